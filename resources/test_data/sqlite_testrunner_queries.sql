@@ -157,6 +157,12 @@ SELECT b FROM mixed LIMIT 10;
 SELECT "right".b FROM mixed AS "left", mixed_null AS "right" WHERE "left".a = "right".a AND "left".b = 2;
 SELECT * FROM mixed AS "left", mixed_null AS "right" WHERE "left".a = "right".d;
 
+-- EXCEPT and INTERSECT
+SELECT a, b FROM id_int_int_int_100 EXCEPT SELECT a, b FROM id_int_int_int_50;
+SELECT a FROM id_int_int_int_100 INTERSECT SELECT b FROM id_int_int_int_50;
+SELECT b, d FROM mixed_null EXCEPT SELECT b, d FROM mixed_null WHERE b > 10;
+SELECT b FROM mixed_null INTERSECT SELECT b FROM mixed_null WHERE c IS NULL;
+
 -- JOIN
 SELECT "left".a, "left".b, "right".a, "right".b FROM mixed AS "left" JOIN mixed_null AS "right" ON "left".b = "right".b;
 SELECT "left".a1, "left".a2, "right".a1 FROM (SELECT a AS a1, a AS a2 FROM mixed) AS "left" JOIN (SELECT a AS a1, a AS a2 FROM mixed_null) AS "right" ON "left".a1 = "right".a2;
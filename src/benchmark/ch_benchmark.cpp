@@ -0,0 +1,61 @@
+#include "benchmark_runner.hpp"
+#include "ch/ch_benchmark_item_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark measures Hyrise's performance executing the mixed workload of the CH-benCHmark (Cole et al.: The
+ * mixed workload CH-benCHmark, 2011). TPC-C transactions and analytical queries run concurrently on the same TPC-C
+ * tables, each with their own clients: --clients transactional clients execute the weighted and shuffled TPC-C
+ * transactions, while --analytical_clients clients execute the analytical queries one after another. The report
+ * contains the results of all items and a summary of the transactional throughput and the analytical latency (see
+ * "mixed_workload" in the JSON output).
+ *
+ * The same limitations as for the TPC-C benchmark apply (see tpcc_benchmark.cpp). Additionally, only the analytical
+ * queries that do not use the SUPPLIER, NATION, and REGION tables are executed (see ch_queries.hpp).
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("CH-benCHmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("analytical_clients", "Specify how many analytical queries should run in parallel to the transactions", cxxopts::value<uint32_t>()->default_value("1")); // NOLINT
+  // clang-format on
+
+  // Parse command line args
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+  const auto num_warehouses = cli_parse_result["scale"].as<size_t>();
+
+  auto config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
+  config->analytical_clients = cli_parse_result["analytical_clients"].as<uint32_t>();
+
+  Assert(config->benchmark_mode == BenchmarkMode::Shuffled, "The mixed workload requires the Shuffled mode");
+  Assert(config->analytical_clients > 0, "Invalid value for --analytical_clients");
+  // As for TPC-C, the concurrent transactions may run into conflicts on both the Hyrise and the SQLite side
+  Assert(!config->verify, "Cannot run verification with concurrent transactional and analytical clients");
+  if (!config->enable_scheduler) {
+    PerformanceWarning("Without the scheduler ('--scheduler'), transactions and queries do not run concurrently");
+  }
+
+  auto context = BenchmarkRunner::create_context(*config);
+
+  std::cout << "- CH-benCHmark scale factor (number of warehouses) is " << num_warehouses << std::endl;
+  std::cout << "- " << config->analytical_clients << " analytical clients are running in parallel" << std::endl;
+
+  // Add CH-benCHmark-specific information
+  context.emplace("scale_factor", num_warehouses);
+  context.emplace("analytical_clients", config->analytical_clients);
+
+  // Run the benchmark
+  auto item_runner = std::make_unique<CHBenchmarkItemRunner>(config, num_warehouses);
+  BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
+                  context)
+      .run();
+}
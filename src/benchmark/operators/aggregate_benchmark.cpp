@@ -8,12 +8,39 @@
 #include "operators/aggregate_sort.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 using namespace opossum::expression_functional;  // NOLINT
 
+namespace {
+
+// Groups by a column with the given distribution of group values and aggregates a uniformly distributed column. The
+// table has the same size as the tables of the MicroBenchmarkBasicFixture.
+void bm_aggregate_hash_skewed(benchmark::State& state, const ColumnDataDistribution& group_distribution) {
+  const auto table = SyntheticTableGenerator::generate_table(
+      {{group_distribution, DataType::Int}, {ColumnDataDistribution::make_uniform_config(0.0, 10'000), DataType::Int}},
+      40'000, ChunkOffset{2'000});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(min_(pqp_column_(ColumnID{1}, DataType::Int, false, "b")))};
+
+  std::vector<ColumnID> groupby = {ColumnID{0}};
+
+  auto warm_up = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+}
+
+}  // namespace
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHash)(benchmark::State& state) {
   _clear_cache();
 
@@ -30,6 +57,16 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHash)(benchmark::State& stat
   }
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHashZipf)(benchmark::State& state) {
+  _clear_cache();
+  bm_aggregate_hash_skewed(state, ColumnDataDistribution::make_zipf_config(0.0, 10'000, 1.0));
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHashHotKey)(benchmark::State& state) {
+  _clear_cache();
+  bm_aggregate_hash_skewed(state, ColumnDataDistribution::make_hot_key_config(0.0, 10'000, 0.5, 10));
+}
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateSortNotSortedNoGroupBy)(benchmark::State& state) {
   _clear_cache();
 
@@ -21,6 +21,9 @@ constexpr auto TABLE_SIZE_SMALL = size_t{1'000};
 constexpr auto TABLE_SIZE_MEDIUM = size_t{100'000};
 constexpr auto TABLE_SIZE_BIG = size_t{10'000'000};
 
+// The join keys are drawn from [0, MAX_KEY]
+constexpr auto MAX_KEY = 10'000.0;
+
 void clear_cache() {
   std::vector<int> clear = std::vector<int>();
   clear.resize(500 * 1000 * 1000, 42);
@@ -33,14 +36,14 @@ void clear_cache() {
 
 namespace opossum {
 
-std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
-  auto table_generator = std::make_shared<SyntheticTableGenerator>();
-
+std::shared_ptr<TableWrapper> generate_table(
+    const size_t number_of_rows,
+    const ColumnDataDistribution& distribution = ColumnDataDistribution::make_uniform_config(0.0, MAX_KEY)) {
   const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
   Assert(chunk_size > 0, "The chunk size is 0 or less, can not generate such a table");
 
-  auto table =
-      table_generator->generate_table(1ul, number_of_rows, chunk_size, SegmentEncodingSpec{EncodingType::Dictionary});
+  auto table = SyntheticTableGenerator::generate_table(
+      {{distribution, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary}}}, number_of_rows, chunk_size);
 
   const auto chunk_count = table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -99,6 +102,26 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// For the skewed benchmarks, only the right input is skewed. With a uniform left input, the expected output size is
+// the same as for BM_Join_MediumAndMedium, so that differences stem from partition imbalance and hot keys.
+template <class C>
+void BM_Join_MediumAndMediumZipf(benchmark::State& state) {  // NOLINT 100,000 x 100,000, Zipf exponent of 1
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right =
+      generate_table(TABLE_SIZE_MEDIUM, ColumnDataDistribution::make_zipf_config(0.0, MAX_KEY, 1.0));
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+template <class C>
+void BM_Join_MediumAndMediumHotKey(benchmark::State& state) {  // NOLINT 100,000 x 100,000, half of the rows on 1 key
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right =
+      generate_table(TABLE_SIZE_MEDIUM, ColumnDataDistribution::make_hot_key_config(0.0, MAX_KEY, 0.5, 1));
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -108,9 +131,13 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumZipf, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumHotKey, JoinHash);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumZipf, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumHotKey, JoinSortMerge);
 
 }  // namespace opossum
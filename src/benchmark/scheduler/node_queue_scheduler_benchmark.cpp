@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "utils/load_table.hpp"
+
+/**
+ * Overheads of the NodeQueueScheduler, its TaskQueues, and the tasks themselves, which dominate the execution of small
+ * queries. The first argument of each benchmark is the number of workers. As the fake-NUMA topology does not use more
+ * workers than there are cores, larger arguments are capped on smaller machines.
+ */
+
+namespace opossum {
+
+// Workers are spread over (fake) NUMA nodes with a queue each, so that tasks of an imbalanced load have to be stolen
+static void use_node_queue_scheduler(const size_t worker_count, const size_t node_count = 1) {
+  Hyrise::get().topology.use_fake_numa_topology(static_cast<uint32_t>(worker_count),
+                                                static_cast<uint32_t>(std::max(worker_count / node_count, size_t{1})));
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+}
+
+static void use_immediate_execution_scheduler() {
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Keeps a worker busy without touching memory that other workers use
+static void spin(const std::chrono::nanoseconds duration) {
+  const auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end) {}
+}
+
+static std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t task_count,
+                                                               const std::function<void()>& fn) {
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>(fn));
+  }
+  return tasks;
+}
+
+// Time from scheduling a task until a worker starts executing it
+static void BM_NodeQueueScheduler_SpawnToExecuteLatency(benchmark::State& state) {
+  use_node_queue_scheduler(state.range(0));
+
+  for (auto _ : state) {
+    auto execution_start = std::chrono::steady_clock::time_point{};
+    const auto task = std::make_shared<JobTask>([&]() { execution_start = std::chrono::steady_clock::now(); });
+
+    const auto schedule_start = std::chrono::steady_clock::now();
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({task});
+    state.SetIterationTime(std::chrono::duration<double>(execution_start - schedule_start).count());
+  }
+
+  use_immediate_execution_scheduler();
+}
+
+static void BM_NodeQueueScheduler_EmptyTaskThroughput(benchmark::State& state) {
+  use_node_queue_scheduler(state.range(0));
+  constexpr auto TASK_COUNT = size_t{10'000};
+
+  for (auto _ : state) {
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(create_tasks(TASK_COUNT, []() {}));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * TASK_COUNT));
+
+  use_immediate_execution_scheduler();
+}
+
+// A chain, where each task can only run once its predecessor is done, and a fan-in of independent tasks into one
+static void BM_NodeQueueScheduler_WaitForDependencies(benchmark::State& state) {
+  use_node_queue_scheduler(state.range(0));
+  constexpr auto TASK_COUNT = size_t{1'000};
+  const auto is_chain = state.range(1) == 0;
+  state.SetLabel(is_chain ? "chain" : "fan-in");
+
+  for (auto _ : state) {
+    auto tasks = create_tasks(TASK_COUNT, []() {});
+    for (auto task_id = size_t{0}; task_id + 1 < TASK_COUNT; ++task_id) {
+      tasks[task_id]->set_as_predecessor_of(is_chain ? tasks[task_id + 1] : tasks.back());
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * TASK_COUNT));
+
+  use_immediate_execution_scheduler();
+}
+
+// All tasks are pushed to the queue of the first of two nodes, so that the workers of the second node have to steal.
+// Compare with the balanced load, whose tasks are distributed over both nodes.
+static void BM_NodeQueueScheduler_StealingUnderImbalance(benchmark::State& state) {
+  use_node_queue_scheduler(state.range(0), 2);
+  constexpr auto TASK_COUNT = size_t{2'000};
+  const auto is_imbalanced = state.range(1) == 1;
+  state.SetLabel(is_imbalanced ? "imbalanced" : "balanced");
+
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  for (auto _ : state) {
+    const auto tasks = create_tasks(TASK_COUNT, []() { spin(std::chrono::microseconds{10}); });
+    for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+      tasks[task_id]->schedule(is_imbalanced ? NodeID{0} : NodeID{static_cast<uint32_t>(task_id % node_count)});
+    }
+    AbstractScheduler::wait_for_tasks(tasks);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * TASK_COUNT));
+
+  use_immediate_execution_scheduler();
+}
+
+// Tasks that schedule tasks themselves and wait for them, e.g., operators that parallelize their work
+static void BM_NodeQueueScheduler_NestedScheduleAndWait(benchmark::State& state) {
+  use_node_queue_scheduler(state.range(0));
+  constexpr auto OUTER_TASK_COUNT = size_t{16};
+  constexpr auto INNER_TASK_COUNT = size_t{64};
+
+  for (auto _ : state) {
+    const auto outer_tasks = create_tasks(OUTER_TASK_COUNT, []() {
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(create_tasks(INNER_TASK_COUNT, []() {}));
+    });
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(outer_tasks);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * OUTER_TASK_COUNT * (INNER_TASK_COUNT + 1)));
+
+  use_immediate_execution_scheduler();
+}
+
+// A tiny plan of three operators executed as OperatorTasks, i.e., the scheduling overhead of a small query. With zero
+// workers, the operators are executed directly for comparison.
+static void BM_NodeQueueScheduler_OperatorTasks(benchmark::State& state) {
+  const auto worker_count = static_cast<size_t>(state.range(0));
+  if (worker_count > 0) use_node_queue_scheduler(worker_count);
+
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl");
+  for (auto _ : state) {
+    const auto table_wrapper_a = std::make_shared<TableWrapper>(table);
+    const auto table_wrapper_b = std::make_shared<TableWrapper>(table);
+    const auto union_all = std::make_shared<UnionAll>(table_wrapper_a, table_wrapper_b);
+
+    if (worker_count > 0) {
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(union_all));
+    } else {
+      table_wrapper_a->execute();
+      table_wrapper_b->execute();
+      union_all->execute();
+    }
+  }
+
+  if (worker_count > 0) use_immediate_execution_scheduler();
+}
+
+BENCHMARK(BM_NodeQueueScheduler_SpawnToExecuteLatency)->RangeMultiplier(2)->Range(1, 16)->UseManualTime();
+BENCHMARK(BM_NodeQueueScheduler_EmptyTaskThroughput)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_NodeQueueScheduler_WaitForDependencies)
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->Args({4, 0})
+    ->Args({4, 1})
+    ->Args({16, 0})
+    ->Args({16, 1})
+    ->UseRealTime();
+BENCHMARK(BM_NodeQueueScheduler_StealingUnderImbalance)
+    ->Args({2, 0})
+    ->Args({2, 1})
+    ->Args({4, 0})
+    ->Args({4, 1})
+    ->Args({16, 0})
+    ->Args({16, 1})
+    ->UseRealTime();
+BENCHMARK(BM_NodeQueueScheduler_NestedScheduleAndWait)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_NodeQueueScheduler_OperatorTasks)->Arg(0)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+}  // namespace opossum
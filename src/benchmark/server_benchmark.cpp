@@ -0,0 +1,299 @@
+#include <libpq-fe.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <cxxopts.hpp>
+#include <nlohmann/json.hpp>
+
+#include "hyrise.hpp"
+#include "server/server.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * pgbench-like benchmark of the server: Unlike the other benchmarks, which execute the queries in-process, it starts a
+ * Server and lets --clients connections issue queries through libpq for --time seconds. This covers the costs of the
+ * network, the PostgreSQL protocol (Session and PostgresProtocolHandler), and the ResultSerializer.
+ *
+ * The queries are executed with one of three protocol modes (cf. pgbench's --protocol):
+ *   simple     - Query messages with the parameter as a literal (PQexec)
+ *   extended   - Bind and Execute messages of a statement that each connection prepares once (PQexecPrepared)
+ *   pipelined  - as extended, but --pipeline_depth queries are sent before a single Sync (libpq's pipeline mode)
+ *
+ * As with pgbench's scale factor, the table pgbench_accounts has 100'000 rows per --scale. By default, each query
+ * selects the balance of a random account (pgbench --select-only). --sql replaces the query, e.g., to return larger
+ * results. Its placeholder `?` is set to a random aid.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+constexpr auto ROWS_PER_SCALE = size_t{100'000};
+constexpr auto DEFAULT_SQL = "SELECT abalance FROM pgbench_accounts WHERE aid = ?";
+
+enum class ProtocolMode { Simple, Extended, Pipelined };
+
+struct ClientResult {
+  std::vector<std::chrono::nanoseconds> latencies;
+  size_t error_count{0};
+  std::string first_error;
+};
+
+void generate_accounts_table(const size_t row_count) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("aid", DataType::Int, false);
+  column_definitions.emplace_back("bid", DataType::Int, false);
+  column_definitions.emplace_back("abalance", DataType::Int, false);
+  column_definitions.emplace_back("filler", DataType::String, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+
+  const auto chunk_size = static_cast<size_t>(Chunk::DEFAULT_SIZE);
+  for (auto begin = size_t{0}; begin < row_count; begin += chunk_size) {
+    const auto end = std::min(begin + chunk_size, row_count);
+    auto aids = pmr_vector<int32_t>{};
+    auto bids = pmr_vector<int32_t>{};
+    aids.reserve(end - begin);
+    bids.reserve(end - begin);
+    for (auto row_id = begin; row_id < end; ++row_id) {
+      aids.emplace_back(static_cast<int32_t>(row_id + 1));
+      bids.emplace_back(static_cast<int32_t>(row_id / ROWS_PER_SCALE + 1));
+    }
+
+    // As in pgbench, the filler is blank-padded to 84 characters
+    const auto segments = Segments{std::make_shared<ValueSegment<int32_t>>(std::move(aids)),
+                                   std::make_shared<ValueSegment<int32_t>>(std::move(bids)),
+                                   std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>(end - begin, 0)),
+                                   std::make_shared<ValueSegment<pmr_string>>(
+                                       pmr_vector<pmr_string>(end - begin, pmr_string(84, ' ')))};
+    table->append_chunk(segments, std::make_shared<MvccData>(end - begin, CommitID{0}));
+
+    const auto& chunk = table->last_chunk();
+    chunk->finalize();
+    ChunkEncoder::encode_chunk(chunk, table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+    generate_chunk_pruning_statistics(chunk);
+  }
+
+  Hyrise::get().storage_manager.add_table("pgbench_accounts", table);
+}
+
+bool check_result(PGresult* result, ClientResult& client_result) {
+  const auto status = PQresultStatus(result);
+  const auto succeeded = status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK;
+  if (!succeeded) {
+    if (client_result.error_count == 0) client_result.first_error = PQresultErrorMessage(result);
+    ++client_result.error_count;
+  }
+  PQclear(result);
+  return succeeded;
+}
+
+void run_client(const std::string& connection_string, const std::string& sql, const ProtocolMode protocol_mode,
+                const size_t pipeline_depth, const size_t row_count, const std::chrono::steady_clock::time_point end,
+                const size_t seed, ClientResult& client_result) {
+  auto* const connection = PQconnectdb(connection_string.c_str());
+  Assert(PQstatus(connection) == CONNECTION_OK,
+         std::string{"Could not connect to the server: "} + PQerrorMessage(connection));
+
+  auto random_engine = std::mt19937{static_cast<std::mt19937::result_type>(seed)};
+  auto aid_distribution = std::uniform_int_distribution<size_t>{1, row_count};
+  const auto is_prepared = protocol_mode != ProtocolMode::Simple;
+  if (is_prepared) {
+    Assert(check_result(PQprepare(connection, "query", sql.c_str(), 1, nullptr), client_result),
+           "Could not prepare the query: " + client_result.first_error);
+  }
+
+#ifdef LIBPQ_HAS_PIPELINING
+  if (protocol_mode == ProtocolMode::Pipelined) {
+    Assert(PQenterPipelineMode(connection) == 1, "Could not enter the pipeline mode");
+  }
+#else
+  Assert(protocol_mode != ProtocolMode::Pipelined, "The pipeline mode requires libpq 14 or newer");
+  static_cast<void>(pipeline_depth);
+#endif
+
+  while (std::chrono::steady_clock::now() < end) {
+    const auto aid = std::to_string(aid_distribution(random_engine));
+    const auto* const parameter = aid.c_str();
+    const auto start = std::chrono::steady_clock::now();
+
+    if (protocol_mode == ProtocolMode::Simple) {
+      check_result(PQexec(connection, boost::replace_all_copy(sql, "?", aid).c_str()), client_result);
+    } else if (protocol_mode == ProtocolMode::Extended) {
+      check_result(PQexecPrepared(connection, "query", 1, &parameter, nullptr, nullptr, 0), client_result);
+    } else {
+#ifdef LIBPQ_HAS_PIPELINING
+      // All queries of a batch are sent at once. Their latency is the time until their own result has arrived.
+      for (auto query_id = size_t{0}; query_id < pipeline_depth; ++query_id) {
+        const auto batch_aid = query_id == 0 ? aid : std::to_string(aid_distribution(random_engine));
+        const auto* const batch_parameter = batch_aid.c_str();
+        Assert(PQsendQueryPrepared(connection, "query", 1, &batch_parameter, nullptr, nullptr, 0) == 1,
+               std::string{"Could not send the query: "} + PQerrorMessage(connection));
+      }
+      Assert(PQpipelineSync(connection) == 1, std::string{"Could not send Sync: "} + PQerrorMessage(connection));
+
+      for (auto query_id = size_t{0}; query_id < pipeline_depth; ++query_id) {
+        check_result(PQgetResult(connection), client_result);
+        client_result.latencies.emplace_back(std::chrono::steady_clock::now() - start);
+        // Each query's results are terminated by a nullptr
+        Assert(!PQgetResult(connection), "Unexpected result in the pipeline");
+      }
+
+      auto* const sync_result = PQgetResult(connection);
+      Assert(PQresultStatus(sync_result) == PGRES_PIPELINE_SYNC, "Expected the end of the pipeline");
+      PQclear(sync_result);
+#endif
+      continue;
+    }
+
+    client_result.latencies.emplace_back(std::chrono::steady_clock::now() - start);
+  }
+
+  PQfinish(connection);
+}
+
+// Nearest-rank percentile of sorted latencies
+std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds>& sorted_latencies,
+                                    const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(static_cast<double>(sorted_latencies.size()) * percent / 100.0));
+  return sorted_latencies[std::max(rank, size_t{1}) - 1];
+}
+
+double to_milliseconds(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  cxxopts::Options cli_options("./hyriseBenchmarkServer",
+                               "Benchmarks the server with concurrent libpq connections, similar to pgbench.");
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("s,scale", "Scale factor, i.e., 100'000 rows of pgbench_accounts per unit", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("c,clients", "Number of concurrent connections", cxxopts::value<size_t>()->default_value("8")) // NOLINT
+    ("t,time", "Duration of the benchmark in seconds", cxxopts::value<uint64_t>()->default_value("10")) // NOLINT
+    ("M,protocol", "Protocol mode: simple, extended, or pipelined", cxxopts::value<std::string>()->default_value("simple")) // NOLINT
+    ("pipeline_depth", "Number of queries per Sync in the pipelined protocol mode", cxxopts::value<size_t>()->default_value("16")) // NOLINT
+    ("sql", "Query to run, with a placeholder (?) for a random aid", cxxopts::value<std::string>()->default_value(DEFAULT_SQL)) // NOLINT
+    ("o,output", "JSON file to output results to", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  const auto parsed_options = cli_options.parse(argc, argv);
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto row_count = parsed_options["scale"].as<size_t>() * ROWS_PER_SCALE;
+  const auto client_count = parsed_options["clients"].as<size_t>();
+  const auto duration = std::chrono::seconds{parsed_options["time"].as<uint64_t>()};
+  const auto pipeline_depth = parsed_options["pipeline_depth"].as<size_t>();
+  const auto sql = parsed_options["sql"].as<std::string>();
+  const auto output_path = parsed_options["output"].as<std::string>();
+
+  const auto protocol = boost::to_lower_copy(parsed_options["protocol"].as<std::string>());
+  auto protocol_mode = ProtocolMode::Simple;
+  if (protocol == "extended") {
+    protocol_mode = ProtocolMode::Extended;
+  } else if (protocol == "pipelined") {
+    protocol_mode = ProtocolMode::Pipelined;
+  } else {
+    Assert(protocol == "simple", "Unknown protocol mode: " + protocol);
+  }
+  Assert(client_count > 0 && pipeline_depth > 0, "Expected at least one client and one query per pipeline");
+
+  std::cout << "- Generating " << row_count << " rows of pgbench_accounts" << std::endl;
+  generate_accounts_table(row_count);
+
+  // Port 0 selects a random open port
+  auto server = Server{boost::asio::ip::make_address("127.0.0.1"), 0, SendExecutionInfo::No};
+  auto server_thread = std::thread{[&]() { server.run(); }};
+  while (!server.is_initialized()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server.server_port());
+
+  std::cout << "- Running '" << sql << "' with " << client_count << " clients in the " << protocol
+            << " protocol mode for " << duration.count() << " seconds" << std::endl;
+  auto client_results = std::vector<ClientResult>(client_count);
+  auto client_threads = std::vector<std::thread>{};
+  const auto begin = std::chrono::steady_clock::now();
+  for (auto client_id = size_t{0}; client_id < client_count; ++client_id) {
+    client_threads.emplace_back(run_client, std::cref(connection_string), std::cref(sql), protocol_mode,
+                                pipeline_depth, row_count, begin + duration, client_id,
+                                std::ref(client_results[client_id]));
+  }
+  for (auto& client_thread : client_threads) {
+    client_thread.join();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+  server.shutdown();
+  server_thread.join();
+
+  auto latencies = std::vector<std::chrono::nanoseconds>{};
+  auto error_count = size_t{0};
+  for (const auto& client_result : client_results) {
+    latencies.insert(latencies.end(), client_result.latencies.begin(), client_result.latencies.end());
+    error_count += client_result.error_count;
+    if (client_result.error_count > 0) std::cerr << "Query failed: " << client_result.first_error << std::endl;
+  }
+  Assert(!latencies.empty(), "No query was executed");
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto queries_per_second =
+      static_cast<double>(latencies.size()) / std::chrono::duration<double>(elapsed).count();
+  auto latency_sum = std::chrono::nanoseconds{0};
+  for (const auto latency : latencies) {
+    latency_sum += latency;
+  }
+  const auto mean_latency = latency_sum / latencies.size();
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "- Queries: " << latencies.size() << " (" << error_count << " failed)" << std::endl;
+  std::cout << "- QPS: " << queries_per_second << std::endl;
+  std::cout << "- Latency (ms): mean " << to_milliseconds(mean_latency) << ", p50 "
+            << to_milliseconds(percentile(latencies, 50.0)) << ", p90 " << to_milliseconds(percentile(latencies, 90.0))
+            << ", p99 " << to_milliseconds(percentile(latencies, 99.0)) << ", p99.9 "
+            << to_milliseconds(percentile(latencies, 99.9)) << ", max " << to_milliseconds(latencies.back())
+            << std::endl;
+
+  if (!output_path.empty()) {
+    const auto output = nlohmann::json{{"sql", sql},
+                                       {"protocol", protocol},
+                                       {"clients", client_count},
+                                       {"pipeline_depth", pipeline_depth},
+                                       {"rows", row_count},
+                                       {"duration_ns", std::chrono::nanoseconds{elapsed}.count()},
+                                       {"queries", latencies.size()},
+                                       {"failed_queries", error_count},
+                                       {"queries_per_second", queries_per_second},
+                                       {"latency_mean_ns", mean_latency.count()},
+                                       {"latency_p50_ns", percentile(latencies, 50.0).count()},
+                                       {"latency_p90_ns", percentile(latencies, 90.0).count()},
+                                       {"latency_p99_ns", percentile(latencies, 99.0).count()},
+                                       {"latency_p999_ns", percentile(latencies, 99.9).count()},
+                                       {"latency_max_ns", latencies.back().count()}};
+    std::ofstream{output_path} << std::setw(2) << output << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+/**
+ * Benchmarks single segments for all combinations of data type, value distribution, encoding type, and vector
+ * compression type. Each combination is measured for
+ *   - Encode:              encoding a ValueSegment (ChunkEncoder::encode_segment)
+ *   - Decode:              re-encoding the segment as a ValueSegment
+ *   - SegmentIterate:      segment_iterate(), as used by most operators
+ *   - IterableSequential:  the iterable of create_iterable_from_segment()
+ *   - IterablePointAccess: the iterable with a random position filter
+ *   - AccessorPointAccess: random accesses through a SegmentAccessor
+ *
+ * The benchmarks are named BM_SegmentEncoding/<operation>/<encoding>[-<vector compression>]/<data type>/<distribution>.
+ * To store a baseline, run hyriseMicroBenchmarks with --benchmark_filter=BM_SegmentEncoding
+ * --benchmark_out=<file>.json --benchmark_out_format=json. Next to the time, the JSON reports the processed values per
+ * second (items_per_second) and the size of the encoded segment (segment_bytes).
+ */
+
+namespace opossum {
+
+namespace {
+
+// A single, full chunk. Values are generated with a fixed seed so that runs are comparable.
+constexpr auto ROW_COUNT = Chunk::DEFAULT_SIZE;
+constexpr auto POINT_ACCESS_COUNT = ROW_COUNT / 10;
+constexpr auto LOW_CARDINALITY_DISTINCT_COUNT = 100;
+constexpr auto RUN_LENGTH = 256;
+constexpr auto SEED = 42;
+
+// Longer than the small string optimization of common standard libraries
+constexpr auto STRING_LENGTH = size_t{24};
+
+enum class ValueDistribution { Sorted, Uniform, LowCardinality, Runs };
+
+enum class SegmentOperation {
+  Encode,
+  Decode,
+  SegmentIterate,
+  IterableSequential,
+  IterablePointAccess,
+  AccessorPointAccess
+};
+
+const auto value_distribution_names = std::vector<std::pair<ValueDistribution, std::string>>{
+    {ValueDistribution::Sorted, "Sorted"},
+    {ValueDistribution::Uniform, "Uniform"},
+    {ValueDistribution::LowCardinality, "LowCardinality"},
+    {ValueDistribution::Runs, "Runs"}};
+
+const auto segment_operation_names = std::vector<std::pair<SegmentOperation, std::string>>{
+    {SegmentOperation::Encode, "Encode"},
+    {SegmentOperation::Decode, "Decode"},
+    {SegmentOperation::SegmentIterate, "SegmentIterate"},
+    {SegmentOperation::IterableSequential, "IterableSequential"},
+    {SegmentOperation::IterablePointAccess, "IterablePointAccess"},
+    {SegmentOperation::AccessorPointAccess, "AccessorPointAccess"}};
+
+std::vector<int32_t> generate_values(const ValueDistribution distribution) {
+  auto values = std::vector<int32_t>(ROW_COUNT);
+  auto random_engine = std::mt19937{SEED};
+
+  switch (distribution) {
+    case ValueDistribution::Sorted:
+      std::iota(values.begin(), values.end(), 0);
+      break;
+    case ValueDistribution::Uniform: {
+      auto value_distribution = std::uniform_int_distribution<int32_t>{0, static_cast<int32_t>(ROW_COUNT - 1)};
+      std::generate(values.begin(), values.end(), [&]() { return value_distribution(random_engine); });
+    } break;
+    case ValueDistribution::LowCardinality: {
+      auto value_distribution = std::uniform_int_distribution<int32_t>{0, LOW_CARDINALITY_DISTINCT_COUNT - 1};
+      std::generate(values.begin(), values.end(), [&]() { return value_distribution(random_engine); });
+    } break;
+    case ValueDistribution::Runs: {
+      // Runs of equal values, but the runs themselves are not sorted
+      auto value_distribution = std::uniform_int_distribution<int32_t>{0, static_cast<int32_t>(ROW_COUNT - 1)};
+      for (auto run_begin = size_t{0}; run_begin < values.size(); run_begin += RUN_LENGTH) {
+        const auto run_end = std::min(run_begin + RUN_LENGTH, values.size());
+        std::fill(values.begin() + run_begin, values.begin() + run_end, value_distribution(random_engine));
+      }
+    } break;
+  }
+
+  return values;
+}
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> create_value_segment(const ValueDistribution distribution) {
+  const auto int_values = generate_values(distribution);
+
+  auto values = pmr_vector<T>(int_values.size());
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // The zero padding keeps the order of the integers
+    std::transform(int_values.cbegin(), int_values.cend(), values.begin(), [](const auto value) {
+      const auto string = std::to_string(value);
+      return pmr_string{std::string(STRING_LENGTH - string.size(), '0').append(string)};
+    });
+  } else {
+    std::copy(int_values.cbegin(), int_values.cend(), values.begin());
+  }
+
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+std::shared_ptr<RowIDPosList> generate_positions() {
+  auto random_engine = std::mt19937{SEED};
+  auto offset_distribution = std::uniform_int_distribution<ChunkOffset>{0, ROW_COUNT - 1};
+
+  auto positions = std::make_shared<RowIDPosList>(POINT_ACCESS_COUNT);
+  std::generate(positions->begin(), positions->end(),
+                [&]() { return RowID{ChunkID{0}, offset_distribution(random_engine)}; });
+  positions->guarantee_single_chunk();
+  return positions;
+}
+
+template <typename T>
+void BM_SegmentEncoding(benchmark::State& state, const ValueDistribution distribution,
+                        const SegmentEncodingSpec encoding_spec, const SegmentOperation operation) {
+  const auto data_type = data_type_from_type<T>();
+  const auto value_segment = create_value_segment<T>(distribution);
+  const auto segment = ChunkEncoder::encode_segment(value_segment, data_type, encoding_spec);
+  const auto positions = generate_positions();
+
+  // Consumes the values so that the compiler cannot optimize the accesses away
+  const auto consume = [](const auto& position) {
+    if (!position.is_null()) benchmark::DoNotOptimize(position.value());
+  };
+
+  auto processed_values = size_t{ROW_COUNT};
+
+  switch (operation) {
+    case SegmentOperation::Encode:
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(ChunkEncoder::encode_segment(value_segment, data_type, encoding_spec));
+      }
+      break;
+
+    case SegmentOperation::Decode:
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            ChunkEncoder::encode_segment(segment, data_type, SegmentEncodingSpec{EncodingType::Unencoded}));
+      }
+      break;
+
+    case SegmentOperation::SegmentIterate:
+      for (auto _ : state) {
+        segment_iterate<T>(*segment, consume);
+      }
+      break;
+
+    case SegmentOperation::IterableSequential:
+    case SegmentOperation::IterablePointAccess:
+      if (operation == SegmentOperation::IterablePointAccess) processed_values = POINT_ACCESS_COUNT;
+
+      resolve_segment_type<T>(*segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+          const auto iterable = create_iterable_from_segment<T>(typed_segment);
+          for (auto _ : state) {
+            if (operation == SegmentOperation::IterableSequential) {
+              iterable.for_each(consume);
+            } else {
+              iterable.for_each(positions, consume);
+            }
+          }
+        }
+      });
+      break;
+
+    case SegmentOperation::AccessorPointAccess: {
+      processed_values = POINT_ACCESS_COUNT;
+
+      const auto accessor = create_segment_accessor<T>(segment);
+      for (auto _ : state) {
+        for (const auto& position : *positions) {
+          benchmark::DoNotOptimize(accessor->access(position.chunk_offset));
+        }
+      }
+    } break;
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * processed_values));
+  state.counters["segment_bytes"] =
+      static_cast<double>(segment->memory_usage(MemoryUsageCalculationMode::Full));
+}
+
+// Returns all encoding specs that are supported for the data type, with each vector compression type if the encoding
+// compresses vectors
+std::vector<SegmentEncodingSpec> supported_encoding_specs(const DataType data_type) {
+  auto encoding_specs = std::vector<SegmentEncodingSpec>{};
+  for (const auto encoding_type : all_encoding_types) {
+    if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    // LZ4 only uses SimdBp128 (see base_segment_encoder.hpp)
+    if (encoding_type == EncodingType::Unencoded || encoding_type == EncodingType::LZ4 ||
+        !create_encoder(encoding_type)->uses_vector_compression()) {
+      encoding_specs.emplace_back(encoding_type);
+      continue;
+    }
+
+    for (const auto& vector_compression_type : vector_compression_type_to_string.left) {
+      encoding_specs.emplace_back(encoding_type, vector_compression_type.first);
+    }
+  }
+  return encoding_specs;
+}
+
+std::string encoding_spec_name(const SegmentEncodingSpec& encoding_spec) {
+  auto name = encoding_type_to_string.left.at(encoding_spec.encoding_type);
+  if (encoding_spec.vector_compression_type) {
+    name += "-" + vector_compression_type_to_string.left.at(*encoding_spec.vector_compression_type);
+  }
+  return name;
+}
+
+void register_segment_encoding_benchmarks() {
+  for (const auto data_type : {DataType::Int, DataType::String}) {
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (const auto& encoding_spec : supported_encoding_specs(data_type)) {
+        for (const auto& [distribution, distribution_name] : value_distribution_names) {
+          for (const auto& [operation, operation_name] : segment_operation_names) {
+            const auto name = "BM_SegmentEncoding/" + operation_name + "/" + encoding_spec_name(encoding_spec) + "/" +
+                              data_type_to_string.left.at(data_type) + "/" + distribution_name;
+            benchmark::RegisterBenchmark(name.c_str(), BM_SegmentEncoding<ColumnDataType>, distribution,
+                                         encoding_spec, operation);
+          }
+        }
+      }
+    });
+  }
+}
+
+// As in table_scan_sorted_benchmark.cpp, a global object registers the benchmarks so that they are not included in
+// the hyriseBenchmarkPlayground.
+class StartUp {
+ public:
+  StartUp() { register_segment_encoding_benchmarks(); }
+};
+StartUp startup;
+
+}  // namespace
+
+}  // namespace opossum
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <nlohmann/json.hpp>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "file_based_table_generator.hpp"
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_literal_normalizer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_workload_recorder.hpp"
+
+/**
+ * Replays a workload that was captured by the WorkloadCapturePlugin (see sql_workload_recorder.hpp) against the tables
+ * in --table_path, e.g., a snapshot of the production data, to evaluate a different configuration or version of Hyrise
+ * with the production workload.
+ *
+ * Each recorded session is replayed by its own thread, which issues the statements in their recorded order and at
+ * their recorded start times, divided by --speed. A speed of 0 issues the statements of each session as fast as
+ * possible. Transactions that were committed through the TransactionContext instead of a COMMIT statement are
+ * committed when the next statement of the session ran outside of them.
+ *
+ * The latencies are reported per normalized query (see sql_literal_normalizer.hpp), comparing the recorded and the
+ * replayed executions. Statements whose outcome differs (e.g., because of transaction conflicts) are counted as well.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+using Record = SQLWorkloadRecorder::Record;
+
+struct ReplayedStatement {
+  std::chrono::nanoseconds duration{0};
+  bool succeeded{false};
+};
+
+struct QueryLatencies {
+  std::vector<std::chrono::nanoseconds> recorded_durations;
+  std::vector<std::chrono::nanoseconds> replayed_durations;
+  size_t mismatch_count{0};
+};
+
+void replay_session(const std::vector<Record>& records, const std::vector<size_t>& record_ids,
+                    const std::chrono::steady_clock::time_point begin, const double speed,
+                    std::vector<ReplayedStatement>& replayed_statements) {
+  auto transaction_context = std::shared_ptr<TransactionContext>{};
+  // Whether the transaction was started by the replay instead of a BEGIN statement
+  auto owns_transaction = false;
+  auto recorded_transaction_id = INVALID_TRANSACTION_ID;
+
+  const auto end_owned_transaction = [&]() {
+    if (owns_transaction && transaction_context->phase() == TransactionPhase::Active) {
+      transaction_context->commit();
+    }
+    transaction_context = nullptr;
+    owns_transaction = false;
+  };
+
+  for (const auto record_id : record_ids) {
+    const auto& record = records[record_id];
+    if (speed > 0.0) {
+      std::this_thread::sleep_until(
+          begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(record.start / speed));
+    }
+
+    if (record.transaction_id != recorded_transaction_id) {
+      // The recorded transaction ended without a COMMIT or ROLLBACK statement, i.e., through its TransactionContext
+      if (owns_transaction) end_owned_transaction();
+
+      // Statements of a transaction that was not started by BEGIN
+      if (record.transaction_id != INVALID_TRANSACTION_ID && !transaction_context) {
+        transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+        owns_transaction = true;
+      }
+      recorded_transaction_id = record.transaction_id;
+    }
+
+    auto builder = SQLPipelineBuilder{record.sql}.with_session_id(record.session_id);
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    auto pipeline = builder.create_pipeline();
+
+    auto& replayed_statement = replayed_statements[record_id];
+    const auto start = std::chrono::steady_clock::now();
+    try {
+      replayed_statement.succeeded = pipeline.get_result_table().first == SQLPipelineStatus::Success;
+      transaction_context = pipeline.transaction_context();
+    } catch (const std::exception&) {
+      // E.g., a table that is missing in the snapshot. The statement is reported as failed.
+      replayed_statement.succeeded = false;
+      if (transaction_context && transaction_context->phase() == TransactionPhase::Active) {
+        transaction_context->rollback(RollbackReason::User);
+      }
+      transaction_context = nullptr;
+    }
+    replayed_statement.duration = std::chrono::steady_clock::now() - start;
+
+    if (!transaction_context) owns_transaction = false;
+  }
+
+  if (owns_transaction) {
+    end_owned_transaction();
+  } else if (transaction_context && transaction_context->phase() == TransactionPhase::Active) {
+    // The capture ended before the transaction did
+    transaction_context->rollback(RollbackReason::User);
+  }
+}
+
+// Nearest-rank percentile
+std::chrono::nanoseconds percentile(std::vector<std::chrono::nanoseconds> durations, const size_t percent) {
+  const auto rank = (durations.size() * percent + 99) / 100 - 1;
+  std::nth_element(durations.begin(), durations.begin() + rank, durations.end());
+  return durations[rank];
+}
+
+std::chrono::nanoseconds total(const std::vector<std::chrono::nanoseconds>& durations) {
+  auto sum = std::chrono::nanoseconds{0};
+  for (const auto duration : durations) {
+    sum += duration;
+  }
+  return sum;
+}
+
+std::chrono::nanoseconds mean(const std::vector<std::chrono::nanoseconds>& durations) {
+  return total(durations) / durations.size();
+}
+
+double to_milliseconds(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("Hyrise Workload Replay");
+
+  // clang-format off
+  cli_options.add_options()
+      ("workload", "Workload log written by the WorkloadCapturePlugin", cxxopts::value<std::string>()->default_value("hyrise_workload.log")) // NOLINT
+      ("table_path", "Directory containing the snapshot of the tables as csv, tbl or binary files", cxxopts::value<std::string>()->default_value(".")) // NOLINT
+      ("speed", "Factor that the recorded pace of the statements is scaled by, 0 replays them as fast as possible", cxxopts::value<double>()->default_value("1.0")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+  const auto workload_path = cli_parse_result["workload"].as<std::string>();
+  const auto table_path = cli_parse_result["table_path"].as<std::string>();
+  const auto speed = cli_parse_result["speed"].as<double>();
+  if (speed < 0.0) {
+    std::cerr << "--speed must not be negative" << std::endl;
+    return 1;
+  }
+
+  const auto config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
+
+  const auto records = SQLWorkloadRecorder::read(workload_path);
+  std::cout << "- Replaying " << records.size() << " statements from " << workload_path << " at speed " << speed
+            << std::endl;
+
+  if (config->enable_scheduler) {
+    Hyrise::get().topology.use_default_topology(config->cores);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+  Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+
+  FileBasedTableGenerator{config, table_path}.generate_and_store();
+
+  auto record_ids_by_session = std::map<SessionID, std::vector<size_t>>{};
+  for (auto record_id = size_t{0}; record_id < records.size(); ++record_id) {
+    record_ids_by_session[records[record_id].session_id].emplace_back(record_id);
+  }
+
+  // Each thread only writes the entries of its own session's records
+  auto replayed_statements = std::vector<ReplayedStatement>(records.size());
+  const auto begin = std::chrono::steady_clock::now();
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(record_ids_by_session.size());
+  for (const auto& [session_id, record_ids] : record_ids_by_session) {
+    threads.emplace_back(replay_session, std::cref(records), std::cref(record_ids), begin, speed,
+                         std::ref(replayed_statements));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto replay_duration = std::chrono::steady_clock::now() - begin;
+
+  auto latencies_by_query = std::map<std::string, QueryLatencies>{};
+  for (auto record_id = size_t{0}; record_id < records.size(); ++record_id) {
+    const auto& record = records[record_id];
+    const auto normalized_sql = normalize_sql_literals(record.sql);
+    auto& latencies = latencies_by_query[normalized_sql ? normalized_sql->sql : record.sql];
+    latencies.recorded_durations.emplace_back(record.duration);
+    latencies.replayed_durations.emplace_back(replayed_statements[record_id].duration);
+    if (replayed_statements[record_id].succeeded != record.succeeded) ++latencies.mismatch_count;
+  }
+
+  // The queries that took the most time in the recording first
+  auto queries = std::vector<std::pair<std::string, const QueryLatencies*>>{};
+  for (const auto& [sql, latencies] : latencies_by_query) {
+    queries.emplace_back(sql, &latencies);
+  }
+  std::sort(queries.begin(), queries.end(), [](const auto& lhs, const auto& rhs) {
+    return total(lhs.second->recorded_durations) > total(rhs.second->recorded_durations);
+  });
+
+  std::cout << "- Replay took " << to_milliseconds(replay_duration) << " ms" << std::endl;
+  std::cout << std::fixed << std::setprecision(3);
+  auto json_queries = nlohmann::json::array();
+  for (const auto& [sql, latencies] : queries) {
+    const auto recorded_mean = mean(latencies->recorded_durations);
+    const auto replayed_mean = mean(latencies->replayed_durations);
+    const auto change = recorded_mean.count() > 0
+                            ? 100.0 * (static_cast<double>(replayed_mean.count()) / recorded_mean.count() - 1.0)
+                            : 0.0;
+
+    std::cout << sql << std::endl;
+    std::cout << "    executions: " << latencies->recorded_durations.size() << ", mean: "
+              << to_milliseconds(recorded_mean) << " ms -> " << to_milliseconds(replayed_mean) << " ms ("
+              << std::showpos << change << std::noshowpos << " %), p99: "
+              << to_milliseconds(percentile(latencies->recorded_durations, 99)) << " ms -> "
+              << to_milliseconds(percentile(latencies->replayed_durations, 99)) << " ms";
+    if (latencies->mismatch_count > 0) std::cout << ", different outcome: " << latencies->mismatch_count;
+    std::cout << std::endl;
+
+    json_queries.push_back({{"sql", sql},
+                            {"executions", latencies->recorded_durations.size()},
+                            {"recorded_mean_ns", recorded_mean.count()},
+                            {"replayed_mean_ns", replayed_mean.count()},
+                            {"recorded_p99_ns", percentile(latencies->recorded_durations, 99).count()},
+                            {"replayed_p99_ns", percentile(latencies->replayed_durations, 99).count()},
+                            {"different_outcomes", latencies->mismatch_count}});
+  }
+
+  if (config->output_file_path) {
+    auto output = nlohmann::json{{"context", BenchmarkRunner::create_context(*config)},
+                                 {"workload", workload_path},
+                                 {"speed", speed},
+                                 {"replay_duration_ns", std::chrono::nanoseconds{replay_duration}.count()},
+                                 {"queries", json_queries}};
+    std::ofstream{*config->output_file_path} << std::setw(2) << output << std::endl;
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
@@ -78,4 +78,9 @@ const std::vector<int>& AbstractBenchmarkItemRunner::weights() const {
   return empty_vector;
 }
 
+const std::vector<BenchmarkItemID>& AbstractBenchmarkItemRunner::analytical_items() const {
+  static const std::vector<BenchmarkItemID> empty_vector;
+  return empty_vector;
+}
+
 }  // namespace opossum
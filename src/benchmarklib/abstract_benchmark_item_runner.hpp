@@ -52,6 +52,11 @@ class AbstractBenchmarkItemRunner {
   // the TPC-C benchmark, where not all transactions are executed equally often.
   virtual const std::vector<int>& weights() const;
 
+  // Returns the items that are executed by separate analytical clients (see BenchmarkConfig::analytical_clients) in
+  // the Shuffled mode, for example the queries of the mixed CH-benCHmark. All other items are executed by the regular
+  // clients. By default, no items are analytical.
+  virtual const std::vector<BenchmarkItemID>& analytical_items() const;
+
  protected:
   // Executes the benchmark item with the given ID. BenchmarkItemRunners should not use the SQL pipeline directly,
   // but use the provided BenchmarkSQLExecutor. That class not only tracks the execution metrics and provides them
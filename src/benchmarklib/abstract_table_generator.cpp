@@ -3,13 +3,16 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/list_directory.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -19,6 +22,7 @@ void to_json(nlohmann::json& json, const TableGenerationMetrics& metrics) {
           {"encoding_duration", metrics.encoding_duration.count()},
           {"binary_caching_duration", metrics.binary_caching_duration.count()},
           {"sort_duration", metrics.sort_duration.count()},
+          {"numa_placement_duration", metrics.numa_placement_duration.count()},
           {"store_duration", metrics.store_duration.count()},
           {"index_duration", metrics.index_duration.count()}};
 }
@@ -239,6 +243,19 @@ void AbstractTableGenerator::generate_and_store() {
               << std::endl;
   }
 
+  /**
+   * Distribute the chunks across the NUMA nodes, so that scans read node-local memory
+   */
+  if (Hyrise::get().topology.nodes().size() > 1) {
+    std::cout << "- Placing chunks on " << Hyrise::get().topology.nodes().size() << " NUMA nodes" << std::endl;
+    for (auto& [table_name, table_info] : table_info_by_name) {
+      place_chunks_on_numa_nodes(table_info.table);
+    }
+    metrics.numa_placement_duration = timer.lap();
+    std::cout << "- Placing chunks on NUMA nodes done (" << format_duration(metrics.numa_placement_duration) << ")"
+              << std::endl;
+  }
+
   /**
    * Add the Tables to the StorageManager
    */
@@ -323,6 +340,45 @@ AbstractTableGenerator::SortOrderByTable AbstractTableGenerator::_sort_order_by_
 void AbstractTableGenerator::_add_constraints(
     std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {}
 
+std::optional<std::unordered_map<std::string, BenchmarkTableInfo>>
+AbstractTableGenerator::_load_binary_tables_from_cache(const std::filesystem::path& cache_directory) const {
+  const auto table_files = list_directory(cache_directory);
+
+  auto tables = std::vector<std::shared_ptr<Table>>(table_files.size());
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(table_files.size());
+  for (auto file_id = size_t{0}; file_id < table_files.size(); ++file_id) {
+    threads.emplace_back([&, file_id] {
+      const auto& table_file = table_files[file_id];
+      Timer per_table_timer;
+      tables[file_id] = BinaryParser::parse(table_file);
+      auto output = std::stringstream{};
+      output << "-  Loaded table " << table_file.stem() << " from cached binary " << table_file.relative_path()
+             << " (" << per_table_timer.lap_formatted() << ")\n";
+      std::cout << output.str() << std::flush;
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  auto table_info_by_name = std::unordered_map<std::string, BenchmarkTableInfo>{};
+  for (auto file_id = size_t{0}; file_id < table_files.size(); ++file_id) {
+    const auto& table = tables[file_id];
+    const auto& table_file = table_files[file_id];
+    if (table->chunk_count() > 1 && table->get_chunk(ChunkID{0})->size() != _benchmark_config->chunk_size) {
+      std::cout << "-  Cached table " << table_file.stem() << " has a mismatching chunk size of "
+                << table->get_chunk(ChunkID{0})->size() << ", discarding the cache" << std::endl;
+      return std::nullopt;
+    }
+
+    auto& table_info = table_info_by_name[table_file.stem()];
+    table_info.table = table;
+    table_info.loaded_from_binary = true;
+    table_info.binary_file_path = table_file;
+  }
+
+  return table_info_by_name;
+}
+
 bool AbstractTableGenerator::_all_chunks_sorted_by(const std::shared_ptr<Table>& table,
                                                    const SortColumnDefinition& sort_column) {
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <optional>
 #include <unordered_map>
 
 #include "encoding_config.hpp"
@@ -41,6 +42,7 @@ struct TableGenerationMetrics {
   std::chrono::nanoseconds encoding_duration{};
   std::chrono::nanoseconds binary_caching_duration{};
   std::chrono::nanoseconds sort_duration{};
+  std::chrono::nanoseconds numa_placement_duration{};
   std::chrono::nanoseconds store_duration{};
   std::chrono::nanoseconds index_duration{};
 };
@@ -76,6 +78,13 @@ class AbstractTableGenerator {
   // Optionally, the benchmark may add constraints once the tables are generated / loaded from binary
   virtual void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const;
 
+  // Loads the binary files of a benchmark's table cache (one file per table) in parallel. Each file is memory-mapped
+  // and its chunks are imported in parallel by the BinaryParser. Every table is validated right after it was loaded.
+  // If any table does not match the benchmark configuration (currently, the chunk size), the cache is stale and
+  // std::nullopt is returned so that the benchmark re-generates the tables and overwrites the cache.
+  std::optional<std::unordered_map<std::string, BenchmarkTableInfo>> _load_binary_tables_from_cache(
+      const std::filesystem::path& cache_directory) const;
+
   const std::shared_ptr<BenchmarkConfig> _benchmark_config;
 
   static bool _all_chunks_sorted_by(const std::shared_ptr<Table>& table, const SortColumnDefinition& sort_column);
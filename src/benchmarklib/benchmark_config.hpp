@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <vector>
 
 #include "encoding_config.hpp"
 #include "storage/chunk.hpp"
@@ -43,6 +44,34 @@ class BenchmarkConfig {
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool metrics = false;
 
+  // If set, the runtimes of the executed operators are used to calibrate the cost model, which is written to this file
+  std::optional<std::string> cost_model_calibration_file_path = std::nullopt;
+  // If set, the optimizer and the LQPTranslator use the calibrated cost model stored in this file
+  std::optional<std::string> cost_model_file_path = std::nullopt;
+
+  // Number of clients that execute the analytical items of mixed workloads in the Shuffled mode, in addition to the
+  // `clients` that execute the remaining items (see AbstractBenchmarkItemRunner::analytical_items)
+  uint32_t analytical_clients = 0;
+
+  // Runs that begin within this duration after the start of an item's measurement are excluded from the latency
+  // histograms in the JSON output (e.g., to let caches and the mix of the Shuffled mode reach a steady state). Other
+  // than the runs of the warmup_duration, they still count towards items_per_second.
+  Duration latency_warmup_duration = std::chrono::seconds(0);
+  // Width of the buckets of the per-item throughput and latency time series in the JSON output
+  Duration time_series_interval = std::chrono::seconds(1);
+
+  // If not empty, the benchmark is executed once for each combination of these core and client counts instead of once
+  // for `cores` and `clients`. An empty `sweep_clients` means that only `clients` is used. The tables are generated
+  // only once (see BenchmarkRunner::run).
+  std::vector<uint32_t> sweep_cores;
+  std::vector<uint32_t> sweep_clients;
+
+  // If positive, the Shuffled mode generates load in an open loop: (non-analytical) items arrive following a Poisson
+  // process with this many arrivals per second and are scheduled independently of how many runs are currently
+  // executing. The time that runs wait for the scheduler is reported as their queueing delay. Otherwise, each of the
+  // `clients` schedules its next item only once its previous one has finished (closed loop).
+  double arrival_rate = 0.0;
+
  private:
   BenchmarkConfig() = default;
 };
@@ -22,6 +22,10 @@ struct BenchmarkItemResult {
   // the entire benchmark.
   Duration duration{0};
 
+  // Stores the begin of the measured runs (i.e., after the warmup), measured as time since start of benchmark. The
+  // `begin` of the runs is relative to the same point in time.
+  Duration measurement_begin{0};
+
   // The *optional* is set if the verification was executed; the *bool* is true if the verification succeeded.
   std::atomic<std::optional<bool>> verification_passed{std::nullopt};
 };
@@ -3,7 +3,11 @@
 namespace opossum {
 
 BenchmarkItemRunResult::BenchmarkItemRunResult(Duration init_begin, Duration init_duration,
-                                               std::vector<SQLPipelineMetrics> init_metrics)
-    : begin(init_begin), duration(init_duration), metrics(std::move(init_metrics)) {}
+                                               std::vector<SQLPipelineMetrics> init_metrics,
+                                               Duration init_queueing_delay)
+    : begin(init_begin),
+      duration(init_duration),
+      queueing_delay(init_queueing_delay),
+      metrics(std::move(init_metrics)) {}
 
 }  // namespace opossum
@@ -9,7 +9,8 @@ namespace opossum {
 
 // Stores the result of a SINGLE run of a single benchmark item (e.g., one execution of TPC-H query 5).
 struct BenchmarkItemRunResult {
-  BenchmarkItemRunResult(Duration init_begin, Duration init_duration, std::vector<SQLPipelineMetrics> init_metrics);
+  BenchmarkItemRunResult(Duration init_begin, Duration init_duration, std::vector<SQLPipelineMetrics> init_metrics,
+                         Duration init_queueing_delay = Duration{0});
 
   // Stores the begin timestamp of this run (measured as time since start of benchmark)
   Duration begin;
@@ -17,6 +18,10 @@ struct BenchmarkItemRunResult {
   // Stores the runtime of this run
   Duration duration;
 
+  // For open-loop runs (see BenchmarkConfig::arrival_rate), stores the time between the arrival of the run and its
+  // begin, i.e., the time spent waiting for the scheduler. The response time of the run is queueing_delay + duration.
+  Duration queueing_delay;
+
   // Holds one entry per SQLPipeline executed as part of a run of this item. For benchmarks like TPC-H, where each
   // item corresponds to a single TPC-H query, this vector always has a size of 1. For others, like TPC-C, there
   // are multiple SQL queries executed and thus multiple entries in the inner vector.
@@ -1,5 +1,6 @@
 #include "benchmark_runner.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <random>
@@ -14,6 +15,7 @@
 
 #include "benchmark_config.hpp"
 #include "constant_mappings.hpp"
+#include "cost_estimation/cost_model_calibration.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -77,9 +79,30 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
 }
 
 void BenchmarkRunner::run() {
+  if (!_config.sweep_cores.empty()) {
+    _run_sweep();
+    return;
+  }
+
+  _run_benchmark();
+}
+
+void BenchmarkRunner::_run_benchmark() {
   std::cout << "- Starting Benchmark..." << std::endl;
 
+  if (_config.cost_model_file_path) {
+    auto cost_model_json = nlohmann::json{};
+    std::ifstream{*_config.cost_model_file_path} >> cost_model_json;
+    Hyrise::get().cost_model_coefficients =
+        std::make_shared<const CostModelCoefficients>(CostModelCoefficients::from_json(cost_model_json));
+  }
+
+  if (_config.cost_model_calibration_file_path) {
+    Hyrise::get().cost_model_calibration = std::make_shared<CostModelCalibration>();
+  }
+
   _benchmark_start = std::chrono::system_clock::now();
+  _total_finished_runs = 0;
 
   auto track_system_utilization = std::atomic_bool{_config.metrics};
   auto system_utilization_tracker = std::thread{[&] {
@@ -136,6 +159,14 @@ void BenchmarkRunner::run() {
   auto benchmark_end = std::chrono::system_clock::now();
   _total_run_duration = benchmark_end - _benchmark_start;
 
+  if (_config.cost_model_calibration_file_path) {
+    const auto& cost_model_calibration = *Hyrise::get().cost_model_calibration;
+    std::cout << "- Calibrating the cost model with " << cost_model_calibration.sample_count() << " samples"
+              << std::endl;
+    std::ofstream{*_config.cost_model_calibration_file_path} << cost_model_calibration.train().to_json().dump(2);
+    Hyrise::get().cost_model_calibration = nullptr;
+  }
+
   // Create report
   if (_config.output_file_path) {
     if (!_config.verify && !_config.enable_visualization) {
@@ -152,10 +183,25 @@ void BenchmarkRunner::run() {
     for (const auto& item_id : items) {
       std::cout << "- Results for " << _benchmark_item_runner->item_name(item_id) << std::endl;
       std::cout << "  -> Executed " << _results[item_id].successful_runs.size() << " times" << std::endl;
+      if (_config.arrival_rate > 0.0 && !_results[item_id].successful_runs.empty()) {
+        const auto [queueing_delay_histogram, response_time_histogram] = _open_loop_histograms(_results[item_id]);
+        const auto milliseconds = [](const uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1e6; };
+        std::cout << "  -> Response time p50/p99: " << milliseconds(response_time_histogram.percentile(50.0)) << "/"
+                  << milliseconds(response_time_histogram.percentile(99.0)) << " ms, thereof queueing delay: "
+                  << milliseconds(queueing_delay_histogram.percentile(50.0)) << "/"
+                  << milliseconds(queueing_delay_histogram.percentile(99.0)) << " ms" << std::endl;
+      }
       if (!_results[item_id].unsuccessful_runs.empty()) {
         std::cout << "  -> " << _results[item_id].unsuccessful_runs.size() << " additional runs failed" << std::endl;
       }
     }
+
+    if (!_benchmark_item_runner->analytical_items().empty()) {
+      const auto summary = _mixed_workload_summary();
+      std::cout << "- Transactional throughput: " << summary["transactional_items_per_second"].get<double>()
+                << " iter/s, analytical latency: "
+                << summary["analytical_mean_latency"].get<double>() / 1'000'000 << " ms/iter" << std::endl;
+    }
   }
 
   // Fail if verification against SQLite was requested and failed
@@ -182,8 +228,112 @@ void BenchmarkRunner::run() {
   system_utilization_tracker.join();
 }
 
+void BenchmarkRunner::_run_sweep() {
+  const auto sweep_clients =
+      _config.sweep_clients.empty() ? std::vector<uint32_t>{_config.clients} : _config.sweep_clients;
+
+  // Instead of one report per step, a combined report is written below
+  const auto output_file_path = _config.output_file_path;
+  _config.output_file_path = std::nullopt;
+
+  auto steps = nlohmann::json::array();
+  for (const auto cores : _config.sweep_cores) {
+    for (const auto clients : sweep_clients) {
+      // As in the constructor, the workers of the scheduler are pinned to the cores of the topology
+      Hyrise::get().topology.use_default_topology(cores);
+      Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+      _config.cores = cores;
+      _config.clients = clients;
+
+      std::cout << "- Sweep step with " << Hyrise::get().topology.num_cpus() << " cores and " << clients
+                << " clients" << std::endl;
+      _run_benchmark();
+      steps.push_back(_sweep_step_summary());
+    }
+  }
+
+  _config.output_file_path = output_file_path;
+
+  // The first step is the baseline for the speedup. The efficiency is the speedup per additional core, i.e., 1.0 for
+  // a linear scale-up.
+  const auto baseline_items_per_second = steps.front()["items_per_second"].get<double>();
+  const auto baseline_cores = steps.front()["cores"].get<double>();
+  std::cout << "- Scalability (baseline: " << baseline_cores << " cores, " << steps.front()["clients"] << " clients)"
+            << std::endl;
+  for (auto& step : steps) {
+    const auto speedup =
+        baseline_items_per_second > 0.0 ? step["items_per_second"].get<double>() / baseline_items_per_second : 0.0;
+    const auto efficiency = speedup * baseline_cores / step["cores"].get<double>();
+    step["speedup"] = speedup;
+    step["efficiency"] = efficiency;
+
+    for (auto item_index = size_t{0}; item_index < step["benchmarks"].size(); ++item_index) {
+      auto& benchmark = step["benchmarks"][item_index];
+      const auto baseline_item_items_per_second =
+          steps.front()["benchmarks"][item_index]["items_per_second"].get<double>();
+      benchmark["speedup"] = baseline_item_items_per_second > 0.0
+                                 ? benchmark["items_per_second"].get<double>() / baseline_item_items_per_second
+                                 : 0.0;
+    }
+
+    std::cout << "  -> " << step["cores"] << " cores, " << step["clients"] << " clients: "
+              << step["items_per_second"].get<double>() << " iter/s (speedup: " << speedup
+              << ", efficiency: " << efficiency << ")" << std::endl;
+  }
+
+  if (_config.output_file_path && !_config.verify) {
+    std::ofstream output_file(*_config.output_file_path);
+    output_file << std::setw(2) << nlohmann::json{{"context", _context}, {"sweep", std::move(steps)}} << std::endl;
+  }
+}
+
+nlohmann::json BenchmarkRunner::_sweep_step_summary() const {
+  const auto to_seconds = [](const Duration duration) {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+           1'000'000'000.0;
+  };
+
+  auto successful_runs = size_t{0};
+  auto duration = Duration{0};
+  auto benchmarks = nlohmann::json::array();
+  for (const auto& item_id : _benchmark_item_runner->items()) {
+    const auto& result = _results.at(item_id);
+    successful_runs += result.successful_runs.size();
+    if (_config.benchmark_mode == BenchmarkMode::Ordered) duration += result.duration;
+
+    benchmarks.push_back(nlohmann::json{
+        {"name", _benchmark_item_runner->item_name(item_id)},
+        {"items_per_second", static_cast<double>(result.successful_runs.size()) / to_seconds(result.duration)},
+        {"latency", _latency_histogram(result).to_json(false)}});
+  }
+  // For the Shuffled mode, the duration of each item is the duration of the entire benchmark
+  if (_config.benchmark_mode == BenchmarkMode::Shuffled) duration = _state.benchmark_duration;
+
+  auto numa_cores_per_node = std::vector<size_t>();
+  for (const auto& node : Hyrise::get().topology.nodes()) {
+    numa_cores_per_node.push_back(node.cpus.size());
+  }
+
+  return nlohmann::json{{"cores", Hyrise::get().topology.num_cpus()},
+                        {"utilized_cores_per_numa_node", numa_cores_per_node},
+                        {"clients", _config.clients},
+                        {"items_per_second", static_cast<double>(successful_runs) / to_seconds(duration)},
+                        {"benchmarks", std::move(benchmarks)}};
+}
+
 void BenchmarkRunner::_benchmark_shuffled() {
-  auto item_ids = _benchmark_item_runner->items();
+  // Analytical items are executed in order by their own clients, all other items are shuffled
+  const auto& analytical_item_ids = _benchmark_item_runner->analytical_items();
+  const auto is_analytical = [&](const BenchmarkItemID item_id) {
+    return std::find(analytical_item_ids.begin(), analytical_item_ids.end(), item_id) != analytical_item_ids.end();
+  };
+  Assert(analytical_item_ids.empty() || _config.analytical_clients > 0,
+         "Analytical items require at least one analytical client");
+
+  auto item_ids = std::vector<BenchmarkItemID>{};
+  for (const auto& item_id : _benchmark_item_runner->items()) {
+    if (!is_analytical(item_id)) item_ids.emplace_back(item_id);
+  }
 
   if (const auto& weights = _benchmark_item_runner->weights(); !weights.empty()) {
     auto item_ids_weighted = std::vector<BenchmarkItemID>{};
@@ -195,8 +345,9 @@ void BenchmarkRunner::_benchmark_shuffled() {
   }
 
   auto item_ids_shuffled = std::vector<BenchmarkItemID>{};
+  auto next_analytical_item_index = size_t{0};
 
-  for (const auto& item_id : item_ids) {
+  for (const auto& item_id : _benchmark_item_runner->items()) {
     _warmup(item_id);
   }
 
@@ -204,25 +355,63 @@ void BenchmarkRunner::_benchmark_shuffled() {
   std::random_device random_device;
   std::mt19937 random_generator(random_device());
 
+  const auto next_item_id = [&]() {
+    if (item_ids_shuffled.empty()) {
+      item_ids_shuffled = item_ids;
+      std::shuffle(item_ids_shuffled.begin(), item_ids_shuffled.end(), random_generator);
+    }
+
+    const auto item_id = item_ids_shuffled.back();
+    item_ids_shuffled.pop_back();
+    return item_id;
+  };
+
+  // For the open-loop load generation, the times between two arrivals are exponentially distributed
+  const auto open_loop = _config.arrival_rate > 0.0;
+  auto inter_arrival_time_distribution = std::exponential_distribution<double>{open_loop ? _config.arrival_rate : 1.0};
+  const auto next_inter_arrival_time = [&]() {
+    return std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::duration<double>{inter_arrival_time_distribution(random_generator)});
+  };
+
   Assert(_currently_running_clients == 0, "Did not expect any clients to run at this time");
 
   _state = BenchmarkState{_config.max_duration};
+  const auto measurement_begin = std::chrono::system_clock::now() - _benchmark_start;
+  for (auto& result : _results) {
+    result.measurement_begin = measurement_begin;
+  }
+  auto next_arrival = std::chrono::system_clock::now() + next_inter_arrival_time();
 
   while (_state.keep_running() && (_config.max_runs < 0 || _total_finished_runs.load(std::memory_order_relaxed) <
                                                                static_cast<size_t>(_config.max_runs))) {
-    // We want to only schedule as many items simultaneously as we have simulated clients
-    if (_currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
-      if (item_ids_shuffled.empty()) {
-        item_ids_shuffled = item_ids;
-        std::shuffle(item_ids_shuffled.begin(), item_ids_shuffled.end(), random_generator);
+    auto scheduled_item = false;
+
+    if (open_loop) {
+      // Schedule all items that have arrived by now. If this thread was woken up late, the runs still count their
+      // queueing delay from their arrival so that the delay is not hidden (coordinated omission).
+      while (!item_ids.empty() && std::chrono::system_clock::now() >= next_arrival) {
+        _schedule_item_run(next_item_id(), false, next_arrival);
+        next_arrival += next_inter_arrival_time();
+        scheduled_item = true;
       }
+    } else if (!item_ids.empty() && _currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
+      // We want to only schedule as many items simultaneously as we have simulated clients
+      _schedule_item_run(next_item_id());
+      scheduled_item = true;
+    }
 
-      const auto item_id = item_ids_shuffled.back();
-      item_ids_shuffled.pop_back();
+    if (!analytical_item_ids.empty() &&
+        _currently_running_analytical_clients.load(std::memory_order_relaxed) < _config.analytical_clients) {
+      _schedule_item_run(analytical_item_ids[next_analytical_item_index], true);
+      next_analytical_item_index = (next_analytical_item_index + 1) % analytical_item_ids.size();
+      scheduled_item = true;
+    }
 
-      _schedule_item_run(item_id);
-    } else {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (!scheduled_item) {
+      auto wake_up = std::chrono::system_clock::now() + std::chrono::milliseconds(10);
+      if (open_loop) wake_up = std::min(wake_up, next_arrival);
+      std::this_thread::sleep_until(wake_up);
     }
   }
   _state.set_done();
@@ -234,7 +423,8 @@ void BenchmarkRunner::_benchmark_shuffled() {
 
   // Wait for the rest of the tasks that didn't make it in time - they will not count towards the results
   Hyrise::get().scheduler()->wait_for_all_tasks();
-  Assert(_currently_running_clients == 0, "All runs must be finished at this point");
+  Assert(_currently_running_clients == 0 && _currently_running_analytical_clients == 0,
+         "All runs must be finished at this point");
 
   _snapshot_segment_access_counters("End of Benchmark");
 }
@@ -251,6 +441,7 @@ void BenchmarkRunner::_benchmark_ordered() {
     Assert(_currently_running_clients == 0, "Did not expect any clients to run at this time");
 
     _state = BenchmarkState{_config.max_duration};
+    result.measurement_begin = std::chrono::system_clock::now() - _benchmark_start;
 
     while (_state.keep_running() &&
            (_config.max_runs < 0 || (result.successful_runs.size() + result.unsuccessful_runs.size()) <
@@ -302,17 +493,20 @@ void BenchmarkRunner::_benchmark_ordered() {
   }
 }
 
-void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id) {
-  _currently_running_clients++;
+void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id, const bool analytical,
+                                         const std::optional<std::chrono::system_clock::time_point>& arrival) {
+  auto& running_clients = analytical ? _currently_running_analytical_clients : _currently_running_clients;
+  running_clients++;
   BenchmarkItemResult& result = _results[item_id];
 
   auto task = std::make_shared<JobTask>(
-      [&, item_id]() {
+      [&, &running_clients = running_clients, item_id, arrival]() {
         const auto run_start = std::chrono::system_clock::now();
+        const auto queueing_delay = arrival ? Duration{run_start - *arrival} : Duration{0};
         auto [success, metrics, any_run_verification_failed] = _benchmark_item_runner->execute_item(item_id);
         const auto run_end = std::chrono::system_clock::now();
 
-        --_currently_running_clients;
+        --running_clients;
         ++_total_finished_runs;
 
         // If result.verification_passed was previously unset, set it; otherwise only invalidate it if the run failed.
@@ -321,7 +515,8 @@ void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id) {
         if (!_state.is_done()) {  // To prevent items from adding their result after the time is up
           if (!_config.metrics) metrics.clear();
           const auto item_result =
-              BenchmarkItemRunResult{run_start - _benchmark_start, run_end - run_start, std::move(metrics)};
+              BenchmarkItemRunResult{run_start - _benchmark_start, run_end - run_start, std::move(metrics),
+                                     queueing_delay};
           if (success) {
             result.successful_runs.push_back(item_result);
           } else {
@@ -404,6 +599,7 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
 
         runs_json.push_back(nlohmann::json{{"begin", run_result.begin.count()},
                                            {"duration", run_result.duration.count()},
+                                           {"queueing_delay", run_result.queueing_delay.count()},
                                            {"metrics", all_pipeline_metrics_json}});
       }
       return runs_json;
@@ -430,6 +626,14 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     // includes successful iterations.
     benchmark["items_per_second"] = items_per_second;
 
+    benchmark["latency"] = _latency_histogram(result).to_json();
+    if (_config.arrival_rate > 0.0) {
+      const auto [queueing_delay_histogram, response_time_histogram] = _open_loop_histograms(result);
+      benchmark["queueing_delay"] = queueing_delay_histogram.to_json();
+      benchmark["response_time"] = response_time_histogram.to_json();
+    }
+    benchmark["time_series"] = _time_series(result);
+
     benchmarks.push_back(benchmark);
   }
 
@@ -454,6 +658,10 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                         {"summary", std::move(summary)},
                         {"table_generation", _table_generator->metrics}};
 
+  if (_config.benchmark_mode == BenchmarkMode::Shuffled && !_benchmark_item_runner->analytical_items().empty()) {
+    report["mixed_workload"] = _mixed_workload_summary();
+  }
+
   if (Hyrise::get().storage_manager.has_table("benchmark_system_utilization_log")) {
     report["system_utilization"] = _sql_to_json("SELECT * FROM benchmark_system_utilization_log");
   }
@@ -465,6 +673,102 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
   stream << std::setw(2) << report << std::endl;
 }
 
+LatencyHistogram BenchmarkRunner::_latency_histogram(const BenchmarkItemResult& result) const {
+  const auto latency_warmup_end = result.measurement_begin + _config.latency_warmup_duration;
+
+  auto histogram = LatencyHistogram{};
+  for (const auto& run_result : result.successful_runs) {
+    if (run_result.begin < latency_warmup_end) continue;
+    histogram.record(run_result.duration);
+  }
+  return histogram;
+}
+
+std::pair<LatencyHistogram, LatencyHistogram> BenchmarkRunner::_open_loop_histograms(
+    const BenchmarkItemResult& result) const {
+  const auto latency_warmup_end = result.measurement_begin + _config.latency_warmup_duration;
+
+  auto queueing_delay_histogram = LatencyHistogram{};
+  auto response_time_histogram = LatencyHistogram{};
+  for (const auto& run_result : result.successful_runs) {
+    if (run_result.begin < latency_warmup_end) continue;
+    queueing_delay_histogram.record(run_result.queueing_delay);
+    response_time_histogram.record(run_result.queueing_delay + run_result.duration);
+  }
+  return {queueing_delay_histogram, response_time_histogram};
+}
+
+nlohmann::json BenchmarkRunner::_time_series(const BenchmarkItemResult& result) const {
+  // Runs are assigned to the bucket in which they began. Unlike the latency histogram of the item, this includes the
+  // runs of the latency warmup so that the time series shows how long it takes to reach a steady state.
+  auto bucket_histograms = std::vector<LatencyHistogram>{};
+  for (const auto& run_result : result.successful_runs) {
+    const auto bucket_id =
+        static_cast<size_t>(std::max(run_result.begin - result.measurement_begin, Duration{0}) /
+                            _config.time_series_interval);
+    if (bucket_id >= bucket_histograms.size()) bucket_histograms.resize(bucket_id + 1);
+    bucket_histograms[bucket_id].record(run_result.duration);
+  }
+
+  auto time_series_json = nlohmann::json::array();
+  for (auto bucket_id = size_t{0}; bucket_id < bucket_histograms.size(); ++bucket_id) {
+    const auto bucket_begin = _config.time_series_interval * static_cast<Duration::rep>(bucket_id);
+
+    // The last bucket is usually cut short by the end of the measurement
+    auto bucket_duration = std::min(_config.time_series_interval, result.duration - bucket_begin);
+    if (bucket_duration <= Duration{0}) bucket_duration = _config.time_series_interval;
+    const auto bucket_duration_seconds =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(bucket_duration).count()) /
+        1'000'000'000.0;
+
+    const auto& histogram = bucket_histograms[bucket_id];
+    time_series_json.push_back(
+        nlohmann::json{{"begin", std::chrono::duration_cast<std::chrono::nanoseconds>(bucket_begin).count()},
+                       {"items_per_second", static_cast<double>(histogram.count()) / bucket_duration_seconds},
+                       {"latency", histogram.to_json(false)}});
+  }
+  return time_series_json;
+}
+
+nlohmann::json BenchmarkRunner::_mixed_workload_summary() const {
+  const auto& analytical_item_ids = _benchmark_item_runner->analytical_items();
+
+  auto transactional_runs = size_t{0};
+  auto analytical_runs = size_t{0};
+  auto analytical_duration = Duration{0};
+  auto analytical_histogram = LatencyHistogram{};
+  for (const auto& item_id : _benchmark_item_runner->items()) {
+    const auto& result = _results.at(item_id);
+    if (std::find(analytical_item_ids.begin(), analytical_item_ids.end(), item_id) == analytical_item_ids.end()) {
+      transactional_runs += result.successful_runs.size();
+      continue;
+    }
+
+    analytical_runs += result.successful_runs.size();
+    for (const auto& run_result : result.successful_runs) {
+      analytical_duration += run_result.duration;
+    }
+    analytical_histogram.merge(_latency_histogram(result));
+  }
+
+  const auto duration_seconds =
+      static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()) /
+      1'000'000'000.0;
+  const auto analytical_mean_latency =
+      analytical_runs == 0 ? 0.0
+                           : static_cast<double>(
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(analytical_duration).count()) /
+                                 static_cast<double>(analytical_runs);
+
+  // The latency is given in nanoseconds, as the durations of the individual runs (see "time_unit" in the context)
+  return nlohmann::json{{"clients", _config.clients},
+                        {"analytical_clients", _config.analytical_clients},
+                        {"transactional_items_per_second", static_cast<double>(transactional_runs) / duration_seconds},
+                        {"analytical_items_per_second", static_cast<double>(analytical_runs) / duration_seconds},
+                        {"analytical_mean_latency", analytical_mean_latency},
+                        {"analytical_latency", analytical_histogram.to_json(false)}};
+}
+
 cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& benchmark_name) {
   cxxopts::Options cli_options{benchmark_name};
 
@@ -478,10 +782,11 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
   // some point. The way this is solved here is not really nice, but as the TPC-C benchmark binary has just a main
   // method and not a class, retrieving this default value properly would require some major refactoring of how
   // benchmarks interact with the BenchmarkRunner. At this moment, that does not seem to be worth the effort.
-  const auto* const default_mode = (benchmark_name == "TPC-C Benchmark" ? "Shuffled" : "Ordered");
+  const auto is_tpcc = benchmark_name == "TPC-C Benchmark" || benchmark_name == "CH-benCHmark";
+  const auto* const default_mode = (is_tpcc ? "Shuffled" : "Ordered");
 
   // TPC-C does not support binary caching
-  const auto* const default_dont_cache_binary_tables = (benchmark_name == "TPC-C Benchmark" ? "true" : "false");
+  const auto* const default_dont_cache_binary_tables = (is_tpcc ? "true" : "false");
 
   // clang-format off
   cli_options.add_options()
@@ -491,6 +796,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("c,chunk_size", "Chunk size", cxxopts::value<ChunkOffset>()->default_value(std::to_string(Chunk::DEFAULT_SIZE))) // NOLINT
     ("t,time", "Runtime - per item for Ordered, total for Shuffled", cxxopts::value<uint64_t>()->default_value("60")) // NOLINT
     ("w,warmup", "Number of seconds that each item is run for warm up", cxxopts::value<uint64_t>()->default_value("0")) // NOLINT
+    ("latency_warmup", "Number of seconds at the beginning of each measurement whose runs are excluded from the latency histograms", cxxopts::value<uint64_t>()->default_value("0")) // NOLINT
+    ("time_series_interval", "Width of the buckets of the throughput and latency time series in the JSON output, in milliseconds", cxxopts::value<uint64_t>()->default_value("1000")) // NOLINT
     ("o,output", "JSON file to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value("")) // NOLINT
     ("m,mode", "Ordered or Shuffled", cxxopts::value<std::string>()->default_value(default_mode)) // NOLINT
     ("e,encoding", "Specify Chunk encoding as a string or as a JSON config file (for more detailed configuration, see --full_help). String options: " + encoding_strings_option, cxxopts::value<std::string>()->default_value("Dictionary"))  // NOLINT
@@ -499,10 +806,15 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
     ("clients", "Specify how many items should run in parallel if the scheduler is active", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
+    ("arrival_rate", "Shuffled mode only: schedule items in an open loop with this many Poisson arrivals per second instead of using closed-loop clients", cxxopts::value<double>()->default_value("0")) // NOLINT
+    ("sweep_cores", "Repeat the benchmark for each of these comma-separated core counts and report the speedup (requires --scheduler)", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("sweep_clients", "Comma-separated client counts that are combined with each of the --sweep_cores", cxxopts::value<std::string>()->default_value("")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value(default_dont_cache_binary_tables)) // NOLINT
-    ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("cost_model_calibration", "Calibrate the cost model with the operator runtimes and write it to this JSON file", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("cost_model", "Use the calibrated cost model from this JSON file (see --cost_model_calibration)", cxxopts::value<std::string>()->default_value("")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -537,9 +849,16 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"max_runs", config.max_runs},
       {"max_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.max_duration).count()},
       {"warmup_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.warmup_duration).count()},
+      {"latency_warmup_duration",
+       std::chrono::duration_cast<std::chrono::nanoseconds>(config.latency_warmup_duration).count()},
+      {"time_series_interval",
+       std::chrono::duration_cast<std::chrono::nanoseconds>(config.time_series_interval).count()},
       {"using_scheduler", config.enable_scheduler},
       {"cores", config.cores},
       {"clients", config.clients},
+      {"arrival_rate", config.arrival_rate},
+      {"sweep_cores", config.sweep_cores},
+      {"sweep_clients", config.sweep_clients},
       {"verify", config.verify},
       {"time_unit", "ns"},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
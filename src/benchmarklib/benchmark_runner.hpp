@@ -16,6 +16,7 @@
 #include "abstract_table_generator.hpp"
 #include "benchmark_item_result.hpp"
 #include "benchmark_state.hpp"
+#include "latency_histogram.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -42,6 +43,8 @@ class BenchmarkRunner : public Noncopyable {
   BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractBenchmarkItemRunner> benchmark_item_runner,
                   std::unique_ptr<AbstractTableGenerator> table_generator, const nlohmann::json& context);
 
+  // Runs the benchmark and writes the report. If `sweep_cores` is set, the benchmark is repeated for each combination
+  // of core and client counts and a single report with the throughput, speedup, and efficiency of each step is written.
   void run();
 
   static cxxopts::Options get_basic_cli_options(const std::string& benchmark_name);
@@ -52,6 +55,15 @@ class BenchmarkRunner : public Noncopyable {
   std::shared_ptr<SQLiteWrapper> sqlite_wrapper;
 
  private:
+  // Runs the benchmark once with the current scheduler, cores, and clients
+  void _run_benchmark();
+
+  // Runs the benchmark for each combination of sweep_cores and sweep_clients (see BenchmarkConfig)
+  void _run_sweep();
+
+  // Summarizes the throughput of the last call of _run_benchmark for _run_sweep
+  nlohmann::json _sweep_step_summary() const;
+
   // Run benchmark in BenchmarkMode::Shuffled mode
   void _benchmark_shuffled();
 
@@ -62,8 +74,23 @@ class BenchmarkRunner : public Noncopyable {
   void _warmup(const BenchmarkItemID item_id);
 
   // Schedules a run of the specified for execution. After execution, the result is updated. If the scheduler is
-  // disabled, the item is executed immediately.
-  void _schedule_item_run(const BenchmarkItemID item_id);
+  // disabled, the item is executed immediately. Analytical items are counted towards the analytical clients. For
+  // open-loop runs, `arrival` is the point in time from which the queueing delay of the run is measured.
+  void _schedule_item_run(const BenchmarkItemID item_id, const bool analytical = false,
+                          const std::optional<std::chrono::system_clock::time_point>& arrival = std::nullopt);
+
+  // Returns the histogram of the successful runs of an item, excluding the runs of the latency warmup
+  LatencyHistogram _latency_histogram(const BenchmarkItemResult& result) const;
+
+  // For open-loop runs, returns the histograms of the queueing delays and of the response times (i.e., queueing delay
+  // plus duration) of the successful runs of an item, excluding the runs of the latency warmup
+  std::pair<LatencyHistogram, LatencyHistogram> _open_loop_histograms(const BenchmarkItemResult& result) const;
+
+  // Returns the throughput and latency of the successful runs of an item per time_series_interval
+  nlohmann::json _time_series(const BenchmarkItemResult& result) const;
+
+  // For mixed workloads, summarizes the throughput of the transactional items and the latency of the analytical items
+  nlohmann::json _mixed_workload_summary() const;
 
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
@@ -75,7 +102,8 @@ class BenchmarkRunner : public Noncopyable {
   // to identify a certain point in the benchmark, e.g., when an item is finished in the ordered mode.
   void _snapshot_segment_access_counters(const std::string& moment = "");
 
-  const BenchmarkConfig _config;
+  // Not const, as _run_sweep changes the cores and clients between the steps
+  BenchmarkConfig _config;
 
   std::unique_ptr<AbstractBenchmarkItemRunner> _benchmark_item_runner;
   std::unique_ptr<AbstractTableGenerator> _table_generator;
@@ -95,6 +123,7 @@ class BenchmarkRunner : public Noncopyable {
   // The atomic uints are modified by other threads when finishing an item, to keep track of when we can
   // let a simulated client schedule the next item, as well as the total number of finished items so far
   std::atomic_uint _currently_running_clients{0};
+  std::atomic_uint _currently_running_analytical_clients{0};
 
   // For BenchmarkMode::Shuffled, we count the number of runs executed across all items. This also includes items that
   // were unsuccessful (e.g., because of transaction aborts).
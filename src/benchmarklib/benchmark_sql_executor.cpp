@@ -1,11 +1,63 @@
 #include "benchmark_sql_executor.hpp"
 
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+#include "hyrise.hpp"
+#include "server/query_handler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "utils/check_table_equal.hpp"
 #include "utils/timer.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Prepared statements are named after their SQL string and shared by all executors
+std::mutex prepare_statement_mutex;
+
+// The generic plans are cached per worker thread, as a PreparedPlanCache must not be accessed concurrently
+thread_local PreparedPlanCache prepared_plan_cache;  // NOLINT
+
+std::string insert_parameters(const std::string& sql, const std::vector<AllTypeVariant>& parameters) {
+  auto stream = std::ostringstream{};
+  stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  auto parameter_iter = parameters.begin();
+  auto is_quoted = false;
+  for (const auto character : sql) {
+    if (character == '\'') is_quoted = !is_quoted;
+    if (character != '?' || is_quoted) {
+      stream << character;
+      continue;
+    }
+
+    Assert(parameter_iter != parameters.end(), "Too few parameters for statement: " + sql);
+    const auto& parameter = *parameter_iter;
+    ++parameter_iter;
+    if (variant_is_null(parameter)) {
+      stream << "NULL";
+    } else if (const auto* const string = boost::get<pmr_string>(&parameter)) {
+      stream << '\'';
+      for (const auto string_character : *string) {
+        if (string_character == '\'') stream << '\'';
+        stream << string_character;
+      }
+      stream << '\'';
+    } else {
+      stream << parameter;
+    }
+  }
+  Assert(parameter_iter == parameters.end(), "Too many parameters for statement: " + sql);
+  return stream.str();
+}
+
+}  // namespace
+
 namespace opossum {
 BenchmarkSQLExecutor::BenchmarkSQLExecutor(const std::shared_ptr<SQLiteWrapper>& sqlite_wrapper,
                                            const std::optional<std::string>& visualize_prefix)
@@ -47,6 +99,32 @@ std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> BenchmarkSQLExecutor:
   return {pipeline_status, result_table};
 }
 
+std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> BenchmarkSQLExecutor::execute_prepared(
+    const std::string& sql, const std::vector<AllTypeVariant>& parameters) {
+  // Verification and visualization work on SQL pipelines
+  if (_sqlite_connection || _visualize_prefix) return execute(insert_parameters(sql, parameters));
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_prepared_plan(sql)) {
+    const auto lock = std::lock_guard<std::mutex>{prepare_statement_mutex};
+    if (!storage_manager.has_prepared_plan(sql)) QueryHandler::setup_prepared_plan(sql, sql);
+  }
+
+  const auto pqp = QueryHandler::bind_prepared_plan({sql, "", parameters}, prepared_plan_cache);
+
+  auto statement_transaction_context = transaction_context;
+  if (!statement_transaction_context) {
+    statement_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  }
+  pqp->set_transaction_context_recursively(statement_transaction_context);
+
+  const auto result_table = QueryHandler::execute_prepared_plan(pqp);
+  if (statement_transaction_context->aborted()) return {SQLPipelineStatus::Failure, nullptr};
+  if (statement_transaction_context->is_auto_commit()) statement_transaction_context->commit();
+
+  return {SQLPipelineStatus::Success, result_table};
+}
+
 BenchmarkSQLExecutor::~BenchmarkSQLExecutor() {
   if (transaction_context) {
     Assert(transaction_context->phase() == TransactionPhase::Committed ||
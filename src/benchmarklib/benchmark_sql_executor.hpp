@@ -25,6 +25,15 @@ class BenchmarkSQLExecutor {
   std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> execute(
       const std::string& sql, const std::shared_ptr<const Table>& expected_result_table = nullptr);
 
+  // Executes a statement with placeholders (?) for the parameters, e.g., "SELECT * FROM t WHERE a = ?". The statement
+  // is parsed and translated into a prepared plan once per process. Afterwards, the parameters are bound to the plans
+  // cached by QueryHandler::bind_prepared_plan, which skips parsing and, once the generic plan is used, optimization
+  // and translation. Thus, values that differ between executions should be parameters, not literals. If verification
+  // or visualization are enabled, the parameters are inserted into the SQL string, which is then executed by execute().
+  // Prepared executions do not record metrics.
+  std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> execute_prepared(
+      const std::string& sql, const std::vector<AllTypeVariant>& parameters);
+
   // If auto-commit is disabled, explicitly commit / roll back the transaction
   void commit();
   void rollback();
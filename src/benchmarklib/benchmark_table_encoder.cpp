@@ -55,11 +55,8 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
 
 namespace opossum {
 
-bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                                   const EncodingConfig& encoding_config) {
-  /**
-   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
-   */
+ChunkEncodingSpec BenchmarkTableEncoder::chunk_encoding_spec(const std::string& table_name, const Table& table,
+                                                             const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -68,10 +65,10 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   ChunkEncodingSpec chunk_encoding_spec;
 
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     // Check if a column specific encoding was specified
     if (table_has_custom_encoding) {
-      const auto& column_name = table->column_name(column_id);
+      const auto& column_name = table.column_name(column_id);
       const auto& encoding_by_column_name = column_mapping_it->second;
       const auto& segment_encoding = encoding_by_column_name.find(column_name);
       if (segment_encoding != encoding_by_column_name.end()) {
@@ -82,7 +79,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
 
     // Check if a type specific encoding was specified
-    const auto& column_data_type = table->column_data_type(column_id);
+    const auto& column_data_type = table.column_data_type(column_id);
     const auto& encoding_by_data_type = type_mapping.find(column_data_type);
     if (encoding_by_data_type != type_mapping.end()) {
       // The column type has a specific encoding
@@ -95,7 +92,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
-      std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
+      std::cout << " - Column '" << table_name << "." << table.column_name(column_id) << "' of type ";
       std::cout << column_data_type << " cannot be encoded as ";
       std::cout << encoding_config.default_encoding_spec.encoding_type << " and is ";
       std::cout << "left Unencoded." << std::endl;
@@ -103,6 +100,16 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
   }
 
+  return chunk_encoding_spec;
+}
+
+bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                   const EncodingConfig& encoding_config) {
+  /**
+   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
+   */
+  const auto chunk_encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, *table, encoding_config);
+
   /**
    * 2. Actually encode chunks
    */
@@ -139,4 +146,79 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
   return encoding_performed;
 }
 
+BackgroundChunkEncoder::BackgroundChunkEncoder(const EncodingConfig& encoding_config)
+    : _encoding_config(encoding_config) {
+  // The generator occupies one core
+  const auto thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+  _threads.reserve(thread_count);
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    _threads.emplace_back([&] { _work(); });
+  }
+}
+
+BackgroundChunkEncoder::~BackgroundChunkEncoder() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _shutdown = true;
+  }
+  _task_added.notify_all();
+
+  for (auto& thread : _threads) thread.join();
+}
+
+void BackgroundChunkEncoder::encode_chunk(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                          const ChunkID chunk_id) {
+  const auto& chunk = table->get_chunk(chunk_id);
+  if (chunk->is_mutable()) chunk->finalize();
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    auto& chunk_encoding_spec = _chunk_encoding_specs[table];
+    if (!chunk_encoding_spec) {
+      chunk_encoding_spec = std::make_shared<const ChunkEncodingSpec>(
+          BenchmarkTableEncoder::chunk_encoding_spec(table_name, *table, _encoding_config));
+    }
+    _tasks.emplace_back(Task{table, chunk_id, chunk_encoding_spec});
+  }
+  _task_added.notify_one();
+}
+
+void BackgroundChunkEncoder::encode_table(const std::string& table_name, const std::shared_ptr<Table>& table) {
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    encode_chunk(table_name, table, chunk_id);
+  }
+}
+
+void BackgroundChunkEncoder::wait() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _task_done.wait(lock, [&] { return _tasks.empty() && _running_task_count == 0; });
+}
+
+void BackgroundChunkEncoder::_work() {
+  while (true) {
+    auto task = Task{};
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      _task_added.wait(lock, [&] { return _shutdown || !_tasks.empty(); });
+      if (_tasks.empty()) return;
+
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+      ++_running_task_count;
+    }
+
+    const auto chunk = task.table->get_chunk(task.chunk_id);
+    if (!is_chunk_encoding_spec_satisfied(*task.chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
+      ChunkEncoder::encode_chunk(chunk, task.table->column_data_types(), *task.chunk_encoding_spec);
+    }
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      --_running_task_count;
+    }
+    _task_done.notify_all();
+  }
+}
+
 }  // namespace opossum
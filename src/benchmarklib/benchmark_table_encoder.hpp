@@ -1,7 +1,16 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
@@ -15,6 +24,58 @@ class BenchmarkTableEncoder {
   //              false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                      const EncodingConfig& encoding_config);
+
+  // The encoding of the table's segments as requested by the @param encoding_config
+  static ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name, const Table& table,
+                                               const EncodingConfig& encoding_config);
+};
+
+/**
+ * Encodes the chunks of tables while the tables are still being generated. The data generators of TPC-H and TPC-DS
+ * are not thread-safe and add rows in a single thread. Each chunk that they complete is handed to this encoder,
+ * which finalizes it and encodes it in one of its worker threads, so that encoding overlaps with generation instead of
+ * being a separate pass. BenchmarkTableEncoder::encode() skips the chunks that are already encoded as requested.
+ * Like BenchmarkTableEncoder, it uses threads instead of JobTasks to be parallel even if the scheduler is disabled.
+ */
+class BackgroundChunkEncoder {
+ public:
+  explicit BackgroundChunkEncoder(const EncodingConfig& encoding_config);
+  ~BackgroundChunkEncoder();
+
+  BackgroundChunkEncoder(const BackgroundChunkEncoder&) = delete;
+  BackgroundChunkEncoder& operator=(const BackgroundChunkEncoder&) = delete;
+
+  // Expects that no more rows are added to the chunk
+  void encode_chunk(const std::string& table_name, const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  // Encodes all chunks of a completely generated table
+  void encode_table(const std::string& table_name, const std::shared_ptr<Table>& table);
+
+  // Blocks until all chunks handed to the encoder are encoded
+  void wait();
+
+ private:
+  struct Task {
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+    std::shared_ptr<const ChunkEncodingSpec> chunk_encoding_spec;
+  };
+
+  void _work();
+
+  const EncodingConfig& _encoding_config;
+
+  std::mutex _mutex;
+  std::condition_variable _task_added;
+  std::condition_variable _task_done;
+  std::deque<Task> _tasks;
+  size_t _running_task_count{0};
+  bool _shutdown{false};
+
+  // Determined once per table, as the encoding config might print warnings
+  std::unordered_map<std::shared_ptr<Table>, std::shared_ptr<const ChunkEncodingSpec>> _chunk_encoding_specs;
+
+  std::vector<std::thread> _threads;
 };
 
 }  // namespace opossum
@@ -0,0 +1,46 @@
+#include "ch_benchmark_item_runner.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+#include "ch_queries.hpp"
+
+namespace opossum {
+
+CHBenchmarkItemRunner::CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses)
+    : TPCCBenchmarkItemRunner(config, num_warehouses) {
+  _items = TPCCBenchmarkItemRunner::items();
+
+  // The analytical items follow the transactions
+  for (const auto& [query_id, _] : ch_queries) {
+    const auto item_id = BenchmarkItemID{_items.size()};
+    _items.emplace_back(item_id);
+    _analytical_items.emplace_back(item_id);
+    _query_ids.emplace_back(query_id);
+  }
+}
+
+std::string CHBenchmarkItemRunner::item_name(const BenchmarkItemID item_id) const {
+  const auto transaction_count = TPCCBenchmarkItemRunner::items().size();
+  if (item_id < transaction_count) return TPCCBenchmarkItemRunner::item_name(item_id);
+
+  Assert(item_id < _items.size(), "Invalid item_id");
+  auto name = std::stringstream{};
+  name << "CH " << std::setfill('0') << std::setw(2) << _query_ids[item_id - transaction_count];
+  return name.str();
+}
+
+const std::vector<BenchmarkItemID>& CHBenchmarkItemRunner::items() const { return _items; }
+
+const std::vector<BenchmarkItemID>& CHBenchmarkItemRunner::analytical_items() const { return _analytical_items; }
+
+bool CHBenchmarkItemRunner::_on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) {
+  const auto transaction_count = TPCCBenchmarkItemRunner::items().size();
+  if (item_id < transaction_count) return TPCCBenchmarkItemRunner::_on_execute_item(item_id, sql_executor);
+
+  Assert(item_id < _items.size(), "Invalid item_id");
+  const auto [status, table] = sql_executor.execute(ch_queries.at(_query_ids[item_id - transaction_count]));
+  return status == SQLPipelineStatus::Success;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "tpcc/tpcc_benchmark_item_runner.hpp"
+
+namespace opossum {
+
+// Runs the mixed workload of the CH-benCHmark: The TPC-C transactions (items 0 to 4, see TPCCBenchmarkItemRunner) and
+// the analytical queries of ch_queries.hpp, which read the same tables. In the Shuffled mode, the transactions are
+// executed by the regular clients and the queries by the analytical clients, both concurrently.
+class CHBenchmarkItemRunner : public TPCCBenchmarkItemRunner {
+ public:
+  CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses);
+
+  std::string item_name(const BenchmarkItemID item_id) const override;
+  const std::vector<BenchmarkItemID>& items() const override;
+
+  const std::vector<BenchmarkItemID>& analytical_items() const override;
+
+ protected:
+  bool _on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) override;
+
+  // The query id (as in ch_queries) of each analytical item
+  std::vector<size_t> _query_ids;
+
+  std::vector<BenchmarkItemID> _items;
+  std::vector<BenchmarkItemID> _analytical_items;
+};
+
+}  // namespace opossum
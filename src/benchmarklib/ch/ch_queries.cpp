@@ -0,0 +1,154 @@
+#include "ch_queries.hpp"
+
+/**
+ * General changes to all queries:
+ *  1. Dates are stored as UNIX timestamps (see TPCCTableGenerator), so date literals are replaced by their timestamps
+ *     (1999-01-01: 915148800, 2007-01-02: 1167696000).
+ *  2. The date ranges of the original queries cover all generated data. As TPCCTableGenerator uses the current time
+ *     instead of a date in 2012, the upper bounds are moved to 2100-01-01 (4102444800).
+ *  3. The ORDERS table of the CH-benCHmark is called "ORDER" in our TPC-C implementation.
+ */
+
+namespace {
+
+/**
+ * CH-benCHmark 1
+ */
+const char* const ch_query_1 =
+    R"(SELECT OL_NUMBER, SUM(OL_QUANTITY) AS SUM_QTY, SUM(OL_AMOUNT) AS SUM_AMOUNT, AVG(OL_QUANTITY) AS AVG_QTY,
+         AVG(OL_AMOUNT) AS AVG_AMOUNT, COUNT(*) AS COUNT_ORDER
+       FROM ORDER_LINE
+       WHERE OL_DELIVERY_D > 1167696000
+       GROUP BY OL_NUMBER
+       ORDER BY OL_NUMBER;)";
+
+/**
+ * CH-benCHmark 3
+ */
+const char* const ch_query_3 =
+    R"(SELECT OL_O_ID, OL_W_ID, OL_D_ID, SUM(OL_AMOUNT) AS REVENUE, O_ENTRY_D
+       FROM CUSTOMER, NEW_ORDER, "ORDER", ORDER_LINE
+       WHERE C_STATE LIKE 'A%' AND C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND NO_W_ID = O_W_ID AND
+         NO_D_ID = O_D_ID AND NO_O_ID = O_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND
+         O_ENTRY_D > 1167696000
+       GROUP BY OL_O_ID, OL_W_ID, OL_D_ID, O_ENTRY_D
+       ORDER BY REVENUE DESC, O_ENTRY_D;)";
+
+/**
+ * CH-benCHmark 4
+ */
+const char* const ch_query_4 =
+    R"(SELECT O_OL_CNT, COUNT(*) AS ORDER_COUNT
+       FROM "ORDER"
+       WHERE O_ENTRY_D >= 1167696000 AND O_ENTRY_D < 4102444800 AND EXISTS (
+         SELECT * FROM ORDER_LINE
+         WHERE O_ID = OL_O_ID AND O_W_ID = OL_W_ID AND O_D_ID = OL_D_ID AND OL_DELIVERY_D >= O_ENTRY_D)
+       GROUP BY O_OL_CNT
+       ORDER BY O_OL_CNT;)";
+
+/**
+ * CH-benCHmark 6
+ */
+const char* const ch_query_6 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+       FROM ORDER_LINE
+       WHERE OL_DELIVERY_D >= 915148800 AND OL_DELIVERY_D < 4102444800 AND OL_QUANTITY BETWEEN 1 AND 100000;)";
+
+/**
+ * CH-benCHmark 12
+ */
+const char* const ch_query_12 =
+    R"(SELECT O_OL_CNT,
+         SUM(CASE WHEN O_CARRIER_ID = 1 OR O_CARRIER_ID = 2 THEN 1 ELSE 0 END) AS HIGH_LINE_COUNT,
+         SUM(CASE WHEN O_CARRIER_ID <> 1 AND O_CARRIER_ID <> 2 THEN 1 ELSE 0 END) AS LOW_LINE_COUNT
+       FROM "ORDER", ORDER_LINE
+       WHERE OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND O_ENTRY_D <= OL_DELIVERY_D AND
+         OL_DELIVERY_D < 4102444800
+       GROUP BY O_OL_CNT
+       ORDER BY O_OL_CNT;)";
+
+/**
+ * CH-benCHmark 13
+ */
+const char* const ch_query_13 =
+    R"(SELECT C_COUNT, COUNT(*) AS CUSTDIST
+       FROM (SELECT C_ID, COUNT(O_ID) AS C_COUNT
+             FROM CUSTOMER LEFT OUTER JOIN "ORDER" ON C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND C_ID = O_C_ID AND
+               O_CARRIER_ID > 8
+             GROUP BY C_ID) AS C_ORDERS
+       GROUP BY C_COUNT
+       ORDER BY CUSTDIST DESC, C_COUNT DESC;)";
+
+/**
+ * CH-benCHmark 14
+ */
+const char* const ch_query_14 =
+    R"(SELECT 100.00 * SUM(CASE WHEN I_DATA LIKE 'PR%' THEN OL_AMOUNT ELSE 0 END) / (1 + SUM(OL_AMOUNT))
+         AS PROMO_REVENUE
+       FROM ORDER_LINE, ITEM
+       WHERE OL_I_ID = I_ID AND OL_DELIVERY_D >= 1167696000 AND OL_DELIVERY_D < 4102444800;)";
+
+/**
+ * CH-benCHmark 17
+ */
+const char* const ch_query_17 =
+    R"(SELECT SUM(OL_AMOUNT) / 2.0 AS AVG_YEARLY
+       FROM ORDER_LINE, (SELECT I_ID, AVG(OL_QUANTITY) AS A
+                         FROM ITEM, ORDER_LINE
+                         WHERE I_DATA LIKE '%b' AND OL_I_ID = I_ID
+                         GROUP BY I_ID) T
+       WHERE OL_I_ID = T.I_ID AND OL_QUANTITY < T.A;)";
+
+/**
+ * CH-benCHmark 18
+ */
+const char* const ch_query_18 =
+    R"(SELECT C_LAST, C_ID, O_ID, O_ENTRY_D, O_OL_CNT, SUM(OL_AMOUNT) AS AMOUNT_SUM
+       FROM CUSTOMER, "ORDER", ORDER_LINE
+       WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND
+         OL_O_ID = O_ID
+       GROUP BY O_ID, O_W_ID, O_D_ID, C_ID, C_LAST, O_ENTRY_D, O_OL_CNT
+       HAVING SUM(OL_AMOUNT) > 200
+       ORDER BY AMOUNT_SUM DESC, O_ENTRY_D;)";
+
+/**
+ * CH-benCHmark 19
+ */
+const char* const ch_query_19 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+       FROM ORDER_LINE, ITEM
+       WHERE (OL_I_ID = I_ID AND I_DATA LIKE '%a' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10 AND
+              I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 3)) OR
+             (OL_I_ID = I_ID AND I_DATA LIKE '%b' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10 AND
+              I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 4)) OR
+             (OL_I_ID = I_ID AND I_DATA LIKE '%c' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10 AND
+              I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 5, 3));)";
+
+/**
+ * CH-benCHmark 22
+ *
+ * Changes:
+ *  1. As in TPC-H 22, the country code is computed in a subquery instead of being grouped and sorted by SUBSTR()
+ */
+const char* const ch_query_22 =
+    R"(SELECT COUNTRY, COUNT(*) AS NUMCUST, SUM(C_BALANCE) AS TOTACCTBAL
+       FROM (SELECT SUBSTR(C_STATE, 1, 1) AS COUNTRY, C_BALANCE
+             FROM CUSTOMER
+             WHERE SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7') AND
+               C_BALANCE > (SELECT AVG(C_BALANCE)
+                            FROM CUSTOMER
+                            WHERE C_BALANCE > 0.00 AND SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7')) AND
+               NOT EXISTS (SELECT * FROM "ORDER" WHERE O_C_ID = C_ID AND O_W_ID = C_W_ID AND O_D_ID = C_D_ID)
+            ) AS CUSTSALE
+       GROUP BY COUNTRY
+       ORDER BY COUNTRY;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::map<size_t, const char*> ch_queries = {
+    {1, ch_query_1},   {3, ch_query_3},   {4, ch_query_4},   {6, ch_query_6},   {12, ch_query_12}, {13, ch_query_13},
+    {14, ch_query_14}, {17, ch_query_17}, {18, ch_query_18}, {19, ch_query_19}, {22, ch_query_22}};
+
+}  // namespace opossum
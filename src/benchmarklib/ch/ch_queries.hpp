@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdlib>
+#include <map>
+
+namespace opossum {
+
+/**
+ * Contains the supported analytical queries of the CH-benCHmark (Cole et al.: The mixed workload CH-benCHmark, 2011),
+ * which run on the tables of TPC-C. Use ordered map to have queries sorted by query id.
+ *
+ * Queries that use the additional SUPPLIER, NATION, and REGION tables of the CH-benCHmark (2, 5, 7-11, 15, 16, 20,
+ * and 21) are not supported. These tables are not generated, and the queries join them on keys that are computed
+ * with ASCII() and modulo expressions.
+ */
+extern const std::map<size_t, const char*> ch_queries;
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include "constant_mappings.hpp"
 #include "utils/assert.hpp"
@@ -131,10 +132,74 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
-  return BenchmarkConfig{
+  auto config = BenchmarkConfig{
       benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
       warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
       verify,          cache_binary_tables, metrics};
+
+  const auto latency_warmup = parse_result["latency_warmup"].as<uint64_t>();
+  if (latency_warmup > 0) {
+    std::cout << "- Excluding runs of the first " << latency_warmup << " seconds from the latency histograms"
+              << std::endl;
+    config.latency_warmup_duration = std::chrono::duration_cast<Duration>(std::chrono::seconds{latency_warmup});
+  }
+
+  const auto time_series_interval = parse_result["time_series_interval"].as<uint64_t>();
+  Assert(time_series_interval > 0, "--time_series_interval must be positive");
+  config.time_series_interval = std::chrono::duration_cast<Duration>(std::chrono::milliseconds{time_series_interval});
+
+  config.sweep_cores = parse_count_list(parse_result["sweep_cores"].as<std::string>());
+  config.sweep_clients = parse_count_list(parse_result["sweep_clients"].as<std::string>());
+  if (!config.sweep_cores.empty()) {
+    Assert(enable_scheduler, "Sweeping over core counts requires the scheduler ('--scheduler')");
+    Assert(!metrics, "--metrics cannot be used when sweeping over core and client counts");
+    Assert(!enable_visualization, "Cannot visualize plans when sweeping over core and client counts");
+    std::cout << "- Sweeping over " << config.sweep_cores.size() << " core counts";
+    if (!config.sweep_clients.empty()) std::cout << " and " << config.sweep_clients.size() << " client counts";
+    std::cout << std::endl;
+  } else {
+    Assert(config.sweep_clients.empty(), "--sweep_clients requires --sweep_cores");
+  }
+
+  const auto arrival_rate = parse_result["arrival_rate"].as<double>();
+  if (arrival_rate > 0.0) {
+    Assert(benchmark_mode == BenchmarkMode::Shuffled, "Open-loop load generation requires the Shuffled mode");
+    Assert(enable_scheduler, "Open-loop load generation requires the scheduler ('--scheduler')");
+    std::cout << "- Generating load in an open loop with " << arrival_rate << " arrivals per second" << std::endl;
+    config.arrival_rate = arrival_rate;
+  } else {
+    Assert(arrival_rate == 0.0, "Invalid value for --arrival_rate");
+  }
+
+  const auto cost_model_calibration_file_path = parse_result["cost_model_calibration"].as<std::string>();
+  if (!cost_model_calibration_file_path.empty()) {
+    std::cout << "- Calibrating the cost model into " << cost_model_calibration_file_path << std::endl;
+    config.cost_model_calibration_file_path = cost_model_calibration_file_path;
+  }
+
+  const auto cost_model_file_path = parse_result["cost_model"].as<std::string>();
+  if (!cost_model_file_path.empty()) {
+    Assert(std::filesystem::is_regular_file(cost_model_file_path), "No such file: " + cost_model_file_path);
+    std::cout << "- Using the calibrated cost model from " << cost_model_file_path << std::endl;
+    config.cost_model_file_path = cost_model_file_path;
+  }
+
+  return config;
+}
+
+std::vector<uint32_t> CLIConfigParser::parse_count_list(std::string comma_separated_counts) {
+  auto counts = std::vector<uint32_t>{};
+  boost::trim_if(comma_separated_counts, boost::is_any_of(","));
+  if (comma_separated_counts.empty()) return counts;
+
+  auto count_strings = std::vector<std::string>{};
+  boost::split(count_strings, comma_separated_counts, boost::is_any_of(","), boost::token_compress_on);
+  for (const auto& count_string : count_strings) {
+    const auto count = boost::lexical_cast<uint32_t>(boost::trim_copy(count_string));
+    Assert(count > 0, "Core and client counts must be positive");
+    counts.emplace_back(count);
+  }
+  return counts;
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
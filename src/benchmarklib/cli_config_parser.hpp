@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include "cxxopts.hpp"
 
@@ -16,6 +17,9 @@ class CLIConfigParser {
 
   static EncodingConfig parse_encoding_config(const std::string& encoding_file_str);
 
+  // Parses a comma-separated list of positive counts (e.g., "1,2,4,8" for --sweep_cores)
+  static std::vector<uint32_t> parse_count_list(std::string comma_separated_counts);
+
   // Returns whether --help or --full_help was requested - used to stop execution of the benchmark
   static bool print_help_if_requested(const cxxopts::Options& options, const cxxopts::ParseResult& parse_result);
 };
@@ -0,0 +1,104 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void LatencyHistogram::record(const Duration latency) {
+  const auto value = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+
+  const auto index = bucket_index(value);
+  if (index >= _bucket_counts.size()) _bucket_counts.resize(index + 1);
+  ++_bucket_counts[index];
+
+  _min = _count == 0 ? value : std::min(_min, value);
+  _max = std::max(_max, value);
+  _sum += static_cast<double>(value);
+  ++_count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  if (other._count == 0) return;
+
+  if (other._bucket_counts.size() > _bucket_counts.size()) _bucket_counts.resize(other._bucket_counts.size());
+  for (auto index = size_t{0}; index < other._bucket_counts.size(); ++index) {
+    _bucket_counts[index] += other._bucket_counts[index];
+  }
+
+  _min = _count == 0 ? other._min : std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+  _sum += other._sum;
+  _count += other._count;
+}
+
+uint64_t LatencyHistogram::count() const { return _count; }
+
+uint64_t LatencyHistogram::min() const { return _min; }
+
+uint64_t LatencyHistogram::max() const { return _max; }
+
+double LatencyHistogram::mean() const { return _count == 0 ? 0.0 : _sum / static_cast<double>(_count); }
+
+uint64_t LatencyHistogram::percentile(const double percentile) const {
+  DebugAssert(percentile > 0.0 && percentile <= 100.0, "Invalid percentile");
+  if (_count == 0) return 0;
+
+  const auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile / 100.0 * _count)));
+
+  auto accumulated_count = uint64_t{0};
+  for (auto index = size_t{0}; index < _bucket_counts.size(); ++index) {
+    accumulated_count += _bucket_counts[index];
+    if (accumulated_count >= rank) return std::min(bucket_upper_bound(index), _max);
+  }
+  Fail("Percentile rank exceeds the number of recorded values");
+}
+
+nlohmann::json LatencyHistogram::to_json(const bool include_buckets) const {
+  auto json = nlohmann::json{{"count", _count},
+                             {"min", _min},
+                             {"max", _max},
+                             {"mean", mean()},
+                             {"p50", percentile(50.0)},
+                             {"p90", percentile(90.0)},
+                             {"p99", percentile(99.0)},
+                             {"p99.9", percentile(99.9)}};
+
+  if (include_buckets) {
+    auto buckets_json = nlohmann::json::array();
+    for (auto index = size_t{0}; index < _bucket_counts.size(); ++index) {
+      if (_bucket_counts[index] == 0) continue;
+      buckets_json.push_back(
+          nlohmann::json{{"upper_bound", bucket_upper_bound(index)}, {"count", _bucket_counts[index]}});
+    }
+    json["buckets"] = std::move(buckets_json);
+  }
+
+  return json;
+}
+
+size_t LatencyHistogram::bucket_index(const uint64_t value) {
+  if (value < SUB_BUCKET_COUNT) return value;
+
+  // For values with the most significant bit at position `magnitude`, the (SUB_BUCKET_BITS - 1) bits below it select
+  // one of the SUB_BUCKET_COUNT / 2 buckets of this power of two.
+  const auto magnitude = static_cast<uint32_t>(std::bit_width(value) - 1);
+  const auto shift = magnitude - SUB_BUCKET_BITS + 1;
+  const auto sub_bucket = (value >> shift) - SUB_BUCKET_COUNT / 2;
+  return SUB_BUCKET_COUNT + (magnitude - SUB_BUCKET_BITS) * (SUB_BUCKET_COUNT / 2) + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(const size_t bucket_index) {
+  if (bucket_index < SUB_BUCKET_COUNT) return bucket_index;
+
+  const auto shift = (bucket_index - SUB_BUCKET_COUNT) / (SUB_BUCKET_COUNT / 2) + 1;
+  const auto sub_bucket = (bucket_index - SUB_BUCKET_COUNT) % (SUB_BUCKET_COUNT / 2) + SUB_BUCKET_COUNT / 2;
+  // For the highest bucket, this wraps around to the maximum uint64_t value
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+}  // namespace opossum
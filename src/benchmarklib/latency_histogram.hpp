@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "nlohmann/json.hpp"
+
+namespace opossum {
+
+/**
+ * Histogram of run latencies following the layout of HDR histograms (http://hdrhistogram.org): Values below
+ * SUB_BUCKET_COUNT are counted exactly. Above, each power of two is split into SUB_BUCKET_COUNT / 2 linear buckets, so
+ * that the values of a bucket differ by less than 1 / (SUB_BUCKET_COUNT / 2) relative to its lowest value. With
+ * nanosecond values, this gives a precision of below 1% for latencies from microseconds to hours in at most a few
+ * thousand buckets.
+ *
+ * The histogram is not thread-safe. The BenchmarkRunner builds it from the recorded runs after the benchmark.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr auto SUB_BUCKET_BITS = uint32_t{8};
+  static constexpr auto SUB_BUCKET_COUNT = uint64_t{1} << SUB_BUCKET_BITS;
+
+  void record(const Duration latency);
+
+  // Adds the values recorded in `other` to this histogram
+  void merge(const LatencyHistogram& other);
+
+  uint64_t count() const;
+
+  // All values are given in nanoseconds. For an empty histogram, they are zero.
+  uint64_t min() const;
+  uint64_t max() const;
+  double mean() const;
+
+  // Returns the highest value that is equivalent (i.e., in the same bucket) to the value at the given percentile
+  // (0 < percentile <= 100). It is never larger than the recorded maximum.
+  uint64_t percentile(const double percentile) const;
+
+  // Contains count, min, max, mean, and the percentiles p50, p90, p99, and p99.9. If `include_buckets` is set, the
+  // non-empty buckets are added as an array of {"upper_bound", "count"} objects.
+  nlohmann::json to_json(const bool include_buckets = true) const;
+
+  // Index of the bucket that `value` is counted in and the highest value counted in a bucket
+  static size_t bucket_index(const uint64_t value);
+  static uint64_t bucket_upper_bound(const size_t bucket_index);
+
+ protected:
+  std::vector<uint64_t> _bucket_counts;
+  uint64_t _count{0};
+  uint64_t _min{0};
+  uint64_t _max{0};
+  double _sum{0.0};
+};
+
+}  // namespace opossum
@@ -43,6 +43,63 @@ pmr_vector<T> create_typed_segment_values(const std::vector<int>& values) {
   return result;
 }
 
+// Samples ranks in [1, n] following Zipf's law using rejection-inversion (Hörmann and Derflinger: Rejection-inversion
+// to generate variates from monotone discrete distributions, 1996). Other than sampling from the cumulative
+// distribution function, it neither requires O(n) memory nor O(n) setup time, which matters as the values of each
+// chunk are generated separately.
+class ZipfSampler {
+ public:
+  ZipfSampler(const int n, const double exponent)
+      : _n(n),
+        _exponent(exponent),
+        _h_integral_x1(_h_integral(1.5) - 1.0),
+        _h_integral_n(_h_integral(static_cast<double>(n) + 0.5)),
+        _s(2.0 - _h_integral_inverse(_h_integral(2.5) - _h(2.0))) {
+    Assert(n > 0, "Zipf distribution requires at least one value");
+    Assert(exponent > 0.0, "Zipf exponent must be positive");
+  }
+
+  template <typename RandomEngine>
+  int operator()(RandomEngine& random_engine) const {
+    auto uniform_distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+    while (true) {
+      const auto u = _h_integral_n + uniform_distribution(random_engine) * (_h_integral_x1 - _h_integral_n);
+      const auto x = _h_integral_inverse(u);
+      const auto k = std::clamp(static_cast<int>(x + 0.5), 1, _n);
+      if (k - x <= _s || u >= _h_integral(k + 0.5) - _h(k)) return k;
+    }
+  }
+
+ private:
+  // h(x) = 1 / x^exponent and its integral H(x) = (x^(1 - exponent) - 1) / (1 - exponent), which is log(x) for an
+  // exponent of 1. The helpers keep H and its inverse numerically stable for exponents close to 1.
+  double _h(const double x) const { return std::exp(-_exponent * std::log(x)); }
+
+  double _h_integral(const double x) const {
+    const auto log_x = std::log(x);
+    return _expm1_by_x((1.0 - _exponent) * log_x) * log_x;
+  }
+
+  double _h_integral_inverse(const double x) const {
+    const auto t = std::max(-1.0, x * (1.0 - _exponent));
+    return std::exp(_log1p_by_x(t) * x);
+  }
+
+  static double _log1p_by_x(const double x) {
+    return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+  }
+
+  static double _expm1_by_x(const double x) {
+    return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+  }
+
+  const int _n;
+  const double _exponent;
+  const double _h_integral_x1;
+  const double _h_integral_n;
+  const double _s;
+};
+
 }  // namespace
 
 namespace opossum {
@@ -126,6 +183,31 @@ std::shared_ptr<Table> SyntheticTableGenerator::generate_table(
               };
               break;
             }
+            case DataDistributionType::Zipf: {
+              const auto min_value = static_cast<int>(column_data_distribution.min_value);
+              const auto value_count = static_cast<int>(column_data_distribution.max_value) - min_value + 1;
+              const auto zipf_sampler = ZipfSampler{value_count, column_data_distribution.zipf_exponent};
+              generate_value_by_distribution_type = [zipf_sampler, min_value, &pseudorandom_engine]() {
+                return min_value + zipf_sampler(pseudorandom_engine) - 1;
+              };
+              break;
+            }
+            case DataDistributionType::HotKey: {
+              const auto min_value = static_cast<int>(column_data_distribution.min_value);
+              const auto max_value = static_cast<int>(column_data_distribution.max_value);
+              Assert(column_data_distribution.hot_key_count > 0 &&
+                         column_data_distribution.hot_key_count <= max_value - min_value + 1,
+                     "Hot keys must be in the value range");
+              const auto hot_key_ratio = column_data_distribution.hot_key_ratio;
+              auto hot_key_dist =
+                  std::uniform_int_distribution<int>{min_value, min_value + column_data_distribution.hot_key_count - 1};
+              auto uniform_dist = std::uniform_int_distribution<int>{min_value, max_value};
+              generate_value_by_distribution_type = [=, &probability_dist, &pseudorandom_engine]() mutable {
+                if (probability_dist(pseudorandom_engine) < hot_key_ratio) return hot_key_dist(pseudorandom_engine);
+                return uniform_dist(pseudorandom_engine);
+              };
+              break;
+            }
             case DataDistributionType::Pareto: {
               const auto pareto_dist = boost::math::pareto_distribution<double>{column_data_distribution.pareto_scale,
                                                                                 column_data_distribution.pareto_shape};
@@ -12,7 +12,7 @@ namespace opossum {
 
 class Table;
 
-enum class DataDistributionType { Uniform, NormalSkewed, Pareto };
+enum class DataDistributionType { Uniform, NormalSkewed, Pareto, Zipf, HotKey };
 
 struct ColumnDataDistribution {
   static ColumnDataDistribution make_uniform_config(const double min, const double max) {
@@ -44,6 +44,26 @@ struct ColumnDataDistribution {
     return c;
   }
 
+  // The values in [min, max] follow Zipf's law: the k-th most frequent value, min + k - 1, occurs with a probability
+  // proportional to 1 / k^zipf_exponent. Used to create hot keys for joins and hot groups for aggregates.
+  static ColumnDataDistribution make_zipf_config(const double min, const double max, const double zipf_exponent = 1.0) {
+    auto c = make_uniform_config(min, max);
+    c.zipf_exponent = zipf_exponent;
+    c.distribution_type = DataDistributionType::Zipf;
+    return c;
+  }
+
+  // With a probability of hot_key_ratio, one of the hot_key_count values starting at min is chosen uniformly.
+  // Otherwise, the value is uniformly distributed in [min, max].
+  static ColumnDataDistribution make_hot_key_config(const double min, const double max,
+                                                    const double hot_key_ratio = 0.5, const int hot_key_count = 1) {
+    auto c = make_uniform_config(min, max);
+    c.hot_key_ratio = hot_key_ratio;
+    c.hot_key_count = hot_key_count;
+    c.distribution_type = DataDistributionType::HotKey;
+    return c;
+  }
+
   DataDistributionType distribution_type = DataDistributionType::Uniform;
 
   int num_different_values = 1'000;
@@ -55,6 +75,11 @@ struct ColumnDataDistribution {
   double skew_scale;
   double skew_shape;
 
+  double zipf_exponent;
+
+  double hot_key_ratio;
+  int hot_key_count;
+
   double min_value;
   double max_value;
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -193,8 +195,13 @@ class TableBuilder {
 
   size_t row_count() const { return _row_count; }
 
+  // Called for each chunk once it is complete, e.g., to encode it while the following rows are still being added
+  using ChunkCompletedCallback = std::function<void(const std::shared_ptr<Table>& table, const ChunkID chunk_id)>;
+  void set_chunk_completed_callback(const ChunkCompletedCallback& callback) { _chunk_completed_callback = callback; }
+
  private:
   std::shared_ptr<Table> _table;
+  ChunkCompletedCallback _chunk_completed_callback;
   ChunkOffset _estimated_rows_per_chunk;
 
   // _table->row_count() only counts completed chunks but we want the total number of rows added to this table builder
@@ -237,6 +244,8 @@ class TableBuilder {
     auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
 
     _table->append_chunk(segments, mvcc_data);
+
+    if (_chunk_completed_callback) _chunk_completed_callback(_table, ChunkID{_table->chunk_count() - 1});
   }
 };
 
@@ -19,9 +19,8 @@ TPCCDelivery::TPCCDelivery(const int num_warehouses, BenchmarkSQLExecutor& sql_e
 bool TPCCDelivery::_on_execute() {
   for (auto d_id = 1; d_id <= 10; ++d_id) {
     // TODO(anyone): This could be optimized by querying only once and grouping by NO_D_ID
-    const auto new_order_select_pair =
-        _sql_executor.execute(std::string{"SELECT MIN(NO_O_ID) IS NULL, MIN(NO_O_ID) FROM NEW_ORDER WHERE NO_W_ID = "} +
-                              std::to_string(w_id) + " AND NO_D_ID = " + std::to_string(d_id));
+    const auto new_order_select_pair = _sql_executor.execute_prepared(
+        "SELECT MIN(NO_O_ID) IS NULL, MIN(NO_O_ID) FROM NEW_ORDER WHERE NO_W_ID = ? AND NO_D_ID = ?", {w_id, d_id});
     const auto& new_order_table = new_order_select_pair.second;
 
     // TODO(anyone): Selecting MIN(NO_O_ID) IS NULL and using it here would not be necessary if get_value returned
@@ -32,51 +31,47 @@ bool TPCCDelivery::_on_execute() {
     const auto no_o_id = *new_order_table->get_value<int32_t>(ColumnID{1}, 0);
 
     // Delete from NEW_ORDER
-    const auto new_order_update_pair =
-        _sql_executor.execute(std::string{"DELETE FROM NEW_ORDER WHERE NO_W_ID = "} + std::to_string(w_id) +
-                              " AND NO_D_ID = " + std::to_string(d_id) + " AND NO_O_ID = " + std::to_string(no_o_id));
+    const auto new_order_update_pair = _sql_executor.execute_prepared(
+        "DELETE FROM NEW_ORDER WHERE NO_W_ID = ? AND NO_D_ID = ? AND NO_O_ID = ?", {w_id, d_id, no_o_id});
     if (new_order_update_pair.first != SQLPipelineStatus::Success) {
       return false;
     }
 
     // Get customer ID
-    const auto order_select_pair =
-        _sql_executor.execute(std::string{"SELECT O_C_ID FROM \"ORDER\" WHERE O_W_ID = "} + std::to_string(w_id) +
-                              " AND O_D_ID = " + std::to_string(d_id) + " AND O_ID = " + std::to_string(no_o_id));
+    const auto order_select_pair = _sql_executor.execute_prepared(
+        "SELECT O_C_ID FROM \"ORDER\" WHERE O_W_ID = ? AND O_D_ID = ? AND O_ID = ?", {w_id, d_id, no_o_id});
     const auto& order_table = order_select_pair.second;
     Assert(order_table && order_table->row_count() == 1, "Did not find order");
     auto o_c_id = *order_table->get_value<int32_t>(ColumnID{0}, 0);
 
     // Update ORDER
-    const auto order_update_pair =
-        _sql_executor.execute(std::string{"UPDATE \"ORDER\" SET O_CARRIER_ID = "} + std::to_string(o_carrier_id) +
-                              " WHERE O_W_ID = " + std::to_string(w_id) + " AND O_D_ID = " + std::to_string(d_id) +
-                              " AND O_ID = " + std::to_string(no_o_id));
+    const auto order_update_pair = _sql_executor.execute_prepared(
+        "UPDATE \"ORDER\" SET O_CARRIER_ID = ? WHERE O_W_ID = ? AND O_D_ID = ? AND O_ID = ?",
+        {o_carrier_id, w_id, d_id, no_o_id});
     if (order_update_pair.first != SQLPipelineStatus::Success) {
       return false;
     }
 
     // Retrieve amount from ORDER_LINE
-    const auto order_line_select_pair = _sql_executor.execute(
-        std::string{"SELECT SUM(OL_AMOUNT) FROM ORDER_LINE WHERE OL_W_ID = "} + std::to_string(w_id) +
-        " AND OL_D_ID = " + std::to_string(d_id) + " AND OL_O_ID = " + std::to_string(no_o_id));
+    const auto order_line_select_pair = _sql_executor.execute_prepared(
+        "SELECT SUM(OL_AMOUNT) FROM ORDER_LINE WHERE OL_W_ID = ? AND OL_D_ID = ? AND OL_O_ID = ?",
+        {w_id, d_id, no_o_id});
     const auto& order_line_table = order_line_select_pair.second;
     Assert(order_line_table && order_line_table->row_count() == 1, "Did not find order lines");
     const auto amount = *order_line_table->get_value<double>(ColumnID{0}, 0);
 
     // Set delivery date in ORDER_LINE
-    const auto order_line_update_pair =
-        _sql_executor.execute(std::string{"UPDATE ORDER_LINE SET OL_DELIVERY_D = "} + std::to_string(ol_delivery_d) +
-                              " WHERE OL_W_ID = " + std::to_string(w_id) + " AND OL_D_ID = " + std::to_string(d_id) +
-                              " AND OL_O_ID = " + std::to_string(no_o_id));
+    const auto order_line_update_pair = _sql_executor.execute_prepared(
+        "UPDATE ORDER_LINE SET OL_DELIVERY_D = ? WHERE OL_W_ID = ? AND OL_D_ID = ? AND OL_O_ID = ?",
+        {ol_delivery_d, w_id, d_id, no_o_id});
     Assert(order_update_pair.first == SQLPipelineStatus::Success,
            "We have already 'locked' the order ID when we deleted it from NEW_ORDER. No conflict should be possible.");
 
     // Update balance and delivery count for customer
-    const auto customer_update_pair =
-        _sql_executor.execute(std::string{"UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + "} + std::to_string(amount) +
-                              ", C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = " + std::to_string(w_id) +
-                              " AND C_D_ID = " + std::to_string(d_id) + " AND C_ID = " + std::to_string(o_c_id));
+    const auto customer_update_pair = _sql_executor.execute_prepared(
+        "UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + ?, C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = ? AND "
+        "C_D_ID = ? AND C_ID = ?",
+        {amount, w_id, d_id, o_c_id});
     if (customer_update_pair.first != SQLPipelineStatus::Success) {
       return false;
     }
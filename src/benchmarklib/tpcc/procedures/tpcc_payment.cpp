@@ -44,9 +44,8 @@ bool TPCCPayment::_on_execute() {
   SQLPipelineStatus pipeline_status;
 
   // Retrieve information about the warehouse
-  const auto warehouse_select_pair = _sql_executor.execute(
-      std::string{"SELECT W_NAME, W_STREET_1, W_STREET_2, W_CITY, W_STATE, W_ZIP, W_YTD FROM WAREHOUSE WHERE W_ID = "} +
-      std::to_string(w_id));
+  const auto warehouse_select_pair = _sql_executor.execute_prepared(
+      "SELECT W_NAME, W_STREET_1, W_STREET_2, W_CITY, W_STATE, W_ZIP, W_YTD FROM WAREHOUSE WHERE W_ID = ?", {w_id});
   const auto& warehouse_table = warehouse_select_pair.second;
   Assert(warehouse_table && warehouse_table->row_count() == 1, "Did not find warehouse (or found more than one)");
   auto w_name = *warehouse_table->get_value<pmr_string>(ColumnID{0}, 0);
@@ -54,26 +53,24 @@ bool TPCCPayment::_on_execute() {
 
   // Update warehouse YTD
   std::tie(pipeline_status, std::ignore) =
-      _sql_executor.execute(std::string{"UPDATE WAREHOUSE SET W_YTD = "} + std::to_string(w_ytd + h_amount) +
-                            " WHERE W_ID = " + std::to_string(w_id));
+      _sql_executor.execute_prepared("UPDATE WAREHOUSE SET W_YTD = ? WHERE W_ID = ?", {w_ytd + h_amount, w_id});
   if (pipeline_status != SQLPipelineStatus::Success) {
     return false;
   }
 
   // Retrieve information about the district
-  const auto district_select_pair = _sql_executor.execute(
-      std::string{
-          "SELECT D_NAME, D_STREET_1, D_STREET_2, D_CITY, D_STATE, D_ZIP, D_YTD FROM DISTRICT WHERE D_W_ID = "} +
-      std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
+  const auto district_select_pair = _sql_executor.execute_prepared(
+      "SELECT D_NAME, D_STREET_1, D_STREET_2, D_CITY, D_STATE, D_ZIP, D_YTD FROM DISTRICT WHERE D_W_ID = ? AND "
+      "D_ID = ?",
+      {w_id, d_id});
   const auto& district_table = district_select_pair.second;
   Assert(district_table && district_table->row_count() == 1, "Did not find district (or found more than one)");
   auto d_name = *district_table->get_value<pmr_string>(ColumnID{0}, 0);
   auto d_ytd = *district_table->get_value<float>(ColumnID{6}, 0);
 
   // Update district YTD
-  const auto district_update_pair =
-      _sql_executor.execute(std::string{"UPDATE DISTRICT SET D_YTD = "} + std::to_string(d_ytd + h_amount) +
-                            " WHERE D_W_ID = " + std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
+  const auto district_update_pair = _sql_executor.execute_prepared(
+      "UPDATE DISTRICT SET D_YTD = ? WHERE D_W_ID = ? AND D_ID = ?", {d_ytd + h_amount, w_id, d_id});
   if (district_update_pair.first != SQLPipelineStatus::Success) {
     return false;
   }
@@ -83,22 +80,22 @@ bool TPCCPayment::_on_execute() {
 
   if (!select_customer_by_name) {
     // Case 1 - Select customer by ID
-    std::tie(std::ignore, customer_table) = _sql_executor.execute(
-        std::string{"SELECT C_ID, C_FIRST, C_MIDDLE, C_LAST, C_STREET_1, C_STREET_2, C_CITY, C_STATE, C_ZIP, C_PHONE, "
-                    "C_SINCE, C_CREDIT, C_CREDIT_LIM, C_DISCOUNT, C_BALANCE, C_DATA FROM CUSTOMER WHERE C_W_ID = "} +
-        std::to_string(w_id) + " AND C_D_ID = " + std::to_string(c_d_id) +
-        " AND C_ID = " + std::to_string(std::get<int32_t>(customer)));
+    std::tie(std::ignore, customer_table) = _sql_executor.execute_prepared(
+        "SELECT C_ID, C_FIRST, C_MIDDLE, C_LAST, C_STREET_1, C_STREET_2, C_CITY, C_STATE, C_ZIP, C_PHONE, C_SINCE, "
+        "C_CREDIT, C_CREDIT_LIM, C_DISCOUNT, C_BALANCE, C_DATA FROM CUSTOMER WHERE C_W_ID = ? AND C_D_ID = ? AND "
+        "C_ID = ?",
+        {w_id, c_d_id, std::get<int32_t>(customer)});
     Assert(customer_table && customer_table->row_count() == 1, "Did not find customer by ID (or found more than one)");
 
     customer_offset = size_t{0};
     c_id = std::get<int32_t>(customer);
   } else {
     // Case 2 - Select customer by name
-    std::tie(std::ignore, customer_table) = _sql_executor.execute(
-        std::string{"SELECT C_ID, C_FIRST, C_MIDDLE, C_LAST, C_STREET_1, C_STREET_2, C_CITY, C_STATE, C_ZIP, C_PHONE, "
-                    "C_SINCE, C_CREDIT, C_CREDIT_LIM, C_DISCOUNT, C_BALANCE, C_DATA FROM CUSTOMER WHERE C_W_ID = "} +
-        std::to_string(w_id) + " AND C_D_ID = " + std::to_string(c_d_id) + " AND C_LAST = '" +
-        std::string{std::get<pmr_string>(customer)} + "' ORDER BY C_FIRST");
+    std::tie(std::ignore, customer_table) = _sql_executor.execute_prepared(
+        "SELECT C_ID, C_FIRST, C_MIDDLE, C_LAST, C_STREET_1, C_STREET_2, C_CITY, C_STATE, C_ZIP, C_PHONE, C_SINCE, "
+        "C_CREDIT, C_CREDIT_LIM, C_DISCOUNT, C_BALANCE, C_DATA FROM CUSTOMER WHERE C_W_ID = ? AND C_D_ID = ? AND "
+        "C_LAST = ? ORDER BY C_FIRST",
+        {w_id, c_d_id, std::get<pmr_string>(customer)});
     Assert(customer_table && customer_table->row_count() >= 1, "Did not find customer by name");
 
     // Calculate ceil(n/2)
@@ -111,11 +108,10 @@ bool TPCCPayment::_on_execute() {
   // There is a possible optimization here if we take `customer_table` as an input to an UPDATE operator, but that
   // would be outside of the SQL realm. Also, it would it make it impossible to run _execute_sql via the network
   // layer later on.
-  const auto customer_update_balance_pair =
-      _sql_executor.execute(std::string{"UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - "} + std::to_string(h_amount) +
-                            ", C_YTD_PAYMENT = C_YTD_PAYMENT + " + std::to_string(h_amount) +
-                            ", C_PAYMENT_CNT = C_PAYMENT_CNT + 1 WHERE C_W_ID = " + std::to_string(w_id) +
-                            " AND C_D_ID = " + std::to_string(c_d_id) + " AND C_ID = " + std::to_string(c_id));
+  const auto customer_update_balance_pair = _sql_executor.execute_prepared(
+      "UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - ?, C_YTD_PAYMENT = C_YTD_PAYMENT + ?, "
+      "C_PAYMENT_CNT = C_PAYMENT_CNT + 1 WHERE C_W_ID = ? AND C_D_ID = ? AND C_ID = ?",
+      {h_amount, h_amount, w_id, c_d_id, c_id});
   if (customer_update_balance_pair.first != SQLPipelineStatus::Success) {
     return false;
   }
@@ -132,20 +128,19 @@ bool TPCCPayment::_on_execute() {
     new_c_data_stream << *customer_table->get_value<pmr_string>(ColumnID{15}, customer_offset);  // C_DATA
     auto new_c_data = new_c_data_stream.str();
     new_c_data.resize(std::min(new_c_data.size(), size_t{500}));
-    const auto customer_update_data_pair = _sql_executor.execute(
-        std::string{"UPDATE CUSTOMER SET C_DATA = '"} + new_c_data + "' WHERE C_W_ID = " + std::to_string(w_id) +
-        " AND C_D_ID = " + std::to_string(c_d_id) + " AND C_ID = " + std::to_string(c_id));
+    const auto customer_update_data_pair = _sql_executor.execute_prepared(
+        "UPDATE CUSTOMER SET C_DATA = ? WHERE C_W_ID = ? AND C_D_ID = ? AND C_ID = ?",
+        {pmr_string{new_c_data}, w_id, c_d_id, c_id});
     if (customer_update_data_pair.first != SQLPipelineStatus::Success) {
       return false;
     }
   }
 
   // Insert into history table
-  const auto history_insert_pair = _sql_executor.execute(std::string{
-      "INSERT INTO HISTORY (H_C_ID, H_C_D_ID, H_C_W_ID, H_D_ID, H_W_ID, H_DATA, H_DATE, H_AMOUNT) VALUES (" +
-      std::to_string(c_id) + ", " + std::to_string(c_d_id) + ", " + std::to_string(c_w_id) + ", " +
-      std::to_string(d_id) + ", " + std::to_string(w_id) + ", '" + std::string{w_name + "    " + d_name} + "', '" +
-      std::to_string(h_date) + "', " + std::to_string(h_amount) + ")"});
+  const auto history_insert_pair = _sql_executor.execute_prepared(
+      "INSERT INTO HISTORY (H_C_ID, H_C_D_ID, H_C_W_ID, H_D_ID, H_W_ID, H_DATA, H_DATE, H_AMOUNT) VALUES "
+      "(?, ?, ?, ?, ?, ?, ?, ?)",
+      {c_id, c_d_id, c_w_id, d_id, w_id, w_name + "    " + d_name, h_date, h_amount});
   Assert(history_insert_pair.first == SQLPipelineStatus::Success, "INSERT should not fail");
 
   _sql_executor.commit();
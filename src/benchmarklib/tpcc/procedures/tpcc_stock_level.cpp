@@ -22,8 +22,7 @@ TPCCStockLevel::TPCCStockLevel(const int num_warehouses, BenchmarkSQLExecutor& s
 bool TPCCStockLevel::_on_execute() {
   // Retrieve next order ID
   const auto district_table_pair =
-      _sql_executor.execute(std::string{"SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = "} + std::to_string(w_id) +
-                            " AND D_ID = " + std::to_string(d_id));
+      _sql_executor.execute_prepared("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = ? AND D_ID = ?", {w_id, d_id});
   const auto& district_table = district_table_pair.second;
   Assert(district_table && district_table->row_count() == 1, "Did not find district (or found more than one)");
 
@@ -31,9 +30,9 @@ bool TPCCStockLevel::_on_execute() {
   auto first_o_id = *district_table->get_value<int32_t>(ColumnID{0}, 0) - 20;
 
   // Retrieve the distict item ids of those orders
-  const auto order_line_table_pair = _sql_executor.execute(
-      std::string{"SELECT DISTINCT OL_I_ID FROM ORDER_LINE WHERE OL_W_ID = "} + std::to_string(w_id) +
-      " AND OL_D_ID = " + std::to_string(d_id) + " AND OL_O_ID >= " + std::to_string(first_o_id));
+  const auto order_line_table_pair = _sql_executor.execute_prepared(
+      "SELECT DISTINCT OL_I_ID FROM ORDER_LINE WHERE OL_W_ID = ? AND OL_D_ID = ? AND OL_O_ID >= ?",
+      {w_id, d_id, first_o_id});
   const auto& order_line_table = order_line_table_pair.second;
 
   // Build a string for the IN expression
@@ -44,7 +43,8 @@ bool TPCCStockLevel::_on_execute() {
   auto ol_i_ids = ol_i_ids_stream.str();
   ol_i_ids.resize(ol_i_ids.size() - 2);  // Remove final ", "
 
-  // Retrieve the number of items that have a stock level under the threshold value
+  // Retrieve the number of items that have a stock level under the threshold value. The length of the IN list differs
+  // between executions, so that this statement is not prepared.
   _sql_executor.execute(std::string{"SELECT COUNT(*) FROM STOCK WHERE S_I_ID IN ("} + ol_i_ids +
                         ") AND S_W_ID = " + std::to_string(w_id) + " AND S_QUANTITY < " + std::to_string(threshold));
 
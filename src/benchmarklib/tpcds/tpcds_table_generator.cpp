@@ -37,10 +37,8 @@ extern "C" {
 }
 
 #include "benchmark_config.hpp"
-#include "import_export/binary/binary_parser.hpp"
+#include "benchmark_table_encoder.hpp"
 #include "table_builder.hpp"
-#include "utils/list_directory.hpp"
-#include "utils/timer.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
@@ -274,24 +272,20 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCDSTableGenerator::generat
   // try to load cached tables
   const auto cache_directory = "tpcds_cached_tables/sf-" + std::to_string(_scale_factor);  // NOLINT
   if (_benchmark_config->cache_binary_tables && std::filesystem::is_directory(cache_directory)) {
-    for (const auto& table_file : list_directory(cache_directory)) {
-      const auto table_name = table_file.stem();
-      auto timer = Timer{};
-      std::cout << "-  Loading table " << table_name << " from cached binary " << table_file.relative_path();
-
-      table_info_by_name[table_name].table = BinaryParser::parse(table_file);
-      table_info_by_name[table_name].loaded_from_binary = true;
-
-      std::cout << " (" << timer.lap_formatted() << ")" << std::endl;
+    if (auto cached_table_info_by_name = _load_binary_tables_from_cache(cache_directory)) {
+      return *cached_table_info_by_name;
     }
-
-    return table_info_by_name;
   }
 
+  // dsdgen is not thread-safe, so the tables are generated one after another. Each table is encoded by the
+  // BackgroundChunkEncoder while the next one is generated.
+  auto chunk_encoder = BackgroundChunkEncoder{_benchmark_config->encoding_config};
+
   for (const auto& table_name : {"call_center", "catalog_page", "customer_address", "customer", "customer_demographics",
                                  "date_dim", "household_demographics", "income_band", "inventory", "item", "promotion",
                                  "reason", "ship_mode", "store", "time_dim", "warehouse", "web_page", "web_site"}) {
     table_info_by_name[table_name].table = _generate_table(table_name);
+    chunk_encoder.encode_table(table_name, table_info_by_name[table_name].table);
   }
 
   for (const auto& [sales_table_name, returns_table_name] : std::vector<std::pair<std::string, std::string>>{
@@ -299,8 +293,12 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCDSTableGenerator::generat
     auto catalog_sales_and_returns = _generate_sales_and_returns_tables(sales_table_name);
     table_info_by_name[sales_table_name].table = catalog_sales_and_returns.first;
     table_info_by_name[returns_table_name].table = catalog_sales_and_returns.second;
+    chunk_encoder.encode_table(sales_table_name, catalog_sales_and_returns.first);
+    chunk_encoder.encode_table(returns_table_name, catalog_sales_and_returns.second);
   }
 
+  chunk_encoder.wait();
+
   if (_benchmark_config->cache_binary_tables) {
     std::filesystem::create_directories(cache_directory);
     for (auto& [table_name, table_info] : table_info_by_name) {
@@ -10,12 +10,10 @@ extern "C" {
 #include <utility>
 
 #include "benchmark_config.hpp"
-#include "import_export/binary/binary_parser.hpp"
+#include "benchmark_table_encoder.hpp"
 #include "storage/chunk.hpp"
 #include "storage/table_key_constraint.hpp"
 #include "table_builder.hpp"
-#include "utils/list_directory.hpp"
-#include "utils/timer.hpp"
 
 extern char** asc_date;
 extern seed_t seed[];  // NOLINT
@@ -127,23 +125,9 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
 
   const auto cache_directory = std::string{"tpch_cached_tables/sf-"} + std::to_string(_scale_factor);  // NOLINT
   if (_benchmark_config->cache_binary_tables && std::filesystem::is_directory(cache_directory)) {
-    std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
-
-    for (const auto& table_file : list_directory(cache_directory)) {
-      const auto table_name = table_file.stem();
-      Timer timer;
-      std::cout << "-  Loading table " << table_name << " from cached binary " << table_file.relative_path();
-
-      BenchmarkTableInfo table_info;
-      table_info.table = BinaryParser::parse(table_file);
-      table_info.loaded_from_binary = true;
-      table_info.binary_file_path = table_file;
-      table_info_by_name[table_name] = table_info;
-
-      std::cout << " (" << timer.lap_formatted() << ")" << std::endl;
+    if (auto table_info_by_name = _load_binary_tables_from_cache(cache_directory)) {
+      return *table_info_by_name;
     }
-
-    return table_info_by_name;
   }
 
   // Init tpch_dbgen - it is important this is done before any data structures from tpch_dbgen are read.
@@ -171,6 +155,26 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
   TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, nation_count};
   TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, region_count};
 
+  // dbgen is not thread-safe, so the rows are generated in a single thread. Meanwhile, the completed chunks are
+  // encoded by the BackgroundChunkEncoder. Tables that are sorted later are encoded after sorting, as the Sort
+  // operator materializes the segments (see AbstractTableGenerator::generate_and_store()).
+  auto chunk_encoder = BackgroundChunkEncoder{_benchmark_config->encoding_config};
+  const auto sort_order_by_table = _sort_order_by_table();
+  const auto encode_completed_chunks = [&](auto& table_builder, const std::string& table_name) {
+    if (sort_order_by_table.contains(table_name)) return;
+    table_builder.set_chunk_completed_callback([&chunk_encoder, table_name](const auto& table, const auto chunk_id) {
+      chunk_encoder.encode_chunk(table_name, table, chunk_id);
+    });
+  };
+  encode_completed_chunks(customer_builder, "customer");
+  encode_completed_chunks(order_builder, "orders");
+  encode_completed_chunks(lineitem_builder, "lineitem");
+  encode_completed_chunks(part_builder, "part");
+  encode_completed_chunks(partsupp_builder, "partsupp");
+  encode_completed_chunks(supplier_builder, "supplier");
+  encode_completed_chunks(nation_builder, "nation");
+  encode_completed_chunks(region_builder, "region");
+
   /**
    * CUSTOMER
    */
@@ -301,6 +305,8 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
   auto region_table = region_builder.finish_table();
   table_info_by_name["region"].table = region_table;
 
+  chunk_encoder.wait();
+
   if (_benchmark_config->cache_binary_tables) {
     std::filesystem::create_directories(cache_directory);
     for (auto& [table_name, table_info] : table_info_by_name) {
@@ -372,6 +378,31 @@ void TPCHTableGenerator::_add_constraints(
   const auto region_pk_constraint =
       TableKeyConstraint{{region_table->column_id_by_name("r_regionkey")}, KeyConstraintType::PRIMARY_KEY};
   region_table->add_soft_key_constraint(region_pk_constraint);
+
+  // Foreign keys as per TPC-H Specification, paragraph 1.4.2
+  const auto add_foreign_key_constraint = [&](const auto& table, const std::vector<std::string>& column_names,
+                                              const std::string& referenced_table_name,
+                                              const std::vector<std::string>& referenced_column_names) {
+    const auto& referenced_table = table_info_by_name.at(referenced_table_name).table;
+    auto column_ids = std::vector<ColumnID>{};
+    auto referenced_column_ids = std::vector<ColumnID>{};
+    for (auto column_index = size_t{0}; column_index < column_names.size(); ++column_index) {
+      column_ids.emplace_back(table->column_id_by_name(column_names[column_index]));
+      referenced_column_ids.emplace_back(referenced_table->column_id_by_name(referenced_column_names[column_index]));
+    }
+    table->add_soft_foreign_key_constraint({column_ids, referenced_table_name, referenced_column_ids});
+  };
+
+  add_foreign_key_constraint(customer_table, {"c_nationkey"}, "nation", {"n_nationkey"});
+  add_foreign_key_constraint(orders_table, {"o_custkey"}, "customer", {"c_custkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_orderkey"}, "orders", {"o_orderkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_partkey"}, "part", {"p_partkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_suppkey"}, "supplier", {"s_suppkey"});
+  add_foreign_key_constraint(lineitem_table, {"l_partkey", "l_suppkey"}, "partsupp", {"ps_partkey", "ps_suppkey"});
+  add_foreign_key_constraint(partsupp_table, {"ps_partkey"}, "part", {"p_partkey"});
+  add_foreign_key_constraint(partsupp_table, {"ps_suppkey"}, "supplier", {"s_suppkey"});
+  add_foreign_key_constraint(supplier_table, {"s_nationkey"}, "nation", {"n_nationkey"});
+  add_foreign_key_constraint(nation_table, {"n_regionkey"}, "region", {"r_regionkey"});
 }
 
 }  // namespace opossum
@@ -5,6 +5,8 @@
 
 #include "benchmark_config.hpp"
 #include "cli_config_parser.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
 #include "server/server.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
@@ -61,6 +63,9 @@ cxxopts::Options get_server_cli_options() {
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>()) // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("wal_directory", "Optional: make committed transactions durable by logging them to this directory. On start, the "
+                      "tables stored in the directory are recovered.", cxxopts::value<std::string>()) // NOLINT
+    ("checkpoint_interval", "Seconds between two checkpoints of the write-ahead log (0 disables periodic checkpoints)", cxxopts::value<uint32_t>()->default_value("300")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -89,6 +94,13 @@ int main(int argc, char* argv[]) {
     generate_benchmark_data(parsed_options["benchmark_data"].as<std::string>());
   }
 
+  if (parsed_options.count("wal_directory")) {
+    const auto checkpoint_interval = std::chrono::seconds{parsed_options["checkpoint_interval"].as<uint32_t>()};
+    opossum::Hyrise::get().write_ahead_log = std::make_shared<opossum::WriteAheadLog>(
+        parsed_options["wal_directory"].as<std::string>(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(checkpoint_interval));
+  }
+
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
 
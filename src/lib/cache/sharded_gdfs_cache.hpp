@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_cache.hpp"
+#include "boost/heap/fibonacci_heap.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Cache implementation using the GDFS policy (see gdfs_cache.hpp) for caches that are read by many threads at once,
+ * such as the plan caches, which are queried by every SQL statement of every session. Different from the GDFSCache,
+ * a hit does not need an exclusive lock:
+ *
+ *   (1) The entries are distributed over shards by the hash of their key. Each shard has its own lock, heap, and
+ *       inflation value and holds its share of the capacity. Caches with a capacity below 2 * MIN_SHARD_CAPACITY only
+ *       have a single shard, so that they behave exactly like the GDFSCache.
+ *   (2) A hit only locks its shard in shared mode and counts itself in an atomic counter of the entry. The frequencies
+ *       and priorities of the entries are updated from these counters when the heap is needed, i.e., before an entry
+ *       is evicted. As the inflation value only changes on evictions, this results in the same priorities as updating
+ *       them on each hit.
+ *
+ * To iterate over the cache in a thread-safe manner, use the copy provided by snapshot().
+ */
+template <typename Key, typename Value>
+class ShardedGDFSCache : public AbstractCache<Key, Value> {
+ public:
+  using SnapshotEntry = typename AbstractCache<Key, Value>::SnapshotEntry;
+
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{64};
+  static constexpr auto MAX_SHARD_COUNT = size_t{16};
+
+  explicit ShardedGDFSCache(size_t capacity = DEFAULT_CACHE_CAPACITY)
+      : AbstractCache<Key, Value>(capacity),
+        _shards(std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, MAX_SHARD_COUNT)) {}
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) final {
+    const auto shard_index = _shard_index(key);
+    auto& shard = _shards[shard_index];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    const auto shard_capacity = _shard_capacity(shard_index);
+    if (shard_capacity == 0) return;
+
+    auto it = shard.map.find(key);
+    if (it != shard.map.end()) {
+      // Update priority.
+      auto& entry = it->second;
+      entry.value = value;
+      entry.size = size;
+      entry.frequency += entry.pending_hits.exchange(0) + 1;
+      _update_priority(shard, entry);
+      return;
+    }
+
+    // If the shard is full, evict the item at the top of its heap so that we can insert the new item.
+    if (shard.map.size() >= shard_capacity) {
+      _evict(shard);
+    }
+
+    // Insert new item in cache.
+    auto& entry = shard.map.try_emplace(key).first->second;
+    entry.value = value;
+    entry.size = size;
+    entry.frequency = 1;
+    entry.handle = shard.queue.push(HeapEntry{key, shard.inflation + static_cast<double>(entry.frequency) / size});
+  }
+
+  std::optional<Value> try_get(const Key& query) final {
+    auto& shard = _shards[_shard_index(query)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    const auto it = shard.map.find(query);
+    if (it == shard.map.end()) return std::nullopt;
+
+    // The priority is updated before the next eviction
+    it->second.pending_hits.fetch_add(1, std::memory_order_relaxed);
+    return it->second.value;
+  }
+
+  bool has(const Key& key) const final {
+    const auto& shard = _shards[_shard_index(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+  }
+
+  size_t size() const final {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+  void clear() final {
+    for (auto& shard : _shards) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.map.clear();
+      shard.queue.clear();
+    }
+  }
+
+  // The number of shards is fixed at construction. Thus, shrinking the cache considerably can leave shards without
+  // capacity, whose keys are no longer cached.
+  void resize(size_t capacity) final {
+    this->_capacity = capacity;
+
+    for (auto shard_index = size_t{0}; shard_index < _shards.size(); ++shard_index) {
+      auto& shard = _shards[shard_index];
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      while (shard.map.size() > _shard_capacity(shard_index)) {
+        _evict(shard);
+      }
+    }
+  }
+
+  std::unordered_map<Key, SnapshotEntry> snapshot() const final {
+    std::unordered_map<Key, SnapshotEntry> map_copy;
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      for (const auto& [key, entry] : shard.map) {
+        map_copy[key] = SnapshotEntry{entry.value, entry.frequency + entry.pending_hits.load()};
+      }
+    }
+    return map_copy;
+  }
+
+  size_t shard_count() const { return _shards.size(); }
+
+ protected:
+  struct HeapEntry {
+    Key key;
+    double priority;
+
+    // The underlying heap is a max-heap.
+    // To have the item with lowest priority at the top, we invert the comparison.
+    bool operator<(const HeapEntry& other) const { return priority > other.priority; }
+  };
+
+  using Handle = typename boost::heap::fibonacci_heap<HeapEntry>::handle_type;
+
+  struct ShardEntry {
+    Value value{};
+    double size{1.0};
+    size_t frequency{0};
+
+    // Hits that are not yet part of the frequency and the priority
+    std::atomic_size_t pending_hits{0};
+
+    Handle handle{};
+  };
+
+  struct Shard {
+    // Priority queue to hold all elements of the shard. Implemented as max-heap.
+    boost::heap::fibonacci_heap<HeapEntry> queue;
+
+    // The entries are not moved by the unordered_map, which allows them to hold atomic counters
+    std::unordered_map<Key, ShardEntry> map;
+
+    // Inflation value that will be updated whenever an item of the shard is evicted.
+    double inflation{0.0};
+
+    mutable std::shared_mutex mutex;
+  };
+
+  size_t _shard_index(const Key& key) const { return std::hash<Key>{}(key) % _shards.size(); }
+
+  // The capacity is split evenly among the shards
+  size_t _shard_capacity(const size_t shard_index) const {
+    const auto capacity = this->_capacity.load();
+    const auto shard_count = _shards.size();
+    return capacity / shard_count + (shard_index < capacity % shard_count ? 1 : 0);
+  }
+
+  static void _update_priority(Shard& shard, ShardEntry& entry) {
+    (*entry.handle).priority = shard.inflation + static_cast<double>(entry.frequency) / entry.size;
+    shard.queue.update(entry.handle);
+  }
+
+  // Evicts an item from the fullest shard
+  void _evict() final {
+    const auto fullest_shard = std::max_element(_shards.begin(), _shards.end(), [](const auto& lhs, const auto& rhs) {
+      std::shared_lock<std::shared_mutex> lhs_lock(lhs.mutex);
+      std::shared_lock<std::shared_mutex> rhs_lock(rhs.mutex);
+      return lhs.map.size() < rhs.map.size();
+    });
+
+    std::unique_lock<std::shared_mutex> lock(fullest_shard->mutex);
+    if (!fullest_shard->map.empty()) {
+      _evict(*fullest_shard);
+    }
+  }
+
+  // Requires the shard to be locked exclusively
+  static void _evict(Shard& shard) {
+    DebugAssert(!shard.map.empty(), "Cannot evict from an empty shard");
+
+    // Apply the hits since the last eviction, which all happened with the current inflation value
+    for (auto& [key, entry] : shard.map) {
+      const auto pending_hits = entry.pending_hits.exchange(0);
+      if (pending_hits == 0) continue;
+
+      entry.frequency += pending_hits;
+      _update_priority(shard, entry);
+    }
+
+    const auto top = shard.queue.top();
+
+    shard.inflation = top.priority;
+    shard.map.erase(top.key);
+    shard.queue.pop();
+  }
+
+  std::vector<Shard> _shards;
+};
+
+}  // namespace opossum
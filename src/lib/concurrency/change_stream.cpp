@@ -0,0 +1,189 @@
+#include "change_stream.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Distinguishes the temporary files of snapshots that are sent concurrently
+std::atomic<size_t> next_snapshot_id{0};
+
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+}  // namespace
+
+namespace opossum {
+
+ChangeStream::ReplicaConnection::ReplicaConnection(boost::asio::io_service& io_service) : socket(io_service) {}
+
+ChangeStream::ChangeStream(const uint16_t port)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
+  _accept_replica();
+  _network_thread = std::thread{[&]() { _io_service.run(); }};
+}
+
+ChangeStream::~ChangeStream() {
+  // Closing the acceptor aborts the pending accept, so that the network thread runs out of work
+  boost::asio::post(_io_service, [&]() { _acceptor.close(); });
+  _network_thread.join();
+
+  for (const auto& connection : _connections) {
+    {
+      std::lock_guard<std::mutex> lock(connection->mutex);
+      connection->closed = true;
+    }
+    connection->condition_variable.notify_one();
+
+    // Unblocks a thread that is still sending to a replica
+    auto error = boost::system::error_code{};
+    connection->socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+    connection->thread.join();
+  }
+}
+
+uint16_t ChangeStream::port() const { return _acceptor.local_endpoint().port(); }
+
+size_t ChangeStream::subscribe(Subscriber&& subscriber) {
+  std::lock_guard<std::mutex> lock(_subscribers_mutex);
+  const auto subscription_id = _next_subscription_id++;
+  _subscribers.emplace(subscription_id, std::move(subscriber));
+  return subscription_id;
+}
+
+void ChangeStream::unsubscribe(const size_t subscription_id) {
+  std::lock_guard<std::mutex> lock(_subscribers_mutex);
+  _subscribers.erase(subscription_id);
+}
+
+void ChangeStream::publish(const CommitID commit_id, const std::shared_ptr<const std::vector<char>>& records) {
+  std::lock_guard<std::mutex> lock(_subscribers_mutex);
+  for (const auto& [subscription_id, subscriber] : _subscribers) {
+    subscriber(commit_id, records);
+  }
+}
+
+void ChangeStream::_accept_replica() {
+  auto connection = std::make_shared<ReplicaConnection>(_io_service);
+  _acceptor.async_accept(connection->socket, [this, connection](const boost::system::error_code& error) {
+    // The acceptor has been closed by the destructor
+    if (error == boost::asio::error::operation_aborted) return;
+    Assert(!error, error.message());
+
+    connection->socket.set_option(boost::asio::ip::tcp::no_delay(true));
+    connection->thread = std::thread{[this, connection]() { _serve_replica(*connection); }};
+    {
+      std::lock_guard<std::mutex> lock(_connections_mutex);
+      _connections.emplace_back(connection);
+    }
+
+    _accept_replica();
+  });
+}
+
+void ChangeStream::_serve_replica(ReplicaConnection& connection) {
+  // Subscribe before taking the snapshot, so that no commit after the snapshot is missed
+  const auto subscription_id = subscribe([&connection](const CommitID commit_id, const auto& records) {
+    {
+      std::lock_guard<std::mutex> lock(connection.mutex);
+      connection.changes.emplace_back(commit_id, records);
+    }
+    connection.condition_variable.notify_one();
+  });
+
+  try {
+    const auto snapshot_commit_id = _send_snapshot(connection.socket);
+
+    while (true) {
+      auto changes = std::deque<std::pair<CommitID, std::shared_ptr<const std::vector<char>>>>{};
+      {
+        auto lock = std::unique_lock<std::mutex>{connection.mutex};
+        connection.condition_variable.wait(lock, [&]() { return !connection.changes.empty() || connection.closed; });
+        if (connection.closed) break;
+        changes.swap(connection.changes);
+      }
+
+      auto buffer = std::vector<char>{};
+      for (const auto& [commit_id, records] : changes) {
+        // Commits that were published while the snapshot was taken can be part of it
+        if (commit_id <= snapshot_commit_id) continue;
+
+        append_value(buffer, static_cast<uint32_t>(records->size()));
+        append_value(buffer, commit_id);
+        buffer.insert(buffer.end(), records->begin(), records->end());
+      }
+      boost::asio::write(connection.socket, boost::asio::buffer(buffer));
+    }
+  } catch (const boost::system::system_error& error) {
+    Hyrise::get().log_manager.add_message("ChangeStream", "Replica disconnected: " + std::string{error.what()},
+                                          LogLevel::Info);
+  }
+
+  unsubscribe(subscription_id);
+}
+
+CommitID ChangeStream::_send_snapshot(boost::asio::ip::tcp::socket& socket) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto tables = Hyrise::get().storage_manager.tables();
+  const auto snapshot_path = std::filesystem::temp_directory_path() /
+                             ("hyrise_snapshot_" + std::to_string(getpid()) + "_" + std::to_string(next_snapshot_id++));
+
+  auto buffer = std::vector<char>{};
+  append_value(buffer, static_cast<uint32_t>(tables.size()));
+  boost::asio::write(socket, boost::asio::buffer(buffer));
+
+  // The tables are sent one after another, so that only one of them is buffered at a time
+  for (const auto& [table_name, table] : tables) {
+    auto snapshot = std::shared_ptr<const Table>{table};
+    if (table->uses_mvcc() == UseMvcc::Yes) {
+      const auto get_table = std::make_shared<GetTable>(table_name);
+      get_table->execute();
+      const auto validate = std::make_shared<Validate>(get_table);
+      validate->set_transaction_context(transaction_context);
+      validate->execute();
+      snapshot = validate->get_output();
+    }
+    BinaryWriter::write(*snapshot, snapshot_path, table->table_statistics());
+
+    auto file = std::ifstream{snapshot_path, std::ios::binary};
+    const auto table_data = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    std::filesystem::remove(snapshot_path);
+
+    buffer.clear();
+    append_value(buffer, static_cast<uint32_t>(table_name.size()));
+    buffer.insert(buffer.end(), table_name.begin(), table_name.end());
+    append_value(buffer, static_cast<uint64_t>(table_data.size()));
+    boost::asio::write(socket, boost::asio::buffer(buffer));
+    boost::asio::write(socket, boost::asio::buffer(table_data));
+  }
+
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  buffer.clear();
+  append_value(buffer, snapshot_commit_id);
+  boost::asio::write(socket, boost::asio::buffer(buffer));
+  return snapshot_commit_id;
+}
+
+}  // namespace opossum
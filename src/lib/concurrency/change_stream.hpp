@@ -0,0 +1,96 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Streams the changes of committed transactions to read replicas (see Replica).
+ *
+ * The changes of a commit are the redo records that its read/write operators also write to the WriteAheadLog, i.e.,
+ * the values of the rows it inserted and deleted (see AbstractReadWriteOperator::write_log_records). They are
+ * published once the commit is visible. As the TransactionManager makes commits visible in the order of their commit
+ * ids, subscribers receive the changes in commit order. Commits without changes are not published.
+ *
+ * Replicas connect via TCP. A replica first receives a snapshot of all tables of the StorageManager and then the
+ * changes of all commits after the snapshot. Each replica is served by its own thread, which sends the changes that
+ * were published while it sent the previous ones in one write. There is no backpressure: The changes for a replica
+ * that does not keep up are buffered.
+ *
+ * As with the WriteAheadLog, only changes to the data of tables are streamed. Tables that are created or dropped after
+ * a replica connected are not replicated.
+ *
+ * Protocol (integers in host byte order, i.e., primary and replicas must have the same architecture):
+ *   Snapshot:  [u32 table count] ([u32 name size][name][u64 table size][table written by BinaryWriter])*
+ *              [CommitID snapshot commit id]
+ *   Changes:   ([u32 records size][CommitID commit id][records])*
+ */
+class ChangeStream : public Noncopyable {
+ public:
+  using Subscriber =
+      std::function<void(const CommitID commit_id, const std::shared_ptr<const std::vector<char>>& records)>;
+
+  // Accepts replicas on the port. For port 0, the operating system chooses a free port.
+  explicit ChangeStream(const uint16_t port = 0);
+
+  // Disconnects all replicas
+  ~ChangeStream();
+
+  uint16_t port() const;
+
+  /**
+   * Subscribers receive the changes of all commits that are published after they subscribed. They are called by the
+   * thread that publishes the commit and should return quickly.
+   */
+  size_t subscribe(Subscriber&& subscriber);
+  void unsubscribe(const size_t subscription_id);
+
+  // Called by the TransactionContext once the commit is visible
+  void publish(const CommitID commit_id, const std::shared_ptr<const std::vector<char>>& records);
+
+ private:
+  struct ReplicaConnection {
+    explicit ReplicaConnection(boost::asio::io_service& io_service);
+
+    boost::asio::ip::tcp::socket socket;
+    std::thread thread;
+
+    // Protects the changes that have not been sent yet
+    std::mutex mutex;
+    std::condition_variable condition_variable;
+    std::deque<std::pair<CommitID, std::shared_ptr<const std::vector<char>>>> changes;
+    bool closed{false};
+  };
+
+  void _accept_replica();
+  void _serve_replica(ReplicaConnection& connection);
+
+  // Sends a snapshot of all tables and returns its commit id
+  CommitID _send_snapshot(boost::asio::ip::tcp::socket& socket);
+
+  std::mutex _subscribers_mutex;
+  std::map<size_t, Subscriber> _subscribers;
+  size_t _next_subscription_id{0};
+
+  boost::asio::io_service _io_service;
+  boost::asio::ip::tcp::acceptor _acceptor;
+  std::thread _network_thread;
+
+  std::mutex _connections_mutex;
+  std::vector<std::shared_ptr<ReplicaConnection>> _connections;
+};
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include "epoch_manager.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+EpochManager::Guard::Guard(std::atomic<uint64_t>& slot) : _slot(slot) {}
+
+EpochManager::Guard::~Guard() {
+  // The epoch in the upper bits becomes meaningless once the pin count drops to zero
+  const auto previous_state = _slot.fetch_sub(1);
+  DebugAssert((previous_state & 0xFFFFFFFF) > 0, "Epoch was not pinned");
+}
+
+EpochManager::Guard EpochManager::pin() {
+  static thread_local const auto slot_id = std::hash<std::thread::id>{}(std::this_thread::get_id()) % PIN_SLOT_COUNT;
+  auto& slot = _pin_slots[slot_id].state;
+
+  auto expected_state = slot.load();
+  while (true) {
+    // Join a slot that is already pinned by another thread with its (older) epoch
+    const auto pin_count = expected_state & 0xFFFFFFFF;
+    const auto desired_state =
+        pin_count == 0 ? (static_cast<uint64_t>(_global_epoch.load()) << 32u) | 1 : expected_state + 1;
+    if (slot.compare_exchange_weak(expected_state, desired_state)) break;
+  }
+
+  return Guard{slot};
+}
+
+void EpochManager::_retire(std::function<void()>&& deleter) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_retired_mutex};
+    // Readers that pin after the increment cannot see the object anymore, as it was unlinked before
+    _retired.emplace_back(_global_epoch.fetch_add(1), std::move(deleter));
+  }
+
+  reclaim();
+}
+
+size_t EpochManager::reclaim() {
+  auto lowest_pinned_epoch = std::numeric_limits<uint32_t>::max();
+  for (const auto& pin_slot : _pin_slots) {
+    const auto state = pin_slot.state.load();
+    if ((state & 0xFFFFFFFF) > 0) {
+      lowest_pinned_epoch = std::min(lowest_pinned_epoch, static_cast<uint32_t>(state >> 32u));
+    }
+  }
+
+  auto reclaimable = std::vector<std::function<void()>>{};
+  auto remaining_count = size_t{0};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_retired_mutex};
+    const auto partition_end = std::stable_partition(_retired.begin(), _retired.end(), [&](const auto& retired) {
+      return retired.first >= lowest_pinned_epoch;
+    });
+    for (auto iter = partition_end; iter != _retired.end(); ++iter) {
+      reclaimable.emplace_back(std::move(iter->second));
+    }
+    _retired.erase(partition_end, _retired.end());
+    remaining_count = _retired.size();
+  }
+
+  // Deleting an object might release large amounts of memory (e.g., the last reference to a chunk), which should not
+  // happen while holding the lock
+  for (const auto& deleter : reclaimable) {
+    deleter();
+  }
+
+  return remaining_count;
+}
+
+size_t EpochManager::retired_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_retired_mutex};
+  return _retired.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Epoch-based reclamation for objects that readers access without holding a lock or a reference count, e.g., the
+ * chunk holders of a Table (see Table::get_chunk). Readers pin the current epoch for the duration of the access. An
+ * object that was unlinked by a writer is retired with the current epoch and freed once no thread is pinned to that
+ * or an earlier epoch anymore, as only those threads might still have seen the object.
+ *
+ * Pins are counted in cache-line aligned slots that are selected by the thread id. Threads sharing a slot keep the
+ * oldest epoch of the slot pinned, which delays the reclamation, but is always safe. Pinning costs one
+ * compare-and-swap on a slot that is, in most cases, not used by other threads. The EpochManager is a Singleton
+ * instead of a member of Hyrise, as tables can outlive Hyrise::reset().
+ */
+class EpochManager : public Singleton<EpochManager> {
+ public:
+  // Keeps the epoch of the calling thread pinned until it is destroyed
+  class Guard : public Noncopyable {
+   public:
+    explicit Guard(std::atomic<uint64_t>& slot);
+    ~Guard();
+
+   private:
+    std::atomic<uint64_t>& _slot;
+  };
+
+  Guard pin();
+
+  // Deletes the object once all readers that might still access it have unpinned their epochs
+  template <typename T>
+  void retire(T* object) {
+    _retire([object]() { delete object; });
+  }
+
+  // Frees the retired objects that no pinned reader can access anymore and returns the number of objects that are
+  // still retired. Called by retire() and periodically by the MvccDeletePlugin.
+  size_t reclaim();
+
+  size_t retired_count() const;
+
+ private:
+  friend class Singleton;
+
+  EpochManager() = default;
+
+  void _retire(std::function<void()>&& deleter);
+
+  struct alignas(64) PinSlot {
+    std::atomic<uint64_t> state{0};  // pinned epoch in the upper 32 bits, pin count in the lower 32 bits
+  };
+
+  static constexpr auto PIN_SLOT_COUNT = uint32_t{256};
+
+  std::array<PinSlot, PIN_SLOT_COUNT> _pin_slots;
+
+  std::atomic<uint32_t> _global_epoch{1};
+
+  mutable std::mutex _retired_mutex;
+  std::vector<std::pair<uint32_t, std::function<void()>>> _retired;  // retire epoch, deleter
+};
+
+}  // namespace opossum
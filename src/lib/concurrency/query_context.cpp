@@ -0,0 +1,87 @@
+#include "query_context.hpp"
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<uint64_t> next_query_id{1};
+
+}  // namespace
+
+QueryContext::QueryContext(const std::string& sql, const SessionID session_id,
+                           const std::optional<size_t> memory_limit)
+    : _id(next_query_id++),
+      _sql(sql),
+      _session_id(session_id),
+      _started(std::chrono::steady_clock::now()),
+      _memory_resource(std::make_shared<TrackingMemoryResource>(nullptr, memory_limit)) {}
+
+uint64_t QueryContext::id() const { return _id; }
+
+const std::string& QueryContext::sql() const { return _sql; }
+
+SessionID QueryContext::session_id() const { return _session_id; }
+
+std::chrono::nanoseconds QueryContext::elapsed_time() const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _started);
+}
+
+void QueryContext::cancel() { _cancelled = true; }
+
+bool QueryContext::is_cancelled() const {
+  return _cancelled.load(std::memory_order_relaxed) || _memory_resource->limit_exceeded();
+}
+
+bool QueryContext::memory_limit_exceeded() const { return _memory_resource->limit_exceeded(); }
+
+const std::shared_ptr<TrackingMemoryResource>& QueryContext::memory_resource() const { return _memory_resource; }
+
+void QueryContext::set_physical_plan(const std::shared_ptr<const AbstractOperator>& physical_plan) {
+  const auto lock = std::lock_guard<std::mutex>{_physical_plan_mutex};
+  _physical_plan = physical_plan;
+}
+
+std::shared_ptr<const AbstractOperator> QueryContext::physical_plan() const {
+  const auto lock = std::lock_guard<std::mutex>{_physical_plan_mutex};
+  return _physical_plan.lock();
+}
+
+RunningQueries& RunningQueries::operator=(RunningQueries&& running_queries) noexcept {
+  const auto lock = std::scoped_lock{_mutex, running_queries._mutex};
+  _query_contexts = std::move(running_queries._query_contexts);
+  return *this;
+}
+
+void RunningQueries::add(const std::shared_ptr<QueryContext>& query_context) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _query_contexts.emplace(query_context->id(), query_context);
+}
+
+void RunningQueries::remove(const QueryContext& query_context) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _query_contexts.erase(query_context.id());
+}
+
+std::vector<std::shared_ptr<QueryContext>> RunningQueries::query_contexts() const {
+  auto query_contexts = std::vector<std::shared_ptr<QueryContext>>{};
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  query_contexts.reserve(_query_contexts.size());
+  for (const auto& [query_id, query_context] : _query_contexts) {
+    query_contexts.emplace_back(query_context);
+  }
+  return query_contexts;
+}
+
+bool RunningQueries::cancel(const uint64_t query_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto query_context_iter = _query_contexts.find(query_id);
+  if (query_context_iter == _query_contexts.end()) return false;
+
+  query_context_iter->second->cancel();
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "memory/tracking_memory_resource.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Represents a running SQL statement, whose progress is shown in the meta_running_queries table and which can be
+ * cancelled from another thread.
+ *
+ * The SQLPipelineStatement creates the context before executing its physical plan and passes it to all of the plan's
+ * operators. Operators with per-chunk loops (e.g., TableScan, JoinHash, JoinNestedLoop, and AggregateHash) count the
+ * chunks that they have processed (see AbstractOperator::progress()) and check for cancellation between the chunks.
+ * Cancellation is cooperative: A cancelled operator stops processing its input and returns an incomplete output. Once
+ * the plan has finished, the SQLPipelineStatement rolls back the transaction and fails. Operators that are executed
+ * for subqueries do not see the context and run to completion.
+ *
+ * The memory that the operators allocate for their intermediate data structures (e.g., hash tables and
+ * ExpressionResults) and the memory of their output tables are accounted by the context's memory resource. If a memory
+ * limit is given (see Hyrise::query_memory_limit) and exceeded, the query is cancelled.
+ */
+class QueryContext : public Noncopyable {
+ public:
+  QueryContext(const std::string& sql, const SessionID session_id,
+               const std::optional<size_t> memory_limit = std::nullopt);
+
+  // Unique within the process
+  uint64_t id() const;
+
+  const std::string& sql() const;
+  SessionID session_id() const;
+  std::chrono::nanoseconds elapsed_time() const;
+
+  void cancel();
+
+  // True if the query was cancelled or its memory limit was exceeded
+  bool is_cancelled() const;
+  bool memory_limit_exceeded() const;
+
+  // The parent of the memory resources of the operators
+  const std::shared_ptr<TrackingMemoryResource>& memory_resource() const;
+
+  // The operators of the plan report their progress. Held weakly, as the operators hold the context.
+  void set_physical_plan(const std::shared_ptr<const AbstractOperator>& physical_plan);
+  std::shared_ptr<const AbstractOperator> physical_plan() const;
+
+ private:
+  const uint64_t _id;
+  const std::string _sql;
+  const SessionID _session_id;
+  const std::chrono::steady_clock::time_point _started;
+
+  std::atomic_bool _cancelled{false};
+  const std::shared_ptr<TrackingMemoryResource> _memory_resource;
+
+  mutable std::mutex _physical_plan_mutex;
+  std::weak_ptr<const AbstractOperator> _physical_plan;
+};
+
+// The contexts of the statements that are currently executed
+class RunningQueries : public Noncopyable {
+ public:
+  RunningQueries() = default;
+
+  void add(const std::shared_ptr<QueryContext>& query_context);
+  void remove(const QueryContext& query_context);
+
+  std::vector<std::shared_ptr<QueryContext>> query_contexts() const;
+
+  // Returns false if no query with the id is running
+  bool cancel(const uint64_t query_id);
+
+ protected:
+  friend class Hyrise;
+  RunningQueries& operator=(RunningQueries&& running_queries) noexcept;
+
+ private:
+  mutable std::mutex _mutex;
+  std::map<uint64_t, std::shared_ptr<QueryContext>> _query_contexts;
+};
+
+}  // namespace opossum
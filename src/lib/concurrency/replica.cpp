@@ -0,0 +1,220 @@
+#include "replica.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Replica::Replica() = default;
+
+Replica::Replica(const std::string& host, const uint16_t port)
+    : _socket(std::make_unique<boost::asio::ip::tcp::socket>(_io_service)) {
+  auto resolver = boost::asio::ip::tcp::resolver{_io_service};
+  boost::asio::connect(*_socket, resolver.resolve(host, std::to_string(port)));
+  _socket->set_option(boost::asio::ip::tcp::no_delay(true));
+
+  _receive_snapshot();
+  _receive_thread = std::thread{[&]() { _receive_changes(); }};
+}
+
+Replica::~Replica() {
+  if (!_socket) return;
+
+  // Unblocks the receive thread
+  auto error = boost::system::error_code{};
+  _socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+  _receive_thread.join();
+}
+
+CommitID Replica::applied_commit_id() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _applied_commit_id;
+}
+
+void Replica::wait_for_commit(const CommitID commit_id) {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _applied_condition_variable.wait(lock, [&]() { return _applied_commit_id >= commit_id || _disconnected; });
+}
+
+void Replica::apply(const CommitID commit_id, const std::string_view records) {
+  Assert(commit_id > applied_commit_id(), "Changes must be applied in commit order");
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _applying_transaction_id = transaction_context->transaction_id();
+
+  WriteAheadLog::read_records(records, [&](const auto& table_name, const auto is_delete, const auto& rows,
+                                           const auto& encoded_rows) {
+    if (is_delete) {
+      _delete_rows(table_name, encoded_rows, transaction_context);
+    } else {
+      _insert_rows(table_name, rows, transaction_context);
+    }
+  });
+
+  // No other transaction modifies the replicated tables, so applying the changes cannot conflict
+  Assert(!transaction_context->aborted(), "Applying the changes of a commit failed");
+  transaction_context->commit();
+  _applying_transaction_id = INVALID_TRANSACTION_ID;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _applied_commit_id = commit_id;
+  }
+  _applied_condition_variable.notify_all();
+}
+
+bool Replica::is_applying(const TransactionContext& transaction_context) const {
+  return transaction_context.transaction_id() == _applying_transaction_id;
+}
+
+void Replica::_receive_snapshot() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  const auto snapshot_path = std::filesystem::temp_directory_path() / ("hyrise_replica_" + std::to_string(getpid()));
+
+  auto table_count = uint32_t{0};
+  _read(&table_count, sizeof(table_count));
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    auto name_size = uint32_t{0};
+    _read(&name_size, sizeof(name_size));
+    auto table_name = std::string(name_size, '\0');
+    _read(table_name.data(), name_size);
+
+    auto table_size = uint64_t{0};
+    _read(&table_size, sizeof(table_size));
+    auto table_data = std::vector<char>(table_size);
+    _read(table_data.data(), table_size);
+
+    {
+      auto file = std::ofstream{snapshot_path, std::ios::binary};
+      file.write(table_data.data(), static_cast<std::streamsize>(table_data.size()));
+      Assert(file.good(), "Could not write snapshot of table '" + table_name + "'");
+    }
+    storage_manager.add_table(table_name, BinaryParser::parse(snapshot_path));
+    std::filesystem::remove(snapshot_path);
+  }
+
+  auto snapshot_commit_id = CommitID{0};
+  _read(&snapshot_commit_id, sizeof(snapshot_commit_id));
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _applied_commit_id = snapshot_commit_id;
+}
+
+void Replica::_receive_changes() {
+  try {
+    auto records = std::string{};
+    while (true) {
+      auto records_size = uint32_t{0};
+      _read(&records_size, sizeof(records_size));
+      auto commit_id = CommitID{0};
+      _read(&commit_id, sizeof(commit_id));
+      records.resize(records_size);
+      _read(records.data(), records_size);
+
+      apply(commit_id, records);
+    }
+  } catch (const boost::system::system_error& error) {
+    Hyrise::get().log_manager.add_message("Replica", "Disconnected from primary: " + std::string{error.what()},
+                                          LogLevel::Info);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _disconnected = true;
+  }
+  _applied_condition_variable.notify_all();
+}
+
+void Replica::_read(void* data, const size_t size) { boost::asio::read(*_socket, boost::asio::buffer(data, size)); }
+
+void Replica::_insert_rows(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows,
+                           const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto values_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  for (const auto& row : rows) {
+    values_table->append(row);
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+}
+
+void Replica::_delete_rows(const std::string& table_name, const std::vector<std::string_view>& encoded_rows,
+                           const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // A table that was replaced by one with the same name is indexed from scratch
+  auto& row_index = _row_indexes[table_name];
+  if (row_index.table != table) row_index = RowIndex{table, {}, {}};
+
+  // Index the rows that were inserted since the last delete
+  const auto chunk_count = table->chunk_count();
+  row_index.indexed_chunk_sizes.resize(chunk_count, ChunkOffset{0});
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = row_index.indexed_chunk_sizes[chunk_id]; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) continue;
+
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      row_index.row_ids_by_encoded_row[WriteAheadLog::encode_row(*table, row_id)].emplace_back(row_id);
+    }
+    row_index.indexed_chunk_sizes[chunk_id] = chunk_size;
+  }
+
+  // As rows with identical values are indistinguishable, it does not matter which of them is deleted
+  const auto pos_list = std::make_shared<RowIDPosList>();
+  pos_list->reserve(encoded_rows.size());
+  for (const auto& encoded_row : encoded_rows) {
+    const auto row_ids_iter = row_index.row_ids_by_encoded_row.find(std::string{encoded_row});
+    Assert(row_ids_iter != row_index.row_ids_by_encoded_row.end() && !row_ids_iter->second.empty(),
+           "Change deletes a row that does not exist in table '" + table_name + "'");
+    pos_list->emplace_back(row_ids_iter->second.back());
+    row_ids_iter->second.pop_back();
+  }
+  std::sort(pos_list->begin(), pos_list->end());
+
+  auto segments = Segments{};
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  const auto referencing_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  referencing_table->append_chunk(segments);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(referencing_table);
+  table_wrapper->execute();
+  const auto delete_operator = std::make_shared<Delete>(table_wrapper);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+/**
+ * Read replica of a primary that streams the changes of its commits (see ChangeStream).
+ *
+ * On construction, the replica connects to the primary and loads the snapshot of its tables into the StorageManager,
+ * which must not contain tables with the same names. Afterwards, a thread applies the changes of the primary's commits
+ * in commit order. The changes of each commit are applied in a single transaction of the replica. Thus, queries see
+ * the state of the primary after one of its commits, never a partially applied commit.
+ *
+ * Replicas are read-only: Apart from the transactions that apply changes, no transaction can execute read/write
+ * operators. Queries are executed with SQLPipelines as usual and see the changes that were applied before they
+ * started.
+ *
+ * Deleted rows are identified by their values (see WriteAheadLog). For each table with deletes, the replica keeps an
+ * index of the encoded rows, which is extended by the rows inserted since the last delete.
+ */
+class Replica : public Noncopyable {
+ public:
+  // Creates a replica that only receives changes via apply(), e.g., from a subscription to a ChangeStream
+  Replica();
+
+  Replica(const std::string& host, const uint16_t port);
+
+  // Disconnects from the primary. The replicated tables remain in the StorageManager.
+  ~Replica();
+
+  // The commit id of the primary up to which all changes have been applied
+  CommitID applied_commit_id() const;
+
+  /**
+   * Blocks until the changes up to the commit id of the primary have been applied or the primary disconnected. As
+   * commits without changes are not streamed, waiting for them returns only once a later commit has been applied.
+   */
+  void wait_for_commit(const CommitID commit_id);
+
+  // Applies the changes of a commit of the primary. Commits must be applied in commit order.
+  void apply(const CommitID commit_id, const std::string_view records);
+
+  // Returns true if the transaction applies changes. Only such transactions may execute read/write operators.
+  bool is_applying(const TransactionContext& transaction_context) const;
+
+ private:
+  // Encoded rows of a table that have not been deleted, and the number of rows of each chunk that have been indexed
+  struct RowIndex {
+    std::shared_ptr<const Table> table;
+    std::unordered_map<std::string, std::vector<RowID>> row_ids_by_encoded_row;
+    std::vector<ChunkOffset> indexed_chunk_sizes;
+  };
+
+  void _receive_snapshot();
+  void _receive_changes();
+  void _read(void* data, const size_t size);
+
+  void _insert_rows(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows,
+                    const std::shared_ptr<TransactionContext>& transaction_context);
+  void _delete_rows(const std::string& table_name, const std::vector<std::string_view>& encoded_rows,
+                    const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Only accessed by the thread that applies changes
+  std::unordered_map<std::string, RowIndex> _row_indexes;
+
+  std::atomic<TransactionID> _applying_transaction_id{INVALID_TRANSACTION_ID};
+
+  // Protects the applied commit id
+  mutable std::mutex _mutex;
+  std::condition_variable _applied_condition_variable;
+  CommitID _applied_commit_id{0};
+  bool _disconnected{false};
+
+  boost::asio::io_service _io_service;
+  std::unique_ptr<boost::asio::ip::tcp::socket> _socket;
+  std::thread _receive_thread;
+};
+
+}  // namespace opossum
@@ -1,23 +1,35 @@
 #include "transaction_context.hpp"
 
+#include <algorithm>
 #include <future>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "commit_context.hpp"
+#include "concurrency/change_stream.hpp"
+#include "concurrency/replica.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
-                                       const AutoCommit is_auto_commit)
+                                       const AutoCommit is_auto_commit, const TransactionAccessMode access_mode)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
       _is_auto_commit{is_auto_commit},
+      _access_mode{access_mode},
       _phase{TransactionPhase::Active},
       _num_active_operators{0} {
-  Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  if (_access_mode == TransactionAccessMode::ReadOnly) {
+    _reader_slot_id = Hyrise::get().transaction_manager._register_reader(snapshot_commit_id);
+  } else {
+    Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  }
 }
 
 TransactionContext::~TransactionContext() {
@@ -51,13 +63,26 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  if (_access_mode == TransactionAccessMode::ReadOnly) {
+    Hyrise::get().transaction_manager._deregister_reader(_snapshot_commit_id, _reader_slot_id);
+  } else {
+    Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  }
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
 AutoCommit TransactionContext::is_auto_commit() const { return _is_auto_commit; }
 
+bool TransactionContext::is_read_only() const { return _access_mode == TransactionAccessMode::ReadOnly; }
+
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
+  Assert(!is_read_only(), "Read-only transactions cannot execute read-write operators.");
+  const auto& replica = Hyrise::get().replica;
+  AssertInput(!replica || replica->is_applying(*this), "Replicas are read-only.");
+  _read_write_operators.push_back(op);
+}
+
 CommitID TransactionContext::commit_id() const {
   Assert(_commit_context, "TransactionContext cid only available after commit context has been created.");
 
@@ -87,13 +112,57 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
 }
 
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  // A read-only transaction has nothing to make visible, so it does not need a commit id
+  if (is_read_only()) {
+    _transition(TransactionPhase::Active, TransactionPhase::Committed);
+    if (callback) callback(_transaction_id);
+    return;
+  }
+
   _prepare_commit();
 
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  const auto& change_stream = Hyrise::get().change_stream;
+  auto on_commit = callback;
+  if (write_ahead_log || change_stream) {
+    auto records = std::vector<char>{};
+    for (const auto& op : _read_write_operators) {
+      op->write_log_records(records);
+    }
+
+    if (!records.empty()) {
+      // The changes are streamed once the commit is visible. As commits become visible in the order of their commit
+      // ids, the subscribers of the change stream receive them in commit order.
+      if (change_stream) {
+        const auto shared_records = write_ahead_log ? std::make_shared<const std::vector<char>>(records)
+                                                    : std::make_shared<const std::vector<char>>(std::move(records));
+        on_commit = [change_stream, commit_id = commit_id(), shared_records, callback](auto transaction_id) {
+          change_stream->publish(commit_id, shared_records);
+          if (callback) callback(transaction_id);
+        };
+      }
+
+      // With a write-ahead log, the commit is only published once its records are durable
+      if (write_ahead_log) {
+        write_ahead_log->append(commit_id(), std::move(records), [context = shared_from_this(), on_commit]() {
+          context->_mark_as_pending_and_try_commit(on_commit);
+        });
+        return;
+      }
+    }
+  }
+
+  _mark_as_pending_and_try_commit(on_commit);
+}
+
+void TransactionContext::register_modified_table(const std::shared_ptr<const Table>& table) {
+  if (std::find(_modified_tables.begin(), _modified_tables.end(), table) == _modified_tables.end()) {
+    _modified_tables.emplace_back(table);
+  }
 }
 
 void TransactionContext::commit() {
@@ -163,7 +232,13 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
               "All read/write operators need to have been committed.");
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback,
+                                                  modified_tables = _modified_tables](auto transaction_id) {
+    // The commit is published, i.e., all snapshots taken from now on see the modifications
+    for (const auto& table : modified_tables) {
+      table->increase_version();
+    }
+
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
@@ -172,7 +247,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
     if (callback) callback(transaction_id);
   });
 
-  Hyrise::get().transaction_manager._try_increment_last_commit_id(_commit_context);
+  Hyrise::get().transaction_manager._publish_pending_commits();
 }
 
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
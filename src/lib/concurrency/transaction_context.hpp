@@ -3,6 +3,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "types.hpp"
@@ -10,6 +11,7 @@
 namespace opossum {
 
 class AbstractReadWriteOperator;
+class Table;
 class CommitContext;
 
 /**
@@ -62,7 +64,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   friend class TransactionManager;
 
  public:
-  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id, AutoCommit is_auto_commit);
+  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id, AutoCommit is_auto_commit,
+                     TransactionAccessMode access_mode = TransactionAccessMode::ReadWrite);
   ~TransactionContext();
 
   /**
@@ -120,12 +123,22 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void commit();
 
+  /**
+   * Returns whether the transaction was created as read-only. Read-only transactions cannot register read-write
+   * operators and commit without acquiring a commit id.
+   */
+  bool is_read_only() const;
+
   /**
    * Add an operator to the list of read-write operators.
    */
-  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
-    _read_write_operators.push_back(op);
-  }
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op);
+
+  /**
+   * Registers a table whose rows are modified by the transaction. Called by the read-write operators when they commit
+   * their records. The versions of the tables are increased once the commit has been published (see Table::version).
+   */
+  void register_modified_table(const std::shared_ptr<const Table>& table);
 
   /**
    * Returns the read-write operators.
@@ -199,8 +212,13 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
   const AutoCommit _is_auto_commit;
+  const TransactionAccessMode _access_mode;
+
+  // The reader slot in which a read-only transaction is registered, see TransactionManager::_register_reader
+  std::optional<uint32_t> _reader_slot_id;
 
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
+  std::vector<std::shared_ptr<const Table>> _modified_tables;
 
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
@@ -1,19 +1,45 @@
 #include "transaction_manager.hpp"
 
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "commit_context.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto SLOT_COUNT_MASK = uint64_t{0xFFFFFFFF};
+
+uint64_t slot_count(const uint64_t slot_state) { return slot_state & SLOT_COUNT_MASK; }
+
+CommitID slot_snapshot_commit_id(const uint64_t slot_state) { return static_cast<CommitID>(slot_state >> 32u); }
+
+uint64_t make_slot_state(const CommitID snapshot_commit_id, const uint64_t count) {
+  return (static_cast<uint64_t>(snapshot_commit_id) << 32u) | count;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)},
+      _last_published_commit_context{_last_commit_context},
+      _is_publishing{false},
+      _active_snapshot_slots{std::make_unique<std::atomic<uint64_t>[]>(  // NOLINT(modernize-avoid-c-arrays)
+          ACTIVE_SNAPSHOT_SLOT_COUNT)},
+      _reader_slots{std::make_unique<ReaderSlot[]>(READER_SLOT_COUNT)} {}  // NOLINT(modernize-avoid-c-arrays)
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(!get_lowest_active_snapshot_commit_id(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
@@ -21,102 +47,179 @@ TransactionManager& TransactionManager::operator=(TransactionManager&& transacti
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
   _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _last_published_commit_context = transaction_manager._last_published_commit_context;
+  _is_publishing = transaction_manager._is_publishing.load();
+  for (auto slot_id = uint32_t{0}; slot_id < ACTIVE_SNAPSHOT_SLOT_COUNT; ++slot_id) {
+    _active_snapshot_slots[slot_id] = transaction_manager._active_snapshot_slots[slot_id].load();
+  }
+  for (auto slot_id = uint32_t{0}; slot_id < READER_SLOT_COUNT; ++slot_id) {
+    _reader_slots[slot_id].state = transaction_manager._reader_slots[slot_id].state.load();
+  }
   return *this;
 }
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
-std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(const AutoCommit auto_commit) {
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
+    const AutoCommit auto_commit, const TransactionAccessMode access_mode) {
   const TransactionID snapshot_commit_id = _last_commit_id;
+  if (access_mode == TransactionAccessMode::ReadOnly) {
+    return std::make_shared<TransactionContext>(READ_ONLY_TRANSACTION_ID, snapshot_commit_id, auto_commit,
+                                                access_mode);
+  }
   return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id, auto_commit);
 }
 
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  // Probe for a slot that is either free or already counts the snapshot commit id
+  for (auto probe = uint32_t{0}; probe < ACTIVE_SNAPSHOT_SLOT_COUNT; ++probe) {
+    auto& slot = _active_snapshot_slots[(snapshot_commit_id + probe) % ACTIVE_SNAPSHOT_SLOT_COUNT];
+    auto slot_state = slot.load();
+    while (slot_count(slot_state) == 0 || slot_snapshot_commit_id(slot_state) == snapshot_commit_id) {
+      if (slot.compare_exchange_weak(slot_state, make_slot_state(snapshot_commit_id, slot_count(slot_state) + 1))) {
+        return;
+      }
+    }
+  }
+
+  Fail("Too many distinct snapshot commit ids are in use at the same time.");
 }
 
 void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  // Probe in the same order as _register_transaction for any slot that counts the snapshot commit id
+  for (auto probe = uint32_t{0}; probe < ACTIVE_SNAPSHOT_SLOT_COUNT; ++probe) {
+    auto& slot = _active_snapshot_slots[(snapshot_commit_id + probe) % ACTIVE_SNAPSHOT_SLOT_COUNT];
+    auto slot_state = slot.load();
+    while (slot_count(slot_state) > 0 && slot_snapshot_commit_id(slot_state) == snapshot_commit_id) {
+      if (slot.compare_exchange_weak(slot_state, make_slot_state(snapshot_commit_id, slot_count(slot_state) - 1))) {
+        return;
+      }
+    }
+  }
 
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+  Fail(
+      "Could not find snapshot_commit_id in TransactionManager's active snapshot commit ids. Therefore, the removal "
+      "failed and the function should not have been called.");
+}
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
+std::optional<uint32_t> TransactionManager::_register_reader(const CommitID snapshot_commit_id) {
+  const auto reader_slot_id =
+      static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()) % READER_SLOT_COUNT);
+  auto& slot = _reader_slots[reader_slot_id].state;
+  auto slot_state = slot.load();
+  while (slot_count(slot_state) == 0 || slot_snapshot_commit_id(slot_state) == snapshot_commit_id) {
+    if (slot.compare_exchange_weak(slot_state, make_slot_state(snapshot_commit_id, slot_count(slot_state) + 1))) {
+      return reader_slot_id;
+    }
+  }
+
+  // The slot is still used by an older reader (e.g., one that was handed over to another thread)
+  _register_transaction(snapshot_commit_id);
+  return std::nullopt;
+}
+
+void TransactionManager::_deregister_reader(const CommitID snapshot_commit_id,
+                                            const std::optional<uint32_t> reader_slot_id) {
+  if (!reader_slot_id) {
+    _deregister_transaction(snapshot_commit_id);
     return;
   }
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+  auto& slot = _reader_slots[*reader_slot_id].state;
+  auto slot_state = slot.load();
+  do {
+    Assert(slot_count(slot_state) > 0 && slot_snapshot_commit_id(slot_state) == snapshot_commit_id,
+           "Reader slot does not count the snapshot commit id of the deregistered reader.");
+  } while (!slot.compare_exchange_weak(slot_state, make_slot_state(snapshot_commit_id, slot_count(slot_state) - 1)));
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  auto lowest_snapshot_commit_id = std::optional<CommitID>{};
 
-  if (_active_snapshot_commit_ids.empty()) {
-    return std::nullopt;
+  const auto visit_slot = [&](const uint64_t slot_state) {
+    if (slot_count(slot_state) == 0) return;
+
+    const auto snapshot_commit_id = slot_snapshot_commit_id(slot_state);
+    if (!lowest_snapshot_commit_id || snapshot_commit_id < *lowest_snapshot_commit_id) {
+      lowest_snapshot_commit_id = snapshot_commit_id;
+    }
+  };
+
+  for (auto slot_id = uint32_t{0}; slot_id < ACTIVE_SNAPSHOT_SLOT_COUNT; ++slot_id) {
+    visit_slot(_active_snapshot_slots[slot_id].load());
+  }
+  for (auto slot_id = uint32_t{0}; slot_id < READER_SLOT_COUNT; ++slot_id) {
+    visit_slot(_reader_slots[slot_id].state.load());
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return lowest_snapshot_commit_id;
 }
 
 /**
  * Logic of the lock-free algorithm
  *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
+ * Let’s say n threads call this method simultaneously. They all try to set the successor of _last_commit_context
+ * (pointed to by current_context). Only one of them will succeed and then advances _last_commit_context to the new
+ * context. The others continue with the successor. If _last_commit_context still points to a context that already
+ * has a successor, its creator has not advanced _last_commit_context yet. Instead of waiting for it, the threads
+ * advance _last_commit_context themselves, so that no thread ever waits for another one.
  */
 std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   auto current_context = std::atomic_load(&_last_commit_context);
-  auto next_context = std::shared_ptr<CommitContext>();
 
-  auto success = false;
-  while (!success) {
-    while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
+  while (true) {
+    if (const auto next_context = current_context->next()) {
+      // Only moves _last_commit_context forward, as it is only replaced if it still points to current_context
+      auto expected_context = current_context;
+      std::atomic_compare_exchange_strong(&_last_commit_context, &expected_context, next_context);
+      current_context = next_context;
+      continue;
     }
 
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
-
-    success = current_context->try_set_next(next_context);
+    const auto next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
+    if (!current_context->try_set_next(next_context)) continue;
 
-    if (!success) continue;
-
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
-
-    Assert(success, "Invariant violated.");
+    // Might fail if another thread has already advanced _last_commit_context to next_context
+    std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+    return next_context;
   }
-
-  return next_context;
 }
 
-void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
-
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+/**
+ * Group commit
+ *
+ * Only one thread at a time publishes commits. It collects all pending commit contexts that directly follow the last
+ * published one and makes them visible with a single update of _last_commit_id. Afterwards, their callbacks are
+ * fired. A thread that fails to become the publisher simply returns, as its commit context is already pending and
+ * will be published by the current publisher: After releasing _is_publishing, the publisher checks whether the
+ * successor of the last published context has become pending in the meantime and, if so, publishes it as well.
+ */
+void TransactionManager::_publish_pending_commits() {
+  while (true) {
+    auto expected_is_publishing = false;
+    if (!_is_publishing.compare_exchange_strong(expected_is_publishing, true)) return;
+
+    auto published_contexts = std::vector<std::shared_ptr<CommitContext>>{};
+    auto last_context = _last_published_commit_context;
+    for (auto next_context = last_context->next(); next_context && next_context->is_pending();
+         next_context = next_context->next()) {
+      published_contexts.emplace_back(next_context);
+      last_context = next_context;
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    if (!published_contexts.empty()) {
+      _last_published_commit_context = last_context;
+      _last_commit_id = last_context->commit_id();
 
-    current_context->fire_callback();
+      for (const auto& context : published_contexts) {
+        context->fire_callback();
+      }
+    }
 
-    if (!current_context->has_next()) return;
+    _is_publishing = false;
 
-    current_context = current_context->next();
+    const auto next_context = last_context->next();
+    if (!next_context || !next_context->is_pending()) return;
   }
 }
 
@@ -3,8 +3,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
-#include <mutex>
-#include <unordered_set>
+#include <optional>
 
 #include "types.hpp"
 
@@ -34,6 +33,11 @@
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
  * a new commit ID that is used to make its changes visible to others.
+ *
+ * Commits are published as groups: Once a transaction has written its commit ID to the MVCC data, its CommitContext
+ * is marked as pending. A single thread at a time (the publisher) then makes all consecutive pending commits visible
+ * at once by setting the last commit ID to the highest of their commit IDs. Transactions that become pending while
+ * another thread is publishing do not wait for it, but leave their commit to the publisher.
  */
 
 namespace opossum {
@@ -58,8 +62,12 @@ class TransactionManager : public Noncopyable {
    * @param is_auto_commit declares whether the transaction is created (and will also commit) automatically. The
    * alternative would be that it was created through a user command (BEGIN). This information is used by the
    * SQLPipelineStatement to auto-commit the transaction - the transaction does not commit itself.
+   * @param access_mode ReadOnly transactions cannot register read-write operators. They do not draw a transaction id
+   * but use READ_ONLY_TRANSACTION_ID, register their snapshot in a per-thread reader slot instead of the shared hash
+   * table (see _register_reader), and commit without a commit context.
    */
-  std::shared_ptr<TransactionContext> new_transaction_context(const AutoCommit auto_commit);
+  std::shared_ptr<TransactionContext> new_transaction_context(
+      const AutoCommit auto_commit, const TransactionAccessMode access_mode = TransactionAccessMode::ReadWrite);
 
   /**
    * Returns the lowest snapshot-commit-id currently used by a transaction.
@@ -76,17 +84,30 @@ class TransactionManager : public Noncopyable {
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
   std::shared_ptr<CommitContext> _new_commit_context();
-  void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
+
+  /**
+   * Publishes all pending commits that directly follow the last visible commit, i.e., increments the last commit id.
+   * If another thread is currently publishing, the commits are left to it.
+   */
+  void _publish_pending_commits();
 
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * The following two functions are used to keep the active
+   * snapshot-commit-ids up to date. Both are lock-free.
    */
   void _register_transaction(CommitID snapshot_commit_id);
   void _deregister_transaction(CommitID snapshot_commit_id);
 
+  /**
+   * Registers the snapshot of a read-only transaction in the reader slot of the calling thread and returns the slot. If
+   * the slot counts a different snapshot, the transaction is registered via _register_transaction and std::nullopt is
+   * returned. The returned slot has to be passed to _deregister_reader, which may be called from any thread.
+   */
+  std::optional<uint32_t> _register_reader(CommitID snapshot_commit_id);
+  void _deregister_reader(CommitID snapshot_commit_id, std::optional<uint32_t> reader_slot_id);
+
   std::atomic<TransactionID> _next_transaction_id;
 
   std::atomic<CommitID> _last_commit_id;
@@ -94,9 +115,35 @@ class TransactionManager : public Noncopyable {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
+  // The most recently created commit context, i.e., the end of the chain of commit contexts
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  // The commit context of the last visible commit. Only accessed by the thread that holds _is_publishing.
+  std::shared_ptr<CommitContext> _last_published_commit_context;
+  std::atomic<bool> _is_publishing;
+
+  /**
+   * The active snapshot-commit-ids are counted in a hash table with open addressing. Each slot packs a snapshot commit
+   * id (upper 32 bits) and the number of active transactions using it (lower 32 bits) into one atomic, so that
+   * transactions can be registered and deregistered with a single compare-and-swap instead of a global mutex. A slot
+   * with a count of zero is free. The same snapshot commit id might be counted in multiple slots.
+   *
+   * The table limits the number of distinct snapshot commit ids that are in use at the same time. This is far more
+   * than the number of concurrent transactions we expect, as most transactions share the latest snapshot.
+   */
+  static constexpr auto ACTIVE_SNAPSHOT_SLOT_COUNT = uint32_t{1u << 14u};
+  std::unique_ptr<std::atomic<uint64_t>[]> _active_snapshot_slots;  // NOLINT(modernize-avoid-c-arrays)
+
+  /**
+   * Read-only transactions typically all use the latest snapshot, so they would all update the same slot of the hash
+   * table above. Instead, each thread counts its readers in its own reader slot, which uses the same packed layout and
+   * has a cache line of its own. As a thread usually executes one query after another, its slot mostly holds the
+   * snapshot that the next reader needs, too, and registering is an uncontended compare-and-swap.
+   */
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> state{0};
+  };
+  static constexpr auto READER_SLOT_COUNT = uint32_t{256};
+  std::unique_ptr<ReaderSlot[]> _reader_slots;  // NOLINT(modernize-avoid-c-arrays)
 };
 }  // namespace opossum
@@ -0,0 +1,609 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+enum class LogRecordType : uint8_t { Insert, Delete };
+
+// Header of a log entry, followed by payload_size bytes of records
+struct EntryHeader {
+  uint32_t payload_size;
+  CommitID commit_id;
+  uint64_t checksum;
+};
+
+// FNV-1a, which is sufficient to detect torn writes
+uint64_t checksum(const char* data, const size_t size) {
+  auto hash = uint64_t{14695981039346656037ull};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= uint64_t{1099511628211ull};
+  }
+  return hash;
+}
+
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void append_string(std::vector<char>& buffer, const std::string_view string) {
+  append_value(buffer, static_cast<uint32_t>(string.size()));
+  buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+// Each row is encoded as a sequence of (is_null, value) pairs
+void append_row(std::vector<char>& buffer, const Table& table, const RowID row_id) {
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto value = (*chunk->get_segment(column_id))[row_id.chunk_offset];
+    const auto is_null = variant_is_null(value);
+    append_value(buffer, static_cast<uint8_t>(is_null));
+    if (is_null) continue;
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        append_string(buffer, boost::get<pmr_string>(value));
+      } else {
+        append_value(buffer, boost::get<ColumnDataType>(value));
+      }
+    });
+  }
+}
+
+// Starts a record and returns the position of its size, which is set by finish_record
+size_t start_record(std::vector<char>& records, const LogRecordType type, const std::string& table_name,
+                    const size_t row_count) {
+  const auto record_position = records.size();
+  append_value(records, uint32_t{0});
+  append_value(records, type);
+  append_string(records, table_name);
+  append_value(records, static_cast<uint32_t>(row_count));
+  return record_position;
+}
+
+void finish_record(std::vector<char>& records, const size_t record_position) {
+  const auto record_size = static_cast<uint32_t>(records.size() - record_position - sizeof(uint32_t));
+  std::memcpy(records.data() + record_position, &record_size, sizeof(uint32_t));
+}
+
+class RecordReader {
+ public:
+  explicit RecordReader(const std::string_view data) : _data(data) {}
+
+  bool at_end() const { return _position == _data.size(); }
+
+  size_t position() const { return _position; }
+
+  template <typename T>
+  T read_value() {
+    auto value = T{};
+    std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+    return value;
+  }
+
+  std::string_view read_string() { return read_bytes(read_value<uint32_t>()); }
+
+  std::string_view read_bytes(const size_t size) {
+    Assert(_position + size <= _data.size(), "Log record is truncated");
+    const auto bytes = _data.substr(_position, size);
+    _position += size;
+    return bytes;
+  }
+
+  std::vector<AllTypeVariant> read_row(const Table& table) {
+    const auto column_count = table.column_count();
+    auto values = std::vector<AllTypeVariant>(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (read_value<uint8_t>()) continue;
+
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          values[column_id] = pmr_string{read_string()};
+        } else {
+          values[column_id] = read_value<ColumnDataType>();
+        }
+      });
+    }
+    return values;
+  }
+
+ private:
+  std::string_view _data;
+  size_t _position{0};
+};
+
+/**
+ * Applies the records of a single table in the order of their commits. Inserted rows are appended. Deleted rows are
+ * looked up by their encoded values, so the index of all rows is only built once the first delete record is found.
+ * As rows with identical values are indistinguishable, it does not matter which of them is deleted.
+ */
+void replay_records(Table& table, const std::vector<std::string_view>& records) {
+  auto row_ids_by_encoded_row = std::optional<std::unordered_map<std::string_view, std::vector<RowID>>>{};
+  // Keeps the encoded rows of the index alive that are not part of the log records. A deque does not move its
+  // elements when it grows, so that the string_views stay valid.
+  auto encoded_rows = std::deque<std::string>{};
+
+  const auto build_index = [&]() {
+    row_ids_by_encoded_row.emplace();
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      const auto mvcc_data = chunk->mvcc_data();
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) continue;
+
+        auto encoded_row = std::vector<char>{};
+        append_row(encoded_row, table, RowID{chunk_id, chunk_offset});
+        const auto& key = encoded_rows.emplace_back(encoded_row.begin(), encoded_row.end());
+        (*row_ids_by_encoded_row)[key].emplace_back(chunk_id, chunk_offset);
+      }
+    }
+  };
+
+  for (const auto& record : records) {
+    auto reader = RecordReader{record};
+    const auto type = reader.read_value<LogRecordType>();
+    reader.read_string();
+    const auto row_count = reader.read_value<uint32_t>();
+
+    for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+      const auto row_begin = reader.position();
+      const auto values = reader.read_row(table);
+      const auto encoded_row = record.substr(row_begin, reader.position() - row_begin);
+
+      if (type == LogRecordType::Insert) {
+        table.append(values);
+        if (row_ids_by_encoded_row) {
+          const auto chunk_id = ChunkID{table.chunk_count() - 1};
+          const auto chunk_offset = ChunkOffset{table.get_chunk(chunk_id)->size() - 1};
+          (*row_ids_by_encoded_row)[encoded_row].emplace_back(chunk_id, chunk_offset);
+        }
+        continue;
+      }
+
+      if (!row_ids_by_encoded_row) build_index();
+
+      const auto row_ids_iter = row_ids_by_encoded_row->find(encoded_row);
+      Assert(row_ids_iter != row_ids_by_encoded_row->end() && !row_ids_iter->second.empty(),
+             "Log record deletes a row that does not exist in table");
+      const auto row_id = row_ids_iter->second.back();
+      row_ids_iter->second.pop_back();
+
+      const auto chunk = table.get_chunk(row_id.chunk_id);
+      chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, CommitID{0});
+      chunk->increase_invalid_row_count(1);
+    }
+  }
+}
+
+// Returns the id of files named <prefix><id><suffix>
+std::optional<uint32_t> file_id(const std::filesystem::path& path, const std::string& prefix,
+                                const std::string& suffix) {
+  const auto filename = path.filename().string();
+  if (filename.size() <= prefix.size() + suffix.size()) return std::nullopt;
+  if (!filename.starts_with(prefix) || !filename.ends_with(suffix)) return std::nullopt;
+
+  const auto id = filename.substr(prefix.size(), filename.size() - prefix.size() - suffix.size());
+  if (!std::all_of(id.begin(), id.end(), ::isdigit)) return std::nullopt;
+  return static_cast<uint32_t>(std::stoul(id));
+}
+
+std::string log_file_name(const uint32_t id) { return "log_" + std::to_string(id) + ".wal"; }
+
+std::string checkpoint_directory_name(const uint32_t id) { return "checkpoint_" + std::to_string(id); }
+
+// The BinaryWriter does not sync its writes, i.e., the data is not guaranteed to be on disk yet
+void sync_path(const std::filesystem::path& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open '" + path.string() + "': " + std::strerror(errno));
+  const auto result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(result == 0, "Could not sync '" + path.string() + "': " + std::strerror(errno));
+}
+
+}  // namespace
+
+namespace opossum {
+
+WriteAheadLog::WriteAheadLog(const std::filesystem::path& directory,
+                             const std::chrono::milliseconds checkpoint_interval)
+    : _directory(directory) {
+  std::filesystem::create_directories(_directory);
+  _recover();
+
+  _flush_thread = std::thread{[&]() { _flush_loop(); }};
+
+  // The recovered commits have commit ids of the previous run. A new checkpoint contains them, so that their log
+  // records are not needed anymore.
+  checkpoint();
+
+  if (checkpoint_interval > std::chrono::milliseconds{0}) {
+    _checkpoint_thread = std::make_unique<PausableLoopThread>(checkpoint_interval, [&](size_t) { checkpoint(); });
+  }
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  _checkpoint_thread.reset();
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _pending_condition_variable.notify_one();
+  _flush_thread.join();
+
+  if (_file_descriptor >= 0) close(_file_descriptor);
+}
+
+const std::filesystem::path& WriteAheadLog::directory() const { return _directory; }
+
+void WriteAheadLog::append(const CommitID commit_id, std::vector<char>&& records, std::function<void()>&& on_durable) {
+  DebugAssert(!records.empty(), "Transactions without records do not need to be logged");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending_entries.emplace_back(Entry{commit_id, std::move(records), std::move(on_durable)});
+    ++_appended_entry_count;
+  }
+  _pending_condition_variable.notify_one();
+}
+
+void WriteAheadLog::flush() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  const auto appended_entry_count = _appended_entry_count;
+  _durable_condition_variable.wait(lock, [&]() { return _durable_entry_count >= appended_entry_count; });
+}
+
+void WriteAheadLog::_flush_loop() {
+  while (true) {
+    auto entries = std::vector<Entry>{};
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      _pending_condition_variable.wait(lock, [&]() { return !_pending_entries.empty() || _shutdown; });
+      if (_pending_entries.empty()) return;
+
+      // All entries that were appended while the previous group was written form the next group
+      entries.swap(_pending_entries);
+    }
+
+    {
+      std::lock_guard<std::mutex> file_lock(_file_mutex);
+      _write_entries(entries);
+    }
+
+    for (const auto& entry : entries) {
+      entry.on_durable();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _durable_entry_count += entries.size();
+    }
+    _durable_condition_variable.notify_all();
+  }
+}
+
+void WriteAheadLog::_write_entries(const std::vector<Entry>& entries) {
+  auto buffer = std::vector<char>{};
+  for (const auto& entry : entries) {
+    const auto header = EntryHeader{static_cast<uint32_t>(entry.records.size()), entry.commit_id,
+                                    checksum(entry.records.data(), entry.records.size())};
+    append_value(buffer, header);
+    buffer.insert(buffer.end(), entry.records.begin(), entry.records.end());
+    _max_logged_commit_id = std::max(_max_logged_commit_id, entry.commit_id);
+  }
+
+  auto written_byte_count = size_t{0};
+  while (written_byte_count < buffer.size()) {
+    const auto result = write(_file_descriptor, buffer.data() + written_byte_count, buffer.size() - written_byte_count);
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, "Could not write to log: " + std::string{std::strerror(errno)});
+    written_byte_count += static_cast<size_t>(result);
+  }
+
+  Assert(fsync(_file_descriptor) == 0, "Could not sync log: " + std::string{std::strerror(errno)});
+}
+
+void WriteAheadLog::_open_next_log_file() {
+  if (_file_descriptor >= 0) close(_file_descriptor);
+
+  ++_log_file_id;
+  const auto path = _directory / log_file_name(_log_file_id);
+  _file_descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open '" + path.string() + "': " + std::strerror(errno));
+}
+
+/**
+ * A checkpoint must contain all commits whose records are in the log files that it replaces. Thus, we first continue
+ * logging in a new file and wait until all commits logged to the previous files are visible. Only then, the snapshot
+ * of the checkpoint is taken. Records in the new file with a commit id up to the snapshot commit id are skipped during
+ * recovery.
+ */
+void WriteAheadLog::checkpoint() {
+  std::lock_guard<std::mutex> checkpoint_lock(_checkpoint_mutex);
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  auto checkpoint_id = uint32_t{0};
+  auto max_logged_commit_id = CommitID{0};
+  {
+    std::lock_guard<std::mutex> file_lock(_file_mutex);
+    _open_next_log_file();
+    checkpoint_id = _log_file_id;
+    max_logged_commit_id = _max_logged_commit_id;
+  }
+
+  while (transaction_manager.last_commit_id() < max_logged_commit_id) {
+    std::this_thread::yield();
+  }
+
+  const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  const auto checkpoint_directory = _directory / checkpoint_directory_name(checkpoint_id);
+  const auto temporary_directory = std::filesystem::path{checkpoint_directory.string() + ".tmp"};
+  std::filesystem::remove_all(temporary_directory);
+  std::filesystem::create_directories(temporary_directory);
+
+  auto table_names = std::vector<std::string>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, table] : tables) {
+    const auto table_path = temporary_directory / (std::to_string(table_names.size()) + ".bin");
+    table_names.emplace_back(table_name);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, table_name = table_name, table = table, table_path]() {
+      auto snapshot = std::shared_ptr<const Table>{table};
+      if (table->uses_mvcc() == UseMvcc::Yes) {
+        const auto get_table = std::make_shared<GetTable>(table_name);
+        get_table->execute();
+        const auto validate = std::make_shared<Validate>(get_table);
+        validate->set_transaction_context(transaction_context);
+        validate->execute();
+        snapshot = validate->get_output();
+      }
+
+      // The statistics of the stored table still describe the snapshot, which only lacks the invalidated rows
+      BinaryWriter::write(*snapshot, table_path, table->table_statistics());
+      sync_path(table_path);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  const auto manifest_path = temporary_directory / "manifest";
+  {
+    auto manifest = std::ofstream{manifest_path};
+    manifest << transaction_context->snapshot_commit_id() << '\n';
+    for (const auto& table_name : table_names) {
+      manifest << table_name << '\n';
+    }
+    Assert(manifest.good(), "Could not write checkpoint manifest");
+  }
+  sync_path(manifest_path);
+
+  std::filesystem::rename(temporary_directory, checkpoint_directory);
+  sync_path(_directory);
+
+  // Remove the checkpoints and log files that are replaced by the new checkpoint
+  for (const auto& directory_entry : std::filesystem::directory_iterator(_directory)) {
+    const auto& path = directory_entry.path();
+    const auto obsolete_checkpoint_id = file_id(path, "checkpoint_", "");
+    const auto incomplete_checkpoint_id = file_id(path, "checkpoint_", ".tmp");
+    const auto obsolete_log_file_id = file_id(path, "log_", ".wal");
+    if ((obsolete_checkpoint_id && *obsolete_checkpoint_id < checkpoint_id) ||
+        (incomplete_checkpoint_id && *incomplete_checkpoint_id < checkpoint_id) ||
+        (obsolete_log_file_id && *obsolete_log_file_id < checkpoint_id)) {
+      std::filesystem::remove_all(path);
+    }
+  }
+}
+
+void WriteAheadLog::_recover() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto checkpoint_id = std::optional<uint32_t>{};
+  auto log_file_ids = std::vector<uint32_t>{};
+  for (const auto& directory_entry : std::filesystem::directory_iterator(_directory)) {
+    const auto& path = directory_entry.path();
+    if (const auto id = file_id(path, "checkpoint_", "")) {
+      _log_file_id = std::max(_log_file_id, *id);
+      if (std::filesystem::exists(path / "manifest") && (!checkpoint_id || *id > *checkpoint_id)) checkpoint_id = id;
+    } else if (const auto id = file_id(path, "log_", ".wal")) {
+      _log_file_id = std::max(_log_file_id, *id);
+      log_file_ids.emplace_back(*id);
+    }
+  }
+
+  // Load the tables of the checkpoint in parallel
+  auto snapshot_commit_id = CommitID{0};
+  if (checkpoint_id) {
+    const auto checkpoint_directory = _directory / checkpoint_directory_name(*checkpoint_id);
+    auto manifest = std::ifstream{checkpoint_directory / "manifest"};
+    auto line = std::string{};
+    std::getline(manifest, line);
+    snapshot_commit_id = static_cast<CommitID>(std::stoul(line));
+
+    auto table_names = std::vector<std::string>{};
+    while (std::getline(manifest, line)) {
+      table_names.emplace_back(line);
+    }
+
+    const auto table_count = table_names.size();
+    auto tables = std::vector<std::shared_ptr<Table>>(table_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto table_id = size_t{0}; table_id < table_count; ++table_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, table_id]() {
+        tables[table_id] = BinaryParser::parse(checkpoint_directory / (std::to_string(table_id) + ".bin"));
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    for (auto table_id = size_t{0}; table_id < table_count; ++table_id) {
+      storage_manager.add_table(table_names[table_id], tables[table_id]);
+    }
+  }
+
+  // Collect the entries of all commits after the snapshot
+  struct RecoveredEntry {
+    CommitID commit_id;
+    std::string_view records;
+  };
+  auto entries = std::vector<RecoveredEntry>{};
+
+  std::sort(log_file_ids.begin(), log_file_ids.end());
+  auto log_files = std::vector<std::unique_ptr<MemoryMappedFile>>{};
+  for (const auto log_file_id : log_file_ids) {
+    if (checkpoint_id && log_file_id < *checkpoint_id) continue;
+
+    const auto& log_file = log_files.emplace_back(
+        std::make_unique<MemoryMappedFile>((_directory / log_file_name(log_file_id)).string()));
+    const auto data = std::string_view{log_file->data(), log_file->size()};
+
+    auto position = size_t{0};
+    while (position + sizeof(EntryHeader) <= data.size()) {
+      auto header = EntryHeader{};
+      std::memcpy(&header, data.data() + position, sizeof(EntryHeader));
+      const auto payload_position = position + sizeof(EntryHeader);
+
+      // A torn entry can only be the last one of a file, as every group of entries is synced before the next is written
+      if (payload_position + header.payload_size > data.size()) break;
+      const auto payload = data.substr(payload_position, header.payload_size);
+      if (checksum(payload.data(), payload.size()) != header.checksum) break;
+
+      if (header.commit_id > snapshot_commit_id) entries.emplace_back(RecoveredEntry{header.commit_id, payload});
+      position = payload_position + header.payload_size;
+    }
+  }
+
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.commit_id < rhs.commit_id; });
+
+  // Split the records by table. Different tables are replayed in parallel.
+  auto records_by_table = std::unordered_map<std::string, std::vector<std::string_view>>{};
+  for (const auto& entry : entries) {
+    auto reader = RecordReader{entry.records};
+    while (!reader.at_end()) {
+      const auto record = reader.read_bytes(reader.read_value<uint32_t>());
+
+      auto record_reader = RecordReader{record};
+      record_reader.read_value<LogRecordType>();
+      records_by_table[std::string{record_reader.read_string()}].emplace_back(record);
+    }
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, records] : records_by_table) {
+    if (!storage_manager.has_table(table_name)) {
+      Hyrise::get().log_manager.add_message("WriteAheadLog",
+                                            "Skipped log records of table '" + table_name +
+                                                "', which is not part of the checkpoint. Tables created after the "
+                                                "last checkpoint are not recovered.",
+                                            LogLevel::Warning);
+      continue;
+    }
+
+    const auto table = storage_manager.get_table(table_name);
+    jobs.emplace_back(std::make_shared<JobTask>([table, &records = records]() { replay_records(*table, records); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+void WriteAheadLog::write_insert_record(std::vector<char>& records, const std::string& table_name, const Table& table,
+                                        const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                                        const ChunkOffset end_chunk_offset) {
+  if (begin_chunk_offset == end_chunk_offset) return;
+
+  const auto record_position =
+      start_record(records, LogRecordType::Insert, table_name, end_chunk_offset - begin_chunk_offset);
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    append_row(records, table, RowID{chunk_id, chunk_offset});
+  }
+  finish_record(records, record_position);
+}
+
+void WriteAheadLog::write_delete_record(std::vector<char>& records, const std::shared_ptr<const Table>& table,
+                                        const AbstractPosList& pos_list) {
+  if (pos_list.empty()) return;
+
+  for (const auto& [table_name, stored_table] : Hyrise::get().storage_manager.tables()) {
+    if (stored_table != table) continue;
+
+    const auto record_position = start_record(records, LogRecordType::Delete, table_name, pos_list.size());
+    for (const auto row_id : pos_list) {
+      append_row(records, *table, row_id);
+    }
+    finish_record(records, record_position);
+    return;
+  }
+}
+
+void WriteAheadLog::read_records(const std::string_view records, const RecordVisitor& visitor) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto reader = RecordReader{records};
+  while (!reader.at_end()) {
+    const auto record = reader.read_bytes(reader.read_value<uint32_t>());
+
+    auto record_reader = RecordReader{record};
+    const auto type = record_reader.read_value<LogRecordType>();
+    const auto table_name = std::string{record_reader.read_string()};
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    const auto row_count = record_reader.read_value<uint32_t>();
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    auto encoded_rows = std::vector<std::string_view>{};
+    rows.reserve(row_count);
+    encoded_rows.reserve(row_count);
+    for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+      const auto row_begin = record_reader.position();
+      rows.emplace_back(record_reader.read_row(*table));
+      encoded_rows.emplace_back(record.substr(row_begin, record_reader.position() - row_begin));
+    }
+
+    visitor(table_name, type == LogRecordType::Delete, rows, encoded_rows);
+  }
+}
+
+std::string WriteAheadLog::encode_row(const Table& table, const RowID row_id) {
+  auto encoded_row = std::vector<char>{};
+  append_row(encoded_row, table, row_id);
+  return std::string{encoded_row.begin(), encoded_row.end()};
+}
+
+}  // namespace opossum
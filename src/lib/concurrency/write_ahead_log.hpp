@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class AbstractPosList;
+class Table;
+
+/**
+ * Redo log that makes committed transactions durable.
+ *
+ * When a transaction commits, its read/write operators (Insert, Delete, and thereby Update) append redo records of
+ * the rows they inserted and deleted (see AbstractReadWriteOperator::write_log_records). The records are logical, i.e.,
+ * they contain the values of the rows instead of their RowIDs. The commit is only published by the TransactionManager
+ * once the records have been written to disk (fsync).
+ *
+ * Group commit: A single flush thread writes the records. All records that are appended while the thread waits for
+ * the previous fsync are written and synced together, so that the number of fsyncs does not grow with the number of
+ * concurrently committing transactions.
+ *
+ * Checkpoints: checkpoint() writes all tables of the StorageManager (as of a snapshot) with the BinaryWriter and
+ * removes the log files and checkpoints that are no longer needed. Checkpoints are written periodically if a
+ * checkpoint interval is given.
+ *
+ * Recovery: On construction, the latest checkpoint in the directory is loaded and all log records of commits after
+ * its snapshot are replayed. Tables are loaded and replayed in parallel, one job per table. Afterwards, a new
+ * checkpoint is written, as the commit ids of the TransactionManager start from scratch.
+ *
+ * Only changes to the data of tables are logged. Tables that are created (or dropped) are only durable after the next
+ * checkpoint. Constraints, indexes, and the chunk encoding are not part of checkpoints.
+ *
+ * Files in the directory:
+ *   log_<id>.wal         Log file. Each entry consists of a header (payload size, commit id, checksum) and the
+ *                        records of one transaction. A torn entry at the end of a file is ignored during recovery.
+ *   checkpoint_<id>/     Checkpoint, replay continues with log_<id>.wal. Contains one binary file per table and a
+ *                        manifest with the snapshot commit id and the table names.
+ */
+class WriteAheadLog : public Noncopyable {
+ public:
+  // Recovers the state stored in the directory (if any), writes a checkpoint, and starts logging. The StorageManager
+  // must not contain tables with the names of the recovered tables.
+  explicit WriteAheadLog(const std::filesystem::path& directory,
+                         const std::chrono::milliseconds checkpoint_interval = std::chrono::milliseconds{0});
+
+  // Makes all appended records durable
+  ~WriteAheadLog();
+
+  const std::filesystem::path& directory() const;
+
+  /**
+   * Appends the records of a committing transaction. `on_durable` is called by the flush thread once the records are
+   * on disk. Must be called with non-empty records.
+   */
+  void append(const CommitID commit_id, std::vector<char>&& records, std::function<void()>&& on_durable);
+
+  // Blocks until all records that have been appended before are durable
+  void flush();
+
+  void checkpoint();
+
+  /**
+   * Helpers for the read/write operators to encode their records. Delete records are only written for tables that are
+   * stored in the StorageManager.
+   */
+  static void write_insert_record(std::vector<char>& records, const std::string& table_name, const Table& table,
+                                  const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                                  const ChunkOffset end_chunk_offset);
+  static void write_delete_record(std::vector<char>& records, const std::shared_ptr<const Table>& table,
+                                  const AbstractPosList& pos_list);
+
+  /**
+   * Helpers for replicas to apply the records of a commit (see Replica). read_records() calls the visitor for each
+   * record with the name of its table, whether it deletes (or inserts) rows, and the values and the encodings of the
+   * rows. Rows with equal values have equal encodings, also those encoded with encode_row(). Records of tables that
+   * are not stored in the StorageManager are skipped.
+   */
+  using RecordVisitor = std::function<void(const std::string& table_name, const bool is_delete,
+                                           const std::vector<std::vector<AllTypeVariant>>& rows,
+                                           const std::vector<std::string_view>& encoded_rows)>;
+  static void read_records(const std::string_view records, const RecordVisitor& visitor);
+  static std::string encode_row(const Table& table, const RowID row_id);
+
+ private:
+  struct Entry {
+    CommitID commit_id;
+    std::vector<char> records;
+    std::function<void()> on_durable;
+  };
+
+  void _flush_loop();
+  void _write_entries(const std::vector<Entry>& entries);
+
+  // Closes the current log file (if any) and continues with a new one. Requires _file_mutex.
+  void _open_next_log_file();
+
+  void _recover();
+
+  const std::filesystem::path _directory;
+
+  // Protects the pending entries and the counters of appended and durable entries
+  std::mutex _mutex;
+  std::condition_variable _pending_condition_variable;
+  std::condition_variable _durable_condition_variable;
+  std::vector<Entry> _pending_entries;
+  uint64_t _appended_entry_count{0};
+  uint64_t _durable_entry_count{0};
+  bool _shutdown{false};
+
+  // Protects the log file, which is written by the flush thread and switched by checkpoints
+  std::mutex _file_mutex;
+  int _file_descriptor{-1};
+  uint32_t _log_file_id{0};
+  CommitID _max_logged_commit_id{0};
+
+  // Only one checkpoint is written at a time
+  std::mutex _checkpoint_mutex;
+
+  std::thread _flush_thread;
+  std::unique_ptr<PausableLoopThread> _checkpoint_thread;
+};
+
+}  // namespace opossum
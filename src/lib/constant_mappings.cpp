@@ -7,6 +7,7 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -21,6 +22,8 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
         {AggregateFunction::StandardDeviationSample, "STDDEV_SAMP"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
+        {AggregateFunction::ApproxPercentile, "APPROX_PERCENTILE"},
         {AggregateFunction::Any, "ANY"},
     });
 
@@ -39,11 +42,17 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FSST, "FSST"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
 const boost::bimap<FileType, std::string> file_type_to_string = make_bimap<FileType, std::string>(
-    {{FileType::Tbl, "Tbl"}, {FileType::Csv, "Csv"}, {FileType::Binary, "Binary"}, {FileType::Auto, "Auto"}});
+    {{FileType::Tbl, "Tbl"},
+     {FileType::Csv, "Csv"},
+     {FileType::Binary, "Binary"},
+     {FileType::Parquet, "Parquet"},
+     {FileType::Arrow, "Arrow"},
+     {FileType::Auto, "Auto"}});
 
 const boost::bimap<LogLevel, std::string> log_level_to_string = make_bimap<LogLevel, std::string>(
     {{LogLevel::Debug, "Debug"}, {LogLevel::Info, "Info"}, {LogLevel::Warning, "Warning"}});
@@ -52,8 +61,20 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
     make_bimap<VectorCompressionType, std::string>({
         {VectorCompressionType::FixedSizeByteAligned, "Fixed-size byte-aligned"},
         {VectorCompressionType::SimdBp128, "SIMD-BP128"},
+        {VectorCompressionType::BitPacking, "Bit-packing"},
     });
 
+const boost::bimap<WindowFunction, std::string> window_function_to_string = make_bimap<WindowFunction, std::string>({
+    {WindowFunction::RowNumber, "ROW_NUMBER"},
+    {WindowFunction::Rank, "RANK"},
+    {WindowFunction::DenseRank, "DENSE_RANK"},
+    {WindowFunction::Min, "MIN"},
+    {WindowFunction::Max, "MAX"},
+    {WindowFunction::Sum, "SUM"},
+    {WindowFunction::Avg, "AVG"},
+    {WindowFunction::Count, "COUNT"},
+});
+
 std::ostream& operator<<(std::ostream& stream, const AggregateFunction aggregate_function) {
   return stream << aggregate_function_to_string.left.at(aggregate_function);
 }
@@ -100,10 +121,18 @@ std::ostream& operator<<(std::ostream& stream, const CompressedVectorType compre
       stream << "SimdBp128";
       break;
     }
+    case CompressedVectorType::BitPacking: {
+      stream << "BitPacking";
+      break;
+    }
     default:
       break;
   }
   return stream;
 }
 
+std::ostream& operator<<(std::ostream& stream, const WindowFunction window_function) {
+  return stream << window_function_to_string.left.at(window_function);
+}
+
 }  // namespace opossum
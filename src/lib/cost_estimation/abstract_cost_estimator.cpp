@@ -1,5 +1,6 @@
 #include "abstract_cost_estimator.hpp"
 
+#include <mutex>
 #include <queue>
 #include <unordered_set>
 
@@ -52,6 +53,7 @@ Cost AbstractCostEstimator::estimate_plan_cost(const std::shared_ptr<AbstractLQP
 
   // Store cost in cache
   if (cost_estimation_by_lqp_cache) {
+    const auto lock = std::lock_guard<std::mutex>{_cost_estimation_by_lqp_cache_mutex};
     cost_estimation_by_lqp_cache->emplace(lqp, cost);
   }
 
@@ -73,9 +75,14 @@ std::optional<Cost> AbstractCostEstimator::_get_subplan_cost_from_cache(
     return std::nullopt;
   }
 
-  const auto cost_estimation_cache_iter = cost_estimation_by_lqp_cache->find(lqp);
-  if (cost_estimation_cache_iter == cost_estimation_by_lqp_cache->end()) {
-    return std::nullopt;
+  auto cached_cost = Cost{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_cost_estimation_by_lqp_cache_mutex};
+    const auto cost_estimation_cache_iter = cost_estimation_by_lqp_cache->find(lqp);
+    if (cost_estimation_cache_iter == cost_estimation_by_lqp_cache->end()) {
+      return std::nullopt;
+    }
+    cached_cost = cost_estimation_cache_iter->second;
   }
 
   // Check whether the cache entry can be used: This is only the case if the entire subplan has not yet been
@@ -103,7 +110,7 @@ std::optional<Cost> AbstractCostEstimator::_get_subplan_cost_from_cache(
     visited.emplace(subplan_node);
   }
 
-  return cost_estimation_cache_iter->second;
+  return cached_cost;
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "types.hpp"
@@ -51,6 +52,9 @@ class AbstractCostEstimator {
   mutable std::optional<std::unordered_map<std::shared_ptr<AbstractLQPNode>, Cost>> cost_estimation_by_lqp_cache;
 
  private:
+  // Guards `cost_estimation_by_lqp_cache`, so that plans can be costed concurrently (see DpCcp)
+  mutable std::mutex _cost_estimation_by_lqp_cache_mutex;
+
   /**
    * The Cost of a subplan can be retrieved from the `cost_estimation_by_lqp_cache` under two conditions:
    *    - It is, obviously, actually in the cache
@@ -0,0 +1,122 @@
+#include "cost_estimator_calibrated.hpp"
+
+#include <utility>
+
+#include "expression/abstract_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CostEstimatorCalibrated::CostEstimatorCalibrated(
+    const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+    const std::shared_ptr<const CostModelCoefficients>& init_coefficients)
+    : AbstractCostEstimator(init_cardinality_estimator),
+      coefficients(init_coefficients),
+      _logical_cost_estimator(init_cardinality_estimator) {
+  Assert(coefficients, "CostEstimatorCalibrated needs coefficients");
+}
+
+std::shared_ptr<AbstractCostEstimator> CostEstimatorCalibrated::new_instance() const {
+  return std::make_shared<CostEstimatorCalibrated>(cardinality_estimator->new_instance(), coefficients);
+}
+
+Cost CostEstimatorCalibrated::estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto operator_cost = _estimate_operator_cost(node, _operator_types(*node));
+  if (operator_cost) return operator_cost->first;
+
+  const auto logical_cost = _logical_cost_estimator.estimate_node_cost(node);
+  return logical_cost * static_cast<Cost>(coefficients->fallback_nanoseconds_per_row);
+}
+
+std::optional<OperatorType> CostEstimatorCalibrated::cheapest_join_operator(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  const auto operator_cost = _estimate_operator_cost(join_node, _operator_types(*join_node));
+  if (!operator_cost) return std::nullopt;
+  return operator_cost->second;
+}
+
+std::vector<OperatorType> CostEstimatorCalibrated::_operator_types(const AbstractLQPNode& node) {
+  switch (node.type) {
+    case LQPNodeType::Join: {
+      const auto& join_node = static_cast<const JoinNode&>(node);
+      if (join_node.join_mode == JoinMode::Cross) return {OperatorType::Product};
+
+      // Same checks as in LQPTranslator::_translate_join_node
+      const auto& primary_predicate = *join_node.join_predicates().front();
+      const auto join_predicate =
+          OperatorJoinPredicate::from_expression(primary_predicate, *node.left_input(), *node.right_input());
+      if (!join_predicate) return {};
+
+      const auto configuration =
+          JoinConfiguration{join_node.join_mode, join_predicate->predicate_condition,
+                            primary_predicate.arguments[0]->data_type(), primary_predicate.arguments[1]->data_type(),
+                            join_node.join_predicates().size() > 1};
+
+      auto operator_types = std::vector<OperatorType>{};
+      if (JoinHash::supports(configuration)) operator_types.emplace_back(OperatorType::JoinHash);
+      if (JoinSortMerge::supports(configuration)) operator_types.emplace_back(OperatorType::JoinSortMerge);
+      if (JoinNestedLoop::supports(configuration)) operator_types.emplace_back(OperatorType::JoinNestedLoop);
+      return operator_types;
+    }
+
+    case LQPNodeType::Union:
+      switch (static_cast<const UnionNode&>(node).set_operation_mode) {
+        case SetOperationMode::Positions:
+          return {OperatorType::UnionPositions};
+        case SetOperationMode::All:
+          return {OperatorType::UnionAll};
+        case SetOperationMode::Unique:
+          return {};
+      }
+      Fail("Invalid enum value");
+
+    case LQPNodeType::Aggregate:
+      return {OperatorType::Aggregate};
+    case LQPNodeType::Alias:
+      return {OperatorType::Alias};
+    case LQPNodeType::Limit:
+      return {OperatorType::Limit};
+    case LQPNodeType::Predicate:
+      return {OperatorType::TableScan};
+    case LQPNodeType::Projection:
+      return {OperatorType::Projection};
+    case LQPNodeType::Sort:
+      return {OperatorType::Sort};
+    case LQPNodeType::StoredTable:
+      return {OperatorType::GetTable};
+    case LQPNodeType::Validate:
+      return {OperatorType::Validate};
+
+    default:
+      return {};
+  }
+}
+
+std::optional<std::pair<Cost, OperatorType>> CostEstimatorCalibrated::_estimate_operator_cost(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::vector<OperatorType>& operator_types) const {
+  if (operator_types.empty()) return std::nullopt;
+
+  const auto output_row_count = cardinality_estimator->estimate_cardinality(node);
+  const auto left_input_row_count =
+      node->left_input() ? cardinality_estimator->estimate_cardinality(node->left_input()) : 0.0f;
+  const auto right_input_row_count =
+      node->right_input() ? cardinality_estimator->estimate_cardinality(node->right_input()) : 0.0f;
+  const auto features = cost_model_features(left_input_row_count, right_input_row_count, output_row_count);
+
+  auto cheapest = std::optional<std::pair<Cost, OperatorType>>{};
+  for (const auto operator_type : operator_types) {
+    const auto cost = coefficients->estimate(CostModelKey::for_node(*node, operator_type), features);
+    if (cost && (!cheapest || *cost < cheapest->first)) cheapest = std::pair{*cost, operator_type};
+  }
+  return cheapest;
+}
+
+}  // namespace opossum
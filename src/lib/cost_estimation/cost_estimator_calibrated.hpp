@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_cost_estimator.hpp"
+#include "cost_estimator_logical.hpp"
+#include "cost_model_calibration.hpp"
+
+namespace opossum {
+
+class JoinNode;
+
+/**
+ * Cost model for the runtime of the physical operators (in nanoseconds), calibrated from the runtimes of executed
+ * operators (see CostModelCalibration). Unlike CostEstimatorLogical, it distinguishes the join implementations and
+ * accounts for the encoding of scanned columns and for their access pattern. A join is costed with the cheapest join
+ * implementation that supports it, which is also the one that the LQPTranslator chooses if
+ * Hyrise::get().cost_model_coefficients is set. Nodes whose operators have not been calibrated are costed like in
+ * CostEstimatorLogical, scaled to nanoseconds.
+ */
+class CostEstimatorCalibrated : public AbstractCostEstimator {
+ public:
+  CostEstimatorCalibrated(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+                          const std::shared_ptr<const CostModelCoefficients>& init_coefficients);
+
+  std::shared_ptr<AbstractCostEstimator> new_instance() const override;
+
+  Cost estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+  // Returns the calibrated join implementation with the lowest cost for the (non-cross) join, if any
+  std::optional<OperatorType> cheapest_join_operator(const std::shared_ptr<JoinNode>& join_node) const;
+
+  const std::shared_ptr<const CostModelCoefficients> coefficients;
+
+ private:
+  // The operator types that the node can be translated into
+  static std::vector<OperatorType> _operator_types(const AbstractLQPNode& node);
+
+  // The lowest cost of the given operator types, if any of them is calibrated, and the corresponding type
+  std::optional<std::pair<Cost, OperatorType>> _estimate_operator_cost(
+      const std::shared_ptr<AbstractLQPNode>& node, const std::vector<OperatorType>& operator_types) const;
+
+  const CostEstimatorLogical _logical_cost_estimator;
+};
+
+}  // namespace opossum
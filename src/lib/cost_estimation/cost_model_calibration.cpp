@@ -0,0 +1,275 @@
+#include "cost_model_calibration.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <magic_enum.hpp>
+
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/pqp_utils.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The encoding of the first stored column that the predicate accesses
+std::optional<EncodingType> scanned_encoding_type(const PredicateNode& predicate_node) {
+  auto encoding_type = std::optional<EncodingType>{};
+  const auto predicate = predicate_node.predicate();
+  visit_expression(predicate, [&](const auto& expression) {
+    if (encoding_type) return ExpressionVisitation::DoNotVisitArguments;
+
+    const auto column_expression = std::dynamic_pointer_cast<const LQPColumnExpression>(expression);
+    if (!column_expression) return ExpressionVisitation::VisitArguments;
+
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_expression->original_node.lock());
+    if (!stored_table_node || !Hyrise::get().storage_manager.has_table(stored_table_node->table_name)) {
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+
+    // Chunks are usually encoded alike, so the first one that exists is representative
+    const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto segment = chunk->get_segment(column_expression->original_column_id);
+      encoding_type = get_segment_encoding_spec(segment).encoding_type;
+      break;
+    }
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+  return encoding_type;
+}
+
+template <typename Enum>
+Enum parse_enum(const nlohmann::json& entry, const std::string& name) {
+  const auto string = entry.at(name).get<std::string>();
+  const auto value = magic_enum::enum_cast<Enum>(string);
+  AssertInput(value, "Unknown " + name + " '" + string + "' in cost model");
+  return *value;
+}
+
+// Solves the least squares problem for the given samples via the normal equations. Returns nullopt if the samples do
+// not determine the coefficients.
+template <typename Samples>
+std::optional<CostModelCoefficients::Coefficients> fit_coefficients(const Samples& samples) {
+  constexpr auto N = COST_MODEL_FEATURE_COUNT;
+
+  // Scale the features to [0, 1] so that the row counts do not dominate the numerics
+  auto scales = std::array<double, N>{};
+  scales.fill(1.0);
+  for (const auto* const sample : samples) {
+    for (auto feature_id = size_t{0}; feature_id < N; ++feature_id) {
+      scales[feature_id] = std::max(scales[feature_id], std::abs(sample->features[feature_id]));
+    }
+  }
+
+  // Augmented matrix [X^T X | X^T y]
+  auto matrix = std::array<std::array<double, N + 1>, N>{};
+  for (const auto* const sample : samples) {
+    for (auto row = size_t{0}; row < N; ++row) {
+      const auto row_value = sample->features[row] / scales[row];
+      for (auto column = size_t{0}; column < N; ++column) {
+        matrix[row][column] += row_value * sample->features[column] / scales[column];
+      }
+      matrix[row][N] += row_value * sample->runtime_ns;
+    }
+  }
+
+  // Features that are zero in all samples (e.g., the right input of unary operators) would make the matrix singular.
+  // A small ridge term sets their coefficients to zero instead.
+  for (auto row = size_t{0}; row < N; ++row) {
+    matrix[row][row] += 1e-9 * static_cast<double>(samples.size());
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (auto pivot = size_t{0}; pivot < N; ++pivot) {
+    auto max_row = pivot;
+    for (auto row = pivot + 1; row < N; ++row) {
+      if (std::abs(matrix[row][pivot]) > std::abs(matrix[max_row][pivot])) max_row = row;
+    }
+    if (std::abs(matrix[max_row][pivot]) < 1e-12) return std::nullopt;
+    std::swap(matrix[pivot], matrix[max_row]);
+
+    for (auto row = size_t{0}; row < N; ++row) {
+      if (row == pivot) continue;
+      const auto factor = matrix[row][pivot] / matrix[pivot][pivot];
+      for (auto column = pivot; column <= N; ++column) {
+        matrix[row][column] -= factor * matrix[pivot][column];
+      }
+    }
+  }
+
+  auto coefficients = CostModelCoefficients::Coefficients{};
+  for (auto feature_id = size_t{0}; feature_id < N; ++feature_id) {
+    coefficients[feature_id] = matrix[feature_id][N] / matrix[feature_id][feature_id] / scales[feature_id];
+  }
+  return coefficients;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CostModelFeatures cost_model_features(const double left_input_row_count, const double right_input_row_count,
+                                      const double output_row_count) {
+  return {1.0,
+          left_input_row_count,
+          right_input_row_count,
+          output_row_count,
+          left_input_row_count * std::log2(left_input_row_count + 1.0),
+          right_input_row_count * std::log2(right_input_row_count + 1.0)};
+}
+
+CostModelKey CostModelKey::for_node(const AbstractLQPNode& node, const OperatorType operator_type) {
+  auto key = CostModelKey{operator_type};
+  if (operator_type != OperatorType::TableScan || node.type != LQPNodeType::Predicate) return key;
+
+  key.encoding_type = scanned_encoding_type(static_cast<const PredicateNode&>(node));
+
+  // Scans on (validated) stored tables access the segments sequentially, scans on the output of other operators access
+  // them through PosLists
+  auto input = node.left_input();
+  if (input && input->type == LQPNodeType::Validate) input = input->left_input();
+  key.access_type = input && input->type == LQPNodeType::StoredTable ? SegmentAccessCounter::AccessType::Sequential
+                                                                     : SegmentAccessCounter::AccessType::Random;
+  return key;
+}
+
+bool operator<(const CostModelKey& lhs, const CostModelKey& rhs) {
+  return std::tie(lhs.operator_type, lhs.encoding_type, lhs.access_type) <
+         std::tie(rhs.operator_type, rhs.encoding_type, rhs.access_type);
+}
+
+void CostModelCoefficients::set(const CostModelKey& key, const Coefficients& coefficients) {
+  _coefficients[key] = coefficients;
+}
+
+std::optional<CostModelCoefficients::Coefficients> CostModelCoefficients::get(const CostModelKey& key) const {
+  auto iter = _coefficients.find(key);
+  if (iter == _coefficients.end()) {
+    iter = _coefficients.find(CostModelKey{key.operator_type});
+    if (iter == _coefficients.end()) return std::nullopt;
+  }
+  return iter->second;
+}
+
+std::optional<Cost> CostModelCoefficients::estimate(const CostModelKey& key, const CostModelFeatures& features) const {
+  const auto coefficients = get(key);
+  if (!coefficients) return std::nullopt;
+
+  auto runtime_ns = 0.0;
+  for (auto feature_id = size_t{0}; feature_id < COST_MODEL_FEATURE_COUNT; ++feature_id) {
+    runtime_ns += (*coefficients)[feature_id] * features[feature_id];
+  }
+
+  // Least squares fits can have negative coefficients, but runtimes cannot be negative
+  return static_cast<Cost>(std::max(runtime_ns, 0.0));
+}
+
+nlohmann::json CostModelCoefficients::to_json() const {
+  auto entries = nlohmann::json::array();
+  for (const auto& [key, coefficients] : _coefficients) {
+    auto entry = nlohmann::json{{"operator_type", magic_enum::enum_name(key.operator_type)},
+                                {"coefficients", coefficients}};
+    if (key.encoding_type) entry["encoding_type"] = magic_enum::enum_name(*key.encoding_type);
+    if (key.access_type) entry["access_type"] = magic_enum::enum_name(*key.access_type);
+    entries.push_back(std::move(entry));
+  }
+
+  return {{"fallback_nanoseconds_per_row", fallback_nanoseconds_per_row}, {"coefficients", entries}};
+}
+
+CostModelCoefficients CostModelCoefficients::from_json(const nlohmann::json& json) {
+  auto coefficients = CostModelCoefficients{};
+  coefficients.fallback_nanoseconds_per_row = json.at("fallback_nanoseconds_per_row").get<double>();
+
+  for (const auto& entry : json.at("coefficients")) {
+    auto key = CostModelKey{parse_enum<OperatorType>(entry, "operator_type")};
+    if (entry.contains("encoding_type")) key.encoding_type = parse_enum<EncodingType>(entry, "encoding_type");
+    if (entry.contains("access_type")) {
+      key.access_type = parse_enum<SegmentAccessCounter::AccessType>(entry, "access_type");
+    }
+    coefficients.set(key, entry.at("coefficients").get<Coefficients>());
+  }
+
+  return coefficients;
+}
+
+void CostModelCalibration::add_plan(const std::shared_ptr<const AbstractOperator>& pqp) {
+  const auto output_row_count = [](const std::shared_ptr<const AbstractOperator>& op) {
+    if (!op || !op->performance_data->has_output) return 0.0;
+    return static_cast<double>(op->performance_data->output_row_count);
+  };
+
+  visit_pqp(pqp, [&](const auto& op) {
+    const auto& performance_data = *op->performance_data;
+    if (op->lqp_node && performance_data.executed) {
+      const auto features =
+          cost_model_features(output_row_count(op->left_input()), output_row_count(op->right_input()),
+                              output_row_count(op));
+      add_sample(*op->lqp_node, op->type(), features, performance_data.walltime);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+}
+
+void CostModelCalibration::add_sample(const AbstractLQPNode& node, const OperatorType operator_type,
+                                      const CostModelFeatures& features, const std::chrono::nanoseconds runtime) {
+  auto sample = Sample{CostModelKey::for_node(node, operator_type), features, static_cast<double>(runtime.count())};
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _samples.emplace_back(std::move(sample));
+}
+
+size_t CostModelCalibration::sample_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _samples.size();
+}
+
+CostModelCoefficients CostModelCalibration::train() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  // Samples of table scans are also used for the coefficients of the operator type alone, which serve as a fallback
+  // for encodings and access types that were not calibrated
+  auto samples_by_key = std::map<CostModelKey, std::vector<const Sample*>>{};
+  auto total_runtime_ns = 0.0;
+  auto total_row_count = 0.0;
+  for (const auto& sample : _samples) {
+    samples_by_key[sample.key].emplace_back(&sample);
+    if (sample.key.encoding_type || sample.key.access_type) {
+      samples_by_key[CostModelKey{sample.key.operator_type}].emplace_back(&sample);
+    }
+
+    // Logical cost as used by CostEstimatorLogical for most nodes: input plus output rows
+    total_runtime_ns += sample.runtime_ns;
+    total_row_count += sample.features[1] + sample.features[2] + sample.features[3];
+  }
+
+  auto coefficients = CostModelCoefficients{};
+  if (total_row_count > 0.0) coefficients.fallback_nanoseconds_per_row = total_runtime_ns / total_row_count;
+
+  for (const auto& [key, samples] : samples_by_key) {
+    if (samples.size() < MIN_SAMPLE_COUNT) continue;
+
+    const auto key_coefficients = fit_coefficients(samples);
+    if (key_coefficients) coefficients.set(key, *key_coefficients);
+  }
+
+  return coefficients;
+}
+
+}  // namespace opossum
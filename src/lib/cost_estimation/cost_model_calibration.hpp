@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "operators/abstract_operator.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * The calibrated cost model predicts the runtime of an operator (in nanoseconds) as a linear combination of these
+ * features, which are derived from the row counts of its inputs and its output: a constant, the left input row count,
+ * the right input row count, the output row count, and n * log2(n) for both input row counts (for sorting).
+ */
+constexpr auto COST_MODEL_FEATURE_COUNT = size_t{6};
+using CostModelFeatures = std::array<double, COST_MODEL_FEATURE_COUNT>;
+
+CostModelFeatures cost_model_features(const double left_input_row_count, const double right_input_row_count,
+                                      const double output_row_count);
+
+/**
+ * Identifies the coefficients of an operator. Besides on the operator type, the runtime of table scans depends on the
+ * encoding of the scanned column and on whether it is accessed sequentially or through PosLists (random access).
+ */
+struct CostModelKey {
+  // Determines the key for the operator of the given type that the LQP node is translated into
+  static CostModelKey for_node(const AbstractLQPNode& node, const OperatorType operator_type);
+
+  OperatorType operator_type;
+  std::optional<EncodingType> encoding_type{};
+  std::optional<SegmentAccessCounter::AccessType> access_type{};
+};
+
+bool operator<(const CostModelKey& lhs, const CostModelKey& rhs);
+
+/**
+ * Trained coefficients of the calibrated cost model (see CostModelCalibration and CostEstimatorCalibrated).
+ */
+class CostModelCoefficients {
+ public:
+  using Coefficients = std::array<double, COST_MODEL_FEATURE_COUNT>;
+
+  void set(const CostModelKey& key, const Coefficients& coefficients);
+
+  // Returns the coefficients of the key. Falls back to the coefficients of the operator type alone if there are none
+  // for the encoding and access type.
+  std::optional<Coefficients> get(const CostModelKey& key) const;
+
+  // Predicted runtime in nanoseconds, if there are coefficients for the key
+  std::optional<Cost> estimate(const CostModelKey& key, const CostModelFeatures& features) const;
+
+  // Runtime per processed row (input and output) for operators without coefficients, in nanoseconds
+  double fallback_nanoseconds_per_row{1.0};
+
+  nlohmann::json to_json() const;
+  static CostModelCoefficients from_json(const nlohmann::json& json);
+
+ private:
+  std::map<CostModelKey, Coefficients> _coefficients;
+};
+
+/**
+ * Collects the runtimes of executed operators (see OperatorPerformanceData) and fits the coefficients of the cost
+ * model with least squares. Plans are added by the SQLPipelineStatement if Hyrise::get().cost_model_calibration is
+ * set, e.g., by running a benchmark with --cost_model_calibration.
+ */
+class CostModelCalibration : public Noncopyable {
+ public:
+  // Keys with fewer samples do not get coefficients of their own
+  static constexpr auto MIN_SAMPLE_COUNT = COST_MODEL_FEATURE_COUNT * 2;
+
+  // Adds a sample for every executed operator of the plan that has an LQP node
+  void add_plan(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Adds a sample for an operator that the LQP node was translated into
+  void add_sample(const AbstractLQPNode& node, const OperatorType operator_type, const CostModelFeatures& features,
+                  const std::chrono::nanoseconds runtime);
+
+  size_t sample_count() const;
+
+  CostModelCoefficients train() const;
+
+ private:
+  struct Sample {
+    CostModelKey key;
+    CostModelFeatures features;
+    double runtime_ns;
+  };
+
+  mutable std::mutex _mutex;
+  std::vector<Sample> _samples;
+};
+
+}  // namespace opossum
@@ -0,0 +1,256 @@
+#include "cluster.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include "concurrency/transaction_context.hpp"
+#include "distributed/shard_fragment.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Distinguishes the temporary files of tables that are transferred concurrently
+std::atomic<size_t> next_transfer_id{0};
+
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+std::filesystem::path transfer_path() {
+  return std::filesystem::temp_directory_path() /
+         ("hyrise_transfer_" + std::to_string(getpid()) + "_" + std::to_string(next_transfer_id++));
+}
+
+// Tables are transferred in the format of the BinaryWriter, which only writes to files
+std::vector<char> serialize_table(const Table& table) {
+  const auto path = transfer_path();
+  BinaryWriter::write(table, path);
+
+  auto file = std::ifstream{path, std::ios::binary};
+  auto data = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  file.close();
+  std::filesystem::remove(path);
+  return data;
+}
+
+std::shared_ptr<Table> deserialize_table(const std::string_view data) {
+  const auto path = transfer_path();
+  {
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    Assert(file.good(), "Could not write transferred table");
+  }
+
+  const auto table = BinaryParser::parse(path);
+  std::filesystem::remove(path);
+  return table;
+}
+
+template <typename T>
+T read_value(boost::asio::ip::tcp::socket& socket) {
+  auto value = T{};
+  boost::asio::read(socket, boost::asio::buffer(&value, sizeof(T)));
+  return value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Cluster::Cluster(const std::vector<ClusterNode>& nodes, const NodeID node_id)
+    : _nodes(nodes),
+      _node_id(node_id),
+      _acceptor(_io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), nodes.at(node_id).port)) {
+  _accept_request();
+  _network_thread = std::thread{[&]() { _io_service.run(); }};
+}
+
+Cluster::~Cluster() {
+  // Closing the acceptor aborts the pending accept, so that the network thread runs out of work
+  boost::asio::post(_io_service, [&]() { _acceptor.close(); });
+  _network_thread.join();
+
+  while (_running_request_count > 0) {
+    // As in Server::shutdown(), a busy wait is good enough to guarantee a clean shutdown
+    std::this_thread::yield();
+  }
+}
+
+NodeID Cluster::node_id() const { return _node_id; }
+
+NodeID Cluster::node_count() const { return NodeID{static_cast<NodeID::base_type>(_nodes.size())}; }
+
+void Cluster::add_sharded_table(const std::string& table_name, const ColumnID sharding_column_id) {
+  _shardings[table_name] =
+      TablePartitioning::hash(sharding_column_id, PartitionID{static_cast<PartitionID::base_type>(_nodes.size())});
+}
+
+bool Cluster::is_sharded(const std::string& table_name) const { return _shardings.contains(table_name); }
+
+ColumnID Cluster::sharding_column_id(const std::string& table_name) const {
+  const auto sharding_iter = _shardings.find(table_name);
+  Assert(sharding_iter != _shardings.end(), "Table '" + table_name + "' is not sharded");
+  return sharding_iter->second->column_id();
+}
+
+NodeID Cluster::node_for(const std::string& table_name, const AllTypeVariant& value) const {
+  const auto sharding_iter = _shardings.find(table_name);
+  Assert(sharding_iter != _shardings.end(), "Table '" + table_name + "' is not sharded");
+  return NodeID{static_cast<NodeID::base_type>(sharding_iter->second->partition_for(value))};
+}
+
+std::shared_ptr<const Table> Cluster::execute_fragment(
+    const NodeID node_id, const ShardFragment& fragment,
+    const std::shared_ptr<TransactionContext>& transaction_context) const {
+  if (node_id != _node_id) {
+    const auto response = _send_request(node_id, RequestType::ExecuteFragment, fragment.serialize());
+    return deserialize_table({response.data(), response.size()});
+  }
+
+  auto fragment_transaction_context = transaction_context;
+  if (!fragment_transaction_context) {
+    fragment_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(
+        AutoCommit::Yes, TransactionAccessMode::ReadOnly);
+  }
+
+  const auto pqp = fragment.create_pqp();
+  pqp->set_transaction_context_recursively(fragment_transaction_context);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp));
+  if (!transaction_context) fragment_transaction_context->commit();
+
+  return pqp->get_output();
+}
+
+void Cluster::insert(const NodeID node_id, const std::string& table_name, const Table& rows) const {
+  DebugAssert(node_id != _node_id, "Rows of this node are inserted by the Insert operator");
+
+  auto payload = std::vector<char>{};
+  append_value(payload, static_cast<uint32_t>(table_name.size()));
+  payload.insert(payload.end(), table_name.begin(), table_name.end());
+  const auto table_data = serialize_table(rows);
+  payload.insert(payload.end(), table_data.begin(), table_data.end());
+
+  _send_request(node_id, RequestType::Insert, payload);
+}
+
+void Cluster::_accept_request() {
+  const auto socket = std::make_shared<boost::asio::ip::tcp::socket>(_io_service);
+  _acceptor.async_accept(*socket, [this, socket](const boost::system::error_code& error) {
+    // The acceptor has been closed by the destructor
+    if (error == boost::asio::error::operation_aborted) return;
+    Assert(!error, error.message());
+
+    ++_running_request_count;
+    const auto task = std::make_shared<JobTask>([this, request_socket = socket]() mutable {
+      _handle_request(*request_socket);
+
+      // The socket must not outlive the io_service, which is destroyed once no request is running
+      request_socket.reset();
+      --_running_request_count;
+    });
+    task->schedule();
+
+    _accept_request();
+  });
+}
+
+void Cluster::_handle_request(boost::asio::ip::tcp::socket& socket) {
+  auto failed = false;
+  auto response = std::vector<char>{};
+  try {
+    const auto request_type = read_value<RequestType>(socket);
+    auto payload = std::vector<char>(read_value<uint64_t>(socket));
+    boost::asio::read(socket, boost::asio::buffer(payload));
+
+    switch (request_type) {
+      case RequestType::ExecuteFragment: {
+        const auto fragment = ShardFragment::deserialize({payload.data(), payload.size()});
+        response = serialize_table(*execute_fragment(_node_id, fragment));
+      } break;
+
+      case RequestType::Insert: {
+        auto table_name_size = uint32_t{0};
+        std::memcpy(&table_name_size, payload.data(), sizeof(table_name_size));
+        const auto table_name = std::string{payload.data() + sizeof(table_name_size), table_name_size};
+        const auto table_data_begin = sizeof(table_name_size) + table_name_size;
+        const auto rows =
+            deserialize_table({payload.data() + table_data_begin, payload.size() - table_data_begin});
+
+        const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+        table_wrapper->execute();
+        const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+        const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+        insert->set_transaction_context(transaction_context);
+        insert->execute();
+        transaction_context->commit();
+      } break;
+    }
+  } catch (const std::exception& exception) {
+    failed = true;
+    const auto message = std::string{exception.what()};
+    response.assign(message.begin(), message.end());
+  }
+
+  try {
+    auto header = std::vector<char>{};
+    append_value(header, static_cast<uint8_t>(failed));
+    append_value(header, static_cast<uint64_t>(response.size()));
+    boost::asio::write(socket, boost::asio::buffer(header));
+    boost::asio::write(socket, boost::asio::buffer(response));
+  } catch (const boost::system::system_error& error) {
+    Hyrise::get().log_manager.add_message("Cluster", "Could not respond to request: " + std::string{error.what()},
+                                          LogLevel::Warning);
+  }
+}
+
+std::vector<char> Cluster::_send_request(const NodeID node_id, const RequestType request_type,
+                                         const std::vector<char>& payload) const {
+  const auto& node = _nodes.at(node_id);
+  auto io_service = boost::asio::io_service{};
+  auto socket = boost::asio::ip::tcp::socket{io_service};
+  auto resolver = boost::asio::ip::tcp::resolver{io_service};
+  boost::asio::connect(socket, resolver.resolve(node.host, std::to_string(node.port)));
+  socket.set_option(boost::asio::ip::tcp::no_delay(true));
+
+  auto header = std::vector<char>{};
+  append_value(header, request_type);
+  append_value(header, static_cast<uint64_t>(payload.size()));
+  boost::asio::write(socket, boost::asio::buffer(header));
+  boost::asio::write(socket, boost::asio::buffer(payload));
+
+  const auto failed = read_value<uint8_t>(socket);
+  auto response = std::vector<char>(read_value<uint64_t>(socket));
+  boost::asio::read(socket, boost::asio::buffer(response));
+  Assert(!failed, "Node " + std::to_string(static_cast<NodeID::base_type>(node_id)) + " failed to handle request: " +
+                      std::string{response.begin(), response.end()});
+  return response;
+}
+
+}  // namespace opossum
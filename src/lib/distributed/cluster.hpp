@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class TablePartitioning;
+class TransactionContext;
+struct ShardFragment;
+
+struct ClusterNode {
+  std::string host;
+  uint16_t port;
+};
+
+/**
+ * A shared-nothing cluster of Hyrise instances (nodes) that shard large tables.
+ *
+ * The rows of a sharded table are hash partitioned by one of its columns across the nodes (see TablePartitioning).
+ * Each node stores its shard under the name of the table and registers the table with add_sharded_table(). Queries can
+ * be sent to any node, which then coordinates their execution:
+ *
+ *  - Reads of sharded tables are executed by Exchange operators that gather the rows of all shards. Predicates and
+ *    aggregations directly on top of the table are executed by each node on its shard (see ShardFragment), the
+ *    remaining operators by the coordinator.
+ *  - Inserted rows are shuffled to the nodes that store them.
+ *  - DELETE and UPDATE statements on sharded tables are not supported.
+ *
+ * There are no distributed transactions: Each node reads and inserts in transactions of its own, so that queries do
+ * not see a consistent snapshot across nodes and rows inserted on other nodes are not rolled back.
+ *
+ * Each node serves the requests of the other nodes on its port. Requests are handled in tasks on the scheduler. Tables
+ * are transferred in the format of the BinaryWriter. All nodes must run the same build on the same architecture, as
+ * integers are sent in host byte order and the hashes of the sharding values must match.
+ */
+class Cluster : public Noncopyable {
+ public:
+  // Starts serving requests on the port of this node, which is nodes[node_id]
+  Cluster(const std::vector<ClusterNode>& nodes, const NodeID node_id);
+
+  // Stops serving requests, waits for requests that are being handled
+  ~Cluster();
+
+  NodeID node_id() const;
+  NodeID node_count() const;
+
+  // Rows are stored by the node whose id is the hash partition of their value in the sharding column
+  void add_sharded_table(const std::string& table_name, const ColumnID sharding_column_id);
+  bool is_sharded(const std::string& table_name) const;
+  ColumnID sharding_column_id(const std::string& table_name) const;
+  NodeID node_for(const std::string& table_name, const AllTypeVariant& value) const;
+
+  /**
+   * Executes the fragment on the shard of the node. On this node, the fragment is executed in the given transaction if
+   * there is one.
+   */
+  std::shared_ptr<const Table> execute_fragment(
+      const NodeID node_id, const ShardFragment& fragment,
+      const std::shared_ptr<TransactionContext>& transaction_context = nullptr) const;
+
+  // Inserts the rows into the shard of another node in a transaction of that node
+  void insert(const NodeID node_id, const std::string& table_name, const Table& rows) const;
+
+ private:
+  enum class RequestType : uint8_t { ExecuteFragment, Insert };
+
+  void _accept_request();
+  void _handle_request(boost::asio::ip::tcp::socket& socket);
+  std::vector<char> _send_request(const NodeID node_id, const RequestType request_type,
+                                  const std::vector<char>& payload) const;
+
+  const std::vector<ClusterNode> _nodes;
+  const NodeID _node_id;
+
+  // Sharded tables are only registered before queries are executed
+  std::unordered_map<std::string, std::shared_ptr<const TablePartitioning>> _shardings;
+
+  boost::asio::io_service _io_service;
+  boost::asio::ip::tcp::acceptor _acceptor;
+  std::thread _network_thread;
+  std::atomic<uint64_t> _running_request_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,264 @@
+#include "shard_fragment.hpp"
+
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void append_string(std::vector<char>& buffer, const std::string_view string) {
+  append_value(buffer, static_cast<uint32_t>(string.size()));
+  buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+void append_variant(std::vector<char>& buffer, const AllTypeVariant& variant) {
+  const auto data_type = data_type_from_all_type_variant(variant);
+  append_value(buffer, data_type);
+  if (data_type == DataType::Null) return;
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      append_string(buffer, boost::get<pmr_string>(variant));
+    } else {
+      append_value(buffer, boost::get<ColumnDataType>(variant));
+    }
+  });
+}
+
+template <typename T>
+void append_vector(std::vector<char>& buffer, const std::vector<T>& values) {
+  append_value(buffer, static_cast<uint32_t>(values.size()));
+  for (const auto& value : values) {
+    append_value(buffer, value);
+  }
+}
+
+class FragmentReader {
+ public:
+  explicit FragmentReader(const std::string_view data) : _data(data) {}
+
+  template <typename T>
+  T read_value() {
+    Assert(_position + sizeof(T) <= _data.size(), "Fragment is truncated");
+    auto value = T{};
+    std::memcpy(&value, _data.data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto size = read_value<uint32_t>();
+    Assert(_position + size <= _data.size(), "Fragment is truncated");
+    const auto string = std::string{_data.substr(_position, size)};
+    _position += size;
+    return string;
+  }
+
+  AllTypeVariant read_variant() {
+    const auto data_type = read_value<DataType>();
+    if (data_type == DataType::Null) return NULL_VALUE;
+
+    auto variant = AllTypeVariant{};
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        variant = pmr_string{read_string()};
+      } else {
+        variant = read_value<ColumnDataType>();
+      }
+    });
+    return variant;
+  }
+
+  template <typename T>
+  std::vector<T> read_vector() {
+    auto values = std::vector<T>(read_value<uint32_t>());
+    for (auto& value : values) {
+      value = read_value<T>();
+    }
+    return values;
+  }
+
+ private:
+  std::string_view _data;
+  size_t _position{0};
+};
+
+// The columns of the local shard without the pruned ones, i.e., the output columns of the GetTable
+std::vector<std::shared_ptr<PQPColumnExpression>> column_expressions(const ShardFragment& fragment) {
+  const auto table = Hyrise::get().storage_manager.get_table(fragment.table_name);
+  const auto column_count = table->column_count();
+
+  auto expressions = std::vector<std::shared_ptr<PQPColumnExpression>>{};
+  auto pruned_column_ids_iter = fragment.pruned_column_ids.begin();
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < column_count; ++stored_column_id) {
+    if (pruned_column_ids_iter != fragment.pruned_column_ids.end() && *pruned_column_ids_iter == stored_column_id) {
+      ++pruned_column_ids_iter;
+      continue;
+    }
+
+    expressions.emplace_back(pqp_column_(ColumnID{static_cast<ColumnID::base_type>(expressions.size())},
+                                         table->column_data_type(stored_column_id),
+                                         table->column_is_nullable(stored_column_id),
+                                         table->column_name(stored_column_id)));
+  }
+  return expressions;
+}
+
+std::vector<std::shared_ptr<AggregateExpression>> partial_aggregate_expressions(
+    const ShardFragment& fragment, const std::vector<std::shared_ptr<PQPColumnExpression>>& columns) {
+  auto expressions = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto& aggregate : fragment.aggregates) {
+    const auto argument = aggregate.column_id
+                              ? columns[*aggregate.column_id]
+                              : std::make_shared<PQPColumnExpression>(INVALID_COLUMN_ID, DataType::Long, false, "*");
+    expressions.emplace_back(std::make_shared<AggregateExpression>(aggregate.aggregate_function, argument));
+  }
+  return expressions;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool ShardFragment::supports(const AggregateFunction aggregate_function) {
+  switch (aggregate_function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+    case AggregateFunction::Sum:
+    case AggregateFunction::Count:
+    case AggregateFunction::Any:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::shared_ptr<AbstractOperator> ShardFragment::create_pqp() const {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  auto pqp = std::shared_ptr<AbstractOperator>{
+      std::make_shared<GetTable>(table_name, std::vector<ChunkID>{}, pruned_column_ids)};
+  if (table->uses_mvcc() == UseMvcc::Yes) pqp = std::make_shared<Validate>(pqp);
+
+  const auto columns = column_expressions(*this);
+  for (const auto& predicate : predicates) {
+    const auto& column = columns[predicate.column_id];
+    auto expression = std::shared_ptr<AbstractExpression>{};
+    if (is_between_predicate_condition(predicate.predicate_condition)) {
+      expression = std::make_shared<BetweenExpression>(predicate.predicate_condition, column, value_(predicate.value),
+                                                       value_(*predicate.value2));
+    } else {
+      expression =
+          std::make_shared<BinaryPredicateExpression>(predicate.predicate_condition, column, value_(predicate.value));
+    }
+    pqp = std::make_shared<TableScan>(pqp, expression);
+  }
+
+  if (!is_aggregating()) return pqp;
+  return std::make_shared<AggregateHash>(pqp, partial_aggregate_expressions(*this, columns), group_by_column_ids);
+}
+
+std::shared_ptr<AbstractOperator> ShardFragment::create_final_aggregate_pqp(
+    const std::shared_ptr<AbstractOperator>& input_operator) const {
+  DebugAssert(is_aggregating(), "Fragment does not aggregate");
+
+  // The partial results contain the GROUP BY columns followed by the aggregates
+  const auto group_by_column_count = group_by_column_ids.size();
+  auto final_group_by_column_ids = std::vector<ColumnID>(group_by_column_count);
+  std::iota(final_group_by_column_ids.begin(), final_group_by_column_ids.end(), ColumnID{0});
+
+  const auto partial_aggregates = partial_aggregate_expressions(*this, column_expressions(*this));
+  auto final_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (auto aggregate_index = size_t{0}; aggregate_index < partial_aggregates.size(); ++aggregate_index) {
+    const auto& partial_aggregate = partial_aggregates[aggregate_index];
+    const auto is_count = partial_aggregate->aggregate_function == AggregateFunction::Count;
+    const auto partial_column =
+        pqp_column_(ColumnID{static_cast<ColumnID::base_type>(group_by_column_count + aggregate_index)},
+                    partial_aggregate->data_type(), !is_count, partial_aggregate->as_column_name());
+
+    // The counts of the nodes are summed up, the other functions are applied to their own results
+    const auto final_function = is_count ? AggregateFunction::Sum : partial_aggregate->aggregate_function;
+    final_aggregates.emplace_back(std::make_shared<AggregateExpression>(final_function, partial_column));
+  }
+
+  return std::make_shared<AggregateHash>(input_operator, final_aggregates, final_group_by_column_ids);
+}
+
+bool ShardFragment::is_aggregating() const { return !group_by_column_ids.empty() || !aggregates.empty(); }
+
+std::vector<char> ShardFragment::serialize() const {
+  auto buffer = std::vector<char>{};
+  append_string(buffer, table_name);
+  append_vector(buffer, pruned_column_ids);
+
+  append_value(buffer, static_cast<uint32_t>(predicates.size()));
+  for (const auto& predicate : predicates) {
+    append_value(buffer, predicate.column_id);
+    append_value(buffer, predicate.predicate_condition);
+    append_variant(buffer, predicate.value);
+    append_value(buffer, static_cast<uint8_t>(predicate.value2.has_value()));
+    if (predicate.value2) append_variant(buffer, *predicate.value2);
+  }
+
+  append_vector(buffer, group_by_column_ids);
+  append_value(buffer, static_cast<uint32_t>(aggregates.size()));
+  for (const auto& aggregate : aggregates) {
+    append_value(buffer, aggregate.aggregate_function);
+    append_value(buffer, aggregate.column_id.value_or(INVALID_COLUMN_ID));
+  }
+  return buffer;
+}
+
+ShardFragment ShardFragment::deserialize(const std::string_view data) {
+  auto reader = FragmentReader{data};
+  auto fragment = ShardFragment{};
+  fragment.table_name = reader.read_string();
+  fragment.pruned_column_ids = reader.read_vector<ColumnID>();
+
+  const auto predicate_count = reader.read_value<uint32_t>();
+  for (auto predicate_index = uint32_t{0}; predicate_index < predicate_count; ++predicate_index) {
+    auto& predicate = fragment.predicates.emplace_back();
+    predicate.column_id = reader.read_value<ColumnID>();
+    predicate.predicate_condition = reader.read_value<PredicateCondition>();
+    predicate.value = reader.read_variant();
+    if (reader.read_value<uint8_t>()) predicate.value2 = reader.read_variant();
+  }
+
+  fragment.group_by_column_ids = reader.read_vector<ColumnID>();
+  const auto aggregate_count = reader.read_value<uint32_t>();
+  for (auto aggregate_index = uint32_t{0}; aggregate_index < aggregate_count; ++aggregate_index) {
+    auto& aggregate = fragment.aggregates.emplace_back();
+    aggregate.aggregate_function = reader.read_value<AggregateFunction>();
+    const auto column_id = reader.read_value<ColumnID>();
+    if (column_id != INVALID_COLUMN_ID) aggregate.column_id = column_id;
+  }
+  return fragment;
+}
+
+}  // namespace opossum
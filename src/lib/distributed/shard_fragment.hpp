@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Part of a query that every node of a Cluster executes on its shard of a table (see Exchange): The valid rows of the
+ * shard are scanned with predicates of the form `column <condition> value(s)` and optionally aggregated. Column ids
+ * refer to the columns of the table without the pruned ones.
+ *
+ * The aggregation is partial, i.e., the coordinator combines the groups of all nodes. Thus, only aggregate functions
+ * whose results can be combined are supported: MIN, MAX, SUM, COUNT (whose results are summed up), and ANY.
+ */
+struct ShardFragment {
+  struct Predicate {
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    AllTypeVariant value;
+    std::optional<AllTypeVariant> value2;
+  };
+
+  struct Aggregate {
+    AggregateFunction aggregate_function;
+    // nullopt for COUNT(*)
+    std::optional<ColumnID> column_id;
+  };
+
+  // Returns whether fragments can aggregate with the function
+  static bool supports(const AggregateFunction aggregate_function);
+
+  // Creates the operators that execute the fragment on the local shard
+  std::shared_ptr<AbstractOperator> create_pqp() const;
+
+  // Creates the aggregate that combines the partial aggregates of all nodes, which are the output of the input operator
+  std::shared_ptr<AbstractOperator> create_final_aggregate_pqp(
+      const std::shared_ptr<AbstractOperator>& input_operator) const;
+
+  bool is_aggregating() const;
+
+  std::vector<char> serialize() const;
+  static ShardFragment deserialize(const std::string_view data);
+
+  std::string table_name;
+  std::vector<ColumnID> pruned_column_ids;
+  std::vector<Predicate> predicates;
+
+  // If both are empty, the rows are not aggregated
+  std::vector<ColumnID> group_by_column_ids;
+  std::vector<Aggregate> aggregates;
+};
+
+}  // namespace opossum
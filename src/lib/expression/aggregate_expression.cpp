@@ -14,15 +14,22 @@
 namespace opossum {
 
 AggregateExpression::AggregateExpression(const AggregateFunction init_aggregate_function,
-                                         const std::shared_ptr<AbstractExpression>& argument)
-    : AbstractExpression(ExpressionType::Aggregate, {argument}), aggregate_function(init_aggregate_function) {}
+                                         const std::shared_ptr<AbstractExpression>& argument,
+                                         const std::optional<double>& init_percentile)
+    : AbstractExpression(ExpressionType::Aggregate, {argument}),
+      aggregate_function(init_aggregate_function),
+      percentile(init_percentile) {
+  Assert(percentile.has_value() == (aggregate_function == AggregateFunction::ApproxPercentile),
+         "Expected a percentile for APPROX_PERCENTILE only");
+  Assert(!percentile || (*percentile >= 0.0 && *percentile <= 1.0), "Percentile must be between 0 and 1");
+}
 
 std::shared_ptr<AbstractExpression> AggregateExpression::argument() const {
   return arguments.empty() ? nullptr : arguments[0];
 }
 
 std::shared_ptr<AbstractExpression> AggregateExpression::deep_copy() const {
-  return std::make_shared<AggregateExpression>(aggregate_function, argument()->deep_copy());
+  return std::make_shared<AggregateExpression>(aggregate_function, argument()->deep_copy(), percentile);
 }
 
 std::string AggregateExpression::description(const DescriptionMode mode) const {
@@ -42,6 +49,7 @@ std::string AggregateExpression::description(const DescriptionMode mode) const {
   } else {
     stream << aggregate_function << "(";
     if (argument()) stream << argument()->description(mode);
+    if (percentile) stream << ", " << *percentile;
     stream << ")";
   }
 
@@ -59,6 +67,10 @@ DataType AggregateExpression::data_type() const {
     return AggregateTraits<NullValue, AggregateFunction::CountDistinct>::AGGREGATE_DATA_TYPE;
   }
 
+  if (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    return AggregateTraits<NullValue, AggregateFunction::ApproxCountDistinct>::AGGREGATE_DATA_TYPE;
+  }
+
   const auto argument_data_type = argument()->data_type();
   auto aggregate_data_type = DataType::Null;
 
@@ -76,6 +88,7 @@ DataType AggregateExpression::data_type() const {
         break;
       case AggregateFunction::Count:
       case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct:
         break;  // These are handled above
       case AggregateFunction::Sum:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
@@ -84,6 +97,10 @@ DataType AggregateExpression::data_type() const {
         aggregate_data_type =
             AggregateTraits<AggregateDataType, AggregateFunction::StandardDeviationSample>::AGGREGATE_DATA_TYPE;
         break;
+      case AggregateFunction::ApproxPercentile:
+        aggregate_data_type =
+            AggregateTraits<AggregateDataType, AggregateFunction::ApproxPercentile>::AGGREGATE_DATA_TYPE;
+        break;
       case AggregateFunction::Any:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Any>::AGGREGATE_DATA_TYPE;
         break;
@@ -110,15 +127,22 @@ bool AggregateExpression::is_count_star(const AbstractExpression& expression) {
 bool AggregateExpression::_shallow_equals(const AbstractExpression& expression) const {
   DebugAssert(dynamic_cast<const AggregateExpression*>(&expression),
               "Different expression type should have been caught by AbstractExpression::operator==");
-  return aggregate_function == static_cast<const AggregateExpression&>(expression).aggregate_function;
+  const auto& aggregate_expression = static_cast<const AggregateExpression&>(expression);
+  return aggregate_function == aggregate_expression.aggregate_function &&
+         percentile == aggregate_expression.percentile;
 }
 
-size_t AggregateExpression::_shallow_hash() const { return boost::hash_value(static_cast<size_t>(aggregate_function)); }
+size_t AggregateExpression::_shallow_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(aggregate_function));
+  if (percentile) boost::hash_combine(hash, *percentile);
+  return hash;
+}
 
 bool AggregateExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
-  // Aggregates (except COUNT and COUNT DISTINCT) will return NULL when executed on an
+  // Aggregates (except COUNT, COUNT DISTINCT, and APPROX_COUNT_DISTINCT) will return NULL when executed on an
   // empty group - thus they are always nullable
-  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
+  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+         aggregate_function != AggregateFunction::ApproxCountDistinct;
 }
 
 }  // namespace opossum
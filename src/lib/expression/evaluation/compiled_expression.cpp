@@ -0,0 +1,402 @@
+#include "compiled_expression.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/arithmetic_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression_evaluator.hpp"
+#include "expression_functors.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Register = CompiledExpression::Register;
+using Kernel = CompiledExpression::Kernel;
+
+// The result types that the ExpressionEvaluator produces, see expression_common_type()
+struct ArithmeticResultType {
+  template <typename Left, typename Right>
+  using type = std::conditional_t<
+      std::is_same_v<double, Left> || std::is_same_v<double, Right>, double,
+      std::conditional_t<std::is_same_v<int64_t, Left> || std::is_same_v<int64_t, Right>,
+                         std::conditional_t<std::is_floating_point_v<Left> || std::is_floating_point_v<Right>, double,
+                                            int64_t>,
+                         std::conditional_t<std::is_same_v<float, Left> || std::is_same_v<float, Right>, float,
+                                            int32_t>>>;
+};
+
+struct BoolResultType {
+  template <typename Left, typename Right>
+  using type = ExpressionEvaluator::Bool;
+};
+
+bool is_numeric_data_type(const DataType data_type) {
+  return data_type == DataType::Int || data_type == DataType::Long || data_type == DataType::Float ||
+         data_type == DataType::Double;
+}
+
+/**
+ * Evaluates a node for a block. With the default null logic, the result is NULL if one of the operands is NULL (see
+ * ExpressionEvaluator::_evaluate_default_null_logic()). Otherwise, the functor decides whether the result is NULL.
+ */
+template <typename Functor, bool functor_based_null_logic, typename Result, typename Left, typename Right>
+void evaluate_block(Register& result, const Register& left, const Register& right, const size_t row_count) {
+  auto* const result_values = static_cast<Result*>(result.output);
+  const auto* const left_values = static_cast<const Left*>(left.values);
+  const auto* const right_values = static_cast<const Right*>(right.values);
+
+  if constexpr (functor_based_null_logic) {
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      auto null = false;
+      result_values[row_id] = Result{};
+      Functor{}(result_values[row_id], null, left_values[row_id], left.nullable && left.nulls[row_id],
+                right_values[row_id], right.nullable && right.nulls[row_id]);
+      result.nulls[row_id] = null;
+    }
+    result.nullable = true;
+  } else {
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      Functor{}(result_values[row_id], left_values[row_id], right_values[row_id]);
+    }
+
+    if (left.nullable && right.nullable) {
+      for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+        result.nulls[row_id] = left.nulls[row_id] | right.nulls[row_id];
+      }
+    } else if (left.nullable || right.nullable) {
+      const auto& nulls = left.nullable ? left.nulls : right.nulls;
+      std::copy_n(nulls.cbegin(), row_count, result.nulls.begin());
+    }
+    result.nullable = left.nullable || right.nullable;
+  }
+}
+
+// Returns nullptr if the functor does not support the operand types or if the result type differs from the data type
+// of the expression
+template <typename Functor, bool functor_based_null_logic, typename ResultType>
+Kernel resolve_kernel(const AbstractExpression& left, const AbstractExpression& right,
+                      const DataType result_data_type) {
+  auto kernel = Kernel{nullptr};
+  resolve_data_type(left.data_type(), [&](const auto left_data_type_t) {
+    using Left = typename decltype(left_data_type_t)::type;
+
+    resolve_data_type(right.data_type(), [&](const auto right_data_type_t) {
+      using Right = typename decltype(right_data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<Left> && std::is_arithmetic_v<Right>) {
+        using Result = typename ResultType::template type<Left, Right>;
+
+        if constexpr (Functor::template supports<Result, Left, Right>::value) {
+          if (data_type_from_type<Result>() == result_data_type) {
+            kernel = &evaluate_block<Functor, functor_based_null_logic, Result, Left, Right>;
+          }
+        }
+      }
+    });
+  });
+  return kernel;
+}
+
+// Makes the values and nulls of an input available to the kernels
+template <typename T>
+void load_block(Register& input_register, const BaseExpressionResult& base_input_result, const size_t begin,
+                const size_t row_count) {
+  const auto& input_result = static_cast<const ExpressionResult<T>&>(base_input_result);
+
+  if (input_result.is_literal()) {
+    // Literals are broadcast once and remain in the register for all blocks
+    if (begin > 0) return;
+
+    auto& buffer = std::get<std::vector<T>>(input_register.buffer);
+    buffer.assign(CompiledExpression::BLOCK_SIZE, input_result.values.front());
+    input_register.values = buffer.data();
+    input_register.nullable = input_result.is_null(0);
+    std::fill(input_register.nulls.begin(), input_register.nulls.end(), input_register.nullable);
+    return;
+  }
+
+  input_register.values = input_result.values.data() + begin;
+  input_register.nullable = input_result.is_nullable() && (input_result.nulls.size() > 1 || input_result.nulls[0]);
+  if (!input_register.nullable) return;
+
+  if (input_result.nulls.size() == 1) {
+    std::fill_n(input_register.nulls.begin(), row_count, true);
+  } else {
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      input_register.nulls[row_id] = input_result.nulls[begin + row_id];
+    }
+  }
+}
+
+// Programs are cached per expression and the precomputed subexpressions that occur in it
+using ProgramKey = std::pair<std::shared_ptr<const AbstractExpression>, std::vector<std::shared_ptr<AbstractExpression>>>;
+
+struct ProgramKeyHash {
+  size_t operator()(const ProgramKey& key) const {
+    auto hash = key.first->hash();
+    for (const auto& precomputed_subexpression : key.second) {
+      boost::hash_combine(hash, precomputed_subexpression->hash());
+    }
+    return hash;
+  }
+};
+
+struct ProgramKeyEqual {
+  bool operator()(const ProgramKey& lhs, const ProgramKey& rhs) const {
+    return *lhs.first == *rhs.first && expressions_equal(lhs.second, rhs.second);
+  }
+};
+
+std::shared_mutex compiled_expressions_mutex;
+std::unordered_map<ProgramKey, std::shared_ptr<const CompiledExpression>, ProgramKeyHash, ProgramKeyEqual>
+    compiled_expressions;
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const CompiledExpression> CompiledExpression::compile(
+    const AbstractExpression& expression, const ExpressionUnorderedSet& precomputed_subexpressions) {
+  if (expression.type != ExpressionType::Arithmetic && expression.type != ExpressionType::Logical &&
+      expression.type != ExpressionType::Predicate) {
+    return nullptr;
+  }
+
+  const auto expression_ptr = std::const_pointer_cast<AbstractExpression>(expression.shared_from_this());
+
+  // Parameters are part of the expression's equality, but take a different value for every row of the outer query.
+  // Subqueries would keep their PQPs alive. Therefore, programs of expressions with either of them are not cached.
+  auto cacheable = true;
+  auto program_key = ProgramKey{expression_ptr, {}};
+  visit_expression(expression_ptr, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::CorrelatedParameter ||
+        sub_expression->type == ExpressionType::PQPSubquery) {
+      cacheable = false;
+    }
+    // The root is not an input of its own program
+    if (sub_expression != expression_ptr && precomputed_subexpressions.contains(sub_expression)) {
+      program_key.second.emplace_back(sub_expression);
+    }
+    return ExpressionVisitation::VisitArguments;
+  });
+
+  const auto contained_precomputed_subexpressions =
+      ExpressionUnorderedSet{program_key.second.begin(), program_key.second.end()};
+
+  if (cacheable) {
+    std::shared_lock<std::shared_mutex> lock(compiled_expressions_mutex);
+    const auto compiled_expression_iter = compiled_expressions.find(program_key);
+    if (compiled_expression_iter != compiled_expressions.end()) return compiled_expression_iter->second;
+  }
+
+  // The constructor is private, so std::make_shared cannot be used
+  auto compiled_expression = std::shared_ptr<CompiledExpression>(new CompiledExpression{});
+  auto expression_registers = ExpressionUnorderedMap<size_t>{};
+  compiled_expression->_compile(expression_ptr, contained_precomputed_subexpressions, expression_registers);
+  if (compiled_expression->_instructions.size() < MIN_FUSED_NODE_COUNT) compiled_expression = nullptr;
+
+  if (cacheable) {
+    // Expressions that cannot be compiled are cached as well, so that they are not analyzed again
+    std::unique_lock<std::shared_mutex> lock(compiled_expressions_mutex);
+    if (compiled_expressions.size() >= MAX_CACHED_PROGRAM_COUNT) compiled_expressions.clear();
+    compiled_expressions.emplace(std::move(program_key), compiled_expression);
+  }
+
+  return compiled_expression;
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& CompiledExpression::inputs() const { return _inputs; }
+
+std::shared_ptr<BaseExpressionResult> CompiledExpression::evaluate(
+    const std::vector<std::shared_ptr<BaseExpressionResult>>& input_results,
+    const PolymorphicAllocator<size_t>& allocator) const {
+  Assert(input_results.size() == _inputs.size(), "Expected one result per input");
+
+  auto registers = std::vector<Register>(_register_data_types.size());
+  for (auto register_id = size_t{0}; register_id < registers.size(); ++register_id) {
+    auto& current_register = registers[register_id];
+    current_register.nulls.resize(BLOCK_SIZE);
+
+    resolve_data_type(_register_data_types[register_id], [&](const auto data_type_t) {
+      using RegisterDataType = typename decltype(data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<RegisterDataType>) {
+        current_register.buffer = std::vector<RegisterDataType>{};
+      } else {
+        Fail("Only numeric expressions can be compiled");
+      }
+    });
+  }
+
+  for (const auto& instruction : _instructions) {
+    auto& result_register = registers[instruction.result_register];
+    std::visit(
+        [&](auto& buffer) {
+          buffer.resize(BLOCK_SIZE);
+          result_register.values = buffer.data();
+          result_register.output = buffer.data();
+        },
+        result_register.buffer);
+  }
+
+  // Literals have a single row, series have one row per row of the chunk
+  auto input_loaders = std::vector<void (*)(Register&, const BaseExpressionResult&, const size_t, const size_t)>{};
+  auto row_count = size_t{1};
+  for (auto input_id = size_t{0}; input_id < _inputs.size(); ++input_id) {
+    resolve_data_type(_inputs[input_id]->data_type(), [&](const auto data_type_t) {
+      using InputDataType = typename decltype(data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<InputDataType>) {
+        const auto& input_result = static_cast<const ExpressionResult<InputDataType>&>(*input_results[input_id]);
+        if (!input_result.is_literal()) row_count = input_result.size();
+        input_loaders.emplace_back(&load_block<InputDataType>);
+      }
+    });
+  }
+
+  // The root of the expression is compiled last
+  const auto root_register_id = _instructions.back().result_register;
+  const auto& root_register = registers[root_register_id];
+
+  auto result = std::shared_ptr<BaseExpressionResult>{};
+  resolve_data_type(_register_data_types[root_register_id], [&](const auto data_type_t) {
+    using Result = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_arithmetic_v<Result>) {
+      auto values = pmr_vector<Result>(row_count, allocator);
+      auto nulls = NullBitmap(allocator);
+
+      for (auto begin = size_t{0}; begin < row_count; begin += BLOCK_SIZE) {
+        const auto block_row_count = std::min(BLOCK_SIZE, row_count - begin);
+
+        for (auto input_id = size_t{0}; input_id < _inputs.size(); ++input_id) {
+          input_loaders[input_id](registers[_input_registers[input_id]], *input_results[input_id], begin,
+                                  block_row_count);
+        }
+
+        registers[root_register_id].output = values.data() + begin;
+        for (const auto& instruction : _instructions) {
+          instruction.kernel(registers[instruction.result_register], registers[instruction.left_register],
+                             registers[instruction.right_register], block_row_count);
+        }
+
+        if (root_register.nullable) {
+          nulls.resize(row_count);
+          for (auto row_id = size_t{0}; row_id < block_row_count; ++row_id) {
+            nulls[begin + row_id] = root_register.nulls[row_id];
+          }
+        }
+      }
+
+      result = std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+    }
+  });
+
+  return result;
+}
+
+size_t CompiledExpression::_compile(const std::shared_ptr<AbstractExpression>& expression,
+                                    const ExpressionUnorderedSet& precomputed_subexpressions,
+                                    ExpressionUnorderedMap<size_t>& expression_registers) {
+  const auto expression_register_iter = expression_registers.find(expression);
+  if (expression_register_iter != expression_registers.end()) return expression_register_iter->second;
+
+  auto kernel = Kernel{nullptr};
+  auto left = std::shared_ptr<AbstractExpression>{};
+  auto right = std::shared_ptr<AbstractExpression>{};
+
+  // Only binary expressions are fused. Their arguments are checked first, as, e.g., the arguments of an IN expression
+  // can be lists, which do not have a data type.
+  const auto is_fusable_type = expression->type == ExpressionType::Arithmetic ||
+                               expression->type == ExpressionType::Logical ||
+                               (expression->type == ExpressionType::Predicate &&
+                                is_binary_numeric_predicate_condition(
+                                    static_cast<const AbstractPredicateExpression&>(*expression).predicate_condition));
+  if (is_fusable_type && !precomputed_subexpressions.contains(expression) && expression->arguments.size() == 2 &&
+      is_numeric_data_type(expression->arguments[0]->data_type()) &&
+      is_numeric_data_type(expression->arguments[1]->data_type())) {
+    left = expression->arguments[0];
+    right = expression->arguments[1];
+    const auto data_type = expression->data_type();
+
+    switch (expression->type) {
+      case ExpressionType::Arithmetic: {
+        // clang-format off
+        switch (static_cast<const ArithmeticExpression&>(*expression).arithmetic_operator) {
+          case ArithmeticOperator::Addition:       kernel = resolve_kernel<AdditionEvaluator, false, ArithmeticResultType>(*left, *right, data_type); break;  // NOLINT
+          case ArithmeticOperator::Subtraction:    kernel = resolve_kernel<SubtractionEvaluator, false, ArithmeticResultType>(*left, *right, data_type); break;  // NOLINT
+          case ArithmeticOperator::Multiplication: kernel = resolve_kernel<MultiplicationEvaluator, false, ArithmeticResultType>(*left, *right, data_type); break;  // NOLINT
+          case ArithmeticOperator::Division:       kernel = resolve_kernel<DivisionEvaluator, true, ArithmeticResultType>(*left, *right, data_type); break;  // NOLINT
+          case ArithmeticOperator::Modulo:         kernel = resolve_kernel<ModuloEvaluator, true, ArithmeticResultType>(*left, *right, data_type); break;  // NOLINT
+        }
+        // clang-format on
+      } break;
+
+      case ExpressionType::Predicate: {
+        // As in the ExpressionEvaluator, > and >= are flipped to < and <= to reduce the number of template
+        // instantiations
+        auto predicate_condition = static_cast<const AbstractPredicateExpression&>(*expression).predicate_condition;
+        if (predicate_condition == PredicateCondition::GreaterThan ||
+            predicate_condition == PredicateCondition::GreaterThanEquals) {
+          predicate_condition = flip_predicate_condition(predicate_condition);
+          std::swap(left, right);
+        }
+
+        // clang-format off
+        switch (predicate_condition) {
+          case PredicateCondition::Equals:         kernel = resolve_kernel<EqualsEvaluator, false, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+          case PredicateCondition::NotEquals:      kernel = resolve_kernel<NotEqualsEvaluator, false, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+          case PredicateCondition::LessThan:       kernel = resolve_kernel<LessThanEvaluator, false, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+          case PredicateCondition::LessThanEquals: kernel = resolve_kernel<LessThanEqualsEvaluator, false, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+          default: break;
+        }
+        // clang-format on
+      } break;
+
+      case ExpressionType::Logical: {
+        // clang-format off
+        switch (static_cast<const LogicalExpression&>(*expression).logical_operator) {
+          case LogicalOperator::And: kernel = resolve_kernel<TernaryAndEvaluator, true, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+          case LogicalOperator::Or:  kernel = resolve_kernel<TernaryOrEvaluator, true, BoolResultType>(*left, *right, data_type); break;  // NOLINT
+        }
+        // clang-format on
+      } break;
+
+      default:
+        break;
+    }
+  }
+
+  const auto result_register = _add_register(expression->data_type());
+  if (kernel) {
+    const auto left_register = _compile(left, precomputed_subexpressions, expression_registers);
+    const auto right_register = _compile(right, precomputed_subexpressions, expression_registers);
+    _instructions.emplace_back(Instruction{kernel, result_register, left_register, right_register});
+  } else {
+    _inputs.emplace_back(expression);
+    _input_registers.emplace_back(result_register);
+  }
+
+  expression_registers.emplace(expression, result_register);
+  return result_register;
+}
+
+size_t CompiledExpression::_add_register(const DataType data_type) {
+  _register_data_types.emplace_back(data_type);
+  return _register_data_types.size() - 1;
+}
+
+}  // namespace opossum
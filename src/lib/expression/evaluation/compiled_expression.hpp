@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression_result.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Evaluates trees of arithmetic, comparison, and logical expressions over numeric operands in a single pass, instead
+ * of materializing an ExpressionResult for every node of the tree as the ExpressionEvaluator does. Used by the
+ * ExpressionEvaluator, e.g., for `SELECT a * (1 - b) * (1 + c) ...` or `WHERE a + b > c AND d * 2 < e`.
+ *
+ * compile() translates the tree into a program of kernels. Each kernel evaluates one node and is chosen from templates
+ * that are instantiated for all operators and operand types, so no code is generated at runtime. All other
+ * expressions (columns, values, and everything that cannot be fused, e.g., CASE or string comparisons) become the
+ * inputs of the program and are evaluated by the ExpressionEvaluator. The program is executed for blocks of
+ * BLOCK_SIZE rows, so that the intermediate results of the nodes remain in the CPU cache and are reused for every
+ * block. Identical subexpressions, like in `(a + 3) * (a + 3)`, are evaluated once.
+ *
+ * Subexpressions that are shared with other expressions evaluated on the same chunk, like `a * (1 - b)` in TPC-H Q1's
+ * `SUM(a * (1 - b))` and `SUM(a * (1 - b) * (1 + c))`, can be passed as precomputed subexpressions. They become inputs
+ * of the program, so that the ExpressionEvaluator computes them once and shares their result via its cache.
+ *
+ * Programs only depend on the expression and the precomputed subexpressions it contains, so that they are cached
+ * across chunks and queries.
+ */
+class CompiledExpression final {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{1024};
+
+  // Trees with a single fusable node are evaluated as fast by the ExpressionEvaluator itself
+  static constexpr auto MIN_FUSED_NODE_COUNT = size_t{2};
+
+  // Bounds the number of cached programs. The cache is cleared when it is exceeded.
+  static constexpr auto MAX_CACHED_PROGRAM_COUNT = size_t{1024};
+
+  // Returns nullptr if the expression does not consist of at least MIN_FUSED_NODE_COUNT fusable nodes. The root of the
+  // expression is compiled even if it is one of the precomputed subexpressions.
+  static std::shared_ptr<const CompiledExpression> compile(
+      const AbstractExpression& expression, const ExpressionUnorderedSet& precomputed_subexpressions = {});
+
+  // The expressions whose results evaluate() expects
+  const std::vector<std::shared_ptr<AbstractExpression>>& inputs() const;
+
+  // Expects an ExpressionResult<T> with the data type of the input for each input. Returns an ExpressionResult<T>
+  // with the data type of the compiled expression, whose vectors are allocated with the given allocator.
+  std::shared_ptr<BaseExpressionResult> evaluate(
+      const std::vector<std::shared_ptr<BaseExpressionResult>>& input_results,
+      const PolymorphicAllocator<size_t>& allocator = {}) const;
+
+  /**
+   * The values and nulls of an input or of a node for the current block. Kernels write the values of the root node
+   * directly into the output.
+   */
+  struct Register {
+    std::variant<std::vector<int32_t>, std::vector<int64_t>, std::vector<float>, std::vector<double>> buffer;
+    std::vector<uint8_t> nulls;
+
+    const void* values{nullptr};
+    void* output{nullptr};
+    bool nullable{false};
+  };
+
+  using Kernel = void (*)(Register& result, const Register& left, const Register& right, const size_t row_count);
+
+ private:
+  CompiledExpression() = default;
+
+  // Returns the register that holds the result of the expression. Identical subexpressions share their register.
+  size_t _compile(const std::shared_ptr<AbstractExpression>& expression,
+                  const ExpressionUnorderedSet& precomputed_subexpressions,
+                  ExpressionUnorderedMap<size_t>& expression_registers);
+
+  size_t _add_register(const DataType data_type);
+
+  struct Instruction {
+    Kernel kernel;
+    size_t result_register;
+    size_t left_register;
+    size_t right_register;
+  };
+
+  std::vector<std::shared_ptr<AbstractExpression>> _inputs;
+  std::vector<size_t> _input_registers;
+
+  std::vector<Instruction> _instructions;
+  std::vector<DataType> _register_data_types;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 
@@ -7,6 +8,7 @@
 #include <boost/variant/apply_visitor.hpp>
 
 #include "all_parameter_variant.hpp"
+#include "compiled_expression.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
@@ -30,9 +32,15 @@
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_gather.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 #include "utils/performance_warning.hpp"
 
 using namespace std::string_literals;            // NOLINT
@@ -65,6 +73,88 @@ void resolve_binary_predicate_evaluator(const PredicateCondition predicate_condi
   // clang-format on
 }
 
+// Returns true if the expression consists only of functions, casts, extracts, and constants, and references no other
+// column than @param column (which is set when the first column is found). Such expressions return NULL if the column
+// is NULL and can be evaluated once per dictionary entry (see ExpressionEvaluator::_evaluate_on_dictionary()).
+bool is_dictionary_evaluable(const std::shared_ptr<AbstractExpression>& expression,
+                             std::shared_ptr<AbstractExpression>& column) {
+  switch (expression->type) {
+    case ExpressionType::PQPColumn:
+      if (column && *column != *expression) return false;
+      column = expression;
+      return true;
+
+    case ExpressionType::Value:
+    case ExpressionType::CorrelatedParameter:
+      return true;
+
+    case ExpressionType::Function:
+    case ExpressionType::Cast:
+    case ExpressionType::Extract:
+      return std::all_of(expression->arguments.cbegin(), expression->arguments.cend(),
+                         [&](const auto& argument) { return is_dictionary_evaluable(argument, column); });
+
+    default:
+      return false;
+  }
+}
+
+// Subqueries, LIKEs, INs, and functions are expensive to evaluate for each row. Operands of ANDs and ORs and branches
+// of CASEs that contain them are only evaluated for the rows that need them (see evaluates_lazily()).
+bool is_expensive_to_evaluate(const std::shared_ptr<AbstractExpression>& expression) {
+  auto is_expensive = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      case ExpressionType::PQPSubquery:
+      case ExpressionType::Exists:
+      case ExpressionType::Function:
+        is_expensive = true;
+        break;
+
+      case ExpressionType::Predicate: {
+        const auto predicate_condition =
+            static_cast<const AbstractPredicateExpression&>(*sub_expression).predicate_condition;
+        is_expensive =
+            predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike ||
+            predicate_condition == PredicateCondition::In || predicate_condition == PredicateCondition::NotIn;
+      } break;
+
+      default:
+        break;
+    }
+
+    return is_expensive ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return is_expensive;
+}
+
+// Returns true for ANDs and ORs with an expensive operand and CASEs with an expensive branch. Instead of computing the
+// expensive operand or branch for all rows, the evaluator only computes it for the rows that the other operand or the
+// condition leave undecided. Such expressions are not compiled, as CompiledExpressions evaluate their inputs for all
+// rows.
+bool evaluates_lazily(const AbstractExpression& expression) {
+  if (expression.type == ExpressionType::Logical) {
+    return is_expensive_to_evaluate(expression.arguments[0]) || is_expensive_to_evaluate(expression.arguments[1]);
+  }
+
+  if (expression.type == ExpressionType::Case) {
+    const auto& case_expression = static_cast<const CaseExpression&>(expression);
+    return is_expensive_to_evaluate(case_expression.then()) || is_expensive_to_evaluate(case_expression.otherwise());
+  }
+
+  return false;
+}
+
+// AND and OR are commutative in SQL's ternary logic. Returns the operands of @param logical_expression so that the
+// second one is the expensive one.
+std::pair<std::shared_ptr<AbstractExpression>, std::shared_ptr<AbstractExpression>> order_logical_operands(
+    const LogicalExpression& logical_expression) {
+  const auto& left = logical_expression.left_operand();
+  const auto& right = logical_expression.right_operand();
+  if (is_expensive_to_evaluate(left) && !is_expensive_to_evaluate(right)) return {right, left};
+  return {left, right};
+}
+
 std::shared_ptr<AbstractExpression> rewrite_between_expression(const AbstractExpression& expression) {
   // `a BETWEEN b AND c` --> `a >= b AND a <= c`
   //
@@ -139,18 +229,81 @@ namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
-    : _table(table),
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const std::shared_ptr<CorrelatedSubqueryResults>& correlated_subquery_results,
+    const std::shared_ptr<boost::container::pmr::memory_resource>& upstream_memory_resource)
+    : _upstream_memory_resource(upstream_memory_resource),
+      _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
-      _uncorrelated_subquery_results(uncorrelated_subquery_results) {
+      _uncorrelated_subquery_results(uncorrelated_subquery_results),
+      _correlated_subquery_results(correlated_subquery_results) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
+
+  // The first buffer fits the materialization of a (numeric) segment, the following ones grow geometrically
+  _memory_resource = std::make_shared<boost::container::pmr::monotonic_buffer_resource>(
+      std::max(_output_row_count * sizeof(int64_t), MIN_MEMORY_RESOURCE_BUFFER_SIZE),
+      _upstream_memory_resource ? _upstream_memory_resource.get() : boost::container::pmr::get_default_resource());
+  _allocator = PolymorphicAllocator<size_t>{_memory_resource.get()};
+}
+
+ExpressionEvaluator::ExpressionEvaluator(ExpressionEvaluator& evaluator,
+                                         const std::shared_ptr<const RowIDPosList>& rows)
+    : _upstream_memory_resource(evaluator._upstream_memory_resource),
+      _memory_resource(evaluator._memory_resource),
+      _allocator(evaluator._allocator),
+      _table(evaluator._table),
+      _chunk(evaluator._chunk),
+      _chunk_id(evaluator._chunk_id),
+      _output_row_count(rows->size()),
+      _rows(rows),
+      _uncorrelated_subquery_results(evaluator._uncorrelated_subquery_results),
+      _common_subexpressions(evaluator._common_subexpressions) {
+  DebugAssert(_chunk, "Expected an evaluator that operates on a chunk");
+  DebugAssert(rows->references_single_chunk() && std::is_sorted(rows->cbegin(), rows->cend()),
+              "Expected sorted rows of a single chunk");
+  _segment_materializations.resize(_chunk->column_count());
+
+  // If the evaluator operates on a subset of the rows itself, the rows are positions in that subset
+  if (evaluator._rows) {
+    auto chunk_rows = std::make_shared<RowIDPosList>();
+    chunk_rows->reserve(rows->size());
+    for (const auto& row : *rows) {
+      chunk_rows->emplace_back((*evaluator._rows)[row.chunk_offset]);
+    }
+    chunk_rows->guarantee_single_chunk();
+    _rows = std::move(chunk_rows);
+  }
+
+  // Share the memoized results of correlated subqueries with the evaluator for all rows
+  if (!evaluator._correlated_subquery_results) {
+    evaluator._correlated_subquery_results = std::make_shared<CorrelatedSubqueryResults>();
+  }
+  _correlated_subquery_results = evaluator._correlated_subquery_results;
 }
 
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  auto result = _evaluate_expression_to_result<Result>(expression);
+  if (!_memory_resource) return result;
+
+  // The result (or the ExpressionResults it was computed from) might be allocated from the evaluator's memory resource.
+  // The returned pointer keeps the memory resource alive until the result is released, even if the evaluator is gone.
+  // The result is released first, so that its vectors are not deallocated after the memory resource was destroyed.
+  // Likewise, the memory resource returns its buffers before the upstream resource is released.
+  return std::shared_ptr<ExpressionResult<Result>>(
+      result.get(), [result, memory_resource = _memory_resource, upstream_memory_resource = _upstream_memory_resource](
+                        const ExpressionResult<Result>* /* ptr */) mutable {
+        result.reset();
+        memory_resource.reset();
+      });
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result(
+    const AbstractExpression& expression) {
   // First, look in the cache
   const auto expression_ptr = expression.shared_from_this();
   const auto cached_result_iter = _cached_expression_results.find(expression_ptr);
@@ -161,6 +314,32 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
   // Ok, we have to actually work...
   auto result = std::shared_ptr<ExpressionResult<Result>>{};
 
+  // Trees of arithmetic, comparison, and logical expressions are evaluated in a single pass without materializing the
+  // result of every node (see compiled_expression.hpp)
+  if constexpr (std::is_arithmetic_v<Result>) {
+    if (_chunk && expression.data_type() == data_type_from_type<Result>() && !evaluates_lazily(expression)) {
+      const auto compiled_expression =
+          _common_subexpressions ? CompiledExpression::compile(expression, *_common_subexpressions)
+                                 : CompiledExpression::compile(expression);
+      if (compiled_expression) {
+        const auto compiled_result = _evaluate_compiled_expression(*compiled_expression);
+        result = std::static_pointer_cast<ExpressionResult<Result>>(compiled_result);
+        _cached_expression_results.insert(cached_result_iter, {expression_ptr, result});
+        return result;
+      }
+    }
+  }
+
+  // Functions of a single dictionary-encoded column are evaluated once per dictionary entry. This yields a result
+  // for every row of the chunk, so evaluators for a subset of the rows do not use it.
+  if (_chunk && !_rows && (expression.type == ExpressionType::Function || expression.type == ExpressionType::Cast ||
+                 expression.type == ExpressionType::Extract)) {
+    if (const auto dictionary_result = _evaluate_on_dictionary<Result>(expression)) {
+      _cached_expression_results.insert(cached_result_iter, {expression_ptr, dictionary_result});
+      return dictionary_result;
+    }
+  }
+
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       result = _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -216,6 +395,9 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
     case ExpressionType::Aggregate:
       Fail("ExpressionEvaluator doesn't support Aggregates, use the Aggregate Operator to compute them");
 
+    case ExpressionType::WindowFunction:
+      Fail("ExpressionEvaluator doesn't support window functions, use the Window operator to compute them");
+
     case ExpressionType::List:
       Fail("Can't evaluate a ListExpression, lists should only appear as the right operand of an InExpression");
 
@@ -235,6 +417,20 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
   return std::static_pointer_cast<ExpressionResult<Result>>(result);
 }
 
+std::shared_ptr<BaseExpressionResult> ExpressionEvaluator::_evaluate_compiled_expression(
+    const CompiledExpression& compiled_expression) {
+  auto input_results = std::vector<std::shared_ptr<BaseExpressionResult>>{};
+  input_results.reserve(compiled_expression.inputs().size());
+  for (const auto& input : compiled_expression.inputs()) {
+    resolve_data_type(input->data_type(), [&](const auto data_type_t) {
+      using InputDataType = typename decltype(data_type_t)::type;
+      input_results.emplace_back(_evaluate_expression_to_result<InputDataType>(*input));
+    });
+  }
+
+  return compiled_expression.evaluate(input_results, _allocator);
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_arithmetic_expression(
     const ArithmeticExpression& expression) {
@@ -297,13 +493,13 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
              expression.predicate_condition == PredicateCondition::NotLike,
          "Expected PredicateCondition Like or NotLike");
 
-  const auto left_results = evaluate_expression_to_result<pmr_string>(*expression.left_operand());
-  const auto right_results = evaluate_expression_to_result<pmr_string>(*expression.right_operand());
+  const auto left_results = _evaluate_expression_to_result<pmr_string>(*expression.left_operand());
+  const auto right_results = _evaluate_expression_to_result<pmr_string>(*expression.right_operand());
 
   const auto invert_results = expression.predicate_condition == PredicateCondition::NotLike;
 
   const auto result_size = _result_size(left_results->size(), right_results->size());
-  auto result_values = pmr_vector<ExpressionEvaluator::Bool>(result_size, 0);
+  auto result_values = pmr_vector<ExpressionEvaluator::Bool>(result_size, 0, _allocator);
 
   /**
    * Three different kinds of LIKE are considered for performance reasons and avoid redundant creation of the
@@ -338,7 +534,7 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
     }
   }
 
-  auto result_nulls = _evaluate_default_null_logic(left_results->nulls, right_results->nulls);
+  auto result_nulls = _evaluate_default_null_logic(left_results->nulls, right_results->nulls, _allocator);
 
   return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::move(result_values),
                                                                        std::move(result_nulls));
@@ -353,7 +549,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_like_ex
 template <>
 std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
 ExpressionEvaluator::_evaluate_is_null_expression<ExpressionEvaluator::Bool>(const IsNullExpression& expression) {
-  pmr_vector<ExpressionEvaluator::Bool> result_values;
+  pmr_vector<ExpressionEvaluator::Bool> result_values(_allocator);
 
   _resolve_to_expression_result_view(*expression.operand(), [&](const auto& view) {
     result_values.resize(view.size());
@@ -384,8 +580,8 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
   const auto& left_expression = *in_expression.value();
   const auto& right_expression = *in_expression.set();
 
-  pmr_vector<ExpressionEvaluator::Bool> result_values;
-  pmr_vector<bool> result_nulls;
+  pmr_vector<ExpressionEvaluator::Bool> result_values(_allocator);
+  NullBitmap result_nulls(_allocator);
 
   if (right_expression.type == ExpressionType::List) {
     const auto& list_expression = static_cast<const ListExpression&>(right_expression);
@@ -399,7 +595,7 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
     if (left_expression.data_type() == DataType::Null) {
       // `NULL [NOT] IN ...` is NULL
       return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(pmr_vector<ExpressionEvaluator::Bool>{0},
-                                                                           pmr_vector<bool>{true});
+                                                                           NullBitmap{true});
     }
 
     /**
@@ -483,7 +679,7 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
     PerformanceWarning("Using slow path for IN expression");
 
     // Nope, it is a list with diverse types - falling back to rewrite of expression:
-    return evaluate_expression_to_result<ExpressionEvaluator::Bool>(*rewrite_in_list_expression(in_expression));
+    return _evaluate_expression_to_result<ExpressionEvaluator::Bool>(*rewrite_in_list_expression(in_expression));
 
   } else if (right_expression.type == ExpressionType::PQPSubquery) {
     const auto* subquery_expression = dynamic_cast<const PQPSubqueryExpression*>(&right_expression);
@@ -587,7 +783,7 @@ ExpressionEvaluator::_evaluate_predicate_expression<ExpressionEvaluator::Bool>(
     case PredicateCondition::BetweenLowerExclusive:
     case PredicateCondition::BetweenUpperExclusive:
     case PredicateCondition::BetweenExclusive:
-      return evaluate_expression_to_result<ExpressionEvaluator::Bool>(
+      return _evaluate_expression_to_result<ExpressionEvaluator::Bool>(
           *rewrite_between_expression(predicate_expression));
 
     case PredicateCondition::In:
@@ -628,10 +824,14 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_column_
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_expression(
     const CaseExpression& case_expression) {
-  const auto when = evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
+  const auto when = _evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
+
+  if (_chunk && evaluates_lazily(case_expression)) {
+    return _evaluate_case_expression_lazily<Result>(case_expression, *when);
+  }
 
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  pmr_vector<Result> values(_allocator);
+  NullBitmap nulls(_allocator);
 
   _resolve_to_expression_results(
       *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
@@ -661,6 +861,59 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
   return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
 }
 
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_expression_lazily(
+    const CaseExpression& case_expression, const ExpressionResult<ExpressionEvaluator::Bool>& when) {
+  auto then_rows = std::make_shared<RowIDPosList>();
+  auto else_rows = std::make_shared<RowIDPosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
+    auto& rows = when.value(chunk_offset) && !when.is_null(chunk_offset) ? then_rows : else_rows;
+    rows->emplace_back(RowID{_chunk_id, chunk_offset});
+  }
+
+  auto values = pmr_vector<Result>(_output_row_count, _allocator);
+  auto nulls = NullBitmap(_output_row_count, false, _allocator);
+
+  const auto evaluate_branch = [&](const std::shared_ptr<AbstractExpression>& branch,
+                                   const std::shared_ptr<RowIDPosList>& rows) {
+    if (rows->empty()) return;
+    rows->guarantee_single_chunk();
+
+    // Writes the result for the rows, which is indexed by the position in the rows or by the chunk offset
+    const auto write_branch_result = [&](ExpressionEvaluator& evaluator, const bool is_evaluated_for_rows) {
+      evaluator._resolve_to_expression_result(*branch, [&](const auto& branch_result) {
+        using BranchDataType = typename std::decay_t<decltype(branch_result)>::Type;
+
+        if constexpr (CaseEvaluator::supports_v<Result, BranchDataType, BranchDataType>) {
+          const auto row_count = rows->size();
+          for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+            const auto chunk_offset = (*rows)[row_idx].chunk_offset;
+            const auto result_idx = is_evaluated_for_rows ? row_idx : size_t{chunk_offset};
+            values[chunk_offset] = to_value<Result>(branch_result.value(result_idx));
+            nulls[chunk_offset] = branch_result.is_null(result_idx);
+          }
+        } else {
+          Fail("Illegal operands for CaseExpression");
+        }
+      });
+    };
+
+    // Cheap branches and branches that all rows take are evaluated for the entire chunk
+    if (rows->size() < _output_row_count && is_expensive_to_evaluate(branch)) {
+      auto evaluator = ExpressionEvaluator{*this, rows};
+      write_branch_result(evaluator, true);
+    } else {
+      write_branch_result(*this, false);
+    }
+  };
+
+  // A nested CASE in the ELSE branch only evaluates its condition for the rows that did not take the THEN branch
+  evaluate_branch(case_expression.then(), then_rows);
+  evaluate_branch(case_expression.otherwise(), else_rows);
+
+  return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_expression(
     const CastExpression& cast_expression) {
@@ -672,8 +925,8 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
    *    NULL -> Any type                    A nulled value of the requested type is returned.
    */
 
-  auto values = pmr_vector<Result>{};
-  auto nulls = pmr_vector<bool>{};
+  auto values = pmr_vector<Result>(_allocator);
+  auto nulls = NullBitmap(_allocator);
 
   _resolve_to_expression_result(*cast_expression.argument(), [&](const auto& argument_result) {
     using ArgumentDataType = typename std::decay_t<decltype(argument_result)>::Type;
@@ -768,7 +1021,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_value_o
     // NullValue can be evaluated to any type - it is then a null value of that type.
     // This makes it easier to implement expressions where a certain data type is expected, but a Null literal is
     // given. Think `CASE NULL THEN ... ELSE ...` - the NULL will be evaluated to be a bool.
-    pmr_vector<bool> nulls{};
+    NullBitmap nulls{};
     nulls.emplace_back(true);
     return std::make_shared<ExpressionResult<Result>>(pmr_vector<Result>{{Result{}}}, nulls);
   } else {
@@ -800,7 +1053,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_functio
 template <>
 std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_extract_expression<pmr_string>(
     const ExtractExpression& extract_expression) {
-  const auto from_result = evaluate_expression_to_result<pmr_string>(*extract_expression.from());
+  const auto from_result = _evaluate_expression_to_result<pmr_string>(*extract_expression.from());
 
   switch (extract_expression.datetime_component) {
     case DatetimeComponent::Year:
@@ -821,7 +1074,63 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_ext
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_extract_expression(
     const ExtractExpression& extract_expression) {
-  Fail("Only Strings (YYYY-MM-DD) supported for Dates right now");
+  if constexpr (std::is_same_v<Result, int32_t>) {
+    pmr_vector<int32_t> values(_allocator);
+    NullBitmap nulls(_allocator);
+
+    _resolve_to_expression_result(*extract_expression.from(), [&](const auto& from_result) {
+      using FromType = typename std::decay_t<decltype(from_result)>::Type;
+
+      if constexpr (std::is_same_v<FromType, int32_t> || std::is_same_v<FromType, int64_t>) {
+        const auto row_count = from_result.size();
+        values.resize(row_count);
+        nulls = from_result.nulls;
+
+        // Resolve the component outside of the loop, so that the loop only computes integer arithmetic
+        const auto extract = [&](const auto& extract_component) {
+          for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+            // DATEs are the days since 1970-01-01, TIMESTAMPs the seconds since 1970-01-01 00:00:00
+            if constexpr (std::is_same_v<FromType, int32_t>) {
+              values[row_id] = extract_component(from_result.values[row_id], int64_t{0});
+            } else {
+              const auto timestamp = from_result.values[row_id];
+              const auto days = days_from_timestamp(timestamp);
+              values[row_id] = extract_component(days, timestamp - days * SECONDS_PER_DAY);
+            }
+          }
+        };
+
+        switch (extract_expression.datetime_component) {
+          case DatetimeComponent::Year:
+            extract([](const int32_t days, const int64_t) { return civil_from_days(days).year; });
+            break;
+          case DatetimeComponent::Month:
+            extract([](const int32_t days, const int64_t) {
+              return static_cast<int32_t>(civil_from_days(days).month);
+            });
+            break;
+          case DatetimeComponent::Day:
+            extract([](const int32_t days, const int64_t) { return static_cast<int32_t>(civil_from_days(days).day); });
+            break;
+          case DatetimeComponent::Hour:
+            extract([](const int32_t, const int64_t seconds) { return static_cast<int32_t>(seconds / 3600); });
+            break;
+          case DatetimeComponent::Minute:
+            extract([](const int32_t, const int64_t seconds) { return static_cast<int32_t>(seconds / 60 % 60); });
+            break;
+          case DatetimeComponent::Second:
+            extract([](const int32_t, const int64_t seconds) { return static_cast<int32_t>(seconds % 60); });
+            break;
+        }
+      } else {
+        Fail("EXTRACT requires a String (YYYY-MM-DD), an Int (DATE), or a Long (TIMESTAMP)");
+      }
+    });
+
+    return std::make_shared<ExpressionResult<int32_t>>(std::move(values), std::move(nulls));
+  } else {
+    Fail("Only Strings (YYYY-MM-DD) and Ints are supported as results of EXTRACT");
+  }
 }
 
 template <size_t offset, size_t count>
@@ -829,7 +1138,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_ext
     const ExpressionResult<pmr_string>& from_result) {
   std::shared_ptr<ExpressionResult<pmr_string>> result;
 
-  pmr_vector<pmr_string> values(from_result.size());
+  pmr_vector<pmr_string> values(from_result.size(), _allocator);
 
   from_result.as_view([&](const auto& from_view) {
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(from_view.size());
@@ -848,8 +1157,8 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_ext
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_unary_minus_expression(
     const UnaryMinusExpression& unary_minus_expression) {
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  pmr_vector<Result> values(_allocator);
+  NullBitmap nulls(_allocator);
 
   _resolve_to_expression_result(*unary_minus_expression.argument(), [&](const auto& argument_result) {
     using ArgumentType = typename std::decay_t<decltype(argument_result)>::Type;
@@ -880,7 +1189,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_subquer
   const auto subquery_results = _prune_tables_to_expression_results<Result>(subquery_result_tables);
 
   pmr_vector<Result> result_values(subquery_results.size());
-  pmr_vector<bool> result_nulls;
+  NullBitmap result_nulls;
 
   // Materialize values
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(subquery_results.size());
@@ -926,15 +1235,62 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquer
     _materialize_segment_if_not_yet_materialized(parameter.second);
   }
 
+  if (!_correlated_subquery_results) _correlated_subquery_results = std::make_shared<CorrelatedSubqueryResults>();
+
   std::vector<std::shared_ptr<const Table>> results(_output_row_count);
+  auto parameter_values = std::vector<AllTypeVariant>(expression.parameters.size());
 
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
-    results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
+    for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
+      const auto column_id = expression.parameters[parameter_idx].second;
+      parameter_values[parameter_idx] = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+    }
+
+    // Rows with the same parameter values share the result
+    results[chunk_offset] = _correlated_subquery_results->get(expression.pqp, parameter_values);
+    if (!results[chunk_offset]) {
+      results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
+      _correlated_subquery_results->set(expression.pqp, parameter_values, results[chunk_offset]);
+    }
   }
 
   return results;
 }
 
+std::shared_ptr<const Table> ExpressionEvaluator::CorrelatedSubqueryResults::get(
+    const std::shared_ptr<AbstractOperator>& pqp, const std::vector<AllTypeVariant>& parameter_values) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto result_iter = _results.find(Key{pqp, parameter_values});
+  return result_iter != _results.cend() ? result_iter->second : nullptr;
+}
+
+void ExpressionEvaluator::CorrelatedSubqueryResults::set(const std::shared_ptr<AbstractOperator>& pqp,
+                                                         const std::vector<AllTypeVariant>& parameter_values,
+                                                         const std::shared_ptr<const Table>& result) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_results.size() >= MAX_RESULT_COUNT) return;
+  _results.try_emplace(Key{pqp, parameter_values}, result);
+}
+
+size_t ExpressionEvaluator::CorrelatedSubqueryResults::KeyHash::operator()(const Key& key) const {
+  auto hash = std::hash<std::shared_ptr<AbstractOperator>>{}(key.first);
+  for (const auto& parameter_value : key.second) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(parameter_value));
+  }
+  return hash;
+}
+
+bool ExpressionEvaluator::CorrelatedSubqueryResults::KeyEqual::operator()(const Key& lhs, const Key& rhs) const {
+  if (lhs.first != rhs.first || lhs.second.size() != rhs.second.size()) return false;
+  for (auto parameter_idx = size_t{0}; parameter_idx < lhs.second.size(); ++parameter_idx) {
+    const auto& left_value = lhs.second[parameter_idx];
+    const auto& right_value = rhs.second[parameter_idx];
+    if (variant_is_null(left_value) && variant_is_null(right_value)) continue;
+    if (variant_is_null(left_value) || variant_is_null(right_value) || !(left_value == right_value)) return false;
+  }
+  return true;
+}
+
 std::shared_ptr<ExpressionEvaluator::UncorrelatedSubqueryResults>
 ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
@@ -956,6 +1312,44 @@ ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(
   return uncorrelated_subquery_results;
 }
 
+std::shared_ptr<ExpressionUnorderedSet> ExpressionEvaluator::find_common_subexpressions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  // Count the expressions in which each subexpression occurs. Repetitions within an expression are already shared by
+  // the cache and the CompiledExpression.
+  auto occurrence_counts = ExpressionUnorderedMap<size_t>{};
+  for (const auto& expression : expressions) {
+    auto subexpressions = ExpressionUnorderedSet{};
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPColumn || sub_expression->type == ExpressionType::Value ||
+          sub_expression->type == ExpressionType::CorrelatedParameter ||
+          sub_expression->type == ExpressionType::PQPSubquery) {
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      if (subexpressions.emplace(sub_expression).second) ++occurrence_counts[sub_expression];
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  auto common_subexpressions = std::make_shared<ExpressionUnorderedSet>();
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      const auto occurrence_count_iter = occurrence_counts.find(sub_expression);
+      if (occurrence_count_iter == occurrence_counts.end()) return ExpressionVisitation::DoNotVisitArguments;
+      if (occurrence_count_iter->second < 2) return ExpressionVisitation::VisitArguments;
+
+      common_subexpressions->emplace(sub_expression);
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  return common_subexpressions;
+}
+
+void ExpressionEvaluator::set_common_subexpressions(
+    const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions) {
+  _common_subexpressions = common_subexpressions;
+}
+
 std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_for_row(
     const PQPSubqueryExpression& expression, const ChunkOffset chunk_offset) {
   Assert(expression.parameters.empty() || _chunk,
@@ -973,6 +1367,16 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
     parameters.emplace(parameter_id, value);
   }
 
+  // Uncorrelated subqueries are looked up in the cache that is shared between operators and executions
+  const auto& subquery_result_cache = Hyrise::get().subquery_result_cache;
+  auto cache_key = std::optional<SQLResultCacheKey>{};
+  if (subquery_result_cache && expression.parameters.empty()) {
+    cache_key = create_subquery_result_cache_key(*expression.pqp);
+    if (cache_key) {
+      if (const auto cached_result = subquery_result_cache->try_get(*cache_key)) return *cached_result;
+    }
+  }
+
   // TODO(moritz) deep_copy() shouldn't be necessary for every row if we could re-execute PQPs...
   auto row_pqp = expression.pqp->deep_copy();
   row_pqp->set_parameters(parameters);
@@ -980,13 +1384,23 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
   const auto tasks = OperatorTask::make_tasks_from_operator(row_pqp);
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
-  return row_pqp->get_output();
+  const auto result = row_pqp->get_output();
+  if (cache_key && result) {
+    const auto result_size = result->memory_usage(MemoryUsageCalculationMode::Sampled);
+    if (result_size <= MAX_CACHED_RESULT_SIZE) {
+      // The key's LQP is copied so that it does not change with the plan that the subquery belongs to
+      cache_key->lqp = cache_key->lqp->deep_copy();
+      subquery_result_cache->set(*cache_key, result, 1.0, static_cast<double>(std::max(result_size, size_t{1})));
+    }
+  }
+
+  return result;
 }
 
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
     const AbstractExpression& expression) {
   std::shared_ptr<BaseValueSegment> segment;
-  pmr_vector<bool> nulls;
+  NullBitmap nulls;
 
   _resolve_to_expression_result_view(expression, [&](const auto& view) {
     using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
@@ -1022,7 +1436,7 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
    * Only Expressions returning a Bool can be evaluated to a PosList of matches.
    *
    * (Not)In and (Not)Like Expressions are evaluated by generating an ExpressionResult of booleans
-   * (evaluate_expression_to_result<>()) which is then scanned for positive entries.
+   * (_evaluate_expression_to_result<>()) which is then scanned for positive entries.
    * TODO(anybody) Add fast implementations for (Not)In and (Not)Like as well.
    *
    * All other Expression types have dedicated, hopefully fast, implementations.
@@ -1030,6 +1444,22 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
 
   auto result_pos_list = RowIDPosList{};
 
+  const auto compiled_expression = evaluates_lazily(expression) ? std::shared_ptr<const CompiledExpression>{}
+                                                                : CompiledExpression::compile(expression);
+  if (compiled_expression) {
+    const auto result = std::static_pointer_cast<ExpressionResult<ExpressionEvaluator::Bool>>(
+        _evaluate_compiled_expression(*compiled_expression));
+    result->as_view([&](const auto& result_view) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
+           ++chunk_offset) {
+        if (result_view.value(chunk_offset) != 0 && !result_view.is_null(chunk_offset)) {
+          result_pos_list.emplace_back(RowID{_chunk_id, chunk_offset});
+        }
+      }
+    });
+    return result_pos_list;
+  }
+
   switch (expression.type) {
     case ExpressionType::Predicate: {
       const auto& predicate_expression = static_cast<const AbstractPredicateExpression&>(expression);
@@ -1112,7 +1542,7 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
           // a) such implementations would require lots of code, there is little potential for code sharing between the
           //    evaluate-to-PosList and evaluate-to-Result implementations
           // b) Like/In are on the slower end anyway
-          const auto result = evaluate_expression_to_result<ExpressionEvaluator::Bool>(expression);
+          const auto result = _evaluate_expression_to_result<ExpressionEvaluator::Bool>(expression);
           result->as_view([&](const auto& result_view) {
             for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
                  ++chunk_offset) {
@@ -1128,6 +1558,48 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
+      if (evaluates_lazily(logical_expression)) {
+        // The expensive operand is only evaluated for the rows that match the other operand (for AND) or that do not
+        // match it (for OR)
+        const auto [first_operand, second_operand] = order_logical_operands(logical_expression);
+        const auto first_pos_list = evaluate_expression_to_pos_list(*first_operand);
+
+        auto undecided_rows = std::shared_ptr<RowIDPosList>{};
+        if (logical_expression.logical_operator == LogicalOperator::And) {
+          undecided_rows = std::make_shared<RowIDPosList>(first_pos_list.cbegin(), first_pos_list.cend());
+        } else {
+          undecided_rows = std::make_shared<RowIDPosList>();
+          undecided_rows->reserve(_output_row_count - first_pos_list.size());
+          auto first_pos_list_iter = first_pos_list.cbegin();
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
+               ++chunk_offset) {
+            if (first_pos_list_iter != first_pos_list.cend() && first_pos_list_iter->chunk_offset == chunk_offset) {
+              ++first_pos_list_iter;
+            } else {
+              undecided_rows->emplace_back(RowID{_chunk_id, chunk_offset});
+            }
+          }
+        }
+
+        auto second_pos_list = RowIDPosList{};
+        if (!undecided_rows->empty()) {
+          undecided_rows->guarantee_single_chunk();
+          auto evaluator = ExpressionEvaluator{*this, undecided_rows};
+          second_pos_list = evaluator.evaluate_expression_to_pos_list(*second_operand);
+          // The matches of the evaluator for the undecided rows are positions in these rows
+          for (auto& row_id : second_pos_list) {
+            row_id = (*undecided_rows)[row_id.chunk_offset];
+          }
+        }
+
+        if (logical_expression.logical_operator == LogicalOperator::And) return second_pos_list;
+
+        result_pos_list.reserve(first_pos_list.size() + second_pos_list.size());
+        std::merge(first_pos_list.begin(), first_pos_list.end(), second_pos_list.begin(), second_pos_list.end(),
+                   std::back_inserter(result_pos_list));
+        break;
+      }
+
       const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
       const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
 
@@ -1197,6 +1669,19 @@ ExpressionEvaluator::_evaluate_logical_expression<ExpressionEvaluator::Bool>(con
   const auto& left = *expression.left_operand();
   const auto& right = *expression.right_operand();
 
+  if (_chunk && evaluates_lazily(expression) && left.data_type() == DataTypeBool && right.data_type() == DataTypeBool) {
+    auto result = std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>{};
+    switch (expression.logical_operator) {
+      case LogicalOperator::Or:
+        result = _evaluate_logical_expression_lazily<TernaryOrEvaluator>(expression);
+        break;
+      case LogicalOperator::And:
+        result = _evaluate_logical_expression_lazily<TernaryAndEvaluator>(expression);
+        break;
+    }
+    if (result) return result;
+  }
+
   // clang-format off
   switch (expression.logical_operator) {
     case LogicalOperator::Or:  return _evaluate_binary_with_functor_based_null_logic<ExpressionEvaluator::Bool, TernaryOrEvaluator>(left, right);  // NOLINT
@@ -1213,11 +1698,56 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_logical
   Fail("LogicalExpression can only output bool");
 }
 
+template <typename Functor>
+std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>> ExpressionEvaluator::_evaluate_logical_expression_lazily(
+    const LogicalExpression& expression) {
+  const auto [first_operand, second_operand] = order_logical_operands(expression);
+  const auto first_result = _evaluate_expression_to_result<ExpressionEvaluator::Bool>(*first_operand);
+
+  // FALSE decides an AND, TRUE decides an OR
+  const auto deciding_value = std::is_same_v<Functor, TernaryOrEvaluator>;
+  const auto is_decided = [&](const ChunkOffset chunk_offset) {
+    return !first_result->is_null(chunk_offset) && (first_result->value(chunk_offset) != 0) == deciding_value;
+  };
+
+  if (first_result->is_literal()) {
+    if (!is_decided(ChunkOffset{0})) return nullptr;
+    return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(
+        pmr_vector<ExpressionEvaluator::Bool>(_output_row_count, deciding_value, _allocator));
+  }
+
+  auto undecided_rows = std::make_shared<RowIDPosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
+    if (!is_decided(chunk_offset)) undecided_rows->emplace_back(RowID{_chunk_id, chunk_offset});
+  }
+  if (undecided_rows->size() == _output_row_count) return nullptr;
+
+  auto values = pmr_vector<ExpressionEvaluator::Bool>(_output_row_count, deciding_value, _allocator);
+  auto nulls = NullBitmap(_output_row_count, false, _allocator);
+
+  if (!undecided_rows->empty()) {
+    undecided_rows->guarantee_single_chunk();
+    auto evaluator = ExpressionEvaluator{*this, undecided_rows};
+    const auto second_result = evaluator._evaluate_expression_to_result<ExpressionEvaluator::Bool>(*second_operand);
+
+    const auto row_count = undecided_rows->size();
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      const auto chunk_offset = (*undecided_rows)[row_idx].chunk_offset;
+      auto is_null = false;
+      Functor{}(values[chunk_offset], is_null, first_result->value(chunk_offset), first_result->is_null(chunk_offset),
+                second_result->value(row_idx), second_result->is_null(row_idx));
+      nulls[chunk_offset] = is_null;
+    }
+  }
+
+  return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::move(values), std::move(nulls));
+}
+
 template <typename Result, typename Functor>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_with_default_null_logic(
     const AbstractExpression& left_expression, const AbstractExpression& right_expression) {
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  pmr_vector<Result> values(_allocator);
+  NullBitmap nulls(_allocator);
 
   _resolve_to_expression_results(left_expression, right_expression, [&](const auto& left, const auto& right) {
     using LeftDataType = typename std::decay_t<decltype(left)>::Type;
@@ -1226,7 +1756,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_size = _result_size(left.size(), right.size());
       values.resize(result_size);
-      nulls = _evaluate_default_null_logic(left.nulls, right.nulls);
+      nulls = _evaluate_default_null_logic(left.nulls, right.nulls, _allocator);
 
       // Using three different branches instead of views, which would generate 9 cases.
       if (left.is_literal() == right.is_literal()) {
@@ -1262,8 +1792,8 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_row_count = _result_size(left.size(), right.size());
 
-      pmr_vector<bool> nulls(result_row_count);
-      pmr_vector<Result> values(result_row_count);
+      NullBitmap nulls(result_row_count, _allocator);
+      pmr_vector<Result> values(result_row_count, _allocator);
 
       for (auto row_idx = ChunkOffset{0}; row_idx < result_row_count; ++row_idx) {
         bool null;
@@ -1323,7 +1853,7 @@ void ExpressionEvaluator::_resolve_to_expression_result(const AbstractExpression
     resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
       using ExpressionDataType = typename decltype(data_type_t)::type;
 
-      const auto expression_result = evaluate_expression_to_result<ExpressionDataType>(expression);
+      const auto expression_result = _evaluate_expression_to_result<ExpressionDataType>(expression);
       fn(*expression_result);
     });
   }
@@ -1347,29 +1877,30 @@ ChunkOffset ExpressionEvaluator::_result_size(const RowCounts... row_counts) {
   return static_cast<ChunkOffset>(std::max({row_counts...}));
 }
 
-pmr_vector<bool> ExpressionEvaluator::_evaluate_default_null_logic(const pmr_vector<bool>& left,
-                                                                   const pmr_vector<bool>& right) {
+NullBitmap ExpressionEvaluator::_evaluate_default_null_logic(const NullBitmap& left, const NullBitmap& right,
+                                                             const NullBitmap::allocator_type& allocator) {
   if (left.size() == right.size()) {
-    pmr_vector<bool> nulls(left.size());
-    std::transform(left.begin(), left.end(), right.begin(), nulls.begin(), [](auto l, auto r) { return l || r; });
+    // Combines 64 rows per instruction
+    auto nulls = NullBitmap(left, allocator);
+    nulls |= right;
     return nulls;
   } else if (left.size() > right.size()) {
     DebugAssert(right.size() <= 1,
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!right.empty() && right.front()) {
-      return pmr_vector<bool>({true});
+      return NullBitmap({true}, allocator);
     } else {
-      return left;
+      return NullBitmap(left, allocator);
     }
   } else {
     DebugAssert(left.size() <= 1,
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!left.empty() && left.front()) {
-      return pmr_vector<bool>({true});
+      return NullBitmap({true}, allocator);
     } else {
-      return right;
+      return NullBitmap(right, allocator);
     }
   }
 }
@@ -1384,14 +1915,18 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
     using ColumnDataType = typename decltype(column_data_type_t)::type;
 
-    pmr_vector<ColumnDataType> values;
-    pmr_vector<bool> nulls;
+    pmr_vector<ColumnDataType> values(_allocator);
+    NullBitmap nulls(_allocator);
 
-    if (const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+    if (_rows) {
+      // Evaluators for a subset of the rows only gather the values of these rows
+      segment_gather<ColumnDataType>(segment, _rows, values, nulls);
+      if (!_table->column_is_nullable(column_id)) nulls.clear();
+    } else if (const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
       // Shortcut
-      values = pmr_vector<ColumnDataType>{value_segment->values()};
+      values = pmr_vector<ColumnDataType>(value_segment->values(), _allocator);
       if (_table->column_is_nullable(column_id)) {
-        nulls = pmr_vector<bool>{value_segment->null_values()};
+        nulls = NullBitmap(value_segment->null_values(), _allocator);
       }
     } else {
       values.resize(segment.size());
@@ -1425,18 +1960,115 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   });
 }
 
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_on_dictionary(
+    const AbstractExpression& expression) {
+  if constexpr (std::is_same_v<Result, NullValue>) {
+    return nullptr;
+  } else {
+    auto column = std::shared_ptr<AbstractExpression>{};
+    for (const auto& argument : expression.arguments) {
+      if (!is_dictionary_evaluable(argument, column)) return nullptr;
+    }
+    if (!column) return nullptr;
+
+    const auto& column_expression = static_cast<const PQPColumnExpression&>(*column);
+    const auto& segment = _chunk->get_segment(column_expression.column_id);
+
+    auto result = std::shared_ptr<ExpressionResult<Result>>{};
+
+    resolve_data_type(column_expression.data_type(), [&](const auto column_data_type_t) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+
+      // ReferenceSegments are supported if they reference a single DictionarySegment
+      auto dictionary_segment = std::shared_ptr<const DictionarySegment<ColumnDataType>>{};
+      auto position_filter = std::shared_ptr<const AbstractPosList>{};
+      if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        position_filter = reference_segment->pos_list();
+        if (position_filter->empty() || !position_filter->references_single_chunk()) return;
+
+        const auto referenced_chunk =
+            reference_segment->referenced_table()->get_chunk(position_filter->common_chunk_id());
+        dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(
+            referenced_chunk->get_segment(reference_segment->referenced_column_id()));
+      } else {
+        dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+      }
+      if (!dictionary_segment) return;
+
+      const auto row_count = segment->size();
+      const auto& dictionary = *dictionary_segment->dictionary();
+      if (dictionary.empty() || dictionary.size() * MIN_ROWS_PER_DICTIONARY_ENTRY > row_count) return;
+
+      // Evaluate the expression on a table that holds the dictionary as its only column
+      const auto column_name = column_expression.as_column_name();
+      const auto column_definitions =
+          TableColumnDefinitions{TableColumnDefinition{column_name, column_expression.data_type(), false}};
+      const auto dictionary_table = std::make_shared<Table>(column_definitions, TableType::Data);
+      dictionary_table->append_chunk({std::make_shared<ValueSegment<ColumnDataType>>(
+          pmr_vector<ColumnDataType>{dictionary.cbegin(), dictionary.cend()})});
+
+      auto dictionary_expression = expression.deep_copy();
+      const auto dictionary_column =
+          std::make_shared<PQPColumnExpression>(ColumnID{0}, column_expression.data_type(), false, column_name);
+      expression_deep_replace(dictionary_expression,
+                              ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{{column, dictionary_column}});
+
+      const auto dictionary_results = ExpressionEvaluator{dictionary_table, ChunkID{0}}
+                                          .evaluate_expression_to_result<Result>(*dictionary_expression);
+
+      // Look up the result of each row's dictionary entry
+      const auto nullable =
+          _table->column_is_nullable(column_expression.column_id) || dictionary_results->is_nullable();
+      const auto null_value_id = dictionary_segment->null_value_id();
+
+      auto values = pmr_vector<Result>(row_count, _allocator);
+      auto nulls = NullBitmap(_allocator);
+      if (nullable) nulls.resize(row_count);
+
+      const auto write_row = [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+        if (value_id == null_value_id) {
+          nulls[chunk_offset] = true;
+          return;
+        }
+        values[chunk_offset] = dictionary_results->value(value_id);
+        if (nullable) nulls[chunk_offset] = dictionary_results->is_null(value_id);
+      };
+
+      resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        if (position_filter) {
+          auto decompressor = attribute_vector.create_decompressor();
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+            write_row(chunk_offset, ValueID{decompressor.get((*position_filter)[chunk_offset].chunk_offset)});
+          }
+        } else {
+          auto chunk_offset = ChunkOffset{0};
+          for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+               ++value_id_it, ++chunk_offset) {
+            write_row(chunk_offset, ValueID{*value_id_it});
+          }
+        }
+      });
+
+      result = std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+    });
+
+    return result;
+  }
+}
+
 std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_substring(
     const std::vector<std::shared_ptr<AbstractExpression>>& arguments) {
   DebugAssert(arguments.size() == 3, "SUBSTR expects three arguments");
 
-  const auto strings = evaluate_expression_to_result<pmr_string>(*arguments[0]);
-  const auto starts = evaluate_expression_to_result<int32_t>(*arguments[1]);
-  const auto lengths = evaluate_expression_to_result<int32_t>(*arguments[2]);
+  const auto strings = _evaluate_expression_to_result<pmr_string>(*arguments[0]);
+  const auto starts = _evaluate_expression_to_result<int32_t>(*arguments[1]);
+  const auto lengths = _evaluate_expression_to_result<int32_t>(*arguments[2]);
 
   const auto row_count = _result_size(strings->size(), starts->size(), lengths->size());
 
-  pmr_vector<pmr_string> result_values(row_count);
-  pmr_vector<bool> result_nulls(row_count);
+  pmr_vector<pmr_string> result_values(row_count, _allocator);
+  NullBitmap result_nulls(row_count, _allocator);
 
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(row_count); ++chunk_offset) {
     result_nulls[chunk_offset] =
@@ -1512,7 +2144,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_con
       return std::make_shared<ExpressionResult<pmr_string>>(null_value_result);
     }
 
-    const auto argument_result = evaluate_expression_to_result<pmr_string>(*argument);
+    const auto argument_result = _evaluate_expression_to_result<pmr_string>(*argument);
     argument_results.emplace_back(argument_result);
 
     result_is_nullable |= argument_result->is_nullable();
@@ -1525,7 +2157,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_con
   }
 
   // 3 - Concatenate the values
-  pmr_vector<pmr_string> result_values(result_size);
+  pmr_vector<pmr_string> result_values(result_size, _allocator);
   for (const auto& argument_result : argument_results) {
     argument_result->as_view([&](const auto& argument_view) {
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(result_size); ++chunk_offset) {
@@ -1536,7 +2168,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_con
   }
 
   // 4 - Optionally concatenate the nulls (i.e. one argument is null -> result is null) and return
-  pmr_vector<bool> result_nulls{};
+  NullBitmap result_nulls(_allocator);
   if (result_is_nullable) {
     result_nulls.resize(result_size, false);
     for (const auto& argument_result : argument_results) {
@@ -1572,7 +2204,7 @@ std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_pru
     Assert(table->column_data_type(ColumnID{0}) == data_type_from_type<Result>(),
            "Expected different DataType from Subquery");
 
-    pmr_vector<bool> result_nulls;
+    NullBitmap result_nulls;
     pmr_vector<Result> result_values(table->row_count());
 
     auto chunk_offset = ChunkOffset{0};
@@ -1615,4 +2247,15 @@ std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_pru
   return results;
 }
 
+template std::shared_ptr<ExpressionResult<int32_t>> ExpressionEvaluator::evaluate_expression_to_result<int32_t>(
+    const AbstractExpression& expression);
+template std::shared_ptr<ExpressionResult<int64_t>> ExpressionEvaluator::evaluate_expression_to_result<int64_t>(
+    const AbstractExpression& expression);
+template std::shared_ptr<ExpressionResult<float>> ExpressionEvaluator::evaluate_expression_to_result<float>(
+    const AbstractExpression& expression);
+template std::shared_ptr<ExpressionResult<double>> ExpressionEvaluator::evaluate_expression_to_result<double>(
+    const AbstractExpression& expression);
+template std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::evaluate_expression_to_result<pmr_string>(
+    const AbstractExpression& expression);
+
 }  // namespace opossum
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "boost/container/pmr/monotonic_buffer_resource.hpp"
 #include "boost/variant.hpp"
 
 #include "all_type_variant.hpp"
@@ -22,6 +26,7 @@ class BinaryPredicateExpression;
 class CaseExpression;
 class CastExpression;
 class Chunk;
+class CompiledExpression;
 class ExistsExpression;
 class ExtractExpression;
 class FunctionExpression;
@@ -55,6 +60,36 @@ class ExpressionEvaluator final {
   using UncorrelatedSubqueryResults =
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<const Table>>;
 
+  // Performance Hack:
+  //   Correlated subqueries are executed once per distinct combination of the values of the outer columns that they
+  //   reference, not once per row. The results are memoized in CorrelatedSubqueryResults, which operators can share
+  //   between the evaluators of all their chunks, so that rows of different chunks reuse them as well.
+  class CorrelatedSubqueryResults final {
+   public:
+    // Bounds the memory held by the cache. The results for further parameter values are not memoized.
+    static constexpr auto MAX_RESULT_COUNT = size_t{100'000};
+
+    // Returns nullptr if the result has not been memoized
+    std::shared_ptr<const Table> get(const std::shared_ptr<AbstractOperator>& pqp,
+                                     const std::vector<AllTypeVariant>& parameter_values) const;
+    void set(const std::shared_ptr<AbstractOperator>& pqp, const std::vector<AllTypeVariant>& parameter_values,
+             const std::shared_ptr<const Table>& result);
+
+   private:
+    using Key = std::pair<std::shared_ptr<AbstractOperator>, std::vector<AllTypeVariant>>;
+
+    // In contrast to SQL semantics, NULL parameter values are equal to each other
+    struct KeyHash {
+      size_t operator()(const Key& key) const;
+    };
+    struct KeyEqual {
+      bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+
+    mutable std::mutex _mutex;
+    std::unordered_map<Key, std::shared_ptr<const Table>, KeyHash, KeyEqual> _results;
+  };
+
   // For Expressions that do not reference any columns (e.g. in the LIMIT clause)
   ExpressionEvaluator() = default;
 
@@ -62,9 +97,15 @@ class ExpressionEvaluator final {
    * For Expressions that reference segments from a single table
    * @param uncorrelated_subquery_results  Results from pre-computed uncorrelated selects, so they do not need to be
    *                                     evaluated for every chunk. Solely for performance.
+   * @param correlated_subquery_results    Memoized results of correlated subqueries, shared with the evaluators of
+   *                                     other chunks. If not given, results are only memoized within this chunk.
+   * @param upstream_memory_resource       Resource from which the buffers for the results are allocated, e.g., the
+   *                                     memory resource of the operator. If not given, the default resource is used.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {});
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {},
+                      const std::shared_ptr<CorrelatedSubqueryResults>& correlated_subquery_results = {},
+                      const std::shared_ptr<boost::container::pmr::memory_resource>& upstream_memory_resource = {});
 
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   RowIDPosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
@@ -76,13 +117,47 @@ class ExpressionEvaluator final {
   static std::shared_ptr<UncorrelatedSubqueryResults> populate_uncorrelated_subquery_results_cache(
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
+  /**
+   * Performance Hack:
+   *   Returns the subexpressions (other than columns, values, and parameters) that occur in more than one of the given
+   *   expressions, e.g., `a * (1 - b)` in `SUM(a * (1 - b))` and `SUM(a * (1 - b) * (1 + c))` of TPC-H Q1. Only the
+   *   outermost of nested common subexpressions are returned, unless an inner one also occurs elsewhere. Operators
+   *   that evaluate several expressions per chunk pass them to set_common_subexpressions().
+   */
+  static std::shared_ptr<ExpressionUnorderedSet> find_common_subexpressions(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+  // The common subexpressions are evaluated on their own, so that their results are cached and shared between the
+  // expressions, instead of being fused into the CompiledExpression of each expression and computed repeatedly.
+  void set_common_subexpressions(const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions);
+
  private:
+  /**
+   * For evaluating an operand of an AND or OR or a branch of a CASE only for some rows of the chunk of
+   * @param evaluator, i.e., those that the other operand or the condition leave undecided. Its results have one entry
+   * per row in @param rows, whose chunk offsets are sorted positions in the results of @param evaluator. The evaluator
+   * shares the memory resource and the subquery results of @param evaluator, which has to outlive it.
+   */
+  ExpressionEvaluator(ExpressionEvaluator& evaluator, const std::shared_ptr<const RowIDPosList>& rows);
+
+  // evaluate_expression_to_result() for results that do not leave the evaluator
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result(const AbstractExpression& expression);
+
+  // Evaluates the inputs of the compiled expression and returns its result
+  std::shared_ptr<BaseExpressionResult> _evaluate_compiled_expression(const CompiledExpression& compiled_expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_logical_expression(const LogicalExpression& expression);
 
+  // Evaluates the cheaper operand first and the other one only for the rows for which the first one is not FALSE (for
+  // AND) or not TRUE (for OR). Returns nullptr if no row is decided by the first operand.
+  template <typename Functor>
+  std::shared_ptr<ExpressionResult<Bool>> _evaluate_logical_expression_lazily(const LogicalExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_predicate_expression(
       const AbstractPredicateExpression& predicate_expression);
@@ -116,6 +191,11 @@ class ExpressionEvaluator final {
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_case_expression(const CaseExpression& case_expression);
 
+  // Evaluates the expensive branches of the CASE only for the rows that take them
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_case_expression_lazily(const CaseExpression& case_expression,
+                                                                             const ExpressionResult<Bool>& when);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_cast_expression(const CastExpression& cast_expression);
 
@@ -176,10 +256,22 @@ class ExpressionEvaluator final {
    * Either operand can be either empty (the operand is not nullable), contain one element (the operand is a literal
    * with null info) or can have n rows (the operand is a nullable series)
    */
-  static pmr_vector<bool> _evaluate_default_null_logic(const pmr_vector<bool>& left, const pmr_vector<bool>& right);
+  static NullBitmap _evaluate_default_null_logic(const NullBitmap& left, const NullBitmap& right,
+                                                 const NullBitmap::allocator_type& allocator);
 
   void _materialize_segment_if_not_yet_materialized(const ColumnID column_id);
 
+  /**
+   * Evaluates functions, casts, and extracts of a single column once per entry of its DictionarySegment instead of
+   * once per row, e.g., SUBSTR(s, 1, 3) or CAST(s AS INT), and looks up the results with the attribute vector. Returns
+   * nullptr if the expression references other columns or subqueries, if the column is not dictionary-encoded in the
+   * chunk, or if the dictionary has more than one entry per MIN_ROWS_PER_DICTIONARY_ENTRY rows.
+   */
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_on_dictionary(const AbstractExpression& expression);
+
+  static constexpr auto MIN_ROWS_PER_DICTIONARY_ENTRY = size_t{2};
+
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_substring(
       const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
   std::shared_ptr<ExpressionResult<pmr_string>> _evaluate_concatenate(
@@ -189,11 +281,22 @@ class ExpressionEvaluator final {
   static std::vector<std::shared_ptr<ExpressionResult<Result>>> _prune_tables_to_expression_results(
       const std::vector<std::shared_ptr<const Table>>& tables);
 
+  // For evaluators that operate on a chunk, the values and nulls of the (intermediate) results are allocated from a
+  // monotonic buffer, which is only released as a whole. This avoids allocating and freeing chunk-sized vectors for
+  // every node of an expression. Declared first, so that it is destroyed after all results of the evaluator.
+  static constexpr auto MIN_MEMORY_RESOURCE_BUFFER_SIZE = size_t{4096};
+  std::shared_ptr<boost::container::pmr::memory_resource> _upstream_memory_resource;
+  std::shared_ptr<boost::container::pmr::monotonic_buffer_resource> _memory_resource;
+  PolymorphicAllocator<size_t> _allocator;
+
   std::shared_ptr<const Table> _table;
   std::shared_ptr<const Chunk> _chunk;
   const ChunkID _chunk_id;
   size_t _output_row_count{1};
 
+  // Set for evaluators that operate on a subset of the rows of the chunk only (see the private constructor above)
+  std::shared_ptr<const RowIDPosList> _rows;
+
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
@@ -201,9 +304,15 @@ class ExpressionEvaluator final {
   // do not have to be executed multiple times by different evaluators
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
 
+  // Created on first use if not passed in
+  std::shared_ptr<CorrelatedSubqueryResults> _correlated_subquery_results;
+
   // Some expressions can be reused, either in the same result column (SELECT (a+3)*(a+3)), or across columns
   // (TPC-H Q1)
   ConstExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _cached_expression_results;
+
+  // Subexpressions that are not fused into CompiledExpressions, so that they are computed only once (see above)
+  std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
 };
 
 }  // namespace opossum
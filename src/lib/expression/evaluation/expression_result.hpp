@@ -8,6 +8,7 @@
 #include "expression_result_views.hpp"
 #include "null_value.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/null_bitmap.hpp"
 #include "storage/segment_iterables/segment_positions.hpp"
 #include "utils/assert.hpp"
 
@@ -62,7 +63,7 @@ class ExpressionResult : public BaseExpressionResult {
 
   ExpressionResult() = default;
 
-  explicit ExpressionResult(pmr_vector<T> init_values, pmr_vector<bool> init_nulls = {})
+  explicit ExpressionResult(pmr_vector<T> init_values, NullBitmap init_nulls = {})
       : values(std::move(init_values)), nulls(std::move(init_nulls)) {
     // Allowed size of nulls: 0 (not nullable)
     //                        1 (nullable, all values are NULL or NOT NULL, depending on the value)
@@ -112,7 +113,7 @@ class ExpressionResult : public BaseExpressionResult {
   size_t size() const { return values.size(); }
 
   pmr_vector<T> values;
-  pmr_vector<bool> nulls;
+  NullBitmap nulls;
 };
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include "storage/null_bitmap.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -21,7 +22,7 @@ class ExpressionResultNullableSeries {
  public:
   using Type = T;
 
-  ExpressionResultNullableSeries(const pmr_vector<T>& values, const pmr_vector<bool>& nulls)
+  ExpressionResultNullableSeries(const pmr_vector<T>& values, const NullBitmap& nulls)
       : _values(values), _nulls(nulls) {
     DebugAssert(values.size() == nulls.size(), "Need as many values as nulls");
   }
@@ -44,7 +45,7 @@ class ExpressionResultNullableSeries {
 
  private:
   const pmr_vector<T>& _values;
-  const pmr_vector<bool>& _nulls;
+  const NullBitmap& _nulls;
 };
 
 /**
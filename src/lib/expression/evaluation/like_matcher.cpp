@@ -3,10 +3,32 @@
 #include <optional>
 #include <utility>
 
-#include "boost/algorithm/string/replace.hpp"
-
 #include "utils/assert.hpp"
 
+namespace {
+
+// Expects string and piece to have the same size
+bool piece_matches(const std::string_view string, const std::string_view piece) {
+  for (auto char_id = size_t{0}; char_id < piece.size(); ++char_id) {
+    if (piece[char_id] != '_' && piece[char_id] != string[char_id]) return false;
+  }
+  return true;
+}
+
+// Returns the position of the first occurrence of the piece in the string or std::string_view::npos
+size_t find_piece(const std::string_view string, const std::string_view piece) {
+  // Without wildcards, use the library's search, which is vectorized by the common standard libraries
+  if (piece.find('_') == std::string_view::npos) return string.find(piece);
+
+  if (string.size() < piece.size()) return std::string_view::npos;
+  for (auto position = size_t{0}; position <= string.size() - piece.size(); ++position) {
+    if (piece_matches(string.substr(position, piece.size()), piece)) return position;
+  }
+  return std::string_view::npos;
+}
+
+}  // namespace
+
 namespace opossum {
 
 LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
@@ -118,35 +140,40 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
 
     if (pattern_is_contains_multiple) {
       return MultipleContainsPattern{strings};
-    } else {
-      return std::regex(sql_like_to_regex(pattern));
     }
+
+    auto general_pattern = GeneralPattern{};
+    auto piece_begin = size_t{0};
+    while (true) {
+      const auto piece_end = pattern.find('%', piece_begin);
+      general_pattern.pieces.emplace_back(pattern.substr(piece_begin, piece_end - piece_begin));
+      if (piece_end == pmr_string::npos) break;
+      piece_begin = piece_end + 1;
+    }
+    return general_pattern;
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+bool LikeMatcher::matches(const std::string_view string, const GeneralPattern& pattern) {
+  const auto& pieces = pattern.pieces;
+  const auto first_piece = std::string_view{pieces.front()};
+  if (pieces.size() == 1) return string.size() == first_piece.size() && piece_matches(string, first_piece);
+
+  const auto last_piece = std::string_view{pieces.back()};
+  if (string.size() < first_piece.size() + last_piece.size()) return false;
+  if (!piece_matches(string.substr(0, first_piece.size()), first_piece) ||
+      !piece_matches(string.substr(string.size() - last_piece.size()), last_piece)) {
+    return false;
   }
 
-  return std::string{"^" + sql_like + "$"};
+  auto remaining_string = string.substr(first_piece.size(), string.size() - first_piece.size() - last_piece.size());
+  for (auto piece_id = size_t{1}; piece_id + 1 < pieces.size(); ++piece_id) {
+    const auto& piece = pieces[piece_id];
+    const auto position = find_piece(remaining_string, piece);
+    if (position == std::string_view::npos) return false;
+    remaining_string.remove_prefix(position + piece.size());
+  }
+  return true;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -2,8 +2,8 @@
 
 #include <experimental/functional>
 #include <optional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -17,7 +17,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are matched without backtracking (see GeneralPattern).
  */
 class LikeMatcher {
   // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
@@ -28,11 +28,6 @@ class LikeMatcher {
 #endif
 
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -59,7 +54,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is a GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -77,16 +72,24 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // 'H_llo%W%ld', split at each '%' into the pieces {"H_llo", "W", "ld"}. In the pieces, '_' matches any character.
+  // The first piece has to match at the beginning of the string and the last piece at its end (unless the pattern has
+  // a single piece, which has to match the entire string). The pieces in between have a fixed length, so they are
+  // searched for from left to right and the leftmost occurrence is taken, which needs no backtracking.
+  struct GeneralPattern final {
+    std::vector<pmr_string> pieces;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  static bool matches(const std::string_view string, const GeneralPattern& pattern);
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -137,11 +140,11 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
 
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return matches(std::string_view{string.data(), string.size()}, general_pattern) ^ invert_results;
       });
 
     } else {
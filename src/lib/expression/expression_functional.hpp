@@ -120,6 +120,7 @@ inline detail::unary<AggregateFunction::Avg, AggregateExpression> avg_;
 inline detail::unary<AggregateFunction::Count, AggregateExpression> count_;
 inline detail::unary<AggregateFunction::CountDistinct, AggregateExpression> count_distinct_;
 inline detail::unary<AggregateFunction::StandardDeviationSample, AggregateExpression> standard_deviation_sample_;
+inline detail::unary<AggregateFunction::ApproxCountDistinct, AggregateExpression> approx_count_distinct_;
 inline detail::unary<AggregateFunction::Any, AggregateExpression> any_;
 
 inline detail::binary<ArithmeticOperator::Division, ArithmeticExpression> div_;
@@ -232,6 +233,11 @@ std::shared_ptr<CorrelatedParameterExpression> correlated_parameter_(const Param
 
 std::shared_ptr<AggregateExpression> count_star_(const std::shared_ptr<AbstractLQPNode>& lqp_node);
 
+template <typename A>
+std::shared_ptr<AggregateExpression> approx_percentile_(const A& a, const double percentile) {
+  return std::make_shared<AggregateExpression>(AggregateFunction::ApproxPercentile, to_expression(a), percentile);
+}
+
 template <typename Argument>
 std::shared_ptr<UnaryMinusExpression> unary_minus_(const Argument& argument) {
   return std::make_shared<UnaryMinusExpression>(to_expression(argument));
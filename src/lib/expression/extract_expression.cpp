@@ -43,7 +43,10 @@ std::string ExtractExpression::description(const DescriptionMode mode) const {
 }
 
 DataType ExtractExpression::data_type() const {
-  // Dates are Strings, DateComponents COULD be Ints, but lets leave it at String for now
+  // Dates stored as integers (see date_time_utils.hpp) yield integer components. For "YYYY-MM-DD" strings, the
+  // components are substrings.
+  const auto from_data_type = from()->data_type();
+  if (from_data_type == DataType::Int || from_data_type == DataType::Long) return DataType::Int;
   return DataType::String;
 }
 
@@ -12,6 +12,8 @@ std::ostream& operator<<(std::ostream& stream, const DatetimeComponent datetime_
 
 /**
  * SQL's EXTRACT()
+ * Works on "YYYY-MM-DD" strings, on DATEs stored as Int (days since 1970-01-01), and on TIMESTAMPs stored as Long
+ * (seconds since 1970-01-01 00:00:00)
  * NOT a FunctionExpression since we currently have no way for taking as an enum such as DatetimeComponent as a function
  * argument
  */
@@ -0,0 +1,185 @@
+#include "window_function_expression.hpp"
+
+#include <sstream>
+
+#include "boost/functional/hash.hpp"
+
+#include "aggregate_expression.hpp"
+#include "constant_mappings.hpp"
+#include "expression_utils.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractExpression>> concatenate_arguments(
+    const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions) {
+  auto arguments = std::vector<std::shared_ptr<AbstractExpression>>{};
+  if (argument) arguments.emplace_back(argument);
+  arguments.insert(arguments.end(), partition_by_expressions.begin(), partition_by_expressions.end());
+  arguments.insert(arguments.end(), order_by_expressions.begin(), order_by_expressions.end());
+  return arguments;
+}
+
+bool is_ranking_function(const WindowFunction window_function) {
+  return window_function == WindowFunction::RowNumber || window_function == WindowFunction::Rank ||
+         window_function == WindowFunction::DenseRank;
+}
+
+void write_frame_bound(std::ostream& stream, const std::optional<uint64_t>& bound, const char* const direction) {
+  if (bound == 0) {
+    stream << "CURRENT ROW";
+  } else if (!bound) {
+    stream << "UNBOUNDED " << direction;
+  } else {
+    stream << *bound << " " << direction;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::ostream& operator<<(std::ostream& stream, const WindowFrame& frame) {
+  stream << (frame.type == FrameType::Rows ? "ROWS" : "RANGE") << " BETWEEN ";
+  write_frame_bound(stream, frame.preceding, "PRECEDING");
+  stream << " AND ";
+  write_frame_bound(stream, frame.following, "FOLLOWING");
+  return stream;
+}
+
+WindowFunctionExpression::WindowFunctionExpression(
+    const WindowFunction init_window_function, const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+    const std::vector<SortMode>& init_sort_modes, const WindowFrame& init_frame)
+    : AbstractExpression(ExpressionType::WindowFunction,
+                         concatenate_arguments(argument, partition_by_expressions, order_by_expressions)),
+      window_function(init_window_function),
+      sort_modes(init_sort_modes),
+      frame(init_frame),
+      _has_argument(argument != nullptr),
+      _partition_by_expression_count(partition_by_expressions.size()) {
+  Assert(order_by_expressions.size() == sort_modes.size(), "Expected one SortMode per ORDER BY expression");
+  Assert(is_ranking_function(window_function) != _has_argument || window_function == WindowFunction::Count,
+         "Ranking functions take no argument, all other window functions except COUNT(*) take one");
+  Assert(frame.type == FrameType::Rows || ((!frame.preceding || frame.preceding == 0) &&
+                                           (!frame.following || frame.following == 0)),
+         "RANGE frames only support UNBOUNDED and CURRENT ROW bounds");
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::argument() const {
+  return _has_argument ? arguments[0] : nullptr;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::partition_by_expressions() const {
+  const auto begin = arguments.begin() + (_has_argument ? 1 : 0);
+  return {begin, begin + _partition_by_expression_count};
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::order_by_expressions() const {
+  return {arguments.begin() + (_has_argument ? 1 : 0) + _partition_by_expression_count, arguments.end()};
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::deep_copy() const {
+  return std::make_shared<WindowFunctionExpression>(
+      window_function, _has_argument ? argument()->deep_copy() : nullptr,
+      expressions_deep_copy(partition_by_expressions()), expressions_deep_copy(order_by_expressions()), sort_modes,
+      frame);
+}
+
+std::string WindowFunctionExpression::description(const DescriptionMode mode) const {
+  std::stringstream stream;
+
+  stream << window_function_to_string.left.at(window_function) << "(";
+  if (_has_argument) {
+    stream << argument()->description(mode);
+  } else if (window_function == WindowFunction::Count) {
+    stream << "*";
+  }
+  stream << ") OVER (";
+
+  const auto partition_by = partition_by_expressions();
+  if (!partition_by.empty()) {
+    stream << "PARTITION BY " << expression_descriptions(partition_by, mode);
+  }
+
+  const auto order_by = order_by_expressions();
+  if (!order_by.empty()) {
+    if (!partition_by.empty()) stream << " ";
+    stream << "ORDER BY ";
+    for (auto expression_idx = size_t{0}; expression_idx < order_by.size(); ++expression_idx) {
+      stream << order_by[expression_idx]->description(mode) << " (" << sort_modes[expression_idx] << ")";
+      if (expression_idx + 1 < order_by.size()) stream << ", ";
+    }
+  }
+
+  if (!is_ranking_function(window_function) && frame != WindowFrame{}) {
+    if (!partition_by.empty() || !order_by.empty()) stream << " ";
+    stream << frame;
+  }
+
+  stream << ")";
+  return stream.str();
+}
+
+DataType WindowFunctionExpression::data_type() const {
+  if (is_ranking_function(window_function) || window_function == WindowFunction::Count) return DataType::Long;
+
+  auto window_function_data_type = DataType::Null;
+  resolve_data_type(argument()->data_type(), [&](const auto data_type_t) {
+    using ArgumentDataType = typename decltype(data_type_t)::type;
+    switch (window_function) {
+      case WindowFunction::Min:
+      case WindowFunction::Max:
+        window_function_data_type = data_type_from_type<ArgumentDataType>();
+        break;
+      case WindowFunction::Sum:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::Avg:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Avg>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::RowNumber:
+      case WindowFunction::Rank:
+      case WindowFunction::DenseRank:
+      case WindowFunction::Count:
+        break;  // These are handled above
+    }
+  });
+
+  return window_function_data_type;
+}
+
+bool WindowFunctionExpression::_shallow_equals(const AbstractExpression& expression) const {
+  DebugAssert(dynamic_cast<const WindowFunctionExpression*>(&expression),
+              "Different expression type should have been caught by AbstractExpression::operator==");
+  const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(expression);
+  return window_function == window_function_expression.window_function &&
+         sort_modes == window_function_expression.sort_modes && frame == window_function_expression.frame &&
+         _has_argument == window_function_expression._has_argument &&
+         _partition_by_expression_count == window_function_expression._partition_by_expression_count;
+}
+
+size_t WindowFunctionExpression::_shallow_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(window_function));
+  for (const auto& sort_mode : sort_modes) {
+    boost::hash_combine(hash, sort_mode);
+  }
+  boost::hash_combine(hash, frame.type);
+  boost::hash_combine(hash, _partition_by_expression_count);
+  return hash;
+}
+
+bool WindowFunctionExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
+  // As the frame always contains the current row, aggregates are only NULL if all of their arguments in the frame are
+  if (is_ranking_function(window_function) || window_function == WindowFunction::Count) return false;
+  return argument()->is_nullable_on_lqp(lqp);
+}
+
+}  // namespace opossum
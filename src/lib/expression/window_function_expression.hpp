@@ -0,0 +1,69 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class WindowFunction { RowNumber, Rank, DenseRank, Min, Max, Sum, Avg, Count };
+
+/**
+ * The frame of an aggregate window function, i.e., the rows of the partition that are aggregated for the current row.
+ * For FrameType::Rows, the bounds are the numbers of rows before and after the current row. For FrameType::Range, the
+ * only supported bound is 0, which extends the frame to the peers of the current row (i.e., the rows with the same
+ * ORDER BY values). std::nullopt stands for UNBOUNDED PRECEDING/FOLLOWING. The default frame is SQL's
+ * `RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW`, which spans the entire partition if there is no ORDER BY.
+ */
+enum class FrameType { Rows, Range };
+
+struct WindowFrame {
+  FrameType type{FrameType::Range};
+  std::optional<uint64_t> preceding{};
+  std::optional<uint64_t> following{0};
+
+  bool operator==(const WindowFrame& other) const = default;
+};
+
+std::ostream& operator<<(std::ostream& stream, const WindowFrame& frame);
+
+/**
+ * SQL's window functions, e.g., `RANK() OVER (PARTITION BY a ORDER BY b DESC)` or
+ * `SUM(c) OVER (ORDER BY b ROWS BETWEEN 2 PRECEDING AND CURRENT ROW)`. They are computed by the WindowNode.
+ *
+ * The arguments are the argument of the function (if any), followed by the PARTITION BY and the ORDER BY expressions.
+ * Ranking functions and COUNT(*) have no argument.
+ */
+class WindowFunctionExpression : public AbstractExpression {
+ public:
+  WindowFunctionExpression(const WindowFunction init_window_function,
+                           const std::shared_ptr<AbstractExpression>& argument,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+                           const std::vector<SortMode>& init_sort_modes, const WindowFrame& init_frame = {});
+
+  // nullptr for ranking functions and COUNT(*)
+  std::shared_ptr<AbstractExpression> argument() const;
+  std::vector<std::shared_ptr<AbstractExpression>> partition_by_expressions() const;
+  std::vector<std::shared_ptr<AbstractExpression>> order_by_expressions() const;
+
+  std::shared_ptr<AbstractExpression> deep_copy() const override;
+  std::string description(const DescriptionMode mode) const override;
+  DataType data_type() const override;
+
+  const WindowFunction window_function;
+  const std::vector<SortMode> sort_modes;
+  const WindowFrame frame;
+
+ protected:
+  bool _shallow_equals(const AbstractExpression& expression) const override;
+  size_t _shallow_hash() const override;
+  bool _on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const override;
+
+ private:
+  const bool _has_argument;
+  const size_t _partition_by_expression_count;
+};
+
+}  // namespace opossum
@@ -1,5 +1,10 @@
 #include "hyrise.hpp"
 
+#include "concurrency/change_stream.hpp"
+#include "concurrency/replica.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "distributed/cluster.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -20,11 +25,22 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  lz4_block_cache = LZ4BlockCache{};
+  running_queries = RunningQueries{};
+  operator_statistics = OperatorStatistics{};
+  job_partitioner = JobPartitioner{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  // The write-ahead log publishes the commits of its remaining records, which requires the old TransactionManager
+  Hyrise::get().write_ahead_log = nullptr;
+  // Replicas apply changes and the change stream takes snapshots, both of which require the old TransactionManager
+  Hyrise::get().replica = nullptr;
+  Hyrise::get().change_stream = nullptr;
+  // Requests of other nodes are handled in tasks that require the old scheduler and StorageManager
+  Hyrise::get().cluster = nullptr;
   get() = Hyrise{};
 }
 
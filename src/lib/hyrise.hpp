@@ -1,10 +1,19 @@
 #pragma once
 
+#include <filesystem>
+
 #include "boost/container/pmr/memory_resource.hpp"
+#include "concurrency/query_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "operators/join_hash/join_hash_build_cache.hpp"
+#include "operators/operator_statistics.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_partitioner.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/meta_table_manager.hpp"
@@ -15,7 +24,18 @@
 namespace opossum {
 
 class AbstractScheduler;
+class AdaptiveReoptimizer;
 class BenchmarkRunner;
+class CardinalityFeedback;
+class ChangeStream;
+class Cluster;
+class CostModelCalibration;
+class CostModelCoefficients;
+class Replica;
+class SQLQueryStatistics;
+class SQLWorkloadRecorder;
+class SamplingProfiler;
+class WriteAheadLog;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -46,12 +66,95 @@ class Hyrise : public Singleton<Hyrise> {
   SettingsManager settings_manager;
   LogManager log_manager;
   Topology topology;
+  LZ4BlockCache lz4_block_cache;
+
+  // The SQL statements that are currently executed (see query_context.hpp)
+  RunningQueries running_queries;
+
+  // If set, SQL statements whose intermediate results and data structures exceed this many bytes are cancelled (see
+  // query_context.hpp)
+  std::optional<size_t> query_memory_limit;
+
+  // Operators that exceed the memory limit of their query write intermediate data to files in this directory, which
+  // should be on a local SSD (see spill_file.hpp)
+  std::filesystem::path spill_directory = std::filesystem::temp_directory_path();
+
+  // Aggregates the performance data of all executed operators (see operator_statistics.hpp)
+  OperatorStatistics operator_statistics;
+
+  // If set, the walltime and hardware counters of every n-th operator execution are sampled (see
+  // sampling_profiler.hpp)
+  std::shared_ptr<SamplingProfiler> sampling_profiler;
+
+  // If set, generate_chunk_pruning_statistics() also builds a bloom filter for every segment, so that equality and IN
+  // predicates on high-cardinality columns such as ids can prune chunks (see blocked_bloom_filter.hpp). Pruning
+  // statistics that already exist are not rebuilt.
+  bool build_pruning_bloom_filters = false;
+
+  // Groups the chunks that operators process into jobs (see job_partitioner.hpp)
+  JobPartitioner job_partitioner;
 
   // Plan caches used by the SQLPipelineBuilder if `with_{l/p}qp_cache()` are not used. Both default caches can be
   // nullptr themselves. If both default_{l/p}qp_cache and _{l/p}qp_cache are nullptr, no plan caching is used.
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // If set, SELECT statements that only differ in their literals share their optimized LQP (see sql_plan_cache.hpp).
+  // It is used if the logical plan cache does not contain the statement itself.
+  std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
+
+  // If set, the results of auto-committed SELECT statements are reused until one of their tables is modified (see
+  // sql_result_cache.hpp).
+  std::shared_ptr<SQLResultCache> result_cache;
+
+  // If set, the results of uncorrelated subqueries are shared between the operators of a plan and between executions
+  // until one of their tables is modified, e.g., for `(SELECT MAX(x) FROM t)` in recurring reports (see
+  // create_subquery_result_cache_key()).
+  std::shared_ptr<SQLResultCache> subquery_result_cache;
+
+  // If set, the metrics of all successfully executed SQL statements are aggregated per normalized query (see
+  // sql_query_statistics.hpp and the meta_query_statistics table)
+  std::shared_ptr<SQLQueryStatistics> query_statistics;
+
+  // If set, all SQL statements executed by SQLPipelines are logged so that the workload can be replayed (see
+  // sql_workload_recorder.hpp)
+  std::shared_ptr<SQLWorkloadRecorder> workload_recorder;
+
+  // Cache for the hash tables built by JoinHash (see join_hash_build_cache.hpp). If nullptr, nothing is shared.
+  std::shared_ptr<JoinHashBuildCache> join_hash_build_cache;
+
+  // Limits the number of concurrently executing SQL statements (see admission_control.hpp). If nullptr, all
+  // statements execute immediately.
+  std::shared_ptr<AdmissionControl> admission_control;
+
+  // Makes committed transactions durable (see write_ahead_log.hpp). If nullptr, nothing is logged.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
+
+  // Streams the changes of committed transactions to read replicas (see change_stream.hpp). If nullptr, nothing is
+  // streamed.
+  std::shared_ptr<ChangeStream> change_stream;
+
+  // Set if this instance is a read replica (see replica.hpp), which rejects read/write operators of other transactions
+  std::shared_ptr<Replica> replica;
+
+  // Set if this instance is a node of a cluster that shards tables (see cluster.hpp)
+  std::shared_ptr<Cluster> cluster;
+
+  // If set, the default optimizer uses the calibrated cost model and the LQPTranslator chooses the join
+  // implementations by its cost (see cost_estimator_calibrated.hpp)
+  std::shared_ptr<const CostModelCoefficients> cost_model_coefficients;
+
+  // If set, the runtimes of all executed operators are collected to calibrate the cost model
+  std::shared_ptr<CostModelCalibration> cost_model_calibration;
+
+  // If set, the actual row counts of executed operators are recorded and correct the cardinality estimates of recurring
+  // subplans (see cardinality_feedback.hpp)
+  std::shared_ptr<CardinalityFeedback> cardinality_feedback;
+
+  // If set, SELECT statements with multiple joins are re-optimized during their execution when the cardinality of an
+  // intermediate result deviates from its estimate (see adaptive_reoptimizer.hpp)
+  std::shared_ptr<AdaptiveReoptimizer> adaptive_reoptimizer;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
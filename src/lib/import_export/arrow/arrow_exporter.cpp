@@ -0,0 +1,285 @@
+#include "arrow_exporter.hpp"
+
+#include <cerrno>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The validity bitmaps are built from 64-bit words, whose bytes are in Arrow's bit order on little-endian machines
+using ValidityWord = NullBitmap::Word;
+
+const char* arrow_format(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return "i";
+    case DataType::Long:
+      return "l";
+    case DataType::Float:
+      return "f";
+    case DataType::Double:
+      return "g";
+    case DataType::String:
+      return "u";
+    case DataType::Null:
+      Fail("Cannot export NULL columns");
+  }
+  Fail("Unknown data type");
+}
+
+struct SchemaData {
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+struct ArrayData {
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_pointers;
+
+  // Zero-copy arrays keep their segment alive, materialized arrays own their values
+  std::shared_ptr<const AbstractSegment> segment;
+  std::shared_ptr<const void> values;
+  std::vector<int32_t> offsets;
+  std::vector<ValidityWord> validity;
+};
+
+struct StreamData {
+  std::shared_ptr<const Table> table;
+  ChunkID next_chunk_id{0};
+  std::string last_error;
+};
+
+// Children that the consumer has moved elsewhere are already marked as released
+void release_schema(ArrowSchema* schema) {
+  for (auto child_id = int64_t{0}; child_id < schema->n_children; ++child_id) {
+    auto* const child = schema->children[child_id];
+    if (child->release) child->release(child);
+  }
+  delete static_cast<SchemaData*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+void release_array(ArrowArray* array) {
+  for (auto child_id = int64_t{0}; child_id < array->n_children; ++child_id) {
+    auto* const child = array->children[child_id];
+    if (child->release) child->release(child);
+  }
+  delete static_cast<ArrayData*>(array->private_data);
+  array->release = nullptr;
+}
+
+void export_column_schema(const Table& table, const ColumnID column_id, ArrowSchema* schema) {
+  auto data = std::make_unique<SchemaData>();
+  data->name = table.column_name(column_id);
+
+  *schema = ArrowSchema{};
+  schema->format = arrow_format(table.column_data_type(column_id));
+  schema->name = data->name.c_str();
+  schema->flags = table.column_is_nullable(column_id) ? ARROW_FLAG_NULLABLE : 0;
+  schema->release = release_schema;
+  schema->private_data = data.release();
+}
+
+void export_segment(const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type,
+                    const bool is_immutable, ArrowArray* array) {
+  auto data = std::make_unique<ArrayData>();
+  const auto size = segment->size();
+  auto null_count = int64_t{0};
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // The values of mutable chunks may still be appended to, so that only immutable ones are exported without copying
+    if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+      const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+      if (value_segment && is_immutable) {
+        data->segment = segment;
+        data->buffers = {nullptr, value_segment->values().data()};
+        if (!value_segment->is_nullable()) return;
+
+        const auto& null_values = value_segment->null_values();
+        null_count = static_cast<int64_t>(null_values.count());
+        if (null_count == 0) return;
+
+        data->validity.reserve(null_values.words().size());
+        for (const auto word : null_values.words()) {
+          data->validity.emplace_back(~word);
+        }
+        data->buffers[0] = data->validity.data();
+        return;
+      }
+    }
+
+    data->validity.resize((size + NullBitmap::BITS_PER_WORD - 1) / NullBitmap::BITS_PER_WORD, ~ValidityWord{0});
+    auto values = std::make_shared<std::conditional_t<std::is_same_v<ColumnDataType, pmr_string>, std::string,
+                                                      std::vector<ColumnDataType>>>();
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      data->offsets.reserve(size + 1);
+      data->offsets.emplace_back(0);
+    } else {
+      values->resize(size);
+    }
+
+    auto row_id = size_t{0};
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      if (position.is_null()) {
+        const auto bit = ValidityWord{1} << (row_id % NullBitmap::BITS_PER_WORD);
+        data->validity[row_id / NullBitmap::BITS_PER_WORD] &= ~bit;
+        ++null_count;
+      } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        values->append(position.value());
+      } else {
+        (*values)[row_id] = position.value();
+      }
+
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        Assert(values->size() <= std::numeric_limits<int32_t>::max(), "Strings of a chunk exceed 2 GB");
+        data->offsets.emplace_back(static_cast<int32_t>(values->size()));
+      }
+      ++row_id;
+    });
+
+    const auto* const validity = null_count > 0 ? data->validity.data() : nullptr;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      data->buffers = {validity, data->offsets.data(), values->data()};
+    } else {
+      data->buffers = {validity, values->data()};
+    }
+    data->values = std::move(values);
+  });
+
+  *array = ArrowArray{};
+  array->length = static_cast<int64_t>(size);
+  array->null_count = null_count;
+  array->n_buffers = static_cast<int64_t>(data->buffers.size());
+  array->buffers = data->buffers.data();
+  array->release = release_array;
+  array->private_data = data.release();
+}
+
+// Exceptions must not leave the callbacks of the consumer. Failures are reported by an errno code and get_last_error.
+template <typename Functor>
+int handle_stream_call(ArrowArrayStream* stream, const Functor& functor) {
+  auto& data = *static_cast<StreamData*>(stream->private_data);
+  try {
+    functor(data);
+    data.last_error.clear();
+    return 0;
+  } catch (const std::exception& exception) {
+    data.last_error = exception.what();
+    return EIO;
+  }
+}
+
+int stream_get_schema(ArrowArrayStream* stream, ArrowSchema* out_schema) {
+  return handle_stream_call(stream, [&](StreamData& data) { ArrowExporter::export_schema(*data.table, out_schema); });
+}
+
+int stream_get_next(ArrowArrayStream* stream, ArrowArray* out_array) {
+  return handle_stream_call(stream, [&](StreamData& data) {
+    const auto chunk_count = data.table->chunk_count();
+    while (data.next_chunk_id < chunk_count) {
+      const auto chunk_id = data.next_chunk_id;
+      ++data.next_chunk_id;
+
+      const auto chunk = data.table->get_chunk(chunk_id);
+      if (chunk && chunk->size() > 0) {
+        ArrowExporter::export_chunk(data.table, chunk_id, out_array);
+        return;
+      }
+    }
+
+    // A released array marks the end of the stream
+    *out_array = ArrowArray{};
+  });
+}
+
+const char* stream_get_last_error(ArrowArrayStream* stream) {
+  const auto& last_error = static_cast<StreamData*>(stream->private_data)->last_error;
+  return last_error.empty() ? nullptr : last_error.c_str();
+}
+
+void release_stream(ArrowArrayStream* stream) {
+  delete static_cast<StreamData*>(stream->private_data);
+  stream->release = nullptr;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void ArrowExporter::export_schema(const Table& table, ArrowSchema* out_schema) {
+  const auto column_count = table.column_count();
+  auto data = std::make_unique<SchemaData>();
+  data->children.resize(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    export_column_schema(table, column_id, &data->children[column_id]);
+    data->child_pointers.emplace_back(&data->children[column_id]);
+  }
+
+  *out_schema = ArrowSchema{};
+  out_schema->format = "+s";
+  out_schema->name = "";
+  out_schema->n_children = static_cast<int64_t>(column_count);
+  out_schema->children = data->child_pointers.data();
+  out_schema->release = release_schema;
+  out_schema->private_data = data.release();
+}
+
+void ArrowExporter::export_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                                 ArrowArray* out_array) {
+  const auto chunk = table->get_chunk(chunk_id);
+  Assert(chunk, "Cannot export a chunk that has been removed");
+
+  const auto column_count = table->column_count();
+  auto data = std::make_unique<ArrayData>();
+  data->buffers = {nullptr};
+  data->children.resize(column_count);
+  try {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      export_segment(chunk->get_segment(column_id), table->column_data_type(column_id), !chunk->is_mutable(),
+                     &data->children[column_id]);
+      data->child_pointers.emplace_back(&data->children[column_id]);
+    }
+  } catch (...) {
+    for (auto* const child : data->child_pointers) {
+      child->release(child);
+    }
+    throw;
+  }
+
+  *out_array = ArrowArray{};
+  out_array->length = static_cast<int64_t>(chunk->size());
+  out_array->n_buffers = 1;
+  out_array->n_children = static_cast<int64_t>(column_count);
+  out_array->buffers = data->buffers.data();
+  out_array->children = data->child_pointers.data();
+  out_array->release = release_array;
+  out_array->private_data = data.release();
+}
+
+void ArrowExporter::export_table(const std::shared_ptr<const Table>& table, ArrowArrayStream* out_stream) {
+  auto data = std::make_unique<StreamData>();
+  data->table = table;
+
+  *out_stream = ArrowArrayStream{};
+  out_stream->get_schema = stream_get_schema;
+  out_stream->get_next = stream_get_next;
+  out_stream->get_last_error = stream_get_last_error;
+  out_stream->release = release_stream;
+  out_stream->private_data = data.release();
+}
+
+}  // namespace opossum
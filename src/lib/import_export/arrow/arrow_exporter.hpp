@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+
+#include "import_export/arrow/arrow_c_data_interface.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/*
+ * This exporter hands tables to Arrow-based consumers (e.g., pyarrow and pandas in the same process) through the Arrow
+ * C Data Interface, without converting the values to AllTypeVariants or text. Unlike the ArrowWriter, it does not
+ * require the Arrow library.
+ *
+ * Each chunk becomes a struct array whose children are the columns. The numeric values of ValueSegments in immutable
+ * chunks are not copied, the exported arrays reference them and keep the segments alive until they are released.
+ * Values of other segments (e.g., encoded or reference segments) and all strings are materialized once. NULL flags are
+ * converted into Arrow's validity bitmaps.
+ *
+ * The exported structs are owned by the consumer, which has to call their release callbacks. As with ArrowWriter,
+ * NULL columns cannot be exported.
+ */
+class ArrowExporter {
+ public:
+  // Exports the column names, types, and nullability as a struct schema with one child per column.
+  static void export_schema(const Table& table, ArrowSchema* out_schema);
+
+  // Exports the chunk as a struct array that matches the schema of export_schema().
+  static void export_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, ArrowArray* out_array);
+
+  // Exports the table as a stream of its non-empty chunks (Arrow C Stream Interface), e.g., for
+  // pyarrow.RecordBatchReader._import_from_c().
+  static void export_table(const std::shared_ptr<const Table>& table, ArrowArrayStream* out_stream);
+};
+
+}  // namespace opossum
@@ -0,0 +1,302 @@
+#include "arrow_parser.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HYRISE_ARROW_SUPPORT
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/file_reader.h>
+
+#endif
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "utils/assert.hpp"
+
+#if HYRISE_ARROW_SUPPORT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void assert_ok(const arrow::Status& status, const std::string& filename) {
+  Assert(status.ok(), "Could not read " + filename + ": " + status.ToString());
+}
+
+template <typename T>
+T value_or_fail(arrow::Result<T>&& result, const std::string& filename) {
+  assert_ok(result.status(), filename);
+  return std::move(result).ValueUnsafe();
+}
+
+// The requested columns of one row group (Parquet) or record batch (Arrow IPC)
+using ArrowColumns = std::vector<std::shared_ptr<arrow::ChunkedArray>>;
+
+// Gives the parser uniform access to the row groups of Parquet files and the record batches of Arrow IPC files
+struct ArrowFile {
+  std::shared_ptr<arrow::Schema> schema;
+  size_t row_group_count;
+  std::function<ArrowColumns(const size_t row_group, const std::vector<int>& column_indices)> read_row_group;
+};
+
+ArrowFile open_parquet_file(const std::string& filename) {
+  auto file = value_or_fail(arrow::io::MemoryMappedFile::Open(filename, arrow::io::FileMode::READ), filename);
+  auto parquet_reader = parquet::ParquetFileReader::Open(file);
+  const auto& parquet_schema = *parquet_reader->metadata()->schema();
+
+  // Read the string columns as dictionary arrays, so that dictionary pages are not decoded into individual values
+  auto properties = parquet::default_arrow_reader_properties();
+  properties.set_use_threads(true);
+  for (auto column_index = 0; column_index < parquet_schema.num_columns(); ++column_index) {
+    if (parquet_schema.Column(column_index)->physical_type() == parquet::Type::BYTE_ARRAY) {
+      properties.set_read_dictionary(column_index, true);
+    }
+  }
+
+  auto reader = std::unique_ptr<parquet::arrow::FileReader>{};
+  assert_ok(parquet::arrow::FileReader::Make(arrow::default_memory_pool(), std::move(parquet_reader), properties,
+                                             &reader),
+            filename);
+
+  auto schema = std::shared_ptr<arrow::Schema>{};
+  assert_ok(reader->GetSchema(&schema), filename);
+  Assert(schema->num_fields() == parquet_schema.num_columns(), "Nested Parquet columns are not supported");
+
+  const auto row_group_count = static_cast<size_t>(reader->num_row_groups());
+  auto shared_reader = std::shared_ptr<parquet::arrow::FileReader>{std::move(reader)};
+  return {schema, row_group_count, [shared_reader, filename](const auto row_group, const auto& column_indices) {
+            auto table = std::shared_ptr<arrow::Table>{};
+            assert_ok(shared_reader->ReadRowGroup(static_cast<int>(row_group), column_indices, &table), filename);
+            return table->columns();
+          }};
+}
+
+ArrowFile open_ipc_file(const std::string& filename) {
+  auto file = value_or_fail(arrow::io::MemoryMappedFile::Open(filename, arrow::io::FileMode::READ), filename);
+  auto reader = value_or_fail(arrow::ipc::RecordBatchFileReader::Open(file), filename);
+
+  const auto row_group_count = static_cast<size_t>(reader->num_record_batches());
+  return {reader->schema(), row_group_count, [reader, filename](const auto row_group, const auto& column_indices) {
+            const auto batch = value_or_fail(reader->ReadRecordBatch(static_cast<int>(row_group)), filename);
+            auto columns = ArrowColumns{};
+            columns.reserve(column_indices.size());
+            for (const auto column_index : column_indices) {
+              columns.emplace_back(std::make_shared<arrow::ChunkedArray>(batch->column(column_index)));
+            }
+            return columns;
+          }};
+}
+
+DataType data_type_from_arrow_type(const arrow::DataType& arrow_type) {
+  switch (arrow_type.id()) {
+    case arrow::Type::INT32:
+      return DataType::Int;
+    case arrow::Type::INT64:
+      return DataType::Long;
+    case arrow::Type::FLOAT:
+      return DataType::Float;
+    case arrow::Type::DOUBLE:
+      return DataType::Double;
+    case arrow::Type::STRING:
+    case arrow::Type::LARGE_STRING:
+      return DataType::String;
+    case arrow::Type::DICTIONARY: {
+      const auto value_type = static_cast<const arrow::DictionaryType&>(arrow_type).value_type()->id();
+      Assert(value_type == arrow::Type::STRING || value_type == arrow::Type::LARGE_STRING,
+             "Only string dictionaries are supported, got " + arrow_type.ToString());
+      return DataType::String;
+    }
+    default:
+      Fail("Unsupported Arrow type " + arrow_type.ToString());
+  }
+}
+
+// Calls functor(index, std::string_view) for all values of a (large) string array
+template <typename Functor>
+void for_each_string(const arrow::Array& array, const Functor& functor) {
+  const auto visit = [&](const auto& string_array) {
+    const auto length = string_array.length();
+    for (auto index = int64_t{0}; index < length; ++index) {
+      functor(index, std::string_view{string_array.GetView(index)});
+    }
+  };
+
+  if (array.type_id() == arrow::Type::LARGE_STRING) {
+    visit(static_cast<const arrow::LargeStringArray&>(array));
+  } else {
+    Assert(array.type_id() == arrow::Type::STRING, "Expected a string array, got " + array.type()->ToString());
+    visit(static_cast<const arrow::StringArray&>(array));
+  }
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> create_value_segment(const arrow::ChunkedArray& column, const bool nullable) {
+  const auto row_count = static_cast<size_t>(column.length());
+  auto values = pmr_vector<T>(row_count);
+  auto null_values = pmr_vector<bool>(nullable ? row_count : 0);
+
+  auto offset = size_t{0};
+  for (const auto& array : column.chunks()) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      for_each_string(*array, [&](const auto index, const auto value) {
+        values[offset + index] = pmr_string{value.data(), value.size()};
+      });
+    } else {
+      using ArrowArray = arrow::NumericArray<typename arrow::CTypeTraits<T>::ArrowType>;
+      const auto* const raw_values = static_cast<const ArrowArray&>(*array).raw_values();
+      std::copy(raw_values, raw_values + array->length(), values.begin() + offset);
+    }
+
+    if (nullable) {
+      for (auto index = int64_t{0}; index < array->length(); ++index) {
+        null_values[offset + index] = array->IsNull(index);
+      }
+    } else {
+      Assert(array->null_count() == 0, "Found NULL values in a column that is not nullable");
+    }
+
+    offset += array->length();
+  }
+
+  if (!nullable) return std::make_shared<ValueSegment<T>>(std::move(values));
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+// The arrays of a row group can have different dictionaries, which are unified into the sorted dictionary of the
+// segment. The value IDs of the rows are found by mapping their dictionary indices, without decoding their values.
+std::shared_ptr<AbstractSegment> create_dictionary_segment(const arrow::ChunkedArray& column) {
+  auto dictionary = std::make_shared<pmr_vector<pmr_string>>();
+  for (const auto& array : column.chunks()) {
+    const auto& array_dictionary = *static_cast<const arrow::DictionaryArray&>(*array).dictionary();
+    Assert(array_dictionary.null_count() == 0, "NULL values in Arrow dictionaries are not supported");
+    for_each_string(array_dictionary, [&](const auto /* index */, const auto value) {
+      dictionary->emplace_back(value.data(), value.size());
+    });
+  }
+  std::sort(dictionary->begin(), dictionary->end());
+  dictionary->erase(std::unique(dictionary->begin(), dictionary->end()), dictionary->end());
+  dictionary->shrink_to_fit();
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+  auto attribute_vector = pmr_vector<uint32_t>(static_cast<size_t>(column.length()));
+
+  auto offset = size_t{0};
+  for (const auto& array : column.chunks()) {
+    const auto& dictionary_array = static_cast<const arrow::DictionaryArray&>(*array);
+
+    auto value_ids = std::vector<uint32_t>(static_cast<size_t>(dictionary_array.dictionary()->length()));
+    for_each_string(*dictionary_array.dictionary(), [&](const auto index, const auto value) {
+      const auto it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), value);
+      value_ids[index] = static_cast<uint32_t>(std::distance(dictionary->cbegin(), it));
+    });
+
+    for (auto index = int64_t{0}; index < dictionary_array.length(); ++index) {
+      attribute_vector[offset + index] =
+          dictionary_array.IsNull(index) ? null_value_id : value_ids[dictionary_array.GetValueIndex(index)];
+    }
+
+    offset += dictionary_array.length();
+  }
+
+  const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+      compress_vector(attribute_vector, VectorCompressionType::FixedSizeByteAligned, {}, {null_value_id}));
+  return std::make_shared<DictionarySegment<pmr_string>>(dictionary, compressed_attribute_vector);
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> create_segment(const arrow::ChunkedArray& column, const bool nullable) {
+  if (column.type()->id() == arrow::Type::DICTIONARY) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return create_dictionary_segment(column);
+    } else {
+      Fail("Only string columns can be dictionary-encoded");
+    }
+  }
+
+  return create_value_segment<T>(column, nullable);
+}
+
+}  // namespace
+
+#endif
+
+namespace opossum {
+
+std::shared_ptr<Table> ArrowParser::parse(const std::string& filename, const FileType file_type,
+                                          const ChunkOffset chunk_size, const std::vector<std::string>& column_names,
+                                          const std::vector<size_t>& row_groups) {
+#if HYRISE_ARROW_SUPPORT
+  Assert(file_type == FileType::Parquet || file_type == FileType::Arrow, "ArrowParser only reads Parquet and Arrow");
+  const auto arrow_file = file_type == FileType::Parquet ? open_parquet_file(filename) : open_ipc_file(filename);
+  const auto& schema = *arrow_file.schema;
+
+  auto column_indices = std::vector<int>{};
+  if (column_names.empty()) {
+    column_indices.resize(schema.num_fields());
+    std::iota(column_indices.begin(), column_indices.end(), 0);
+  } else {
+    for (const auto& column_name : column_names) {
+      // GetFieldIndex also returns -1 if the name is ambiguous
+      const auto column_index = schema.GetFieldIndex(column_name);
+      Assert(column_index != -1, "Column '" + column_name + "' not found in " + filename);
+      column_indices.emplace_back(column_index);
+    }
+  }
+  Assert(!column_indices.empty(), "Cannot import a table without columns");
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (const auto column_index : column_indices) {
+    const auto& field = *schema.field(column_index);
+    column_definitions.emplace_back(field.name(), data_type_from_arrow_type(*field.type()), field.nullable());
+  }
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+
+  auto selected_row_groups = row_groups;
+  if (selected_row_groups.empty()) {
+    selected_row_groups.resize(arrow_file.row_group_count);
+    std::iota(selected_row_groups.begin(), selected_row_groups.end(), size_t{0});
+  }
+
+  for (const auto row_group : selected_row_groups) {
+    Assert(row_group < arrow_file.row_group_count,
+           "Row group " + std::to_string(row_group) + " not found in " + filename);
+
+    const auto columns = arrow_file.read_row_group(row_group, column_indices);
+    const auto row_count = static_cast<size_t>(columns.front()->length());
+    if (row_count == 0) continue;
+    Assert(row_count <= Chunk::MAX_SIZE, "Row group " + std::to_string(row_group) + " exceeds the maximum chunk size");
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      resolve_data_type(table->column_data_type(column_id), [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto nullable = table->column_is_nullable(column_id);
+        segments.emplace_back(create_segment<ColumnDataType>(*columns[column_id], nullable));
+      });
+    }
+
+    table->append_chunk(segments, std::make_shared<MvccData>(row_count, CommitID{0}));
+    table->last_chunk()->finalize();
+  }
+
+  return table;
+#else
+  Fail("Hyrise was built without Arrow support, which is required to read Parquet and Arrow files");
+#endif
+}
+
+}  // namespace opossum
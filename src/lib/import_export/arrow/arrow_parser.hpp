@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "import_export/file_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/*
+ * This parser reads Apache Parquet and Arrow IPC files through the Arrow library and creates a table from them. It is
+ * only available if Hyrise was built with Arrow support (see ENABLE_ARROW_SUPPORT), otherwise, parse() fails.
+ *
+ * Each row group of a Parquet file and each record batch of an Arrow IPC file becomes one chunk. Only the requested
+ * columns and row groups are decoded. Dictionary-encoded string columns (i.e., dictionary pages of Parquet files and
+ * dictionary arrays of Arrow IPC files) are turned into DictionarySegments directly: only the dictionary is sorted,
+ * and the attribute vector is created by mapping the dictionary indices instead of looking up every value.
+ *
+ * Supported Arrow types are int32, int64, float, double, and (large) utf8 strings, possibly dictionary-encoded.
+ */
+class ArrowParser {
+ public:
+  /*
+   * @param filename      Path to the input file.
+   * @param file_type     FileType::Parquet or FileType::Arrow.
+   * @param chunk_size    Target chunk size of the table. The chunks are sized by the row groups of the file.
+   * @param column_names  Columns to import, in this order. If empty, all columns are imported.
+   * @param row_groups    Row groups (or record batches) to import. If empty, all row groups are imported.
+   * @returns             The table that was created from the file.
+   */
+  static std::shared_ptr<Table> parse(const std::string& filename, const FileType file_type,
+                                      const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
+                                      const std::vector<std::string>& column_names = {},
+                                      const std::vector<size_t>& row_groups = {});
+};
+
+}  // namespace opossum
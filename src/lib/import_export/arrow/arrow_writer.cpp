@@ -0,0 +1,142 @@
+#include "arrow_writer.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HYRISE_ARROW_SUPPORT
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <parquet/arrow/writer.h>
+
+#endif
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+#if HYRISE_ARROW_SUPPORT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void assert_ok(const arrow::Status& status, const std::string& filename) {
+  Assert(status.ok(), "Could not write " + filename + ": " + status.ToString());
+}
+
+template <typename T>
+T value_or_fail(arrow::Result<T>&& result, const std::string& filename) {
+  assert_ok(result.status(), filename);
+  return std::move(result).ValueUnsafe();
+}
+
+template <typename T>
+struct ArrowBuilder {
+  using type = typename arrow::TypeTraits<typename arrow::CTypeTraits<T>::ArrowType>::BuilderType;
+};
+
+template <>
+struct ArrowBuilder<pmr_string> {
+  using type = arrow::StringBuilder;
+};
+
+std::shared_ptr<arrow::DataType> arrow_type_from_data_type(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return arrow::int32();
+    case DataType::Long:
+      return arrow::int64();
+    case DataType::Float:
+      return arrow::float32();
+    case DataType::Double:
+      return arrow::float64();
+    case DataType::String:
+      return arrow::utf8();
+    case DataType::Null:
+      Fail("Cannot write NULL columns");
+  }
+  Fail("Unknown data type");
+}
+
+std::shared_ptr<arrow::Array> create_array(const AbstractSegment& segment, const DataType data_type,
+                                           const std::string& filename) {
+  auto array = std::shared_ptr<arrow::Array>{};
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto builder = typename ArrowBuilder<ColumnDataType>::type{};
+    assert_ok(builder.Reserve(segment.size()), filename);
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        assert_ok(builder.AppendNull(), filename);
+      } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        const auto& value = position.value();
+        assert_ok(builder.Append(value.data(), static_cast<int32_t>(value.size())), filename);
+      } else {
+        assert_ok(builder.Append(position.value()), filename);
+      }
+    });
+    assert_ok(builder.Finish(&array), filename);
+  });
+  return array;
+}
+
+}  // namespace
+
+#endif
+
+namespace opossum {
+
+void ArrowWriter::write(const Table& table, const std::string& filename, const FileType file_type) {
+#if HYRISE_ARROW_SUPPORT
+  Assert(file_type == FileType::Parquet || file_type == FileType::Arrow, "ArrowWriter only writes Parquet and Arrow");
+
+  auto fields = arrow::FieldVector{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto arrow_type = arrow_type_from_data_type(table.column_data_type(column_id));
+    fields.emplace_back(arrow::field(table.column_name(column_id), arrow_type, table.column_is_nullable(column_id)));
+  }
+  const auto schema = arrow::schema(fields);
+
+  auto output = value_or_fail(arrow::io::FileOutputStream::Open(filename), filename);
+  auto parquet_writer = std::unique_ptr<parquet::arrow::FileWriter>{};
+  auto ipc_writer = std::shared_ptr<arrow::ipc::RecordBatchWriter>{};
+  if (file_type == FileType::Parquet) {
+    parquet_writer =
+        value_or_fail(parquet::arrow::FileWriter::Open(*schema, arrow::default_memory_pool(), output), filename);
+  } else {
+    ipc_writer = value_or_fail(arrow::ipc::MakeFileWriter(output, schema), filename);
+  }
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    auto arrays = arrow::ArrayVector{};
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      arrays.emplace_back(create_array(*chunk->get_segment(column_id), table.column_data_type(column_id), filename));
+    }
+
+    // One row group or record batch per chunk
+    if (parquet_writer) {
+      const auto arrow_table = arrow::Table::Make(schema, arrays, chunk->size());
+      assert_ok(parquet_writer->WriteTable(*arrow_table, chunk->size()), filename);
+    } else {
+      assert_ok(ipc_writer->WriteRecordBatch(*arrow::RecordBatch::Make(schema, chunk->size(), arrays)), filename);
+    }
+  }
+
+  assert_ok(parquet_writer ? parquet_writer->Close() : ipc_writer->Close(), filename);
+  assert_ok(output->Close(), filename);
+#else
+  Fail("Hyrise was built without Arrow support, which is required to write Parquet and Arrow files");
+#endif
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+#include "import_export/file_type.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/*
+ * This writer stores a table as an Apache Parquet or Arrow IPC file through the Arrow library. It is only available if
+ * Hyrise was built with Arrow support (see ENABLE_ARROW_SUPPORT), otherwise, write() fails.
+ *
+ * Each chunk becomes one row group of the Parquet file or one record batch of the Arrow IPC file, so that importing
+ * the file with the ArrowParser restores the chunks. The values are written unencoded; the Parquet writer applies its
+ * own dictionary encoding.
+ */
+class ArrowWriter {
+ public:
+  /*
+   * @param table      The table to write.
+   * @param filename   Path to the output file.
+   * @param file_type  FileType::Parquet or FileType::Arrow.
+   */
+  static void write(const Table& table, const std::string& filename, const FileType file_type);
+};
+
+}  // namespace opossum
@@ -1,18 +1,28 @@
 #include "binary_parser.hpp"
 
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/statistics_objects/blocked_bloom_filter.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "storage/vector_compression/simd_bp128/oversized_types.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
@@ -22,63 +32,102 @@
 namespace opossum {
 
 std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  const auto mapped_file = MemoryMappedFile{filename};
+  auto file = FileReader{mapped_file};
+
+  const auto [table, chunk_count] = _read_header(file);
+  const auto chunk_offsets = _read_values<uint64_t>(file, static_cast<size_t>(chunk_count));
+  const auto table_statistics_offset = _read_value<uint64_t>(file);
+  const auto chunks_end = table_statistics_offset != 0 ? table_statistics_offset : mapped_file.size();
+  Assert(chunks_end <= mapped_file.size(), "Invalid table statistics offset in binary file");
+
+  // Each chunk is imported by its own task, which reads the range from its offset to the offset of the next chunk
+  auto imported_chunks = std::vector<ImportedChunk>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto begin = chunk_offsets[chunk_id];
+    const auto end = chunk_id + 1 < chunk_count ? chunk_offsets[chunk_id + 1] : chunks_end;
+    Assert(begin <= end && end <= chunks_end, "Invalid chunk offsets in binary file");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, begin, end, &output_table = *table]() {
+      auto chunk_file = FileReader{mapped_file, begin, end};
+      imported_chunks[chunk_id] = _import_chunk(chunk_file, output_table);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto& [segments, row_count, sorted_columns, pruning_statistics] : imported_chunks) {
+    table->append_chunk(segments, std::make_shared<MvccData>(row_count, CommitID{0}));
+    table->last_chunk()->finalize();
+    if (!sorted_columns.empty()) table->last_chunk()->set_individually_sorted_by(sorted_columns);
+    if (pruning_statistics) table->last_chunk()->set_pruning_statistics(pruning_statistics);
+  }
 
-  auto [table, chunk_count] = _read_header(file);
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+  if (table_statistics_offset != 0) {
+    auto statistics_file = FileReader{mapped_file, table_statistics_offset, mapped_file.size()};
+    table->set_table_statistics(_import_table_statistics(statistics_file, *table));
   }
 
   return table;
 }
 
+BinaryParser::FileReader::FileReader(const MemoryMappedFile& file) : FileReader(file, 0, file.size()) {}
+
+BinaryParser::FileReader::FileReader(const MemoryMappedFile& file, const size_t begin, const size_t end)
+    : _position(file.data() + begin), _end(file.data() + end) {}
+
+const char* BinaryParser::FileReader::consume(const size_t byte_count) {
+  Assert(byte_count <= static_cast<size_t>(_end - _position), "Unexpected end of binary file");
+  const auto* const begin = _position;
+  _position += byte_count;
+  return begin;
+}
+
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(FileReader& file, const size_t count) {
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  if (count > 0) std::memcpy(values.data(), file.consume(count * sizeof(T)), count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(FileReader& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
-  return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
+pmr_vector<bool> BinaryParser::_read_values(FileReader& file, const size_t count) {
+  static_assert(sizeof(BoolAsByteType) == 1, "Bools are expected to be stored as single bytes");
+  const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(file.consume(count));
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(FileReader& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  // The characters are copied directly from the mapped file into the strings.
+  const auto* buffer = file.consume(total_length);
 
   pmr_vector<pmr_string> values(count);
-  size_t start = 0;
-
   for (size_t i = 0; i < count; ++i) {
-    values[i] = pmr_string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
-    start += string_lengths[i];
+    values[i] = pmr_string(buffer, buffer + string_lengths[i]);
+    buffer += string_lengths[i];
   }
 
   return values;
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(FileReader& file) {
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, file.consume(sizeof(T)), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(FileReader& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -98,7 +147,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+BinaryParser::ImportedChunk BinaryParser::_import_chunk(FileReader& file, const Table& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   // Import sort column definitions
@@ -111,18 +160,108 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   }
 
   Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_segment(file, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
+  }
+
+  auto pruning_statistics = std::optional<ChunkPruningStatistics>{};
+  if (_read_value<bool>(file)) {
+    pruning_statistics.emplace(table.column_count());
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      (*pruning_statistics)[column_id] = _import_attribute_statistics(file, table.column_data_type(column_id));
+    }
+  }
+
+  return {std::move(output_segments), row_count, std::move(sorted_columns), std::move(pruning_statistics)};
+}
+
+std::shared_ptr<TableStatistics> BinaryParser::_import_table_statistics(FileReader& file, const Table& table) {
+  const auto row_count = _read_value<Cardinality>(file);
+  const auto represented_chunk_count = _read_value<uint32_t>(file);
+  const auto represented_chunk_sizes = _read_values<ChunkOffset>(file, represented_chunk_count);
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(table.column_count());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    column_statistics[column_id] = _import_attribute_statistics(file, table.column_data_type(column_id));
+  }
+
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+  table_statistics->column_group_statistics = std::make_shared<ColumnGroupStatistics>();
+  table_statistics->represented_chunk_sizes.assign(represented_chunk_sizes.cbegin(), represented_chunk_sizes.cend());
+  return table_statistics;
+}
+
+std::shared_ptr<BaseAttributeStatistics> BinaryParser::_import_attribute_statistics(FileReader& file,
+                                                                                    DataType data_type) {
+  std::shared_ptr<BaseAttributeStatistics> result;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    result = _import_attribute_statistics<ColumnDataType>(file);
+  });
+
+  return result;
+}
+
+template <typename T>
+std::shared_ptr<AttributeStatistics<T>> BinaryParser::_import_attribute_statistics(FileReader& file) {
+  const auto attribute_statistics = std::make_shared<AttributeStatistics<T>>();
+
+  if (_read_value<bool>(file)) {
+    const auto bin_count = _read_value<uint32_t>(file);
+    const auto bin_minima = _read_values<T>(file, bin_count);
+    const auto bin_maxima = _read_values<T>(file, bin_count);
+    const auto bin_heights = _read_values<HistogramCountType>(file, bin_count);
+    const auto bin_distinct_counts = _read_values<HistogramCountType>(file, bin_count);
+    attribute_statistics->set_statistics_object(std::make_shared<GenericHistogram<T>>(
+        std::vector<T>(bin_minima.cbegin(), bin_minima.cend()), std::vector<T>(bin_maxima.cbegin(), bin_maxima.cend()),
+        std::vector<HistogramCountType>(bin_heights.cbegin(), bin_heights.cend()),
+        std::vector<HistogramCountType>(bin_distinct_counts.cbegin(), bin_distinct_counts.cend())));
   }
 
-  const auto mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
-  table->append_chunk(output_segments, mvcc_data);
-  table->last_chunk()->finalize();
-  if (num_sorted_columns > 0) table->last_chunk()->set_individually_sorted_by(sorted_columns);
+  if (_read_value<bool>(file)) {
+    const auto min_max = _read_values<T>(file, 2);
+    attribute_statistics->set_statistics_object(std::make_shared<MinMaxFilter<T>>(min_max[0], min_max[1]));
+  }
+
+  if (_read_value<bool>(file)) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      const auto range_count = _read_value<uint32_t>(file);
+      const auto range_minima = _read_values<T>(file, range_count);
+      const auto range_maxima = _read_values<T>(file, range_count);
+      auto ranges = std::vector<std::pair<T, T>>(range_count);
+      for (auto range_id = uint32_t{0}; range_id < range_count; ++range_id) {
+        ranges[range_id] = {range_minima[range_id], range_maxima[range_id]};
+      }
+      attribute_statistics->set_statistics_object(std::make_shared<RangeFilter<T>>(std::move(ranges)));
+    } else {
+      Fail("RangeFilters are not supported for strings");
+    }
+  }
+
+  if (_read_value<bool>(file)) {
+    attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(_read_value<float>(file)));
+  }
+
+  if (_read_value<bool>(file)) {
+    const auto value_count = _read_value<Cardinality>(file);
+    const auto selectivity = _read_value<Selectivity>(file);
+    const auto registers = _read_values<uint8_t>(file, HyperLogLogSketch::REGISTER_COUNT);
+    attribute_statistics->set_statistics_object(std::make_shared<HyperLogLogSketch>(
+        std::vector<uint8_t>(registers.cbegin(), registers.cend()), value_count, selectivity));
+  }
+
+  if (_read_value<bool>(file)) {
+    const auto word_count = _read_value<uint32_t>(file);
+    const auto words = _read_values<uint64_t>(file, word_count);
+    attribute_statistics->set_statistics_object(
+        std::make_shared<BlockedBloomFilter<T>>(std::vector<uint64_t>(words.cbegin(), words.cend())));
+  }
+
+  return attribute_statistics;
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(FileReader& file, ChunkOffset row_count,
                                                                DataType data_type, bool column_is_nullable) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -134,7 +273,7 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(FileReader& file, ChunkOffset row_count,
                                                                bool column_is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -161,13 +300,20 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(FileReader& file, ChunkOffset row_count,
                                                                      bool column_is_nullable) {
   if (column_is_nullable) {
     const auto segment_is_nullable = _read_value<bool>(file);
@@ -183,7 +329,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(FileReader& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -195,7 +341,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    FileReader& file, ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -205,7 +351,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(FileReader& file,
                                                                               ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -216,7 +362,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(FileReader& file,
                                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -234,7 +380,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(FileReader& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -283,9 +429,30 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
   }
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(FileReader& file, ChunkOffset row_count) {
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbols = _read_values<uint64_t>(file, symbol_count);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = pmr_vector<bool>(_read_values<bool>(file, row_count));
+  }
+
+  auto offsets = _read_values<uint32_t>(file, row_count + size_t{1});
+  auto compressed_values = _read_values<char>(file, offsets.back());
+
+  return std::make_shared<FSSTSegment<pmr_string>>(FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)},
+                                                   std::move(compressed_values), std::move(offsets),
+                                                   std::move(null_values));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    FileReader& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
+    case 0:
+      return _import_bitpacking_vector(file, row_count);
     case 1:
       return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case 2:
@@ -298,8 +465,10 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    FileReader& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
+    case 0:
+      return _import_bitpacking_vector(file, row_count);
     case 1:
       return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case 2:
@@ -311,10 +480,17 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::unique_ptr<BitPackingVector> BinaryParser::_import_bitpacking_vector(FileReader& file, ChunkOffset row_count) {
+  const auto bit_width = _read_value<uint8_t>(file);
+  const auto word_count = _read_value<uint32_t>(file);
+  return std::make_unique<BitPackingVector>(_read_values<uint64_t>(file, word_count), bit_width, row_count);
+}
+
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(FileReader& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
-  pmr_vector<char> values(string_length * count);
-  file.read(values.data(), values.size());
+  const auto byte_count = static_cast<size_t>(string_length) * count;
+  const auto* const characters = file.consume(byte_count);
+  auto values = pmr_vector<char>(characters, characters + byte_count);
   return std::make_shared<FixedStringVector>(std::move(values), string_length);
 }
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -12,16 +11,29 @@
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
+class BitPackingVector;
+template <typename T>
+class AttributeStatistics;
+class TableStatistics;
+
 /*
  * This parser reads an Opossum binary file and creates a table from that input.
  * Documentation of the file formats can be found in BinaryWriter header file.
+ *
+ * The file is memory-mapped so that the chunks can be imported in parallel, each task reading the range between the
+ * chunk offsets of the header. This is an mmap-based reader for the existing, unversioned file format, not a zero-copy
+ * one: the segments own their data, and all values are copied from the mapping into the segments' vectors, as the file
+ * format does not align them and all segment types store their data in pmr_vectors. Importing a table therefore
+ * reads the whole file, and the mapping is released once parse() returns.
  */
 class BinaryParser {
  public:
@@ -29,83 +41,136 @@ class BinaryParser {
    * Reads the given binary file. The file must be in the following form:
    *
    * --------------
-   * |   Header   |
+   * |   Header¹  |
    * |------------|
-   * |   Chunks¹  |
+   * |   Chunks²  |
    * --------------
    *
-   * ¹ Zero or more chunks
+   * |------------|
+   * | Statistics³|
+   * --------------
+   *
+   * ¹ Including the offsets of the chunks and of the table statistics in the file
+   * ² Zero or more chunks, each followed by its pruning statistics if it has them
+   * ³ Optional table statistics
+   *
+   * Persisted table and pruning statistics are restored, so that neither TableStatistics::from_table() nor
+   * generate_chunk_pruning_statistics() need to scan the table when it is added to the StorageManager.
    */
   static std::shared_ptr<Table> parse(const std::string& filename);
 
  private:
+  // Sequential cursor over a memory-mapped binary file. Reading past the end of the file fails.
+  class FileReader {
+   public:
+    explicit FileReader(const MemoryMappedFile& file);
+
+    // Reads the bytes [begin, end) of the file only
+    FileReader(const MemoryMappedFile& file, const size_t begin, const size_t end);
+
+    // Returns a pointer to the next byte_count bytes and advances the cursor behind them. As the file format does not
+    // align values, the returned pointer must not be dereferenced as anything but char.
+    const char* consume(const size_t byte_count);
+
+   private:
+    const char* _position;
+    const char* const _end;
+  };
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(FileReader& file);
+
+  struct ImportedChunk {
+    Segments segments;
+    ChunkOffset row_count{0};
+    std::vector<SortColumnDefinition> sorted_columns;
+    std::optional<ChunkPruningStatistics> pruning_statistics;
+  };
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Creates the segments of a chunk from chunk information from the given file. The chunks are added to the table
+   * once all of them have been imported.
    * The chunk information has the following form:
    *
    * ----------------
    * |  Row count   |
    * |--------------|
    * |  Segments¹   |
+   * |--------------|
+   * |  Pruning     |
+   * |  statistics² |
    * ----------------
    *
    * ¹Number of columns is provided in the binary header
+   * ²Optional, preceded by a flag
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static ImportedChunk _import_chunk(FileReader& file, const Table& table);
+
+  // Reads the table statistics that follow the chunks, see BinaryWriter::_write_table_statistics()
+  static std::shared_ptr<TableStatistics> _import_table_statistics(FileReader& file, const Table& table);
+
+  // Calls the right _import_attribute_statistics<ColumnDataType> depending on the given data_type.
+  static std::shared_ptr<BaseAttributeStatistics> _import_attribute_statistics(FileReader& file, DataType data_type);
+
+  // Reads the statistics objects written by BinaryWriter::_write_attribute_statistics()
+  template <typename T>
+  static std::shared_ptr<AttributeStatistics<T>> _import_attribute_statistics(FileReader& file);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(FileReader& file, ChunkOffset row_count,
                                                           DataType data_type, bool column_is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(FileReader& file, ChunkOffset row_count,
                                                           bool column_is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(FileReader& file, ChunkOffset row_count,
                                                                 bool column_is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(FileReader& file, ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      FileReader& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(FileReader& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(FileReader& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(FileReader& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(FileReader& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(FileReader& file, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+      FileReader& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+
+  // Reads a bit-packed vector, i.e., an attribute vector or offset value vector with a width of 0.
+  static std::unique_ptr<BitPackingVector> _import_bitpacking_vector(FileReader& file, ChunkOffset row_count);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(FileReader& file, const size_t count);
 
-  // Reads row_count many values from type T and returns them in a vector
+  // Reads row_count many values from type T and copies them out of the mapping into a newly allocated vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(FileReader& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(FileReader& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(FileReader& file);
 };
 
 }  // namespace opossum
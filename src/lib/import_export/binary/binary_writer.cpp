@@ -1,16 +1,27 @@
 #include "binary_writer.hpp"
 
+#include <algorithm>
 #include <cstring>
-#include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/blocked_bloom_filter.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "utils/async_file_writer.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -20,18 +31,18 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the ostream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the strings are
+/* Writes the given strings to the ostream. First an array of string lengths is written. After that the strings are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
+void export_string_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
   pmr_vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -41,7 +52,7 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(ostream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -54,36 +65,42 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(ostream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values) {
+  ostream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
-void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
-  ofstream.write(values.data(), values.size() * values.string_length());
+void export_values(std::ostream& ostream, const FixedStringVector& values) {
+  ostream.write(values.data(), values.size() * values.string_length());
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
+  export_string_values(ostream, values);
 }
 
 // specialized implementation for bool values
 template <typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
+void export_values(std::ostream& ostream, const std::vector<bool, Alloc>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// NullBitmaps are written in the same format as bool vectors
+void export_values(std::ostream& ostream, const NullBitmap& values) {
+  const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
+  export_values(ostream, writable_bools);
+}
+
+// Writes a shallow copy of the given value to the ostream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& ostream, const T& value) {
+  ostream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
 }  // namespace
@@ -91,22 +108,67 @@ void export_value(std::ofstream& ofstream, const T& value) {
 namespace opossum {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
+  write(table, filename, table.table_statistics());
+}
 
-  _write_header(table, ofstream);
+void BinaryWriter::write(const Table& table, const std::string& filename,
+                         const std::shared_ptr<const TableStatistics>& table_statistics) {
+  // The serialized chunks are written by an AsyncFileWriter while the next batch of chunks is being serialized
+  auto writer = AsyncFileWriter{filename};
+  auto ostream = std::ostream{&writer};
+  ostream.exceptions(std::ostream::failbit | std::ostream::badbit);
+
+  _write_header(table, ostream);
+
+  // Reserve the chunk offset index. It is filled once the positions of the chunks are known.
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto index_position = ostream.tellp();
+  auto chunk_offsets = pmr_vector<uint64_t>(chunk_count);
+  export_values(ostream, chunk_offsets);
+  auto table_statistics_offset = uint64_t{0};
+  export_value(ostream, table_statistics_offset);
+
+  // The chunks are serialized in parallel, one batch of chunks at a time, so that at most one batch of serialized
+  // chunks is held in memory. The buffers are written in order.
+  const auto batch_size = std::max(size_t{1}, static_cast<size_t>(Hyrise::get().topology.num_cpus()));
+  auto buffers = std::vector<std::stringstream>(std::min(batch_size, chunk_count));
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& buffer = buffers[chunk_id - batch_begin];
+        buffer.str({});
+        buffer.clear();
+        _write_chunk(table, buffer, ChunkID{static_cast<ChunkID::base_type>(chunk_id)});
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      chunk_offsets[chunk_id] = static_cast<uint64_t>(ostream.tellp());
+      ostream << buffers[chunk_id - batch_begin].rdbuf();
+    }
+  }
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  if (table_statistics && table_statistics->column_statistics.size() == table.column_count()) {
+    table_statistics_offset = static_cast<uint64_t>(ostream.tellp());
+    _write_table_statistics(*table_statistics, ostream);
   }
+
+  ostream.seekp(index_position);
+  export_values(ostream, chunk_offsets);
+  export_value(ostream, table_statistics_offset);
+  writer.close();
 }
 
-void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+void BinaryWriter::_write_header(const Table& table, std::ostream& ostream) {
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
-  export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+  export_value(ostream, static_cast<ChunkOffset>(target_chunk_size));
+  export_value(ostream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(ostream, static_cast<ColumnID::base_type>(table.column_count()));
 
   pmr_vector<pmr_string> column_types(table.column_count());
   pmr_vector<pmr_string> column_names(table.column_count());
@@ -118,53 +180,205 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(ostream, column_types);
+  export_values(ostream, columns_are_nullable);
+  export_string_values(ostream, column_names);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+void BinaryWriter::_write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id) {
   const auto chunk = table.get_chunk(chunk_id);
   Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(ostream, static_cast<ChunkOffset>(chunk->size()));
 
   // Export sort column definitions
   const auto& sorted_columns = chunk->individually_sorted_by();
-  export_value(ofstream, static_cast<uint32_t>(sorted_columns.size()));
+  export_value(ostream, static_cast<uint32_t>(sorted_columns.size()));
   for (const auto& [column, sort_mode] : sorted_columns) {
-    export_value(ofstream, column);
-    export_value(ofstream, sort_mode);
+    export_value(ostream, column);
+    export_value(ostream, sort_mode);
   }
 
   // Iterating over all segments of this chunk and exporting them
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
     resolve_data_and_segment_type(*chunk->get_segment(column_id),
                                   [&](const auto data_type_t, const auto& resolved_segment) {
-                                    _write_segment(resolved_segment, table.column_is_nullable(column_id), ofstream);
+                                    _write_segment(resolved_segment, table.column_is_nullable(column_id), ostream);
                                   });
   }
+
+  const auto pruning_statistics = _pruning_statistics(*chunk);
+  export_value(ostream, static_cast<BoolAsByteType>(pruning_statistics.has_value()));
+  if (!pruning_statistics) return;
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto& segment_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[column_id]);
+      _write_attribute_statistics(segment_statistics, ostream);
+    });
+  }
+}
+
+std::optional<ChunkPruningStatistics> BinaryWriter::_pruning_statistics(const Chunk& chunk) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (pruning_statistics || chunk.column_count() == 0) return pruning_statistics;
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  if (!reference_segment) return std::nullopt;
+
+  const auto& pos_list = reference_segment->pos_list();
+  if (pos_list->empty() || !pos_list->references_single_chunk()) return std::nullopt;
+
+  // Validate and similar operators reference the columns of a single table in their original order. Other reference
+  // chunks (e.g., those created by projections) are written without pruning statistics.
+  const auto& referenced_table = reference_segment->referenced_table();
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+    if (!segment || segment->referenced_table() != referenced_table || segment->referenced_column_id() != column_id ||
+        segment->pos_list() != pos_list) {
+      return std::nullopt;
+    }
+  }
+
+  const auto referenced_chunk = referenced_table->get_chunk((*pos_list)[0].chunk_id);
+  if (!referenced_chunk || referenced_chunk->column_count() != chunk.column_count()) return std::nullopt;
+  return referenced_chunk->pruning_statistics();
+}
+
+void BinaryWriter::_write_table_statistics(const TableStatistics& table_statistics, std::ostream& ostream) {
+  export_value(ostream, table_statistics.row_count);
+  export_value(ostream, static_cast<uint32_t>(table_statistics.represented_chunk_sizes.size()));
+  export_values(ostream, table_statistics.represented_chunk_sizes);
+
+  for (const auto& column_statistics : table_statistics.column_statistics) {
+    resolve_data_type(column_statistics->data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _write_attribute_statistics(static_cast<const AttributeStatistics<ColumnDataType>&>(*column_statistics),
+                                  ostream);
+    });
+  }
+}
+
+template <typename T>
+void BinaryWriter::_write_attribute_statistics(const AttributeStatistics<T>& attribute_statistics,
+                                               std::ostream& ostream) {
+  const auto& histogram = attribute_statistics.histogram;
+  export_value(ostream, static_cast<BoolAsByteType>(histogram != nullptr));
+  if (histogram) {
+    const auto bin_count = histogram->bin_count();
+    auto bin_minima = pmr_vector<T>(bin_count);
+    auto bin_maxima = pmr_vector<T>(bin_count);
+    auto bin_heights = pmr_vector<HistogramCountType>(bin_count);
+    auto bin_distinct_counts = pmr_vector<HistogramCountType>(bin_count);
+    for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+      bin_minima[bin_id] = histogram->bin_minimum(bin_id);
+      bin_maxima[bin_id] = histogram->bin_maximum(bin_id);
+      bin_heights[bin_id] = histogram->bin_height(bin_id);
+      bin_distinct_counts[bin_id] = histogram->bin_distinct_count(bin_id);
+    }
+
+    export_value(ostream, static_cast<uint32_t>(bin_count));
+    export_values(ostream, bin_minima);
+    export_values(ostream, bin_maxima);
+    export_values(ostream, bin_heights);
+    export_values(ostream, bin_distinct_counts);
+  }
+
+  const auto& min_max_filter = attribute_statistics.min_max_filter;
+  export_value(ostream, static_cast<BoolAsByteType>(min_max_filter != nullptr));
+  if (min_max_filter) {
+    export_values(ostream, pmr_vector<T>{min_max_filter->min, min_max_filter->max});
+  }
+
+  // RangeFilters only exist for arithmetic types
+  if constexpr (std::is_arithmetic_v<T>) {
+    const auto& range_filter = attribute_statistics.range_filter;
+    export_value(ostream, static_cast<BoolAsByteType>(range_filter != nullptr));
+    if (range_filter) {
+      auto range_minima = pmr_vector<T>{};
+      auto range_maxima = pmr_vector<T>{};
+      range_minima.reserve(range_filter->ranges.size());
+      range_maxima.reserve(range_filter->ranges.size());
+      for (const auto& [range_minimum, range_maximum] : range_filter->ranges) {
+        range_minima.emplace_back(range_minimum);
+        range_maxima.emplace_back(range_maximum);
+      }
+
+      export_value(ostream, static_cast<uint32_t>(range_filter->ranges.size()));
+      export_values(ostream, range_minima);
+      export_values(ostream, range_maxima);
+    }
+  } else {
+    export_value(ostream, BoolAsByteType{false});
+  }
+
+  const auto& null_value_ratio = attribute_statistics.null_value_ratio;
+  export_value(ostream, static_cast<BoolAsByteType>(null_value_ratio != nullptr));
+  if (null_value_ratio) {
+    export_value(ostream, null_value_ratio->ratio);
+  }
+
+  const auto& sketch = attribute_statistics.distinct_count_sketch;
+  export_value(ostream, static_cast<BoolAsByteType>(sketch != nullptr));
+  if (sketch) {
+    export_value(ostream, sketch->value_count);
+    export_value(ostream, sketch->selectivity());
+    export_values(ostream, sketch->registers());
+  }
+
+  const auto& bloom_filter = attribute_statistics.bloom_filter;
+  export_value(ostream, static_cast<BoolAsByteType>(bloom_filter != nullptr));
+  if (bloom_filter) {
+    export_value(ostream, static_cast<uint32_t>(bloom_filter->words.size()));
+    export_values(ostream, bloom_filter->words);
+  }
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Unencoded);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::Unencoded);
 
   if (column_is_nullable) {
-    export_value(ofstream, value_segment.is_nullable());
+    export_value(ostream, value_segment.is_nullable());
   }
 
   if (value_segment.is_nullable()) {
-    export_values(ofstream, value_segment.null_values());
+    export_values(ostream, value_segment.null_values());
+  }
+
+  export_values(ostream, value_segment.values());
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const RowGroupSegment<T>& row_group_segment, bool column_is_nullable,
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::Unencoded);
+
+  if (column_is_nullable) {
+    export_value(ostream, row_group_segment.is_nullable());
+  }
+
+  const auto segment_size = row_group_segment.size();
+  if (row_group_segment.is_nullable()) {
+    auto null_values = row_group_segment.null_values();
+    null_values.resize(segment_size);
+    export_values(ostream, null_values);
   }
 
-  export_values(ofstream, value_segment.values());
+  auto values = pmr_vector<T>{};
+  values.reserve(segment_size);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    values.emplace_back(row_group_segment.value(chunk_offset));
+  }
+  export_values(ostream, values);
 }
 
 void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
+                                  std::ostream& ostream) {
   // We materialize reference segments and save them as value segments
-  export_value(ofstream, EncodingType::Unencoded);
+  export_value(ostream, EncodingType::Unencoded);
 
   if (reference_segment.size() == 0) return;
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
@@ -181,154 +395,175 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, boo
         values << value.value();
       });
 
-      export_values(ofstream, string_lengths);
-      ofstream << values.rdbuf();
+      export_values(ostream, string_lengths);
+      ostream << values.rdbuf();
 
     } else {
       // Unfortunately, we have to iterate over all values of the reference segment
       // to materialize its contents. Then we can write them to the file
-      iterable.for_each([&](const auto& value) { export_value(ofstream, value.value()); });
+      iterable.for_each([&](const auto& value) { export_value(ostream, value.value()); });
     }
   });
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Dictionary);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::Dictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size and dictionary
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
-  export_values(ofstream, *dictionary_segment.dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
+  export_values(ostream, *dictionary_segment.dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *dictionary_segment.compressed_vector_type(),
                             *dictionary_segment.attribute_vector());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                                  bool column_is_nullable, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FixedStringDictionary);
+                                  bool column_is_nullable, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FixedStringDictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(fixed_string_dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size, string length and dictionary
   const auto dictionary_size = fixed_string_dictionary_segment.fixed_string_dictionary()->size();
   const auto string_length = fixed_string_dictionary_segment.fixed_string_dictionary()->string_length();
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_size));
-  export_value(ofstream, static_cast<uint32_t>(string_length));
-  export_values(ofstream, *fixed_string_dictionary_segment.fixed_string_dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_size));
+  export_value(ostream, static_cast<uint32_t>(string_length));
+  export_values(ostream, *fixed_string_dictionary_segment.fixed_string_dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *fixed_string_dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *fixed_string_dictionary_segment.compressed_vector_type(),
                             *fixed_string_dictionary_segment.attribute_vector());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::RunLength);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::RunLength);
 
   // Write size and values
-  export_value(ofstream, static_cast<uint32_t>(run_length_segment.values()->size()));
-  export_values(ofstream, *run_length_segment.values());
+  export_value(ostream, static_cast<uint32_t>(run_length_segment.values()->size()));
+  export_values(ostream, *run_length_segment.values());
 
   // Write NULL values
-  export_values(ofstream, *run_length_segment.null_values());
+  export_values(ostream, *run_length_segment.null_values());
 
   // Write end positions
-  export_values(ofstream, *run_length_segment.end_positions());
+  export_values(ostream, *run_length_segment.end_positions());
 }
 
-template <>
-void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
-                                  bool column_is_nullable, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FrameOfReference);
+template <typename T>
+void BinaryWriter::_write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment,
+                                  bool column_is_nullable, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FrameOfReference);
 
   // Write attribute vector width
-  const auto offset_value_vector_width = _compressed_vector_width<int32_t>(frame_of_reference_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
+  const auto offset_value_vector_width = _compressed_vector_width<T>(frame_of_reference_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
 
   // Write number of blocks and block minima
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
-  export_values(ofstream, frame_of_reference_segment.block_minima());
+  export_value(ostream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
+  export_values(ostream, frame_of_reference_segment.block_minima());
 
   // Write flag if optional NULL value vector is written
-  export_value(ofstream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
+  export_value(ostream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
   if (frame_of_reference_segment.null_values()) {
     // Write NULL values
-    export_values(ofstream, *frame_of_reference_segment.null_values());
+    export_values(ostream, *frame_of_reference_segment.null_values());
   }
 
   // Write offset values
-  _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool column_is_nullable, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::LZ4);
+void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool column_is_nullable, std::ostream& ostream) {
+  export_value(ostream, EncodingType::LZ4);
 
   // Write num elements (rows in segment)
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.size()));
 
   // Write number of blocks
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
 
   // Write block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.block_size()));
 
   // Write last block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.last_block_size()));
 
   // Write compressed size for each LZ4 Block
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_block.size()));
   }
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_values(ofstream, lz4_block);
+    export_values(ostream, lz4_block);
   }
 
   if (lz4_segment.null_values()) {
     // Write NULL value size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
     // Write NULL values
-    export_values(ofstream, *lz4_segment.null_values());
+    export_values(ostream, *lz4_segment.null_values());
   } else {
     // No NULL values
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 
   // Write dictionary size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
 
   // Write dictionary
-  export_values(ofstream, lz4_segment.dictionary());
+  export_values(ostream, lz4_segment.dictionary());
 
   if (lz4_segment.string_offsets()) {
     // Write string_offset size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.string_offsets()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.string_offsets()->size()));
     // Write string_offset data_size
-    export_value(ofstream,
+    export_value(ostream,
                  static_cast<uint32_t>(
                      dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets()).data().size()));
     // Write string offsets
-    _export_compressed_vector(ofstream, *lz4_segment.compressed_vector_type(), *(lz4_segment.string_offsets()));
+    _export_compressed_vector(ostream, *lz4_segment.compressed_vector_type(), *(lz4_segment.string_offsets()));
   } else {
     // Write string_offset size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, bool column_is_nullable, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FSST);
+
+  // Write symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ostream, static_cast<uint32_t>(symbol_table.symbols().size()));
+  export_values(ostream, symbol_table.symbols());
+  export_values(ostream, symbol_table.symbol_lengths());
+
+  // Write flag if optional NULL value vector is stored
+  export_value(ostream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    export_values(ostream, *fsst_segment.null_values());
+  }
+
+  // Write offsets and compressed values
+  export_values(ostream, fsst_segment.offsets());
+  export_values(ostream, fsst_segment.compressed_values());
+}
+
 template <typename T>
 uint32_t BinaryWriter::_compressed_vector_width(const AbstractEncodedSegment& abstract_encoded_segment) {
   uint32_t vector_width = 0u;
@@ -344,6 +579,9 @@ uint32_t BinaryWriter::_compressed_vector_width(const AbstractEncodedSegment& ab
       case CompressedVectorType::FixedSize1ByteAligned:
         vector_width = 1u;
         break;
+      case CompressedVectorType::BitPacking:
+        vector_width = 0u;
+        break;
       default:
         Fail("Export of specified CompressedVectorType is not yet supported");
     }
@@ -351,21 +589,28 @@ uint32_t BinaryWriter::_compressed_vector_width(const AbstractEncodedSegment& ab
   return vector_width;
 }
 
-void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+void BinaryWriter::_export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                              const BaseCompressedVector& compressed_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::SimdBp128:
-      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      return;
+    case CompressedVectorType::BitPacking: {
+      const auto& bitpacking_vector = dynamic_cast<const BitPackingVector&>(compressed_vector);
+      export_value(ostream, bitpacking_vector.bit_width());
+      export_value(ostream, static_cast<uint32_t>(bitpacking_vector.data().size()));
+      export_values(ostream, bitpacking_vector.data());
       return;
+    }
     default:
       Fail("Any other type should have been caught before.");
   }
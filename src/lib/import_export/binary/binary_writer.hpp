@@ -1,14 +1,18 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/row_group_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -17,14 +21,26 @@ namespace opossum {
 
 class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
+template <typename T>
+class AttributeStatistics;
+class TableStatistics;
 
 class BinaryWriter {
  public:
+  /**
+   * Writes the table, including its table statistics and the pruning statistics of its chunks, so that they do not
+   * need to be recreated when the file is parsed. For tables that do not carry statistics themselves (e.g., the
+   * validated snapshot of a stored table), @param table_statistics can be passed separately. The pruning statistics of
+   * reference chunks that only reference a single chunk are taken from that chunk, as they remain valid for a subset
+   * of its rows.
+   */
   static void write(const Table& table, const std::string& filename);
+  static void write(const Table& table, const std::string& filename,
+                    const std::shared_ptr<const TableStatistics>& table_statistics);
 
  private:
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given ostream.
    *
    * Description                 | Type                                | Size in bytes
    * --------------------------------------------------------------------------------------------------------
@@ -35,11 +51,17 @@ class BinaryWriter {
    * Column nullable             | bool (stored as BoolAsByteType)     | Column Count * 1
    * Column name lengths         | size_t array                        | Column Count * 1
    * Column names                | std::string array                   | Sum of lengths of all names
+   * Chunk offsets¹              | uint64_t array                      | Chunk count * 8
+   * Table statistics offset²    | uint64_t                            | 8
+   *
+   * ¹ Positions of the chunks in the file, which allow reading them in parallel. They are written by write() after
+   *   the chunks, which are serialized in parallel.
+   * ² Position of the table statistics, which follow the chunks. 0 if the table has no statistics.
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& ostream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given ostream.
    * First, it creates a chunk header with the following contents:
    *
    * Description                 | Type                                | Size in bytes
@@ -50,8 +72,68 @@ class BinaryWriter {
    *
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
+   *
+   * Finally, the pruning statistics of the chunk follow:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Has pruning statistics      | bool (stored as BoolAsByteType)     | 1
+   * Pruning statistics¹         | AttributeStatistics                 | One per column
+   *
+   * ¹ Only written if the chunk has pruning statistics, see _write_attribute_statistics()
+   */
+  static void _write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id);
+
+  /**
+   * Writes the table statistics, which follow the chunks, with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Row count                   | Cardinality                         | 4
+   * Represented chunk count     | uint32_t                            | 4
+   * Represented chunk sizes     | ChunkOffset array                   | Represented chunk count * 4
+   * Column statistics           | AttributeStatistics                 | One per column
+   */
+  static void _write_table_statistics(const TableStatistics& table_statistics, std::ostream& ostream);
+
+  /**
+   * AttributeStatistics are dumped with the following layout. Each statistics object is preceded by a flag that tells
+   * whether the statistics contain it:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Has histogram               | bool (stored as BoolAsByteType)     | 1
+   * Bin count¹                  | uint32_t                            | 4
+   * Bin minima¹                 | T array                             | Bin count * sizeof(T)
+   * Bin maxima¹                 | T array                             | Bin count * sizeof(T)
+   * Bin heights¹                | HistogramCountType array            | Bin count * 4
+   * Bin distinct counts¹        | HistogramCountType array            | Bin count * 4
+   * Has MinMaxFilter            | bool (stored as BoolAsByteType)     | 1
+   * Minimum and maximum²        | T array                             | 2 * sizeof(T)
+   * Has RangeFilter             | bool (stored as BoolAsByteType)     | 1
+   * Range count³                | uint32_t                            | 4
+   * Range minima³               | T array                             | Range count * sizeof(T)
+   * Range maxima³               | T array                             | Range count * sizeof(T)
+   * Has NullValueRatio          | bool (stored as BoolAsByteType)     | 1
+   * NULL value ratio⁴           | float                               | 4
+   * Has distinct count sketch   | bool (stored as BoolAsByteType)     | 1
+   * Value count⁵                | Cardinality                         | 4
+   * Selectivity⁵                | Selectivity                         | 4
+   * Registers⁵                  | uint8_t array                       | HyperLogLogSketch::REGISTER_COUNT
+   * Has BlockedBloomFilter      | bool (stored as BoolAsByteType)     | 1
+   * Word count⁶                 | uint32_t                            | 4
+   * Words⁶                      | uint64_t array                      | Word count * 8
+   *
+   * Strings are written like the values of ValueSegments, i.e., their lengths followed by their characters.
+   *
+   * ¹⁻⁶: These fields are only written if the statistics contain the respective object. Histograms are written as
+   *      their bins, so that the parser restores any histogram type as a GenericHistogram with the same bins.
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  template <typename T>
+  static void _write_attribute_statistics(const AttributeStatistics<T>& attribute_statistics, std::ostream& ostream);
+
+  // Returns the pruning statistics of the chunk or, for reference chunks, those of the single referenced chunk
+  static std::optional<ChunkPruningStatistics> _pruning_statistics(const Chunk& chunk);
 
   /**
    * ValueSegments are dumped with the following layout:
@@ -74,7 +156,12 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    */
   template <typename T>
-  static void _write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable, std::ofstream& ofstream);
+  static void _write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable, std::ostream& ostream);
+
+  // RowGroupSegments are materialized and dumped like ValueSegments
+  template <typename T>
+  static void _write_segment(const RowGroupSegment<T>& row_group_segment, bool column_is_nullable,
+                             std::ostream& ostream);
 
   /**
    * ReferenceSegments are dumped with the following layout, which is similar to value segments:
@@ -92,8 +179,7 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    */
-  static void _write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable,
-                             std::ofstream& ofstream);
+  static void _write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable, std::ostream& ostream);
 
   /**
    * DictionarySegments are dumped with the following layout:
@@ -113,10 +199,13 @@ class BinaryWriter {
    *
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is written if the type of the column is NOT a string
+   *
+   * Bit-packed attribute vectors are written with a width of 0 and contain their bit width (uint8_t), the number of
+   * 64-bit words (uint32_t), and the words. The same holds for the offset values of FrameOfReferenceSegments.
    */
   template <typename T>
   static void _write_segment(const DictionarySegment<T>& dictionary_segment, bool column_is_nullable,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * FixedStringDictionarySegments are dumped with the following layout:
@@ -135,7 +224,7 @@ class BinaryWriter {
    */
   template <typename T>
   static void _write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                             bool column_is_nullable, std::ofstream& ofstream);
+                             bool column_is_nullable, std::ostream& ostream);
 
   /**
    * RunLengthSegments are dumped with the following layout:
@@ -153,7 +242,7 @@ class BinaryWriter {
    */
   template <typename T>
   static void _write_segment(const RunLengthSegment<T>& run_length_segment, bool column_is_nullable,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * FrameOfReferenceSegments are dumped with the following layout:
@@ -175,7 +264,7 @@ class BinaryWriter {
    */
   template <typename T>
   static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, bool column_is_nullable,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * LZ4Segments are dumped with the following layout:
@@ -204,13 +293,35 @@ class BinaryWriter {
    * ²: These fields are only written if string offset size is not 0
    */
   template <typename T>
-  static void _write_segment(const LZ4Segment<T>& lz4_segment, bool column_is_nullable, std::ofstream& ofstream);
+  static void _write_segment(const LZ4Segment<T>& lz4_segment, bool column_is_nullable, std::ostream& ostream);
+
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Number of symbols           | uint32_t                            | 4
+   * Symbols                     | uint64_t                            | Number of symbols * 8
+   * Symbol lengths              | uint8_t                             | Number of symbols * 1
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Offsets                     | uint32_t                            | (size + 1) * 4
+   * Compressed values           | char array                          | Last offset
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool column_is_nullable, std::ostream& ostream);
 
   template <typename T>
   static uint32_t _compressed_vector_width(const AbstractEncodedSegment& abstract_encoded_segment);
 
   // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
-  static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  static void _export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                         const BaseCompressedVector& compressed_vector);
 
   template <typename T>
@@ -1,7 +1,8 @@
 #include "csv_parser.hpp"
 
+#include <algorithm>
+#include <array>
 #include <fstream>
-#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -18,6 +19,7 @@
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
@@ -31,8 +33,6 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     meta = *csv_meta;
   }
 
-  auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
-
   auto table = _create_table_from_meta(chunk_size, meta);
 
   std::ifstream csvfile{filename};
@@ -46,56 +46,61 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
   }
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
-  std::vector<size_t> field_ends;
-  std::mutex append_chunk_mutex;
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+  csvfile.close();
+
+  // The file is mapped instead of being read into memory, so that the kernel reads it while it is being parsed
+  const auto mapped_file = MemoryMappedFile{filename};
+  const auto content_view = std::string_view{mapped_file.data(), mapped_file.size()};
+  _parse_content_into_table(content_view, *table, meta);
+
+  return table;
+}
+
+std::shared_ptr<Table> CsvParser::parse_content(std::string_view csv_content,
+                                                const TableColumnDefinitions& column_definitions,
+                                                const ParseConfig& config, const ChunkOffset chunk_size) {
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+  _parse_content_into_table(csv_content, *table, CsvMeta{config, {}});
+  return table;
+}
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+void CsvParser::_parse_content_into_table(std::string_view csv_content, Table& table, const CsvMeta& meta) {
+  const auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+  // Split the content into chunks of target_chunk_size rows in parallel, then parse each chunk in its own task
+  const auto chunk_ends = _find_chunk_ends(csv_content, table.target_chunk_size(), meta, SPLIT_RANGE_SIZE);
+
+  auto segments_by_chunks = std::vector<Segments>(chunk_ends.size());
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_ends.size());
+  std::mutex append_chunk_mutex;
 
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+  auto chunk_begin = size_t{0};
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_ends.size(); ++chunk_index) {
+    // The chunk includes the delimiter of its last row (if there is one at the end of the file)
+    const auto chunk_end = std::min(chunk_ends[chunk_index] + 1, csv_content.size());
+    const auto chunk_content = csv_content.substr(chunk_begin, chunk_end - chunk_begin);
+    chunk_begin = chunk_end;
+
+    tasks.emplace_back(std::make_shared<JobTask>([chunk_content, &table, &segments = segments_by_chunks[chunk_index],
+                                                  &meta, &escaped_linebreak, &append_chunk_mutex]() {
+      auto field_ends = std::vector<size_t>{};
+      _find_fields_in_chunk(chunk_content, table, field_ends, meta);
+
+      // Only pass the part of the string that is actually needed to the parsing task
+      const auto relevant_content = chunk_content.substr(0, field_ends.back());
+      _parse_into_chunk(relevant_content, field_ends, table, segments, meta, escaped_linebreak, append_chunk_mutex);
     }));
-    tasks.back()->schedule();
   }
 
-  Hyrise::get().scheduler()->wait_for_tasks(tasks);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
   for (auto& segments : segments_by_chunks) {
     DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
     const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-    table->last_chunk()->finalize();
+    table.append_chunk(segments, mvcc_data);
+    table.last_chunk()->finalize();
   }
-
-  return table;
 }
 
 std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
@@ -138,6 +143,10 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     // Find either of row separator, column delimiter, quote identifier
     auto pos = csv_content.find_first_of(search_for, from);
     if (std::string::npos == pos) {
+      // The last row of the file does not need to be terminated by a delimiter
+      if (from < csv_content.size() && !in_quotes) {
+        field_ends.push_back(csv_content.size());
+      }
       break;
     }
     from = pos + 1;
@@ -174,6 +183,94 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
   return true;
 }
 
+std::vector<size_t> CsvParser::_find_chunk_ends(std::string_view csv_content, const ChunkOffset chunk_size,
+                                                const CsvMeta& meta, const size_t range_size) {
+  if (csv_content.empty()) return {};
+
+  // An unescaped quote toggles whether the following characters are quoted. A quote that is preceded by the escape
+  // character is part of the value, unless quotes are escaped by doubling them (i.e., the escape is the quote).
+  const auto is_toggling_quote = [&](const size_t position) {
+    if (csv_content[position] != meta.config.quote) return false;
+    return meta.config.quote == meta.config.escape || position == 0 ||
+           csv_content[position - 1] != meta.config.escape;
+  };
+
+  const auto range_count = std::max(size_t{1}, csv_content.size() / range_size);
+  const auto range_begin = [&](const size_t range_index) { return range_index * range_size; };
+  const auto range_end = [&](const size_t range_index) {
+    return range_index + 1 == range_count ? csv_content.size() : (range_index + 1) * range_size;
+  };
+
+  // 1. Count the row delimiters of each range in parallel. As it is not known yet whether a range begins within a
+  //    quoted value, both cases are counted in a single pass: If it begins outside of quotes, the delimiters that are
+  //    found in the unquoted state count, otherwise, the ones that are found in the quoted state.
+  struct RangeInfo {
+    std::array<size_t, 2> delimiter_counts{};
+    bool toggles_quotes{false};
+    bool begins_quoted{false};
+    size_t first_row_index{0};
+  };
+  auto range_infos = std::vector<RangeInfo>(range_count);
+
+  auto count_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  count_tasks.reserve(range_count);
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    count_tasks.emplace_back(std::make_shared<JobTask>([&, range_index]() {
+      auto& range_info = range_infos[range_index];
+      auto quoted = false;
+      const auto end = range_end(range_index);
+      for (auto position = range_begin(range_index); position < end; ++position) {
+        if (is_toggling_quote(position)) {
+          quoted = !quoted;
+        } else if (csv_content[position] == meta.config.delimiter) {
+          ++range_info.delimiter_counts[quoted];
+        }
+      }
+      range_info.toggles_quotes = quoted;
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(count_tasks);
+
+  // 2. Pass the quote state and the row count from range to range
+  auto quoted = false;
+  auto row_count = size_t{0};
+  for (auto& range_info : range_infos) {
+    range_info.begins_quoted = quoted;
+    range_info.first_row_index = row_count;
+    row_count += range_info.delimiter_counts[quoted];
+    quoted ^= range_info.toggles_quotes;
+  }
+
+  // 3. Find the delimiters that end the last rows of full chunks in parallel
+  auto chunk_ends = std::vector<size_t>(row_count / chunk_size);
+  auto find_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  find_tasks.reserve(range_count);
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    find_tasks.emplace_back(std::make_shared<JobTask>([&, range_index]() {
+      const auto& range_info = range_infos[range_index];
+      auto range_quoted = range_info.begins_quoted;
+      auto row_index = range_info.first_row_index;
+      const auto end = range_end(range_index);
+      for (auto position = range_begin(range_index); position < end; ++position) {
+        if (is_toggling_quote(position)) {
+          range_quoted = !range_quoted;
+        } else if (csv_content[position] == meta.config.delimiter && !range_quoted) {
+          if (row_index % chunk_size == chunk_size - 1) chunk_ends[row_index / chunk_size] = position;
+          ++row_index;
+        }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(find_tasks);
+
+  // The remaining rows form the last chunk, which ends with the file. Its last row does not need to be terminated by a
+  // delimiter.
+  const auto full_chunks_end = chunk_ends.empty() ? size_t{0} : chunk_ends.back() + 1;
+  if (full_chunks_end < csv_content.size()) chunk_ends.emplace_back(csv_content.size() - 1);
+
+  return chunk_ends;
+}
+
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
                                     const Table& table, Segments& segments, const CsvMeta& meta,
                                     const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
@@ -21,9 +21,9 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser maps the csv file into memory and separates the data into chunks that are aligned with the csv rows.
+ * Each data chunk is parsed and converted into a opossum chunk in parallel. In the end all chunks are combined to the
+ * final table.
  */
 class CsvParser {
  public:
@@ -37,12 +37,30 @@ class CsvParser {
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+  /*
+   * Parses CSV content that is already in memory, e.g., rows received by the server for COPY FROM STDIN.
+   * @param csv_content         Complete rows, the last of which does not need to be terminated by a delimiter.
+   * @param column_definitions  The columns of the created table.
+   */
+  static std::shared_ptr<Table> parse_content(std::string_view csv_content,
+                                              const TableColumnDefinitions& column_definitions,
+                                              const ParseConfig& config = {},
+                                              const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+
  protected:
+  // Size of the parts of the file in which the row delimiters are searched in parallel
+  static constexpr auto SPLIT_RANGE_SIZE = size_t{16'000'000};
+
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
   static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
 
+  /*
+   * Splits the content into chunks and parses them in parallel. The chunks are appended to the empty table.
+   */
+  static void _parse_content_into_table(std::string_view csv_content, Table& table, const CsvMeta& meta);
+
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
@@ -53,6 +71,20 @@ class CsvParser {
   static bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
                                     const CsvMeta& meta);
 
+  /*
+   * Finds the chunk boundaries in parallel, in the style of simdcsv: The content is split into ranges of
+   * \p range_size bytes. First, the row delimiters of all ranges are counted for both possible quote states at the
+   * beginning of a range. Afterwards, the actual quote states and the index of the first row of each range are known,
+   * and the delimiters that end chunks are searched in all ranges at once.
+   *
+   * @param csv_content String_view on the content of the CSV.
+   * @param chunk_size  Number of rows per chunk.
+   * @returns           For each chunk, the position of the delimiter that ends its last row. The last chunk ends at the
+   *                    end of \p csv_content, even if it does not end with a delimiter.
+   */
+  static std::vector<size_t> _find_chunk_ends(std::string_view csv_content, const ChunkOffset chunk_size,
+                                              const CsvMeta& meta, const size_t range_size);
+
   /*
    * @param      csv_chunk  String_view on one chunk of the CSV.
    * @param      field_ends Positions of the field ends of the given \p csv_chunk.
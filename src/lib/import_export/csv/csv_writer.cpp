@@ -1,15 +1,87 @@
 #include "csv_writer.hpp"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
+
+#include "constant_mappings.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
 #include "types.hpp"
+#include "utils/async_file_writer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Appends the string, enclosed in quote characters, with each quote character escaped
+void append_quoted_string(std::string& buffer, const std::string_view string, const ParseConfig& config) {
+  /**
+   * We put the quotechars around any string value by default
+   * as this is the only time when a comma (,) might be inside a value.
+   * This might consume more space, however it speeds the program as it
+   * does not require additional checks.
+   * If we start allowing more characters as delimiter, we should change
+   * this behaviour to either general quoting or checking for "illegal"
+   * characters.
+   */
+  buffer += config.quote;
+  for (const auto character : string) {
+    if (character == config.quote) buffer += config.escape;
+    buffer += character;
+  }
+  buffer += config.quote;
+}
+
+// Numbers are written with std::to_chars instead of a stream. Floating-point values keep the format of a stream with
+// its default precision of six significant digits (i.e., %g).
+template <typename T, typename Value>
+void append_value(std::string& buffer, const Value& value, const ParseConfig& config, const bool quote_strings) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto string = std::string_view{value};
+    if (quote_strings) {
+      append_quoted_string(buffer, string, config);
+    } else {
+      Assert(string.find(config.separator) == std::string_view::npos &&
+                 string.find(config.delimiter) == std::string_view::npos,
+             "Cannot write a string that contains the separator or delimiter without quotes");
+      buffer += string;
+    }
+  } else {
+    auto characters = std::array<char, 32>{};
+    auto result = std::to_chars_result{};
+    if constexpr (std::is_floating_point_v<T>) {
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value,
+                             std::chars_format::general, 6);
+    } else {
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    }
+    DebugAssert(result.ec == std::errc{}, "Could not format value");
+    buffer.append(characters.data(), result.ptr);
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
 void CsvWriter::write(const Table& table, const std::string& filename, const ParseConfig& config) {
   _generate_meta_info_file(table, filename + CsvMeta::META_FILE_EXTENSION);
-  _generate_content_file(table, filename, config);
+  _generate_content_file(table, filename, config, ContentFormat::Csv);
+}
+
+void CsvWriter::write_tbl(const Table& table, const std::string& filename) {
+  auto config = ParseConfig{};
+  config.separator = '|';
+  _generate_content_file(table, filename, config, ContentFormat::Tbl);
 }
 
 void CsvWriter::_generate_meta_info_file(const Table& table, const std::string& filename) {
@@ -31,7 +103,8 @@ void CsvWriter::_generate_meta_info_file(const Table& table, const std::string&
   meta_file_stream << std::setw(4) << meta_json << std::endl;
 }
 
-void CsvWriter::_generate_content_file(const Table& table, const std::string& filename, const ParseConfig& config) {
+void CsvWriter::_generate_content_file(const Table& table, const std::string& filename, const ParseConfig& config,
+                                       const ContentFormat format) {
   /**
    * A naively exported csv file is a materialized file in row format.
    * This offers some advantages, but also disadvantages.
@@ -42,82 +115,129 @@ void CsvWriter::_generate_content_file(const Table& table, const std::string& fi
    * Also, it does not involve the column-oriented style used in OpossumDB.
    */
 
-  // Open file for writing
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  ofstream.open(filename);
+  // Open file for writing. The rows are formatted while the previously formatted ones are being written.
+  auto writer = AsyncFileWriter{filename};
+  auto ostream = std::ostream{&writer};
+  ostream.exceptions(std::ostream::failbit | std::ostream::badbit);
+
+  // The header of a .tbl file holds the column names and the column types (see load_table())
+  if (format == ContentFormat::Tbl) {
+    const auto column_count = table.column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id != ColumnID{0}) ostream << config.separator;
+      ostream << table.column_name(column_id);
+    }
+    ostream << config.delimiter;
 
-  /**
-   * Multiple rows containing the values of each respective row are written.
-   * Therefore we first iterate through the chunks, then through the rows
-   * in the chunks and afterwards through the segments of the chunks.
-   *
-   * This is a lot of iterating, but to convert a column-based table to
-   * a row-based representation takes some effort.
-   */
-  const auto chunk_count = table.chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table.get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
-      for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-        const auto segment = chunk->get_segment(column_id);
-
-        // The previous implementation did a double dispatch (at least two virtual method calls)
-        // So the subscript operator cannot be much slower.
-        const auto value = (*segment)[chunk_offset];
-        if (column_id != ColumnID{0}) {
-          ofstream << config.separator;
-        }
-        _write(value, ofstream, config);
-      }
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id != ColumnID{0}) ostream << config.separator;
+      ostream << data_type_to_string.left.at(table.column_data_type(column_id));
+      if (table.column_is_nullable(column_id)) ostream << "_null";
+    }
+    ostream << config.delimiter;
+  }
 
-      ofstream << config.delimiter;
+  // The chunks are formatted in parallel, one batch of chunks at a time, so that at most one batch of formatted chunks
+  // is held in memory. The buffers are written in order.
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto batch_size = std::max(size_t{1}, static_cast<size_t>(Hyrise::get().topology.num_cpus()));
+  auto buffers = std::vector<std::string>(std::min(batch_size, chunk_count));
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& buffer = buffers[chunk_id - batch_begin];
+        buffer.clear();
+        _format_chunk(table, ChunkID{static_cast<ChunkID::base_type>(chunk_id)}, config, format, buffer);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      const auto& buffer = buffers[chunk_id - batch_begin];
+      ostream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
   }
 
-  ofstream.close();
+  writer.close();
 }
 
-void CsvWriter::_write(const AllTypeVariant& value, std::ofstream& ofstream, const ParseConfig& config) {
-  if (variant_is_null(value)) return;
-
-  if (value.type() == typeid(pmr_string)) {
-    _write_string_value(boost::get<pmr_string>(value), ofstream, config);
-    return;
+void CsvWriter::write_header(const Table& table, std::ostream& stream, const ParseConfig& config) {
+  auto buffer = std::string{};
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    if (column_id != ColumnID{0}) {
+      buffer += config.separator;
+    }
+    append_quoted_string(buffer, table.column_name(column_id), config);
   }
+  buffer += config.delimiter;
+  stream << buffer;
+}
 
-  ofstream << value;
+void CsvWriter::write_chunk(const Table& table, const ChunkID chunk_id, std::ostream& stream,
+                            const ParseConfig& config) {
+  auto buffer = std::string{};
+  _format_chunk(table, chunk_id, config, ContentFormat::Csv, buffer);
+  stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 }
 
-void CsvWriter::_write_string_value(const pmr_string& value, std::ofstream& ofstream, const ParseConfig& config) {
+void CsvWriter::_format_chunk(const Table& table, const ChunkID chunk_id, const ParseConfig& config,
+                              const ContentFormat format, std::string& buffer) {
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
   /**
-   * We put the quotechars around any string value by default
-   * as this is the only time when a comma (,) might be inside a value.
-   * This might consume more space, however it speeds the program as it
-   * does not require additional checks.
-   * If we start allowing more characters as delimiter, we should change
-   * this behaviour to either general quoting or checking for "illegal"
-   * characters.
+   * Multiple rows containing the values of each respective row are written.
+   * Instead of accessing each value of a row through its segment, which resolves the segment and creates an
+   * AllTypeVariant for every value, each segment is iterated once and its values are formatted into a buffer of their
+   * own. The rows are then assembled from the buffers of the columns.
    */
-  ofstream << config.quote;
-  ofstream << _escape(value, config);
-  ofstream << config.quote;
-}
+  const auto row_count = static_cast<size_t>(chunk->size());
+  const auto column_count = table.column_count();
+  const auto quote_strings = format == ContentFormat::Csv;
+  const auto null_string =
+      format == ContentFormat::Csv ? std::string_view{} : std::string_view{ParseConfig::NULL_STRING};
+
+  auto column_buffers = std::vector<std::string>(column_count);
+  auto value_ends = std::vector<std::vector<size_t>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto& column_buffer = column_buffers[column_id];
+    auto& column_value_ends = value_ends[column_id];
+    column_value_ends.reserve(row_count);
+
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          column_buffer += null_string;
+        } else {
+          append_value<ColumnDataType>(column_buffer, position.value(), config, quote_strings);
+        }
+        column_value_ends.emplace_back(column_buffer.size());
+      });
+    });
+  }
+
+  auto size = buffer.size() + row_count * column_count;
+  for (const auto& column_buffer : column_buffers) {
+    size += column_buffer.size();
+  }
+  buffer.reserve(size);
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id != ColumnID{0}) {
+        buffer += config.separator;
+      }
+      const auto value_begin = row == 0 ? size_t{0} : value_ends[column_id][row - 1];
+      buffer.append(column_buffers[column_id], value_begin, value_ends[column_id][row] - value_begin);
+    }
 
-/*
- * Escapes each quote character with an escape symbol.
- */
-pmr_string CsvWriter::_escape(const pmr_string& string, const ParseConfig& config) {
-  pmr_string result(string);
-  size_t next_pos = 0;
-  while (std::string::npos != (next_pos = result.find(config.quote, next_pos))) {
-    result.insert(next_pos, 1, config.escape);
-    // Has to jump 2 positions ahead because a new character had been inserted.
-    next_pos += 2;
+    buffer += config.delimiter;
   }
-  return result;
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fstream>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -84,17 +85,43 @@ class CsvWriter {
    */
   static void write(const Table& table, const std::string& filename, const ParseConfig& config = {});
 
+  /*
+   * Writes the table in the .tbl format that is read by load_table(): The first two lines hold the column names and
+   * the column types (with a "_null" suffix for nullable columns), followed by the rows. Values are separated by a pipe
+   * (|), strings are not quoted, and NULLs are written as "null". No meta file is created.
+   *
+   *  a|b|c
+   *  int_null|string|float
+   *  1|Hallo Welt|3.5
+   *  null|Kekse|5
+   */
+  static void write_tbl(const Table& table, const std::string& filename);
+
+  /*
+   * Writes the column names or the rows of a single chunk in the format of the content file, e.g., to stream a table
+   * to a client (see COPY TO STDOUT).
+   */
+  static void write_header(const Table& table, std::ostream& stream, const ParseConfig& config = {});
+  static void write_chunk(const Table& table, const ChunkID chunk_id, std::ostream& stream,
+                          const ParseConfig& config = {});
+
   /*
    * Ends a row of entries in the csv file.
    */
   void end_line();
 
  protected:
+  enum class ContentFormat { Csv, Tbl };
+
   static void _generate_meta_info_file(const Table& table, const std::string& filename);
-  static void _generate_content_file(const Table& table, const std::string& filename, const ParseConfig& config);
-  static void _write(const AllTypeVariant& value, std::ofstream& ofstream, const ParseConfig& config);
-  static pmr_string _escape(const pmr_string& string, const ParseConfig& config);
-  static void _write_string_value(const pmr_string& value, std::ofstream& ofstream, const ParseConfig& config);
+
+  // The chunks are formatted in parallel, each into a buffer of its own, and written in order
+  static void _generate_content_file(const Table& table, const std::string& filename, const ParseConfig& config,
+                                     const ContentFormat format);
+
+  // Appends the rows of the chunk to the buffer. Each segment is iterated once with its type resolved.
+  static void _format_chunk(const Table& table, const ChunkID chunk_id, const ParseConfig& config,
+                            const ContentFormat format, std::string& buffer);
 };
 
 }  // namespace opossum
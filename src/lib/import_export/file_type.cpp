@@ -28,6 +28,10 @@ FileType file_type_from_filename(const std::string& filename) {
     return FileType::Tbl;
   } else if (extension == ".bin") {
     return FileType::Binary;
+  } else if (extension == ".parquet") {
+    return FileType::Parquet;
+  } else if (extension == ".arrow" || extension == ".feather") {
+    return FileType::Arrow;
   }
   Fail("Unknown file extension " + extension);
 }
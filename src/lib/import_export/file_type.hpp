@@ -4,7 +4,8 @@
 
 namespace opossum {
 
-enum class FileType { Csv, Tbl, Binary, Auto };
+// Parquet and Arrow (IPC) files require Hyrise to be built with Arrow support (see ArrowParser)
+enum class FileType { Csv, Tbl, Binary, Parquet, Arrow, Auto };
 
 FileType import_type_to_file_type(const hsql::ImportType import_type);
 
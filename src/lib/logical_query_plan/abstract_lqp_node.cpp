@@ -158,12 +158,12 @@ LQPInputSide AbstractLQPNode::get_input_side(const std::shared_ptr<AbstractLQPNo
 }
 
 std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
+  const auto outputs = this->outputs();
+
   std::vector<LQPInputSide> input_sides;
-  input_sides.reserve(_outputs.size());
+  input_sides.reserve(outputs.size());
 
-  for (const auto& output_weak_ptr : _outputs) {
-    const auto output = output_weak_ptr.lock();
-    DebugAssert(output, "Failed to lock output");
+  for (const auto& output : outputs) {
     input_sides.emplace_back(get_input_side(output));
   }
 
@@ -171,13 +171,15 @@ std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
 }
 
 std::vector<std::shared_ptr<AbstractLQPNode>> AbstractLQPNode::outputs() const {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
+
   std::vector<std::shared_ptr<AbstractLQPNode>> outputs;
   outputs.reserve(_outputs.size());
 
   for (const auto& output_weak_ptr : _outputs) {
-    const auto output = output_weak_ptr.lock();
-    DebugAssert(output, "Failed to lock output");
-    outputs.emplace_back(output);
+    // An expired output is being destroyed by another thread, which waits for the mutex to remove its pointer
+    auto output = output_weak_ptr.lock();
+    if (output) outputs.emplace_back(std::move(output));
   }
 
   return outputs;
@@ -192,28 +194,31 @@ void AbstractLQPNode::remove_output(const std::shared_ptr<AbstractLQPNode>& outp
 }
 
 void AbstractLQPNode::clear_outputs() {
-  // Don't use for-each loop here, as remove_output manipulates the _outputs vector
-  while (!_outputs.empty()) {
-    auto output = _outputs.front().lock();
-    DebugAssert(output, "Failed to lock output");
+  // Iterate over a copy, as remove_output manipulates the _outputs vector and acquires the _outputs_mutex. An output
+  // that appears twice (e.g., a self join) is untied from both of its sides.
+  for (const auto& output : outputs()) {
     remove_output(output);
   }
 }
 
 std::vector<LQPOutputRelation> AbstractLQPNode::output_relations() const {
-  std::vector<LQPOutputRelation> output_relations(output_count());
-
+  // Take the outputs only once, so that the relations are consistent even if outputs are added concurrently
   const auto outputs = this->outputs();
-  const auto input_sides = get_input_sides();
 
-  for (size_t output_idx = 0; output_idx < output_relations.size(); ++output_idx) {
-    output_relations[output_idx] = LQPOutputRelation{outputs[output_idx], input_sides[output_idx]};
+  std::vector<LQPOutputRelation> output_relations;
+  output_relations.reserve(outputs.size());
+
+  for (const auto& output : outputs) {
+    output_relations.emplace_back(LQPOutputRelation{output, get_input_side(output)});
   }
 
   return output_relations;
 }
 
-size_t AbstractLQPNode::output_count() const { return _outputs.size(); }
+size_t AbstractLQPNode::output_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
+  return _outputs.size();
+}
 
 std::shared_ptr<AbstractLQPNode> AbstractLQPNode::deep_copy(LQPNodeMapping input_node_mapping) const {
   return _deep_copy_impl(input_node_mapping);
@@ -356,6 +361,7 @@ std::shared_ptr<AbstractLQPNode> AbstractLQPNode::_shallow_copy(LQPNodeMapping&
 }
 
 void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   const auto iter = std::find_if(_outputs.begin(), _outputs.end(), [&](const auto& other) {
     /**
      * HACK!
@@ -383,6 +389,7 @@ void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
 
 void AbstractLQPNode::_add_output_pointer(const std::shared_ptr<AbstractLQPNode>& output) {
   // Having the same output multiple times is allowed, e.g. for self joins
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   _outputs.emplace_back(output);
 }
 
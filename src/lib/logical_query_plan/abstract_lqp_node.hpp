@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -39,6 +40,7 @@ enum class LQPNodeType {
   Update,
   Union,
   Validate,
+  Window,
   Mock
 };
 
@@ -257,6 +259,9 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
   /** @} */
 
   std::vector<std::weak_ptr<AbstractLQPNode>> _outputs;
+  // Join ordering algorithms may build candidate plans on top of the same subplans concurrently (see DpCcp), which adds
+  // and removes outputs of the subplans' roots. All accesses to _outputs (except for the destructor's) hold the mutex.
+  mutable std::mutex _outputs_mutex;
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
 };
 
@@ -7,11 +7,14 @@
 namespace opossum {
 
 ImportNode::ImportNode(const std::string& init_table_name, const std::string& init_file_name,
-                       const FileType init_file_type)
+                       const FileType init_file_type, const std::vector<std::string>& init_column_names,
+                       const std::vector<size_t>& init_row_groups)
     : AbstractNonQueryNode(LQPNodeType::Import),
       table_name(init_table_name),
       file_name(init_file_name),
-      file_type(init_file_type) {}
+      file_type(init_file_type),
+      column_names(init_column_names),
+      row_groups(init_row_groups) {}
 
 std::string ImportNode::description(const DescriptionMode mode) const {
   std::ostringstream stream;
@@ -23,17 +26,20 @@ size_t ImportNode::_on_shallow_hash() const {
   auto hash = boost::hash_value(table_name);
   boost::hash_combine(hash, file_name);
   boost::hash_combine(hash, file_type);
+  boost::hash_combine(hash, column_names);
+  boost::hash_combine(hash, row_groups);
   return hash;
 }
 
 std::shared_ptr<AbstractLQPNode> ImportNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return ImportNode::make(table_name, file_name, file_type);
+  return ImportNode::make(table_name, file_name, file_type, column_names, row_groups);
 }
 
 bool ImportNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& import_node = static_cast<const ImportNode&>(rhs);
   return table_name == import_node.table_name && file_name == import_node.file_name &&
-         file_type == import_node.file_type;
+         file_type == import_node.file_type && column_names == import_node.column_names &&
+         row_groups == import_node.row_groups;
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "abstract_non_query_node.hpp"
 #include "enable_make_for_lqp_node.hpp"
@@ -10,17 +11,22 @@
 namespace opossum {
 
 /**
- * This node type represents the IMPORT / COPY FROM management command.
+ * This node type represents the IMPORT / COPY FROM management command. For Parquet and Arrow files, it can be
+ * restricted to columns and row groups, which the Import operator does not decode at all. Empty lists import all of
+ * them.
  */
 class ImportNode : public EnableMakeForLQPNode<ImportNode>, public AbstractNonQueryNode {
  public:
-  ImportNode(const std::string& init_table_name, const std::string& init_file_name, const FileType init_file_type);
+  ImportNode(const std::string& init_table_name, const std::string& init_file_name, const FileType init_file_type,
+             const std::vector<std::string>& init_column_names = {}, const std::vector<size_t>& init_row_groups = {});
 
   std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
 
   const std::string table_name;
   const std::string file_name;
   const FileType file_type;
+  const std::vector<std::string> column_names;
+  const std::vector<size_t> row_groups;
 
  protected:
   size_t _on_shallow_hash() const override;
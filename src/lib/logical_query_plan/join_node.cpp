@@ -39,6 +39,7 @@ std::string JoinNode::description(const DescriptionMode mode) const {
 
   std::stringstream stream;
   stream << "[Join] Mode: " << join_mode;
+  if (is_runtime_filter) stream << " (Runtime Filter)";
 
   for (const auto& predicate : join_predicates()) {
     stream << " [" << predicate->description(expression_mode) << "]";
@@ -228,19 +229,27 @@ bool JoinNode::is_column_nullable(const ColumnID column_id) const {
 
 const std::vector<std::shared_ptr<AbstractExpression>>& JoinNode::join_predicates() const { return node_expressions; }
 
-size_t JoinNode::_on_shallow_hash() const { return boost::hash_value(join_mode); }
+size_t JoinNode::_on_shallow_hash() const {
+  auto hash = boost::hash_value(join_mode);
+  boost::hash_combine(hash, is_runtime_filter);
+  return hash;
+}
 
 std::shared_ptr<AbstractLQPNode> JoinNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  if (!join_predicates().empty()) {
-    return JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
-  } else {
-    return JoinNode::make(join_mode);
-  }
+  if (join_predicates().empty()) return JoinNode::make(join_mode);
+
+  const auto copy =
+      JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
+  copy->is_semi_reduction = is_semi_reduction;
+  copy->is_runtime_filter = is_runtime_filter;
+  return copy;
 }
 
 bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& join_node = static_cast<const JoinNode&>(rhs);
-  if (join_mode != join_node.join_mode) return false;
+  // Runtime filters are not exact, so they cannot be deduplicated with regular semi joins. Semi join reductions (that
+  // are not runtime filters) return the same result as the equivalent semi join.
+  if (join_mode != join_node.join_mode || is_runtime_filter != join_node.is_runtime_filter) return false;
   return expressions_equal_to_expressions_in_different_lqp(join_predicates(), join_node.join_predicates(),
                                                            node_mapping);
 }
@@ -54,6 +54,14 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   JoinMode join_mode;
 
+  // Set by the SemiJoinReductionRule for the semi joins that it adds. These only reduce the input of another join,
+  // which evaluates the predicate again, so that they may keep rows without a join partner.
+  bool is_semi_reduction{false};
+
+  // Set by the RuntimeJoinFilterRule for semi join reductions that are translated into a RuntimeFilterScan instead of
+  // a semi join. That filter is not exact, it keeps some of the rows without a join partner.
+  bool is_runtime_filter{false};
+
  protected:
   /**
    * @return A subset of the given LQPUniqueConstraints @param left_unique_constraints and @param
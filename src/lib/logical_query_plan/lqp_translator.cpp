@@ -1,16 +1,22 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
-#include <boost/hana/for_each.hpp>
-#include <boost/hana/tuple.hpp>
+#include <magic_enum.hpp>
 
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
 #include "change_meta_table_node.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "distributed/cluster.hpp"
+#include "distributed/shard_fragment.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -21,6 +27,9 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
@@ -33,16 +42,24 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/delete.hpp"
+#include "operators/difference.hpp"
+#include "operators/exchange.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
+#include "operators/group_join.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/intersect.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_inequality.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -53,27 +70,353 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "operators/pipelined_table_scan.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter_scan.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/index/table/table_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "window_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool expression_contains_subquery(const std::shared_ptr<AbstractExpression>& expression) {
+  auto contains_subquery = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) contains_subquery = true;
+    return contains_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return contains_subquery;
+}
+
+// Simple cost model for choosing the join implementation if there is no calibrated cost model (see
+// CostEstimatorCalibrated). Costs are the estimated number of processed rows; inserting a row into a hash table is
+// assumed to be twice as expensive as probing it.
+constexpr auto HASH_JOIN_BUILD_COST_FACTOR = Cost{2};
+
+// Cardinality estimates can be far off, so that the rule-based join implementation is only replaced by one whose
+// estimated cost is lower by at least this factor
+constexpr auto MIN_JOIN_COST_IMPROVEMENT_FACTOR = Cost{2};
+
+struct JoinOperatorCandidate {
+  OperatorType operator_type;
+  // Only for JoinIndex
+  std::optional<IndexSide> index_side{};
+  Cost cost{0.0f};
+};
+
+std::ostream& operator<<(std::ostream& stream, const JoinOperatorCandidate& candidate) {
+  stream << magic_enum::enum_name(candidate.operator_type);
+  if (candidate.index_side) stream << " (index on " << magic_enum::enum_name(*candidate.index_side) << ")";
+  stream << " " << candidate.cost;
+  return stream;
+}
+
+// Whether the table is sharded across the nodes of the cluster, in which case it is read by an Exchange operator
+// instead of a GetTable
+bool is_sharded(const StoredTableNode& stored_table_node) {
+  const auto& cluster = Hyrise::get().cluster;
+  return cluster && cluster->is_sharded(stored_table_node.table_name);
+}
+
+bool lqp_reads_sharded_table(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto reads_sharded_table = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable && is_sharded(static_cast<const StoredTableNode&>(*node))) {
+      reads_sharded_table = true;
+    }
+    return reads_sharded_table ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return reads_sharded_table;
+}
+
+std::optional<ColumnID> stored_table_column_id(const AbstractExpression& expression,
+                                               const StoredTableNode& stored_table_node) {
+  if (expression.type != ExpressionType::LQPColumn) return std::nullopt;
+  return stored_table_node.find_column_id(expression);
+}
+
+// Converts a predicate of the form `column <condition> value(s)` on a column of the stored table into a predicate of a
+// ShardFragment
+std::optional<ShardFragment::Predicate> shard_fragment_predicate(const AbstractExpression& predicate,
+                                                                 const StoredTableNode& stored_table_node) {
+  const auto value = [](const AbstractExpression& expression) -> std::optional<AllTypeVariant> {
+    if (expression.type != ExpressionType::Value) return std::nullopt;
+    return static_cast<const ValueExpression&>(expression).value;
+  };
+
+  if (const auto* const between_expression = dynamic_cast<const BetweenExpression*>(&predicate)) {
+    const auto column_id = stored_table_column_id(*between_expression->value(), stored_table_node);
+    const auto lower_bound = value(*between_expression->lower_bound());
+    const auto upper_bound = value(*between_expression->upper_bound());
+    if (!column_id || !lower_bound || !upper_bound) return std::nullopt;
+    return ShardFragment::Predicate{*column_id, between_expression->predicate_condition, *lower_bound, *upper_bound};
+  }
+
+  const auto* const binary_predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&predicate);
+  if (!binary_predicate_expression) return std::nullopt;
+  const auto& left_operand = *binary_predicate_expression->left_operand();
+  const auto& right_operand = *binary_predicate_expression->right_operand();
+  const auto predicate_condition = binary_predicate_expression->predicate_condition;
+
+  if (const auto column_id = stored_table_column_id(left_operand, stored_table_node)) {
+    const auto right_value = value(right_operand);
+    if (!right_value) return std::nullopt;
+    return ShardFragment::Predicate{*column_id, predicate_condition, *right_value, std::nullopt};
+  }
+
+  // `value <condition> column` is flipped
+  const auto column_id = stored_table_column_id(right_operand, stored_table_node);
+  const auto left_value = value(left_operand);
+  if (!column_id || !left_value || !is_binary_numeric_predicate_condition(predicate_condition)) return std::nullopt;
+  return ShardFragment::Predicate{*column_id, flip_predicate_condition(predicate_condition), *left_value, std::nullopt};
+}
+
+std::optional<ShardFragment::Aggregate> shard_fragment_aggregate(const AbstractExpression& expression,
+                                                                 const StoredTableNode& stored_table_node) {
+  if (expression.type != ExpressionType::Aggregate) return std::nullopt;
+  const auto& aggregate_expression = static_cast<const AggregateExpression&>(expression);
+  if (!ShardFragment::supports(aggregate_expression.aggregate_function)) return std::nullopt;
+  if (AggregateExpression::is_count_star(aggregate_expression)) {
+    return ShardFragment::Aggregate{AggregateFunction::Count, std::nullopt};
+  }
+
+  const auto column_id = stored_table_column_id(*aggregate_expression.argument(), stored_table_node);
+  if (!column_id) return std::nullopt;
+  return ShardFragment::Aggregate{aggregate_expression.aggregate_function, *column_id};
+}
+
+bool input_is_sorted_by(const AbstractLQPNode& input, const ColumnID column_id) {
+  return input.type == LQPNodeType::Sort && *input.node_expressions.front() == *input.output_expressions()[column_id];
+}
+
+// If the input is a (validated) stored table and all of its chunks have an index on the column at column_id, returns
+// the number of chunks
+std::optional<ChunkID> indexed_chunk_count(const AbstractLQPNode& input, const ColumnID column_id) {
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(input.output_expressions()[column_id]);
+  if (!column_expression) return std::nullopt;
+
+  const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(
+      input.type == LQPNodeType::Validate ? input.left_input() : input.shared_from_this());
+  if (!stored_table_node || column_expression->original_node.lock() != stored_table_node) return std::nullopt;
+  if (is_sharded(*stored_table_node)) return std::nullopt;
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto chunk_count = table->chunk_count();
+  if (chunk_count == 0) return std::nullopt;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->get_indexes(std::vector<ColumnID>{column_expression->original_column_id}).empty()) {
+      return std::nullopt;
+    }
+  }
+  return chunk_count;
+}
+
+// If the input is a stored table (without Validate, see JoinIndex) and the column has a TableIndex, returns the number
+// of its entries
+std::optional<size_t> table_index_entry_count(const AbstractLQPNode& input, const ColumnID column_id) {
+  if (input.type != LQPNodeType::StoredTable) return std::nullopt;
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(input.output_expressions()[column_id]);
+  if (!column_expression) return std::nullopt;
+
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(input);
+  if (is_sharded(stored_table_node)) return std::nullopt;
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto table_index = table->get_table_index(column_expression->original_column_id);
+  if (!table_index) return std::nullopt;
+  return table_index->entry_count();
+}
+
+// The number of distinct values of the input's column, estimated from its distinct count sketch. Used to reserve hash
+// tables in the operators.
+std::optional<size_t> estimated_distinct_count(const std::shared_ptr<AbstractLQPNode>& input,
+                                               const ColumnID column_id) {
+  const auto input_table_statistics = CardinalityEstimator{}.estimate_statistics(input);
+  const auto distinct_count =
+      CardinalityEstimator::estimate_distinct_count(*input_table_statistics->column_statistics[column_id]);
+  if (!distinct_count) return std::nullopt;
+  return static_cast<size_t>(std::ceil(*distinct_count));
+}
+
+// Whether the join has an inequality as primary predicate and as one of its secondary predicates (e.g., band joins
+// such as `a.ts BETWEEN b.start AND b.end`). JoinInequality evaluates the second inequality using its bit array instead
+// of checking it for every match of the primary predicate.
+bool is_two_inequality_join(const JoinConfiguration& configuration,
+                            const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
+  if (!JoinInequality::supports(configuration)) return false;
+  return std::any_of(secondary_join_predicates.cbegin(), secondary_join_predicates.cend(), [](const auto& predicate) {
+    const auto predicate_condition = predicate.predicate_condition;
+    return predicate_condition == PredicateCondition::LessThan ||
+           predicate_condition == PredicateCondition::LessThanEquals ||
+           predicate_condition == PredicateCondition::GreaterThan ||
+           predicate_condition == PredicateCondition::GreaterThanEquals;
+  });
+}
+
+// The join implementations that support the join, with their estimated costs
+std::vector<JoinOperatorCandidate> join_operator_candidates(
+    const JoinNode& join_node, const JoinConfiguration& configuration,
+    const OperatorJoinPredicate& primary_join_predicate,
+    const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
+  const auto& left_input = *join_node.left_input();
+  const auto& right_input = *join_node.right_input();
+
+  // Estimates of zero rows are common for selective predicates, but the inputs are rarely actually empty
+  auto cardinality_estimator = CardinalityEstimator{};
+  cardinality_estimator.guarantee_bottom_up_construction();
+  const auto estimate = [&](const auto& node) {
+    return std::max(cardinality_estimator.estimate_cardinality(node), Cardinality{1});
+  };
+  const auto left_row_count = estimate(join_node.left_input());
+  const auto right_row_count = estimate(join_node.right_input());
+  const auto output_row_count = estimate(join_node.shared_from_this());
+
+  auto candidates = std::vector<JoinOperatorCandidate>{};
+
+  if (JoinHash::supports(configuration)) {
+    // For inner joins, JoinHash builds the hash table for the smaller input. Otherwise, the build side is determined by
+    // the join mode (see JoinHash::_on_execute).
+    const auto build_left_input = join_node.join_mode == JoinMode::Right ||
+                                  (join_node.join_mode == JoinMode::Inner && left_row_count <= right_row_count);
+    const auto build_row_count = build_left_input ? left_row_count : right_row_count;
+    const auto probe_row_count = build_left_input ? right_row_count : left_row_count;
+    candidates.push_back({OperatorType::JoinHash, std::nullopt,
+                          build_row_count * HASH_JOIN_BUILD_COST_FACTOR + probe_row_count + output_row_count});
+  }
+
+  if (JoinSortMerge::supports(configuration)) {
+    const auto sort_cost = [](const AbstractLQPNode& input, const ColumnID column_id, const Cardinality row_count) {
+      return input_is_sorted_by(input, column_id) ? Cost{0} : row_count * std::log2(row_count + 1);
+    };
+    candidates.push_back({OperatorType::JoinSortMerge, std::nullopt,
+                          sort_cost(left_input, primary_join_predicate.column_ids.first, left_row_count) +
+                              sort_cost(right_input, primary_join_predicate.column_ids.second, right_row_count) +
+                              left_row_count + right_row_count + output_row_count});
+  }
+
+  // JoinInequality always sorts its inputs. For two inequality predicates, the right input is sorted again.
+  if (JoinInequality::supports(configuration)) {
+    const auto second_sort_cost = is_two_inequality_join(configuration, secondary_join_predicates)
+                                      ? right_row_count * std::log2(right_row_count + 1)
+                                      : Cost{0};
+    candidates.push_back({OperatorType::JoinInequality, std::nullopt,
+                          left_row_count * std::log2(left_row_count + 1) +
+                              right_row_count * std::log2(right_row_count + 1) + second_sort_cost + left_row_count +
+                              right_row_count + output_row_count});
+  }
+
+  if (JoinNestedLoop::supports(configuration)) {
+    candidates.push_back(
+        {OperatorType::JoinNestedLoop, std::nullopt, left_row_count * right_row_count + output_row_count});
+  }
+
+  // JoinIndex probes the index of every chunk (or the TableIndex) of the index side with every row of the other side
+  if (configuration.left_data_type == configuration.right_data_type) {
+    const auto table_type = [](const AbstractLQPNode& input) {
+      return input.type == LQPNodeType::StoredTable ? TableType::Data : TableType::References;
+    };
+    auto index_configuration = configuration;
+    index_configuration.left_table_type = table_type(left_input);
+    index_configuration.right_table_type = table_type(right_input);
+
+    for (const auto index_side : {IndexSide::Left, IndexSide::Right}) {
+      const auto& index_input = index_side == IndexSide::Left ? left_input : right_input;
+      const auto index_column_id = index_side == IndexSide::Left ? primary_join_predicate.column_ids.first
+                                                                 : primary_join_predicate.column_ids.second;
+      index_configuration.index_side = index_side;
+      if (!JoinIndex::supports(index_configuration)) continue;
+
+      const auto index_row_count = index_side == IndexSide::Left ? left_row_count : right_row_count;
+      const auto probe_row_count = index_side == IndexSide::Left ? right_row_count : left_row_count;
+
+      // With a TableIndex, every probe row needs a single lookup instead of one per chunk
+      const auto entry_count = table_index_entry_count(index_input, index_column_id);
+      if (entry_count && JoinIndex::uses_table_index(join_node.join_mode, index_side) &&
+          TableIndex::supports(primary_join_predicate.predicate_condition)) {
+        candidates.push_back({OperatorType::JoinIndex, index_side,
+                              probe_row_count * std::log2(static_cast<Cost>(*entry_count) + 2) + output_row_count});
+        continue;
+      }
+
+      const auto chunk_count = indexed_chunk_count(index_input, index_column_id);
+      if (!chunk_count) continue;
+
+      const auto rows_per_chunk = index_row_count / static_cast<Cardinality>(*chunk_count);
+      candidates.push_back({OperatorType::JoinIndex, index_side,
+                            probe_row_count * static_cast<Cost>(*chunk_count) * std::log2(rows_per_chunk + 2) +
+                                output_row_count});
+    }
+  }
+
+  return candidates;
+}
+
+// Returns whether the rows of the node's output are known to be ordered by the expression once its chunks are
+// reordered (see AggregateSort::streaming_chunk_order), so that AggregateSort aggregates them without sorting
+bool lqp_is_ordered_by(const AbstractLQPNode& node, const AbstractExpression& expression) {
+  switch (node.type) {
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Validate:
+      return lqp_is_ordered_by(*node.left_input(), expression);
+
+    case LQPNodeType::Predicate:
+      // The TableScan drops the sort order of chunks that reference multiple chunks, such as those of a Sort
+      return node.left_input()->type != LQPNodeType::Sort && lqp_is_ordered_by(*node.left_input(), expression);
+
+    case LQPNodeType::Sort:
+      return *node.node_expressions.front() == expression;
+
+    case LQPNodeType::StoredTable: {
+      const auto* column_expression = dynamic_cast<const LQPColumnExpression*>(&expression);
+      if (!column_expression || column_expression->original_node.lock().get() != &node) return false;
+
+      // The Exchange does not keep the order of the chunks of the shards
+      const auto& stored_table_node = static_cast<const StoredTableNode&>(node);
+      if (is_sharded(stored_table_node)) return false;
+
+      const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+      return AggregateSort::streaming_chunk_order(*table, column_expression->original_column_id).has_value();
+    }
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
+LQPTranslator::LQPTranslator(SubplanResultLookup subplan_result_lookup)
+    : _subplan_result_lookup(std::move(subplan_result_lookup)) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -106,7 +449,31 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     return operator_iter->second;
   }
 
-  auto pqp = _translate_by_node_type(node->type, node);
+  if (_operator_by_lqp_node.empty() && _consumer_count_by_lqp_node.empty()) {
+    // This is the root of the plan. Count the consumers of each node, so that scans that are only used by a single
+    // other scan can be pipelined (see _translate_predicate_node). Semantically equal nodes are translated into a
+    // single operator, which is why their consumers are only counted once.
+    auto visited_nodes = LQPNodeUnorderedMap<bool>{};
+    for (const auto& root : lqp_find_subplan_roots(node)) {
+      visit_lqp(root, [&](const auto& sub_node) {
+        if (!visited_nodes.emplace(sub_node, true).second) return LQPVisitation::DoNotVisitInputs;
+        if (sub_node->left_input()) ++_consumer_count_by_lqp_node[sub_node->left_input()];
+        if (sub_node->right_input()) ++_consumer_count_by_lqp_node[sub_node->right_input()];
+        return LQPVisitation::VisitInputs;
+      });
+    }
+  }
+
+  auto pqp = std::shared_ptr<AbstractOperator>{};
+  if (_subplan_result_lookup) {
+    if (const auto subplan_result = _subplan_result_lookup(node)) {
+      pqp = std::make_shared<TableWrapper>(subplan_result);
+      pqp->comment = "Result shared by an earlier statement";
+    }
+  }
+
+  if (!pqp && Hyrise::get().cluster) pqp = _translate_node_to_exchange(node);
+  if (!pqp) pqp = _translate_by_node_type(node->type, node);
 
   // Adding the actual LQP node that led to the creation of the PQP node.  Note, the LQP needs to be set in
   // _translate_predicate_node_to_index_scan() as well, because the function creates two scans operators and returns
@@ -117,6 +484,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   return pqp;
 }
 
+const LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>>& LQPTranslator::operator_by_lqp_node() const {
+  return _operator_by_lqp_node;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     LQPNodeType type, const std::shared_ptr<AbstractLQPNode>& node) const {
   switch (type) {
@@ -135,6 +506,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::StaticTable:        return _translate_static_table_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
+    case LQPNodeType::Window:             return _translate_window_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
     case LQPNodeType::Intersect:          return _translate_intersect_node(node);
     case LQPNodeType::Except:             return _translate_except_node(node);
@@ -155,6 +527,62 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
   }
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_node_to_exchange(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Matches [Aggregate] [Predicate]* [Validate] StoredTable of a sharded table. Every fragment validates the rows.
+  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  auto input_node = aggregate_node ? node->left_input() : node;
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  while (input_node->type == LQPNodeType::Predicate) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input_node));
+    input_node = input_node->left_input();
+  }
+  if (input_node->type == LQPNodeType::Validate) input_node = input_node->left_input();
+
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(input_node);
+  if (!stored_table_node || !is_sharded(*stored_table_node)) return nullptr;
+
+  auto fragment = ShardFragment{};
+  fragment.table_name = stored_table_node->table_name;
+  fragment.pruned_column_ids = stored_table_node->pruned_column_ids();
+
+  // If a predicate cannot be executed by the fragment, the node is translated as usual and the fragment is matched
+  // again for its input
+  for (auto predicate_node_iter = predicate_nodes.rbegin(); predicate_node_iter != predicate_nodes.rend();
+       ++predicate_node_iter) {
+    const auto predicate = shard_fragment_predicate(*(*predicate_node_iter)->predicate(), *stored_table_node);
+    if (!predicate) return nullptr;
+    fragment.predicates.emplace_back(*predicate);
+  }
+
+  if (!aggregate_node) return std::make_shared<Exchange>(fragment);
+
+  const auto& node_expressions = aggregate_node->node_expressions;
+  const auto aggregate_expressions_begin_idx = aggregate_node->aggregate_expressions_begin_idx;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_expressions_begin_idx; ++expression_idx) {
+    const auto column_id = stored_table_column_id(*node_expressions[expression_idx], *stored_table_node);
+    if (!column_id) return nullptr;
+    fragment.group_by_column_ids.emplace_back(*column_id);
+  }
+  for (auto expression_idx = aggregate_expressions_begin_idx; expression_idx < node_expressions.size();
+       ++expression_idx) {
+    const auto aggregate = shard_fragment_aggregate(*node_expressions[expression_idx], *stored_table_node);
+    if (!aggregate) return nullptr;
+    fragment.aggregates.emplace_back(*aggregate);
+  }
+
+  // The final aggregate combines the partial aggregates of the nodes. Its columns are renamed to those of the node.
+  const auto final_aggregate = fragment.create_final_aggregate_pqp(std::make_shared<Exchange>(fragment));
+  auto column_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_id = ColumnID{0}; column_id < node_expressions.size(); ++column_id) {
+    const auto& expression = node_expressions[column_id];
+    column_expressions.emplace_back(std::make_shared<PQPColumnExpression>(
+        column_id, expression->data_type(), aggregate_node->is_column_nullable(column_id),
+        expression->as_column_name()));
+  }
+  return std::make_shared<Projection>(final_aggregate, column_expressions);
+}
+
 // NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -170,8 +598,34 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
   const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
-    case ScanType::TableScan:
-      return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+    case ScanType::TableScan: {
+      const auto table_scan = _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+
+      // A scan on top of another scan that has no other consumers becomes part of a PipelinedTableScan, which applies
+      // both predicates to a chunk before moving on to the next chunk. Predicates with subqueries are excluded, as
+      // the PipelinedTableScan would evaluate the subqueries for every chunk.
+      const auto consumer_count_iter = _consumer_count_by_lqp_node.find(input_node);
+      if (input_node->type != LQPNodeType::Predicate || consumer_count_iter == _consumer_count_by_lqp_node.end() ||
+          consumer_count_iter->second != 1 || expression_contains_subquery(table_scan->predicate())) {
+        return table_scan;
+      }
+
+      if (input_operator->type() == OperatorType::TableScan) {
+        const auto input_scan = std::static_pointer_cast<TableScan>(input_operator);
+        if (input_scan->excluded_chunk_ids.empty() && !expression_contains_subquery(input_scan->predicate())) {
+          return std::make_shared<PipelinedTableScan>(
+              input_scan->mutable_left_input(),
+              std::vector<std::shared_ptr<AbstractExpression>>{input_scan->predicate(), table_scan->predicate()});
+        }
+      } else if (input_operator->type() == OperatorType::PipelinedTableScan) {
+        const auto input_scan = std::static_pointer_cast<PipelinedTableScan>(input_operator);
+        auto predicates = input_scan->predicates();
+        predicates.emplace_back(table_scan->predicate());
+        return std::make_shared<PipelinedTableScan>(input_scan->mutable_left_input(), predicates);
+      }
+
+      return table_scan;
+    }
     case ScanType::IndexScan:
       return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
   }
@@ -224,12 +678,36 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
 
   const auto table_name = stored_table_node->table_name;
   const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // A TableIndex covers all chunks, so that no TableScan is needed for the chunks without index (see IndexScanRule)
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->arguments[0]);
+  const auto table_index =
+      column_expression ? table->get_table_index(column_expression->original_column_id) : nullptr;
+  if (table_index && table_index->supports(predicate->predicate_condition, value_variant, value2_variant)) {
+    auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::Invalid, column_ids,
+                                                  predicate->predicate_condition, right_values, right_values2);
+    index_scan->use_table_index = true;
+    index_scan->lqp_node = node;
+    return index_scan;
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
+  // HashIndexes are preferred for equality lookups, see IndexScanRule
+  auto index_type = SegmentIndexType::GroupKey;
+  if (predicate->predicate_condition == PredicateCondition::Equals ||
+      predicate->predicate_condition == PredicateCondition::NotEquals) {
+    for (const auto& index_statistics : table->indexes_statistics()) {
+      if (index_statistics.type == SegmentIndexType::Hash && index_statistics.column_ids == column_ids) {
+        index_type = SegmentIndexType::Hash;
+      }
+    }
+  }
+
   auto pruned_table_chunk_id = ChunkID{0};
   auto pruned_chunk_ids_iter = pruned_chunk_ids.cbegin();
 
-  // Create a vector of chunk ids that have a GroupKey index and are not pruned.
+  // Create a vector of chunk ids that have an index of that type and are not pruned.
   const auto chunk_count = table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     // Check if chunk is pruned
@@ -237,18 +715,22 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
       ++pruned_chunk_ids_iter;
       continue;
     }
-    // Check if chunk has GroupKey index
+    // Check if chunk has an index of that type
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk && chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+    if (chunk && chunk->get_index(index_type, column_ids)) {
       indexed_chunks.emplace_back(pruned_table_chunk_id);
     }
     ++pruned_table_chunk_id;
   }
 
+  // Mutable chunks are not indexed (see Table::create_index()). If no chunk has the index (yet), an IndexScan without
+  // included chunks would scan all of them.
+  if (indexed_chunks.empty()) return _translate_predicate_node_to_table_scan(node, input_operator);
+
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -296,10 +778,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = translate_node(node->left_input());
+  const auto input_operator = translate_node(node->left_input());
+
+  return std::make_shared<Sort>(input_operator, _translate_sort_definitions(sort_node));
+}
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, sort_node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
   auto sort_mode_iter = sort_node->sort_modes.begin();
@@ -314,9 +800,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *sort_mode_iter});
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -346,30 +831,116 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   }
 
   const auto& primary_join_predicate = join_predicates.front();
-  std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
-  auto join_operator = std::shared_ptr<AbstractOperator>{};
+  if (join_node->is_runtime_filter) {
+    Assert(join_node->join_mode == JoinMode::Semi && join_predicates.size() == 1 &&
+               primary_join_predicate.predicate_condition == PredicateCondition::Equals,
+           "Runtime filters are only supported for semi joins with a single equals predicate");
+    return std::make_shared<RuntimeFilterScan>(left_input_operator, right_input_operator,
+                                               primary_join_predicate.column_ids);
+  }
+
+  std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
+  const auto configuration = JoinConfiguration{join_node->join_mode, primary_join_predicate.predicate_condition,
+                                               left_data_type, right_data_type, !secondary_join_predicates.empty()};
+
+  const auto make_join_operator = [&](const JoinOperatorCandidate& candidate) -> std::shared_ptr<AbstractOperator> {
+    switch (candidate.operator_type) {
+      case OperatorType::JoinHash: {
+        const auto join_hash = std::make_shared<JoinHash>(left_input_operator, right_input_operator,
+                                                          join_node->join_mode, primary_join_predicate,
+                                                          secondary_join_predicates);
+        join_hash->estimated_left_distinct_count =
+            estimated_distinct_count(node->left_input(), primary_join_predicate.column_ids.first);
+        join_hash->estimated_right_distinct_count =
+            estimated_distinct_count(node->right_input(), primary_join_predicate.column_ids.second);
+        return join_hash;
+      }
+      case OperatorType::JoinSortMerge:
+        return std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                               primary_join_predicate, secondary_join_predicates);
+      case OperatorType::JoinInequality:
+        return std::make_shared<JoinInequality>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                primary_join_predicate, secondary_join_predicates);
+      case OperatorType::JoinNestedLoop:
+        return std::make_shared<JoinNestedLoop>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                primary_join_predicate, secondary_join_predicates);
+      case OperatorType::JoinIndex:
+        return std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                           primary_join_predicate, secondary_join_predicates, *candidate.index_side);
+      default:
+        Fail("Not a join operator");
+    }
+  };
+
+  // Without cardinality estimates, we assume JoinHash is always faster than JoinSortMerge, which is faster than
+  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order. The exception are inputs
+  // that are both sorted by their join columns: JoinSortMerge does not sort them again, but only merges them.
+  auto rule_based_operator_type = std::optional<OperatorType>{};
+  if (JoinHash::supports(configuration)) {
+    rule_based_operator_type = OperatorType::JoinHash;
+  } else if (JoinSortMerge::supports(configuration)) {
+    rule_based_operator_type = OperatorType::JoinSortMerge;
+  } else if (JoinNestedLoop::supports(configuration)) {
+    rule_based_operator_type = OperatorType::JoinNestedLoop;
+  }
+  const auto inputs_are_sorted =
+      input_is_sorted_by(*node->left_input(), primary_join_predicate.column_ids.first) &&
+      input_is_sorted_by(*node->right_input(), primary_join_predicate.column_ids.second) &&
+      JoinSortMerge::supports(configuration);
+  if (inputs_are_sorted) rule_based_operator_type = OperatorType::JoinSortMerge;
+
+  // JoinSortMerge and JoinNestedLoop evaluate the secondary predicates for every match of the primary predicate, which
+  // are mostly no matches of the join for band joins (see is_two_inequality_join())
+  const auto two_inequalities = is_two_inequality_join(configuration, secondary_join_predicates);
+  if (two_inequalities) rule_based_operator_type = OperatorType::JoinInequality;
+  Assert(rule_based_operator_type,
+         "No operator implementation available for join '"s + join_node->description() + "'");
+
+  // With a calibrated cost model, the join operator with the lowest estimated runtime is used. The calibrated cost
+  // model does not know about sorted inputs and the JoinInequality.
+  const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients;
+  if (cost_model_coefficients && !inputs_are_sorted && !two_inequalities) {
+    const auto cost_estimator =
+        CostEstimatorCalibrated{std::make_shared<CardinalityEstimator>(), cost_model_coefficients};
+    const auto cheapest_operator_type = cost_estimator.cheapest_join_operator(join_node);
+    if (cheapest_operator_type) {
+      const auto join_operator = make_join_operator({*cheapest_operator_type});
+      join_operator->comment = "Chosen by the calibrated cost model";
+      return join_operator;
+    }
+  }
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
-  constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
-      hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
-
-  boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
-    using JoinOperator = typename decltype(join_operator_t)::type;
-
-    if (join_operator) return;
+  // Otherwise, the rule-based choice is compared with the alternatives (including index joins) using estimated costs
+  const auto candidates =
+      join_operator_candidates(*join_node, configuration, primary_join_predicate, secondary_join_predicates);
+
+  const auto rule_based_candidate_iter =
+      std::find_if(candidates.begin(), candidates.end(), [&](const auto& candidate) {
+        return candidate.operator_type == *rule_based_operator_type && !candidate.index_side;
+      });
+  DebugAssert(rule_based_candidate_iter != candidates.end(), "Rule-based join operator should be a candidate");
+  const auto cheapest_candidate_iter =
+      std::min_element(candidates.begin(), candidates.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.cost < rhs.cost; });
+
+  auto chosen_candidate = *rule_based_candidate_iter;
+  if (cheapest_candidate_iter->cost * MIN_JOIN_COST_IMPROVEMENT_FACTOR <= rule_based_candidate_iter->cost) {
+    chosen_candidate = *cheapest_candidate_iter;
+  }
 
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
-      join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
-                                                     primary_join_predicate, std::move(secondary_join_predicates));
+  const auto join_operator = make_join_operator(chosen_candidate);
+  if (candidates.size() > 1) {
+    auto comment = std::stringstream{};
+    comment << "Estimated costs: ";
+    for (auto candidate_iter = candidates.begin(); candidate_iter != candidates.end(); ++candidate_iter) {
+      comment << (candidate_iter == candidates.begin() ? "" : ", ") << *candidate_iter;
     }
-  });
-  Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
+    join_operator->comment = comment.str();
+  }
 
   return join_operator;
 }
@@ -378,6 +949,9 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
+  const auto group_join = _translate_aggregate_node_to_group_join(aggregate_node);
+  if (group_join) return group_join;
+
   const auto input_operator = translate_node(node->left_input());
 
   std::vector<std::shared_ptr<AggregateExpression>> pqp_aggregate_expressions;
@@ -410,26 +984,119 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
-  return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
+  // If the input is ordered by the only GROUP BY column, AggregateSort streams over it without hashing or sorting
+  if (group_by_column_ids.size() == 1 && lqp_is_ordered_by(*node->left_input(), *aggregate_node->node_expressions[0])) {
+    return std::make_shared<AggregateSort>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
+  }
+
+  const auto aggregate_hash =
+      std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
+
+  // Let the AggregateHash reserve the estimated number of groups, which is known if the GROUP BY columns have distinct
+  // count sketches
+  if (!group_by_column_ids.empty()) {
+    const auto input_table_statistics = CardinalityEstimator{}.estimate_statistics(node->left_input());
+    const auto group_count = CardinalityEstimator::estimate_group_count(*aggregate_node, *input_table_statistics);
+    if (group_count) aggregate_hash->estimated_group_count = static_cast<size_t>(std::ceil(*group_count));
+  }
+
+  return aggregate_hash;
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node_to_group_join(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  // A GroupJoin replaces a join that is only used by the aggregate, if the aggregate groups by the join key
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(aggregate_node->left_input());
+  if (!join_node || join_node->output_count() != 1 || join_node->join_mode == JoinMode::Cross ||
+      join_node->join_predicates().size() != 1 || aggregate_node->aggregate_expressions_begin_idx != 1) {
+    return nullptr;
+  }
+
+  const auto join_predicate = OperatorJoinPredicate::from_expression(*join_node->join_predicates().front(),
+                                                                     *join_node->left_input(), *join_node->right_input());
+  if (!join_predicate) return nullptr;
+
+  const auto& left_join_column = join_node->left_input()->output_expressions()[join_predicate->column_ids.first];
+  const auto& right_join_column = join_node->right_input()->output_expressions()[join_predicate->column_ids.second];
+  if (!GroupJoin::supports({join_node->join_mode, join_predicate->predicate_condition, left_join_column->data_type(),
+                            right_join_column->data_type(), false})) {
+    return nullptr;
+  }
+
+  // For inner joins, both join columns hold the same values. Left outer joins have NULLs in the right join column.
+  const auto& groupby_expression = *aggregate_node->node_expressions.front();
+  const auto left_column_count = static_cast<ColumnCount>(join_node->left_input()->output_expressions().size());
+  auto groupby_column_id = join_predicate->column_ids.first;
+  if (groupby_expression != *left_join_column) {
+    if (join_node->join_mode != JoinMode::Inner || groupby_expression != *right_join_column) return nullptr;
+    groupby_column_id = static_cast<ColumnID>(left_column_count + join_predicate->column_ids.second);
+  }
+
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  aggregates.reserve(aggregate_node->node_expressions.size() - 1);
+  for (auto expression_idx = size_t{1}; expression_idx < aggregate_node->node_expressions.size(); ++expression_idx) {
+    const auto& lqp_expression = aggregate_node->node_expressions[expression_idx];
+    if (lqp_expression->type != ExpressionType::Aggregate) return nullptr;
+
+    const auto aggregate =
+        std::static_pointer_cast<AggregateExpression>(_translate_expression(lqp_expression, join_node));
+    if (!GroupJoin::supports_aggregate(*aggregate, left_column_count)) return nullptr;
+    aggregates.emplace_back(aggregate);
+  }
+
+  return std::make_shared<GroupJoin>(translate_node(join_node->left_input()), translate_node(join_node->right_input()),
+                                     join_node->join_mode, *join_predicate, aggregates, groupby_column_id);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+
+  // An ORDER BY followed by a LIMIT becomes a TopK, unless the sorted result is also used elsewhere
+  const auto& input_node = node->left_input();
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1) {
+    const auto sort_node = std::static_pointer_cast<SortNode>(input_node);
+    return std::make_shared<TopK>(
+        translate_node(sort_node->left_input()), _translate_sort_definitions(sort_node),
+        _translate_expressions({limit_node->num_rows_expression()}, sort_node->left_input()).front());
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  const auto row_count_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  // If the Limit is the only consumer of its input and its row count is known, the input operator may stop early (see
+  // AbstractOperator::row_budget). Semantically equal inputs share an operator, so their consumers are counted
+  // together. Row counts of prepared statements are only known once the parameters are set.
+  const auto consumer_count_iter = _consumer_count_by_lqp_node.find(input_node);
+  const auto row_count_data_type = row_count_expression->data_type();
+  if (consumer_count_iter != _consumer_count_by_lqp_node.end() && consumer_count_iter->second == 1 &&
+      row_count_expression->type == ExpressionType::Value &&
+      (row_count_data_type == DataType::Int || row_count_data_type == DataType::Long)) {
+    input_operator->row_budget = Limit::evaluate_row_count(*row_count_expression);
+  }
+
+  return std::make_shared<Limit>(input_operator, row_count_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
+  auto input_operator = translate_node(node->left_input());
   auto insert_node = std::dynamic_pointer_cast<InsertNode>(node);
+
+  // The rows of sharded tables are inserted by the nodes that store them
+  const auto& cluster = Hyrise::get().cluster;
+  if (cluster && cluster->is_sharded(insert_node->table_name)) {
+    input_operator = std::make_shared<Exchange>(input_operator, insert_node->table_name);
+  }
   return std::make_shared<Insert>(insert_node->table_name, input_operator);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_delete_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Delete requires references to the stored table, but the Exchange materializes the rows of the shards
+  AssertInput(!lqp_reads_sharded_table(node->left_input()), "DELETE is not supported on sharded tables");
+
   const auto input_operator = translate_node(node->left_input());
   auto delete_node = std::dynamic_pointer_cast<DeleteNode>(node);
   return std::make_shared<Delete>(input_operator);
@@ -438,6 +1105,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_delete_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_update_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   auto update_node = std::dynamic_pointer_cast<UpdateNode>(node);
+  AssertInput(!lqp_reads_sharded_table(node->left_input()), "UPDATE is not supported on sharded tables");
 
   const auto input_operator_left = translate_node(node->left_input());
   const auto input_operator_right = translate_node(node->right_input());
@@ -463,16 +1131,20 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
   Fail("Invalid enum value.");
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intersect_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  FailInput("Hyrise does not yet support set operations");
+  const auto intersect_node = std::static_pointer_cast<IntersectNode>(node);
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+  return std::make_shared<Intersect>(input_operator_left, input_operator_right, intersect_node->set_operation_mode);
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_except_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  FailInput("Hyrise does not yet support set operations");
+  const auto except_node = std::static_pointer_cast<ExceptNode>(node);
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+  return std::make_shared<Difference>(input_operator_left, input_operator_right, except_node->set_operation_mode);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
@@ -481,6 +1153,15 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_input());
+  const auto window_node = std::static_pointer_cast<WindowNode>(node);
+  const auto window_function_expression = std::static_pointer_cast<WindowFunctionExpression>(
+      _translate_expression(window_node->window_function_expression(), node->left_input()));
+  return std::make_shared<Window>(input_operator, window_function_expression);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator_left = translate_node(node->left_input());
@@ -533,7 +1214,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_import_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto import_node = std::dynamic_pointer_cast<ImportNode>(node);
   return std::make_shared<Import>(import_node->file_name, import_node->table_name, Chunk::DEFAULT_SIZE,
-                                  import_node->file_type);
+                                  import_node->file_type, std::nullopt, import_node->column_names,
+                                  import_node->row_groups);
 }
 
 // NOLINTNEXTLINE - while this particular method could be made static, others cannot.
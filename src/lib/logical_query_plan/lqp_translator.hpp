@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 
@@ -12,7 +13,10 @@ namespace opossum {
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class AggregateNode;
 class PredicateNode;
+class SortNode;
+class Table;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -23,14 +27,29 @@ struct OperatorJoinPredicate;
  */
 class LQPTranslator {
  public:
+  // Returns an already computed result for the sub-plan rooted in the given node or nullptr (see sql_subplan_cache.hpp)
+  using SubplanResultLookup = std::function<std::shared_ptr<const Table>(const std::shared_ptr<AbstractLQPNode>&)>;
+
+  LQPTranslator() = default;
+
+  // Sub-plans for which @param subplan_result_lookup returns a result are translated into TableWrappers of that result
+  explicit LQPTranslator(SubplanResultLookup subplan_result_lookup);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // The operators that the translated LQP nodes resulted in
+  const LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>>& operator_by_lqp_node() const;
+
  private:
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Translates the reads of sharded tables into Exchange operators (see cluster.hpp) and executes as much of the plan
+  // above them on the shards as possible. Returns nullptr if the node is not the root of such a plan.
+  std::shared_ptr<AbstractOperator> _translate_node_to_exchange(const std::shared_ptr<AbstractLQPNode>& node) const;
+
   std::shared_ptr<AbstractOperator> _translate_stored_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
@@ -40,8 +59,11 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_definitions(const std::shared_ptr<SortNode>& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_aggregate_node_to_group_join(
+      const std::shared_ptr<AggregateNode>& aggregate_node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -54,6 +76,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_change_meta_table_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_window_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -78,6 +101,11 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Number of (deduplicated) consumers of each node in the translated LQP, including its subqueries
+  mutable LQPNodeUnorderedMap<size_t> _consumer_count_by_lqp_node;
+
+  const SubplanResultLookup _subplan_result_lookup;
 };
 
 }  // namespace opossum
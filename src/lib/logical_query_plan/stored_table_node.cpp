@@ -97,9 +97,12 @@ bool StoredTableNode::is_column_nullable(const ColumnID column_id) const {
 std::shared_ptr<LQPUniqueConstraints> StoredTableNode::unique_constraints() const {
   auto unique_constraints = std::make_shared<LQPUniqueConstraints>();
 
-  // We create unique constraints from selected table key constraints
+  // We create unique constraints from selected table key constraints, both declared and discovered ones
   const auto& table = Hyrise::get().storage_manager.get_table(table_name);
-  const auto& table_key_constraints = table->soft_key_constraints();
+  auto table_key_constraints = table->soft_key_constraints();
+  const auto discovered_key_constraints = table->discovered_soft_key_constraints();
+  table_key_constraints.insert(table_key_constraints.end(), discovered_key_constraints.cbegin(),
+                               discovered_key_constraints.cend());
 
   for (const TableKeyConstraint& table_key_constraint : table_key_constraints) {
     // Discard key constraints that involve pruned column id(s).
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class WindowFunctionExpression;
+
+/**
+ * This node type computes a window function (see WindowFunctionExpression), e.g., `RANK() OVER (ORDER BY a)`, for each
+ * row of its input. Its output consists of the input columns, followed by the result of the window function. The
+ * PARTITION BY, ORDER BY, and argument expressions are expected to be computed by an input node.
+ */
+class WindowNode : public EnableMakeForLQPNode<WindowNode>, public AbstractLQPNode {
+ public:
+  explicit WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression);
+
+  std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
+  std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  // Forwards unique constraints from the left input node
+  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,185 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <new>
+#include <string>
+
+#include "pool_memory_resource.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+size_t round_up(const size_t bytes, const size_t page_size) { return (bytes + page_size - 1) / page_size * page_size; }
+
+#ifdef MAP_HUGETLB
+// Returns nullptr if the huge pages of hugetlbfs are exhausted or not configured
+void* map_explicit_huge_pages(const size_t length) {
+  auto flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_1GB) && defined(MAP_HUGE_2MB)
+  flags |= length % HugePageMemoryResource::GIGANTIC_PAGE_SIZE == 0 ? MAP_HUGE_1GB : MAP_HUGE_2MB;
+#endif
+  auto* const pointer = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+  return pointer == MAP_FAILED ? nullptr : pointer;
+}
+#endif
+
+// mmap only guarantees the alignment of normal pages, but transparent huge pages can only back 2 MB aligned ranges.
+// Thus, we map an additional huge page and unmap the unaligned head and the tail.
+void* map_aligned_pages(const size_t length, const bool advise_huge_pages) {
+  const auto mapping_length = length + HugePageMemoryResource::HUGE_PAGE_SIZE;
+  auto* const mapping =
+      mmap(nullptr, mapping_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) throw std::bad_alloc{};
+
+  const auto mapping_address = reinterpret_cast<uintptr_t>(mapping);
+  const auto address = round_up(mapping_address, HugePageMemoryResource::HUGE_PAGE_SIZE);
+  const auto head_length = address - mapping_address;
+  const auto tail_length = mapping_length - head_length - length;
+  if (head_length > 0) munmap(mapping, head_length);
+  if (tail_length > 0) munmap(reinterpret_cast<void*>(address + length), tail_length);
+
+  auto* const pointer = reinterpret_cast<void*>(address);
+#ifdef MADV_HUGEPAGE
+  // The advice fails if the kernel does not support transparent huge pages, in which case normal pages are used
+  if (advise_huge_pages) madvise(pointer, length, MADV_HUGEPAGE);
+#endif
+  return pointer;
+}
+
+std::string mode_to_string(const HugePageMode mode) {
+  switch (mode) {
+    case HugePageMode::Disabled:
+      return "disabled";
+    case HugePageMode::Transparent:
+      return "transparent";
+    case HugePageMode::Explicit:
+      return "explicit";
+  }
+  Fail("Invalid enum value");
+}
+
+class HugePageModeSetting : public AbstractSetting {
+ public:
+  HugePageModeSetting(const std::string& init_name, HugePageMemoryResource& resource)
+      : AbstractSetting(init_name), _resource(resource) {}
+
+  const std::string& description() const final {
+    static const auto description = std::string{
+        "Page size of large allocations: disabled (normal pages), transparent (transparent huge pages), or explicit "
+        "(huge pages of hugetlbfs)"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = mode_to_string(_resource.mode());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    for (const auto mode : {HugePageMode::Disabled, HugePageMode::Transparent, HugePageMode::Explicit}) {
+      if (value == mode_to_string(mode)) {
+        _resource.set_mode(mode);
+        return;
+      }
+    }
+    AssertInput(false, "Expected disabled, transparent, or explicit for " + name);
+  }
+
+ private:
+  HugePageMemoryResource& _resource;
+  std::string _value;
+};
+
+}  // namespace
+
+namespace opossum {
+
+HugePageMemoryResource& HugePageMemoryResource::get(const HugePageAllocationClass allocation_class) {
+  // Leaked for the same reason as the default resource (see boost_default_memory_resource.cpp)
+  switch (allocation_class) {
+    case HugePageAllocationClass::Intermediates: {
+      // Smaller allocations are cached by the pool, larger ones would be mmap'ed by malloc anyway
+      static auto* instance =  // NOLINT
+          new HugePageMemoryResource(allocation_class, PoolMemoryResource::MAX_POOLED_BYTES + 1,
+                                     &PoolMemoryResource::get());
+      return *instance;
+    }
+    case HugePageAllocationClass::Segments: {
+      static auto* instance =  // NOLINT
+          new HugePageMemoryResource(allocation_class, HUGE_PAGE_SIZE, boost::container::pmr::get_default_resource());
+      return *instance;
+    }
+  }
+  Fail("Invalid enum value");
+}
+
+size_t HugePageMemoryResource::mapped_size(const size_t bytes) {
+  return round_up(bytes, bytes >= GIGANTIC_PAGE_SIZE ? GIGANTIC_PAGE_SIZE : HUGE_PAGE_SIZE);
+}
+
+HugePageMemoryResource::HugePageMemoryResource(const HugePageAllocationClass allocation_class, const size_t min_bytes,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _allocation_class(allocation_class), _min_bytes(min_bytes), _upstream(upstream) {}
+
+HugePageMode HugePageMemoryResource::mode() const { return _mode.load(std::memory_order_relaxed); }
+
+void HugePageMemoryResource::set_mode(const HugePageMode mode) { _mode.store(mode, std::memory_order_relaxed); }
+
+size_t HugePageMemoryResource::min_bytes() const { return _min_bytes; }
+
+size_t HugePageMemoryResource::mapped_bytes() const { return _mapped_bytes.load(std::memory_order_relaxed); }
+
+void HugePageMemoryResource::register_settings() {
+  Assert(_settings.empty(), "Settings are already registered");
+
+  const auto name = std::string{_allocation_class == HugePageAllocationClass::Intermediates
+                                    ? "Memory.huge_pages.intermediates"
+                                    : "Memory.huge_pages.segments"};
+  _settings.emplace_back(std::make_shared<HugePageModeSetting>(name, *this));
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+}
+
+void HugePageMemoryResource::unregister_settings() {
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
+}
+
+void* HugePageMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes < _min_bytes) return _upstream->allocate(bytes, alignment);
+  DebugAssert(alignment <= HUGE_PAGE_SIZE, "HugePageMemoryResource does not support alignments beyond a huge page");
+
+  const auto length = mapped_size(bytes);
+  const auto mode = this->mode();
+  auto* pointer = static_cast<void*>(nullptr);
+#ifdef MAP_HUGETLB
+  if (mode == HugePageMode::Explicit) pointer = map_explicit_huge_pages(length);
+#endif
+  if (!pointer) pointer = map_aligned_pages(length, mode != HugePageMode::Disabled);
+
+  _mapped_bytes.fetch_add(length, std::memory_order_relaxed);
+  return pointer;
+}
+
+void HugePageMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  if (bytes < _min_bytes) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  const auto length = mapped_size(bytes);
+  munmap(pointer, length);
+  _mapped_bytes.fetch_sub(length, std::memory_order_relaxed);
+}
+
+bool HugePageMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
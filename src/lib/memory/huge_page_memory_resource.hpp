@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+namespace opossum {
+
+class AbstractSetting;
+
+enum class HugePageMode {
+  // Large allocations are mapped with the normal page size
+  Disabled,
+  // Large allocations are 2 MB aligned and madvise'd to be backed by transparent huge pages
+  Transparent,
+  // Large allocations are mapped from the pre-reserved huge pages of hugetlbfs (1 GB pages for allocations of at least
+  // 1 GB, 2 MB pages otherwise). If no huge pages are available, Transparent is used instead.
+  Explicit
+};
+
+enum class HugePageAllocationClass {
+  // Buffers of operators (e.g., the hash tables of joins and aggregates), which are forwarded to the
+  // PoolMemoryResource if they are small
+  Intermediates,
+  // Buffers of segments that are migrated with place_chunks_on_huge_pages(), which are forwarded to the default
+  // resource if they are small
+  Segments
+};
+
+/**
+ * Memory resource that maps large allocations directly with mmap so that they can be backed by huge pages. Scans of
+ * large segments and random accesses to large hash tables cause a TLB miss for almost every 4 KB page they touch. With
+ * 2 MB pages, the TLB covers 512 times as much memory.
+ *
+ * There is one resource per allocation class, whose mode can be changed at runtime (e.g., through the setting
+ * "Memory.huge_pages.intermediates" after register_settings()). Allocations below min_bytes() are forwarded to the
+ * upstream resource of the class. Larger allocations are always mapped, also if huge pages are disabled, so that they
+ * can be unmapped without knowing the mode at the time of their allocation.
+ *
+ * The resource of the Intermediates class is the upstream of the TrackingMemoryResources of queries and operators.
+ */
+class HugePageMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto HUGE_PAGE_SIZE = size_t{2} * 1024 * 1024;
+  static constexpr auto GIGANTIC_PAGE_SIZE = size_t{1024} * 1024 * 1024;
+
+  // Resources live until the process exits, as data allocated from them might outlive all other objects (cf.
+  // boost_default_memory_resource.cpp).
+  static HugePageMemoryResource& get(const HugePageAllocationClass allocation_class);
+
+  // Returns the number of bytes that are mapped for a large allocation of `bytes`
+  static size_t mapped_size(const size_t bytes);
+
+  HugePageMode mode() const;
+  void set_mode(const HugePageMode mode);
+
+  size_t min_bytes() const;
+
+  // The bytes of all large allocations that are currently mapped (i.e., including the rounding to whole pages)
+  size_t mapped_bytes() const;
+
+  void register_settings();
+  void unregister_settings();
+
+ protected:
+  HugePageMemoryResource(const HugePageAllocationClass allocation_class, const size_t min_bytes,
+                         boost::container::pmr::memory_resource* upstream);
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const HugePageAllocationClass _allocation_class;
+  const size_t _min_bytes;
+  boost::container::pmr::memory_resource* const _upstream;
+
+  std::atomic<HugePageMode> _mode{HugePageMode::Transparent};
+  std::atomic<size_t> _mapped_bytes{0};
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+
+#include <numa.h>
+
+#endif
+
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <new>
+
+#include "utils/assert.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+
+namespace {
+
+// numa_available() issues a system call, so we only call it once
+bool numa_is_available() {
+  static const auto is_available = numa_available() >= 0;
+  return is_available;
+}
+
+}  // namespace
+
+#endif
+
+namespace opossum {
+
+NUMAMemoryResource* NUMAMemoryResource::get(const NodeID node_id) {
+  Assert(node_id != INVALID_NODE_ID && node_id != CURRENT_NODE_ID, "Expected an actual node");
+
+  // Yes, this leaks on purpose (see boost_default_memory_resource.cpp). A deque does not move its elements when it
+  // grows, so that handed out resources stay valid.
+  static auto* resources = new std::deque<NUMAMemoryResource>();  // NOLINT
+  static auto resources_mutex = std::mutex{};
+
+  const auto lock = std::lock_guard<std::mutex>{resources_mutex};
+  while (resources->size() <= static_cast<size_t>(node_id)) {
+    resources->emplace_back(NUMAMemoryResource{NodeID{static_cast<NodeID::base_type>(resources->size())}});
+  }
+  return &(*resources)[node_id];
+}
+
+NUMAMemoryResource::NUMAMemoryResource(const NodeID node_id) : _node_id(node_id) {}
+
+NodeID NUMAMemoryResource::node_id() const { return _node_id; }
+
+void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (bytes >= NUMA_ALLOCATION_THRESHOLD && numa_is_available()) {
+    // numa_alloc_onnode returns page-aligned memory, which satisfies any alignment
+    auto* const pointer = numa_alloc_onnode(bytes, static_cast<int>(_node_id));
+    if (!pointer) throw std::bad_alloc{};
+    return pointer;
+  }
+#endif
+
+  // Like the default resource, we rely on malloc's alignment (cf. boost_default_memory_resource.cpp)
+  auto* const pointer = std::malloc(bytes);  // NOLINT
+  if (!pointer) throw std::bad_alloc{};
+  return pointer;
+}
+
+void NUMAMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (bytes >= NUMA_ALLOCATION_THRESHOLD && numa_is_available()) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+
+  std::free(pointer);  // NOLINT
+}
+
+bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcept {
+  return dynamic_cast<const NUMAMemoryResource*>(&other) != nullptr;
+}
+
+}  // namespace opossum
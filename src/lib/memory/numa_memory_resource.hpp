@@ -0,0 +1,41 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that places allocations on a given NUMA node. Large allocations (i.e., the buffers of segments) are
+ * bound to the node using libnuma. Small allocations are served by malloc and thus placed where they are first
+ * touched, which is the node of the allocating thread. To place all data of a chunk on a node, the chunk should be
+ * migrated by a task that is scheduled on that node (see place_chunks_on_numa_nodes()).
+ *
+ * Without NUMA support, all allocations are served by malloc.
+ *
+ * Memory allocated with one NUMAMemoryResource can be deallocated by any other NUMAMemoryResource.
+ */
+class NUMAMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  // Returns the resource of the given node. Resources are never destroyed, as chunks might outlive all other objects
+  // (cf. boost_default_memory_resource.cpp).
+  static NUMAMemoryResource* get(const NodeID node_id);
+
+  NodeID node_id() const;
+
+  // Allocations of at least this size are bound to the node with libnuma, which rounds them up to whole pages
+  static constexpr auto NUMA_ALLOCATION_THRESHOLD = size_t{64 * 1'024};
+
+ protected:
+  explicit NUMAMemoryResource(const NodeID node_id);
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const NodeID _node_id;
+};
+
+}  // namespace opossum
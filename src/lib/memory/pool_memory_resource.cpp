@@ -0,0 +1,118 @@
+#include "pool_memory_resource.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto MIN_EXPONENT = std::bit_width(PoolMemoryResource::MIN_BLOCK_SIZE) - 1;
+constexpr auto SUB_CLASS_BITS = 2;
+constexpr auto SUB_CLASS_COUNT = size_t{1} << SUB_CLASS_BITS;
+
+// Size class 0 holds requests of up to MIN_BLOCK_SIZE bytes. The following classes split each power of two into
+// SUB_CLASS_COUNT classes, e.g., 80, 96, 112, and 128 bytes.
+constexpr size_t size_class(const size_t bytes) {
+  if (bytes <= PoolMemoryResource::MIN_BLOCK_SIZE) return 0;
+
+  const auto exponent = std::bit_width(bytes - 1) - 1;
+  const auto sub_class = ((bytes - 1) >> (exponent - SUB_CLASS_BITS)) & (SUB_CLASS_COUNT - 1);
+  return static_cast<size_t>(exponent - MIN_EXPONENT) * SUB_CLASS_COUNT + sub_class + 1;
+}
+
+constexpr size_t size_class_block_size(const size_t size_class) {
+  if (size_class == 0) return PoolMemoryResource::MIN_BLOCK_SIZE;
+
+  const auto exponent = (size_class - 1) / SUB_CLASS_COUNT + MIN_EXPONENT;
+  const auto sub_class = (size_class - 1) % SUB_CLASS_COUNT;
+  return (SUB_CLASS_COUNT + sub_class + 1) << (exponent - SUB_CLASS_BITS);
+}
+
+constexpr auto SIZE_CLASS_COUNT = size_class(PoolMemoryResource::MAX_POOLED_BYTES) + 1;
+
+thread_local auto thread_cache_destroyed = false;
+
+struct ThreadCache {
+  ThreadCache() = default;
+
+  ThreadCache(const ThreadCache&) = delete;
+  ThreadCache& operator=(const ThreadCache&) = delete;
+
+  ~ThreadCache() {
+    thread_cache_destroyed = true;
+    for (const auto& blocks : free_blocks) {
+      for (auto* const block : blocks) {
+        std::free(block);  // NOLINT
+      }
+    }
+  }
+
+  std::array<std::vector<void*>, SIZE_CLASS_COUNT> free_blocks;
+  size_t cached_bytes{0};
+};
+
+// Returns nullptr once the cache of the thread was destroyed, e.g., if static objects are freed at exit
+ThreadCache* thread_cache() {
+  if (thread_cache_destroyed) return nullptr;
+  thread_local auto cache = ThreadCache{};
+  return &cache;
+}
+
+}  // namespace
+
+namespace opossum {
+
+PoolMemoryResource& PoolMemoryResource::get() {
+  // Leaked for the same reason as the default resource (see boost_default_memory_resource.cpp)
+  static auto* instance = new PoolMemoryResource();  // NOLINT
+  return *instance;
+}
+
+size_t PoolMemoryResource::block_size(const size_t bytes) {
+  if (bytes > MAX_POOLED_BYTES) return bytes;
+  return size_class_block_size(size_class(bytes));
+}
+
+void* PoolMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  DebugAssert(alignment <= alignof(std::max_align_t), "PoolMemoryResource does not support over-aligned types");
+  if (bytes > MAX_POOLED_BYTES) return std::malloc(bytes);  // NOLINT
+
+  const auto block_size_class = size_class(bytes);
+  auto* const cache = thread_cache();
+  if (!cache || cache->free_blocks[block_size_class].empty()) {
+    return std::malloc(size_class_block_size(block_size_class));  // NOLINT
+  }
+
+  auto& blocks = cache->free_blocks[block_size_class];
+  auto* const block = blocks.back();
+  blocks.pop_back();
+  cache->cached_bytes -= size_class_block_size(block_size_class);
+  return block;
+}
+
+void PoolMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  if (bytes > MAX_POOLED_BYTES) {
+    std::free(pointer);  // NOLINT
+    return;
+  }
+
+  const auto block_size_class = size_class(bytes);
+  const auto block_size = size_class_block_size(block_size_class);
+  auto* const cache = thread_cache();
+  if (!cache || cache->cached_bytes + block_size > THREAD_CACHE_CAPACITY) {
+    std::free(pointer);  // NOLINT
+    return;
+  }
+
+  cache->free_blocks[block_size_class].emplace_back(pointer);
+  cache->cached_bytes += block_size;
+}
+
+bool PoolMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+namespace opossum {
+
+/**
+ * Memory resource for intermediate results that caches freed blocks in thread-local pools of size classes, so that
+ * the many short-lived buffers of a query (e.g., position lists, expression results, and hash tables) are reused
+ * instead of being returned to malloc. Large buffers in particular would otherwise be mmap'ed and unmapped for every
+ * allocation, each time causing page faults when the memory is first touched.
+ *
+ * Requests are rounded up to one of four size classes per power of two (i.e., by less than 25%) and blocks of a class
+ * are plain malloc'ed blocks of its size. Thus, a block can be freed by any thread: it is then cached by that thread.
+ * Requests beyond MAX_POOLED_BYTES and blocks that do not fit into the THREAD_CACHE_CAPACITY of a thread are directly
+ * forwarded to malloc and free. The caches of a thread are freed once it exits.
+ *
+ * Base data does not use this resource, as the rounding would waste memory for long-lived allocations. It serves the
+ * small allocations of queries and operators (see HugePageMemoryResource) and is the default resource of RowIDPosLists.
+ */
+class PoolMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto MIN_BLOCK_SIZE = size_t{64};
+  static constexpr auto MAX_POOLED_BYTES = size_t{4} * 1024 * 1024;
+  static constexpr auto THREAD_CACHE_CAPACITY = size_t{16} * 1024 * 1024;
+
+  // The resource lives until the process exits, so that it can be used by objects that outlive the query, such as
+  // the output tables of operators.
+  static PoolMemoryResource& get();
+
+  // Returns the number of bytes that are allocated for a request of `bytes`
+  static size_t block_size(const size_t bytes);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  PoolMemoryResource() = default;
+};
+
+}  // namespace opossum
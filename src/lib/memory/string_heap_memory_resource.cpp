@@ -0,0 +1,75 @@
+#include "string_heap_memory_resource.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringHeapMemoryResource::StringHeapMemoryResource(boost::container::pmr::memory_resource* upstream)
+    : _upstream(upstream) {}
+
+StringHeapMemoryResource::~StringHeapMemoryResource() {
+  for (const auto& block : _blocks) {
+    _upstream->deallocate(block.data, block.size, ALIGNMENT);
+  }
+  for (const auto& [pointer, size_and_alignment] : _large_allocations) {
+    _upstream->deallocate(pointer, size_and_alignment.first, size_and_alignment.second);
+  }
+}
+
+size_t StringHeapMemoryResource::allocated_bytes() const { return _allocated_bytes.load(std::memory_order_relaxed); }
+
+void* StringHeapMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (_is_large(bytes, alignment)) {
+    auto* const pointer = _upstream->allocate(bytes, alignment);
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _large_allocations.emplace(pointer, std::pair{bytes, alignment});
+    _allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    return pointer;
+  }
+
+  // Rounding up keeps the offsets of all allocations aligned
+  const auto size = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  while (true) {
+    auto* const block = _current_block.load(std::memory_order_acquire);
+    if (block) {
+      const auto offset = block->used.fetch_add(size, std::memory_order_relaxed);
+      if (offset + size <= block->size) return block->data + offset;
+    }
+    _add_block(block, size);
+  }
+}
+
+void StringHeapMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  // The bytes of small allocations stay in their block (see class comment)
+  if (!_is_large(bytes, alignment)) return;
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto erased_count = _large_allocations.erase(pointer);
+    DebugAssert(erased_count == 1, "Pointer was not allocated from this StringHeapMemoryResource");
+  }
+  _allocated_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+  _upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool StringHeapMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+bool StringHeapMemoryResource::_is_large(const size_t bytes, const size_t alignment) {
+  return bytes > LARGE_ALLOCATION_BYTES || alignment > ALIGNMENT;
+}
+
+void StringHeapMemoryResource::_add_block(const Block* full_block, const size_t min_size) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_current_block.load(std::memory_order_relaxed) != full_block) return;
+
+  const auto block_size =
+      std::max(_blocks.empty() ? MIN_BLOCK_SIZE : std::min(_blocks.back().size * 2, MAX_BLOCK_SIZE), min_size);
+  auto* const data = static_cast<std::byte*>(_upstream->allocate(block_size, ALIGNMENT));
+  _blocks.emplace_back(data, block_size);
+  _allocated_bytes.fetch_add(block_size, std::memory_order_relaxed);
+  _current_block.store(&_blocks.back(), std::memory_order_release);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that places the characters of the strings of one ValueSegment<pmr_string> back to back in a few
+ * contiguous blocks, similar to the character buffer of an Arrow string column. With the default resource, every
+ * string that does not fit into the small string buffer is a separate malloc, so that appending to a mutable chunk
+ * is bound by the allocator and scanning it causes a cache miss per string. Here, an allocation only bumps an atomic
+ * offset in the current block, and strings that were appended one after another are adjacent in memory.
+ *
+ * Freeing a string does not free its bytes, they are released with the resource. This fits ValueSegments, whose
+ * values are written once (see Insert and ValueSegment::append). Blocks start at MIN_BLOCK_SIZE and double up to
+ * MAX_BLOCK_SIZE, so that small segments stay small. Allocations larger than LARGE_ALLOCATION_BYTES (e.g., the buffer
+ * of the value vector itself) or with an alignment beyond ALIGNMENT are forwarded to the upstream resource and freed
+ * when they are deallocated.
+ *
+ * Allocations may happen concurrently, as multiple Insert operators write to the same segment. The resource must
+ * outlive all strings that were allocated from it. As copies of pmr_strings use the default resource (see
+ * select_on_container_copy_construction), only moving strings out of the segment would break this.
+ */
+class StringHeapMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  static constexpr auto MIN_BLOCK_SIZE = size_t{4} * 1024;
+  static constexpr auto MAX_BLOCK_SIZE = size_t{1024} * 1024;
+  static constexpr auto LARGE_ALLOCATION_BYTES = MAX_BLOCK_SIZE / 4;
+  static constexpr auto ALIGNMENT = alignof(uint64_t);
+
+  explicit StringHeapMemoryResource(
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+  ~StringHeapMemoryResource() override;
+
+  // Bytes of the blocks and of the forwarded large allocations
+  size_t allocated_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  struct Block {
+    Block(std::byte* init_data, const size_t init_size) : data(init_data), size(init_size) {}
+
+    std::byte* const data;
+    const size_t size;
+    std::atomic<size_t> used{0};
+  };
+
+  static bool _is_large(const size_t bytes, const size_t alignment);
+
+  // Adds a block of at least min_size bytes, unless another thread already replaced full_block
+  void _add_block(const Block* full_block, const size_t min_size);
+
+  boost::container::pmr::memory_resource* const _upstream;
+
+  std::atomic<Block*> _current_block{nullptr};
+
+  // Protects _blocks and _large_allocations. Blocks are never removed before the resource is destroyed and a deque
+  // does not move its elements when appending, so that _current_block can be read without the mutex.
+  mutable std::mutex _mutex;
+  std::deque<Block> _blocks;
+  std::unordered_map<void*, std::pair<size_t, size_t>> _large_allocations;  // size, alignment
+  std::atomic<size_t> _allocated_bytes{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#include "tracking_memory_resource.hpp"
+
+#include "huge_page_memory_resource.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TrackingMemoryResource::TrackingMemoryResource(const std::shared_ptr<TrackingMemoryResource>& parent,
+                                               const std::optional<size_t> limit)
+    : _parent(parent),
+      _upstream(parent ? static_cast<boost::container::pmr::memory_resource*>(parent.get())
+                       : static_cast<boost::container::pmr::memory_resource*>(
+                             &HugePageMemoryResource::get(HugePageAllocationClass::Intermediates))),
+      _limit(limit) {}
+
+size_t TrackingMemoryResource::allocated_bytes() const { return _allocated_bytes.load(std::memory_order_relaxed); }
+
+size_t TrackingMemoryResource::peak_allocated_bytes() const {
+  return _peak_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+const std::optional<size_t>& TrackingMemoryResource::limit() const { return _limit; }
+
+bool TrackingMemoryResource::limit_exceeded() const { return _limit_exceeded.load(std::memory_order_relaxed); }
+
+void TrackingMemoryResource::add_bytes(const size_t bytes) {
+  _count_allocation(bytes);
+  if (_parent) _parent->add_bytes(bytes);
+}
+
+void TrackingMemoryResource::remove_bytes(const size_t bytes) {
+  _count_deallocation(bytes);
+  if (_parent) _parent->remove_bytes(bytes);
+}
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // If the parent is the upstream resource, it counts the allocation itself
+  auto* const pointer = _upstream->allocate(bytes, alignment);
+  _count_allocation(bytes);
+  return pointer;
+}
+
+void TrackingMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  _upstream->deallocate(pointer, bytes, alignment);
+  _count_deallocation(bytes);
+}
+
+bool TrackingMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+void TrackingMemoryResource::_count_allocation(const size_t bytes) {
+  const auto allocated_bytes = _allocated_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+  auto peak_allocated_bytes = _peak_allocated_bytes.load(std::memory_order_relaxed);
+  while (allocated_bytes > peak_allocated_bytes &&
+         !_peak_allocated_bytes.compare_exchange_weak(peak_allocated_bytes, allocated_bytes,
+                                                      std::memory_order_relaxed)) {}
+
+  if (_limit && allocated_bytes > *_limit) _limit_exceeded = true;
+}
+
+void TrackingMemoryResource::_count_deallocation(const size_t bytes) {
+  DebugAssert(allocated_bytes() >= bytes, "Deallocating more bytes than were allocated");
+  _allocated_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace opossum
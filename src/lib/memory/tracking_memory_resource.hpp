@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that counts the bytes that are currently allocated from it and the peak of that count, and forwards
+ * all allocations to its upstream resource. Used to account the memory of a query (see query_context.hpp) and of its
+ * operators (see AbstractOperator::_memory_resource()). The upstream resource is the parent or, without a parent, the
+ * HugePageMemoryResource of intermediates. It forwards small allocations to the PoolMemoryResource, so that the
+ * intermediate results of queries reuse freed buffers, and backs large ones (e.g., hash tables) with huge pages.
+ *
+ * If a parent is given, allocations are also counted by the parent, so that the parent accounts for all of its
+ * children. Once the bytes counted by a resource with a limit exceed the limit, limit_exceeded() stays true. The
+ * allocation itself still succeeds, as the operators' tasks cannot handle exceptions. Instead, the query is cancelled
+ * cooperatively.
+ *
+ * Allocations may happen concurrently, which is why the counters are atomic.
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(const std::shared_ptr<TrackingMemoryResource>& parent = nullptr,
+                                  const std::optional<size_t> limit = std::nullopt);
+
+  size_t allocated_bytes() const;
+  size_t peak_allocated_bytes() const;
+
+  const std::optional<size_t>& limit() const;
+  bool limit_exceeded() const;
+
+  // Accounts for memory that is not allocated from the resource, e.g., the output tables of operators. The bytes are
+  // also added to or removed from the parent.
+  void add_bytes(const size_t bytes);
+  void remove_bytes(const size_t bytes);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  void _count_allocation(const size_t bytes);
+  void _count_deallocation(const size_t bytes);
+
+  const std::shared_ptr<TrackingMemoryResource> _parent;
+  boost::container::pmr::memory_resource* const _upstream;
+  const std::optional<size_t> _limit;
+
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _peak_allocated_bytes{0};
+  std::atomic_bool _limit_exceeded{false};
+};
+
+}  // namespace opossum
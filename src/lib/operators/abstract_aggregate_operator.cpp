@@ -71,8 +71,9 @@ void AbstractAggregateOperator::_validate_aggregates() const {
       Assert(input_table->column_data_type(column_id) != DataType::String ||
                  (aggregate->aggregate_function != AggregateFunction::Sum &&
                   aggregate->aggregate_function != AggregateFunction::Avg &&
-                  aggregate->aggregate_function != AggregateFunction::StandardDeviationSample),
-             "Aggregate: Cannot calculate SUM, AVG or STDDEV_SAMP on string column");
+                  aggregate->aggregate_function != AggregateFunction::StandardDeviationSample &&
+                  aggregate->aggregate_function != AggregateFunction::ApproxPercentile),
+             "Aggregate: Cannot calculate SUM, AVG, STDDEV_SAMP or APPROX_PERCENTILE on string column");
     }
   }
 }
@@ -3,6 +3,8 @@
 #include "expression/aggregate_expression.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/aggregate/hyper_log_log.hpp"
+#include "operators/aggregate/quantile_sketch.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 
@@ -125,6 +127,30 @@ class AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction:
   }
 };
 
+template <typename ColumnDataType, typename AggregateType>
+class AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct> {
+ public:
+  auto get_aggregate_function() {
+    return [](const ColumnDataType& new_value, const size_t aggregate_count, HyperLogLog& accumulator) {
+      accumulator.add(new_value);
+    };
+  }
+};
+
+template <typename ColumnDataType, typename AggregateType>
+class AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxPercentile> {
+ public:
+  auto get_aggregate_function() {
+    return [](const ColumnDataType& new_value, const size_t aggregate_count, QuantileSketch& accumulator) {
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        accumulator.add(static_cast<double>(new_value));
+      } else {
+        Fail("ApproxPercentile not available for non-arithmetic types.");
+      }
+    };
+  }
+};
+
 class AbstractAggregateOperator : public AbstractReadOnlyOperator {
  public:
   AbstractAggregateOperator(const std::shared_ptr<AbstractOperator>& in,
@@ -6,9 +6,12 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "concurrency/query_context.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_non_query_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "resolve_type.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
@@ -16,6 +19,7 @@
 #include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
+#include "utils/sampling_profiler.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -26,6 +30,8 @@ AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_pt
                                    std::unique_ptr<AbstractOperatorPerformanceData> init_performance_data)
     : performance_data(std::move(init_performance_data)), _type(type), _left_input(left), _right_input(right) {}
 
+AbstractOperator::~AbstractOperator() { clear_output(); }
+
 OperatorType AbstractOperator::type() const { return _type; }
 
 void AbstractOperator::execute() {
@@ -36,6 +42,12 @@ void AbstractOperator::execute() {
 
   Timer performance_timer;
 
+  const auto& sampling_profiler = Hyrise::get().sampling_profiler;
+  auto sampling_measurement = sampling_profiler ? sampling_profiler->start() : SamplingProfiler::Measurement{};
+
+  _tracking_memory_resource =
+      std::make_shared<TrackingMemoryResource>(_query_context ? _query_context->memory_resource() : nullptr);
+
   auto transaction_context = this->transaction_context();
 
   if (transaction_context) {
@@ -56,15 +68,25 @@ void AbstractOperator::execute() {
 
   // release any temporary data if possible
   _on_cleanup();
+  performance_data->peak_memory_usage = _tracking_memory_resource->peak_allocated_bytes();
 
   if (_output) {
     performance_data->has_output = true;
     performance_data->output_row_count = _output->row_count();
     performance_data->output_chunk_count = _output->chunk_count();
+
+    // Stored tables are not intermediate results of the query
+    if (_query_context && _type != OperatorType::GetTable) {
+      _accounted_output_bytes = _output->memory_usage(MemoryUsageCalculationMode::Sampled);
+      _tracking_memory_resource->add_bytes(_accounted_output_bytes);
+    }
   }
   performance_data->walltime = performance_timer.lap();
   performance_data->executed = true;
 
+  Hyrise::get().operator_statistics.record(*this);
+  sampling_measurement.stop(*this);
+
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
                 reinterpret_cast<uintptr_t>(this));
@@ -122,7 +144,14 @@ void AbstractOperator::execute() {
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const { return _output; }
 
-void AbstractOperator::clear_output() { _output = nullptr; }
+void AbstractOperator::clear_output() {
+  _output = nullptr;
+
+  if (_accounted_output_bytes > 0) {
+    _tracking_memory_resource->remove_bytes(_accounted_output_bytes);
+    _accounted_output_bytes = 0;
+  }
+}
 
 std::string AbstractOperator::description(DescriptionMode description_mode) const { return name(); }
 
@@ -156,6 +185,49 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_right_input) mutable_right_input()->set_transaction_context_recursively(transaction_context);
 }
 
+void AbstractOperator::set_query_context_recursively(const std::shared_ptr<QueryContext>& query_context) {
+  _query_context = query_context;
+
+  if (_left_input) mutable_left_input()->set_query_context_recursively(query_context);
+  if (_right_input) mutable_right_input()->set_query_context_recursively(query_context);
+}
+
+const std::shared_ptr<QueryContext>& AbstractOperator::query_context() const { return _query_context; }
+
+const std::shared_ptr<TrackingMemoryResource>& AbstractOperator::_memory_resource() const {
+  DebugAssert(_tracking_memory_resource, "Memory resource is only set once the operator is executed");
+  return _tracking_memory_resource;
+}
+
+std::optional<size_t> AbstractOperator::_remaining_memory_budget() const {
+  if (!_query_context) return std::nullopt;
+
+  const auto& memory_resource = *_query_context->memory_resource();
+  const auto& limit = memory_resource.limit();
+  if (!limit) return std::nullopt;
+
+  const auto allocated_bytes = memory_resource.allocated_bytes();
+  return allocated_bytes < *limit ? *limit - allocated_bytes : 0;
+}
+
+bool AbstractOperator::is_cancelled() const { return _query_context && _query_context->is_cancelled(); }
+
+std::pair<size_t, size_t> AbstractOperator::progress() const {
+  return {_processed_chunk_count.load(std::memory_order_relaxed), _total_chunk_count.load(std::memory_order_relaxed)};
+}
+
+void AbstractOperator::_set_total_chunk_count(const size_t chunk_count) const {
+  _total_chunk_count.store(chunk_count, std::memory_order_relaxed);
+}
+
+void AbstractOperator::_add_processed_chunks(const size_t chunk_count) const {
+  _processed_chunk_count.fetch_add(chunk_count, std::memory_order_relaxed);
+}
+
+bool AbstractOperator::_row_budget_reached(const size_t output_row_count) const {
+  return row_budget && output_row_count >= *row_budget;
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_left_input() const {
   return std::const_pointer_cast<AbstractOperator>(_left_input);
 }
@@ -190,6 +262,9 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   auto copied_op = _on_deep_copy(copied_left_input, copied_right_input);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->lqp_node = lqp_node;
+  copied_op->comment = comment;
+  copied_op->row_budget = row_budget;
 
   copied_ops.emplace(this, copied_op);
 
@@ -206,6 +281,9 @@ std::ostream& operator<<(std::ostream& stream, const AbstractOperator& abstract_
 
   const auto node_print_fn = [&](const auto& op, auto& fn_stream) {
     fn_stream << op->description();
+    if (!op->comment.empty()) {
+      fn_stream << " [" << op->comment << "]";
+    }
 
     // If the operator was already executed, print some info about data and performance
     const auto output = op->get_output();
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
@@ -12,7 +15,9 @@
 namespace opossum {
 
 class OperatorTask;
+class QueryContext;
 class Table;
+class TrackingMemoryResource;
 class TransactionContext;
 
 enum class OperatorType {
@@ -26,27 +31,35 @@ enum class OperatorType {
   DropView,
   Delete,
   Difference,
+  Exchange,
   Export,
   GetTable,
+  GroupJoin,
   Import,
   IndexScan,
   Insert,
+  Intersect,
   JoinHash,
   JoinIndex,
+  JoinInequality,
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
   Limit,
+  PipelinedTableScan,
   Print,
   Product,
   Projection,
+  RuntimeFilterScan,
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
   Validate,
+  Window,
   Mock  // for Tests that need to Mock operators
 };
 
@@ -71,7 +84,7 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
                    std::unique_ptr<AbstractOperatorPerformanceData> performance_data =
                        std::make_unique<OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>>());
 
-  virtual ~AbstractOperator() = default;
+  virtual ~AbstractOperator();
 
   OperatorType type() const;
 
@@ -98,6 +111,18 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Sets the context of the running query on itself and both input operators recursively (see query_context.hpp)
+  void set_query_context_recursively(const std::shared_ptr<QueryContext>& query_context);
+  const std::shared_ptr<QueryContext>& query_context() const;
+
+  // Returns true if the query that the operator belongs to has been cancelled. Operators with per-chunk loops check
+  // this between the chunks and return an incomplete output once it is true.
+  bool is_cancelled() const;
+
+  // The number of input chunks that the operator has processed and that it processes in total. The total is zero for
+  // operators that do not report their progress.
+  std::pair<size_t, size_t> progress() const;
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
@@ -122,6 +147,14 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // LQP node with which this operator has been created. Might be uninitialized.
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
+  // Holds a (short) comment that is printed with the plan and during plan visualization. For example, the
+  // LQPTranslator explains why it chose a join implementation. It is not part of the description.
+  std::string comment;
+
+  // Set by the LQPTranslator if the only consumer of the output (e.g., a Limit) needs no more than this many rows.
+  // Operators with per-chunk loops stop processing further chunks once their output has that many rows.
+  std::optional<size_t> row_budget;
+
   std::unique_ptr<AbstractOperatorPerformanceData> performance_data;
 
  protected:
@@ -141,6 +174,23 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // override this if the Operator uses Expressions and set the transaction context in the SubqueryExpressions
   virtual void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Operators allocate their intermediate data structures (e.g., hash tables) from this resource, so that their memory
+  // is accounted for the query (see query_context.hpp). Set when the operator is executed. Allocations must not outlive
+  // the operator, unless they hold the resource.
+  const std::shared_ptr<TrackingMemoryResource>& _memory_resource() const;
+
+  // The number of bytes that the operator may still allocate before its query exceeds the memory limit. std::nullopt if
+  // the query has no limit. Operators that can spill their intermediate data to disk (e.g., JoinHash) do so if they
+  // expect to exceed the budget.
+  std::optional<size_t> _remaining_memory_budget() const;
+
+  // Used by operators with per-chunk loops to report their progress
+  void _set_total_chunk_count(const size_t chunk_count) const;
+  void _add_processed_chunks(const size_t chunk_count = 1) const;
+
+  // Returns true if an output of @param output_row_count rows satisfies the row_budget
+  bool _row_budget_reached(const size_t output_row_count) const;
+
   void _print_impl(std::ostream& out, std::vector<bool>& levels,
                    std::unordered_map<const AbstractOperator*, size_t>& id_by_operator, size_t& id_counter) const;
 
@@ -163,6 +213,14 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
+
+  std::shared_ptr<QueryContext> _query_context;
+  std::shared_ptr<TrackingMemoryResource> _tracking_memory_resource;
+  // The memory usage of the output table, which is accounted for the query until the output is cleared
+  size_t _accounted_output_bytes{0};
+  // Mutable, as JoinHash reports the progress from its const implementation
+  mutable std::atomic<size_t> _processed_chunk_count{0};
+  mutable std::atomic<size_t> _total_chunk_count{0};
 };
 
 std::ostream& operator<<(std::ostream& stream, const AbstractOperator& abstract_operator);
@@ -1,13 +1,129 @@
 #include "abstract_read_only_operator.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns, for each column of the chunk, the index of the first column that shares its position list, or an empty
+// vector if the chunk has a segment that is not a ReferenceSegment. Two chunks can only be merged if the pattern of
+// shared position lists is the same, so that the merged chunk shares its position lists in the same way.
+std::vector<ColumnID> pos_list_owners(const Chunk& chunk) {
+  const auto column_count = chunk.column_count();
+  auto owners = std::vector<ColumnID>(column_count);
+  auto owner_by_pos_list = std::unordered_map<const AbstractPosList*, ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+    if (!reference_segment) return {};
+
+    owners[column_id] = owner_by_pos_list.try_emplace(reference_segment->pos_list().get(), column_id).first->second;
+  }
+  return owners;
+}
+
+bool references_same_columns(const Chunk& lhs, const Chunk& rhs) {
+  for (auto column_id = ColumnID{0}; column_id < lhs.column_count(); ++column_id) {
+    const auto& lhs_segment = static_cast<const ReferenceSegment&>(*lhs.get_segment(column_id));
+    const auto& rhs_segment = static_cast<const ReferenceSegment&>(*rhs.get_segment(column_id));
+    if (lhs_segment.referenced_table() != rhs_segment.referenced_table() ||
+        lhs_segment.referenced_column_id() != rhs_segment.referenced_column_id()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::shared_ptr<Chunk> merge_chunks(const std::vector<std::shared_ptr<Chunk>>& chunks, const size_t begin,
+                                    const size_t end, const size_t row_count, const std::vector<ColumnID>& owners) {
+  const auto& first_chunk = *chunks[begin];
+  const auto column_count = first_chunk.column_count();
+
+  auto merged_pos_lists = std::vector<std::shared_ptr<RowIDPosList>>(column_count);
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto& merged_pos_list = merged_pos_lists[owners[column_id]];
+    if (!merged_pos_list) {
+      merged_pos_list = std::make_shared<RowIDPosList>();
+      merged_pos_list->reserve(row_count);
+      for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+        const auto& segment = static_cast<const ReferenceSegment&>(*chunks[chunk_index]->get_segment(column_id));
+        const auto& pos_list = *segment.pos_list();
+        merged_pos_list->insert(merged_pos_list->end(), pos_list.cbegin(), pos_list.cend());
+      }
+
+      // The chunks may still reference a single chunk or ascending positions, e.g., if they are the result of
+      // scanning a single input chunk in several jobs
+      const auto first_chunk_id = merged_pos_list->empty() ? INVALID_CHUNK_ID : merged_pos_list->front().chunk_id;
+      if (std::all_of(merged_pos_list->cbegin(), merged_pos_list->cend(),
+                      [&](const auto& row_id) { return row_id.chunk_id == first_chunk_id; })) {
+        merged_pos_list->guarantee_single_chunk();
+      }
+      if (std::is_sorted(merged_pos_list->cbegin(), merged_pos_list->cend())) merged_pos_list->guarantee_sorted();
+    }
+
+    const auto& first_segment = static_cast<const ReferenceSegment&>(*first_chunk.get_segment(column_id));
+    segments.emplace_back(std::make_shared<ReferenceSegment>(first_segment.referenced_table(),
+                                                             first_segment.referenced_column_id(), merged_pos_list));
+  }
+
+  const auto chunk = std::make_shared<Chunk>(std::move(segments), nullptr, first_chunk.get_allocator());
+  chunk->finalize();
+  return chunk;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<const Table> AbstractReadOnlyOperator::_on_execute(std::shared_ptr<TransactionContext>) {
   return _on_execute();
 }
 
+std::vector<std::shared_ptr<Chunk>> AbstractReadOnlyOperator::_coalesce_reference_chunks(
+    std::vector<std::shared_ptr<Chunk>>&& chunks) {
+  if (chunks.size() < MIN_CHUNK_COUNT_TO_COALESCE) return std::move(chunks);
+
+  const auto is_coalescable = [](const Chunk& chunk) {
+    return chunk.size() < MIN_COALESCED_CHUNK_SIZE && chunk.individually_sorted_by().empty();
+  };
+
+  auto coalesced_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  coalesced_chunks.reserve(chunks.size());
+
+  const auto chunk_count = chunks.size();
+  auto begin = size_t{0};
+  while (begin < chunk_count) {
+    auto end = begin + 1;
+    auto row_count = size_t{chunks[begin]->size()};
+
+    const auto owners = is_coalescable(*chunks[begin]) ? pos_list_owners(*chunks[begin]) : std::vector<ColumnID>{};
+    if (!owners.empty()) {
+      while (end < chunk_count && is_coalescable(*chunks[end]) &&
+             row_count + chunks[end]->size() <= MAX_COALESCED_CHUNK_SIZE && pos_list_owners(*chunks[end]) == owners &&
+             references_same_columns(*chunks[begin], *chunks[end])) {
+        row_count += chunks[end]->size();
+        ++end;
+      }
+    }
+
+    if (end == begin + 1) {
+      coalesced_chunks.emplace_back(std::move(chunks[begin]));
+    } else {
+      coalesced_chunks.emplace_back(merge_chunks(chunks, begin, end, row_count, owners));
+    }
+    begin = end;
+  }
+
+  return coalesced_chunks;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "operators/abstract_operator.hpp"
 #include "storage/table.hpp"
@@ -14,6 +15,12 @@ class AbstractReadOnlyOperator : public AbstractOperator {
  public:
   using AbstractOperator::AbstractOperator;
 
+  // Output chunks of reference tables with fewer rows than MIN_COALESCED_CHUNK_SIZE are merged with their neighbors
+  // into chunks of at most MAX_COALESCED_CHUNK_SIZE rows (see _coalesce_reference_chunks).
+  static constexpr auto MIN_COALESCED_CHUNK_SIZE = ChunkOffset{500};
+  static constexpr auto MAX_COALESCED_CHUNK_SIZE = ChunkOffset{MIN_COALESCED_CHUNK_SIZE * 2};
+  static constexpr auto MIN_CHUNK_COUNT_TO_COALESCE = size_t{64};
+
  protected:
   // This override exists so that all AbstractReadOnlyOperators can ignore the transaction context
   // Apart from Validate and GetTable, none of the read-only operators needs the transaction context.
@@ -21,6 +28,14 @@ class AbstractReadOnlyOperator : public AbstractOperator {
 
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // Selective operators (e.g., the TableScan) emit one output chunk per input chunk, so that thousands of chunks with
+  // only a handful of rows each are common. Each of these chunks costs every following operator a job, a set of
+  // ReferenceSegments, and a split of its position lists. If there are at least MIN_CHUNK_COUNT_TO_COALESCE chunks,
+  // consecutive small chunks whose segments reference the same columns are merged into one chunk with concatenated
+  // position lists. As a trade-off, the merged position lists usually lose the references_single_chunk property.
+  // Chunks with an individual sort order are kept as they are, as the merged chunk would lose it.
+  static std::vector<std::shared_ptr<Chunk>> _coalesce_reference_chunks(std::vector<std::shared_ptr<Chunk>>&& chunks);
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in table_scan.hpp.
@@ -28,6 +43,14 @@ class AbstractReadOnlyOperator : public AbstractOperator {
    public:
     virtual ~AbstractReadOnlyOperatorImpl() = default;
     virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // Selective operators (e.g., the TableScan) emit one output chunk per input chunk, so that thousands of chunks with
+  // only a handful of rows each are common. Each of these chunks costs every following operator a job, a set of
+  // ReferenceSegments, and a split of its position lists. If there are at least MIN_CHUNK_COUNT_TO_COALESCE chunks,
+  // consecutive small chunks whose segments reference the same columns are merged into one chunk with concatenated
+  // position lists. As a trade-off, the merged position lists usually lose the references_single_chunk property.
+  // Chunks with an individual sort order are kept as they are, as the merged chunk would lose it.
+  static std::vector<std::shared_ptr<Chunk>> _coalesce_reference_chunks(std::vector<std::shared_ptr<Chunk>>&& chunks);
   };
 };
 
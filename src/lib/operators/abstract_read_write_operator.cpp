@@ -42,6 +42,14 @@ void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   _state = ReadWriteOperatorState::Committed;
 }
 
+void AbstractReadWriteOperator::write_log_records(std::vector<char>& records) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Only committed operators write log records.");
+
+  _on_write_log_records(records);
+}
+
+void AbstractReadWriteOperator::_on_write_log_records(std::vector<char>& records) const {}
+
 void AbstractReadWriteOperator::rollback_records() {
   Assert(_state == ReadWriteOperatorState::Conflicted || _state == ReadWriteOperatorState::Executed,
          "Operator needs to have state Failed or Executed in order to be rolled back.");
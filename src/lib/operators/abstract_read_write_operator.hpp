@@ -41,6 +41,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void commit_records(const CommitID commit_id);
 
+  /**
+   * Appends the redo records of the committed changes for the WriteAheadLog (see write_ahead_log.hpp).
+   */
+  void write_log_records(std::vector<char>& records) const;
+
   /**
    * Rolls back the operator by unlocking all modified rows. No other action is necessary since commit_records should
    * have never been called and the modifications were not made visible in the first place.
@@ -75,6 +80,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by write_log_records. Operators that only forward to other read/write operators (e.g., Update, whose Delete
+   * and Insert are registered at the transaction context themselves) do not write records.
+   */
+  virtual void _on_write_log_records(std::vector<char>& records) const;
+
   /**
    * Called by rollback_records.
    */
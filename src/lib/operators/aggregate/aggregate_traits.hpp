@@ -26,6 +26,13 @@ struct AggregateTraits<ColumnType, AggregateFunction::CountDistinct> {
   static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Long;
 };
 
+// APPROX_COUNT_DISTINCT on all types
+template <typename ColumnType>
+struct AggregateTraits<ColumnType, AggregateFunction::ApproxCountDistinct> {
+  typedef int64_t AggregateType;
+  static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Long;
+};
+
 // MIN/MAX/ANY on all types
 template <typename ColumnType, AggregateFunction aggregate_function>
 struct AggregateTraits<ColumnType, aggregate_function,
@@ -75,14 +82,26 @@ struct AggregateTraits<
   static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Double;
 };
 
-// invalid: AVG, SUM or STDDEV_SAMP on non-arithmetic types
+// APPROX_PERCENTILE on arithmetic types
 template <typename ColumnType, AggregateFunction aggregate_function>
 struct AggregateTraits<ColumnType, aggregate_function,
-                       typename std::enable_if_t<!std::is_arithmetic_v<ColumnType> &&
-                                                     (aggregate_function == AggregateFunction::Avg ||
-                                                      aggregate_function == AggregateFunction::Sum ||
-                                                      aggregate_function == AggregateFunction::StandardDeviationSample),
+                       typename std::enable_if_t<aggregate_function == AggregateFunction::ApproxPercentile &&
+                                                     std::is_arithmetic_v<ColumnType>,
                                                  void>> {
+  typedef double AggregateType;
+  static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Double;
+};
+
+// invalid: AVG, SUM, STDDEV_SAMP, or APPROX_PERCENTILE on non-arithmetic types
+template <typename ColumnType, AggregateFunction aggregate_function>
+struct AggregateTraits<
+    ColumnType, aggregate_function,
+    typename std::enable_if_t<!std::is_arithmetic_v<ColumnType> &&
+                                  (aggregate_function == AggregateFunction::Avg ||
+                                   aggregate_function == AggregateFunction::Sum ||
+                                   aggregate_function == AggregateFunction::StandardDeviationSample ||
+                                   aggregate_function == AggregateFunction::ApproxPercentile),
+                              void>> {
   typedef ColumnType AggregateType;
   static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Null;
 };
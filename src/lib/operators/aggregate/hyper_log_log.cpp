@@ -0,0 +1,70 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+
+// Finalizer of MurmurHash3, which spreads every input bit over all output bits
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xFF51AFD7ED558CCD};
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xC4CEB9FE1A85EC53};
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  if (_registers.empty()) _registers.resize(REGISTER_COUNT);
+
+  const auto mixed_hash = mix(hash);
+  const auto register_index = mixed_hash >> (64 - PRECISION);
+  const auto remaining_bits = mixed_hash << PRECISION;
+  const auto rank =
+      static_cast<uint8_t>(std::min(std::countl_zero(remaining_bits), static_cast<int>(64 - PRECISION)) + 1);
+
+  auto& register_value = _registers[register_index];
+  register_value = std::max(register_value, rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._registers.empty()) return;
+  if (_registers.empty()) {
+    _registers = other._registers;
+    return;
+  }
+
+  for (auto register_index = size_t{0}; register_index < REGISTER_COUNT; ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+uint64_t HyperLogLog::estimate() const {
+  if (_registers.empty()) return 0;
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto register_value : _registers) {
+    inverse_sum += std::ldexp(1.0, -register_value);
+    if (register_value == 0) ++zero_register_count;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, the raw estimate is biased and linear counting of the empty registers is more precise.
+  // As the hashes have 64 bits, no correction for hash collisions is needed for large cardinalities.
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return std::llround(register_count * std::log(register_count / static_cast<double>(zero_register_count)));
+  }
+  return std::llround(raw_estimate);
+}
+
+}  // namespace opossum
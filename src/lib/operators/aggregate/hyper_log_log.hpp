@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch that estimates the number of distinct values, used by APPROX_COUNT_DISTINCT (Flajolet et al.:
+ * HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm, 2007).
+ *
+ * Each value is hashed to 64 bits. The first PRECISION bits select one of REGISTER_COUNT registers, which keeps the
+ * maximum position of the first set bit in the remaining bits. The estimate is derived from the harmonic mean of the
+ * registers, using linear counting for small cardinalities. With a PRECISION of 12, a sketch takes 4 KB and has a
+ * standard error of about 1.6%, independent of the number of values.
+ *
+ * Sketches are merged by taking the maximum of each register, which makes them suitable for parallel aggregation. The
+ * registers are allocated when the first value is added, so that empty sketches (e.g., of preallocated groups) are
+ * cheap.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = uint8_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  // The hash does not need to be well-distributed (e.g., std::hash<int32_t> is the identity), it is mixed again
+  void add_hash(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  uint64_t estimate() const;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include "quantile_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void QuantileSketch::add(const double value) {
+  if (_compactors.empty()) _compactors.resize(1);
+
+  _compactors[0].emplace_back(value);
+  ++_value_count;
+  ++_count;
+
+  auto max_value_count = size_t{0};
+  for (auto level = size_t{0}; level < _compactors.size(); ++level) {
+    max_value_count += _capacity(level);
+  }
+  if (_value_count >= max_value_count) _compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+  if (other._compactors.size() > _compactors.size()) _compactors.resize(other._compactors.size());
+
+  for (auto level = size_t{0}; level < other._compactors.size(); ++level) {
+    _compactors[level].insert(_compactors[level].end(), other._compactors[level].begin(),
+                              other._compactors[level].end());
+  }
+  _value_count += other._value_count;
+  _count += other._count;
+
+  while (true) {
+    auto max_value_count = size_t{0};
+    for (auto level = size_t{0}; level < _compactors.size(); ++level) {
+      max_value_count += _capacity(level);
+    }
+    if (_value_count < max_value_count) break;
+    _compress();
+  }
+}
+
+double QuantileSketch::quantile(const double quantile) const {
+  Assert(_count > 0, "Cannot estimate a quantile without values");
+  Assert(quantile >= 0.0 && quantile <= 1.0, "Quantile must be between 0 and 1");
+
+  auto weighted_values = std::vector<std::pair<double, uint64_t>>{};
+  weighted_values.reserve(_value_count);
+  auto total_weight = uint64_t{0};
+  for (auto level = size_t{0}; level < _compactors.size(); ++level) {
+    const auto weight = uint64_t{1} << level;
+    for (const auto value : _compactors[level]) {
+      weighted_values.emplace_back(value, weight);
+    }
+    total_weight += weight * _compactors[level].size();
+  }
+  std::sort(weighted_values.begin(), weighted_values.end());
+
+  const auto target_weight = quantile * static_cast<double>(total_weight);
+  auto cumulative_weight = uint64_t{0};
+  for (const auto& [value, weight] : weighted_values) {
+    cumulative_weight += weight;
+    if (static_cast<double>(cumulative_weight) >= target_weight) return value;
+  }
+  return weighted_values.back().first;
+}
+
+uint64_t QuantileSketch::count() const { return _count; }
+
+size_t QuantileSketch::_capacity(const size_t level) const {
+  const auto height = static_cast<double>(_compactors.size() - level - 1);
+  return std::max(size_t{2}, static_cast<size_t>(std::ceil(static_cast<double>(K) * std::pow(2.0 / 3.0, height))));
+}
+
+void QuantileSketch::_compress() {
+  for (auto level = size_t{0}; level < _compactors.size(); ++level) {
+    if (_compactors[level].size() < _capacity(level)) continue;
+
+    if (level + 1 == _compactors.size()) _compactors.emplace_back();
+    auto& compactor = _compactors[level];
+    auto& next_compactor = _compactors[level + 1];
+
+    std::sort(compactor.begin(), compactor.end());
+
+    // xorshift64 as a deterministic coin
+    _coin_state ^= _coin_state << 13;
+    _coin_state ^= _coin_state >> 7;
+    _coin_state ^= _coin_state << 17;
+    const auto offset = static_cast<size_t>(_coin_state & 1);
+
+    // With an odd number of values, the smallest one stays in the compactor
+    const auto begin = compactor.size() % 2;
+    for (auto value_idx = begin + offset; value_idx < compactor.size(); value_idx += 2) {
+      next_compactor.emplace_back(compactor[value_idx]);
+    }
+    _value_count -= compactor.size() - begin;
+    _value_count += (compactor.size() - begin) / 2;
+    compactor.resize(begin);
+    return;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * KLL sketch that estimates quantiles of a stream of values, used by APPROX_PERCENTILE (Karnin, Lang, Liberty: Optimal
+ * Quantile Approximation in Streams, 2016).
+ *
+ * The values are kept in compactors. A value in the compactor of level h stands for 2^h input values. Once the sketch
+ * holds more values than it has capacity for, the lowest compactor that exceeds its own capacity is sorted and either
+ * its even or its odd values are promoted to the next level, while the others are dropped. The capacity of a level
+ * shrinks geometrically with its distance from the top level, so that the sketch keeps about 3 * K values. With a K
+ * of 200, the rank error of the estimated quantiles is about 1.7%. Until the first compaction, the quantiles are exact.
+ *
+ * Sketches are merged by concatenating their compactors and compacting the result, which makes them suitable for
+ * parallel aggregation. The coin that decides between the even and odd values is deterministic, so that the results
+ * are reproducible.
+ */
+class QuantileSketch {
+ public:
+  static constexpr auto K = size_t{200};
+
+  void add(const double value);
+
+  void merge(const QuantileSketch& other);
+
+  // Returns the smallest value whose rank is at least `quantile` (between 0 and 1) of all values. Expects at least one
+  // value to have been added.
+  double quantile(const double quantile) const;
+
+  // The number of added values
+  uint64_t count() const;
+
+ private:
+  size_t _capacity(const size_t level) const;
+  void _compress();
+
+  std::vector<std::vector<double>> _compactors;
+  size_t _value_count{0};
+  uint64_t _count{0};
+  uint64_t _coin_state{0x9E3779B97F4A7C15};
+};
+
+}  // namespace opossum
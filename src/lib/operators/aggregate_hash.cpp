@@ -1,9 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -12,11 +15,21 @@
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -137,6 +150,118 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Without GROUP BY, MIN and MAX of a segment that covers all rows of a stored segment are known without scanning it:
+// they are the first and the last entry of the dictionary or the bounds of the chunk's pruning statistics. This is the
+// case for data segments and for ReferenceSegments with an EntireChunkPosList, which the Validate emits for entirely
+// visible chunks. Returns false if neither is available. Otherwise, bounds are nullopt if there are only NULL values.
+template <typename T>
+bool get_bounds_from_metadata(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                              std::optional<std::pair<T, T>>& bounds) {
+  auto stored_chunk = table.get_chunk(chunk_id);
+  auto stored_column_id = column_id;
+  auto segment = stored_chunk->get_segment(column_id);
+
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    const auto& pos_list = reference_segment->pos_list();
+    if (!std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list)) return false;
+
+    stored_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+    // Mutable chunks may have grown since the PosList was created
+    if (!stored_chunk || stored_chunk->size() != pos_list->size()) return false;
+    stored_column_id = reference_segment->referenced_column_id();
+    segment = stored_chunk->get_segment(stored_column_id);
+  }
+
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if (!dictionary.empty()) bounds.emplace(dictionary.front(), dictionary.back());
+    return true;
+  }
+
+  const auto& pruning_statistics = stored_chunk->pruning_statistics();
+  if (stored_chunk->is_mutable() || !pruning_statistics) return false;
+
+  const auto& statistics = static_cast<const AttributeStatistics<T>&>(*(*pruning_statistics)[stored_column_id]);
+  if (statistics.min_max_filter) {
+    bounds.emplace(statistics.min_max_filter->min, statistics.min_max_filter->max);
+    return true;
+  }
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (statistics.range_filter) {
+      bounds.emplace(statistics.range_filter->ranges.front().first, statistics.range_filter->ranges.back().second);
+      return true;
+    }
+  }
+
+  // Segments without non-NULL values have no filter, but neither have segments whose filters were not created
+  return false;
+}
+
+// Returns the partition of a group for the parallel aggregation. The keys are often consecutive ids, which KeyHash
+// spreads over all bits of the hash, so that the partition can be taken from its upper bits.
+template <typename AggregateKey>
+size_t radix_partition(const AggregateKey& key, const size_t radix_bits) {
+  if (radix_bits == 0) return 0;
+  return KeyHash<AggregateKey>{}(key) >> (64 - radix_bits);
+}
+
+// Merges a task-local result of the parallel aggregation into the final result of the same group.
+template <AggregateFunction aggregate_function, typename AggregateResult>
+void merge_aggregate_result(AggregateResult& target, const AggregateResult& source) {
+  if (target.row_id.is_null()) {
+    target.row_id = source.row_id;
+  }
+
+  if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    target.accumulator.insert(source.accumulator.begin(), source.accumulator.end());
+    target.aggregate_count += source.aggregate_count;
+    return;
+  }
+
+  if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct ||
+                aggregate_function == AggregateFunction::ApproxPercentile) {
+    target.accumulator.merge(source.accumulator);
+    target.aggregate_count += source.aggregate_count;
+    return;
+  }
+
+  // The accumulator is only valid if at least one value was aggregated (see AggregateFunctionBuilder)
+  if (source.aggregate_count == 0) return;
+  if (target.aggregate_count == 0) {
+    target.accumulator = source.accumulator;
+    target.aggregate_count = source.aggregate_count;
+    return;
+  }
+
+  if constexpr (aggregate_function == AggregateFunction::Min) {
+    if (value_smaller(source.accumulator, target.accumulator)) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Max) {
+    if (value_greater(source.accumulator, target.accumulator)) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+    target.accumulator += source.accumulator;
+  } else if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
+    // Combine the counts, means, and squared distances from the mean of both parts, see
+    // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+    const auto target_count = target.accumulator[0];
+    const auto source_count = source.accumulator[0];
+    const auto count = target_count + source_count;
+    const auto delta = source.accumulator[1] - target.accumulator[1];
+
+    target.accumulator[0] = count;
+    target.accumulator[1] += delta * source_count / count;
+    target.accumulator[2] += source.accumulator[2] + delta * delta * target_count * source_count / count;
+    if (count > 1) {
+      target.accumulator[3] = std::sqrt(target.accumulator[2] / (count - 1));
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -160,7 +285,9 @@ const std::string& AggregateHash::name() const {
 std::shared_ptr<AbstractOperator> AggregateHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids);
+  const auto copy = std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids);
+  copy->estimated_group_count = estimated_group_count;
+  return copy;
 }
 
 void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -177,8 +304,15 @@ struct AggregateResultContext : SegmentVisitorContext {
 
   // In cases where we know how many values to expect, we can preallocate the context in order to avoid later
   // re-allocations.
-  explicit AggregateResultContext(const size_t preallocated_size = 0)
-      : results(preallocated_size, AggregateResultAllocator{&buffer}) {}
+  // If we only have an estimate of the number of values, reserving the results avoids most re-allocations without
+  // creating entries for groups that do not exist.
+  // The buffer is allocated from the given resource, usually the memory resource of the operator.
+  explicit AggregateResultContext(
+      const size_t preallocated_size = 0, const size_t reserved_size = 0,
+      boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource())
+      : buffer(memory_resource), results(preallocated_size, AggregateResultAllocator{&buffer}) {
+    results.reserve(reserved_size);
+  }
 
   boost::container::pmr::monotonic_buffer_resource buffer;
   AggregateResults<ColumnDataType, aggregate_function> results;
@@ -186,34 +320,90 @@ struct AggregateResultContext : SegmentVisitorContext {
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
 struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregate_function> {
-  explicit AggregateContext(const size_t preallocated_size = 0)
-      : AggregateResultContext<ColumnDataType, aggregate_function>(preallocated_size) {
+  explicit AggregateContext(
+      const size_t preallocated_size = 0, const size_t reserved_size = 0,
+      boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource())
+      : AggregateResultContext<ColumnDataType, aggregate_function>(preallocated_size, reserved_size, memory_resource) {
     auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
 
     // Unused if AggregateKey == EmptyAggregateKey, but we initialize it anyway to reduce the number of diverging code
     // paths.
     // NOLINTNEXTLINE(clang-analyzer-core.CallAndMessage) - false warning: called C++ object (result_ids) is null
     result_ids = std::make_unique<AggregateResultIdMap<AggregateKey>>(allocator);
+    result_ids->reserve(reserved_size);
   }
 
   std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
 };
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(
+    ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
+    KeysPerChunk<AggregateKey>& keys_per_chunk, std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
 
   auto aggregator =
       AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
 
+  // Without GROUP BY, MIN and MAX of entire stored segments come from metadata (see get_bounds_from_metadata)
+  if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey> &&
+                (aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max)) {
+    const auto input_column_id =
+        static_cast<const PQPColumnExpression&>(*_aggregates[column_index]->argument()).column_id;
+    auto bounds = std::optional<std::pair<ColumnDataType, ColumnDataType>>{};
+    if (get_bounds_from_metadata(*left_input_table(), chunk_id, input_column_id, bounds)) {
+      if (!bounds) return;
+
+      auto& result = get_or_add_result(std::false_type{}, result_ids, results,
+                                       get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, ChunkOffset{0}),
+                                       RowID{chunk_id, ChunkOffset{0}});
+      aggregator(aggregate_function == AggregateFunction::Min ? bounds->first : bounds->second, result.aggregate_count,
+                 result.accumulator);
+      ++result.aggregate_count;
+      return;
+    }
+  }
+
+  // Without GROUP BY, all rows of a run belong to the same result. Thus, for RunLengthSegments, MIN, MAX, SUM, AVG, and
+  // COUNT are updated once per run (SUM and AVG with value * run length) instead of once per row.
+  if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey> &&
+                (aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max ||
+                 aggregate_function == AggregateFunction::Count ||
+                 (std::is_arithmetic_v<ColumnDataType> && (aggregate_function == AggregateFunction::Sum ||
+                                                           aggregate_function == AggregateFunction::Avg)))) {
+    if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&abstract_segment)) {
+      const auto& values = *run_length_segment->values();
+      const auto& null_values = *run_length_segment->null_values();
+      const auto& end_positions = *run_length_segment->end_positions();
+      if (values.empty()) return;
+
+      auto& result = get_or_add_result(std::false_type{}, result_ids, results,
+                                       get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, ChunkOffset{0}),
+                                       RowID{chunk_id, ChunkOffset{0}});
+
+      auto run_start = ChunkOffset{0};
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        const auto run_length = size_t{end_positions[run_index] + 1 - run_start};
+        run_start = ChunkOffset{end_positions[run_index] + 1};
+        if (null_values[run_index]) continue;
+
+        if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+          result.accumulator += static_cast<AggregateType>(values[run_index]) * static_cast<AggregateType>(run_length);
+        } else {
+          aggregator(values[run_index], result.aggregate_count, result.accumulator);
+        }
+        result.aggregate_count += run_length;
+      }
+      return;
+    }
+  }
+
   ChunkOffset chunk_offset{0};
 
   // CacheResultIds is a boolean type parameter that is forwarded to get_or_add_result, see the documentation over there
@@ -242,7 +432,7 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+  if (contexts.size() > 1 || _use_immediate_key_shortcut) {
     segment_iterate<ColumnDataType>(abstract_segment,
                                     [&](const auto& position) { process_position(std::true_type{}, position); });
   } else {
@@ -257,7 +447,9 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
  */
 template <typename AggregateKey>
 KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
-  KeysPerChunk<AggregateKey> keys_per_chunk;
+  // The vectors of AggregateKeys are allocated from the same resource
+  auto keys_per_chunk =
+      KeysPerChunk<AggregateKey>{PolymorphicAllocator<AggregateKeys<AggregateKey>>{_memory_resource().get()}};
 
   if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
     const auto& input_table = left_input_table();
@@ -300,18 +492,91 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
     //     We can immediately map these into a numerical representation by reinterpreting their byte storage as an
     //     integer. The calculation is described below. Note that this is done on a per-string basis and does not
     //     require all strings in the given column to be that short.
+    //
+    // (3) If all segments of a GROUP BY column are dictionary-encoded, we translate each dictionary once and look up
+    //     the ids of the rows by their value ids. The ids of such a column are dense (1 to the number of distinct
+    //     values), so that they can be combined into immediate indexes into the results (see below).
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(_groupby_column_ids.size());
 
+    // For each GROUP BY column with dense ids, the number of ids including the NULL id 0; 0 for other columns.
+    auto dense_id_counts = std::vector<size_t>(_groupby_column_ids.size());
+
     for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
       jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, chunk_count,
-                                                   this]() {
+                                                   &dense_id_counts, this]() {
         const auto groupby_column_id = _groupby_column_ids.at(group_column_index);
         const auto data_type = input_table->column_data_type(groupby_column_id);
 
+        auto dictionary_encoded = true;
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto chunk = input_table->get_chunk(chunk_id);
+          if (!chunk ||
+              !std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(groupby_column_id))) {
+            dictionary_encoded = false;
+            break;
+          }
+        }
+
         resolve_data_type(data_type, [&](auto type) {
           using ColumnDataType = typename decltype(type)::type;
 
+          if (dictionary_encoded) {
+            // Assign dense ids to the values, starting with 1 as 0 is reserved for NULL. Only the dictionary entries
+            // are hashed, the rows are mapped by their value ids.
+            auto id_map = tsl::robin_map<ColumnDataType, AggregateKeyEntry>{};
+            auto ids_of_value_ids = std::vector<AggregateKeyEntry>{};
+
+            // Chunks that share their dictionary (see ChunkEncoder::merge_dictionaries()) also share the ids of their
+            // value ids, so that the dictionary is only hashed once.
+            auto previous_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+
+            for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+              const auto abstract_segment = input_table->get_chunk(chunk_id)->get_segment(groupby_column_id);
+              const auto& segment = static_cast<const BaseDictionarySegment&>(*abstract_segment);
+              segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+              segment.access_counter[SegmentAccessCounter::AccessType::Dictionary] += segment.size();
+
+              const auto dictionary_segment =
+                  std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(abstract_segment);
+              const auto dictionary = dictionary_segment ? dictionary_segment->dictionary() : nullptr;
+              if (!dictionary || dictionary != previous_dictionary) {
+                const auto unique_values_count = segment.unique_values_count();
+                DebugAssert(segment.null_value_id() == unique_values_count, "Expected NULL to follow the dictionary");
+                ids_of_value_ids.resize(unique_values_count + 1);
+                for (auto value_id = ValueID{0}; value_id < unique_values_count; ++value_id) {
+                  const auto value = boost::get<ColumnDataType>(segment.value_of_value_id(value_id));
+                  ids_of_value_ids[value_id] = id_map.try_emplace(value, id_map.size() + 1).first->second;
+                }
+                ids_of_value_ids[unique_values_count] = 0;
+              }
+              previous_dictionary = dictionary;
+
+              auto& keys = keys_per_chunk[chunk_id];
+              resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+                auto chunk_offset = ChunkOffset{0};
+                for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+                     ++value_id_it, ++chunk_offset) {
+                  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                    keys[chunk_offset] = ids_of_value_ids[*value_id_it];
+                  } else {
+                    keys[chunk_offset][group_column_index] = ids_of_value_ids[*value_id_it];
+                  }
+                }
+              });
+            }
+
+            dense_id_counts[group_column_index] = id_map.size() + 1;
+
+            auto previous_max = _expected_result_size.load();
+            while (previous_max < id_map.size()) {
+              if (_expected_result_size.compare_exchange_strong(previous_max, id_map.size())) {
+                break;
+              }
+            }
+            return;
+          }
+
           if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
             // For values with a smaller type than AggregateKeyEntry, we can use the value itself as an
             // AggregateKeyEntry. We cannot do this for types with the same size as AggregateKeyEntry as we need to have
@@ -406,11 +671,19 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
             // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
             // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
             // allocate a bit too much.
-            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
-            auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
-
-            auto id_map = tsl::robin_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>, std::equal_to<>,
-                                         decltype(allocator)>(allocator);
+            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000, _memory_resource().get());
+
+            // Strings are stored in the id_map as string_views into an arena (temp_buffer), to which the characters of
+            // a string are copied when it is seen for the first time. Compared to a map of pmr_strings, this saves the
+            // string's allocation and keeps the map entries small and trivially copyable when the map grows. The map
+            // stores the hashes of the strings, so that neither growing nor probing has to rehash or compare strings
+            // whose hashes differ.
+            constexpr auto IS_STRING_COLUMN = std::is_same_v<ColumnDataType, pmr_string>;
+            using IdMapKey = std::conditional_t<IS_STRING_COLUMN, std::string_view, ColumnDataType>;
+            auto allocator = PolymorphicAllocator<std::pair<const IdMapKey, AggregateKeyEntry>>{&temp_buffer};
+
+            auto id_map = tsl::robin_map<IdMapKey, AggregateKeyEntry, KeyHash<IdMapKey>, std::equal_to<>,
+                                         decltype(allocator), IS_STRING_COLUMN>(allocator);
             AggregateKeyEntry id_counter = 1u;
 
             if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
@@ -495,12 +768,26 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
                   if (id == std::numeric_limits<AggregateKeyEntry>::max()) {
                     // Could not take the shortcut above, either because we don't have a string or because it is too
                     // long
-                    auto inserted = id_map.try_emplace(position.value(), id_counter);
+                    if constexpr (IS_STRING_COLUMN) {
+                      const auto string = std::string_view{position.value()};
+                      const auto hash = KeyHash<std::string_view>{}(string);
+                      const auto id_it = id_map.find(string, hash);
+                      if (id_it != id_map.end()) {
+                        id = id_it->second;
+                      } else {
+                        auto* const characters = static_cast<char*>(temp_buffer.allocate(string.size(), 1));
+                        std::memcpy(characters, string.data(), string.size());
+                        id = id_counter++;
+                        id_map.emplace(std::string_view{characters, string.size()}, id);
+                      }
+                    } else {
+                      auto inserted = id_map.try_emplace(position.value(), id_counter);
 
-                    id = inserted.first->second;
+                      id = inserted.first->second;
 
-                    // if the id_map didn't have the value as a key and a new element was inserted
-                    if (inserted.second) ++id_counter;
+                      // if the id_map didn't have the value as a key and a new element was inserted
+                      if (inserted.second) ++id_counter;
+                    }
                   }
 
                   if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
@@ -532,11 +819,409 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
     }
 
     Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // If all GROUP BY columns have dense ids and their combinations do not span much more than the number of rows, we
+    // combine the ids of a row into an immediate index into the results. This is the same as the immediate key
+    // shortcut for consecutive int32_t values, but also works for multiple GROUP BY columns: get_or_add_result only
+    // looks at the first entry of a cached AggregateKey. For example, grouping by a status code and a country becomes
+    // an array-indexed aggregation.
+    if (!_use_immediate_key_shortcut &&
+        std::all_of(dense_id_counts.begin(), dense_id_counts.end(), [](const auto count) { return count > 0; })) {
+      auto combined_id_count = 1.0;
+      for (const auto dense_id_count : dense_id_counts) {
+        combined_id_count *= static_cast<double>(dense_id_count);
+      }
+
+      if (combined_id_count < static_cast<double>(input_table->row_count()) * 1.2) {
+        _expected_result_size = static_cast<size_t>(combined_id_count);
+        _use_immediate_key_shortcut = true;
+
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          for (auto& key : keys_per_chunk[chunk_id]) {
+            if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+              key = key | CACHE_MASK;
+            } else {
+              // Mixed-radix combination of the ids, where the NULL id 0 of all columns results in the index 0
+              auto combined_id = AggregateKeyEntry{0};
+              auto stride = AggregateKeyEntry{1};
+              for (auto group_column_index = size_t{0}; group_column_index < dense_id_counts.size();
+                   ++group_column_index) {
+                combined_id += key[group_column_index] * stride;
+                stride *= dense_id_counts[group_column_index];
+              }
+              key[0] = combined_id | CACHE_MASK;
+            }
+          }
+        }
+      }
+    }
   }
 
   return keys_per_chunk;
 }
 
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                                     KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto& input_table = left_input_table();
+
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) return;
+
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
+
+  if (!_has_aggregate_functions) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
+     * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
+     * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
+     *
+     * As the grouping happens as part of the aggregation but no aggregate function exists, we use
+     * `AggregateFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
+     * are the same as they are for a regular grouped aggregate.
+     */
+
+    auto context =
+        std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
+            contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    // Add value or combination of values is added to the list of distinct value(s). This is done by calling
+    // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
+    if (_use_immediate_key_shortcut) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
+        // is enabled in get_or_add_result.
+        get_or_add_result(std::true_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    } else {
+      // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
+      // get_aggregate_key.
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        get_or_add_result(std::false_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    }
+  } else {
+    ColumnID aggregate_idx{0};
+    for (const auto& aggregate : _aggregates) {
+      /**
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
+       */
+
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
+
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+        auto context =
+            std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
+                contexts[aggregate_idx]);
+
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+
+          // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
+          // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
+          // not NULL_ROW_ID.
+          results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+        } else {
+          // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
+          // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
+          if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+              // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
+              // have been written by the immediate key shortcut
+              auto& result =
+                  get_or_add_result(std::true_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          } else {
+            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+              auto& result =
+                  get_or_add_result(std::false_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          }
+        }
+
+        ++aggregate_idx;
+        continue;
+      }
+
+      const auto abstract_segment = chunk_in->get_segment(input_column_id);
+      const auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::ApproxCountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::ApproxCountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::ApproxPercentile:
+            _aggregate_segment<ColumnDataType, AggregateFunction::ApproxPercentile, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Any:
+            // ANY is a pseudo-function and is handled by _write_groupby_output
+            break;
+        }
+      });
+
+      ++aggregate_idx;
+    }
+  }
+}  // NOLINT(readability/fn_size)
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk, const size_t task_count) {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  // We use (at least) as many partitions as there are tasks so that the merge is parallelized to the same degree.
+  const auto radix_bits = static_cast<size_t>(std::ceil(std::log2(task_count)));
+  const auto partition_count = size_t{1} << radix_bits;
+
+  // For each partition, the groups found by a task, i.e., their keys and their ids in the task-local results.
+  using PartitionedGroups = std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>;
+
+  auto contexts_per_task = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(task_count);
+  auto groups_per_task = std::vector<PartitionedGroups>(task_count, PartitionedGroups(partition_count));
+
+  // Only the first context that calculates an aggregate looks up the groups in its result id map. The following
+  // contexts reuse the cached result ids (see get_or_add_result). ANY does not look up anything.
+  auto key_context_index = ColumnID{0};
+  if (_has_aggregate_functions) {
+    while (_aggregates[key_context_index]->aggregate_function == AggregateFunction::Any) {
+      ++key_context_index;
+    }
+  }
+
+  /**
+   * PRE-AGGREGATION
+   * Each task aggregates a range of chunks into its own contexts. These only hold the groups of the task's chunks and
+   * are accessed without synchronization. Afterwards, the task partitions its groups by the hash of their keys.
+   * Tasks run on the NUMA node of their first chunk, which holds the whole range if the input table's chunks were
+   * partitioned across the nodes (see place_chunks_on_numa_nodes()).
+   */
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+    const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+
+    auto job = std::make_shared<JobTask>([&, task_id, begin_chunk_id, end_chunk_id]() {
+      auto& contexts = contexts_per_task[task_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        if (is_cancelled()) break;
+        _aggregate_chunk<AggregateKey>(chunk_id, contexts, keys_per_chunk);
+        _add_processed_chunks();
+      }
+
+      auto& groups = groups_per_task[task_id];
+      _resolve_context_type(key_context_index, [&](const auto type, const auto function) {
+        using ColumnDataType = typename decltype(type)::type;
+        using Context = AggregateContext<ColumnDataType, decltype(function)::value, AggregateKey>;
+
+        const auto& result_ids = *static_cast<const Context&>(*contexts[key_context_index]).result_ids;
+        for (const auto& [key, result_id] : result_ids) {
+          groups[radix_partition(key, radix_bits)].emplace_back(key, result_id);
+        }
+      });
+    });
+
+    if (begin_chunk_id < end_chunk_id) {
+      const auto first_chunk = input_table->get_chunk(begin_chunk_id);
+      if (first_chunk) job->set_node_id(first_chunk->numa_node_id());
+    }
+    jobs.emplace_back(job);
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * MERGING
+   * Each partition is merged by a separate task. A partition owns a contiguous range of the final results that is
+   * large enough to hold its groups even if no group was found by more than one task. Unused results keep their
+   * NULL_ROW_ID and are skipped when writing the output.
+   */
+  auto partition_offsets = std::vector<size_t>(partition_count + 1);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partition_offsets[partition_id + 1] = partition_offsets[partition_id];
+    for (const auto& groups : groups_per_task) {
+      partition_offsets[partition_id + 1] += groups[partition_id].size();
+    }
+  }
+
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(partition_offsets.back());
+
+  // For DISTINCT, only the first context holds results (see _aggregate_chunk)
+  const auto merged_context_count = _has_aggregate_functions ? _aggregates.size() : size_t{1};
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      // Assign each group of the partition to a result within the partition's range
+      auto merged_result_ids = ska::bytell_hash_map<AggregateKey, AggregateResultId, KeyHash<AggregateKey>>{};
+      auto merged_result_ids_per_task = std::vector<std::vector<AggregateResultId>>(task_count);
+      auto next_result_id = partition_offsets[partition_id];
+
+      for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+        const auto& groups = groups_per_task[task_id][partition_id];
+        auto& merged_result_ids_of_task = merged_result_ids_per_task[task_id];
+        merged_result_ids_of_task.reserve(groups.size());
+
+        for (const auto& group : groups) {
+          const auto emplace_result = merged_result_ids.emplace(group.first, next_result_id);
+          if (emplace_result.second) ++next_result_id;
+          merged_result_ids_of_task.emplace_back(emplace_result.first->second);
+        }
+      }
+      DebugAssert(next_result_id <= partition_offsets[partition_id + 1], "Partition exceeds its range of results");
+
+      for (auto aggregate_index = ColumnID{0}; aggregate_index < merged_context_count; ++aggregate_index) {
+        // ANY is written from the row ids of the groups
+        if (_has_aggregate_functions && _aggregates[aggregate_index]->aggregate_function == AggregateFunction::Any) {
+          continue;
+        }
+
+        _resolve_context_type(aggregate_index, [&](const auto type, const auto function) {
+          using ColumnDataType = typename decltype(type)::type;
+          using Context = AggregateContext<ColumnDataType, decltype(function)::value, AggregateKey>;
+
+          auto& results = static_cast<Context&>(*_contexts_per_column[aggregate_index]).results;
+          for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+            const auto& task_results =
+                static_cast<const Context&>(*contexts_per_task[task_id][aggregate_index]).results;
+            const auto& groups = groups_per_task[task_id][partition_id];
+            const auto& merged_result_ids_of_task = merged_result_ids_per_task[task_id];
+
+            const auto group_count = groups.size();
+            for (auto group_index = size_t{0}; group_index < group_count; ++group_index) {
+              DebugAssert(groups[group_index].second < task_results.size(), "Task did not aggregate the group");
+              merge_aggregate_result<decltype(function)::value>(results[merged_result_ids_of_task[group_index]],
+                                                                task_results[groups[group_index].second]);
+            }
+          }
+        });
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+template <typename Functor>
+void AggregateHash::_resolve_context_type(const ColumnID aggregate_index, const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    // See the DISTINCT implementation in _aggregate_chunk
+    functor(boost::hana::type_c<DistinctColumnType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+    return;
+  }
+
+  const auto& aggregate = _aggregates[aggregate_index];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+  if (input_column_id == INVALID_COLUMN_ID) {
+    // COUNT(*)
+    functor(boost::hana::type_c<CountColumnType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(left_input_table()->column_data_type(input_column_id), [&](const auto type) {
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::ApproxCountDistinct>{});
+        break;
+      case AggregateFunction::ApproxPercentile:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::ApproxPercentile>{});
+        break;
+      case AggregateFunction::Any:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+        break;
+    }
+  });
+}
+
 template <typename AggregateKey>
 void AggregateHash::_aggregate() {
   const auto& input_table = left_input_table();
@@ -562,19 +1247,22 @@ void AggregateHash::_aggregate() {
   /**
    * AGGREGATION STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
-
-  if (!_has_aggregate_functions) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
-    */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>(_expected_result_size);
+  const auto chunk_count = input_table->chunk_count();
+  _set_total_chunk_count(chunk_count);
 
-    _contexts_per_column.push_back(context);
+  // Without GROUP BY columns, there is only a single group. With the immediate key shortcut, the keys already are
+  // indexes into the results, which makes the aggregation cheap enough. In both cases, we aggregate sequentially.
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    if (!_use_immediate_key_shortcut) {
+      const auto task_count = std::min({static_cast<size_t>(chunk_count),
+                                        input_table->row_count() / JOB_SPAWN_THRESHOLD,
+                                        Hyrise::get().topology.num_cpus()});
+      if (task_count > 1) {
+        _aggregate_in_parallel<AggregateKey>(keys_per_chunk, task_count);
+        step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+        return;
+      }
+    }
   }
 
   /**
@@ -582,182 +1270,18 @@ void AggregateHash::_aggregate() {
    * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
    * and _write_aggregate_output() needs these contexts anyway.
    */
-  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
-
-    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-    const auto input_column_id = pqp_column.column_id;
-
-    if (input_column_id == INVALID_COLUMN_ID) {
-      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-          _expected_result_size);
-
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
-    }
-    const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+  // If the GROUP BY columns did not tell the number of groups, the estimated number of groups is reserved instead
+  auto reserved_size = size_t{0};
+  if (_expected_result_size == 0 && estimated_group_count) {
+    reserved_size = std::min(*estimated_group_count, static_cast<size_t>(left_input_table()->row_count()));
   }
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(_expected_result_size, reserved_size);
 
   // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) continue;
-
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (!_has_aggregate_functions) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
-       * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
-       * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
-       *
-       * As the grouping happens as part of the aggregation but no aggregate function exists, we use
-       * `AggregateFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
-       * are the same as they are for a regular grouped aggregate.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      // Add value or combination of values is added to the list of distinct value(s). This is done by calling
-      // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
-        for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
-          get_or_add_result(std::true_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
-        for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-          get_or_add_result(std::false_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      }
-    } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
-
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context =
-              std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
-
-            // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
-            // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
-            // not NULL_ROW_ID.
-            results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
-          } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-              for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
-                auto& result =
-                    get_or_add_result(std::true_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            } else {
-              for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-                auto& result =
-                    get_or_add_result(std::false_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            }
-          }
-
-          ++aggregate_idx;
-          continue;
-        }
-
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
-
-        /*
-        Invoke correct aggregator for each segment
-        */
-
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              // ANY is a pseudo-function and is handled by _write_groupby_output
-              break;
-          }
-        });
-
-        ++aggregate_idx;
-      }
-    }
+    if (is_cancelled()) break;
+    _aggregate_chunk<AggregateKey>(chunk_id, _contexts_per_column, keys_per_chunk);
+    _add_processed_chunks();
   }
   step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
 }  // NOLINT(readability/fn_size)
@@ -970,6 +1494,46 @@ write_aggregate_values(pmr_vector<AggregateType>& values, pmr_vector<bool>& null
   Fail("Invalid aggregate");
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction aggregate_func>
+std::enable_if_t<aggregate_func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+    const AggregateResults<ColumnDataType, aggregate_func>& results) {
+  values.reserve(results.size());
+
+  for (const auto& result : results) {
+    // NULL_ROW_ID (just a marker, not literally NULL) means that this result is either a gap (in the case of an
+    // unused immediate key) or the result of overallocating the result vector. As such, it must be skipped.
+    if (result.row_id.is_null()) continue;
+
+    values.emplace_back(result.accumulator.estimate());
+  }
+}
+
+// APPROX_PERCENTILE writes the estimated percentile. As the percentile is part of the aggregate, it is passed
+// separately and this function is not called through write_aggregate_values.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction aggregate_func>
+void write_approx_percentile_values(pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+                                    const AggregateResults<ColumnDataType, aggregate_func>& results,
+                                    const double percentile) {
+  values.reserve(results.size());
+  null_values.reserve(results.size());
+
+  for (const auto& result : results) {
+    // NULL_ROW_ID (just a marker, not literally NULL) means that this result is either a gap (in the case of an
+    // unused immediate key) or the result of overallocating the result vector. As such, it must be skipped.
+    if (result.row_id.is_null()) continue;
+
+    if (result.aggregate_count > 0) {
+      values.emplace_back(result.accumulator.quantile(percentile));
+      null_values.emplace_back(false);
+    } else {
+      values.emplace_back();
+      null_values.emplace_back(true);
+    }
+  }
+}
+
 void AggregateHash::_write_groupby_output(RowIDPosList& pos_list) {
   Timer timer;
   auto input_table = left_input_table();
@@ -1075,6 +1639,12 @@ void AggregateHash::_write_aggregate_output(boost::hana::basic_type<ColumnDataTy
     case AggregateFunction::StandardDeviationSample:
       write_aggregate_output<ColumnDataType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
+    case AggregateFunction::ApproxPercentile:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxPercentile>(column_index);
+      break;
     case AggregateFunction::Any:
       // written by _write_groupby_output
       break;
@@ -1130,9 +1700,20 @@ void AggregateHash::write_aggregate_output(ColumnID aggregate_index) {
   auto null_values = pmr_vector<bool>{};
 
   constexpr bool NEEDS_NULL =
-      (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct);
+      (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+       aggregate_function != AggregateFunction::ApproxCountDistinct);
 
-  write_aggregate_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(values, null_values, results);
+  if constexpr (aggregate_function == AggregateFunction::ApproxPercentile) {
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      write_approx_percentile_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(
+          values, null_values, results, *aggregate->percentile);
+    } else {
+      Fail("Invalid aggregate");
+    }
+  } else {
+    write_aggregate_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(values, null_values,
+                                                                                         results);
+  }
 
   if (_groupby_column_ids.empty() && values.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
@@ -1161,37 +1742,46 @@ void AggregateHash::write_aggregate_output(ColumnID aggregate_index) {
 
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const AggregateFunction aggregate_function) const {
+    const DataType data_type, const AggregateFunction aggregate_function, const size_t preallocated_size,
+    const size_t reserved_size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
     using ColumnDataType = typename decltype(type)::type;
+    const auto make_context = [&](const auto function) {
+      using Context = AggregateContext<ColumnDataType, decltype(function)::value, AggregateKey>;
+      context = std::make_shared<Context>(preallocated_size, reserved_size, _memory_resource().get());
+    };
+
     switch (aggregate_function) {
       case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Min, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
         break;
       case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Max, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
         break;
       case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Sum, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
         break;
       case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Avg, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
         break;
       case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Count, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
         break;
       case AggregateFunction::CountDistinct:
-        context =
-            std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
         break;
       case AggregateFunction::StandardDeviationSample:
-        context = std::make_shared<
-            AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::ApproxCountDistinct>{});
+        break;
+      case AggregateFunction::ApproxPercentile:
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::ApproxPercentile>{});
         break;
       case AggregateFunction::Any:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Any, AggregateKey>>(size);
+        make_context(std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
         break;
     }
   });
@@ -1199,4 +1789,47 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
   return context;
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size, const size_t reserved_size) const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (!_has_aggregate_functions) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, the contexts will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
+    */
+    auto context =
+        std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>(
+            preallocated_size, reserved_size, _memory_resource().get());
+
+    contexts.push_back(context);
+  }
+
+  const auto& input_table = left_input_table();
+  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
+          preallocated_size, reserved_size, _memory_resource().get());
+
+      contexts[aggregate_idx] = context;
+      continue;
+    }
+    const auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] = _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function,
+                                                                      preallocated_size, reserved_size);
+  }
+
+  return contexts;
+}
+
 }  // namespace opossum
@@ -16,7 +16,6 @@
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/container/scoped_allocator.hpp>
 #include <boost/container/small_vector.hpp>
-#include <boost/functional/hash.hpp>
 #include <bytell_hash_map.hpp>
 #include <uninitialized_vector.hpp>
 
@@ -28,6 +27,7 @@
 #include "storage/reference_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
+#include "utils/hash_functions.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -60,21 +60,27 @@ This result contains:
 
 Optionally, the result may also contain:
 - a set of DISTINCT values OR
-- secondary aggregates, which are currently only used by STDDEV_SAMP
+- secondary aggregates, which are currently only used by STDDEV_SAMP OR
+- a sketch for APPROX_COUNT_DISTINCT and APPROX_PERCENTILE
 */
 template <typename ColumnDataType, AggregateFunction aggregate_function>
 struct AggregateResult {
   using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
 
-  using DistinctValues = tsl::robin_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
+  using DistinctValues = tsl::robin_set<ColumnDataType, KeyHash<ColumnDataType>, std::equal_to<ColumnDataType>,
                                         PolymorphicAllocator<ColumnDataType>>;
 
   // Find the correct accumulator type using nested conditionals.
   using AccumulatorType = std::conditional_t<
       // For StandardDeviationSample, use StandardDeviationSampleData as the accumulator,
       aggregate_function == AggregateFunction::StandardDeviationSample, StandardDeviationSampleData,
-      // for CountDistinct, use DistinctValues, otherwise use AggregateType
-      std::conditional_t<aggregate_function == AggregateFunction::CountDistinct, DistinctValues, AggregateType>>;
+      // for CountDistinct, use DistinctValues,
+      std::conditional_t<
+          aggregate_function == AggregateFunction::CountDistinct, DistinctValues,
+          // for the approximate aggregates, use their sketches, otherwise use AggregateType
+          std::conditional_t<aggregate_function == AggregateFunction::ApproxCountDistinct, HyperLogLog,
+                             std::conditional_t<aggregate_function == AggregateFunction::ApproxPercentile,
+                                                QuantileSketch, AggregateType>>>>;
 
   AccumulatorType accumulator{};
   size_t aggregate_count = 0;
@@ -101,7 +107,7 @@ using AggregateResultIdMapAllocator = PolymorphicAllocator<std::pair<const Aggre
 
 template <typename AggregateKey>
 using AggregateResultIdMap =
-    ska::bytell_hash_map<AggregateKey, AggregateResultId, std::hash<AggregateKey>, std::equal_to<AggregateKey>,
+    ska::bytell_hash_map<AggregateKey, AggregateResultId, KeyHash<AggregateKey>, std::equal_to<AggregateKey>,
                          AggregateResultIdMapAllocator<AggregateKey>>;
 
 // The key type that is used for the aggregation map.
@@ -144,6 +150,15 @@ class AggregateHash : public AbstractAggregateOperator {
 
   const std::string& name() const override;
 
+  // Estimated number of groups (see CardinalityEstimator::estimate_group_count), set by the LQPTranslator. If the
+  // GROUP BY columns do not tell the number of groups before the aggregation, it is used to reserve the results.
+  std::optional<size_t> estimated_group_count;
+
+  // If the input has at least two times JOB_SPAWN_THRESHOLD rows and is grouped by keys that cannot be used as
+  // immediate indexes into the results, the chunks are pre-aggregated in parallel tasks of at least JOB_SPAWN_THRESHOLD
+  // rows each. The task-local results are radix-partitioned by their key and the partitions are merged in parallel.
+  static constexpr auto JOB_SPAWN_THRESHOLD = 10'000;
+
   // write the aggregated output for a given aggregate column
   template <typename ColumnDataType, AggregateFunction aggregate_function>
   void write_aggregate_output(ColumnID aggregate_index);
@@ -165,6 +180,18 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  void _aggregate_chunk(ChunkID chunk_id, std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                        KeysPerChunk<AggregateKey>& keys_per_chunk);
+
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk, size_t task_count);
+
+  // Calls the functor with the ColumnDataType (as a hana type) and the AggregateFunction (as an integral_constant) of
+  // the context that is used for the aggregate at the given index.
+  template <typename Functor>
+  void _resolve_context_type(ColumnID aggregate_index, const Functor& functor) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -181,11 +208,20 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction aggregate_function) const;
+                                                                   const AggregateFunction aggregate_function,
+                                                                   const size_t preallocated_size,
+                                                                   const size_t reserved_size) const;
+
+  // Creates one context per aggregate (or a single one for DISTINCT) whose results are preallocated and reserved as
+  // given
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(const size_t preallocated_size,
+                                                                                 const size_t reserved_size = 0) const;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
@@ -209,7 +245,7 @@ struct hash<opossum::EmptyAggregateKey> {
 template <>
 struct hash<opossum::AggregateKeySmallVector> {
   size_t operator()(const opossum::AggregateKeySmallVector& key) const {
-    return boost::hash_range(key.begin(), key.end());
+    return opossum::hash_bytes(key.data(), key.size() * sizeof(opossum::AggregateKeyEntry));
   }
 };
 
@@ -217,7 +253,7 @@ template <>
 struct hash<std::array<opossum::AggregateKeyEntry, 2>> {
   // gcc9 doesn't support templating by `int N` here.
   size_t operator()(const std::array<opossum::AggregateKeyEntry, 2>& key) const {
-    return boost::hash_range(key.begin(), key.end());
+    return opossum::hash_bytes(key.data(), sizeof(key));
   }
 };
 }  // namespace std
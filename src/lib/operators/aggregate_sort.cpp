@@ -36,6 +36,73 @@ std::shared_ptr<const Table> sort_table_by_column_ids(const std::shared_ptr<cons
   return sort->get_output();
 }
 
+template <typename ColumnDataType>
+std::optional<std::vector<ChunkID>> order_chunks_by_value_ranges(const Table& table, const ColumnID column_id) {
+  struct ChunkValueRange {
+    ChunkID chunk_id;
+    ColumnDataType first_value;
+    ColumnDataType last_value;
+  };
+
+  auto null_chunk_ids = std::vector<ChunkID>{};
+  auto value_ranges = std::vector<ChunkValueRange>{};
+  auto sort_mode = std::optional<SortMode>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    const auto& chunk_sorted_by = chunk->individually_sorted_by();
+    const auto sort_definition = std::find_if(chunk_sorted_by.cbegin(), chunk_sorted_by.cend(),
+                                              [&](const auto& definition) { return definition.column == column_id; });
+    if (sort_definition == chunk_sorted_by.cend() || (sort_mode && *sort_mode != sort_definition->sort_mode)) {
+      return std::nullopt;
+    }
+    sort_mode = sort_definition->sort_mode;
+
+    // We are aware that operator[] is slow, but it is only used for the first and the last value of each chunk.
+    const auto& segment = *chunk->get_segment(column_id);
+    const auto first_value = segment[ChunkOffset{0}];
+    const auto last_value = segment[static_cast<ChunkOffset>(chunk->size() - 1)];
+
+    // As the NULLs of a sorted chunk are at one of its ends, the chunk is either entirely NULL or, if only one of its
+    // ends is NULL, contains NULLs and values. We do not find out where the NULLs of the latter chunks end, so that
+    // they could be placed next to the NULL-only chunks.
+    const auto first_value_is_null = variant_is_null(first_value);
+    if (first_value_is_null != variant_is_null(last_value)) return std::nullopt;
+
+    if (first_value_is_null) {
+      null_chunk_ids.emplace_back(chunk_id);
+    } else {
+      value_ranges.emplace_back(ChunkValueRange{chunk_id, boost::get<ColumnDataType>(first_value),
+                                                boost::get<ColumnDataType>(last_value)});
+    }
+  }
+
+  const auto ascending = sort_mode != SortMode::Descending;
+  const auto precedes = [&](const ColumnDataType& lhs, const ColumnDataType& rhs) {
+    return ascending ? lhs < rhs : rhs < lhs;
+  };
+
+  std::sort(value_ranges.begin(), value_ranges.end(), [&](const auto& lhs, const auto& rhs) {
+    if (lhs.first_value != rhs.first_value) return precedes(lhs.first_value, rhs.first_value);
+    return precedes(lhs.last_value, rhs.last_value);
+  });
+
+  // Only the last value of a chunk may also occur in the following chunks
+  for (auto range_idx = size_t{1}; range_idx < value_ranges.size(); ++range_idx) {
+    if (precedes(value_ranges[range_idx].first_value, value_ranges[range_idx - 1].last_value)) return std::nullopt;
+  }
+
+  auto chunk_order = std::move(null_chunk_ids);
+  chunk_order.reserve(chunk_order.size() + value_ranges.size());
+  for (const auto& value_range : value_ranges) {
+    chunk_order.emplace_back(value_range.chunk_id);
+  }
+  return chunk_order;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -272,6 +339,11 @@ void AggregateSort::_set_and_write_aggregate_value(
     is_null = false;
   }
 
+  if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    // APPROX_COUNT_DISTINCT is never NULL
+    is_null = false;
+  }
+
   if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
     if (!std::is_same_v<AggregateType, pmr_string>) {
       if (value_count >= 2) {
@@ -283,6 +355,16 @@ void AggregateSort::_set_and_write_aggregate_value(
     } else {
       Fail("StandardDeviationSample does not work for strings");
     }
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    aggregate_results[aggregate_group_index] = static_cast<AggregateType>(accumulator.estimate());
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxPercentile) {
+    if constexpr (std::is_arithmetic_v<AggregateType>) {
+      if (value_count > 0) {
+        aggregate_results[aggregate_group_index] = accumulator.quantile(*_aggregates[aggregate_index]->percentile);
+      }
+    } else {
+      Fail("ApproxPercentile does not work for strings");
+    }
   } else {
     aggregate_results[aggregate_group_index] = accumulator;
   }
@@ -290,6 +372,15 @@ void AggregateSort::_set_and_write_aggregate_value(
   aggregate_null_values[aggregate_group_index] = is_null;
 }
 
+std::optional<std::vector<ChunkID>> AggregateSort::streaming_chunk_order(const Table& table, const ColumnID column_id) {
+  auto chunk_order = std::optional<std::vector<ChunkID>>{};
+  resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    chunk_order = order_chunks_by_value_ranges<ColumnDataType>(table, column_id);
+  });
+  return chunk_order;
+}
+
 Segments AggregateSort::_get_segments_of_chunk(const std::shared_ptr<const Table>& input_table,
                                                const ChunkID chunk_id) {
   Segments segments{};
@@ -303,6 +394,38 @@ Segments AggregateSort::_get_segments_of_chunk(const std::shared_ptr<const Table
   return segments;
 }
 
+Segments AggregateSort::_get_reference_segments_of_chunk(const std::shared_ptr<const Table>& input_table,
+                                                         const ChunkID chunk_id) {
+  // In case of a reference segment, we can directly forward it.
+  if (input_table->type() == TableType::References) return _get_segments_of_chunk(input_table, chunk_id);
+
+  // Otherwise, reference the entire chunk using an EntireChunkPosList.
+  const auto column_count = input_table->column_count();
+  const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_table->get_chunk(chunk_id)->size());
+  auto reference_segments = Segments{};
+  reference_segments.reserve(column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    reference_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+  }
+  return reference_segments;
+}
+
+std::shared_ptr<const Table> AggregateSort::_reorder_chunks(const std::shared_ptr<const Table>& input_table,
+                                                            const std::vector<ChunkID>& chunk_order) {
+  auto chunk_order_is_unchanged = chunk_order.size() == input_table->chunk_count();
+  for (auto chunk_idx = size_t{0}; chunk_idx < chunk_order.size() && chunk_order_is_unchanged; ++chunk_idx) {
+    chunk_order_is_unchanged = chunk_order[chunk_idx] == ChunkID{static_cast<ChunkID::base_type>(chunk_idx)};
+  }
+  if (chunk_order_is_unchanged) return input_table;
+
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  for (const auto chunk_id : chunk_order) {
+    output_table->append_chunk(_get_reference_segments_of_chunk(input_table, chunk_id));
+  }
+  return output_table;
+}
+
 std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_ptr<const Table>& input_table,
                                                              const std::vector<ColumnID>& groupby_column_ids) {
   auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
@@ -326,24 +449,9 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
         }) != chunk_sorted_by.cend();
 
     if (single_column_group_by && chunk_sorted_by_first_group_by_column) {
-      if (input_table->type() == TableType::Data) {
-        // Since the chunks that actually have to be sorted will be returned as referencing chunks, we need to forward
-        // the already sorted input chunks as such too, using an EntireChunkPosList.
-        const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk->size());
-        auto reference_segments = Segments{};
-        reference_segments.reserve(column_count);
-
-        // Create actual ReferenceSegment objects.
-        for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(input_table, column_id, pos_list);
-          reference_segments.push_back(ref_segment_out);
-        }
-
-        output_table->append_chunk(reference_segments);
-      } else {
-        // In case of a reference segment, we can directly forward it.
-        output_table->append_chunk(_get_segments_of_chunk(input_table, chunk_id));
-      }
+      // Since the chunks that actually have to be sorted will be returned as referencing chunks, we need to forward
+      // the already sorted input chunks as such too.
+      output_table->append_chunk(_get_reference_segments_of_chunk(input_table, chunk_id));
     } else {
       // Creating a new table holding only the current chunk and pass it to the sort operator.
       auto single_chunk_table = std::make_shared<Table>(input_table->column_definitions(), input_table->type());
@@ -370,8 +478,9 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
  * 2. Build the output table definition.
  *    - If empty, return (empty) result table.
  * 3. Sort the input table by group by columns using the sort operator.
- *    - depending on characteristics of the input table, sorting can either be skipped (input already sorted by group
- *      by column) or sorting can be limited to chunks instead of sorting the whole table (input table is clustered)
+ *    - depending on characteristics of the input table, sorting can either be skipped (chunks already sorted by the
+ *      group by column and only reordered, see streaming_chunk_order) or sorting can be limited to chunks instead of
+ *      sorting the whole table (input table is clustered)
  * 4. Find the group boundaries.
  *    - The unit of aggregation (either chunks or the whole table, depending on the table's value clustering) is now
  *      sorted by all group by columns.
@@ -441,7 +550,8 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       std::vector<AllTypeVariant> default_values;
       for (const auto& aggregate : _aggregates) {
         if (aggregate->aggregate_function == AggregateFunction::Count ||
-            aggregate->aggregate_function == AggregateFunction::CountDistinct) {
+            aggregate->aggregate_function == AggregateFunction::CountDistinct ||
+            aggregate->aggregate_function == AggregateFunction::ApproxCountDistinct) {
           default_values.emplace_back(int64_t{0});
         } else {
           default_values.emplace_back(NULL_VALUE);
@@ -477,7 +587,18 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       }
     }
 
-    if (is_value_clustered_by_groupby_column) {
+    // If the chunks are sorted by the only group by column and their value ranges do not overlap, the groups become
+    // consecutive by reordering the chunks. They are then aggregated in a single pass over the input, where groups that
+    // continue across chunk borders are found like any other group boundary. This is the case for the output of a Sort
+    // (even after it was shuffled by parallel operators such as the Validate) or for tables whose chunks were sorted
+    // by a steadily increasing column like a timestamp.
+    const auto streaming_chunk_order = _groupby_column_ids.size() == 1
+                                           ? AggregateSort::streaming_chunk_order(*input_table, _groupby_column_ids[0])
+                                           : std::nullopt;
+
+    if (streaming_chunk_order) {
+      sorted_table = _reorder_chunks(input_table, *streaming_chunk_order);
+    } else if (is_value_clustered_by_groupby_column) {
       // Sort input table chunk-wise as the group by values are clustered.
       sorted_table = _sort_table_chunk_wise(input_table, _groupby_column_ids);
     } else {
@@ -689,6 +810,20 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
               group_boundaries, aggregate_index, sorted_table);
           break;
         }
+        case AggregateFunction::ApproxCountDistinct: {
+          using AggregateType =
+              typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct>(
+              group_boundaries, aggregate_index, sorted_table);
+          break;
+        }
+        case AggregateFunction::ApproxPercentile: {
+          using AggregateType =
+              typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxPercentile>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::ApproxPercentile>(
+              group_boundaries, aggregate_index, sorted_table);
+          break;
+        }
         case AggregateFunction::Any: {
           write_groupby_column(input_column_id, ColumnID{static_cast<ColumnID::base_type>(aggregate_index +
                                                                                           _groupby_column_ids.size())});
@@ -751,6 +886,12 @@ void AggregateSort::_create_aggregate_column_definitions(boost::hana::basic_type
     case AggregateFunction::StandardDeviationSample:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
+    case AggregateFunction::ApproxPercentile:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::ApproxPercentile>(column_index);
+      break;
     case AggregateFunction::Any:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::Any>(column_index);
       break;
@@ -784,7 +925,7 @@ void AggregateSort::create_aggregate_column_definitions(ColumnID column_index) {
 
   const auto nullable =
       (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
-       aggregate_function != AggregateFunction::Any) ||
+       aggregate_function != AggregateFunction::ApproxCountDistinct && aggregate_function != AggregateFunction::Any) ||
       (aggregate_function == AggregateFunction::Any && left_input_table()->column_is_nullable(input_column_id));
   const auto column_name = aggregate->aggregate_function == AggregateFunction::Any ? pqp_column.as_column_name()
                                                                                    : aggregate->as_column_name();
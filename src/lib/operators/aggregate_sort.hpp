@@ -42,15 +42,13 @@ namespace opossum {
  * https://github.com/hyrise/hyrise/wiki/Operators_Aggregate .
  * While most of this page refers to the hash-based aggregate, it also explains common features like aggregate traits.
  *
- * Some notes regarding future optimization:
- * Currently, we always sort the input table by the group by columns.
- * In some cases this might be unnecessary, as the table could already be sorted.
+ * Some notes regarding optimization:
+ * The input table is not sorted if its chunks are already sorted by the only group by column and their value ranges
+ * do not overlap (see streaming_chunk_order). The chunks are then merely reordered and aggregated in a single pass,
+ * which is why the LQPTranslator chooses this operator over the AggregateHash if the input order is known. With
+ * multiple group by columns, we always sort, as the sort information of chunks is not cascading.
  * There is an issue that discusses how such information as sortedness should be propagated:
  *  https://github.com/hyrise/hyrise/issues/1519
- * As soon as this issue is decided, the sort aggregate operator should be adapted to benefit from sortedness.
- *  If the issue comes to the conclusion that it is the optimizer's responsibility to be aware of sortedness,
- *  this operator might be refactored to expect sorted input and to not sort at all;
- *  and let the optimizer add the required sort operators to the LQP.
  *
  *  To be precise: We do NOT need the input to be sorted.
  *  What we actually need is that all rows belonging to the same group are consecutive,
@@ -67,6 +65,14 @@ class AggregateSort : public AbstractAggregateOperator {
 
   const std::string& name() const override;
 
+  /**
+   * Returns the order in which the chunks of the table have to be read so that its rows are ordered by the column, or
+   * std::nullopt if the chunk sort orders do not allow for this. This is the case if all chunks are sorted by the
+   * column in the same sort mode and their value ranges do not overlap except for their first and last values. Empty
+   * chunks are omitted. Only the first and the last value of each chunk are accessed.
+   */
+  static std::optional<std::vector<ChunkID>> streaming_chunk_order(const Table& table, const ColumnID column_id);
+
   /**
    * Creates the aggregate column definitions and appends it to `_output_column_definitions`
    * We need the input column data type because the aggregate type can depend on it.
@@ -81,8 +87,11 @@ class AggregateSort : public AbstractAggregateOperator {
 
  protected:
   template <AggregateFunction aggregate_function, typename AggregateType>
-  using AggregateAccumulator = std::conditional_t<aggregate_function == AggregateFunction::StandardDeviationSample,
-                                                  StandardDeviationSampleData, AggregateType>;
+  using AggregateAccumulator = std::conditional_t<
+      aggregate_function == AggregateFunction::StandardDeviationSample, StandardDeviationSampleData,
+      std::conditional_t<aggregate_function == AggregateFunction::ApproxCountDistinct, HyperLogLog,
+                         std::conditional_t<aggregate_function == AggregateFunction::ApproxPercentile, QuantileSketch,
+                                            AggregateType>>>;
 
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -126,6 +135,12 @@ class AggregateSort : public AbstractAggregateOperator {
                                                        const std::vector<ColumnID>& groupby_column_ids);
 
   static Segments _get_segments_of_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id);
+
+  // Returns the segments of the chunk as reference segments, referencing the entire chunk if the table is a data table
+  static Segments _get_reference_segments_of_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id);
+
+  static std::shared_ptr<const Table> _reorder_chunks(const std::shared_ptr<const Table>& input_table,
+                                                      const std::vector<ChunkID>& chunk_order);
 };
 
 }  // namespace opossum
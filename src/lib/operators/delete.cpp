@@ -5,11 +5,56 @@
 #include <utility>
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Calls functor(chunk_id, begin_index, end_index) for each run of consecutive positions that reference the same chunk.
+// Bulk deletes thus look up the chunk and lock its MVCC data once per run instead of once per row.
+template <typename Functor>
+void for_each_chunk_run(const AbstractPosList& pos_list, const Functor& functor) {
+  const auto pos_list_size = pos_list.size();
+  if (pos_list_size > 0 && pos_list.references_single_chunk()) {
+    functor(pos_list.common_chunk_id(), size_t{0}, pos_list_size);
+    return;
+  }
+
+  auto run_begin = size_t{0};
+  while (run_begin < pos_list_size) {
+    const auto chunk_id = pos_list[run_begin].chunk_id;
+    auto run_end = run_begin + 1;
+    while (run_end < pos_list_size && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+    functor(chunk_id, run_begin, run_end);
+    run_begin = run_end;
+  }
+}
+
+// Calls functor(begin_offset, end_offset) for each range of consecutive chunk offsets within a run, so that the MVCC
+// data of contiguous rows (e.g., of an EntireChunkPosList) is updated as a range
+template <typename Functor>
+void for_each_offset_range(const AbstractPosList& pos_list, size_t begin_index, const size_t end_index,
+                           const Functor& functor) {
+  while (begin_index < end_index) {
+    const auto begin_offset = pos_list[begin_index].chunk_offset;
+    auto range_length = size_t{1};
+    while (begin_index + range_length < end_index &&
+           pos_list[begin_index + range_length].chunk_offset == begin_offset + range_length) {
+      ++range_length;
+    }
+    functor(begin_offset, static_cast<ChunkOffset>(begin_offset + range_length));
+    begin_index += range_length;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
@@ -48,40 +93,65 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
-    for (const auto row_id : *pos_list) {
-      const auto referenced_chunk = first_segment->referenced_table()->get_chunk(row_id.chunk_id);
+    const auto& referenced_table = first_segment->referenced_table();
+    auto failed = false;
+    for_each_chunk_run(*pos_list, [&](const ChunkID referenced_chunk_id, const size_t begin_index,
+                                      const size_t end_index) {
+      if (failed) return;
+
+      const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
       Assert(referenced_chunk, "Referenced chunks are not allowed to be null pointers");
 
-      // Scope for the lock on the MVCC data
-      {
-        auto mvcc_data = referenced_chunk->mvcc_data();
-        DebugAssert(mvcc_data, "Delete cannot operate on a table without MVCC data");
+      DebugAssert(referenced_chunk->has_mvcc_data(), "Delete cannot operate on a table without MVCC data");
+      const auto [mvcc_data, compaction_lock] = referenced_chunk->writable_mvcc_data();
+
+      for (auto pos_list_index = begin_index; pos_list_index < end_index; ++pos_list_index) {
+        const auto chunk_offset = (*pos_list)[pos_list_index].chunk_offset;
 
         DebugAssert(
-            Validate::is_row_visible(
-                context->transaction_id(), context->snapshot_commit_id(), mvcc_data->get_tid(row_id.chunk_offset),
-                mvcc_data->get_begin_cid(row_id.chunk_offset), mvcc_data->get_end_cid(row_id.chunk_offset)),
+            Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
+                                     mvcc_data->get_tid(chunk_offset), mvcc_data->get_begin_cid(chunk_offset),
+                                     mvcc_data->get_end_cid(chunk_offset)),
             "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
 
         // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
         auto expected = 0u;
-        const auto success = mvcc_data->compare_exchange_tid(row_id.chunk_offset, expected, _transaction_id);
+        const auto success = mvcc_data->compare_exchange_tid(chunk_offset, expected, _transaction_id);
 
         if (!success) {
           // If the row has a set TID, it might be a row that our TX inserted
           // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
           // change this row from the initial tid
 
-          if (mvcc_data->get_tid(row_id.chunk_offset) == _transaction_id) {
+          if (mvcc_data->get_tid(chunk_offset) == _transaction_id) {
             // Make sure that even we don't see it anymore
-            mvcc_data->set_tid(row_id.chunk_offset, INVALID_TRANSACTION_ID);
+            mvcc_data->set_tid(chunk_offset, INVALID_TRANSACTION_ID);
           } else {
             // the row is already locked by someone else and the transaction needs to be rolled back
-            _mark_as_failed();
-            return nullptr;
+            failed = true;
+            return;
           }
         }
       }
+    });
+
+    if (failed) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
+  // Maintain the materialized views on the referenced table (see MaterializedView) once all rows are locked
+  if (_referencing_table->row_count() > 0) {
+    const auto& first_segment =
+        static_cast<const ReferenceSegment&>(*_referencing_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    const auto materialized_views =
+        Hyrise::get().storage_manager.materialized_views_on_table(first_segment.referenced_table());
+    for (const auto& materialized_view : materialized_views) {
+      if (!materialized_view->maintain_deleted_rows(_referencing_table, context)) {
+        _mark_as_failed();
+        return nullptr;
+      }
     }
   }
 
@@ -95,14 +165,33 @@ void Delete::_on_commit_records(const CommitID commit_id) {
     const auto referencing_segment =
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
+    transaction_context()->register_modified_table(referenced_table);
+
+    const auto& pos_list = *referencing_segment->pos_list();
+    for_each_chunk_run(pos_list, [&](const ChunkID referenced_chunk_id, const size_t begin_index,
+                                     const size_t end_index) {
+      const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+      const auto mvcc_data = referenced_chunk->mvcc_data();
+
+      for_each_offset_range(pos_list, begin_index, end_index,
+                            [&](const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+                              mvcc_data->set_end_cids(begin_offset, end_offset, commit_id);
+                            });
+      referenced_chunk->increase_invalid_row_count(static_cast<ChunkOffset>(end_index - begin_index));
+      // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+    });
+  }
+}
 
-    for (const auto row_id : *referencing_segment->pos_list()) {
-      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+void Delete::_on_write_log_records(std::vector<char>& records) const {
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
 
-      referenced_chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
-      referenced_chunk->increase_invalid_row_count(1);
-      // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
-    }
+    WriteAheadLog::write_delete_record(records, referencing_segment->referenced_table(),
+                                       *referencing_segment->pos_list());
   }
 }
 
@@ -114,19 +203,29 @@ void Delete::_on_rollback_records() {
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
 
-    for (const auto row_id : *referencing_segment->pos_list()) {
-      auto expected = _transaction_id;
-
-      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
-
-      // unlock all rows locked in _on_execute
-      const auto result = referenced_chunk->mvcc_data()->compare_exchange_tid(row_id.chunk_offset, expected, 0u);
-
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) return;
-    }
+    const auto& pos_list = *referencing_segment->pos_list();
+    auto stopped = false;
+    for_each_chunk_run(pos_list, [&](const ChunkID referenced_chunk_id, const size_t begin_index,
+                                     const size_t end_index) {
+      if (stopped) return;
+
+      const auto mvcc_data = referenced_table->get_chunk(referenced_chunk_id)->mvcc_data();
+      for (auto pos_list_index = begin_index; pos_list_index < end_index; ++pos_list_index) {
+        auto expected = _transaction_id;
+
+        // unlock all rows locked in _on_execute
+        const auto result = mvcc_data->compare_exchange_tid(pos_list[pos_list_index].chunk_offset, expected, 0u);
+
+        // If the above operation fails, it means the row is locked by another transaction. This must have been
+        // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
+        // unlocking rows here as well.
+        if (!result) {
+          stopped = true;
+          return;
+        }
+      }
+    });
+    if (stopped) return;
   }
 }
 
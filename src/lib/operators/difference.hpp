@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -12,14 +11,21 @@
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Computes the rows of the left input that are not contained in the right input (EXCEPT). With
+ * SetOperationMode::Unique, each such row is returned once. SetOperationMode::All has multiset semantics (EXCEPT ALL).
+ * SetOperationMode::Positions keeps every left row that has no equal row in the right input, including duplicates, and
+ * retains the chunks of the left input. See hash_set_operation.hpp for details.
  */
 class Difference : public AbstractReadOnlyOperator {
  public:
   Difference(const std::shared_ptr<const AbstractOperator>& left_in,
-             const std::shared_ptr<const AbstractOperator>& right_in);
+             const std::shared_ptr<const AbstractOperator>& right_in,
+             const SetOperationMode set_operation_mode = SetOperationMode::Positions);
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationMode set_operation_mode() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -29,6 +35,6 @@ class Difference : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
  private:
-  static void _append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value);
+  const SetOperationMode _set_operation_mode;
 };
 }  // namespace opossum
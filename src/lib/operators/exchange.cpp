@@ -0,0 +1,150 @@
+#include "exchange.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "distributed/cluster.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Appends the chunks of the input table to the output table as ValueSegments
+void append_materialized_chunks(const Table& input_table, Table& output_table) {
+  const auto chunk_count = input_table.chunk_count();
+  const auto column_count = input_table.column_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(input_table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        auto values = pmr_vector<ColumnDataType>{};
+        auto null_values = pmr_vector<bool>{};
+        values.reserve(chunk->size());
+        null_values.reserve(chunk->size());
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+          null_values.emplace_back(position.is_null());
+        });
+
+        if (input_table.column_is_nullable(column_id)) {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), null_values));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+    output_table.append_chunk(segments);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+Exchange::Exchange(const ShardFragment& fragment)
+    : AbstractReadOnlyOperator(OperatorType::Exchange), _mode(ExchangeMode::Gather), _fragment(fragment) {}
+
+Exchange::Exchange(const std::shared_ptr<const AbstractOperator>& input_operator, const std::string& table_name)
+    : AbstractReadOnlyOperator(OperatorType::Exchange, input_operator),
+      _mode(ExchangeMode::Shuffle),
+      _fragment(ShardFragment{.table_name = table_name}) {}
+
+const std::string& Exchange::name() const {
+  static const auto name = std::string{"Exchange"};
+  return name;
+}
+
+std::string Exchange::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  auto stream = std::stringstream{};
+  stream << name() << separator << (_mode == ExchangeMode::Gather ? "Gather" : "Shuffle") << separator << "("
+         << _fragment.table_name << ")";
+  if (_mode == ExchangeMode::Gather) {
+    stream << separator << _fragment.predicates.size() << " predicate(s)";
+    if (_fragment.is_aggregating()) stream << "," << separator << "partially aggregated";
+  }
+  return stream.str();
+}
+
+ExchangeMode Exchange::mode() const { return _mode; }
+
+const ShardFragment& Exchange::fragment() const { return _fragment; }
+
+std::shared_ptr<const Table> Exchange::_on_execute() {
+  Assert(Hyrise::get().cluster, "Exchange requires a cluster");
+  return _mode == ExchangeMode::Gather ? _gather() : _shuffle();
+}
+
+std::shared_ptr<const Table> Exchange::_gather() {
+  const auto& cluster = *Hyrise::get().cluster;
+  const auto node_count = cluster.node_count();
+
+  auto results = std::vector<std::shared_ptr<const Table>>(node_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(node_count);
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, node_id]() {
+      results[node_id] = cluster.execute_fragment(node_id, _fragment, transaction_context());
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  const auto output_table = std::make_shared<Table>(results.front()->column_definitions(), TableType::Data);
+  for (const auto& result : results) {
+    append_materialized_chunks(*result, *output_table);
+  }
+  return output_table;
+}
+
+std::shared_ptr<const Table> Exchange::_shuffle() {
+  const auto& cluster = *Hyrise::get().cluster;
+  const auto node_count = cluster.node_count();
+  const auto& table_name = _fragment.table_name;
+  const auto sharding_column_id = cluster.sharding_column_id(table_name);
+
+  const auto& column_definitions = left_input_table()->column_definitions();
+  auto tables = std::vector<std::shared_ptr<Table>>(node_count);
+  for (auto& table : tables) {
+    table = std::make_shared<Table>(column_definitions, TableType::Data);
+  }
+  for (const auto& row : left_input_table()->get_rows()) {
+    tables[cluster.node_for(table_name, row[sharding_column_id])]->append(row);
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    if (node_id == cluster.node_id() || tables[node_id]->row_count() == 0) continue;
+    jobs.emplace_back(
+        std::make_shared<JobTask>([&, node_id]() { cluster.insert(node_id, table_name, *tables[node_id]); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return tables[cluster.node_id()];
+}
+
+std::shared_ptr<AbstractOperator> Exchange::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  if (_mode == ExchangeMode::Gather) return std::make_shared<Exchange>(_fragment);
+  return std::make_shared<Exchange>(copied_left_input, _fragment.table_name);
+}
+
+void Exchange::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "distributed/shard_fragment.hpp"
+
+namespace opossum {
+
+enum class ExchangeMode { Gather, Shuffle };
+
+/**
+ * Moves rows between the nodes of the Cluster (see Hyrise::cluster):
+ *
+ *  - Gather: Executes a ShardFragment on every node and outputs the union of their results. The local shard is read in
+ *    the transaction of the operator. The operator has no input.
+ *  - Shuffle: Sends the rows of the input to the nodes that store them in the sharded table and outputs the rows that
+ *    are stored by this node, which are then inserted by the Insert operator. The other nodes insert their rows in
+ *    transactions of their own.
+ *
+ * The output is always materialized.
+ */
+class Exchange : public AbstractReadOnlyOperator {
+ public:
+  explicit Exchange(const ShardFragment& fragment);
+  Exchange(const std::shared_ptr<const AbstractOperator>& input_operator, const std::string& table_name);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  ExchangeMode mode() const;
+  const ShardFragment& fragment() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  std::shared_ptr<const Table> _gather();
+  std::shared_ptr<const Table> _shuffle();
+
+  const ExchangeMode _mode;
+
+  // For Shuffle, only the table name is set, which is the table that the rows are inserted into
+  const ShardFragment _fragment;
+};
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "hyrise.hpp"
+#include "import_export/arrow/arrow_writer.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "import_export/csv/csv_writer.hpp"
 #include "utils/assert.hpp"
@@ -31,11 +32,17 @@ std::shared_ptr<const Table> Export::_on_execute() {
     case FileType::Csv:
       CsvWriter::write(*left_input_table(), _filename);
       break;
+    case FileType::Tbl:
+      CsvWriter::write_tbl(*left_input_table(), _filename);
+      break;
     case FileType::Binary:
       BinaryWriter::write(*left_input_table(), _filename);
       break;
+    case FileType::Parquet:
+    case FileType::Arrow:
+      ArrowWriter::write(*left_input_table(), _filename, _file_type);
+      break;
     case FileType::Auto:
-    case FileType::Tbl:
       Fail("Export: Exporting file type is not supported.");
   }
 
@@ -16,7 +16,7 @@ namespace opossum {
 
 /*
  * This operator writes a table into a file.
- * Supportes file types are .csv and Opossum .bin files.
+ * Supportes file types are .csv, .tbl, Opossum .bin, and (if built with Arrow support) .parquet and .arrow files.
  * For .csv files, a CSV config is added, which is located in the <filename>.json file.
  * Documentation of the file formats can be found in BinaryWriter and CsvWriter header files.
  */
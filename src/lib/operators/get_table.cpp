@@ -60,6 +60,22 @@ const std::vector<ChunkID>& GetTable::pruned_chunk_ids() const { return _pruned_
 
 const std::vector<ColumnID>& GetTable::pruned_column_ids() const { return _pruned_column_ids; }
 
+ChunkID GetTable::output_chunk_id(const ChunkID stored_chunk_id) const {
+  DebugAssert(performance_data->executed, "Chunks are only mapped after the execution");
+  // Chunks that were added to the stored table after the execution are not part of the output
+  if (stored_chunk_id >= _output_chunk_ids.size()) return INVALID_CHUNK_ID;
+  return _output_chunk_ids[stored_chunk_id];
+}
+
+ColumnID GetTable::stored_column_id(const ColumnID output_column_id) const {
+  auto stored_column_id = output_column_id;
+  for (const auto pruned_column_id : _pruned_column_ids) {
+    if (pruned_column_id > stored_column_id) break;
+    ++stored_column_id;
+  }
+  return stored_column_id;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
@@ -163,6 +179,7 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   auto output_chunks_iter = output_chunks.begin();
 
   auto excluded_chunk_ids_iter = excluded_chunk_ids.begin();
+  _output_chunk_ids.assign(chunk_count, INVALID_CHUNK_ID);
 
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
     // Skip `stored_chunk_id` if it is in the sorted vector `excluded_chunk_ids`
@@ -170,6 +187,7 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       ++excluded_chunk_ids_iter;
       continue;
     }
+    _output_chunk_ids[stored_chunk_id] = static_cast<ChunkID>(std::distance(output_chunks.begin(), output_chunks_iter));
 
     // The Chunk is to be included in the output Table, now we progress to excluding Columns
     const auto stored_chunk = stored_table->get_chunk(stored_chunk_id);
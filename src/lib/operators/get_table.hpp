@@ -34,6 +34,12 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // Map the chunks and columns of the stored table to those of the output table and vice versa, e.g., for RowIDs found
+  // in a TableIndex of the stored table (see IndexScan). output_chunk_id() returns INVALID_CHUNK_ID for chunks that are
+  // not part of the output and may only be called after the execution.
+  ChunkID output_chunk_id(const ChunkID stored_chunk_id) const;
+  ColumnID stored_column_id(const ColumnID output_column_id) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -46,5 +52,8 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  // Output ChunkID of each chunk of the stored table, set on execution
+  std::vector<ChunkID> _output_chunk_ids;
 };
 }  // namespace opossum
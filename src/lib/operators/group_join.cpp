@@ -0,0 +1,721 @@
+#include "group_join.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aggregate/aggregate_traits.hpp"
+#include "constant_mappings.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_aggregate_operator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/timer.hpp"
+
+using namespace std::string_literals;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// For each row of a chunk, the group it contributes to or INVALID_GROUP_ID
+using GroupIDs = std::vector<size_t>;
+constexpr auto INVALID_GROUP_ID = std::numeric_limits<size_t>::max();
+
+// Runs functor(task_id) for each task, concurrently if there is more than one task
+template <typename Functor>
+void execute_tasks(const size_t task_count, const Functor& functor) {
+  if (task_count == 1) {
+    functor(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, task_id]() { functor(task_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns the number of tasks among which the chunks of the table are split, given that each task should process at
+// least GroupJoin::JOB_SPAWN_THRESHOLD rows
+size_t task_count_for(const Table& table) {
+  if (!Hyrise::get().is_multi_threaded()) return 1;
+  return std::max(size_t{1}, std::min({static_cast<size_t>(table.chunk_count()),
+                                       table.row_count() / GroupJoin::JOB_SPAWN_THRESHOLD,
+                                       static_cast<size_t>(Hyrise::get().topology.num_cpus())}));
+}
+
+// Returns the contiguous range [begin, end) of chunks that a task processes
+std::pair<ChunkID, ChunkID> task_chunk_range(const ChunkID chunk_count, const size_t task_id, const size_t task_count) {
+  return {ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)},
+          ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)}};
+}
+
+class BaseGroupJoinAggregate {
+ public:
+  virtual ~BaseGroupJoinAggregate() = default;
+
+  // Adds the values of all rows of the segment that have a group id
+  virtual void aggregate(const AbstractSegment& segment, const GroupIDs& group_ids) = 0;
+
+  // Adds the aggregates of the groups [begin_group_id, end_group_id) that another aggregate of the same type
+  // calculated on other rows, e.g., by another task
+  virtual void merge(const BaseGroupJoinAggregate& other, const size_t begin_group_id, const size_t end_group_id) = 0;
+
+  // Writes the aggregates of the output groups. left_row_counts holds the number of left rows of each group.
+  virtual std::shared_ptr<AbstractSegment> write_output(const std::vector<size_t>& output_group_ids,
+                                                        const std::vector<int64_t>& left_row_counts) const = 0;
+};
+
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+class GroupJoinAggregate : public BaseGroupJoinAggregate {
+ public:
+  using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
+
+  explicit GroupJoinAggregate(const size_t group_count) : _accumulators(group_count), _value_counts(group_count) {}
+
+  void aggregate(const AbstractSegment& segment, const GroupIDs& group_ids) final {
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      const auto group_id = group_ids[position.chunk_offset()];
+      if (group_id == INVALID_GROUP_ID || position.is_null()) return;
+
+      if constexpr (aggregate_function == AggregateFunction::Any) {
+        // ANY is only calculated for the first left row of a group
+        _accumulators[group_id] = position.value();
+      } else {
+        // Shares the implementation of MIN, MAX, SUM, and AVG with the aggregate operators
+        AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>{}.get_aggregate_function()(
+            position.value(), _value_counts[group_id], _accumulators[group_id]);
+      }
+      ++_value_counts[group_id];
+    });
+  }
+
+  void merge(const BaseGroupJoinAggregate& other, const size_t begin_group_id, const size_t end_group_id) final {
+    const auto& other_aggregate = static_cast<const GroupJoinAggregate&>(other);
+    for (auto group_id = begin_group_id; group_id < end_group_id; ++group_id) {
+      const auto other_value_count = other_aggregate._value_counts[group_id];
+      if (other_value_count == 0) continue;
+
+      const auto& other_accumulator = other_aggregate._accumulators[group_id];
+      auto& accumulator = _accumulators[group_id];
+      if (_value_counts[group_id] == 0) {
+        accumulator = other_accumulator;
+      } else if constexpr (aggregate_function == AggregateFunction::Min) {
+        accumulator = std::min(accumulator, other_accumulator);
+      } else if constexpr (aggregate_function == AggregateFunction::Max) {
+        accumulator = std::max(accumulator, other_accumulator);
+      } else if constexpr (aggregate_function == AggregateFunction::Sum ||
+                           aggregate_function == AggregateFunction::Avg) {
+        accumulator += other_accumulator;
+      }
+      // COUNT only needs the value counts, ANY keeps the value that it already has
+      _value_counts[group_id] += other_value_count;
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> write_output(const std::vector<size_t>& output_group_ids,
+                                                const std::vector<int64_t>& left_row_counts) const final {
+    auto values = pmr_vector<AggregateType>(output_group_ids.size());
+
+    if constexpr (aggregate_function == AggregateFunction::Count) {
+      for (auto output_row = size_t{0}; output_row < output_group_ids.size(); ++output_row) {
+        const auto group_id = output_group_ids[output_row];
+        values[output_row] = static_cast<AggregateType>(_value_counts[group_id]) * left_row_counts[group_id];
+      }
+      return std::make_shared<ValueSegment<AggregateType>>(std::move(values));
+    } else {
+      // Groups without (non-NULL) values, e.g., left rows without a join partner, have NULL as their aggregate
+      auto null_values = pmr_vector<bool>(output_group_ids.size());
+      for (auto output_row = size_t{0}; output_row < output_group_ids.size(); ++output_row) {
+        const auto group_id = output_group_ids[output_row];
+        if (_value_counts[group_id] == 0) {
+          null_values[output_row] = true;
+          continue;
+        }
+
+        if constexpr (aggregate_function == AggregateFunction::Sum) {
+          values[output_row] = _accumulators[group_id] * static_cast<AggregateType>(left_row_counts[group_id]);
+        } else if constexpr (aggregate_function == AggregateFunction::Avg) {
+          values[output_row] = _accumulators[group_id] / static_cast<AggregateType>(_value_counts[group_id]);
+        } else {
+          values[output_row] = _accumulators[group_id];
+        }
+      }
+      return std::make_shared<ValueSegment<AggregateType>>(std::move(values), std::move(null_values));
+    }
+  }
+
+ protected:
+  std::vector<AggregateType> _accumulators;
+  std::vector<int64_t> _value_counts;
+};
+
+// COUNT(*) counts the matching right rows, independent of any column
+class GroupJoinCountStar : public BaseGroupJoinAggregate {
+ public:
+  explicit GroupJoinCountStar(const size_t group_count) : _match_counts(group_count) {}
+
+  void aggregate(const AbstractSegment& /*segment*/, const GroupIDs& group_ids) final {
+    for (const auto group_id : group_ids) {
+      if (group_id != INVALID_GROUP_ID) ++_match_counts[group_id];
+    }
+  }
+
+  void merge(const BaseGroupJoinAggregate& other, const size_t begin_group_id, const size_t end_group_id) final {
+    const auto& other_match_counts = static_cast<const GroupJoinCountStar&>(other)._match_counts;
+    for (auto group_id = begin_group_id; group_id < end_group_id; ++group_id) {
+      _match_counts[group_id] += other_match_counts[group_id];
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> write_output(const std::vector<size_t>& output_group_ids,
+                                                const std::vector<int64_t>& left_row_counts) const final {
+    auto values = pmr_vector<int64_t>(output_group_ids.size());
+    for (auto output_row = size_t{0}; output_row < output_group_ids.size(); ++output_row) {
+      const auto group_id = output_group_ids[output_row];
+      // In left outer joins, left rows without a join partner are emitted once. Inner joins do not output such groups.
+      values[output_row] = std::max(_match_counts[group_id], int64_t{1}) * left_row_counts[group_id];
+    }
+    return std::make_shared<ValueSegment<int64_t>>(std::move(values));
+  }
+
+ protected:
+  std::vector<int64_t> _match_counts;
+};
+
+std::unique_ptr<BaseGroupJoinAggregate> make_group_join_aggregate(const AggregateFunction aggregate_function,
+                                                                  const DataType data_type, const size_t group_count) {
+  auto aggregate = std::unique_ptr<BaseGroupJoinAggregate>{};
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    switch (aggregate_function) {
+      case AggregateFunction::Min:
+        aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Min>>(group_count);
+        break;
+      case AggregateFunction::Max:
+        aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Max>>(group_count);
+        break;
+      case AggregateFunction::Count:
+        aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Count>>(group_count);
+        break;
+      case AggregateFunction::Any:
+        aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Any>>(group_count);
+        break;
+      case AggregateFunction::Sum:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Sum>>(group_count);
+          break;
+        }
+        Fail("GroupJoin: Cannot calculate SUM on string column");
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          aggregate = std::make_unique<GroupJoinAggregate<ColumnDataType, AggregateFunction::Avg>>(group_count);
+          break;
+        }
+        Fail("GroupJoin: Cannot calculate AVG on string column");
+      default:
+        Fail("GroupJoin does not support "s + aggregate_function_to_string.left.at(aggregate_function));
+    }
+  });
+
+  return aggregate;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool GroupJoin::supports(const JoinConfiguration config) {
+  return (config.join_mode == JoinMode::Inner || config.join_mode == JoinMode::Left) &&
+         config.predicate_condition == PredicateCondition::Equals && config.left_data_type == config.right_data_type &&
+         !config.secondary_predicates;
+}
+
+bool GroupJoin::supports_aggregate(const AggregateExpression& aggregate, const ColumnCount left_column_count) {
+  const auto pqp_column = std::dynamic_pointer_cast<PQPColumnExpression>(aggregate.argument());
+  if (!pqp_column) return false;
+
+  const auto column_id = pqp_column->column_id;
+  if (column_id == INVALID_COLUMN_ID) return aggregate.aggregate_function == AggregateFunction::Count;
+
+  const auto from_left_input = column_id < left_column_count;
+  switch (aggregate.aggregate_function) {
+    case AggregateFunction::Any:
+      return from_left_input;
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+    case AggregateFunction::Sum:
+    case AggregateFunction::Avg:
+    case AggregateFunction::Count:
+      return !from_left_input && (pqp_column->data_type() != DataType::String ||
+                                  (aggregate.aggregate_function != AggregateFunction::Sum &&
+                                   aggregate.aggregate_function != AggregateFunction::Avg));
+    default:
+      return false;
+  }
+}
+
+GroupJoin::GroupJoin(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                     const OperatorJoinPredicate& primary_predicate,
+                     const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                     const ColumnID groupby_column_id)
+    : AbstractJoinOperator(OperatorType::GroupJoin, left, right, mode, primary_predicate, {},
+                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _aggregates(aggregates),
+      _groupby_column_id(groupby_column_id) {}
+
+const std::string& GroupJoin::name() const {
+  static const auto name = std::string{"GroupJoin"};
+  return name;
+}
+
+std::string GroupJoin::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << AbstractJoinOperator::description(description_mode) << separator
+         << "GroupBy ColumnID: " << _groupby_column_id << " Aggregates: ";
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    stream << _aggregates[aggregate_idx]->as_column_name();
+    if (aggregate_idx + 1 < _aggregates.size()) stream << ", ";
+  }
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AggregateExpression>>& GroupJoin::aggregates() const { return _aggregates; }
+
+ColumnID GroupJoin::groupby_column_id() const { return _groupby_column_id; }
+
+std::shared_ptr<AbstractOperator> GroupJoin::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  auto copied_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  copied_aggregates.reserve(_aggregates.size());
+  for (const auto& aggregate : _aggregates) {
+    copied_aggregates.emplace_back(std::static_pointer_cast<AggregateExpression>(aggregate->deep_copy()));
+  }
+
+  return std::make_shared<GroupJoin>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                     copied_aggregates, _groupby_column_id);
+}
+
+std::shared_ptr<const Table> GroupJoin::_on_execute() {
+  const auto& left_column_type = left_input_table()->column_data_type(_primary_predicate.column_ids.first);
+  Assert(supports({_mode, _primary_predicate.predicate_condition, left_column_type,
+                   right_input_table()->column_data_type(_primary_predicate.column_ids.second), false}),
+         "GroupJoin doesn't support these parameters");
+
+  const auto left_column_count = left_input_table()->column_count();
+  Assert(_groupby_column_id == _primary_predicate.column_ids.first ||
+             (_mode == JoinMode::Inner && _groupby_column_id == left_column_count + _primary_predicate.column_ids.second),
+         "GroupJoin has to group by the join key");
+  for (const auto& aggregate : _aggregates) {
+    Assert(supports_aggregate(*aggregate, left_column_count),
+           "GroupJoin does not support aggregate " + aggregate->as_column_name());
+  }
+
+  resolve_data_type(left_column_type, [&](const auto type) {
+    using KeyType = typename decltype(type)::type;
+    _impl = std::make_unique<GroupJoinImpl<KeyType>>(*this);
+  });
+
+  return _impl->_on_execute();
+}
+
+void GroupJoin::_on_cleanup() { _impl.reset(); }
+
+template <typename KeyType>
+class GroupJoin::GroupJoinImpl : public AbstractReadOnlyOperatorImpl {
+ public:
+  explicit GroupJoinImpl(const GroupJoin& group_join) : _group_join(group_join) {}
+
+  std::shared_ptr<const Table> _on_execute() override {
+    auto& step_performance_data = static_cast<OperatorPerformanceData<OperatorSteps>&>(*_group_join.performance_data);
+    const auto& left_table = *_group_join.left_input_table();
+    const auto& right_table = *_group_join.right_input_table();
+    const auto left_column_id = _group_join._primary_predicate.column_ids.first;
+    const auto right_column_id = _group_join._primary_predicate.column_ids.second;
+    const auto left_column_count = left_table.column_count();
+
+    Timer timer;
+    const auto build_task_count = task_count_for(left_table);
+    if (build_task_count > 1) {
+      _build_in_parallel(left_table, left_column_id, build_task_count);
+    } else {
+      _build(left_table, left_column_id);
+    }
+    _assign_group_ids();
+
+    const auto group_count = _keys.size();
+    auto aggregates = _make_aggregates(left_table, right_table, group_count, true);
+    _aggregate_left_columns(left_table, aggregates);
+    step_performance_data.set_step_runtime(OperatorSteps::Building, timer.lap());
+
+    // Probe the groups with the right input and aggregate the values of the matching rows. Each task aggregates a range
+    // of chunks. The first task writes into the final aggregates, the others into their own ones, which are merged
+    // afterwards.
+    const auto probe_task_count = task_count_for(right_table);
+    const auto right_chunk_count = right_table.chunk_count();
+    auto match_counts = std::vector<int64_t>(group_count);
+    auto match_counts_per_task = std::vector<std::vector<int64_t>>(probe_task_count);
+    auto aggregates_per_task = std::vector<std::vector<std::unique_ptr<BaseGroupJoinAggregate>>>(probe_task_count);
+
+    execute_tasks(probe_task_count, [&](const size_t task_id) {
+      auto* task_match_counts = &match_counts;
+      auto* task_aggregates = &aggregates;
+      if (task_id > 0) {
+        match_counts_per_task[task_id].resize(group_count);
+        aggregates_per_task[task_id] = _make_aggregates(left_table, right_table, group_count, false);
+        task_match_counts = &match_counts_per_task[task_id];
+        task_aggregates = &aggregates_per_task[task_id];
+      }
+
+      const auto [begin_chunk_id, end_chunk_id] = task_chunk_range(right_chunk_count, task_id, probe_task_count);
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = right_table.get_chunk(chunk_id);
+        if (!chunk) continue;
+        _probe_chunk(*chunk, right_column_id, left_column_count, *task_match_counts, *task_aggregates);
+      }
+    });
+
+    if (probe_task_count > 1) {
+      // Each task merges a range of groups
+      execute_tasks(probe_task_count, [&](const size_t task_id) {
+        const auto begin_group_id = group_count * task_id / probe_task_count;
+        const auto end_group_id = group_count * (task_id + 1) / probe_task_count;
+
+        for (auto other_task_id = size_t{1}; other_task_id < probe_task_count; ++other_task_id) {
+          const auto& other_match_counts = match_counts_per_task[other_task_id];
+          for (auto group_id = begin_group_id; group_id < end_group_id; ++group_id) {
+            match_counts[group_id] += other_match_counts[group_id];
+          }
+
+          const auto& other_aggregates = aggregates_per_task[other_task_id];
+          for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+            if (!other_aggregates[aggregate_idx]) continue;
+            aggregates[aggregate_idx]->merge(*other_aggregates[aggregate_idx], begin_group_id, end_group_id);
+          }
+        }
+      });
+    }
+    step_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+
+    // Inner joins only output groups with join partners, left outer joins output all groups
+    auto output_group_ids = std::vector<size_t>{};
+    output_group_ids.reserve(group_count);
+    for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+      if (_group_join._mode == JoinMode::Left || match_counts[group_id] > 0) output_group_ids.emplace_back(group_id);
+    }
+
+    // Write the group-by column, followed by the aggregates
+    const auto groupby_from_left_input = _group_join._groupby_column_id < left_column_count;
+    const auto& groupby_table = groupby_from_left_input ? left_table : right_table;
+    const auto groupby_input_column_id =
+        groupby_from_left_input ? _group_join._groupby_column_id
+                                : static_cast<ColumnID>(_group_join._groupby_column_id - left_column_count);
+    const auto groupby_is_nullable = groupby_table.column_is_nullable(groupby_input_column_id);
+
+    auto output_column_definitions = TableColumnDefinitions{{groupby_table.column_name(groupby_input_column_id),
+                                                             data_type_from_type<KeyType>(), groupby_is_nullable}};
+    auto output_segments = Segments{};
+
+    auto key_values = pmr_vector<KeyType>{};
+    auto key_null_values = pmr_vector<bool>{};
+    key_values.reserve(output_group_ids.size());
+    key_null_values.reserve(output_group_ids.size());
+    for (const auto group_id : output_group_ids) {
+      key_values.emplace_back(_keys[group_id]);
+      key_null_values.emplace_back(_null_group_id == group_id);
+    }
+    if (groupby_is_nullable) {
+      output_segments.emplace_back(
+          std::make_shared<ValueSegment<KeyType>>(std::move(key_values), std::move(key_null_values)));
+    } else {
+      DebugAssert(!_null_group_id, "Unexpected NULL group");
+      output_segments.emplace_back(std::make_shared<ValueSegment<KeyType>>(std::move(key_values)));
+    }
+
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+      const auto& aggregate = _group_join._aggregates[aggregate_idx];
+      const auto is_nullable = aggregate->aggregate_function != AggregateFunction::Count;
+      output_column_definitions.emplace_back(aggregate->as_column_name(), aggregate->data_type(), is_nullable);
+      output_segments.emplace_back(aggregates[aggregate_idx]->write_output(output_group_ids, _left_row_counts));
+    }
+
+    auto output = std::make_shared<Table>(output_column_definitions, TableType::Data);
+    if (!output_group_ids.empty()) {
+      output->append_chunk(output_segments);
+    }
+    step_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+    return output;
+  }
+
+ protected:
+  // The groups of the keys that hash into the same partition. Their ids are local to the partition until
+  // _assign_group_ids() moves them into the per-group vectors of the GroupJoinImpl.
+  struct Partition {
+    std::unordered_map<KeyType, size_t> group_ids_by_key;
+    std::vector<KeyType> keys;
+    std::vector<int64_t> left_row_counts;
+    std::vector<RowID> first_row_ids;
+  };
+
+  // The left rows with a NULL key, which form a group of their own in left outer joins
+  struct NullRows {
+    RowID first_row_id{NULL_ROW_ID};
+    int64_t row_count{0};
+  };
+
+  // Builds the groups from the join column of the left input in a single partition
+  void _build(const Table& left_table, const ColumnID left_column_id) {
+    _partitions.resize(1);
+    auto& partition = _partitions.front();
+
+    const auto left_chunk_count = left_table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < left_chunk_count; ++chunk_id) {
+      const auto chunk = left_table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<KeyType>(*chunk->get_segment(left_column_id), [&](const auto& position) {
+        const auto row_id = RowID{chunk_id, position.chunk_offset()};
+        if (position.is_null()) {
+          _add_null_row(_null_rows, row_id);
+        } else {
+          _add_row(partition, position.value(), row_id);
+        }
+      });
+    }
+  }
+
+  // Builds the groups in multiple tasks. First, each task radix-partitions the keys of a range of chunks. Then, each
+  // partition is grouped by a separate task. As the partitions are filled in the order of the chunks, the first row of
+  // each group is the same as in the single-threaded build.
+  void _build_in_parallel(const Table& left_table, const ColumnID left_column_id, const size_t task_count) {
+    const auto radix_bits = static_cast<size_t>(std::ceil(std::log2(task_count)));
+    const auto partition_count = size_t{1} << radix_bits;
+    _partitions.resize(partition_count);
+
+    using PartitionedRows = std::vector<std::vector<std::pair<KeyType, RowID>>>;
+    auto rows_per_task = std::vector<PartitionedRows>(task_count, PartitionedRows(partition_count));
+    auto null_rows_per_task = std::vector<NullRows>(task_count);
+
+    const auto left_chunk_count = left_table.chunk_count();
+    execute_tasks(task_count, [&](const size_t task_id) {
+      auto& rows = rows_per_task[task_id];
+      auto& null_rows = null_rows_per_task[task_id];
+
+      const auto [begin_chunk_id, end_chunk_id] = task_chunk_range(left_chunk_count, task_id, task_count);
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = left_table.get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        segment_iterate<KeyType>(*chunk->get_segment(left_column_id), [&](const auto& position) {
+          const auto row_id = RowID{chunk_id, position.chunk_offset()};
+          if (position.is_null()) {
+            _add_null_row(null_rows, row_id);
+          } else {
+            rows[_partition_id(position.value())].emplace_back(position.value(), row_id);
+          }
+        });
+      }
+    });
+
+    execute_tasks(partition_count, [&](const size_t partition_id) {
+      auto& partition = _partitions[partition_id];
+      for (auto& rows : rows_per_task) {
+        for (const auto& [key, row_id] : rows[partition_id]) {
+          _add_row(partition, key, row_id);
+        }
+        rows[partition_id] = std::vector<std::pair<KeyType, RowID>>{};
+      }
+    });
+
+    for (const auto& null_rows : null_rows_per_task) {
+      if (_null_rows.first_row_id.is_null()) _null_rows.first_row_id = null_rows.first_row_id;
+      _null_rows.row_count += null_rows.row_count;
+    }
+  }
+
+  void _add_row(Partition& partition, const KeyType& key, const RowID& row_id) {
+    const auto [group_it, inserted] = partition.group_ids_by_key.try_emplace(key, partition.keys.size());
+    if (inserted) {
+      partition.keys.emplace_back(key);
+      partition.left_row_counts.emplace_back(0);
+      partition.first_row_ids.emplace_back(row_id);
+    }
+    ++partition.left_row_counts[group_it->second];
+  }
+
+  void _add_null_row(NullRows& null_rows, const RowID& row_id) const {
+    if (_group_join._mode != JoinMode::Left) return;
+    if (null_rows.first_row_id.is_null()) null_rows.first_row_id = row_id;
+    ++null_rows.row_count;
+  }
+
+  // Numbers the groups of all partitions consecutively. In left outer joins, the rows with a NULL key form an
+  // additional, last group.
+  void _assign_group_ids() {
+    const auto partition_count = _partitions.size();
+    _group_id_offsets.resize(partition_count);
+    auto group_count = size_t{0};
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      _group_id_offsets[partition_id] = group_count;
+      group_count += _partitions[partition_id].keys.size();
+    }
+
+    _keys.resize(group_count);
+    _left_row_counts.resize(group_count);
+    _first_row_ids.resize(group_count);
+    execute_tasks(partition_count, [&](const size_t partition_id) {
+      auto& partition = _partitions[partition_id];
+      const auto offset = static_cast<std::ptrdiff_t>(_group_id_offsets[partition_id]);
+      std::move(partition.keys.begin(), partition.keys.end(), _keys.begin() + offset);
+      std::copy(partition.left_row_counts.begin(), partition.left_row_counts.end(), _left_row_counts.begin() + offset);
+      std::copy(partition.first_row_ids.begin(), partition.first_row_ids.end(), _first_row_ids.begin() + offset);
+      partition.keys = std::vector<KeyType>{};
+      partition.left_row_counts = std::vector<int64_t>{};
+      partition.first_row_ids = std::vector<RowID>{};
+    });
+
+    if (_null_rows.row_count > 0) {
+      _null_group_id = _keys.size();
+      _keys.emplace_back();
+      _left_row_counts.emplace_back(_null_rows.row_count);
+      _first_row_ids.emplace_back(_null_rows.first_row_id);
+    }
+  }
+
+  // The partitions are taken from the lower bits of the hash. The number of partitions is a power of two.
+  size_t _partition_id(const KeyType& key) const { return std::hash<KeyType>{}(key) & (_partitions.size() - 1); }
+
+  size_t _find_group(const KeyType& key) const {
+    const auto partition_id = _partition_id(key);
+    const auto& group_ids_by_key = _partitions[partition_id].group_ids_by_key;
+    const auto group_it = group_ids_by_key.find(key);
+    if (group_it == group_ids_by_key.end()) return INVALID_GROUP_ID;
+    return _group_id_offsets[partition_id] + group_it->second;
+  }
+
+  // Creates the aggregates. Unless with_left_columns is set, the aggregates on left columns (i.e., ANY) are nullptr.
+  std::vector<std::unique_ptr<BaseGroupJoinAggregate>> _make_aggregates(const Table& left_table,
+                                                                        const Table& right_table,
+                                                                        const size_t group_count,
+                                                                        const bool with_left_columns) const {
+    const auto left_column_count = left_table.column_count();
+
+    auto aggregates = std::vector<std::unique_ptr<BaseGroupJoinAggregate>>{};
+    aggregates.reserve(_group_join._aggregates.size());
+    for (const auto& aggregate : _group_join._aggregates) {
+      const auto column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+      if (column_id == INVALID_COLUMN_ID) {
+        aggregates.emplace_back(std::make_unique<GroupJoinCountStar>(group_count));
+      } else if (column_id < left_column_count) {
+        aggregates.emplace_back(with_left_columns ? make_group_join_aggregate(aggregate->aggregate_function,
+                                                                              left_table.column_data_type(column_id),
+                                                                              group_count)
+                                                  : nullptr);
+      } else {
+        aggregates.emplace_back(make_group_join_aggregate(
+            aggregate->aggregate_function,
+            right_table.column_data_type(static_cast<ColumnID>(column_id - left_column_count)), group_count));
+      }
+    }
+    return aggregates;
+  }
+
+  // Looks up the groups of the rows of a right chunk and aggregates their values
+  void _probe_chunk(const Chunk& chunk, const ColumnID right_column_id, const ColumnCount left_column_count,
+                    std::vector<int64_t>& match_counts,
+                    const std::vector<std::unique_ptr<BaseGroupJoinAggregate>>& aggregates) const {
+    auto group_ids = GroupIDs(chunk.size(), INVALID_GROUP_ID);
+    auto chunk_has_matches = false;
+    segment_iterate<KeyType>(*chunk.get_segment(right_column_id), [&](const auto& position) {
+      if (position.is_null()) return;
+      const auto group_id = _find_group(position.value());
+      if (group_id == INVALID_GROUP_ID) return;
+
+      group_ids[position.chunk_offset()] = group_id;
+      ++match_counts[group_id];
+      chunk_has_matches = true;
+    });
+    if (!chunk_has_matches) return;
+
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+      const auto column_id =
+          static_cast<const PQPColumnExpression&>(*_group_join._aggregates[aggregate_idx]->argument()).column_id;
+      if (column_id == INVALID_COLUMN_ID) {
+        aggregates[aggregate_idx]->aggregate(*chunk.get_segment(right_column_id), group_ids);
+      } else if (column_id >= left_column_count) {
+        aggregates[aggregate_idx]->aggregate(*chunk.get_segment(static_cast<ColumnID>(column_id - left_column_count)),
+                                             group_ids);
+      }
+    }
+  }
+
+  // Calculates the aggregates on left columns (i.e., ANY) from the first row of each group. As each group has its
+  // first row in a single chunk, the chunks are aggregated concurrently.
+  void _aggregate_left_columns(const Table& left_table,
+                               const std::vector<std::unique_ptr<BaseGroupJoinAggregate>>& aggregates) {
+    const auto left_column_count = left_table.column_count();
+
+    auto first_row_group_ids_by_chunk = std::vector<GroupIDs>(left_table.chunk_count());
+    for (auto group_id = size_t{0}; group_id < _first_row_ids.size(); ++group_id) {
+      const auto& row_id = _first_row_ids[group_id];
+      auto& group_ids = first_row_group_ids_by_chunk[row_id.chunk_id];
+      if (group_ids.empty()) {
+        group_ids.resize(left_table.get_chunk(row_id.chunk_id)->size(), INVALID_GROUP_ID);
+      }
+      group_ids[row_id.chunk_offset] = group_id;
+    }
+
+    const auto left_chunk_count = left_table.chunk_count();
+    const auto task_count = task_count_for(left_table);
+    execute_tasks(task_count, [&](const size_t task_id) {
+      const auto [begin_chunk_id, end_chunk_id] = task_chunk_range(left_chunk_count, task_id, task_count);
+      for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+        const auto column_id =
+            static_cast<const PQPColumnExpression&>(*_group_join._aggregates[aggregate_idx]->argument()).column_id;
+        if (column_id == INVALID_COLUMN_ID || column_id >= left_column_count) continue;
+
+        for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+          const auto& group_ids = first_row_group_ids_by_chunk[chunk_id];
+          if (group_ids.empty()) continue;
+          aggregates[aggregate_idx]->aggregate(*left_table.get_chunk(chunk_id)->get_segment(column_id), group_ids);
+        }
+      }
+    });
+  }
+
+  const GroupJoin& _group_join;
+
+  std::vector<Partition> _partitions;
+  std::vector<size_t> _group_id_offsets;
+  NullRows _null_rows;
+  std::optional<size_t> _null_group_id;
+
+  // Per group
+  std::vector<KeyType> _keys;
+  std::vector<int64_t> _left_row_counts;
+  std::vector<RowID> _first_row_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Fuses an equi join with an aggregation that groups by the join key. JoinHash followed by AggregateHash writes the
+ * join result as pos lists, only to hash it again by the same key. Instead, the GroupJoin builds a hash table of the
+ * groups from the left input and, while probing it with the right input, directly updates the aggregates of the
+ * matching group. The join result is never materialized.
+ *
+ * The aggregates address the columns of the join result, i.e., the columns of the left input followed by those of the
+ * right input. This way, the GroupJoin replaces a JoinNode below an AggregateNode without changing the aggregates (see
+ * LQPTranslator). Supported are COUNT(*) as well as COUNT, SUM, AVG, MIN, and MAX on columns of the right input and
+ * ANY on columns of the left input (as added by the DependentGroupByReductionRule). The group-by column is the left
+ * join column or, for inner joins, the right join column, which holds the same values.
+ *
+ * If multiple left rows share a key, each of them is joined with every matching right row. Thus, COUNT and SUM are
+ * multiplied by the number of left rows of the group, while AVG, MIN, and MAX are not affected.
+ *
+ * With a multi-threaded scheduler, both inputs are processed in tasks of at least JOB_SPAWN_THRESHOLD rows each. The
+ * tasks of the build radix-partition the keys of the left input, and each partition is grouped by a separate task.
+ * The tasks of the probe aggregate the right rows into task-local aggregates, which are merged afterwards.
+ */
+class GroupJoin : public AbstractJoinOperator {
+ public:
+  static constexpr auto JOB_SPAWN_THRESHOLD = size_t{10'000};
+
+  static bool supports(const JoinConfiguration config);
+
+  // Returns true if the GroupJoin can calculate the aggregate, which has to be translated against the join result.
+  static bool supports_aggregate(const AggregateExpression& aggregate, const ColumnCount left_column_count);
+
+  GroupJoin(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
+            const std::vector<std::shared_ptr<AggregateExpression>>& aggregates, const ColumnID groupby_column_id);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<std::shared_ptr<AggregateExpression>>& aggregates() const;
+
+  // The column id of the group-by column in the join result
+  ColumnID groupby_column_id() const;
+
+  enum class OperatorSteps : uint8_t { Building, Probing, OutputWriting };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_cleanup() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  template <typename KeyType>
+  class GroupJoinImpl;
+  template <typename KeyType>
+  friend class GroupJoinImpl;
+
+  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
+
+  const std::vector<std::shared_ptr<AggregateExpression>> _aggregates;
+  const ColumnID _groupby_column_id;
+};
+
+}  // namespace opossum
@@ -1,8 +1,11 @@
 #include "import.hpp"
 
+#include <fstream>
+
 #include <boost/algorithm/string.hpp>
 
 #include "hyrise.hpp"
+#include "import_export/arrow/arrow_parser.hpp"
 #include "import_export/binary/binary_parser.hpp"
 #include "import_export/csv/csv_parser.hpp"
 #include "utils/assert.hpp"
@@ -11,16 +14,22 @@
 namespace opossum {
 
 Import::Import(const std::string& init_filename, const std::string& tablename, const ChunkOffset chunk_size,
-               const FileType file_type, const std::optional<CsvMeta>& csv_meta)
+               const FileType file_type, const std::optional<CsvMeta>& csv_meta,
+               const std::vector<std::string>& column_names, const std::vector<size_t>& row_groups)
     : AbstractReadOnlyOperator(OperatorType::Import),
       filename(init_filename),
       _tablename(tablename),
       _chunk_size(chunk_size),
       _file_type(file_type),
-      _csv_meta(csv_meta) {
+      _csv_meta(csv_meta),
+      _column_names(column_names),
+      _row_groups(row_groups) {
   if (_file_type == FileType::Auto) {
     _file_type = file_type_from_filename(filename);
   }
+  Assert((_column_names.empty() && _row_groups.empty()) || _file_type == FileType::Parquet ||
+             _file_type == FileType::Arrow,
+         "Only Parquet and Arrow imports can be restricted to columns and row groups");
 }
 
 const std::string& Import::name() const {
@@ -46,6 +55,10 @@ std::shared_ptr<const Table> Import::_on_execute() {
     case FileType::Binary:
       table = BinaryParser::parse(filename);
       break;
+    case FileType::Parquet:
+    case FileType::Arrow:
+      table = ArrowParser::parse(filename, _file_type, _chunk_size, _column_names, _row_groups);
+      break;
     case FileType::Auto:
       Fail("File type should have been determined previously.");
   }
@@ -63,7 +76,8 @@ std::shared_ptr<const Table> Import::_on_execute() {
 std::shared_ptr<AbstractOperator> Import::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<Import>(filename, _tablename, _chunk_size, _file_type, _csv_meta);
+  return std::make_shared<Import>(filename, _tablename, _chunk_size, _file_type, _csv_meta, _column_names,
+                                  _row_groups);
 }
 
 void Import::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "import_export/csv/csv_meta.hpp"
@@ -14,9 +15,11 @@ namespace opossum {
 
 /*
  * This operator reads a file, creates a table from that input and adds it to the storage manager.
- * Supported file types are .tbl, .csv and Opossum .bin files.
+ * Supported file types are .tbl, .csv, Opossum .bin, and (if built with Arrow support) .parquet and .arrow files.
  * For .csv files, a CSV config is additionally required, which is commonly located in the <filename>.json file.
  * Documentation of the file formats can be found in BinaryWriter and CsvWriter header files.
+ * For Parquet and Arrow files, the columns and row groups to read can be restricted, so that the remaining ones are
+ * not decoded at all.
  */
 class Import : public AbstractReadOnlyOperator {
  public:
@@ -26,10 +29,13 @@ class Import : public AbstractReadOnlyOperator {
    * @param chunk_size     Optional. Chunk size. Does not effect binary import.
    * @param file_type      Optional. Type indicating the file format. If not present, it is guessed by the filename.
    * @param csv_meta       Optional. A specific meta config, used instead of filename + '.json'
+   * @param column_names   Optional. Parquet and Arrow only. Columns to import. If empty, all columns are imported.
+   * @param row_groups     Optional. Parquet and Arrow only. Row groups to import. If empty, all are imported.
    */
   explicit Import(const std::string& init_filename, const std::string& tablename,
                   const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE, const FileType file_type = FileType::Auto,
-                  const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                  const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                  const std::vector<std::string>& column_names = {}, const std::vector<size_t>& row_groups = {});
 
   const std::string& name() const final;
   const std::string filename;
@@ -48,6 +54,8 @@ class Import : public AbstractReadOnlyOperator {
   const ChunkOffset _chunk_size;
   FileType _file_type;
   const std::optional<CsvMeta> _csv_meta;
+  const std::vector<std::string> _column_names;
+  const std::vector<size_t> _row_groups;
 };
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <tuple>
 
 #include "expression/between_expression.hpp"
 
@@ -9,7 +10,9 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "get_table.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table/table_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -38,6 +41,11 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (use_table_index) {
+    _scan_table_index();
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -67,8 +75,11 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<IndexScan>(copied_left_input, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_left_input, _index_type, _left_column_ids, _predicate_condition,
+                                                _right_values, _right_values2);
+  copy->included_chunk_ids = included_chunk_ids;
+  copy->use_table_index = use_table_index;
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -110,6 +121,51 @@ void IndexScan::_validate_input() {
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
+void IndexScan::_scan_table_index() {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  Assert(get_table, "IndexScan using a TableIndex must follow a GetTable.");
+  Assert(_left_column_ids.size() == 1, "TableIndexes only index single columns.");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto table_index = stored_table->get_table_index(get_table->stored_column_id(_left_column_ids[0]));
+  Assert(table_index, "TableIndex not found for column.");
+
+  const auto right_value2 =
+      _right_values2.empty() ? std::nullopt : std::optional<AllTypeVariant>{_right_values2[0]};
+  auto matches = RowIDPosList{};
+  table_index->lookup(_predicate_condition, _right_values[0], right_value2, matches);
+
+  // The index refers to the chunks of the stored table. Translate them to the chunks of the input table and drop the
+  // matches in chunks that GetTable excluded, e.g., because they were pruned or deleted.
+  auto matches_end = matches.begin();
+  for (const auto& row_id : matches) {
+    const auto chunk_id = get_table->output_chunk_id(row_id.chunk_id);
+    if (chunk_id == INVALID_CHUNK_ID) continue;
+    *matches_end = RowID{chunk_id, row_id.chunk_offset};
+    ++matches_end;
+  }
+  matches.erase(matches_end, matches.end());
+  std::sort(matches.begin(), matches.end());
+
+  // Write one output chunk per input chunk, so that each pos list references a single chunk
+  for (auto chunk_begin = matches.cbegin(); chunk_begin != matches.cend();) {
+    const auto chunk_id = chunk_begin->chunk_id;
+    const auto chunk_end = std::find_if(chunk_begin, matches.cend(),
+                                        [chunk_id](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto pos_list = std::make_shared<RowIDPosList>(chunk_begin, chunk_end);
+    pos_list->guarantee_single_chunk();
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < _in_table->column_count(); ++column_id) {
+      segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, pos_list));
+    }
+    _out_table->append_chunk(segments, nullptr, _in_table->get_chunk(chunk_id)->get_allocator());
+
+    chunk_begin = chunk_end;
+  }
+}
+
 RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
@@ -121,23 +177,25 @@ RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
   Assert(index, "Index of specified type not found for segment (vector).");
+  Assert(index->supports_range_queries() || _predicate_condition == PredicateCondition::Equals ||
+             _predicate_condition == PredicateCondition::NotEquals,
+         "Predicate condition not supported by index type.");
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
+      std::tie(range_begin, range_end) = index->equal_range(_right_values);
       break;
     }
     case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
+      // The index groups the positions by value, so that all other values are before or after the search value
+      const auto [equal_begin, equal_end] = index->equal_range(_right_values);
       range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      range_end = equal_begin;
 
       matches_out.reserve(std::distance(range_begin, range_end));
       std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
 
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
+      range_begin = equal_end;
       range_end = index->cend();
       break;
     }
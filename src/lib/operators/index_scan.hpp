@@ -30,6 +30,10 @@ class IndexScan : public AbstractReadOnlyOperator {
   // If set, only the specified chunks will be scanned. See TableScan::excluded_chunk_ids for usage.
   std::vector<ChunkID> included_chunk_ids;
 
+  // If set, the TableIndex of the stored table is used instead of the chunk indexes, so that all chunks are scanned
+  // with a single lookup. The input must be a GetTable, and the index type and included_chunk_ids are ignored.
+  bool use_table_index{false};
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -41,6 +45,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job(const ChunkID chunk_id, std::mutex& output_mutex);
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index();
 
  private:
   const SegmentIndexType _index_type;
@@ -2,14 +2,20 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/table/table_index.hpp"
+#include "storage/row_group_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table_partitioning.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -17,6 +23,31 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
+// The values of a RowGroupSegment are not contiguous and are written one by one
+template <typename T>
+void copy_value_range_to_row_group_segment(const AbstractSegment& source_abstract_segment,
+                                           ChunkOffset source_begin_offset, RowGroupSegment<T>& target_segment,
+                                           ChunkOffset target_begin_offset, ChunkOffset length) {
+  auto null_values = NullBitmap(length);
+  auto has_null_values = false;
+
+  segment_with_iterators<T>(source_abstract_segment, [&](const auto source_begin, const auto source_end) {
+    auto source_iter = source_begin + source_begin_offset;
+    for (auto index = ChunkOffset{0}; index < length; ++index, ++source_iter) {
+      if (source_iter->is_null()) {
+        null_values[index] = true;
+        has_null_values = true;
+      } else {
+        target_segment.set_value(target_begin_offset + index, source_iter->value());
+      }
+    }
+  });
+
+  if (has_null_values) {
+    target_segment.set_null_values(target_begin_offset, null_values, ChunkOffset{0}, length);
+  }
+}
+
 template <typename T>
 void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstract_segment,
                       ChunkOffset source_begin_offset, const std::shared_ptr<AbstractSegment>& target_abstract_segment,
@@ -24,6 +55,12 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
   DebugAssert(source_abstract_segment->size() >= source_begin_offset + length, "Source Segment out-of-bounds");
   DebugAssert(target_abstract_segment->size() >= target_begin_offset + length, "Target Segment out-of-bounds");
 
+  if (const auto target_row_group_segment = std::dynamic_pointer_cast<RowGroupSegment<T>>(target_abstract_segment)) {
+    copy_value_range_to_row_group_segment(*source_abstract_segment, source_begin_offset, *target_row_group_segment,
+                                          target_begin_offset, length);
+    return;
+  }
+
   const auto target_value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(target_abstract_segment);
   Assert(target_value_segment, "Cannot insert into non-ValueSegments");
 
@@ -38,34 +75,114 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
                 target_values.begin() + target_begin_offset);
 
     if (source_value_segment->is_nullable()) {
-      const auto nulls_begin_iter = source_value_segment->null_values().begin() + source_begin_offset;
-      const auto nulls_end_iter = nulls_begin_iter + length;
-
-      auto nulls_target_offset = target_begin_offset;
-      for (auto nulls_iter = nulls_begin_iter; nulls_iter != nulls_end_iter; ++nulls_iter) {
-        if (*nulls_iter) target_value_segment->set_null_value(nulls_target_offset);
-        ++nulls_target_offset;
-      }
+      target_value_segment->set_null_values(target_begin_offset, source_value_segment->null_values(),
+                                            source_begin_offset, length);
     }
   } else {
+    auto null_values = NullBitmap(length);
+    auto has_null_values = false;
+
     segment_with_iterators<T>(*source_abstract_segment, [&](const auto source_begin, const auto source_end) {
       auto source_iter = source_begin + source_begin_offset;
       auto target_iter = target_values.begin() + target_begin_offset;
 
-      // Copy values and null values
+      // Copy values and collect null values, which are set with a single lock acquisition
       for (auto index = ChunkOffset(0); index < length; index++) {
         *target_iter = source_iter->value();
 
         if (source_iter->is_null()) {
-          // ValueSegments not being NULLable will be handled over there
-          target_value_segment->set_null_value(target_begin_offset + index);
+          null_values[index] = true;
+          has_null_values = true;
         }
 
         ++source_iter;
         ++target_iter;
       }
     });
+
+    // ValueSegments not being NULLable will be handled over there
+    if (has_null_values) {
+      target_value_segment->set_null_values(target_begin_offset, null_values, ChunkOffset{0}, length);
+    }
+  }
+
+  target_value_segment->account_for_values(target_begin_offset, length);
+}
+
+using SourceTables = std::vector<std::pair<std::optional<PartitionID>, std::shared_ptr<const Table>>>;
+
+// Splits the rows to insert by the partition of the target table that they belong to. The rows of each partition are
+// materialized in a single chunk of ValueSegments, which is then copied like the input of an unpartitioned table.
+SourceTables split_by_partition(const std::shared_ptr<const Table>& input_table,
+                                const TablePartitioning& partitioning) {
+  const auto partition_count = partitioning.partition_count();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto row_partition_ids = std::vector<PartitionID>{};
+  row_partition_ids.reserve(input_table->row_count());
+  auto partition_row_counts = std::vector<size_t>(partition_count);
+  resolve_data_type(input_table->column_data_type(partitioning.column_id()), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(partitioning.column_id());
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        const auto partition_id = position.is_null() ? partitioning.partition_for(NULL_VALUE)
+                                                     : partitioning.partition_for(AllTypeVariant{position.value()});
+        row_partition_ids.emplace_back(partition_id);
+        ++partition_row_counts[partition_id];
+      });
+    }
+  });
+
+  const auto column_count = input_table->column_count();
+  auto partition_segments = std::vector<Segments>(partition_count, Segments(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto nullable = input_table->column_is_nullable(column_id);
+
+      auto values = std::vector<pmr_vector<ColumnDataType>>(partition_count);
+      auto null_values = std::vector<NullBitmap>(partition_count);
+      for (auto partition_id = PartitionID{0}; partition_id < partition_count; ++partition_id) {
+        values[partition_id].reserve(partition_row_counts[partition_id]);
+        if (nullable) null_values[partition_id].reserve(partition_row_counts[partition_id]);
+      }
+
+      auto row_partition_id_iter = row_partition_ids.cbegin();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          const auto partition_id = *row_partition_id_iter;
+          ++row_partition_id_iter;
+
+          values[partition_id].emplace_back(position.value());
+          if (nullable) null_values[partition_id].push_back(position.is_null());
+        });
+      }
+
+      for (auto partition_id = PartitionID{0}; partition_id < partition_count; ++partition_id) {
+        if (partition_row_counts[partition_id] == 0) continue;
+
+        if (nullable) {
+          partition_segments[partition_id][column_id] = std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(values[partition_id]), std::move(null_values[partition_id]));
+        } else {
+          partition_segments[partition_id][column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values[partition_id]));
+        }
+      }
+    });
   }
+
+  auto source_tables = SourceTables{};
+  for (auto partition_id = PartitionID{0}; partition_id < partition_count; ++partition_id) {
+    if (partition_row_counts[partition_id] == 0) continue;
+
+    auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(partition_segments[partition_id])};
+    source_tables.emplace_back(
+        partition_id, std::make_shared<Table>(input_table->column_definitions(), TableType::Data, std::move(chunks)));
+  }
+  return source_tables;
 }
 
 }  // namespace
@@ -91,6 +208,14 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type");
   }
 
+  // The rows inserted into a partitioned table are appended to the chunks of their partitions
+  auto source_tables = SourceTables{};
+  if (const auto& partitioning = _target_table->partitioning()) {
+    source_tables = split_by_partition(left_input_table(), *partitioning);
+  } else {
+    source_tables.emplace_back(std::nullopt, left_input_table());
+  }
+
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
    *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
@@ -100,138 +225,184 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   {
     const auto append_lock = _target_table->acquire_append_mutex();
 
-    auto remaining_rows = left_input_table()->row_count();
+    for (const auto& [partition_id, source_table] : source_tables) {
+      auto remaining_rows = source_table->row_count();
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
-    while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-      // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->target_chunk_size()) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
-      }
+      while (remaining_rows > 0) {
+        auto target_chunk_id = _target_table->last_chunk_id(partition_id);
+        auto target_chunk = target_chunk_id ? _target_table->get_chunk(*target_chunk_id) : nullptr;
 
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->target_chunk_size() - target_chunk->size(), remaining_rows);
-
-      _target_chunk_ranges.emplace_back(
-          ChunkRange{target_chunk_id, target_chunk->size(),
-                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
-
-      // Mark new (but still empty) rows as being under modification by current transaction.
-      // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
-      // new row count.
-      {
-        const auto& mvcc_data = target_chunk->mvcc_data();
-        DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data");
-        const auto transaction_id = context->transaction_id();
-        const auto end_offset = target_chunk->size() + num_rows_for_target_chunk;
-        for (auto target_chunk_offset = target_chunk->size(); target_chunk_offset < end_offset; ++target_chunk_offset) {
-          DebugAssert(mvcc_data->get_begin_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid begin CID");
-          DebugAssert(mvcc_data->get_end_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid end CID");
-          mvcc_data->set_tid(target_chunk_offset, transaction_id, std::memory_order_relaxed);
+        // If the last Chunk of the target Table (or partition) is either immutable or full, append a new mutable Chunk.
+        // Chunks allocated before the target chunk size was changed might be full before or after reaching it.
+        if (!target_chunk || !target_chunk->is_mutable() ||
+            target_chunk->size() >= _target_table->mutable_chunk_capacity(*target_chunk)) {
+          _target_table->append_mutable_chunk(partition_id);
+          target_chunk_id = _target_table->last_chunk_id(partition_id);
+          target_chunk = _target_table->get_chunk(*target_chunk_id);
         }
-      }
-
-      // Make sure the MVCC data is written before the first segment (and thus the chunk) is resized
-      std::atomic_thread_fence(std::memory_order_seq_cst);
-
-      // Grow data Segments.
-      // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
-      // resize that makes the new row count visible to the outside world.
-      auto old_size = target_chunk->size();
-      for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
-        const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-
-          const auto value_segment =
-              std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
-          Assert(value_segment, "Cannot insert into non-ValueSegments");
+        const auto num_rows_for_target_chunk = std::min<size_t>(
+            _target_table->mutable_chunk_capacity(*target_chunk) - target_chunk->size(), remaining_rows);
+
+        _target_chunk_ranges.emplace_back(
+            ChunkRange{*target_chunk_id, target_chunk->size(),
+                       static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
+
+        // Mark new (but still empty) rows as being under modification by current transaction.
+        // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
+        // new row count.
+        {
+          const auto& mvcc_data = target_chunk->mvcc_data();
+          DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data");
+          const auto begin_offset = target_chunk->size();
+          const auto end_offset = static_cast<ChunkOffset>(begin_offset + num_rows_for_target_chunk);
+          if constexpr (HYRISE_DEBUG) {
+            for (auto target_chunk_offset = begin_offset; target_chunk_offset < end_offset; ++target_chunk_offset) {
+              Assert(mvcc_data->get_begin_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid begin CID");
+              Assert(mvcc_data->get_end_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid end CID");
+            }
+          }
+          mvcc_data->set_tids(begin_offset, end_offset, context->transaction_id(), std::memory_order_relaxed);
+        }
 
-          const auto new_size = old_size + num_rows_for_target_chunk;
+        // Make sure the MVCC data is written before the first segment (and thus the chunk) is resized
+        std::atomic_thread_fence(std::memory_order_seq_cst);
 
-          // Cannot guarantee resize without reallocation. The ValueSegment should have been allocated with the target
-          // table's target chunk size reserved.
-          Assert(value_segment->values().capacity() >= new_size, "ValueSegment too small");
-          value_segment->resize(new_size);
-        });
+        // Grow data Segments.
+        // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
+        // resize that makes the new row count visible to the outside world.
+        auto old_size = target_chunk->size();
+        for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
+          const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
+
+          resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+
+            const auto& target_segment = target_chunk->get_segment(column_id);
+            const auto new_size = old_size + num_rows_for_target_chunk;
+
+            if (const auto row_group_segment =
+                    std::dynamic_pointer_cast<RowGroupSegment<ColumnDataType>>(target_segment)) {
+              Assert(row_group_segment->row_group()->capacity() >= new_size, "RowGroupSegment too small");
+              row_group_segment->resize(new_size);
+              return;
+            }
+
+            const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_segment);
+            Assert(value_segment, "Cannot insert into non-ValueSegments");
+
+            // Cannot guarantee resize without reallocation. The ValueSegment should have been allocated with the
+            // target table's target chunk size reserved.
+            Assert(value_segment->values().capacity() >= new_size, "ValueSegment too small");
+            value_segment->resize(new_size);
+          });
+
+          // Make sure the first column's resize actually happens last and doesn't get reordered.
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
 
-        // Make sure the first column's resize actually happens last and doesn't get reordered.
-        std::atomic_thread_fence(std::memory_order_seq_cst);
+        remaining_rows -= num_rows_for_target_chunk;
       }
-
-      remaining_rows -= num_rows_for_target_chunk;
     }
   }
 
   /**
-   * 2. Insert the Data into the memory allocated in the first step without holding a lock on the Table.
+   * 2. Insert the Data into the memory allocated in the first step without holding a lock on the Table. The chunk
+   *    ranges were allocated for one source table after the other.
    */
-  auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
-
-  for (const auto& target_chunk_range : _target_chunk_ranges) {
-    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
-
-    auto target_chunk_offset = target_chunk_range.begin_chunk_offset;
-    auto target_chunk_range_remaining_rows =
-        target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset;
-
-    while (target_chunk_range_remaining_rows > 0) {
-      const auto source_chunk = left_input_table()->get_chunk(source_row_id.chunk_id);
-      const auto source_chunk_remaining_rows = source_chunk->size() - source_row_id.chunk_offset;
-      const auto num_rows_current_iteration = std::min(source_chunk_remaining_rows, target_chunk_range_remaining_rows);
-
-      // Copy from the source into the target Segments
-      for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
-        const auto source_segment = source_chunk->get_segment(column_id);
-        const auto target_segment = target_chunk->get_segment(column_id);
+  auto target_chunk_range_iter = _target_chunk_ranges.cbegin();
+  for (const auto& [partition_id, source_table] : source_tables) {
+    auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+    auto source_table_remaining_rows = source_table->row_count();
+
+    while (source_table_remaining_rows > 0) {
+      const auto& target_chunk_range = *target_chunk_range_iter;
+      ++target_chunk_range_iter;
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+
+      auto target_chunk_offset = target_chunk_range.begin_chunk_offset;
+      auto target_chunk_range_remaining_rows =
+          target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset;
+      source_table_remaining_rows -= target_chunk_range_remaining_rows;
+
+      while (target_chunk_range_remaining_rows > 0) {
+        const auto source_chunk = source_table->get_chunk(source_row_id.chunk_id);
+        const auto source_chunk_remaining_rows = source_chunk->size() - source_row_id.chunk_offset;
+        const auto num_rows_current_iteration =
+            std::min(source_chunk_remaining_rows, target_chunk_range_remaining_rows);
+
+        // Copy from the source into the target Segments
+        for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
+          const auto source_segment = source_chunk->get_segment(column_id);
+          const auto target_segment = target_chunk->get_segment(column_id);
+
+          resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+            copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
+                                             target_chunk_offset, num_rows_current_iteration);
+          });
+        }
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-          copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
-                                           target_chunk_offset, num_rows_current_iteration);
-        });
-      }
+        if (num_rows_current_iteration == source_chunk_remaining_rows) {
+          // Proceed to next source Chunk
+          ++source_row_id.chunk_id;
+          source_row_id.chunk_offset = 0;
+        } else {
+          source_row_id.chunk_offset += num_rows_current_iteration;
+        }
 
-      if (num_rows_current_iteration == source_chunk_remaining_rows) {
-        // Proceed to next source Chunk
-        ++source_row_id.chunk_id;
-        source_row_id.chunk_offset = 0;
-      } else {
-        source_row_id.chunk_offset += num_rows_current_iteration;
+        target_chunk_offset += num_rows_current_iteration;
+        target_chunk_range_remaining_rows -= num_rows_current_iteration;
       }
+    }
+  }
 
-      target_chunk_offset += num_rows_current_iteration;
-      target_chunk_range_remaining_rows -= num_rows_current_iteration;
+  /**
+   * 3. Add the new rows to the TableIndexes of the target Table. This is done before the commit, the entries only
+   *    become visible through the MVCC data of their rows (see TableIndex).
+   */
+  for (const auto& table_index : _target_table->table_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_index->insert(target_chunk_range.chunk_id, *target_chunk->get_segment(table_index->column_id()),
+                          target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
     }
   }
 
+  /**
+   * 4. Add the partials of the new rows to the materialized views on the target Table (see MaterializedView).
+   */
+  for (const auto& materialized_view : Hyrise::get().storage_manager.materialized_views_on_table(_target_table)) {
+    const auto success = materialized_view->maintain_inserted_rows(left_input_table(), context);
+    Assert(success, "Inserts into the partials of a materialized view cannot fail");
+  }
+
   return nullptr;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
+  transaction_context()->register_modified_table(_target_table);
+
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
 
-    for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
-         ++chunk_offset) {
-      mvcc_data->set_begin_cid(chunk_offset, cid);
-      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
-    }
+    mvcc_data->set_begin_cids(target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset, cid);
+    mvcc_data->set_tids(target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset, 0u,
+                        std::memory_order_relaxed);
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
 }
 
+void Insert::_on_write_log_records(std::vector<char>& records) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    WriteAheadLog::write_insert_record(records, _target_table_name, *_target_table, target_chunk_range.chunk_id,
+                                       target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 void Insert::_on_rollback_records() {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
@@ -250,23 +421,19 @@ void Insert::_on_rollback_records() {
      * We need to set `begin_cid = 0` so that the ChunkCompressionTask can identify "completed" Chunks.
      */
 
-    for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
-         ++chunk_offset) {
-      mvcc_data->set_end_cid(chunk_offset, 0u);
+    mvcc_data->set_end_cids(target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset, 0u);
 
-      // Update chunk statistics
-      target_chunk->increase_invalid_row_count(1u);
-    }
+    // Update chunk statistics
+    target_chunk->increase_invalid_row_count(
+        static_cast<ChunkOffset>(target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset));
 
     // This fence guarantees that no other thread will ever observe `begin_cid = 0 && end_cid != 0` for rolled-back
     // records
     std::atomic_thread_fence(std::memory_order_release);
 
-    for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
-         ++chunk_offset) {
-      mvcc_data->set_begin_cid(chunk_offset, 0u);
-      mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
-    }
+    mvcc_data->set_begin_cids(target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset, 0u);
+    mvcc_data->set_tids(target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset, 0u,
+                        std::memory_order_relaxed);
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
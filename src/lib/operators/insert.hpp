@@ -33,6 +33,7 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
+  void _on_write_log_records(std::vector<char>& records) const override;
   void _on_rollback_records() override;
 
  private:
@@ -0,0 +1,43 @@
+#include "intersect.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "operators/set_operation/hash_set_operation.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+Intersect::Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+                     const std::shared_ptr<const AbstractOperator>& right_in,
+                     const SetOperationMode set_operation_mode)
+    : AbstractReadOnlyOperator(OperatorType::Intersect, left_in, right_in), _set_operation_mode(set_operation_mode) {}
+
+const std::string& Intersect::name() const {
+  static const auto name = std::string{"Intersect"};
+  return name;
+}
+
+std::string Intersect::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  std::stringstream stream;
+  stream << name() << separator << "Mode: " << _set_operation_mode;
+  return stream.str();
+}
+
+SetOperationMode Intersect::set_operation_mode() const { return _set_operation_mode; }
+
+std::shared_ptr<AbstractOperator> Intersect::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<Intersect>(copied_left_input, copied_right_input, _set_operation_mode);
+}
+
+void Intersect::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Intersect::_on_execute() {
+  return hash_set_operation(left_input_table(), right_input_table(), SetOperationType::Intersect, _set_operation_mode);
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Computes the rows of the left input that are also contained in the right input (INTERSECT). With
+ * SetOperationMode::Unique, each such row is returned once. SetOperationMode::All has multiset semantics
+ * (INTERSECT ALL). SetOperationMode::Positions keeps every left row that has an equal row in the right input, including
+ * duplicates, and retains the chunks of the left input. See hash_set_operation.hpp for details.
+ */
+class Intersect : public AbstractReadOnlyOperator {
+ public:
+  Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+            const std::shared_ptr<const AbstractOperator>& right_in,
+            const SetOperationMode set_operation_mode = SetOperationMode::Positions);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationMode set_operation_mode() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const SetOperationMode _set_operation_mode;
+};
+}  // namespace opossum
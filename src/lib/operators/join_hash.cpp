@@ -1,8 +1,12 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <climits>
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -10,22 +14,388 @@
 #include <vector>
 
 #include "bytell_hash_map.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "join_hash/join_hash_build_cache.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/spill_file.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
 
 namespace {
 
+using namespace opossum;  // NOLINT
+
 // Depending on which input table became the build/probe table we have to order the columns of the output table.
 // Semi/Anti* Joins only emit tuples from the probe table
 enum class OutputColumnOrder { BuildFirstProbeSecond, ProbeFirstBuildSecond, ProbeOnly };
 
+// Maps the value ids of a dictionary to those of the build side's dictionary. Values that do not occur there are
+// mapped to -1, which never finds a join partner.
+using ValueIDMapping = std::vector<int32_t>;
+
+struct DictionaryEncodedColumn {
+  // The table that stores the values, i.e., the input table itself or the table referenced by it
+  std::shared_ptr<const Table> stored_table;
+  ColumnID stored_column_id{INVALID_COLUMN_ID};
+
+  // The DictionarySegments holding the values of the input, indexed by the chunk ids of stored_table, and how their
+  // value ids are translated (nullptr for segments that use the build side's dictionary)
+  std::vector<std::shared_ptr<const DictionarySegment<pmr_string>>> segments;
+  std::vector<const ValueIDMapping*> mappings;
+};
+
+// Collects the segments that hold the values of the column. Returns std::nullopt if one of them is not a
+// DictionarySegment or if the input references more than one table.
+std::optional<DictionaryEncodedColumn> find_dictionary_segments(const std::shared_ptr<const Table>& table,
+                                                                const ColumnID column_id) {
+  auto column = DictionaryEncodedColumn{};
+  if (table->type() == TableType::Data) {
+    column.stored_table = table;
+    column.stored_column_id = column_id;
+    column.segments.resize(table->chunk_count());
+  }
+
+  const auto add_segment = [&](const ChunkID stored_chunk_id) {
+    if (column.segments[stored_chunk_id]) return true;
+
+    const auto stored_chunk = column.stored_table->get_chunk(stored_chunk_id);
+    if (!stored_chunk) return false;
+    column.segments[stored_chunk_id] = std::dynamic_pointer_cast<const DictionarySegment<pmr_string>>(
+        stored_chunk->get_segment(column.stored_column_id));
+    return column.segments[stored_chunk_id] != nullptr;
+  };
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    // The translated input has to have the same chunks as the original one
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) return std::nullopt;
+
+    if (table->type() == TableType::Data) {
+      if (!add_segment(chunk_id)) return std::nullopt;
+      continue;
+    }
+
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+    if (!column.stored_table) {
+      column.stored_table = reference_segment.referenced_table();
+      column.stored_column_id = reference_segment.referenced_column_id();
+      column.segments.resize(column.stored_table->chunk_count());
+    } else if (reference_segment.referenced_table() != column.stored_table ||
+               reference_segment.referenced_column_id() != column.stored_column_id) {
+      return std::nullopt;
+    }
+
+    const auto& pos_list = *reference_segment.pos_list();
+    if (!pos_list.empty() && pos_list.references_single_chunk()) {
+      if (!add_segment(pos_list.common_chunk_id())) return std::nullopt;
+      continue;
+    }
+    for (const auto& row_id : pos_list) {
+      if (!row_id.is_null() && !add_segment(row_id.chunk_id)) return std::nullopt;
+    }
+  }
+
+  column.mappings.resize(column.segments.size());
+  return column;
+}
+
+// Returns a table with the same chunks as the input whose only column holds the translated value ids of the column
+std::shared_ptr<const Table> materialize_value_ids(const Table& table, const ColumnID column_id,
+                                                   const DictionaryEncodedColumn& column) {
+  const auto chunk_count = table.chunk_count();
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto row_count = chunk->size();
+
+    const auto translate = [&, chunk_id, chunk, row_count]() {
+      auto values = pmr_vector<int32_t>(row_count);
+      auto null_values = pmr_vector<bool>(row_count);
+
+      const auto translate_value_id = [&](const ChunkOffset chunk_offset, const ChunkID stored_chunk_id,
+                                          const ValueID::base_type value_id) {
+        if (value_id == column.segments[stored_chunk_id]->null_value_id()) {
+          null_values[chunk_offset] = true;
+        } else if (const auto* mapping = column.mappings[stored_chunk_id]) {
+          values[chunk_offset] = (*mapping)[value_id];
+        } else {
+          values[chunk_offset] = static_cast<int32_t>(value_id);
+        }
+      };
+
+      if (table.type() == TableType::Data) {
+        resolve_compressed_vector_type(*column.segments[chunk_id]->attribute_vector(), [&](const auto& vector) {
+          auto chunk_offset = ChunkOffset{0};
+          for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it, ++chunk_offset) {
+            translate_value_id(chunk_offset, chunk_id, *value_id_it);
+          }
+        });
+      } else {
+        const auto& pos_list = *static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id)).pos_list();
+        auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>(column.segments.size());
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          const auto row_id = pos_list[chunk_offset];
+          if (row_id.is_null()) {
+            null_values[chunk_offset] = true;
+            continue;
+          }
+
+          auto& decompressor = decompressors[row_id.chunk_id];
+          if (!decompressor) {
+            decompressor = column.segments[row_id.chunk_id]->attribute_vector()->create_base_decompressor();
+          }
+          translate_value_id(chunk_offset, row_id.chunk_id, decompressor->get(row_id.chunk_offset));
+        }
+      }
+
+      const auto segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+      chunks[chunk_id] = std::make_shared<Chunk>(Segments{segment});
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > row_count) {
+      translate();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(translate));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return std::make_shared<Table>(TableColumnDefinitions{{"value_id", DataType::Int, true}}, TableType::Data,
+                                 std::move(chunks));
+}
+
+// If the values of the build side are stored in DictionarySegments that share a single dictionary and those of the
+// probe side in DictionarySegments as well, the join columns of both sides are translated to value ids of the build
+// side's dictionary. Each dictionary of the probe side is translated once, which only pays off if the probe side has
+// more rows than the dictionaries have values. Returns the tables holding the value ids of both sides.
+std::optional<std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>>> translate_to_value_ids(
+    const std::shared_ptr<const Table>& build_table, const ColumnID build_column_id,
+    const std::shared_ptr<const Table>& probe_table, const ColumnID probe_column_id) {
+  if (build_table->row_count() == 0 || probe_table->row_count() == 0) return std::nullopt;
+
+  const auto build_column = find_dictionary_segments(build_table, build_column_id);
+  if (!build_column) return std::nullopt;
+
+  auto build_dictionary = std::shared_ptr<const pmr_vector<pmr_string>>{};
+  for (const auto& segment : build_column->segments) {
+    if (!segment) continue;
+    if (!build_dictionary) build_dictionary = segment->dictionary();
+    if (segment->dictionary() != build_dictionary) return std::nullopt;
+  }
+  if (!build_dictionary || build_dictionary->size() >= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return std::nullopt;
+  }
+
+  auto probe_column = find_dictionary_segments(probe_table, probe_column_id);
+  if (!probe_column) return std::nullopt;
+
+  auto mappings = std::unordered_map<const pmr_vector<pmr_string>*, ValueIDMapping>{};
+  auto translated_value_count = size_t{0};
+  const auto stored_chunk_count = probe_column->segments.size();
+  for (auto stored_chunk_id = ChunkID{0}; stored_chunk_id < stored_chunk_count; ++stored_chunk_id) {
+    const auto& segment = probe_column->segments[stored_chunk_id];
+    if (!segment || segment->dictionary() == build_dictionary) continue;
+
+    const auto& dictionary = *segment->dictionary();
+    auto [mapping_it, inserted] = mappings.try_emplace(&dictionary);
+    if (inserted) {
+      translated_value_count += dictionary.size();
+      if (translated_value_count > probe_table->row_count()) return std::nullopt;
+
+      // Both dictionaries are sorted, so each search can start at the previous match
+      auto& mapping = mapping_it->second;
+      mapping.resize(dictionary.size());
+      auto search_begin = build_dictionary->cbegin();
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        search_begin = std::lower_bound(search_begin, build_dictionary->cend(), dictionary[value_id]);
+        const auto found = search_begin != build_dictionary->cend() && *search_begin == dictionary[value_id];
+        mapping[value_id] = found ? static_cast<int32_t>(std::distance(build_dictionary->cbegin(), search_begin)) : -1;
+      }
+    }
+    probe_column->mappings[stored_chunk_id] = &mapping_it->second;
+  }
+
+  return std::pair{materialize_value_ids(*build_table, build_column_id, *build_column),
+                   materialize_value_ids(*probe_table, probe_column_id, *probe_column)};
+}
+
+// A column whose values are packed into the join key: the value minus `min` takes the next `bit_count` bits
+struct PackedKeyColumn {
+  ColumnID column_id{INVALID_COLUMN_ID};
+  int64_t min{0};
+  uint8_t bit_count{0};
+};
+
+bool is_integral(const DataType data_type) { return data_type == DataType::Int || data_type == DataType::Long; }
+
+// Returns the smallest and the largest value of an integral column, or std::nullopt if it only holds NULLs
+std::optional<std::pair<int64_t, int64_t>> integral_value_range(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  auto chunk_ranges = std::vector<std::pair<int64_t, int64_t>>(
+      chunk_count, {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()});
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto determine_range = [&, chunk_id, chunk]() {
+      auto& [min, max] = chunk_ranges[chunk_id];
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if constexpr (std::is_integral_v<ColumnDataType>) {
+          segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+            if (position.is_null()) return;
+            min = std::min(min, static_cast<int64_t>(position.value()));
+            max = std::max(max, static_cast<int64_t>(position.value()));
+          });
+        } else {
+          Fail("Only integral columns can be packed");
+        }
+      });
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > chunk->size()) {
+      determine_range();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(determine_range));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto min = std::numeric_limits<int64_t>::max();
+  auto max = std::numeric_limits<int64_t>::min();
+  for (const auto& [chunk_min, chunk_max] : chunk_ranges) {
+    min = std::min(min, chunk_min);
+    max = std::max(max, chunk_max);
+  }
+
+  if (min > max) return std::nullopt;
+  return std::pair{min, max};
+}
+
+// Returns a table with the same chunks as the input whose only column holds the packed keys of the columns. Rows with
+// a NULL in any of the columns have a NULL key, as they cannot satisfy all equi-predicates.
+std::shared_ptr<const Table> materialize_packed_keys(const Table& table, const std::vector<PackedKeyColumn>& columns) {
+  const auto chunk_count = table.chunk_count();
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto row_count = chunk->size();
+
+    const auto pack = [&, chunk_id, chunk, row_count]() {
+      auto keys = pmr_vector<uint64_t>(row_count);
+      auto null_values = pmr_vector<bool>(row_count);
+
+      for (const auto& column : columns) {
+        resolve_data_type(table.column_data_type(column.column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          if constexpr (std::is_integral_v<ColumnDataType>) {
+            segment_iterate<ColumnDataType>(*chunk->get_segment(column.column_id), [&](const auto& position) {
+              const auto chunk_offset = position.chunk_offset();
+              if (position.is_null()) {
+                null_values[chunk_offset] = true;
+                return;
+              }
+
+              const auto offset = static_cast<uint64_t>(static_cast<int64_t>(position.value())) -
+                                  static_cast<uint64_t>(column.min);
+              auto& key = keys[chunk_offset];
+              key = column.bit_count == 64 ? offset : (key << column.bit_count) | offset;
+            });
+          }
+        });
+      }
+
+      auto values = pmr_vector<int64_t>(row_count);
+      std::transform(keys.cbegin(), keys.cend(), values.begin(),
+                     [](const auto key) { return static_cast<int64_t>(key); });
+      const auto segment = std::make_shared<ValueSegment<int64_t>>(std::move(values), std::move(null_values));
+      chunks[chunk_id] = std::make_shared<Chunk>(Segments{segment});
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > row_count) {
+      pack();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(pack));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return std::make_shared<Table>(TableColumnDefinitions{{"packed_key", DataType::Long, true}}, TableType::Data,
+                                 std::move(chunks));
+}
+
+// If the primary predicate and secondary equi-predicates join integral columns, their values are bit-packed into a
+// single 64-bit key per row. The hash tables then find the rows that match on all of these columns instead of only on
+// the primary one, whose matches are otherwise checked against the secondary predicates one candidate pair at a time
+// (e.g., for composite keys such as TPC-C's (w_id, d_id, o_id), of which the first has only few values). Each column
+// takes as many bits as the range of its values in both inputs needs. As statistics are only estimates, the ranges are
+// determined with a pass over the columns. Returns the tables holding the packed keys of both sides and removes the
+// packed predicates from secondary_predicates, or returns std::nullopt if the keys do not fit into 64 bits.
+std::optional<std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>>> pack_join_keys(
+    const std::shared_ptr<const Table>& build_table, const std::shared_ptr<const Table>& probe_table,
+    const ColumnIDPair& primary_column_ids, std::vector<OperatorJoinPredicate>& secondary_predicates) {
+  const auto is_packable = [&](const ColumnIDPair& column_ids) {
+    return is_integral(build_table->column_data_type(column_ids.first)) &&
+           is_integral(probe_table->column_data_type(column_ids.second));
+  };
+  const auto is_packable_predicate = [&](const OperatorJoinPredicate& predicate) {
+    return predicate.predicate_condition == PredicateCondition::Equals && is_packable(predicate.column_ids);
+  };
+
+  if (!is_packable(primary_column_ids)) return std::nullopt;
+
+  auto packed_column_ids = std::vector<ColumnIDPair>{primary_column_ids};
+  for (const auto& predicate : secondary_predicates) {
+    if (is_packable_predicate(predicate)) packed_column_ids.emplace_back(predicate.column_ids);
+  }
+  if (packed_column_ids.size() == 1) return std::nullopt;
+
+  auto build_columns = std::vector<PackedKeyColumn>{};
+  auto probe_columns = std::vector<PackedKeyColumn>{};
+  auto bit_count = size_t{0};
+  for (const auto& [build_column_id, probe_column_id] : packed_column_ids) {
+    // If a side only holds NULLs, no rows match and the join is not worth packing the keys
+    const auto build_range = integral_value_range(*build_table, build_column_id);
+    if (!build_range) return std::nullopt;
+    const auto probe_range = integral_value_range(*probe_table, probe_column_id);
+    if (!probe_range) return std::nullopt;
+
+    const auto min = std::min(build_range->first, probe_range->first);
+    const auto max = std::max(build_range->second, probe_range->second);
+    const auto column_bit_count =
+        static_cast<uint8_t>(std::bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min)));
+    bit_count += column_bit_count;
+    if (bit_count > 64) return std::nullopt;
+
+    build_columns.push_back({build_column_id, min, column_bit_count});
+    probe_columns.push_back({probe_column_id, min, column_bit_count});
+  }
+
+  std::erase_if(secondary_predicates, is_packable_predicate);
+  return std::pair{materialize_packed_keys(*build_table, build_columns),
+                   materialize_packed_keys(*probe_table, probe_columns)};
+}
+
 }  // namespace
 
 namespace opossum {
@@ -63,8 +433,11 @@ std::string JoinHash::description(DescriptionMode description_mode) const {
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates, _radix_bits);
+  const auto copy = std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                               _secondary_predicates, _radix_bits);
+  copy->estimated_left_distinct_count = estimated_left_distinct_count;
+  copy->estimated_right_distinct_count = estimated_right_distinct_count;
+  return copy;
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -74,8 +447,8 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
   /*
     The number of radix bits is used to determine the number of build partitions. The idea is to size the partitions in
     a way that keeps the whole hash map cache resident. We aim for the largest unshared cache (for most Intel systems
-    that's the L2 cache, for Apple's M1 the L1 cache). This calculation should include hardware knowledge, once
-    available in Hyrise. As of now, we assume a cache size of 1024 KB, of which we use 75 %.
+    that's the L2 cache, for Apple's M1 the L1 cache). The cache size is taken from the topology (see
+    Topology::l2_cache_size), of which we use 75 %.
 
     We estimate the size the following way:
       - we assume each key appears once (that is an overestimation space-wise, but we
@@ -93,10 +466,10 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
     PerformanceWarning("Build side larger than probe side in hash join");
   }
 
-  // We assume a cache of 1024 KB for an Intel Xeon Platinum 8180. For local deployments or other CPUs, this size might
-  // be different (e.g., an AMD EPYC 7F72 CPU has an L2 cache size of 512 KB and Apple's M1 has 128 KB).
-  constexpr auto L2_CACHE_SIZE = 1'024'000;                   // bytes
-  constexpr auto L2_CACHE_MAX_USABLE = L2_CACHE_SIZE * 0.75;  // use 75% of the L2 cache size
+  // The L2 cache size differs widely between CPUs (e.g., 1024 KB for an Intel Xeon Platinum 8180, 512 KB for an AMD
+  // EPYC 7F72, and 128 KB for Apple's M1), which is why we do not assume a fixed size.
+  const auto l2_cache_size = static_cast<double>(Hyrise::get().topology.l2_cache_size());  // bytes
+  const auto l2_cache_max_usable = l2_cache_size * 0.75;  // use 75% of the L2 cache size
 
   // For information about the sizing of the bytell hash map, see the comments:
   // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
@@ -109,11 +482,27 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
       // key + value (and one byte overhead, see link above)
       static_cast<double>(sizeof(uint32_t)) / 0.8;
 
-  const auto cluster_count = std::max(1.0, complete_hash_map_size / L2_CACHE_MAX_USABLE);
+  const auto cluster_count = std::max(1.0, complete_hash_map_size / l2_cache_max_usable);
 
   return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
 }
 
+size_t JoinHash::calculate_bloom_filter_size(const size_t row_count) {
+  /*
+    Larger filters have fewer false positives, but once they exceed the cache, every lookup is likely a cache miss. We
+    thus aim for BLOOM_FILTER_BITS_PER_VALUE bits per value of the input that is materialized first, but do not use
+    more than half of the L2 cache. As the bloom filters are probed with a mask, their size is a power of two.
+  */
+  const auto capped_row_count = std::clamp(row_count, size_t{1}, MAX_BLOOM_FILTER_SIZE / BLOOM_FILTER_BITS_PER_VALUE);
+  const auto desired_size = std::bit_ceil(capped_row_count * BLOOM_FILTER_BITS_PER_VALUE);
+
+  const auto l2_cache_bits = Hyrise::get().topology.l2_cache_size() * CHAR_BIT;
+  const auto max_size =
+      std::min(MAX_BLOOM_FILTER_SIZE, std::max(MIN_BLOOM_FILTER_SIZE, std::bit_floor(l2_cache_bits / 2)));
+
+  return std::clamp(desired_size, MIN_BLOOM_FILTER_SIZE, max_size);
+}
+
 std::shared_ptr<const Table> JoinHash::_on_execute() {
   Assert(supports({_mode, _primary_predicate.predicate_condition,
                    left_input_table()->column_data_type(_primary_predicate.column_ids.first),
@@ -182,9 +571,44 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   }
 
   auto& join_hash_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
-  resolve_data_type(build_column_type, [&](const auto build_data_type_t) {
+
+  // Whether the build side's hash tables can be shared with other joins (see join_hash_build_cache.hpp)
+  const auto& build_cache = Hyrise::get().join_hash_build_cache;
+  const auto& build_input = build_hash_table_for_right_input ? _right_input : _left_input;
+  const auto build_side_is_cacheable = build_cache && transaction_context_is_set() &&
+                                       transaction_context()->read_write_operators().empty() &&
+                                       join_hash_build_input_is_cacheable(build_input->lqp_node);
+
+  // Equi-predicates on integral columns are joined on a single bit-packed key. Cached build sides are shared with
+  // joins that might have different secondary predicates, so their keys are not packed.
+  auto packed_key_tables = std::optional<std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>>>{};
+  if (!adjusted_secondary_predicates.empty() && !build_side_is_cacheable) {
+    const auto secondary_predicate_count = adjusted_secondary_predicates.size();
+    packed_key_tables =
+        pack_join_keys(build_input_table, probe_input_table, adjusted_column_ids, adjusted_secondary_predicates);
+    join_hash_performance_data.packed_predicate_count =
+        packed_key_tables ? secondary_predicate_count - adjusted_secondary_predicates.size() + 1 : 0;
+  }
+
+  // String columns whose values are stored in DictionarySegments sharing the build side's dictionary (e.g., self-joins
+  // or joins on foreign keys of merged tables, see ChunkEncoder::merge_dictionaries()) are joined on the value ids of
+  // that dictionary. This replaces hashing and comparing strings with 32-bit integers. Cached build sides are stored
+  // as strings and shared with other probe sides, so they are not translated.
+  auto value_id_tables = std::optional<std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>>>{};
+  if (build_column_type == DataType::String && probe_column_type == DataType::String && !build_side_is_cacheable) {
+    value_id_tables = translate_to_value_ids(build_input_table, build_column_id, probe_input_table, probe_column_id);
+  }
+  join_hash_performance_data.joins_on_value_ids = value_id_tables.has_value();
+
+  // If set, the join keys are materialized from these tables instead of the join columns of the inputs
+  const auto& key_tables = packed_key_tables ? packed_key_tables : value_id_tables;
+  const auto key_type = packed_key_tables ? DataType::Long : DataType::Int;
+  const auto build_join_type = key_tables ? key_type : build_column_type;
+  const auto probe_join_type = key_tables ? key_type : probe_column_type;
+
+  resolve_data_type(build_join_type, [&](const auto build_data_type_t) {
     using BuildColumnDataType = typename decltype(build_data_type_t)::type;
-    resolve_data_type(probe_column_type, [&](const auto probe_data_type_t) {
+    resolve_data_type(probe_join_type, [&](const auto probe_data_type_t) {
       using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
 
       constexpr auto BOTH_ARE_STRING =
@@ -207,10 +631,37 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
                    max_partition_size,
                "Partition count too small (potential overflows in hash map offsetting).");
 
+        using HashedType = typename JoinHashTraits<BuildColumnDataType, ProbeColumnDataType>::HashType;
+        auto build_cache_key = std::optional<JoinHashBuildCacheKey>{};
+        auto cached_build_side = std::shared_ptr<const JoinHashBuildCacheEntry<HashedType>>{};
+        if (build_side_is_cacheable) {
+          build_cache_key = JoinHashBuildCacheKey{build_input->lqp_node,
+                                                  transaction_context()->snapshot_commit_id(),
+                                                  build_input_table->row_count(),
+                                                  build_column_id,
+                                                  probe_column_type,
+                                                  *_radix_bits,
+                                                  _secondary_predicates.empty() && (_mode == JoinMode::Semi ||
+                                                                                    _mode == JoinMode::AntiNullAsTrue ||
+                                                                                    _mode == JoinMode::AntiNullAsFalse),
+                                                  _mode == JoinMode::AntiNullAsTrue};
+
+          if (const auto cache_entry = build_cache->try_get(*build_cache_key)) {
+            cached_build_side = std::dynamic_pointer_cast<const JoinHashBuildCacheEntry<HashedType>>(*cache_entry);
+            DebugAssert(cached_build_side, "Cached build side has an unexpected type");
+
+            // The cached hash tables store RowIDs of the cached build input. The tables have the same rows.
+            build_input_table = cached_build_side->build_input_table;
+          }
+        }
+        join_hash_performance_data.build_side_is_cached = static_cast<bool>(cached_build_side);
+
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
             _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
-            std::move(adjusted_secondary_predicates));
+            build_hash_table_for_right_input ? estimated_right_distinct_count : estimated_left_distinct_count,
+            std::move(adjusted_secondary_predicates), std::move(build_cache_key), std::move(cached_build_side),
+            key_tables ? key_tables->first : nullptr, key_tables ? key_tables->second : nullptr);
       } else {
         Fail("Cannot join String with non-String column");
       }
@@ -234,21 +685,38 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
                JoinHash::PerformanceData& performance_data,
-               std::vector<OperatorJoinPredicate> secondary_predicates = {})
+               const std::optional<size_t>& estimated_build_distinct_count,
+               std::vector<OperatorJoinPredicate> secondary_predicates = {},
+               std::optional<JoinHashBuildCacheKey> build_cache_key = std::nullopt,
+               std::shared_ptr<const JoinHashBuildCacheEntry<
+                   typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType>> cached_build_side = nullptr,
+               const std::shared_ptr<const Table>& build_materialization_table = nullptr,
+               const std::shared_ptr<const Table>& probe_materialization_table = nullptr)
       : _join_hash(join_hash),
         _build_input_table(build_input_table),
         _probe_input_table(probe_input_table),
+        _build_materialization_table(build_materialization_table),
+        _probe_materialization_table(probe_materialization_table),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
         _performance(performance_data),
         _output_column_order(output_column_order),
         _secondary_predicates(std::move(secondary_predicates)),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _estimated_build_distinct_count(estimated_build_distinct_count),
+        _build_cache_key(std::move(build_cache_key)),
+        _cached_build_side(std::move(cached_build_side)) {}
 
  protected:
   const JoinHash& _join_hash;
   const std::shared_ptr<const Table> _build_input_table, _probe_input_table;
+
+  // If set, the join columns are materialized from these tables instead of the inputs. They have the same chunks as
+  // the inputs and hold the join key (e.g., translated to dictionary value ids or packed from several join columns)
+  // as their only column.
+  const std::shared_ptr<const Table> _build_materialization_table, _probe_materialization_table;
+
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
@@ -262,9 +730,17 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
 
   const size_t _radix_bits;
 
+  // Number of distinct values that the hash tables of the build side are reserved for (see JoinHash)
+  const std::optional<size_t> _estimated_build_distinct_count;
+
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
 
+  // If _build_cache_key is set, the build side is shared via the JoinHashBuildCache. If _cached_build_side is set as
+  // well, the build side has already been processed by another JoinHash and only the probe side is processed.
+  const std::optional<JoinHashBuildCacheKey> _build_cache_key;
+  const std::shared_ptr<const JoinHashBuildCacheEntry<HashedType>> _cached_build_side;
+
   std::shared_ptr<const Table> _on_execute() override {
     /**
      * Keep/Discard NULLs from build and probe columns as follows
@@ -325,21 +801,40 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      */
 
     /**
-     * 1.1. Materialize the build partition, which is expected to be smaller. Create a bloom filter.
+     * 1.1. Materialize the build partition, which is expected to be smaller. Create a bloom filter. Both filters have
+     *      the same size, which is chosen for the input that is materialized first.
      */
 
+    // A build side that is shared via the JoinHashBuildCache must not depend on the probe side. Thus, it is always
+    // materialized first and the probe side's bloom filter is not used for it.
+    const auto reuse_build_side = static_cast<bool>(_cached_build_side);
+    const auto share_build_side = _build_cache_key && !reuse_build_side;
+
     auto build_side_bloom_filter = BloomFilter{};
     auto probe_side_bloom_filter = BloomFilter{};
+    const auto build_side_is_materialized_first = reuse_build_side || share_build_side ||
+                                                  _build_input_table->row_count() < _probe_input_table->row_count();
+    const auto bloom_filter_size =
+        reuse_build_side ? _cached_build_side->bloom_filter_size
+                         : JoinHash::calculate_bloom_filter_size(
+                               std::min(_build_input_table->row_count(), _probe_input_table->row_count()));
+
+    const auto& build_materialization_table =
+        _build_materialization_table ? _build_materialization_table : _build_input_table;
+    const auto build_materialization_column_id = _build_materialization_table ? ColumnID{0} : _column_ids.first;
+    const auto& probe_materialization_table =
+        _probe_materialization_table ? _probe_materialization_table : _probe_input_table;
+    const auto probe_materialization_column_id = _probe_materialization_table ? ColumnID{0} : _column_ids.second;
 
     const auto materialize_build_side = [&](const auto& input_bloom_filter) {
       if (keep_nulls_build_column) {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            build_materialization_table, build_materialization_column_id, histograms_build_column, _radix_bits,
+            build_side_bloom_filter, input_bloom_filter, bloom_filter_size);
       } else {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            build_materialization_table, build_materialization_column_id, histograms_build_column, _radix_bits,
+            build_side_bloom_filter, input_bloom_filter, bloom_filter_size);
       }
     };
 
@@ -350,49 +845,71 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     const auto materialize_probe_side = [&](const auto& input_bloom_filter) {
       if (keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            probe_materialization_table, probe_materialization_column_id, histograms_probe_column, _radix_bits,
+            probe_side_bloom_filter, input_bloom_filter, bloom_filter_size);
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            probe_materialization_table, probe_materialization_column_id, histograms_probe_column, _radix_bits,
+            probe_side_bloom_filter, input_bloom_filter, bloom_filter_size);
       }
     };
 
+    _join_hash._set_total_chunk_count(_build_input_table->chunk_count() + _probe_input_table->chunk_count());
+
     Timer timer_materialization;
-    if (_build_input_table->row_count() < _probe_input_table->row_count()) {
+    if (reuse_build_side) {
+      const auto& cached_bloom_filter = _cached_build_side->bloom_filter;
+      materialize_probe_side(bloom_filter_is_selective(cached_bloom_filter) ? cached_bloom_filter
+                                                                            : ALL_TRUE_BLOOM_FILTER);
+      _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+    } else if (build_side_is_materialized_first) {
       // When materializing the first side (here: the build side), we do not yet have a bloom filter. To keep the number
       // of code paths low, materialize_*_side always expects a bloom filter. For the first step, we thus pass in a
-      // bloom filter that returns true for every probe.
+      // bloom filter that returns true for every probe. The same is done if the first side's filter is so full that it
+      // would barely skip any rows.
       materialize_build_side(ALL_TRUE_BLOOM_FILTER);
       _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
-      materialize_probe_side(build_side_bloom_filter);
+      materialize_probe_side(bloom_filter_is_selective(build_side_bloom_filter) ? build_side_bloom_filter
+                                                                                : ALL_TRUE_BLOOM_FILTER);
       _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
     } else {
       materialize_probe_side(ALL_TRUE_BLOOM_FILTER);
       _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
-      materialize_build_side(probe_side_bloom_filter);
+      materialize_build_side(bloom_filter_is_selective(probe_side_bloom_filter) ? probe_side_bloom_filter
+                                                                                : ALL_TRUE_BLOOM_FILTER);
       _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
     }
+    _join_hash._add_processed_chunks(_build_input_table->chunk_count() + _probe_input_table->chunk_count());
+
+    // If the probe side has been materialized second, the build side has not yet been filtered with its bloom filter.
+    // We do so either while partitioning the build side or while building the hash tables. If the build side has been
+    // materialized second, it has already been filtered and checking the filter again would not skip any more values.
+    const auto& remaining_probe_side_bloom_filter =
+        build_side_is_materialized_first && !share_build_side && bloom_filter_is_selective(probe_side_bloom_filter)
+            ? probe_side_bloom_filter
+            : ALL_TRUE_BLOOM_FILTER;
+    const auto filter_while_partitioning = _radix_bits > 0 && !keep_nulls_build_column;
 
     /**
-     * 2. Perform radix partitioning for build and probe sides. The bloom filters are not used in this step. Future work
-     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
-     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
-     *    within partition_by_radix.
+     * 2. Perform radix partitioning for build and probe sides. Values of the build side that are not contained in the
+     *    remaining probe side bloom filter are not written to the partitions, which reduces the size of the
+     *    intermediary results. As NULL values are not contained in a bloom filter, this is not done if they are kept.
      */
     if (_radix_bits > 0) {
       Timer timer_clustering;
       auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
       jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        if (reuse_build_side) return;
+
         // radix partition the build table
         if (keep_nulls_build_column) {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
               materialized_build_column, histograms_build_column, _radix_bits);
         } else {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits, remaining_probe_side_bloom_filter,
+              bloom_filter_size);
         }
 
         // After the data in materialized_build_column has been partitioned, it is not needed anymore.
@@ -431,19 +948,111 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
      *    all rows.
      *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
-     *    probe step.
+     *    probe step, unless these values have already been excluded while partitioning.
+     *
+     *    If the partitions and the hash tables are not expected to fit into the remaining memory budget of the query,
+     *    the partitions of both sides are spilled to disk. They are then loaded, built, and probed in batches that fit
+     *    into the budget, like in a grace hash join (see step 4). This is not done for shared build sides or for
+     *    strings, which cannot be written as they are.
      */
+    const auto& build_bloom_filter =
+        filter_while_partitioning ? ALL_TRUE_BLOOM_FILTER : remaining_probe_side_bloom_filter;
+    const auto build_hash_tables = [&]() {
+      if (_secondary_predicates.empty() &&
+          (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+        hash_tables =
+            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly, _radix_bits,
+                                               build_bloom_filter, bloom_filter_size, _estimated_build_distinct_count,
+                                               _join_hash._memory_resource().get());
+      } else {
+        hash_tables =
+            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
+                                               build_bloom_filter, bloom_filter_size, _estimated_build_distinct_count,
+                                               _join_hash._memory_resource().get());
+      }
+    };
+
+    const auto has_null_values = [&]() {
+      for (const auto& build_side_partition : radix_build_column) {
+        if (std::find(build_side_partition.null_values.begin(), build_side_partition.null_values.end(), true) !=
+            build_side_partition.null_values.end()) {
+          return true;
+        }
+      }
+      return false;
+    };
+
+    // The partitions and, for each value of the build side, an entry in the hash table and its position
+    const auto estimate_memory_usage = [](const size_t build_element_count, const size_t probe_element_count) {
+      return build_element_count * (sizeof(PartitionedElement<BuildColumnType>) + sizeof(HashedType) +
+                                    sizeof(typename PosHashTable<HashedType>::Offset) + sizeof(RowID)) +
+             probe_element_count * sizeof(PartitionedElement<ProbeColumnType>);
+    };
+
+    constexpr auto PARTITIONS_ARE_SPILLABLE =
+        PARTITION_IS_SPILLABLE<BuildColumnType> && PARTITION_IS_SPILLABLE<ProbeColumnType>;
+    auto spill_file = std::unique_ptr<SpillFile>{};
+    auto spilled_build_partitions = std::vector<SpilledPartition>{};
+    auto spilled_probe_partitions = std::vector<SpilledPartition>{};
+    auto build_column_has_null_values = false;
+
+    if constexpr (PARTITIONS_ARE_SPILLABLE) {
+      const auto remaining_memory_budget = _join_hash._remaining_memory_budget();
+      if (_radix_bits > 0 && !reuse_build_side && !share_build_side && remaining_memory_budget) {
+        auto build_element_count = size_t{0};
+        for (const auto& partition : radix_build_column) {
+          build_element_count += partition.elements.size();
+        }
+        auto probe_element_count = size_t{0};
+        for (const auto& partition : radix_probe_column) {
+          probe_element_count += partition.elements.size();
+        }
+
+        if (estimate_memory_usage(build_element_count, probe_element_count) > *remaining_memory_budget) {
+          Timer timer_spilling;
+          if (keep_nulls_build_column) build_column_has_null_values = has_null_values();
+
+          spill_file = std::make_unique<SpillFile>(Hyrise::get().spill_directory);
+          spilled_build_partitions = spill_partitions(radix_build_column, *spill_file);
+          spilled_probe_partitions = spill_partitions(radix_probe_column, *spill_file);
+          _performance.spilled_bytes = spill_file->size();
+          // Spilling writes the radix partitions and is thus part of the clustering
+          _performance.set_step_runtime(
+              OperatorSteps::Clustering,
+              _performance.get_step_runtime(OperatorSteps::Clustering) + timer_spilling.lap());
+        }
+      }
+    }
+
     Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
+    if (reuse_build_side) {
+      // Nothing to do, the hash tables have been built by another JoinHash
+    } else if (!spill_file) {
+      build_hash_tables();
     }
     _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
+    if (reuse_build_side) {
+      build_column_has_null_values = _cached_build_side->build_column_has_null_values;
+    } else if (keep_nulls_build_column && !spill_file) {
+      build_column_has_null_values = has_null_values();
+    }
+    radix_build_column.clear();
+
+    // Offer the build side to other JoinHashes. From here on, the hash tables are accessed via the cache entry.
+    auto shared_build_side = _cached_build_side;
+    if (share_build_side) {
+      auto cache_entry = std::make_shared<JoinHashBuildCacheEntry<HashedType>>();
+      cache_entry->build_input_table = _build_input_table;
+      cache_entry->bloom_filter_size = bloom_filter_size;
+      cache_entry->build_column_has_null_values = build_column_has_null_values;
+      cache_entry->hash_tables = std::move(hash_tables);
+      cache_entry->bloom_filter = std::move(build_side_bloom_filter);
+      Hyrise::get().join_hash_build_cache->set(*_build_cache_key, cache_entry);
+      shared_build_side = std::move(cache_entry);
+    }
+    const auto& probed_hash_tables = shared_build_side ? shared_build_side->hash_tables : hash_tables;
+
     /**
      * Short cut for AntiNullAsTrue:
      *   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted anyway (as
@@ -451,20 +1060,14 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *   hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
      *   detecting a NULL value on the build side there.
      */
-    if (_mode == JoinMode::AntiNullAsTrue) {
-      for (const auto& build_side_partition : radix_build_column) {
-        for (const auto null_value : build_side_partition.null_values) {
-          if (null_value) {
-            Timer timer_output_writing;
-            const auto result = _join_hash._build_output_table({});
-            _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
-            return result;
-          }
-        }
-      }
+    if (_mode == JoinMode::AntiNullAsTrue && build_column_has_null_values) {
+      Timer timer_output_writing;
+      const auto result = _join_hash._build_output_table({});
+      _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+      return result;
     }
 
-    radix_build_column.clear();
+    if (_join_hash.is_cancelled()) return _join_hash._build_output_table({});
 
     /**
      * 4. Probe step
@@ -483,43 +1086,101 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       probe_side_pos_lists[i].reserve(result_rows_per_partition);
     }
 
+    const auto probe_hash_tables = [&](const auto& hash_tables_to_probe) {
+      switch (_mode) {
+        case JoinMode::Inner:
+          probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables_to_probe, build_side_pos_lists,
+                                                    probe_side_pos_lists, _mode, *_build_input_table,
+                                                    *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Left:
+        case JoinMode::Right:
+          probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables_to_probe, build_side_pos_lists,
+                                                   probe_side_pos_lists, _mode, *_build_input_table,
+                                                   *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Semi:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables_to_probe,
+                                                                       probe_side_pos_lists, *_build_input_table,
+                                                                       *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsTrue:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+              radix_probe_column, hash_tables_to_probe, probe_side_pos_lists, *_build_input_table,
+              *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsFalse:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+              radix_probe_column, hash_tables_to_probe, probe_side_pos_lists, *_build_input_table,
+              *_probe_input_table, _secondary_predicates);
+          break;
+
+        default:
+          Fail("JoinMode not supported by JoinHash");
+      }
+    };
+
     Timer timer_probing;
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
+    if (!spill_file) {
+      probe_hash_tables(probed_hash_tables);
+    } else if constexpr (PARTITIONS_ARE_SPILLABLE) {
+      // Load the spilled partitions in batches that fit into the remaining memory budget (but at least one partition
+      // per batch), build their hash tables, and probe them before the next batch is loaded. The batches are
+      // processed one after another, the partitions within a batch in parallel.
+      auto building_duration = std::chrono::nanoseconds{0};
+      radix_build_column.resize(partition_count);
+
+      auto batch_begin = size_t{0};
+      while (batch_begin < partition_count && !_join_hash.is_cancelled()) {
+        const auto memory_budget = _join_hash._remaining_memory_budget().value_or(0);
+
+        auto batch_end = batch_begin;
+        auto batch_memory_usage = size_t{0};
+        while (batch_end < partition_count) {
+          const auto partition_memory_usage =
+              estimate_memory_usage(spilled_build_partitions[batch_end].elements.size /
+                                        sizeof(PartitionedElement<BuildColumnType>),
+                                    spilled_probe_partitions[batch_end].elements.size /
+                                        sizeof(PartitionedElement<ProbeColumnType>));
+          if (batch_end > batch_begin && batch_memory_usage + partition_memory_usage > memory_budget) break;
+          batch_memory_usage += partition_memory_usage;
+          ++batch_end;
+        }
+
+        for (auto partition_idx = batch_begin; partition_idx < batch_end; ++partition_idx) {
+          radix_build_column[partition_idx] =
+              load_spilled_partition<BuildColumnType>(spilled_build_partitions[partition_idx], *spill_file);
+          radix_probe_column[partition_idx] =
+              load_spilled_partition<ProbeColumnType>(spilled_probe_partitions[partition_idx], *spill_file);
+        }
+
+        Timer timer_batch_building;
+        build_hash_tables();
+        building_duration += timer_batch_building.lap();
+
+        for (auto partition_idx = batch_begin; partition_idx < batch_end; ++partition_idx) {
+          radix_build_column[partition_idx] = Partition<BuildColumnType>();
+        }
+
+        probe_hash_tables(hash_tables);
+
+        for (auto partition_idx = batch_begin; partition_idx < batch_end; ++partition_idx) {
+          radix_probe_column[partition_idx] = Partition<ProbeColumnType>();
+        }
+        hash_tables.clear();
+
+        batch_begin = batch_end;
+      }
+
+      radix_build_column.clear();
+      _performance.set_step_runtime(OperatorSteps::Building, building_duration);
+      _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap() - building_duration);
     }
-    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+    if (!spill_file) _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
 
     radix_probe_column.clear();
     hash_tables.clear();
@@ -591,9 +1252,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       // following PosList(s) until a size between MIN_SIZE and MAX_SIZE is reached. This involves a trade-off:
       // A lower number of output chunks reduces the overhead, especially when multi-threading is used. However,
       // merging chunks destroys a potential references_single_chunk property of the PosList that would have been
-      // emitted otherwise. Search for guarantee_single_chunk in join_hash_steps.hpp for details.
-      constexpr auto MIN_SIZE = 500;
-      constexpr auto MAX_SIZE = MIN_SIZE * 2;
+      // emitted otherwise. Search for guarantee_single_chunk in join_hash_steps.hpp for details. Merging the PosLists
+      // before the segments are written is cheaper than coalescing the output chunks afterwards (see
+      // AbstractReadOnlyOperator::_coalesce_reference_chunks), but uses the same sizes.
+      constexpr auto MIN_SIZE = size_t{MIN_COALESCED_CHUNK_SIZE};
+      constexpr auto MAX_SIZE = size_t{MAX_COALESCED_CHUNK_SIZE};
       build_side_pos_list->reserve(MAX_SIZE);
       probe_side_pos_list->reserve(MAX_SIZE);
 
@@ -654,6 +1317,12 @@ void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, Descripti
   const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
   stream << separator << "Radix bits: " << radix_bits << ".";
   stream << separator << "Build side is " << (left_input_is_build_side ? "left." : "right.");
+  if (build_side_is_cached) stream << separator << "Build side was taken from the cache.";
+  if (joins_on_value_ids) stream << separator << "Joined on dictionary value ids.";
+  if (packed_predicate_count > 0) {
+    stream << separator << "Joined on a key packed from " << packed_predicate_count << " predicates.";
+  }
+  if (spilled_bytes > 0) stream << separator << "Spilled " << format_bytes(spilled_bytes) << " to disk.";
 }
 
 }  // namespace opossum
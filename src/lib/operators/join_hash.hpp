@@ -37,6 +37,15 @@ class JoinHash : public AbstractJoinOperator {
   template <typename T>
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size, const JoinMode mode);
 
+  // Returns the number of bits of the bloom filters for an input of row_count rows (see join_hash_steps.hpp)
+  static size_t calculate_bloom_filter_size(const size_t row_count);
+
+  // Estimated numbers of distinct values in the join columns of the left and the right input, set by the LQPTranslator
+  // (see CardinalityEstimator::estimate_distinct_count). The hash tables of the build side are reserved for them
+  // instead of for all rows of the build side.
+  std::optional<size_t> estimated_left_distinct_count;
+  std::optional<size_t> estimated_right_distinct_count;
+
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
     ProbeSideMaterializing,
@@ -52,6 +61,14 @@ class JoinHash : public AbstractJoinOperator {
     size_t radix_bits{0};
     // Initially, the left input is the build side and the right side is the probe side.
     bool left_input_is_build_side{true};
+    // Set if the hash tables of the build side were built by another JoinHash (see join_hash_build_cache.hpp)
+    bool build_side_is_cached{false};
+    bool joins_on_value_ids{false};
+    // The number of equi-predicates whose columns were bit-packed into a single join key (0 if none were packed)
+    size_t packed_predicate_count{0};
+    // The number of bytes of the radix partitions that were spilled because they did not fit into the memory budget of
+    // the query
+    size_t spilled_bytes{0};
   };
 
  protected:
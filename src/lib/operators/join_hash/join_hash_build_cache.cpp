@@ -0,0 +1,57 @@
+#include "join_hash_build_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+bool JoinHashBuildCacheKey::operator==(const JoinHashBuildCacheKey& other) const {
+  return snapshot_commit_id == other.snapshot_commit_id && build_input_row_count == other.build_input_row_count &&
+         build_column_id == other.build_column_id && probe_column_data_type == other.probe_column_data_type &&
+         radix_bits == other.radix_bits && existence_only == other.existence_only &&
+         keep_null_values == other.keep_null_values &&
+         (build_input_lqp == other.build_input_lqp || *build_input_lqp == *other.build_input_lqp);
+}
+
+size_t JoinHashBuildCacheKey::hash() const {
+  auto hash = build_input_lqp->hash();
+  boost::hash_combine(hash, snapshot_commit_id);
+  boost::hash_combine(hash, build_input_row_count);
+  boost::hash_combine(hash, static_cast<ColumnID::base_type>(build_column_id));
+  boost::hash_combine(hash, static_cast<size_t>(probe_column_data_type));
+  boost::hash_combine(hash, radix_bits);
+  boost::hash_combine(hash, existence_only);
+  boost::hash_combine(hash, keep_null_values);
+  return hash;
+}
+
+bool join_hash_build_input_is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  if (!lqp || !lqp_is_validated(std::const_pointer_cast<AbstractLQPNode>(lqp))) return false;
+
+  auto cacheable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& sub_expression) {
+        switch (sub_expression->type) {
+          case ExpressionType::CorrelatedParameter:
+          case ExpressionType::Placeholder:
+          case ExpressionType::LQPSubquery:
+          case ExpressionType::PQPSubquery:
+            cacheable = false;
+            return ExpressionVisitation::DoNotVisitArguments;
+          default:
+            return ExpressionVisitation::VisitArguments;
+        }
+      });
+    }
+    return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return cacheable;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "cache/gdfs_cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Identifies the hash tables that a JoinHash builds for its build side. Dashboard-like workloads join the same
+ * (filtered) dimension table over and over again. As long as the build input produces the same rows, the hash tables
+ * can be shared by all of these joins, so that only the probe side has to be processed.
+ *
+ * The build input is identified by its LQP and the snapshot in which it was executed. Two transactions with the same
+ * snapshot commit id see the same committed rows, and join_hash_build_input_is_cacheable makes sure that the result
+ * of the LQP depends on nothing else. The remaining members describe how the hash tables were built.
+ */
+struct JoinHashBuildCacheKey {
+  std::shared_ptr<const AbstractLQPNode> build_input_lqp;
+  CommitID snapshot_commit_id{0};
+
+  // Guards against tables that are replaced without a commit (e.g., by dropping and re-adding them)
+  size_t build_input_row_count{0};
+
+  ColumnID build_column_id{0};
+
+  // The type used for hashing depends on both join columns
+  DataType probe_column_data_type{DataType::Null};
+
+  size_t radix_bits{0};
+  bool existence_only{false};
+  bool keep_null_values{false};
+
+  bool operator==(const JoinHashBuildCacheKey& other) const;
+  size_t hash() const;
+};
+
+/**
+ * The state of a build side that is needed for probing. The hash tables and the bloom filter depend on the type used
+ * for hashing and are stored in JoinHashBuildCacheEntry<HashedType> (see join_hash_steps.hpp). As the hash tables
+ * store RowIDs of build_input_table, the probing JoinHash has to use the cached table as its build input.
+ */
+struct AbstractJoinHashBuildCacheEntry {
+  virtual ~AbstractJoinHashBuildCacheEntry() = default;
+
+  std::shared_ptr<const Table> build_input_table;
+  size_t bloom_filter_size{0};
+
+  // Only needed for JoinMode::AntiNullAsTrue, which does not emit any rows if the build column contains NULL values
+  bool build_column_has_null_values{false};
+};
+
+// Shares the hash tables of JoinHash build sides across operators and queries. Set Hyrise::get().join_hash_build_cache
+// to enable it. The capacity is the number of cached build sides.
+using JoinHashBuildCache = GDFSCache<JoinHashBuildCacheKey, std::shared_ptr<const AbstractJoinHashBuildCacheEntry>>;
+
+// Returns true if the result of the LQP only depends on the snapshot it is executed in. This requires that all stored
+// tables are validated and that the LQP has no parameters (they are set after translation and are not part of the
+// LQP's equality) as well as no subqueries.
+bool join_hash_build_input_is_cacheable(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::JoinHashBuildCacheKey> {
+  size_t operator()(const opossum::JoinHashBuildCacheKey& key) const { return key.hash(); }
+};
+
+}  // namespace std
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
 #include <boost/container/pmr/unsynchronized_pool_resource.hpp>
 #include <boost/container/small_vector.hpp>
@@ -9,13 +14,17 @@
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "memory/huge_page_memory_resource.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_build_cache.hpp"
+#include "operators/join_hash/join_hash_traits.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/spill_file.hpp"
 #include "type_comparison.hpp"
 
 /*
@@ -89,7 +98,11 @@ class PosHashTable {
 
   // In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
   // with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map.
-  using OffsetHashTable = ska::bytell_hash_map<HashedType, Offset>;
+  // Large hash tables are randomly accessed by the probe phase, which is why they are backed by huge pages. They do
+  // not use the operator's memory resource, as they might be kept in the JoinHashBuildCache beyond the operator.
+  using OffsetHashTable =
+      ska::bytell_hash_map<HashedType, Offset, JoinHashFunction<HashedType>, std::equal_to<HashedType>,
+                           PolymorphicAllocator<std::pair<HashedType, Offset>>>;
 
   // The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
   // as n because in many cases, we join on primary key attributes where by definition we have only one match on the
@@ -103,13 +116,24 @@ class PosHashTable {
     std::vector<size_t> offsets;
   };
 
-  explicit PosHashTable(const JoinHashBuildMode mode, const size_t max_size)
-      : _mode(mode),
-        _small_pos_lists(mode == JoinHashBuildMode::AllPositions ? max_size + 1 : 0,
-                         SmallPosList{SmallPosList::allocator_type(_memory_pool.get())}) {
-    // _small_pos_lists is initialized with an additional element to make the enforcement of the assertions easier. For
-    // _JoinHashBuildMode::ExistenceOnly, we do not store positions and thus do not initialize _small_pos_lists.
-    _offset_hash_table.reserve(max_size);
+  // The hash table is reserved for max_size values, i.e., the number of inserted rows, unless there is an estimate of
+  // the number of distinct values. Duplicates are common on the build side, so that the estimate avoids reserving
+  // memory that is never used. If the estimate is too small, the hash table and the SmallPosLists grow as needed.
+  // The memory of the SmallPosLists is allocated from the given resource.
+  explicit PosHashTable(
+      const JoinHashBuildMode mode, const size_t max_size,
+      const std::optional<size_t>& estimated_distinct_count = std::nullopt,
+      boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource())
+      : _monotonic_buffer(std::make_unique<boost::container::pmr::monotonic_buffer_resource>(memory_resource)),
+        _memory_pool(std::make_unique<boost::container::pmr::unsynchronized_pool_resource>(_monotonic_buffer.get())),
+        _mode(mode) {
+    const auto reserved_size = std::min(max_size, estimated_distinct_count.value_or(max_size));
+    _offset_hash_table.reserve(reserved_size);
+
+    // For JoinHashBuildMode::ExistenceOnly, we do not store positions and thus do not need _small_pos_lists
+    if (mode == JoinHashBuildMode::AllPositions) {
+      _small_pos_lists.reserve(reserved_size);
+    }
   }
 
   // For a value seen on the build side, add the value to the hash map.
@@ -118,23 +142,44 @@ class PosHashTable {
   template <typename InputType>
   void emplace(const InputType& value, RowID row_id) {
     const auto casted_value = static_cast<HashedType>(value);
+    if (_existence_bitmap) {
+      _existence_bitmap->set(_bitmap_index(casted_value));
+      return;
+    }
 
     // If casted_value is already present in the hash table, this returns an iterator to the existing value. If not, it
     // inserts a mapping from casted_value to the index into _values, which is defined by the previously inserted
     // number of values.
-    const auto it = _offset_hash_table.emplace(casted_value, _offset_hash_table.size());
+    const auto [it, inserted] = _offset_hash_table.emplace(casted_value, _offset_hash_table.size());
     if (_mode == JoinHashBuildMode::AllPositions) {
-      auto& pos_list = _small_pos_lists[it.first->second];
+      if (inserted) {
+        _small_pos_lists.emplace_back(SmallPosList::allocator_type(_memory_pool.get()));
+      }
+      auto& pos_list = _small_pos_lists[it->second];
       pos_list.emplace_back(row_id);
 
-      DebugAssert(_offset_hash_table.size() < _small_pos_lists.size(),
-                  "Hash table too big for pre-allocated data structures");
+      DebugAssert(_offset_hash_table.size() == _small_pos_lists.size(), "Expected one SmallPosList per value");
       DebugAssert(_offset_hash_table.size() < std::numeric_limits<Offset>::max(), "Hash table too big for offset");
     }
   }
 
+  // For JoinHashBuildMode::ExistenceOnly and integral values, the values can be stored in a dense bitmap over their
+  // range instead of the hash table. This is smaller and faster than the hash table if the range is small compared to
+  // the number of values, e.g., for keys of a dimension table. Must be called before values are added.
+  void use_existence_bitmap(const HashedType min_value, const HashedType max_value) {
+    DebugAssert(_mode == JoinHashBuildMode::ExistenceOnly, "The bitmap does not store positions");
+    DebugAssert(_offset_hash_table.empty(), "Values were already added to the hash table");
+    _bitmap_min_value = min_value;
+    _existence_bitmap = boost::dynamic_bitset<>(static_cast<size_t>(_bitmap_index(max_value)) + 1);
+    // Release the memory reserved by the constructor
+    _offset_hash_table.shrink_to_fit();
+  }
+
+  bool uses_existence_bitmap() const { return _existence_bitmap.has_value(); }
+
   // Rewrite the SmallPosLists into one giant UnifiedPosList (see above).
   void finalize() {
+    if (_existence_bitmap) return;
     _offset_hash_table.shrink_to_fit();
 
     if (_mode == JoinHashBuildMode::AllPositions) {
@@ -170,61 +215,110 @@ class PosHashTable {
     DebugAssert(_mode == JoinHashBuildMode::AllPositions, "find is invalid for ExistenceOnly mode, use contains");
     DebugAssert(_unified_pos_list, "_unified_pos_list not set - was finalize called?");
 
-    const auto casted_value = static_cast<HashedType>(value);
-    const auto hash_table_iter = _offset_hash_table.find(casted_value);
+    return positions(find_offset(value));
+  }
+
+  // The steps of find(), which probe() takes for a batch of values at a time. Each step accesses memory at an address
+  // that the previous step computed, which can be prefetched in between: find_offset() looks up the value in the hash
+  // table and returns the index of its SmallPosList, or std::nullopt if the value is not found.
+  // prefetch_positions() prefetches the offsets of that index in the UnifiedPosList, and positions() returns the range
+  // of matching positions from them.
+  template <typename InputType>
+  std::optional<Offset> find_offset(const InputType& value) const {
+    DebugAssert(_mode == JoinHashBuildMode::AllPositions, "find is invalid for ExistenceOnly mode, use contains");
+    DebugAssert(_unified_pos_list, "_unified_pos_list not set - was finalize called?");
+
+    const auto hash_table_iter = _offset_hash_table.find(static_cast<HashedType>(value));
+    if (hash_table_iter == _offset_hash_table.end()) return std::nullopt;
+    return hash_table_iter->second;
+  }
 
-    if (hash_table_iter == _offset_hash_table.end()) {
+  void prefetch_positions(const Offset offset) const { __builtin_prefetch(&_unified_pos_list->offsets[offset]); }
+
+  const std::pair<RowIDPosList::const_iterator, RowIDPosList::const_iterator> positions(
+      const std::optional<Offset> offset) const {
+    if (!offset) {
       // Not found, return an empty range
       return {_unified_pos_list->pos_list.end(), _unified_pos_list->pos_list.end()};
     }
 
     // Return two iterators that define a half open range, starting at the first value that corresponds to the search
     // value and ending at the first value of the next value. This is what we added `total_size` to the offset list for.
-    return {_unified_pos_list->pos_list.begin() + _unified_pos_list->offsets[hash_table_iter->second],
-            _unified_pos_list->pos_list.begin() + _unified_pos_list->offsets[hash_table_iter->second + 1]};
+    return {_unified_pos_list->pos_list.begin() + _unified_pos_list->offsets[*offset],
+            _unified_pos_list->pos_list.begin() + _unified_pos_list->offsets[*offset + 1]};
   }
 
   // For a value seen on the probe side, return whether it has been seen on the build side
   template <typename InputType>
   bool contains(const InputType& value) const {
     const auto casted_value = static_cast<HashedType>(value);
+    if (_existence_bitmap) {
+      if (casted_value < _bitmap_min_value) return false;
+      const auto index = _bitmap_index(casted_value);
+      return index < _existence_bitmap->size() && _existence_bitmap->test(index);
+    }
     return _offset_hash_table.find(casted_value) != _offset_hash_table.end();
   }
 
  private:
+  // The difference is computed on unsigned values, which does not overflow for values that are not below the minimum
+  uint64_t _bitmap_index(const HashedType value) const {
+    if constexpr (std::is_integral_v<HashedType>) {
+      return static_cast<uint64_t>(value) - static_cast<uint64_t>(_bitmap_min_value);
+    } else {
+      Fail("The existence bitmap is only used for integral values");
+    }
+  }
+
   // During the build phase, the small_vectors cause many small allocations. Instead of going to malloc every time,
   // we create our own pool, which is discarded once finalize() is called. The pool is unsynchronized (i.e., non-thread-
   // safe) by design. This way, we can quickly perform a high number of allocations without having to synchronize with
   // other threads for each allocation. Instead, we synchronize only when we refill the underlying
   // monotonic_buffer_resource. This works because each PosHashTable is used by exactly one thread.
-  std::unique_ptr<boost::container::pmr::monotonic_buffer_resource> _monotonic_buffer =
-      std::make_unique<boost::container::pmr::monotonic_buffer_resource>();
-  std::unique_ptr<boost::container::pmr::unsynchronized_pool_resource> _memory_pool =
-      std::make_unique<boost::container::pmr::unsynchronized_pool_resource>(_monotonic_buffer.get());
+  std::unique_ptr<boost::container::pmr::monotonic_buffer_resource> _monotonic_buffer;
+  std::unique_ptr<boost::container::pmr::unsynchronized_pool_resource> _memory_pool;
 
   JoinHashBuildMode _mode{};
-  OffsetHashTable _offset_hash_table{};
+  OffsetHashTable _offset_hash_table{
+      0, JoinHashFunction<HashedType>{}, std::equal_to<HashedType>{},
+      PolymorphicAllocator<std::pair<HashedType, Offset>>{
+          &HugePageMemoryResource::get(HugePageAllocationClass::Intermediates)}};
   std::vector<SmallPosList> _small_pos_lists{};
 
   std::optional<UnifiedPosList> _unified_pos_list{};
+
+  HashedType _bitmap_min_value{};
+  std::optional<boost::dynamic_bitset<>> _existence_bitmap{};
 };
 
-// The bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether bloom filters are worth the memory and computational costs. This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Evaluate whether using multiple hash functions (k>1) brings any improvement. In a first experiment, however, we
-//     saw no benefits for single-threaded TPC-H SF 10.
-// (4) Use the probe side bloom filter when partitioning the build side. By doing that, we reduce the size of the
-//     intermediary results. When a bloom filter-supported partitioning has been done (i.e., partitioning has not
-//     been skipped), we do not need to use a bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
+// The bloom filter is used during the materialization, radix partitioning, and build phases. For each value, it
+// contains `true` in BLOOM_FILTER_HASH_COUNT (k) slots that are derived from the value's hash (see
+// bloom_filter_insert). JoinHash adapts the use of the filters to its inputs:
+// (1) A filter is only used if it is selective enough to be worth the additional lookups (see
+//     bloom_filter_is_selective). Filters of inputs with mostly distinct values quickly fill up, especially if the
+//     input is much larger than the filter.
+// (2) The filter size is chosen based on the size of the input that is materialized first, but it is limited by the
+//     L2 cache size so that lookups are cheap (see JoinHash::calculate_bloom_filter_size). BLOOM_FILTER_SIZE is the
+//     size that is used if a caller does not pass a size.
+// (3) Two slots are used per value. This lowers the false positive rate for a given filter size, which is what allows
+//     us to use smaller filters.
+// (4) If the build side is materialized before the probe side, the probe side's filter is used while radix
+//     partitioning the build side. This reduces the size of the intermediary results, and the build phase does not
+//     need to check the filter anymore.
 static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
 static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
+static constexpr auto MIN_BLOOM_FILTER_SIZE = size_t{1} << 16;
+static constexpr auto MAX_BLOOM_FILTER_SIZE = size_t{1} << 22;
+static constexpr auto BLOOM_FILTER_HASH_COUNT = 2;
+
+// With k = 2 and eight bits per value, about 5 % of the values not in the filter are false positives.
+static constexpr auto BLOOM_FILTER_BITS_PER_VALUE = size_t{8};
+
+// Filters that let more than half of the values that are not in the filter pass are not worth their lookups.
+static constexpr auto MAX_BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.5;
+
+// Number of probe elements whose hash table lookups are issued before their matches are written (see probe())
+static constexpr auto PROBE_BATCH_SIZE = size_t{16};
 
 // Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
 // needed for merging partial bloom filters created by different threads. Note that the dynamic_bitset(n, value)
@@ -233,27 +327,114 @@ using BloomFilter = boost::dynamic_bitset<>;
 
 // ALL_TRUE_BLOOM_FILTER is initialized by creating a BloomFilter with every value being false and using bitwise
 // negation (~x). As the negation is surprisingly expensive, we create a static empty bloom filter and reference
-// it where needed. Having a bloom filter that always returns true avoids a branch in the hot loop.
-static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
+// it where needed. Having a bloom filter that always returns true avoids a branch in the hot loop. As it has the
+// maximum size, it can be used in place of filters of any size.
+inline const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(MAX_BLOOM_FILTER_SIZE);
+
+// The first slot of a value is taken from the lower bits of its hash, the second one from the upper 32 bits. As
+// JoinHashFunction mixes all bits of the key and MAX_BLOOM_FILTER_SIZE is below 2^32, the slots are independent.
+inline size_t bloom_filter_second_slot(const Hash hash, const size_t bloom_filter_mask) {
+  static_assert(MAX_BLOOM_FILTER_SIZE <= size_t{1} << 32, "Second slot would overlap with the first one");
+  return (hash >> 32) & bloom_filter_mask;
+}
+
+inline void bloom_filter_insert(BloomFilter& bloom_filter, const Hash hash, const size_t bloom_filter_mask) {
+  bloom_filter[hash & bloom_filter_mask] = true;
+  bloom_filter[bloom_filter_second_slot(hash, bloom_filter_mask)] = true;
+}
+
+inline bool bloom_filter_contains(const BloomFilter& bloom_filter, const Hash hash, const size_t bloom_filter_mask) {
+  // Using & instead of && avoids a branch
+  return bloom_filter[hash & bloom_filter_mask] & bloom_filter[bloom_filter_second_slot(hash, bloom_filter_mask)];
+}
+
+// Estimates the false positive rate of the filter from its fill level
+inline bool bloom_filter_is_selective(const BloomFilter& bloom_filter) {
+  const auto fill_level = static_cast<double>(bloom_filter.count()) / static_cast<double>(bloom_filter.size());
+  return std::pow(fill_level, BLOOM_FILTER_HASH_COUNT) <= MAX_BLOOM_FILTER_FALSE_POSITIVE_RATE;
+}
+
+// Checks that input_bloom_filter can be probed with the mask of the given filter size. The input filter is either a
+// filter of the same size or ALL_TRUE_BLOOM_FILTER.
+inline void assert_bloom_filter_size(const BloomFilter& input_bloom_filter, const size_t bloom_filter_size) {
+  Assert(bloom_filter_size >= 1 && bloom_filter_size <= MAX_BLOOM_FILTER_SIZE &&
+             (bloom_filter_size & (bloom_filter_size - 1)) == 0,
+         "Bloom filter size must be a power of two not larger than MAX_BLOOM_FILTER_SIZE");
+  Assert(input_bloom_filter.size() >= bloom_filter_size, "Invalid input_bloom_filter");
+}
+
+// A build side shared via the JoinHashBuildCache (see join_hash_build_cache.hpp)
+template <typename HashedType>
+struct JoinHashBuildCacheEntry : public AbstractJoinHashBuildCacheEntry {
+  std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
+  BloomFilter bloom_filter;
+};
+
+// The location of a radix partition that JoinHash has written to a SpillFile
+struct SpilledPartition {
+  SpillFile::Range elements;
+  SpillFile::Range null_values;
+};
+
+// Partitions can only be spilled if their values are trivially copyable, i.e., not for strings
+template <typename T>
+constexpr auto PARTITION_IS_SPILLABLE = std::is_trivially_copyable_v<PartitionedElement<T>>;
+
+// Writes the partitions to the file and releases their memory
+template <typename T>
+std::vector<SpilledPartition> spill_partitions(RadixContainer<T>& radix_container, SpillFile& spill_file) {
+  static_assert(PARTITION_IS_SPILLABLE<T>, "Partition cannot be spilled");
+
+  auto spilled_partitions = std::vector<SpilledPartition>(radix_container.size());
+  for (auto partition_idx = size_t{0}; partition_idx < radix_container.size(); ++partition_idx) {
+    auto& partition = radix_container[partition_idx];
+    spilled_partitions[partition_idx].elements = spill_file.write_vector(partition.elements);
+
+    // std::vector<bool> does not store its values as bytes
+    const auto null_values = std::vector<uint8_t>(partition.null_values.begin(), partition.null_values.end());
+    spilled_partitions[partition_idx].null_values = spill_file.write_vector(null_values);
+
+    partition = Partition<T>();
+  }
+
+  return spilled_partitions;
+}
+
+template <typename T>
+Partition<T> load_spilled_partition(const SpilledPartition& spilled_partition, const SpillFile& spill_file) {
+  static_assert(PARTITION_IS_SPILLABLE<T>, "Partition cannot be spilled");
+
+  auto partition = Partition<T>();
+  spill_file.read_vector(spilled_partition.elements, partition.elements);
+
+  auto null_values = std::vector<uint8_t>{};
+  spill_file.read_vector(spilled_partition.null_values, null_values);
+  partition.null_values.assign(null_values.begin(), null_values.end());
+
+  return partition;
+}
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
-//                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             bloom filter is false
+// @param output_bloom_filter  Out: A filled BloomFilter of bloom_filter_size that contains each value encountered in
+//                             the input column (see bloom_filter_insert)
+// @param input_bloom_filter   Optional: Materialization is skipped for each value that is not contained in the bloom
+//                             filter
+// @param bloom_filter_size    Size of the output_bloom_filter and the input_bloom_filter (unless the latter is
+//                             ALL_TRUE_BLOOM_FILTER)
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
                                     BloomFilter& output_bloom_filter,
-                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER,
+                                    const size_t bloom_filter_size = BLOOM_FILTER_SIZE) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
-  const std::hash<HashedType> hash_function;
+  const JoinHashFunction<HashedType> hash_function;
   // List of all elements that will be partitioned
   auto radix_container = RadixContainer<T>{};
   radix_container.resize(chunk_count);
@@ -266,10 +447,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
   Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
+  assert_bloom_filter_size(input_bloom_filter, bloom_filter_size);
+  output_bloom_filter.resize(bloom_filter_size);
   std::mutex output_bloom_filter_mutex;
-
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  const auto bloom_filter_mask = bloom_filter_size - 1;
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -287,7 +468,7 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
       if (Hyrise::get().is_multi_threaded()) {
         // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
+        local_output_bloom_filter = BloomFilter(bloom_filter_size);
         used_output_bloom_filter = local_output_bloom_filter;
       }
 
@@ -334,14 +515,15 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
             auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+            if (!value.is_null() && !bloom_filter_contains(input_bloom_filter, hashed_value, bloom_filter_mask) &&
+                !keep_null_values) {
               // Value in not present in input bloom filter and can be skipped
               skip = true;
             }
 
             if (!skip) {
               // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
+              bloom_filter_insert(used_output_bloom_filter.get(), hashed_value, bloom_filter_mask);
 
               /*
               For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -395,7 +577,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
     if (JoinHash::JOB_SPAWN_THRESHOLD > num_rows) {
       materialize();
     } else {
-      jobs.emplace_back(std::make_shared<JobTask>(materialize));
+      // Materialize the chunk on the NUMA node that holds it
+      auto job = std::make_shared<JobTask>(materialize);
+      job->set_node_id(chunk_in->numa_node_id());
+      jobs.emplace_back(job);
     }
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
@@ -403,15 +588,52 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   return radix_container;
 }
 
+// Semi and anti joins without secondary predicates only test whether a value exists on the build side. For integral
+// values, PosHashTable can store them in a dense bitmap instead (see PosHashTable::use_existence_bitmap()). The bitmap
+// is used if the range of the values needs at most EXISTENCE_BITMAP_MAX_BITS_PER_VALUE bits per value, which is about
+// the memory a value takes in the hash table. The range is taken from the materialized values rather than from the
+// statistics, as these are exact and filtered by the predicates below the join.
+static constexpr auto EXISTENCE_BITMAP_MAX_BITS_PER_VALUE = size_t{64};
+
+template <typename HashedType, typename BuildColumnType>
+void use_existence_bitmap_if_dense(PosHashTable<HashedType>& hash_table,
+                                   const RadixContainer<BuildColumnType>& radix_container,
+                                   const size_t begin_partition_idx, const size_t end_partition_idx) {
+  if constexpr (std::is_integral_v<HashedType> && std::is_integral_v<BuildColumnType>) {
+    auto min_value = std::numeric_limits<HashedType>::max();
+    auto max_value = std::numeric_limits<HashedType>::lowest();
+    auto value_count = size_t{0};
+    for (auto partition_idx = begin_partition_idx; partition_idx < end_partition_idx; ++partition_idx) {
+      const auto& elements = radix_container[partition_idx].elements;
+      for (const auto& element : elements) {
+        const auto value = static_cast<HashedType>(element.value);
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+      }
+      value_count += elements.size();
+    }
+
+    if (value_count == 0) return;
+    const auto range = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+    if (range / EXISTENCE_BITMAP_MAX_BITS_PER_VALUE < value_count) {
+      hash_table.use_existence_bitmap(min_value, max_value);
+    }
+  }
+}
+
 /*
-Build all the hash tables for the partitions of the build column. One job per partition
+Build all the hash tables for the partitions of the build column. One job per partition. Values that are not contained
+in the input_bloom_filter are not inserted.
 */
 
 template <typename BuildColumnType, typename HashedType>
-std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
-                                                           const JoinHashBuildMode mode, const size_t radix_bits,
-                                                           const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
+std::vector<std::optional<PosHashTable<HashedType>>> build(
+    const RadixContainer<BuildColumnType>& radix_container, const JoinHashBuildMode mode, const size_t radix_bits,
+    const BloomFilter& input_bloom_filter, const size_t bloom_filter_size = BLOOM_FILTER_SIZE,
+    const std::optional<size_t>& estimated_distinct_count = std::nullopt,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
+  assert_bloom_filter_size(input_bloom_filter, bloom_filter_size);
+  const auto bloom_filter_mask = bloom_filter_size - 1;
 
   if (radix_container.empty()) return {};
 
@@ -421,13 +643,17 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   */
   std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
 
+  auto total_size = size_t{0};
+  for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
+    total_size += radix_container[partition_idx].elements.size();
+  }
+
   if (radix_bits == 0) {
-    auto total_size = size_t{0};
-    for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
-      total_size += radix_container[partition_idx].elements.size();
-    }
     hash_tables.resize(1);
-    hash_tables[0] = PosHashTable<HashedType>(mode, total_size);
+    hash_tables[0] = PosHashTable<HashedType>(mode, total_size, estimated_distinct_count, memory_resource);
+    if (mode == JoinHashBuildMode::ExistenceOnly) {
+      use_existence_bitmap_if_dense(*hash_tables[0], radix_container, 0, radix_container.size());
+    }
   } else {
     hash_tables.resize(radix_container.size());
   }
@@ -440,7 +666,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
     if (radix_container[partition_idx].elements.empty()) {
       continue;
     }
-    const std::hash<HashedType> hash_function;
+    const JoinHashFunction<HashedType> hash_function;
 
     const auto& elements = radix_container[partition_idx].elements;
     const auto elements_count = elements.size();
@@ -450,13 +676,24 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 
       auto& hash_table = hash_tables[hash_table_idx];
       if (radix_bits > 0) {
-        hash_table = PosHashTable<HashedType>(mode, elements_count);
+        // The values are spread evenly across the partitions by their hash, and so are the distinct values
+        auto estimated_partition_distinct_count = std::optional<size_t>{};
+        if (estimated_distinct_count) {
+          estimated_partition_distinct_count = static_cast<size_t>(std::ceil(
+              static_cast<double>(*estimated_distinct_count) * static_cast<double>(elements_count) /
+              static_cast<double>(total_size)));
+        }
+        hash_table =
+            PosHashTable<HashedType>(mode, elements_count, estimated_partition_distinct_count, memory_resource);
+        if (mode == JoinHashBuildMode::ExistenceOnly) {
+          use_existence_bitmap_if_dense(*hash_table, radix_container, partition_idx, partition_idx + 1);
+        }
       }
       for (const auto& element : elements) {
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
         const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+        if (!bloom_filter_contains(input_bloom_filter, hashed_value, bloom_filter_mask)) {
           continue;
         }
 
@@ -486,19 +723,27 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+// Values that are not contained in the input_bloom_filter are not written to the output partitions. NULL values are
+// not contained in any bloom filter, so filtering is only possible if NULL values are not kept.
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER,
+                                     const size_t bloom_filter_size = BLOOM_FILTER_SIZE) {
   if (radix_container.empty()) return radix_container;
 
+  assert_bloom_filter_size(input_bloom_filter, bloom_filter_size);
+  const auto bloom_filter_mask = bloom_filter_size - 1;
+  const auto use_bloom_filter = &input_bloom_filter != &ALL_TRUE_BLOOM_FILTER;
+  Assert(!keep_null_values || !use_bloom_filter, "Cannot use a bloom filter when NULL values are kept");
+
   if constexpr (keep_null_values) {
     Assert(radix_container[0].elements.size() == radix_container[0].null_values.size(),
            "partition_by_radix() called with NULL consideration but radix container does not store any NULL "
            "value information");
   }
 
-  const std::hash<HashedType> hash_function;
+  const JoinHashFunction<HashedType> hash_function;
 
   const auto input_partition_count = radix_container.size();
   const auto output_partition_count = size_t{1} << radix_bits;
@@ -535,6 +780,11 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
     }
   }
 
+  // The histograms count all elements, including those that are filtered out. As each input partition writes to its
+  // own range of an output partition, filtering leaves gaps. To close them, we need the beginnings of the ranges.
+  const auto output_begin_offsets_by_input_partition =
+      use_bloom_filter ? output_offsets_by_input_partition : std::vector<std::vector<size_t>>{};
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(input_partition_count);
 
@@ -551,7 +801,12 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
           DebugAssert(!(element.row_id == NULL_ROW_ID), "NULL_ROW_ID should not have made it this far");
         }
 
-        const size_t radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
+        const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
+        if (use_bloom_filter && !bloom_filter_contains(input_bloom_filter, hashed_value, bloom_filter_mask)) {
+          continue;
+        }
+
+        const size_t radix = hashed_value & radix_mask;
 
         auto& output_idx = output_offsets_by_input_partition[input_partition_idx][radix];
         DebugAssert(output_idx < output[radix].elements.size(), "output_idx is completely out-of-bounds");
@@ -580,6 +835,34 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   jobs.clear();
 
+  // Close the gaps left by filtered elements. The ranges are moved to the front in order, so the order of the elements
+  // is the same as without filtering.
+  if (use_bloom_filter) {
+    for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
+      const auto compact_partition = [&, output_partition_idx]() {
+        auto& elements = output[output_partition_idx].elements;
+        auto write_offset = size_t{0};
+        for (auto input_partition_idx = size_t{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
+          const auto begin_offset = output_begin_offsets_by_input_partition[input_partition_idx][output_partition_idx];
+          const auto end_offset = output_offsets_by_input_partition[input_partition_idx][output_partition_idx];
+          if (write_offset != begin_offset) {
+            std::copy(elements.begin() + begin_offset, elements.begin() + end_offset, elements.begin() + write_offset);
+          }
+          write_offset += end_offset - begin_offset;
+        }
+        elements.resize(write_offset);
+      };
+
+      if (JoinHash::JOB_SPAWN_THRESHOLD > output[output_partition_idx].elements.size()) {
+        compact_partition();
+      } else {
+        jobs.emplace_back(std::make_shared<JobTask>(compact_partition));
+      }
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    jobs.clear();
+  }
+
   // Compress null_values_as_char into partition.null_values
   if constexpr (keep_null_values) {
     for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
@@ -650,6 +933,8 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         if (!secondary_join_predicates.empty()) {
           multi_predicate_join_evaluator.emplace(build_table, probe_table, mode, secondary_join_predicates);
         }
+        // The matches of the primary predicate, which are filtered by the secondary predicates as a batch
+        auto candidate_row_ids = std::vector<RowID>{};
 
         // Simple heuristic to estimate result size: half of the partition's rows will match
         // a more conservative pre-allocation would be the size of the build cluster
@@ -657,74 +942,98 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_side_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
-          const auto& probe_column_element = elements[partition_offset];
-
-          if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
-            // From previous joins, we could potentially have NULL values that do not refer to
-            // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
-            continue;
+        // The elements are probed in batches (group prefetching). A lookup consists of three dependent memory
+        // accesses: the hash table slot, the offsets of the matching SmallPosList in the UnifiedPosList, and the first
+        // matching position. Each step is taken for all elements of a batch before the next one, and the memory of
+        // the next step is prefetched. As the accesses of different elements do not depend on each other, their cache
+        // misses overlap, which they cannot if each lookup is followed by writing its matches. The hash table slots
+        // themselves are not prefetched, as ska::bytell_hash_map does not expose their addresses.
+        auto batch_offsets = std::array<std::optional<typename PosHashTable<HashedType>::Offset>, PROBE_BATCH_SIZE>{};
+        auto batch_matching_rows =
+            std::array<std::pair<RowIDPosList::const_iterator, RowIDPosList::const_iterator>, PROBE_BATCH_SIZE>{};
+
+        for (auto batch_begin = size_t{0}; batch_begin < elements_count; batch_begin += PROBE_BATCH_SIZE) {
+          const auto batch_end = std::min(batch_begin + PROBE_BATCH_SIZE, elements_count);
+
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            auto& offset = batch_offsets[partition_offset - batch_begin];
+            offset = hash_table.find_offset(static_cast<HashedType>(elements[partition_offset].value));
+            if (offset) hash_table.prefetch_positions(*offset);
           }
 
-          auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
-              hash_table.find(static_cast<HashedType>(probe_column_element.value));
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            auto& matching_rows = batch_matching_rows[partition_offset - batch_begin];
+            matching_rows = hash_table.positions(batch_offsets[partition_offset - batch_begin]);
+            if (matching_rows.first != matching_rows.second) {
+              __builtin_prefetch(&*matching_rows.first);
+            }
+          }
 
-          if (primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end) {
-            // Key exists, thus we have at least one hit for the primary predicate
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            const auto& probe_column_element = elements[partition_offset];
 
-            // Since we cannot store NULL values directly in off-the-shelf containers,
-            // we need to the check the NULL bit vector here because a NULL value (represented
-            // as a zero) yields the same rows as an actual zero value.
-            // For inner joins, we skip NULL values and output them for outer joins.
-            // Note: If the materialization/radix partitioning phase did not explicitly consider
-            // NULL values, they will not be handed to the probe function.
-            if constexpr (keep_null_values) {
-              if (null_values[partition_offset]) {
-                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                // ignore found matches and continue with next probe item
-                continue;
-              }
+            if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
+              // From previous joins, we could potentially have NULL values that do not refer to
+              // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
+              continue;
             }
 
-            // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
-            // lists.
-            if (!multi_predicate_join_evaluator) {
-              for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
-                   ++primary_predicate_matching_rows_iter) {
-                const auto row_id = *primary_predicate_matching_rows_iter;
-                pos_list_build_side_local.emplace_back(row_id);
-                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-              }
-            } else {
-              auto match_found = false;
-              for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
-                   ++primary_predicate_matching_rows_iter) {
-                const auto row_id = *primary_predicate_matching_rows_iter;
-                if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                  pos_list_build_side_local.emplace_back(row_id);
+            auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
+                batch_matching_rows[partition_offset - batch_begin];
+
+            if (primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end) {
+              // Key exists, thus we have at least one hit for the primary predicate
+
+              // Since we cannot store NULL values directly in off-the-shelf containers,
+              // we need to the check the NULL bit vector here because a NULL value (represented
+              // as a zero) yields the same rows as an actual zero value.
+              // For inner joins, we skip NULL values and output them for outer joins.
+              // Note: If the materialization/radix partitioning phase did not explicitly consider
+              // NULL values, they will not be handed to the probe function.
+              if constexpr (keep_null_values) {
+                if (null_values[partition_offset]) {
+                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
                   pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                  match_found = true;
+                  // ignore found matches and continue with next probe item
+                  continue;
                 }
               }
 
-              // We have not found matching items for all predicates.
-              if constexpr (keep_null_values) {
-                if (!match_found) {
-                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+              // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
+              // lists.
+              if (!multi_predicate_join_evaluator) {
+                for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
+                     ++primary_predicate_matching_rows_iter) {
+                  const auto row_id = *primary_predicate_matching_rows_iter;
+                  pos_list_build_side_local.emplace_back(row_id);
                   pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
                 }
+              } else {
+                candidate_row_ids.assign(primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end);
+                multi_predicate_join_evaluator->filter_left_rows(candidate_row_ids, probe_column_element.row_id);
+                for (const auto& row_id : candidate_row_ids) {
+                  pos_list_build_side_local.emplace_back(row_id);
+                  pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+                }
+
+                // We have not found matching items for all predicates.
+                if constexpr (keep_null_values) {
+                  if (candidate_row_ids.empty()) {
+                    pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                    pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+                  }
+                }
               }
-            }
 
-          } else {
-            // We have not found matching items for the first predicate. Only continue for non-equi join modes.
-            // We use constexpr to prune this conditional for the equi-join implementation.
-            // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
-            // relation since the relations are swapped upfront.
-            if constexpr (keep_null_values) {
-              pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-              pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+            } else {
+              // We have not found matching items for the first predicate. Only continue for non-equi join modes.
+              // We use constexpr to prune this conditional for the equi-join implementation.
+              // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
+              // relation since the relations are swapped upfront.
+              if constexpr (keep_null_values) {
+                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+              }
             }
           }
         }
@@ -794,6 +1103,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         // Accessors are not thread-safe, so we create one evaluator per job
         MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
                                                                    secondary_join_predicates);
+        // The matches of the primary predicate, which are filtered by the secondary predicates as a batch
+        auto candidate_row_ids = std::vector<RowID>{};
 
         for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
@@ -824,17 +1135,12 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
           if (secondary_join_predicates.empty()) {
             any_build_column_value_matches = hash_table.contains(static_cast<HashedType>(probe_column_element.value));
           } else {
-            auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
+            const auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
                 hash_table.find(static_cast<HashedType>(probe_column_element.value));
 
-            for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
-                 ++primary_predicate_matching_rows_iter) {
-              const auto row_id = *primary_predicate_matching_rows_iter;
-              if (multi_predicate_join_evaluator.satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                any_build_column_value_matches = true;
-                break;
-              }
-            }
+            candidate_row_ids.assign(primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end);
+            multi_predicate_join_evaluator.filter_left_rows(candidate_row_ids, probe_column_element.row_id);
+            any_build_column_value_matches = !candidate_row_ids.empty();
           }
 
           if ((mode == JoinMode::Semi && any_build_column_value_matches) ||
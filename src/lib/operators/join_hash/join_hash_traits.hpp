@@ -3,6 +3,8 @@
 #include <string>
 #include <type_traits>
 
+#include "utils/hash_functions.hpp"
+
 namespace opossum {
 
 // JoinHashTraits
@@ -38,4 +40,11 @@ struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, pmr_string> || st
   using HashType = pmr_string;
 };
 
+// JoinHashFunction
+
+// The hash function of the radix partitioning, the bloom filters, and the hash tables. Its upper bits must be as good
+// as its lower bits, as the second bloom filter slot is taken from them (see bloom_filter_second_slot).
+template <typename HashedType>
+using JoinHashFunction = KeyHash<HashedType>;
+
 }  // namespace opossum
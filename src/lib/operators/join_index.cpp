@@ -5,14 +5,18 @@
 #include <numeric>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -46,6 +50,18 @@ bool JoinIndex::supports(const JoinConfiguration config) {
   }
 }
 
+bool JoinIndex::uses_table_index(const JoinMode mode, const IndexSide index_side) {
+  const auto is_semi_or_anti_join =
+      mode == JoinMode::Semi || mode == JoinMode::AntiNullAsFalse || mode == JoinMode::AntiNullAsTrue;
+  const auto tracks_index_matches = mode == JoinMode::FullOuter ||
+                                    (mode == JoinMode::Left && index_side == IndexSide::Left) ||
+                                    (mode == JoinMode::Right && index_side == IndexSide::Right) ||
+                                    (is_semi_or_anti_join && index_side == IndexSide::Left);
+
+  // For AntiNullAsTrue, NULL values on the index side match every probe row, but they are not stored in a TableIndex
+  return !tracks_index_matches && mode != JoinMode::AntiNullAsTrue && mode != JoinMode::Cross;
+}
+
 JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator>& left,
                      const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                      const OperatorJoinPredicate& primary_predicate,
@@ -147,9 +163,31 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
   auto index_joining_duration = std::chrono::nanoseconds{0};
   auto nested_loop_joining_duration = std::chrono::nanoseconds{0};
+  const auto table_index = _find_usable_table_index();
+
   Timer timer;
-  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
-      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
+  if (table_index) {  // DATA JOIN USING A TABLE INDEX
+    const auto index_get_table =
+        std::static_pointer_cast<const GetTable>(_index_side == IndexSide::Left ? left_input() : right_input());
+
+    // Scan all chunks from the probe side input
+    const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+    for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+      const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+      segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+        _data_join_segment_using_table_index(probe_iter, probe_end, probe_chunk_id, *table_index, *index_get_table,
+                                             track_probe_matches, is_semi_or_anti_join);
+      });
+    }
+    index_joining_duration += timer.lap();
+    join_index_performance_data.chunks_scanned_with_index += _index_input_table->chunk_count();
+
+    _append_matches_non_inner(is_semi_or_anti_join);
+  } else if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
+             _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
@@ -167,12 +205,9 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       if (reference_segment_pos_list->references_single_chunk()) {
         const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
         Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
+        const auto index = _find_usable_index(index_data_table_chunk->get_indexes(index_data_table_column_ids));
 
-        if (!indexes.empty()) {
-          // We assume the first index to be efficient for our join
-          // as we do not want to spend time on evaluating the best index inside of this join loop
-          const auto& index = indexes.front();
+        if (index) {
 
           // Scan all chunks from the probe side input
           const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
@@ -206,13 +241,10 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
+      const auto index = _find_usable_index(
+          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second}));
 
-      if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
+      if (index) {
 
         // Scan all chunks from the probe side input
         const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
@@ -352,6 +384,92 @@ void JoinIndex::_reference_join_two_segments_using_index(
   }
 }
 
+template <typename ProbeIterator>
+void JoinIndex::_data_join_segment_using_table_index(ProbeIterator probe_iter, ProbeIterator probe_end,
+                                                     const ChunkID probe_chunk_id, const TableIndex& table_index,
+                                                     const GetTable& index_get_table, const bool track_probe_matches,
+                                                     const bool is_semi_or_anti_join) {
+  // Returns true if the match completes the probe row, i.e., for semi and anti joins
+  const auto append_match = [&](const ChunkOffset probe_chunk_offset, const RowID& stored_row_id) {
+    // The index refers to the chunks of the stored table, see IndexScan::_scan_table_index()
+    const auto index_chunk_id = index_get_table.output_chunk_id(stored_row_id.chunk_id);
+    if (index_chunk_id == INVALID_CHUNK_ID) return false;
+
+    if (track_probe_matches) _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+    if (is_semi_or_anti_join) return true;
+
+    _probe_pos_list->emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
+    _index_pos_list->emplace_back(RowID{index_chunk_id, stored_row_id.chunk_offset});
+    return false;
+  };
+
+  // Equi joins on columns of the same data type (e.g., on foreign keys) look up all values of the probe segment at
+  // once, which visits the index in sorted order (see TableIndex::lookup_equals()). The matches are not ordered by
+  // the probe rows, which the output of JoinIndex does not guarantee anyway.
+  using ProbeColumnDataType = std::decay_t<decltype((*probe_iter).value())>;
+  if (_adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+      data_type_from_type<ProbeColumnDataType>() == table_index.data_type()) {
+    auto probe_values = std::vector<std::pair<ProbeColumnDataType, ChunkOffset>>{};
+    probe_values.reserve(std::distance(probe_iter, probe_end));
+    for (; probe_iter != probe_end; ++probe_iter) {
+      const auto probe_side_position = *probe_iter;
+      if (probe_side_position.is_null()) continue;
+      probe_values.emplace_back(probe_side_position.value(), probe_side_position.chunk_offset());
+    }
+
+    auto matches = std::vector<std::pair<ChunkOffset, RowID>>{};
+    matches.reserve(probe_values.size());
+    table_index.lookup_equals(std::move(probe_values), matches);
+    for (const auto& [probe_chunk_offset, stored_row_id] : matches) {
+      append_match(probe_chunk_offset, stored_row_id);
+    }
+    return;
+  }
+
+  // The adjusted predicate compares the probe value to the index value, the lookup compares the index value to it
+  const auto predicate_condition = flip_predicate_condition(_adjusted_primary_predicate.predicate_condition);
+
+  auto index_matches = RowIDPosList{};
+  for (; probe_iter != probe_end; ++probe_iter) {
+    const auto probe_side_position = *probe_iter;
+    if (probe_side_position.is_null()) continue;
+
+    index_matches.clear();
+    table_index.lookup(predicate_condition, AllTypeVariant{probe_side_position.value()}, std::nullopt, index_matches);
+
+    for (const auto& stored_row_id : index_matches) {
+      if (append_match(probe_side_position.chunk_offset(), stored_row_id)) break;
+    }
+  }
+}
+
+std::shared_ptr<TableIndex> JoinIndex::_find_usable_table_index() const {
+  if (!uses_table_index(_mode, _index_side) || !_secondary_predicates.empty()) return nullptr;
+  if (!TableIndex::supports(_adjusted_primary_predicate.predicate_condition)) return nullptr;
+
+  const auto index_get_table =
+      std::dynamic_pointer_cast<const GetTable>(_index_side == IndexSide::Left ? left_input() : right_input());
+  if (!index_get_table) return nullptr;
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(index_get_table->table_name());
+  return stored_table->get_table_index(
+      index_get_table->stored_column_id(_adjusted_primary_predicate.column_ids.second));
+}
+
+std::shared_ptr<AbstractIndex> JoinIndex::_find_usable_index(
+    const std::vector<std::shared_ptr<AbstractIndex>>& indexes) const {
+  const auto predicate_condition = _adjusted_primary_predicate.predicate_condition;
+  const auto requires_range_queries =
+      predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals;
+
+  // We assume the first usable index to be efficient for our join as we do not want to spend time on evaluating the
+  // best index inside of this join loop
+  for (const auto& index : indexes) {
+    if (!requires_range_queries || index->supports_range_queries()) return index;
+  }
+  return nullptr;
+}
+
 template <typename SegmentPosition>
 std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition probe_side_position,
                                                            const std::shared_ptr<AbstractIndex>& index) const {
@@ -376,18 +494,15 @@ std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition
 
     switch (_adjusted_primary_predicate.predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({probe_side_position.value()});
-        range_end = index->upper_bound({probe_side_position.value()});
+        std::tie(range_begin, range_end) = index->equal_range({probe_side_position.value()});
         break;
       }
       case PredicateCondition::NotEquals: {
-        // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({probe_side_position.value()});
-        index_ranges.emplace_back(IndexRange{range_begin, range_end});
+        // The index groups the positions by value, so that all other values are before or after the search value
+        const auto [equal_begin, equal_end] = index->equal_range({probe_side_position.value()});
+        index_ranges.emplace_back(IndexRange{index->cbegin(), equal_begin});
 
-        // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({probe_side_position.value()});
+        range_begin = equal_end;
         range_end = index->cend();
         break;
       }
@@ -13,7 +13,9 @@
 
 namespace opossum {
 
+class GetTable;
 class MultiPredicateJoinEvaluator;
+class TableIndex;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -27,11 +29,20 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * If the index side input is a GetTable whose stored table has a TableIndex on the join column, that index is used
+   * instead of the chunk indexes, so that every probe row needs a single lookup. For equi joins, the values of each
+   * probe chunk are looked up at once in sorted order. This requires that the matches of the index side do not have to
+   * be tracked (see uses_table_index()).
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
   static bool supports(const JoinConfiguration config);
 
+  // Whether a TableIndex on the index side can be used for the join mode. Outer joins that keep the unmatched rows of
+  // the index side, semi and anti joins with the index on the left, and AntiNullAsTrue joins use the chunk indexes.
+  static bool uses_table_index(const JoinMode mode, const IndexSide index_side);
+
   JoinIndex(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
             const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
             const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
@@ -72,6 +83,20 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractIndex>& index,
       const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list);
 
+  template <typename ProbeIterator>
+  void _data_join_segment_using_table_index(ProbeIterator probe_iter, ProbeIterator probe_end,
+                                            const ChunkID probe_chunk_id, const TableIndex& table_index,
+                                            const GetTable& index_get_table, const bool track_probe_matches,
+                                            const bool is_semi_or_anti_join);
+
+  // Returns the TableIndex of the stored table on the index side column if the index side input is a GetTable and the
+  // index can be used for the join, or nullptr.
+  std::shared_ptr<TableIndex> _find_usable_table_index() const;
+
+  // Returns the first index that supports the predicate condition, i.e., that supports range queries for conditions
+  // other than Equals and NotEquals, or nullptr.
+  std::shared_ptr<AbstractIndex> _find_usable_index(const std::vector<std::shared_ptr<AbstractIndex>>& indexes) const;
+
   template <typename SegmentPosition>
   std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
                                                   const std::shared_ptr<AbstractIndex>& index) const;
@@ -0,0 +1,381 @@
+#include "join_inequality.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "join_nested_loop.hpp"
+#include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_inequality_predicate_condition(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+// Placeholder for the value of the second predicate if there is none
+struct NoValue {};
+
+// The values of a row in the columns of the primary predicate (x) and the secondary predicate evaluated using the bit
+// array (y). Rows with NULL values are not materialized, as they never match.
+template <typename X, typename Y>
+struct MaterializedRow {
+  X x;
+  Y y;
+  RowID row_id;
+};
+
+template <typename X, typename Y>
+std::vector<MaterializedRow<X, Y>> materialize(const Table& table, const ColumnID x_column_id,
+                                               const ColumnID y_column_id) {
+  auto rows = std::vector<MaterializedRow<X, Y>>{};
+  rows.reserve(table.row_count());
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto first_row_index = rows.size();
+    segment_iterate<X>(*chunk->get_segment(x_column_id), [&](const auto& position) {
+      if (position.is_null()) return;
+      rows.push_back({position.value(), Y{}, RowID{chunk_id, position.chunk_offset()}});
+    });
+
+    if constexpr (!std::is_same_v<Y, NoValue>) {
+      // The positions are iterated in the order of their chunk offsets, so the rows of the chunk are completed (or
+      // removed for NULL values) in a single pass
+      auto read_index = first_row_index;
+      auto write_index = first_row_index;
+      segment_iterate<Y>(*chunk->get_segment(y_column_id), [&](const auto& position) {
+        if (read_index == rows.size() || rows[read_index].row_id.chunk_offset != position.chunk_offset()) return;
+        if (!position.is_null()) {
+          rows[write_index] = std::move(rows[read_index]);
+          rows[write_index].y = position.value();
+          ++write_index;
+        }
+        ++read_index;
+      });
+      rows.erase(rows.begin() + write_index, rows.end());
+    }
+  }
+
+  return rows;
+}
+
+// Returns the range [begin, end) of `sorted_rows` whose values satisfy `value <predicate_condition> row value`.
+// `sorted_rows` has to be sorted by these values, which are projected from the rows by `get_value`.
+template <typename Rows, typename Value, typename GetValue>
+std::pair<size_t, size_t> satisfying_range(const Rows& sorted_rows, const Value& value,
+                                           const PredicateCondition predicate_condition, const GetValue& get_value) {
+  const auto lower_bound = [&]() {
+    const auto iter = std::lower_bound(sorted_rows.cbegin(), sorted_rows.cend(), value,
+                                       [&](const auto& row, const auto& other) { return get_value(row) < other; });
+    return static_cast<size_t>(std::distance(sorted_rows.cbegin(), iter));
+  };
+  const auto upper_bound = [&]() {
+    const auto iter = std::upper_bound(sorted_rows.cbegin(), sorted_rows.cend(), value,
+                                       [&](const auto& other, const auto& row) { return other < get_value(row); });
+    return static_cast<size_t>(std::distance(sorted_rows.cbegin(), iter));
+  };
+
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      return {upper_bound(), sorted_rows.size()};
+    case PredicateCondition::LessThanEquals:
+      return {lower_bound(), sorted_rows.size()};
+    case PredicateCondition::GreaterThan:
+      return {0, lower_bound()};
+    case PredicateCondition::GreaterThanEquals:
+      return {0, upper_bound()};
+    default:
+      Fail("Predicate condition is not an inequality.");
+  }
+}
+
+/**
+ * Calls `emit(left_row_id, right_row_id)` for the pairs of rows that satisfy `x_predicate` and, if Y is not NoValue,
+ * `y_predicate`. `emit` returns whether the pair is a match (i.e., satisfies the remaining predicates). If
+ * `first_match_only` is set, the search for a left row ends with its first match.
+ */
+template <typename X, typename Y, typename Emit>
+void __attribute__((noinline))
+join_inputs(const Table& left_table, const Table& right_table, const OperatorJoinPredicate& x_predicate,
+            const OperatorJoinPredicate& y_predicate, const bool first_match_only,
+            JoinInequality::PerformanceData& performance_data, const Emit& emit) {
+  Timer timer;
+
+  auto left_rows = materialize<X, Y>(left_table, x_predicate.column_ids.first, y_predicate.column_ids.first);
+  auto right_rows = materialize<X, Y>(right_table, x_predicate.column_ids.second, y_predicate.column_ids.second);
+
+  const auto sort_by_x = [](auto& rows) {
+    std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.x < rhs.x; });
+  };
+  sort_by_x(left_rows);
+
+  if constexpr (std::is_same_v<Y, NoValue>) {
+    sort_by_x(right_rows);
+    performance_data.set_step_runtime(JoinInequality::OperatorSteps::Sorting, timer.lap());
+
+    // The right rows that satisfy the predicate for a left row are a prefix or a suffix of the sorted rows
+    const auto get_x = [](const auto& row) -> const X& { return row.x; };
+    for (const auto& left_row : left_rows) {
+      const auto [begin, end] = satisfying_range(right_rows, left_row.x, x_predicate.predicate_condition, get_x);
+      for (auto right_index = begin; right_index < end; ++right_index) {
+        if (emit(left_row.row_id, right_rows[right_index].row_id) && first_match_only) break;
+      }
+    }
+  } else {
+    // The right rows are ranked by y. The permutation `ranks_by_x` lists the ranks in the order of x.
+    std::sort(right_rows.begin(), right_rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.y < rhs.y; });
+    auto ranks_by_x = std::vector<size_t>(right_rows.size());
+    std::iota(ranks_by_x.begin(), ranks_by_x.end(), size_t{0});
+    std::sort(ranks_by_x.begin(), ranks_by_x.end(),
+              [&](const auto lhs, const auto rhs) { return right_rows[lhs].x < right_rows[rhs].x; });
+    performance_data.set_step_runtime(JoinInequality::OperatorSteps::Sorting, timer.lap());
+
+    // The left rows are visited so that the right rows satisfying x_predicate only grow: For `left.x < right.x`, in
+    // descending order of x, for `left.x > right.x`, in ascending order. Each right row is marked in the bit array
+    // once it satisfies x_predicate for the current left row.
+    const auto descending = x_predicate.predicate_condition == PredicateCondition::LessThan ||
+                            x_predicate.predicate_condition == PredicateCondition::LessThanEquals;
+    auto bits = std::vector<uint64_t>((right_rows.size() + 63) / 64);
+    auto marked_count = size_t{0};
+
+    const auto get_y = [](const auto& row) -> const Y& { return row.y; };
+    with_comparator(x_predicate.predicate_condition, [&](const auto& x_comparator) {
+      for (auto left_index = size_t{0}; left_index < left_rows.size(); ++left_index) {
+        const auto& left_row = left_rows[descending ? left_rows.size() - 1 - left_index : left_index];
+
+        while (marked_count < ranks_by_x.size()) {
+          const auto rank = ranks_by_x[descending ? ranks_by_x.size() - 1 - marked_count : marked_count];
+          if (!x_comparator(left_row.x, right_rows[rank].x)) break;
+          bits[rank / 64] |= uint64_t{1} << (rank % 64);
+          ++marked_count;
+        }
+        if (marked_count == 0) continue;
+
+        // Scan the marked ranks of the right rows that satisfy y_predicate
+        const auto [begin, end] = satisfying_range(right_rows, left_row.y, y_predicate.predicate_condition, get_y);
+        if (begin == end) continue;
+        for (auto word_index = begin / 64; word_index <= (end - 1) / 64; ++word_index) {
+          auto word = bits[word_index];
+          if (word_index == begin / 64) word &= ~uint64_t{0} << (begin % 64);
+          if (word_index == (end - 1) / 64 && end % 64 != 0) word &= ~uint64_t{0} >> (64 - end % 64);
+
+          auto found_match = false;
+          while (word) {
+            const auto rank = word_index * 64 + std::countr_zero(word);
+            if (emit(left_row.row_id, right_rows[rank].row_id) && first_match_only) {
+              found_match = true;
+              break;
+            }
+            word &= word - 1;
+          }
+          if (found_match) break;
+        }
+      }
+    });
+  }
+
+  performance_data.set_step_runtime(JoinInequality::OperatorSteps::Joining, timer.lap());
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool JoinInequality::supports(const JoinConfiguration config) {
+  return is_inequality_predicate_condition(config.predicate_condition) &&
+         config.left_data_type == config.right_data_type && config.join_mode != JoinMode::AntiNullAsTrue &&
+         config.join_mode != JoinMode::Cross;
+}
+
+JoinInequality::JoinInequality(const std::shared_ptr<const AbstractOperator>& left,
+                               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                               const OperatorJoinPredicate& primary_predicate,
+                               const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinInequality, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<PerformanceData>()) {}
+
+const std::string& JoinInequality::name() const {
+  static const auto name = std::string{"JoinInequality"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> JoinInequality::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinInequality>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                          _secondary_predicates);
+}
+
+std::shared_ptr<const Table> JoinInequality::_on_execute() {
+  Assert(supports({_mode, _primary_predicate.predicate_condition,
+                   left_input_table()->column_data_type(_primary_predicate.column_ids.first),
+                   right_input_table()->column_data_type(_primary_predicate.column_ids.second),
+                   !_secondary_predicates.empty(), left_input_table()->type(), right_input_table()->type()}),
+         "JoinInequality doesn't support these parameters");
+
+  auto left_table = left_input_table();
+  auto right_table = right_input_table();
+  auto primary_predicate = _primary_predicate;
+  auto secondary_predicates = _secondary_predicates;
+
+  // For Right Outer we swap the tables so we have the outer on the "left"
+  if (_mode == JoinMode::Right) {
+    std::swap(left_table, right_table);
+    primary_predicate.flip();
+    for (auto& secondary_predicate : secondary_predicates) {
+      secondary_predicate.flip();
+    }
+  }
+
+  // The first secondary inequality on columns of the same data type is evaluated using the bit array, the other
+  // secondary predicates for each match
+  auto y_predicate = std::optional<OperatorJoinPredicate>{};
+  auto remaining_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& secondary_predicate : secondary_predicates) {
+    if (!y_predicate && is_inequality_predicate_condition(secondary_predicate.predicate_condition) &&
+        left_table->column_data_type(secondary_predicate.column_ids.first) ==
+            right_table->column_data_type(secondary_predicate.column_ids.second)) {
+      y_predicate = secondary_predicate;
+    } else {
+      remaining_predicates.emplace_back(secondary_predicate);
+    }
+  }
+
+  auto& join_inequality_performance_data = static_cast<PerformanceData&>(*performance_data);
+  join_inequality_performance_data.uses_bit_array = y_predicate.has_value();
+
+  const auto is_outer_join = _mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
+  const auto is_semi_or_anti_join = _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse;
+  const auto track_left_matches = is_outer_join || is_semi_or_anti_join;
+  const auto track_right_matches = _mode == JoinMode::FullOuter;
+
+  const auto create_matches_by_chunk = [](const Table& table) {
+    const auto chunk_count = table.chunk_count();
+    auto matches_by_chunk = std::vector<std::vector<bool>>(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      matches_by_chunk[chunk_id].resize(chunk->size());
+    }
+    return matches_by_chunk;
+  };
+  auto left_matches_by_chunk =
+      track_left_matches ? create_matches_by_chunk(*left_table) : std::vector<std::vector<bool>>{};
+  auto right_matches_by_chunk =
+      track_right_matches ? create_matches_by_chunk(*right_table) : std::vector<std::vector<bool>>{};
+
+  const auto pos_list_left = std::make_shared<RowIDPosList>();
+  const auto pos_list_right = std::make_shared<RowIDPosList>();
+  auto secondary_predicate_evaluator =
+      MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, remaining_predicates};
+
+  const auto emit = [&](const RowID& left_row_id, const RowID& right_row_id) {
+    if (!secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) return false;
+
+    if (track_left_matches) left_matches_by_chunk[left_row_id.chunk_id][left_row_id.chunk_offset] = true;
+    if (track_right_matches) right_matches_by_chunk[right_row_id.chunk_id][right_row_id.chunk_offset] = true;
+
+    // Semi/Anti joins build their output from left_matches_by_chunk
+    if (!is_semi_or_anti_join) {
+      pos_list_left->emplace_back(left_row_id);
+      pos_list_right->emplace_back(right_row_id);
+    }
+    return true;
+  };
+
+  resolve_data_type(left_table->column_data_type(primary_predicate.column_ids.first), [&](const auto x_data_type_t) {
+    using X = typename decltype(x_data_type_t)::type;
+    if (!y_predicate) {
+      join_inputs<X, NoValue>(*left_table, *right_table, primary_predicate, primary_predicate, is_semi_or_anti_join,
+                              join_inequality_performance_data, emit);
+      return;
+    }
+
+    resolve_data_type(left_table->column_data_type(y_predicate->column_ids.first), [&](const auto y_data_type_t) {
+      using Y = typename decltype(y_data_type_t)::type;
+      join_inputs<X, Y>(*left_table, *right_table, primary_predicate, *y_predicate, is_semi_or_anti_join,
+                        join_inequality_performance_data, emit);
+    });
+  });
+
+  Timer timer;
+
+  // Add the unmatched rows for outer joins
+  const auto add_unmatched_rows = [](const std::vector<std::vector<bool>>& matches_by_chunk, RowIDPosList& pos_list,
+                                     RowIDPosList& other_pos_list) {
+    const auto chunk_count = ChunkID{static_cast<uint32_t>(matches_by_chunk.size())};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk_size = static_cast<ChunkOffset>(matches_by_chunk[chunk_id].size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (matches_by_chunk[chunk_id][chunk_offset]) continue;
+        pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+        other_pos_list.emplace_back(NULL_ROW_ID);
+      }
+    }
+  };
+  if (is_outer_join) add_unmatched_rows(left_matches_by_chunk, *pos_list_left, *pos_list_right);
+  if (_mode == JoinMode::FullOuter) add_unmatched_rows(right_matches_by_chunk, *pos_list_right, *pos_list_left);
+
+  if (is_semi_or_anti_join) {
+    const auto invert = _mode == JoinMode::AntiNullAsFalse;
+    const auto chunk_count = left_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk_size = static_cast<ChunkOffset>(left_matches_by_chunk[chunk_id].size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (left_matches_by_chunk[chunk_id][chunk_offset] ^ invert) {
+          pos_list_left->emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+
+  // Write the output chunk based on the PosLists, see JoinNestedLoop
+  auto segments = Segments{};
+  if (is_semi_or_anti_join) {
+    JoinNestedLoop::_write_output_chunk(segments, left_table, pos_list_left);
+  } else if (_mode == JoinMode::Right) {
+    JoinNestedLoop::_write_output_chunk(segments, right_table, pos_list_right);
+    JoinNestedLoop::_write_output_chunk(segments, left_table, pos_list_left);
+  } else {
+    JoinNestedLoop::_write_output_chunk(segments, left_table, pos_list_left);
+    JoinNestedLoop::_write_output_chunk(segments, right_table, pos_list_right);
+  }
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  if (segments.at(0)->size() > 0) {
+    chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+  }
+  join_inequality_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return _build_output_table(std::move(chunks));
+}
+
+void JoinInequality::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  if (uses_bit_array) {
+    stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n")
+           << "Secondary predicate evaluated using the bit array.";
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Join for inequality predicates (<, <=, >, >=), e.g., interval and band joins such as
+ * `a.ts BETWEEN b.start AND b.end`, following the IEJoin algorithm (Khayyat et al., "Lightning Fast and Space
+ * Efficient Inequality Joins", VLDB 2015).
+ *
+ * Both inputs are materialized and sorted by the columns of the primary predicate. If the first secondary predicate
+ * that is an inequality compares columns of the same data type, the rows of the right input are additionally ranked
+ * by that column. While the left rows are visited in the order of the primary predicate, a bit array marks the ranks
+ * of the right rows that satisfy the primary predicate for the current left row. The rows that satisfy both
+ * predicates are then the set bits in a range of ranks, which is scanned a word (64 rows) at a time. Thus, the join
+ * needs O(n * log(n) + m * log(m) + n * m / 64 + output) operations instead of the O(n * m) predicate evaluations of
+ * the JoinNestedLoop. With a single inequality predicate, the matches of a left row are a range of the sorted right
+ * rows. The other secondary predicates are evaluated for the matches.
+ *
+ * Rows with NULL values in the columns of the (indexed) predicates never match. Thus, AntiNullAsTrue is not supported.
+ */
+class JoinInequality : public AbstractJoinOperator {
+ public:
+  static bool supports(const JoinConfiguration config);
+
+  JoinInequality(const std::shared_ptr<const AbstractOperator>& left,
+                 const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                 const OperatorJoinPredicate& primary_predicate,
+                 const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
+
+  const std::string& name() const override;
+
+  enum class OperatorSteps : uint8_t { Sorting, Joining, OutputWriting };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Set if a secondary predicate was evaluated using the bit array
+    bool uses_bit_array{false};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+};
+
+}  // namespace opossum
@@ -1,11 +1,17 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -68,6 +74,116 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
     }
   }
 }
+
+// The values of a segment of a join column in contiguous memory. NULLs are stored as bytes rather than in a
+// std::vector<bool> so that the comparisons in join_materialized_segments() can be vectorized.
+template <typename T>
+struct MaterializedSegment {
+  std::vector<T> values;
+  std::vector<uint8_t> null_values;
+};
+
+template <typename T>
+std::vector<MaterializedSegment<T>> materialize_segments(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  auto materialized_segments = std::vector<MaterializedSegment<T>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto& segment = *chunk->get_segment(column_id);
+      auto& materialized_segment = materialized_segments[chunk_id];
+      materialized_segment.values.reserve(segment.size());
+      materialized_segment.null_values.reserve(segment.size());
+      segment_iterate<T>(segment, [&](const auto& position) {
+        materialized_segment.values.emplace_back(position.is_null() ? T{} : position.value());
+        materialized_segment.null_values.emplace_back(position.is_null());
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return materialized_segments;
+}
+
+// Joins two materialized segments. The right segment is processed in tiles of TILE_SIZE values that stay in the L1
+// cache while all left values are compared with them. The comparisons of a left value with a block of 64 right values
+// are combined into a bit mask without branches, which the compiler vectorizes. Only the set bits are then checked
+// against the secondary predicates. In contrast to join_two_typed_segments(), the matches of a left row are not
+// written at once, but by tile.
+template <typename BinaryFunctor, typename T>
+void __attribute__((noinline))
+join_materialized_segments(const BinaryFunctor& func, const MaterializedSegment<T>& left,
+                           const MaterializedSegment<T>& right, const ChunkID chunk_id_left,
+                           const ChunkID chunk_id_right, const JoinNestedLoop::JoinParams& params) {
+  constexpr auto BLOCK_SIZE = size_t{64};
+  constexpr auto TILE_SIZE = size_t{16} * BLOCK_SIZE;
+
+  // See join_two_typed_segments() for the handling of NULLs
+  const auto null_is_match = params.mode == JoinMode::AntiNullAsTrue;
+  // Semi and anti joins only need to know whether a left row has a match
+  const auto first_match_only = !params.write_pos_lists && !params.track_right_matches;
+
+  const auto left_size = left.values.size();
+  const auto right_size = right.values.size();
+  for (auto tile_begin = size_t{0}; tile_begin < right_size; tile_begin += TILE_SIZE) {
+    const auto tile_end = std::min(tile_begin + TILE_SIZE, right_size);
+
+    for (auto left_offset = size_t{0}; left_offset < left_size; ++left_offset) {
+      const auto left_is_null = left.null_values[left_offset] != 0;
+      if (left_is_null && !null_is_match) continue;
+      if (first_match_only && params.left_matches[left_offset]) continue;
+
+      const auto& left_value = left.values[left_offset];
+      const auto left_row_id = RowID{chunk_id_left, static_cast<ChunkOffset>(left_offset)};
+
+      for (auto block_begin = tile_begin; block_begin < tile_end; block_begin += BLOCK_SIZE) {
+        const auto block_size = std::min(BLOCK_SIZE, tile_end - block_begin);
+        const auto* const right_values = right.values.data() + block_begin;
+        const auto* const right_null_values = right.null_values.data() + block_begin;
+
+        auto matches = uint64_t{0};
+        if (left_is_null) {
+          matches = block_size == BLOCK_SIZE ? ~uint64_t{0} : (uint64_t{1} << block_size) - 1;
+        } else if (null_is_match) {
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            matches |= static_cast<uint64_t>(func(left_value, right_values[index]) | right_null_values[index])
+                       << index;
+          }
+        } else {
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            matches |= static_cast<uint64_t>(func(left_value, right_values[index]) & (right_null_values[index] ^ 1))
+                       << index;
+          }
+        }
+
+        while (matches) {
+          const auto right_row_id =
+              RowID{chunk_id_right, static_cast<ChunkOffset>(block_begin + std::countr_zero(matches))};
+          matches &= matches - 1;
+          if (params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
+            process_match(left_row_id, right_row_id, params);
+            if (first_match_only) break;
+          }
+        }
+        if (first_match_only && params.left_matches[left_offset]) break;
+      }
+    }
+  }
+}
+
+// The matches of a job, which joins a left chunk with a block of right chunks
+struct JobResult {
+  RowIDPosList pos_list_left;
+  RowIDPosList pos_list_right;
+  std::vector<bool> left_matches;
+  std::vector<std::vector<bool>> right_matches;
+};
+
 }  // namespace
 
 namespace opossum {
@@ -125,10 +241,6 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     }
   }
 
-  // Track pairs of matching RowIDs
-  const auto pos_list_left = std::make_shared<RowIDPosList>();
-  const auto pos_list_right = std::make_shared<RowIDPosList>();
-
   const auto is_outer_join = _mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
   const auto is_semi_or_anti_join =
       _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
@@ -136,51 +248,170 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
   const auto track_left_matches = is_outer_join || is_semi_or_anti_join;
   const auto track_right_matches = _mode == JoinMode::FullOuter;
 
-  auto left_matches_by_chunk = std::vector<std::vector<bool>>(left_table->chunk_count());
-
-  auto right_matches_by_chunk = std::vector<std::vector<bool>>(right_table->chunk_count());
+  const auto chunk_count_left = left_table->chunk_count();
   const auto chunk_count_right = right_table->chunk_count();
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+
+  // If both join columns have the same data type, their values are materialized and joined by the blocked kernel of
+  // join_materialized_segments(). Otherwise, the segments are joined by _join_two_untyped_segments().
+  auto join_chunk_pair = std::function<void(const ChunkID, const ChunkID, JoinParams&)>{};
+  const auto left_data_type = left_table->column_data_type(left_column_id);
+  if (left_data_type == right_table->column_data_type(right_column_id)) {
+    resolve_data_type(left_data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto materialized_left_segments = std::make_shared<std::vector<MaterializedSegment<ColumnDataType>>>(
+          materialize_segments<ColumnDataType>(*left_table, left_column_id));
+      const auto materialized_right_segments = std::make_shared<std::vector<MaterializedSegment<ColumnDataType>>>(
+          materialize_segments<ColumnDataType>(*right_table, right_column_id));
+
+      join_chunk_pair = [materialized_left_segments, materialized_right_segments](
+                            const ChunkID chunk_id_left, const ChunkID chunk_id_right, JoinParams& params) {
+        with_comparator(params.predicate_condition, [&](auto comparator) {
+          join_materialized_segments(comparator, (*materialized_left_segments)[chunk_id_left],
+                                     (*materialized_right_segments)[chunk_id_right], chunk_id_left, chunk_id_right,
+                                     params);
+        });
+      };
+    });
+  } else {
+    join_chunk_pair = [&](const ChunkID chunk_id_left, const ChunkID chunk_id_right, JoinParams& params) {
+      const auto chunk_left = left_table->get_chunk(chunk_id_left);
+      const auto chunk_right = right_table->get_chunk(chunk_id_right);
+      Assert(chunk_left && chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      _join_two_untyped_segments(*chunk_left->get_segment(left_column_id), *chunk_right->get_segment(right_column_id),
+                                 chunk_id_left, chunk_id_right, params);
+    };
+  }
+
+  // Each job joins a left chunk with a block of right chunks that hold up to MAX_RIGHT_ROWS_PER_JOB rows (or a single
+  // larger chunk). The jobs write their own matches, which are combined afterwards.
+  constexpr auto MAX_RIGHT_ROWS_PER_JOB = size_t{16'384};
+  auto right_chunk_blocks = std::vector<std::pair<ChunkID, ChunkID>>{};
+  auto block_row_count = size_t{0};
+  for (auto chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
     const auto chunk_right = right_table->get_chunk(chunk_id_right);
     Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    right_matches_by_chunk[chunk_id_right].resize(chunk_right->size());
+    const auto chunk_size = chunk_right->size();
+    if (right_chunk_blocks.empty() || block_row_count + chunk_size > MAX_RIGHT_ROWS_PER_JOB) {
+      right_chunk_blocks.emplace_back(chunk_id_right, chunk_id_right);
+      block_row_count = 0;
+    }
+    ++right_chunk_blocks.back().second;
+    block_row_count += chunk_size;
   }
 
-  auto secondary_predicate_evaluator =
-      MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+  const auto job_count = static_cast<size_t>(chunk_count_left) * right_chunk_blocks.size();
+  auto job_results = std::vector<JobResult>(job_count);
+  _set_total_chunk_count(chunk_count_left);
 
-  // Scan all chunks from left input
-  const auto chunk_count_left = left_table->chunk_count();
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+  const auto join_block = [&](const ChunkID chunk_id_left, const size_t block_index) {
+    if (is_cancelled()) return;
     const auto chunk_left = left_table->get_chunk(chunk_id_left);
     Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    auto segment_left = chunk_left->get_segment(left_column_id);
-
-    std::vector<bool> left_matches;
-
+    const auto [begin_chunk_id_right, end_chunk_id_right] = right_chunk_blocks[block_index];
+    auto& job_result = job_results[chunk_id_left * right_chunk_blocks.size() + block_index];
     if (track_left_matches) {
-      left_matches.resize(segment_left->size());
+      job_result.left_matches.resize(chunk_left->size());
+    }
+    if (track_right_matches) {
+      job_result.right_matches.resize(end_chunk_id_right - begin_chunk_id_right);
     }
 
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-      const auto chunk_right = right_table->get_chunk(chunk_id_right);
-      Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    // As accessors are not thread-safe, each job evaluates the secondary predicates with its own evaluator
+    auto secondary_predicate_evaluator =
+        MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+    auto untracked_right_matches = std::vector<bool>{};
 
-      const auto segment_right = chunk_right->get_segment(right_column_id);
+    for (auto chunk_id_right = begin_chunk_id_right; chunk_id_right < end_chunk_id_right; ++chunk_id_right) {
+      auto& right_matches = track_right_matches ? job_result.right_matches[chunk_id_right - begin_chunk_id_right]
+                                                : untracked_right_matches;
+      if (track_right_matches) {
+        right_matches.resize(right_table->get_chunk(chunk_id_right)->size());
+      }
 
-      JoinParams params{*pos_list_left,
-                        *pos_list_right,
-                        left_matches,
-                        right_matches_by_chunk[chunk_id_right],
+      JoinParams params{job_result.pos_list_left,
+                        job_result.pos_list_right,
+                        job_result.left_matches,
+                        right_matches,
                         track_left_matches,
                         track_right_matches,
                         _mode,
                         maybe_flipped_predicate_condition,
                         secondary_predicate_evaluator,
                         !is_semi_or_anti_join};
-      _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+      join_chunk_pair(chunk_id_left, chunk_id_right, params);
+    }
+
+    if (block_index + 1 == right_chunk_blocks.size()) {
+      _add_processed_chunks();
+    }
+  };
+
+  if (job_count == 1) {
+    join_block(ChunkID{0}, 0);
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+      for (auto block_index = size_t{0}; block_index < right_chunk_blocks.size(); ++block_index) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left, block_index]() {
+          join_block(chunk_id_left, block_index);
+        }));
+      }
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  // The matches of the remaining chunks are unknown, the incomplete output is discarded
+  if (is_cancelled()) return _build_output_table({});
+
+  // Combine the matches of the jobs
+  const auto pos_list_left = std::make_shared<RowIDPosList>();
+  const auto pos_list_right = std::make_shared<RowIDPosList>();
+  auto output_row_count = size_t{0};
+  for (const auto& job_result : job_results) {
+    output_row_count += job_result.pos_list_left.size();
+  }
+  pos_list_left->reserve(output_row_count);
+  pos_list_right->reserve(output_row_count);
+
+  const auto combine_matches = [](std::vector<bool>& matches, const std::vector<bool>& job_matches) {
+    for (auto chunk_offset = size_t{0}; chunk_offset < job_matches.size(); ++chunk_offset) {
+      if (job_matches[chunk_offset]) matches[chunk_offset] = true;
+    }
+  };
+
+  auto left_matches_by_chunk = std::vector<std::vector<bool>>(chunk_count_left);
+  if (track_left_matches) {
+    for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+      left_matches_by_chunk[chunk_id_left].resize(left_table->get_chunk(chunk_id_left)->size());
+    }
+  }
+  auto right_matches_by_chunk = std::vector<std::vector<bool>>(chunk_count_right);
+  if (track_right_matches) {
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+      right_matches_by_chunk[chunk_id_right].resize(right_table->get_chunk(chunk_id_right)->size());
+    }
+  }
+
+  for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+    auto& left_matches = left_matches_by_chunk[chunk_id_left];
+
+    for (auto block_index = size_t{0}; block_index < right_chunk_blocks.size(); ++block_index) {
+      const auto& job_result = job_results[chunk_id_left * right_chunk_blocks.size() + block_index];
+      pos_list_left->insert(pos_list_left->end(), job_result.pos_list_left.cbegin(), job_result.pos_list_left.cend());
+      pos_list_right->insert(pos_list_right->end(), job_result.pos_list_right.cbegin(),
+                             job_result.pos_list_right.cend());
+
+      combine_matches(left_matches, job_result.left_matches);
+      const auto begin_chunk_id_right = right_chunk_blocks[block_index].first;
+      for (auto block_offset = size_t{0}; block_offset < job_result.right_matches.size(); ++block_offset) {
+        combine_matches(right_matches_by_chunk[begin_chunk_id_right + block_offset],
+                        job_result.right_matches[block_offset]);
+      }
     }
 
     if (is_outer_join) {
@@ -192,8 +423,6 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
         }
       }
     }
-
-    left_matches_by_chunk[chunk_id_left] = std::move(left_matches);
   }
 
   // For Full Outer we need to add all unmatched rows for the right side.
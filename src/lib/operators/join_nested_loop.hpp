@@ -14,6 +14,7 @@
 namespace opossum {
 
 class JoinIndex;
+class JoinInequality;
 
 class JoinNestedLoop : public AbstractJoinOperator {
  public:
@@ -64,6 +65,9 @@ class JoinNestedLoop : public AbstractJoinOperator {
 
   // The JoinIndex uses this join as a fallback if no index exists
   friend class JoinIndex;
+
+  // The JoinInequality writes its output like this join
+  friend class JoinInequality;
 };
 
 }  // namespace opossum
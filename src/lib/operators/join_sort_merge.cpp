@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -769,13 +770,40 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   }
 
   /**
-  * Performs the join on all clusters in parallel.
+  * Joins a single cluster, evaluating the secondary predicates (if any) with its own MultiPredicateJoinEvaluator.
+  **/
+  void _join_cluster_with_evaluator(const size_t cluster_number) {
+    // Accessors are not thread-safe, so we create one evaluator per job
+    std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
+    if (!_secondary_join_predicates.empty()) {
+      multi_predicate_join_evaluator.emplace(*_sort_merge_join._left_input->get_output(),
+                                             *_sort_merge_join.right_input()->get_output(), _mode,
+                                             _secondary_join_predicates);
+    }
+
+    _join_cluster(cluster_number, multi_predicate_join_evaluator);
+  }
+
+  /**
+  * Performs the join on all clusters in parallel. The clusters are handed to the scheduler from the largest to the
+  * smallest, so that idle workers pick up the remaining clusters instead of waiting for a large cluster that was
+  * started last. Clusters that are too small for a job are joined while the jobs run.
   **/
   void _perform_join() {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
+    std::vector<size_t> inline_cluster_numbers;
+
+    auto cluster_numbers = std::vector<size_t>(_cluster_count);
+    std::iota(cluster_numbers.begin(), cluster_numbers.end(), size_t{0});
+    const auto merge_row_count = [&](const size_t cluster_number) {
+      return (*_sorted_left_table)[cluster_number]->size() + (*_sorted_right_table)[cluster_number]->size();
+    };
+    std::stable_sort(cluster_numbers.begin(), cluster_numbers.end(), [&](const auto lhs, const auto rhs) {
+      return merge_row_count(lhs) > merge_row_count(rhs);
+    });
 
     // Parallel join for each cluster
-    for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
+    for (const auto cluster_number : cluster_numbers) {
       // Create output position lists
       _output_pos_lists_left[cluster_number] = std::make_shared<RowIDPosList>();
       _output_pos_lists_right[cluster_number] = std::make_shared<RowIDPosList>();
@@ -787,28 +815,19 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
         }
       }
 
-      const auto merge_row_count =
-          (*_sorted_left_table)[cluster_number]->size() + (*_sorted_right_table)[cluster_number]->size();
-      const auto join_cluster_task = [this, cluster_number] {
-        // Accessors are not thread-safe, so we create one evaluator per job
-        std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
-        if (!_secondary_join_predicates.empty()) {
-          multi_predicate_join_evaluator.emplace(*_sort_merge_join._left_input->get_output(),
-                                                 *_sort_merge_join.right_input()->get_output(), _mode,
-                                                 _secondary_join_predicates);
-        }
-
-        this->_join_cluster(cluster_number, multi_predicate_join_evaluator);
-      };
-
-      if (merge_row_count > JOB_SPAWN_THRESHOLD * 2) {
-        jobs.push_back(std::make_shared<JobTask>(join_cluster_task));
+      if (merge_row_count(cluster_number) > JOB_SPAWN_THRESHOLD * 2) {
+        jobs.push_back(
+            std::make_shared<JobTask>([this, cluster_number] { _join_cluster_with_evaluator(cluster_number); }));
+        jobs.back()->schedule();
       } else {
-        join_cluster_task();
+        inline_cluster_numbers.push_back(cluster_number);
       }
     }
 
-    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    for (const auto cluster_number : inline_cluster_numbers) {
+      _join_cluster_with_evaluator(cluster_number);
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
     // The outer joins for the non-equi cases
     // Note: Equi outer joins can be integrated into the main algorithm, while these can not.
@@ -995,9 +1014,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
 
     auto result_table = _sort_merge_join._build_output_table(std::move(output_chunks));
     if (_mode != JoinMode::Left && _mode != JoinMode::Right && _mode != JoinMode::FullOuter &&
-        _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals) {
+        _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals &&
+        !sort_output.spread_skewed_values) {
       // Table clustering is not defined for columns storing NULL values. Additionally, clustering is not given for
-      // non-equal predicates.
+      // non-equal predicates or if the rows of heavy hitters were spread over multiple clusters.
       result_table->set_value_clustered_by({left_join_column, right_join_column});
     }
 
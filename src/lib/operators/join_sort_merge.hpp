@@ -20,7 +20,11 @@ namespace opossum {
    * i.e., your previous sorting order might be disturbed:
    *     - The output chunks will be sorted by the join columns.
    *     - The whole output table will not necessarily be entirely sorted by the join columns.
-   *     - However, the whole output table will always be clustered by the join columns.
+   *     - However, the whole output table will be clustered by the join columns, unless the rows of heavy hitters
+   *       were spread over multiple clusters (see radix_cluster_sort.hpp).
+   *
+   * If the chunks of an input are individually sorted by its join column (e.g., because the input is a Sort), that
+   * input is not sorted again. Instead, the sorted runs of its chunks are merged (see radix_cluster_sort.hpp).
    */
 class JoinSortMerge : public AbstractJoinOperator {
  public:
@@ -33,6 +37,11 @@ class JoinSortMerge : public AbstractJoinOperator {
 
   const std::string& name() const override;
 
+  // Tasks are added to the scheduler in case the number of elements to process is above JOB_SPAWN_THRESHOLD. If not,
+  // the task is executed directly. This threshold needs to be re-evaluated over time to find the value which gives the
+  // best performance.
+  static constexpr auto JOB_SPAWN_THRESHOLD = 500;
+
   enum class OperatorSteps : uint8_t {
     LeftSideMaterializing,
     RightSideMaterializing,
@@ -56,11 +65,6 @@ class JoinSortMerge : public AbstractJoinOperator {
   friend class JoinSortMergeImpl;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-
-  // Tasks are added to the scheduler in case the number of elements to process is above JOB_SPAWN_THRESHOLD. If not,
-  // the task is executed directly. This threshold needs to be re-evaluated over time to find the value which gives the
-  // best performance.
-  static constexpr auto JOB_SPAWN_THRESHOLD = 500;
 };
 
 }  // namespace opossum
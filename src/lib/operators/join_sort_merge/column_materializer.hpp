@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -32,6 +34,56 @@ using MaterializedSegment = std::vector<MaterializedValue<T>>;
 template <typename T>
 using MaterializedSegmentList = std::vector<std::shared_ptr<MaterializedSegment<T>>>;
 
+/**
+ * Returns the first eight bytes of the string as a big-endian integer, padded with zeros. If the keys of two strings
+ * differ, they are ordered like the strings themselves (bytes are compared as unsigned chars, as std::string does).
+ * Equal keys do not imply equal strings.
+ */
+inline uint64_t order_preserving_string_prefix(const pmr_string& string) {
+  auto key = uint64_t{0};
+  const auto prefix_length = std::min(string.size(), sizeof(uint64_t));
+  for (auto index = size_t{0}; index < prefix_length; ++index) {
+    key |= static_cast<uint64_t>(static_cast<unsigned char>(string[index])) << (56 - 8 * index);
+  }
+  return key;
+}
+
+/**
+ * Sorts the materialized values by their value. Comparing strings requires following their pointers (unless they are
+ * short enough for the small string buffer) and a byte-wise comparison. For strings, we thus sort fixed-width keys (see
+ * order_preserving_string_prefix) together with the index of their value and only compare the full strings on ties.
+ * Dictionary segments do not need this as they are sorted via their value ids (see ColumnMaterializer).
+ */
+template <typename T>
+void sort_materialized_segment(MaterializedSegment<T>& segment) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    struct NormalizedKey {
+      uint64_t prefix;
+      size_t index;
+    };
+
+    auto normalized_keys = std::vector<NormalizedKey>(segment.size());
+    for (auto index = size_t{0}; index < segment.size(); ++index) {
+      normalized_keys[index] = NormalizedKey{order_preserving_string_prefix(segment[index].value), index};
+    }
+
+    std::sort(normalized_keys.begin(), normalized_keys.end(), [&](const auto& left, const auto& right) {
+      if (left.prefix != right.prefix) return left.prefix < right.prefix;
+      return segment[left.index].value < segment[right.index].value;
+    });
+
+    auto sorted_segment = MaterializedSegment<T>{};
+    sorted_segment.reserve(segment.size());
+    for (const auto& normalized_key : normalized_keys) {
+      sorted_segment.emplace_back(std::move(segment[normalized_key.index]));
+    }
+    segment = std::move(sorted_segment);
+  } else {
+    std::sort(segment.begin(), segment.end(),
+              [](const auto& left, const auto& right) { return left.value < right.value; });
+  }
+}
+
 /**
  * This data structure is passed as a reference to the jobs which materialize
  * the chunks. Each job then adds `samples_to_collect` samples to its passed
@@ -161,8 +213,7 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      sort_materialized_segment(output);
     }
 
     _gather_samples_from_segment(output, subsample);
@@ -182,7 +233,34 @@ class ColumnMaterializer {
     auto base_attribute_vector = segment.attribute_vector();
     auto dict = segment.dictionary();
 
-    if (_sort) {
+    if (_sort && dict->size() > segment.size()) {
+      // Dictionaries shared with other chunks (see ChunkEncoder::merge_dictionaries()) can be much larger than the
+      // segment, so that a bucket per value id would not pay off. Instead, the rows are sorted by their value ids,
+      // which is still cheaper than comparing the values.
+      auto value_ids_and_offsets = std::vector<std::pair<ValueID, ChunkOffset>>{};
+      value_ids_and_offsets.reserve(segment.size());
+
+      resolve_compressed_vector_type(*base_attribute_vector, [&](const auto& attribute_vector) {
+        auto chunk_offset = ChunkOffset{0u};
+        const auto null_value_id = segment.null_value_id();
+
+        for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+             ++value_id_it, ++chunk_offset) {
+          const auto value_id = static_cast<ValueID>(*value_id_it);
+
+          if (value_id != null_value_id) {
+            value_ids_and_offsets.emplace_back(value_id, chunk_offset);
+          } else if (_materialize_null) {
+            null_rows_output->push_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      });
+
+      std::sort(value_ids_and_offsets.begin(), value_ids_and_offsets.end());
+      for (const auto& [value_id, chunk_offset] : value_ids_and_offsets) {
+        output.emplace_back(RowID{chunk_id, chunk_offset}, (*dict)[value_id]);
+      }
+    } else if (_sort) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
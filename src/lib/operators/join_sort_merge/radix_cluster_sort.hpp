@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,6 +27,9 @@ struct RadixClusterOutput {
   std::unique_ptr<MaterializedSegmentList<T>> clusters_right;
   std::unique_ptr<RowIDPosList> null_rows_left;
   std::unique_ptr<RowIDPosList> null_rows_right;
+
+  // Whether the rows of heavy hitters were spread over multiple clusters (see _choose_skewed_values)
+  bool spread_skewed_values{false};
 };
 
 /*
@@ -39,6 +45,16 @@ struct RadixClusterOutput {
 * -> Then, either radix clustering or range clustering is performed.
 * -> At last, the resulting clusters are sorted.
 *
+* If all chunks of an input are already sorted by the join column (see Chunk::individually_sorted_by, e.g., the output
+* of Sort), the chunks are not sorted during materialization. As the clustering keeps the order of the values of each
+* chunk, every cluster then consists of one sorted run per input chunk. Instead of being sorted, these runs are merged.
+* Together with the range clustering of the non-equi case, this is a parallel, range-partitioned merge of the inputs.
+*
+* In the equi case, the rows of a heavy hitter would all end up in a single cluster, which is then sorted and joined by
+* a single worker while the others idle. Heavy hitters are detected from the samples taken during materialization.
+* Their rows are spread over all clusters on one input and copied to all clusters on the other input, so that each
+* cluster produces a share of the heavy hitter's cross product (see _choose_skewed_values).
+*
 * Radix clustering example:
 * cluster_count = 4
 * bits for 4 clusters: 2
@@ -83,7 +99,13 @@ class RadixClusterSort {
     return std::hash<T2>{}(value)&radix_bitmask;
   }
 
+  // A value needs to occur at least this often in the samples of an input to be considered a heavy hitter
+  static constexpr auto MIN_HEAVY_HITTER_SAMPLE_COUNT = size_t{3};
+
  protected:
+  // Returned by a clusterer for values that are copied to all clusters
+  static constexpr auto ALL_CLUSTERS = std::numeric_limits<size_t>::max();
+
   /**
   * The ChunkInformation structure is used to gather statistics regarding a chunk's values in order to
   * be able to appropriately reserve space for the clustering output.
@@ -137,6 +159,42 @@ class RadixClusterSort {
   bool _materialize_null_left;
   bool _materialize_null_right;
 
+  // For each cluster, the start offsets of the runs that the input chunks wrote to it. If the input chunks are sorted,
+  // each of these runs is sorted as well.
+  using RunOffsets = std::vector<std::vector<size_t>>;
+
+  /**
+  * Returns the sort mode of the given column if all chunks of the table are sorted by it in the same direction.
+  **/
+  static std::optional<SortMode> _presorted_by(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    auto sort_mode = std::optional<SortMode>{};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto& sorted_by = chunk->individually_sorted_by();
+      const auto sort_definition_it = std::find_if(sorted_by.cbegin(), sorted_by.cend(), [&](const auto& definition) {
+        return definition.column == column_id;
+      });
+      if (sort_definition_it == sorted_by.cend()) return std::nullopt;
+      if (sort_mode && *sort_mode != sort_definition_it->sort_mode) return std::nullopt;
+      sort_mode = sort_definition_it->sort_mode;
+    }
+    return sort_mode;
+  }
+
+  /**
+  * Brings the materialized segments of a presorted table into ascending order. NULL values have already been removed,
+  * so whether they were sorted first or last does not matter.
+  **/
+  static void _make_ascending(std::unique_ptr<MaterializedSegmentList<T>>& segments, const SortMode sort_mode) {
+    if (sort_mode == SortMode::Ascending) return;
+    for (auto& segment : *segments) {
+      std::reverse(segment->begin(), segment->end());
+    }
+  }
+
   /**
   * Determines the total size of a materialized segment list.
   **/
@@ -153,14 +211,17 @@ class RadixClusterSort {
   * Concatenates multiple materialized segments to a single materialized segment.
   **/
   static std::unique_ptr<MaterializedSegmentList<T>> _concatenate_chunks(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks, RunOffsets& run_offsets) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(1);
     (*output_table)[0] = std::make_shared<MaterializedSegment<T>>();
 
     // Reserve the required space and move the data to the output
     auto output_chunk = (*output_table)[0];
     output_chunk->reserve(_materialized_table_size(input_chunks));
+    run_offsets = RunOffsets(1);
     for (auto& chunk : *input_chunks) {
+      if (chunk->empty()) continue;
+      run_offsets[0].push_back(output_chunk->size());
       output_chunk->insert(output_chunk->end(), chunk->begin(), chunk->end());
     }
 
@@ -169,7 +230,9 @@ class RadixClusterSort {
 
   /**
   * Performs the clustering on a materialized table using a clustering function that determines for each
-  * value the appropriate cluster id. This is how the clustering works:
+  * value the appropriate cluster id. Besides the value, the clusterer gets a running number of the value within its
+  * chunk, which can be used to distribute equal values over the clusters. It may return ALL_CLUSTERS for values that
+  * are copied to every cluster. This is how the clustering works:
   * -> Count for each chunk how many of its values belong in each of the clusters using histograms.
   * -> Aggregate the per-chunk histograms to a histogram for the whole table. For each chunk it is noted where
   *    it will be inserting values in each cluster.
@@ -177,7 +240,8 @@ class RadixClusterSort {
   * -> At last, each value of each chunk is moved to the appropriate cluster.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
+                                                       std::function<size_t(const T&, size_t)> clusterer,
+                                                       RunOffsets& run_offsets) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
     TableInformation table_information(input_chunks->size(), _cluster_count);
 
@@ -188,10 +252,17 @@ class RadixClusterSort {
       auto input_chunk = (*input_chunks)[chunk_number];
 
       // Count the number of entries for each cluster to be able to reserve the appropriate output space later.
-      auto job = std::make_shared<JobTask>([input_chunk, &clusterer, &chunk_information] {
-        for (auto& entry : *input_chunk) {
-          auto cluster_id = clusterer(entry.value);
-          ++chunk_information.cluster_histogram[cluster_id];
+      auto job = std::make_shared<JobTask>([input_chunk, chunk_number, &clusterer, &chunk_information] {
+        const auto chunk_size = input_chunk->size();
+        for (auto index = size_t{0}; index < chunk_size; ++index) {
+          const auto cluster_id = clusterer((*input_chunk)[index].value, chunk_number + index);
+          if (cluster_id == ALL_CLUSTERS) {
+            for (auto& cluster_size : chunk_information.cluster_histogram) {
+              ++cluster_size;
+            }
+          } else {
+            ++chunk_information.cluster_histogram[cluster_id];
+          }
         }
       });
 
@@ -208,6 +279,16 @@ class RadixClusterSort {
       }
     }
 
+    // Each chunk writes its values for a cluster as one consecutive run, starting at its insert position
+    run_offsets = RunOffsets(_cluster_count);
+    for (auto& chunk_information : table_information.chunk_information) {
+      for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+        if (chunk_information.cluster_histogram[cluster_id] > 0) {
+          run_offsets[cluster_id].push_back(chunk_information.insert_position[cluster_id]);
+        }
+      }
+    }
+
     // Reserve the appropriate output space for the clusters
     for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
       auto cluster_size = table_information.cluster_histogram[cluster_id];
@@ -220,8 +301,20 @@ class RadixClusterSort {
       auto job =
           std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
             auto& chunk_information = table_information.chunk_information[chunk_number];
-            for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
+            const auto& input_chunk = *(*input_chunks)[chunk_number];
+            const auto chunk_size = input_chunk.size();
+            for (auto index = size_t{0}; index < chunk_size; ++index) {
+              const auto& entry = input_chunk[index];
+              const auto cluster_id = clusterer(entry.value, chunk_number + index);
+              if (cluster_id == ALL_CLUSTERS) {
+                for (auto copy_cluster_id = size_t{0}; copy_cluster_id < output_table->size(); ++copy_cluster_id) {
+                  auto& insert_position = chunk_information.insert_position[copy_cluster_id];
+                  (*(*output_table)[copy_cluster_id])[insert_position] = entry;
+                  ++insert_position;
+                }
+                continue;
+              }
+
               auto& output_cluster = *(*output_table)[cluster_id];
               auto& insert_position = chunk_information.insert_position[cluster_id];
               output_cluster[insert_position] = entry;
@@ -237,16 +330,100 @@ class RadixClusterSort {
   }
 
   /**
-  * Performs least significant bit radix clustering which is used in the equi join case.
+  * Performs least significant bit radix clustering which is used in the equi join case. The rows of the spread values
+  * are distributed round-robin over all clusters, the rows of the copied values are copied to every cluster.
   * Note: if we used the most significant bits, we could also use this for non-equi joins.
   * Then, however we would have to deal with skewed clusters. Other ideas:
   * - manually select the clustering bits based on statistics.
   * - consolidate clusters in order to reduce skew.
   **/
-  std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+  std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
+                                                             RunOffsets& run_offsets,
+                                                             const std::vector<T>& spread_values = {},
+                                                             const std::vector<T>& copied_values = {}) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    if (spread_values.empty() && copied_values.empty()) {
+      return _cluster(
+          input_chunks, [=](const T& value, const size_t) { return get_radix<T>(value, radix_bitmask); },
+          run_offsets);
+    }
+
+    // Only values that share their radix with a skewed value have to be looked up
+    auto skewed_radixes = std::vector<bool>(_cluster_count);
+    for (const auto& value : spread_values) skewed_radixes[get_radix<T>(value, radix_bitmask)] = true;
+    for (const auto& value : copied_values) skewed_radixes[get_radix<T>(value, radix_bitmask)] = true;
+
+    const auto clusterer = [&, radix_bitmask](const T& value, const size_t position) {
+      const auto radix = get_radix<T>(value, radix_bitmask);
+      if (!skewed_radixes[radix]) return radix;
+      if (std::find(spread_values.cbegin(), spread_values.cend(), value) != spread_values.cend()) {
+        return position & radix_bitmask;
+      }
+      if (std::find(copied_values.cbegin(), copied_values.cend(), value) != copied_values.cend()) return ALL_CLUSTERS;
+      return radix;
+    };
+    return _cluster(input_chunks, clusterer, run_offsets);
+  }
+
+  /**
+  * Returns the values of which an input is estimated to hold more rows than a cluster should hold in total, together
+  * with their estimated row counts. The estimates are based on the samples taken from the input.
+  **/
+  static std::vector<std::pair<T, size_t>> _find_heavy_hitters(std::vector<T> samples, const size_t row_count,
+                                                               const size_t cluster_row_count) {
+    auto heavy_hitters = std::vector<std::pair<T, size_t>>{};
+    std::sort(samples.begin(), samples.end());
+    for (auto run_begin = samples.cbegin(); run_begin != samples.cend();) {
+      const auto run_end = std::upper_bound(run_begin, samples.cend(), *run_begin);
+      const auto sample_count = static_cast<size_t>(std::distance(run_begin, run_end));
+      const auto estimated_row_count = sample_count * row_count / samples.size();
+      if (sample_count >= MIN_HEAVY_HITTER_SAMPLE_COUNT && estimated_row_count > cluster_row_count) {
+        heavy_hitters.emplace_back(*run_begin, estimated_row_count);
+      }
+      run_begin = run_end;
+    }
+    return heavy_hitters;
+  }
+
+  /**
+  * Chooses the heavy hitters whose rows are spread over all clusters on one input and copied to all clusters on the
+  * other input. Each cluster then joins its share of the spread rows with all copied rows. Rows of the copied input
+  * are thus visited once per cluster, which is only correct if they are not emitted when they have no match. Hence,
+  * the left input is only spread if NULL-extended rows are not materialized for the right input (i.e., not for right
+  * and full outer joins) and vice versa. Where both is possible, the input with more rows of the value is spread, so
+  * that fewer rows are copied.
+  * Returns the values to spread on the left input and the values to spread on the right input.
+  **/
+  std::pair<std::vector<T>, std::vector<T>> _choose_skewed_values(const std::vector<T>& samples_left,
+                                                                 const std::vector<T>& samples_right,
+                                                                 const size_t left_row_count,
+                                                                 const size_t right_row_count) const {
+    const auto cluster_row_count = (left_row_count + right_row_count) / _cluster_count;
+
+    // Estimated row counts of the heavy hitters in the left and the right input
+    auto estimated_row_counts = std::map<T, std::pair<size_t, size_t>>{};
+    for (const auto& [value, row_count] : _find_heavy_hitters(samples_left, left_row_count, cluster_row_count)) {
+      estimated_row_counts[value].first = row_count;
+    }
+    for (const auto& [value, row_count] : _find_heavy_hitters(samples_right, right_row_count, cluster_row_count)) {
+      estimated_row_counts[value].second = row_count;
+    }
+
+    const auto can_spread_left = !_materialize_null_right;
+    const auto can_spread_right = !_materialize_null_left;
+
+    auto spread_left_values = std::vector<T>{};
+    auto spread_right_values = std::vector<T>{};
+    for (const auto& [value, row_counts] : estimated_row_counts) {
+      const auto [left_count, right_count] = row_counts;
+      if (can_spread_left && left_count > 0 && (left_count >= right_count || !can_spread_right)) {
+        spread_left_values.emplace_back(value);
+      } else if (can_spread_right && right_count > 0) {
+        spread_right_values.emplace_back(value);
+      }
+    }
+
+    return {std::move(spread_left_values), std::move(spread_right_values)};
   }
 
   /**
@@ -289,11 +466,12 @@ class RadixClusterSort {
   **/
   std::pair<std::unique_ptr<MaterializedSegmentList<T>>, std::unique_ptr<MaterializedSegmentList<T>>> _range_cluster(
       const std::unique_ptr<MaterializedSegmentList<T>>& left_input,
-      const std::unique_ptr<MaterializedSegmentList<T>>& right_input, std::vector<T> sample_values) {
+      const std::unique_ptr<MaterializedSegmentList<T>>& right_input, std::vector<T> sample_values,
+      RunOffsets& left_run_offsets, RunOffsets& right_run_offsets) {
     const std::vector<T> split_values = _pick_split_values(sample_values);
 
     // Implements range clustering
-    auto clusterer = [&split_values](const T& value) {
+    auto clusterer = [&split_values](const T& value, const size_t) {
       // Find the first split value that is greater or equal to the entry.
       // The split values are sorted in ascending order.
       // Note: can we do this faster? (binary search?)
@@ -308,19 +486,72 @@ class RadixClusterSort {
       return split_values.size();
     };
 
-    auto output_left = _cluster(left_input, clusterer);
-    auto output_right = _cluster(right_input, clusterer);
+    auto output_left = _cluster(left_input, clusterer, left_run_offsets);
+    auto output_right = _cluster(right_input, clusterer, right_run_offsets);
 
     return {std::move(output_left), std::move(output_right)};
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Merges the sorted runs of a cluster, which start at the given offsets, pairwise until the cluster is sorted.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
-    for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+  static void _merge_sorted_runs(MaterializedSegment<T>& cluster, std::vector<size_t> run_offsets) {
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+    run_offsets.push_back(cluster.size());
+
+    while (run_offsets.size() > 2) {
+      auto merged_run_offsets = std::vector<size_t>{};
+      merged_run_offsets.reserve(run_offsets.size() / 2 + 1);
+
+      auto run_id = size_t{0};
+      for (; run_id + 2 < run_offsets.size(); run_id += 2) {
+        std::inplace_merge(cluster.begin() + run_offsets[run_id], cluster.begin() + run_offsets[run_id + 1],
+                           cluster.begin() + run_offsets[run_id + 2], compare);
+        merged_run_offsets.push_back(run_offsets[run_id]);
+      }
+      // Keep a remaining unpaired run and the end offset
+      for (; run_id < run_offsets.size(); ++run_id) {
+        merged_run_offsets.push_back(run_offsets[run_id]);
+      }
+
+      run_offsets = std::move(merged_run_offsets);
     }
+
+    DebugAssert(std::is_sorted(cluster.begin(), cluster.end(), compare), "Presorted input was not sorted");
+  }
+
+  /**
+  * Sorts all clusters of a materialized table in parallel. If the input table was presorted, the clusters consist of
+  * sorted runs, which are merged instead. The largest clusters are scheduled first, so that workers that are done
+  * with the smaller clusters do not wait for a large cluster that was started last.
+  **/
+  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters, const bool presorted,
+                      const RunOffsets& run_offsets) {
+    auto cluster_ids = std::vector<size_t>(clusters->size());
+    std::iota(cluster_ids.begin(), cluster_ids.end(), size_t{0});
+    std::stable_sort(cluster_ids.begin(), cluster_ids.end(), [&](const auto lhs, const auto rhs) {
+      return (*clusters)[lhs]->size() > (*clusters)[rhs]->size();
+    });
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (const auto cluster_id : cluster_ids) {
+      const auto sort_cluster = [&, cluster_id] {
+        auto& cluster = *(*clusters)[cluster_id];
+        if (presorted) {
+          _merge_sorted_runs(cluster, run_offsets[cluster_id]);
+        } else {
+          sort_materialized_segment(cluster);
+        }
+      };
+
+      if ((*clusters)[cluster_id]->size() > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
+        jobs.push_back(std::make_shared<JobTask>(sort_cluster));
+      } else {
+        sort_cluster();
+      }
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   }
 
  public:
@@ -331,40 +562,53 @@ class RadixClusterSort {
     RadixClusterOutput<T> output;
 
     Timer timer;
-    // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
+    const auto left_sort_mode = _presorted_by(_left_input_table, _left_column_id);
+    const auto right_sort_mode = _presorted_by(_right_input_table, _right_column_id);
+
+    // Sort the chunks of the input tables in the non-equi cases, unless they are already sorted
+    ColumnMaterializer<T> left_column_materializer(!_equi_case && !left_sort_mode, _materialize_null_left);
     auto [materialized_left_segments, null_rows_left, samples_left] =
         left_column_materializer.materialize(_left_input_table, _left_column_id);
     output.null_rows_left = std::move(null_rows_left);
+    if (left_sort_mode) _make_ascending(materialized_left_segments, *left_sort_mode);
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::LeftSideMaterializing, timer.lap());
 
-    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
+    ColumnMaterializer<T> right_column_materializer(!_equi_case && !right_sort_mode, _materialize_null_right);
     auto [materialized_right_segments, null_rows_right, samples_right] =
         right_column_materializer.materialize(_right_input_table, _right_column_id);
     output.null_rows_right = std::move(null_rows_right);
+    if (right_sort_mode) _make_ascending(materialized_right_segments, *right_sort_mode);
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::RightSideMaterializing, timer.lap());
 
-    // Append right samples to left samples and sort (reserve not necessary when insert can
-    // determine the new capacity from the iterator: https://stackoverflow.com/a/35359472/1147726)
-    samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
-
+    auto left_run_offsets = RunOffsets{};
+    auto right_run_offsets = RunOffsets{};
     if (_cluster_count == 1) {
-      output.clusters_left = _concatenate_chunks(materialized_left_segments);
-      output.clusters_right = _concatenate_chunks(materialized_right_segments);
+      output.clusters_left = _concatenate_chunks(materialized_left_segments, left_run_offsets);
+      output.clusters_right = _concatenate_chunks(materialized_right_segments, right_run_offsets);
     } else if (_equi_case) {
-      output.clusters_left = _radix_cluster(materialized_left_segments);
-      output.clusters_right = _radix_cluster(materialized_right_segments);
+      const auto [spread_left_values, spread_right_values] =
+          _choose_skewed_values(samples_left, samples_right, _materialized_table_size(materialized_left_segments),
+                                _materialized_table_size(materialized_right_segments));
+      output.spread_skewed_values = !spread_left_values.empty() || !spread_right_values.empty();
+      output.clusters_left = _radix_cluster(materialized_left_segments, left_run_offsets, spread_left_values,
+                                            spread_right_values);
+      output.clusters_right = _radix_cluster(materialized_right_segments, right_run_offsets, spread_right_values,
+                                             spread_left_values);
     } else {
-      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left);
+      // Append right samples to left samples and sort (reserve not necessary when insert can
+      // determine the new capacity from the iterator: https://stackoverflow.com/a/35359472/1147726)
+      samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
+
+      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left,
+                                   left_run_offsets, right_run_offsets);
       output.clusters_left = std::move(result.first);
       output.clusters_right = std::move(result.second);
     }
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::Clustering, timer.lap());
 
-    // Sort each cluster (right now std::sort -> but maybe can be replaced with
-    // an more efficient algorithm if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    // Sort each cluster or, for presorted inputs, merge its sorted runs
+    _sort_clusters(output.clusters_left, left_sort_mode.has_value(), left_run_offsets);
+    _sort_clusters(output.clusters_right, right_sort_mode.has_value(), right_run_offsets);
 
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::Sorting, timer.lap());
 
@@ -24,26 +24,15 @@ const std::string& Limit::name() const {
 
 std::shared_ptr<AbstractExpression> Limit::row_count_expression() const { return _row_count_expression; }
 
-std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
-    const std::shared_ptr<AbstractOperator>& copied_left_input,
-    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<Limit>(copied_left_input, _row_count_expression->deep_copy());
-}
-
-std::shared_ptr<const Table> Limit::_on_execute() {
-  const auto input_table = left_input_table();
-
-  /**
-   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to
-   */
+size_t Limit::evaluate_row_count(const AbstractExpression& row_count_expression) {
   auto num_rows = size_t{};
 
-  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+  resolve_data_type(row_count_expression.data_type(), [&](const auto data_type_t) {
     using LimitDataType = typename decltype(data_type_t)::type;
 
     if constexpr (std::is_integral_v<LimitDataType>) {
       const auto num_rows_expression_result =
-          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(*_row_count_expression);
+          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(row_count_expression);
       Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for Limit");
       Assert(!num_rows_expression_result->is_null(0), "Expected non-null for Limit");
 
@@ -56,6 +45,23 @@ std::shared_ptr<const Table> Limit::_on_execute() {
     }
   });
 
+  return num_rows;
+}
+
+std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<Limit>(copied_left_input, _row_count_expression->deep_copy());
+}
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = left_input_table();
+
+  /**
+   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to
+   */
+  const auto num_rows = evaluate_row_count(*_row_count_expression);
+
   /**
    * Perform the actual limitting
    */
@@ -18,6 +18,9 @@ class Limit : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  // Evaluates a row count expression (e.g., of a Limit or a TopK) to the number of rows
+  static size_t evaluate_row_count(const AbstractExpression& row_count_expression);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
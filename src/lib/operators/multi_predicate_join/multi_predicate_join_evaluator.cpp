@@ -53,6 +53,13 @@ bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row
   return true;
 }
 
+void MultiPredicateJoinEvaluator::filter_left_rows(std::vector<RowID>& left_row_ids, const RowID& right_row_id) {
+  for (const auto& comparator : _comparators) {
+    if (left_row_ids.empty()) return;
+    comparator->filter_left_rows(left_row_ids, right_row_id);
+  }
+}
+
 template <typename T>
 std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> MultiPredicateJoinEvaluator::_create_accessors(
     const Table& table, const ColumnID column_id) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "operators/operator_join_predicate.hpp"
@@ -19,10 +20,17 @@ class MultiPredicateJoinEvaluator {
 
   bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id);
 
+  // Evaluates the predicates for a batch of left rows that share the same right row, e.g., the rows of the build side
+  // that match a probe row in a hash table. Removes the rows that do not satisfy all predicates from left_row_ids,
+  // keeping the order of the others. Each predicate is evaluated for the whole batch, so that the virtual call and the
+  // access of the right value happen once per batch instead of once per pair, and the comparison is inlined.
+  void filter_left_rows(std::vector<RowID>& left_row_ids, const RowID& right_row_id);
+
  protected:
   class BaseFieldComparator : public Noncopyable {
    public:
     virtual bool compare(const RowID& left, const RowID& right) const = 0;
+    virtual void filter_left_rows(std::vector<RowID>& left_row_ids, const RowID& right) const = 0;
     virtual ~BaseFieldComparator() = default;
   };
 
@@ -53,6 +61,21 @@ class MultiPredicateJoinEvaluator {
       }
     }
 
+    void filter_left_rows(std::vector<RowID>& left_row_ids, const RowID& right) const override {
+      const auto right_value = _right_accessors[right.chunk_id]->access(right.chunk_offset);
+      const auto null_is_match = _join_mode == JoinMode::AntiNullAsTrue;
+      if (!right_value) {
+        if (!null_is_match) left_row_ids.clear();
+        return;
+      }
+
+      const auto end = std::remove_if(left_row_ids.begin(), left_row_ids.end(), [&](const RowID& left) {
+        const auto left_value = _left_accessors[left.chunk_id]->access(left.chunk_offset);
+        return left_value ? !_compare_functor(*left_value, *right_value) : !null_is_match;
+      });
+      left_row_ids.erase(end, left_row_ids.end());
+    }
+
    private:
     const CompareFunctor _compare_functor;
     const JoinMode _join_mode;
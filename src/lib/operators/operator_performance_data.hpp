@@ -1,8 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <string_view>
 
 // Warning: In the past, magic_enum has led to problems with TSan. See #2154 for details.
 #include <magic_enum.hpp>
@@ -20,6 +22,11 @@ struct AbstractOperatorPerformanceData : public Noncopyable {
 
   virtual void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const = 0;
 
+  // Calls the functor with the name and the runtime of each of the operator's steps. Does nothing for operators
+  // without steps.
+  using StepRuntimeFunctor = std::function<void(const std::string_view step_name, const std::chrono::nanoseconds)>;
+  virtual void for_each_step_runtime(const StepRuntimeFunctor& functor) const = 0;
+
   bool executed{false};
   std::chrono::nanoseconds walltime{0};
 
@@ -28,6 +35,10 @@ struct AbstractOperatorPerformanceData : public Noncopyable {
   bool has_output{false};
   uint64_t output_row_count{0};
   uint64_t output_chunk_count{0};
+
+  // The peak of the bytes that the operator has allocated from its memory resource for intermediate data structures
+  // (see AbstractOperator::_memory_resource()). The output table is not included.
+  size_t peak_memory_usage{0};
 };
 
 /**
@@ -82,6 +93,14 @@ struct OperatorPerformanceData : public AbstractOperatorPerformanceData {
     stream << ".";
   }
 
+  void for_each_step_runtime(const StepRuntimeFunctor& functor) const override {
+    if constexpr (!std::is_same_v<Steps, NoSteps>) {
+      for (auto step_index = size_t{0}; step_index < magic_enum::enum_count<Steps>(); ++step_index) {
+        functor(magic_enum::enum_name(static_cast<Steps>(step_index)), step_runtimes[step_index]);
+      }
+    }
+  }
+
   std::chrono::nanoseconds get_step_runtime(const Steps step) const {
     DebugAssert(magic_enum::enum_integer(step) < magic_enum::enum_count<Steps>(), "Step index is too large.");
     return step_runtimes[static_cast<size_t>(step)];
@@ -0,0 +1,57 @@
+#include "operator_statistics.hpp"
+
+#include "operators/abstract_operator.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+OperatorStatistics& OperatorStatistics::operator=(OperatorStatistics&& operator_statistics) noexcept {
+  const auto lock = std::scoped_lock{_mutex, operator_statistics._mutex};
+  _entries = std::move(operator_statistics._entries);
+  return *this;
+}
+
+void OperatorStatistics::record(const AbstractOperator& op) {
+  const auto& performance_data = *op.performance_data;
+
+  // Gather the numbers before taking the lock
+  auto input_row_count = size_t{0};
+  if (const auto& left_input_table = op.left_input_table()) input_row_count += left_input_table->row_count();
+  if (const auto& right_input_table = op.right_input_table()) input_row_count += right_input_table->row_count();
+
+  const auto& output = op.get_output();
+  auto output_memory_usage = size_t{0};
+  if (output && op.type() != OperatorType::GetTable) {
+    output_memory_usage = output->memory_usage(MemoryUsageCalculationMode::Sampled);
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  auto& entry = _entries[op.name()];
+  ++entry.execution_count;
+  entry.walltime += performance_data.walltime;
+  entry.input_row_count += input_row_count;
+  entry.output_row_count += performance_data.output_row_count;
+  entry.output_memory_usage += output_memory_usage;
+
+  auto step_index = size_t{0};
+  performance_data.for_each_step_runtime([&](const auto step_name, const auto step_runtime) {
+    if (step_index == entry.step_runtimes.size()) {
+      entry.step_runtimes.emplace_back(std::string{step_name}, std::chrono::nanoseconds{0});
+    }
+    entry.step_runtimes[step_index].second += step_runtime;
+    ++step_index;
+  });
+}
+
+std::map<std::string, OperatorStatistics::Entry> OperatorStatistics::entries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries;
+}
+
+void OperatorStatistics::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+}
+
+}  // namespace opossum
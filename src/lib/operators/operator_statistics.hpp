@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Aggregates the performance data (see operator_performance_data.hpp) of all executed operators by their name, e.g.,
+ * to spot regressions or to calibrate a cost model. The statistics are exposed by the meta_operator_statistics table.
+ *
+ * AbstractOperator::execute() records every operator once it has finished. This takes a lock, but operators are
+ * coarse-grained compared to it, so the statistics are always collected. The memory of an output is estimated with
+ * MemoryUsageCalculationMode::Sampled. For outputs that forward the segments of stored tables or of their inputs (e.g.,
+ * of Alias), these segments are counted again. The output of GetTable is not counted, as it holds the stored segments.
+ */
+class OperatorStatistics : public Noncopyable {
+ public:
+  struct Entry {
+    size_t execution_count{0};
+    std::chrono::nanoseconds walltime{0};
+    size_t input_row_count{0};
+    size_t output_row_count{0};
+    size_t output_memory_usage{0};
+
+    // Cumulative runtimes of the operator's steps, in the order of their enum
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> step_runtimes;
+  };
+
+  OperatorStatistics() = default;
+
+  void record(const AbstractOperator& op);
+
+  // Returns a copy of the statistics, keyed by the operator's name
+  std::map<std::string, Entry> entries() const;
+
+  void clear();
+
+ protected:
+  friend class Hyrise;
+  OperatorStatistics& operator=(OperatorStatistics&& operator_statistics) noexcept;
+
+ private:
+  mutable std::mutex _mutex;
+  std::map<std::string, Entry> _entries;
+};
+
+}  // namespace opossum
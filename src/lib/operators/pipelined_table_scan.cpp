@@ -0,0 +1,161 @@
+#include "pipelined_table_scan.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/adaptive_predicate_order.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+PipelinedTableScan::PipelinedTableScan(const std::shared_ptr<const AbstractOperator>& in,
+                                       const std::vector<std::shared_ptr<AbstractExpression>>& predicates)
+    : AbstractReadOnlyOperator{OperatorType::PipelinedTableScan, in}, _predicates(predicates) {
+  Assert(!_predicates.empty(), "PipelinedTableScan needs at least one predicate");
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& PipelinedTableScan::predicates() const { return _predicates; }
+
+const std::string& PipelinedTableScan::name() const {
+  static const auto name = std::string{"PipelinedTableScan"};
+  return name;
+}
+
+std::string PipelinedTableScan::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+
+  stream << name();
+  for (const auto& predicate : _predicates) {
+    stream << separator << predicate->as_column_name();
+  }
+
+  return stream.str();
+}
+
+void PipelinedTableScan::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expressions_set_transaction_context(_predicates, transaction_context);
+}
+
+void PipelinedTableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expressions_set_parameters(_predicates, parameters);
+}
+
+std::shared_ptr<AbstractOperator> PipelinedTableScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<PipelinedTableScan>(copied_left_input, expressions_deep_copy(_predicates));
+}
+
+std::shared_ptr<const Table> PipelinedTableScan::_on_execute() {
+  const auto in_table = left_input_table();
+  const auto chunk_count = in_table->chunk_count();
+
+  // If all predicates are scanned on a single column, a ConjunctionTableScanImpl applies them to each chunk without
+  // intermediate chunks. Otherwise, each chunk is scanned for the first predicate with an impl that is shared by all
+  // chunks, just like in the TableScan.
+  auto conjunction_impl = std::unique_ptr<AbstractTableScanImpl>{};
+  if (_predicates.size() > 1) {
+    conjunction_impl = TableScan::create_impl(in_table, inflate_logical_expressions(_predicates, LogicalOperator::And));
+    if (!dynamic_cast<const ConjunctionTableScanImpl*>(conjunction_impl.get())) conjunction_impl.reset();
+  }
+
+  auto first_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+  if (!conjunction_impl) {
+    first_impls.reserve(_predicates.size());
+    for (const auto& predicate : _predicates) {
+      first_impls.emplace_back(TableScan::create_impl(in_table, predicate));
+    }
+  }
+
+  // Like the ConjunctionTableScanImpl, the stacked scans are reordered based on the measured selectivities and costs
+  auto predicate_order = AdaptivePredicateOrder{_predicates.size()};
+
+  std::mutex output_mutex;
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(chunk_count);
+
+  const auto chunk_groups = Hyrise::get().job_partitioner.partition(*in_table);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_groups.size());
+
+  // Like in the TableScan, the jobs stop once the chunks of all jobs satisfy the row budget
+  auto output_row_count = std::atomic<size_t>{0};
+
+  for (const auto& chunk_group : chunk_groups) {
+    auto perform_scans = [this, &chunk_group, &in_table, &conjunction_impl, &first_impls, &predicate_order,
+                          &output_mutex, &output_chunks, &output_row_count]() {
+      for (const auto chunk_id : chunk_group) {
+        if (_row_budget_reached(output_row_count.load())) return;
+
+        if (conjunction_impl) {
+          const auto chunk = TableScan::scan_chunk(in_table, chunk_id, *conjunction_impl);
+          if (!chunk) continue;
+
+          output_row_count += chunk->size();
+          std::lock_guard<std::mutex> lock(output_mutex);
+          output_chunks.emplace_back(chunk);
+          continue;
+        }
+
+        const auto order = predicate_order.order();
+
+        auto timer = Timer{};
+        auto chunk = TableScan::scan_chunk(in_table, chunk_id, *first_impls[order.front()]);
+        const auto input_row_count = size_t{in_table->get_chunk(chunk_id)->size()};
+        predicate_order.record(order.front(), input_row_count, chunk ? size_t{chunk->size()} : size_t{0}, timer.lap());
+
+        // Apply the remaining predicates to the intermediate chunk. As TableScan::scan_chunk resolves reference
+        // segments, the output keeps referencing the data table (if any) that the input references.
+        for (auto order_id = size_t{1}; order_id < order.size() && chunk; ++order_id) {
+          const auto predicate_id = order[order_id];
+          const auto intermediate_row_count = size_t{chunk->size()};
+          const auto intermediate_table = std::make_shared<Table>(
+              in_table->column_definitions(), TableType::References, std::vector<std::shared_ptr<Chunk>>{chunk});
+          const auto impl = TableScan::create_impl(intermediate_table, _predicates[predicate_id]);
+          chunk = TableScan::scan_chunk(intermediate_table, ChunkID{0}, *impl);
+          const auto output_row_count = chunk ? size_t{chunk->size()} : size_t{0};
+          predicate_order.record(predicate_id, intermediate_row_count, output_row_count, timer.lap());
+        }
+        if (!chunk) continue;
+
+        output_row_count += chunk->size();
+        std::lock_guard<std::mutex> lock(output_mutex);
+        output_chunks.emplace_back(chunk);
+      }
+    };
+
+    // Chunks are grouped into jobs just like in the TableScan
+    if (chunk_groups.size() == 1) {
+      perform_scans();
+    } else {
+      auto job_task = std::make_shared<JobTask>(perform_scans);
+      job_task->set_node_id(in_table->get_chunk(chunk_group.front())->numa_node_id());
+      jobs.push_back(job_task);
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
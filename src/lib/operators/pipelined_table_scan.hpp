@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Returns the same result as one TableScan per predicate stacked on top of each other, but processes the input chunk
+ * by chunk (morsel-driven): Each job applies all predicates to a chunk, one after the other and to the rows that passed
+ * the previous ones, before moving on to the next chunk of its group (see JobPartitioner). The intermediate chunks are
+ * consumed right after they were written and while they are still in the cache, and they never exist for the entire
+ * input at the same time. Jobs are scheduled on the NUMA node of their chunks.
+ *
+ * If all predicates can be scanned on a single column (e.g., `a > 5`, `b LIKE 'x%'`, or `c BETWEEN 1 AND 3`), they are
+ * applied by a ConjunctionTableScanImpl, which scans the positions that passed the previous predicates without
+ * creating intermediate chunks. Otherwise, the first predicate is scanned on the input table. Each following
+ * predicate is scanned on a table that consists of the single intermediate chunk, so that a new TableScanImpl has to
+ * be created for every chunk and predicate. In both cases, the predicates are reordered for every chunk based on the
+ * selectivities and costs measured on the previous chunks (see AdaptivePredicateOrder), so that misestimates of the
+ * PredicateReorderingRule are corrected at runtime. For predicates with subqueries, whose results the
+ * ExpressionEvaluator would compute once per impl, the LQPTranslator keeps using stacked TableScans.
+ */
+class PipelinedTableScan : public AbstractReadOnlyOperator {
+ public:
+  PipelinedTableScan(const std::shared_ptr<const AbstractOperator>& in,
+                     const std::vector<std::shared_ptr<AbstractExpression>>& predicates);
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& predicates() const;
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<std::shared_ptr<AbstractExpression>> _predicates;
+};
+
+}  // namespace opossum
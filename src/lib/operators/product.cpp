@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "storage/pos_lists/cartesian_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -64,10 +65,14 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
   //   l2 r2
   //   l2 r3
   // we can first repeat each line on the left side #rightSide times and then repeat the ascending sequence for the
-  // right side #leftSide times
+  // right side #leftSide times. Instead of materializing these #leftSide * #rightSide RowIDs per side, we use
+  // CartesianPosLists that compute the positions from the input when they are accessed.
 
-  std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>> calculated_pos_lists_left;
-  std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>> calculated_pos_lists_right;
+  std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>> calculated_pos_lists_left;
+  std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>> calculated_pos_lists_right;
+
+  const auto chunk_size_left = chunk_left->size();
+  const auto chunk_size_right = chunk_right->size();
 
   Segments output_segments;
   auto is_left_side = true;
@@ -97,17 +102,12 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
       auto& pos_list_out = (is_left_side ? calculated_pos_lists_left : calculated_pos_lists_right)[pos_list_in];
       if (!pos_list_out) {
         // can't reuse
-        pos_list_out = std::make_shared<RowIDPosList>();
-        pos_list_out->reserve(chunk_left->size() * chunk_right->size());
-        for (size_t i = 0; i < chunk_left->size() * chunk_right->size(); ++i) {
-          // size_t is sufficient here, because ChunkOffset::max is 2^32 and (2^32 * 2^32 = 2^64)
-          auto offset = is_left_side ? static_cast<ChunkOffset>(i / chunk_right->size())
-                                     : static_cast<ChunkOffset>(i % chunk_right->size());
-          if (pos_list_in) {
-            pos_list_out->emplace_back((*pos_list_in)[offset]);
-          } else {
-            pos_list_out->emplace_back(RowID{is_left_side ? chunk_id_left : chunk_id_right, offset});
-          }
+        if (is_left_side) {
+          pos_list_out =
+              std::make_shared<CartesianPosList>(pos_list_in, chunk_id_left, chunk_size_left, chunk_size_right, 1);
+        } else {
+          pos_list_out =
+              std::make_shared<CartesianPosList>(pos_list_in, chunk_id_right, chunk_size_right, 1, chunk_size_left);
         }
       }
       output_segments.push_back(std::make_shared<ReferenceSegment>(referenced_table, referenced_segment, pos_list_out));
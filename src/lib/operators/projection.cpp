@@ -14,6 +14,7 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
@@ -93,6 +94,12 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   const auto uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
 
+  // Correlated subqueries are executed once per distinct parameter value across all chunks
+  const auto correlated_subquery_results = std::make_shared<ExpressionEvaluator::CorrelatedSubqueryResults>();
+
+  // Subexpressions shared by multiple expressions are evaluated once per chunk, e.g., `a * (1 - b)` in TPC-H Q1
+  const auto common_subexpressions = ExpressionEvaluator::find_common_subexpressions(expressions);
+
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
   if (!uncorrelated_subquery_results->empty()) {
     step_performance_data.set_step_runtime(OperatorSteps::UncorrelatedSubqueries, timer.lap());
@@ -108,8 +115,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   // described above.
   auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(chunk_count);
+  // Chunks for which new columns have to be evaluated
+  auto evaluated_chunk_ids = std::vector<ChunkID>{};
+  evaluated_chunk_ids.reserve(chunk_count);
 
   const auto expression_count = expressions.size();
   const auto forwarded_pqp_columns = _determine_forwarded_columns(output_table_type);
@@ -149,34 +157,45 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     // All columns are forwarded. We do not need to evaluate newly generated columns.
     if (all_segments_forwarded) continue;
 
+    evaluated_chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Evaluate the newly generated columns. Small chunks are evaluated together in one job, large ones get a job of
+  // their own (see JobPartitioner). If there is only one group, it is evaluated right away.
+  const auto chunk_groups = Hyrise::get().job_partitioner.partition(input_table, evaluated_chunk_ids);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_groups.size());
+  for (const auto& chunk_group : chunk_groups) {
     // Defines the job that performs the evaluation if the columns are newly generated.
-    auto perform_projection_evaluation = [this, chunk_id, &uncorrelated_subquery_results, expression_count,
+    auto perform_projection_evaluation = [this, &chunk_group, &uncorrelated_subquery_results,
+                                          &correlated_subquery_results, &common_subexpressions, expression_count,
                                           &output_segments_by_chunk, &column_is_nullable, &forwarded_pqp_columns]() {
-      auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id, uncorrelated_subquery_results};
-
-      for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
-        const auto& expression = expressions[column_id];
-
-        if (!forwarded_pqp_columns.contains(expression)) {
-          // Newly generated column - the expression needs to be evaluated
-          auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-          column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-          // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
-          // both ReferenceSegments and ValueSegments. We deal with this later.
-          output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
+      for (const auto chunk_id : chunk_group) {
+        auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id, uncorrelated_subquery_results,
+                                             correlated_subquery_results, _memory_resource()};
+        evaluator.set_common_subexpressions(common_subexpressions);
+
+        for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+          const auto& expression = expressions[column_id];
+
+          if (!forwarded_pqp_columns.contains(expression)) {
+            // Newly generated column - the expression needs to be evaluated
+            auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
+            column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+            // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
+            // both ReferenceSegments and ValueSegments. We deal with this later.
+            output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
+          }
         }
       }
     };
-    // Evaluate the expression immediately if it contains less than `JOB_SPAWN_THRESHOLD` rows, otherwise wrap
-    // it into a task. The upper bound of the chunk size, which defines if it will be executed in parallel or not,
-    // still needs to be re-evaluated over time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
+
+    if (chunk_groups.size() == 1) {
+      perform_projection_evaluation();
+    } else {
       auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
+      job_task->set_node_id(input_table.get_chunk(chunk_group.front())->numa_node_id());
       jobs.push_back(job_task);
-    } else {
-      perform_projection_evaluation();
-      expression_evaluator_cost += timer.lap();
     }
   }
 
@@ -0,0 +1,244 @@
+#include "runtime_filter_scan.hpp"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/abstract_table_scan_impl.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Applies the runtime filter to the probe column. It is used through TableScan::scan_chunk, which turns the matches
+ * into the output chunk of ReferenceSegments.
+ */
+template <typename ColumnDataType>
+class RuntimeFilterTableScanImpl : public AbstractTableScanImpl {
+ public:
+  RuntimeFilterTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                             const ColumnDataType& min_value, const ColumnDataType& max_value,
+                             const BloomFilter& bloom_filter, const size_t bloom_filter_mask)
+      : _in_table(in_table),
+        _column_id(column_id),
+        _min_value(min_value),
+        _max_value(max_value),
+        _bloom_filter(bloom_filter),
+        _bloom_filter_mask(bloom_filter_mask) {}
+
+  std::string description() const override { return "RuntimeFilter"; }
+
+  std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override {
+    auto matches = std::make_shared<RowIDPosList>();
+
+    if (_can_prune(chunk_id)) {
+      ++num_chunks_with_early_out;
+      return matches;
+    }
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    const auto& segment = *_in_table->get_chunk(chunk_id)->get_segment(_column_id);
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+
+      const auto value = static_cast<ColumnDataType>(position.value());
+      if (value < _min_value || value > _max_value) return;
+      if (!bloom_filter_contains(_bloom_filter, hash_function(value), _bloom_filter_mask)) return;
+
+      matches->emplace_back(RowID{chunk_id, position.chunk_offset()});
+    });
+
+    return matches;
+  }
+
+ private:
+  // Checks whether the pruning statistics of the stored chunk that the input chunk belongs to rule out all values in
+  // [_min_value, _max_value]. The chunks of a reference table only have a stored chunk if they reference one.
+  bool _can_prune(const ChunkID chunk_id) const {
+    auto stored_chunk = _in_table->get_chunk(chunk_id);
+    auto stored_column_id = _column_id;
+
+    if (_in_table->type() == TableType::References) {
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*stored_chunk->get_segment(_column_id));
+      const auto& pos_list = reference_segment.pos_list();
+      if (pos_list->empty() || !pos_list->references_single_chunk()) return false;
+
+      stored_chunk = reference_segment.referenced_table()->get_chunk((*pos_list)[0].chunk_id);
+      stored_column_id = reference_segment.referenced_column_id();
+    }
+
+    if (!stored_chunk) return false;
+    const auto& pruning_statistics = stored_chunk->pruning_statistics();
+    if (!pruning_statistics) return false;
+
+    return (*pruning_statistics)[stored_column_id]->does_not_contain(PredicateCondition::BetweenInclusive,
+                                                                     AllTypeVariant{_min_value},
+                                                                     AllTypeVariant{_max_value});
+  }
+
+  const std::shared_ptr<const Table> _in_table;
+  const ColumnID _column_id;
+  const ColumnDataType _min_value;
+  const ColumnDataType _max_value;
+  const BloomFilter& _bloom_filter;
+  const size_t _bloom_filter_mask;
+};
+
+}  // namespace
+
+namespace opossum {
+
+using namespace std::string_literals;  // NOLINT
+
+RuntimeFilterScan::RuntimeFilterScan(const std::shared_ptr<const AbstractOperator>& left,
+                                     const std::shared_ptr<const AbstractOperator>& right,
+                                     const ColumnIDPair& column_ids)
+    : AbstractReadOnlyOperator{OperatorType::RuntimeFilterScan, left, right, std::make_unique<PerformanceData>()},
+      _column_ids(column_ids) {}
+
+const ColumnIDPair& RuntimeFilterScan::column_ids() const { return _column_ids; }
+
+const std::string& RuntimeFilterScan::name() const {
+  static const auto name = std::string{"RuntimeFilterScan"};
+  return name;
+}
+
+std::string RuntimeFilterScan::description(DescriptionMode description_mode) const {
+  const auto column_name = [&](const auto from_left, const auto column_id) {
+    const auto& input_table = from_left ? _left_input->get_output() : _right_input->get_output();
+    if (input_table) return input_table->column_name(column_id);
+
+    if (lqp_node) {
+      const auto& input_lqp_node = lqp_node->input(from_left ? LQPInputSide::Left : LQPInputSide::Right);
+      return input_lqp_node->output_expressions()[column_id]->as_column_name();
+    }
+
+    return "Column #"s + std::to_string(column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(" << column_name(true, _column_ids.first) << " in filter of "
+         << column_name(false, _column_ids.second) << ")";
+
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> RuntimeFilterScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<RuntimeFilterScan>(copied_left_input, copied_right_input, _column_ids);
+}
+
+void RuntimeFilterScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> RuntimeFilterScan::_on_execute() {
+  const auto in_table = left_input_table();
+  const auto build_table = right_input_table();
+
+  const auto data_type = in_table->column_data_type(_column_ids.first);
+  Assert(data_type == build_table->column_data_type(_column_ids.second),
+         "RuntimeFilterScan requires the columns to have the same data type");
+
+  auto& filter_performance_data = static_cast<PerformanceData&>(*performance_data);
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    /**
+     * 1. Build the runtime filter from the build column. Like the bloom filters of the JoinHash, it is sized so that
+     *    probing it is cheap.
+     */
+    const auto bloom_filter_size = JoinHash::calculate_bloom_filter_size(build_table->row_count());
+    const auto bloom_filter_mask = bloom_filter_size - 1;
+    auto bloom_filter = BloomFilter(bloom_filter_size);
+    auto min_value = std::optional<ColumnDataType>{};
+    auto max_value = std::optional<ColumnDataType>{};
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    const auto build_chunk_count = build_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+      const auto chunk = build_table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(_column_ids.second), [&](const auto& position) {
+        if (position.is_null()) return;
+
+        const auto value = static_cast<ColumnDataType>(position.value());
+        if (!min_value || value < *min_value) min_value = value;
+        if (!max_value || value > *max_value) max_value = value;
+        bloom_filter_insert(bloom_filter, hash_function(value), bloom_filter_mask);
+      });
+    }
+
+    // Without a non-NULL value on the build side, no probe row can find a join partner
+    if (!min_value) return;
+
+    filter_performance_data.bloom_filter_used = bloom_filter_is_selective(bloom_filter);
+    const auto& used_bloom_filter = filter_performance_data.bloom_filter_used ? bloom_filter : ALL_TRUE_BLOOM_FILTER;
+
+    /**
+     * 2. Apply the filter to the probe side. The chunks are scanned in jobs just like in the TableScan.
+     */
+    auto impl = RuntimeFilterTableScanImpl<ColumnDataType>{in_table,   _column_ids.first, *min_value,
+                                                           *max_value, used_bloom_filter, bloom_filter_mask};
+
+    std::mutex output_mutex;
+
+    const auto chunk_groups = Hyrise::get().job_partitioner.partition(*in_table);
+    output_chunks.reserve(in_table->chunk_count());
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_groups.size());
+
+    for (const auto& chunk_group : chunk_groups) {
+      auto perform_scan = [&chunk_group, &in_table, &impl, &output_mutex, &output_chunks]() {
+        for (const auto chunk_id : chunk_group) {
+          const auto chunk = TableScan::scan_chunk(in_table, chunk_id, impl);
+          if (!chunk) continue;
+
+          std::lock_guard<std::mutex> lock(output_mutex);
+          output_chunks.emplace_back(chunk);
+        }
+      };
+
+      if (chunk_groups.size() == 1) {
+        perform_scan();
+      } else {
+        auto job_task = std::make_shared<JobTask>(perform_scan);
+        job_task->set_node_id(in_table->get_chunk(chunk_group.front())->numa_node_id());
+        jobs.push_back(job_task);
+      }
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    filter_performance_data.num_chunks_pruned = impl.num_chunks_with_early_out.load();
+  });
+
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "abstract_read_only_operator.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sideways information passing for equi-joins: Forwards the rows of the left (probe) input whose value in the probe
+ * column might find a join partner in the build column of the right (build) input. For this, the build side publishes
+ * a runtime filter, which consists of the minimum and maximum value of the build column and a bloom filter of its
+ * values (see join_hash_steps.hpp). The probe side applies it before anything is materialized:
+ *
+ *   (1) Probe chunks whose pruning statistics (i.e., the MinMaxFilters and RangeFilters of the stored chunk) do not
+ *       overlap with the build side's value range are skipped without looking at their values.
+ *   (2) The remaining probe rows are scanned and only those whose value lies in that range and is contained in the
+ *       bloom filter are forwarded. If the build side has too many distinct values for the bloom filter to be
+ *       selective, only the value range is checked.
+ *
+ * The filter is not exact: Rows without a join partner might be forwarded. Thus, it can only be used to reduce the
+ * input of a join that evaluates the join predicate again, i.e., for semi join reductions (see RuntimeJoinFilterRule).
+ * Different from a semi join, it does not materialize the probe input or build a hash table. NULLs are never forwarded.
+ *
+ * The output is a reference table like the output of the TableScan. Both columns must have the same data type.
+ */
+class RuntimeFilterScan : public AbstractReadOnlyOperator {
+ public:
+  RuntimeFilterScan(const std::shared_ptr<const AbstractOperator>& left,
+                    const std::shared_ptr<const AbstractOperator>& right, const ColumnIDPair& column_ids);
+
+  const ColumnIDPair& column_ids() const;
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
+    std::atomic<size_t> num_chunks_pruned{0};
+    bool bloom_filter_used{false};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
+      OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
+
+      const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+      stream << separator << "Chunks: " << num_chunks_pruned.load() << " pruned using the value range.";
+      stream << separator << "Bloom filter " << (bloom_filter_used ? "used." : "not selective.");
+    }
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const ColumnIDPair _column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,405 @@
+#include "hash_set_operation.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Each task should process at least this many rows
+constexpr auto JOB_SPAWN_THRESHOLD = size_t{10'000};
+
+// Combined into the hash of a row for each NULL value, so that NULLs in different columns lead to different hashes
+constexpr auto NULL_VALUE_HASH = size_t{0x9E3779B97F4A7C15};
+
+// Runs functor(task_id) for each task, concurrently if there is more than one task
+template <typename Functor>
+void execute_tasks(const size_t task_count, const Functor& functor) {
+  if (task_count == 1) {
+    functor(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, task_id]() { functor(task_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns the number of tasks among which `row_count` rows are split, given that each task should process at least
+// JOB_SPAWN_THRESHOLD rows
+size_t task_count_for(const size_t row_count) {
+  return std::max(size_t{1},
+                  std::min(row_count / JOB_SPAWN_THRESHOLD, static_cast<size_t>(Hyrise::get().topology.num_cpus())));
+}
+
+class BaseMaterializedColumn : private Noncopyable {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  // Materializes the segment of the given chunk and combines the hashes of its values into the hashes of the rows
+  virtual void materialize(const ChunkID chunk_id, const AbstractSegment& segment, std::vector<size_t>& row_hashes) = 0;
+
+  // Returns whether two rows hold the same value, with NULLs being equal to each other. `other` must have the same
+  // data type.
+  virtual bool equals(const RowID& row_id, const BaseMaterializedColumn& other, const RowID& other_row_id) const = 0;
+};
+
+// The values of a column, stored per chunk so that the chunks can be materialized concurrently
+template <typename T>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const ChunkID chunk_count) : _values(chunk_count), _nulls(chunk_count) {}
+
+  void materialize(const ChunkID chunk_id, const AbstractSegment& segment, std::vector<size_t>& row_hashes) final {
+    auto& values = _values[chunk_id];
+    auto& nulls = _nulls[chunk_id];
+    values.resize(segment.size());
+    nulls.resize(segment.size());
+
+    segment_iterate<T>(segment, [&](const auto& position) {
+      const auto chunk_offset = position.chunk_offset();
+      if (position.is_null()) {
+        nulls[chunk_offset] = true;
+        boost::hash_combine(row_hashes[chunk_offset], NULL_VALUE_HASH);
+      } else {
+        values[chunk_offset] = position.value();
+        boost::hash_combine(row_hashes[chunk_offset], std::hash<T>{}(position.value()));
+      }
+    });
+  }
+
+  bool equals(const RowID& row_id, const BaseMaterializedColumn& other, const RowID& other_row_id) const final {
+    const auto& typed_other = static_cast<const MaterializedColumn<T>&>(other);
+    const auto is_null = _nulls[row_id.chunk_id][row_id.chunk_offset];
+    const auto other_is_null = typed_other._nulls[other_row_id.chunk_id][other_row_id.chunk_offset];
+    if (is_null || other_is_null) return is_null == other_is_null;
+
+    return _values[row_id.chunk_id][row_id.chunk_offset] ==
+           typed_other._values[other_row_id.chunk_id][other_row_id.chunk_offset];
+  }
+
+ private:
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _nulls;
+};
+
+// All rows of a table, materialized with their typed values, together with the hash of each row
+class MaterializedRows : private Noncopyable {
+ public:
+  explicit MaterializedRows(const Table& table) : _hashes(table.chunk_count()) {
+    const auto chunk_count = table.chunk_count();
+    const auto column_count = table.column_count();
+
+    _columns.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        _columns.emplace_back(std::make_unique<MaterializedColumn<ColumnDataType>>(chunk_count));
+      });
+    }
+
+    const auto task_count = std::min(static_cast<size_t>(std::max(chunk_count, ChunkID{1})),
+                                     task_count_for(table.row_count()));
+    execute_tasks(task_count, [&](const size_t task_id) {
+      const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+      const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = table.get_chunk(chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        _hashes[chunk_id].resize(chunk->size());
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          _columns[column_id]->materialize(chunk_id, *chunk->get_segment(column_id), _hashes[chunk_id]);
+        }
+      }
+    });
+  }
+
+  ChunkID chunk_count() const { return ChunkID{static_cast<ChunkID::base_type>(_hashes.size())}; }
+
+  ChunkOffset chunk_size(const ChunkID chunk_id) const { return static_cast<ChunkOffset>(_hashes[chunk_id].size()); }
+
+  size_t hash(const RowID& row_id) const { return _hashes[row_id.chunk_id][row_id.chunk_offset]; }
+
+  bool equals(const RowID& row_id, const MaterializedRows& other, const RowID& other_row_id) const {
+    const auto column_count = _columns.size();
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      if (!_columns[column_id]->equals(row_id, *other._columns[column_id], other_row_id)) return false;
+    }
+    return true;
+  }
+
+ private:
+  std::vector<std::unique_ptr<BaseMaterializedColumn>> _columns;
+  std::vector<std::vector<size_t>> _hashes;
+};
+
+// A row of either input, used as the key of the hash tables. This allows us to probe the hash tables built from the
+// right input with rows of the left input without copying their values.
+struct RowReference {
+  const MaterializedRows* rows;
+  RowID row_id;
+};
+
+struct RowReferenceHash {
+  size_t operator()(const RowReference& row) const { return row.rows->hash(row.row_id); }
+};
+
+struct RowReferenceEqual {
+  bool operator()(const RowReference& lhs, const RowReference& rhs) const {
+    return lhs.rows->equals(lhs.row_id, *rhs.rows, rhs.row_id);
+  }
+};
+
+// Maps each distinct row of a partition to a number, e.g., its number of occurrences
+using RowMap = std::unordered_map<RowReference, size_t, RowReferenceHash, RowReferenceEqual>;
+
+size_t partition_of(const MaterializedRows& rows, const RowID& row_id, const size_t partition_count) {
+  return rows.hash(row_id) % partition_count;
+}
+
+// Calls functor(row_id) for each row of the given hash partition, in the order of the table
+template <typename Functor>
+void for_each_row_in_partition(const MaterializedRows& rows, const size_t partition, const size_t partition_count,
+                               const Functor& functor) {
+  const auto chunk_count = rows.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_size = rows.chunk_size(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      if (partition_count == 1 || partition_of(rows, row_id, partition_count) == partition) functor(row_id);
+    }
+  }
+}
+
+// Builds one hash table per partition that maps the distinct rows to their number of occurrences
+std::vector<RowMap> count_rows_per_partition(const MaterializedRows& rows, const size_t partition_count) {
+  auto row_counts = std::vector<RowMap>(partition_count);
+  execute_tasks(partition_count, [&](const size_t partition) {
+    auto& partition_row_counts = row_counts[partition];
+    for_each_row_in_partition(rows, partition, partition_count,
+                              [&](const RowID& row_id) { ++partition_row_counts[RowReference{&rows, row_id}]; });
+  });
+  return row_counts;
+}
+
+size_t count_of(const std::vector<RowMap>& row_counts, const MaterializedRows& rows, const RowID& row_id) {
+  const auto& partition_row_counts = row_counts[partition_of(rows, row_id, row_counts.size())];
+  const auto iter = partition_row_counts.find(RowReference{&rows, row_id});
+  return iter == partition_row_counts.end() ? 0 : iter->second;
+}
+
+// Describes how the output segments reference the values of the input table
+struct OutputReferences {
+  explicit OutputReferences(const std::shared_ptr<const Table>& input_table)
+      : input_table(input_table),
+        referenced_tables(input_table->column_count(), input_table),
+        referenced_column_ids(input_table->column_count()),
+        input_pos_lists(input_table->column_count()),
+        pos_list_owner(input_table->column_count(), ColumnID{0}) {
+    const auto column_count = input_table->column_count();
+    const auto chunk_count = input_table->chunk_count();
+    std::iota(referenced_column_ids.begin(), referenced_column_ids.end(), ColumnID{0});
+    if (input_table->type() == TableType::Data) return;
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto& column_pos_lists = input_pos_lists[column_id];
+      column_pos_lists.resize(chunk_count);
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+        column_pos_lists[chunk_id] = reference_segment.pos_list();
+        referenced_tables[column_id] = reference_segment.referenced_table();
+        referenced_column_ids[column_id] = reference_segment.referenced_column_id();
+      }
+
+      // Columns that share the input PosLists of all chunks can also share their output PosLists
+      auto owner_column_id = ColumnID{0};
+      while (input_pos_lists[owner_column_id] != column_pos_lists) ++owner_column_id;
+      pos_list_owner[column_id] = owner_column_id;
+    }
+  }
+
+  // Creates a chunk that references the given rows of the input table. If the rows stem from a single input chunk and
+  // are in ascending order, the guarantees of the input PosLists are forwarded.
+  std::shared_ptr<Chunk> create_chunk(const std::vector<RowID>& row_ids, const bool retains_input_order) const {
+    const auto column_count = input_table->column_count();
+    auto pos_lists = std::vector<std::shared_ptr<RowIDPosList>>(column_count);
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto& pos_list = pos_lists[column_id];
+      if (pos_list_owner[column_id] != column_id) {
+        pos_list = pos_lists[pos_list_owner[column_id]];
+      } else {
+        pos_list = std::make_shared<RowIDPosList>();
+        pos_list->reserve(row_ids.size());
+
+        if (input_table->type() == TableType::Data) {
+          for (const auto& row_id : row_ids) {
+            pos_list->emplace_back(row_id);
+          }
+          if (retains_input_order) {
+            pos_list->guarantee_single_chunk();
+            pos_list->guarantee_sorted();
+          }
+        } else {
+          const auto& column_pos_lists = input_pos_lists[column_id];
+          for (const auto& row_id : row_ids) {
+            pos_list->emplace_back((*column_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+          }
+          if (retains_input_order && !row_ids.empty()) {
+            const auto& input_pos_list = *column_pos_lists[row_ids.front().chunk_id];
+            if (input_pos_list.references_single_chunk()) pos_list->guarantee_single_chunk();
+            if (input_pos_list.is_sorted()) pos_list->guarantee_sorted();
+          }
+        }
+      }
+
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_tables[column_id], referenced_column_ids[column_id], pos_list));
+    }
+
+    auto chunk = std::make_shared<Chunk>(std::move(output_segments));
+    chunk->finalize();
+    return chunk;
+  }
+
+  const std::shared_ptr<const Table> input_table;
+  std::vector<std::shared_ptr<const Table>> referenced_tables;
+  std::vector<ColumnID> referenced_column_ids;
+
+  // The PosList of each chunk of each column, only used if the input table is a reference table
+  std::vector<std::vector<std::shared_ptr<const AbstractPosList>>> input_pos_lists;
+
+  // The column whose output PosList is used for a column
+  std::vector<ColumnID> pos_list_owner;
+};
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const Table> hash_set_operation(const std::shared_ptr<const Table>& left_input_table,
+                                                const std::shared_ptr<const Table>& right_input_table,
+                                                const SetOperationType set_operation_type,
+                                                const SetOperationMode set_operation_mode) {
+  const auto column_count = left_input_table->column_count();
+  DebugAssert(column_count == right_input_table->column_count(), "Input tables must have same number of columns");
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    DebugAssert(left_input_table->column_data_type(column_id) == right_input_table->column_data_type(column_id),
+                "Input tables must have the same column data types");
+  }
+
+  // 1. Materialize both inputs. The hash of a row determines its partition.
+  const auto left_rows = MaterializedRows{*left_input_table};
+  const auto right_rows = MaterializedRows{*right_input_table};
+  const auto partition_count =
+      task_count_for(std::max(left_input_table->row_count(), right_input_table->row_count()));
+
+  // 2. For each partition, build a hash table that counts the occurrences of the distinct right rows.
+  const auto right_row_counts = count_rows_per_partition(right_rows, partition_count);
+
+  const auto output_references = OutputReferences{left_input_table};
+  const auto keep_matches = set_operation_type == SetOperationType::Intersect;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+
+  if (set_operation_mode == SetOperationMode::Positions) {
+    // 3a. Probe each left chunk and keep the rows that (do not) have a match, retaining the chunks of the left input.
+    const auto chunk_count = left_input_table->chunk_count();
+    output_chunks.resize(chunk_count);
+    const auto task_count = std::min(static_cast<size_t>(std::max(chunk_count, ChunkID{1})),
+                                     task_count_for(left_input_table->row_count()));
+    execute_tasks(task_count, [&](const size_t task_id) {
+      const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+      const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+      auto row_ids = std::vector<RowID>{};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        row_ids.clear();
+        const auto chunk_size = left_rows.chunk_size(chunk_id);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto row_id = RowID{chunk_id, chunk_offset};
+          if ((count_of(right_row_counts, left_rows, row_id) > 0) == keep_matches) row_ids.emplace_back(row_id);
+        }
+        if (row_ids.empty()) continue;
+
+        // Removing rows does not change the sort order of a chunk
+        auto output_chunk = output_references.create_chunk(row_ids, true);
+        const auto& sorted_by = left_input_table->get_chunk(chunk_id)->individually_sorted_by();
+        if (!sorted_by.empty()) {
+          output_chunk->set_individually_sorted_by(sorted_by);
+        }
+        output_chunks[chunk_id] = std::move(output_chunk);
+      }
+    });
+  } else {
+    // 3b. Count the distinct left rows of each partition and compare their number of occurrences with the right input.
+    //     Equal rows are in the same partition, so that each partition is processed independently.
+    output_chunks.resize(partition_count);
+    execute_tasks(partition_count, [&](const size_t partition) {
+      const auto& partition_right_row_counts = right_row_counts[partition];
+
+      // Distinct rows in the order of their first occurrence, with their number of occurrences
+      auto distinct_left_rows = std::vector<std::pair<RowID, size_t>>{};
+      auto distinct_left_row_indices = RowMap{};
+      for_each_row_in_partition(left_rows, partition, partition_count, [&](const RowID& row_id) {
+        const auto [iter, inserted] =
+            distinct_left_row_indices.try_emplace(RowReference{&left_rows, row_id}, distinct_left_rows.size());
+        if (inserted) {
+          distinct_left_rows.emplace_back(row_id, 1);
+        } else {
+          ++distinct_left_rows[iter->second].second;
+        }
+      });
+
+      auto row_ids = std::vector<RowID>{};
+      for (const auto& [row_id, left_count] : distinct_left_rows) {
+        const auto right_iter = partition_right_row_counts.find(RowReference{&left_rows, row_id});
+        const auto right_count = right_iter == partition_right_row_counts.end() ? size_t{0} : right_iter->second;
+
+        auto output_count = size_t{0};
+        if (set_operation_mode == SetOperationMode::Unique) {
+          output_count = (right_count > 0) == keep_matches ? 1 : 0;
+        } else if (keep_matches) {
+          output_count = std::min(left_count, right_count);
+        } else {
+          output_count = left_count > right_count ? left_count - right_count : 0;
+        }
+
+        // All occurrences of a row are equal, so we can reference the first one repeatedly
+        row_ids.insert(row_ids.end(), output_count, row_id);
+      }
+
+      if (!row_ids.empty()) output_chunks[partition] = output_references.create_chunk(row_ids, false);
+    });
+  }
+
+  output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+
+  return std::make_shared<Table>(left_input_table->column_definitions(), TableType::References,
+                                 std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class SetOperationType { Except, Intersect };
+
+/**
+ * Hash-based implementation of EXCEPT and INTERSECT that is shared by the Difference and the Intersect operators.
+ *
+ * Both inputs are materialized column by column using segment_iterate, so that rows are hashed and compared with their
+ * typed values. The right input is then inserted into hash tables that map each distinct row to its number of
+ * occurrences. The rows are radix-partitioned by their hash, and each partition is built (and, for Unique and All,
+ * also probed) by its own task. NULLs are treated as equal to each other, as SQL requires for set operations.
+ *
+ * The output references the rows of the left input. Depending on the set_operation_mode, it contains:
+ *   - Unique:    each distinct left row once if it (Intersect) / if it does not (Except) occur in the right input
+ *   - All:       a left row that occurs m times in the left and n times in the right input min(m, n) times
+ *                (Intersect) / max(m - n, 0) times (Except), i.e., multiset semantics
+ *   - Positions: every left row if it (Intersect) / if it does not (Except) occur in the right input. Here, the chunks
+ *                and the order of the left input are retained.
+ *
+ * Both inputs need to have the same number of columns and the same column data types.
+ */
+std::shared_ptr<const Table> hash_set_operation(const std::shared_ptr<const Table>& left_input_table,
+                                                const std::shared_ptr<const Table>& right_input_table,
+                                                const SetOperationType set_operation_type,
+                                                const SetOperationMode set_operation_mode);
+
+}  // namespace opossum
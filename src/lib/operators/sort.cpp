@@ -1,12 +1,44 @@
 #include "sort.hpp"
 
+#include <array>
+#include <cstring>
+#include <numeric>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/spill_file.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/timer.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
+// Runs functor(task_id) for each task, concurrently if there is more than one task
+template <typename Functor>
+void execute_tasks(const size_t task_count, const Functor& functor) {
+  if (task_count == 1) {
+    functor(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, task_id]() { functor(task_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns the number of tasks among which `item_count` items of work are split, given that each task should process
+// at least JOB_SPAWN_THRESHOLD rows.
+size_t task_count_for(const size_t item_count, const size_t row_count) {
+  return std::max(size_t{1}, std::min({item_count, row_count / Sort::JOB_SPAWN_THRESHOLD,
+                                       static_cast<size_t>(Hyrise::get().topology.num_cpus())}));
+}
+
 // Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
 // creating chunks of output_chunk_size rows at maximum.
 std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
@@ -24,52 +56,52 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
   const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
   Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
 
-  // Vector of segments for each chunk
-  std::vector<Segments> output_segments_by_chunk(output_chunk_count);
-
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
+  const auto column_count = output->column_count();
   const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
-  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-    const auto column_data_type = output->column_data_type(column_id);
-    const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
-
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = 0u;
-
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-      auto value_segment_null_vector = pmr_vector<bool>();
-
-      {
-        const auto next_chunk_size = std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count));
-        value_segment_value_vector.reserve(next_chunk_size);
-        if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-      }
-
-      auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& abstract_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(abstract_segment);
-      }
-
-      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
-        const auto [chunk_id, chunk_offset] = pos_list[row_index];
+  const auto row_count = pos_list.size();
 
-        auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        if (column_is_nullable) value_segment_null_vector.push_back(is_null);
+  // Vector of segments for each chunk
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
 
-        ++current_segment_size;
+  // Output chunks do not depend on each other, so that each task writes a range of them. As segment accessors are not
+  // thread-safe, every task creates its own accessors for the input chunks it reads from.
+  const auto task_count = task_count_for(output_chunk_count, row_count);
+  execute_tasks(task_count, [&](const size_t task_id) {
+    const auto begin_output_chunk = output_chunk_count * task_id / task_count;
+    const auto end_output_chunk = output_chunk_count * (task_id + 1) / task_count;
 
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0u;
+    for (ColumnID column_id{0u}; column_id < column_count; ++column_id) {
+      const auto column_data_type = output->column_data_type(column_id);
+      const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
+
+      resolve_data_type(column_data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto accessor_by_chunk_id =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+
+        for (auto output_chunk = begin_output_chunk; output_chunk < end_output_chunk; ++output_chunk) {
+          const auto begin_row = output_chunk * output_chunk_size;
+          const auto end_row = std::min(begin_row + output_chunk_size, row_count);
+
+          auto value_segment_value_vector = pmr_vector<ColumnDataType>();
+          auto value_segment_null_vector = pmr_vector<bool>();
+          value_segment_value_vector.reserve(end_row - begin_row);
+          if (column_is_nullable) value_segment_null_vector.reserve(end_row - begin_row);
+
+          for (auto row_index = begin_row; row_index < end_row; ++row_index) {
+            const auto [chunk_id, chunk_offset] = pos_list[row_index];
+
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              accessor =
+                  create_segment_accessor<ColumnDataType>(unsorted_table->get_chunk(chunk_id)->get_segment(column_id));
+            }
+            const auto typed_value = accessor->access(chunk_offset);
+            const auto is_null = !typed_value;
+            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
+            if (column_is_nullable) value_segment_null_vector.push_back(is_null);
+          }
 
           std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
           if (column_is_nullable) {
@@ -78,33 +110,11 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
           } else {
             value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
           }
-
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>();
-          value_segment_null_vector = pmr_vector<bool>();
-
-          const auto next_chunk_size =
-              std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count - row_index));
-          value_segment_value_vector.reserve(next_chunk_size);
-          if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-
-          ++chunk_it;
+          output_segments_by_chunk[output_chunk][column_id] = value_segment;
         }
-      }
-
-      // Last segment has not been added
-      if (current_segment_size > 0u) {
-        std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-        if (column_is_nullable) {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                         std::move(value_segment_null_vector));
-        } else {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
-        }
-        chunk_it->push_back(value_segment);
-      }
-    });
-  }
+      });
+    }
+  });
 
   for (auto& segments : output_segments_by_chunk) {
     output->append_chunk(segments);
@@ -215,6 +225,417 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   return output_table;
 }
 
+// Writes an order-preserving encoding of a non-NULL value to `key`, so that comparing keys byte by byte (e.g., with
+// memcmp) yields the sort order. The first byte flags non-NULL values. As the keys of NULL values stay all zero, they
+// come first in both sort modes. The value follows in big-endian order, with the sign bit flipped for signed values.
+template <typename ColumnDataType>
+void write_normalized_key(uint8_t* const key, ColumnDataType value, const SortMode sort_mode) {
+  using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+  static_assert(sizeof(ColumnDataType) == sizeof(UnsignedType), "Unexpected width of sort column type");
+  constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+
+  auto bits = UnsignedType{};
+  if constexpr (std::is_floating_point_v<ColumnDataType>) {
+    // -0.0 and 0.0 compare equal and have to keep their input order
+    if (value == ColumnDataType{0}) value = ColumnDataType{0};
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Negative floating-point values are ordered by their inverted magnitude
+    bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+  } else {
+    bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+  }
+  if (sort_mode == SortMode::Descending) bits = ~bits;
+
+  key[0] = 1;
+  for (auto byte_index = size_t{0}; byte_index < sizeof(bits); ++byte_index) {
+    key[1 + byte_index] = static_cast<uint8_t>(bits >> ((sizeof(bits) - 1 - byte_index) * 8));
+  }
+}
+
+// Stable LSD radix sort of `row_count` row indices by their normalized keys, using `buffer` as scratch space. Bytes
+// that are the same for all rows (e.g., NULL flags of columns without NULLs or the upper bytes of small integers) do
+// not need a pass.
+void radix_sort_rows(const std::vector<uint8_t>& keys, const size_t key_width, size_t* const rows,
+                     size_t* const buffer, const size_t row_count) {
+  auto* source = rows;
+  auto* target = buffer;
+
+  auto histogram = std::array<size_t, 256>{};
+  for (auto byte_index = key_width; byte_index > 0; --byte_index) {
+    const auto key_byte = byte_index - 1;
+
+    histogram.fill(0);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      ++histogram[keys[source[row] * key_width + key_byte]];
+    }
+    if (std::find(histogram.begin(), histogram.end(), row_count) != histogram.end()) continue;
+
+    auto bucket_begin = size_t{0};
+    for (auto& count : histogram) {
+      const auto bucket_size = count;
+      count = bucket_begin;
+      bucket_begin += bucket_size;
+    }
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      target[histogram[keys[source[row] * key_width + key_byte]]++] = source[row];
+    }
+    std::swap(source, target);
+  }
+
+  if (source != rows) std::copy(source, source + row_count, rows);
+}
+
+// Layout of the normalized key of a row, which concatenates the keys of all sort columns
+struct NormalizedKeyLayout {
+  NormalizedKeyLayout(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions) {
+    for (const auto& sort_definition : sort_definitions) {
+      offsets.emplace_back(width);
+      resolve_data_type(table.column_data_type(sort_definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        width += 1 + sizeof(ColumnDataType);
+      });
+    }
+  }
+
+  std::vector<size_t> offsets;
+  size_t width{0};
+};
+
+// Writes the normalized keys of all rows of the chunk to `keys`, which are expected to be zero-initialized (i.e., the
+// key of NULLs)
+void write_normalized_keys(const Chunk& chunk, const std::vector<SortColumnDefinition>& sort_definitions,
+                           const NormalizedKeyLayout& key_layout, uint8_t* const keys) {
+  const auto key_width = key_layout.width;
+  const auto sort_definition_count = sort_definitions.size();
+  for (auto sort_definition_id = size_t{0}; sort_definition_id < sort_definition_count; ++sort_definition_id) {
+    const auto& sort_definition = sort_definitions[sort_definition_id];
+    const auto& segment = *chunk.get_segment(sort_definition.column);
+    auto* const column_keys = keys + key_layout.offsets[sort_definition_id];
+
+    resolve_data_type(segment.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          if (position.is_null()) return;
+          write_normalized_key(column_keys + position.chunk_offset() * key_width, position.value(),
+                               sort_definition.sort_mode);
+        });
+      } else {
+        Fail("Expected fixed-width sort column");
+      }
+    });
+  }
+}
+
+// A sorted run of the external sort. Its records, i.e., the normalized key of a row followed by the row's RowID, are
+// stored in the spill file.
+struct SpilledRun {
+  SpillFile::Range records;
+  size_t row_count{0};
+};
+
+// Reads the records of a spilled run in blocks of block_row_count rows
+class SpilledRunReader {
+ public:
+  SpilledRunReader(const SpillFile& spill_file, const SpilledRun& run, const size_t record_width,
+                   const size_t block_row_count)
+      : _spill_file(spill_file), _run(run), _record_width(record_width), _block_row_count(block_row_count) {
+    if (!exhausted()) _read_block();
+  }
+
+  bool exhausted() const { return _row == _run.row_count; }
+
+  const uint8_t* record() const {
+    DebugAssert(!exhausted(), "Run is exhausted");
+    return &_block[(_row - _block_begin_row) * _record_width];
+  }
+
+  void advance() {
+    ++_row;
+    if (!exhausted() && _row == _block_begin_row + _block_row_count) _read_block();
+  }
+
+ private:
+  void _read_block() {
+    _block_begin_row = _row;
+    _block.resize(std::min(_block_row_count, _run.row_count - _row) * _record_width);
+    _spill_file.read(SpillFile::Range{_run.records.offset + _row * _record_width, _block.size()}, _block.data());
+  }
+
+  const SpillFile& _spill_file;
+  const SpilledRun _run;
+  const size_t _record_width;
+  const size_t _block_row_count;
+
+  size_t _row{0};
+  size_t _block_begin_row{0};
+  std::vector<uint8_t> _block;
+};
+
+// Tournament tree that yields the reader with the smallest record. Each inner node stores the loser of the match
+// between its subtrees, so that advancing the winner only replays the matches on the path from its leaf to the root,
+// i.e., log2(run count) comparisons per row. Ties are won by the earlier run, which keeps the merge stable.
+class LoserTree {
+ public:
+  LoserTree(std::vector<SpilledRunReader>& readers, const size_t key_width)
+      : _readers(readers), _key_width(key_width), _losers(readers.size()) {
+    _winner = _build(1);
+  }
+
+  size_t winner() const { return _winner; }
+
+  // Advances the winning reader and determines the next winner
+  void advance() {
+    _readers[_winner].advance();
+    for (auto node = (_readers.size() + _winner) / 2; node > 0; node /= 2) {
+      if (_less(_losers[node], _winner)) std::swap(_losers[node], _winner);
+    }
+  }
+
+ private:
+  // Inner nodes are numbered from 1 like in a binary heap, the leaves of the readers follow them. Returns the winner
+  // of the subtree.
+  size_t _build(const size_t node) {
+    if (node >= _readers.size()) return node - _readers.size();
+
+    const auto left_winner = _build(2 * node);
+    const auto right_winner = _build(2 * node + 1);
+    if (_less(right_winner, left_winner)) {
+      _losers[node] = left_winner;
+      return right_winner;
+    }
+    _losers[node] = right_winner;
+    return left_winner;
+  }
+
+  // Exhausted readers lose against all others
+  bool _less(const size_t lhs, const size_t rhs) const {
+    const auto& lhs_reader = _readers[lhs];
+    const auto& rhs_reader = _readers[rhs];
+    if (lhs_reader.exhausted() || rhs_reader.exhausted()) {
+      if (lhs_reader.exhausted() != rhs_reader.exhausted()) return rhs_reader.exhausted();
+      return lhs < rhs;
+    }
+
+    const auto comparison = std::memcmp(lhs_reader.record(), rhs_reader.record(), _key_width);
+    return comparison < 0 || (comparison == 0 && lhs < rhs);
+  }
+
+  std::vector<SpilledRunReader>& _readers;
+  const size_t _key_width;
+  std::vector<size_t> _losers;
+  size_t _winner{0};
+};
+
+// Sorts the table like sort_by_normalized_keys, but within the memory budget. The chunks are split into runs that are
+// sorted concurrently, each within a share of the budget. The sorted records of each run are spilled to disk. Then,
+// the runs are merged by a loser tree, which reads them in blocks. As the runs follow the input order and ties are won
+// by the earlier run, the result is the same as that of the in-memory sort. Only the RowIDs of the result, from which
+// the output is written, are kept in memory.
+RowIDPosList external_sort_by_normalized_keys(const Table& table,
+                                              const std::vector<SortColumnDefinition>& sort_definitions,
+                                              const NormalizedKeyLayout& key_layout, const size_t memory_budget,
+                                              Sort::PerformanceData& performance_data) {
+  Timer timer;
+  const auto row_count = static_cast<size_t>(table.row_count());
+  const auto chunk_count = table.chunk_count();
+  const auto key_width = key_layout.width;
+  const auto record_width = key_width + sizeof(RowID);
+
+  // 1. Split the chunks into runs. A run uses the RowIDs, keys, and records of its rows as well as two vectors of row
+  //    indices for the radix sort.
+  const auto concurrent_run_count = static_cast<size_t>(Hyrise::get().topology.num_cpus());
+  const auto run_bytes_per_row = sizeof(RowID) + key_width + record_width + 2 * sizeof(size_t);
+  const auto max_run_row_count = std::max(size_t{1}, memory_budget / (concurrent_run_count * run_bytes_per_row));
+
+  auto run_bounds = std::vector<ChunkID>{ChunkID{0}};
+  auto run_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    // Each run consists of at least one chunk
+    const auto chunk_size = static_cast<size_t>(chunk->size());
+    if (run_row_count > 0 && run_row_count + chunk_size > max_run_row_count) {
+      run_bounds.emplace_back(chunk_id);
+      run_row_count = 0;
+    }
+    run_row_count += chunk_size;
+  }
+  run_bounds.emplace_back(chunk_count);
+  const auto run_count = run_bounds.size() - 1;
+
+  // 2. Materialize and radix-sort the keys of each run and spill its records in sorted order
+  auto spill_file = SpillFile{Hyrise::get().spill_directory};
+  auto runs = std::vector<SpilledRun>(run_count);
+
+  execute_tasks(run_count, [&](const size_t run_id) {
+    auto row_ids = RowIDPosList{};
+    for (auto chunk_id = run_bounds[run_id]; chunk_id < run_bounds[run_id + 1]; ++chunk_id) {
+      const auto chunk_size = table.get_chunk(chunk_id)->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        row_ids.emplace_back(chunk_id, chunk_offset);
+      }
+    }
+
+    const auto run_row_count = row_ids.size();
+    auto keys = std::vector<uint8_t>(run_row_count * key_width);
+    auto first_row = size_t{0};
+    for (auto chunk_id = run_bounds[run_id]; chunk_id < run_bounds[run_id + 1]; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      write_normalized_keys(*chunk, sort_definitions, key_layout, keys.data() + first_row * key_width);
+      first_row += chunk->size();
+    }
+
+    auto rows = std::vector<size_t>(run_row_count);
+    std::iota(rows.begin(), rows.end(), size_t{0});
+    auto buffer = std::vector<size_t>(run_row_count);
+    radix_sort_rows(keys, key_width, rows.data(), buffer.data(), run_row_count);
+
+    auto records = std::vector<uint8_t>(run_row_count * record_width);
+    for (auto row = size_t{0}; row < run_row_count; ++row) {
+      auto* const record = &records[row * record_width];
+      std::memcpy(record, &keys[rows[row] * key_width], key_width);
+      std::memcpy(record + key_width, &row_ids[rows[row]], sizeof(RowID));
+    }
+    runs[run_id] = SpilledRun{spill_file.write_vector(records), run_row_count};
+  });
+  performance_data.spilled_bytes = spill_file.size();
+  performance_data.set_step_runtime(Sort::OperatorSteps::MaterializeSortColumns, timer.lap());
+
+  // 3. Merge the runs, splitting the budget among the blocks of their readers
+  const auto block_row_count =
+      std::clamp(memory_budget / (run_count * record_width), size_t{1}, Sort::EXTERNAL_SORT_MAX_BLOCK_ROW_COUNT);
+
+  auto readers = std::vector<SpilledRunReader>{};
+  readers.reserve(run_count);
+  for (const auto& run : runs) {
+    readers.emplace_back(spill_file, run, record_width, block_row_count);
+  }
+
+  auto loser_tree = LoserTree{readers, key_width};
+  auto pos_list = RowIDPosList(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    std::memcpy(&pos_list[row], readers[loser_tree.winner()].record() + key_width, sizeof(RowID));
+    loser_tree.advance();
+  }
+  performance_data.set_step_runtime(Sort::OperatorSteps::Sort, timer.lap());
+
+  return pos_list;
+}
+
+// Sorts the table by all (fixed-width) sort columns at once instead of one stable sort per column. Each row is
+// encoded as a normalized key that concatenates the keys of all sort columns. Tasks materialize the keys of a range of
+// chunks, radix-sort a range of rows, and the sorted runs are then merged pairwise. As both radix sort and merge are
+// stable, rows with equal keys keep their input order, which is the same result as the sequence of stable sorts.
+// If the keys do not fit into the memory budget of the query, the table is sorted externally.
+RowIDPosList sort_by_normalized_keys(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions,
+                                     const std::optional<size_t>& memory_budget,
+                                     Sort::PerformanceData& step_performance_data) {
+  Timer timer;
+  const auto row_count = static_cast<size_t>(table.row_count());
+  const auto chunk_count = table.chunk_count();
+
+  const auto key_layout = NormalizedKeyLayout{table, sort_definitions};
+  const auto key_width = key_layout.width;
+
+  // The keys, the RowIDs, and two vectors of row indices for the radix sort
+  if (memory_budget && row_count * (key_width + sizeof(RowID) + 2 * sizeof(size_t)) > *memory_budget) {
+    return external_sort_by_normalized_keys(table, sort_definitions, key_layout, *memory_budget,
+                                            step_performance_data);
+  }
+
+  // Rows are identified by their index in the input, starting with the first row of each chunk
+  auto first_row_by_chunk = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    first_row_by_chunk[chunk_id + 1] = first_row_by_chunk[chunk_id] + chunk->size();
+  }
+
+  // 1. Materialize the normalized keys (zero-initialized, which is the key of NULLs) and the RowIDs of all rows
+  auto keys = std::vector<uint8_t>(row_count * key_width);
+  auto row_ids = RowIDPosList(row_count);
+
+  const auto materialization_task_count = task_count_for(chunk_count, row_count);
+  execute_tasks(materialization_task_count, [&](const size_t task_id) {
+    const auto begin_chunk_id =
+        ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / materialization_task_count)};
+    const auto end_chunk_id =
+        ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / materialization_task_count)};
+
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      const auto first_row = first_row_by_chunk[chunk_id];
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        row_ids[first_row + chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+
+      write_normalized_keys(*chunk, sort_definitions, key_layout, keys.data() + first_row * key_width);
+    }
+  });
+  step_performance_data.set_step_runtime(Sort::OperatorSteps::MaterializeSortColumns, timer.lap());
+
+  // 2. Radix-sort ranges of rows and merge the sorted runs pairwise until a single one is left
+  auto rows = std::vector<size_t>(row_count);
+  std::iota(rows.begin(), rows.end(), size_t{0});
+  auto buffer = std::vector<size_t>(row_count);
+
+  const auto sort_task_count = task_count_for(row_count, row_count);
+  auto run_bounds = std::vector<size_t>(sort_task_count + 1);
+  for (auto task_id = size_t{0}; task_id <= sort_task_count; ++task_id) {
+    run_bounds[task_id] = row_count * task_id / sort_task_count;
+  }
+
+  execute_tasks(sort_task_count, [&](const size_t task_id) {
+    const auto begin_row = run_bounds[task_id];
+    radix_sort_rows(keys, key_width, rows.data() + begin_row, buffer.data() + begin_row,
+                    run_bounds[task_id + 1] - begin_row);
+  });
+
+  const auto key_less = [&](const size_t lhs, const size_t rhs) {
+    return std::memcmp(&keys[lhs * key_width], &keys[rhs * key_width], key_width) < 0;
+  };
+
+  while (run_bounds.size() > 2) {
+    const auto run_count = run_bounds.size() - 1;
+
+    // An odd run out is copied as it is
+    execute_tasks((run_count + 1) / 2, [&](const size_t merge_id) {
+      const auto begin = run_bounds[2 * merge_id];
+      const auto end = run_bounds[std::min(2 * merge_id + 2, run_count)];
+      if (2 * merge_id + 1 == run_count) {
+        std::copy(rows.begin() + begin, rows.begin() + end, buffer.begin() + begin);
+        return;
+      }
+
+      const auto middle = run_bounds[2 * merge_id + 1];
+      std::merge(rows.begin() + begin, rows.begin() + middle, rows.begin() + middle, rows.begin() + end,
+                 buffer.begin() + begin, key_less);
+    });
+
+    auto merged_run_bounds = std::vector<size_t>{};
+    for (auto run_id = size_t{0}; run_id < run_count; run_id += 2) {
+      merged_run_bounds.emplace_back(run_bounds[run_id]);
+    }
+    merged_run_bounds.emplace_back(row_count);
+
+    run_bounds = std::move(merged_run_bounds);
+    std::swap(rows, buffer);
+  }
+  step_performance_data.set_step_runtime(Sort::OperatorSteps::Sort, timer.lap());
+
+  // 3. Write the RowIDs in sorted order
+  auto pos_list = RowIDPosList(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    pos_list[row] = row_ids[rows[row]];
+  }
+  step_performance_data.set_step_runtime(Sort::OperatorSteps::TemporaryResultWriting, timer.lap());
+
+  return pos_list;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -222,7 +643,7 @@ namespace opossum {
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
            const ChunkOffset output_chunk_size, const ForceMaterialization force_materialization)
     : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr,
-                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+                               std::make_unique<PerformanceData>()),
       _sort_definitions(sort_definitions),
       _output_chunk_size(output_chunk_size),
       _force_materialization(force_materialization) {
@@ -244,6 +665,13 @@ std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+void Sort::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  if (spilled_bytes > 0) stream << separator << "Spilled " << format_bytes(spilled_bytes) << " to disk.";
+}
+
 std::shared_ptr<const Table> Sort::_on_execute() {
   const auto& input_table = left_input_table();
 
@@ -268,30 +696,44 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   // ReferenceSegments.
   auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
 
-  auto total_materialization_time = std::chrono::nanoseconds{};
-  auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
-  auto total_sort_time = std::chrono::nanoseconds{};
+  auto& step_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
 
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
+  // Fixed-width sort columns can be encoded into normalized keys, which are radix-sorted in parallel. Strings are
+  // sorted column by column.
+  const auto sort_columns_have_fixed_width =
+      std::all_of(_sort_definitions.begin(), _sort_definitions.end(), [&](const auto& sort_definition) {
+        const auto data_type = input_table->column_data_type(sort_definition.column);
+        return data_type != DataType::String && data_type != DataType::Null;
+      });
 
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+  if (sort_columns_have_fixed_width) {
+    previously_sorted_pos_list =
+        sort_by_normalized_keys(*input_table, _sort_definitions, _remaining_memory_budget(), step_performance_data);
+  } else {
+    auto total_materialization_time = std::chrono::nanoseconds{};
+    auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
+    auto total_sort_time = std::chrono::nanoseconds{};
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+    for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
+      const auto& sort_definition = _sort_definitions[sort_step];
+      const auto data_type = input_table->column_data_type(sort_definition.column);
 
-      total_materialization_time += sort_impl.materialization_time;
-      total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
-      total_sort_time += sort_impl.sort_time;
-    });
-  }
+      resolve_data_type(data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
 
-  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
-  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, total_materialization_time);
-  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, total_temporary_result_writing_time);
-  step_performance_data.set_step_runtime(OperatorSteps::Sort, total_sort_time);
+        auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
+        previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+
+        total_materialization_time += sort_impl.materialization_time;
+        total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
+        total_sort_time += sort_impl.sort_time;
+      });
+    }
+
+    step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, total_materialization_time);
+    step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, total_temporary_result_writing_time);
+    step_performance_data.set_step_runtime(OperatorSteps::Sort, total_sort_time);
+  }
 
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
@@ -18,13 +18,31 @@ namespace opossum {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ * If all sort columns have a fixed width, their values are encoded into one normalized key per row, which is sorted
+ * by a parallel radix sort. Otherwise, one stable sort per sort column is used.
+ * If the normalized keys do not fit into the memory budget of the query (see QueryContext), an external merge sort is
+ * used instead: sorted runs are spilled to disk and merged by a loser tree.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
+  // Sorting and writing the output is split into tasks of at least JOB_SPAWN_THRESHOLD rows each
+  static constexpr auto JOB_SPAWN_THRESHOLD = 10'000;
+
+  // The external sort reads spilled runs in blocks of at most this many rows
+  static constexpr auto EXTERNAL_SORT_MAX_BLOCK_ROW_COUNT = size_t{16'384};
+
   enum class ForceMaterialization : bool { Yes = true, No = false };
 
   enum class OperatorSteps : uint8_t { MaterializeSortColumns, Sort, TemporaryResultWriting, WriteOutput };
 
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // The number of bytes of the sorted runs that were spilled because the normalized keys did not fit into the memory
+    // budget of the query
+    size_t spilled_bytes{0};
+  };
+
   Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
        const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE,
        const ForceMaterialization force_materialization = ForceMaterialization::No);
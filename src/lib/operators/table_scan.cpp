@@ -1,5 +1,7 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -17,6 +19,7 @@
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -33,6 +36,8 @@
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/conjunction_table_scan_impl.hpp"
+#include "table_scan/disjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
@@ -75,7 +80,9 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy());
+  const auto copy = std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy());
+  copy->excluded_chunk_ids = excluded_chunk_ids;
+  return copy;
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
@@ -88,116 +95,48 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
+  const auto chunk_count = in_table->chunk_count();
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(chunk_count - excluded_chunk_set.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!excluded_chunk_set.contains(chunk_id)) chunk_ids.emplace_back(chunk_id);
+  }
+
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  output_chunks.reserve(chunk_ids.size());
+  _set_total_chunk_count(chunk_ids.size());
+
+  // Small chunks are scanned together in one job, large ones get a job of their own (see JobPartitioner)
+  const auto chunk_groups = Hyrise::get().job_partitioner.partition(*in_table, chunk_ids);
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  jobs.reserve(chunk_groups.size());
 
-  const auto chunk_count = in_table->chunk_count();
-  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-    const auto chunk_in = in_table->get_chunk(chunk_id);
-    Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      Segments out_segments;
-      out_segments.reserve(in_table->column_count());
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
-       */
-      auto keep_chunk_sort_order = true;
-      if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
-          // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-            out_segments.emplace_back(segment_in);
-          }
-        } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-
-            auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-            DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-            const auto pos_list_in = ref_segment_in->pos_list();
-
-            const auto table_out = ref_segment_in->referenced_table();
-            const auto column_id_out = ref_segment_in->referenced_column_id();
-
-            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-            if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              size_t offset = 0;
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
-            }
-
-            const auto ref_segment_out =
-                std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-            out_segments.push_back(ref_segment_out);
-          }
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
+  // With a row budget, the jobs stop once the chunks of all jobs have enough rows
+  auto output_row_count = std::atomic<size_t>{0};
 
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+  for (const auto& chunk_group : chunk_groups) {
+    auto perform_table_scan = [this, &chunk_group, &in_table, &output_mutex, &output_chunks, &output_row_count]() {
+      for (const auto chunk_id : chunk_group) {
+        if (is_cancelled() || _row_budget_reached(output_row_count.load())) return;
 
-        for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
-          const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      }
+        const auto chunk = scan_chunk(in_table, chunk_id, *_impl);
+        _add_processed_chunks();
+        if (!chunk) continue;
 
-      const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
-      chunk->finalize();
-      if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
-        chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+        output_row_count += chunk->size();
+        std::lock_guard<std::mutex> lock(output_mutex);
+        output_chunks.emplace_back(chunk);
       }
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_chunks.emplace_back(chunk);
     };
-    // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
-    // time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
+
+    if (chunk_groups.size() == 1) {
+      perform_table_scan();
+    } else {
+      // Scan the chunks on the NUMA node that holds them
       auto job_task = std::make_shared<JobTask>(perform_table_scan);
+      job_task->set_node_id(in_table->get_chunk(chunk_group.front())->numa_node_id());
       jobs.push_back(job_task);
-    } else {
-      perform_table_scan();
     }
   }
 
@@ -208,7 +147,107 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
 
-  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References,
+                                 _coalesce_reference_chunks(std::move(output_chunks)));
+}
+
+std::shared_ptr<Chunk> TableScan::scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                             AbstractTableScanImpl& impl) {
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(chunk_id);
+  if (matches_out->empty()) return nullptr;
+
+  Segments out_segments;
+  out_segments.reserve(in_table->column_count());
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
+   * the matches to construct the reference segments of the output. If it is a reference segment, we need to
+   * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
+   * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
+   * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
+   * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
+   * share their position list).
+   */
+  auto keep_chunk_sort_order = true;
+
+  // Most scan implementations emit their matches in ascending order. If they do, sorted input positions stay sorted
+  // (see AbstractPosList::is_sorted).
+  const auto matches_are_sorted = std::is_sorted(matches_out->cbegin(), matches_out->cend());
+
+  if (in_table->type() == TableType::References) {
+    if (matches_out->size() == chunk_in->size()) {
+      // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+        out_segments.emplace_back(segment_in);
+      }
+    } else {
+      auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+          if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
+          } else {
+            // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+            // reason is that several table scan implementations split the pos lists by chunks (see
+            // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+            // this does not affect all scan implementations, we chose the safe and defensive path for now.
+            keep_chunk_sort_order = false;
+          }
+          if (matches_are_sorted && pos_list_in->is_sorted()) filtered_pos_list->guarantee_sorted();
+
+          size_t offset = 0;
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            (*filtered_pos_list)[offset] = row_id;
+            ++offset;
+          }
+        }
+
+        const auto ref_segment_out =
+            std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+    if (matches_are_sorted) matches_out->guarantee_sorted();
+
+    // If the entire chunk is matched, create an EntireChunkPosList instead
+    const auto output_pos_list = matches_out->size() == chunk_in->size()
+                                     ? static_cast<std::shared_ptr<AbstractPosList>>(
+                                           std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
+                                     : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+
+    for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
+      const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+  chunk->finalize();
+  if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
+    chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+  }
+  return chunk;
 }
 
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
@@ -246,6 +285,11 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
 }
 
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  return create_impl(left_input_table(), _predicate);
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl(const std::shared_ptr<const Table>& in_table,
+                                                              const std::shared_ptr<AbstractExpression>& predicate) {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -258,7 +302,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  auto resolved_predicate = _resolve_uncorrelated_subqueries(predicate);
 
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
@@ -307,23 +351,23 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column of type string> LIKE <value of type string>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(left_input_table(), left_column_expression->column_id,
-                                                       predicate_condition, boost::get<pmr_string>(*right_value));
+      return std::make_unique<ColumnLikeTableScanImpl>(in_table, left_column_expression->column_id, predicate_condition,
+                                                       boost::get<pmr_string>(*right_value));
     }
 
     // Predicate pattern: <column of type T> <binary predicate_condition> <value of type T>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, left_column_expression->column_id,
                                                           predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), right_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, right_column_expression->column_id,
                                                           flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                            predicate_condition, right_column_expression->column_id);
     }
   }
@@ -332,7 +376,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnIsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                          is_null_expression->predicate_condition);
     }
   }
@@ -376,13 +420,50 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column of type T> BETWEEN <value of type T> AND <value of type T>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(left_input_table(), left_column->column_id,
-                                                          *lower_bound_value, *upper_bound_value, predicate_condition);
+      return std::make_unique<ColumnBetweenTableScanImpl>(in_table, left_column->column_id, *lower_bound_value,
+                                                          *upper_bound_value, predicate_condition);
+    }
+  }
+
+  if (const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(resolved_predicate);
+      logical_expression && logical_expression->logical_operator == LogicalOperator::Or) {
+    // Predicate pattern: <predicate> OR <predicate> OR ..., where at least one predicate has a dedicated scanning
+    // implementation. The other predicates are evaluated by the ExpressionEvaluator.
+    auto predicate_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    auto has_dedicated_impl = false;
+    for (const auto& disjunct : flatten_logical_expressions(resolved_predicate, LogicalOperator::Or)) {
+      predicate_impls.emplace_back(create_impl(in_table, disjunct));
+      if (!dynamic_cast<const ExpressionEvaluatorTableScanImpl*>(predicate_impls.back().get())) {
+        has_dedicated_impl = true;
+      }
+    }
+
+    if (has_dedicated_impl) {
+      return std::make_unique<DisjunctionTableScanImpl>(in_table, std::move(predicate_impls));
+    }
+  }
+
+  if (const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(resolved_predicate);
+      logical_expression && logical_expression->logical_operator == LogicalOperator::And) {
+    // Predicate pattern: <predicate> AND <predicate> AND ..., where each predicate is scanned on a single column
+    auto predicate_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    auto all_dereferenced = true;
+    for (const auto& conjunct : flatten_logical_expressions(resolved_predicate, LogicalOperator::And)) {
+      auto predicate_impl = create_impl(in_table, conjunct);
+      if (!dynamic_cast<const AbstractDereferencedColumnTableScanImpl*>(predicate_impl.get())) {
+        all_dereferenced = false;
+        break;
+      }
+      predicate_impls.emplace_back(std::move(predicate_impl));
+    }
+
+    if (all_dereferenced) {
+      return std::make_unique<ConjunctionTableScanImpl>(in_table, std::move(predicate_impls));
     }
   }
 
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(left_input_table(), resolved_predicate);
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate);
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
@@ -14,6 +14,7 @@
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -32,6 +33,15 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
 
+  // Creates the TableScanImpl for a predicate on the given table. Also used by the PipelinedTableScan.
+  static std::unique_ptr<AbstractTableScanImpl> create_impl(const std::shared_ptr<const Table>& in_table,
+                                                            const std::shared_ptr<AbstractExpression>& predicate);
+
+  // Scans a chunk of the given table with an impl that was created for that table. Returns the output chunk of
+  // ReferenceSegments, or nullptr if no row matched.
+  static std::shared_ptr<Chunk> scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                           AbstractTableScanImpl& impl);
+
   /**
    * @brief If set, the specified chunks will not be scanned.
    *
@@ -27,6 +27,8 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
 
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
     _scan_reference_segment(*reference_segment, chunk_id, *matches);
+  } else if (_can_prune(*chunk, _column_id)) {
+    ++num_chunks_with_early_out;
   } else {
     _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
   }
@@ -34,6 +36,42 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
   return matches;
 }
 
+std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_positions(
+    const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& positions) {
+  DebugAssert(positions->references_single_chunk(), "Expected positions within a single chunk");
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto& segment = chunk->get_segment(_column_id);
+
+  auto matches = std::make_shared<RowIDPosList>();
+
+  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    // Scan a ReferenceSegment that references only the rows of the referenced table at the given positions
+    const auto& pos_list = *reference_segment->pos_list();
+    auto referenced_positions = std::make_shared<RowIDPosList>();
+    referenced_positions->reserve(positions->size());
+    for (const auto& position : *positions) {
+      referenced_positions->emplace_back(pos_list[position.chunk_offset]);
+    }
+    if (pos_list.references_single_chunk()) referenced_positions->guarantee_single_chunk();
+
+    const auto filtered_segment = ReferenceSegment{reference_segment->referenced_table(),
+                                                   reference_segment->referenced_column_id(), referenced_positions};
+    _scan_reference_segment(filtered_segment, chunk_id, *matches);
+  } else if (_can_prune(*chunk, _column_id)) {
+    ++num_chunks_with_early_out;
+  } else {
+    _scan_non_reference_segment(*segment, chunk_id, *matches, positions);
+  }
+
+  // The scan has filled `matches` with indices into `positions`
+  for (auto& match : *matches) {
+    match.chunk_offset = (*positions)[match.chunk_offset].chunk_offset;
+  }
+
+  return matches;
+}
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
@@ -42,6 +80,10 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
     // Fast path :)
 
     const auto chunk = segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+    if (_can_prune(*chunk, segment.referenced_column_id())) {
+      ++num_chunks_with_early_out;
+      return;
+    }
     auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
 
     _scan_non_reference_segment(*referenced_segment, chunk_id, matches, pos_list);
@@ -60,6 +102,10 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
     if (!position_filter || position_filter->empty()) continue;
 
     const auto chunk = segment.referenced_table()->get_chunk(referenced_chunk_id);
+    if (_can_prune(*chunk, segment.referenced_column_id())) {
+      ++num_chunks_with_early_out;
+      continue;
+    }
     auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
 
     const auto num_previous_matches = matches.size();
@@ -75,4 +121,9 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
   }
 }
 
+bool AbstractDereferencedColumnTableScanImpl::_can_prune(const Chunk& stored_chunk,
+                                                         const ColumnID stored_column_id) const {
+  return false;
+}
+
 }  // namespace opossum
@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class Chunk;
 class Table;
 class ReferenceSegment;
 class AbstractSegment;
@@ -29,11 +30,24 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
 
+  // Scans only the given rows of the chunk (e.g., the matches of another predicate) and returns those that match, in
+  // the same order. The positions must reference the chunk of the input table and guarantee this by
+  // references_single_chunk(). Used by the ConjunctionTableScanImpl.
+  std::shared_ptr<RowIDPosList> scan_positions(const ChunkID chunk_id,
+                                               const std::shared_ptr<const RowIDPosList>& positions);
+
   const PredicateCondition predicate_condition;
 
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
 
+  // Returns true if the pruning statistics or the partition of the stored chunk rule out that any of its values in the
+  // given column matches. Such chunks (or the parts of a ReferenceSegment that point to them) are skipped and count as
+  // early outs.
+  // In contrast to the ChunkPruningRule, this covers values that are only known at execution time, e.g., the
+  // parameters of prepared statements or the results of uncorrelated subqueries.
+  virtual bool _can_prune(const Chunk& stored_chunk, const ColumnID stored_column_id) const;
+
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
   // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
@@ -1,16 +1,21 @@
 #pragma once
 
-#ifdef __AVX512VL__
+#if defined(__AVX512VL__) || defined(__AVX2__)
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <limits>
+#include <string_view>
 
 #include "operators/operator_performance_data.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -56,8 +61,9 @@ class AbstractTableScanImpl {
     // For a description of the SIMD code, have a look at the comments in that method.
     // To reduce compile time, SIMD scanning is not used for for ColumnVsColumnScans. Also, string comparisons are more
     // expensive than the scan itself, so we disable SIMD for these, too.
-    if constexpr (std::is_same_v<RightIterator, std::false_type> &&
-                  !std::is_same_v<std::decay_t<decltype(left_it->value())>, pmr_string>) {
+    using LeftValueType = std::decay_t<decltype(left_it->value())>;
+    if constexpr (std::is_same_v<RightIterator, std::false_type> && !std::is_same_v<LeftValueType, pmr_string> &&
+                  !std::is_same_v<LeftValueType, std::string_view>) {
       _simd_scan_with_iterators<CheckForNull>(func, left_it, left_end, chunk_id, matches_out, right_it);
     }
 
@@ -94,9 +100,11 @@ class AbstractTableScanImpl {
     // Most of the performance gain does not come from scanning the input data but from inserting into matches_out more
     // efficiently. That is why you will see bigger benefits for scans that select more rows.
     //
-    // Finally, this implementation is only better if we are on a machine that supports AVX-512 VL. If we are not, we
-    // still do one iteration, simply to reduce the amount of dead / diverging code. After that, we return to the
-    // non-SIMD scan.
+    // Finally, this implementation is only better if we are on a machine that supports AVX-512 VL or AVX2. AVX-512 VL
+    // has a compress instruction for moving the matching rows. With AVX2, a permutation that is looked up for the
+    // mask does the same. If neither is supported, we still do one iteration, simply to reduce the amount of dead /
+    // diverging code. After that, we return to the non-SIMD scan. As the scan is compiled for the host (see
+    // -march=native), the instruction set is chosen at compile time.
 
     // We assume a maximum SIMD register size of 256 bit. Smaller registers simply lead to the inner loop being unrolled
     // more than once. Even on machines with 512-bit SIMD registers, we prefer to use 256 bits, because current Intel
@@ -188,8 +196,8 @@ class AbstractTableScanImpl {
       }
 
       // Now write the matches into matches_out.
-#ifndef __AVX512VL__
-      // "Slow" path for non-AVX512VL systems
+#if !defined(__AVX512VL__) && !defined(__AVX2__)
+      // "Slow" path for systems without AVX-512 VL and AVX2
       for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
         if (mask >> i & 1) {
           matches_out[matches_out_index++].chunk_offset = offsets[i];
@@ -200,11 +208,23 @@ class AbstractTableScanImpl {
       // might be significantly slower.
       break;
 #else
-      // Fast path for AVX512VL systems
+      // Fast path for AVX512VL and AVX2 systems
 
       // Compress `offsets`, i.e., move all values where the mask is set to 1 to the front
-      auto offsets_simd =
-          _mm256_maskz_compress_epi32(static_cast<unsigned char>(mask), reinterpret_cast<__m256i&>(offsets));
+      const auto offsets_simd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets.data()));
+#ifdef __AVX512VL__
+      const auto compressed_offsets_simd = _mm256_maskz_compress_epi32(static_cast<unsigned char>(mask), offsets_simd);
+#else
+      static_assert(BLOCK_SIZE == 8, "AVX2 permutations expect eight offsets per block");
+      static constexpr auto COMPRESS_PERMUTATIONS = _compress_permutations();
+      const auto permutation = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(COMPRESS_PERMUTATIONS[mask].data()));
+      const auto compressed_offsets_simd = _mm256_permutevar8x32_epi32(offsets_simd, permutation);
+#endif
+
+      // Reading the lanes of the register through a ChunkOffset pointer would violate strict aliasing, so the
+      // compressed offsets are stored first.
+      auto compressed_offsets = std::array<ChunkOffset, BLOCK_SIZE>{};
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(compressed_offsets.data()), compressed_offsets_simd);
 
       // Copy all offsets into `matches_out` - even those that are set to 0 (which are located at the end). This does
       // not matter because they will be overwritten in the next round anyway. Copying more than necessary is better
@@ -216,7 +236,7 @@ class AbstractTableScanImpl {
       #pragma omp simd safelen(BLOCK_SIZE)
       // clang-format on
       for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
-        matches_out[matches_out_index + i].chunk_offset = (reinterpret_cast<ChunkOffset*>(&offsets_simd))[i];
+        matches_out[matches_out_index + i].chunk_offset = compressed_offsets[i];
       }
 
       // Count the number of matches and increase the index of the next write to matches_out accordingly
@@ -236,6 +256,167 @@ class AbstractTableScanImpl {
     // The remainder is now done by the regular scan
   }
 
+  // For each mask of eight rows, the permutation that moves the offsets of the matching rows to the front. Used to
+  // compress offsets on AVX2 systems, which lack the compress instruction of AVX-512.
+  static constexpr std::array<std::array<uint32_t, 8>, 256> _compress_permutations() {
+    auto permutations = std::array<std::array<uint32_t, 8>, 256>{};
+    for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+      auto position = size_t{0};
+      for (auto row = uint32_t{0}; row < 8; ++row) {
+        if (mask >> row & 1) permutations[mask][position++] = row;
+      }
+    }
+    return permutations;
+  }
+
+  /**
+   * Scans the value IDs of a dictionary-encoded segment for the range [lower_value_id, upper_value_id) while they are
+   * still in their compressed form. For fixed-size byte-aligned attribute vectors, the 8- or 16-bit codes are compared
+   * without widening them to ValueIDs first. Thus, more codes fit into a SIMD register and less memory bandwidth is
+   * used compared to going through the attribute vector iterable. Matches are written directly into matches_out.
+   *
+   * The NULL value ID has to be outside of the range, i.e., NULLs are never matched. Returns false if the given
+   * vector type is not supported. In that case, nothing is written and the caller has to use the iterable.
+   */
+  static bool _scan_compressed_value_id_range(const BaseCompressedVector& attribute_vector,
+                                              const ValueID lower_value_id, const ValueID upper_value_id,
+                                              const ChunkID chunk_id, RowIDPosList& matches_out) {
+    return _with_fixed_size_byte_aligned_codes(attribute_vector, [&](const auto& codes) {
+      _scan_code_range(codes, size_t{0}, codes.size(), static_cast<ValueID::base_type>(lower_value_id),
+                       static_cast<ValueID::base_type>(upper_value_id), chunk_id, matches_out);
+    });
+  }
+
+  /**
+   * Scans a FrameOfReferenceSegment for the values in [lower, upper] without decoding them. Blocks whose [minimum,
+   * maximum] does not overlap with the range are skipped and blocks within the range match as a whole. For the
+   * remaining blocks, the range is shifted by the block's minimum and compared to the offsets in their compressed form
+   * (see _scan_compressed_value_id_range). NULLs are removed from the matches, as they are stored as an offset of zero.
+   *
+   * Returns false if the offsets are not stored in a fixed-size byte-aligned vector. In that case, nothing is written
+   * and the caller has to use the iterable.
+   */
+  template <typename T>
+  static bool _scan_frame_of_reference_range(const FrameOfReferenceSegment<T>& segment, const T lower, const T upper,
+                                             const ChunkID chunk_id, RowIDPosList& matches_out) {
+    return _with_fixed_size_byte_aligned_codes(segment.offset_values(), [&](const auto& codes) {
+      if (lower > upper) return;
+
+      using UnsignedT = std::make_unsigned_t<T>;
+      constexpr auto BLOCK_SIZE = size_t{FrameOfReferenceSegment<T>::block_size};
+      const auto& block_minima = segment.block_minima();
+      const auto& block_maxima = segment.block_maxima();
+      const auto& null_values = segment.null_values();
+      const auto size = codes.size();
+
+      for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+        const auto block_minimum = block_minima[block_index];
+        const auto block_maximum = block_maxima[block_index];
+        if (block_maximum < lower || block_minimum > upper) continue;
+
+        const auto block_begin = block_index * BLOCK_SIZE;
+        const auto block_end = std::min(block_begin + BLOCK_SIZE, size);
+        const auto block_matches_begin = matches_out.size();
+
+        if (lower <= block_minimum && block_maximum <= upper) {
+          matches_out.resize(block_matches_begin + (block_end - block_begin));
+          for (auto offset = block_begin; offset < block_end; ++offset) {
+            const auto chunk_offset = static_cast<ChunkOffset>(offset);
+            matches_out[block_matches_begin + (offset - block_begin)] = RowID{chunk_id, chunk_offset};
+          }
+        } else {
+          // The offsets are at most the block's maximum minus its minimum, which fits into 32 bits (see
+          // FrameOfReferenceEncoder). As the block only partially matches, the shifted range does not cover all of
+          // them, so that its exclusive upper bound fits into 32 bits as well.
+          const auto lower_offset = static_cast<uint32_t>(static_cast<UnsignedT>(std::max(lower, block_minimum)) -
+                                                          static_cast<UnsignedT>(block_minimum));
+          const auto upper_offset = static_cast<uint32_t>(static_cast<UnsignedT>(std::min(upper, block_maximum)) -
+                                                          static_cast<UnsignedT>(block_minimum));
+          _scan_code_range(codes, block_begin, block_end, lower_offset, uint64_t{upper_offset} + 1, chunk_id,
+                           matches_out);
+        }
+
+        if (null_values) {
+          const auto matches_begin = matches_out.begin() + static_cast<std::ptrdiff_t>(block_matches_begin);
+          const auto matches_end = std::remove_if(matches_begin, matches_out.end(), [&](const auto& row_id) {
+            return (*null_values)[row_id.chunk_offset];
+          });
+          matches_out.resize(static_cast<size_t>(std::distance(matches_out.begin(), matches_end)));
+        }
+      }
+    });
+  }
+
+  // Calls the functor with the codes of a fixed-size byte-aligned vector. Returns false for other vector types.
+  template <typename Functor>
+  static bool _with_fixed_size_byte_aligned_codes(const BaseCompressedVector& vector, const Functor& functor) {
+    switch (vector.type()) {
+      case CompressedVectorType::FixedSize1ByteAligned:
+        functor(static_cast<const FixedSizeByteAlignedVector<uint8_t>&>(vector).data());
+        return true;
+      case CompressedVectorType::FixedSize2ByteAligned:
+        functor(static_cast<const FixedSizeByteAlignedVector<uint16_t>&>(vector).data());
+        return true;
+      case CompressedVectorType::FixedSize4ByteAligned:
+        functor(static_cast<const FixedSizeByteAlignedVector<uint32_t>&>(vector).data());
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Writes the offsets in [begin_offset, end_offset) whose code lies in [lower, upper) to matches_out
+  template <typename UnsignedIntType>
+  static void __attribute__((hot, noinline))
+  _scan_code_range(const pmr_vector<UnsignedIntType>& codes, const size_t begin_offset, const size_t end_offset,
+                   const uint64_t lower, const uint64_t upper, const ChunkID chunk_id, RowIDPosList& matches_out) {
+    DebugAssert(lower < upper, "Expected non-empty code range");
+    DebugAssert(upper - 1 <= std::numeric_limits<UnsignedIntType>::max(), "Code range exceeds the width of the codes");
+
+    // See ColumnBetweenTableScanImpl: (x >= a && x < b) === ((x - a) < (b - a)) for unsigned integers. Casting the
+    // difference back into UnsignedIntType keeps the comparison in the narrow type.
+    const auto typed_lower = static_cast<UnsignedIntType>(lower);
+    const auto typed_diff = static_cast<UnsignedIntType>(upper - lower);
+
+    constexpr auto BLOCK_SIZE = size_t{64};
+    const auto* const data = codes.data();
+
+    auto matches_out_index = matches_out.size();
+    auto offset = begin_offset;
+    for (; offset + BLOCK_SIZE <= end_offset; offset += BLOCK_SIZE) {
+      auto mask = uint64_t{0};
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
+        mask |= uint64_t{static_cast<UnsignedIntType>(data[offset + i] - typed_lower) < typed_diff} << i;
+      }
+
+      if (!mask) continue;
+
+      // Grow more aggressively than the default behavior as the potentially wasted space is only ephemeral (see above)
+      if (matches_out_index + BLOCK_SIZE > matches_out.size()) {
+        matches_out.resize((BLOCK_SIZE + matches_out.size()) * 3, RowID{chunk_id, 0});
+      }
+
+      while (mask) {
+        const auto i = static_cast<size_t>(__builtin_ctzll(mask));
+        matches_out[matches_out_index++] = RowID{chunk_id, static_cast<ChunkOffset>(offset + i)};
+        mask &= mask - 1;
+      }
+    }
+
+    matches_out.resize(matches_out_index);
+
+    for (; offset < end_offset; ++offset) {
+      if (static_cast<UnsignedIntType>(data[offset] - typed_lower) < typed_diff) {
+        matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(offset)});
+      }
+    }
+  }
+
   /**@}*/
 };
 
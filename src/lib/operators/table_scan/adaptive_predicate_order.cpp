@@ -0,0 +1,42 @@
+#include "adaptive_predicate_order.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace opossum {
+
+AdaptivePredicateOrder::AdaptivePredicateOrder(const size_t predicate_count)
+    : _predicate_statistics(predicate_count) {}
+
+std::vector<size_t> AdaptivePredicateOrder::order() const {
+  const auto predicate_count = _predicate_statistics.size();
+
+  auto ranks = std::vector<double>(predicate_count, std::numeric_limits<double>::infinity());
+  for (auto predicate_id = size_t{0}; predicate_id < predicate_count; ++predicate_id) {
+    const auto& statistics = _predicate_statistics[predicate_id];
+    const auto input_row_count = static_cast<double>(statistics.input_row_count.load());
+    if (input_row_count == 0) continue;
+
+    const auto selectivity = static_cast<double>(statistics.output_row_count.load()) / input_row_count;
+    // Avoid dividing by zero for scans that were too fast to be measured
+    const auto cost_per_row = std::max(static_cast<double>(statistics.runtime_ns.load()), 1.0) / input_row_count;
+    ranks[predicate_id] = (1.0 - selectivity) / cost_per_row;
+  }
+
+  auto order = std::vector<size_t>(predicate_count);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) { return ranks[lhs] > ranks[rhs]; });
+  return order;
+}
+
+void AdaptivePredicateOrder::record(const size_t predicate_id, const size_t input_row_count,
+                                    const size_t output_row_count, const std::chrono::nanoseconds runtime) {
+  auto& statistics = _predicate_statistics[predicate_id];
+  statistics.input_row_count += input_row_count;
+  statistics.output_row_count += output_row_count;
+  statistics.runtime_ns += static_cast<uint64_t>(runtime.count());
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Orders the predicates of a conjunction by their selectivity and cost as measured while scanning the chunks of a
+ * table, instead of relying on the estimates that the PredicateReorderingRule used, which can be far off (e.g., for
+ * LIKE or correlated columns). Used by the ConjunctionTableScanImpl and the PipelinedTableScan, which apply each
+ * predicate to the rows that passed the previous ones.
+ *
+ * For independent predicates, the expected cost of scanning a row is minimized if the predicates are ordered by
+ * descending rank = (1 - selectivity) / cost per row, i.e., predicates that filter out many rows at a low cost come
+ * first. Predicates that have not been measured yet (e.g., because the previous ones did not leave any rows) come
+ * first, so that each of them is measured on the next chunk. Afterwards, the order follows the measurements and is
+ * refined with every chunk. The selectivities and costs of the later predicates are measured on the rows that passed
+ * the previous ones, so they are not independent of the order. They are still a good indicator.
+ *
+ * record() and order() can be called concurrently for different chunks.
+ */
+class AdaptivePredicateOrder {
+ public:
+  explicit AdaptivePredicateOrder(const size_t predicate_count);
+
+  // The order in which the next chunk should be scanned, as indices of the predicates
+  std::vector<size_t> order() const;
+
+  void record(const size_t predicate_id, const size_t input_row_count, const size_t output_row_count,
+              const std::chrono::nanoseconds runtime);
+
+ private:
+  struct PredicateStatistics {
+    std::atomic<uint64_t> input_row_count{0};
+    std::atomic<uint64_t> output_row_count{0};
+    std::atomic<uint64_t> runtime_ns{0};
+  };
+
+  std::vector<PredicateStatistics> _predicate_statistics;
+};
+
+}  // namespace opossum
@@ -1,13 +1,16 @@
 #include "column_between_table_scan_impl.hpp"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 
 #include "expression/between_expression.hpp"
 #include "sorted_segment_search.hpp"
+#include "statistics/base_attribute_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -34,6 +37,16 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+bool ColumnBetweenTableScanImpl::_can_prune(const Chunk& stored_chunk, const ColumnID stored_column_id) const {
+  if (stored_chunk.partition_does_not_contain(stored_column_id, predicate_condition, left_value, right_value)) {
+    return true;
+  }
+
+  const auto& pruning_statistics = stored_chunk.pruning_statistics();
+  return pruning_statistics &&
+         (*pruning_statistics)[stored_column_id]->does_not_contain(predicate_condition, left_value, right_value);
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -55,6 +68,8 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   }
 
   // Select optimized or generic scanning implementation based on segment type
+  if (!position_filter && _scan_frame_of_reference_segment(segment, chunk_id, matches)) return;
+
   if (dictionary_segment) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
   } else {
@@ -88,6 +103,41 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(
   });
 }
 
+bool ColumnBetweenTableScanImpl::_scan_frame_of_reference_segment(const AbstractSegment& segment,
+                                                                  const ChunkID chunk_id, RowIDPosList& matches) const {
+  auto scanned = false;
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<ColumnDataType>)) {
+      const auto* const for_segment = dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment);
+      if (!for_segment) return;
+
+      // Exclusive bounds are turned into inclusive ones. If there is no value beyond an exclusive bound, nothing
+      // matches.
+      auto lower = boost::get<ColumnDataType>(left_value);
+      auto upper = boost::get<ColumnDataType>(right_value);
+      if (!is_lower_inclusive_between(predicate_condition)) {
+        if (lower == std::numeric_limits<ColumnDataType>::max()) {
+          scanned = true;
+          return;
+        }
+        ++lower;
+      }
+      if (!is_upper_inclusive_between(predicate_condition)) {
+        if (upper == std::numeric_limits<ColumnDataType>::min()) {
+          scanned = true;
+          return;
+        }
+        --upper;
+      }
+
+      scanned = _scan_frame_of_reference_range(*for_segment, lower, upper, chunk_id, matches);
+    }
+  });
+  return scanned;
+}
+
 void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -159,6 +209,11 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  if (!position_filter && _scan_compressed_value_id_range(*segment.attribute_vector(), lower_bound_value_id,
+                                                          upper_bound_value_id, chunk_id, matches)) {
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
@@ -189,6 +244,7 @@ void ColumnBetweenTableScanImpl::_scan_sorted_segment(const AbstractSegment& seg
         const auto typed_right_value = boost::get<ColumnDataType>(right_value);
         auto sorted_segment_search = SortedSegmentSearch(segment_begin, segment_end, sort_mode, _column_is_nullable,
                                                          predicate_condition, typed_left_value, typed_right_value);
+        sorted_segment_search.use_block_minima(typed_segment, position_filter != nullptr);
 
         sorted_segment_search.scan_sorted_segment([&](auto begin, auto end) {
           sorted_segment_search._write_rows_to_matches(begin, end, chunk_id, matches, position_filter);
@@ -33,12 +33,18 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant right_value;
 
  protected:
+  bool _can_prune(const Chunk& stored_chunk, const ColumnID stored_column_id) const override;
+
   void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
+  // Returns false if the segment is not a FrameOfReferenceSegment or its offsets cannot be scanned directly
+  bool _scan_frame_of_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches) const;
+
   // Optimized scan on DictionarySegments
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
@@ -1,5 +1,6 @@
 #include "column_is_null_table_scan_impl.hpp"
 
+#include <bit>
 #include <memory>
 
 #include "storage/base_value_segment.hpp"
@@ -7,7 +8,6 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
-#include "storage/value_segment/null_value_vector_iterable.hpp"
 
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
@@ -106,11 +106,37 @@ void ColumnIsNullTableScanImpl::_scan_value_segment(const BaseValueSegment& segm
 
   DebugAssert(segment.is_nullable(), "Columns that are not nullable should have been caught by edge case handling.");
 
-  auto iterable = NullValueVectorIterable{segment.null_values()};
-
+  const auto& null_values = segment.null_values();
   const auto invert = _predicate_condition == PredicateCondition::IsNotNull;
-  const auto functor = [&](const auto& value) { return invert ^ value.is_null(); };
-  iterable.with_iterators([&](auto it, auto end) { _scan_with_iterators<false>(functor, it, end, chunk_id, matches); });
+
+  // Nullable segments often contain no NULLs at all
+  if (null_values.none()) {
+    if (invert) {
+      _add_all(chunk_id, matches, segment.size());
+      ++num_chunks_with_all_rows_matching;
+    } else {
+      ++num_chunks_with_early_out;
+    }
+    return;
+  }
+
+  // Instead of testing every bit, only the set bits of each (inverted) word of the bitmap are visited
+  const auto segment_size = null_values.size();
+  matches.reserve(matches.size() + (invert ? segment_size - null_values.count() : null_values.count()));
+
+  const auto& words = null_values.words();
+  const auto word_count = words.size();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    auto word = invert ? ~words[word_id] : words[word_id];
+    while (word != 0) {
+      const auto chunk_offset = word_id * NullBitmap::BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word));
+      // Inverting sets the padding bits beyond the segment's size
+      if (chunk_offset >= segment_size) break;
+
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+      word &= word - 1;
+    }
+  }
 }
 
 bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) const {
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -24,7 +25,15 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  if (!LikeMatcher::contains_wildcard(pattern)) {
+    _equals_string = pattern;
+  } else if (tokens.size() == 2 && std::holds_alternative<pmr_string>(tokens[0]) &&
+             tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars}) {
+    _starts_with_string = std::get<pmr_string>(tokens[0]);
+  }
+}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
@@ -32,11 +41,15 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
   // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
-  // input rows, use an optimized implementation.
+  // input rows, use an optimized implementation. Dictionaries that are shared with other chunks (see
+  // ChunkEncoder::merge_dictionaries()) can hold more values than the segment.
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
       dictionary_segment &&
-      (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
+      dictionary_segment->unique_values_count() <= (position_filter ? position_filter->size() : segment.size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && (_equals_string || _starts_with_string)) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -111,6 +124,36 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                 RowIDPosList& matches,
+                                                 const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  const auto& symbol_table = segment.symbol_table();
+  const auto iterable = FSSTSegmentIterable<pmr_string, true>{segment};
+  const auto invert_results = _invert_results;
+
+  if (_equals_string) {
+    // Equal strings have equal compressed representations, so the pattern is compressed once
+    auto compressed_pattern = pmr_vector<char>{};
+    symbol_table.compress(*_equals_string, compressed_pattern);
+    const auto compressed_pattern_view = std::string_view{compressed_pattern.data(), compressed_pattern.size()};
+
+    iterable.with_iterators(position_filter, [&](auto it, const auto end) {
+      const auto equals = [compressed_pattern_view, invert_results](const auto& position) {
+        return (position.value() == compressed_pattern_view) ^ invert_results;
+      };
+      _scan_with_iterators<true>(equals, it, end, chunk_id, matches);
+    });
+  } else {
+    const auto prefix = std::string_view{*_starts_with_string};
+    iterable.with_iterators(position_filter, [&](auto it, const auto end) {
+      const auto starts_with = [&symbol_table, prefix, invert_results](const auto& position) {
+        return symbol_table.decompressed_starts_with(position.value(), prefix) ^ invert_results;
+      };
+      _scan_with_iterators<true>(starts_with, it, end, chunk_id, matches);
+    });
+  }
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
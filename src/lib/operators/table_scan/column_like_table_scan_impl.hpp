@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -17,6 +18,9 @@ namespace opossum {
 
 class Table;
 
+template <typename T>
+class FSSTSegment;
+
 /**
  * @brief Implements a column scan using the LIKE operator
  *
@@ -25,9 +29,11 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, patterns without wildcards are compared to the compressed strings and prefix patterns
+ *   ('hello%') only decode as many bytes as needed. Other patterns decompress every string.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Resorts to faster Pattern matchers for special cases, e.g., StartsWithPattern. All other
+ *                    patterns are matched piece by piece (see LikeMatcher::GeneralPattern).
  */
 class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -44,6 +50,8 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
   /**
    * Used for dictionary segments
@@ -56,6 +64,10 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // Set if the pattern does not contain wildcards or has the form 'hello%', respectively. Used for FSST segments.
+  std::optional<pmr_string> _equals_string;
+  std::optional<pmr_string> _starts_with_string;
 };
 
 }  // namespace opossum
@@ -1,13 +1,19 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "sorted_segment_search.hpp"
+#include "statistics/base_attribute_statistics.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 
@@ -30,6 +36,13 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnVsValueTableScanImpl::description() const { return "ColumnVsValue"; }
 
+bool ColumnVsValueTableScanImpl::_can_prune(const Chunk& stored_chunk, const ColumnID stored_column_id) const {
+  if (stored_chunk.partition_does_not_contain(stored_column_id, predicate_condition, value)) return true;
+
+  const auto& pruning_statistics = stored_chunk.pruning_statistics();
+  return pruning_statistics && (*pruning_statistics)[stored_column_id]->does_not_contain(predicate_condition, value);
+}
+
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -47,6 +60,28 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    return;
+  }
+
+  // With a position filter, the positions do not form runs or blocks, so that the generic scan is used
+  if (!position_filter && _scan_frame_of_reference_segment(segment, chunk_id, matches)) return;
+
+  if (!position_filter) {
+    auto is_run_length_segment = false;
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment)) {
+        _scan_run_length_segment(*run_length_segment, chunk_id, matches);
+        is_run_length_segment = true;
+      }
+    });
+    if (is_run_length_segment) return;
+  }
+
+  if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+      fsst_segment &&
+      (predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -77,6 +112,107 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                    RowIDPosList& matches,
+                                                    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // The compression is deterministic, so equal strings have equal compressed representations. Thus, we compress the
+  // search value once and compare it to the compressed values instead of decompressing them.
+  auto compressed_search_value = pmr_vector<char>{};
+  segment.symbol_table().compress(boost::get<pmr_string>(value), compressed_search_value);
+  const auto search_value = std::string_view{compressed_search_value.data(), compressed_search_value.size()};
+
+  const auto iterable = FSSTSegmentIterable<pmr_string, true>{segment};
+  iterable.with_iterators(position_filter, [&](auto it, const auto end) {
+    const auto scan = [&](const auto predicate_comparator) {
+      const auto comparator = [predicate_comparator, search_value](const auto& position) {
+        return predicate_comparator(position.value(), search_value);
+      };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    };
+
+    if (predicate_condition == PredicateCondition::Equals) {
+      scan(std::equal_to<void>{});
+    } else {
+      scan(std::not_equal_to<void>{});
+    }
+  });
+}
+
+bool ColumnVsValueTableScanImpl::_scan_frame_of_reference_segment(const AbstractSegment& segment,
+                                                                  const ChunkID chunk_id, RowIDPosList& matches) const {
+  // NotEquals is no single range of values
+  if (predicate_condition == PredicateCondition::NotEquals) return false;
+
+  auto scanned = false;
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<ColumnDataType>)) {
+      const auto* const for_segment = dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment);
+      if (!for_segment) return;
+
+      const auto typed_value = boost::get<ColumnDataType>(value);
+      auto lower = std::numeric_limits<ColumnDataType>::min();
+      auto upper = std::numeric_limits<ColumnDataType>::max();
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          lower = typed_value;
+          upper = typed_value;
+          break;
+        case PredicateCondition::LessThan:
+          if (typed_value == lower) {
+            scanned = true;
+            return;
+          }
+          upper = typed_value - 1;
+          break;
+        case PredicateCondition::LessThanEquals:
+          upper = typed_value;
+          break;
+        case PredicateCondition::GreaterThan:
+          if (typed_value == upper) {
+            scanned = true;
+            return;
+          }
+          lower = typed_value + 1;
+          break;
+        case PredicateCondition::GreaterThanEquals:
+          lower = typed_value;
+          break;
+        default:
+          return;
+      }
+
+      scanned = _scan_frame_of_reference_range(*for_segment, lower, upper, chunk_id, matches);
+    }
+  });
+  return scanned;
+}
+
+template <typename T>
+void ColumnVsValueTableScanImpl::_scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) const {
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+  const auto typed_value = boost::get<T>(value);
+
+  with_comparator(predicate_condition, [&](auto predicate_comparator) {
+    auto run_start = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto run_end = ChunkOffset{end_positions[run_index] + 1};
+      if (!null_values[run_index] && predicate_comparator(values[run_index], typed_value)) {
+        const auto output_start_offset = matches.size();
+        matches.resize(output_start_offset + (run_end - run_start));
+        for (auto chunk_offset = run_start; chunk_offset < run_end; ++chunk_offset) {
+          matches[output_start_offset + (chunk_offset - run_start)] = RowID{chunk_id, chunk_offset};
+        }
+      }
+      run_start = run_end;
+    }
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -147,6 +283,30 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  // Without a position filter, all predicates except NotEquals can be expressed as a value ID range, which can be
+  // evaluated directly on the compressed attribute vector.
+  if (!position_filter && predicate_condition != PredicateCondition::NotEquals) {
+    auto lower_value_id = ValueID{0};
+    auto upper_value_id = segment.null_value_id();
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        lower_value_id = search_value_id;
+        upper_value_id = ValueID{search_value_id + 1};
+        break;
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        upper_value_id = search_value_id;
+        break;
+      default:
+        lower_value_id = search_value_id;
+    }
+
+    if (_scan_compressed_value_id_range(*segment.attribute_vector(), lower_value_id, upper_value_id, chunk_id,
+                                        matches)) {
+      return;
+    }
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -181,6 +341,7 @@ void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& seg
       segment_iterable.with_iterators(position_filter, [&](auto segment_begin, auto segment_end) {
         auto sorted_segment_search = SortedSegmentSearch(segment_begin, segment_end, sort_mode, _column_is_nullable,
                                                          predicate_condition, boost::get<ColumnDataType>(value));
+        sorted_segment_search.use_block_minima(typed_segment, position_filter != nullptr);
 
         sorted_segment_search.scan_sorted_segment([&](auto begin, auto end) {
           sorted_segment_search._write_rows_to_matches(begin, end, chunk_id, matches, position_filter);
@@ -14,6 +14,12 @@
 
 namespace opossum {
 
+template <typename T>
+class FSSTSegment;
+
+template <typename T>
+class RunLengthSegment;
+
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
@@ -21,6 +27,10 @@ namespace opossum {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, (in)equality is evaluated on the compressed strings
+ * - For run-length segments, the predicate is evaluated once per run and the matching runs are emitted as ranges
+ * - For frame-of-reference segments, the predicate is evaluated on the block minima and maxima first and on the
+ *   offsets of partially matching blocks afterwards
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -32,6 +42,8 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant value;
 
  protected:
+  bool _can_prune(const Chunk& stored_chunk, const ColumnID stored_column_id) const override;
+
   void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
@@ -40,6 +52,17 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
+  // Returns false if the segment is not a FrameOfReferenceSegment or the predicate cannot be evaluated on its offsets
+  bool _scan_frame_of_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches) const;
+
+  template <typename T>
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id,
+                                RowIDPosList& matches) const;
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter,
                             const SortMode sort_mode) const;
@@ -0,0 +1,76 @@
+#include "conjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+ConjunctionTableScanImpl::ConjunctionTableScanImpl(
+    const std::shared_ptr<const Table>& in_table, std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls)
+    : _in_table(in_table), _predicate_order(predicate_impls.size()) {
+  DebugAssert(predicate_impls.size() > 1, "Expected at least two predicates");
+
+  _predicate_impls.reserve(predicate_impls.size());
+  for (auto& predicate_impl : predicate_impls) {
+    Assert(dynamic_cast<AbstractDereferencedColumnTableScanImpl*>(predicate_impl.get()),
+           "Expected AbstractDereferencedColumnTableScanImpl");
+    _predicate_impls.emplace_back(static_cast<AbstractDereferencedColumnTableScanImpl*>(predicate_impl.release()));
+  }
+}
+
+std::string ConjunctionTableScanImpl::description() const {
+  auto stream = std::stringstream{};
+  stream << "Conjunction(";
+  for (auto predicate_id = size_t{0}; predicate_id < _predicate_impls.size(); ++predicate_id) {
+    if (predicate_id > 0) stream << ", ";
+    stream << _predicate_impls[predicate_id]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<RowIDPosList> ConjunctionTableScanImpl::scan_chunk(const ChunkID chunk_id) {
+  const auto order = _predicate_order.order();
+
+  auto matches = std::shared_ptr<RowIDPosList>{};
+  for (auto order_id = size_t{0}; order_id < order.size(); ++order_id) {
+    const auto predicate_id = order[order_id];
+    auto& predicate_impl = *_predicate_impls[predicate_id];
+
+    auto timer = Timer{};
+    auto input_row_count = size_t{0};
+    if (order_id == 0) {
+      input_row_count = _in_table->get_chunk(chunk_id)->size();
+      matches = predicate_impl.scan_chunk(chunk_id);
+    } else {
+      input_row_count = matches->size();
+      matches->guarantee_single_chunk();
+      matches = predicate_impl.scan_positions(chunk_id, matches);
+    }
+
+    _predicate_order.record(predicate_id, input_row_count, matches->size(), timer.lap());
+
+    if (matches->empty()) {
+      ++num_chunks_with_early_out;
+      return matches;
+    }
+  }
+
+  return matches;
+}
+
+const std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>>&
+ConjunctionTableScanImpl::predicate_impls() const {
+  return _predicate_impls;
+}
+
+std::vector<size_t> ConjunctionTableScanImpl::predicate_order() const { return _predicate_order.order(); }
+
+}  // namespace opossum
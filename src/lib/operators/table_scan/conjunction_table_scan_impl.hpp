@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "adaptive_predicate_order.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Scans for the rows that satisfy all predicates of a conjunction, e.g., `a < 5 AND b = 'x' AND c BETWEEN 1 AND 3`.
+ * Each predicate is scanned by its own AbstractDereferencedColumnTableScanImpl. The first predicate scans the entire
+ * chunk, each following one only the matches of the previous ones (see scan_positions()). Compared to one TableScan
+ * per predicate, this avoids writing an intermediate table of ReferenceSegments per predicate that the next scan has
+ * to dereference again.
+ *
+ * The predicates are reordered for every chunk based on their selectivity and cost on the previous chunks (see
+ * AdaptivePredicateOrder).
+ */
+class ConjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  // Expects at least two AbstractDereferencedColumnTableScanImpls
+  ConjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                           std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls);
+
+  std::string description() const override;
+  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+
+  const std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>>& predicate_impls() const;
+
+  // The order in which the next chunk will be scanned, as indices into predicate_impls()
+  std::vector<size_t> predicate_order() const;
+
+ private:
+  const std::shared_ptr<const Table> _in_table;
+  std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>> _predicate_impls;
+  AdaptivePredicateOrder _predicate_order;
+};
+
+}  // namespace opossum
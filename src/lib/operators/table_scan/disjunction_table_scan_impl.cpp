@@ -0,0 +1,70 @@
+#include "disjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+DisjunctionTableScanImpl::DisjunctionTableScanImpl(
+    const std::shared_ptr<const Table>& in_table, std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls)
+    : _in_table(in_table), _predicate_impls(std::move(predicate_impls)) {
+  DebugAssert(_predicate_impls.size() > 1, "Expected at least two predicates");
+}
+
+std::string DisjunctionTableScanImpl::description() const {
+  auto stream = std::stringstream{};
+  stream << "Disjunction(";
+  for (auto predicate_id = size_t{0}; predicate_id < _predicate_impls.size(); ++predicate_id) {
+    if (predicate_id > 0) stream << ", ";
+    stream << _predicate_impls[predicate_id]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<RowIDPosList> DisjunctionTableScanImpl::scan_chunk(const ChunkID chunk_id) {
+  auto chunk_matches = std::vector<bool>(_in_table->get_chunk(chunk_id)->size());
+  auto match_count = size_t{0};
+
+  for (const auto& predicate_impl : _predicate_impls) {
+    const auto predicate_matches = predicate_impl->scan_chunk(chunk_id);
+    for (const auto& row_id : *predicate_matches) {
+      // Mutable chunks might have grown since we retrieved their size
+      if (row_id.chunk_offset >= chunk_matches.size()) chunk_matches.resize(row_id.chunk_offset + 1);
+
+      if (chunk_matches[row_id.chunk_offset]) continue;
+      chunk_matches[row_id.chunk_offset] = true;
+      ++match_count;
+    }
+
+    // If all rows match, the remaining predicates do not need to be scanned
+    if (match_count == chunk_matches.size()) {
+      ++num_chunks_with_all_rows_matching;
+      break;
+    }
+  }
+
+  auto matches = std::make_shared<RowIDPosList>();
+  if (match_count == 0) {
+    ++num_chunks_with_early_out;
+    return matches;
+  }
+
+  matches->reserve(match_count);
+  const auto row_count = static_cast<ChunkOffset>(chunk_matches.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (chunk_matches[chunk_offset]) matches->emplace_back(RowID{chunk_id, chunk_offset});
+  }
+  return matches;
+}
+
+const std::vector<std::unique_ptr<AbstractTableScanImpl>>& DisjunctionTableScanImpl::predicate_impls() const {
+  return _predicate_impls;
+}
+
+}  // namespace opossum
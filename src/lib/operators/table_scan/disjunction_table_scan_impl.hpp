@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Scans for the rows that satisfy at least one predicate of a disjunction, e.g., `a < 5 OR b = 'x' OR c IS NULL`.
+ * Each predicate is scanned by its own AbstractTableScanImpl, and their matches are combined in a bitmap of the chunk.
+ * Compared to splitting up the disjunction into TableScans whose results are merged by UnionPositions, this avoids
+ * materializing and sorting the matches of all predicates for the entire table.
+ */
+class DisjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  DisjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                           std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls);
+
+  std::string description() const override;
+  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>>& predicate_impls() const;
+
+ private:
+  const std::shared_ptr<const Table> _in_table;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _predicate_impls;
+};
+
+}  // namespace opossum
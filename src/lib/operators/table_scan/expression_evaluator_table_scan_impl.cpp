@@ -7,7 +7,9 @@ namespace opossum {
 
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
     const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression)
-    : _in_table(in_table), _expression(expression) {
+    : _in_table(in_table),
+      _expression(expression),
+      _correlated_subquery_results(std::make_shared<ExpressionEvaluator::CorrelatedSubqueryResults>()) {
   _uncorrelated_subquery_results = ExpressionEvaluator::populate_uncorrelated_subquery_results_cache({expression});
 }
 
@@ -15,8 +17,8 @@ std::string ExpressionEvaluatorTableScanImpl::description() const { return "Expr
 
 std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
   return std::make_shared<RowIDPosList>(
-      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list(
-          *_expression));
+      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results, _correlated_subquery_results}
+          .evaluate_expression_to_pos_list(*_expression));
 }
 
 }  // namespace opossum
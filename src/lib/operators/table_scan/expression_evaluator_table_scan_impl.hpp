@@ -25,6 +25,9 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<AbstractExpression> _expression;
   std::shared_ptr<ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  // Shared by the evaluators of all chunks, so that correlated subqueries are executed once per parameter value
+  const std::shared_ptr<ExpressionEvaluator::CorrelatedSubqueryResults> _correlated_subquery_results;
 };
 
 }  // namespace opossum
@@ -1,14 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
 #include <boost/range.hpp>
 #include <boost/range/join.hpp>
 
 #include "all_type_variant.hpp"
 #include "constant_mappings.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "types.hpp"
 
@@ -53,29 +56,61 @@ class SortedSegmentSearch {
   IteratorType _get_first_bound(const SearchValueType& search_value, const IteratorType begin,
                                 const IteratorType end) const {
     if (_is_ascending) {
-      return std::lower_bound(begin, end, search_value, [](const auto& segment_position, const auto& value) {
-        return segment_position.value() < value;
-      });
+      return _partition_point(begin, end, [&](const auto& value) { return value < search_value; });
     } else {
-      return std::lower_bound(begin, end, search_value, [](const auto& segment_position, const auto& value) {
-        return segment_position.value() > value;
-      });
+      return _partition_point(begin, end, [&](const auto& value) { return value > search_value; });
     }
   }
 
   IteratorType _get_last_bound(const SearchValueType& search_value, const IteratorType begin,
                                const IteratorType end) const {
     if (_is_ascending) {
-      return std::upper_bound(begin, end, search_value, [](const auto& value, const auto& segment_position) {
-        return segment_position.value() > value;
-      });
+      return _partition_point(begin, end, [&](const auto& value) { return !(value > search_value); });
     } else {
-      return std::upper_bound(begin, end, search_value, [](const auto& value, const auto& segment_position) {
-        return segment_position.value() < value;
-      });
+      return _partition_point(begin, end, [&](const auto& value) { return !(value < search_value); });
     }
   }
 
+  // Returns the first position in [begin, end) whose value does not satisfy the predicate, which has to be true for a
+  // prefix of the range. If block minima are set, the range is narrowed down to a single block first.
+  template <typename Predicate>
+  IteratorType _partition_point(IteratorType begin, IteratorType end, const Predicate& predicate) const {
+    if (_block_minima && begin != end) {
+      std::tie(begin, end) = _narrow_by_block_minima(begin, end, predicate);
+    }
+    return std::partition_point(begin, end,
+                                [&](const auto& segment_position) { return predicate(segment_position.value()); });
+  }
+
+  /**
+   * On a sorted segment without NULL values, the minimum of an ascending block is its first value, the minimum of a
+   * descending block its last value. Thus, the block minima are samples of the segment at known offsets. The first
+   * failing sample and its predecessor delimit the offsets in which the partition point can be found.
+   */
+  template <typename Predicate>
+  std::pair<IteratorType, IteratorType> _narrow_by_block_minima(const IteratorType begin, const IteratorType end,
+                                                                const Predicate& predicate) const {
+    const auto& block_minima = *_block_minima;
+    const auto sample_offset = [&](const size_t block_id) -> size_t {
+      if (_is_ascending) return block_id * _block_size;
+      return std::min(static_cast<size_t>(block_id + 1) * _block_size, static_cast<size_t>(_segment_size)) - 1;
+    };
+
+    const auto first_failing_block = static_cast<size_t>(std::distance(
+        block_minima.cbegin(), std::partition_point(block_minima.cbegin(), block_minima.cend(), predicate)));
+    const auto lower_offset = first_failing_block == 0 ? size_t{0} : sample_offset(first_failing_block - 1) + 1;
+    const auto upper_offset = first_failing_block == block_minima.size() ? static_cast<size_t>(_segment_size)
+                                                                         : sample_offset(first_failing_block);
+
+    const auto begin_offset = static_cast<size_t>(begin->chunk_offset());
+    const auto end_offset = begin_offset + static_cast<size_t>(std::distance(begin, end));
+    if (upper_offset <= begin_offset) return {begin, begin};
+    if (lower_offset >= end_offset) return {end, end};
+
+    return {begin + (std::max(lower_offset, begin_offset) - begin_offset),
+            begin + (std::min(upper_offset, end_offset) - begin_offset)};
+  }
+
   // This function sets the offset(s) which delimit the result set based on the predicate condition and the sort order
   void _set_begin_and_end_positions_for_vs_value_scan() {
     if (_predicate_condition == PredicateCondition::Equals) {
@@ -239,6 +274,25 @@ class SortedSegmentSearch {
   }
 
  public:
+  /**
+   * If the scanned segment is a FrameOfReferenceSegment, its block minima are used to narrow down the binary searches
+   * before any offset value is decompressed. This requires the iterators to cover the whole segment (i.e., no position
+   * filter) and the segment to be free of NULL values.
+   */
+  template <typename SegmentType>
+  void use_block_minima(const SegmentType& segment, const bool has_position_filter) {
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<SearchValueType>)) {
+      if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<SearchValueType>>) {
+        if (has_position_filter || segment.null_values()) return;
+
+        _block_minima = &segment.block_minima();
+        _block_size = FrameOfReferenceSegment<SearchValueType>::block_size;
+        _segment_size = segment.size();
+      }
+    }
+  }
+
   template <typename ResultConsumer>
   void scan_sorted_segment(const ResultConsumer& result_consumer) {
     if (_second_search_value) {
@@ -313,6 +367,11 @@ class SortedSegmentSearch {
   const std::optional<SearchValueType> _second_search_value;
   const bool _nullable;
   const bool _is_ascending;
+
+  // See use_block_minima()
+  const pmr_vector<SearchValueType>* _block_minima{nullptr};
+  ChunkOffset _block_size{0};
+  ChunkOffset _segment_size{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,285 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A row that might be among the first k rows. Only the value of the first sort column is stored with its type, the
+// values of the other sort columns are only compared if the first values are equal.
+template <typename SortColumnType>
+struct Candidate {
+  std::optional<SortColumnType> value;
+  std::vector<AllTypeVariant> further_values;
+  RowID row_id;
+};
+
+// Returns a negative number if the value `lhs` comes first, zero if both values are equal, and a positive number if
+// `rhs` comes first. As in Sort, NULLs come first in both sort modes.
+template <typename Value>
+int compare_values(const Value& lhs, const bool lhs_is_null, const Value& rhs, const bool rhs_is_null,
+                   const SortMode sort_mode) {
+  if (lhs_is_null || rhs_is_null) return static_cast<int>(rhs_is_null) - static_cast<int>(lhs_is_null);
+  if (lhs == rhs) return 0;
+  return (lhs < rhs) == (sort_mode == SortMode::Ascending) ? -1 : 1;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  const auto row_count = Limit::evaluate_row_count(*_row_count_expression);
+
+  // Same output as a Limit to zero rows
+  if (row_count == 0) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  }
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  Timer timer;
+
+  // If all rows are returned, there is nothing to select
+  if (row_count >= input_table->row_count()) {
+    const auto sort = std::make_shared<Sort>(left_input(), _sort_definitions);
+    sort->execute();
+    step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
+    return sort->get_output();
+  }
+
+  auto row_ids = std::vector<RowID>{};
+  resolve_data_type(input_table->column_data_type(_sort_definitions[0].column), [&](const auto type) {
+    using SortColumnType = typename decltype(type)::type;
+    row_ids = _select_rows<SortColumnType>(row_count);
+  });
+
+  // Write the selected rows as a reference table, one chunk per input chunk that contains selected rows. References
+  // into a reference table are resolved, as ReferenceSegments have to reference data tables.
+  const auto column_count = input_table->column_count();
+  auto selected_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto chunk_begin = row_ids.begin(); chunk_begin != row_ids.end();) {
+    const auto chunk_id = chunk_begin->chunk_id;
+    const auto chunk_end =
+        std::find_if(chunk_begin, row_ids.end(), [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+    const auto chunk = input_table->get_chunk(chunk_id);
+
+    const auto pos_list = std::make_shared<RowIDPosList>(chunk_begin, chunk_end);
+    pos_list->guarantee_single_chunk();
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto segment = chunk->get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      if (!reference_segment) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+        continue;
+      }
+
+      const auto& input_pos_list = *reference_segment->pos_list();
+      auto referenced_pos_list = std::make_shared<RowIDPosList>();
+      referenced_pos_list->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        referenced_pos_list->emplace_back(input_pos_list[row_id.chunk_offset]);
+      }
+      segments.emplace_back(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                               reference_segment->referenced_column_id(),
+                                                               referenced_pos_list));
+    }
+
+    selected_chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+    chunk_begin = chunk_end;
+  }
+  const auto selected_rows = std::make_shared<Table>(input_table->column_definitions(), TableType::References,
+                                                     std::move(selected_chunks));
+  step_performance_data.set_step_runtime(OperatorSteps::RowSelection, timer.lap());
+
+  // The selected rows are in input order, so that the stable Sort keeps the order of rows with equal values
+  const auto table_wrapper = std::make_shared<TableWrapper>(selected_rows);
+  table_wrapper->execute();
+
+  const auto sort = std::make_shared<Sort>(table_wrapper, _sort_definitions);
+  sort->execute();
+  step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
+
+  return sort->get_output();
+}
+
+template <typename SortColumnType>
+std::vector<RowID> TopK::_select_rows(const size_t row_count) const {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  const auto& first_sort_definition = _sort_definitions[0];
+
+  // Defines the total order of the candidates: by the sort columns, then by their position in the input
+  const auto comes_first = [&](const Candidate<SortColumnType>& lhs, const Candidate<SortColumnType>& rhs) {
+    const auto comparison = compare_values(lhs.value.value_or(SortColumnType{}), !lhs.value,
+                                           rhs.value.value_or(SortColumnType{}), !rhs.value,
+                                           first_sort_definition.sort_mode);
+    if (comparison != 0) return comparison < 0;
+
+    const auto further_value_count = lhs.further_values.size();
+    for (auto index = size_t{0}; index < further_value_count; ++index) {
+      const auto& lhs_value = lhs.further_values[index];
+      const auto& rhs_value = rhs.further_values[index];
+      const auto further_comparison =
+          compare_values(lhs_value, variant_is_null(lhs_value), rhs_value, variant_is_null(rhs_value),
+                         _sort_definitions[index + 1].sort_mode);
+      if (further_comparison != 0) return further_comparison < 0;
+    }
+
+    return lhs.row_id < rhs.row_id;
+  };
+
+  const auto task_count = std::max(size_t{1}, std::min({static_cast<size_t>(chunk_count),
+                                                        input_table->row_count() / JOB_SPAWN_THRESHOLD,
+                                                        Hyrise::get().topology.num_cpus()}));
+
+  // Each task keeps a max-heap of the k best rows of its chunks, so that the last of them is at the front
+  auto heaps = std::vector<std::vector<Candidate<SortColumnType>>>(task_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, task_id]() {
+      auto& heap = heaps[task_id];
+      heap.reserve(row_count);
+
+      const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+      const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+        const auto& sorted_by = chunk->individually_sorted_by();
+        const auto chunk_is_sorted =
+            std::find(sorted_by.begin(), sorted_by.end(), first_sort_definition) != sorted_by.end();
+
+        auto further_segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+        for (auto index = size_t{1}; index < _sort_definitions.size(); ++index) {
+          further_segments.emplace_back(chunk->get_segment(_sort_definitions[index].column));
+        }
+
+        const auto make_candidate = [&](std::optional<SortColumnType> value, const ChunkOffset chunk_offset) {
+          auto candidate = Candidate<SortColumnType>{std::move(value), {}, RowID{chunk_id, chunk_offset}};
+          candidate.further_values.reserve(further_segments.size());
+          for (const auto& further_segment : further_segments) {
+            candidate.further_values.emplace_back((*further_segment)[chunk_offset]);
+          }
+          return candidate;
+        };
+
+        const auto& segment = *chunk->get_segment(first_sort_definition.column);
+        segment_with_iterators<SortColumnType>(segment, [&](auto it, const auto end) {
+          for (; it != end; ++it) {
+            const auto& position = *it;
+            auto value = position.is_null() ? std::nullopt : std::optional<SortColumnType>{position.value()};
+
+            if (heap.size() < row_count) {
+              heap.emplace_back(make_candidate(std::move(value), position.chunk_offset()));
+              std::push_heap(heap.begin(), heap.end(), comes_first);
+              continue;
+            }
+
+            const auto& last = heap.front();
+            const auto comparison = compare_values(value.value_or(SortColumnType{}), !value,
+                                                   last.value.value_or(SortColumnType{}), !last.value,
+                                                   first_sort_definition.sort_mode);
+            if (comparison > 0) {
+              // In a sorted chunk, NULLs come first and all following values come after this one
+              if (chunk_is_sorted) break;
+              continue;
+            }
+
+            auto candidate = make_candidate(std::move(value), position.chunk_offset());
+            if (comparison == 0 && !comes_first(candidate, last)) continue;
+
+            std::pop_heap(heap.begin(), heap.end(), comes_first);
+            heap.back() = std::move(candidate);
+            std::push_heap(heap.begin(), heap.end(), comes_first);
+          }
+        });
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Merge the heaps and select the k best rows of all tasks
+  auto candidates = std::move(heaps[0]);
+  for (auto task_id = size_t{1}; task_id < task_count; ++task_id) {
+    std::move(heaps[task_id].begin(), heaps[task_id].end(), std::back_inserter(candidates));
+  }
+  if (candidates.size() > row_count) {
+    std::nth_element(candidates.begin(), candidates.begin() + row_count, candidates.end(), comes_first);
+    candidates.erase(candidates.begin() + row_count, candidates.end());
+  }
+
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(candidates.size());
+  for (const auto& candidate : candidates) {
+    row_ids.emplace_back(candidate.row_id);
+  }
+  std::sort(row_ids.begin(), row_ids.end());
+
+  return row_ids;
+}
+
+}  // namespace opossum
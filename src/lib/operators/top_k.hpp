@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Returns the first k rows of the input in the order given by the sort definitions, i.e., the same result as a Sort
+ * followed by a Limit, where k is given by the row count expression. Instead of sorting the entire input, each task
+ * keeps the k best rows of its chunks in a bounded heap. If a chunk is sorted by the first sort definition (see
+ * Chunk::individually_sorted_by), the task stops scanning it as soon as no better row can follow. Finally, the heaps
+ * are merged and only the k selected rows are sorted. As in Sort, NULLs come first and rows with equal values keep
+ * their input order.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  // The input is split into tasks of at least JOB_SPAWN_THRESHOLD rows each
+  static constexpr auto JOB_SPAWN_THRESHOLD = 10'000;
+
+  enum class OperatorSteps : uint8_t { RowSelection, Sort };
+
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::string& name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Returns the RowIDs of the k rows that come first in the sort order, ordered by their position in the input
+  template <typename SortColumnType>
+  std::vector<RowID> _select_rows(const size_t row_count) const;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
@@ -36,16 +36,30 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
       const auto chunk = input->get_chunk(in_chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-      // creating empty chunk to add segments with positions
-      Segments output_segments;
-
-      // iterating over all segments of the current chunk
-      for (ColumnID column_id{0}; column_id < input->column_count(); ++column_id) {
+      // The segments are forwarded as they are, neither the values nor the PosLists of reference segments are copied
+      const auto column_count = input->column_count();
+      auto output_segments = Segments{};
+      output_segments.reserve(column_count);
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
         output_segments.push_back(chunk->get_segment(column_id));
       }
 
-      // adding newly filled chunk to the output table
-      output_chunks[output_chunk_idx] = std::make_shared<Chunk>(output_segments);
+      auto output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+
+      // Reference segments never change and immutable data chunks cannot grow anymore. As the segments are shared,
+      // properties that describe their contents (sort order, pruning statistics) remain valid for the output chunk.
+      if (input->type() == TableType::References || !chunk->is_mutable()) {
+        output_chunk->finalize();
+        const auto& sorted_by = chunk->individually_sorted_by();
+        if (!sorted_by.empty()) {
+          output_chunk->set_individually_sorted_by(sorted_by);
+        }
+        if (chunk->pruning_statistics()) {
+          output_chunk->set_pruning_statistics(chunk->pruning_statistics());
+        }
+      }
+
+      output_chunks[output_chunk_idx] = std::move(output_chunk);
       ++output_chunk_idx;
     }
   }
@@ -25,6 +25,11 @@
  * ReferenceMatrices.
  * Using a implementation derived from std::set_union, the two virtual pos lists are merged into the result table.
  *
+ * If both inputs reference a single table through a single ColumnCluster (e.g., for `WHERE a < 5 OR b > 7` on a stored
+ * table) and hold many of its rows, the sorts are avoided: The rows of both inputs are flagged in per-chunk bitmaps of
+ * the referenced table, which are then turned into sorted pos lists, one per referenced chunk. See
+ * _union_single_cluster_with_bitmaps().
+ *
  *
  * ### About ReferenceMatrices
  * The ReferenceMatrix consists of N rows and X columns of RowIDs.
@@ -78,6 +83,11 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (_column_cluster_offsets.size() == 1) {
+    const auto bitmap_result = _union_single_cluster_with_bitmaps();
+    if (bitmap_result) return bitmap_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -313,6 +323,75 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_single_cluster_with_bitmaps() const {
+  const auto& referenced_table = _referenced_tables.front();
+  const auto input_row_count = left_input_table()->row_count() + right_input_table()->row_count();
+  if (input_row_count * MAX_REFERENCED_ROWS_PER_INPUT_ROW_FOR_BITMAPS < referenced_table->row_count()) return nullptr;
+
+  // For each row of the referenced table, stores whether it is part of the left (LEFT_FLAG) and/or the right input
+  // (RIGHT_FLAG). Only the chunks that are referenced by the inputs are allocated.
+  constexpr auto LEFT_FLAG = uint8_t{1};
+  constexpr auto RIGHT_FLAG = uint8_t{2};
+  const auto referenced_chunk_count = referenced_table->chunk_count();
+  auto chunk_flags = std::vector<std::vector<uint8_t>>(referenced_chunk_count);
+
+  // Returns false if the input cannot be represented by flags, in which case we fall back to sorting
+  const auto add_input = [&](const Table& input_table, const uint8_t input_flag) {
+    const auto input_chunk_count = input_table.chunk_count();
+    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+      const auto segment = input_table.get_chunk(input_chunk_id)->get_segment(ColumnID{0});
+      const auto& pos_list = *static_cast<const ReferenceSegment&>(*segment).pos_list();
+
+      for (const auto& row_id : pos_list) {
+        // NULL_ROW_IDs (with INVALID_CHUNK_ID) are not part of any chunk
+        if (row_id.chunk_id >= referenced_chunk_count) return false;
+
+        auto& flags = chunk_flags[row_id.chunk_id];
+        if (flags.empty()) {
+          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+          if (!referenced_chunk) return false;
+          flags.resize(referenced_chunk->size());
+        }
+        if (row_id.chunk_offset >= flags.size()) flags.resize(row_id.chunk_offset + 1);
+
+        // Like std::set_union, we keep rows that occur multiple times in an input. Flags cannot represent them.
+        if (flags[row_id.chunk_offset] & input_flag) return false;
+        flags[row_id.chunk_offset] |= input_flag;
+      }
+    }
+    return true;
+  };
+
+  if (!add_input(*left_input_table(), LEFT_FLAG) || !add_input(*right_input_table(), RIGHT_FLAG)) return nullptr;
+
+  auto output_table = std::make_shared<Table>(left_input_table()->column_definitions(), TableType::References);
+  const auto column_count = output_table->column_count();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    const auto& flags = chunk_flags[chunk_id];
+    if (flags.empty()) continue;
+
+    auto pos_list = std::make_shared<RowIDPosList>();
+    pos_list->reserve(std::count_if(flags.cbegin(), flags.cend(), [](const auto flag) { return flag != 0; }));
+    const auto flag_count = static_cast<ChunkOffset>(flags.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < flag_count; ++chunk_offset) {
+      if (flags[chunk_offset]) pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    pos_list->guarantee_single_chunk();
+    pos_list->guarantee_sorted();
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    output_table->append_chunk(output_segments);
+  }
+
+  return output_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
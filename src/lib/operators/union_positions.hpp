@@ -107,6 +107,17 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * Used if both inputs consist of a single ColumnCluster. Returns nullptr if the inputs hold too few rows of the
+   * referenced table, or if they contain rows that cannot be represented by bitmaps (NULL_ROW_IDs or rows that occur
+   * multiple times in one input).
+   */
+  std::shared_ptr<const Table> _union_single_cluster_with_bitmaps() const;
+
+  // The bitmaps are used if the inputs hold at least one row for this many rows of the referenced table. Otherwise,
+  // allocating and iterating over the bitmaps is more expensive than sorting the inputs.
+  static constexpr auto MAX_REFERENCED_ROWS_PER_INPUT_ROW_FOR_BITMAPS = size_t{16};
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
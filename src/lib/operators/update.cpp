@@ -1,7 +1,9 @@
 #include "update.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -9,10 +11,40 @@
 #include "delete.hpp"
 #include "hyrise.hpp"
 #include "insert.hpp"
+#include "resolve_type.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/row_group_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 #include "table_wrapper.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The segments of mutable chunks are either ValueSegments or RowGroupSegments (see Table::set_column_groups()). Both
+// return T{} for NULLs.
+template <typename T>
+std::pair<bool, T> mutable_segment_value(const AbstractSegment& segment, const ChunkOffset chunk_offset) {
+  if (const auto* row_group_segment = dynamic_cast<const RowGroupSegment<T>*>(&segment)) {
+    return {row_group_segment->is_null(chunk_offset), row_group_segment->value(chunk_offset)};
+  }
+  const auto& value_segment = static_cast<const ValueSegment<T>&>(segment);
+  return {value_segment.is_null(chunk_offset), value_segment.values()[chunk_offset]};
+}
+
+template <typename T>
+void set_mutable_segment_value(AbstractSegment& segment, const ChunkOffset chunk_offset, const T& value) {
+  if (auto* row_group_segment = dynamic_cast<RowGroupSegment<T>*>(&segment)) {
+    row_group_segment->set_value(chunk_offset, value);
+    return;
+  }
+  static_cast<ValueSegment<T>&>(segment).values()[chunk_offset] = value;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Update::Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
@@ -35,7 +67,10 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(left_input_table()->column_data_types() == right_input_table()->column_data_types(),
               "Update required identical layouts from its input tables");
 
-  // 1. Delete obsolete data with the Delete operator.
+  // 1. Overwrite rows that are only visible to this transaction in place
+  if (left_input_table()->row_count() > 0 && _try_update_in_place(table_to_update, *context)) return nullptr;
+
+  // 2. Delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
   if (left_input_table()->row_count() > 0) {
     _delete = std::make_shared<Delete>(_left_input);
@@ -48,7 +83,7 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
-  // 2. Insert new data with the Insert operator.
+  // 3. Insert new data with the Insert operator.
   _insert = std::make_shared<Insert>(_table_to_update_name, _right_input);
   _insert->set_transaction_context(context);
   _insert->execute();
@@ -57,6 +92,131 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   return nullptr;
 }
 
+bool Update::_try_update_in_place(const std::shared_ptr<Table>& table, const TransactionContext& context) const {
+  const auto& fields_to_update = *left_input_table();
+  const auto& update_values = *right_input_table();
+  if (fields_to_update.type() != TableType::References) return false;
+
+  // The Delete and Insert operators maintain the materialized views on the table
+  if (!Hyrise::get().storage_manager.materialized_views_on_table(table).empty()) return false;
+
+  // 1. Collect the updated rows and check that they are uncommitted inserts of this transaction. Rows that this
+  //    transaction inserted and deleted again have an INVALID_TRANSACTION_ID (see Delete).
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(fields_to_update.row_count());
+
+  const auto column_count = fields_to_update.column_count();
+  const auto chunk_count = fields_to_update.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = fields_to_update.get_chunk(chunk_id);
+    const auto& pos_list = static_cast<const ReferenceSegment&>(*chunk->get_segment(ColumnID{0})).pos_list();
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+      if (segment.referenced_table() != table || segment.referenced_column_id() != column_id ||
+          segment.pos_list() != pos_list) {
+        return false;
+      }
+    }
+
+    for (const auto& row_id : *pos_list) {
+      if (row_id.is_null()) return false;
+
+      // Mutable chunks are not encoded and their values are not reflected in any pruning statistics or sort orders
+      const auto target_chunk = table->get_chunk(row_id.chunk_id);
+      if (!target_chunk->is_mutable() || target_chunk->pruning_statistics() ||
+          !target_chunk->individually_sorted_by().empty()) {
+        return false;
+      }
+
+      const auto& mvcc_data = *target_chunk->mvcc_data();
+      if (mvcc_data.get_tid(row_id.chunk_offset) != context.transaction_id() ||
+          mvcc_data.get_begin_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID ||
+          mvcc_data.get_end_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID) {
+        return false;
+      }
+
+      row_ids.emplace_back(row_id);
+    }
+  }
+
+  // 2. Find the changed values and check that they can be written in place. The writes are deferred until all columns
+  //    have been checked so that the rows are either updated completely or not at all.
+  auto key_columns = std::unordered_set<ColumnID>{};
+  for (const auto& key_constraint : table->soft_key_constraints()) {
+    key_columns.insert(key_constraint.columns().cbegin(), key_constraint.columns().cend());
+  }
+
+  auto writes = std::vector<std::function<void()>>{};
+  auto can_update_in_place = true;
+  for (auto column_id = ColumnID{0}; column_id < column_count && can_update_in_place; ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto new_values = std::vector<ColumnDataType>{};
+      auto new_values_nullable = false;
+      new_values.reserve(row_ids.size());
+      const auto update_values_chunk_count = update_values.chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < update_values_chunk_count; ++chunk_id) {
+        segment_iterate<ColumnDataType>(*update_values.get_chunk(chunk_id)->get_segment(column_id),
+                                        [&](const auto& position) {
+                                          new_values_nullable |= position.is_null();
+                                          new_values.emplace_back(position.value());
+                                        });
+      }
+      DebugAssert(new_values.size() == row_ids.size(), "Update requires the same number of rows from both inputs");
+
+      auto changed_offsets = std::vector<size_t>{};
+      for (auto row_index = size_t{0}; row_index < row_ids.size(); ++row_index) {
+        const auto& row_id = row_ids[row_index];
+        const auto& segment = table->get_chunk(row_id.chunk_id)->get_segment(column_id);
+        const auto [is_null, value] = mutable_segment_value<ColumnDataType>(*segment, row_id.chunk_offset);
+        // ValueSegment does not support resetting NULL values (see ValueSegment::set_null_value)
+        if (is_null) {
+          can_update_in_place = false;
+          return;
+        }
+        if (value != new_values[row_index]) {
+          changed_offsets.emplace_back(row_index);
+        }
+      }
+      if (changed_offsets.empty()) return;
+
+      // Strings are not fixed-width. Changed values of indexed or key columns would have to be reflected there.
+      if (std::is_same_v<ColumnDataType, pmr_string> || new_values_nullable || key_columns.contains(column_id) ||
+          table->get_table_index(column_id)) {
+        can_update_in_place = false;
+        return;
+      }
+      for (const auto row_index : changed_offsets) {
+        if (!table->get_chunk(row_ids[row_index].chunk_id)->get_indexes(std::vector<ColumnID>{column_id}).empty()) {
+          can_update_in_place = false;
+          return;
+        }
+      }
+
+      writes.emplace_back([&, column_id, new_values = std::move(new_values),
+                           changed_offsets = std::move(changed_offsets)]() {
+        for (const auto row_index : changed_offsets) {
+          const auto& row_id = row_ids[row_index];
+          set_mutable_segment_value(*table->get_chunk(row_id.chunk_id)->get_segment(column_id), row_id.chunk_offset,
+                                    new_values[row_index]);
+        }
+      });
+    });
+  }
+
+  if (!can_update_in_place) return false;
+
+  // 3. Write the values. As for Insert, which writes the values of the uncommitted rows in the same way, no lock is
+  //    needed because no other transaction reads these rows.
+  for (const auto& write : writes) {
+    write();
+  }
+
+  return true;
+}
+
 std::shared_ptr<AbstractOperator> Update::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
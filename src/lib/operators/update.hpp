@@ -22,6 +22,13 @@ class Insert;
  *
  * Assumption: The input has been validated before.
  *
+ * Usually, the updated rows are deleted and inserted again with their new values. Only if all updated rows were
+ * inserted by the same transaction and have not been committed yet, their values are overwritten in place (see
+ * _try_update_in_place). This is MVCC-correct because no other transaction can see these rows, and a rollback
+ * invalidates them anyway. It avoids that tables grow when a transaction updates its own rows (e.g., the same row
+ * multiple times). Committed rows are never updated in place, as concurrent transactions read their values directly
+ * from the segments without consulting any version information other than the MVCC data of the row.
+ *
  * Note: Update does not support null values at the moment
  */
 class Update : public AbstractReadWriteOperator {
@@ -44,6 +51,12 @@ class Update : public AbstractReadWriteOperator {
   // Rollback happens in Insert and Delete operators
   void _on_rollback_records() override {}
 
+  // Overwrites the values of the updated rows in place and returns true if all rows are uncommitted inserts of the
+  // given transaction, they are stored in mutable chunks without pruning statistics or sort orders, and all changed
+  // values (old and new) are non-NULL and belong to fixed-width columns without indexes or key constraints.
+  // Otherwise, nothing is written and false is returned.
+  bool _try_update_in_place(const std::shared_ptr<Table>& table, const TransactionContext& context) const;
+
  protected:
   const std::string _table_to_update_name;
   std::shared_ptr<Delete> _delete;
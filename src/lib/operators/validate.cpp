@@ -1,5 +1,10 @@
 #include "validate.hpp"
 
+#ifdef __AVX512VL__
+#include <x86intrin.h>
+#endif
+
+#include <array>
 #include <memory>
 #include <string>
 #include <utility>
@@ -25,6 +30,94 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+// Appends RowID{chunk_id, get_chunk_offset(row_index)} for all row_index < row_count whose row is visible. Similar to
+// AbstractTableScanImpl::_simd_scan_with_iterators, rows are checked in blocks in SIMD lanes, and the offsets of the
+// visible rows are moved to the output without branches. Consult that method for further details.
+template <typename GetChunkOffset>
+void collect_visible_rows(const TransactionID our_tid, const CommitID snapshot_commit_id, const MvccData& mvcc_data,
+                          const ChunkID chunk_id, const size_t row_count, const GetChunkOffset& get_chunk_offset,
+                          RowIDPosList& rows_out) {
+  // The index at which we will write the next visible row. At most row_count rows are visible.
+  auto rows_out_index = rows_out.size();
+  rows_out.resize(rows_out_index + row_count, RowID{chunk_id, ChunkOffset{0}});
+
+  auto row_index = size_t{0};
+
+  // Compacted MVCC data has no vectors, its getters are used below
+  if (!mvcc_data.is_compacted()) {
+    // As in the table scan, we assume a SIMD register size of 256 bit
+    constexpr auto BLOCK_SIZE = size_t{256 / 8 / sizeof(ChunkOffset)};
+
+    const auto* const begin_cids = mvcc_data.begin_cids();
+    const auto* const end_cids = mvcc_data.end_cids();
+    const auto* const tids = mvcc_data.tids();
+
+    for (; row_index + BLOCK_SIZE <= row_count; row_index += BLOCK_SIZE) {
+      auto offsets = std::array<ChunkOffset, BLOCK_SIZE>{};
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
+        offsets[i] = get_chunk_offset(row_index + i);
+      }
+
+#ifdef __AVX512VL__
+      __mmask16 mask = 0;
+#else
+      uint16_t mask = 0;
+#endif
+
+      // Same expression as in Validate::is_row_visible
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
+        const auto offset = offsets[i];
+        const auto is_visible = snapshot_commit_id < end_cids[offset] &&
+                                ((snapshot_commit_id >= begin_cids[offset]) != (tids[offset] == our_tid));
+        mask |= is_visible << i;
+      }
+
+      if (!mask) continue;
+
+#ifdef __AVX512VL__
+      // Move the offsets of the visible rows to the front and copy all of them, the surplus ones are overwritten later
+      auto offsets_simd =
+          _mm256_maskz_compress_epi32(static_cast<unsigned char>(mask), reinterpret_cast<__m256i&>(offsets));
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
+        rows_out[rows_out_index + i].chunk_offset = (reinterpret_cast<ChunkOffset*>(&offsets_simd))[i];
+      }
+
+      rows_out_index += __builtin_popcount(mask);
+#else
+      // Write every offset, but only advance the index for visible rows
+      for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
+        rows_out[rows_out_index].chunk_offset = offsets[i];
+        rows_out_index += (mask >> i) & 1u;
+      }
+#endif
+    }
+  }
+
+  // Remainder
+  for (; row_index < row_count; ++row_index) {
+    const auto chunk_offset = get_chunk_offset(row_index);
+    rows_out[rows_out_index].chunk_offset = chunk_offset;
+    rows_out_index += is_row_visible(our_tid, snapshot_commit_id, chunk_offset, mvcc_data);
+  }
+
+  // Remove all entries that we have overallocated
+  rows_out.resize(rows_out_index);
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -40,17 +133,18 @@ bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id
 
 bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk,
                                         const CommitID snapshot_commit_id) const {
-  Assert(
-      _can_use_chunk_shortcut,
-      "This call to _is_entire_chunk_visible is not allowed. Are there any DeleteOperators in the same transaction?");
   DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0})),
               "_is_entire_chunk_visible cannot be called on reference chunks.");
 
-  const auto& mvcc_data = chunk->mvcc_data();
+  const auto mvcc_data = chunk->mvcc_data();
   const auto max_begin_cid = mvcc_data->max_begin_cid;
-  if (!max_begin_cid) return false;
+  if (!max_begin_cid || snapshot_commit_id < max_begin_cid) return false;
+
+  // Compacted MVCC data has neither deleted nor locked rows. Rows that this transaction locks are never compacted, so
+  // the shortcut is safe even if the transaction contains a Delete.
+  if (mvcc_data->is_compacted()) return true;
 
-  return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
+  return _can_use_chunk_shortcut && chunk->invalid_row_count() == 0;
 }
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
@@ -99,6 +193,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
   // (4) no rows in the chunk have been invalidated before this transaction was started,
   // (5) the current transaction has no in-flight deletes.
+  // Chunks whose MVCC data was compacted (see MvccData) fulfill all of these conditions by construction.
   const auto& read_write_operators = transaction_context->read_write_operators();
   for (const auto& read_write_operator : read_write_operators) {
     if (read_write_operator->type() == OperatorType::Delete) {
@@ -187,17 +282,23 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         const auto referenced_chunk = referenced_table->get_chunk(pos_list_in->common_chunk_id());
         auto mvcc_data = referenced_chunk->mvcc_data();
 
-        if (_can_use_chunk_shortcut && _is_entire_chunk_visible(referenced_chunk, snapshot_commit_id)) {
+        if (_is_entire_chunk_visible(referenced_chunk, snapshot_commit_id)) {
           // We can reuse the old PosList since it is entirely visible. Not using the entirely_visible_chunks cache for
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
         } else {
           RowIDPosList temp_pos_list;
           temp_pos_list.guarantee_single_chunk();
-          for (auto row_id : *pos_list_in) {
-            if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
-            }
+          if (pos_list_in->is_sorted()) temp_pos_list.guarantee_sorted();
+          const auto common_chunk_id = pos_list_in->common_chunk_id();
+          if (const auto row_id_pos_list_in = std::dynamic_pointer_cast<const RowIDPosList>(pos_list_in)) {
+            collect_visible_rows(
+                our_tid, snapshot_commit_id, *mvcc_data, common_chunk_id, row_id_pos_list_in->size(),
+                [&](const size_t index) { return (*row_id_pos_list_in)[index].chunk_offset; }, temp_pos_list);
+          } else {
+            collect_visible_rows(
+                our_tid, snapshot_commit_id, *mvcc_data, common_chunk_id, pos_list_in->size(),
+                [&](const size_t index) { return (*pos_list_in)[index].chunk_offset; }, temp_pos_list);
           }
           pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
         }
@@ -208,6 +309,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         // their MVCC information.
         RowIDPosList temp_pos_list;
         temp_pos_list.reserve(expected_number_of_valid_rows);
+        if (pos_list_in->is_sorted()) temp_pos_list.guarantee_sorted();
 
         if (entirely_visible_chunks.empty()) {
           // Check _is_entire_chunk_visible once for every chunk, even if we do not know if it is referenced or not.
@@ -253,7 +355,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
 
       DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
 
-      if (_can_use_chunk_shortcut && _is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
+      if (_is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
         // Not using the entirely_visible_chunks cache here as for data tables, we only look at chunks once anyway.
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
       } else {
@@ -261,13 +363,11 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         RowIDPosList temp_pos_list;
         temp_pos_list.reserve(expected_number_of_valid_rows);
         temp_pos_list.guarantee_single_chunk();
+        temp_pos_list.guarantee_sorted();
         // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto i = 0u; i < chunk_size; i++) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, i});
-          }
-        }
+        collect_visible_rows(
+            our_tid, snapshot_commit_id, *mvcc_data, chunk_id, chunk_in->size(),
+            [](const size_t index) { return static_cast<ChunkOffset>(index); }, temp_pos_list);
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
       }
 
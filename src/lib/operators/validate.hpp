@@ -34,7 +34,8 @@ class Validate : public AbstractReadOnlyOperator {
                         std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
 
   // This is a performance optimization that can only be used if a couple of conditions are met, i.e., if
-  // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
+  // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions. Chunks with compacted
+  // MVCC data are entirely visible regardless of _can_use_chunk_shortcut.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
   bool _can_use_chunk_shortcut = true;
@@ -0,0 +1,550 @@
+#include "window.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "operators/sort.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Runs functor(task_id) for each task, concurrently if there is more than one task
+template <typename Functor>
+void execute_tasks(const size_t task_count, const Functor& functor) {
+  if (task_count == 1) {
+    functor(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, task_id]() { functor(task_id); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns the number of tasks among which `row_count` rows are split, given that each task should process at least
+// JOB_SPAWN_THRESHOLD rows
+size_t task_count_for(const size_t row_count) {
+  return std::max(size_t{1}, std::min(row_count / Window::JOB_SPAWN_THRESHOLD,
+                                      static_cast<size_t>(Hyrise::get().topology.num_cpus())));
+}
+
+// The values of a column of the sorted input in output order. NULLs are not stored as std::vector<bool>, so that tasks
+// can write them concurrently.
+template <typename T>
+struct MaterializedColumn {
+  std::vector<T> values;
+  std::vector<uint8_t> nulls;
+};
+
+template <typename T>
+MaterializedColumn<T> materialize_column(const Table& table, const ColumnID column_id,
+                                         const std::vector<size_t>& first_row_by_chunk) {
+  const auto row_count = first_row_by_chunk.back();
+  const auto chunk_count = table.chunk_count();
+  auto column = MaterializedColumn<T>{std::vector<T>(row_count), std::vector<uint8_t>(row_count)};
+
+  const auto task_count = std::min(static_cast<size_t>(chunk_count), task_count_for(row_count));
+  execute_tasks(task_count, [&](const size_t task_id) {
+    const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+    const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      const auto first_row = first_row_by_chunk[chunk_id];
+      segment_iterate<T>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+        const auto row = first_row + position.chunk_offset();
+        if (position.is_null()) {
+          column.nulls[row] = true;
+        } else {
+          column.values[row] = position.value();
+        }
+      });
+    }
+  });
+
+  return column;
+}
+
+// Flags the rows whose values in the column differ from those of the previous row. Added to partition_starts for the
+// PARTITION BY columns and to peer_starts for the ORDER BY columns.
+void flag_value_changes(const Table& table, const ColumnID column_id, const std::vector<size_t>& first_row_by_chunk,
+                        std::vector<uint8_t>& starts) {
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto column = materialize_column<ColumnDataType>(table, column_id, first_row_by_chunk);
+
+    const auto row_count = starts.size();
+    const auto task_count = task_count_for(row_count);
+    execute_tasks(task_count, [&](const size_t task_id) {
+      const auto begin_row = std::max(size_t{1}, row_count * task_id / task_count);
+      const auto end_row = row_count * (task_id + 1) / task_count;
+      for (auto row = begin_row; row < end_row; ++row) {
+        if (column.nulls[row] != column.nulls[row - 1] ||
+            (!column.nulls[row] && column.values[row] != column.values[row - 1])) {
+          starts[row] = true;
+        }
+      }
+    });
+  });
+}
+
+// Splits the rows into ranges of complete partitions, one per task
+std::vector<size_t> split_into_task_ranges(const std::vector<uint8_t>& partition_starts) {
+  const auto row_count = partition_starts.size();
+  const auto task_count = task_count_for(row_count);
+
+  auto bounds = std::vector<size_t>{0};
+  for (auto task_id = size_t{1}; task_id < task_count; ++task_id) {
+    auto bound = std::max(row_count * task_id / task_count, bounds.back() + 1);
+    while (bound < row_count && !partition_starts[bound]) ++bound;
+    if (bound >= row_count) break;
+    bounds.emplace_back(bound);
+  }
+  bounds.emplace_back(row_count);
+  return bounds;
+}
+
+// Answers aggregates over ranges of leaves in O(log n). Each inner node holds the combination of its two children, so
+// that every range is covered by O(log n) nodes. Node 1 is the root, the leaves are the nodes n to 2n - 1. Combine
+// has to be commutative and associative, and a default-constructed State has to be its neutral element.
+template <typename State, typename Combine>
+class SegmentTree {
+ public:
+  SegmentTree(std::vector<State>&& leaves, const Combine& combine)
+      : _leaf_count(leaves.size()), _nodes(2 * _leaf_count), _combine(combine) {
+    std::move(leaves.begin(), leaves.end(), _nodes.begin() + _leaf_count);
+    for (auto node = _leaf_count - 1; node > 0; --node) {
+      _nodes[node] = _combine(_nodes[2 * node], _nodes[2 * node + 1]);
+    }
+  }
+
+  // Combines the leaves from begin (inclusive) to end (exclusive)
+  State aggregate(size_t begin, size_t end) const {
+    auto result = State{};
+    for (begin += _leaf_count, end += _leaf_count; begin < end; begin /= 2, end /= 2) {
+      if (begin % 2 == 1) result = _combine(result, _nodes[begin++]);
+      if (end % 2 == 1) result = _combine(result, _nodes[--end]);
+    }
+    return result;
+  }
+
+ private:
+  const size_t _leaf_count;
+  std::vector<State> _nodes;
+  const Combine _combine;
+};
+
+// The aggregate of the non-NULL values in a frame and their number
+template <typename Accumulator>
+struct AggregateState {
+  Accumulator value{};
+  int64_t count{0};
+};
+
+template <typename ResultType>
+struct WindowFunctionResult {
+  std::vector<ResultType> values;
+  std::vector<uint8_t> nulls;
+};
+
+// The inputs of the window function computation, in output order
+struct PartitionedRows {
+  std::vector<uint8_t> partition_starts;
+  std::vector<uint8_t> peer_starts;
+  std::vector<size_t> task_bounds;
+};
+
+// Calls functor(row, partition_begin, partition_end, peer_begin, peer_end) for every row of the task. Peers are the
+// rows of the partition with the same ORDER BY values.
+template <typename Functor>
+void for_each_row_of_task(const PartitionedRows& rows, const size_t task_id, const Functor& functor) {
+  const auto task_end = rows.task_bounds[task_id + 1];
+  auto partition_begin = rows.task_bounds[task_id];
+  while (partition_begin < task_end) {
+    auto partition_end = partition_begin + 1;
+    while (partition_end < task_end && !rows.partition_starts[partition_end]) ++partition_end;
+
+    auto peer_begin = partition_begin;
+    while (peer_begin < partition_end) {
+      auto peer_end = peer_begin + 1;
+      while (peer_end < partition_end && !rows.peer_starts[peer_end]) ++peer_end;
+
+      for (auto row = peer_begin; row < peer_end; ++row) {
+        functor(row, partition_begin, partition_end, peer_begin, peer_end);
+      }
+      peer_begin = peer_end;
+    }
+    partition_begin = partition_end;
+  }
+}
+
+WindowFunctionResult<int64_t> compute_ranking_function(const WindowFunction window_function,
+                                                       const PartitionedRows& rows) {
+  const auto row_count = rows.partition_starts.size();
+  auto result = WindowFunctionResult<int64_t>{std::vector<int64_t>(row_count), {}};
+
+  execute_tasks(rows.task_bounds.size() - 1, [&](const size_t task_id) {
+    auto dense_rank = int64_t{0};
+    for_each_row_of_task(rows, task_id, [&](const auto row, const auto partition_begin, const auto /*partition_end*/,
+                                            const auto peer_begin, const auto /*peer_end*/) {
+      if (row == partition_begin) dense_rank = 0;
+      if (row == peer_begin) ++dense_rank;
+
+      switch (window_function) {
+        case WindowFunction::RowNumber:
+          result.values[row] = static_cast<int64_t>(row - partition_begin + 1);
+          break;
+        case WindowFunction::Rank:
+          result.values[row] = static_cast<int64_t>(peer_begin - partition_begin + 1);
+          break;
+        case WindowFunction::DenseRank:
+          result.values[row] = dense_rank;
+          break;
+        default:
+          Fail("Expected ranking function");
+      }
+    });
+  });
+
+  return result;
+}
+
+// Computes an aggregate over the frame of every row. `argument` is nullptr for COUNT(*). Each task builds a segment
+// tree over its rows, which does not have to span partitions, as frames do not.
+template <typename ArgumentType, typename Accumulator, typename Combine, typename Finalize>
+auto compute_aggregate_function(const MaterializedColumn<ArgumentType>* const argument, const WindowFrame& frame,
+                                const PartitionedRows& rows, const Combine& combine, const Finalize& finalize) {
+  using State = AggregateState<Accumulator>;
+  using ResultType = typename std::decay_t<decltype(finalize(State{}))>::value_type;
+
+  const auto row_count = rows.partition_starts.size();
+  auto result = WindowFunctionResult<ResultType>{std::vector<ResultType>(row_count), std::vector<uint8_t>(row_count)};
+
+  execute_tasks(rows.task_bounds.size() - 1, [&](const size_t task_id) {
+    const auto task_begin = rows.task_bounds[task_id];
+    const auto task_end = rows.task_bounds[task_id + 1];
+
+    auto leaves = std::vector<State>(task_end - task_begin);
+    for (auto row = task_begin; row < task_end; ++row) {
+      auto& leaf = leaves[row - task_begin];
+      if (!argument) {
+        leaf.count = 1;
+      } else if (!argument->nulls[row]) {
+        leaf.value = static_cast<Accumulator>(argument->values[row]);
+        leaf.count = 1;
+      }
+    }
+    const auto segment_tree = SegmentTree<State, Combine>{std::move(leaves), combine};
+
+    for_each_row_of_task(rows, task_id, [&](const auto row, const auto partition_begin, const auto partition_end,
+                                            const auto peer_begin, const auto peer_end) {
+      auto frame_begin = partition_begin;
+      auto frame_end = partition_end;
+      if (frame.type == FrameType::Rows) {
+        if (frame.preceding && row - partition_begin > *frame.preceding) frame_begin = row - *frame.preceding;
+        if (frame.following && partition_end - row - 1 > *frame.following) frame_end = row + *frame.following + 1;
+      } else {
+        // RANGE frames only have UNBOUNDED or CURRENT ROW bounds, where the current row includes its peers
+        if (frame.preceding) frame_begin = peer_begin;
+        if (frame.following) frame_end = peer_end;
+      }
+
+      const auto state = segment_tree.aggregate(frame_begin - task_begin, frame_end - task_begin);
+      const auto value = finalize(state);
+      if (value) {
+        result.values[row] = *value;
+      } else {
+        result.nulls[row] = true;
+      }
+    });
+  });
+
+  return result;
+}
+
+template <typename ArgumentType>
+auto compute_min_max(const MaterializedColumn<ArgumentType>& argument, const WindowFrame& frame,
+                     const PartitionedRows& rows, const bool is_min) {
+  using State = AggregateState<ArgumentType>;
+  const auto combine = [is_min](const State& lhs, const State& rhs) {
+    if (lhs.count == 0) return rhs;
+    if (rhs.count == 0) return lhs;
+    const auto lhs_wins = is_min ? !(rhs.value < lhs.value) : !(lhs.value < rhs.value);
+    return State{lhs_wins ? lhs.value : rhs.value, lhs.count + rhs.count};
+  };
+  const auto finalize = [](const State& state) {
+    return state.count > 0 ? std::optional<ArgumentType>{state.value} : std::nullopt;
+  };
+  return compute_aggregate_function<ArgumentType, ArgumentType>(&argument, frame, rows, combine, finalize);
+}
+
+// Writes the result of the window function to a ValueSegment per chunk of the sorted input
+template <typename ResultType>
+std::vector<std::shared_ptr<AbstractSegment>> write_segments(WindowFunctionResult<ResultType>&& result,
+                                                             const std::vector<size_t>& first_row_by_chunk,
+                                                             const bool nullable) {
+  const auto chunk_count = first_row_by_chunk.size() - 1;
+  auto segments = std::vector<std::shared_ptr<AbstractSegment>>(chunk_count);
+
+  const auto task_count = std::min(chunk_count, task_count_for(first_row_by_chunk.back()));
+  execute_tasks(task_count, [&](const size_t task_id) {
+    for (auto chunk_id = chunk_count * task_id / task_count; chunk_id < chunk_count * (task_id + 1) / task_count;
+         ++chunk_id) {
+      const auto begin = first_row_by_chunk[chunk_id];
+      const auto end = first_row_by_chunk[chunk_id + 1];
+      auto values = pmr_vector<ResultType>(std::make_move_iterator(result.values.begin() + begin),
+                                           std::make_move_iterator(result.values.begin() + end));
+      if (nullable) {
+        auto nulls = NullBitmap(result.nulls.begin() + begin, result.nulls.begin() + end);
+        segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(values), std::move(nulls));
+      } else {
+        segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(values));
+      }
+    }
+  });
+
+  return segments;
+}
+
+ColumnID column_id_of(const std::shared_ptr<AbstractExpression>& expression) {
+  const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+  Assert(pqp_column_expression, "Expected the arguments of the window function to be columns");
+  return pqp_column_expression->column_id;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Window::Window(const std::shared_ptr<const AbstractOperator>& in,
+               const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::Window, in, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _window_function_expression(window_function_expression) {}
+
+const std::string& Window::name() const {
+  static const auto name = std::string{"Window"};
+  return name;
+}
+
+std::string Window::description(DescriptionMode description_mode) const {
+  return name() + " " + _window_function_expression->as_column_name();
+}
+
+const std::shared_ptr<WindowFunctionExpression>& Window::window_function_expression() const {
+  return _window_function_expression;
+}
+
+std::shared_ptr<AbstractOperator> Window::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<Window>(
+      copied_left_input, std::static_pointer_cast<WindowFunctionExpression>(_window_function_expression->deep_copy()));
+}
+
+void Window::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Window::_on_execute() {
+  const auto& input_table = left_input_table();
+  const auto& expression = *_window_function_expression;
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  Timer timer;
+
+  const auto window_function = expression.window_function;
+  const auto argument_column_id =
+      expression.argument() ? std::optional<ColumnID>{column_id_of(expression.argument())} : std::nullopt;
+  const auto is_aggregate = window_function != WindowFunction::RowNumber && window_function != WindowFunction::Rank &&
+                            window_function != WindowFunction::DenseRank;
+  const auto nullable = is_aggregate && window_function != WindowFunction::Count &&
+                        input_table->column_is_nullable(*argument_column_id);
+
+  auto column_definitions = input_table->column_definitions();
+  column_definitions.emplace_back(expression.as_column_name(), expression.data_type(), nullable);
+
+  if (input_table->row_count() == 0) {
+    return std::make_shared<Table>(column_definitions, TableType::Data);
+  }
+
+  // 1. Sort the input by the PARTITION BY and then by the ORDER BY columns
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto& partition_by_expression : expression.partition_by_expressions()) {
+    sort_definitions.emplace_back(column_id_of(partition_by_expression));
+  }
+  const auto order_by_expressions = expression.order_by_expressions();
+  for (auto expression_idx = size_t{0}; expression_idx < order_by_expressions.size(); ++expression_idx) {
+    sort_definitions.emplace_back(column_id_of(order_by_expressions[expression_idx]),
+                                  expression.sort_modes[expression_idx]);
+  }
+
+  auto sorted_table = input_table;
+  if (!sort_definitions.empty()) {
+    const auto sort = std::make_shared<Sort>(left_input(), sort_definitions);
+    sort->execute();
+    sorted_table = sort->get_output();
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
+
+  // 2. Find the partitions and the peers, i.e., the rows with the same ORDER BY values, and compute the window function
+  //    for tasks of complete partitions
+  const auto chunk_count = sorted_table->chunk_count();
+  auto first_row_by_chunk = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    first_row_by_chunk[chunk_id + 1] = first_row_by_chunk[chunk_id] + sorted_table->get_chunk(chunk_id)->size();
+  }
+  const auto row_count = first_row_by_chunk.back();
+
+  auto rows = PartitionedRows{};
+  rows.partition_starts.resize(row_count);
+  rows.partition_starts[0] = true;
+  const auto partition_by_column_count = sort_definitions.size() - order_by_expressions.size();
+  for (auto sort_definition_idx = size_t{0}; sort_definition_idx < partition_by_column_count; ++sort_definition_idx) {
+    flag_value_changes(*sorted_table, sort_definitions[sort_definition_idx].column, first_row_by_chunk,
+                       rows.partition_starts);
+  }
+
+  rows.peer_starts = rows.partition_starts;
+  for (auto sort_definition_idx = partition_by_column_count; sort_definition_idx < sort_definitions.size();
+       ++sort_definition_idx) {
+    flag_value_changes(*sorted_table, sort_definitions[sort_definition_idx].column, first_row_by_chunk,
+                       rows.peer_starts);
+  }
+  rows.task_bounds = split_into_task_ranges(rows.partition_starts);
+
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+  if (!is_aggregate) {
+    result_segments =
+        write_segments(compute_ranking_function(window_function, rows), first_row_by_chunk, false);
+  } else if (!argument_column_id) {
+    Assert(window_function == WindowFunction::Count, "Only COUNT can be computed without an argument");
+    using State = AggregateState<int64_t>;
+    const auto combine = [](const State& lhs, const State& rhs) { return State{0, lhs.count + rhs.count}; };
+    const auto finalize = [](const State& state) { return std::optional<int64_t>{state.count}; };
+    result_segments = write_segments(
+        compute_aggregate_function<int64_t, int64_t>(nullptr, expression.frame, rows, combine, finalize),
+        first_row_by_chunk, false);
+  } else {
+    resolve_data_type(sorted_table->column_data_type(*argument_column_id), [&](const auto data_type_t) {
+      using ArgumentType = typename decltype(data_type_t)::type;
+      const auto argument = materialize_column<ArgumentType>(*sorted_table, *argument_column_id, first_row_by_chunk);
+
+      switch (window_function) {
+        case WindowFunction::Min:
+        case WindowFunction::Max:
+          result_segments = write_segments(
+              compute_min_max(argument, expression.frame, rows, window_function == WindowFunction::Min),
+              first_row_by_chunk, nullable);
+          break;
+
+        case WindowFunction::Count: {
+          using State = AggregateState<int64_t>;
+          const auto combine = [](const State& lhs, const State& rhs) { return State{0, lhs.count + rhs.count}; };
+          const auto finalize = [](const State& state) { return std::optional<int64_t>{state.count}; };
+          auto result = WindowFunctionResult<int64_t>{};
+          if constexpr (std::is_arithmetic_v<ArgumentType>) {
+            result = compute_aggregate_function<ArgumentType, int64_t>(&argument, expression.frame, rows, combine,
+                                                                       finalize);
+          } else {
+            // Strings are not accumulated, only their NULL flags are relevant
+            auto null_flags = MaterializedColumn<int64_t>{std::vector<int64_t>(row_count), argument.nulls};
+            result = compute_aggregate_function<int64_t, int64_t>(&null_flags, expression.frame, rows, combine,
+                                                                  finalize);
+          }
+          result_segments = write_segments(std::move(result), first_row_by_chunk, false);
+        } break;
+
+        case WindowFunction::Sum:
+        case WindowFunction::Avg: {
+          if constexpr (std::is_arithmetic_v<ArgumentType>) {
+            using SumType = typename AggregateTraits<ArgumentType, AggregateFunction::Sum>::AggregateType;
+            using State = AggregateState<SumType>;
+            const auto combine = [](const State& lhs, const State& rhs) {
+              return State{lhs.value + rhs.value, lhs.count + rhs.count};
+            };
+
+            if (window_function == WindowFunction::Sum) {
+              const auto finalize = [](const State& state) {
+                return state.count > 0 ? std::optional<SumType>{state.value} : std::nullopt;
+              };
+              result_segments = write_segments(
+                  compute_aggregate_function<ArgumentType, SumType>(&argument, expression.frame, rows, combine,
+                                                                    finalize),
+                  first_row_by_chunk, nullable);
+            } else {
+              const auto finalize = [](const State& state) {
+                return state.count > 0 ? std::optional<double>{static_cast<double>(state.value) /
+                                                               static_cast<double>(state.count)}
+                                       : std::nullopt;
+              };
+              result_segments = write_segments(
+                  compute_aggregate_function<ArgumentType, SumType>(&argument, expression.frame, rows, combine,
+                                                                    finalize),
+                  first_row_by_chunk, nullable);
+            }
+          } else {
+            Fail("SUM and AVG are only supported for numeric arguments");
+          }
+        } break;
+
+        default:
+          Fail("Unexpected window function");
+      }
+    });
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::ComputeWindowFunction, timer.lap());
+
+  // 3. Write the sorted input with the result of the window function. As a table cannot mix data and reference
+  //    segments, the result of a reference input is stored in a separate table that reference segments point to (see
+  //    Projection).
+  const auto output_table_type = sorted_table->type();
+  auto result_table = std::shared_ptr<Table>{};
+  if (output_table_type == TableType::References) {
+    result_table = std::make_shared<Table>(TableColumnDefinitions{column_definitions.back()}, TableType::Data);
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto sorted_chunk = sorted_table->get_chunk(chunk_id);
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < sorted_table->column_count(); ++column_id) {
+      segments.emplace_back(sorted_chunk->get_segment(column_id));
+    }
+
+    if (result_table) {
+      result_table->append_chunk(Segments{result_segments[chunk_id]});
+      const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, sorted_chunk->size());
+      segments.emplace_back(std::make_shared<ReferenceSegment>(result_table, ColumnID{0}, pos_list));
+    } else {
+      segments.emplace_back(result_segments[chunk_id]);
+    }
+
+    output_chunks[chunk_id] = std::make_shared<Chunk>(std::move(segments));
+    output_chunks[chunk_id]->finalize();
+    if (!sorted_chunk->individually_sorted_by().empty()) {
+      output_chunks[chunk_id]->set_individually_sorted_by(sorted_chunk->individually_sorted_by());
+    }
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(column_definitions, output_table_type, std::move(output_chunks));
+}
+
+}  // namespace opossum
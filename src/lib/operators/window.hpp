@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Computes a window function (see WindowFunctionExpression) for each row of the input. The output consists of the
+ * input columns, followed by the result of the window function. The argument, PARTITION BY, and ORDER BY expressions of
+ * the window function have to be PQPColumnExpressions.
+ *
+ * The input is sorted by the PARTITION BY and then by the ORDER BY columns using the Sort operator, so that the rows
+ * of each partition are consecutive and ordered. The rows are output in this order. Tasks of at least
+ * JOB_SPAWN_THRESHOLD rows then compute the window function for ranges of complete partitions. Aggregates over a frame
+ * are answered by a segment tree over the rows of the task, i.e., in O(log n) per row for any frame.
+ */
+class Window : public AbstractReadOnlyOperator {
+ public:
+  static constexpr auto JOB_SPAWN_THRESHOLD = 10'000;
+
+  enum class OperatorSteps : uint8_t { Sort, ComputeWindowFunction, WriteOutput };
+
+  Window(const std::shared_ptr<const AbstractOperator>& in,
+         const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::shared_ptr<WindowFunctionExpression>& window_function_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+};
+
+}  // namespace opossum
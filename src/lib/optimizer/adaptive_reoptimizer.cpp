@@ -0,0 +1,200 @@
+#include "adaptive_reoptimizer.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractLQPNode>> join_nodes(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) nodes.emplace_back(node);
+    return LQPVisitation::VisitInputs;
+  });
+  return nodes;
+}
+
+// Returns a join that has no joins below it, if the LQP has multiple joins (otherwise, there is nothing to re-order)
+std::shared_ptr<AbstractLQPNode> next_materialized_join(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto nodes = join_nodes(lqp);
+  if (nodes.size() < 2) return nullptr;
+
+  const auto has_join_input = [](const auto& join_node) {
+    return !join_nodes(join_node->left_input()).empty() ||
+           (join_node->right_input() && !join_nodes(join_node->right_input()).empty());
+  };
+  const auto iter = std::find_if_not(nodes.begin(), nodes.end(), has_join_input);
+  DebugAssert(iter != nodes.end(), "The lowest join should have no joins as inputs");
+  return *iter;
+}
+
+std::shared_ptr<AbstractCostEstimator> create_cost_estimator() {
+  // Same cost model as the default optimizer
+  const auto cardinality_estimator = std::make_shared<CardinalityEstimator>();
+  if (const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients) {
+    return std::make_shared<CostEstimatorCalibrated>(cardinality_estimator, cost_model_coefficients);
+  }
+  return std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+}
+
+std::vector<std::shared_ptr<AbstractTask>> execute_pqp(const std::shared_ptr<AbstractOperator>& pqp,
+                                                       const std::shared_ptr<TransactionContext>& transaction_context) {
+  if (transaction_context) pqp->set_transaction_context_recursively(transaction_context);
+  const auto operator_tasks = OperatorTask::make_tasks_from_operator(pqp);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>(operator_tasks.cbegin(), operator_tasks.cend());
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  return tasks;
+}
+
+// Replaces the subplan of the executed node by a StaticTableNode that holds its result
+void materialize(const std::shared_ptr<AbstractLQPNode>& root_node, const std::shared_ptr<AbstractLQPNode>& node,
+                 const Table& result, const TableStatistics& estimated_statistics) {
+  // The StaticTableNode needs a mutable table, which shares the segments of the result
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  const auto chunk_count = result.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = result.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    auto segments = Segments{};
+    const auto column_count = chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+  }
+  const auto table = std::make_shared<Table>(result.column_definitions(), result.type(), std::move(chunks));
+
+  // Generating statistics from the result would require a pass over it. Instead, the estimated statistics are scaled
+  // to the actual row count.
+  const auto actual_row_count = static_cast<Cardinality>(result.row_count());
+  const auto selectivity =
+      estimated_statistics.row_count > 0 ? actual_row_count / estimated_statistics.row_count : Selectivity{1};
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(estimated_statistics.column_statistics.size());
+  for (const auto& estimated_column_statistics : estimated_statistics.column_statistics) {
+    column_statistics.emplace_back(estimated_column_statistics->scaled(selectivity));
+  }
+  table->set_table_statistics(std::make_shared<TableStatistics>(std::move(column_statistics), actual_row_count));
+
+  const auto static_table_node = StaticTableNode::make(table);
+
+  // The nodes above refer to the output expressions of the materialized subplan, which now are the columns of the
+  // StaticTableNode
+  auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  const auto output_expressions = node->output_expressions();
+  const auto static_table_expressions = static_table_node->output_expressions();
+  DebugAssert(output_expressions.size() == static_table_expressions.size(), "Result should match the output");
+  for (auto column_id = ColumnID{0}; column_id < output_expressions.size(); ++column_id) {
+    expression_mapping.emplace(output_expressions[column_id], static_table_expressions[column_id]);
+  }
+
+  lqp_replace_node(node, static_table_node);
+
+  visit_lqp(root_node, [&](const auto& visited_node) {
+    if (visited_node == static_table_node) return LQPVisitation::DoNotVisitInputs;
+
+    for (auto& expression : visited_node->node_expressions) {
+      expression_deep_replace(expression, expression_mapping);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+AdaptiveReoptimizer::AdaptiveReoptimizer(const double init_q_error_threshold)
+    : q_error_threshold(init_q_error_threshold) {
+  Assert(q_error_threshold >= 1.0, "The q-error is at least 1");
+}
+
+bool AdaptiveReoptimizer::is_applicable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto is_query = true;
+  auto join_count = size_t{0};
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::DummyTable:
+      case LQPNodeType::Except:
+      case LQPNodeType::Intersect:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Root:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StaticTable:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Union:
+      case LQPNodeType::Validate:
+        break;
+
+      case LQPNodeType::Join:
+        ++join_count;
+        break;
+
+      default:
+        is_query = false;
+    }
+    return is_query ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return is_query && join_count > 1;
+}
+
+std::vector<std::shared_ptr<AbstractTask>> AdaptiveReoptimizer::execute(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<TransactionContext>& transaction_context) {
+  // The LQP might be cached, so the materialized results are placed in a copy
+  const auto root_node = LogicalPlanRootNode::make(lqp->deep_copy());
+
+  while (const auto join_node = next_materialized_join(root_node)) {
+    const auto estimated_statistics = CardinalityEstimator{}.estimate_statistics(join_node);
+
+    const auto pqp = LQPTranslator{}.translate_node(join_node);
+    execute_pqp(pqp, transaction_context);
+    const auto& result = pqp->get_output();
+    Assert(result, "Join should have produced a result");
+
+    const auto actual_row_count = static_cast<double>(result->row_count());
+    const auto estimated_row_count = static_cast<double>(estimated_statistics->row_count);
+    materialize(root_node, join_node, *result, *estimated_statistics);
+
+    // Plus one, so that empty results and estimates do not divide by zero
+    const auto q_error = (std::max(actual_row_count, estimated_row_count) + 1.0) /
+                         (std::min(actual_row_count, estimated_row_count) + 1.0);
+    if (q_error > q_error_threshold) {
+      auto join_ordering_rule = JoinOrderingRule{};
+      join_ordering_rule.cost_estimator = create_cost_estimator();
+      join_ordering_rule.apply_to_plan(root_node);
+      ++reoptimization_count;
+    }
+  }
+
+  return execute_pqp(LQPTranslator{}.translate_node(root_node->left_input()), transaction_context);
+}
+
+}  // namespace opossum
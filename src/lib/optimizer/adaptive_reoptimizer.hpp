@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractTask;
+class TransactionContext;
+
+/**
+ * Mid-query re-optimization. Cardinality estimates are often off by orders of magnitude after a few joins, but a plan
+ * never changes once its execution has started. The AdaptiveReoptimizer executes a query join by join instead, starting
+ * with the lowest joins:
+ *
+ *   1. The output of an executed join is a materialization point: Its subplan is replaced by a StaticTableNode holding
+ *      the result, whose statistics are scaled to the actual row count.
+ *   2. If the actual row count deviates from the estimate by more than the q-error threshold, the JoinOrderingRule is
+ *      applied to the remaining LQP, which is now estimated with the true cardinality of the materialized result.
+ *   3. Once the remaining LQP has at most one join, it is translated and executed as a whole.
+ *
+ * The SQLPipelineStatement uses it for SELECT statements if Hyrise::get().adaptive_reoptimizer is set.
+ */
+class AdaptiveReoptimizer : public Noncopyable {
+ public:
+  explicit AdaptiveReoptimizer(const double init_q_error_threshold = 10.0);
+
+  // Whether the LQP is a query with multiple joins. Data-modifying or maintenance statements are not re-optimized.
+  static bool is_applicable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  /**
+   * Executes the optimized LQP, which is not modified. Returns the (executed) tasks of the last step, the last of which
+   * holds the root operator.
+   */
+  std::vector<std::shared_ptr<AbstractTask>> execute(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                     const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // The remaining plan is re-optimized if max(actual, estimated) / min(actual, estimated) exceeds this threshold
+  const double q_error_threshold;
+
+  // Number of times that the remaining plan was re-optimized
+  std::atomic<size_t> reoptimization_count{0};
+};
+
+}  // namespace opossum
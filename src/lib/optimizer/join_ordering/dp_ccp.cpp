@@ -1,17 +1,31 @@
 #include "dp_ccp.hpp"
 
+#include <map>
 #include <unordered_map>
 
 #include "cost_estimation/abstract_cost_estimator.hpp"
 #include "enumerate_ccp.hpp"
+#include "hyrise.hpp"
 #include "join_graph.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using CsgCmpPairIndicesByVertexSet = std::map<JoinGraphVertexSet, std::vector<size_t>>;
+
+}  // namespace
+
 namespace opossum {
 
+DpCcp::DpCcp(const size_t max_csg_cmp_pair_count) : _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
+
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
@@ -98,39 +112,109 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
   }
 
   /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
+   * 5. Enumerate the CsgCmpPairs. Give up if there are too many of them. The estimations for the vertices and local
+   *    predicates remain in the caches of the cost estimator for the algorithm that the caller falls back to.
    */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
-  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
-    const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
-    const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
-    DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
-                "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
+  auto enumerate_ccp = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges, _max_csg_cmp_pair_count};
+  const auto csg_cmp_pairs = enumerate_ccp();
+  if (enumerate_ccp.limit_exceeded()) return nullptr;
+
+  /**
+   * 6. Actual DpCcp algorithm: Build candidate plans; keep the cheapest candidate plan for each subset of vertices.
+   *
+   * The CsgCmpPairs are grouped by the vertex set that they join. The candidates for a vertex set only depend on the
+   * plans of smaller vertex sets, so that all vertex sets of the same size are planned concurrently, level by level.
+   * The entries of `best_plan` are created upfront, so that the map is not modified while it is read concurrently.
+   * Within a vertex set, the candidates are considered in the order of enumeration, so that ties are broken as in a
+   * serial enumeration.
+   */
+  auto csg_cmp_pair_indices_by_vertex_set = CsgCmpPairIndicesByVertexSet{};
+  for (auto csg_cmp_pair_idx = size_t{0}; csg_cmp_pair_idx < csg_cmp_pairs.size(); ++csg_cmp_pair_idx) {
+    const auto& csg_cmp_pair = csg_cmp_pairs[csg_cmp_pair_idx];
+    csg_cmp_pair_indices_by_vertex_set[csg_cmp_pair.first | csg_cmp_pair.second].emplace_back(csg_cmp_pair_idx);
+  }
+
+  auto vertex_sets_by_size = std::vector<std::vector<CsgCmpPairIndicesByVertexSet::const_iterator>>(
+      join_graph.vertices.size() + 1);
+  for (auto iter = csg_cmp_pair_indices_by_vertex_set.cbegin(); iter != csg_cmp_pair_indices_by_vertex_set.cend();
+       ++iter) {
+    vertex_sets_by_size[iter->first.count()].emplace_back(iter);
+    best_plan.emplace(iter->first, nullptr);
+  }
+
+  // Warm up the caches of the vertex plans before they are accessed concurrently. Some nodes (e.g., StoredTableNodes)
+  // compute their output expressions lazily.
+  for (const auto& [vertex_set, plan] : best_plan) {
+    if (!plan) continue;
+    plan->output_expressions();
+    cost_estimator->estimate_plan_cost(plan);
+  }
+
+  const auto plan_vertex_set = [&](const CsgCmpPairIndicesByVertexSet::const_iterator& vertex_set_iter) {
+    auto best_candidate_plan = std::shared_ptr<AbstractLQPNode>{};
+    auto best_candidate_cost = Cost{0};
+
+    for (const auto csg_cmp_pair_idx : vertex_set_iter->second) {
+      const auto& csg_cmp_pair = csg_cmp_pairs[csg_cmp_pair_idx];
+      const auto& left_plan = best_plan.find(csg_cmp_pair.first)->second;
+      const auto& right_plan = best_plan.find(csg_cmp_pair.second)->second;
+      DebugAssert(left_plan && right_plan, "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
 
-    const auto join_predicates = join_graph.find_join_predicates(csg_cmp_pair.first, csg_cmp_pair.second);
+      const auto join_predicates = join_graph.find_join_predicates(csg_cmp_pair.first, csg_cmp_pair.second);
+      auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, cost_estimator);
+      const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_plan);
 
-    auto candidate_plan =
-        _add_join_to_plan(best_plan_left_iter->second, best_plan_right_iter->second, join_predicates, cost_estimator);
+      if (!best_candidate_plan || candidate_cost < best_candidate_cost) {
+        best_candidate_plan = std::move(candidate_plan);
+        best_candidate_cost = candidate_cost;
+      }
+    }
 
-    const auto joined_vertex_set = csg_cmp_pair.first | csg_cmp_pair.second;
+    best_plan.find(vertex_set_iter->first)->second = std::move(best_candidate_plan);
+  };
+
+  for (const auto& vertex_sets : vertex_sets_by_size) {
+    // Split the level into tasks of at least MIN_CANDIDATES_PER_TASK candidate plans
+    auto task_ranges = std::vector<std::pair<size_t, size_t>>{};
+    auto task_begin = size_t{0};
+    auto task_candidate_count = size_t{0};
+    for (auto vertex_set_idx = size_t{0}; vertex_set_idx < vertex_sets.size(); ++vertex_set_idx) {
+      task_candidate_count += vertex_sets[vertex_set_idx]->second.size();
+      if (task_candidate_count < MIN_CANDIDATES_PER_TASK && vertex_set_idx + 1 < vertex_sets.size()) continue;
+
+      task_ranges.emplace_back(task_begin, vertex_set_idx + 1);
+      task_begin = vertex_set_idx + 1;
+      task_candidate_count = 0;
+    }
 
-    const auto best_plan_iter = best_plan.find(joined_vertex_set);
-    if (best_plan_iter == best_plan.end() || cost_estimator->estimate_plan_cost(candidate_plan) <
-                                                 cost_estimator->estimate_plan_cost(best_plan_iter->second)) {
-      best_plan.insert_or_assign(joined_vertex_set, candidate_plan);
+    const auto plan_vertex_sets = [&](const std::pair<size_t, size_t>& task_range) {
+      for (auto vertex_set_idx = task_range.first; vertex_set_idx < task_range.second; ++vertex_set_idx) {
+        plan_vertex_set(vertex_sets[vertex_set_idx]);
+      }
+    };
+
+    if (task_ranges.size() == 1) {
+      plan_vertex_sets(task_ranges.front());
+    } else if (task_ranges.size() > 1) {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(task_ranges.size());
+      for (const auto& task_range : task_ranges) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, task_range]() { plan_vertex_sets(task_range); }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
     }
   }
 
   /**
-   * 6. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
+   * 7. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
    *    graph.
    */
   boost::dynamic_bitset<> all_vertices_set{join_graph.vertices.size()};
   all_vertices_set.flip();  // Turns all bits to '1'
 
   const auto best_plan_iter = best_plan.find(all_vertices_set);
-  Assert(best_plan_iter != best_plan.end(), "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+  Assert(best_plan_iter != best_plan.end() && best_plan_iter->second,
+         "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
 
   return best_plan_iter->second;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -17,11 +19,26 @@ class JoinGraph;
  * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations.
  *
  * Local predicates are pushed down and sorted by increasing cost.
+ *
+ * The planning time of DpCcp is proportional to the number of CsgCmpPairs, which grows exponentially for dense join
+ * graphs. If more than @param max_csg_cmp_pair_count pairs exist, DpCcp gives up before costing any join and returns
+ * nullptr, so that the caller can fall back to a cheaper algorithm (see JoinOrderingRule).
+ *
+ * The candidate plans for vertex sets of the same size are built and costed concurrently by the scheduler's workers.
+ * Thus, the cost estimator (and its cardinality estimator) must be safe to use from multiple threads.
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
+  // Minimum number of candidate plans that a task builds and costs, so that small levels are not split up
+  static constexpr auto MIN_CANDIDATES_PER_TASK = size_t{64};
+
+  explicit DpCcp(const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
+
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
                                               const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+ private:
+  const size_t _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
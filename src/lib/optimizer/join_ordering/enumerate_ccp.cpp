@@ -17,8 +17,9 @@
 
 namespace opossum {
 
-EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges)
-    : _num_vertices(num_vertices), _edges(std::move(edges)) {
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+                           const size_t max_csg_cmp_pair_count)
+    : _num_vertices(num_vertices), _edges(std::move(edges)), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {
   // DPccp should not be used for queries with a table count on the scale of 64 because of complexity reasons
   Assert(num_vertices < sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp relies on to_ulong()");  // NOLINT
 
@@ -47,7 +48,7 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
    * each vertex (_enumerate_csg_recursive()).
    * For each subgraph, a search for complement subgraphs is started (_enumerate_cmp()).
    */
-  for (size_t reverse_vertex_idx = 0; reverse_vertex_idx < _num_vertices; ++reverse_vertex_idx) {
+  for (size_t reverse_vertex_idx = 0; reverse_vertex_idx < _num_vertices && !_limit_exceeded; ++reverse_vertex_idx) {
     const auto forward_vertex_idx = _num_vertices - reverse_vertex_idx - 1;
 
     auto start_vertex_set = JoinGraphVertexSet(_num_vertices);
@@ -87,6 +88,15 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
   return _csg_cmp_pairs;
 }
 
+bool EnumerateCcp::limit_exceeded() const {
+  return _limit_exceeded;
+}
+
+bool EnumerateCcp::_exceeds_limit(const size_t additional_pair_count) {
+  if (additional_pair_count > _max_csg_cmp_pair_count - _csg_cmp_pairs.size()) _limit_exceeded = true;
+  return _limit_exceeded;
+}
+
 void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
                                             const JoinGraphVertexSet& exclusion_set) {
   /**
@@ -94,7 +104,15 @@ void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csg
    * For each newly found connected subgraph, calls itself recursively.
    */
 
+  if (_limit_exceeded) return;
+
   const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+
+  // Each connected subgraph found here is later paired with at least one complement (unless it is the entire graph).
+  // Stop before materializing the exponential number of subsets of a large neighborhood.
+  const auto neighborhood_subset_count = (size_t{1} << neighborhood.count()) - 1;
+  if (_exceeds_limit(csgs.size() + neighborhood_subset_count)) return;
+
   const auto neighborhood_subsets = _non_empty_subsets(neighborhood);
   const auto extended_exclusion_set = exclusion_set | neighborhood;
 
@@ -128,6 +146,7 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
     auto cmp_vertex_set = JoinGraphVertexSet(_num_vertices);
     cmp_vertex_set.set(*iter);
 
+    if (_exceeds_limit(1)) return;
     _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, cmp_vertex_set));
 
     const auto extended_exclusion_set = exclusion_set | (_exclusion_set(*iter) & neighborhood);
@@ -135,6 +154,7 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
     std::vector<JoinGraphVertexSet> csgs;
     _enumerate_csg_recursive(csgs, cmp_vertex_set, extended_exclusion_set);
 
+    if (_exceeds_limit(csgs.size())) return;
     for (const auto& csg : csgs) {
       _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, csg));
     }
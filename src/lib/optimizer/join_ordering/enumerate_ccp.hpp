@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -51,14 +52,22 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  *          -> a single vertex or
  *          -> a subgraph for which **all possible subdivisions have been enumerated before**. This fact is essential
  *              for dynamic programming to work.
+ *
+ * The number of CsgCmpPairs grows exponentially with the number of vertices for dense graphs (e.g., stars or cliques).
+ * If more than @param max_csg_cmp_pair_count pairs would be enumerated, the enumeration is aborted and
+ * limit_exceeded() returns true. The returned pairs are incomplete in that case. Connected subgraphs that are waiting
+ * for their complements count towards the limit as well, so that the enumeration stops before they are materialized.
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
 
   // Corresponds to EnumerateCsg in the paper
   std::vector<CsgCmpPair> operator()();
 
+  bool limit_exceeded() const;
+
  private:
   // Corresponds to EnumerateCsgRec in the paper
   void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
@@ -78,8 +87,13 @@ class EnumerateCcp final {
   // Corresponds to subset-first subset enumeration in the paper
   std::vector<JoinGraphVertexSet> _non_empty_subsets(const JoinGraphVertexSet& vertex_set) const;
 
+  // Returns true (and marks the limit as exceeded) if @param additional_pair_count more pairs would exceed the limit
+  bool _exceeds_limit(const size_t additional_pair_count);
+
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const size_t _max_csg_cmp_pair_count;
+  bool _limit_exceeded{false};
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
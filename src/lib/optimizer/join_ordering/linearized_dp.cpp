@@ -0,0 +1,260 @@
+#include "linearized_dp.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using TreeAdjacency = std::vector<std::vector<std::pair<size_t, double>>>;
+
+/**
+ * A sequence of vertices that IKKBZ does not separate anymore. T is the factor by which the sequence multiplies the
+ * cardinality of the plan it is joined to, C is the C_out cost that it adds to a plan with a cardinality of one.
+ */
+struct Module {
+  double t;
+  double c;
+  std::vector<size_t> vertices;
+
+  // Sequences with a lower rank should be joined first (adjacent sequence interchange property)
+  double rank() const {
+    if (c == 0.0) return -std::numeric_limits<double>::infinity();
+    return (t - 1.0) / c;
+  }
+
+  void append(const Module& other) {
+    c += t * other.c;
+    t *= other.t;
+    vertices.insert(vertices.end(), other.vertices.begin(), other.vertices.end());
+  }
+};
+
+// Linearizes the subtree below @param vertex_idx into a sequence of modules with ascending ranks
+std::vector<Module> linearize_subtree(const TreeAdjacency& adjacency, const std::vector<double>& cardinalities,
+                                      const size_t vertex_idx, const size_t parent_idx,
+                                      const double parent_selectivity) {
+  // Merge the sequences of the subtrees by rank. As each of them is sorted already, a stable sort keeps the order
+  // within each of them.
+  auto modules = std::vector<Module>{};
+  for (const auto& [child_idx, selectivity] : adjacency[vertex_idx]) {
+    if (child_idx == parent_idx) continue;
+    auto child_modules = linearize_subtree(adjacency, cardinalities, child_idx, vertex_idx, selectivity);
+    std::move(child_modules.begin(), child_modules.end(), std::back_inserter(modules));
+  }
+  std::stable_sort(modules.begin(), modules.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.rank() < rhs.rank(); });
+
+  // Normalize: the vertex has to be joined before the vertices below it. If it has a higher rank than the modules that
+  // follow it, it is combined with them.
+  const auto t = cardinalities[vertex_idx] * parent_selectivity;
+  auto module = Module{t, t, {vertex_idx}};
+  auto module_iter = modules.begin();
+  while (module_iter != modules.end() && module.rank() > module_iter->rank()) {
+    module.append(*module_iter);
+    ++module_iter;
+  }
+
+  auto result = std::vector<Module>{std::move(module)};
+  std::move(module_iter, modules.end(), std::back_inserter(result));
+  return result;
+}
+
+// Sum of the intermediate cardinalities of the left-deep plan that joins the vertices in @param order
+double c_out(const TreeAdjacency& adjacency, const std::vector<double>& cardinalities,
+             const std::vector<size_t>& order) {
+  auto joined_vertices = std::vector<bool>(cardinalities.size());
+  joined_vertices[order.front()] = true;
+
+  auto cardinality = cardinalities[order.front()];
+  auto cost = 0.0;
+  for (auto order_idx = size_t{1}; order_idx < order.size(); ++order_idx) {
+    const auto vertex_idx = order[order_idx];
+    cardinality *= cardinalities[vertex_idx];
+    for (const auto& [neighbor_idx, selectivity] : adjacency[vertex_idx]) {
+      if (joined_vertices[neighbor_idx]) cardinality *= selectivity;
+    }
+    joined_vertices[vertex_idx] = true;
+    cost += cardinality;
+  }
+  return cost;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+  const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+
+  /**
+   * 1. Add the local predicates on top of the vertices and collect the uncorrelated predicates, which are placed on top
+   *    of the final plan.
+   */
+  auto vertex_plans = std::vector<std::shared_ptr<AbstractLQPNode>>(vertex_count);
+  auto cardinalities = std::vector<double>(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    vertex_plans[vertex_idx] = _add_predicates_to_plan(join_graph.vertices[vertex_idx],
+                                                       join_graph.find_local_predicates(vertex_idx), cost_estimator);
+    cardinalities[vertex_idx] = cardinality_estimator->estimate_cardinality(vertex_plans[vertex_idx]);
+  }
+
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  /**
+   * 2. Estimate the selectivity of each binary edge. The statistics of the two-vertex joins remain in the
+   *    JoinGraphStatisticsCache and are reused when the DP below builds the same joins.
+   */
+  auto neighborhoods = std::vector<JoinGraphVertexSet>(vertex_count, JoinGraphVertexSet{vertex_count});
+  auto binary_edges = std::vector<std::tuple<size_t, size_t, double>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+    neighborhoods[first_vertex_idx].set(second_vertex_idx);
+    neighborhoods[second_vertex_idx].set(first_vertex_idx);
+
+    const auto join_plan = _add_join_to_plan(vertex_plans[first_vertex_idx], vertex_plans[second_vertex_idx],
+                                             edge.predicates, cost_estimator);
+    const auto input_cardinality = cardinalities[first_vertex_idx] * cardinalities[second_vertex_idx];
+    const auto selectivity =
+        input_cardinality > 0.0 ? cardinality_estimator->estimate_cardinality(join_plan) / input_cardinality : 1.0;
+    binary_edges.emplace_back(first_vertex_idx, second_vertex_idx, selectivity);
+  }
+
+  /**
+   * 3. Reduce the join graph to its minimum spanning tree w.r.t. the selectivities (Prim's algorithm), so that the most
+   *    selective joins are kept for the linearization.
+   */
+  auto tree_edges = std::vector<std::tuple<size_t, size_t, double>>{};
+  auto tree_vertices = JoinGraphVertexSet{vertex_count};
+  tree_vertices.set(0);
+  while (tree_edges.size() + 1 < vertex_count) {
+    auto best_edge = std::optional<std::tuple<size_t, size_t, double>>{};
+    for (const auto& edge : binary_edges) {
+      const auto& [first_vertex_idx, second_vertex_idx, selectivity] = edge;
+      if (tree_vertices.test(first_vertex_idx) == tree_vertices.test(second_vertex_idx)) continue;
+      if (!best_edge || selectivity < std::get<2>(*best_edge)) best_edge = edge;
+    }
+    Assert(best_edge, "JoinGraph is not connected by binary edges");
+
+    tree_vertices.set(std::get<0>(*best_edge));
+    tree_vertices.set(std::get<1>(*best_edge));
+    tree_edges.emplace_back(*best_edge);
+  }
+
+  const auto order = linearize(cardinalities, tree_edges);
+
+  /**
+   * 4. DP over the subchains of the order: The best plan for the subchain [begin, end] is the cheapest join of the best
+   *    plans for [begin, split] and [split + 1, end] that are connected by an edge. Every prefix of the order is
+   *    connected, so that there is a plan for the entire chain.
+   */
+  auto vertex_sets = std::vector<std::vector<JoinGraphVertexSet>>(vertex_count);
+  auto subchain_neighborhoods = std::vector<std::vector<JoinGraphVertexSet>>(vertex_count);
+  auto best_plans = std::vector<std::vector<std::shared_ptr<AbstractLQPNode>>>(vertex_count);
+  auto best_plan_costs = std::vector<std::vector<Cost>>(vertex_count);
+  for (auto begin = size_t{0}; begin < vertex_count; ++begin) {
+    vertex_sets[begin].resize(vertex_count, JoinGraphVertexSet{vertex_count});
+    subchain_neighborhoods[begin].resize(vertex_count, JoinGraphVertexSet{vertex_count});
+    best_plans[begin].resize(vertex_count);
+    best_plan_costs[begin].resize(vertex_count);
+
+    for (auto end = begin; end < vertex_count; ++end) {
+      if (end > begin) {
+        vertex_sets[begin][end] = vertex_sets[begin][end - 1];
+        subchain_neighborhoods[begin][end] = subchain_neighborhoods[begin][end - 1];
+      }
+      vertex_sets[begin][end].set(order[end]);
+      subchain_neighborhoods[begin][end] |= neighborhoods[order[end]];
+    }
+
+    best_plans[begin][begin] = vertex_plans[order[begin]];
+    best_plan_costs[begin][begin] = cost_estimator->estimate_plan_cost(best_plans[begin][begin]);
+  }
+
+  for (auto length = size_t{2}; length <= vertex_count; ++length) {
+    for (auto begin = size_t{0}; begin + length <= vertex_count; ++begin) {
+      const auto end = begin + length - 1;
+
+      for (auto split = begin; split < end; ++split) {
+        const auto& left_plan = best_plans[begin][split];
+        const auto& right_plan = best_plans[split + 1][end];
+        if (!left_plan || !right_plan) continue;
+
+        const auto& left_vertex_set = vertex_sets[begin][split];
+        const auto& right_vertex_set = vertex_sets[split + 1][end];
+        if ((subchain_neighborhoods[begin][split] & right_vertex_set).none()) continue;
+
+        const auto join_predicates = join_graph.find_join_predicates(left_vertex_set, right_vertex_set);
+        const auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, cost_estimator);
+        const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_plan);
+
+        if (!best_plans[begin][end] || candidate_cost < best_plan_costs[begin][end]) {
+          best_plans[begin][end] = candidate_plan;
+          best_plan_costs[begin][end] = candidate_cost;
+        }
+      }
+    }
+  }
+
+  const auto& result_plan = best_plans.front().back();
+  Assert(result_plan, "No plan for all vertices generated, the linearization is not connected");
+
+  return _add_predicates_to_plan(result_plan, uncorrelated_predicates, cost_estimator);
+}
+
+std::vector<size_t> LinearizedDp::linearize(const std::vector<double>& cardinalities,
+                                            const std::vector<std::tuple<size_t, size_t, double>>& tree_edges) {
+  const auto vertex_count = cardinalities.size();
+  Assert(tree_edges.size() + 1 == vertex_count, "Expected a spanning tree");
+
+  auto adjacency = TreeAdjacency(vertex_count);
+  for (const auto& [first_vertex_idx, second_vertex_idx, selectivity] : tree_edges) {
+    adjacency[first_vertex_idx].emplace_back(second_vertex_idx, selectivity);
+    adjacency[second_vertex_idx].emplace_back(first_vertex_idx, selectivity);
+  }
+
+  // Linearize the tree for each possible root and keep the cheapest order
+  auto best_order = std::vector<size_t>{};
+  auto best_cost = std::numeric_limits<double>::infinity();
+  for (auto root_idx = size_t{0}; root_idx < vertex_count; ++root_idx) {
+    const auto modules = linearize_subtree(adjacency, cardinalities, root_idx, root_idx, 1.0);
+
+    // The root is always joined first, even if it was combined with other modules
+    auto order = std::vector<size_t>{};
+    order.reserve(vertex_count);
+    for (const auto& module : modules) {
+      order.insert(order.end(), module.vertices.begin(), module.vertices.end());
+    }
+
+    const auto cost = c_out(adjacency, cardinalities, order);
+    if (best_order.empty() || cost < best_cost) {
+      best_order = std::move(order);
+      best_cost = cost;
+    }
+  }
+
+  return best_order;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for join graphs that are too large for DpCcp, described in "Adaptive Optimization of Very
+ * Large Join Queries" (Neumann and Radke, SIGMOD 2018).
+ *
+ * 1. The vertices are brought into a linear order using IKKBZ ("Optimization of Nonrecursive Queries", Krishnamurthy
+ *    et al., VLDB 1986). IKKBZ finds the optimal left-deep plan without cross products for acyclic join graphs under
+ *    the C_out cost function (i.e., the sum of intermediate cardinalities) in polynomial time. Cyclic join graphs are
+ *    reduced to the minimum spanning tree w.r.t. the join selectivities.
+ * 2. DP over the linear order: The best (bushy) plan is searched among the plans that join subchains of the order.
+ *    This considers O(n^3) candidate plans instead of the exponentially many considered by DpCcp, while a good order
+ *    keeps the relations that should be joined early close to each other.
+ *
+ * Like DpCcp, only binary edges connect subplans (hyperedges are applied once all their vertices are joined) and local
+ * predicates are pushed down.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+  /**
+   * IKKBZ linearization of a join tree. @param cardinalities are the cardinalities of the vertices, @param tree_edges
+   * the edges (vertex indices and selectivity) of a spanning tree. Returns the order of the vertex indices with the
+   * lowest C_out cost, which starts with the best root of the tree.
+   */
+  static std::vector<size_t> linearize(const std::vector<double>& cardinalities,
+                                       const std::vector<std::tuple<size_t, size_t, double>>& tree_edges);
+};
+
+}  // namespace opossum
@@ -1,32 +1,57 @@
 #include "optimizer.hpp"
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_set>
 
+#include "cost_estimation/cost_estimator_calibrated.hpp"
 #include "cost_estimation/cost_estimator_logical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "strategy/between_composition_rule.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
+#include "strategy/common_subexpression_elimination_rule.hpp"
 #include "strategy/dependent_group_by_reduction_rule.hpp"
+#include "strategy/eager_aggregation_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
 #include "strategy/in_expression_rewrite_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
+#include "strategy/join_elimination_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/join_predicate_ordering_rule.hpp"
+#include "strategy/limit_pushdown_rule.hpp"
+#include "strategy/materialized_view_rewrite_rule.hpp"
 #include "strategy/null_scan_removal_rule.hpp"
 #include "strategy/predicate_merge_rule.hpp"
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/runtime_join_filter_rule.hpp"
 #include "strategy/semi_join_reduction_rule.hpp"
 #include "strategy/stored_table_column_alignment_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::shared_ptr<Optimizer> make_optimizer() {
+  if (const auto& cost_model_coefficients = Hyrise::get().cost_model_coefficients) {
+    return std::make_shared<Optimizer>(
+        std::make_shared<CostEstimatorCalibrated>(std::make_shared<CardinalityEstimator>(), cost_model_coefficients));
+  }
+  return std::make_shared<Optimizer>();
+}
+
+}  // namespace
+
 namespace opossum {
 
 /**
@@ -35,7 +60,10 @@ namespace opossum {
  * optimization costs reasonable.
  */
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
-  auto optimizer = std::make_shared<Optimizer>();
+  auto optimizer = make_optimizer();
+
+  // Run first, as the aggregates are matched against the unoptimized plans of the materialized views
+  optimizer->add_rule(std::make_unique<MaterializedViewRewriteRule>());
 
   optimizer->add_rule(std::make_unique<ExpressionReductionRule>());
 
@@ -57,7 +85,8 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicatePlacementRule>());
 
-  optimizer->add_rule(std::make_unique<PredicateSplitUpRule>());
+  // Disjunctions of column predicates are kept, as the TableScan evaluates them faster than UnionNodes would
+  optimizer->add_rule(std::make_unique<PredicateSplitUpRule>(true, false));
 
   optimizer->add_rule(std::make_unique<NullScanRemovalRule>());
 
@@ -68,6 +97,15 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // which does not like semi joins (see above).
   optimizer->add_rule(std::make_unique<ColumnPruningRule>());
 
+  // Run the JoinEliminationRule after the ColumnPruningRule, which turns inner joins with a unique input into semi
+  // joins that are removed if they follow a foreign key. Run it before the SemiJoinReductionRule, which should not
+  // create reductions for joins that are removed anyway.
+  optimizer->add_rule(std::make_unique<JoinEliminationRule>());
+
+  // Push aggregates below joins once the remaining joins are known. The SemiJoinReductionRule afterwards also reduces
+  // the inputs of the added partial aggregates.
+  optimizer->add_rule(std::make_unique<EagerAggregationRule>());
+
   optimizer->add_rule(std::make_unique<SemiJoinReductionRule>());
 
   // Run the PredicatePlacementRule a second time so that semi/anti joins created by the SubqueryToJoinRule and the
@@ -76,6 +114,10 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<JoinPredicateOrderingRule>());
 
+  // Push limits down once the joins and predicates are placed. Outer joins that the JoinEliminationRule removes do
+  // not need a limit on their input.
+  optimizer->add_rule(std::make_unique<LimitPushdownRule>());
+
   // Prune chunks after the BetweenCompositionRule ran, as `a >= 5 AND a <= 7` may not be prunable predicates while
   // `a BETWEEN 5 and 7` is. Also, run it after the PredicatePlacementRule, so that predicates are as close to the
   // StoredTableNode as possible where the ChunkPruningRule can work with them.
@@ -90,6 +132,10 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // Bring predicates into the desired order once the PredicatePlacementRule has positioned them as desired
   optimizer->add_rule(std::make_unique<PredicateReorderingRule>());
 
+  // Decide which semi join reductions become runtime filters once they are placed and ordered. Run it after the
+  // ChunkPruningRule, so that the estimated reducer cardinalities take the pruned chunks into account.
+  optimizer->add_rule(std::make_unique<RuntimeJoinFilterRule>());
+
   // Before the IN predicate is rewritten, it should have been moved to a good position. Also, while the IN predicate
   // might become a join, it is semantically more similar to a predicate. If we run this rule too early, it might
   // hinder other optimizations that stop at joins. For example, the join ordering currently does not know about semi
@@ -100,9 +146,81 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run last, as the inserted ProjectionNodes would stop the rules that move predicates
+  optimizer->add_rule(std::make_unique<CommonSubexpressionEliminationRule>());
+
+  optimizer->set_simple_statement_optimizer(create_simple_statement_optimizer());
+
+  return optimizer;
+}
+
+std::shared_ptr<Optimizer> Optimizer::create_simple_statement_optimizer() {
+  auto optimizer = make_optimizer();
+
+  optimizer->add_rule(std::make_unique<ExpressionReductionRule>());
+
+  // Disjunctions are not split, as the resulting UnionNodes would need the PredicateMergeRule to be merged again
+  optimizer->add_rule(std::make_unique<PredicateSplitUpRule>(false));
+
+  optimizer->add_rule(std::make_unique<BetweenCompositionRule>());
+
+  optimizer->add_rule(std::make_unique<ColumnPruningRule>());
+
+  optimizer->add_rule(std::make_unique<ChunkPruningRule>());
+
+  optimizer->add_rule(std::make_unique<PredicateReorderingRule>());
+
+  optimizer->add_rule(std::make_unique<InExpressionRewriteRule>());
+
+  // Point lookups benefit the most from index scans
+  optimizer->add_rule(std::make_unique<IndexScanRule>());
+
   return optimizer;
 }
 
+bool Optimizer::is_simple_statement(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto is_simple = true;
+  auto table_name = std::optional<std::string>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::StoredTable: {
+        // UPDATE statements read their table twice
+        const auto& stored_table_name = static_cast<const StoredTableNode&>(*node).table_name;
+        if (table_name && *table_name != stored_table_name) is_simple = false;
+        table_name = stored_table_name;
+      } break;
+
+      case LQPNodeType::Alias:
+      case LQPNodeType::Delete:
+      case LQPNodeType::DummyTable:
+      case LQPNodeType::Insert:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StaticTable:
+      case LQPNodeType::Update:
+      case LQPNodeType::Validate:
+        break;
+
+      default:
+        is_simple = false;
+    }
+
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSubquery) is_simple = false;
+        return is_simple ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+
+    return is_simple ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return is_simple;
+}
+
 Optimizer::Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator) : _cost_estimator(cost_estimator) {}
 
 void Optimizer::add_rule(std::unique_ptr<AbstractRule> rule) {
@@ -110,6 +228,10 @@ void Optimizer::add_rule(std::unique_ptr<AbstractRule> rule) {
   _rules.emplace_back(std::move(rule));
 }
 
+void Optimizer::set_simple_statement_optimizer(const std::shared_ptr<Optimizer>& simple_statement_optimizer) {
+  _simple_statement_optimizer = simple_statement_optimizer;
+}
+
 std::shared_ptr<AbstractLQPNode> Optimizer::optimize(
     std::shared_ptr<AbstractLQPNode> input,
     const std::shared_ptr<std::vector<OptimizerRuleMetrics>>& rule_durations) const {
@@ -119,6 +241,10 @@ std::shared_ptr<AbstractLQPNode> Optimizer::optimize(
   // optimized plan.
   Assert(input.use_count() == 1, "Optimizer should have exclusive ownership of plan");
 
+  if (_simple_statement_optimizer && is_simple_statement(input)) {
+    return _simple_statement_optimizer->optimize(std::move(input), rule_durations);
+  }
+
   // Add explicit root node, so the rules can freely change the tree below it without having to maintain a root node
   // to return to the Optimizer
   const auto root_node = LogicalPlanRootNode::make(std::move(input));
@@ -231,6 +357,7 @@ void Optimizer::validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node)
         case LQPNodeType::Root:
         case LQPNodeType::Sort:
         case LQPNodeType::Validate:
+        case LQPNodeType::Window:
           num_expected_inputs = 1;
           break;
 
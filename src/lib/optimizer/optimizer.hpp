@@ -29,6 +29,17 @@ class Optimizer final {
  public:
   static std::shared_ptr<Optimizer> create_default_optimizer();
 
+  // Creates the Optimizer with the few rules that apply to simple statements (see is_simple_statement). The default
+  // optimizer uses it for these statements.
+  static std::shared_ptr<Optimizer> create_simple_statement_optimizer();
+
+  /**
+   * Returns whether @param lqp is a simple statement, such as a point lookup or an INSERT of a few rows. Simple
+   * statements read at most one table and have no joins, aggregates, set operations, or subqueries. Most rules have
+   * nothing to do for them, but applying all of them can take longer than executing the statement.
+   */
+  static bool is_simple_statement(const std::shared_ptr<AbstractLQPNode>& lqp);
+
   explicit Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator =
                          std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()));
 
@@ -37,6 +48,11 @@ class Optimizer final {
    */
   void add_rule(std::unique_ptr<AbstractRule> rule);
 
+  /**
+   * If set, simple statements are optimized by @param simple_statement_optimizer instead of the Optimizer's own rules
+   */
+  void set_simple_statement_optimizer(const std::shared_ptr<Optimizer>& simple_statement_optimizer);
+
   /**
    * Returns optimized version of @param input.
    * @param rule_durations may be set in order to retrieve runtime information for each applied rule.
@@ -50,6 +66,7 @@ class Optimizer final {
  private:
   std::vector<std::unique_ptr<AbstractRule>> _rules;
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+  std::shared_ptr<Optimizer> _simple_statement_optimizer;
 };
 
 }  // namespace opossum
@@ -6,6 +6,10 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -13,8 +17,6 @@
 #include "lossless_cast.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
-#include "statistics/statistics_objects/min_max_filter.hpp"
-#include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -81,6 +83,12 @@ void ChunkPruningRule::_apply_to_plan_without_subqueries(const std::shared_ptr<A
 
 std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, const AbstractExpression& predicate,
                                                           const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  if (predicate.type == ExpressionType::Predicate) {
+    if (const auto* in_expression = dynamic_cast<const InExpression*>(&predicate)) {
+      return _compute_in_list_exclude_list(table, *in_expression, stored_table_node);
+    }
+  }
+
   // Hacky:
   // `table->table_statistics()` contains AttributeStatistics for all columns, even those that are pruned in
   // `stored_table_node`.
@@ -138,11 +146,11 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
       const auto chunk = table.get_chunk(chunk_id);
       if (!chunk) continue;
 
+      // The partition of a chunk also rules out values of mutable chunks, which have no pruning statistics
       const auto pruning_statistics = chunk->pruning_statistics();
-      if (!pruning_statistics) continue;
-
-      const auto segment_statistics = (*pruning_statistics)[operator_predicate.column_id];
-      if (_can_prune(*segment_statistics, condition, *value, value2)) {
+      if (chunk->partition_does_not_contain(operator_predicate.column_id, condition, *value, value2) ||
+          (pruning_statistics &&
+           _can_prune(*(*pruning_statistics)[operator_predicate.column_id], condition, *value, value2))) {
         const auto& already_pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
         if (std::find(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), chunk_id) ==
             already_pruned_chunk_ids.end()) {
@@ -167,36 +175,51 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
   return result;
 }
 
-bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
-                                  const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
-                                  const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
+std::set<ChunkID> ChunkPruningRule::_compute_in_list_exclude_list(
+    const Table& table, const InExpression& in_expression, const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  if (in_expression.is_negated() || in_expression.set()->type != ExpressionType::List) return {};
 
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(in_expression.value());
+  if (!column_expression || column_expression->original_node.lock() != stored_table_node) return {};
+  const auto column_id = column_expression->original_column_id;
+  const auto column_data_type = table.column_data_type(column_id);
 
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+  // As above, values that cannot be converted losslessly prevent pruning. NULLs never match, so they are skipped.
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& element : static_cast<const ListExpression&>(*in_expression.set()).elements()) {
+    if (element->type != ExpressionType::Value) return {};
 
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
-    }
+    const auto& value = static_cast<const ValueExpression&>(*element).value;
+    if (variant_is_null(value)) continue;
 
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
-    }
-  });
+    const auto converted_value = lossless_variant_cast(value, column_data_type);
+    if (!converted_value) return {};
+    values.emplace_back(*converted_value);
+  }
+
+  std::set<ChunkID> result;
 
-  return can_prune;
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto pruning_statistics = chunk->pruning_statistics();
+    const auto contains_none = std::all_of(values.cbegin(), values.cend(), [&](const auto& value) {
+      return chunk->partition_does_not_contain(column_id, PredicateCondition::Equals, value) ||
+             (pruning_statistics &&
+              _can_prune(*(*pruning_statistics)[column_id], PredicateCondition::Equals, value, std::nullopt));
+    });
+    if (contains_none) result.insert(chunk_id);
+  }
+
+  return result;
+}
+
+bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
+                                  const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                  const std::optional<AllTypeVariant>& variant_value2) {
+  return base_segment_statistics.does_not_contain(predicate_condition, variant_value, variant_value2);
 }
 
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) {
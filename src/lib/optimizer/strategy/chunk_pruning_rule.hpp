@@ -15,6 +15,7 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class AbstractExpression;
+class InExpression;
 class StoredTableNode;
 class PredicateNode;
 class Table;
@@ -22,7 +23,8 @@ class Table;
 /**
  * This rule determines which chunks can be pruned from table scans based on
  * the predicates present in the LQP and stores that information in the stored
- * table nodes.
+ * table nodes. Chunks are pruned using their pruning statistics and, for
+ * partitioned tables, the bounds of their partition (see TablePartitioning).
  */
 class ChunkPruningRule : public AbstractRule {
  protected:
@@ -31,6 +33,11 @@ class ChunkPruningRule : public AbstractRule {
   static std::set<ChunkID> _compute_exclude_list(const Table& table, const AbstractExpression& predicate,
                                                  const std::shared_ptr<StoredTableNode>& stored_table_node);
 
+  // Prunes the chunks that contain none of the values of `column IN (value, ...)`. The table statistics are not
+  // updated, as they cannot represent an IN predicate.
+  static std::set<ChunkID> _compute_in_list_exclude_list(const Table& table, const InExpression& in_expression,
+                                                         const std::shared_ptr<StoredTableNode>& stored_table_node);
+
   // Check whether any of the statistics objects available for this Segment identify the predicate as prunable
   static bool _can_prune(const BaseAttributeStatistics& base_segment_statistics,
                          const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
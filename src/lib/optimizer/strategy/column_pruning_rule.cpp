@@ -115,6 +115,14 @@ ExpressionUnorderedSet gather_locally_required_expressions(
       }
     } break;
 
+    // For window nodes, we need the arguments of the window function, i.e., its argument and the PARTITION BY and ORDER
+    // BY expressions
+    case LQPNodeType::Window: {
+      for (const auto& argument : node->node_expressions[0]->arguments) {
+        locally_required_expressions.emplace(argument);
+      }
+    } break;
+
     // For ProjectionNodes, collect all expressions that
     //   (1) were already computed and are re-used as arguments in this projection
     //   (2) cannot be computed (i.e., Aggregate and LQPColumn inputs)
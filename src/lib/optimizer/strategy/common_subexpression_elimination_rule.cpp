@@ -0,0 +1,103 @@
+#include "common_subexpression_elimination_rule.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_shareable_computation(const std::shared_ptr<AbstractExpression>& expression) {
+  switch (expression->type) {
+    case ExpressionType::Arithmetic:
+    case ExpressionType::Case:
+    case ExpressionType::Cast:
+    case ExpressionType::Extract:
+    case ExpressionType::Function:
+    case ExpressionType::UnaryMinus:
+      break;
+    default:
+      return false;
+  }
+
+  auto contains_subquery = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::LQPSubquery) contains_subquery = true;
+    return contains_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return !contains_subquery;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void CommonSubexpressionEliminationRule::_apply_to_plan_without_subqueries(
+    const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  auto projection_nodes = std::vector<std::shared_ptr<ProjectionNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Projection) {
+      projection_nodes.emplace_back(std::static_pointer_cast<ProjectionNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& projection_node : projection_nodes) {
+    _share_with_predicates(projection_node);
+  }
+}
+
+void CommonSubexpressionEliminationRule::_share_with_predicates(const std::shared_ptr<ProjectionNode>& projection_node) {
+  // The chain of predicates directly below the projection, from top to bottom. Predicates with other outputs would
+  // compute the shared columns for those outputs, too.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto node = projection_node->left_input();
+  while (node->type == LQPNodeType::Predicate && node->output_count() == 1 &&
+         static_cast<const PredicateNode&>(*node).scan_type == ScanType::TableScan) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(node));
+    node = node->left_input();
+  }
+  if (predicate_nodes.empty()) return;
+
+  // The computations of the projection that its input does not provide yet, e.g., if the rule ran before
+  const auto& input_node = projection_node->left_input();
+  auto computed_expressions = ExpressionUnorderedSet{};
+  for (const auto& expression : projection_node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (input_node->find_column_id(*sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+      if (is_shareable_computation(sub_expression)) computed_expressions.emplace(sub_expression);
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+  if (computed_expressions.empty()) return;
+
+  // Find the outermost computations in the predicates and the lowest predicate that uses one of them
+  auto shared_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto shared_expression_set = ExpressionUnorderedSet{};
+  auto lowest_predicate_node = std::shared_ptr<PredicateNode>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto& predicate = predicate_node->predicate();
+    visit_expression(predicate, [&](const auto& sub_expression) {
+      if (sub_expression == predicate || !computed_expressions.contains(sub_expression)) {
+        return ExpressionVisitation::VisitArguments;
+      }
+
+      if (shared_expression_set.emplace(sub_expression).second) shared_expressions.emplace_back(sub_expression);
+      lowest_predicate_node = predicate_node;
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+  if (!lowest_predicate_node) return;
+
+  // Predicates do not change the columns, so all shared expressions can be evaluated below the lowest predicate
+  auto expressions = lowest_predicate_node->left_input()->output_expressions();
+  expressions.insert(expressions.end(), shared_expressions.begin(), shared_expressions.end());
+  lqp_insert_node(lowest_predicate_node, LQPInputSide::Left, ProjectionNode::make(expressions));
+}
+
+}  // namespace opossum
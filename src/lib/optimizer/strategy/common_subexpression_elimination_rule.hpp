@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class ProjectionNode;
+
+/**
+ * Computes subexpressions that a ProjectionNode shares with the predicates directly below it only once. E.g., in
+ * `SELECT a * b, a * b + c FROM t WHERE a * b > 5`, both the TableScan and the Projection would evaluate `a * b`.
+ * Instead, a ProjectionNode that adds `a * b` to the columns of its input is inserted below the lowest of these
+ * PredicateNodes. The LQPTranslator resolves `a * b` in the predicates and in the original ProjectionNode to the
+ * column computed by the new node, so that the predicate becomes a simple column scan.
+ *
+ * Only arithmetic expressions, functions, casts, CASE, EXTRACT, and unary minus are shared, as predicates cannot
+ * scan boolean columns. Subexpressions with subqueries are not moved. Shared subexpressions within a Projection,
+ * like in the example above, are handled by the ExpressionEvaluator (see find_common_subexpressions()).
+ */
+class CommonSubexpressionEliminationRule : public AbstractRule {
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+
+ private:
+  static void _share_with_predicates(const std::shared_ptr<ProjectionNode>& projection_node);
+};
+
+}  // namespace opossum
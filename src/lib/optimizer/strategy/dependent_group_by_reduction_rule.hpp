@@ -37,7 +37,7 @@ class StoredTableNode;
  * ANY() selects "any" value from the list of values per group (since we group by the functional dependency's
  * determinant column(s) in this case the group is ensured to be of size one). This rule implements choke point 1.4 of
  * "TPC-H Analyzed: Hidden Messages and Lessons Learned from an Influential Benchmark" (Boncz et al.).
- * However, not all queries listed in the paper can be optimized yet, since Hyrise lacks foreign key support.
+ * However, not all queries listed in the paper can be optimized yet, since this rule does not use foreign keys.
  */
 class DependentGroupByReductionRule : public AbstractRule {
  protected:
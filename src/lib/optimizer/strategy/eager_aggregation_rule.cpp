@@ -0,0 +1,237 @@
+#include "eager_aggregation_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+
+namespace {
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+using Expressions = std::vector<std::shared_ptr<AbstractExpression>>;
+
+// Adds the expression unless an equal one was added before and returns the added one
+const std::shared_ptr<AbstractExpression>& add_unique(Expressions& expressions,
+                                                      const std::shared_ptr<AbstractExpression>& expression) {
+  for (const auto& added_expression : expressions) {
+    if (*added_expression == *expression) return added_expression;
+  }
+  return expressions.emplace_back(expression);
+}
+
+// Tries to push a partial aggregate into the given input of the join. Returns false if the plan is not changed.
+bool push_aggregate(const std::shared_ptr<AbstractLQPNode>& lqp_root,
+                    const std::shared_ptr<AggregateNode>& aggregate_node,
+                    const std::shared_ptr<AbstractLQPNode>& projection_node,
+                    const std::shared_ptr<JoinNode>& join_node, const LQPInputSide side,
+                    const AbstractCardinalityEstimator& cardinality_estimator) {
+  const auto pushed_input = join_node->input(side);
+  const auto other_input = join_node->input(side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left);
+
+  // Each row of the pushed input must join with at most one row of the other input
+  auto pushed_keys = Expressions{};
+  auto other_keys = ExpressionUnorderedSet{};
+  for (const auto& join_predicate : join_node->join_predicates()) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+    auto pushed_key = predicate->left_operand();
+    auto other_key = predicate->right_operand();
+    if (!pushed_input->has_output_expressions({pushed_key})) std::swap(pushed_key, other_key);
+    if (!pushed_input->has_output_expressions({pushed_key}) || !other_input->has_output_expressions({other_key})) {
+      return false;
+    }
+    add_unique(pushed_keys, pushed_key);
+    other_keys.emplace(other_key);
+  }
+  if (!other_input->has_matching_unique_constraint(other_keys)) return false;
+
+  // The partial aggregate groups by the join keys and the group-by expressions that the pushed input provides
+  const auto& node_expressions = aggregate_node->node_expressions;
+  const auto aggregates_begin = node_expressions.begin() + aggregate_node->aggregate_expressions_begin_idx;
+  const auto group_by_expressions = Expressions{node_expressions.begin(), aggregates_begin};
+  auto partial_group_by_expressions = pushed_keys;
+  for (const auto& group_by_expression : group_by_expressions) {
+    if (other_input->has_output_expressions({group_by_expression})) continue;
+    if (!expression_evaluable_on_lqp(group_by_expression, *pushed_input)) return false;
+    add_unique(partial_group_by_expressions, group_by_expression);
+  }
+
+  // For each aggregate, the partial aggregates and the expression that computes the aggregate from the merged partials
+  auto partial_aggregate_expressions = Expressions{};
+  auto merged_aggregate_expressions = Expressions{};
+  auto final_aggregate_expressions = Expressions{};
+  auto arguments = Expressions{};
+  auto merge = [&](const AggregateFunction partial_function, const std::shared_ptr<AbstractExpression>& argument,
+                   const AggregateFunction merge_function) {
+    const auto& partial = add_unique(
+        partial_aggregate_expressions,
+        argument ? std::make_shared<AggregateExpression>(partial_function, argument) : count_star_(pushed_input));
+    return add_unique(merged_aggregate_expressions, std::make_shared<AggregateExpression>(merge_function, partial));
+  };
+
+  auto has_average = false;
+  for (auto aggregate_iter = aggregates_begin; aggregate_iter != node_expressions.end(); ++aggregate_iter) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(**aggregate_iter);
+    if (AggregateExpression::is_count_star(aggregate_expression)) {
+      final_aggregate_expressions.emplace_back(merge(AggregateFunction::Count, nullptr, AggregateFunction::Sum));
+      continue;
+    }
+
+    const auto argument = aggregate_expression.argument();
+    if (!expression_evaluable_on_lqp(argument, *pushed_input)) return false;
+    add_unique(arguments, argument);
+
+    switch (aggregate_expression.aggregate_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+      case AggregateFunction::Sum:
+        final_aggregate_expressions.emplace_back(merge(aggregate_expression.aggregate_function, argument,
+                                                       aggregate_expression.aggregate_function));
+        break;
+
+      case AggregateFunction::Count:
+        final_aggregate_expressions.emplace_back(merge(AggregateFunction::Count, argument, AggregateFunction::Sum));
+        break;
+
+      case AggregateFunction::Avg: {
+        // SUM() over an empty group is NULL, and the division by a zero COUNT() is NULL as well
+        const auto sum = merge(AggregateFunction::Sum, argument, AggregateFunction::Sum);
+        const auto count = merge(AggregateFunction::Count, argument, AggregateFunction::Sum);
+        final_aggregate_expressions.emplace_back(div_(cast_(sum, DataType::Double), count));
+        has_average = true;
+      } break;
+
+      default:
+        return false;
+    }
+  }
+
+  // Compute the arguments and group-by expressions that are not columns of the pushed input
+  auto partial_input = pushed_input;
+  auto projection_expressions = partial_group_by_expressions;
+  for (const auto& argument : arguments) add_unique(projection_expressions, argument);
+  if (!pushed_input->has_output_expressions(ExpressionUnorderedSet{projection_expressions.begin(),
+                                                                   projection_expressions.end()})) {
+    partial_input = ProjectionNode::make(projection_expressions, pushed_input);
+  }
+
+  const auto partial_aggregate_node =
+      AggregateNode::make(partial_group_by_expressions, partial_aggregate_expressions, partial_input);
+  const auto input_row_count = cardinality_estimator.estimate_cardinality(pushed_input);
+  const auto group_count = cardinality_estimator.estimate_cardinality(partial_aggregate_node);
+  if (group_count > EagerAggregationRule::MAX_GROUP_RATIO * input_row_count) {
+    if (partial_input != pushed_input) partial_input->set_left_input(nullptr);
+    partial_aggregate_node->set_left_input(nullptr);
+    return false;
+  }
+
+  join_node->set_input(side, partial_aggregate_node);
+  if (projection_node) lqp_remove_node(projection_node);
+
+  // Merge the partials. Unless an AVG() needs to be computed, the merged partials are the final aggregates.
+  const auto merged_aggregate_node = AggregateNode::make(group_by_expressions, merged_aggregate_expressions);
+  auto final_node = std::shared_ptr<AbstractLQPNode>{merged_aggregate_node};
+  if (has_average) {
+    auto final_expressions = group_by_expressions;
+    final_expressions.insert(final_expressions.end(), final_aggregate_expressions.begin(),
+                             final_aggregate_expressions.end());
+    final_node = ProjectionNode::make(final_expressions);
+  }
+
+  auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < final_aggregate_expressions.size(); ++aggregate_idx) {
+    expression_mapping.emplace(node_expressions[group_by_expressions.size() + aggregate_idx],
+                               final_aggregate_expressions[aggregate_idx]);
+  }
+
+  lqp_replace_node(aggregate_node, final_node);
+  if (has_average) lqp_insert_node(final_node, LQPInputSide::Left, merged_aggregate_node);
+
+  // The nodes above refer to the output expressions of the original aggregate
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node == final_node) return LQPVisitation::DoNotVisitInputs;
+
+    for (auto& expression : node->node_expressions) {
+      expression_deep_replace(expression, expression_mapping);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void EagerAggregationRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  Assert(lqp_root->type == LQPNodeType::Root, "Rule needs root to hold onto");
+
+  // Aggregates directly above an inner join, possibly with a ProjectionNode that computes their arguments
+  auto candidates = std::vector<std::tuple<std::shared_ptr<AggregateNode>, std::shared_ptr<AbstractLQPNode>,
+                                           std::shared_ptr<JoinNode>>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Aggregate) return LQPVisitation::VisitInputs;
+    const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+    // Without a GROUP BY, the merged COUNT() of an empty input would be NULL
+    if (aggregate_node->aggregate_expressions_begin_idx == 0) return LQPVisitation::VisitInputs;
+
+    auto input = aggregate_node->left_input();
+    auto projection_node = std::shared_ptr<AbstractLQPNode>{};
+    if (input->type == LQPNodeType::Projection && input->outputs().size() == 1) {
+      projection_node = input;
+      input = input->left_input();
+    }
+    if (input->type != LQPNodeType::Join || input->outputs().size() != 1) return LQPVisitation::VisitInputs;
+
+    const auto join_node = std::static_pointer_cast<JoinNode>(input);
+    if (join_node->join_mode != JoinMode::Inner) return LQPVisitation::VisitInputs;
+
+    candidates.emplace_back(aggregate_node, projection_node, join_node);
+    return LQPVisitation::VisitInputs;
+  });
+  if (candidates.empty()) return;
+
+  const auto column_names = [&]() {
+    const auto& top_node = lqp_root->left_input();
+    if (top_node->type == LQPNodeType::Alias) return static_cast<const AliasNode&>(*top_node).aliases;
+
+    auto names = std::vector<std::string>{};
+    for (const auto& expression : top_node->output_expressions()) {
+      names.emplace_back(expression->as_column_name());
+    }
+    return names;
+  };
+  const auto original_column_names = column_names();
+
+  const auto& cardinality_estimator = *cost_estimator->cardinality_estimator;
+  for (const auto& [aggregate_node, projection_node, join_node] : candidates) {
+    for (const auto side : {LQPInputSide::Left, LQPInputSide::Right}) {
+      if (push_aggregate(lqp_root, aggregate_node, projection_node, join_node, side, cardinality_estimator)) break;
+    }
+  }
+
+  // The rewritten aggregates have different column names
+  if (column_names() != original_column_names) {
+    lqp_insert_node(lqp_root, LQPInputSide::Left,
+                    AliasNode::make(lqp_root->left_input()->output_expressions(), original_column_names));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Pushes a partial aggregate below inner joins (eager aggregation). Queries often join a large fact table to small
+ * dimension tables and group by attributes of the dimensions. Instead of joining every row of the fact table, the
+ * fact table is first aggregated by its join keys and by the group-by columns it provides. The join then only emits
+ * one row per partial group, and the original aggregate merges the partials:
+ *   SELECT n_name, SUM(c_acctbal), AVG(c_acctbal) FROM customer, nation WHERE c_nationkey = n_nationkey GROUP BY n_name
+ *     >>>   SELECT n_name, SUM(s), CAST(SUM(s) AS DOUBLE) / SUM(c)
+ *           FROM (SELECT c_nationkey, SUM(c_acctbal) AS s, COUNT(c_acctbal) AS c FROM customer GROUP BY c_nationkey),
+ *             nation WHERE c_nationkey = n_nationkey GROUP BY n_name
+ *
+ * SUM(), MIN(), and MAX() are merged by the same function, COUNT() and COUNT(*) by SUM(), and AVG() is computed from
+ * the SUM() and the COUNT() of its argument. The rewrite is only valid if each row of the pushed side joins with at
+ * most one row of the other side, so the join has to use equi-predicates only, and the columns of the other side have
+ * to be unique (see LQPUniqueConstraint). Moreover, the arguments of the aggregates must be columns of the pushed
+ * side, and the group-by columns must be columns of either side. Each side is tried, the left one first.
+ *
+ * As the partial aggregate is an additional hash aggregation, it is only added if the cardinality estimator expects
+ * it to reduce the rows of the pushed side to at most MAX_GROUP_RATIO of them. Without statistics on the group-by
+ * columns, the estimated group count equals the row count and the plan is not changed.
+ */
+class EagerAggregationRule : public AbstractRule {
+ public:
+  constexpr static auto MAX_GROUP_RATIO = 0.5;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace opossum
@@ -9,12 +9,15 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table/table_index.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -40,6 +43,11 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
         const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
         const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
 
+        if (_is_table_index_scan_applicable(*stored_table_node, predicate_node)) {
+          predicate_node->scan_type = ScanType::IndexScan;
+          return LQPVisitation::VisitInputs;
+        }
+
         const auto indexes_statistics = stored_table_node->indexes_statistics();
         for (const auto& index_statistics : indexes_statistics) {
           if (_is_index_scan_applicable(index_statistics, predicate_node)) {
@@ -57,7 +65,9 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) return false;
 
-  if (index_statistics.type != SegmentIndexType::GroupKey) return false;
+  if (index_statistics.type != SegmentIndexType::GroupKey && index_statistics.type != SegmentIndexType::Hash) {
+    return false;
+  }
 
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
@@ -69,8 +79,56 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
+  // The IndexScan takes its values when it is created, so that it cannot be used for predicates on parameters, e.g.,
+  // in the generic plans of prepared statements (see QueryHandler::bind_prepared_plan)
+  if (is_parameter_id(operator_predicate.value) ||
+      (operator_predicate.value2 && is_parameter_id(*operator_predicate.value2))) {
+    return false;
+  }
+
+  // HashIndexes only answer equality lookups
+  if (index_statistics.type == SegmentIndexType::Hash &&
+      operator_predicate.predicate_condition != PredicateCondition::Equals &&
+      operator_predicate.predicate_condition != PredicateCondition::NotEquals) {
+    return false;
+  }
+
   if (index_statistics.column_ids[0] != operator_predicate.column_id) return false;
 
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const StoredTableNode& stored_table_node,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  if (table->table_indexes().empty()) return false;
+
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates || operator_predicates->size() != 1) return false;
+
+  const auto& operator_predicate = (*operator_predicates)[0];
+
+  // As for the chunk indexes, only predicates on values are supported (see _is_index_scan_applicable)
+  if (!is_variant(operator_predicate.value) ||
+      (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
+    return false;
+  }
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+      stored_table_node.output_expressions()[operator_predicate.column_id]);
+  const auto table_index = table->get_table_index(column_expression->original_column_id);
+  if (!table_index) return false;
+
+  const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+  auto value2 = std::optional<AllTypeVariant>{};
+  if (operator_predicate.value2) value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+  if (!table_index->supports(operator_predicate.predicate_condition, value, value2)) return false;
+
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto row_count_table =
       cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
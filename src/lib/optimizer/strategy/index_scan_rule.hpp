@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -22,7 +23,11 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes and, for (Not)Equals predicates, HashIndexes are supported. The LQPTranslator
+ * prefers HashIndexes where both are applicable.
+ *
+ * TableIndexes of the stored table (see Table::create_table_index) are considered as well. They cover all chunks,
+ * including the mutable ones, and are preferred by the LQPTranslator over the chunk indexes.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -30,6 +35,9 @@ class IndexScanRule : public AbstractRule {
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const StoredTableNode& stored_table_node,
+                                       const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
 };
 
@@ -0,0 +1,217 @@
+#include "join_elimination_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+
+namespace {
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+LQPInputSide opposite_side(const LQPInputSide side) {
+  return side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left;
+}
+
+// Returns the operands of the equi-predicates of the join that are evaluated on the given input
+ExpressionUnorderedSet equals_predicate_expressions(const JoinNode& join_node, const LQPInputSide side) {
+  const auto& input = *join_node.input(side);
+
+  auto expressions = ExpressionUnorderedSet{};
+  for (const auto& join_predicate : join_node.join_predicates()) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    for (const auto& operand : {predicate->left_operand(), predicate->right_operand()}) {
+      if (input.has_output_expressions({operand})) expressions.emplace(operand);
+    }
+  }
+  return expressions;
+}
+
+// Returns the StoredTableNode if the node emits all (visible) rows of a stored table
+std::shared_ptr<StoredTableNode> unfiltered_stored_table_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  const auto& candidate_node = node->type == LQPNodeType::Validate ? node->left_input() : node;
+  if (candidate_node->type != LQPNodeType::StoredTable) return nullptr;
+
+  auto stored_table_node = std::static_pointer_cast<StoredTableNode>(candidate_node);
+  if (!stored_table_node->pruned_chunk_ids().empty()) return nullptr;
+  return stored_table_node;
+}
+
+// Returns whether all predicates of the join are equi-predicates that follow the same foreign key from a stored table
+// of the kept input into the discarded input, which must be an unfiltered stored table.
+bool follows_foreign_key(const JoinNode& join_node, const LQPInputSide discarded_side) {
+  const auto discarded_stored_table_node = unfiltered_stored_table_node(join_node.input(discarded_side));
+  if (!discarded_stored_table_node) return false;
+  const auto& kept_input = *join_node.input(opposite_side(discarded_side));
+
+  auto referencing_stored_table_node = std::shared_ptr<const StoredTableNode>{};
+  auto column_id_pairs = std::vector<std::pair<ColumnID, ColumnID>>{};
+  for (const auto& join_predicate : join_node.join_predicates()) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+    auto kept_column = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->left_operand());
+    auto discarded_column = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->right_operand());
+    if (!kept_column || !discarded_column) return false;
+    if (!kept_input.has_output_expressions({kept_column})) std::swap(kept_column, discarded_column);
+    if (!kept_input.has_output_expressions({kept_column})) return false;
+    if (discarded_column->original_node.lock() != discarded_stored_table_node) return false;
+
+    const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(kept_column->original_node.lock());
+    if (!stored_table_node) return false;
+    if (referencing_stored_table_node && stored_table_node != referencing_stored_table_node) return false;
+    referencing_stored_table_node = stored_table_node;
+
+    column_id_pairs.emplace_back(kept_column->original_column_id, discarded_column->original_column_id);
+  }
+  if (!referencing_stored_table_node) return false;
+
+  // The predicates may follow a subset of the foreign key columns, as the inclusion dependency holds for them, too
+  const auto& table = Hyrise::get().storage_manager.get_table(referencing_stored_table_node->table_name);
+  for (const auto& foreign_key_constraint : table->soft_foreign_key_constraints()) {
+    if (foreign_key_constraint.referenced_table_name() != discarded_stored_table_node->table_name) continue;
+
+    const auto& foreign_key_columns = foreign_key_constraint.foreign_key_columns();
+    const auto& referenced_columns = foreign_key_constraint.referenced_columns();
+    const auto follows_constraint = [&](const auto& column_id_pair) {
+      for (auto column_index = size_t{0}; column_index < foreign_key_columns.size(); ++column_index) {
+        if (foreign_key_columns[column_index] == column_id_pair.first &&
+            referenced_columns[column_index] == column_id_pair.second) {
+          return true;
+        }
+      }
+      return false;
+    };
+    if (std::all_of(column_id_pairs.cbegin(), column_id_pairs.cend(), follows_constraint)) return true;
+  }
+  return false;
+}
+
+// Returns whether an expression of the plan, apart from the predicates of the join, uses the output of the discarded
+// input. Expressions that refer to nodes of the discarded input, e.g., COUNT(*), count as well.
+bool is_used(const std::shared_ptr<AbstractLQPNode>& lqp_root, const std::shared_ptr<JoinNode>& join_node,
+             const std::shared_ptr<AbstractLQPNode>& discarded_input) {
+  const auto discarded_output_expressions = discarded_input->output_expressions();
+  const auto discarded_expressions =
+      ExpressionUnorderedSet{discarded_output_expressions.cbegin(), discarded_output_expressions.cend()};
+  auto discarded_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+  visit_lqp(discarded_input, [&](const auto& node) {
+    discarded_nodes.emplace(node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  auto used = false;
+  const auto visit_expressions = [&](const auto& expressions) {
+    for (const auto& expression : expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (used) return ExpressionVisitation::DoNotVisitArguments;
+
+        if (discarded_expressions.contains(sub_expression)) {
+          used = true;
+        } else if (const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(sub_expression)) {
+          used = discarded_nodes.contains(column_expression->original_node.lock());
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+  };
+
+  visit_expressions(lqp_root->output_expressions());
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (used || node == discarded_input) return LQPVisitation::DoNotVisitInputs;
+    if (node != join_node) visit_expressions(node->node_expressions);
+    return LQPVisitation::VisitInputs;
+  });
+
+  return used;
+}
+
+// Checks the conditions described in the header and removes the join and its discarded input if they are met
+bool try_eliminate_join(const std::shared_ptr<AbstractLQPNode>& lqp_root, const std::shared_ptr<JoinNode>& join_node,
+                        const LQPInputSide discarded_side) {
+  const auto join_mode = join_node->join_mode;
+  const auto& discarded_input = join_node->input(discarded_side);
+  const auto& kept_input = join_node->input(opposite_side(discarded_side));
+
+  if (join_mode != JoinMode::Semi) {
+    const auto expressions = equals_predicate_expressions(*join_node, discarded_side);
+    if (expressions.empty() || !discarded_input->has_matching_unique_constraint(expressions)) return false;
+  }
+
+  const auto needs_foreign_key = join_mode == JoinMode::Semi || join_mode == JoinMode::Inner;
+  if (needs_foreign_key && !follows_foreign_key(*join_node, discarded_side)) return false;
+
+  // The columns of the right input of a semi join are never used
+  if (join_mode != JoinMode::Semi && is_used(lqp_root, join_node, discarded_input)) return false;
+
+  // Rows with NULL keys have no match in the referenced table
+  auto replacement_node = kept_input;
+  if (needs_foreign_key) {
+    for (const auto& expression : equals_predicate_expressions(*join_node, opposite_side(discarded_side))) {
+      if (!kept_input->is_column_nullable(kept_input->get_column_id(*expression))) continue;
+      replacement_node = PredicateNode::make(is_not_null_(expression), replacement_node);
+    }
+  }
+
+  const auto outputs = join_node->outputs();
+  const auto input_sides = join_node->get_input_sides();
+  join_node->set_left_input(nullptr);
+  join_node->set_right_input(nullptr);
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], replacement_node);
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void JoinEliminationRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  Assert(lqp_root->type == LQPNodeType::Root, "JoinEliminationRule needs root to hold onto");
+
+  // Removing joins inside visit_lqp would modify the plan that is being traversed. Thus, the joins are collected first.
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) join_nodes.emplace_back(std::static_pointer_cast<JoinNode>(node));
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& join_node : join_nodes) {
+    // The join was part of the discarded input of another join
+    if (join_node->outputs().empty()) continue;
+
+    switch (join_node->join_mode) {
+      case JoinMode::Left:
+      case JoinMode::Semi:
+        try_eliminate_join(lqp_root, join_node, LQPInputSide::Right);
+        break;
+      case JoinMode::Right:
+        try_eliminate_join(lqp_root, join_node, LQPInputSide::Left);
+        break;
+      case JoinMode::Inner:
+        if (!try_eliminate_join(lqp_root, join_node, LQPInputSide::Right)) {
+          try_eliminate_join(lqp_root, join_node, LQPInputSide::Left);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+}  // namespace opossum
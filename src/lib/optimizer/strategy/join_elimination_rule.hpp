@@ -0,0 +1,32 @@
+#pragma once
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Removes joins that neither add columns that are used later on nor change the rows of the other input. These joins
+ * are common in generated SQL, e.g., when a reporting tool joins all dimension tables of a star schema but only uses
+ * some of them. The discarded input is the one whose columns are not used, and three cases are handled:
+ *
+ * (1) Left (Right) outer joins where the equi-predicate columns of the right (left) input are unique (see
+ *     LQPUniqueConstraint): each row of the other input is emitted exactly once, with or without a match.
+ *       SELECT o_orderkey FROM orders LEFT JOIN customer ON o_custkey = c_custkey   >>>   SELECT o_orderkey FROM orders
+ * (2) Semi joins where the equi-predicates follow a foreign key (see ForeignKeyConstraint) of the left input into an
+ *     unfiltered stored table on the right: each row of the left input has a match, unless its key is NULL.
+ *       SELECT c_name FROM customer WHERE c_nationkey IN (SELECT n_nationkey FROM nation)
+ *         >>>   SELECT c_name FROM customer WHERE c_nationkey IS NOT NULL
+ * (3) Inner joins that satisfy both conditions, i.e., each row of the other input has exactly one match. Most of these
+ *     are rewritten to semi joins by the ColumnPruningRule already.
+ *
+ * For (2) and (3), PredicateNodes that remove the rows with NULL keys are added if the key columns are nullable.
+ * Joins with predicates other than the equi-predicates of the foreign key are only removed in case (1).
+ */
+class JoinEliminationRule : public AbstractRule {
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace opossum
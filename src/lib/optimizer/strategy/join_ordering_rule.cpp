@@ -6,6 +6,7 @@
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "statistics/table_statistics.hpp"
@@ -57,7 +58,8 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
    * Since Join Ordering Algorithms will issue many cost/cardinality estimation requests, caching is crucial to
    * optimization performance.
    * Since JoinOrderingAlgorithms build plans bottom up and are constrained to the predicates and vertices in the
-   * JoinGraph, we can enable the corresponding cache policies.
+   * JoinGraph, we can enable the corresponding cache policies. The same caches are used by all algorithms tried
+   * below, so that a fallback algorithm reuses the estimations of the previous one.
    */
   const auto caching_cost_estimator = cost_estimator->new_instance();
   caching_cost_estimator->guarantee_bottom_up_construction();
@@ -65,18 +67,25 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * DpCcp gives up if the join graph has too many candidate joins. Even chains, which have the fewest candidate joins
+   * of all connected join graphs, exceed the budget from 40 vertices on, so DpCcp is not tried for larger graphs.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  DebugAssert(!join_graph->vertices.empty(), "There should be nodes in the join graph.");
-  if (join_graph->vertices.size() == 1) {
+  const auto vertex_count = join_graph->vertices.size();
+  DebugAssert(vertex_count > 0, "There should be nodes in the join graph.");
+  if (vertex_count == 1) {
     // a join graph with only one vertex is no actual join and needs no ordering
     result_lqp = lqp;
-  } else if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
-    result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    if (vertex_count < 40) {
+      result_lqp = DpCcp{MAX_DP_CCP_CSG_CMP_PAIR_COUNT}(*join_graph, caching_cost_estimator);
+    }
+
+    if (!result_lqp && vertex_count <= MAX_LINEARIZED_DP_VERTEX_COUNT) {
+      result_lqp = LinearizedDp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    } else if (!result_lqp) {
+      result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    }
   }
 
   for (const auto& vertex : join_graph->vertices) {
@@ -10,9 +10,17 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified. The algorithm is chosen adaptively, so that the planning time
+ * stays low for large join graphs (see "Adaptive Optimization of Very Large Join Queries", Neumann and Radke, 2018):
+ *   - DpCcp, which is optimal, as long as the join graph has at most MAX_DP_CCP_CSG_CMP_PAIR_COUNT candidate joins
+ *   - LinearizedDp for join graphs with up to MAX_LINEARIZED_DP_VERTEX_COUNT vertices
+ *   - GreedyOperatorOrdering for even larger join graphs
  */
 class JoinOrderingRule : public AbstractRule {
+ public:
+  static constexpr auto MAX_DP_CCP_CSG_CMP_PAIR_COUNT = size_t{10'000};
+  static constexpr auto MAX_LINEARIZED_DP_VERTEX_COUNT = size_t{100};
+
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
 
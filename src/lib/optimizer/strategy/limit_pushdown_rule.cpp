@@ -0,0 +1,79 @@
+#include "limit_pushdown_rule.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/union_node.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the inputs that emit each of their rows at least once
+std::vector<LQPInputSide> row_preserving_inputs(const AbstractLQPNode& node) {
+  if (node.type == LQPNodeType::Union) {
+    if (static_cast<const UnionNode&>(node).set_operation_mode != SetOperationMode::All) return {};
+    return {LQPInputSide::Left, LQPInputSide::Right};
+  }
+
+  if (node.type == LQPNodeType::Join) {
+    switch (static_cast<const JoinNode&>(node).join_mode) {
+      case JoinMode::Left:
+        return {LQPInputSide::Left};
+      case JoinMode::Right:
+        return {LQPInputSide::Right};
+      case JoinMode::Cross:
+        return {LQPInputSide::Left, LQPInputSide::Right};
+      default:
+        return {};
+    }
+  }
+
+  return {};
+}
+
+}  // namespace
+
+namespace opossum {
+
+void LimitPushdownRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  auto limit_nodes = std::vector<std::shared_ptr<LimitNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Limit) limit_nodes.emplace_back(std::static_pointer_cast<LimitNode>(node));
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& limit_node : limit_nodes) {
+    _push_down(limit_node);
+  }
+}
+
+void LimitPushdownRule::_push_down(const std::shared_ptr<LimitNode>& limit_node) {
+  const auto input_node = limit_node->left_input();
+  if (input_node->output_count() > 1) return;
+
+  if (input_node->type == LQPNodeType::Projection || input_node->type == LQPNodeType::Alias) {
+    lqp_remove_node(limit_node);
+    lqp_insert_node(input_node, LQPInputSide::Left, limit_node);
+    _push_down(limit_node);
+    return;
+  }
+
+  for (const auto side : row_preserving_inputs(*input_node)) {
+    // Do not limit an input twice, e.g., if the rule is applied to the plan again
+    const auto& limited_node = input_node->input(side);
+    if (limited_node->type == LQPNodeType::Limit &&
+        *static_cast<const LimitNode&>(*limited_node).num_rows_expression() == *limit_node->num_rows_expression()) {
+      continue;
+    }
+
+    const auto pushed_limit_node = LimitNode::make(limit_node->num_rows_expression()->deep_copy());
+    lqp_insert_node(input_node, side, pushed_limit_node);
+    _push_down(pushed_limit_node);
+  }
+}
+
+}  // namespace opossum
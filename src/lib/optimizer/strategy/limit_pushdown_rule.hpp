@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class LimitNode;
+
+/**
+ * Pushes LimitNodes towards the StoredTableNodes, so that fewer rows are processed by the operators below the Limit:
+ *
+ * (1) ProjectionNodes and AliasNodes compute their output row by row. The LimitNode is moved below them. This also
+ *     moves the LimitNode next to a SortNode below the SELECT list, which the LQPTranslator turns into a TopK.
+ * (2) UNION ALL, outer joins, and cross joins emit every row of (one of) their inputs at least once. Thus, only the
+ *     first n rows of that input are needed for the first n output rows. A copy of the LimitNode is added to those
+ *     inputs, the original one still limits the output.
+ *
+ * The pushed-down LimitNodes also allow the LQPTranslator to give the operators below a row budget (see
+ * AbstractOperator::row_budget), so that scans stop once they found enough rows. Nodes with multiple outputs are not
+ * passed, as the other outputs need all rows.
+ */
+class LimitPushdownRule : public AbstractRule {
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+
+ private:
+  static void _push_down(const std::shared_ptr<LimitNode>& limit_node);
+};
+
+}  // namespace opossum
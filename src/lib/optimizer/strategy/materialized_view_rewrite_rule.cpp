@@ -0,0 +1,56 @@
+#include "materialized_view_rewrite_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "storage/materialized_view.hpp"
+
+namespace opossum {
+
+void MaterializedViewRewriteRule::_apply_to_plan_without_subqueries(
+    const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  const auto materialized_views = Hyrise::get().storage_manager.materialized_views();
+  if (materialized_views.empty()) return;
+
+  auto aggregate_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Aggregate && node != lqp_root) aggregate_nodes.emplace_back(node);
+    return LQPVisitation::VisitInputs;
+  });
+  if (aggregate_nodes.empty()) return;
+
+  // The aliases of an AliasNode at the top are kept by the rewrite
+  const auto column_names = [&]() {
+    const auto& top_node = lqp_root->left_input();
+    if (top_node->type == LQPNodeType::Alias) return static_cast<const AliasNode&>(*top_node).aliases;
+
+    auto names = std::vector<std::string>{};
+    for (const auto& expression : top_node->output_expressions()) {
+      names.emplace_back(expression->as_column_name());
+    }
+    return names;
+  };
+  const auto original_column_names = column_names();
+
+  for (const auto& aggregate_node : aggregate_nodes) {
+    for (const auto& [_, materialized_view] : materialized_views) {
+      if (*aggregate_node != *materialized_view->aggregate_node()) continue;
+
+      materialized_view->replace_with_partials(lqp_root, aggregate_node);
+      break;
+    }
+  }
+
+  if (column_names() != original_column_names) {
+    lqp_insert_node(lqp_root, LQPInputSide::Left,
+                    AliasNode::make(lqp_root->left_input()->output_expressions(), original_column_names));
+  }
+}
+
+}  // namespace opossum
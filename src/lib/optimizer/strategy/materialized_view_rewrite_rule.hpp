@@ -0,0 +1,25 @@
+#pragma once
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces aggregates that a materialized view (see MaterializedView) computes by a plan that reads its partials.
+ * Instead of aggregating the base table, only the partials of the groups are merged:
+ *   SELECT l_orderkey, SUM(l_quantity) FROM lineitem GROUP BY l_orderkey
+ *     >>>   SELECT l_orderkey, CASE WHEN SUM(__partial_2) > 0 THEN SUM(__partial_1) ELSE NULL END
+ *           FROM view__partials GROUP BY l_orderkey HAVING SUM(__row_count) > 0
+ *
+ * An AggregateNode is only replaced if it and its inputs are equal to the aggregate of the view, i.e., the query
+ * needs the same groups, aggregates, and predicates. As the output columns are computed differently, an AliasNode
+ * keeps the original column names. The rule runs first, before other rules change the shape of the plan.
+ */
+class MaterializedViewRewriteRule : public AbstractRule {
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace opossum
@@ -1,7 +1,11 @@
 #include "predicate_split_up_rule.hpp"
 
+#include <algorithm>
+
+#include "expression/between_expression.hpp"
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/is_null_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
@@ -64,9 +68,38 @@ bool predicates_are_mutually_exclusive(const std::vector<std::shared_ptr<Abstrac
 
   return first_less_than_second;
 }
+
+// Returns whether the predicate compares a column to a value (or parameter) or to another column, i.e., whether the
+// TableScan has a dedicated scanning implementation for it.
+bool is_column_predicate(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto is_column = [](const auto& expression) { return expression->type == ExpressionType::LQPColumn; };
+  const auto is_value = [](const auto& expression) {
+    return expression->type == ExpressionType::Value || expression->type == ExpressionType::Placeholder ||
+           expression->type == ExpressionType::CorrelatedParameter;
+  };
+
+  if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+    const auto& left_operand = binary_predicate->left_operand();
+    const auto& right_operand = binary_predicate->right_operand();
+    return (is_column(left_operand) && (is_column(right_operand) || is_value(right_operand))) ||
+           (is_value(left_operand) && is_column(right_operand));
+  }
+
+  if (const auto is_null_expression = std::dynamic_pointer_cast<IsNullExpression>(predicate)) {
+    return is_column(is_null_expression->operand());
+  }
+
+  if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(predicate)) {
+    return is_column(between_expression->value()) && is_value(between_expression->lower_bound()) &&
+           is_value(between_expression->upper_bound());
+  }
+
+  return false;
+}
 }  // namespace
 
-PredicateSplitUpRule::PredicateSplitUpRule(const bool split_disjunctions) : _split_disjunctions(split_disjunctions) {}
+PredicateSplitUpRule::PredicateSplitUpRule(const bool split_disjunctions, const bool split_column_disjunctions)
+    : _split_disjunctions(split_disjunctions), _split_column_disjunctions(split_column_disjunctions) {}
 
 void PredicateSplitUpRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
   Assert(lqp_root->type == LQPNodeType::Root, "PredicateSplitUpRule needs root to hold onto");
@@ -141,6 +174,11 @@ void PredicateSplitUpRule::_split_disjunction(const std::shared_ptr<PredicateNod
     return;
   }
 
+  if (!_split_column_disjunctions &&
+      std::all_of(flat_disjunction.cbegin(), flat_disjunction.cend(), is_column_predicate)) {
+    return;
+  }
+
   // Step 1: Insert initial diamond
   const auto set_operation_mode =
       predicates_are_mutually_exclusive(flat_disjunction) ? SetOperationMode::All : SetOperationMode::Positions;
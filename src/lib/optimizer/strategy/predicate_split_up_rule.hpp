@@ -23,10 +23,14 @@ namespace opossum {
  *   TPC-DS query 35
  *     This rule splits up `EXISTS (...) OR EXISTS (...)` into two expressions that can later be rewritten into two
  *     semi-joins.
+ *
+ * If split_column_disjunctions is false, disjunctions that only consist of predicates comparing columns to values or
+ * to other columns (e.g., `a < 5 OR b = 'x'`) are not split. The TableScan evaluates them in a single pass (see
+ * DisjunctionTableScanImpl), which is cheaper than merging the results of multiple TableScans with UnionPositions.
  */
 class PredicateSplitUpRule : public AbstractRule {
  public:
-  explicit PredicateSplitUpRule(const bool split_disjunctions = true);
+  explicit PredicateSplitUpRule(const bool split_disjunctions = true, const bool split_column_disjunctions = true);
 
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
@@ -36,6 +40,7 @@ class PredicateSplitUpRule : public AbstractRule {
   void _split_disjunction(const std::shared_ptr<PredicateNode>& predicate_node) const;
 
   bool _split_disjunctions;
+  bool _split_column_disjunctions;
 };
 
 }  // namespace opossum
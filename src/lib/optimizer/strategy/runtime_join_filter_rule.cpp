@@ -0,0 +1,74 @@
+#include "runtime_join_filter_rule.hpp"
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Checks whether the node is, apart from predicates (including semi and anti joins) and validates, a stored table.
+bool is_stored_table_scan(std::shared_ptr<AbstractLQPNode> node) {
+  while (true) {
+    switch (node->type) {
+      case LQPNodeType::StoredTable:
+        return true;
+
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Validate:
+        break;
+
+      case LQPNodeType::Join: {
+        const auto join_mode = static_cast<const JoinNode&>(*node).join_mode;
+        if (join_mode != JoinMode::Semi && join_mode != JoinMode::AntiNullAsTrue &&
+            join_mode != JoinMode::AntiNullAsFalse) {
+          return false;
+        }
+      } break;
+
+      default:
+        return false;
+    }
+
+    node = node->left_input();
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void RuntimeJoinFilterRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  const auto estimator = cost_estimator->cardinality_estimator->new_instance();
+  estimator->guarantee_bottom_up_construction();
+
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+    if (!join_node->is_semi_reduction || join_node->is_runtime_filter) return LQPVisitation::VisitInputs;
+
+    // Semi join reductions have a single equals predicate. The RuntimeFilterScan hashes the values of both columns,
+    // which requires them to have the same data type.
+    const auto& join_predicates = join_node->join_predicates();
+    DebugAssert(join_predicates.size() == 1, "Expected semi join reduction to have a single predicate");
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicates.front());
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals ||
+        predicate->left_operand()->data_type() != predicate->right_operand()->data_type()) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    if (!is_stored_table_scan(join_node->left_input())) return LQPVisitation::VisitInputs;
+    if (estimator->estimate_cardinality(join_node->right_input()) > MAX_REDUCER_CARDINALITY) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    join_node->is_runtime_filter = true;
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Executes semi join reductions (see SemiJoinReductionRule) as runtime join filters (see RuntimeFilterScan): Instead
+ * of hashing both inputs, the reducer side publishes the value range and a bloom filter of its join column, and the
+ * reduced side skips the chunks and rows that cannot find a join partner before anything is materialized. As the
+ * filter is not exact, it can only replace semi joins that merely reduce the input of another join.
+ *
+ * This is beneficial when the reduced side is a scan of a stored table, e.g., the fact table in a star schema join
+ * with selective predicates on a dimension table. Only there, the pruning statistics of the stored chunks can be used.
+ * Semi join reductions above other operators (e.g., below an aggregate) remain exact, as the rows let through by the
+ * bloom filter would be processed by those operators. Furthermore, the reducer side should be small, so that the
+ * bloom filter fits into the cache and remains selective.
+ */
+class RuntimeJoinFilterRule : public AbstractRule {
+ public:
+  // Reducer sides with a larger estimated cardinality remain semi joins
+  constexpr static auto MAX_REDUCER_CARDINALITY = 100'000.0;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace opossum
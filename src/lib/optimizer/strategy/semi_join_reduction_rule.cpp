@@ -48,6 +48,7 @@ void SemiJoinReductionRule::_apply_to_plan_without_subqueries(const std::shared_
         auto reducer_node_cardinality = estimator->estimate_cardinality(reducer_node);
 
         const auto semi_join_reduction_node = JoinNode::make(JoinMode::Semi, predicate_expression);
+        semi_join_reduction_node->is_semi_reduction = true;
         semi_join_reduction_node->comment = "Semi Reduction";
         lqp_insert_node(join_node, side_of_join, semi_join_reduction_node);
         semi_join_reduction_node->set_right_input(reducer_node);
@@ -13,9 +13,11 @@
 #include "all_type_variant.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/row_group_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/pos_lists/cartesian_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 
 namespace opossum {
@@ -113,11 +115,14 @@ template <typename ColumnDataType, typename AbstractSegmentType, typename Functo
 std::enable_if_t<std::is_same_v<AbstractSegment, std::remove_const_t<AbstractSegmentType>>>
 /*void*/ resolve_segment_type(AbstractSegmentType& segment, const Functor& functor) {
   using ValueSegmentPtr = ConstOutIfConstIn<AbstractSegmentType, ValueSegment<ColumnDataType>>*;
+  using RowGroupSegmentPtr = ConstOutIfConstIn<AbstractSegmentType, RowGroupSegment<ColumnDataType>>*;
   using ReferenceSegmentPtr = ConstOutIfConstIn<AbstractSegmentType, ReferenceSegment>*;
   using EncodedSegmentPtr = ConstOutIfConstIn<AbstractSegmentType, AbstractEncodedSegment>*;
 
   if (const auto value_segment = dynamic_cast<ValueSegmentPtr>(&segment)) {
     functor(*value_segment);
+  } else if (const auto row_group_segment = dynamic_cast<RowGroupSegmentPtr>(&segment)) {
+    functor(*row_group_segment);
   } else if (const auto reference_segment = dynamic_cast<ReferenceSegmentPtr>(&segment)) {
     functor(*reference_segment);
   } else if (const auto encoded_segment = dynamic_cast<EncodedSegmentPtr>(&segment)) {
@@ -146,6 +151,8 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto cartesian_pos_list = std::dynamic_pointer_cast<const CartesianPosList>(untyped_pos_list)) {
+      functor(cartesian_pos_list);
     } else {
       Fail("Unrecognized PosList type encountered");
     }
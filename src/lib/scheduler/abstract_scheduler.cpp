@@ -1,5 +1,7 @@
 #include "abstract_scheduler.hpp"
 
+#include "hyrise.hpp"
+
 namespace opossum {
 
 void AbstractScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
@@ -31,10 +33,21 @@ void AbstractScheduler::schedule_tasks(const std::vector<std::shared_ptr<Abstrac
   DTRACE_PROBE1(HYRISE, SCHEDULE_TASKS, tasks.size());
   for (const auto& task : tasks) {
     DTRACE_PROBE2(HYRISE, TASKS, reinterpret_cast<uintptr_t>(&tasks), reinterpret_cast<uintptr_t>(task.get()));
-    task->schedule();
+  }
+  Hyrise::get().scheduler()->_schedule_tasks(tasks);
+}
+
+void AbstractScheduler::_schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto node_count = queues().size();
+  for (const auto& task : tasks) {
+    // Tasks that were assigned to a node before they were scheduled run on that node if the scheduler has it
+    const auto node_id = task->node_id();
+    task->schedule(static_cast<size_t>(node_id) < node_count ? node_id : CURRENT_NODE_ID);
   }
 }
 
+void AbstractScheduler::_mark_as_scheduled(const std::shared_ptr<AbstractTask>& task) { task->_mark_as_scheduled(); }
+
 void AbstractScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
   _group_tasks(tasks);
   schedule_tasks(tasks);
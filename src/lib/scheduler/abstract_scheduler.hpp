@@ -41,7 +41,8 @@ class AbstractScheduler : public Noncopyable {
   virtual void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                         SchedulePriority priority = SchedulePriority::Default) = 0;
 
-  // Schedules the given tasks for execution and returns immediately.
+  // Schedules the given tasks for execution and returns immediately. Tasks assigned to a node of the scheduler (see
+  // AbstractTask::set_node_id) run on that node, all others on the current one.
   // If no asynchronicity is needed, prefer schedule_and_wait_for_tasks.
   static void schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
@@ -58,6 +59,13 @@ class AbstractScheduler : public Noncopyable {
   // Internal helper method that adds predecessor/successor relationships between tasks to limit the degree of
   // parallelism and reduce scheduling overhead.
   virtual void _group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const;
+
+  // Schedules the tasks of schedule_tasks(). By default, every task is scheduled on its own. Schedulers can override
+  // this to enqueue the ready tasks of a task graph at once.
+  virtual void _schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // Gives derived schedulers access to AbstractTask's private _mark_as_scheduled()
+  static void _mark_as_scheduled(const std::shared_ptr<AbstractTask>& task);
 };
 
 }  // namespace opossum
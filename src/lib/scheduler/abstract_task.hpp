@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -50,6 +51,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  SchedulePriority priority() const;
+
+  /**
+   * @return The point in time at which the task was put into a TaskQueue or a Worker's deque. Only valid once
+   *         try_mark_as_enqueued() succeeded.
+   */
+  std::chrono::steady_clock::time_point enqueue_time() const;
+
   /**
    * Description for debugging purposes
    */
@@ -78,7 +87,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
 
   /**
-   * Node ids are changed when moving the Task between nodes (e.g. during work stealing)
+   * Node ids are changed when moving the Task between nodes (e.g. during work stealing). Before the Task is scheduled,
+   * the node id can be set to the node the Task should run on (e.g., the NUMA node holding the chunk it processes).
+   * AbstractScheduler::schedule_tasks() then schedules it on that node.
    */
   void set_node_id(NodeID node_id);
 
@@ -154,6 +165,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // else), _is_assigned_to_worker is set to true.
   // TODO(anyone): Change this into proper state transitions, see TransactionContext as an example.
   std::atomic_bool _is_enqueued{false};
+  std::chrono::steady_clock::time_point _enqueue_time{};
   std::atomic_bool _is_scheduled{false};
   std::atomic_bool _is_assigned_to_worker{false};
 
@@ -0,0 +1,206 @@
+#include "admission_control.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Exposes one of the limits of an AdmissionControl as a setting
+class AdmissionLimitSetting : public AbstractSetting {
+ public:
+  AdmissionLimitSetting(const std::string& init_name, const std::string& init_description,
+                        const std::function<size_t()>& get_limit, const std::function<void(size_t)>& set_limit)
+      : AbstractSetting(init_name), _description(init_description), _get_limit(get_limit), _set_limit(set_limit) {}
+
+  const std::string& description() const final { return _description; }
+
+  const std::string& get() final {
+    _value = std::to_string(_get_limit());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty() && std::all_of(value.begin(), value.end(), ::isdigit),
+                "Expected a non-negative number for " + name);
+    _set_limit(std::stoull(value));
+  }
+
+ private:
+  const std::string _description;
+  const std::function<size_t()> _get_limit;
+  const std::function<void(size_t)> _set_limit;
+  std::string _value;
+};
+
+}  // namespace
+
+namespace opossum {
+
+AdmissionControl::Ticket::Ticket(const std::shared_ptr<AdmissionControl>& admission_control,
+                                 const SessionID session_id)
+    : _admission_control(admission_control), _session_id(session_id) {}
+
+AdmissionControl::Ticket::~Ticket() { _admission_control->_release(_session_id); }
+
+AdmissionControl::AdmissionControl(const size_t max_concurrent_queries, const size_t max_queries_per_session)
+    : _max_concurrent_queries(max_concurrent_queries), _max_queries_per_session(max_queries_per_session) {}
+
+std::unique_ptr<AdmissionControl::Ticket> AdmissionControl::admit(const SessionID session_id) {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+
+  auto& session = _sessions[session_id];
+  if (session.waiting_query_ids.empty()) {
+    session.virtual_time = std::max(session.virtual_time, _system_virtual_time);
+  }
+
+  const auto query_id = _next_query_id++;
+  session.waiting_query_ids.emplace_back(query_id);
+  ++_waiting_query_count;
+
+  _admit_waiting_queries();
+  _query_admitted.wait(lock, [&]() { return _admitted_query_ids.contains(query_id); });
+  _admitted_query_ids.erase(query_id);
+
+  // The constructor of Ticket is private, so that std::make_unique cannot be used
+  return std::unique_ptr<Ticket>(new Ticket(shared_from_this(), session_id));  // NOLINT
+}
+
+void AdmissionControl::set_session_weight(const SessionID session_id, const double weight) {
+  Assert(weight > 0.0, "Session weight has to be positive");
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _session_weights[session_id] = weight;
+}
+
+size_t AdmissionControl::max_concurrent_queries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _max_concurrent_queries;
+}
+
+void AdmissionControl::set_max_concurrent_queries(const size_t max_concurrent_queries) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _max_concurrent_queries = max_concurrent_queries;
+  _admit_waiting_queries();
+}
+
+size_t AdmissionControl::max_queries_per_session() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _max_queries_per_session;
+}
+
+void AdmissionControl::set_max_queries_per_session(const size_t max_queries_per_session) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _max_queries_per_session = max_queries_per_session;
+  _admit_waiting_queries();
+}
+
+size_t AdmissionControl::running_query_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _running_query_count;
+}
+
+size_t AdmissionControl::waiting_query_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _waiting_query_count;
+}
+
+void AdmissionControl::register_settings() {
+  Assert(_settings.empty(), "Settings are already registered");
+
+  // The settings only hold a weak reference, so that they do not keep the AdmissionControl alive
+  const auto weak_this = weak_from_this();
+  const auto get_this = [weak_this]() {
+    const auto admission_control = weak_this.lock();
+    Assert(admission_control, "AdmissionControl of the setting no longer exists");
+    return admission_control;
+  };
+
+  _settings.emplace_back(std::make_shared<AdmissionLimitSetting>(
+      "AdmissionControl.max_concurrent_queries", "Maximum number of concurrently executing queries (0 for no limit)",
+      [get_this]() { return get_this()->max_concurrent_queries(); },
+      [get_this](const size_t limit) { get_this()->set_max_concurrent_queries(limit); }));
+  _settings.emplace_back(std::make_shared<AdmissionLimitSetting>(
+      "AdmissionControl.max_queries_per_session",
+      "Maximum number of concurrently executing queries per session (0 for no limit)",
+      [get_this]() { return get_this()->max_queries_per_session(); },
+      [get_this](const size_t limit) { get_this()->set_max_queries_per_session(limit); }));
+
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+}
+
+void AdmissionControl::unregister_settings() {
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
+}
+
+void AdmissionControl::_release(const SessionID session_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  auto session_iter = _sessions.find(session_id);
+  DebugAssert(session_iter != _sessions.end() && session_iter->second.running_query_count > 0,
+              "Released a query that was not admitted");
+  --session_iter->second.running_query_count;
+  --_running_query_count;
+
+  // Forget idle sessions. Their virtual time is caught up with the system's once they wait again.
+  if (session_iter->second.running_query_count == 0 && session_iter->second.waiting_query_ids.empty()) {
+    _sessions.erase(session_iter);
+  }
+
+  _admit_waiting_queries();
+}
+
+void AdmissionControl::_admit_waiting_queries() {
+  auto admitted_any = false;
+
+  while (_waiting_query_count > 0 && (_max_concurrent_queries == 0 || _running_query_count < _max_concurrent_queries)) {
+    // Choose the waiting session with the lowest virtual time among those below their quota. On ties, the session
+    // whose query waits longest goes first.
+    auto next_session_iter = _sessions.end();
+    for (auto session_iter = _sessions.begin(); session_iter != _sessions.end(); ++session_iter) {
+      const auto& session = session_iter->second;
+      if (session.waiting_query_ids.empty()) continue;
+      if (_max_queries_per_session > 0 && session.running_query_count >= _max_queries_per_session) continue;
+      if (next_session_iter != _sessions.end()) {
+        const auto& next_session = next_session_iter->second;
+        if (std::pair{session.virtual_time, session.waiting_query_ids.front()} >
+            std::pair{next_session.virtual_time, next_session.waiting_query_ids.front()}) {
+          continue;
+        }
+      }
+      next_session_iter = session_iter;
+    }
+    if (next_session_iter == _sessions.end()) break;
+
+    auto& session = next_session_iter->second;
+
+    const auto weight_iter = _session_weights.find(next_session_iter->first);
+    const auto weight = weight_iter != _session_weights.end() ? weight_iter->second : 1.0;
+
+    _system_virtual_time = session.virtual_time;
+    session.virtual_time += 1.0 / weight;
+
+    _admitted_query_ids.emplace(session.waiting_query_ids.front());
+    session.waiting_query_ids.pop_front();
+    ++session.running_query_count;
+    --_waiting_query_count;
+    ++_running_query_count;
+    admitted_any = true;
+  }
+
+  if (admitted_any) _query_admitted.notify_all();
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSetting;
+
+/**
+ * Limits the number of queries (i.e., SQLPipelineStatements) that execute concurrently, both in total and per session.
+ * Without limits, a large analytical query can flood all task queues and workers, so that short queries of other
+ * sessions wait behind its tasks.
+ *
+ * A query that cannot be admitted right away waits until another query finishes. The next query is chosen by weighted
+ * fair queuing across sessions: Each session has a virtual time that advances by 1 / weight for every admitted query,
+ * and the oldest waiting query of the session with the lowest virtual time is admitted first. Sessions that start
+ * waiting begin at the virtual time of the system, so that idle sessions do not accumulate credit.
+ *
+ * A limit of zero means that there is no limit. After register_settings(), both limits can be changed through the
+ * settings "AdmissionControl.max_concurrent_queries" and "AdmissionControl.max_queries_per_session".
+ */
+class AdmissionControl : public Noncopyable, public std::enable_shared_from_this<AdmissionControl> {
+ public:
+  // Admission of a single query, which ends when the ticket is destroyed
+  class Ticket : public Noncopyable {
+   public:
+    ~Ticket();
+
+   private:
+    friend class AdmissionControl;
+    Ticket(const std::shared_ptr<AdmissionControl>& admission_control, const SessionID session_id);
+
+    const std::shared_ptr<AdmissionControl> _admission_control;
+    const SessionID _session_id;
+  };
+
+  explicit AdmissionControl(const size_t max_concurrent_queries = 0, const size_t max_queries_per_session = 0);
+
+  // Blocks until the query of the given session may execute
+  std::unique_ptr<Ticket> admit(const SessionID session_id);
+
+  // Sessions with a higher weight get a larger share of the admitted queries if queries of multiple sessions wait.
+  // The default weight is 1.
+  void set_session_weight(const SessionID session_id, const double weight);
+
+  size_t max_concurrent_queries() const;
+  void set_max_concurrent_queries(const size_t max_concurrent_queries);
+
+  size_t max_queries_per_session() const;
+  void set_max_queries_per_session(const size_t max_queries_per_session);
+
+  size_t running_query_count() const;
+  size_t waiting_query_count() const;
+
+  void register_settings();
+  void unregister_settings();
+
+ private:
+  struct SessionState {
+    double virtual_time{0.0};
+    size_t running_query_count{0};
+    std::deque<uint64_t> waiting_query_ids;
+  };
+
+  void _release(const SessionID session_id);
+
+  // Admits waiting queries as long as the limits allow. _mutex has to be locked.
+  void _admit_waiting_queries();
+
+  mutable std::mutex _mutex;
+  std::condition_variable _query_admitted;
+
+  size_t _max_concurrent_queries;
+  size_t _max_queries_per_session;
+
+  size_t _running_query_count{0};
+  size_t _waiting_query_count{0};
+  uint64_t _next_query_id{0};
+  double _system_virtual_time{0.0};
+
+  std::unordered_map<SessionID, SessionState> _sessions;
+  std::unordered_map<SessionID, double> _session_weights;
+  std::unordered_set<uint64_t> _admitted_query_ids;
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
+};
+
+}  // namespace opossum
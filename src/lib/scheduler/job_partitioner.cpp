@@ -0,0 +1,198 @@
+#include "job_partitioner.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Relative cost of reading a row of a segment. The values reflect the decoding effort of the encodings and were not
+// measured precisely.
+double segment_cost_factor(const AbstractSegment& segment) {
+  if (dynamic_cast<const ReferenceSegment*>(&segment)) return 2.0;
+
+  const auto* const encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+  if (!encoded_segment) return 1.0;
+
+  switch (encoded_segment->encoding_type()) {
+    case EncodingType::Unencoded:
+    case EncodingType::Dictionary:
+    case EncodingType::FixedStringDictionary:
+      return 1.0;
+    case EncodingType::RunLength:
+      return 0.5;
+    case EncodingType::FrameOfReference:
+      return 1.5;
+    case EncodingType::FSST:
+      return 3.0;
+    case EncodingType::LZ4:
+      return 4.0;
+  }
+  Fail("Invalid enum value");
+}
+
+class MinJobCostSetting : public AbstractSetting {
+ public:
+  MinJobCostSetting() : AbstractSetting("Scheduler.min_job_cost") {}
+
+  const std::string& description() const final {
+    static const auto description = std::string{
+        "Minimum estimated cost (in rows of a dictionary-encoded segment) of the chunks that operators process in a "
+        "single job"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(Hyrise::get().job_partitioner.min_job_cost());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty() && std::all_of(value.begin(), value.end(), ::isdigit),
+                "Expected a non-negative number for " + name);
+    Hyrise::get().job_partitioner.set_min_job_cost(std::stoull(value));
+  }
+
+ private:
+  std::string _value;
+};
+
+}  // namespace
+
+namespace opossum {
+
+JobPartitioner::JobPartitioner(const size_t min_job_cost) : _min_job_cost(min_job_cost) {}
+
+size_t JobPartitioner::min_job_cost() const { return _min_job_cost; }
+
+void JobPartitioner::set_min_job_cost(const size_t min_job_cost) { _min_job_cost = min_job_cost; }
+
+std::vector<std::vector<ChunkID>> JobPartitioner::partition(const Table& table,
+                                                            const std::vector<ChunkID>& chunk_ids) const {
+  const auto min_job_cost = static_cast<double>(_min_job_cost);
+
+  auto groups = std::vector<std::vector<ChunkID>>{};
+  auto group_cost = 0.0;
+  auto group_node_id = INVALID_NODE_ID;
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto cost = chunk_cost(*chunk);
+    const auto node_id = chunk->numa_node_id();
+
+    // Start a new group if the current one is complete, if the chunk is large enough for a job of its own, or if the
+    // chunk is located on another NUMA node.
+    if (groups.empty() || group_cost >= min_job_cost || cost >= min_job_cost || node_id != group_node_id) {
+      groups.emplace_back();
+      group_cost = 0.0;
+      group_node_id = node_id;
+    }
+
+    groups.back().emplace_back(chunk_id);
+    group_cost += cost;
+  }
+
+  return groups;
+}
+
+std::vector<std::vector<ChunkID>> JobPartitioner::partition(const Table& table) const {
+  const auto chunk_count = table.chunk_count();
+  auto chunk_ids = std::vector<ChunkID>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_ids[chunk_id] = chunk_id;
+  }
+  return partition(table, chunk_ids);
+}
+
+void JobPartitioner::for_each_chunk(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                                    const std::function<void(ChunkID)>& functor,
+                                    const ChunkProgressCallback& progress_callback) const {
+  const auto groups = partition(table, chunk_ids);
+
+  const auto chunk_count = chunk_ids.size();
+  auto processed_chunk_count = size_t{0};
+  auto progress_mutex = std::mutex{};
+
+  const auto process_group = [&](const std::vector<ChunkID>& group) {
+    for (const auto chunk_id : group) {
+      functor(chunk_id);
+
+      if (progress_callback) {
+        const auto lock = std::lock_guard<std::mutex>{progress_mutex};
+        progress_callback(++processed_chunk_count, chunk_count);
+      }
+    }
+  };
+
+  // As in the operators, a single group is processed without spawning a job
+  if (groups.size() == 1) {
+    process_group(groups.front());
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(groups.size());
+  for (const auto& group : groups) {
+    const auto job = std::make_shared<JobTask>([&]() { process_group(group); });
+    job->set_node_id(table.get_chunk(group.front())->numa_node_id());
+    jobs.emplace_back(job);
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+void JobPartitioner::for_each_chunk(const Table& table, const std::function<void(ChunkID)>& functor,
+                                    const ChunkProgressCallback& progress_callback) const {
+  const auto chunk_count = table.chunk_count();
+  auto chunk_ids = std::vector<ChunkID>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_ids[chunk_id] = chunk_id;
+  }
+  for_each_chunk(table, chunk_ids, functor, progress_callback);
+}
+
+double JobPartitioner::chunk_cost(const Chunk& chunk) {
+  const auto column_count = chunk.column_count();
+  if (column_count == 0) return static_cast<double>(chunk.size());
+
+  auto cost_factor_sum = 0.0;
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    cost_factor_sum += segment_cost_factor(*chunk.get_segment(column_id));
+  }
+
+  return static_cast<double>(chunk.size()) * cost_factor_sum / static_cast<double>(column_count);
+}
+
+void JobPartitioner::register_settings() {
+  Assert(_settings.empty(), "Settings are already registered");
+
+  _settings.emplace_back(std::make_shared<MinJobCostSetting>());
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+}
+
+void JobPartitioner::unregister_settings() {
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
+}
+
+}  // namespace opossum
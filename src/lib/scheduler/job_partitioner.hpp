@@ -0,0 +1,79 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSetting;
+class Chunk;
+class Table;
+
+/**
+ * Decides how operators that process their input chunk by chunk (e.g., TableScan, Projection, Validate) split their
+ * work into jobs. Instead of spawning one job per chunk independent of the chunk's size, chunks are grouped by their
+ * estimated cost, i.e., their row count weighted by how expensive their segments are to read (see chunk_cost()):
+ *
+ *   - Consecutive chunks are merged into one group until the group reaches min_job_cost. Thus, many small chunks do
+ *     not pay the scheduling overhead of one job each.
+ *   - A chunk that reaches min_job_cost on its own gets a group of its own.
+ *   - A group only contains chunks of the same NUMA node, so that the job can be scheduled on that node.
+ *   - If the entire input is cheaper than min_job_cost, there is only a single group. Operators execute it directly
+ *     instead of spawning a job.
+ *
+ * Splitting single chunks into smaller ranges is left to the operators that can process row ranges (Sort, TopK).
+ *
+ * Per-chunk work outside of operators, e.g., encoding the chunks of a table or creating their indexes, uses
+ * for_each_chunk(), which schedules the groups as JobTasks.
+ *
+ * After register_settings(), min_job_cost can be changed through the setting "Scheduler.min_job_cost".
+ */
+// Called with the number of processed chunks and the total number of chunks
+using ChunkProgressCallback = std::function<void(size_t processed_chunk_count, size_t chunk_count)>;
+
+class JobPartitioner {
+ public:
+  // Equivalent to 10'000 rows of a dictionary-encoded segment. Previously, operators spawned jobs for chunks of 500
+  // rows or more, which is far below the cost of scheduling a job.
+  static constexpr auto DEFAULT_MIN_JOB_COST = size_t{10'000};
+
+  explicit JobPartitioner(const size_t min_job_cost = DEFAULT_MIN_JOB_COST);
+
+  size_t min_job_cost() const;
+  void set_min_job_cost(const size_t min_job_cost);
+
+  // Groups the chunks with the given ids (in this order). Each group is processed by one job.
+  std::vector<std::vector<ChunkID>> partition(const Table& table, const std::vector<ChunkID>& chunk_ids) const;
+
+  // Groups all chunks of the table
+  std::vector<std::vector<ChunkID>> partition(const Table& table) const;
+
+  // Calls functor(chunk_id) for the chunks with the given ids and waits until all are processed. Each group of
+  // partition() is processed by a JobTask on the NUMA node of its chunks. The functor is called concurrently for
+  // different chunks. If given, progress_callback is called after each chunk. Its calls are serialized, so that it
+  // does not need to be thread-safe.
+  void for_each_chunk(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                      const std::function<void(ChunkID)>& functor,
+                      const ChunkProgressCallback& progress_callback = {}) const;
+
+  // Calls functor(chunk_id) for all chunks of the table, see above
+  void for_each_chunk(const Table& table, const std::function<void(ChunkID)>& functor,
+                      const ChunkProgressCallback& progress_callback = {}) const;
+
+  // The estimated cost of processing a chunk, in rows of a dictionary-encoded segment. Encodings that are more
+  // expensive to decode (e.g., LZ4) and ReferenceSegments, which have to be dereferenced, cost more per row.
+  static double chunk_cost(const Chunk& chunk);
+
+  void register_settings();
+  void unregister_settings();
+
+ private:
+  size_t _min_job_cost;
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
+};
+
+}  // namespace opossum
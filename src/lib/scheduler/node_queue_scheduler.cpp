@@ -1,7 +1,9 @@
 #include "node_queue_scheduler.hpp"
+#include <array>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -38,8 +40,14 @@ void NodeQueueScheduler::begin() {
 
     const auto& topology_node = Hyrise::get().topology.nodes()[node_id];
 
+    auto node_workers = std::vector<Worker*>{};
     for (const auto& topology_cpu : topology_node.cpus) {
       _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      node_workers.emplace_back(_workers.back().get());
+    }
+
+    for (auto* const worker : node_workers) {
+      worker->set_node_workers(node_workers);
     }
   }
 
@@ -88,6 +96,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -102,8 +112,8 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (!task->is_ready()) return;
 
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -115,10 +125,61 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
               "preferred_node_id is not within range of available nodes");
 
+  // Tasks that a worker schedules for its own node are pushed to the worker's deque, where the worker finds them first
+  // and other workers of the node can steal them. This avoids the shared queue for the many small JobTasks that
+  // operators spawn.
+  if (worker && priority == SchedulePriority::Default && worker->queue()->node_id() == preferred_node_id) {
+    worker->push_task(task);
+    return;
+  }
+
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
 }
 
+void NodeQueueScheduler::_schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  DebugAssert(_active, "Can't schedule more tasks after the NodeQueueScheduler was shut down");
+
+  // See AbstractTask::schedule
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Marking all tasks first allows successors that become ready while the batch is enqueued to be executed right away
+  auto task_id = _task_counter.fetch_add(static_cast<TaskID>(tasks.size()));
+  for (const auto& task : tasks) {
+    _mark_as_scheduled(task);
+    task->set_id(task_id++);
+  }
+
+  const auto worker = Worker::get_this_thread_worker();
+  const auto current_node_id = worker ? worker->queue()->node_id() : NodeID{0};
+
+  auto deque_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto queue_tasks =
+      std::vector<std::array<std::vector<std::shared_ptr<AbstractTask>>, TaskQueue::NUM_PRIORITY_LEVELS>>(
+          _queues.size());
+  for (const auto& task : tasks) {
+    if (!task->is_ready()) continue;
+
+    // Tasks that were assigned to a node before they were scheduled run on that node if the scheduler has it
+    const auto node_id = static_cast<size_t>(task->node_id()) < _queues.size() ? task->node_id() : current_node_id;
+
+    // See schedule() for why tasks of the worker's node are pushed to its deque
+    if (worker && task->priority() == SchedulePriority::Default && node_id == current_node_id) {
+      deque_tasks.emplace_back(task);
+    } else {
+      queue_tasks[node_id][static_cast<uint32_t>(task->priority())].emplace_back(task);
+    }
+  }
+
+  if (!deque_tasks.empty()) worker->push_tasks(deque_tasks);
+
+  for (auto node_id = NodeID{0}; node_id < _queues.size(); ++node_id) {
+    for (auto priority = uint32_t{0}; priority < TaskQueue::NUM_PRIORITY_LEVELS; ++priority) {
+      if (!queue_tasks[node_id][priority].empty()) _queues[node_id]->push(queue_tasks[node_id][priority], priority);
+    }
+  }
+}
+
 void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const {
   // Adds predecessor/successor relationships between tasks so that only NUM_GROUPS tasks can be executed in parallel.
   // The optimal value of NUM_GROUPS depends on the number of cores and the number of queries being executed
@@ -126,23 +187,19 @@ void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<Abstract
   //
   // Approach: Skip all tasks that already have predecessors or successors, as adding relationships to these could
   // introduce cyclic dependencies. Again, this is far from perfect, but better than not grouping the tasks.
+  //
+  // A chain is executed on the Worker that executes its first task (see Worker::execute_next). Thus, tasks that were
+  // assigned to different nodes (e.g., the NUMA nodes of their chunks) are grouped separately for each node.
 
-  auto round_robin_counter = 0;
-  auto common_node_id = std::optional<NodeID>{};
-
-  std::vector<std::shared_ptr<AbstractTask>> grouped_tasks(NUM_GROUPS);
+  auto round_robin_counters = std::unordered_map<NodeID, size_t>{};
+  auto grouped_tasks_per_node = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
   for (const auto& task : tasks) {
     if (!task->predecessors().empty() || !task->successors().empty()) return;
 
-    if (common_node_id) {
-      // This is not really a hard assertion. As the chain will likely be executed on the same Worker (see
-      // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-      // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-      // node ids.
-      DebugAssert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id");
-    } else {
-      common_node_id = task->node_id();
-    }
+    const auto node_id = task->node_id();
+    auto& grouped_tasks = grouped_tasks_per_node[node_id];
+    if (grouped_tasks.empty()) grouped_tasks.resize(NUM_GROUPS);
+    auto& round_robin_counter = round_robin_counters[node_id];
 
     const auto group_id = round_robin_counter % NUM_GROUPS;
     const auto& first_task_in_group = grouped_tasks[group_id];
@@ -47,7 +47,10 @@ namespace opossum {
  * For setting up a Scheduler a topology is used. A topology encapsulates the machine's architecture, e.g. number
  * of CPUs and the number of nodes, where a node is a cluster of CPUs.
  * In general, each node owns a TaskQueue. Furthermore, one Worker is assigned to one CPU. Therefore, the Worker
- * running on CPUs of one node are just pulling from the single TaskQueue of this node.
+ * running on CPUs of one node are just pulling from the single TaskQueue of this node. Additionally, each Worker owns a
+ * lock-free WorkStealingDeque. Tasks that a Worker schedules for its own node (e.g., the JobTasks of an operator it
+ * executes) are pushed to this deque instead of the TaskQueue. The Worker pops from its deque in LIFO order before it
+ * pulls from the TaskQueue.
  *
  * A topology can also be created with Hyrise::get().topology.use_fake_numa_topology() to simulate a NUMA system
  * with multiple nodes (queues) and worker and should mainly be used for testing NUMA-concepts
@@ -68,6 +71,9 @@ namespace opossum {
  * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
  * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
  * Afterwards, the current worker is checking its local queue gain.
+ * Before checking remote queues, an idle worker steals the oldest task from the deque of another worker on the same
+ * node. Workers that found no task at all sleep until a task is pushed on their node or a timeout passes. Pushing
+ * a task only touches the mutex of the sleeping workers if there are any.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -96,6 +102,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -112,6 +120,10 @@ class NodeQueueScheduler : public AbstractScheduler {
  protected:
   void _group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const override;
 
+  // Marks all tasks as scheduled before the ready ones are enqueued with one push per queue or deque. Tasks that become
+  // ready later are enqueued by the worker that finished their last predecessor (see AbstractTask::_finish).
+  void _schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) override;
+
  private:
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
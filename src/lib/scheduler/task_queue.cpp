@@ -17,6 +17,11 @@ bool TaskQueue::empty() const {
   return true;
 }
 
+size_t TaskQueue::estimated_size(uint32_t priority) const {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+  return _queues[priority].unsafe_size();
+}
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
@@ -28,7 +33,22 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   task->set_node_id(_node_id);
   _queues[priority].push(task);
 
-  new_task.notify_one();
+  notify_waiting_worker();
+}
+
+void TaskQueue::push(const std::vector<std::shared_ptr<AbstractTask>>& tasks, uint32_t priority) {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+
+  auto pushed_task_count = size_t{0};
+  for (const auto& task : tasks) {
+    if (!task->try_mark_as_enqueued()) continue;
+
+    task->set_node_id(_node_id);
+    _queues[priority].push(task);
+    ++pushed_task_count;
+  }
+
+  notify_waiting_workers(pushed_task_count);
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -55,4 +75,48 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   return nullptr;
 }
 
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout,
+                              const std::function<bool()>& has_stealable_task) {
+  auto lock = std::unique_lock<std::mutex>{_wait_mutex};
+  _waiting_worker_count.fetch_add(1, std::memory_order_seq_cst);
+
+  // Pairs with the fence in notify_waiting_worker(s): Either the pushing thread sees the incremented counter or we see
+  // the pushed task, no matter whether it was pushed into the queue or into a deque.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Tasks pushed after this check find the counter incremented and notify us, which requires the mutex that we only
+  // release once we wait.
+  if (empty() && !has_stealable_task()) {
+    _new_task.wait_for(lock, timeout);
+  }
+
+  _waiting_worker_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void TaskQueue::notify_waiting_worker() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_waiting_worker_count.load(std::memory_order_relaxed) == 0) return;
+
+  const auto lock = std::lock_guard<std::mutex>{_wait_mutex};
+  _new_task.notify_one();
+}
+
+void TaskQueue::notify_waiting_workers(const size_t task_count) {
+  if (task_count == 0) return;
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto waiting_worker_count = _waiting_worker_count.load(std::memory_order_relaxed);
+  if (waiting_worker_count == 0) return;
+
+  const auto lock = std::lock_guard<std::mutex>{_wait_mutex};
+  if (task_count >= waiting_worker_count) {
+    _new_task.notify_all();
+    return;
+  }
+
+  for (auto notified_worker_count = size_t{0}; notified_worker_count < task_count; ++notified_worker_count) {
+    _new_task.notify_one();
+  }
+}
+
 }  // namespace opossum
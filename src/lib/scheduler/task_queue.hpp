@@ -4,8 +4,11 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -18,16 +21,23 @@ class AbstractTask;
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
 
   explicit TaskQueue(NodeID node_id);
 
   bool empty() const;
 
+  // Number of tasks of the priority level that wait in the queue. As tasks are pushed and pulled concurrently, the size
+  // is only an estimate.
+  size_t estimated_size(uint32_t priority) const;
+
   NodeID node_id() const;
 
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
+  // Pushes multiple tasks and wakes up as many waiting workers as needed instead of notifying for every task
+  void push(const std::vector<std::shared_ptr<AbstractTask>>& tasks, uint32_t priority);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from the queue
    */
@@ -39,18 +49,31 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Blocks the calling worker until a task is pushed into the queue or into the deque of one of the node's workers, or
+   * until the timeout has passed (whatever occurs first). As the queue does not know the workers' deques, the worker
+   * passes has_stealable_task, which checks them. The worker only sleeps if neither the queue nor the deques hold a
+   * task once it is registered as waiting, so that a task pushed in the meantime is not missed.
+   */
+  void wait_for_task(const std::chrono::microseconds timeout, const std::function<bool()>& has_stealable_task);
+
+  /**
+   * Wakes up one waiting worker of this node, if there is any. Unless workers are idle, this does not touch the mutex.
    */
-  std::condition_variable new_task;
+  void notify_waiting_worker();
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Wakes up up to task_count waiting workers of this node.
    */
-  std::mutex lock;
+  void notify_waiting_workers(size_t task_count);
 
  private:
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // Number of workers in wait_for_task(), so that pushing a task only needs to notify if there are any
+  std::atomic<uint32_t> _waiting_worker_count{0};
+  std::mutex _wait_mutex;
+  std::condition_variable _new_task;
 };
 
 }  // namespace opossum
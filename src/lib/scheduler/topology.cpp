@@ -6,14 +6,27 @@
 
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#endif
+
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 #if HYRISE_NUMA_SUPPORT
@@ -22,7 +35,7 @@ const int Topology::_number_of_hardware_nodes = numa_num_configured_nodes();  //
 const int Topology::_number_of_hardware_nodes = 1;  // NOLINT
 #endif
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() : _l2_cache_size(_detect_l2_cache_size()) { _init_default_topology(); }
 
 std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node) {
   stream << "Number of Node CPUs: " << topology_node.cpus.size() << ", CPUIDs: [";
@@ -37,25 +50,39 @@ std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node
   return stream;
 }
 
-void Topology::use_default_topology(uint32_t max_num_cores) { _init_default_topology(max_num_cores); }
+void Topology::use_default_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
+  _init_default_topology(max_num_cores, hyperthread_mode);
+}
 
-void Topology::use_numa_topology(uint32_t max_num_cores) { _init_numa_topology(max_num_cores); }
+void Topology::use_numa_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
+  _init_numa_topology(max_num_cores, hyperthread_mode);
+}
 
-void Topology::use_non_numa_topology(uint32_t max_num_cores) { _init_non_numa_topology(max_num_cores); }
+void Topology::use_non_numa_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
+  _init_non_numa_topology(max_num_cores, hyperthread_mode);
+}
 
 void Topology::use_fake_numa_topology(uint32_t max_num_workers, uint32_t workers_per_node) {
   _init_fake_numa_topology(max_num_workers, workers_per_node);
 }
 
-void Topology::_init_default_topology(uint32_t max_num_cores) {
+void Topology::_init_default_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
+  // Workers beyond the CPU quota of a container would only be throttled by the kernel
+  const auto cgroup_cpu_limit = _detect_cgroup_cpu_limit();
+  if (cgroup_cpu_limit) {
+    max_num_cores = max_num_cores == 0 ? *cgroup_cpu_limit : std::min(max_num_cores, *cgroup_cpu_limit);
+  }
+
 #if !HYRISE_NUMA_SUPPORT
-  _init_non_numa_topology(max_num_cores);
+  _init_non_numa_topology(max_num_cores, hyperthread_mode);
 #else
-  _init_numa_topology(max_num_cores);
+  _init_numa_topology(max_num_cores, hyperthread_mode);
 #endif
+
+  _cgroup_cpu_limit = cgroup_cpu_limit;
 }
 
-void Topology::_init_numa_topology(uint32_t max_num_cores) {
+void Topology::_init_numa_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
 #if !HYRISE_NUMA_SUPPORT
   _init_fake_numa_topology(max_num_cores);
 #else
@@ -68,12 +95,10 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
   _fake_numa_topology = false;
 
   auto max_node = numa_max_node();
-  auto num_configured_cpus = static_cast<CpuID>(numa_num_configured_cpus());
 
   // We take the CPU affinity (set, e.g., by numactl) of our process into account.
   // Otherwise, we would always start with the first CPU, even if a specific NUMA node was selected.
-  auto* affinity_cpu_bitmask = numa_allocate_cpumask();
-  numa_sched_getaffinity(0, affinity_cpu_bitmask);
+  const auto available_cpus = _available_cpus(hyperthread_mode);
 
   auto* this_node_cpu_bitmask = numa_allocate_cpumask();
   auto core_count = uint32_t{0};
@@ -84,17 +109,14 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
 
       numa_node_to_cpus(node_id, this_node_cpu_bitmask);
 
-      for (CpuID cpu_id{0}; cpu_id < num_configured_cpus; ++cpu_id) {
-        const auto cpu_is_part_of_node = numa_bitmask_isbitset(this_node_cpu_bitmask, cpu_id);
-        const auto cpu_is_part_of_affinity = numa_bitmask_isbitset(affinity_cpu_bitmask, cpu_id);
-        if (cpu_is_part_of_node && cpu_is_part_of_affinity) {
-          if (max_num_cores == 0 || core_count < max_num_cores) {
-            cpus.emplace_back(TopologyCpu(cpu_id));
-            _num_cpus++;
-          }
-          core_count++;
+      for (const auto cpu_id : available_cpus) {
+        if (!numa_bitmask_isbitset(this_node_cpu_bitmask, cpu_id)) continue;
+
+        if (max_num_cores == 0 || core_count < max_num_cores) {
+          cpus.emplace_back(TopologyCpu(cpu_id));
+          _num_cpus++;
         }
-        if (!cpu_is_part_of_affinity) _filtered_by_affinity = true;
+        core_count++;
       }
 
       TopologyNode node(std::move(cpus));
@@ -102,23 +124,23 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
     }
   }
 
-  numa_free_cpumask(affinity_cpu_bitmask);
   numa_free_cpumask(this_node_cpu_bitmask);
 #endif
 }
 
-void Topology::_init_non_numa_topology(uint32_t max_num_cores) {
+void Topology::_init_non_numa_topology(uint32_t max_num_cores, HyperthreadMode hyperthread_mode) {
   _clear();
   _fake_numa_topology = false;
 
-  _num_cpus = std::thread::hardware_concurrency();
-  if (max_num_cores != 0) {
-    _num_cpus = std::min(_num_cpus, max_num_cores);
+  auto available_cpus = _available_cpus(hyperthread_mode);
+  if (max_num_cores != 0 && available_cpus.size() > max_num_cores) {
+    available_cpus.resize(max_num_cores);
   }
+  _num_cpus = static_cast<uint32_t>(available_cpus.size());
 
   auto cpus = std::vector<TopologyCpu>();
 
-  for (auto cpu_id = CpuID{0}; cpu_id < _num_cpus; cpu_id++) {
+  for (const auto cpu_id : available_cpus) {
     cpus.emplace_back(TopologyCpu(cpu_id));
   }
 
@@ -130,7 +152,8 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
   _clear();
   _fake_numa_topology = true;
 
-  auto num_workers = std::thread::hardware_concurrency();
+  const auto available_cpus = _available_cpus(HyperthreadMode::All);
+  auto num_workers = static_cast<uint32_t>(available_cpus.size());
   if (max_num_workers != 0) {
     num_workers = std::min<uint32_t>(num_workers, max_num_workers);
   }
@@ -140,14 +163,14 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
 
   _nodes.reserve(num_nodes);
 
-  auto cpu_id = CpuID{0};
+  auto cpu_index = uint32_t{0};
 
   for (auto node_id = uint32_t{0}; node_id < num_nodes; node_id++) {
     auto cpus = std::vector<TopologyCpu>();
 
-    for (auto worker_id = uint32_t{0}; worker_id < workers_per_node && cpu_id < num_workers; worker_id++) {
-      cpus.emplace_back(TopologyCpu(cpu_id));
-      cpu_id++;
+    for (auto worker_id = uint32_t{0}; worker_id < workers_per_node && cpu_index < num_workers; worker_id++) {
+      cpus.emplace_back(TopologyCpu(available_cpus[cpu_index]));
+      cpu_index++;
     }
 
     auto node = TopologyNode(std::move(cpus));
@@ -162,9 +185,146 @@ const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
+void Topology::set_l2_cache_size(const size_t l2_cache_size) {
+  Assert(l2_cache_size > 0, "L2 cache size must be positive");
+  _l2_cache_size = l2_cache_size;
+}
+
+size_t Topology::_detect_l2_cache_size() {
+  auto l2_cache_size = int64_t{0};
+
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+  l2_cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+
+#ifdef __APPLE__
+  auto size = sizeof(l2_cache_size);
+  if (sysctlbyname("hw.l2cachesize", &l2_cache_size, &size, nullptr, 0) != 0) {
+    l2_cache_size = 0;
+  }
+#endif
+
+  return l2_cache_size > 0 ? static_cast<size_t>(l2_cache_size) : DEFAULT_L2_CACHE_SIZE;
+}
+
+std::vector<CpuID> Topology::_available_cpus(HyperthreadMode hyperthread_mode) {
+  const auto hardware_concurrency = std::thread::hardware_concurrency();
+  auto cpus = std::vector<CpuID>{};
+
+#ifdef __linux__
+  auto cpu_set = cpu_set_t{};
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    for (auto cpu_id = CpuID{0}; cpu_id < CPU_SETSIZE; ++cpu_id) {
+      if (CPU_ISSET(cpu_id, &cpu_set)) cpus.emplace_back(cpu_id);
+    }
+  }
+  if (!cpus.empty() && cpus.size() < hardware_concurrency) _filtered_by_affinity = true;
+#endif
+
+  if (cpus.empty()) {
+    for (auto cpu_id = CpuID{0}; cpu_id < hardware_concurrency; ++cpu_id) {
+      cpus.emplace_back(cpu_id);
+    }
+  }
+
+  if (hyperthread_mode == HyperthreadMode::OnePerCore) return _one_cpu_per_core(cpus);
+  return cpus;
+}
+
+std::optional<uint32_t> Topology::_detect_cgroup_cpu_limit() {
+#ifdef __linux__
+  const auto read_line = [](const std::string& path) -> std::optional<std::string> {
+    auto file = std::ifstream{path};
+    auto line = std::string{};
+    if (!file || !std::getline(file, line)) return std::nullopt;
+    return line;
+  };
+
+  // Within a container, /sys/fs/cgroup is the root of the container's cgroup
+  if (const auto cpu_max = read_line("/sys/fs/cgroup/cpu.max")) return _parse_cgroup_v2_cpu_limit(*cpu_max);
+
+  const auto cfs_quota_us = read_line("/sys/fs/cgroup/cpu/cpu.cfs_quota_us");
+  const auto cfs_period_us = read_line("/sys/fs/cgroup/cpu/cpu.cfs_period_us");
+  if (cfs_quota_us && cfs_period_us) return _parse_cgroup_v1_cpu_limit(*cfs_quota_us, *cfs_period_us);
+#endif
+
+  return std::nullopt;
+}
+
+std::optional<uint32_t> Topology::_parse_cgroup_v2_cpu_limit(const std::string& cpu_max) {
+  auto stream = std::istringstream{cpu_max};
+  auto quota = std::string{};
+  auto period = std::string{};
+  if (!(stream >> quota >> period) || quota == "max") return std::nullopt;
+  return _parse_cgroup_v1_cpu_limit(quota, period);
+}
+
+std::optional<uint32_t> Topology::_parse_cgroup_v1_cpu_limit(const std::string& cfs_quota_us,
+                                                          const std::string& cfs_period_us) {
+  auto quota = int64_t{0};
+  auto period = int64_t{0};
+  if (!(std::istringstream{cfs_quota_us} >> quota) || !(std::istringstream{cfs_period_us} >> period)) {
+    return std::nullopt;
+  }
+
+  // A quota of -1 means that the cgroup is not limited
+  if (quota <= 0 || period <= 0) return std::nullopt;
+  return static_cast<uint32_t>((quota + period - 1) / period);
+}
+
+std::vector<CpuID> Topology::_sibling_cpus(const CpuID cpu_id) {
+#ifdef __linux__
+  auto file =
+      std::ifstream{"/sys/devices/system/cpu/cpu" + std::to_string(cpu_id) + "/topology/thread_siblings_list"};
+  auto siblings = std::string{};
+  if (file && std::getline(file, siblings)) return _parse_cpu_list(siblings);
+#endif
+
+  return {cpu_id};
+}
+
+std::vector<CpuID> Topology::_one_cpu_per_core(const std::vector<CpuID>& cpus) {
+  auto kept_cpus = std::vector<CpuID>{};
+  for (const auto cpu_id : cpus) {
+    const auto sibling_cpus = _sibling_cpus(cpu_id);
+    const auto core_is_used = std::any_of(sibling_cpus.cbegin(), sibling_cpus.cend(), [&](const auto sibling_cpu_id) {
+      return std::find(kept_cpus.cbegin(), kept_cpus.cend(), sibling_cpu_id) != kept_cpus.cend();
+    });
+    if (!core_is_used) kept_cpus.emplace_back(cpu_id);
+  }
+  return kept_cpus;
+}
+
+std::vector<CpuID> Topology::_parse_cpu_list(const std::string& cpu_list) {
+  auto cpus = std::vector<CpuID>{};
+  auto stream = std::istringstream{cpu_list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    auto range_stream = std::istringstream{range};
+    auto first_cpu_id = uint32_t{0};
+    if (!(range_stream >> first_cpu_id)) continue;
+
+    auto last_cpu_id = first_cpu_id;
+    if (range_stream.peek() == '-') {
+      range_stream.ignore();
+      if (!(range_stream >> last_cpu_id)) continue;
+    }
+
+    for (auto cpu_id = first_cpu_id; cpu_id <= last_cpu_id; ++cpu_id) {
+      cpus.emplace_back(cpu_id);
+    }
+  }
+  return cpus;
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _num_cpus = 0;
+  _filtered_by_affinity = false;
+  _cgroup_cpu_limit = std::nullopt;
 }
 
 std::ostream& operator<<(std::ostream& stream, const Topology& topology) {
@@ -172,6 +332,9 @@ std::ostream& operator<<(std::ostream& stream, const Topology& topology) {
   if (topology._filtered_by_affinity) {
     stream << "Available CPUs / nodes were filtered by externally set CPU affinity (e.g., numactl)." << std::endl;
   }
+  if (topology._cgroup_cpu_limit) {
+    stream << "CPUs were limited to the cgroup CPU quota of " << *topology._cgroup_cpu_limit << " CPU(s)." << std::endl;
+  }
   for (size_t node_idx = 0; node_idx < topology.nodes().size(); ++node_idx) {
     stream << "Node #" << node_idx << " - ";
     stream << topology.nodes()[node_idx];
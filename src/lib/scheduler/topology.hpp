@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -23,12 +25,21 @@ struct TopologyNode final {
 
 std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node);
 
+// Memory-bound workloads often do not benefit from the second hardware thread of a core, but suffer from both threads
+// sharing the core's caches. With OnePerCore, only the first hardware thread (i.e., the one with the lowest CPU id) of
+// each core is used.
+enum class HyperthreadMode { All, OnePerCore };
+
 /**
  * Topology is a singleton that encapsulates the Machine Architecture, i.e. how many Nodes/Cores there are.
  * It is initialized with the actual system topology by default, but can be newly initialized with a custom topology
  * if needed, e.g. for testing purposes.
  *
  * The static 'use_*_topology()' methods replace the current topology information by the new one, and should be used carefully.
+ *
+ * Only the CPUs of the process' affinity mask are used, which is restricted by cpusets (e.g., of containers), taskset,
+ * numactl, or isolated cores. The default topology is additionally limited to the CPU quota of the process' cgroup
+ * (e.g., the CPU limit of a Kubernetes pod), as more workers than the quota would only be throttled.
  */
 class Topology final : public Noncopyable {
  public:
@@ -38,7 +49,7 @@ class Topology final : public Noncopyable {
    * Calls _init_default_topology() internally.
    * Calls _init_numa_topology() or _init_non_numa_topology() if on a NUMA or non-NUMA system respectively.
    */
-  void use_default_topology(uint32_t max_num_cores = 0);
+  void use_default_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
 
   /**
    * Use a NUMA topology.
@@ -49,7 +60,7 @@ class Topology final : public Noncopyable {
    * Calls _init_numa_topology() internally.
    * Calls _init_fake_numa_topology() if on a non-NUMA system.
    */
-  void use_numa_topology(uint32_t max_num_cores = 0);
+  void use_numa_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
 
   /**
    * Use a non-NUMA topology.
@@ -58,7 +69,7 @@ class Topology final : public Noncopyable {
    *
    * Calls _init_non_numa_topology() internally.
    */
-  void use_non_numa_topology(uint32_t max_num_cores = 0);
+  void use_non_numa_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
 
   /**
    * Use a fake-NUMA topology.
@@ -73,23 +84,63 @@ class Topology final : public Noncopyable {
 
   size_t num_cpus() const;
 
+  /**
+   * Size of the largest cache that is not shared between cores (the L2 cache on most systems) in bytes. It is read
+   * from the system when the Topology is created and falls back to DEFAULT_L2_CACHE_SIZE if the system does not
+   * report it (e.g., in some virtual machines). Operators use it to size their cache-resident data structures. For
+   * the sake of reproducible benchmarks or tests, it can be overwritten with set_l2_cache_size().
+   */
+  size_t l2_cache_size() const;
+  void set_l2_cache_size(const size_t l2_cache_size);
+
+  // The L2 cache size of an Intel Xeon Platinum 8180
+  static constexpr auto DEFAULT_L2_CACHE_SIZE = size_t{1'024'000};
+
  private:
   Topology();
 
   friend std::ostream& operator<<(std::ostream& stream, const Topology& topology);
   friend class Hyrise;
+  friend class TopologyTest;
 
-  void _init_default_topology(uint32_t max_num_cores = 0);
-  void _init_numa_topology(uint32_t max_num_cores = 0);
-  void _init_non_numa_topology(uint32_t max_num_cores = 0);
+  void _init_default_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
+  void _init_numa_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
+  void _init_non_numa_topology(uint32_t max_num_cores = 0, HyperthreadMode hyperthread_mode = HyperthreadMode::All);
   void _init_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
   void _clear();
 
+  static size_t _detect_l2_cache_size();
+
+  // Returns the CPUs of the process' affinity mask in ascending order. Sets _filtered_by_affinity if some of the
+  // system's CPUs are not part of it.
+  std::vector<CpuID> _available_cpus(HyperthreadMode hyperthread_mode);
+
+  // Returns the number of CPUs that the CPU quota of the process' cgroup (v2 or v1) grants, rounded up, if a quota is
+  // set
+  static std::optional<uint32_t> _detect_cgroup_cpu_limit();
+
+  // Returns the hardware threads of the CPU's core (including the CPU itself), as reported by the kernel
+  static std::vector<CpuID> _sibling_cpus(CpuID cpu_id);
+
+  // Keeps the first of the given CPUs of each core
+  static std::vector<CpuID> _one_cpu_per_core(const std::vector<CpuID>& cpus);
+
+  // Parse the contents of the cgroup v2 file cpu.max (e.g., "max 100000" or "150000 100000") and of the cgroup v1 files
+  // cpu.cfs_quota_us and cpu.cfs_period_us
+  static std::optional<uint32_t> _parse_cgroup_v2_cpu_limit(const std::string& cpu_max);
+  static std::optional<uint32_t> _parse_cgroup_v1_cpu_limit(const std::string& cfs_quota_us,
+                                                            const std::string& cfs_period_us);
+
+  // Parses a kernel CPU list (e.g., "0-3,8,10-11" in thread_siblings_list)
+  static std::vector<CpuID> _parse_cpu_list(const std::string& cpu_list);
+
   std::vector<TopologyNode> _nodes;
   uint32_t _num_cpus{0};
   bool _fake_numa_topology{false};
   bool _filtered_by_affinity{false};
+  std::optional<uint32_t> _cgroup_cpu_limit;
+  size_t _l2_cache_size{DEFAULT_L2_CACHE_SIZE};
 
   static const int _number_of_hardware_nodes;
 };
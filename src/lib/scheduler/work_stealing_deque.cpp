@@ -0,0 +1,127 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The deque stores heap-allocated task references, so that slots can be read and written atomically. Whoever removes
+// a slot from the deque (the owner in pop() or a thief in steal()) takes over its reference.
+std::shared_ptr<AbstractTask> take_task(std::shared_ptr<AbstractTask>* const task_reference) {
+  auto task = std::move(*task_reference);
+  delete task_reference;  // NOLINT
+  return task;
+}
+
+}  // namespace
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(static_cast<int64_t>(init_capacity)), slots(init_capacity) {
+  DebugAssert((init_capacity & (init_capacity - 1)) == 0, "Capacity has to be a power of two");
+}
+
+std::shared_ptr<AbstractTask>* WorkStealingDeque::Buffer::get(const int64_t index) const {
+  return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(const int64_t index, std::shared_ptr<AbstractTask>* const task) {
+  slots[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    take_task(buffer->get(index));
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > buffer->capacity - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));  // NOLINT
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* const task_reference = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task, which thieves might try to steal at the same time
+    const auto won_race =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won_race) return nullptr;
+  }
+
+  return take_task(task_reference);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto* const task_reference = _buffer.load(std::memory_order_acquire)->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Another thief or the owner took the task first
+    return nullptr;
+  }
+
+  return take_task(task_reference);
+}
+
+bool WorkStealingDeque::empty() const {
+  return _top.load(std::memory_order_acquire) >= _bottom.load(std::memory_order_acquire);
+}
+
+size_t WorkStealingDeque::estimated_size() const {
+  const auto top = _top.load(std::memory_order_acquire);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* const buffer, const int64_t top, const int64_t bottom) {
+  _buffers.emplace_back(std::make_unique<Buffer>(static_cast<size_t>(buffer->capacity) * 2));
+  auto* const grown_buffer = _buffers.back().get();
+  for (auto index = top; index < bottom; ++index) {
+    grown_buffer->put(index, buffer->get(index));
+  }
+
+  _buffer.store(grown_buffer, std::memory_order_release);
+  return grown_buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005), using the memory
+ * orders of Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+ *
+ * Each Worker owns one deque. Only the owner pushes and pops tasks at the bottom (LIFO), so that it continues with the
+ * task it spawned last while the caches are still fresh. Other workers steal the oldest tasks from the top (FIFO).
+ * The deque owns a reference to each of its tasks. Buffers that were replaced when the deque grew are kept until the
+ * deque is destroyed, as thieves might still read from them.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 1'024);
+  ~WorkStealingDeque();
+
+  // May only be called by the owner
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // May only be called by the owner. Returns nullptr if the deque is empty.
+  std::shared_ptr<AbstractTask> pop();
+
+  // May be called by any thread. Returns nullptr if the deque is empty or another thread took the task first.
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+  // May be called by any thread. As the owner and thieves modify the deque concurrently, the size is only an estimate.
+  size_t estimated_size() const;
+
+ private:
+  // A circular array of task references, whose capacity is a power of two
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    std::shared_ptr<AbstractTask>* get(const int64_t index) const;
+    void put(const int64_t index, std::shared_ptr<AbstractTask>* const task);
+
+    const int64_t capacity;
+    std::vector<std::atomic<std::shared_ptr<AbstractTask>*>> slots;
+  };
+
+  Buffer* _grow(Buffer* const buffer, const int64_t top, const int64_t bottom);
+
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -4,6 +4,8 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -60,13 +62,25 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // If execute_next has been called, run that task first. Otherwise, try to retrieve the task pushed last to our own
+  // deque, a task from the node's queue, or one stolen from another worker of the node.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
   } else {
-    task = _queue->pull();
+    task = _deque.pop();
+    if (!task) task = _queue->pull();
+  }
+
+  if (!task) {
+    // Start with the next worker so that idle workers do not all steal from the same one
+    const auto node_worker_count = _node_workers.size();
+    for (auto offset = size_t{1}; offset <= node_worker_count && !task; ++offset) {
+      task = _node_workers[(_next_victim + offset) % node_worker_count]->steal_task();
+    }
+    _next_victim = (_next_victim + 1) % std::max(node_worker_count, size_t{1});
+    if (task) _num_stolen_tasks.fetch_add(1, std::memory_order_relaxed);
   }
 
   if (!task) {
@@ -81,6 +95,7 @@ void Worker::_work() {
       if (task) {
         task->set_node_id(_queue->node_id());
         work_stealing_successful = true;
+        _num_stolen_tasks.fetch_add(1, std::memory_order_relaxed);
         break;
       }
     }
@@ -88,10 +103,14 @@ void Worker::_work() {
     // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
     // own queue or returns after timer exceeded (whatever occurs first).
     if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
+      const auto wait_begin = std::chrono::steady_clock::now();
+      _queue->wait_for_task(WORKER_SLEEP_TIME, [&]() {
+        return std::any_of(_node_workers.cbegin(), _node_workers.cend(),
+                           [](const auto* node_worker) { return !node_worker->_deque.empty(); });
+      });
+      const auto wait_time = std::chrono::steady_clock::now() - wait_begin;
+      _idle_time_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time).count(),
+                              std::memory_order_relaxed);
       return;
     }
   }
@@ -102,7 +121,30 @@ void Worker::_work() {
     return;
   }
 
+  _execute(task);
+}
+
+void Worker::_execute(const std::shared_ptr<AbstractTask>& task) {
+  const auto execution_begin = std::chrono::steady_clock::now();
+
+  const auto wait_time_us = std::max<int64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(execution_begin - task->enqueue_time()).count(), 0);
+  // Bucket i holds wait times in [2^(i-1), 2^i) microseconds, bucket 0 those below one microsecond
+  const auto bucket_id = std::min(static_cast<size_t>(std::bit_width(static_cast<uint64_t>(wait_time_us))),
+                                  WorkerStatistics::TASK_WAIT_TIME_BUCKET_COUNT - 1);
+  _task_wait_times[static_cast<uint32_t>(task->priority())][bucket_id].fetch_add(1, std::memory_order_relaxed);
+
+  // Tasks executed while another task waits for its subtasks (see _wait_for_tasks) are part of the outer task's
+  // busy time
+  ++_execution_depth;
   task->execute();
+  --_execution_depth;
+
+  if (_execution_depth == 0) {
+    const auto execution_time = std::chrono::steady_clock::now() - execution_begin;
+    _busy_time_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(execution_time).count(),
+                            std::memory_order_relaxed);
+  }
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
@@ -126,10 +168,50 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
   } else {
-    _queue->push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    push_task(task);
+  }
+}
+
+void Worker::set_node_workers(const std::vector<Worker*>& node_workers) {
+  _node_workers.clear();
+  for (auto* const node_worker : node_workers) {
+    if (node_worker != this) _node_workers.emplace_back(node_worker);
   }
 }
 
+void Worker::push_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this,
+              "push_task must be called from the same thread that the worker works in");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque.push(task);
+
+  // Idle workers of the node can steal the task
+  _queue->notify_waiting_worker();
+}
+
+void Worker::push_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  DebugAssert(&*get_this_thread_worker() == this,
+              "push_tasks must be called from the same thread that the worker works in");
+
+  auto pushed_task_count = size_t{0};
+  for (const auto& task : tasks) {
+    if (!task->try_mark_as_enqueued()) continue;
+
+    task->set_node_id(_queue->node_id());
+    _deque.push(task);
+    ++pushed_task_count;
+  }
+
+  // This worker takes the last pushed task itself, the others can be stolen
+  _queue->notify_waiting_workers(pushed_task_count > 0 ? pushed_task_count - 1 : 0);
+}
+
+std::shared_ptr<AbstractTask> Worker::steal_task() { return _deque.steal(); }
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -139,6 +221,24 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+WorkerStatistics Worker::statistics() const {
+  auto statistics = WorkerStatistics{};
+  statistics.num_finished_tasks = _num_finished_tasks;
+  statistics.num_stolen_tasks = _num_stolen_tasks.load(std::memory_order_relaxed);
+  statistics.busy_time = std::chrono::nanoseconds{_busy_time_ns.load(std::memory_order_relaxed)};
+  statistics.idle_time = std::chrono::nanoseconds{_idle_time_ns.load(std::memory_order_relaxed)};
+  statistics.deque_size = _deque.estimated_size();
+
+  for (auto priority = uint32_t{0}; priority < TaskQueue::NUM_PRIORITY_LEVELS; ++priority) {
+    for (auto bucket_id = size_t{0}; bucket_id < WorkerStatistics::TASK_WAIT_TIME_BUCKET_COUNT; ++bucket_id) {
+      statistics.task_wait_times[priority][bucket_id] =
+          _task_wait_times[priority][bucket_id].load(std::memory_order_relaxed);
+    }
+  }
+
+  return statistics;
+}
+
 void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
   // This lambda checks if all tasks from the vector (our "own" tasks) have been executed. If they are, it causes
   // _wait_for_tasks to return. If there are remaining tasks, it primarily tries to execute these. If they cannot be
@@ -186,8 +286,7 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
       }
 
       // Actually execute it.
-      task->execute();
-      ++_num_finished_tasks;
+      _execute(task);
 
       // Reset loop so that we re-visit tasks that may have finished in the meantime. We need to decrement `it` because
       // it will be incremented when the loop iteration finishes.
@@ -1,17 +1,39 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-class TaskQueue;
+/**
+ * Snapshot of the counters of a Worker, e.g., for the scheduler meta tables. Bucket i of a task wait time histogram
+ * counts the tasks that waited for less than 2^i microseconds between being enqueued and being executed. The last
+ * bucket counts all tasks that waited longer.
+ */
+struct WorkerStatistics {
+  static constexpr auto TASK_WAIT_TIME_BUCKET_COUNT = size_t{24};
+
+  uint64_t num_finished_tasks{0};
+  uint64_t num_stolen_tasks{0};
+
+  // Busy time includes the time that a task waits for its subtasks, idle time the time without any executable task
+  std::chrono::nanoseconds busy_time{0};
+  std::chrono::nanoseconds idle_time{0};
+
+  size_t deque_size{0};
+
+  std::array<std::array<uint64_t, TASK_WAIT_TIME_BUCKET_COUNT>, TaskQueue::NUM_PRIORITY_LEVELS> task_wait_times{};
+};
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
@@ -35,15 +57,34 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   void start();
   void join();
 
+  // Sets the other workers of the same node, from whose deques this worker steals when it runs out of tasks. The
+  // workers are owned by the scheduler, which joins all of them before they are destroyed.
+  void set_node_workers(const std::vector<Worker*>& node_workers);
+
+  // Pushes a task to this worker's deque, from which it is executed before all other tasks. Must be called from the
+  // thread that the worker works in.
+  void push_task(const std::shared_ptr<AbstractTask>& task);
+
+  // Pushes multiple tasks to this worker's deque and wakes up as many idle workers of the node as needed. Must be
+  // called from the thread that the worker works in.
+  void push_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // Takes the oldest task from this worker's deque. May be called from any thread.
+  std::shared_ptr<AbstractTask> steal_task();
+
   // Try to execute task immediately after this worker finishes the execution of the current task. The goal is to
   // execute the task while the caches are still fresh instead of having to wait for it to be scheduled again. A task
   // can have multiple successors and all of them could become executable at the same time. In that case, the current
-  // worker can only execute one of them immediately. The others are placed into a high priority queue on the same node
-  // so that they are worked on as soon as possible by either this or another worker.
+  // worker can only execute one of them immediately. The others are pushed to the worker's deque so that they are
+  // worked on as soon as possible by either this or (after stealing) another worker of the node.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
   uint64_t num_finished_tasks() const;
 
+  // May be called by any thread while the worker is running. The counters are read one after another and do not
+  // necessarily reflect a single point in time.
+  WorkerStatistics statistics() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -60,15 +101,30 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  // Executes a task that was assigned to this worker and updates the statistics
+  void _execute(const std::shared_ptr<AbstractTask>& task);
+
   std::shared_ptr<AbstractTask> _next_task{};
+  WorkStealingDeque _deque;
+  std::vector<Worker*> _node_workers;
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
 
+  // Statistics, only written by the worker's thread
+  std::atomic<uint64_t> _num_stolen_tasks{0};
+  std::atomic<uint64_t> _busy_time_ns{0};
+  std::atomic<uint64_t> _idle_time_ns{0};
+  std::array<std::array<std::atomic<uint64_t>, WorkerStatistics::TASK_WAIT_TIME_BUCKET_COUNT>,
+             TaskQueue::NUM_PRIORITY_LEVELS>
+      _task_wait_times{};
+  uint32_t _execution_depth{0};
+
   std::vector<int> _random{};
   size_t _next_random{};
+  size_t _next_victim{};
 };
 
 }  // namespace opossum
@@ -22,6 +22,8 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
@@ -38,6 +40,11 @@ enum class PostgresMessageType : unsigned char {
   ParseCommand = 'P',
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
+  CopyFailCommand = 'f',
+
+  // COPY data is sent by the client for COPY FROM STDIN and by the server for COPY TO STDOUT
+  CopyData = 'd',
+  CopyDone = 'c',
 
   // SSL willingness
   SslYes = 'S',
@@ -53,5 +60,6 @@ enum class TransactionStatusIndicator : unsigned char {
 
 // SQL error codes
 constexpr char TRANSACTION_CONFLICT[] = "40001";
+constexpr char OUT_OF_MEMORY[] = "53200";
 
 }  // namespace opossum
@@ -1,5 +1,28 @@
 #include "postgres_protocol_handler.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Startup packets start with the length field, all other packets with the message type followed by the length field
+size_t packet_header_size(const bool is_startup_packet) {
+  return (is_startup_packet ? 0 : sizeof(PostgresMessageType)) + LENGTH_FIELD_SIZE;
+}
+
+template <typename T>
+void append_network_value(std::string& data, const T value) {
+  T converted_value;
+  if constexpr (sizeof(T) == sizeof(uint16_t)) {
+    converted_value = htons(value);
+  } else {
+    static_assert(sizeof(T) == sizeof(uint32_t));
+    converted_value = htonl(value);
+  }
+  data.append(reinterpret_cast<const char*>(&converted_value), sizeof(T));
+}
+
+}  // namespace
+
 namespace opossum {
 
 template <typename SocketType>
@@ -27,9 +50,8 @@ uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::read_startup_packet_body(const uint32_t size) {
   // As of now, we do not do anything with the startup packet body. It contains authentication data and the
-  // database name the user desires to connect to. Hence, we read this information from the network device as
-  // one large string and throw it away.
-  _read_buffer.get_string(size, HasNullTerminator::No);
+  // database name the user desires to connect to. Hence, we skip this information.
+  _read_buffer.skip(size);
 }
 
 template <typename SocketType>
@@ -59,11 +81,43 @@ void PostgresProtocolHandler<SocketType>::send_ready_for_query() {
   _write_buffer.flush();
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::async_receive_packet(
+    const bool is_startup_packet, std::function<void(const boost::system::error_code&)> handler) {
+  const auto header_size = packet_header_size(is_startup_packet);
+  _read_buffer.async_receive(header_size, [this, header_size, handler = std::move(handler)](const auto& error_code) {
+    if (error_code) {
+      handler(error_code);
+      return;
+    }
+
+    // The packet length includes the length field, but not the message type
+    const auto packet_length = _read_buffer.template peek_value<uint32_t>(header_size - LENGTH_FIELD_SIZE);
+    const auto packet_size = header_size - LENGTH_FIELD_SIZE + packet_length;
+    _read_buffer.async_receive(std::min(packet_size, _read_buffer.maximum_capacity()), handler);
+  });
+}
+
+template <typename SocketType>
+bool PostgresProtocolHandler<SocketType>::is_packet_buffered(const bool is_startup_packet) {
+  const auto header_size = packet_header_size(is_startup_packet);
+  if (_read_buffer.size() < header_size) return false;
+
+  const auto packet_length = _read_buffer.template peek_value<uint32_t>(header_size - LENGTH_FIELD_SIZE);
+  const auto packet_size = header_size - LENGTH_FIELD_SIZE + packet_length;
+  return _read_buffer.size() >= std::min(packet_size, _read_buffer.maximum_capacity());
+}
+
 template <typename SocketType>
 PostgresMessageType PostgresProtocolHandler<SocketType>::read_packet_type() {
   return static_cast<PostgresMessageType>(_read_buffer.template get_value<char>());
 }
 
+template <typename SocketType>
+PostgresMessageType PostgresProtocolHandler<SocketType>::peek_packet_type() {
+  return static_cast<PostgresMessageType>(_read_buffer.template peek_value<char>());
+}
+
 template <typename SocketType>
 std::string PostgresProtocolHandler<SocketType>::read_query_packet() {
   const auto query_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
@@ -89,7 +143,8 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width,
+                                                               const ResultFormat result_format) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,39 +154,51 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(result_format));
 }
 
 template <typename SocketType>
-void PostgresProtocolHandler<SocketType>::send_data_row(
-    const std::vector<std::optional<std::string>>& values_as_strings, const uint32_t string_length_sum) {
+void PostgresProtocolHandler<SocketType>::send_data_row(const std::vector<std::optional<std::string_view>>& values,
+                                                        const uint32_t value_length_sum) {
+  auto data_row = std::string{};
+  serialize_data_row(data_row, values, value_length_sum);
+  send_data_rows(data_row);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::serialize_data_row(
+    std::string& data_rows, const std::vector<std::optional<std::string_view>>& values,
+    const uint32_t value_length_sum) {
   // The documentation of the fields in this message can be found at:
   // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
 
-  _write_buffer.template put_value(PostgresMessageType::DataRow);
+  data_rows.push_back(static_cast<char>(PostgresMessageType::DataRow));
 
-  const auto packet_size =
-      LENGTH_FIELD_SIZE + sizeof(uint16_t) + values_as_strings.size() * LENGTH_FIELD_SIZE + string_length_sum;
-
-  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(uint16_t) + values.size() * LENGTH_FIELD_SIZE + value_length_sum;
+  append_network_value(data_rows, static_cast<uint32_t>(packet_size));
 
   // Number of columns in row
-  _write_buffer.template put_value<uint16_t>(static_cast<uint16_t>(values_as_strings.size()));
+  append_network_value(data_rows, static_cast<uint16_t>(values.size()));
 
-  for (const auto& value_string : values_as_strings) {
-    if (value_string.has_value()) {
-      // Size of string representation of value, NOT of value type's size
-      _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(value_string.value().size()));
+  for (const auto& value : values) {
+    if (value.has_value()) {
+      // Size of the serialized value, which is the value type's size only in binary format
+      append_network_value(data_rows, static_cast<uint32_t>(value->size()));
 
-      // Text mode means all values are sent as non-terminated strings
-      _write_buffer.put_string(value_string.value(), HasNullTerminator::No);
+      // Both text and binary values are sent without a null terminator
+      data_rows.append(*value);
     } else {
       // NULL values are represented by setting the value's length to -1
-      _write_buffer.template put_value<int32_t>(-1);
+      append_network_value(data_rows, int32_t{-1});
     }
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_data_rows(const std::string_view data_rows) {
+  _write_buffer.put_bytes(data_rows);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -181,9 +248,9 @@ void PostgresProtocolHandler<SocketType>::read_describe_packet() {
 
   Assert(description_target == 'P', "Only portal descriptions are currently supported.");
 
-  // The description itself will be sent out after execution of the prepared statement.
-  /* const auto statement_or_portal_name = */ _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE - sizeof(char),
-                                                                      HasNullTerminator::No);
+  // The description itself will be sent out after execution of the prepared statement. Hence, the name of the
+  // statement or portal is skipped.
+  _read_buffer.skip(packet_size - LENGTH_FIELD_SIZE - sizeof(char));
 }
 
 template <typename SocketType>
@@ -202,16 +269,19 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
   std::vector<AllTypeVariant> parameter_values;
   for (auto i = 0; i < num_parameter_values; ++i) {
     const auto parameter_value_length = _read_buffer.template get_value<int32_t>();
-    parameter_values.emplace_back(pmr_string{_read_buffer.get_string(parameter_value_length, HasNullTerminator::No)});
+    parameter_values.emplace_back(pmr_string{_read_buffer.get_string_view(parameter_value_length)});
   }
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
+  auto result_formats = std::vector<ResultFormat>{};
   for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    Assert(format_code == 0 || format_code == 1, "Result columns can only be in text (0) or binary (1) format");
+    result_formats.emplace_back(static_cast<ResultFormat>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_formats};
 }
 
 template <typename SocketType>
@@ -227,6 +297,49 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
   return portal;
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_response(const PostgresMessageType message_type,
+                                                             const uint16_t column_count) {
+  // The documentation of the fields in this message can be found at:
+  // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+  _write_buffer.template put_value(message_type);
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(int8_t) + sizeof(uint16_t) + column_count * sizeof(int16_t);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  _write_buffer.template put_value<char>(static_cast<char>(ResultFormat::Text));
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_index = uint16_t{0}; column_index < column_count; ++column_index) {
+    _write_buffer.template put_value<int16_t>(static_cast<int16_t>(ResultFormat::Text));
+  }
+
+  // For COPY FROM STDIN, the client waits for the response before it sends the data
+  if (message_type == PostgresMessageType::CopyInResponse) _write_buffer.flush();
+}
+
+template <typename SocketType>
+std::string_view PostgresProtocolHandler<SocketType>::read_copy_data_packet() {
+  const auto data_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string_view(data_length);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string_view data) {
+  _write_buffer.template put_value(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_bytes(data);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_copy_done_packet() {
+  // This packet has no body. Hence, only read and ignore its size.
+  _read_buffer.template get_value<uint32_t>();
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_fail_packet() {
+  const auto message_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string(message_length);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_error_message(const ErrorMessage& error_message) {
   _write_buffer.template put_value(PostgresMessageType::ErrorResponse);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <string_view>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
@@ -11,11 +13,13 @@ namespace opossum {
 
 using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the requested result
+// formats. Following the protocol, no format means text for all columns, while a single format applies to all columns.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<ResultFormat> result_formats{};
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -36,17 +40,33 @@ class PostgresProtocolHandler {
   // Ready to receive a new packet
   void send_ready_for_query();
 
+  // Receive the next packet without blocking. Once the handler is called without an error, reading the packet does not
+  // block unless the packet is larger than the read buffer. Startup packets are the only ones without a message type.
+  void async_receive_packet(const bool is_startup_packet,
+                            std::function<void(const boost::system::error_code&)> handler);
+
+  // Check whether the next packet has been received completely (see above)
+  bool is_packet_buffered(const bool is_startup_packet);
+
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
+  // Determine the type of a received packet without consuming it
+  PostgresMessageType peek_packet_type();
+
   // Read SQL query packet
   std::string read_query_packet();
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
-  void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
-                     const uint32_t string_length_sum);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const ResultFormat result_format = ResultFormat::Text);
+  // The values are already serialized in the format announced in the row description, std::nullopt being NULL
+  void send_data_row(const std::vector<std::optional<std::string_view>>& values, const uint32_t value_length_sum);
+  // Many rows can be serialized into a single string and sent at once, which avoids copying them into the write buffer
+  static void serialize_data_row(std::string& data_rows, const std::vector<std::optional<std::string_view>>& values,
+                                 const uint32_t value_length_sum);
+  void send_data_rows(const std::string_view data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
@@ -61,6 +81,14 @@ class PostgresProtocolHandler {
   PreparedStatementDetails read_bind_packet();
   std::string read_execute_packet();
 
+  // Messages of COPY FROM STDIN and COPY TO STDOUT. All columns are transferred in text format, which includes CSV.
+  void send_copy_response(const PostgresMessageType message_type, const uint16_t column_count);
+  // The view is only valid until the next packet is read
+  std::string_view read_copy_data_packet();
+  void send_copy_data(const std::string_view data);
+  void read_copy_done_packet();
+  std::string read_copy_fail_packet();
+
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessage& error_message);
 
@@ -1,15 +1,82 @@
 #include "query_handler.hpp"
 
+#include <algorithm>
+#include <regex>
+
+#include <boost/algorithm/string.hpp>
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/static_table_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractExpression>> value_expressions(const std::vector<AllTypeVariant>& values) {
+  auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  expressions.reserve(values.size());
+  for (const auto& value : values) {
+    expressions.emplace_back(std::make_shared<ValueExpression>(value));
+  }
+  return expressions;
+}
+
+std::shared_ptr<AbstractLQPNode> optimize_instantiated_plan(
+    const PreparedPlan& prepared_plan, const std::vector<std::shared_ptr<AbstractExpression>>& parameter_expressions) {
+  const auto optimizer = Optimizer::create_default_optimizer();
+  return optimizer->optimize(prepared_plan.instantiate(parameter_expressions));
+}
+
+bool lqp_contains_subquery(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto contains_subquery = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSubquery) contains_subquery = true;
+        return contains_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+      });
+    }
+    return contains_subquery ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return contains_subquery;
+}
+
+// Copy the generic LQP with the parameters replaced by their values, so that its cost can be estimated for them
+std::shared_ptr<AbstractLQPNode> bind_parameter_values(const std::shared_ptr<AbstractLQPNode>& generic_lqp,
+                                                       const std::unordered_map<ParameterID, AllTypeVariant>& values) {
+  const auto lqp = generic_lqp->deep_copy();
+  visit_lqp(lqp, [&](const auto& node) {
+    for (auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](auto& sub_expression) {
+        if (const auto parameter_expression =
+                std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression)) {
+          sub_expression = std::make_shared<ValueExpression>(values.at(parameter_expression->parameter_id));
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  return lqp;
+}
+
+}  // namespace
 
 namespace opossum {
 
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
     const std::string& query, const SendExecutionInfo send_execution_info,
-    const std::shared_ptr<TransactionContext>& transaction_context) {
+    const std::shared_ptr<TransactionContext>& transaction_context, const SessionID session_id) {
   // A simple query command invalidates unnamed statements
   // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
   if (Hyrise::get().storage_manager.has_prepared_plan("")) Hyrise::get().storage_manager.drop_prepared_plan("");
@@ -18,7 +85,10 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
               "Auto-commit transaction contexts should not be passed around this far");
 
   auto execution_info = ExecutionInformation();
-  auto sql_pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  auto sql_pipeline = SQLPipelineBuilder{query}
+                          .with_transaction_context(transaction_context)
+                          .with_session_id(session_id)
+                          .create_pipeline();
 
   const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
 
@@ -34,12 +104,21 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
       execution_info.pipeline_metrics = stream.str();
     }
   } else if (pipeline_status == SQLPipelineStatus::Failure) {
-    const std::string failed_statement = sql_pipeline.failed_pipeline_statement()->get_sql_string();
-    execution_info.error_message = {{PostgresMessageType::HumanReadableError,
-                                     "Transaction conflict, transaction was rolled back. Following statements might "
-                                     "have still been sent and executed. Failed statement: " +
-                                         failed_statement},
-                                    {PostgresMessageType::SqlstateCodeError, TRANSACTION_CONFLICT}};
+    const auto& failed_pipeline_statement = sql_pipeline.failed_pipeline_statement();
+    const std::string failed_statement = failed_pipeline_statement->get_sql_string();
+    if (failed_pipeline_statement->metrics()->memory_limit_exceeded) {
+      execution_info.error_message = {{PostgresMessageType::HumanReadableError,
+                                       "Statement exceeded the memory limit, transaction was rolled back. Following "
+                                       "statements might have still been sent and executed. Failed statement: " +
+                                           failed_statement},
+                                      {PostgresMessageType::SqlstateCodeError, OUT_OF_MEMORY}};
+    } else {
+      execution_info.error_message = {{PostgresMessageType::HumanReadableError,
+                                       "Transaction conflict, transaction was rolled back. Following statements might "
+                                       "have still been sent and executed. Failed statement: " +
+                                           failed_statement},
+                                      {PostgresMessageType::SqlstateCodeError, TRANSACTION_CONFLICT}};
+    }
   }
   return {execution_info, sql_pipeline.transaction_context()};
 }
@@ -79,24 +158,193 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
 
   const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_details.statement_name);
 
-  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{statement_details.parameters.size()};
-  for (auto parameter_idx = size_t{0}; parameter_idx < statement_details.parameters.size(); ++parameter_idx) {
-    parameter_expressions[parameter_idx] =
-        std::make_shared<ValueExpression>(statement_details.parameters[parameter_idx]);
+  const auto lqp = optimize_instantiated_plan(*prepared_plan, value_expressions(statement_details.parameters));
+
+  auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  return pqp;
+}
+
+std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const PreparedStatementDetails& statement_details,
+                                                                   PreparedPlanCache& prepared_plan_cache) {
+  AssertInput(Hyrise::get().storage_manager.has_prepared_plan(statement_details.statement_name),
+              "The specified statement does not exist.");
+
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_details.statement_name);
+  const auto& parameters = statement_details.parameters;
+  AssertInput(parameters.size() == prepared_plan->parameter_ids.size(), "Incorrect number of parameters supplied");
+
+  auto parameter_data_types = std::vector<DataType>{};
+  auto parameters_by_id = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameters.size(); ++parameter_idx) {
+    parameter_data_types.emplace_back(data_type_from_all_type_variant(parameters[parameter_idx]));
+    parameters_by_id.emplace(prepared_plan->parameter_ids[parameter_idx], parameters[parameter_idx]);
+  }
+
+  // The statement might have been redefined since its generic plan was created, possibly by another session
+  auto& entry = prepared_plan_cache[statement_details.statement_name];
+  if (entry.prepared_plan != prepared_plan || entry.parameter_data_types != parameter_data_types) {
+    entry = PreparedPlanCacheEntry{};
+    entry.prepared_plan = prepared_plan;
+    entry.parameter_data_types = parameter_data_types;
+
+    if (lqp_contains_subquery(prepared_plan->lqp)) {
+      entry.custom_plan_count = CUSTOM_PLAN_COUNT;
+    } else {
+      // In the generic plan, the parameters are CorrelatedParameterExpressions, which the operators resolve when they
+      // are executed
+      auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+      for (auto parameter_idx = size_t{0}; parameter_idx < parameters.size(); ++parameter_idx) {
+        const auto referenced_expression_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+            parameter_data_types[parameter_idx], "parameter_" + std::to_string(parameter_idx)};
+        parameter_expressions.emplace_back(std::make_shared<CorrelatedParameterExpression>(
+            prepared_plan->parameter_ids[parameter_idx], referenced_expression_info));
+      }
+      entry.generic_lqp = optimize_instantiated_plan(*prepared_plan, parameter_expressions);
+
+      if (parameters.empty()) {
+        entry.generic_pqp = LQPTranslator{}.translate_node(entry.generic_lqp);
+        entry.generic_lqp = nullptr;
+        entry.custom_plan_count = CUSTOM_PLAN_COUNT;
+      }
+    }
+  }
+
+  if (entry.custom_plan_count < CUSTOM_PLAN_COUNT) {
+    const auto custom_lqp = optimize_instantiated_plan(*prepared_plan, value_expressions(parameters));
+
+    const auto cost_estimator = CostEstimatorLogical{std::make_shared<CardinalityEstimator>()};
+    entry.custom_plan_cost_sum += cost_estimator.estimate_plan_cost(custom_lqp);
+    entry.generic_plan_cost_sum +=
+        cost_estimator.estimate_plan_cost(bind_parameter_values(entry.generic_lqp, parameters_by_id));
+    ++entry.custom_plan_count;
+
+    if (entry.custom_plan_count == CUSTOM_PLAN_COUNT) {
+      if (entry.generic_plan_cost_sum <= entry.custom_plan_cost_sum * GENERIC_PLAN_COST_FACTOR) {
+        entry.generic_pqp = LQPTranslator{}.translate_node(entry.generic_lqp);
+      }
+      entry.generic_lqp = nullptr;
+    }
+
+    return LQPTranslator{}.translate_node(custom_lqp);
+  }
+
+  if (!entry.generic_pqp) return bind_prepared_plan(statement_details);
+
+  // The cached plan itself is never executed, so that each execution starts with a plan without results
+  const auto pqp = entry.generic_pqp->deep_copy();
+  pqp->set_parameters(parameters_by_id);
+  return pqp;
+}
+
+bool QueryHandler::is_batchable_insert(const std::string& statement_name) {
+  if (!Hyrise::get().storage_manager.has_prepared_plan(statement_name)) return false;
+
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_name);
+  const auto& lqp = prepared_plan->lqp;
+  if (lqp->type != LQPNodeType::Insert || prepared_plan->parameter_ids.empty()) return false;
+
+  // INSERT ... VALUES is translated to a projection of the values on a DummyTableNode (see SQLTranslator)
+  const auto& values_node = lqp->left_input();
+  return values_node->type == LQPNodeType::Projection && values_node->left_input()->type == LQPNodeType::DummyTable;
+}
+
+std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_insert_batch(
+    const std::string& statement_name, const std::vector<std::vector<AllTypeVariant>>& parameter_rows) {
+  DebugAssert(is_batchable_insert(statement_name), "Statement cannot be executed as a batch");
+  DebugAssert(!parameter_rows.empty(), "Expected at least one execution");
+
+  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_name);
+  const auto parameter_count = prepared_plan->parameter_ids.size();
+
+  // Parameters received from the client are strings. The casts of the VALUES projection convert them to the column
+  // types, just as for a single execution.
+  AssertInput(parameter_rows.front().size() == parameter_count, "Incorrect number of parameters supplied");
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    auto data_type = data_type_from_all_type_variant(parameter_rows.front()[parameter_idx]);
+    if (data_type == DataType::Null) data_type = DataType::String;
+    column_definitions.emplace_back("parameter_" + std::to_string(parameter_idx), data_type, true);
+  }
+
+  const auto parameter_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto& parameters : parameter_rows) {
+    AssertInput(parameters.size() == parameter_count, "Incorrect number of parameters supplied");
+    parameter_table->append(parameters);
+  }
+
+  const auto parameter_node = StaticTableNode::make(parameter_table);
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{parameter_count};
+  for (auto parameter_idx = ColumnID{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    parameter_expressions[parameter_idx] = expression_functional::lqp_column_(parameter_node, parameter_idx);
   }
 
   auto lqp = prepared_plan->instantiate(parameter_expressions);
+  lqp->left_input()->set_left_input(parameter_node);
+
   const auto optimizer = Optimizer::create_default_optimizer();
   lqp = optimizer->optimize(std::move(lqp));
 
-  auto pqp = LQPTranslator{}.translate_node(lqp);
+  return LQPTranslator{}.translate_node(lqp);
+}
 
-  return pqp;
+std::optional<CopyStatement> QueryHandler::parse_copy_statement(const std::string& query) {
+  // COPY table_name FROM STDIN [options] or COPY { table_name | (query) } TO STDOUT [options]
+  static const auto copy_regex =
+      std::regex{R"(^\s*COPY\s+(?:(\w+)|\((.+)\))\s+(FROM\s+STDIN|TO\s+STDOUT)\b(.*?);?\s*$)", std::regex::icase};
+  // The regex does not match line breaks
+  auto single_line_query = query;
+  std::replace(single_line_query.begin(), single_line_query.end(), '\n', ' ');
+  std::replace(single_line_query.begin(), single_line_query.end(), '\r', ' ');
+  auto match = std::smatch{};
+  if (!std::regex_match(single_line_query, match, copy_regex)) return std::nullopt;
+
+  auto copy_statement = CopyStatement{};
+  copy_statement.is_copy_from_stdin = boost::algorithm::istarts_with(match.str(3), "FROM");
+  copy_statement.table_name = match.str(1);
+  AssertInput(!copy_statement.is_copy_from_stdin || !copy_statement.table_name.empty(),
+              "COPY FROM STDIN requires a table");
+  copy_statement.query =
+      copy_statement.table_name.empty() ? match.str(2) : "SELECT * FROM " + copy_statement.table_name;
+
+  // The options are a list of words, which may be enclosed in parentheses and separated by commas
+  auto options = boost::algorithm::to_lower_copy(match.str(4));
+  for (auto& character : options) {
+    if (character == '(' || character == ')' || character == ',') character = ' ';
+  }
+  auto words = std::vector<std::string>{};
+  boost::algorithm::split(words, options, boost::algorithm::is_space(), boost::algorithm::token_compress_on);
+  words.erase(std::remove(words.begin(), words.end(), ""), words.end());
+
+  auto is_csv = false;
+  for (auto word_iter = words.begin(); word_iter != words.end(); ++word_iter) {
+    const auto next_word = std::next(word_iter) != words.end() ? *std::next(word_iter) : std::string{};
+    if (*word_iter == "with") {
+      continue;
+    } else if (*word_iter == "csv") {
+      is_csv = true;
+    } else if (*word_iter == "format") {
+      AssertInput(next_word == "csv", "COPY only supports the CSV format");
+      is_csv = true;
+      ++word_iter;
+    } else if (*word_iter == "header") {
+      copy_statement.has_header = next_word != "false" && next_word != "off";
+      if (next_word == "true" || next_word == "on" || next_word == "false" || next_word == "off") ++word_iter;
+    } else {
+      FailInput("Unsupported COPY option: " + *word_iter);
+    }
+  }
+  AssertInput(is_csv, "COPY only supports the CSV format, use FORMAT csv");
+
+  return copy_statement;
 }
 
 std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
-    const std::shared_ptr<AbstractOperator>& physical_plan) {
+    const std::shared_ptr<AbstractOperator>& physical_plan, const SessionID session_id) {
   const auto tasks = OperatorTask::make_tasks_from_operator(physical_plan);
+
+  const auto& admission_control = Hyrise::get().admission_control;
+  const auto admission_ticket = admission_control ? admission_control->admit(session_id) : nullptr;
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
   return static_cast<const OperatorTask&>(*tasks.back()).get_operator()->get_output();
 }
@@ -5,6 +5,7 @@
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/prepared_plan.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -20,19 +21,76 @@ struct ExecutionInformation {
   std::optional<std::string> custom_command_complete_message;
 };
 
+// The generic plan of a prepared statement, i.e., a translated plan in which the parameters are not bound yet, and
+// the information required to decide whether to use it (see QueryHandler::bind_prepared_plan). An entry is only valid
+// for the PreparedPlan and the parameter data types it was created for.
+struct PreparedPlanCacheEntry {
+  std::shared_ptr<PreparedPlan> prepared_plan;
+  std::vector<DataType> parameter_data_types;
+
+  // The optimized generic plan is kept until the decision has been made and then either translated or discarded
+  std::shared_ptr<AbstractLQPNode> generic_lqp;
+  std::shared_ptr<AbstractOperator> generic_pqp;
+
+  size_t custom_plan_count{0};
+  Cost custom_plan_cost_sum{0};
+  Cost generic_plan_cost_sum{0};
+};
+
+// A COPY statement that transfers rows over the connection in CSV format, which the SQL parser does not support.
+// COPY FROM STDIN inserts the rows that the client sends into the table, COPY TO STDOUT sends the rows of the query.
+struct CopyStatement {
+  bool is_copy_from_stdin{false};
+  std::string table_name;
+  std::string query;
+  // Whether the first row contains the column names
+  bool has_header{false};
+};
+
+// Prepared statements are global, but each session stores the generic plans of the statements it executes
+using PreparedPlanCache = std::unordered_map<std::string, PreparedPlanCacheEntry>;
+
 // This class manages the interaction between the server and the database component. Furthermore, most of the SQL-based
 // error handling happens in this class.
 class QueryHandler {
  public:
   static std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> execute_pipeline(
       const std::string& query, const SendExecutionInfo send_execution_info,
-      const std::shared_ptr<TransactionContext>& transaction_context);
+      const std::shared_ptr<TransactionContext>& transaction_context, const SessionID session_id = 0);
 
   static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
 
+  // Optimize and translate the prepared plan with the parameters bound, i.e., create a custom plan.
   static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
 
-  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+  // Similar to PostgreSQL, the first CUSTOM_PLAN_COUNT executions of a prepared statement use custom plans. For each
+  // of them, the estimated cost of the custom plan is compared to that of the generic plan for the same parameters.
+  // This reflects how much the optimizer gains from knowing the actual values, e.g., a different join order for
+  // selective parameters. Afterwards, the generic plan is used if it is not considerably
+  // more expensive. Then, binding only copies the cached PQP and sets its parameters, which saves the optimization and
+  // translation. Statements without parameters use the generic plan right away, as it does not differ from a custom
+  // one. Placeholders in subqueries are bound by the optimizer only, so these statements always use custom plans.
+  static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details,
+                                                              PreparedPlanCache& prepared_plan_cache);
+
+  static constexpr auto CUSTOM_PLAN_COUNT = size_t{5};
+  static constexpr auto GENERIC_PLAN_COST_FACTOR = Cost{1.1f};
+
+  // Check whether the prepared statement inserts a single row of parameters, e.g., INSERT INTO t VALUES (?, ?).
+  // Consecutive executions of such a statement can be combined by bind_prepared_insert_batch.
+  static bool is_batchable_insert(const std::string& statement_name);
+
+  // Bind the parameters of multiple executions of a batchable insert into a single multi-row insert. The parameters
+  // become the rows of a table that replaces the single row of the VALUES clause.
+  static std::shared_ptr<AbstractOperator> bind_prepared_insert_batch(
+      const std::string& statement_name, const std::vector<std::vector<AllTypeVariant>>& parameter_rows);
+
+  // Returns std::nullopt if the query is not a COPY FROM STDIN or COPY TO STDOUT statement. Only the options FORMAT csv
+  // and HEADER are supported, both in the current and in the legacy syntax (e.g., COPY t FROM STDIN CSV HEADER).
+  static std::optional<CopyStatement> parse_copy_statement(const std::string& query);
+
+  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan,
+                                                            const SessionID session_id = 0);
 
  private:
   static void _handle_transaction_statement_message(ExecutionInformation& execution_info, SQLPipeline& sql_pipeline);
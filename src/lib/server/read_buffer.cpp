@@ -74,6 +74,38 @@ std::string ReadBuffer<SocketType>::get_string(const size_t string_length,
   return result;
 }
 
+template <typename SocketType>
+std::string_view ReadBuffer<SocketType>::get_string_view(const size_t string_length) {
+  if (string_length > maximum_capacity()) {
+    _string_view_copy = get_string(string_length, HasNullTerminator::No);
+    return _string_view_copy;
+  }
+
+  _receive_if_necessary(string_length);
+  const auto* const string_begin = &*_start_position;
+  const auto contiguous_length = SERVER_BUFFER_SIZE - static_cast<size_t>(string_begin - _data.data());
+  if (contiguous_length >= string_length) {
+    std::advance(_start_position, string_length);
+    return {string_begin, string_length};
+  }
+
+  _string_view_copy.clear();
+  std::copy_n(_start_position, string_length, std::back_inserter(_string_view_copy));
+  std::advance(_start_position, string_length);
+  return _string_view_copy;
+}
+
+template <typename SocketType>
+void ReadBuffer<SocketType>::skip(const size_t length) {
+  auto remaining_length = length;
+  while (remaining_length > 0) {
+    const auto skipped_length = std::min(remaining_length, maximum_capacity());
+    _receive_if_necessary(skipped_length);
+    std::advance(_start_position, skipped_length);
+    remaining_length -= skipped_length;
+  }
+}
+
 template <typename SocketType>
 void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required) {
   // Already enough data present in buffer
@@ -81,24 +113,9 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
     return;
   }
 
-  // Buffer might contain unread data, so cannot read full buffer size
-  const auto maximum_readable_size = maximum_capacity() - size();
-
-  size_t bytes_read;
   boost::system::error_code error_code;
-  // We cannot forward an iterator to the read system call. Hence, we need to use raw pointers. Therefore, we need to
-  // distinguish between reading into continuous memory or partially read the data.
-  if (std::distance(&*_start_position, &*_current_position) < 0 || &*_start_position == &_data[0]) {
-    bytes_read = boost::asio::read(*_socket, boost::asio::buffer(&*_current_position, maximum_readable_size),
-                                   boost::asio::transfer_at_least(bytes_required - size()), error_code);
-  } else {
-    bytes_read =
-        boost::asio::read(*_socket,
-                          std::array<boost::asio::mutable_buffer, 2>{
-                              boost::asio::buffer(&*_current_position, std::distance(&*_current_position, _data.end())),
-                              boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_start_position - 1))},
-                          boost::asio::transfer_at_least(bytes_required - size()), error_code);
-  }
+  const auto bytes_read = boost::asio::read(*_socket, _free_space(),
+                                            boost::asio::transfer_at_least(bytes_required - size()), error_code);
 
   // Socket was closed by client during execution
   if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
@@ -111,6 +128,37 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
   std::advance(_current_position, bytes_read);
 }
 
+template <typename SocketType>
+void ReadBuffer<SocketType>::async_receive(const size_t bytes_required,
+                                           std::function<void(const boost::system::error_code&)> handler) {
+  DebugAssert(bytes_required <= maximum_capacity(), "Cannot receive more bytes than the buffer holds");
+  if (size() >= bytes_required) {
+    handler(boost::system::error_code{});
+    return;
+  }
+
+  boost::asio::async_read(
+      *_socket, _free_space(), boost::asio::transfer_at_least(bytes_required - size()),
+      [this, handler = std::move(handler)](const boost::system::error_code& error_code, const size_t bytes_read) {
+        std::advance(_current_position, bytes_read);
+        handler(!error_code && bytes_read == 0 ? boost::asio::error::eof : error_code);
+      });
+}
+
+template <typename SocketType>
+std::array<boost::asio::mutable_buffer, 2> ReadBuffer<SocketType>::_free_space() {
+  // Buffer might contain unread data, so cannot read full buffer size
+  const auto maximum_readable_size = maximum_capacity() - size();
+
+  // We cannot forward an iterator to the read system call. Hence, we need to use raw pointers. Therefore, we need to
+  // distinguish between reading into continuous memory or partially read the data.
+  if (std::distance(&*_start_position, &*_current_position) < 0 || &*_start_position == &_data[0]) {
+    return {boost::asio::buffer(&*_current_position, maximum_readable_size), boost::asio::mutable_buffer{}};
+  }
+  return {boost::asio::buffer(&*_current_position, std::distance(&*_current_position, _data.end())),
+          boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_start_position - 1))};
+}
+
 template class ReadBuffer<Socket>;
 template class ReadBuffer<boost::asio::posix::stream_descriptor>;
 
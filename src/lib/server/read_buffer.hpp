@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <string_view>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -29,9 +32,20 @@ class ReadBuffer {
   template <typename T>
   T get_value() {
     _receive_if_necessary(sizeof(T));
-    T network_value = 0;
-    std::copy_n(_start_position, sizeof(T), reinterpret_cast<char*>(&network_value));
+    const auto value = peek_value<T>();
     std::advance(_start_position, sizeof(T));
+    return value;
+  }
+
+  // Extract a numerical value that has already been received without consuming it. The value starts offset bytes after
+  // the first unread byte.
+  template <typename T>
+  T peek_value(const size_t offset = 0) {
+    DebugAssert(size() >= offset + sizeof(T), "Cannot peek at data that has not been received yet");
+    auto position = _start_position;
+    std::advance(position, offset);
+    T network_value = 0;
+    std::copy_n(position, sizeof(T), reinterpret_cast<char*>(&network_value));
     if constexpr (std::is_same_v<T, uint16_t> || std::is_same_v<T, int16_t>) {
       return ntohs(network_value);
     } else if constexpr (std::is_same_v<T, uint32_t> || std::is_same_v<T, int32_t>) {
@@ -47,15 +61,32 @@ class ReadBuffer {
                          const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
   std::string get_string();
 
+  // Extract a string without null terminator. The view points into the buffer if the string is stored contiguously,
+  // otherwise the string is copied once. In both cases, the view is only valid until the next read from the buffer.
+  std::string_view get_string_view(const size_t string_length);
+
+  // Consume data that is not needed
+  void skip(const size_t length);
+
+  // Receive data from the network device without blocking until at least bytes_required bytes are buffered. The
+  // handler is called with the error code of the read operation. If enough data is buffered already, it is called
+  // immediately.
+  void async_receive(const size_t bytes_required, std::function<void(const boost::system::error_code&)> handler);
+
  private:
   void _receive_if_necessary(const size_t bytes_required = 1);
 
+  // The part of the ring buffer that can be filled with new data.
+  std::array<boost::asio::mutable_buffer, 2> _free_space();
+
   std::array<char, SERVER_BUFFER_SIZE> _data;
   // This iterator points to the first element that has not been read yet.
   RingBufferIterator _start_position{_data};
   // This iterator points to the field after the last unread element of the array.
   RingBufferIterator _current_position{_data};
   std::shared_ptr<SocketType> _socket;
+  // Holds strings returned by get_string_view that wrap around the end of the buffer or exceed the buffer's size.
+  std::string _string_view_copy;
 };
 
 }  // namespace opossum
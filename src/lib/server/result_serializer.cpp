@@ -1,13 +1,93 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/lexical_cast.hpp>
+
 #include "query_handler.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The values of one column of a chunk, serialized back to back. A length of -1 represents NULL.
+struct SerializedColumn {
+  std::string data;
+  std::vector<int32_t> lengths;
+};
+
+// See https://www.postgresql.org/docs/12/protocol-message-formats.html (Bind): No format code means text for all
+// columns, a single format code applies to all columns.
+ResultFormat result_format_for_column(const std::vector<ResultFormat>& result_formats, const ColumnID column_id,
+                                      const ColumnCount column_count) {
+  Assert(result_formats.size() <= 1 || result_formats.size() == column_count,
+         "Number of result format codes does not match the number of result columns");
+  if (result_formats.empty()) return ResultFormat::Text;
+  return result_formats.size() == 1 ? result_formats.front() : result_formats[column_id];
+}
+
+template <typename T>
+void append_serialized_value(std::string& data, const T& value, const ResultFormat result_format) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // Text and binary representation of text columns are identical
+    data.append(value.data(), value.size());
+  } else if (result_format == ResultFormat::Binary) {
+    // int4, int8, float4, and float8 are sent as their big-endian (IEEE 754 for floating point types) representation
+    using BitsType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static_assert(sizeof(T) == sizeof(BitsType), "Unexpected size of binary type");
+    auto bits = BitsType{};
+    std::memcpy(&bits, &value, sizeof(T));
+    for (auto shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+      data.push_back(static_cast<char>((bits >> shift) & 0xFF));
+    }
+  } else if constexpr (std::is_integral_v<T>) {
+    auto buffer = std::array<char, 24>{};
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    data.append(buffer.data(), result.ptr);
+  } else {
+    // Keep the precision of the previous AllTypeVariant-based conversion
+    data.append(boost::lexical_cast<std::string>(value));
+  }
+}
+
+SerializedColumn serialize_segment(const AbstractSegment& segment, const DataType data_type,
+                                   const ResultFormat result_format) {
+  auto serialized_column = SerializedColumn{};
+  serialized_column.lengths.reserve(segment.size());
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        serialized_column.lengths.emplace_back(-1);
+        return;
+      }
+      const auto previous_size = serialized_column.data.size();
+      append_serialized_value(serialized_column.data, position.value(), result_format);
+      serialized_column.lengths.emplace_back(static_cast<int32_t>(serialized_column.data.size() - previous_size));
+    });
+  });
+
+  return serialized_column;
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<ResultFormat>& result_formats) {
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -48,45 +128,67 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(
+        table->column_name(column_id), object_id, type_width,
+        result_format_for_column(result_formats, column_id, table->column_count()));
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<ResultFormat>& result_formats) {
+  const auto column_count = table->column_count();
+  auto values = std::vector<std::optional<std::string_view>>(column_count);
 
   const auto chunk_count = table->chunk_count();
 
   // Iterate over each chunk in result table
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
     const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
     const auto chunk_size = chunk->size();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
+    // Serialize the chunk column by column, resolving each segment's type only once
+    auto serialized_columns = std::vector<SerializedColumn>{};
+    serialized_columns.reserve(column_count);
     for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+      const auto result_format = result_format_for_column(result_formats, column_id, column_count);
+      serialized_columns.emplace_back(
+          serialize_segment(*chunk->get_segment(column_id), table->column_data_type(column_id), result_format));
+    }
+
+    // Serialize the DataRow messages of the chunk so that they can be sent without copying them again
+    auto data_rows = std::string{};
+    auto data_size = size_t{0};
+    for (const auto& serialized_column : serialized_columns) {
+      data_size += serialized_column.data.size();
     }
+    const auto data_row_header_size = sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE + sizeof(uint16_t);
+    data_rows.reserve(chunk_size * (data_row_header_size + column_count * LENGTH_FIELD_SIZE) + data_size);
 
     // Iterate over each row in chunk
+    auto positions_in_data = std::vector<size_t>(column_count);
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
+      auto value_length_sum = uint32_t{0};
       // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
+      for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
+        const auto& serialized_column = serialized_columns[column_id];
+        const auto length = serialized_column.lengths[chunk_offset];
+        if (length < 0) {
+          values[column_id] = std::nullopt;
+          continue;
         }
-        values_as_strings[segment_id] = string_value;
+        values[column_id] = std::string_view{serialized_column.data.data() + positions_in_data[column_id],
+                                             static_cast<size_t>(length)};
+        positions_in_data[column_id] += length;
+        // Sum up value lengths for a row to save an extra loop during serialization
+        value_length_sum += length;
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+      PostgresProtocolHandler<SocketType>::serialize_data_row(data_rows, values, value_length_sum);
     }
+    postgres_protocol_handler->send_data_rows(data_rows);
   }
 }
 
@@ -123,17 +225,21 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
 }
 
 template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                               const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                            const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<ResultFormat>&);
 
 }  // namespace opossum
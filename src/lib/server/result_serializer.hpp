@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
@@ -9,20 +11,25 @@ namespace opossum {
 
 struct ExecutionInformation;
 
-// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol. The
+// result formats are those requested in the Bind message (see PreparedStatementDetails), simple queries use text.
 class ResultSerializer {
  public:
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<ResultFormat>& result_formats = {});
 
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
+  // Serialize the result table chunk by chunk. Within a chunk, the values are serialized column-wise with their
+  // static types and then turned into DataRow messages, which are sent without copying them into the write buffer.
+  // Thus, only one serialized chunk is held in memory at a time.
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<ResultFormat>& result_formats = {});
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
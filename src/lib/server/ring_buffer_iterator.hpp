@@ -12,8 +12,10 @@ static constexpr size_t SERVER_BUFFER_SIZE = 4096u;
 
 // This class implements an iterator on an array to let it behave like a circular buffer. If all data has been
 // processed and the end of the underlying data structure is reached, the iterator wraps around and starts at the
-// beginning of the data structure.
-class RingBufferIterator : public boost::iterator_facade<RingBufferIterator, char, std::forward_iterator_tag, char&> {
+// beginning of the data structure. Advancing the iterator and measuring distances take constant time. Distances are
+// always measured forward, i.e., in reading direction of the ring buffer.
+class RingBufferIterator
+    : public boost::iterator_facade<RingBufferIterator, char, std::random_access_iterator_tag, char&> {
  public:
   explicit RingBufferIterator(std::array<char, SERVER_BUFFER_SIZE>& data, size_t position = 0)
       : _data(data), _position(position) {}
@@ -39,6 +41,20 @@ class RingBufferIterator : public boost::iterator_facade<RingBufferIterator, cha
     _position = (_position + 1) % SERVER_BUFFER_SIZE;
   }
 
+  void decrement() {  // NOLINT
+    _position = (_position + SERVER_BUFFER_SIZE - 1) % SERVER_BUFFER_SIZE;
+  }
+
+  void advance(const difference_type distance) {  // NOLINT
+    const auto signed_buffer_size = static_cast<difference_type>(SERVER_BUFFER_SIZE);
+    _position = (_position + static_cast<size_t>(distance % signed_buffer_size + signed_buffer_size)) %
+                SERVER_BUFFER_SIZE;
+  }
+
+  difference_type distance_to(RingBufferIterator const& other) const {  // NOLINT
+    return static_cast<difference_type>((other._position + SERVER_BUFFER_SIZE - _position) % SERVER_BUFFER_SIZE);
+  }
+
   reference dereference() const {  // NOLINT
     return _data[_position];
   }
@@ -1,9 +1,8 @@
 #include "server.hpp"
 
-#include <pthread.h>
-
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -30,45 +29,43 @@ void Server::run() {
 
   _is_initialized = true;
   _accept_new_session();
+
+  // Keep the network threads running while all sessions are busy handling packets and there is no pending operation
+  const auto work_guard = boost::asio::make_work_guard(_io_service);
+  auto network_threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{1}; thread_id < NETWORK_THREAD_COUNT; ++thread_id) {
+    network_threads.emplace_back([&]() { _io_service.run(); });
+  }
   _io_service.run();
+
+  for (auto& network_thread : network_threads) {
+    network_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
+  //
+  // The session is counted as running until it has been destroyed. This makes sure that no session outlives the
+  // io_service that its socket uses.
+  ++_num_running_sessions;
+  auto new_session = std::shared_ptr<Session>(new Session(_io_service, _send_execution_info),
+                                              [&num_running_sessions = _num_running_sessions](Session* session) {
+                                                delete session;
+                                                --num_running_sessions;
+                                              });
   _acceptor.async_accept(*(new_session->socket()),
                          boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
 }
 
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
+  // The acceptor has been closed by shutdown(), which releases the session that was waiting for a client
+  if (error == boost::asio::error::operation_aborted) return;
   Assert(!error, error.message());
 
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
-
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
-
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
+  new_session->start();
   _accept_new_session();
 }
 
@@ -77,6 +74,7 @@ boost::asio::ip::address Server::server_address() const { return _acceptor.local
 uint16_t Server::server_port() const { return _acceptor.local_endpoint().port(); }
 
 void Server::shutdown() {
+  boost::asio::post(_io_service, [&]() { _acceptor.close(); });
   while (_num_running_sessions > 0) {
     // This busy wait might be inefficient, but as this is only to guarantee a clean shutdown, it's good enough.
     std::this_thread::yield();
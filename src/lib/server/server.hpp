@@ -10,9 +10,10 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client and runs the network threads that
+*           complete the asynchronous socket operations of all sessions.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. Received packets are handled in tasks on the scheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -40,13 +41,16 @@ class Server {
   // Get the current address the server is running. This is important especially for multi-NIC devices.
   boost::asio::ip::address server_address() const;
 
-  // Shutdown Hyrise server.
+  // Shutdown Hyrise server. New sessions are no longer accepted, running sessions are waited for.
   void shutdown();
 
   // Indicates if setup is completed.
   bool is_initialized() const;
 
  private:
+  // Completion handlers only schedule tasks, so that a few threads suffice for thousands of sessions
+  static constexpr auto NETWORK_THREAD_COUNT = size_t{2};
+
   void _accept_new_session();
 
   void _start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error);
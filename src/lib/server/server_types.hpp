@@ -10,4 +10,7 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Format codes of result columns as requested by the client in the Bind message
+enum class ResultFormat : int16_t { Text = 0, Binary = 1 };
+
 }  // namespace opossum
@@ -1,42 +1,109 @@
 #include "session.hpp"
 
+#include <atomic>
+#include <sstream>
+#include <string>
+
 #include "client_disconnect_exception.hpp"
+#include "hyrise.hpp"
+#include "import_export/csv/csv_parser.hpp"
+#include "import_export/csv/csv_writer.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Session 0 is used for statements that do not come from the server
+std::atomic<SessionID> next_session_id{1};
+
+// The CSV format of PostgreSQL's COPY: Unquoted empty values are NULL, quotes are escaped by doubling them, and any
+// value may be quoted
+ParseConfig copy_parse_config() {
+  auto config = ParseConfig{};
+  config.reject_quoted_nonstrings = false;
+  config.null_handling = NullHandling::NullStringAsValue;
+  return config;
+}
+
+}  // namespace
 
 namespace opossum {
 
 Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
     : _socket(std::make_shared<Socket>(io_service)),
       _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
-      _send_execution_info(send_execution_info) {}
+      _send_execution_info(send_execution_info),
+      _session_id(next_session_id++) {}
 
 std::shared_ptr<Socket> Session::socket() { return _socket; }
 
-void Session::run() {
+void Session::start() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
-    try {
-      _handle_request();
-    } catch (const ClientDisconnectException&) {
+  _receive_next_packet();
+}
+
+void Session::_receive_next_packet() {
+  if (_terminate_session) return;
+
+  _postgres_protocol_handler->async_receive_packet(
+      !_connection_established, [session = shared_from_this()](const boost::system::error_code& error_code) {
+        // The client closed the connection. Not receiving further packets releases the session.
+        if (error_code) return;
+
+        // Handling a packet may execute a query, which must not block the network threads
+        std::make_shared<JobTask>([session]() { session->_handle_buffered_packets(); })->schedule();
+      });
+}
+
+void Session::_handle_buffered_packets() {
+  // Pipelining clients send many packets at once. These are handled back to back within the same task, and the
+  // responses are only flushed by the final Sync.
+  do {
+    _handle_packet();
+  } while (!_terminate_session && _postgres_protocol_handler->is_packet_buffered(!_connection_established));
+
+  _receive_next_packet();
+}
+
+void Session::_handle_packet() {
+  try {
+    if (!_connection_established) {
+      _establish_connection();
+      _connection_established = true;
       return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
     }
+
+    // Packets that do not belong to a batch of inserts require its execution first. If the execution fails, the
+    // packet has not been read yet and is handled after the error has been reported.
+    const auto packet_type = _postgres_protocol_handler->peek_packet_type();
+    if (packet_type != PostgresMessageType::BindCommand && packet_type != PostgresMessageType::ExecuteCommand &&
+        packet_type != PostgresMessageType::DescribeCommand) {
+      _execute_insert_batch();
+    }
+
+    _handle_request();
+  } catch (const ClientDisconnectException&) {
+    _terminate_session = true;
+  } catch (const std::exception& e) {
+    std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+              << e.what() << std::endl;
+    const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
+    _postgres_protocol_handler->send_error_message(error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+    // Messages that have already been received are processed further. A "sync" message makes the server send another
+    // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
+    // query arrives it must be set to false again to ensure correct message flow.
+    _sync_send_after_error = true;
   }
 }
 
@@ -72,7 +139,8 @@ void Session::_handle_request() {
       break;
     }
     case PostgresMessageType::SyncCommand: {
-      if (!_sync_send_after_error) {
+      // Sync messages are ignored during COPY FROM STDIN
+      if (!_sync_send_after_error && !_copy_from_stdin) {
         _sync();
       } else {
         _postgres_protocol_handler->read_sync_packet();
@@ -94,6 +162,18 @@ void Session::_handle_request() {
       _handle_execute();
       break;
     }
+    case PostgresMessageType::CopyData: {
+      _handle_copy_data();
+      break;
+    }
+    case PostgresMessageType::CopyDone: {
+      _handle_copy_done();
+      break;
+    }
+    case PostgresMessageType::CopyFailCommand: {
+      _handle_copy_fail();
+      break;
+    }
     default:
       Fail("Unknown packet type");
   }
@@ -105,10 +185,21 @@ void Session::_handle_simple_query() {
   // A simple query command invalidates unnamed portals
   _portals.erase("");
 
+  if (const auto copy_statement = QueryHandler::parse_copy_statement(query)) {
+    if (copy_statement->is_copy_from_stdin) {
+      _start_copy_from_stdin(*copy_statement);
+      return;
+    }
+
+    _handle_copy_to_stdout(*copy_statement);
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
   ExecutionInformation execution_information;
 
   std::tie(execution_information, _transaction_context) =
-      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
+      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context, _session_id);
 
   if (!execution_information.error_message.empty()) {
     _postgres_protocol_handler->send_error_message(execution_information.error_message);
@@ -131,6 +222,154 @@ void Session::_handle_simple_query() {
   _postgres_protocol_handler->send_ready_for_query();
 }
 
+void Session::_handle_copy_to_stdout(const CopyStatement& copy_statement) {
+  ExecutionInformation execution_information;
+  std::tie(execution_information, _transaction_context) = QueryHandler::execute_pipeline(
+      copy_statement.query, SendExecutionInfo::No, _transaction_context, _session_id);
+
+  if (!execution_information.error_message.empty()) {
+    _postgres_protocol_handler->send_error_message(execution_information.error_message);
+    return;
+  }
+
+  const auto& table = execution_information.result_table;
+  AssertInput(table, "COPY TO STDOUT requires a query that returns rows");
+  _postgres_protocol_handler->send_copy_response(PostgresMessageType::CopyOutResponse,
+                                                 static_cast<uint16_t>(table->column_count()));
+
+  // Each chunk is sent in a CopyData message of its own, so that the table is never serialized as a whole
+  auto stream = std::stringstream{};
+  if (copy_statement.has_header) CsvWriter::write_header(*table, stream);
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    CsvWriter::write_chunk(*table, chunk_id, stream);
+    _postgres_protocol_handler->send_copy_data(stream.str());
+    stream.str("");
+  }
+  if (chunk_count == 0 && copy_statement.has_header) _postgres_protocol_handler->send_copy_data(stream.str());
+
+  _postgres_protocol_handler->send_status_message(PostgresMessageType::CopyDone);
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(table->row_count()));
+}
+
+void Session::_start_copy_from_stdin(const CopyStatement& copy_statement) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  AssertInput(storage_manager.has_table(copy_statement.table_name),
+              "Table " + copy_statement.table_name + " does not exist");
+  const auto column_count = storage_manager.get_table(copy_statement.table_name)->column_count();
+
+  auto copy_from_stdin = CopyFromStdin{};
+  copy_from_stdin.table_name = copy_statement.table_name;
+  copy_from_stdin.commits_transaction = !_transaction_context;
+  copy_from_stdin.transaction_context =
+      _transaction_context ? _transaction_context
+                           : Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  copy_from_stdin.skip_header = copy_statement.has_header;
+  _copy_from_stdin = std::move(copy_from_stdin);
+
+  _postgres_protocol_handler->send_copy_response(PostgresMessageType::CopyInResponse,
+                                                 static_cast<uint16_t>(column_count));
+}
+
+void Session::_handle_copy_data() {
+  const auto data = _postgres_protocol_handler->read_copy_data_packet();
+
+  // After COPY FROM STDIN failed, the client may still send data, which is discarded
+  if (!_copy_from_stdin) return;
+
+  _copy_from_stdin->data.append(data);
+  if (_copy_from_stdin->data.size() < COPY_BATCH_SIZE) return;
+
+  try {
+    _insert_copied_rows(false);
+  } catch (...) {
+    _abort_copy_from_stdin();
+    throw;
+  }
+}
+
+void Session::_handle_copy_done() {
+  _postgres_protocol_handler->read_copy_done_packet();
+  if (!_copy_from_stdin) return;
+
+  try {
+    _insert_copied_rows(true);
+  } catch (...) {
+    _abort_copy_from_stdin();
+    throw;
+  }
+
+  if (_copy_from_stdin->commits_transaction) _copy_from_stdin->transaction_context->commit();
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(_copy_from_stdin->row_count));
+  _copy_from_stdin.reset();
+  _postgres_protocol_handler->send_ready_for_query();
+}
+
+void Session::_handle_copy_fail() {
+  const auto message = _postgres_protocol_handler->read_copy_fail_packet();
+  if (!_copy_from_stdin) return;
+
+  _abort_copy_from_stdin();
+  FailInput("COPY FROM STDIN failed: " + message);
+}
+
+void Session::_insert_copied_rows(const bool all_rows) {
+  auto& copy_from_stdin = *_copy_from_stdin;
+  auto& data = copy_from_stdin.data;
+
+  // Quotes within quoted values are escaped by doubling them, which toggles the quote state twice
+  const auto config = copy_parse_config();
+  for (; copy_from_stdin.scanned_size < data.size(); ++copy_from_stdin.scanned_size) {
+    const auto character = data[copy_from_stdin.scanned_size];
+    if (character == config.quote) {
+      copy_from_stdin.is_quoted = !copy_from_stdin.is_quoted;
+    } else if (character == config.delimiter && !copy_from_stdin.is_quoted) {
+      copy_from_stdin.rows_end = copy_from_stdin.scanned_size + 1;
+      if (copy_from_stdin.skip_header) {
+        copy_from_stdin.rows_begin = copy_from_stdin.rows_end;
+        copy_from_stdin.skip_header = false;
+      }
+    }
+  }
+
+  // The last row does not need to be terminated by a delimiter
+  if (all_rows) {
+    copy_from_stdin.rows_end = data.size();
+    if (copy_from_stdin.skip_header) copy_from_stdin.rows_begin = data.size();
+  }
+
+  const auto rows_size = copy_from_stdin.rows_end - copy_from_stdin.rows_begin;
+  if (rows_size > 0) {
+    const auto& table_name = copy_from_stdin.table_name;
+    const auto& column_definitions = Hyrise::get().storage_manager.get_table(table_name)->column_definitions();
+    const auto rows = CsvParser::parse_content(std::string_view{data}.substr(copy_from_stdin.rows_begin, rows_size),
+                                               column_definitions, config);
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context_recursively(copy_from_stdin.transaction_context);
+    QueryHandler::execute_prepared_plan(insert, _session_id);
+    copy_from_stdin.row_count += rows->row_count();
+  }
+
+  data.erase(0, copy_from_stdin.rows_end);
+  copy_from_stdin.scanned_size -= copy_from_stdin.rows_end;
+  copy_from_stdin.rows_begin = 0;
+  copy_from_stdin.rows_end = 0;
+}
+
+void Session::_abort_copy_from_stdin() {
+  const auto& transaction_context = _copy_from_stdin->transaction_context;
+  const auto phase = transaction_context->phase();
+  if (phase == TransactionPhase::Active || phase == TransactionPhase::Conflicted) {
+    transaction_context->rollback(RollbackReason::Conflict);
+  }
+
+  // The rows that the COPY inserted into the transaction of the session cannot be rolled back on their own
+  if (!_copy_from_stdin->commits_transaction) _transaction_context.reset();
+  _copy_from_stdin.reset();
+}
+
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
   QueryHandler::setup_prepared_plan(statement_name, query);
@@ -143,6 +382,13 @@ void Session::_handle_parse_command() {
 void Session::_handle_bind_command() {
   const auto parameters = _postgres_protocol_handler->read_bind_packet();
 
+  const auto is_batchable = parameters.portal.empty() && parameters.result_formats.empty() &&
+                            QueryHandler::is_batchable_insert(parameters.statement_name);
+  if (_insert_batch && (!is_batchable || _insert_batch->statement_name != parameters.statement_name ||
+                        _insert_batch->bound_statement)) {
+    _execute_insert_batch();
+  }
+
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
   // https://www.postgresql.org/docs/12/static/protocol-flow.html
@@ -152,14 +398,25 @@ void Session::_handle_bind_command() {
     _portals.erase(portal_it);
   }
 
+  // BindComplete is sent once the batch is executed
+  if (is_batchable) {
+    if (!_insert_batch) _insert_batch = InsertBatch{parameters.statement_name, {}, std::nullopt};
+    _insert_batch->bound_statement = parameters;
+    return;
+  }
+
+  _bind_portal(parameters);
+}
+
+void Session::_bind_portal(const PreparedStatementDetails& statement_details) {
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
+  _portals.emplace(statement_details.portal, Portal{nullptr, {}});
 
-  const auto pqp = QueryHandler::bind_prepared_plan(parameters);
+  const auto pqp = QueryHandler::bind_prepared_plan(statement_details, _prepared_plan_cache);
 
-  _portals[parameters.portal] = pqp;
+  _portals[statement_details.portal] = Portal{pqp, statement_details.result_formats};
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
@@ -177,17 +434,26 @@ void Session::_sync() {
 void Session::_handle_execute() {
   const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
 
+  if (_insert_batch && _insert_batch->bound_statement && portal_name.empty()) {
+    _insert_batch->parameter_rows.emplace_back(std::move(_insert_batch->bound_statement->parameters));
+    _insert_batch->bound_statement.reset();
+    if (_insert_batch->parameter_rows.size() == MAX_INSERT_BATCH_SIZE) _execute_insert_batch();
+    return;
+  }
+  _execute_insert_batch();
+
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal_it->second.physical_plan) {
     _portals.erase(portal_it);
     return;
   }
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_formats = portal_it->second.result_formats;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -196,13 +462,13 @@ void Session::_handle_execute() {
   }
   physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
+  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan, _session_id);
 
   uint64_t row_count = 0;
   // If there is no result table, e.g. after an INSERT command, we cannot send row data
   if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
+    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler, result_formats);
+    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler, result_formats);
     row_count = result_table->row_count();
   } else {
     _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
@@ -212,4 +478,34 @@ void Session::_handle_execute() {
       ResultSerializer::build_command_complete_message(physical_plan->type(), row_count));
   // Ready for query + flush will be done after reading sync message
 }
+
+void Session::_execute_insert_batch() {
+  if (!_insert_batch) return;
+
+  auto insert_batch = std::move(*_insert_batch);
+  _insert_batch.reset();
+
+  if (!insert_batch.parameter_rows.empty()) {
+    const auto physical_plan =
+        QueryHandler::bind_prepared_insert_batch(insert_batch.statement_name, insert_batch.parameter_rows);
+
+    if (!_transaction_context) {
+      _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    }
+    physical_plan->set_transaction_context_recursively(_transaction_context);
+    QueryHandler::execute_prepared_plan(physical_plan, _session_id);
+
+    // Acknowledge each execution as if it had been executed on its own
+    for (auto row_idx = size_t{0}; row_idx < insert_batch.parameter_rows.size(); ++row_idx) {
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+      _postgres_protocol_handler->send_command_complete(
+          ResultSerializer::build_command_complete_message(OperatorType::Insert, 1));
+    }
+  }
+
+  // A Bind that has not been executed yet is bound on its own, so that it can be executed as usual
+  if (insert_batch.bound_statement) _bind_portal(*insert_batch.bound_statement);
+}
+
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "query_handler.hpp"
 #include "scheduler/operator_task.hpp"
 
 namespace opossum {
@@ -12,16 +13,29 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not have a thread of their own. The next packet is received asynchronously by the server's network
+// threads, and each received packet is then handled in a task on the scheduler. As there is at most one pending read
+// or task per session, the session state is never accessed concurrently. Pending operations keep the session alive.
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. This returns immediately, the session ends when the client terminates the connection.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
+  // Wait for the next packet without blocking and schedule a task that handles it.
+  void _receive_next_packet();
+
+  // Handle the received packet and all packets that have been received along with it.
+  void _handle_buffered_packets();
+
+  // Handle a packet that has been received and report errors to the client.
+  void _handle_packet();
+
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
@@ -36,6 +50,7 @@ class Session {
 
   // Bind prepared statement.
   void _handle_bind_command();
+  void _bind_portal(const PreparedStatementDetails& statement_details);
 
   // Read describe message. Row description will be send after execution.
   void _handle_describe();
@@ -46,12 +61,73 @@ class Session {
   // Commit current transaction.
   void _sync();
 
+  // Stream the rows of the query in CopyData messages.
+  void _handle_copy_to_stdout(const CopyStatement& copy_statement);
+
+  // Receive the rows of COPY FROM STDIN in CopyData messages and insert them in batches until the client sends
+  // CopyDone or CopyFail. ReadyForQuery is sent at the end.
+  void _start_copy_from_stdin(const CopyStatement& copy_statement);
+  void _handle_copy_data();
+  void _handle_copy_done();
+  void _handle_copy_fail();
+
+  // Parse and insert the rows that have been received completely. If all_rows is set, the client has sent all data.
+  void _insert_copied_rows(const bool all_rows);
+  void _abort_copy_from_stdin();
+
+  // Execute the deferred executions of a batchable insert (see QueryHandler::is_batchable_insert) as a single insert
+  // and send the responses that have been held back for them.
+  void _execute_insert_batch();
+
+  // A bound prepared statement and the formats in which the client requested its result columns. The plan is a
+  // nullptr if binding failed.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<ResultFormat> result_formats;
+  };
+
+  // Pipelining clients, e.g., JDBC batches, send Bind and Execute for the unnamed portal for many rows before a single
+  // Sync. For a batchable insert, these executions are deferred and their responses are held back, which requires
+  // packets that do not belong to the batch to execute it first. bound_statement is a Bind that has not been executed.
+  struct InsertBatch {
+    std::string statement_name;
+    std::vector<std::vector<AllTypeVariant>> parameter_rows;
+    std::optional<PreparedStatementDetails> bound_statement;
+  };
+
+  // Limits the memory used for deferred parameters
+  static constexpr auto MAX_INSERT_BATCH_SIZE = size_t{10'000};
+
+  // The data of COPY FROM STDIN is inserted in batches of complete rows. A row is complete once its delimiter has been
+  // received. Delimiters within quoted values do not end rows, so the quote state is tracked up to scanned_size.
+  struct CopyFromStdin {
+    std::string table_name;
+    std::shared_ptr<TransactionContext> transaction_context;
+    // Whether the transaction has been started for the COPY, which then commits it
+    bool commits_transaction;
+    bool skip_header;
+    std::string data;
+    size_t rows_begin{0};
+    size_t rows_end{0};
+    size_t scanned_size{0};
+    bool is_quoted{false};
+    uint64_t row_count{0};
+  };
+
+  // Received data is inserted once it exceeds this size
+  static constexpr auto COPY_BATCH_SIZE = size_t{16'000'000};
+
   const std::shared_ptr<Socket> _socket;
   const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  const SessionID _session_id;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
+  PreparedPlanCache _prepared_plan_cache;
+  std::optional<InsertBatch> _insert_batch;
+  std::optional<CopyFromStdin> _copy_from_stdin;
 };
 }  // namespace opossum
@@ -21,7 +21,7 @@ bool WriteBuffer<SocketType>::full() const {
 }
 
 template <typename SocketType>
-void WriteBuffer<SocketType>::put_string(const std::string& value, const HasNullTerminator has_null_terminator) {
+void WriteBuffer<SocketType>::put_string(const std::string_view value, const HasNullTerminator has_null_terminator) {
   auto position_in_string = 0u;
 
   // Use available space first
@@ -48,34 +48,56 @@ void WriteBuffer<SocketType>::put_string(const std::string& value, const HasNull
   }
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::put_bytes(const std::string_view data) {
+  if (data.size() < maximum_capacity() - size()) {
+    std::copy_n(data.cbegin(), data.size(), _current_position);
+    std::advance(_current_position, data.size());
+    return;
+  }
+
+  const auto unflushed_data = _unflushed_data();
+  const auto buffers = std::array<boost::asio::const_buffer, 3>{unflushed_data[0], unflushed_data[1],
+                                                                boost::asio::buffer(data.data(), data.size())};
+  boost::system::error_code error_code;
+  const auto bytes_sent = boost::asio::write(*_socket, buffers, error_code);
+  _assert_write_succeeded(error_code, bytes_sent);
+
+  _start_position = _current_position;
+}
+
 template <typename SocketType>
 void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
   Assert(bytes_required <= size(), "Cannot flush more byte than available");
   const auto bytes_to_send = bytes_required ? bytes_required : size();
-  size_t bytes_sent;
 
   boost::system::error_code error_code;
+  const auto bytes_sent = boost::asio::write(*_socket, _unflushed_data(),
+                                             boost::asio::transfer_at_least(bytes_to_send), error_code);
+  _assert_write_succeeded(error_code, bytes_sent);
+
+  std::advance(_start_position, bytes_sent);
+}
+
+template <typename SocketType>
+std::array<boost::asio::const_buffer, 2> WriteBuffer<SocketType>::_unflushed_data() {
   if (std::distance(&*_start_position, &*_current_position) < 0) {
     // Data not continuously stored in buffer
-    bytes_sent =
-        boost::asio::write(*_socket,
-                           std::array<boost::asio::mutable_buffer, 2>{
-                               boost::asio::buffer(&*_start_position, std::distance(&*_start_position, _data.end())),
-                               boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_current_position))},
-                           boost::asio::transfer_at_least(bytes_to_send), error_code);
-  } else {
-    bytes_sent = boost::asio::write(*_socket, boost::asio::buffer(&*_start_position, size()),
-                                    boost::asio::transfer_at_least(bytes_to_send), error_code);
+    return {boost::asio::buffer(&*_start_position, std::distance(&*_start_position, _data.end())),
+            boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_current_position))};
   }
+  return {boost::asio::buffer(&*_start_position, size()), boost::asio::const_buffer{}};
+}
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::_assert_write_succeeded(const boost::system::error_code& error_code,
+                                                      const size_t bytes_sent) const {
   // Socket was closed by client during execution
   if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
       bytes_sent == 0) {
     throw ClientDisconnectException("Write operation failed. Client closed connection.");
   }
   Assert(!error_code, error_code.message());
-
-  std::advance(_start_position, bytes_sent);
 }
 
 template <typename SocketType>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -43,7 +45,11 @@ class WriteBuffer {
   }
 
   // Put string into the buffer. If the string is longer than the buffer itself the buffer will flush automatically.
-  void put_string(const std::string& value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
+  void put_string(const std::string_view value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
+
+  // Put serialized data into the buffer. Data that does not fit into the remaining space is not copied. Instead, it is
+  // sent along with the buffered data in a single gather write (writev).
+  void put_bytes(const std::string_view data);
 
   // Flush buffer by at least bytes_required. 0 means, flush whole buffer.
   void flush(const size_t bytes_required = 0);
@@ -51,6 +57,11 @@ class WriteBuffer {
  private:
   void _flush_if_necessary(const size_t bytes_required);
 
+  // The buffered data that has not been sent yet, which is split into two parts if it wraps around.
+  std::array<boost::asio::const_buffer, 2> _unflushed_data();
+
+  void _assert_write_succeeded(const boost::system::error_code& error_code, const size_t bytes_sent) const;
+
   std::array<char, SERVER_BUFFER_SIZE> _data;
   // This iterator points to the first element that has not been flushed yet.
   RingBufferIterator _start_position{_data};
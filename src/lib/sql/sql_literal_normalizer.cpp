@@ -0,0 +1,258 @@
+#include "sql_literal_normalizer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The literals following these keywords are part of a date, time, or limit specification and cannot be parameterized
+const auto keywords_with_verbatim_literals =
+    std::unordered_set<std::string>{"DATE", "TIMESTAMP", "INTERVAL", "LIMIT", "OFFSET"};
+
+bool is_identifier_start(const char character) {
+  const auto unsigned_character = static_cast<unsigned char>(character);
+  return std::isalpha(unsigned_character) || character == '_' || unsigned_character >= 0x80;
+}
+
+bool is_identifier_character(const char character) {
+  return is_identifier_start(character) || std::isdigit(static_cast<unsigned char>(character));
+}
+
+bool is_digit(const std::string& sql, const size_t position) {
+  return position < sql.size() && std::isdigit(static_cast<unsigned char>(sql[position]));
+}
+
+bool is_number_start(const std::string& sql, const size_t position) {
+  return is_digit(sql, position) || (position < sql.size() && sql[position] == '.' && is_digit(sql, position + 1));
+}
+
+// Returns the end of the number literal (e.g., `17`, `.5`, or `1.5e-3`) that starts at @param position
+size_t number_end(const std::string& sql, size_t position) {
+  while (is_digit(sql, position)) ++position;
+
+  if (position < sql.size() && sql[position] == '.') {
+    ++position;
+    while (is_digit(sql, position)) ++position;
+  }
+
+  if (position < sql.size() && (sql[position] == 'e' || sql[position] == 'E')) {
+    auto exponent_position = position + 1;
+    if (exponent_position < sql.size() && (sql[exponent_position] == '+' || sql[exponent_position] == '-')) {
+      ++exponent_position;
+    }
+    if (is_digit(sql, exponent_position)) {
+      position = exponent_position;
+      while (is_digit(sql, position)) ++position;
+    }
+  }
+
+  return position;
+}
+
+// Types the number literal like the SQLTranslator does. Returns std::nullopt for values that are out of range.
+std::optional<AllTypeVariant> parse_number(const std::string& literal) {
+  try {
+    if (literal.find_first_of(".eE") != std::string::npos) {
+      return AllTypeVariant{std::stod(literal)};
+    }
+
+    const auto value = static_cast<int64_t>(std::stoll(literal));
+    if (static_cast<int32_t>(value) == value) {
+      return AllTypeVariant{static_cast<int32_t>(value)};
+    }
+    return AllTypeVariant{value};
+  } catch (const std::out_of_range&) {
+    return std::nullopt;
+  }
+}
+
+size_t count_parameterizable_placeholders(const hsql::Expr& expression) {
+  if (expression.type != hsql::kExprOperator) return 0;
+
+  const auto is_column = [](const hsql::Expr* operand) { return operand && operand->type == hsql::kExprColumnRef; };
+  const auto is_placeholder = [](const hsql::Expr* operand) {
+    return operand && operand->type == hsql::kExprParameter;
+  };
+
+  switch (expression.opType) {
+    case hsql::kOpAnd:
+    case hsql::kOpOr: {
+      auto placeholder_count = size_t{0};
+      if (expression.expr) placeholder_count += count_parameterizable_placeholders(*expression.expr);
+      if (expression.expr2) placeholder_count += count_parameterizable_placeholders(*expression.expr2);
+      return placeholder_count;
+    }
+
+    case hsql::kOpEquals:
+    case hsql::kOpNotEquals:
+    case hsql::kOpLess:
+    case hsql::kOpLessEq:
+    case hsql::kOpGreater:
+    case hsql::kOpGreaterEq: {
+      const auto compares_placeholder_to_column = (is_column(expression.expr) && is_placeholder(expression.expr2)) ||
+                                                  (is_placeholder(expression.expr) && is_column(expression.expr2));
+      return compares_placeholder_to_column ? 1 : 0;
+    }
+
+    case hsql::kOpBetween: {
+      if (!is_column(expression.expr) || !expression.exprList) return 0;
+      return static_cast<size_t>(
+          std::count_if(expression.exprList->begin(), expression.exprList->end(), is_placeholder));
+    }
+
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  // Whether the previous token is an identifier, a literal, or a closing parenthesis, after which a minus sign is a
+  // binary operator
+  auto previous_token_is_operand = false;
+
+  // The previous token in upper case if it is a word, empty otherwise
+  auto previous_word = std::string{};
+
+  const auto sql_size = sql.size();
+  auto position = size_t{0};
+  while (position < sql_size) {
+    const auto character = sql[position];
+
+    // Whitespace and comments are copied and do not count as tokens
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      normalized_sql.sql += character;
+      ++position;
+      continue;
+    }
+
+    if (sql.compare(position, 2, "--") == 0 || sql.compare(position, 2, "/*") == 0) {
+      const auto is_line_comment = sql[position + 1] == '-';
+      const auto comment_end = is_line_comment ? sql.find('\n', position) : sql.find("*/", position + 2);
+      const auto end = comment_end == std::string::npos ? sql_size : comment_end + (is_line_comment ? 0 : 2);
+      normalized_sql.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+
+    // Placeholders of the given SQL string could not be told apart from the ones for the literals
+    if (character == '?') return std::nullopt;
+
+    if (is_identifier_start(character)) {
+      auto word_end = position;
+      while (word_end < sql_size && is_identifier_character(sql[word_end])) ++word_end;
+
+      previous_word = sql.substr(position, word_end - position);
+      std::transform(previous_word.begin(), previous_word.end(), previous_word.begin(),
+                     [](const auto word_character) { return std::toupper(word_character); });
+
+      normalized_sql.sql.append(sql, position, word_end - position);
+      previous_token_is_operand = true;
+      position = word_end;
+      continue;
+    }
+
+    const auto keep_literal = keywords_with_verbatim_literals.contains(previous_word);
+    previous_word.clear();
+
+    if (character == '"') {
+      // Quoted identifier
+      const auto closing_quote = sql.find('"', position + 1);
+      const auto end = closing_quote == std::string::npos ? sql_size : closing_quote + 1;
+      normalized_sql.sql.append(sql, position, end - position);
+      previous_token_is_operand = true;
+      position = end;
+      continue;
+    }
+
+    if (character == '\'') {
+      // String literal, in which two single quotes stand for one
+      auto value = pmr_string{};
+      auto literal_end = position + 1;
+      auto is_terminated = false;
+      while (literal_end < sql_size) {
+        if (sql[literal_end] == '\'') {
+          if (literal_end + 1 < sql_size && sql[literal_end + 1] == '\'') {
+            value += '\'';
+            literal_end += 2;
+            continue;
+          }
+          is_terminated = true;
+          ++literal_end;
+          break;
+        }
+        value += sql[literal_end];
+        ++literal_end;
+      }
+
+      if (keep_literal || !is_terminated) {
+        normalized_sql.sql.append(sql, position, literal_end - position);
+      } else {
+        normalized_sql.sql += '?';
+        normalized_sql.literals.emplace_back(value);
+      }
+
+      previous_token_is_operand = true;
+      position = literal_end;
+      continue;
+    }
+
+    // A minus sign that is not a binary operator belongs to the following number literal
+    auto digits_begin = position;
+    if (character == '-' && !previous_token_is_operand) {
+      digits_begin = position + 1;
+      while (digits_begin < sql_size && std::isspace(static_cast<unsigned char>(sql[digits_begin]))) ++digits_begin;
+    }
+
+    if (is_number_start(sql, digits_begin)) {
+      const auto literal_end = number_end(sql, digits_begin);
+      const auto sign = std::string{digits_begin == position ? "" : "-"};
+      auto value = std::optional<AllTypeVariant>{};
+      if (!keep_literal) value = parse_number(sign + sql.substr(digits_begin, literal_end - digits_begin));
+
+      if (value) {
+        normalized_sql.sql += '?';
+        normalized_sql.literals.emplace_back(*value);
+      } else {
+        normalized_sql.sql.append(sql, position, literal_end - position);
+      }
+
+      previous_token_is_operand = true;
+      position = literal_end;
+      continue;
+    }
+
+    normalized_sql.sql += character;
+    previous_token_is_operand = character == ')';
+    ++position;
+  }
+
+  return normalized_sql;
+}
+
+bool is_parameterizable(const hsql::SQLParserResult& parsed_normalized_sql, const size_t literal_count) {
+  if (!parsed_normalized_sql.isValid() || parsed_normalized_sql.size() != 1) return false;
+
+  const auto& statement = *parsed_normalized_sql.getStatement(0);
+  if (!statement.isType(hsql::kStmtSelect)) return false;
+
+  // Only the placeholders in the WHERE clause are counted. If there are as many as literals, no placeholder is used
+  // anywhere else.
+  const auto& select_statement = static_cast<const hsql::SelectStatement&>(statement);
+  if (!select_statement.whereClause) return false;
+
+  return count_parameterizable_placeholders(*select_statement.whereClause) == literal_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "SQLParser.h"
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * A SQL string in which the literals were replaced by value placeholders (`?`), together with the values of these
+ * literals in the order of their placeholders. Statements that only differ in their literals, e.g.,
+ * `SELECT * FROM t WHERE a = 17` and `SELECT * FROM t WHERE a = 18`, share the same normalized SQL string, which makes
+ * it usable as the key of the SQLParameterizedPlanCache (see sql_plan_cache.hpp).
+ */
+struct NormalizedSQL {
+  std::string sql;
+  std::vector<AllTypeVariant> literals;
+};
+
+/**
+ * Replaces the number and string literals of @param sql by value placeholders. The literals are typed like the
+ * SQLTranslator types them (int32_t if the value fits, int64_t otherwise, double, and pmr_string). A minus sign that
+ * cannot be a binary operator becomes part of the following number literal. Literals of DATE, TIMESTAMP, and INTERVAL
+ * expressions as well as LIMIT and OFFSET values are kept, because they cannot be expressed by placeholders.
+ * Identifiers, quoted identifiers, and comments are left alone.
+ *
+ * Returns std::nullopt if @param sql already contains value placeholders.
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+/**
+ * Checks whether the plan of a parsed normalized SQL statement can be reused for any values of its @param literal_count
+ * placeholders. This is the case for SELECT statements whose placeholders are all compared to a column (=, <>, <, <=,
+ * >, >=, BETWEEN) in conjunctions and disjunctions of the WHERE clause. Placeholders anywhere else (e.g., in the
+ * SELECT list or in arithmetics) would keep the plan from being optimized, as their data type is unknown.
+ */
+bool is_parameterizable(const hsql::SQLParserResult& parsed_normalized_sql, const size_t literal_count);
+
+}  // namespace opossum
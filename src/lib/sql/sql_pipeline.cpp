@@ -9,6 +9,8 @@
 #include "create_sql_parser_error_message.hpp"
 #include "hyrise.hpp"
 #include "sql_plan_cache.hpp"
+#include "sql_query_statistics.hpp"
+#include "sql_workload_recorder.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
@@ -18,12 +20,13 @@ namespace opossum {
 SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache, const SessionID session_id)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql(sql),
       _transaction_context(transaction_context),
-      _optimizer(optimizer) {
+      _optimizer(optimizer),
+      _session_id(session_id) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context has to be active.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
@@ -83,10 +86,18 @@ SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<Transacti
     sql_string_offset += statement_string_length;
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
-                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache);
+                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache,
+                                                                     session_id);
     _sql_pipeline_statements.emplace_back(std::move(pipeline_statement));
   }
 
+  if (use_mvcc == UseMvcc::Yes && statement_count() > 1) {
+    _subplan_cache = std::make_shared<SQLSubplanCache>();
+    for (const auto& pipeline_statement : _sql_pipeline_statements) {
+      pipeline_statement->set_subplan_cache(_subplan_cache);
+    }
+  }
+
   // If we see at least one structure altering statement and we have more than one statement, we require execution of a
   // statement before the next one can be translated (so the next statement sees the previous structural changes).
   _requires_execution = seen_altering_statement && statement_count() > 1;
@@ -239,7 +250,17 @@ std::pair<SQLPipelineStatus, const std::vector<std::shared_ptr<const Table>>&> S
 
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->set_transaction_context(_transaction_context);
+    const auto statement_start = std::chrono::steady_clock::now();
     const auto& [statement_status, table] = pipeline_statement->get_result_table();
+
+    if (const auto workload_recorder = Hyrise::get().workload_recorder) {
+      // The transaction that the statement ran in, i.e., not the one that a BEGIN statement has just started
+      const auto transaction_id =
+          _transaction_context ? _transaction_context->transaction_id() : INVALID_TRANSACTION_ID;
+      workload_recorder->record(pipeline_statement->get_sql_string(), _session_id, transaction_id, statement_start,
+                                statement_status == SQLPipelineStatus::Success);
+    }
+
     if (statement_status == SQLPipelineStatus::Failure) {
       _failed_pipeline_statement = pipeline_statement;
 
@@ -258,6 +279,17 @@ std::pair<SQLPipelineStatus, const std::vector<std::shared_ptr<const Table>>&> S
 
     _result_tables.emplace_back(table);
 
+    if (const auto& query_statistics = Hyrise::get().query_statistics) {
+      query_statistics->record(pipeline_statement->get_sql_string(), _metrics.parse_time_nanos / statement_count(),
+                               *pipeline_statement->metrics(), table ? static_cast<size_t>(table->row_count()) : 0);
+    }
+
+    // The snapshot commit id does not cover the uncommitted modifications of a transaction. After statements that might
+    // have modified the data, the results of the previous statements are no longer shared.
+    if (_subplan_cache && !pipeline_statement->get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect)) {
+      _subplan_cache->clear();
+    }
+
     const auto& new_transaction_context = pipeline_statement->transaction_context();
 
     if (!new_transaction_context) {
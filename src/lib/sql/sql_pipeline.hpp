@@ -35,7 +35,7 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache, const SessionID session_id = 0);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -111,6 +111,11 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  const SessionID _session_id;
+
+  // Shares the results of sub-plans among the statements if the pipeline has more than one (see sql_subplan_cache.hpp)
+  std::shared_ptr<SQLSubplanCache> _subplan_cache;
+
   // Execution results
   std::vector<std::string> _sql_strings;
   std::vector<std::shared_ptr<hsql::SQLParserResult>> _parsed_sql_statements;
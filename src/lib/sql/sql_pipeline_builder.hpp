@@ -43,6 +43,12 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
 
+  /**
+   * The session of the statements, used by Hyrise::get().admission_control. Statements that are not issued by a
+   * server session share the session 0.
+   */
+  SQLPipelineBuilder& with_session_id(const SessionID session_id);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -58,6 +64,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  SessionID _session_id{0};
 };
 
 }  // namespace opossum
@@ -2,12 +2,15 @@
 
 #include <fstream>
 #include <iomanip>
+#include <unordered_map>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "concurrency/query_context.hpp"
+#include "cost_estimation/cost_model_calibration.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
@@ -18,11 +21,16 @@
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "optimizer/adaptive_reoptimizer.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/job_task.hpp"
+#include "sql/sql_literal_normalizer.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -31,12 +39,14 @@ namespace opossum {
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const SessionID session_id)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
+      _session_id(session_id),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
@@ -53,6 +63,10 @@ void SQLPipelineStatement::set_transaction_context(const std::shared_ptr<Transac
   _transaction_context = transaction_context;
 }
 
+void SQLPipelineStatement::set_subplan_cache(const std::shared_ptr<SQLSubplanCache>& subplan_cache) {
+  _subplan_cache = subplan_cache;
+}
+
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
 
 const std::shared_ptr<hsql::SQLParserResult>& SQLPipelineStatement::get_parsed_sql_statement() {
@@ -127,6 +141,14 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     }
   }
 
+  // Handle logical query plan if a statement that only differs in its literals has been cached
+  if (const auto& parameterized_plan_cache = Hyrise::get().parameterized_plan_cache) {
+    if (auto parameterized_plan = _get_parameterized_plan(*parameterized_plan_cache)) {
+      _optimized_logical_plan = std::move(parameterized_plan);
+      return _optimized_logical_plan;
+    }
+  }
+
   auto unoptimized_lqp = get_unoptimized_logical_plan();
 
   const auto started = std::chrono::high_resolution_clock::now();
@@ -159,7 +181,8 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   // If we need a transaction context but haven't passed one in, this is the last point where we can create it
   if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
-    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+    _transaction_context =
+        Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes, _auto_commit_access_mode());
   }
 
   // Stores when the actual compilation started/ended
@@ -186,7 +209,27 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
-    _physical_plan = LQPTranslator{}.translate_node(lqp);
+    if (_shares_subplans()) {
+      const auto snapshot_commit_id = _transaction_context->snapshot_commit_id();
+      const auto translator = LQPTranslator{[&](const auto& node) -> std::shared_ptr<const Table> {
+        if (!SQLSubplanCache::is_shareable(node)) return nullptr;
+
+        auto subplan_result = _subplan_cache->try_get(SQLSubplanCacheKey{node, snapshot_commit_id});
+        if (subplan_result) ++_metrics->shared_subplan_count;
+        return subplan_result;
+      }};
+      _physical_plan = translator.translate_node(lqp);
+
+      for (const auto& [node, op] : translator.operator_by_lqp_node()) {
+        // Operators with a row budget stop once the LIMIT above them is satisfied. Their output is incomplete with
+        // respect to their LQP node and must not be shared with other statements.
+        if (op->type() != OperatorType::TableWrapper && !op->row_budget && SQLSubplanCache::is_shareable(node)) {
+          _shareable_subplans.emplace_back(node, op);
+        }
+      }
+    } else {
+      _physical_plan = LQPTranslator{}.translate_node(lqp);
+    }
   }
 
   done = std::chrono::high_resolution_clock::now();
@@ -194,7 +237,9 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
+  // Plans with results of other statements must not be reused
+  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable &&
+      _metrics->shared_subplan_count == 0) {
     pqp_cache->set(_sql_string, _physical_plan);
   }
 
@@ -218,6 +263,99 @@ const std::vector<std::shared_ptr<AbstractTask>>& SQLPipelineStatement::get_task
   return _tasks;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_get_parameterized_plan(
+    SQLParameterizedPlanCache& parameterized_plan_cache) {
+  if (!get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect)) return nullptr;
+
+  // Statements without literals are handled by the logical plan cache
+  const auto normalized_sql = normalize_sql_literals(_sql_string);
+  if (!normalized_sql || normalized_sql->literals.empty()) return nullptr;
+
+  auto prepared_plan = std::shared_ptr<PreparedPlan>{};
+  if (const auto cached_plan = parameterized_plan_cache.try_get(normalized_sql->sql)) {
+    if (!*cached_plan) return nullptr;
+
+    // MVCC-enabled and MVCC-disabled plans will evict each other
+    if (lqp_is_validated((*cached_plan)->lqp) == (_use_mvcc == UseMvcc::Yes)) {
+      prepared_plan = *cached_plan;
+      _metrics->parameterized_plan_cache_hit = true;
+    }
+  }
+
+  if (!prepared_plan) {
+    auto parsed_normalized_sql = hsql::SQLParserResult{};
+    hsql::SQLParser::parse(normalized_sql->sql, &parsed_normalized_sql);
+
+    if (is_parameterizable(parsed_normalized_sql, normalized_sql->literals.size())) {
+      const auto started = std::chrono::high_resolution_clock::now();
+
+      auto translation_result = SQLTranslator{_use_mvcc}.translate_parser_result(parsed_normalized_sql);
+
+      const auto translated = std::chrono::high_resolution_clock::now();
+      _metrics->sql_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(translated - started);
+
+      if (translation_result.translation_info.cacheable) {
+        // The plan is optimized without knowing the values of the placeholders. Thus, the estimates of the predicates
+        // on them are less accurate and chunks cannot be pruned by the ChunkPruningRule.
+        auto optimizer_rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+        auto optimized_lqp =
+            _optimizer->optimize(std::move(translation_result.lqp_nodes.front()), optimizer_rule_durations);
+
+        const auto done = std::chrono::high_resolution_clock::now();
+        _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - translated);
+        _metrics->optimizer_rule_durations = *optimizer_rule_durations;
+
+        prepared_plan = std::make_shared<PreparedPlan>(
+            optimized_lqp, translation_result.translation_info.parameter_ids_of_value_placeholders);
+      }
+    }
+
+    // Statements that cannot be parameterized are cached as well, so that they are only parsed once more
+    parameterized_plan_cache.set(normalized_sql->sql, prepared_plan);
+    if (!prepared_plan) return nullptr;
+  }
+
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameters.reserve(normalized_sql->literals.size());
+  for (const auto& literal : normalized_sql->literals) {
+    parameters.emplace_back(std::make_shared<ValueExpression>(literal));
+  }
+
+  // PreparedPlan::instantiate copies the LQP, so that concurrent translations do not conflict
+  return prepared_plan->instantiate(parameters);
+}
+
+bool SQLPipelineStatement::_shares_subplans() {
+  return _subplan_cache && _use_mvcc == UseMvcc::Yes && _transaction_context &&
+         get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect);
+}
+
+std::vector<std::shared_ptr<AbstractTask>> SQLPipelineStatement::_get_subplan_tasks(
+    const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  auto task_by_operator = std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>{};
+  for (const auto& task : tasks) {
+    task_by_operator.emplace(static_cast<const OperatorTask&>(*task).get_operator(), task);
+  }
+
+  const auto snapshot_commit_id = _transaction_context->snapshot_commit_id();
+  auto subplan_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [node, op] : _shareable_subplans) {
+    // Operators can be replaced during the translation, e.g., if two scans are merged into a PipelinedTableScan
+    const auto task_iter = task_by_operator.find(op);
+    if (task_iter == task_by_operator.end()) continue;
+
+    // As a successor of the operator's task, the task also keeps the OperatorTasks from clearing the output early
+    auto key = SQLSubplanCacheKey{node->deep_copy(), snapshot_commit_id};
+    auto subplan_task = std::make_shared<JobTask>([subplan_cache = _subplan_cache, key = std::move(key), op = op] {
+      if (const auto& output = op->get_output()) subplan_cache->set(key, output);
+    });
+    task_iter->second->set_as_predecessor_of(subplan_task);
+    subplan_tasks.emplace_back(std::move(subplan_task));
+  }
+
+  return subplan_tasks;
+}
+
 std::vector<std::shared_ptr<AbstractTask>> SQLPipelineStatement::_get_transaction_tasks() {
   const auto& sql_statement = get_parsed_sql_statement();
   const std::vector<hsql::SQLStatement*>& statements = sql_statement->getStatements();
@@ -265,14 +403,87 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
-  const auto& tasks = get_tasks();
+  // The result cache is only used for auto-committed SELECT statements. Their snapshot is taken after the table
+  // versions have been read so that a cached result is never newer than the versions of its key.
+  const auto& result_cache = Hyrise::get().result_cache;
+  auto result_cache_key = std::optional<SQLResultCacheKey>{};
+  if (result_cache && _use_mvcc == UseMvcc::Yes && !_transaction_context &&
+      get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect)) {
+    const auto& optimized_logical_plan = get_optimized_logical_plan();
+    if (_translation_info.cacheable) result_cache_key = create_sql_result_cache_key(optimized_logical_plan);
+  }
+
+  if (result_cache_key) {
+    if (const auto cached_result = result_cache->try_get(*result_cache_key)) {
+      _result_table = *cached_result;
+      _metrics->result_cache_hit = true;
+      return {SQLPipelineStatus::Success, _result_table};
+    }
+  }
+
+  // With adaptive re-optimization, the plan is translated and executed step by step
+  const auto& adaptive_reoptimizer = Hyrise::get().adaptive_reoptimizer;
+  const auto reoptimize = adaptive_reoptimizer && !_is_transaction_statement() &&
+                          AdaptiveReoptimizer::is_applicable(get_optimized_logical_plan());
+
+  // If the transaction context has not been passed in, it is created with the physical plan
+  if (reoptimize && !_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    _transaction_context =
+        Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes, _auto_commit_access_mode());
+  }
+  const auto& tasks = reoptimize ? _tasks : get_tasks();
+
+  // Wait until the statement may execute. The time spent waiting is not part of the execution duration.
+  const auto& admission_control = Hyrise::get().admission_control;
+  const auto admission_ticket = admission_control ? admission_control->admit(_session_id) : nullptr;
 
   const auto started = std::chrono::high_resolution_clock::now();
 
-  DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
-                reinterpret_cast<uintptr_t>(this));
+  if (reoptimize) {
+    // The resulting plan contains the materialized intermediate results and is not cached
+    _tasks = adaptive_reoptimizer->execute(get_optimized_logical_plan(), _transaction_context);
+    _physical_plan = static_cast<const OperatorTask&>(*_tasks.back()).get_operator();
+  } else {
+    DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
+                  reinterpret_cast<uintptr_t>(this));
+
+    // While the plan is executed, it is listed in the meta_running_queries table and can be cancelled
+    auto query_context = std::shared_ptr<QueryContext>{};
+    if (!_is_transaction_statement()) {
+      query_context = std::make_shared<QueryContext>(_sql_string, _session_id, Hyrise::get().query_memory_limit);
+      const auto& physical_plan = get_physical_plan();
+      physical_plan->set_query_context_recursively(query_context);
+      query_context->set_physical_plan(physical_plan);
+      Hyrise::get().running_queries.add(query_context);
+    }
+
+    if (_shareable_subplans.empty()) {
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    } else {
+      auto all_tasks = tasks;
+      const auto subplan_tasks = _get_subplan_tasks(tasks);
+      all_tasks.insert(all_tasks.end(), subplan_tasks.begin(), subplan_tasks.end());
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(all_tasks);
+    }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    if (query_context) {
+      Hyrise::get().running_queries.remove(*query_context);
+      // The plan might be cached and is not supposed to hold on to the context
+      get_physical_plan()->set_query_context_recursively(nullptr);
+      _metrics->peak_memory_usage = query_context->memory_resource()->peak_allocated_bytes();
+
+      // The operators of a cancelled query return incomplete outputs, so its modifications are rolled back like those
+      // of a conflicting transaction
+      if (query_context->is_cancelled()) {
+        _metrics->cancelled = true;
+        _metrics->memory_limit_exceeded = query_context->memory_limit_exceeded();
+        if (_transaction_context && _transaction_context->phase() == TransactionPhase::Active) {
+          _transaction_context->rollback(RollbackReason::Conflict);
+        }
+        return {SQLPipelineStatus::Failure, _result_table};
+      }
+    }
+  }
 
   if (has_failed()) {
     return {SQLPipelineStatus::Failure, _result_table};
@@ -299,6 +510,23 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   if (!_result_table) _query_has_output = false;
 
+  if (result_cache_key && _result_table) {
+    const auto result_size = _result_table->memory_usage(MemoryUsageCalculationMode::Sampled);
+    if (result_size <= MAX_CACHED_RESULT_SIZE) {
+      // The key's LQP is copied so that it does not change with the plan held by this statement
+      result_cache_key->lqp = result_cache_key->lqp->deep_copy();
+      result_cache->set(*result_cache_key, _result_table, 1.0, static_cast<double>(std::max(result_size, size_t{1})));
+    }
+  }
+
+  if (const auto& cost_model_calibration = Hyrise::get().cost_model_calibration) {
+    cost_model_calibration->add_plan(get_physical_plan());
+  }
+
+  if (const auto& cardinality_feedback = Hyrise::get().cardinality_feedback) {
+    cardinality_feedback->add_plan(get_physical_plan());
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
                 _metrics->plan_execution_duration.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -366,4 +594,10 @@ bool SQLPipelineStatement::_is_transaction_statement() {
   return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtTransaction);
 }
 
+TransactionAccessMode SQLPipelineStatement::_auto_commit_access_mode() {
+  return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtSelect)
+             ? TransactionAccessMode::ReadOnly
+             : TransactionAccessMode::ReadWrite;
+}
+
 }  // namespace opossum
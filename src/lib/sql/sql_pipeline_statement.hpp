@@ -11,6 +11,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/sql_subplan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "sql_plan_cache.hpp"
 #include "storage/table.hpp"
@@ -26,6 +27,19 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool parameterized_plan_cache_hit = false;
+  bool result_cache_hit = false;
+
+  // Set if the statement was cancelled while its plan was executed, e.g., because it exceeded the memory limit (see
+  // query_context.hpp)
+  bool cancelled = false;
+  bool memory_limit_exceeded = false;
+
+  // The peak memory usage of the intermediate results and data structures of the plan's operators
+  size_t peak_memory_usage = 0;
+
+  // Number of sub-plans whose results were shared by earlier statements of the pipeline (see sql_subplan_cache.hpp)
+  size_t shared_subplan_count = 0;
 };
 
 enum class SQLPipelineStatus {
@@ -57,11 +71,14 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache, const SessionID session_id = 0);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  // Set by the SQLPipeline to share the results of sub-plans among its statements (see sql_subplan_cache.hpp)
+  void set_subplan_cache(const std::shared_ptr<SQLSubplanCache>& subplan_cache);
+
   // Returns the raw SQL string.
   const std::string& get_sql_string();
 
@@ -106,6 +123,23 @@ class SQLPipelineStatement : public Noncopyable {
  private:
   bool _is_transaction_statement();
 
+  // Auto-committed SELECTs cannot modify data, so their transactions are created as read-only
+  TransactionAccessMode _auto_commit_access_mode();
+
+  // Instantiates the optimized LQP shared by all statements that only differ in their literals. If it is not in
+  // Hyrise::get().parameterized_plan_cache yet, it is created and cached. Returns nullptr if the statement cannot be
+  // parameterized.
+  std::shared_ptr<AbstractLQPNode> _get_parameterized_plan(SQLParameterizedPlanCache& parameterized_plan_cache);
+
+  // Returns whether the sub-plans of the statement are shared with other statements of the pipeline. Only SELECT
+  // statements with a transaction context take part.
+  bool _shares_subplans();
+
+  // Returns the tasks that store the results of the shareable sub-plans in the SQLSubplanCache once the operators of
+  // @param tasks have executed
+  std::vector<std::shared_ptr<AbstractTask>> _get_subplan_tasks(
+      const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -119,6 +153,9 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  // Used by the AdmissionControl to schedule the statements of different sessions fairly
+  const SessionID _session_id;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
@@ -132,6 +169,11 @@ class SQLPipelineStatement : public Noncopyable {
 
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
+  std::shared_ptr<SQLSubplanCache> _subplan_cache;
+
+  // The translated sub-plans whose results are shared with the following statements
+  std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, std::shared_ptr<AbstractOperator>>> _shareable_subplans;
+
   // Either a multi-statement transaction context that was passed in using set_transaction_context or an auto-commit
   // transaction context created by the SQLPipelineStatement itself. Might be changed during the execution of this
   // statement, e.g., if it is a BEGIN statement.
@@ -3,14 +3,20 @@
 #include <memory>
 #include <string>
 
-#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_gdfs_cache.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
-using SQLPhysicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
-using SQLLogicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+// The plan caches are queried by every statement of every session. Thus, their hits must not serialize on a lock.
+using SQLPhysicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
+using SQLLogicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+
+// Caches the optimized LQPs of statements keyed by their normalized SQL string (see sql_literal_normalizer.hpp), in
+// which the literals are placeholders. A nullptr marks statements whose plan cannot be parameterized.
+using SQLParameterizedPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<PreparedPlan>>;
 
 }  // namespace opossum
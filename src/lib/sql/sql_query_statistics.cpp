@@ -0,0 +1,80 @@
+#include "sql_query_statistics.hpp"
+
+#include <algorithm>
+
+#include "sql/sql_literal_normalizer.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+
+namespace opossum {
+
+std::chrono::nanoseconds SQLQueryStatistics::Entry::p99(const Phase phase) const {
+  if (samples.empty()) return std::chrono::nanoseconds{0};
+
+  const auto phase_id = static_cast<size_t>(phase);
+  auto durations = std::vector<std::chrono::nanoseconds>{};
+  durations.reserve(samples.size());
+  for (const auto& sample : samples) {
+    durations.emplace_back(sample[phase_id]);
+  }
+
+  // Nearest-rank percentile
+  const auto rank = (durations.size() * 99 + 99) / 100 - 1;
+  std::nth_element(durations.begin(), durations.begin() + rank, durations.end());
+  return durations[rank];
+}
+
+void SQLQueryStatistics::record(const std::string& sql, const std::chrono::nanoseconds parse_duration,
+                                const SQLPipelineStatementMetrics& metrics, const size_t row_count) {
+  // Statements with value placeholders are not normalized and are tracked as they are
+  const auto normalized_sql = normalize_sql_literals(sql);
+  const auto& query = normalized_sql ? normalized_sql->sql : sql;
+
+  auto durations = Durations{};
+  durations[static_cast<size_t>(Phase::Parse)] = parse_duration;
+  durations[static_cast<size_t>(Phase::Translate)] =
+      metrics.sql_translation_duration + metrics.lqp_translation_duration;
+  durations[static_cast<size_t>(Phase::Optimize)] = metrics.optimization_duration;
+  durations[static_cast<size_t>(Phase::Execute)] = metrics.plan_execution_duration;
+  durations[static_cast<size_t>(Phase::Total)] = durations[0] + durations[1] + durations[2] + durations[3];
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  auto entry_iter = _entries.find(query);
+  if (entry_iter == _entries.end()) {
+    if (_entries.size() >= MAX_QUERY_COUNT) {
+      const auto least_called_iter =
+          std::min_element(_entries.begin(), _entries.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.call_count < rhs.second.call_count;
+          });
+      _entries.erase(least_called_iter);
+    }
+    entry_iter = _entries.emplace(query, Entry{}).first;
+  }
+
+  auto& entry = entry_iter->second;
+  if (entry.samples.size() < MAX_SAMPLE_COUNT) {
+    entry.samples.emplace_back(durations);
+  } else {
+    entry.samples[entry.call_count % MAX_SAMPLE_COUNT] = durations;
+  }
+
+  ++entry.call_count;
+  entry.row_count += row_count;
+  if (metrics.query_plan_cache_hit || metrics.parameterized_plan_cache_hit) ++entry.plan_cache_hit_count;
+  if (metrics.result_cache_hit) ++entry.result_cache_hit_count;
+  for (auto phase_id = size_t{0}; phase_id < PHASE_COUNT; ++phase_id) {
+    entry.total_durations[phase_id] += durations[phase_id];
+  }
+}
+
+std::unordered_map<std::string, SQLQueryStatistics::Entry> SQLQueryStatistics::entries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries;
+}
+
+void SQLQueryStatistics::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+}
+
+}  // namespace opossum
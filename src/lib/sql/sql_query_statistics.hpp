@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace opossum {
+
+struct SQLPipelineStatementMetrics;
+
+/**
+ * Aggregates the metrics of executed SQL statements per normalized query, i.e., statements that only differ in their
+ * literals (see sql_literal_normalizer.hpp) share their statistics. Set Hyrise::get().query_statistics to enable it.
+ * The statistics are exposed by the meta_query_statistics table.
+ *
+ * For percentiles, the latencies of the last MAX_SAMPLE_COUNT executions of each query are kept. At most
+ * MAX_QUERY_COUNT queries are tracked. Beyond that, the query with the fewest executions is dropped.
+ */
+class SQLQueryStatistics {
+ public:
+  static constexpr auto MAX_QUERY_COUNT = size_t{1'000};
+  static constexpr auto MAX_SAMPLE_COUNT = size_t{1'024};
+
+  enum class Phase { Parse, Translate, Optimize, Execute, Total };
+  static constexpr auto PHASE_COUNT = size_t{5};
+
+  using Durations = std::array<std::chrono::nanoseconds, PHASE_COUNT>;
+
+  struct Entry {
+    size_t call_count{0};
+    size_t row_count{0};
+    size_t plan_cache_hit_count{0};
+    size_t result_cache_hit_count{0};
+    Durations total_durations{};
+
+    // Ring buffer of the durations of the last MAX_SAMPLE_COUNT executions
+    std::vector<Durations> samples;
+
+    // Returns the 99th percentile of the sampled durations of the phase
+    std::chrono::nanoseconds p99(const Phase phase) const;
+  };
+
+  // Records a successfully executed statement. As the SQLPipeline parses all of its statements at once, the caller
+  // passes the share of the parse time.
+  void record(const std::string& sql, const std::chrono::nanoseconds parse_duration,
+              const SQLPipelineStatementMetrics& metrics, const size_t row_count);
+
+  // Returns a copy of the statistics, keyed by the normalized query
+  std::unordered_map<std::string, Entry> entries() const;
+
+  void clear();
+
+ private:
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, Entry> _entries;
+};
+
+}  // namespace opossum
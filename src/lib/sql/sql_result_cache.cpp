@@ -0,0 +1,87 @@
+#include "sql_result_cache.hpp"
+
+#include <algorithm>
+
+#include <boost/functional/hash.hpp>
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+bool SQLResultCacheKey::operator==(const SQLResultCacheKey& other) const {
+  return table_versions == other.table_versions && (lqp == other.lqp || *lqp == *other.lqp);
+}
+
+size_t SQLResultCacheKey::hash() const {
+  auto hash = lqp->hash();
+  for (const auto& [table, version] : table_versions) {
+    boost::hash_combine(hash, table.get());
+    boost::hash_combine(hash, version);
+  }
+  return hash;
+}
+
+std::optional<SQLResultCacheKey> create_sql_result_cache_key(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  if (!lqp_is_validated(lqp)) return std::nullopt;
+
+  auto key = SQLResultCacheKey{lqp, {}};
+  auto cacheable = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+        const auto table = std::shared_ptr<const Table>{Hyrise::get().storage_manager.get_table(table_name)};
+
+        const auto is_known_table =
+            std::any_of(key.table_versions.begin(), key.table_versions.end(),
+                        [&](const auto& table_version) { return table_version.first == table; });
+        if (!is_known_table) key.table_versions.emplace_back(table, table->version());
+      }
+
+      for (const auto& node_expression : node->node_expressions) {
+        visit_expression(node_expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::Placeholder ||
+              sub_expression->type == ExpressionType::CorrelatedParameter) {
+            cacheable = false;
+            return ExpressionVisitation::DoNotVisitArguments;
+          }
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+
+      return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+  }
+
+  if (!cacheable) return std::nullopt;
+  return key;
+}
+
+std::optional<SQLResultCacheKey> create_subquery_result_cache_key(const AbstractOperator& pqp) {
+  if (!pqp.lqp_node) return std::nullopt;
+
+  const auto transaction_context = pqp.transaction_context();
+  if (!transaction_context || !transaction_context->read_write_operators().empty()) return std::nullopt;
+
+  auto key = create_sql_result_cache_key(std::const_pointer_cast<AbstractLQPNode>(pqp.lqp_node));
+  if (!key) return std::nullopt;
+
+  // The versions are read before the last commit id. If no commit was published since the snapshot, the snapshot sees
+  // the rows of the versions.
+  if (Hyrise::get().transaction_manager.last_commit_id() != transaction_context->snapshot_commit_id()) {
+    return std::nullopt;
+  }
+
+  return key;
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "cache/sharded_gdfs_cache.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class Table;
+
+/**
+ * Identifies the result of a SELECT statement. Dashboard-like workloads repeat the same statements against data that
+ * rarely changes. As long as no transaction modified the stored tables of a statement, every new snapshot sees the same
+ * rows and the statement produces the same result.
+ *
+ * The result is identified by the optimized LQP and the versions (see Table::version) of the stored tables that it
+ * reads. As the versions are part of the key, a cached result is no longer found once one of its tables has been
+ * modified. Outdated results are evicted eventually.
+ */
+struct SQLResultCacheKey {
+  std::shared_ptr<const AbstractLQPNode> lqp;
+
+  // In the order in which the LQP's StoredTableNodes are visited. Holding the tables guards against tables that are
+  // replaced (e.g., by dropping and re-adding them), so that another table is not mistaken for an earlier version.
+  std::vector<std::pair<std::shared_ptr<const Table>, uint64_t>> table_versions;
+
+  bool operator==(const SQLResultCacheKey& other) const;
+  size_t hash() const;
+};
+
+// Caches the result tables of SELECT statements that are executed in auto-commit transactions. Set
+// Hyrise::get().result_cache to enable it. The capacity is the number of cached results, each of which holds at most
+// MAX_CACHED_RESULT_SIZE bytes. This bounds the memory of cached results to capacity * MAX_CACHED_RESULT_SIZE.
+using SQLResultCache = ShardedGDFSCache<SQLResultCacheKey, std::shared_ptr<const Table>>;
+
+constexpr auto MAX_CACHED_RESULT_SIZE = size_t{4'000'000};
+
+// Returns the key for the result of @param lqp, using the current versions of the stored tables. Returns std::nullopt
+// if the result depends on more than the rows visible in the snapshot, i.e., if the LQP is not validated or has
+// placeholders or correlated parameters.
+std::optional<SQLResultCacheKey> create_sql_result_cache_key(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+/**
+ * Returns the key for the result of the uncorrelated subquery @param pqp, which is identified by the LQP that it was
+ * translated from (see Hyrise::subquery_result_cache). Unlike SELECT statements, subqueries are executed in a
+ * transaction whose snapshot was taken before the table versions are read. Thus, std::nullopt is also returned if a
+ * commit was published since the snapshot, which might have increased the versions without being visible to the
+ * snapshot, or if the transaction modified rows itself.
+ */
+std::optional<SQLResultCacheKey> create_subquery_result_cache_key(const AbstractOperator& pqp);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::SQLResultCacheKey> {
+  size_t operator()(const opossum::SQLResultCacheKey& key) const { return key.hash(); }
+};
+
+}  // namespace std
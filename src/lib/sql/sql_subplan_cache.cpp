@@ -0,0 +1,54 @@
+#include "sql_subplan_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/join_hash/join_hash_build_cache.hpp"
+
+namespace opossum {
+
+bool SQLSubplanCacheKey::operator==(const SQLSubplanCacheKey& other) const {
+  return snapshot_commit_id == other.snapshot_commit_id && (lqp == other.lqp || *lqp == *other.lqp);
+}
+
+size_t SQLSubplanCacheKey::hash() const {
+  auto hash = lqp->hash();
+  boost::hash_combine(hash, snapshot_commit_id);
+  return hash;
+}
+
+bool SQLSubplanCache::is_shareable(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  switch (lqp->type) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Join:
+    case LQPNodeType::Predicate:
+      // Build inputs of the JoinHashBuildCache have the same requirements: The LQP has to be validated and must not
+      // depend on parameters or subqueries.
+      return join_hash_build_input_is_cacheable(lqp);
+    default:
+      return false;
+  }
+}
+
+std::shared_ptr<const Table> SQLSubplanCache::try_get(const SQLSubplanCacheKey& key) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto result_iter = _results.find(key);
+  return result_iter != _results.end() ? result_iter->second : nullptr;
+}
+
+void SQLSubplanCache::set(const SQLSubplanCacheKey& key, const std::shared_ptr<const Table>& result) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _results.insert_or_assign(key, result);
+}
+
+size_t SQLSubplanCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _results.size();
+}
+
+void SQLSubplanCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _results.clear();
+}
+
+}  // namespace opossum
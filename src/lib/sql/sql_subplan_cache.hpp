@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Identifies the result of a sub-plan. As for the JoinHashBuildCache (see join_hash_build_cache.hpp), two statements
+ * with the same snapshot commit id see the same committed rows, so equal sub-plans produce the same result.
+ */
+struct SQLSubplanCacheKey {
+  std::shared_ptr<const AbstractLQPNode> lqp;
+  CommitID snapshot_commit_id{0};
+
+  bool operator==(const SQLSubplanCacheKey& other) const;
+  size_t hash() const;
+};
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::SQLSubplanCacheKey> {
+  size_t operator()(const opossum::SQLSubplanCacheKey& key) const { return key.hash(); }
+};
+
+}  // namespace std
+
+namespace opossum {
+
+/**
+ * Shares the results of equal sub-plans among the statements of a multi-statement SQLPipeline. Report generation
+ * submits many statements that filter or join the same tables in the same way. The LQPTranslator deduplicates equal
+ * sub-plans within a statement. Across statements, the results of the predicates, joins, and aggregates of a
+ * statement are kept here, and the LQPTranslator wraps them in TableWrappers for the following statements.
+ *
+ * Uncommitted modifications are not covered by the snapshot commit id. Thus, the SQLPipeline clears the cache after
+ * each statement that is not a SELECT statement, which also covers statements that change the tables themselves.
+ */
+class SQLSubplanCache : public Noncopyable {
+ public:
+  // Returns whether the result of @param lqp only depends on the snapshot and can be shared
+  static bool is_shareable(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+  std::shared_ptr<const Table> try_get(const SQLSubplanCacheKey& key) const;
+  void set(const SQLSubplanCacheKey& key, const std::shared_ptr<const Table>& result);
+
+  size_t size() const;
+  void clear();
+
+ private:
+  mutable std::mutex _mutex;
+  std::unordered_map<SQLSubplanCacheKey, std::shared_ptr<const Table>> _results;
+};
+
+}  // namespace opossum
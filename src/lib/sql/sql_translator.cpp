@@ -1545,8 +1545,13 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           aggregate_function = AggregateFunction::CountDistinct;
         }
 
-        AssertInput(expr.exprList && expr.exprList->size() == 1,
-                    "Expected exactly one argument for this AggregateFunction");
+        if (aggregate_function == AggregateFunction::ApproxPercentile) {
+          AssertInput(expr.exprList && expr.exprList->size() == 2,
+                      "Expected an argument and a percentile for APPROX_PERCENTILE");
+        } else {
+          AssertInput(expr.exprList && expr.exprList->size() == 1,
+                      "Expected exactly one argument for this AggregateFunction");
+        }
 
         auto aggregate_expression = std::shared_ptr<AggregateExpression>{};
 
@@ -1555,10 +1560,22 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           case AggregateFunction::Max:
           case AggregateFunction::Sum:
           case AggregateFunction::Avg:
-          case AggregateFunction::StandardDeviationSample: {
+          case AggregateFunction::StandardDeviationSample:
+          case AggregateFunction::ApproxCountDistinct: {
             aggregate_expression = std::make_shared<AggregateExpression>(
                 aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
           } break;
+          case AggregateFunction::ApproxPercentile: {
+            const auto& percentile_expr = *expr.exprList->at(1);
+            const auto is_float = percentile_expr.type == hsql::kExprLiteralFloat;
+            AssertInput(is_float || percentile_expr.type == hsql::kExprLiteralInt,
+                        "Expected the percentile of APPROX_PERCENTILE to be a number");
+            const auto percentile = is_float ? percentile_expr.fval : static_cast<double>(percentile_expr.ival);
+            AssertInput(percentile >= 0.0 && percentile <= 1.0,
+                        "Expected the percentile of APPROX_PERCENTILE to be between 0 and 1");
+            aggregate_expression = std::make_shared<AggregateExpression>(
+                aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver), percentile);
+          } break;
           case AggregateFunction::Any:
             Fail("ANY() is an internal aggregation function.");
           case AggregateFunction::Count:
@@ -0,0 +1,98 @@
+#include "sql_workload_recorder.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void write_value(std::ofstream& file, const T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::ifstream& file, T& value) {
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return file.gcount() == static_cast<std::streamsize>(sizeof(T));
+}
+
+}  // namespace
+
+namespace opossum {
+
+SQLWorkloadRecorder::SQLWorkloadRecorder(const std::filesystem::path& path) { open(path); }
+
+void SQLWorkloadRecorder::open(const std::filesystem::path& path) {
+  auto file = std::ofstream{path, std::ios::binary | std::ios::app};
+  Assert(file.is_open(), "Could not open workload log '" + path.string() + "': " + std::strerror(errno));
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _path = path;
+  _file = std::move(file);
+  _begin = std::chrono::steady_clock::now();
+}
+
+void SQLWorkloadRecorder::record(const std::string& sql, const SessionID session_id,
+                                 const TransactionID transaction_id, const std::chrono::steady_clock::time_point start,
+                                 const bool succeeded) {
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  // Statements that started before the file was opened are recorded as if they had started with it
+  const auto offset = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(start - _begin),
+                               std::chrono::nanoseconds{0});
+  write_value(_file, static_cast<uint64_t>(offset.count()));
+  write_value(_file, static_cast<uint64_t>(duration.count()));
+  write_value(_file, static_cast<uint32_t>(session_id));
+  write_value(_file, static_cast<uint32_t>(transaction_id));
+  write_value(_file, static_cast<uint8_t>(succeeded));
+  write_value(_file, static_cast<uint32_t>(sql.size()));
+  _file.write(sql.data(), static_cast<std::streamsize>(sql.size()));
+}
+
+void SQLWorkloadRecorder::flush() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _file.flush();
+}
+
+std::filesystem::path SQLWorkloadRecorder::path() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _path;
+}
+
+std::vector<SQLWorkloadRecorder::Record> SQLWorkloadRecorder::read(const std::filesystem::path& path) {
+  auto file = std::ifstream{path, std::ios::binary};
+  Assert(file.is_open(), "Could not open workload log '" + path.string() + "': " + std::strerror(errno));
+
+  auto records = std::vector<Record>{};
+  while (true) {
+    auto start = uint64_t{};
+    auto duration = uint64_t{};
+    auto session_id = uint32_t{};
+    auto transaction_id = uint32_t{};
+    auto succeeded = uint8_t{};
+    auto sql_size = uint32_t{};
+    if (!read_value(file, start) || !read_value(file, duration) || !read_value(file, session_id) ||
+        !read_value(file, transaction_id) || !read_value(file, succeeded) || !read_value(file, sql_size)) {
+      break;
+    }
+
+    auto sql = std::string(sql_size, '\0');
+    file.read(sql.data(), static_cast<std::streamsize>(sql_size));
+    if (file.gcount() != static_cast<std::streamsize>(sql_size)) break;
+
+    records.emplace_back(Record{std::chrono::nanoseconds{start}, std::chrono::nanoseconds{duration},
+                                SessionID{session_id}, TransactionID{transaction_id}, succeeded != 0, std::move(sql)});
+  }
+
+  return records;
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Records the SQL statements executed by SQLPipelines into a log file, so that a production workload can be replayed
+ * later, e.g., against a snapshot of the data to evaluate a different configuration (see hyriseWorkloadReplay). Set
+ * Hyrise::get().workload_recorder to enable it, e.g., by loading the WorkloadCapturePlugin.
+ *
+ * For each statement, the log contains its start relative to the opening of the file, its duration, its session, its
+ * transaction, whether it succeeded, and its SQL string. Parameters are part of the SQL string as literals. Explicit
+ * transactions are recorded as their BEGIN, COMMIT, and ROLLBACK statements. Transactions that are committed through
+ * the TransactionContext instead (e.g., by the benchmark drivers) are identified by the id of the transaction that a
+ * statement ran in. Statements that raise an error (e.g., because of invalid SQL) are not recorded, failed ones (i.e.,
+ * transaction conflicts) are. Prepared statements that the server executes without an SQLPipeline (i.e., the Bind and
+ * Execute messages of the extended query protocol) are not recorded either.
+ *
+ * Records are appended in a binary format with integers in host byte order:
+ * [u64 start ns][u64 duration ns][u32 session id][u32 transaction id][u8 succeeded][u32 SQL size][SQL]
+ */
+class SQLWorkloadRecorder : public Noncopyable {
+ public:
+  struct Record {
+    std::chrono::nanoseconds start;
+    std::chrono::nanoseconds duration;
+    SessionID session_id;
+    // INVALID_TRANSACTION_ID for auto-committed statements
+    TransactionID transaction_id;
+    bool succeeded;
+    std::string sql;
+  };
+
+  explicit SQLWorkloadRecorder(const std::filesystem::path& path);
+
+  // Closes the current log file and appends future records to the given one. The starts of their statements are
+  // relative to this call.
+  void open(const std::filesystem::path& path);
+
+  // Records a statement that was started at the given time and has just finished
+  void record(const std::string& sql, const SessionID session_id, const TransactionID transaction_id,
+              const std::chrono::steady_clock::time_point start, const bool succeeded);
+
+  void flush();
+
+  std::filesystem::path path() const;
+
+  // Reads all records of a log file. A truncated last record (e.g., of a process that crashed) is ignored.
+  static std::vector<Record> read(const std::filesystem::path& path);
+
+ private:
+  mutable std::mutex _mutex;
+  std::filesystem::path _path;
+  std::ofstream _file;
+  std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace opossum
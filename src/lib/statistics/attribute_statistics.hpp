@@ -6,6 +6,7 @@
 #include "base_attribute_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "types.hpp"
 
@@ -20,6 +21,8 @@ template <typename T>
 class RangeFilter;
 template <typename T>
 class CountingQuotientFilter;
+template <typename T>
+class BlockedBloomFilter;
 
 /**
  * For docs, see BaseAttributeStatistics
@@ -41,10 +44,15 @@ class AttributeStatistics : public BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
 
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
   std::shared_ptr<AbstractHistogram<T>> histogram;
   std::shared_ptr<MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<RangeFilter<T>> range_filter;
   std::shared_ptr<NullValueRatioStatistics> null_value_ratio;
+  std::shared_ptr<HyperLogLogSketch> distinct_count_sketch;
+  std::shared_ptr<BlockedBloomFilter<T>> bloom_filter;
 };
 
 template <typename T>
@@ -65,10 +73,18 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     stream << "Has RangeFilter" << std::endl;
   }
 
+  if (attribute_statistics.bloom_filter) {
+    stream << "Has BlockedBloomFilter" << std::endl;
+  }
+
   if (attribute_statistics.null_value_ratio) {
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << std::endl;
   }
 
+  if (attribute_statistics.distinct_count_sketch) {
+    stream << "DistinctCount: " << attribute_statistics.distinct_count_sketch->distinct_count() << std::endl;
+  }
+
   stream << "}" << std::endl;
 
   return stream;
@@ -52,6 +52,13 @@ class BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns true if the filters (MinMaxFilter, RangeFilter) rule out that any value satisfies the predicate. Used for
+   * pruning chunks based on their pruning statistics. The values must be of the data type of the attribute.
+   */
+  virtual bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const = 0;
+
   const DataType data_type;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "join_graph_statistics_cache.hpp"
 
 namespace opossum {
@@ -11,6 +13,9 @@ class CardinalityEstimationCache {
 
   using StatisticsByLQP = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<TableStatistics>>;
   std::optional<StatisticsByLQP> statistics_by_lqp;
+
+  // Guards both caches, so that plans can be estimated concurrently (see DpCcp)
+  std::mutex mutex;
 };
 
 }  // namespace opossum
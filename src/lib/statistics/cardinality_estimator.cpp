@@ -2,14 +2,18 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 
 #include "attribute_statistics.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
@@ -24,15 +28,19 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "logical_query_plan/window_node.hpp"
 #include "lossy_cast.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
 #include "utils/assert.hpp"
@@ -65,6 +73,227 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+// Without histograms (e.g., for strings), inner equi joins can be estimated as |L| * |R| / max(d(L), d(R)), assuming
+// that each value of the side with fewer distinct values has a join partner
+std::optional<Cardinality> estimate_inner_equi_join_with_sketches(const TableStatistics& left_input_table_statistics,
+                                                                  const ColumnID left_column_id,
+                                                                  const TableStatistics& right_input_table_statistics,
+                                                                  const ColumnID right_column_id) {
+  const auto left_distinct_count =
+      CardinalityEstimator::estimate_distinct_count(*left_input_table_statistics.column_statistics[left_column_id]);
+  const auto right_distinct_count =
+      CardinalityEstimator::estimate_distinct_count(*right_input_table_statistics.column_statistics[right_column_id]);
+  if (!left_distinct_count || !right_distinct_count) return std::nullopt;
+
+  const auto max_distinct_count = std::max(*left_distinct_count, *right_distinct_count);
+  if (max_distinct_count == 0.0f) return Cardinality{0};
+  return left_input_table_statistics.row_count * right_input_table_statistics.row_count / max_distinct_count;
+}
+
+// The statistics of a join with the given cardinality, for which the statistics of both inputs are scaled
+std::shared_ptr<TableStatistics> scaled_join_statistics(const TableStatistics& left_input_table_statistics,
+                                                        const TableStatistics& right_input_table_statistics,
+                                                        const Cardinality cardinality) {
+  const auto left_selectivity = Selectivity{
+      left_input_table_statistics.row_count > 0 ? cardinality / left_input_table_statistics.row_count : 0.0f};
+  const auto right_selectivity = Selectivity{
+      right_input_table_statistics.row_count > 0 ? cardinality / right_input_table_statistics.row_count : 0.0f};
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(left_input_table_statistics.column_statistics.size() +
+                            right_input_table_statistics.column_statistics.size());
+  for (const auto& left_column_statistics : left_input_table_statistics.column_statistics) {
+    column_statistics.emplace_back(left_column_statistics->scaled(left_selectivity));
+  }
+  for (const auto& right_column_statistics : right_input_table_statistics.column_statistics) {
+    column_statistics.emplace_back(right_column_statistics->scaled(right_selectivity));
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), cardinality);
+}
+
+// A column of a stored table, for which multi-column statistics can be obtained
+struct StoredTableColumn {
+  std::shared_ptr<const StoredTableNode> stored_table_node;
+  ColumnID column_id;
+};
+
+std::optional<StoredTableColumn> stored_table_column(const std::shared_ptr<AbstractExpression>& expression) {
+  const auto column_expression = std::dynamic_pointer_cast<const LQPColumnExpression>(expression);
+  if (!column_expression || column_expression->original_column_id == INVALID_COLUMN_ID) return std::nullopt;
+
+  const auto stored_table_node =
+      std::dynamic_pointer_cast<const StoredTableNode>(column_expression->original_node.lock());
+  if (!stored_table_node) return std::nullopt;
+
+  return StoredTableColumn{stored_table_node, column_expression->original_column_id};
+}
+
+std::optional<Cardinality> column_group_distinct_count(const StoredTableNode& stored_table_node,
+                                                       const std::vector<ColumnID>& column_ids) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto& table_statistics = table->table_statistics();
+  if (!table_statistics || !table_statistics->column_group_statistics) return std::nullopt;
+
+  return table_statistics->column_group_statistics->distinct_count(*table, column_ids);
+}
+
+// The predicates of the chain of PredicateNodes (and the inner join) that @param lqp starts with, i.e., the predicates
+// that are applied before a predicate on top of it
+std::vector<std::shared_ptr<AbstractExpression>> preceding_predicates(std::shared_ptr<AbstractLQPNode> lqp) {
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  while (lqp) {
+    if (lqp->type == LQPNodeType::Predicate) {
+      const auto conjunction = static_cast<const PredicateNode&>(*lqp).predicate();
+      const auto flattened_predicates = flatten_logical_expressions(conjunction, LogicalOperator::And);
+      predicates.insert(predicates.end(), flattened_predicates.begin(), flattened_predicates.end());
+    } else if (lqp->type == LQPNodeType::Join) {
+      const auto& join_node = static_cast<const JoinNode&>(*lqp);
+      if (join_node.join_mode == JoinMode::Inner) {
+        predicates.insert(predicates.end(), join_node.join_predicates().begin(), join_node.join_predicates().end());
+      }
+      break;
+    } else if (lqp->type != LQPNodeType::Validate) {
+      break;
+    }
+    lqp = lqp->left_input();
+  }
+  return predicates;
+}
+
+/**
+ * Estimates the selectivity of an equality predicate on a stored column, given the preceding predicates, with
+ * ColumnGroupStatistics. The selectivity under the independence assumption is that of the predicate alone. However,
+ * if preceding predicates check columns of the same tables for equality, the combination is estimated instead:
+ *
+ *   - `a = x` after `b = y` on the same table selects distinct_count(b) / distinct_count(a, b) of the rows, so that
+ *     both predicates select 1 / distinct_count(a, b) of the input.
+ *   - `l.a = r.a` after `l.b = r.b` selects max(distinct_count(l.b), distinct_count(r.b)) /
+ *     max(distinct_count(l.a, l.b), distinct_count(r.a, r.b)) of the rows, so that the multi-column join is estimated
+ *     as |l| * |r| / max(distinct_count(l.a, l.b), distinct_count(r.a, r.b)).
+ *
+ * Returns nullopt if no such preceding predicates exist, i.e., if the independence assumption holds.
+ */
+std::optional<Selectivity> correlated_equals_selectivity(
+    const AbstractExpression& predicate, const std::vector<std::shared_ptr<AbstractExpression>>& preceding_predicates) {
+  const auto equals_operands = [](const AbstractExpression& expression)
+      -> std::optional<std::pair<std::shared_ptr<AbstractExpression>, std::shared_ptr<AbstractExpression>>> {
+    const auto* binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&expression);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+    return std::pair{binary_predicate->left_operand(), binary_predicate->right_operand()};
+  };
+
+  const auto operands = equals_operands(predicate);
+  if (!operands) return std::nullopt;
+
+  const auto left_column = stored_table_column(operands->first);
+  const auto right_column = stored_table_column(operands->second);
+
+  if (left_column && right_column) {
+    if (left_column->stored_table_node == right_column->stored_table_node) return std::nullopt;
+
+    // Multi-column join: Collect the preceding join predicates between the same two tables
+    auto left_column_ids = std::vector<ColumnID>{};
+    auto right_column_ids = std::vector<ColumnID>{};
+    for (const auto& preceding_predicate : preceding_predicates) {
+      const auto preceding_operands = equals_operands(*preceding_predicate);
+      if (!preceding_operands) continue;
+
+      auto preceding_left_column = stored_table_column(preceding_operands->first);
+      auto preceding_right_column = stored_table_column(preceding_operands->second);
+      if (!preceding_left_column || !preceding_right_column) continue;
+
+      if (preceding_left_column->stored_table_node == right_column->stored_table_node) {
+        std::swap(preceding_left_column, preceding_right_column);
+      }
+      if (preceding_left_column->stored_table_node != left_column->stored_table_node ||
+          preceding_right_column->stored_table_node != right_column->stored_table_node) {
+        continue;
+      }
+
+      left_column_ids.emplace_back(preceding_left_column->column_id);
+      right_column_ids.emplace_back(preceding_right_column->column_id);
+    }
+    if (left_column_ids.empty()) return std::nullopt;
+
+    const auto& left_node = *left_column->stored_table_node;
+    const auto& right_node = *right_column->stored_table_node;
+    const auto preceding_left_distinct_count = column_group_distinct_count(left_node, left_column_ids);
+    const auto preceding_right_distinct_count = column_group_distinct_count(right_node, right_column_ids);
+    left_column_ids.emplace_back(left_column->column_id);
+    right_column_ids.emplace_back(right_column->column_id);
+    const auto left_distinct_count = column_group_distinct_count(left_node, left_column_ids);
+    const auto right_distinct_count = column_group_distinct_count(right_node, right_column_ids);
+    if (!preceding_left_distinct_count || !preceding_right_distinct_count || !left_distinct_count ||
+        !right_distinct_count) {
+      return std::nullopt;
+    }
+
+    const auto distinct_count = std::max(*left_distinct_count, *right_distinct_count);
+    if (distinct_count == 0) return Selectivity{0};
+    return std::max(*preceding_left_distinct_count, *preceding_right_distinct_count) / distinct_count;
+  }
+
+  // Conjunctive predicates: Collect the preceding predicates that compare columns of the same table with values
+  auto column = left_column;
+  auto value_operand = operands->second;
+  if (!column) {
+    column = right_column;
+    value_operand = operands->first;
+  }
+  // Prepared statements compare with placeholders, which are estimated like values
+  const auto is_value = [](const AbstractExpression& expression) {
+    return expression.type == ExpressionType::Value || expression.type == ExpressionType::Placeholder;
+  };
+  if (!column || !is_value(*value_operand)) return std::nullopt;
+
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& preceding_predicate : preceding_predicates) {
+    const auto preceding_operands = equals_operands(*preceding_predicate);
+    if (!preceding_operands) continue;
+
+    auto preceding_column = stored_table_column(preceding_operands->first);
+    auto preceding_value_operand = preceding_operands->second;
+    if (!preceding_column) {
+      preceding_column = stored_table_column(preceding_operands->second);
+      preceding_value_operand = preceding_operands->first;
+    }
+    if (!preceding_column || !is_value(*preceding_value_operand) ||
+        preceding_column->stored_table_node != column->stored_table_node ||
+        preceding_column->column_id == column->column_id) {
+      continue;
+    }
+
+    column_ids.emplace_back(preceding_column->column_id);
+  }
+  if (column_ids.empty()) return std::nullopt;
+
+  const auto& stored_table_node = *column->stored_table_node;
+  const auto preceding_distinct_count = column_group_distinct_count(stored_table_node, column_ids);
+  column_ids.emplace_back(column->column_id);
+  const auto distinct_count = column_group_distinct_count(stored_table_node, column_ids);
+  if (!preceding_distinct_count || !distinct_count) return std::nullopt;
+
+  if (*distinct_count == 0) return Selectivity{0};
+  return *preceding_distinct_count / *distinct_count;
+}
+
+// Scales the estimated statistics of a predicate so that it selects @param selectivity of the input rows
+std::shared_ptr<TableStatistics> with_selectivity(const TableStatistics& input_table_statistics,
+                                                  const std::shared_ptr<TableStatistics>& output_table_statistics,
+                                                  const Selectivity selectivity) {
+  const auto row_count = Cardinality{input_table_statistics.row_count * selectivity};
+  if (output_table_statistics->row_count == 0) return output_table_statistics;
+
+  const auto scale = row_count / output_table_statistics->row_count;
+  auto column_statistics =
+      std::vector<std::shared_ptr<BaseAttributeStatistics>>{output_table_statistics->column_statistics.size()};
+  for (auto column_id = ColumnID{0}; column_id < column_statistics.size(); ++column_id) {
+    column_statistics[column_id] = output_table_statistics->column_statistics[column_id]->scaled(scale);
+  }
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -90,26 +319,31 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
    *
    * Lookup in `join_graph_statistics_cache` is expected to have a higher hit rate (since every bitmask represents
    * multiple LQPs) than `statistics_by_lqp`. Thus lookup in `join_graph_statistics_cache` is performed first.
+   *
+   * The caches are locked only during lookup and insertion, the estimation itself runs concurrently.
    */
   auto join_graph_bitmask = std::optional<JoinGraphStatisticsCache::Bitmask>{};
   if (cardinality_estimation_cache.join_graph_statistics_cache) {
+    // If the LQP does not represent (a subgraph of) a JoinGraph, there is no bitmask and we cannot use the
+    // cardinality_estimation_cache.join_graph_statistics_cache
     join_graph_bitmask = cardinality_estimation_cache.join_graph_statistics_cache->bitmask(lqp);
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{cardinality_estimation_cache.mutex};
     if (join_graph_bitmask) {
       auto cached_statistics =
           cardinality_estimation_cache.join_graph_statistics_cache->get(*join_graph_bitmask, lqp->output_expressions());
       if (cached_statistics) {
         return cached_statistics;
       }
-    } else {
-      // The LQP does not represent (a subgraph of) of a JoinGraph and therefore we cannot use the
-      // cardinality_estimation_cache.join_graph_statistics_cache
     }
-  }
 
-  if (cardinality_estimation_cache.statistics_by_lqp) {
-    const auto plan_statistics_iter = cardinality_estimation_cache.statistics_by_lqp->find(lqp);
-    if (plan_statistics_iter != cardinality_estimation_cache.statistics_by_lqp->end()) {
-      return plan_statistics_iter->second;
+    if (cardinality_estimation_cache.statistics_by_lqp) {
+      const auto plan_statistics_iter = cardinality_estimation_cache.statistics_by_lqp->find(lqp);
+      if (plan_statistics_iter != cardinality_estimation_cache.statistics_by_lqp->end()) {
+        return plan_statistics_iter->second;
+      }
     }
   }
 
@@ -198,6 +432,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
           estimate_union_node(*union_node, left_input_table_statistics, right_input_table_statistics);
     } break;
 
+    case LQPNodeType::Window: {
+      const auto window_node = std::dynamic_pointer_cast<const WindowNode>(lqp);
+      output_table_statistics = estimate_window_node(*window_node, left_input_table_statistics);
+    } break;
+
     // Currently there is no actual estimation being done and we always apply the worst case
     case LQPNodeType::Intersect:
     case LQPNodeType::Except: {
@@ -227,8 +466,16 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
   }
 
   /**
-   * 3. Store output_table_statistics in cache
+   * 3. Adjust the estimate by the row counts observed in earlier executions of the same subplan
    */
+  if (const auto& cardinality_feedback = Hyrise::get().cardinality_feedback) {
+    output_table_statistics = cardinality_feedback->adjust(lqp, output_table_statistics);
+  }
+
+  /**
+   * 4. Store output_table_statistics in cache
+   */
+  const auto lock = std::lock_guard<std::mutex>{cardinality_estimation_cache.mutex};
   if (join_graph_bitmask) {
     cardinality_estimation_cache.join_graph_statistics_cache->set(*join_graph_bitmask, lqp->output_expressions(),
                                                                   output_table_statistics);
@@ -283,10 +530,49 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_projection_node(
   return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
 }
 
+std::optional<Cardinality> CardinalityEstimator::estimate_distinct_count(
+    const BaseAttributeStatistics& column_statistics) {
+  if (column_statistics.data_type == DataType::Null) return std::nullopt;
+
+  auto distinct_count = std::optional<Cardinality>{};
+  resolve_data_type(column_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto* typed_column_statistics = dynamic_cast<const AttributeStatistics<ColumnDataType>*>(&column_statistics);
+    if (typed_column_statistics && typed_column_statistics->distinct_count_sketch) {
+      distinct_count = typed_column_statistics->distinct_count_sketch->distinct_count();
+    }
+  });
+  return distinct_count;
+}
+
+std::optional<Cardinality> CardinalityEstimator::estimate_group_count(const AggregateNode& aggregate_node,
+                                                                       const TableStatistics& input_table_statistics) {
+  // Without correlation information, the number of groups is the product of the distinct counts of the group-by
+  // columns. It cannot exceed the number of input rows.
+  auto group_count = Cardinality{1};
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_node.aggregate_expressions_begin_idx;
+       ++expression_idx) {
+    const auto& expression = *aggregate_node.node_expressions[expression_idx];
+    const auto input_column_id = aggregate_node.left_input()->find_column_id(expression);
+    if (!input_column_id) return std::nullopt;
+
+    const auto distinct_count = estimate_distinct_count(*input_table_statistics.column_statistics[*input_column_id]);
+    if (!distinct_count) return std::nullopt;
+
+    // Groups of NULLs are not counted by the sketch
+    group_count *= std::max(*distinct_count, Cardinality{1});
+  }
+
+  if (aggregate_node.aggregate_expressions_begin_idx == 0) return group_count;
+  return std::min(group_count, input_table_statistics.row_count);
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     const AggregateNode& aggregate_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
   // For AggregateNodes, statistics from group-by columns are forwarded and for the aggregate columns
-  // dummy statistics are created for now.
+  // dummy statistics are created for now. If the group-by columns have distinct count sketches, they determine the
+  // number of groups. Otherwise, we assume that all input rows form a group of their own.
 
   auto column_statistics =
       std::vector<std::shared_ptr<BaseAttributeStatistics>>{aggregate_node.output_expressions().size()};
@@ -304,7 +590,9 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto group_count = estimate_group_count(aggregate_node, *input_table_statistics);
+  return std::make_shared<TableStatistics>(std::move(column_statistics),
+                                           group_count.value_or(input_table_statistics->row_count));
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
@@ -313,6 +601,19 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
   return input_table_statistics;
 }
 
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_window_node(
+    const WindowNode& window_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // WindowNodes forward all input rows and columns. No meaningful statistics can be generated for the result of the
+  // window function yet, hence an empty AttributeStatistics object is added.
+  auto column_statistics = input_table_statistics->column_statistics;
+  resolve_data_type(window_node.window_function_expression()->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    column_statistics.emplace_back(std::make_shared<AttributeStatistics<ColumnDataType>>());
+  });
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
     const PredicateNode& predicate_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
   // For PredicateNodes, the statistics of the columns scanned on are sliced and all other columns' statistics are
@@ -414,6 +715,15 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
       output_table_statistics = estimate_operator_scan_predicate(output_table_statistics, operator_scan_predicate);
     }
 
+    // Equality predicates on correlated columns (e.g., city and zip code) select far more rows than independent
+    // predicates would
+    const auto correlated_selectivity =
+        correlated_equals_selectivity(*predicate, preceding_predicates(predicate_node.left_input()));
+    if (correlated_selectivity) {
+      output_table_statistics =
+          with_selectivity(*input_table_statistics, output_table_statistics, *correlated_selectivity);
+    }
+
     return output_table_statistics;
   }
 }
@@ -441,10 +751,27 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_join_node(
         case JoinMode::FullOuter:
         case JoinMode::Inner:
           switch (primary_operator_join_predicate->predicate_condition) {
-            case PredicateCondition::Equals:
-              return estimate_inner_equi_join(primary_operator_join_predicate->column_ids.first,
-                                              primary_operator_join_predicate->column_ids.second,
-                                              *left_input_table_statistics, *right_input_table_statistics);
+            case PredicateCondition::Equals: {
+              auto output_table_statistics = estimate_inner_equi_join(
+                  primary_operator_join_predicate->column_ids.first, primary_operator_join_predicate->column_ids.second,
+                  *left_input_table_statistics, *right_input_table_statistics);
+              if (join_node.join_mode != JoinMode::Inner) return output_table_statistics;
+
+              // Although cardinality estimation is only performed for the primary join predicate, the secondary
+              // predicates of multi-column joins are taken into account if there are ColumnGroupStatistics
+              const auto& join_predicates = join_node.join_predicates();
+              for (auto predicate_idx = size_t{1}; predicate_idx < join_predicates.size(); ++predicate_idx) {
+                const auto preceding_join_predicates = std::vector<std::shared_ptr<AbstractExpression>>{
+                    join_predicates.begin(), join_predicates.begin() + predicate_idx};
+                const auto correlated_selectivity =
+                    correlated_equals_selectivity(*join_predicates[predicate_idx], preceding_join_predicates);
+                if (!correlated_selectivity) continue;
+
+                output_table_statistics =
+                    with_selectivity(*output_table_statistics, output_table_statistics, *correlated_selectivity);
+              }
+              return output_table_statistics;
+            }
 
             // TODO(anybody) Implement estimation for non-equi joins. #1830
             case PredicateCondition::NotEquals:
@@ -836,6 +1163,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
   // TODO(anybody) - Implement join estimation for differing column data types
   //               - Implement join estimation for String columns
   if (left_data_type != right_data_type || left_data_type == DataType::String) {
+    const auto cardinality = estimate_inner_equi_join_with_sketches(left_input_table_statistics, left_column_id,
+                                                                    right_input_table_statistics, right_column_id);
+    if (cardinality) {
+      return scaled_join_statistics(left_input_table_statistics, right_input_table_statistics, *cardinality);
+    }
     return estimate_cross_join(left_input_table_statistics, right_input_table_statistics);
   }
 
@@ -860,9 +1192,10 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
       join_column_histogram = estimate_inner_equi_join_with_histograms(*left_histogram, *right_histogram);
       cardinality = join_column_histogram->total_count();
     } else {
-      // TODO(anybody) If there aren't histograms on both sides, use some other algorithm/statistics to estimate the
-      //               Join
-      cardinality = left_input_table_statistics.row_count * right_input_table_statistics.row_count;
+      // Without histograms on both sides, fall back to the distinct counts of the sketches or to a cross join
+      cardinality = estimate_inner_equi_join_with_sketches(left_input_table_statistics, left_column_id,
+                                                           right_input_table_statistics, right_column_id)
+                        .value_or(left_input_table_statistics.row_count * right_input_table_statistics.row_count);
     }
 
     const auto left_selectivity = Selectivity{
@@ -953,9 +1286,16 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_semi_join(
       join_column_histogram = estimate_inner_equi_join_with_histograms(*left_histogram, *distinct_right_histogram);
       cardinality = join_column_histogram->total_count();
     } else {
-      // TODO(anybody) If there aren't histograms on both sides, use some other algorithm/statistics to estimate the
-      //               Join
+      // Without histograms on both sides, assume that the values of the side with fewer distinct values are contained
+      // in the other side. If there are no sketches either, all tuples qualify.
       cardinality = left_input_table_statistics.row_count;
+      const auto left_distinct_count =
+          estimate_distinct_count(*left_input_table_statistics.column_statistics[left_column_id]);
+      const auto right_distinct_count =
+          estimate_distinct_count(*right_input_table_statistics.column_statistics[right_column_id]);
+      if (left_distinct_count && right_distinct_count && *left_distinct_count > 0.0f) {
+        cardinality *= std::min(*right_distinct_count / *left_distinct_count, 1.0f);
+      }
     }
 
     const auto left_selectivity = Selectivity{
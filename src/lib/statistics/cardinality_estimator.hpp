@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "boost/dynamic_bitset.hpp"
 
@@ -16,6 +17,7 @@ template <typename T>
 class GenericHistogram;
 template <typename T>
 class AttributeStatistics;
+class BaseAttributeStatistics;
 class AliasNode;
 class ProjectionNode;
 class AggregateNode;
@@ -24,6 +26,7 @@ class PredicateNode;
 class JoinNode;
 class UnionNode;
 class LimitNode;
+class WindowNode;
 
 /**
  * Hyrise's default, statistics-based cardinality estimator
@@ -45,6 +48,19 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
   static std::shared_ptr<TableStatistics> estimate_projection_node(
       const ProjectionNode& projection_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
 
+  /**
+   * Number of distinct values of a column, estimated by its distinct count sketch. Returns nullopt if the column has no
+   * sketch.
+   */
+  static std::optional<Cardinality> estimate_distinct_count(const BaseAttributeStatistics& column_statistics);
+
+  /**
+   * Number of groups of the AggregateNode, estimated from the distinct count sketches of its group-by columns. Returns
+   * nullopt if a group-by column is not a column of the input or has no sketch.
+   */
+  static std::optional<Cardinality> estimate_group_count(const AggregateNode& aggregate_node,
+                                                         const TableStatistics& input_table_statistics);
+
   static std::shared_ptr<TableStatistics> estimate_aggregate_node(
       const AggregateNode& aggregate_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
 
@@ -64,6 +80,9 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
 
   static std::shared_ptr<TableStatistics> estimate_limit_node(
       const LimitNode& limit_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
+
+  static std::shared_ptr<TableStatistics> estimate_window_node(
+      const WindowNode& window_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
   /** @} */
 
   /**
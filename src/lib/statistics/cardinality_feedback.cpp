@@ -0,0 +1,140 @@
+#include "cardinality_feedback.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/pqp_utils.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The estimates of other nodes follow from those of their inputs (e.g., for projections) or are exact (e.g., for
+// stored tables)
+bool is_recorded_node_type(const LQPNodeType type) {
+  return type == LQPNodeType::Predicate || type == LQPNodeType::Join || type == LQPNodeType::Aggregate;
+}
+
+bool has_parameters(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  auto found_parameter = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& expression) {
+        if (expression->type == ExpressionType::CorrelatedParameter || expression->type == ExpressionType::Placeholder) {
+          found_parameter = true;
+        }
+        return found_parameter ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+      });
+    }
+    return found_parameter ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return found_parameter;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void CardinalityFeedback::add_plan(const std::shared_ptr<const AbstractOperator>& pqp) {
+  // Estimates the nodes as the optimizer would, including the adjustments recorded so far
+  const auto estimator = std::make_shared<CardinalityEstimator>();
+  estimator->guarantee_bottom_up_construction();
+
+  // An LQP node may be translated into multiple operators (e.g., two scans and a union for an index scan). The visit is
+  // breadth-first, so that the first one is the one whose output is the node's output.
+  auto recorded_nodes = std::unordered_set<const AbstractLQPNode*>{};
+
+  visit_pqp(pqp, [&](const auto& op) {
+    const auto& lqp_node = op->lqp_node;
+    const auto& performance_data = *op->performance_data;
+    if (lqp_node && performance_data.executed && performance_data.has_output &&
+        is_recorded_node_type(lqp_node->type) && recorded_nodes.emplace(lqp_node.get()).second &&
+        !has_parameters(lqp_node)) {
+      add_observation(lqp_node, estimator->estimate_cardinality(lqp_node),
+                      static_cast<Cardinality>(performance_data.output_row_count));
+    }
+    return PQPVisitation::VisitInputs;
+  });
+}
+
+void CardinalityFeedback::add_observation(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                          const Cardinality estimated_row_count, const Cardinality actual_row_count) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+
+  auto observation_iter = _observations.find(std::const_pointer_cast<AbstractLQPNode>(lqp));
+  if (observation_iter == _observations.end()) {
+    if (_observations.size() >= MAX_SUBPLAN_COUNT) return;
+
+    // The key is copied so that it does not change with the plan that it was taken from
+    observation_iter = _observations.emplace(lqp->deep_copy(), Observation{}).first;
+  }
+
+  // The estimate is the unadjusted estimate (at least one row, see adjust()) times the previous adjustment. Both row
+  // counts are at least one so that the adjustment never becomes zero, from which the unadjusted estimate could not be
+  // recovered.
+  auto& observation = observation_iter->second;
+  const auto unadjusted_row_count = observation.execution_count > 0 ? estimated_row_count / observation.adjustment
+                                                                    : std::max(estimated_row_count, 1.0f);
+  observation.adjustment = std::max(actual_row_count, 1.0f) / std::max(unadjusted_row_count, 1.0f);
+  observation.estimated_row_count = estimated_row_count;
+  observation.actual_row_count = actual_row_count;
+  ++observation.execution_count;
+}
+
+std::optional<CardinalityFeedback::Observation> CardinalityFeedback::observation(
+    const std::shared_ptr<const AbstractLQPNode>& lqp) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+  const auto observation_iter = _observations.find(std::const_pointer_cast<AbstractLQPNode>(lqp));
+  if (observation_iter == _observations.end()) return std::nullopt;
+  return observation_iter->second;
+}
+
+std::shared_ptr<TableStatistics> CardinalityFeedback::adjust(
+    const std::shared_ptr<const AbstractLQPNode>& lqp, const std::shared_ptr<TableStatistics>& table_statistics) const {
+  if (!is_recorded_node_type(lqp->type)) return table_statistics;
+
+  auto adjustment = 1.0f;
+  {
+    const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+    if (_observations.empty()) return table_statistics;
+
+    const auto observation_iter = _observations.find(std::const_pointer_cast<AbstractLQPNode>(lqp));
+    if (observation_iter == _observations.end()) return table_statistics;
+    adjustment = observation_iter->second.adjustment;
+  }
+
+  const auto row_count = table_statistics->row_count;
+  const auto adjusted_row_count = std::max(row_count, 1.0f) * adjustment;
+
+  // Without an estimated row, the column statistics cannot be scaled and are kept as they are
+  const auto selectivity = row_count > 0.0f ? Selectivity{adjusted_row_count / row_count} : Selectivity{1};
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(table_statistics->column_statistics.size());
+  for (const auto& estimated_column_statistics : table_statistics->column_statistics) {
+    column_statistics.emplace_back(estimated_column_statistics->scaled(selectivity));
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), adjusted_row_count);
+}
+
+size_t CardinalityFeedback::subplan_count() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+  return _observations.size();
+}
+
+void CardinalityFeedback::clear() {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+  _observations.clear();
+}
+
+}  // namespace opossum
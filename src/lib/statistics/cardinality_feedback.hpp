@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class TableStatistics;
+
+/**
+ * Learns from the actual output row counts of executed operators, similar to DB2's LEarning Optimizer (Stillger et al.,
+ * "LEO - DB2's LEarning Optimizer", VLDB 2001). Recurring queries are often misestimated in the same way, e.g., because
+ * of correlated predicates, so that they get the same bad plan every time they are optimized.
+ *
+ * After a statement was executed, the SQLPipelineStatement adds its PQP if Hyrise::get().cardinality_feedback is set.
+ * For every executed PredicateNode, JoinNode, and AggregateNode, whose estimates are the ones that go wrong, the actual
+ * row count is compared to the current estimate, and the ratio between them is stored as an adjustment of the node's
+ * subplan. The CardinalityEstimator multiplies its estimates of equal subplans with this adjustment. As the estimates
+ * of the inputs are already adjusted, the adjustment only corrects the error of the node itself. Storing a ratio
+ * instead of the row count keeps the adjustment valid when the tables grow.
+ *
+ * Subplans are compared by AbstractLQPNode::hash() and operator==, i.e., by their structure and not by their address.
+ * Subplans with parameters (e.g., correlated subqueries) have different row counts per execution and are not recorded.
+ * Plans in the plan caches are not re-optimized, the adjustments take effect the next time a statement is optimized.
+ */
+class CardinalityFeedback : public Noncopyable {
+ public:
+  // Once there are this many subplans, only the adjustments of known subplans are updated
+  static constexpr auto MAX_SUBPLAN_COUNT = size_t{100'000};
+
+  struct Observation {
+    // Factor by which the estimate of the subplan is multiplied
+    float adjustment{1.0f};
+
+    // Row counts of the last execution, where the estimate already includes the previous adjustment
+    Cardinality estimated_row_count{0.0f};
+    Cardinality actual_row_count{0.0f};
+
+    size_t execution_count{0};
+  };
+
+  // Records the output row counts of the executed operators of the plan that have an LQP node
+  void add_plan(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Records the actual row count of the subplan, for which the given (adjusted) row count was estimated
+  void add_observation(const std::shared_ptr<const AbstractLQPNode>& lqp, const Cardinality estimated_row_count,
+                       const Cardinality actual_row_count);
+
+  std::optional<Observation> observation(const std::shared_ptr<const AbstractLQPNode>& lqp) const;
+
+  // Returns the statistics adjusted by the observations of the subplan, or the statistics themselves if there are none
+  std::shared_ptr<TableStatistics> adjust(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                          const std::shared_ptr<TableStatistics>& table_statistics) const;
+
+  size_t subplan_count() const;
+
+  void clear();
+
+ private:
+  mutable std::shared_mutex _mutex;
+  LQPNodeUnorderedMap<Observation> _observations;
+};
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Cardinality ColumnGroupStatistics::distinct_count(const Table& table, std::vector<ColumnID> column_ids) {
+  Assert(!column_ids.empty(), "Column group should not be empty");
+  std::sort(column_ids.begin(), column_ids.end());
+  column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+
+  // Holding the lock while counting keeps concurrent optimizations from counting the same group twice
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _distinct_counts.find(column_ids);
+  if (iter != _distinct_counts.end()) return iter->second;
+
+  // Instead of the value combinations, we collect their hashes. With 64-bit hashes, collisions are negligible for the
+  // purpose of cardinality estimation.
+  auto distinct_hashes = std::unordered_set<size_t>{};
+  auto row_hashes = std::vector<size_t>{};
+  auto row_is_null = std::vector<bool>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_size = chunk->size();
+    row_hashes.assign(chunk_size, 0);
+    row_is_null.assign(chunk_size, false);
+
+    for (const auto column_id : column_ids) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (position.is_null()) {
+            row_is_null[position.chunk_offset()] = true;
+            return;
+          }
+          boost::hash_combine(row_hashes[position.chunk_offset()], std::hash<ColumnDataType>{}(position.value()));
+        });
+      });
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (!row_is_null[chunk_offset]) distinct_hashes.emplace(row_hashes[chunk_offset]);
+    }
+  }
+
+  const auto distinct_count = static_cast<Cardinality>(distinct_hashes.size());
+  _distinct_counts.emplace(std::move(column_ids), distinct_count);
+  return distinct_count;
+}
+
+}  // namespace opossum
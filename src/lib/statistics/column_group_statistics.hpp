@@ -0,0 +1,33 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Multi-column statistics of a stored table. Per-column statistics cannot capture correlations between columns, e.g.,
+ * between the city and the zip code of an address: Assuming independence, `city = 'Potsdam' AND zip = '14482'` would
+ * be estimated to select (row count / distinct cities / distinct zip codes) rows, about one thousandth of the truth.
+ *
+ * ColumnGroupStatistics hold the number of distinct value combinations of groups of columns, which the
+ * CardinalityEstimator uses for conjunctive equality predicates and multi-column equi joins. As they are only needed
+ * for a few column groups, they are built on demand (with a pass over the columns) and cached.
+ */
+class ColumnGroupStatistics : public Noncopyable {
+ public:
+  // The @param table must be the table that these statistics belong to. Rows with a NULL in any of the columns are
+  // not counted.
+  Cardinality distinct_count(const Table& table, std::vector<ColumnID> column_ids);
+
+ private:
+  std::mutex _mutex;
+  std::map<std::vector<ColumnID>, Cardinality> _distinct_counts;
+};
+
+}  // namespace opossum
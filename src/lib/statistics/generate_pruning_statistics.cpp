@@ -5,11 +5,14 @@
 #include <thread>
 #include <unordered_set>
 
+#include "hyrise.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/blocked_bloom_filter.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
@@ -36,6 +39,10 @@ void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_stati
   if (pruning_statistics) {
     segment_statistics.set_statistics_object(pruning_statistics);
   }
+
+  if (Hyrise::get().build_pruning_bloom_filters) {
+    segment_statistics.set_statistics_object(BlockedBloomFilter<T>::build_filter(dictionary));
+  }
 }
 
 }  // namespace
@@ -64,19 +71,23 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
         // we can use the fact that dictionary segments have an accessor for the dictionary
         const auto& dictionary = *typed_segment.dictionary();
         create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        segment_statistics->set_statistics_object(HyperLogLogSketch::from_segment(typed_segment));
       } else {
         // if we have a generic segment we create the dictionary ourselves
         auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
         std::unordered_set<ColumnDataType> values;
+        const auto sketch = std::make_shared<HyperLogLogSketch>();
         iterable.for_each([&](const auto& value) {
           // we are only interested in non-null values
           if (!value.is_null()) {
             values.insert(value.value());
+            sketch->add(value.value());
           }
         });
         pmr_vector<ColumnDataType> dictionary{values.cbegin(), values.cend()};
         std::sort(dictionary.begin(), dictionary.end());
         create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        segment_statistics->set_statistics_object(sketch);
       }
 
       chunk_statistics[column_id] = segment_statistics;
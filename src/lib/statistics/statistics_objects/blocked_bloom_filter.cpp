@@ -0,0 +1,83 @@
+#include "blocked_bloom_filter.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/hash_functions.hpp"
+
+namespace opossum {
+
+template <typename T>
+BlockedBloomFilter<T>::BlockedBloomFilter(std::vector<uint64_t>&& init_words)
+    : AbstractStatisticsObject(data_type_from_type<T>()), words(std::move(init_words)) {
+  Assert(!words.empty(), "BlockedBloomFilter needs at least one word");
+}
+
+template <typename T>
+std::shared_ptr<BlockedBloomFilter<T>> BlockedBloomFilter<T>::build_filter(const pmr_vector<T>& dictionary) {
+  if (dictionary.empty()) return nullptr;
+
+  auto words = std::vector<uint64_t>((dictionary.size() * BITS_PER_VALUE + 63) / 64);
+  for (const auto& value : dictionary) {
+    const auto [word_index, mask] = _word_and_mask(value, words.size());
+    words[word_index] |= mask;
+  }
+
+  return std::make_shared<BlockedBloomFilter<T>>(std::move(words));
+}
+
+template <typename T>
+bool BlockedBloomFilter<T>::may_contain(const T& value) const {
+  const auto [word_index, mask] = _word_and_mask(value, words.size());
+  return (words[word_index] & mask) == mask;
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BlockedBloomFilter<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return nullptr;
+  }
+
+  return std::make_shared<BlockedBloomFilter<T>>(std::vector<uint64_t>{words});
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BlockedBloomFilter<T>::scaled(const Selectivity /*selectivity*/) const {
+  return std::make_shared<BlockedBloomFilter<T>>(std::vector<uint64_t>{words});
+}
+
+template <typename T>
+bool BlockedBloomFilter<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                             const AllTypeVariant& variant_value,
+                                             const std::optional<AllTypeVariant>& variant_value2) const {
+  if (predicate_condition != PredicateCondition::Equals || variant_is_null(variant_value)) {
+    return false;
+  }
+
+  // As for the MinMaxFilter, the caller has to convert the value to T
+  return !may_contain(boost::get<T>(variant_value));
+}
+
+template <typename T>
+std::pair<size_t, uint64_t> BlockedBloomFilter<T>::_word_and_mask(const T& value, const size_t word_count) {
+  const auto hash = static_cast<uint64_t>(KeyHash<T>{}(value));
+
+  // The upper half of the hash selects the word (without a modulo, cf. Lemire's fastrange), the lower half the bits
+  const auto word_index = static_cast<size_t>(((hash >> 32u) * word_count) >> 32u);
+  auto mask = uint64_t{0};
+  for (auto hash_index = size_t{0}; hash_index < HASH_COUNT; ++hash_index) {
+    mask |= uint64_t{1} << ((hash >> (6 * hash_index)) & 63u);
+  }
+
+  return {word_index, mask};
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BlockedBloomFilter);
+
+}  // namespace opossum
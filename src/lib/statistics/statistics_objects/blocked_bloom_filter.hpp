@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Filter that answers whether a segment may contain a value (see MinMaxFilter for filters in general). For
+ * high-cardinality columns whose values are not clustered, e.g., UUIDs or customer ids, the range of every segment
+ * contains almost every value, so that MinMaxFilters and RangeFilters cannot prune point lookups. A bloom filter can:
+ * it has no false negatives and, with BITS_PER_VALUE bits per distinct value, about 1-2% false positives.
+ *
+ * The filter is blocked (Putze et al., "Cache-, Hash- and Space-efficient Bloom Filters", 2007): the hash of a value
+ * selects one 64-bit word, in which it sets HASH_COUNT bits. Thus, a lookup reads a single word. Values are hashed
+ * with KeyHash, which also writes every bit of the hash for integers.
+ *
+ * The filter is only used for equality predicates. It remains valid for the values that satisfy any predicate, so the
+ * sliced and scaled filters are copies.
+ */
+template <typename T>
+class BlockedBloomFilter : public AbstractStatisticsObject {
+ public:
+  static constexpr auto BITS_PER_VALUE = size_t{10};
+  static constexpr auto HASH_COUNT = size_t{4};
+
+  explicit BlockedBloomFilter(std::vector<uint64_t>&& init_words);
+
+  // Returns nullptr for empty dictionaries, i.e., segments without non-NULL values
+  static std::shared_ptr<BlockedBloomFilter<T>> build_filter(const pmr_vector<T>& dictionary);
+
+  // False positives are possible, false negatives are not
+  bool may_contain(const T& value) const;
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  // Used to persist the filter, e.g., by the BinaryWriter
+  const std::vector<uint64_t> words;
+
+ private:
+  // The word of the hash and the bits of the hash within that word
+  static std::pair<size_t, uint64_t> _word_and_mask(const T& value, const size_t word_count);
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(BlockedBloomFilter);
+
+}  // namespace opossum
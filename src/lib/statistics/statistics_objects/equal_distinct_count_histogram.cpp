@@ -1,5 +1,6 @@
 #include "equal_distinct_count_histogram.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <numeric>
@@ -46,15 +47,15 @@ void add_segment_to_value_distribution(const AbstractSegment& segment, ValueDist
 }
 
 template <typename T>
-std::vector<std::pair<T, HistogramCountType>> value_distribution_from_column(const Table& table,
+std::vector<std::pair<T, HistogramCountType>> value_distribution_from_chunks(const Table& table,
                                                                              const ColumnID column_id,
+                                                                             const std::vector<ChunkID>& chunk_ids,
                                                                              const HistogramDomain<T>& domain) {
   // TODO(anybody) If you want to look into performance, this would probably benefit greatly from monotonic buffer
   //               resources.
   ValueDistributionMap<T> value_distribution_map;
 
-  const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+  for (const auto chunk_id : chunk_ids) {
     const auto chunk = table.get_chunk(chunk_id);
     if (!chunk) continue;
 
@@ -99,9 +100,42 @@ EqualDistinctCountHistogram<T>::EqualDistinctCountHistogram(std::vector<T>&& bin
 template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_column(
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
-  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+
+  return _from_value_distribution(value_distribution_from_chunks(table, column_id, chunk_ids, domain), max_bin_count,
+                                  HistogramCountType{1}, HistogramCountType{1});
+}
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_chunks(
+    const Table& table, const ColumnID column_id, const BinID max_bin_count, const std::vector<ChunkID>& chunk_ids,
+    const Cardinality row_count, const HistogramDomain<T>& domain) {
+  auto value_distribution = value_distribution_from_chunks(table, column_id, chunk_ids, domain);
+
+  auto sampled_row_count = Cardinality{0};
+  for (const auto chunk_id : chunk_ids) {
+    if (const auto chunk = table.get_chunk(chunk_id)) sampled_row_count += static_cast<Cardinality>(chunk->size());
+  }
+  if (sampled_row_count == 0) return nullptr;
+
+  // GEE: Values that occur once in the sample stand for sqrt(row_count / sampled_row_count) distinct values of the
+  // table, values that occur more often are likely to be all there is.
+  const auto height_scale = std::max(row_count / sampled_row_count, Cardinality{1});
+  const auto singleton_count = static_cast<Cardinality>(std::count_if(
+      value_distribution.cbegin(), value_distribution.cend(), [](const auto& value) { return value.second == 1; }));
+  const auto sampled_distinct_count = static_cast<Cardinality>(value_distribution.size());
+  const auto distinct_count = std::sqrt(height_scale) * singleton_count + (sampled_distinct_count - singleton_count);
+  const auto distinct_count_scale = sampled_distinct_count > 0 ? distinct_count / sampled_distinct_count : 1.0f;
+
+  return _from_value_distribution(std::move(value_distribution), max_bin_count, height_scale, distinct_count_scale);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::_from_value_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+    const HistogramCountType height_scale, const HistogramCountType distinct_count_scale) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
   if (value_distribution.empty()) {
     return nullptr;
@@ -138,6 +172,7 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     bin_maxima[bin_idx] = std::move(value_distribution[max_value_idx].first);
 
     bin_heights[bin_idx] =
+        height_scale *
         std::accumulate(value_distribution.cbegin() + min_value_idx, value_distribution.cbegin() + max_value_idx + 1,
                         HistogramCountType{0},
                         [](HistogramCountType a, const std::pair<T, HistogramCountType>& b) { return a + b.second; });
@@ -147,7 +182,7 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
 
   return std::make_shared<EqualDistinctCountHistogram<T>>(
       std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
-      static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value);
+      distinct_count_scale * static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value);
 }
 
 template <typename T>
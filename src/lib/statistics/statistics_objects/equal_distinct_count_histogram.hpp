@@ -36,6 +36,17 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram for a column from a sample of the Table's chunks. The bin heights are scaled
+   * to represent @param row_count rows, the distinct counts are extrapolated with the GEE estimator (Charikar et al.,
+   * "Towards Estimation Error Guarantees for Distinct Values", PODS 2000).
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_chunks(const Table& table, const ColumnID column_id,
+                                                                     const BinID max_bin_count,
+                                                                     const std::vector<ChunkID>& chunk_ids,
+                                                                     const Cardinality row_count,
+                                                                     const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -58,6 +69,10 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
   BinID _bin_for_value(const T& value) const override;
   BinID _next_bin_for_value(const T& value) const override;
 
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> _from_value_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+      const HistogramCountType height_scale, const HistogramCountType distinct_count_scale);
+
  private:
   /**
    * We use multiple vectors rather than a vector of structs for ease-of-use with STL library functions.
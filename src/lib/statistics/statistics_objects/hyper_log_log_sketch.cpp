@@ -0,0 +1,135 @@
+#include "hyper_log_log_sketch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// std::hash is the identity for integers in libstdc++. HyperLogLog requires all bits of the hash to be uniformly
+// distributed, so the hash is mixed with the finalizer of MurmurHash3.
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 33u;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33u;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33u;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+HyperLogLogSketch::HyperLogLogSketch() : AbstractStatisticsObject(DataType::Null), _registers(REGISTER_COUNT) {}
+
+HyperLogLogSketch::HyperLogLogSketch(std::vector<uint8_t>&& init_registers, const Cardinality init_value_count,
+                                     const Selectivity init_selectivity)
+    : AbstractStatisticsObject(DataType::Null),
+      value_count(init_value_count),
+      _registers(std::move(init_registers)),
+      _selectivity(init_selectivity) {
+  Assert(_registers.size() == REGISTER_COUNT, "Unexpected number of registers");
+}
+
+std::shared_ptr<HyperLogLogSketch> HyperLogLogSketch::from_segment(const AbstractSegment& segment) {
+  auto sketch = std::make_shared<HyperLogLogSketch>();
+
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (!position.is_null()) sketch->add(position.value());
+    });
+  });
+
+  return sketch;
+}
+
+void HyperLogLogSketch::add_hash(const size_t hash) {
+  const auto mixed_hash = mix(hash);
+  const auto register_id = mixed_hash >> (64u - PRECISION);
+
+  // The remaining bits are shifted to the front. The set bit at the end bounds the rank if they are all zero.
+  const auto remaining_bits = (mixed_hash << PRECISION) | (uint64_t{1} << (PRECISION - 1u));
+  const auto rank = static_cast<uint8_t>(std::countl_zero(remaining_bits) + 1);
+
+  _registers[register_id] = std::max(_registers[register_id], rank);
+  ++value_count;
+}
+
+void HyperLogLogSketch::merge(const HyperLogLogSketch& other) {
+  Assert(_selectivity == 1.0f && other._selectivity == 1.0f, "Cannot merge scaled sketches");
+
+  for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+  value_count += other.value_count;
+}
+
+Cardinality HyperLogLogSketch::distinct_count() const {
+  constexpr auto m = static_cast<double>(REGISTER_COUNT);
+  constexpr auto alpha = 0.7213 / (1.0 + 1.079 / m);
+
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(value));
+    if (value == 0) ++empty_register_count;
+  }
+
+  auto estimate = alpha * m * m / inverse_sum;
+  if (estimate <= 2.5 * m && empty_register_count > 0) {
+    // Small range correction: linear counting is more accurate while many registers are empty
+    estimate = m * std::log(m / static_cast<double>(empty_register_count));
+  }
+
+  // There cannot be more distinct values than values
+  estimate = std::min(estimate, static_cast<double>(value_count));
+
+  if (_selectivity < 1.0f && estimate > 0.0) {
+    // With n / d rows per value, a value remains with probability 1 - (1 - s)^(n / d)
+    const auto rows_per_value = static_cast<double>(value_count) / estimate;
+    estimate *= 1.0 - std::pow(1.0 - static_cast<double>(_selectivity), rows_per_value);
+  }
+
+  return static_cast<Cardinality>(estimate);
+}
+
+std::shared_ptr<HyperLogLogSketch> HyperLogLogSketch::copy() const {
+  return std::make_shared<HyperLogLogSketch>(std::vector<uint8_t>{_registers}, value_count, _selectivity);
+}
+
+std::shared_ptr<AbstractStatisticsObject> HyperLogLogSketch::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  // The sketch does not know which values satisfy the predicate
+  return nullptr;
+}
+
+std::shared_ptr<AbstractStatisticsObject> HyperLogLogSketch::pruned(
+    const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (value_count == 0.0f) return copy();
+
+  const auto pruned_share = std::min(static_cast<float>(num_values_pruned) / (value_count * _selectivity), 1.0f);
+  return scaled(1.0f - pruned_share);
+}
+
+std::shared_ptr<AbstractStatisticsObject> HyperLogLogSketch::scaled(const Selectivity selectivity) const {
+  // Selectivities above 1 (e.g., for joins) duplicate rows, but do not add distinct values
+  return std::make_shared<HyperLogLogSketch>(std::vector<uint8_t>{_registers}, value_count,
+                                             _selectivity * std::min(selectivity, 1.0f));
+}
+
+const std::vector<uint8_t>& HyperLogLogSketch::registers() const { return _registers; }
+
+Selectivity HyperLogLogSketch::selectivity() const { return _selectivity; }
+
+}  // namespace opossum
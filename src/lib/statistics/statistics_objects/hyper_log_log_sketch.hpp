@@ -0,0 +1,81 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+/**
+ * HyperLogLog sketch (Flajolet et al., 2007) that estimates the number of distinct values of a segment or column in a
+ * fixed amount of memory. Each value is hashed; the first PRECISION bits of the hash select a register, which keeps the
+ * maximum number of leading zeros seen in the remaining bits. Sketches are mergeable: the sketch of a column is the
+ * register-wise maximum of the sketches of its segments, so that it does not need another pass over the data when a
+ * chunk is added. The standard error of the estimate is about 1.04 / sqrt(2^PRECISION), i.e., about 3%.
+ *
+ * NULLs are not added to the sketch. The sketch is not templated, the values are hashed before they are added.
+ *
+ * Sketches cannot be restricted to the values that satisfy a predicate, so sliced() does not return a sketch. Scaling
+ * keeps the registers and estimates the number of distinct values that remain when rows are sampled uniformly with the
+ * given selectivity (see distinct_count()).
+ */
+class HyperLogLogSketch : public AbstractStatisticsObject {
+ public:
+  static constexpr auto PRECISION = uint8_t{10};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  HyperLogLogSketch();
+  HyperLogLogSketch(std::vector<uint8_t>&& init_registers, const Cardinality init_value_count,
+                    const Selectivity init_selectivity = 1.0f);
+
+  // Builds a sketch of the non-NULL values of the segment
+  static std::shared_ptr<HyperLogLogSketch> from_segment(const AbstractSegment& segment);
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  void add_hash(const size_t hash);
+
+  // Adds the values of the other sketch. Only unscaled sketches can be merged.
+  void merge(const HyperLogLogSketch& other);
+
+  /**
+   * Estimated number of distinct values. For scaled sketches, the estimate assumes that the values are equally
+   * frequent and that a value remains if at least one of its rows is selected.
+   */
+  Cardinality distinct_count() const;
+
+  std::shared_ptr<HyperLogLogSketch> copy() const;
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> pruned(
+      const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Used to persist the sketch, e.g., by the BinaryWriter
+  const std::vector<uint8_t>& registers() const;
+  Selectivity selectivity() const;
+
+  // Number of (non-NULL) values that were added to the sketch, before scaling
+  Cardinality value_count{0};
+
+ private:
+  std::vector<uint8_t> _registers;
+  Selectivity _selectivity{1.0f};
+};
+
+}  // namespace opossum
@@ -1,24 +1,183 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <thread>
+#include <tuple>
 
 #include "attribute_statistics.hpp"
+#include "column_group_statistics.hpp"
 #include "resolve_type.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+ * (for tables with >= 200m rows) are created.
+ */
+BinID histogram_bin_count(const Cardinality row_count) {
+  return std::min<BinID>(100, std::max<BinID>(5, static_cast<BinID>(row_count / 2'000)));
+}
+
+template <typename T>
+std::shared_ptr<AttributeStatistics<T>> column_statistics_from_histogram(
+    const std::shared_ptr<AbstractHistogram<T>>& histogram, const Cardinality row_count) {
+  const auto column_statistics = std::make_shared<AttributeStatistics<T>>();
+
+  if (histogram) {
+    column_statistics->set_statistics_object(histogram);
+
+    // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio property
+    const auto null_value_ratio =
+        row_count == 0 ? 0.0f : std::max(0.0f, 1.0f - (static_cast<float>(histogram->total_count()) / row_count));
+    column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+  } else {
+    // Failure to generate a histogram currently only stems from all-null segments.
+    // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
+    column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
+  }
+
+  return column_statistics;
+}
+
+/**
+ * The distinct count sketch of a segment. It is taken from the pruning statistics of the chunk if they exist.
+ * Otherwise, the segment is scanned if @param allow_scan is set.
+ */
+template <typename T>
+std::shared_ptr<HyperLogLogSketch> segment_sketch(const Chunk& chunk, const ColumnID column_id, const bool allow_scan) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (pruning_statistics) {
+    const auto segment_statistics = std::dynamic_pointer_cast<AttributeStatistics<T>>((*pruning_statistics)[column_id]);
+    if (segment_statistics && segment_statistics->distinct_count_sketch) {
+      return segment_statistics->distinct_count_sketch;
+    }
+  }
+
+  if (!allow_scan) return nullptr;
+  return HyperLogLogSketch::from_segment(*chunk.get_segment(column_id));
+}
+
+/**
+ * Merges the sketches of all segments of a column. If the histograms are built from sampled chunks, we do not want to
+ * scan the immutable chunks for the sketch either. Then, nullptr is returned unless they have pruning statistics.
+ */
+template <typename T>
+std::shared_ptr<HyperLogLogSketch> column_sketch(const Table& table, const ColumnID column_id, const bool sampled) {
+  const auto sketch = std::make_shared<HyperLogLogSketch>();
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_sketch = segment_sketch<T>(*chunk, column_id, !sampled || chunk->is_mutable());
+    if (!chunk_sketch) return nullptr;
+    sketch->merge(*chunk_sketch);
+  }
+  return sketch;
+}
+
+/**
+ * Merges the histogram of new rows into the histogram of a column. Bins that overlap are assumed to contain the same
+ * values, so that their heights are added, but not their distinct counts. To keep the histogram from growing with
+ * every merge, neighboring bins are combined until there are at most @param max_bin_count bins.
+ */
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> merge_histograms(const AbstractHistogram<T>& histogram,
+                                                       const AbstractHistogram<T>& added_histogram,
+                                                       const BinID max_bin_count) {
+  // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // String histograms cannot be split at bin bounds. For them, assume that the new rows follow the same distribution.
+    if (histogram.total_count() == 0) return added_histogram.clone();
+    const auto scale = (histogram.total_count() + added_histogram.total_count()) / histogram.total_count();
+    return std::static_pointer_cast<AbstractHistogram<T>>(histogram.scaled(scale));
+  } else {
+    const auto split_histogram = histogram.split_at_bin_bounds(added_histogram.bin_bounds());
+    const auto split_added_histogram = added_histogram.split_at_bin_bounds(histogram.bin_bounds());
+
+    // After the splits, the bins of both histograms either have the same bounds or do not overlap
+    auto bins = std::vector<std::tuple<T, T, HistogramCountType, HistogramCountType>>{};
+    auto bin_id = BinID{0};
+    auto added_bin_id = BinID{0};
+    while (bin_id < split_histogram->bin_count() || added_bin_id < split_added_histogram->bin_count()) {
+      const auto take_bin = added_bin_id == split_added_histogram->bin_count() ||
+                            (bin_id < split_histogram->bin_count() &&
+                             split_histogram->bin_minimum(bin_id) <= split_added_histogram->bin_minimum(added_bin_id));
+      const auto take_added_bin = bin_id == split_histogram->bin_count() ||
+                                  (added_bin_id < split_added_histogram->bin_count() &&
+                                   split_added_histogram->bin_minimum(added_bin_id) <=
+                                       split_histogram->bin_minimum(bin_id));
+
+      if (take_bin && take_added_bin) {
+        bins.emplace_back(split_histogram->bin_minimum(bin_id), split_histogram->bin_maximum(bin_id),
+                          split_histogram->bin_height(bin_id) + split_added_histogram->bin_height(added_bin_id),
+                          std::max(split_histogram->bin_distinct_count(bin_id),
+                                   split_added_histogram->bin_distinct_count(added_bin_id)));
+        ++bin_id;
+        ++added_bin_id;
+      } else if (take_bin) {
+        bins.emplace_back(split_histogram->bin_minimum(bin_id), split_histogram->bin_maximum(bin_id),
+                          split_histogram->bin_height(bin_id), split_histogram->bin_distinct_count(bin_id));
+        ++bin_id;
+      } else {
+        bins.emplace_back(split_added_histogram->bin_minimum(added_bin_id),
+                          split_added_histogram->bin_maximum(added_bin_id),
+                          split_added_histogram->bin_height(added_bin_id),
+                          split_added_histogram->bin_distinct_count(added_bin_id));
+        ++added_bin_id;
+      }
+    }
+
+    // Combine groups of neighboring bins, which do not share any values
+    const auto bins_per_merged_bin = (bins.size() + max_bin_count - 1) / max_bin_count;
+    GenericHistogramBuilder<T> builder{max_bin_count, histogram.domain()};
+    for (auto begin_idx = size_t{0}; begin_idx < bins.size(); begin_idx += bins_per_merged_bin) {
+      const auto end_idx = std::min(begin_idx + bins_per_merged_bin, bins.size());
+      auto height = HistogramCountType{0};
+      auto distinct_count = HistogramCountType{0};
+      for (auto bin_idx = begin_idx; bin_idx < end_idx; ++bin_idx) {
+        height += std::get<2>(bins[bin_idx]);
+        distinct_count += std::get<3>(bins[bin_idx]);
+      }
+      builder.add_bin(std::get<0>(bins[begin_idx]), std::get<1>(bins[end_idx - 1]), height, distinct_count);
+    }
+    return builder.build();
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table, const size_t max_scanned_row_count) {
   std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
 
-  /**
-   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
-   * (for tables with >= 200m rows) are created.
-   */
-  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
+  const auto row_count = static_cast<Cardinality>(table.row_count());
+  const auto bin_count = histogram_bin_count(row_count);
+
+  // Building histograms requires a pass over the values of the column. For large tables, we build them from evenly
+  // spaced chunks instead. Sampling entire chunks rather than rows keeps the accesses sequential.
+  const auto chunk_count = table.chunk_count();
+  auto sampled_chunk_ids = std::vector<ChunkID>{};
+  if (table.row_count() > max_scanned_row_count) {
+    const auto sampled_share = static_cast<double>(max_scanned_row_count) / static_cast<double>(table.row_count());
+    const auto sampled_chunk_count =
+        std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(sampled_share * static_cast<double>(chunk_count))));
+    for (auto sample_idx = uint64_t{0}; sample_idx < sampled_chunk_count; ++sample_idx) {
+      sampled_chunk_ids.emplace_back(static_cast<ChunkID::base_type>(sample_idx * chunk_count / sampled_chunk_count));
+    }
+  }
 
   auto next_column_id = std::atomic<size_t>{0u};
   auto threads = std::vector<std::thread>{};
@@ -40,29 +199,15 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
         resolve_data_type(column_data_type, [&](auto type) {
           using ColumnDataType = typename decltype(type)::type;
 
-          const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
-
+          using Histogram = EqualDistinctCountHistogram<ColumnDataType>;
           const auto histogram =
-              EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
-
-          if (histogram) {
-            output_column_statistics->set_statistics_object(histogram);
-
-            // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
-            // property
-            const auto null_value_ratio =
-                table.row_count() == 0
-                    ? 0.0f
-                    : 1.0f - (static_cast<float>(histogram->total_count()) / static_cast<float>(table.row_count()));
-            output_column_statistics->set_statistics_object(
-                std::make_shared<NullValueRatioStatistics>(null_value_ratio));
-          } else {
-            // Failure to generate a histogram currently only stems from all-null segments.
-            // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
-            output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
-          }
-
-          column_statistics[my_column_id] = output_column_statistics;
+              sampled_chunk_ids.empty()
+                  ? Histogram::from_column(table, my_column_id, bin_count)
+                  : Histogram::from_chunks(table, my_column_id, bin_count, sampled_chunk_ids, row_count);
+          const auto statistics = column_statistics_from_histogram<ColumnDataType>(histogram, row_count);
+          statistics->set_statistics_object(
+              column_sketch<ColumnDataType>(table, my_column_id, !sampled_chunk_ids.empty()));
+          column_statistics[my_column_id] = statistics;
         });
       }
     });
@@ -72,7 +217,14 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
     thread.join();
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+  table_statistics->column_group_statistics = std::make_shared<ColumnGroupStatistics>();
+  table_statistics->represented_chunk_sizes.resize(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk) table_statistics->represented_chunk_sizes[chunk_id] = chunk->size();
+  }
+  return table_statistics;
 }
 
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
@@ -84,6 +236,93 @@ DataType TableStatistics::column_data_type(const ColumnID column_id) const {
   return column_statistics[column_id]->data_type;
 }
 
+std::shared_ptr<TableStatistics> TableStatistics::with_chunk(const Table& table, const ChunkID chunk_id) const {
+  Assert(column_group_statistics, "Statistics derived during cardinality estimation cannot be updated");
+  Assert(column_statistics.size() == table.column_count(), "Statistics should belong to the table");
+
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto represented_chunk_size = chunk_id < represented_chunk_sizes.size() ? represented_chunk_sizes[chunk_id]
+                                                                                : ChunkOffset{0};
+  if (!chunk || chunk->size() <= represented_chunk_size) {
+    // Nothing to add. Physically deleted chunks or deleted rows are not removed from the statistics.
+    auto unchanged_table_statistics = std::make_shared<TableStatistics>(std::vector{column_statistics}, row_count);
+    unchanged_table_statistics->column_group_statistics = column_group_statistics;
+    unchanged_table_statistics->represented_chunk_sizes = represented_chunk_sizes;
+    return unchanged_table_statistics;
+  }
+
+  const auto chunk_size = static_cast<Cardinality>(chunk->size());
+  const auto added_row_count = chunk_size - static_cast<Cardinality>(represented_chunk_size);
+  const auto output_row_count = row_count + added_row_count;
+  const auto bin_count = histogram_bin_count(output_row_count);
+
+  auto output_column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_statistics.size());
+  for (auto column_id = ColumnID{0}; column_id < column_statistics.size(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto input_column_statistics =
+          std::static_pointer_cast<AttributeStatistics<ColumnDataType>>(column_statistics[column_id]);
+      auto histogram = input_column_statistics->histogram;
+
+      auto added_histogram = std::static_pointer_cast<AbstractHistogram<ColumnDataType>>(
+          EqualDistinctCountHistogram<ColumnDataType>::from_chunks(table, column_id, bin_count, {chunk_id},
+                                                                   chunk_size));
+      if (added_histogram && added_row_count < chunk_size) {
+        // Only a part of the chunk is new, assume that it follows the distribution of the entire chunk
+        added_histogram = std::static_pointer_cast<AbstractHistogram<ColumnDataType>>(
+            added_histogram->scaled(added_row_count / chunk_size));
+      }
+
+      if (histogram && added_histogram) {
+        histogram = merge_histograms(*histogram, *added_histogram, bin_count);
+      } else if (added_histogram) {
+        histogram = added_histogram;
+      }
+
+      const auto statistics = column_statistics_from_histogram<ColumnDataType>(histogram, output_row_count);
+
+      // Sketches are merged by the maximum of their registers, so that the values of the chunk that are already
+      // represented do not change them. Only the value count must not include these values again.
+      if (input_column_statistics->distinct_count_sketch) {
+        const auto sketch = input_column_statistics->distinct_count_sketch->copy();
+        const auto added_sketch = segment_sketch<ColumnDataType>(*chunk, column_id, true)->copy();
+        added_sketch->value_count *= added_row_count / chunk_size;
+        sketch->merge(*added_sketch);
+        statistics->set_statistics_object(sketch);
+      }
+
+      output_column_statistics[column_id] = statistics;
+    });
+  }
+
+  auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(output_column_statistics), output_row_count);
+
+  // Distinct counts of value combinations cannot be merged, they are counted again when they are needed
+  output_table_statistics->column_group_statistics = std::make_shared<ColumnGroupStatistics>();
+  output_table_statistics->represented_chunk_sizes = represented_chunk_sizes;
+  output_table_statistics->represented_chunk_sizes.resize(std::max(represented_chunk_sizes.size(), chunk_id + 1ul));
+  output_table_statistics->represented_chunk_sizes[chunk_id] = chunk->size();
+  return output_table_statistics;
+}
+
+float TableStatistics::staleness(const Table& table) const {
+  auto unrepresented_row_count = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto represented_chunk_size = chunk_id < represented_chunk_sizes.size() ? represented_chunk_sizes[chunk_id]
+                                                                                  : ChunkOffset{0};
+    unrepresented_row_count += chunk->size() - std::min(chunk->size(), represented_chunk_size);
+  }
+
+  const auto table_row_count = table.row_count();
+  return table_row_count == 0 ? 0.0f : static_cast<float>(unrepresented_row_count) / table_row_count;
+}
+
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics) {
   stream << "TableStatistics {" << std::endl;
   stream << "  RowCount: " << table_statistics.row_count << "; " << std::endl;
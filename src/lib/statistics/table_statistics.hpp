@@ -12,6 +12,7 @@
 namespace opossum {
 
 class BaseAttributeStatistics;
+class ColumnGroupStatistics;
 class Table;
 
 /**
@@ -20,11 +21,17 @@ class Table;
  */
 class TableStatistics {
  public:
+  // Histograms of tables with more rows are built from a sample of their chunks, see from_table()
+  static constexpr auto DEFAULT_MAX_SCANNED_ROW_COUNT = size_t{10'000'000};
+
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. If the table has more than @param max_scanned_row_count rows, the histograms
+   * are built from evenly spaced chunks with about that many rows and extrapolated to the entire table. The distinct
+   * count sketches of the columns are merged from the pruning statistics of the chunks where these exist.
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(const Table& table,
+                                                     const size_t max_scanned_row_count = DEFAULT_MAX_SCANNED_ROW_COUNT);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -34,8 +41,28 @@ class TableStatistics {
    */
   DataType column_data_type(const ColumnID column_id) const;
 
+  /**
+   * Returns statistics of the @param table that additionally represent the rows of the chunk that were added after
+   * these statistics were created, e.g., when the chunk was finalized and encoded. The histograms of the chunk's rows
+   * are merged into the existing ones instead of rebuilding them from the entire table. Only applicable to statistics
+   * created by from_table().
+   */
+  std::shared_ptr<TableStatistics> with_chunk(const Table& table, const ChunkID chunk_id) const;
+
+  /**
+   * Share of the rows of the @param table that these statistics do not represent, i.e., 0 for up-to-date statistics
+   * and close to 1 if most rows were inserted after the statistics were created.
+   */
+  float staleness(const Table& table) const;
+
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // Multi-column statistics, only set for the statistics of a Table (i.e., those created by from_table())
+  std::shared_ptr<ColumnGroupStatistics> column_group_statistics;
+
+  // For the statistics of a Table, the number of rows of each chunk that they represent
+  std::vector<ChunkOffset> represented_chunk_sizes;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
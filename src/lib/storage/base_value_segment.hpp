@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "null_bitmap.hpp"
 
 namespace opossum {
 
@@ -20,11 +21,11 @@ class BaseValueSegment : public AbstractSegment {
   virtual void append(const AllTypeVariant& val) = 0;
 
   /**
-   * @brief Returns vector of NULL values (which is true for offsets where the segment's value is NULL).
+   * @brief Returns the bitmap of NULL values (which is true for offsets where the segment's value is NULL).
    *        Cannot be written to, see value_segment.hpp for details.
    *
    * Throws exception if is_nullable() returns false
    */
-  virtual const pmr_vector<bool>& null_values() const = 0;
+  virtual const NullBitmap& null_values() const = 0;
 };
 }  // namespace opossum
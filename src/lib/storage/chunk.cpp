@@ -5,15 +5,18 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_segment.hpp"
 #include "index/abstract_index.hpp"
+#include "memory/numa_memory_resource.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table_partitioning.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -81,13 +84,82 @@ ChunkOffset Chunk::size() const {
   return static_cast<ChunkOffset>(first_segment->size());
 }
 
-bool Chunk::has_mvcc_data() const { return _mvcc_data != nullptr; }
+bool Chunk::has_mvcc_data() const { return std::atomic_load(&_mvcc_data) != nullptr; }
 
-std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
+std::shared_ptr<MvccData> Chunk::mvcc_data() const {
+  auto mvcc_data = std::atomic_load(&_mvcc_data);
+  if (!mvcc_data) return nullptr;
+
+  auto successor = mvcc_data->successor();
+  if (!successor) return mvcc_data;
+
+  auto latest_mvcc_data = successor;
+  while ((successor = latest_mvcc_data->successor())) {
+    latest_mvcc_data = successor;
+  }
+
+  // Replacing the pointer releases the outdated versions once no one else uses them. If another thread replaced it in
+  // the meantime, it did so with the same or a newer version.
+  std::atomic_compare_exchange_strong(&_mvcc_data, &mvcc_data, latest_mvcc_data);
+  return latest_mvcc_data;
+}
+
+std::pair<std::shared_ptr<MvccData>, std::shared_lock<std::shared_mutex>> Chunk::writable_mvcc_data() const {
+  auto mvcc_data = this->mvcc_data();
+  DebugAssert(mvcc_data, "Chunk has no MVCC data");
+
+  while (true) {
+    if (mvcc_data->is_compacted()) {
+      // Compacted rows are neither deleted nor locked, and the begin cids are below every active snapshot
+      const auto expanded_mvcc_data = std::make_shared<MvccData>(mvcc_data->_compacted_size, *mvcc_data->max_begin_cid);
+      expanded_mvcc_data->max_begin_cid = mvcc_data->max_begin_cid;
+      mvcc_data->_try_set_successor(expanded_mvcc_data);
+      mvcc_data = this->mvcc_data();
+      continue;
+    }
+
+    auto lock = std::shared_lock<std::shared_mutex>{mvcc_data->_write_mutex};
+    if (!mvcc_data->_has_successor) return {mvcc_data, std::move(lock)};
+
+    // The MVCC data was compacted before we got the lock
+    lock.unlock();
+    mvcc_data = this->mvcc_data();
+  }
+}
+
+bool Chunk::try_compact_mvcc_data(const CommitID lowest_snapshot_commit_id) {
+  const auto mvcc_data = this->mvcc_data();
+  if (!mvcc_data || mvcc_data->is_compacted() || is_mutable() || _invalid_row_count > 0) return false;
+
+  const auto max_begin_cid = mvcc_data->max_begin_cid;
+  if (!max_begin_cid || *max_begin_cid > lowest_snapshot_commit_id) return false;
+
+  {
+    const auto lock = std::unique_lock<std::shared_mutex>{mvcc_data->_write_mutex};
+    if (mvcc_data->_has_successor) return false;
+
+    // Rows deleted through derived chunks increase the invalid row count of the derived chunk only, so check the rows
+    const auto chunk_size = size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_tid(chunk_offset) != INVALID_TRANSACTION_ID ||
+          mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) {
+        return false;
+      }
+    }
+
+    std::atomic_store(&mvcc_data->_successor, MvccData::create_compacted(chunk_size, *max_begin_cid));
+    mvcc_data->_has_successor = true;
+  }
+
+  // Replace the pointer right away instead of waiting for the next reader
+  this->mvcc_data();
+  return true;
+}
 
 std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<AbstractIndex>>();
+  const auto lock = std::shared_lock{_indexes_mutex};
   std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
@@ -98,15 +170,17 @@ void Chunk::finalize() {
   _is_mutable = false;
 
   // Only perform the max_begin_cid check if it hasn't already been set.
-  if (has_mvcc_data() && !_mvcc_data->max_begin_cid) {
+  // Mutable chunks are not compacted, so the MVCC data is not replaced concurrently
+  const auto mvcc_data = this->mvcc_data();
+  if (mvcc_data && !mvcc_data->max_begin_cid) {
     const auto chunk_size = size();
     Assert(chunk_size > 0, "finalize() should not be called on an empty chunk");
-    _mvcc_data->max_begin_cid = CommitID{0};
+    mvcc_data->max_begin_cid = CommitID{0};
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      _mvcc_data->max_begin_cid = std::max(*_mvcc_data->max_begin_cid, _mvcc_data->get_begin_cid(chunk_offset));
+      mvcc_data->max_begin_cid = std::max(*mvcc_data->max_begin_cid, mvcc_data->get_begin_cid(chunk_offset));
     }
 
-    Assert(_mvcc_data->max_begin_cid != MvccData::MAX_COMMIT_ID,
+    Assert(mvcc_data->max_begin_cid != MvccData::MAX_COMMIT_ID,
            "max_begin_cid should not be MAX_COMMIT_ID when finalizing a chunk. This probably means the chunk was "
            "finalized before all transactions committed/rolled back.");
   }
@@ -119,6 +193,7 @@ std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(const std::vector
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(
     const SegmentIndexType index_type, const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  const auto lock = std::shared_lock{_indexes_mutex};
   auto index_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
@@ -133,6 +208,7 @@ std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_typ
 }
 
 void Chunk::remove_index(const std::shared_ptr<AbstractIndex>& index) {
+  const auto lock = std::unique_lock{_indexes_mutex};
   auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
   DebugAssert(it != _indexes.cend(), "Trying to remove a non-existing index");
   _indexes.erase(it);
@@ -172,6 +248,21 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   _segments = std::move(new_segments);
 }
 
+NodeID Chunk::numa_node_id() const {
+  if (const auto* const numa_memory_resource = dynamic_cast<const NUMAMemoryResource*>(_alloc.resource())) {
+    return numa_memory_resource->node_id();
+  }
+
+  if (_segments.empty()) return INVALID_NODE_ID;
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(_segments.front());
+  if (!reference_segment) return INVALID_NODE_ID;
+
+  const auto& pos_list = reference_segment->pos_list();
+  if (pos_list->empty() || !pos_list->references_single_chunk()) return INVALID_NODE_ID;
+  const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+  return referenced_chunk ? referenced_chunk->numa_node_id() : INVALID_NODE_ID;
+}
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
 size_t Chunk::memory_usage(const MemoryUsageCalculationMode mode) const {
@@ -181,10 +272,15 @@ size_t Chunk::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += segment->memory_usage(mode);
   }
 
-  // TODO(anybody) Index memory usage missing
+  {
+    const auto lock = std::shared_lock{_indexes_mutex};
+    for (const auto& index : _indexes) {
+      bytes += index->memory_consumption();
+    }
+  }
 
-  if (_mvcc_data) {
-    bytes += _mvcc_data->memory_usage();
+  if (const auto mvcc_data = this->mvcc_data()) {
+    bytes += mvcc_data->memory_usage();
   }
 
   return bytes;
@@ -215,6 +311,25 @@ void Chunk::set_pruning_statistics(const std::optional<ChunkPruningStatistics>&
 
   _pruning_statistics = pruning_statistics;
 }
+
+void Chunk::set_partition(const std::shared_ptr<const TablePartitioning>& partitioning,
+                          const PartitionID partition_id) {
+  Assert(partitioning && partition_id < partitioning->partition_count(), "Invalid partition");
+  _partitioning = partitioning;
+  _partition_id = partition_id;
+}
+
+std::optional<PartitionID> Chunk::partition_id() const {
+  if (!_partitioning) return std::nullopt;
+  return _partition_id;
+}
+
+bool Chunk::partition_does_not_contain(const ColumnID column_id, const PredicateCondition predicate_condition,
+                                       const AllTypeVariant& value,
+                                       const std::optional<AllTypeVariant>& value2) const {
+  return _partitioning && _partitioning->does_not_contain(_partition_id, column_id, predicate_condition, value, value2);
+}
+
 void Chunk::increase_invalid_row_count(const uint32_t count) const { _invalid_row_count += count; }
 
 const std::vector<SortColumnDefinition>& Chunk::individually_sorted_by() const { return _sorted_by; }
@@ -5,9 +5,11 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/container/pmr/memory_resource.hpp>
@@ -24,6 +26,7 @@ namespace opossum {
 class AbstractIndex;
 class AbstractSegment;
 class BaseAttributeStatistics;
+class TablePartitioning;
 
 using Segments = pmr_vector<std::shared_ptr<AbstractSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractIndex>>;
@@ -85,8 +88,23 @@ class Chunk : private Noncopyable {
 
   bool has_mvcc_data() const;
 
+  // Returns the latest version of the MVCC data, which may be compacted (see MvccData)
   std::shared_ptr<MvccData> mvcc_data() const;
 
+  /**
+   * Returns MVCC data in which rows can be locked and invalidated, expanding compacted MVCC data if necessary. While
+   * the returned lock is held, the MVCC data is not compacted. Locked rows prevent it from being compacted afterwards.
+   */
+  std::pair<std::shared_ptr<MvccData>, std::shared_lock<std::shared_mutex>> writable_mvcc_data() const;
+
+  /**
+   * Replaces the MVCC data with compacted MVCC data if the chunk is immutable and all of its rows were committed
+   * before (or at) `lowest_snapshot_commit_id` and are neither deleted nor locked. The caller has to make sure that no
+   * active or future transaction uses a snapshot older than `lowest_snapshot_commit_id`. Returns whether the MVCC data
+   * was compacted.
+   */
+  bool try_compact_mvcc_data(const CommitID lowest_snapshot_commit_id);
+
   std::vector<std::shared_ptr<AbstractIndex>> get_indexes(
       const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
   std::vector<std::shared_ptr<AbstractIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
@@ -109,6 +127,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
+    const auto lock = std::unique_lock{_indexes_mutex};
     _indexes.emplace_back(index);
     return index;
   }
@@ -123,6 +142,13 @@ class Chunk : private Noncopyable {
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
+  /**
+   * Returns the NUMA node that holds the data of this chunk, i.e., the node of its NUMAMemoryResource. For chunks of
+   * ReferenceSegments that reference a single chunk, this is the node of the referenced chunk. Returns INVALID_NODE_ID
+   * if the chunk was not placed on a node.
+   */
+  NodeID numa_node_id() const;
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -135,6 +161,21 @@ class Chunk : private Noncopyable {
   void set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics);
   /** @} */
 
+  /**
+   * The chunks of partitioned tables hold the rows of a single partition (see Table::partitioning()). In contrast to
+   * the pruning statistics, the bounds of the partition are also known for mutable chunks. The partition is set by the
+   * Table before the chunk is added to it.
+   * @{
+   */
+  void set_partition(const std::shared_ptr<const TablePartitioning>& partitioning, const PartitionID partition_id);
+  std::optional<PartitionID> partition_id() const;
+
+  // See TablePartitioning::does_not_contain(), false for chunks that do not belong to a partition
+  bool partition_does_not_contain(const ColumnID column_id, const PredicateCondition predicate_condition,
+                                  const AllTypeVariant& value,
+                                  const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -193,9 +234,14 @@ class Chunk : private Noncopyable {
  private:
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
-  std::shared_ptr<MvccData> _mvcc_data;
+  // Accessed atomically, as it is replaced when the MVCC data is compacted or expanded
+  mutable std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
+  // Indexes can be created and removed while queries look them up, e.g., by the IndexSelectionPlugin
+  mutable std::shared_mutex _indexes_mutex;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
+  std::shared_ptr<const TablePartitioning> _partitioning;
+  PartitionID _partition_id{0};
   bool _is_mutable = true;
   std::vector<SortColumnDefinition> _sorted_by;
   mutable std::atomic<ChunkOffset> _invalid_row_count{0};
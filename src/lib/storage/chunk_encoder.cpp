@@ -1,23 +1,99 @@
 #include "chunk_encoder.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <vector>
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/base_segment_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/row_group_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Re-encodes the given dictionary segments with a single dictionary that contains the values of all of them. For
+// consecutive segments that share their dictionary, the value id mapping is only computed once. Returns whether
+// indexes of the replaced segments were removed.
+template <typename T>
+bool merge_dictionary_segments(const std::vector<std::shared_ptr<Chunk>>& chunks, const ColumnID column_id,
+                               const std::vector<std::shared_ptr<const DictionarySegment<T>>>& segments) {
+  auto merged_values = std::vector<T>{};
+  for (auto segment_index = size_t{0}; segment_index < segments.size(); ++segment_index) {
+    const auto& dictionary = segments[segment_index]->dictionary();
+    if (segment_index > 0 && segments[segment_index - 1]->dictionary() == dictionary) continue;
+    merged_values.insert(merged_values.end(), dictionary->cbegin(), dictionary->cend());
+  }
+
+  std::sort(merged_values.begin(), merged_values.end());
+  merged_values.erase(std::unique(merged_values.begin(), merged_values.end()), merged_values.end());
+  const auto merged_dictionary = std::make_shared<pmr_vector<T>>(merged_values.cbegin(), merged_values.cend());
+  const auto null_value_id = static_cast<uint32_t>(merged_dictionary->size());
+
+  auto removed_indexes = false;
+  auto mapped_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+  auto value_id_mapping = std::vector<uint32_t>{};
+  for (auto segment_index = size_t{0}; segment_index < segments.size(); ++segment_index) {
+    const auto& segment = *segments[segment_index];
+
+    if (segment.dictionary() != mapped_dictionary) {
+      // Both dictionaries are sorted and the merged one contains all values of the old one
+      mapped_dictionary = segment.dictionary();
+      const auto& dictionary = *mapped_dictionary;
+      value_id_mapping.resize(dictionary.size() + 1);
+      auto new_value_id = uint32_t{0};
+      for (auto old_value_id = size_t{0}; old_value_id < dictionary.size(); ++old_value_id) {
+        while ((*merged_dictionary)[new_value_id] < dictionary[old_value_id]) {
+          ++new_value_id;
+        }
+        value_id_mapping[old_value_id] = new_value_id;
+      }
+      value_id_mapping[dictionary.size()] = null_value_id;
+    }
+
+    auto attribute_vector = pmr_vector<uint32_t>(segment.size());
+    resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& compressed_vector) {
+      std::transform(compressed_vector.cbegin(), compressed_vector.cend(), attribute_vector.begin(),
+                     [&](const auto value_id) { return value_id_mapping[value_id]; });
+    });
+
+    // Keep the vector compression of the segment. The value ids might need more bits than before.
+    const auto vector_compression_type = parent_vector_compression_type(*segment.compressed_vector_type());
+    const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+        compress_vector(attribute_vector, vector_compression_type, PolymorphicAllocator<size_t>{}, {null_value_id}));
+
+    const auto& chunk = chunks[segment_index];
+    chunk->replace_segment(column_id,
+                           std::make_shared<DictionarySegment<T>>(merged_dictionary, compressed_attribute_vector));
+
+    for (const auto& index : chunk->get_indexes({segments[segment_index]})) {
+      chunk->remove_index(index);
+      removed_indexes = true;
+    }
+  }
+
+  return removed_indexes;
+}
+
+
+}  // namespace
+
 namespace opossum {
 
 /**
@@ -39,11 +115,15 @@ std::shared_ptr<AbstractSegment> ChunkEncoder::encode_segment(const std::shared_
 
     // Check if early exit is possible when passed segment is already encoded with requested spec.
     // In case no vector compression is specified, only the correct encoding type is checked and the current vector
-    // compression type is ignored.
+    // compression type is ignored. RowGroupSegments are unencoded as well, but are always copied into a columnar
+    // segment, as their RowGroup is only meant for mutable chunks.
     const auto current_segment_encoding_spec = get_segment_encoding_spec(segment);
-    if (current_segment_encoding_spec == encoding_spec ||
-        (!encoding_spec.vector_compression_type &&
-         current_segment_encoding_spec.encoding_type == encoding_spec.encoding_type)) {
+    const auto is_row_group_segment =
+        static_cast<bool>(std::dynamic_pointer_cast<const RowGroupSegment<ColumnDataType>>(segment));
+    if (!is_row_group_segment &&
+        (current_segment_encoding_spec == encoding_spec ||
+         (!encoding_spec.vector_compression_type &&
+          current_segment_encoding_spec.encoding_type == encoding_spec.encoding_type))) {
       result = segment;
       return;
     }
@@ -74,7 +154,16 @@ std::shared_ptr<AbstractSegment> ChunkEncoder::encode_segment(const std::shared_
       });
       result = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
     } else {
-      auto encoder = create_encoder(encoding_spec.encoding_type);
+      // FrameOfReference cannot encode int64_t blocks whose value range exceeds the 32-bit offsets. Such segments are
+      // dictionary-encoded instead, so that callers choosing the encoding per column (e.g., the BenchmarkTableEncoder)
+      // do not have to inspect the data.
+      auto encoding_type = encoding_spec.encoding_type;
+      if (encoding_type == EncodingType::FrameOfReference && data_type == DataType::Long &&
+          !frame_of_reference_is_applicable(*segment, data_type)) {
+        encoding_type = EncodingType::Dictionary;
+      }
+
+      auto encoder = create_encoder(encoding_type);
       if (encoding_spec.vector_compression_type) {
         encoder->set_vector_compression(*encoding_spec.vector_compression_type);
       }
@@ -102,6 +191,12 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
     const auto encoded_segment = encode_segment(abstract_segment, data_type, spec);
     chunk->replace_segment(column_id, encoded_segment);
+
+    // Indexes refer to the segments they were built for and are not found for the encoded segment anymore. Indexes
+    // of the table are recreated by Table::create_chunk_indexes().
+    for (const auto& index : chunk->get_indexes({abstract_segment})) {
+      chunk->remove_index(index);
+    }
   }
 
   generate_chunk_pruning_statistics(chunk);
@@ -114,73 +209,117 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
-                                 const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs) {
+                                 const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs,
+                                 const ChunkProgressCallback& progress_callback) {
   const auto column_data_types = table->column_data_types();
 
   for (auto chunk_id : chunk_ids) {
     Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-    const auto chunk = table->get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
-    encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+    Assert(table->get_chunk(chunk_id), "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
   }
+
+  Hyrise::get().job_partitioner.for_each_chunk(
+      *table, chunk_ids,
+      [&](const ChunkID chunk_id) {
+        encode_chunk(table->get_chunk(chunk_id), column_data_types, chunk_encoding_specs.at(chunk_id));
+        table->create_chunk_indexes(chunk_id);
+      },
+      progress_callback);
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
-                                 const SegmentEncodingSpec& segment_encoding_spec) {
+                                 const SegmentEncodingSpec& segment_encoding_spec,
+                                 const ChunkProgressCallback& progress_callback) {
   const auto column_data_types = table->column_data_types();
 
   for (auto chunk_id : chunk_ids) {
     Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-    const auto chunk = table->get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    encode_chunk(chunk, column_data_types, segment_encoding_spec);
+    Assert(table->get_chunk(chunk_id), "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
   }
+
+  Hyrise::get().job_partitioner.for_each_chunk(
+      *table, chunk_ids,
+      [&](const ChunkID chunk_id) {
+        encode_chunk(table->get_chunk(chunk_id), column_data_types, segment_encoding_spec);
+        table->create_chunk_indexes(chunk_id);
+      },
+      progress_callback);
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
-                                     const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
+                                     const std::vector<ChunkEncodingSpec>& chunk_encoding_specs,
+                                     const ChunkProgressCallback& progress_callback) {
   const auto column_types = table->column_data_types();
   const auto chunk_count = static_cast<size_t>(table->chunk_count());
   Assert(chunk_encoding_specs.size() == chunk_count, "Number of encoding specs must match table’s chunk count.");
 
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
+    Assert(table->get_chunk(chunk_id), "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
   }
+
+  Hyrise::get().job_partitioner.for_each_chunk(
+      *table,
+      [&](const ChunkID chunk_id) {
+        encode_chunk(table->get_chunk(chunk_id), column_types, chunk_encoding_specs[chunk_id]);
+        table->create_chunk_indexes(chunk_id);
+      },
+      progress_callback);
 }
 
-void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
-                                     const ChunkEncodingSpec& chunk_encoding_spec) {
+void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table, const ChunkEncodingSpec& chunk_encoding_spec,
+                                     const ChunkProgressCallback& progress_callback) {
   Assert(chunk_encoding_spec.size() == static_cast<size_t>(table->column_count()),
          "Number of encoding specs must match table’s column count.");
-  const auto column_types = table->column_data_types();
-
-  const auto chunk_count = table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  encode_all_chunks(table, std::vector<ChunkEncodingSpec>(table->chunk_count(), chunk_encoding_spec),
+                    progress_callback);
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
-                                     const SegmentEncodingSpec& segment_encoding_spec) {
+                                     const SegmentEncodingSpec& segment_encoding_spec,
+                                     const ChunkProgressCallback& progress_callback) {
   const auto column_types = table->column_data_types();
 
   const auto chunk_count = table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    encode_chunk(chunk, column_types, segment_encoding_spec);
+    Assert(table->get_chunk(chunk_id), "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
   }
+
+  Hyrise::get().job_partitioner.for_each_chunk(
+      *table,
+      [&](const ChunkID chunk_id) {
+        encode_chunk(table->get_chunk(chunk_id), column_types, segment_encoding_spec);
+        table->create_chunk_indexes(chunk_id);
+      },
+      progress_callback);
+}
+
+void ChunkEncoder::merge_dictionaries(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                      const std::vector<ChunkID>& chunk_ids) {
+  resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+    auto segments = std::vector<std::shared_ptr<const DictionarySegment<ColumnDataType>>>{};
+    chunks.reserve(chunk_ids.size());
+    segments.reserve(chunk_ids.size());
+    for (const auto chunk_id : chunk_ids) {
+      const auto chunk = table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto segment =
+          std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(segment, "Only DictionarySegments can share a dictionary.");
+      chunks.emplace_back(chunk);
+      segments.emplace_back(segment);
+    }
+
+    if (!merge_dictionary_segments(chunks, column_id, segments)) return;
+
+    for (const auto chunk_id : chunk_ids) {
+      table->create_chunk_indexes(chunk_id);
+    }
+  });
 }
 
 }  // namespace opossum
@@ -9,6 +9,7 @@
 #include "all_type_variant.hpp"
 #include "types.hpp"
 
+#include "scheduler/job_partitioner.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
@@ -25,9 +26,15 @@ class AbstractSegment;
  *
  * The methods provided are not thread-safe and might lead to race conditions
  * if there are other operations manipulating the chunks at the same time.
+ *
+ * The functions that encode multiple chunks of a table encode them in parallel using the JobPartitioner, i.e., in
+ * JobTasks on the current scheduler (see JobPartitioner::for_each_chunk()). They optionally report their progress
+ * after each chunk.
  */
 class ChunkEncoder {
  public:
+  // Int64 segments for which FrameOfReference is requested, but whose block value ranges exceed 32 bits, are
+  // dictionary-encoded instead (see frame_of_reference_is_applicable()).
   static std::shared_ptr<AbstractSegment> encode_segment(const std::shared_ptr<AbstractSegment>& segment,
                                                          const DataType data_type,
                                                          const SegmentEncodingSpec& encoding_spec);
@@ -36,6 +43,8 @@ class ChunkEncoder {
    * @brief Encodes a chunk
    *
    * Encodes a chunk using the passed encoding specifications. Reduces also the fragmentation of the chunk’s MVCC data.
+   * The indexes of the replaced segments are dropped. The functions that encode the chunks of a table recreate the
+   * table's indexes (see Table::create_chunk_indexes()).
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
@@ -52,13 +61,15 @@ class ChunkEncoder {
    * The encoding is specified per segment (SegmentEncodingSpec) for each chunk.
    */
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
-                            const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs);
+                            const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs,
+                            const ChunkProgressCallback& progress_callback = {});
 
   /**
    * @brief Encodes the specified chunks of the passed table using a single SegmentEncodingSpec
    */
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
-                            const SegmentEncodingSpec& segment_encoding_spec = {});
+                            const SegmentEncodingSpec& segment_encoding_spec = {},
+                            const ChunkProgressCallback& progress_callback = {});
 
   /**
    * @brief Encodes an entire table
@@ -66,20 +77,34 @@ class ChunkEncoder {
    * The encoding is specified per segment for each chunk.
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
-                                const std::vector<ChunkEncodingSpec>& chunk_encoding_specs);
+                                const std::vector<ChunkEncodingSpec>& chunk_encoding_specs,
+                                const ChunkProgressCallback& progress_callback = {});
 
   /**
    * @brief Encodes an entire table
    *
    * The encoding is specified per segment and is the same for each chunk.
    */
-  static void encode_all_chunks(const std::shared_ptr<Table>& table, const ChunkEncodingSpec& chunk_encoding_spec);
+  static void encode_all_chunks(const std::shared_ptr<Table>& table, const ChunkEncodingSpec& chunk_encoding_spec,
+                                const ChunkProgressCallback& progress_callback = {});
 
   /**
    * @brief Encodes an entire table using a single SegmentEncodingSpec
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
-                                const SegmentEncodingSpec& segment_encoding_spec = {});
+                                const SegmentEncodingSpec& segment_encoding_spec = {},
+                                const ChunkProgressCallback& progress_callback = {});
+
+  /**
+   * @brief Shares a single dictionary among the segments of a column
+   *
+   * Re-encodes the segments of the column in the specified chunks, which have to be DictionarySegments, with one
+   * sorted dictionary that contains the values of all of them. Value ids of these segments can then be compared
+   * across chunks. Segments that already share a dictionary are mapped to the new one in a single step. As for
+   * encode_chunks(), indexes of the replaced segments are dropped and recreated.
+   */
+  static void merge_dictionaries(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                 const std::vector<ChunkID>& chunk_ids);
 };
 
 }  // namespace opossum
@@ -7,6 +7,9 @@ namespace opossum {
 template <typename T>
 class ValueSegment;
 
+template <typename T>
+class RowGroupSegment;
+
 template <typename T>
 class DictionarySegment;
 
@@ -22,6 +25,9 @@ class FrameOfReferenceSegment;
 template <typename T>
 class LZ4Segment;
 
+template <typename T>
+class FSSTSegment;
+
 class ReferenceSegment;
 template <typename T, EraseReferencedSegmentType>
 class ReferenceSegmentIterable;
@@ -47,6 +53,11 @@ class ReferenceSegmentIterable;
 template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
 auto create_iterable_from_segment(const ValueSegment<T>& segment);
 
+// RowGroupSegments are only used for the mutable chunks of some tables and are erased unless the caller explicitly
+// asks for the unerased iterable, which keeps the number of instantiations of segment functors down
+template <typename T, bool EraseSegmentType = true>
+auto create_iterable_from_segment(const RowGroupSegment<T>& segment);
+
 template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
 auto create_iterable_from_segment(const DictionarySegment<T>& segment);
 
@@ -68,6 +79,9 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T, Enabled>& seg
 template <typename T, bool EraseSegmentType = true>
 auto create_iterable_from_segment(const LZ4Segment<T>& segment);
 
+template <typename T, bool EraseSegmentType = true>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment);
+
 template <typename T, bool EraseSegmentType = HYRISE_DEBUG,
           EraseReferencedSegmentType = (HYRISE_DEBUG ? EraseReferencedSegmentType::Yes
                                                      : EraseReferencedSegmentType::No)>
@@ -2,7 +2,9 @@
 
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/lz4_segment/lz4_segment_iterable.hpp"
+#include "storage/row_group_segment/row_group_segment_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -18,6 +20,15 @@ auto create_iterable_from_segment(const ValueSegment<T>& segment) {
   }
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const RowGroupSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return AnySegmentIterable<T>(RowGroupSegmentIterable<T>(segment));
+  } else {
+    return RowGroupSegmentIterable<T>{segment};
+  }
+}
+
 template <typename T, bool EraseSegmentType>
 auto create_iterable_from_segment(const DictionarySegment<T>& segment) {
 #ifdef HYRISE_ERASE_DICTIONARY
@@ -81,4 +92,11 @@ auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
   return AnySegmentIterable<T>(LZ4SegmentIterable<T>(segment));
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+  // FSSTSegment always gets erased, as decompressing a string costs more than the virtual function calls. Scans that
+  // benefit from the encoding use FSSTSegmentIterable directly to access the compressed values.
+  return AnySegmentIterable<T>(FSSTSegmentIterable<T>(segment));
+}
+
 }  // namespace opossum
@@ -17,6 +17,7 @@ DictionarySegment<T>::DictionarySegment(const std::shared_ptr<const pmr_vector<T
     : BaseDictionarySegment(data_type_from_type<T>()),
       _dictionary{dictionary},
       _attribute_vector{attribute_vector},
+      _string_heap_size{string_vector_heap_size(*_dictionary)},
       _decompressor{_attribute_vector->create_base_decompressor()} {
   // NULL is represented by _dictionary.size(). INVALID_VALUE_ID, which is the highest possible number in
   // ValueID::base_type (2^32 - 1), is needed to represent "value not found" in calls to lower_bound/upper_bound.
@@ -59,11 +60,12 @@ std::shared_ptr<AbstractSegment> DictionarySegment<T>::copy_using_allocator(
 }
 
 template <typename T>
-size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
+size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as the heap size of the strings is computed when the segment is created
   const auto common_elements_size = sizeof(*this) + _attribute_vector->data_size();
 
   if constexpr (std::is_same_v<T, pmr_string>) {
-    return common_elements_size + string_vector_memory_usage(*_dictionary, mode);
+    return common_elements_size + string_vector_memory_usage(*_dictionary, _string_heap_size);
   }
   return common_elements_size + _dictionary->size() * sizeof(typename decltype(_dictionary)::element_type::value_type);
 }
@@ -87,6 +87,7 @@ class DictionarySegment : public BaseDictionarySegment {
  protected:
   const std::shared_ptr<const pmr_vector<T>> _dictionary;
   const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const size_t _string_heap_size;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
 };
 
@@ -0,0 +1,33 @@
+#include "foreign_key_constraint.hpp"
+
+namespace opossum {
+
+ForeignKeyConstraint::ForeignKeyConstraint(std::vector<ColumnID> init_foreign_key_columns,
+                                           std::string init_referenced_table_name,
+                                           std::vector<ColumnID> init_referenced_columns)
+    : AbstractTableConstraint({init_foreign_key_columns.cbegin(), init_foreign_key_columns.cend()}),
+      _foreign_key_columns(std::move(init_foreign_key_columns)),
+      _referenced_table_name(std::move(init_referenced_table_name)),
+      _referenced_columns(std::move(init_referenced_columns)) {
+  Assert(!_foreign_key_columns.empty(), "Foreign key constraint needs at least one column.");
+  Assert(_foreign_key_columns.size() == _referenced_columns.size(),
+         "Foreign key constraint needs as many referenced columns as foreign key columns.");
+  Assert(columns().size() == _foreign_key_columns.size(), "Foreign key columns must not contain duplicates.");
+}
+
+const std::vector<ColumnID>& ForeignKeyConstraint::foreign_key_columns() const { return _foreign_key_columns; }
+
+const std::string& ForeignKeyConstraint::referenced_table_name() const { return _referenced_table_name; }
+
+const std::vector<ColumnID>& ForeignKeyConstraint::referenced_columns() const { return _referenced_columns; }
+
+bool ForeignKeyConstraint::_on_equals(const AbstractTableConstraint& table_constraint) const {
+  DebugAssert(dynamic_cast<const ForeignKeyConstraint*>(&table_constraint),
+              "Different table_constraint type should have been caught by AbstractTableConstraint::operator==");
+  const auto& foreign_key_constraint = static_cast<const ForeignKeyConstraint&>(table_constraint);
+  return _foreign_key_columns == foreign_key_constraint._foreign_key_columns &&
+         _referenced_table_name == foreign_key_constraint._referenced_table_name &&
+         _referenced_columns == foreign_key_constraint._referenced_columns;
+}
+
+}  // namespace opossum
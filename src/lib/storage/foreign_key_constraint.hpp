@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "abstract_table_constraint.hpp"
+
+namespace opossum {
+
+/**
+ * Container class to define foreign key constraints, i.e., inclusion dependencies: each row of the table whose foreign
+ * key columns are not NULL has the same values in the referenced columns of a row of the referenced table. The i-th
+ * foreign key column corresponds to the i-th referenced column, which is why the columns are also stored in order.
+ */
+class ForeignKeyConstraint final : public AbstractTableConstraint {
+ public:
+  ForeignKeyConstraint(std::vector<ColumnID> init_foreign_key_columns, std::string init_referenced_table_name,
+                       std::vector<ColumnID> init_referenced_columns);
+
+  const std::vector<ColumnID>& foreign_key_columns() const;
+  const std::string& referenced_table_name() const;
+  const std::vector<ColumnID>& referenced_columns() const;
+
+ protected:
+  bool _on_equals(const AbstractTableConstraint& table_constraint) const override;
+
+ private:
+  std::vector<ColumnID> _foreign_key_columns;
+  std::string _referenced_table_name;
+  std::vector<ColumnID> _referenced_columns;
+};
+
+using ForeignKeyConstraints = std::vector<ForeignKeyConstraint>;
+
+}  // namespace opossum
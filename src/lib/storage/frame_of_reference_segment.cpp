@@ -1,7 +1,11 @@
 #include "frame_of_reference_segment.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "resolve_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -15,13 +19,37 @@ FrameOfReferenceSegment<T, U>::FrameOfReferenceSegment(pmr_vector<T> block_minim
       _block_minima{std::move(block_minima)},
       _null_values{std::move(null_values)},
       _offset_values{std::move(offset_values)},
-      _decompressor{_offset_values->create_base_decompressor()} {}
+      _decompressor{_offset_values->create_base_decompressor()} {
+  // NULLs are stored as their block's minimum, i.e., as an offset of zero, so that they do not affect the maxima
+  auto max_offsets = std::vector<uint32_t>(_block_minima.size());
+  resolve_compressed_vector_type(*_offset_values, [&](const auto& vector) {
+    auto block_index = size_t{0};
+    auto offset_in_block = size_t{0};
+    for (auto it = vector.cbegin(); it != vector.cend(); ++it) {
+      max_offsets[block_index] = std::max(max_offsets[block_index], static_cast<uint32_t>(*it));
+      if (++offset_in_block == block_size) {
+        ++block_index;
+        offset_in_block = 0;
+      }
+    }
+  });
+
+  _block_maxima = pmr_vector<T>(_block_minima.size(), _block_minima.get_allocator());
+  for (auto block_index = size_t{0}; block_index < _block_minima.size(); ++block_index) {
+    _block_maxima[block_index] = static_cast<T>(_block_minima[block_index] + max_offsets[block_index]);
+  }
+}
 
 template <typename T, typename U>
 const pmr_vector<T>& FrameOfReferenceSegment<T, U>::block_minima() const {
   return _block_minima;
 }
 
+template <typename T, typename U>
+const pmr_vector<T>& FrameOfReferenceSegment<T, U>::block_maxima() const {
+  return _block_maxima;
+}
+
 template <typename T, typename U>
 const std::optional<pmr_vector<bool>>& FrameOfReferenceSegment<T, U>::null_values() const {
   return _null_values;
@@ -69,8 +97,8 @@ std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_alloc
 template <typename T, typename U>
 size_t FrameOfReferenceSegment<T, U>::memory_usage(const MemoryUsageCalculationMode) const {
   // MemoryUsageCalculationMode ignored since full calculation is efficient.
-  size_t segment_size =
-      sizeof(*this) + sizeof(T) * _block_minima.capacity() + _offset_values->data_size() + sizeof(_null_values);
+  size_t segment_size = sizeof(*this) + sizeof(T) * (_block_minima.capacity() + _block_maxima.capacity()) +
+                        _offset_values->data_size() + sizeof(_null_values);
 
   if (_null_values) {
     segment_size += _null_values->capacity() / CHAR_BIT;
@@ -91,6 +119,6 @@ std::optional<CompressedVectorType> FrameOfReferenceSegment<T, U>::compressed_ve
 
 template class FrameOfReferenceSegment<int32_t>;
 // int64_t disabled for now, as vector compression cannot handle 64 bit values - also in reference_segment_iterable.hpp
-// template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<int64_t>;
 
 }  // namespace opossum
@@ -27,13 +27,28 @@ class BaseCompressedVector;
  * FOR encoding on its own without vector compression does not
  * add any benefit.
  *
+ * As the offsets are compressed as uint32_t, the value range within
+ * a block of an int64_t segment must not exceed 2^32 - 1. This holds,
+ * e.g., for sorted keys and dates, but not for arbitrary int64_t data.
+ *
+ * If the segment is sorted, the block minima double as samples of
+ * the segment at known offsets. Sorted scans use them to find the
+ * relevant block before decompressing any offset (see
+ * SortedSegmentSearch::use_block_minima).
+ *
+ * Together with the block maxima, which are derived from the offsets
+ * when the segment is created, the minima form a header per block.
+ * Range scans skip or fully accept blocks whose [minimum, maximum]
+ * lies outside or inside the searched range and compare the offsets
+ * of the remaining blocks to the range minus the block's minimum.
+ *
  * Null values are stored in a separate vector. Note, for correct
  * offset handling, the minimum of each frame is stored in the
  * offset_values vector at each position that is NULL.
  *
  * std::enable_if_t must be used here and cannot be replaced by a
  * static_assert in order to prevent instantiation of
- * FrameOfReferenceSegment<T> with T other than int32_t. Otherwise,
+ * FrameOfReferenceSegment<T> with T other than int32_t and int64_t. Otherwise,
  * the compiler might instantiate FrameOfReferenceSegment with other
  * types even if they are never actually needed.
  * "If the function selected by overload resolution can be determined
@@ -58,6 +73,7 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
                                    std::unique_ptr<const BaseCompressedVector> offset_values);
 
   const pmr_vector<T>& block_minima() const;
+  const pmr_vector<T>& block_maxima() const;
   const std::optional<pmr_vector<bool>>& null_values() const;
   const BaseCompressedVector& offset_values() const;
 
@@ -98,11 +114,13 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
 
  private:
   const pmr_vector<T> _block_minima;
+  pmr_vector<T> _block_maxima;
   const std::optional<pmr_vector<bool>> _null_values;
   const std::unique_ptr<const BaseCompressedVector> _offset_values;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
 };
 
 extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
 
 }  // namespace opossum
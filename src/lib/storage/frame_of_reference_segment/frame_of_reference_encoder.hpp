@@ -85,7 +85,10 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
 
         if (block_contains_values) {
           // Make sure that the largest offset fits into uint32_t (required for vector compression).
-          Assert(static_cast<std::make_unsigned_t<T>>(max_value - min_value) <= std::numeric_limits<uint32_t>::max(),
+          // The subtraction is done unsigned, as the signed one might overflow for int64_t.
+          using UnsignedT = std::make_unsigned_t<T>;
+          Assert(static_cast<UnsignedT>(static_cast<UnsignedT>(max_value) - static_cast<UnsignedT>(min_value)) <=
+                     std::numeric_limits<uint32_t>::max(),
                  "Value range in block must fit into uint32_t.");
         }
 
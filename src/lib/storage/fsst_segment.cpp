@@ -0,0 +1,116 @@
+#include "fsst_segment.hpp"
+
+#include <climits>
+#include <memory>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(FSSTSymbolTable&& symbol_table, pmr_vector<char>&& compressed_values,
+                            pmr_vector<uint32_t>&& offsets, std::optional<pmr_vector<bool>>&& null_values)
+    : AbstractEncodedSegment{data_type_from_type<T>()},
+      _symbol_table{std::move(symbol_table)},
+      _compressed_values{std::move(compressed_values)},
+      _offsets{std::move(offsets)},
+      _null_values{std::move(null_values)} {
+  Assert(!_offsets.empty(), "Expected an offset after the last string");
+  Assert(_offsets.back() == _compressed_values.size(), "Last offset must be the end of the compressed values");
+  Assert(!_null_values || _null_values->size() + 1 == _offsets.size(), "Expected a NULL value flag for each row");
+}
+
+template <typename T>
+const FSSTSymbolTable& FSSTSegment<T>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T>
+const pmr_vector<char>& FSSTSegment<T>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T>
+const pmr_vector<uint32_t>& FSSTSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+T FSSTSegment<T>::decompress(const ChunkOffset chunk_offset) const {
+  auto value = T{};
+  _symbol_table.decompress(compressed_value(chunk_offset), value);
+  return value;
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FSSTSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  return decompress(chunk_offset);
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets.size() - 1);
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> FSSTSegment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_null_values =
+      _null_values ? std::optional<pmr_vector<bool>>{pmr_vector<bool>{*_null_values, alloc}} : std::nullopt;
+
+  auto copy = std::make_shared<FSSTSegment<T>>(_symbol_table.copy_using_allocator(alloc),
+                                               pmr_vector<char>{_compressed_values, alloc},
+                                               pmr_vector<uint32_t>{_offsets, alloc}, std::move(new_null_values));
+  copy->access_counter = access_counter;
+
+  return copy;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as full calculation is efficient.
+  auto null_value_vector_size = size_t{0};
+  if (_null_values) {
+    null_value_vector_size = _null_values->capacity() / CHAR_BIT;
+  }
+
+  return sizeof(*this) + _symbol_table.memory_usage() - sizeof(_symbol_table) + _compressed_values.capacity() +
+         _offsets.capacity() * sizeof(uint32_t) + null_value_vector_size;
+}
+
+template <typename T>
+EncodingType FSSTSegment<T>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTSegment<T>::compressed_vector_type() const {
+  return std::nullopt;
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "abstract_encoded_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Segment implementing FSST encoding for strings
+ *
+ * Each string is compressed separately with a symbol table that is built for the segment (see FSSTSymbolTable). The
+ * compressed strings are stored back to back. Unlike in LZ4Segments, accessing a single value only decompresses that
+ * value, which makes point accesses (e.g., from index joins or reference segments) cheap.
+ *
+ * As the compression is deterministic, equality predicates can be evaluated on the compressed strings by compressing
+ * the search value once. Prefix checks (LIKE 'abc%') stop decoding once the prefix has been checked.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  /**
+   * @param compressed_values The compressed strings without any separators in between.
+   * @param offsets The compressed string of row i is in [offsets[i], offsets[i + 1]) of compressed_values, i.e., there
+   *                is one more offset than rows. NULL values are stored as empty strings.
+   * @param null_values Boolean vector that contains the information which row is null and which is not null. If no
+   *                    value in the segment is null, std::nullopt is passed instead.
+   */
+  FSSTSegment(FSSTSymbolTable&& symbol_table, pmr_vector<char>&& compressed_values, pmr_vector<uint32_t>&& offsets,
+              std::optional<pmr_vector<bool>>&& null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_values() const;
+  const pmr_vector<uint32_t>& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  // Returns the compressed representation of the value at chunk_offset. It is empty for NULL values.
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+    return std::string_view{_compressed_values.data() + _offsets[chunk_offset],
+                            _offsets[chunk_offset + 1] - _offsets[chunk_offset]};
+  }
+
+  bool is_null(const ChunkOffset chunk_offset) const { return _null_values && (*_null_values)[chunk_offset]; }
+
+  T decompress(const ChunkOffset chunk_offset) const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode mode) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<char> _compressed_values;
+  const pmr_vector<uint32_t> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace opossum
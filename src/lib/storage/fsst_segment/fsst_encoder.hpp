@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes a string segment with FSST (see FSSTSymbolTable). The symbol table is built on a sample of roughly
+ * SAMPLE_SIZE bytes, which is what the FSST authors found to be sufficient for its quality.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = false;
+
+  static constexpr auto SAMPLE_SIZE = size_t{16'384};
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    auto values = std::vector<pmr_string>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+    auto total_size = size_t{0};
+
+    segment_iterable.with_iterators([&](auto it, auto end) {
+      const auto segment_size = static_cast<size_t>(std::distance(it, end));
+      values.reserve(segment_size);
+      null_values.reserve(segment_size);
+
+      for (; it != end; ++it) {
+        const auto segment_value = *it;
+        const auto is_null = segment_value.is_null();
+        values.emplace_back(is_null ? pmr_string{} : segment_value.value());
+        null_values.push_back(is_null);
+        segment_contains_null = segment_contains_null || is_null;
+        total_size += values.back().size();
+      }
+    });
+
+    // Sample every n-th string so that the sample covers the whole segment
+    const auto sample_stride = std::max(size_t{1}, total_size / SAMPLE_SIZE);
+    auto sample = std::vector<std::string_view>{};
+    sample.reserve(values.size() / sample_stride + 1);
+    for (auto index = size_t{0}; index < values.size(); index += sample_stride) {
+      sample.emplace_back(values[index]);
+    }
+
+    auto symbol_table = FSSTSymbolTable::build(sample, allocator);
+
+    auto compressed_values = pmr_vector<char>{allocator};
+    auto offsets = pmr_vector<uint32_t>{allocator};
+    compressed_values.reserve(total_size);
+    offsets.reserve(values.size() + 1);
+    offsets.push_back(0);
+    for (const auto& value : values) {
+      symbol_table.compress(value, compressed_values);
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+             "Compressed strings exceed the maximum size of an FSST segment");
+      offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+    }
+
+    // The reservation might have overallocated memory - hand that memory back to the system
+    compressed_values.shrink_to_fit();
+
+    auto optional_null_values = segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)}
+                                                      : std::optional<pmr_vector<bool>>{};
+
+    return std::make_shared<FSSTSegment<T>>(std::move(symbol_table), std::move(compressed_values), std::move(offsets),
+                                            std::move(optional_null_values));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/fsst_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over the values of an FSSTSegment, decompressing one string per dereferenced position. If CompressedValues
+ * is set, the positions instead hold the compressed representations of the strings (pointing into the segment). Table
+ * scans use these to evaluate predicates without decompressing the values (see FSSTSegment).
+ */
+template <typename T, bool CompressedValues = false>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T, CompressedValues>> {
+ public:
+  using ValueType = std::conditional_t<CompressedValues, std::string_view, T>;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+
+    auto begin = Iterator{_segment, ChunkOffset{0}};
+    auto end = Iterator{_segment, _segment.size()};
+    functor(begin, end);
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+
+    using PosListIteratorType = decltype(position_filter->cbegin());
+    auto begin =
+        PointAccessIterator<PosListIteratorType>{_segment, position_filter->cbegin(), position_filter->cbegin()};
+    auto end = PointAccessIterator<PosListIteratorType>{_segment, position_filter->cbegin(), position_filter->cend()};
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+  static ValueType _value(const FSSTSegment<T>& segment, const ChunkOffset chunk_offset) {
+    if constexpr (CompressedValues) {
+      return segment.compressed_value(chunk_offset);
+    } else {
+      return segment.decompress(chunk_offset);
+    }
+  }
+
+ private:
+  class Iterator : public AbstractSegmentIterator<Iterator, SegmentPosition<ValueType>> {
+   public:
+    using ValueType = typename FSSTSegmentIterable::ValueType;
+    using IterableType = FSSTSegmentIterable<T, CompressedValues>;
+
+    Iterator(const FSSTSegment<T>& segment, const ChunkOffset chunk_offset)
+        : _segment{&segment}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+    }
+
+    SegmentPosition<ValueType> dereference() const {
+      return SegmentPosition<ValueType>{_value(*_segment, _chunk_offset), _segment->is_null(_chunk_offset),
+                                        _chunk_offset};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename PosListIteratorType>
+  class PointAccessIterator : public AbstractPointAccessSegmentIterator<PointAccessIterator<PosListIteratorType>,
+                                                                        SegmentPosition<ValueType>, PosListIteratorType> {
+   public:
+    using ValueType = typename FSSTSegmentIterable::ValueType;
+    using IterableType = FSSTSegmentIterable<T, CompressedValues>;
+
+    PointAccessIterator(const FSSTSegment<T>& segment, PosListIteratorType position_filter_begin,
+                        PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<PosListIteratorType>, SegmentPosition<ValueType>,
+                                             PosListIteratorType>{std::move(position_filter_begin),
+                                                                  std::move(position_filter_it)},
+          _segment{&segment} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<ValueType> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+      return SegmentPosition<ValueType>{_value(*_segment, chunk_offset), _segment->is_null(chunk_offset),
+                                        chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+  };
+};
+
+}  // namespace opossum
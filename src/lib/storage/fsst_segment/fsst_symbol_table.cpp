@@ -0,0 +1,198 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <unordered_map>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Selects the lower `length` bytes of a symbol word.
+uint64_t symbol_mask(const size_t length) {
+  return length >= FSSTSymbolTable::MAX_SYMBOL_LENGTH ? ~uint64_t{0} : (uint64_t{1} << (8 * length)) - 1;
+}
+
+uint8_t first_byte(const uint64_t symbol) { return static_cast<uint8_t>(symbol & 0xFF); }
+
+}  // namespace
+
+namespace opossum {
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& sample,
+                                       const PolymorphicAllocator<uint64_t>& allocator) {
+  struct Candidate {
+    uint64_t symbol;
+    uint8_t length;
+    size_t gain;
+  };
+
+  auto symbol_table = FSSTSymbolTable{pmr_vector<uint64_t>{allocator}, pmr_vector<uint8_t>{allocator}};
+
+  for (auto generation = size_t{0}; generation < GENERATION_COUNT; ++generation) {
+    // Gains of the candidate symbols, indexed by their length minus one
+    auto gains = std::array<std::unordered_map<uint64_t, size_t>, MAX_SYMBOL_LENGTH>{};
+
+    for (const auto& value : sample) {
+      auto previous_symbol = uint64_t{0};
+      auto previous_length = size_t{0};
+      symbol_table._for_each_code(value, [&](const uint8_t, const uint64_t symbol, const size_t length) {
+        gains[length - 1][symbol] += length;
+        if (previous_length > 0 && previous_length + length <= MAX_SYMBOL_LENGTH) {
+          const auto concatenation = previous_symbol | (symbol << (8 * previous_length));
+          gains[previous_length + length - 1][concatenation] += previous_length + length;
+        }
+        previous_symbol = symbol;
+        previous_length = length;
+      });
+    }
+
+    auto candidates = std::vector<Candidate>{};
+    for (auto length = size_t{1}; length <= MAX_SYMBOL_LENGTH; ++length) {
+      for (const auto& [symbol, gain] : gains[length - 1]) {
+        candidates.emplace_back(Candidate{symbol, static_cast<uint8_t>(length), gain});
+      }
+    }
+
+    // Keep the candidates with the highest gain. Ties are broken by the symbol to make the table deterministic.
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return std::tie(rhs.gain, rhs.length, lhs.symbol) < std::tie(lhs.gain, lhs.length, rhs.symbol);
+                      });
+    candidates.resize(symbol_count);
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      const auto lhs_first_byte = first_byte(lhs.symbol);
+      const auto rhs_first_byte = first_byte(rhs.symbol);
+      return std::tie(lhs_first_byte, rhs.length, lhs.symbol) < std::tie(rhs_first_byte, lhs.length, rhs.symbol);
+    });
+
+    auto symbols = pmr_vector<uint64_t>{allocator};
+    auto symbol_lengths = pmr_vector<uint8_t>{allocator};
+    symbols.reserve(symbol_count);
+    symbol_lengths.reserve(symbol_count);
+    for (const auto& candidate : candidates) {
+      symbols.emplace_back(candidate.symbol);
+      symbol_lengths.emplace_back(candidate.length);
+    }
+
+    symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+  }
+
+  return symbol_table;
+}
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& symbol_lengths)
+    : _symbols{std::move(symbols)}, _symbol_lengths{std::move(symbol_lengths)} {
+  Assert(_symbols.size() == _symbol_lengths.size(), "Expected a length for each symbol");
+  Assert(_symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols");
+
+  const auto symbol_count = _symbols.size();
+  for (auto code = size_t{0}; code < symbol_count; ++code) {
+    DebugAssert(_symbol_lengths[code] >= 1 && _symbol_lengths[code] <= MAX_SYMBOL_LENGTH, "Invalid symbol length");
+    DebugAssert(code == 0 || first_byte(_symbols[code - 1]) < first_byte(_symbols[code]) ||
+                    (first_byte(_symbols[code - 1]) == first_byte(_symbols[code]) &&
+                     _symbol_lengths[code - 1] >= _symbol_lengths[code]),
+                "Symbols are not sorted by their first byte and descending length");
+    ++_first_byte_offsets[first_byte(_symbols[code]) + 1];
+  }
+
+  for (auto byte = size_t{1}; byte < _first_byte_offsets.size(); ++byte) {
+    _first_byte_offsets[byte] += _first_byte_offsets[byte - 1];
+  }
+}
+
+template <typename Functor>
+void FSSTSymbolTable::_for_each_code(const std::string_view value, const Functor& functor) const {
+  const auto value_size = value.size();
+  auto position = size_t{0};
+  while (position < value_size) {
+    const auto remaining_length = value_size - position;
+    auto word = uint64_t{0};
+    std::memcpy(&word, value.data() + position, std::min(remaining_length, MAX_SYMBOL_LENGTH));
+
+    const auto byte = first_byte(word);
+    auto code = ESCAPE_CODE;
+    auto symbol = uint64_t{byte};
+    auto length = size_t{1};
+
+    const auto codes_end = _first_byte_offsets[byte + 1];
+    for (auto candidate_code = _first_byte_offsets[byte]; candidate_code < codes_end; ++candidate_code) {
+      const auto candidate_length = size_t{_symbol_lengths[candidate_code]};
+      if (candidate_length <= remaining_length && (word & symbol_mask(candidate_length)) == _symbols[candidate_code]) {
+        code = static_cast<uint8_t>(candidate_code);
+        symbol = _symbols[candidate_code];
+        length = candidate_length;
+        break;
+      }
+    }
+
+    functor(code, symbol, length);
+    position += length;
+  }
+}
+
+void FSSTSymbolTable::compress(const std::string_view value, pmr_vector<char>& compressed_values) const {
+  _for_each_code(value, [&](const uint8_t code, const uint64_t symbol, const size_t) {
+    compressed_values.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      compressed_values.push_back(static_cast<char>(symbol));
+    }
+  });
+}
+
+void FSSTSymbolTable::decompress(const std::string_view compressed_value, pmr_string& value) const {
+  const auto compressed_size = compressed_value.size();
+  for (auto index = size_t{0}; index < compressed_size; ++index) {
+    const auto code = static_cast<uint8_t>(compressed_value[index]);
+    if (code == ESCAPE_CODE) {
+      DebugAssert(index + 1 < compressed_size, "Escape code is not followed by a literal");
+      value.push_back(compressed_value[++index]);
+    } else {
+      value.append(reinterpret_cast<const char*>(&_symbols[code]), _symbol_lengths[code]);
+    }
+  }
+}
+
+bool FSSTSymbolTable::decompressed_starts_with(const std::string_view compressed_value,
+                                               const std::string_view prefix) const {
+  const auto compressed_size = compressed_value.size();
+  auto matched_length = size_t{0};
+  for (auto index = size_t{0}; index < compressed_size && matched_length < prefix.size(); ++index) {
+    const auto code = static_cast<uint8_t>(compressed_value[index]);
+
+    const char* bytes = nullptr;
+    auto length = size_t{1};
+    if (code == ESCAPE_CODE) {
+      DebugAssert(index + 1 < compressed_size, "Escape code is not followed by a literal");
+      bytes = &compressed_value[++index];
+    } else {
+      bytes = reinterpret_cast<const char*>(&_symbols[code]);
+      length = _symbol_lengths[code];
+    }
+
+    const auto compared_length = std::min(length, prefix.size() - matched_length);
+    if (std::memcmp(bytes, prefix.data() + matched_length, compared_length) != 0) return false;
+    matched_length += compared_length;
+  }
+
+  return matched_length == prefix.size();
+}
+
+const pmr_vector<uint64_t>& FSSTSymbolTable::symbols() const { return _symbols; }
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::symbol_lengths() const { return _symbol_lengths; }
+
+FSSTSymbolTable FSSTSymbolTable::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  return FSSTSymbolTable{pmr_vector<uint64_t>{_symbols, alloc}, pmr_vector<uint8_t>{_symbol_lengths, alloc}};
+}
+
+size_t FSSTSymbolTable::memory_usage() const {
+  return sizeof(*this) + _symbols.capacity() * sizeof(uint64_t) + _symbol_lengths.capacity() * sizeof(uint8_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Static symbol table of the Fast Static Symbol Table (FSST) string compression, see Boncz et al.: "FSST: Fast Random
+ * Access String Compression", VLDB 2020.
+ *
+ * A table holds up to 255 symbols of one to eight bytes. A string is compressed by greedily replacing the longest
+ * symbol that matches at the current position by its one-byte code. Bytes that no symbol starts with are written as
+ * ESCAPE_CODE followed by the literal byte. As each string is compressed independently, single strings can be
+ * decompressed without touching their neighbors. Furthermore, the compression is deterministic, so two strings are equal
+ * iff their compressed representations are equal.
+ *
+ * Symbols are stored as little-endian 64-bit words (i.e., the first byte of a symbol is its least significant byte).
+ * The codes are sorted by the first byte of their symbols and, for the same first byte, by descending length. This way,
+ * the first matching symbol is the longest one.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  /**
+   * Builds a symbol table for the given sample strings. Starting with an empty table, each of GENERATION_COUNT rounds
+   * compresses the sample with the current table and counts how often the used symbols, escaped bytes, and
+   * concatenations of two subsequent ones occur. The next table consists of the candidates with the highest gain
+   * (i.e., occurrences times length).
+   */
+  static FSSTSymbolTable build(const std::vector<std::string_view>& sample,
+                               const PolymorphicAllocator<uint64_t>& allocator = {});
+
+  static constexpr auto GENERATION_COUNT = size_t{5};
+
+  // The symbols have to be sorted as described above.
+  FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& symbol_lengths);
+
+  // Appends the compressed representation of value to compressed_values.
+  void compress(const std::string_view value, pmr_vector<char>& compressed_values) const;
+
+  // Appends the decompressed representation of compressed_value to value.
+  void decompress(const std::string_view compressed_value, pmr_string& value) const;
+
+  // Checks whether the decompressed string starts with prefix, but stops decoding as soon as the result is known.
+  bool decompressed_starts_with(const std::string_view compressed_value, const std::string_view prefix) const;
+
+  const pmr_vector<uint64_t>& symbols() const;
+  const pmr_vector<uint8_t>& symbol_lengths() const;
+
+  FSSTSymbolTable copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
+
+  size_t memory_usage() const;
+
+ private:
+  // Calls functor(code, symbol, length) for each code that the greedy compression of value emits. For escaped bytes,
+  // code is ESCAPE_CODE, the symbol is the literal byte, and the length is 1.
+  template <typename Functor>
+  void _for_each_code(const std::string_view value, const Functor& functor) const;
+
+  pmr_vector<uint64_t> _symbols;
+  pmr_vector<uint8_t> _symbol_lengths;
+
+  // The codes of symbols starting with byte b are in [_first_byte_offsets[b], _first_byte_offsets[b + 1]).
+  std::array<uint16_t, 257> _first_byte_offsets{};
+};
+
+}  // namespace opossum
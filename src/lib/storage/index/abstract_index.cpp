@@ -7,6 +7,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 
 namespace opossum {
 
@@ -21,6 +22,8 @@ size_t AbstractIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOf
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::Hash:
+      return HashIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::Invalid:
       Fail("SegmentIndexType is invalid.");
   }
@@ -56,6 +59,17 @@ AbstractIndex::Iterator AbstractIndex::upper_bound(const std::vector<AllTypeVari
   return _upper_bound(values);
 }
 
+std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator> AbstractIndex::equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(
+      (_get_indexed_segments().size() >= values.size()),
+      "AbstractIndex: The number of queried segments has to be less or equal to the number of indexed segments.");
+
+  return _equal_range(values);
+}
+
+bool AbstractIndex::supports_range_queries() const { return true; }
+
 AbstractIndex::Iterator AbstractIndex::cbegin() const { return _cbegin(); }
 
 AbstractIndex::Iterator AbstractIndex::cend() const { return _cend(); }
@@ -64,6 +78,11 @@ AbstractIndex::Iterator AbstractIndex::null_cbegin() const { return _null_positi
 
 AbstractIndex::Iterator AbstractIndex::null_cend() const { return _null_positions.cend(); }
 
+std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator> AbstractIndex::_equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  return {_lower_bound(values), _upper_bound(values)};
+}
+
 SegmentIndexType AbstractIndex::type() const { return _type; }
 
 size_t AbstractIndex::memory_consumption() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,7 +16,8 @@ class AbstractSegment;
 /**
  * AbstractIndex is the abstract super class for all index types, e.g. GroupKeyIndex, CompositeGroupKeyIndex,
  * ARTIndex etc.
- * It is assumed that all index types support range queries and that they are composite indexes.
+ * It is assumed that all index types except for the HashIndex support range queries (see supports_range_queries())
+ * and that they are composite indexes.
  * I.e. the index is sorted based on the column order. To check whether a key is less than another
  * key, the comparison is performed for the first column. If and only if they are equal, a check is
  * executed for the part of the next column. If needed, this step is repeated for all column
@@ -102,6 +104,22 @@ class AbstractIndex : private Noncopyable {
    */
   Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
 
+  /**
+   * Returns the range of the entries that are equal to the given values. For indexes that support range queries, this
+   * is the range from lower_bound() to upper_bound().
+   *
+   * Calls _equal_range() of the most derived class.
+   * @param values are used to query the index.
+   * @return A pair of Iterators on the first matching element and on the element after the last one.
+   */
+  std::pair<Iterator, Iterator> equal_range(const std::vector<AllTypeVariant>& values) const;
+
+  /**
+   * Indexes that do not order their values, i.e., the HashIndex, only support equal_range(), and their lower_bound()
+   * and upper_bound() fail. Iterating from cbegin() to cend() yields their positions grouped by value.
+   */
+  virtual bool supports_range_queries() const;
+
   /**
    * Returns an Iterator to the position of the smallest indexed non-NULL element. This is useful for range queries
    * with no specified begin.
@@ -154,6 +172,7 @@ class AbstractIndex : private Noncopyable {
    */
   virtual Iterator _lower_bound(const std::vector<AllTypeVariant>&) const = 0;
   virtual Iterator _upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual std::pair<Iterator, Iterator> _equal_range(const std::vector<AllTypeVariant>& values) const;
   virtual Iterator _cbegin() const = 0;
   virtual Iterator _cend() const = 0;
   virtual std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const = 0;
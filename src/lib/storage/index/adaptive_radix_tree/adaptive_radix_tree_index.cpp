@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <iterator>
-#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -30,28 +29,50 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
   Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
   Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_indexed_segment->attribute_vector()->size());
-
+  // The value IDs of the dictionary segment are already sorted and dense, so that the ChunkOffsets are sorted by their
+  // value IDs with a counting sort instead of inserting them into the tree one by one. Each value ID then forms a run
+  // of ChunkOffsets in _chunk_offsets, which the leaves of the tree point to.
   const auto null_value_id = _indexed_segment->null_value_id();
-  _null_positions.reserve(_indexed_segment->attribute_vector()->size());
+  auto value_id_counts = std::vector<ChunkOffset>(static_cast<size_t>(null_value_id) + 1, ChunkOffset{0});
+  resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    for (auto value_id_iter = attribute_vector.cbegin(); value_id_iter != attribute_vector.cend(); ++value_id_iter) {
+      ++value_id_counts[static_cast<ValueID>(*value_id_iter)];
+    }
+  });
+
+  auto keys = std::vector<BinaryComparable>{};
+  auto run_begins = std::vector<size_t>{};
+  auto run_ends = std::vector<size_t>(value_id_counts.size());
+  auto offset_count = size_t{0};
+  for (auto value_id = ValueID{0}; value_id < null_value_id; ++value_id) {
+    run_ends[value_id] = offset_count;
+    if (value_id_counts[value_id] == 0) continue;
+    keys.emplace_back(value_id);
+    run_begins.emplace_back(offset_count);
+    offset_count += value_id_counts[value_id];
+  }
+  run_begins.emplace_back(offset_count);
+
+  _chunk_offsets.resize(offset_count);
+  _null_positions.reserve(value_id_counts[null_value_id]);
 
+  // The scatter is stable, so that the ChunkOffsets of each run remain sorted
   resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
     auto chunk_offset = ChunkOffset{0u};
     auto value_id_iter = attribute_vector.cbegin();
     for (; value_id_iter != attribute_vector.cend(); ++value_id_iter, ++chunk_offset) {
-      if (static_cast<ValueID>(*value_id_iter) == null_value_id) {
+      const auto value_id = static_cast<ValueID>(*value_id_iter);
+      if (value_id == null_value_id) {
         _null_positions.emplace_back(chunk_offset);
       } else {
-        pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_iter}), chunk_offset);
+        _chunk_offsets[run_ends[value_id]++] = chunk_offset;
       }
     }
   });
 
-  _null_positions.shrink_to_fit();
-  _root = _bulk_insert(pairs_to_insert);
+  // _chunk_offsets is complete before the tree is built and is not modified afterwards, so that the Iterators of the
+  // leaves remain valid
+  if (!keys.empty()) _root = _build_tree(keys, run_begins, 0, keys.size(), 0);
 }
 
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -90,64 +111,70 @@ AbstractIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_of
 
 std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
     const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values) {
-  if (values.empty()) {
-    return nullptr;
-  } else {
-    _chunk_offsets.reserve(values.size());
-    auto begin = _chunk_offsets.cbegin();
-    return _bulk_insert(values, static_cast<size_t>(0u), begin);
+  if (values.empty()) return nullptr;
+
+  auto sorted_values = values;
+  std::stable_sort(sorted_values.begin(), sorted_values.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto keys = std::vector<BinaryComparable>{};
+  auto run_begins = std::vector<size_t>{};
+  _chunk_offsets.clear();
+  _chunk_offsets.reserve(sorted_values.size());
+  for (const auto& [key, chunk_offset] : sorted_values) {
+    if (keys.empty() || !(keys.back() == key)) {
+      keys.emplace_back(key);
+      run_begins.emplace_back(_chunk_offsets.size());
+    }
+    _chunk_offsets.emplace_back(chunk_offset);
   }
+  run_begins.emplace_back(_chunk_offsets.size());
+
+  return _build_tree(keys, run_begins, 0, keys.size(), 0);
 }
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values, size_t depth, AbstractIndex::Iterator& it) {
-  // This is the anchor of the recursion: if all values have the same key, create a leaf.
-  if (std::all_of(values.begin(), values.end(), [&values](const std::pair<BinaryComparable, ChunkOffset>& pair) {
-        return values.front().first == pair.first;
-      })) {
-    // copy the Iterator in the _chunk_offsets - vector --> this is the lower_bound of the leaf
-    auto lower = it;
-    // insert the ChunkOffsets into the vector and push the Iterator further
-    auto old_capacity = _chunk_offsets.capacity();
-    for (const auto& pair : values) {
-      _chunk_offsets.emplace_back(pair.second);
-    }
-    std::advance(it, values.size());
-    auto new_capacity = _chunk_offsets.capacity();
-    // we are not allowed to change the size of the vector as it would invalidate all our Iterators
-    Assert(old_capacity == new_capacity, "_chunk_offsets capacity changes, all Iterators are invalidated");
-
-    // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
-    auto upper = it;
-    return std::make_shared<Leaf>(lower, upper);
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_build_tree(const std::vector<BinaryComparable>& keys,
+                                                             const std::vector<size_t>& run_begins,
+                                                             const size_t first_run, const size_t last_run,
+                                                             size_t depth) const {
+  // This is the anchor of the recursion: a single run of equal keys becomes a leaf
+  if (last_run - first_run == 1) {
+    return std::make_shared<Leaf>(_chunk_offsets.cbegin() + run_begins[first_run],
+                                  _chunk_offsets.cbegin() + run_begins[last_run]);
   }
 
-  // radix-partition on the depths-byte into 256 partitions
-  std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
-  for (const auto& pair : values) {
-    partitions[pair.first[depth]].emplace_back(pair);
-  }
+  // As the keys are sorted, the bytes shared by all keys of the range are the ones shared by its first and last key
+  const auto& first_key = keys[first_run];
+  const auto& last_key = keys[last_run - 1];
+  const auto prefix_depth = depth;
+  while (first_key[depth] == last_key[depth]) ++depth;
+  const auto prefix_length = depth - prefix_depth;
 
-  // call recursively for each non-empty partition and gather the children
+  // Partition the runs on the byte at depth, each partition being a contiguous range of runs
   std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children;
-
-  for (auto partition_id = size_t{0}; partition_id < partitions.size(); ++partition_id) {
-    if (!partitions[partition_id].empty()) {
-      auto child =
-          std::make_pair(static_cast<uint8_t>(partition_id), _bulk_insert(partitions[partition_id], depth + 1, it));
-      children.emplace_back(std::move(child));
-    }
+  auto partition_begin = first_run;
+  while (partition_begin < last_run) {
+    const auto partial_key = keys[partition_begin][depth];
+    auto partition_end = partition_begin + 1;
+    while (partition_end < last_run && keys[partition_end][depth] == partial_key) ++partition_end;
+
+    children.emplace_back(partial_key, _build_tree(keys, run_begins, partition_begin, partition_end, depth + 1));
+    partition_begin = partition_end;
   }
+
   // finally create the appropriate ARTNode according to the size of the children
+  auto node = std::shared_ptr<ARTNode>{};
   if (children.size() <= 4) {
-    return std::make_shared<ARTNode4>(children);
+    node = std::make_shared<ARTNode4>(children);
   } else if (children.size() <= 16) {
-    return std::make_shared<ARTNode16>(children);
+    node = std::make_shared<ARTNode16>(children);
   } else if (children.size() <= 48) {
-    return std::make_shared<ARTNode48>(children);
+    node = std::make_shared<ARTNode48>(children);
   } else {
-    return std::make_shared<ARTNode256>(children);
+    node = std::make_shared<ARTNode256>(children);
   }
+  node->set_prefix(first_key, prefix_depth, prefix_length);
+  return node;
 }
 
 std::vector<std::shared_ptr<const AbstractSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
@@ -159,7 +186,7 @@ size_t AdaptiveRadixTreeIndex::_memory_consumption() const {
   Fail("AdaptiveRadixTreeIndex::_memory_consumption() is not implemented yet");
 }
 
-AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _parts(sizeof(value)) {
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) {
   for (size_t byte_id = 1; byte_id <= _parts.size(); ++byte_id) {
     // grab the 8 least significant bits and put them at the front of the vector
     _parts[_parts.size() - byte_id] = static_cast<uint8_t>(value) & 0xFFu;
@@ -171,7 +198,7 @@ AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _par
 size_t AdaptiveRadixTreeIndex::BinaryComparable::size() const { return _parts.size(); }
 
 uint8_t AdaptiveRadixTreeIndex::BinaryComparable::operator[](size_t position) const {
-  Assert(position < _parts.size(), "BinaryComparable indexed out of bounds");
+  DebugAssert(position < _parts.size(), "BinaryComparable indexed out of bounds");
 
   return _parts[position];
 }
@@ -185,4 +212,12 @@ bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
   return true;
 }
 
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right) {
+  for (size_t i = 0; i < std::min(left.size(), right.size()); ++i) {
+    if (left[i] != right[i]) return left[i] < right[i];
+  }
+  return left.size() < right.size();
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -64,7 +65,8 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
     uint8_t operator[](size_t position) const;
 
    private:
-    std::vector<uint8_t> _parts;
+    // A fixed-size array, so that keys can be created for lookups without allocating memory
+    std::array<uint8_t, sizeof(ValueID)> _parts;
   };
 
  private:
@@ -76,10 +78,19 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
 
   Iterator _cend() const final;
 
+  // Sorts the ChunkOffsets by their keys into _chunk_offsets and builds the tree over them
   std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values);
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
-                                        size_t depth, Iterator& it);
+  /**
+   * Builds the (sub)tree of the runs [first_run, last_run) of equal keys in _chunk_offsets, which is sorted by key.
+   * keys[run] is the key of a run, which starts at _chunk_offsets[run_begins[run]] and ends at the start of the next
+   * run. Since the runs are sorted, the tree is built top-down without partitioning (or copying) any values: The
+   * children of a node are the ranges of runs that share the byte at the node's depth. Bytes that all runs of a node
+   * share are stored as its prefix instead of as nodes with a single child (path compression).
+   */
+  std::shared_ptr<ARTNode> _build_tree(const std::vector<BinaryComparable>& keys,
+                                       const std::vector<size_t>& run_begins, size_t first_run, size_t last_run,
+                                       size_t depth) const;
 
   std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
 
@@ -92,4 +103,8 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
 
 bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
                 const AdaptiveRadixTreeIndex::BinaryComparable& right);
+
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right);
+
 }  // namespace opossum
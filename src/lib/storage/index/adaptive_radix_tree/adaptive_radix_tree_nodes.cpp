@@ -1,6 +1,12 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
+#include <bit>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -15,6 +21,54 @@ namespace opossum {
 
 constexpr uint8_t INVALID_INDEX = 255u;
 
+namespace {
+
+/**
+ * Returns the position of the first partial key that is not less than partial_key, or size if there is none. As the
+ * partial keys of ARTNode4 and ARTNode16 are sorted, this is their lower bound. With SSE2, all partial keys are
+ * compared at once: max(partial_keys[i], partial_key) equals partial_keys[i] iff partial_keys[i] >= partial_key.
+ */
+template <size_t size>
+size_t find_first_not_less(const std::array<uint8_t, size>& partial_keys, const uint8_t partial_key) {
+  static_assert(size == 4 || size == 16, "Only the partial keys of ARTNode4 and ARTNode16 are searched");
+#ifdef __SSE2__
+  auto keys = __m128i{};
+  if constexpr (size == 16) {
+    keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(partial_keys.data()));
+  } else {
+    auto packed_keys = int32_t{};
+    std::memcpy(&packed_keys, partial_keys.data(), sizeof(packed_keys));
+    keys = _mm_cvtsi32_si128(packed_keys);
+  }
+  const auto search_keys = _mm_set1_epi8(static_cast<char>(partial_key));
+  const auto not_less = _mm_cmpeq_epi8(_mm_max_epu8(keys, search_keys), keys);
+  const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(not_less)) & ((uint32_t{1} << size) - 1);
+  return mask ? static_cast<size_t>(std::countr_zero(mask)) : size;
+#else
+  return static_cast<size_t>(
+      std::distance(partial_keys.begin(), std::lower_bound(partial_keys.begin(), partial_keys.end(), partial_key)));
+#endif
+}
+
+}  // namespace
+
+void ARTNode::set_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, const size_t depth,
+                         const size_t length) {
+  DebugAssert(length <= _prefix.size() && depth + length <= key.size(), "Prefix exceeds the key");
+  for (auto byte_id = size_t{0}; byte_id < length; ++byte_id) {
+    _prefix[byte_id] = key[depth + byte_id];
+  }
+  _prefix_length = static_cast<uint8_t>(length);
+}
+
+int ARTNode::_compare_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, const size_t depth) const {
+  for (auto byte_id = size_t{0}; byte_id < _prefix_length; ++byte_id) {
+    const auto key_byte = key[depth + byte_id];
+    if (key_byte != _prefix[byte_id]) return key_byte < _prefix[byte_id] ? -1 : 1;
+  }
+  return 0;
+}
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -61,14 +115,17 @@ ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& ch
 
 AbstractIndex::Iterator ARTNode4::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                                                      const std::function<Iterator(size_t, size_t)>& function) const {
-  auto partial_key = key[depth];
-  for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
-    if (_partial_keys[partial_key_id] < partial_key) continue;                                   // key not found yet
-    if (_partial_keys[partial_key_id] == partial_key) return function(partial_key_id, ++depth);  // case0
-    if (!_children[partial_key_id]) return end();  // no more keys available, case1b
-    return _children[partial_key_id]->begin();     // case2
-  }
-  return end();  // case1a
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+  depth += _prefix_length;
+
+  const auto partial_key = key[depth];
+  const auto partial_key_pos = find_first_not_less(_partial_keys, partial_key);
+  if (partial_key_pos == _partial_keys.size()) return end();                                   // case1a
+  if (!_children[partial_key_pos]) return end();                                               // case1b
+  if (_partial_keys[partial_key_pos] == partial_key) return function(partial_key_pos, ++depth);  // case0
+  return _children[partial_key_pos]->begin();                                                  // case2
 }
 
 AbstractIndex::Iterator ARTNode4::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -140,20 +197,25 @@ AbstractIndex::Iterator ARTNode16::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
     const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
         function) const {
-  auto partial_key = key[depth];
-  const auto* const partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  const auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+  depth += _prefix_length;
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, ++depth);  // case0
-  }
-  if (partial_key_pos >= 16) {
+  const auto partial_key = key[depth];
+  const auto partial_key_pos = static_cast<std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type>(
+      find_first_not_less(_partial_keys, partial_key));
+
+  if (partial_key_pos == 16) {
     return end();  // case 1a
   }
-  if (_children[partial_key_pos]) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (!_children[partial_key_pos]) {
+    return end();  // case1b
+  }
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 AbstractIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key,
@@ -244,6 +306,11 @@ ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNod
 
 AbstractIndex::Iterator ARTNode48::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                                                       const std::function<Iterator(uint8_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+  depth += _prefix_length;
+
   auto partial_key = key[depth];
   if (_index_to_child[partial_key] != INVALID_INDEX) {
     // case0
@@ -283,9 +350,9 @@ AbstractIndex::Iterator ARTNode48::begin() const {
 }
 
 AbstractIndex::Iterator ARTNode48::end() const {
-  for (uint8_t i = static_cast<uint8_t>(_index_to_child.size()) - 1; i > 0; --i) {
+  for (auto i = static_cast<int16_t>(_index_to_child.size()) - 1; i >= 0; --i) {
     if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+      return _children[_index_to_child[i]]->end();
     }
   }
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
@@ -329,6 +396,11 @@ ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTN
 AbstractIndex::Iterator ARTNode256::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key,
                                                        size_t depth,
                                                        const std::function<Iterator(uint8_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+  depth += _prefix_length;
+
   auto partial_key = key[depth];
   if (_children[partial_key]) {
     // case0
@@ -370,13 +442,13 @@ AbstractIndex::Iterator ARTNode256::begin() const {
 AbstractIndex::Iterator ARTNode256::end() const {
   for (int16_t i = static_cast<int16_t>(_children.size()) - 1; i >= 0; --i) {
     if (_children[i]) {
-      return _children[i]->begin();
+      return _children[i]->end();
     }
   }
   Fail("Empty _children array in ARTNode256 should never happen");
 }
 
-Leaf::Leaf(AbstractIndex::Iterator& lower, AbstractIndex::Iterator& upper) : _begin(lower), _end(upper) {}
+Leaf::Leaf(const AbstractIndex::Iterator& lower, const AbstractIndex::Iterator& upper) : _begin(lower), _end(upper) {}
 
 AbstractIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const {
   return _begin;
@@ -34,6 +34,21 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+  // Stores the length bytes of key starting at depth, which all keys below this node share, as the node's prefix
+  void set_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth, size_t length);
+
+ protected:
+  // Returns a negative value if the key is smaller than the prefix at depth, a positive one if it is larger, and 0 if
+  // the key continues with the prefix
+  int _compare_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const;
+
+  /**
+   * Path compression: instead of a chain of nodes with a single child each, the bytes that all keys below this node
+   * share are stored as its prefix and skipped during the search. The partial keys of the node follow after the prefix.
+   */
+  std::array<uint8_t, sizeof(ValueID)> _prefix{};
+  uint8_t _prefix_length{0};
 };
 
 /**
@@ -44,7 +59,8 @@ class ARTNode : private Noncopyable {
  *
  * _partial_key[i] is the partial_key for child _children[i]
  *
- * The default value of the _partial_keys array is 255u
+ * The default value of the _partial_keys array is 255u. The partial keys are searched with SIMD instructions if SSE2
+ * is available.
  */
 class ARTNode4 final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
@@ -77,8 +93,8 @@ class ARTNode4 final : public ARTNode {
  *
  * _partial_key[i] is the partial_key for child _children[i]
  *
- * The default value of the _partial_keys array is 255u
- *
+ * The default value of the _partial_keys array is 255u. The partial keys are searched with SIMD instructions if SSE2
+ * is available.
  */
 
 class ARTNode16 final : public ARTNode {
@@ -180,7 +196,7 @@ class Leaf final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
 
  public:
-  explicit Leaf(Iterator& lower, Iterator& upper);
+  Leaf(const Iterator& lower, const Iterator& upper);
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
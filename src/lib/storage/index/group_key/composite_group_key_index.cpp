@@ -14,6 +14,7 @@
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "utils/assert.hpp"
 #include "variable_length_key_proxy.hpp"
 
@@ -97,12 +98,15 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(
   }
 
   // create offsets to unique keys
-  _key_offsets.reserve(segment_size);
-  _key_offsets.emplace_back(0);
+  auto key_offsets = pmr_vector<uint32_t>{};
+  key_offsets.reserve(segment_size);
+  key_offsets.emplace_back(0);
   for (ChunkOffset chunk_offset = 1; chunk_offset < static_cast<ChunkOffset>(segment_size); ++chunk_offset) {
-    if (_keys[chunk_offset] != _keys[chunk_offset - 1]) _key_offsets.emplace_back(chunk_offset);
+    if (_keys[chunk_offset] != _keys[chunk_offset - 1]) key_offsets.emplace_back(chunk_offset);
   }
-  _key_offsets.shrink_to_fit();
+  _key_offsets = compress_vector(key_offsets, VectorCompressionType::FixedSizeByteAligned, {},
+                                 {static_cast<uint32_t>(segment_size)});
+  _key_offsets_decompressor = _key_offsets->create_base_decompressor();
 
   // remove duplicated keys
   auto unique_keys_end = std::unique(_keys.begin(), _keys.end());
@@ -163,14 +167,13 @@ AbstractIndex::Iterator CompositeGroupKeyIndex::_get_position_iterator_for_key(c
   auto key_it = std::lower_bound(_keys.cbegin(), _keys.cend(), key);
   if (key_it == _keys.cend()) return _position_list.cend();
 
-  // get the start position in the position-vector, ie the offset, by getting the offset_iterator for the key
+  // get the start position in the position-vector, ie the offset, by getting the offset for the key
   // (which is at the same position as the iterator for the key in the keystore)
-  auto offset_it = _key_offsets.cbegin();
-  std::advance(offset_it, std::distance(_keys.cbegin(), key_it));
+  const auto offset = _key_offsets_decompressor->get(std::distance(_keys.cbegin(), key_it));
 
   // get an iterator pointing to that start position
   auto position_it = _position_list.cbegin();
-  std::advance(position_it, *offset_it);
+  std::advance(position_it, offset);
 
   return position_it;
 }
@@ -186,7 +189,7 @@ std::vector<std::shared_ptr<const AbstractSegment>> CompositeGroupKeyIndex::_get
 
 size_t CompositeGroupKeyIndex::_memory_consumption() const {
   size_t byte_count = _keys.size() * _keys.key_size();
-  byte_count += _key_offsets.size() * sizeof(ChunkOffset);
+  byte_count += _key_offsets->data_size();
   byte_count += _position_list.size() * sizeof(ChunkOffset);
   return byte_count;
 }
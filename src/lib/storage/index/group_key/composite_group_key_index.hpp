@@ -6,6 +6,8 @@
 #include <vector>
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "types.hpp"
 #include "variable_length_key_store.hpp"
 
@@ -109,8 +111,10 @@ class CompositeGroupKeyIndex : public AbstractIndex {
   // contains concatenated value-ids
   VariableLengthKeyStore _keys;
 
-  // the start positions within _position_list for every key
-  std::vector<ChunkOffset> _key_offsets;
+  // the start positions within _position_list for every key, compressed to the smallest width that fits the number
+  // of positions
+  std::unique_ptr<const BaseCompressedVector> _key_offsets;
+  std::unique_ptr<BaseVectorDecompressor> _key_offsets_decompressor;
 
   // contains positions, ie ChunkOffsets, for the concatenated value-ids
   std::vector<ChunkOffset> _position_list;
@@ -1,17 +1,23 @@
 #include "group_key_index.hpp"
 
+#include <limits>
 #include <memory>
 #include <vector>
 
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/index/abstract_index.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 
 namespace opossum {
 
 size_t GroupKeyIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
                                                   uint32_t value_bytes) {
-  return row_count * sizeof(ChunkOffset) + distinct_count * sizeof(std::size_t);
+  // The start offsets are compressed to the smallest width that fits the row count (see constructor)
+  const auto offset_width = row_count <= std::numeric_limits<uint8_t>::max()    ? sizeof(uint8_t)
+                            : row_count <= std::numeric_limits<uint16_t>::max() ? sizeof(uint16_t)
+                                                                                : sizeof(uint32_t);
+  return row_count * sizeof(ChunkOffset) + (distinct_count + 1) * offset_width;
 }
 
 GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
@@ -32,7 +38,7 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSeg
   //    Therefore we have `unique_values_count` ValueIDs (NULL-value-id is not included)
   //    for which we want to count the occurrences.
   auto value_histogram =
-      std::vector<ChunkOffset>(_indexed_segment->unique_values_count() + 1u /*to mark the ending position */, 0u);
+      pmr_vector<uint32_t>(_indexed_segment->unique_values_count() + 1u /*to mark the ending position */, 0u);
 
   // 2) Count the occurrences of value-ids: Iterate once over the attribute vector (i.e. value ids)
   //    and count the occurrences of each value id at their respective position in the dictionary,
@@ -56,13 +62,13 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSeg
   _positions = std::vector<ChunkOffset>(non_null_count);
   _null_positions = std::vector<ChunkOffset>(null_count);
 
-  // 4) Create start offsets for the positions in _value_start_offsets
-  _value_start_offsets = std::move(value_histogram);
-  std::partial_sum(_value_start_offsets.begin(), _value_start_offsets.end(), _value_start_offsets.begin());
+  // 4) Create start offsets for the positions
+  auto value_start_offsets = std::move(value_histogram);
+  std::partial_sum(value_start_offsets.begin(), value_start_offsets.end(), value_start_offsets.begin());
 
   // 5) Create the positions
-  // 5a) Copy _value_start_offsets to use the copy as a write counter
-  auto value_write_offsets = std::vector<ChunkOffset>(_value_start_offsets);
+  // 5a) Copy value_start_offsets to use the copy as a write counter
+  auto value_write_offsets = value_start_offsets;
 
   // 5b) Iterate over the attribute vector to obtain the write-offsets and
   //     to finally insert the positions
@@ -85,6 +91,11 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSeg
       value_write_offsets[value_id]++;
     }
   });
+
+  // 6) Compress the start offsets, the largest of which is the number of non-NULL positions
+  _value_start_offsets = compress_vector(value_start_offsets, VectorCompressionType::FixedSizeByteAligned, {},
+                                         {static_cast<uint32_t>(non_null_count)});
+  _value_start_offsets_decompressor = _value_start_offsets->create_base_decompressor();
 }
 
 GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -120,7 +131,7 @@ GroupKeyIndex::Iterator GroupKeyIndex::_get_positions_iterator_at(ValueID value_
   }
 
   // get the start position in the position-vector, ie the offset, by looking up the index_offset at value_id
-  auto start_pos = _value_start_offsets[value_id];
+  auto start_pos = _value_start_offsets_decompressor->get(value_id);
 
   // get an iterator pointing to start_pos
   auto iter = _positions.cbegin();
@@ -134,8 +145,9 @@ std::vector<std::shared_ptr<const AbstractSegment>> GroupKeyIndex::_get_indexed_
 
 size_t GroupKeyIndex::_memory_consumption() const {
   size_t bytes = sizeof(_indexed_segment);
-  bytes += sizeof(std::vector<ChunkOffset>);  // _value_start_offsets
-  bytes += sizeof(ChunkOffset) * _value_start_offsets.capacity();
+  bytes += sizeof(_value_start_offsets);
+  bytes += _value_start_offsets->data_size();
+  bytes += sizeof(_value_start_offsets_decompressor);
   bytes += sizeof(std::vector<ChunkOffset>);  // _positions
   bytes += sizeof(ChunkOffset) * _positions.capacity();
   return bytes;
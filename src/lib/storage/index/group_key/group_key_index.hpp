@@ -6,6 +6,8 @@
 #include <vector>
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -48,6 +50,10 @@ class GroupKeyIndexTest;
  * x¹: Mark for the ending position.
  * x²: NULL positions are stored in `_null_positions` of the AbstractIndex
  *
+ * The offsets are stored as a FixedSizeByteAligned compressed vector with the smallest width that fits the number of
+ * positions, i.e., one or two bytes per distinct value for most chunks. The positions cannot be compressed as they are
+ * handed out as AbstractIndex::Iterators, which point into a vector of ChunkOffsets.
+ *
  * Find more information about this in our Wiki: https://github.com/hyrise/hyrise/wiki/GroupKey
  */
 class GroupKeyIndex : public AbstractIndex {
@@ -91,7 +97,8 @@ class GroupKeyIndex : public AbstractIndex {
 
  private:
   const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
-  std::vector<ChunkOffset> _value_start_offsets;  // maps value-ids to offsets in _positions
-  std::vector<ChunkOffset> _positions;            // non-NULL record positions in the attribute vector
+  std::unique_ptr<const BaseCompressedVector> _value_start_offsets;  // maps value-ids to offsets in _positions
+  std::unique_ptr<BaseVectorDecompressor> _value_start_offsets_decompressor;
+  std::vector<ChunkOffset> _positions;  // non-NULL record positions in the attribute vector
 };
 }  // namespace opossum
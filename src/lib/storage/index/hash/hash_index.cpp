@@ -0,0 +1,55 @@
+#include "hash_index.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/index/segment_index_type.hpp"
+
+namespace opossum {
+
+size_t HashIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                              uint32_t value_bytes) {
+  // Positions, distinct values with their start offsets, and at least two slots per distinct value
+  return row_count * sizeof(ChunkOffset) + distinct_count * (value_bytes + sizeof(ChunkOffset) + 2 * sizeof(uint32_t));
+}
+
+HashIndex::HashIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : AbstractIndex{get_index_type_of<HashIndex>()},
+      // Empty segment list is illegal but range check needed for accessing the first segment
+      _indexed_segment(segments_to_index.empty() ? nullptr : segments_to_index[0]) {
+  Assert(static_cast<bool>(_indexed_segment), "HashIndex requires segments_to_index not to be empty.");
+  Assert((segments_to_index.size() == 1), "HashIndex only works with a single segment.");
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto column_data_type) {
+    using ColumnDataType = typename decltype(column_data_type)::type;
+    _impl = std::make_shared<HashIndexImpl<ColumnDataType>>(_indexed_segment, _null_positions);
+  });
+}
+
+bool HashIndex::supports_range_queries() const { return false; }
+
+HashIndex::Iterator HashIndex::_lower_bound(const std::vector<AllTypeVariant>&) const {
+  Fail("HashIndex does not support range queries, use equal_range().");
+}
+
+HashIndex::Iterator HashIndex::_upper_bound(const std::vector<AllTypeVariant>&) const {
+  Fail("HashIndex does not support range queries, use equal_range().");
+}
+
+std::pair<HashIndex::Iterator, HashIndex::Iterator> HashIndex::_equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  Assert((values.size() == 1), "HashIndex expects exactly one input value");
+  // the caller is responsible for not passing a NULL value
+  Assert(!variant_is_null(values[0]), "Null was passed to equal_range().");
+
+  return _impl->equal_range(values[0]);
+}
+
+HashIndex::Iterator HashIndex::_cbegin() const { return _impl->cbegin(); }
+
+HashIndex::Iterator HashIndex::_cend() const { return _impl->cend(); }
+
+std::vector<std::shared_ptr<const AbstractSegment>> HashIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t HashIndex::_memory_consumption() const { return _impl->memory_consumption(); }
+
+}  // namespace opossum
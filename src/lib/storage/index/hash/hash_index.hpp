@@ -0,0 +1,47 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "hash_index_impl.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/index/abstract_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+/**
+ * The HashIndex works on a single segment of any encoding and only answers equality lookups, which are the hot path
+ * of OLTP workloads, e.g., primary key lookups. Its values are not ordered, so that it does not support lower_bound()
+ * and upper_bound() (see AbstractIndex::supports_range_queries()). In exchange, a lookup does not need a binary
+ * search, and the structure only consists of flat vectors (see HashIndexImpl).
+ */
+class HashIndex : public AbstractIndex {
+  friend HashIndexTest;
+
+ public:
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See AbstractIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  HashIndex() = delete;
+  explicit HashIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  bool supports_range_queries() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>&) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>&) const final;
+  std::pair<Iterator, Iterator> _equal_range(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  std::shared_ptr<const AbstractSegment> _indexed_segment;
+  std::shared_ptr<BaseHashIndexImpl> _impl;
+};
+
+}  // namespace opossum
@@ -0,0 +1,134 @@
+#include "hash_index_impl.hpp"
+
+#include <functional>
+
+#include "lossless_cast.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+BaseHashIndexImpl::Iterator BaseHashIndexImpl::cbegin() const { return _positions.cbegin(); }
+
+BaseHashIndexImpl::Iterator BaseHashIndexImpl::cend() const { return _positions.cend(); }
+
+template <typename DataType>
+HashIndexImpl<DataType>::HashIndexImpl(const std::shared_ptr<const AbstractSegment>& indexed_segment,
+                                       std::vector<ChunkOffset>& null_positions)
+    : _slots(16, EMPTY_SLOT), _slot_bits{4} {
+  // 1) Assign ids to the distinct values and count their occurrences. The ids of the non-NULL rows are kept so that
+  //    the segment is only decoded once.
+  auto row_value_ids = std::vector<std::pair<ChunkOffset, uint32_t>>{};
+  row_value_ids.reserve(indexed_segment->size());
+  auto value_counts = std::vector<ChunkOffset>{};
+
+  segment_iterate<DataType>(*indexed_segment, [&](const auto& position) {
+    if (position.is_null()) {
+      null_positions.emplace_back(position.chunk_offset());
+      return;
+    }
+
+    const auto value_id = _find_or_insert(position.value());
+    if (value_id == value_counts.size()) value_counts.emplace_back(0);
+    ++value_counts[value_id];
+    row_value_ids.emplace_back(position.chunk_offset(), value_id);
+  });
+
+  // 2) Turn the counts into start offsets and write the positions of each value to its range
+  _value_start_offsets.resize(value_counts.size() + 1);
+  for (auto value_id = size_t{0}; value_id < value_counts.size(); ++value_id) {
+    _value_start_offsets[value_id + 1] = _value_start_offsets[value_id] + value_counts[value_id];
+  }
+
+  auto value_write_offsets = std::vector<ChunkOffset>(_value_start_offsets.begin(), _value_start_offsets.end() - 1);
+  _positions.resize(row_value_ids.size());
+  for (const auto& [chunk_offset, value_id] : row_value_ids) {
+    _positions[value_write_offsets[value_id]++] = chunk_offset;
+  }
+
+  _values.shrink_to_fit();
+  null_positions.shrink_to_fit();
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::memory_consumption() const {
+  auto bytes = sizeof(*this);
+  bytes += _positions.capacity() * sizeof(ChunkOffset);
+  bytes += _values.capacity() * sizeof(DataType);
+  bytes += _value_start_offsets.capacity() * sizeof(ChunkOffset);
+  bytes += _slots.capacity() * sizeof(uint32_t);
+  if constexpr (std::is_same_v<DataType, pmr_string>) {
+    for (const auto& value : _values) {
+      bytes += string_heap_size(value);
+    }
+  }
+  return bytes;
+}
+
+template <typename DataType>
+std::pair<BaseHashIndexImpl::Iterator, BaseHashIndexImpl::Iterator> HashIndexImpl<DataType>::equal_range(
+    const AllTypeVariant& value) const {
+  // Values that cannot be represented by the indexed data type, e.g., 1.5 for an int column, have no matches
+  const auto typed_value = lossless_variant_cast<DataType>(value);
+  if (!typed_value) return {_positions.cend(), _positions.cend()};
+
+  return equal_range(*typed_value);
+}
+
+template <typename DataType>
+std::pair<BaseHashIndexImpl::Iterator, BaseHashIndexImpl::Iterator> HashIndexImpl<DataType>::equal_range(
+    const DataType& value) const {
+  const auto slot_mask = _slots.size() - 1;
+  for (auto slot = _slot_for(value);; slot = (slot + 1) & slot_mask) {
+    const auto value_id = _slots[slot];
+    if (value_id == EMPTY_SLOT) return {_positions.cend(), _positions.cend()};
+
+    if (_values[value_id] == value) {
+      return {_positions.cbegin() + _value_start_offsets[value_id],
+              _positions.cbegin() + _value_start_offsets[value_id + 1]};
+    }
+  }
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::_slot_for(const DataType& value) const {
+  // Fibonacci hashing spreads the hashes of consecutive integers (which std::hash returns unchanged) and keeps the
+  // high bits, which are the best mixed ones
+  const auto hash = static_cast<uint64_t>(std::hash<DataType>{}(value));
+  return static_cast<size_t>((hash * uint64_t{0x9E3779B97F4A7C15}) >> (64 - _slot_bits));
+}
+
+template <typename DataType>
+uint32_t HashIndexImpl<DataType>::_find_or_insert(const DataType& value) {
+  const auto slot_mask = _slots.size() - 1;
+  auto slot = _slot_for(value);
+  for (; _slots[slot] != EMPTY_SLOT; slot = (slot + 1) & slot_mask) {
+    if (_values[_slots[slot]] == value) return _slots[slot];
+  }
+
+  const auto value_id = static_cast<uint32_t>(_values.size());
+  _values.emplace_back(value);
+  _slots[slot] = value_id;
+
+  if (_values.size() * 2 > _slots.size()) _grow();
+  return value_id;
+}
+
+template <typename DataType>
+void HashIndexImpl<DataType>::_grow() {
+  ++_slot_bits;
+  Assert(_slot_bits < 33, "Too many distinct values for HashIndex");
+  _slots = std::vector<uint32_t>(size_t{1} << _slot_bits, EMPTY_SLOT);
+
+  const auto slot_mask = _slots.size() - 1;
+  for (auto value_id = uint32_t{0}; value_id < _values.size(); ++value_id) {
+    auto slot = _slot_for(_values[value_id]);
+    while (_slots[slot] != EMPTY_SLOT) slot = (slot + 1) & slot_mask;
+    _slots[slot] = value_id;
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/abstract_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+class BaseHashIndexImpl : public Noncopyable {
+  friend HashIndexTest;
+
+ public:
+  virtual ~BaseHashIndexImpl() = default;
+
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+  virtual size_t memory_consumption() const = 0;
+  virtual std::pair<Iterator, Iterator> equal_range(const AllTypeVariant& value) const = 0;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ protected:
+  // Non-NULL positions, grouped by value
+  std::vector<ChunkOffset> _positions;
+};
+
+/**
+ * Open-addressing hash table that maps each distinct value of the segment to the range of its positions. The table
+ * only stores ids of the distinct values, so that a slot takes four bytes, and is probed linearly. With a load factor
+ * of at most 0.5, point lookups hit very few (mostly one or two) adjacent slots. The positions of a value are stored
+ * contiguously, as in the GroupKeyIndex.
+ */
+template <typename DataType>
+class HashIndexImpl : public BaseHashIndexImpl {
+  friend HashIndexTest;
+
+ public:
+  HashIndexImpl(const std::shared_ptr<const AbstractSegment>& indexed_segment,
+                std::vector<ChunkOffset>& null_positions);
+
+  size_t memory_consumption() const override;
+
+  std::pair<Iterator, Iterator> equal_range(const AllTypeVariant& value) const override;
+  std::pair<Iterator, Iterator> equal_range(const DataType& value) const;
+
+ protected:
+  static constexpr auto EMPTY_SLOT = uint32_t{0xFFFFFFFF};
+
+  size_t _slot_for(const DataType& value) const;
+
+  // Inserts the value if it is not contained yet and returns its id
+  uint32_t _find_or_insert(const DataType& value);
+
+  void _grow();
+
+  std::vector<DataType> _values;                  // distinct values by id
+  std::vector<ChunkOffset> _value_start_offsets;  // maps value ids to offsets in _positions, plus the end offset
+  std::vector<uint32_t> _slots;                   // value ids or EMPTY_SLOT, the size is a power of two
+  uint8_t _slot_bits{0};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(HashIndexImpl);
+
+}  // namespace opossum
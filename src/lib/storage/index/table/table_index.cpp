@@ -0,0 +1,67 @@
+#include "table_index.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableIndex::TableIndex(const Table& table, const ColumnID column_id)
+    : _column_id{column_id}, _data_type{table.column_data_type(column_id)} {
+  Assert(table.type() == TableType::Data, "TableIndexes can only be created for data tables.");
+
+  resolve_data_type(_data_type, [&](const auto column_data_type) {
+    using ColumnDataType = typename decltype(column_data_type)::type;
+    _impl = std::make_unique<TableIndexImpl<ColumnDataType>>();
+  });
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto segment = chunk->get_segment(column_id);
+    _impl->insert(chunk_id, *segment, ChunkOffset{0}, segment->size());
+  }
+}
+
+ColumnID TableIndex::column_id() const { return _column_id; }
+
+DataType TableIndex::data_type() const { return _data_type; }
+
+void TableIndex::insert(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+                        const ChunkOffset end_chunk_offset) {
+  DebugAssert(begin_chunk_offset <= end_chunk_offset && end_chunk_offset <= segment.size(), "Invalid range.");
+  _impl->insert(chunk_id, segment, begin_chunk_offset, end_chunk_offset);
+}
+
+void TableIndex::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                        const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const {
+  Assert(supports(predicate_condition, value, value2), "Predicate not supported by TableIndex.");
+  _impl->lookup(predicate_condition, value, value2, matches);
+}
+
+size_t TableIndex::entry_count() const { return _impl->entry_count(); }
+
+size_t TableIndex::memory_consumption() const { return sizeof(TableIndex) + _impl->memory_consumption(); }
+
+bool TableIndex::supports(const PredicateCondition predicate_condition) {
+  return is_binary_numeric_predicate_condition(predicate_condition) ||
+         is_between_predicate_condition(predicate_condition);
+}
+
+bool TableIndex::supports(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                          const std::optional<AllTypeVariant>& value2) const {
+  if (!supports(predicate_condition)) return false;
+  if (predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals) {
+    return true;
+  }
+
+  // Comparisons with NULL have no matches, whatever the data type
+  const auto has_data_type = [&](const AllTypeVariant& variant) {
+    return variant_is_null(variant) || data_type_from_all_type_variant(variant) == _data_type;
+  };
+  return has_data_type(value) && (!value2 || has_data_type(*value2));
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "table_index_impl.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class Table;
+class TableIndexTest;
+
+/**
+ * In contrast to the indexes derived from AbstractIndex, which index a single (immutable) segment, a TableIndex
+ * indexes a column of all chunks of a table, including the mutable ones. It maps the values to RowIDs, so that a
+ * lookup does not need to probe one index per chunk and costs O(log n) instead of O(chunks).
+ *
+ * The index is maintained by the Table when rows or chunks are appended and by the Insert operator, which adds the rows
+ * it has written before the transaction commits.
+ * Entries are never removed: Whether the row of an entry is visible is decided by its MVCC data, like for rows found
+ * by scans. Thus, rows that are rolled back or deleted remain in the index, and operators that use it have to be
+ * followed by a Validate when MVCC is used. Entries of physically deleted chunks have to be skipped by the user, their
+ * valid rows have been re-inserted (and indexed) by the MvccDeletePlugin.
+ */
+class TableIndex : private Noncopyable {
+  friend TableIndexTest;
+
+ public:
+  // Indexes the rows of all chunks that currently exist in the table
+  TableIndex(const Table& table, const ColumnID column_id);
+
+  ColumnID column_id() const;
+
+  DataType data_type() const;
+
+  // Adds the rows in [begin_chunk_offset, end_chunk_offset) of the segment of the indexed column in the given chunk
+  void insert(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+              const ChunkOffset end_chunk_offset);
+
+  // Appends the RowIDs of all rows for which `<indexed value> <predicate_condition> value [AND value2]` holds to
+  // matches. The RowIDs are not sorted.
+  void lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+              const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const;
+
+  // Batched Equals lookup, e.g., for the probe rows of a join: For every (value, chunk offset) pair in `values` and
+  // every row whose indexed value equals the value, a (chunk offset, RowID) pair is appended to matches. In contrast
+  // to calling lookup() for each value, the values are visited in sorted order, which locks each partition once and
+  // accesses its B+-tree in key order. The values need to have the data type of the indexed column.
+  template <typename ColumnDataType>
+  void lookup_equals(std::vector<std::pair<ColumnDataType, ChunkOffset>> values,
+                     std::vector<std::pair<ChunkOffset, RowID>>& matches) const {
+    const auto* impl = dynamic_cast<const TableIndexImpl<ColumnDataType>*>(_impl.get());
+    Assert(impl, "Values do not have the data type of the indexed column.");
+    impl->lookup_equals(std::move(values), matches);
+  }
+
+  // Number of indexed (i.e., non-NULL) values
+  size_t entry_count() const;
+
+  size_t memory_consumption() const;
+
+  // Comparisons and BETWEEN predicates can be answered by a TableIndex, (NOT) LIKE, (NOT) IN, and IS (NOT) NULL not
+  static bool supports(const PredicateCondition predicate_condition);
+
+  // In addition, the entries are ordered by the values of the column's data type. Range lookups for values of other
+  // data types, e.g., 1.5 on an int column, are not supported.
+  bool supports(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                const std::optional<AllTypeVariant>& value2) const;
+
+ protected:
+  const ColumnID _column_id;
+  const DataType _data_type;
+  std::unique_ptr<BaseTableIndexImpl> _impl;
+};
+
+}  // namespace opossum
@@ -0,0 +1,224 @@
+#include "table_index_impl.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "lossless_cast.hpp"
+#include "storage/row_group_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+template <typename DataType>
+void TableIndexImpl<DataType>::insert(const ChunkID chunk_id, const AbstractSegment& segment,
+                                      const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  // Group the entries by partition first, so that each partition is locked only once
+  auto partition_entries = std::array<std::vector<std::pair<DataType, RowID>>, PARTITION_COUNT>{};
+  const auto add_entry = [&](const DataType& value, const ChunkOffset chunk_offset) {
+    partition_entries[_partition_for(value)].emplace_back(value, RowID{chunk_id, chunk_offset});
+  };
+
+  // Inserts only index the rows they have just written, so that the (mutable) ValueSegment is accessed directly
+  // instead of iterating over the entire segment for every insert
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<DataType>*>(&segment)) {
+    const auto& values = value_segment->values();
+    const auto is_nullable = value_segment->is_nullable();
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      if (is_nullable && value_segment->null_values()[chunk_offset]) continue;
+      add_entry(values[chunk_offset], chunk_offset);
+    }
+  } else if (const auto* row_group_segment = dynamic_cast<const RowGroupSegment<DataType>*>(&segment)) {
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      if (row_group_segment->is_null(chunk_offset)) continue;
+      add_entry(row_group_segment->value(chunk_offset), chunk_offset);
+    }
+  } else {
+    Assert(begin_chunk_offset == 0 && end_chunk_offset == segment.size(),
+           "Only mutable segments can be indexed partially.");
+    segment_iterate<DataType>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+      add_entry(position.value(), position.chunk_offset());
+    });
+  }
+
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    if (partition_entries[partition_id].empty()) continue;
+
+    auto& partition = _partitions[partition_id];
+    const auto lock = std::unique_lock{partition.mutex};
+    for (const auto& entry : partition_entries[partition_id]) {
+      partition.entries.insert(entry);
+    }
+  }
+}
+
+template <typename DataType>
+void TableIndexImpl<DataType>::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                      const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const {
+  // Comparisons with NULL are never true
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return;
+
+  // Values that cannot be represented by the indexed data type, e.g., 1.5 for an int column, equal no indexed value.
+  // Range lookups require the value to have the data type of the column (see TableIndex::supports()).
+  const auto typed_value = lossless_variant_cast<DataType>(value);
+  if (predicate_condition == PredicateCondition::Equals) {
+    if (!typed_value) return;
+
+    const auto& partition = _partitions[_partition_for(*typed_value)];
+    const auto lock = std::shared_lock{partition.mutex};
+    const auto [range_begin, range_end] = partition.entries.equal_range(*typed_value);
+    std::transform(range_begin, range_end, std::back_inserter(matches), [](const auto& entry) { return entry.second; });
+    return;
+  }
+
+  if (predicate_condition == PredicateCondition::NotEquals) {
+    if (!typed_value) {
+      _append_range(std::nullopt, true, std::nullopt, true, matches);
+      return;
+    }
+    _append_range(std::nullopt, true, typed_value, false, matches);
+    _append_range(typed_value, false, std::nullopt, true, matches);
+    return;
+  }
+
+  Assert(typed_value, "Value cannot be represented by the data type of the indexed column.");
+
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      _append_range(std::nullopt, true, typed_value, false, matches);
+      return;
+    case PredicateCondition::LessThanEquals:
+      _append_range(std::nullopt, true, typed_value, true, matches);
+      return;
+    case PredicateCondition::GreaterThan:
+      _append_range(typed_value, false, std::nullopt, true, matches);
+      return;
+    case PredicateCondition::GreaterThanEquals:
+      _append_range(typed_value, true, std::nullopt, true, matches);
+      return;
+    default:
+      break;
+  }
+
+  Assert(is_between_predicate_condition(predicate_condition), "Predicate condition not supported by TableIndex.");
+  Assert(value2, "Between predicates require a second value.");
+  const auto typed_value2 = lossless_variant_cast<DataType>(*value2);
+  Assert(typed_value2, "Value cannot be represented by the data type of the indexed column.");
+
+  _append_range(typed_value, is_lower_inclusive_between(predicate_condition), typed_value2,
+                is_upper_inclusive_between(predicate_condition), matches);
+}
+
+template <typename DataType>
+void TableIndexImpl<DataType>::lookup_equals(std::vector<std::pair<DataType, ChunkOffset>> values,
+                                             std::vector<std::pair<ChunkOffset, RowID>>& matches) const {
+  // Group the values by partition (like insert()) and sort them within each partition. Consecutive lookups then
+  // descend into neighbouring leaves of the B+-tree, whose inner nodes are still cached, and duplicate values are
+  // looked up only once.
+  static_assert(PARTITION_COUNT <= 256, "Partition ids do not fit into uint8_t.");
+  auto partition_ids = std::vector<uint8_t>(values.size());
+  auto partition_offsets = std::array<size_t, PARTITION_COUNT + 1>{};
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    partition_ids[value_index] = static_cast<uint8_t>(_partition_for(values[value_index].first));
+    ++partition_offsets[partition_ids[value_index] + 1];
+  }
+  std::partial_sum(partition_offsets.cbegin(), partition_offsets.cend(), partition_offsets.begin());
+
+  auto sorted_values = std::vector<std::pair<DataType, ChunkOffset>>(values.size());
+  auto write_offsets = partition_offsets;
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    sorted_values[write_offsets[partition_ids[value_index]]++] = std::move(values[value_index]);
+  }
+
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    const auto begin = sorted_values.begin() + partition_offsets[partition_id];
+    const auto end = sorted_values.begin() + partition_offsets[partition_id + 1];
+    if (begin == end) continue;
+    std::sort(begin, end);
+
+    const auto& partition = _partitions[partition_id];
+    const auto lock = std::shared_lock{partition.mutex};
+
+    // Matches of the previously looked up value
+    auto previous_matches_begin = matches.size();
+    for (auto value_it = begin; value_it != end; ++value_it) {
+      const auto previous_matches_end = matches.size();
+      if (value_it != begin && std::prev(value_it)->first == value_it->first) {
+        for (auto match_index = previous_matches_begin; match_index < previous_matches_end; ++match_index) {
+          const auto row_id = matches[match_index].second;
+          matches.emplace_back(value_it->second, row_id);
+        }
+      } else {
+        const auto [range_begin, range_end] = partition.entries.equal_range(value_it->first);
+        for (auto entry_it = range_begin; entry_it != range_end; ++entry_it) {
+          matches.emplace_back(value_it->second, entry_it->second);
+        }
+      }
+      previous_matches_begin = previous_matches_end;
+    }
+  }
+}
+
+template <typename DataType>
+size_t TableIndexImpl<DataType>::entry_count() const {
+  auto count = size_t{0};
+  for (const auto& partition : _partitions) {
+    const auto lock = std::shared_lock{partition.mutex};
+    count += partition.entries.size();
+  }
+  return count;
+}
+
+template <typename DataType>
+size_t TableIndexImpl<DataType>::memory_consumption() const {
+  auto bytes = sizeof(*this);
+  for (const auto& partition : _partitions) {
+    const auto lock = std::shared_lock{partition.mutex};
+    bytes += partition.entries.bytes_used();
+    if constexpr (std::is_same_v<DataType, pmr_string>) {
+      for (const auto& entry : partition.entries) {
+        bytes += string_heap_size(entry.first);
+      }
+    }
+  }
+  return bytes;
+}
+
+template <typename DataType>
+size_t TableIndexImpl<DataType>::_partition_for(const DataType& value) const {
+  // Fibonacci hashing spreads the hashes of consecutive integers (which std::hash returns unchanged), see HashIndexImpl
+  const auto hash = static_cast<uint64_t>(std::hash<DataType>{}(value));
+  return static_cast<size_t>((hash * uint64_t{0x9E3779B97F4A7C15}) >> (64 - PARTITION_BITS));
+}
+
+template <typename DataType>
+void TableIndexImpl<DataType>::_append_range(const std::optional<DataType>& lower, const bool lower_inclusive,
+                                             const std::optional<DataType>& upper, const bool upper_inclusive,
+                                             RowIDPosList& matches) const {
+  // Empty ranges would otherwise lead to begin iterators behind the end iterators
+  if (lower && upper && (*upper < *lower || (*upper == *lower && !(lower_inclusive && upper_inclusive)))) return;
+
+  for (const auto& partition : _partitions) {
+    const auto lock = std::shared_lock{partition.mutex};
+    const auto& entries = partition.entries;
+
+    auto range_begin = entries.begin();
+    if (lower) range_begin = lower_inclusive ? entries.lower_bound(*lower) : entries.upper_bound(*lower);
+
+    auto range_end = entries.end();
+    if (upper) range_end = upper_inclusive ? entries.upper_bound(*upper) : entries.lower_bound(*upper);
+
+    std::transform(range_begin, range_end, std::back_inserter(matches), [](const auto& entry) { return entry.second; });
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <array>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableIndexTest;
+
+class BaseTableIndexImpl : public Noncopyable {
+  friend TableIndexTest;
+
+ public:
+  virtual ~BaseTableIndexImpl() = default;
+
+  virtual void insert(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+                      const ChunkOffset end_chunk_offset) = 0;
+  virtual void lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                      const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const = 0;
+  virtual size_t entry_count() const = 0;
+  virtual size_t memory_consumption() const = 0;
+};
+
+/**
+ * Implementation: https://code.google.com/archive/p/cpp-btree/
+ *
+ * The entries are hash-partitioned by value. Each partition is a B+-tree with its own lock, so that inserts into
+ * different partitions do not block each other and readers only hold shared locks. Point lookups visit a single
+ * partition, range lookups visit all of them. NULL values are not indexed, as no predicate handled by the index
+ * matches them.
+ */
+template <typename DataType>
+class TableIndexImpl : public BaseTableIndexImpl {
+  friend TableIndexTest;
+
+ public:
+  static constexpr auto PARTITION_BITS = size_t{4};
+  static constexpr auto PARTITION_COUNT = size_t{1} << PARTITION_BITS;
+
+  void insert(const ChunkID chunk_id, const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+              const ChunkOffset end_chunk_offset) final;
+  void lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+              const std::optional<AllTypeVariant>& value2, RowIDPosList& matches) const final;
+  size_t entry_count() const final;
+  size_t memory_consumption() const final;
+
+  // See TableIndex::lookup_equals()
+  void lookup_equals(std::vector<std::pair<DataType, ChunkOffset>> values,
+                     std::vector<std::pair<ChunkOffset, RowID>>& matches) const;
+
+ protected:
+  struct Partition {
+    mutable std::shared_mutex mutex;
+    btree::btree_multimap<DataType, RowID> entries;
+  };
+
+  size_t _partition_for(const DataType& value) const;
+
+  // Appends the RowIDs of the entries in [lower, upper) of every partition. nullopt bounds are unbounded, the
+  // inclusivity of the bounds is given by the flags.
+  void _append_range(const std::optional<DataType>& lower, const bool lower_inclusive,
+                     const std::optional<DataType>& upper, const bool upper_inclusive, RowIDPosList& matches) const;
+
+  std::array<Partition, PARTITION_COUNT> _partitions;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(TableIndexImpl);
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <string>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
@@ -27,7 +28,8 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
       _block_size{block_size},
       _last_block_size{last_block_size},
       _compressed_size{compressed_size},
-      _num_elements{num_elements} {}
+      _num_elements{num_elements},
+      _block_cache_id{LZ4BlockCache::next_segment_id()} {}
 
 template <typename T>
 LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::optional<pmr_vector<bool>>&& null_values,
@@ -42,7 +44,8 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
       _block_size{block_size},
       _last_block_size{last_block_size},
       _compressed_size{compressed_size},
-      _num_elements{num_elements} {}
+      _num_elements{num_elements},
+      _block_cache_id{LZ4BlockCache::next_segment_id()} {}
 
 template <typename T>
 AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -212,6 +215,11 @@ void LZ4Segment<T>::_decompress_block(const size_t block_index, std::vector<T>&
 
 template <typename T>
 void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::vector<char>& decompressed_data) const {
+  auto& block_cache = Hyrise::get().lz4_block_cache;
+  if (block_cache.try_get(_block_cache_id, block_index, decompressed_data)) {
+    return;
+  }
+
   // Assure that the decompressed data fits into the vector.
   if (decompressed_data.size() != _block_size) {
     decompressed_data.resize(_block_size);
@@ -229,6 +237,8 @@ void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::ve
   if (block_index + 1 == _lz4_blocks.size()) {
     decompressed_data.resize(_last_block_size);
   }
+
+  block_cache.set(_block_cache_id, block_index, decompressed_data);
 }
 
 template <typename T>
@@ -179,6 +179,9 @@ class LZ4Segment : public AbstractEncodedSegment {
   const size_t _compressed_size;
   const size_t _num_elements;
 
+  // Identifies the decompressed blocks of this segment in the LZ4BlockCache
+  const uint64_t _block_cache_id;
+
   /**
    * Decompress a single block into the provided buffer (the vector). This method writes to the buffer with the given
    * offset, i.e., the buffer can be larger than a single block.
@@ -192,7 +195,8 @@ class LZ4Segment : public AbstractEncodedSegment {
 
   /**
    * Decompresses a single block into a char vector. This method resizes the input vector if the decompressed data
-   * would not fit into it. It is used for string-segments as well as non-string-segments.
+   * would not fit into it. It is used for string-segments as well as non-string-segments. As it serves the point
+   * accesses, it takes the block from the LZ4BlockCache if possible and adds newly decompressed blocks to it.
    * This allows a uniform interface in the decompress method for caching. For non-string-segments the decompressed
    * values have to be further cast to type T, while string-segments can use the char-vector directly.
    *
@@ -0,0 +1,108 @@
+#include "lz4_block_cache.hpp"
+
+#include <atomic>
+
+namespace opossum {
+
+LZ4BlockCache::LZ4BlockCache(const size_t capacity) : _capacity(capacity) {}
+
+LZ4BlockCache& LZ4BlockCache::operator=(LZ4BlockCache&& lz4_block_cache) noexcept {
+  const auto lock = std::scoped_lock{_mutex, lz4_block_cache._mutex};
+  _capacity = lz4_block_cache._capacity;
+  _size_in_bytes = lz4_block_cache._size_in_bytes;
+  _hit_count = lz4_block_cache._hit_count;
+  _miss_count = lz4_block_cache._miss_count;
+  _entries = std::move(lz4_block_cache._entries);
+  _entry_by_key = std::move(lz4_block_cache._entry_by_key);
+  return *this;
+}
+
+bool LZ4BlockCache::try_get(const uint64_t segment_id, const size_t block_index,
+                            std::vector<char>& decompressed_block) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto entry_it = _entry_by_key.find(Key{segment_id, block_index});
+  if (entry_it == _entry_by_key.end()) {
+    ++_miss_count;
+    return false;
+  }
+
+  ++_hit_count;
+  _entries.splice(_entries.begin(), _entries, entry_it->second);
+  decompressed_block = entry_it->second->decompressed_block;
+  return true;
+}
+
+void LZ4BlockCache::set(const uint64_t segment_id, const size_t block_index,
+                        const std::vector<char>& decompressed_block) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto block_size = decompressed_block.size();
+  if (block_size > _capacity) return;
+
+  const auto key = Key{segment_id, block_index};
+  if (_entry_by_key.contains(key)) {
+    // Another thread decompressed the same block concurrently
+    return;
+  }
+
+  _evict_until_fits(_capacity - block_size);
+  _entries.push_front(Entry{key, decompressed_block});
+  _entry_by_key.emplace(key, _entries.begin());
+  _size_in_bytes += block_size;
+}
+
+void LZ4BlockCache::resize(const size_t capacity) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _evict_until_fits(capacity);
+  _capacity = capacity;
+}
+
+void LZ4BlockCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+  _entry_by_key.clear();
+  _size_in_bytes = 0;
+  _hit_count = 0;
+  _miss_count = 0;
+}
+
+size_t LZ4BlockCache::capacity() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _capacity;
+}
+
+size_t LZ4BlockCache::size_in_bytes() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _size_in_bytes;
+}
+
+size_t LZ4BlockCache::block_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+size_t LZ4BlockCache::hit_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _hit_count;
+}
+
+size_t LZ4BlockCache::miss_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _miss_count;
+}
+
+uint64_t LZ4BlockCache::next_segment_id() {
+  // Not part of the cache state so that ids stay unique across Hyrise::reset()
+  static auto next_id = std::atomic<uint64_t>{0};
+  return next_id++;
+}
+
+void LZ4BlockCache::_evict_until_fits(const size_t capacity) {
+  while (_size_in_bytes > capacity) {
+    const auto& entry = _entries.back();
+    _size_in_bytes -= entry.decompressed_block.size();
+    _entry_by_key.erase(entry.key);
+    _entries.pop_back();
+  }
+}
+
+}  // namespace opossum
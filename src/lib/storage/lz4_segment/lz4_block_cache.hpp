@@ -0,0 +1,78 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Process-wide cache of decompressed LZ4 blocks, accessible via Hyrise::get().lz4_block_cache. Point accesses to an
+ * LZ4Segment (e.g., via get_typed_value or a position list) decompress a whole block to retrieve a single value.
+ * Without this cache, the same hot blocks of frequently point-accessed segments would be decompressed by every
+ * operator and every query again.
+ *
+ * Blocks are identified by a process-unique id of their segment (see LZ4Segment) and their index within that segment.
+ * As ids are never reused, blocks of deleted segments cannot be hit anymore and are eventually evicted. The cache is
+ * bounded by the number of decompressed bytes it holds and evicts the least recently used blocks first. A capacity of
+ * zero disables the cache.
+ */
+class LZ4BlockCache : public Noncopyable {
+ public:
+  static constexpr auto DEFAULT_CAPACITY = size_t{64} * 1024 * 1024;
+
+  explicit LZ4BlockCache(const size_t capacity = DEFAULT_CAPACITY);
+
+  // Copies the cached block into `decompressed_block` and returns true if the block is cached. Counts a hit or a miss.
+  bool try_get(const uint64_t segment_id, const size_t block_index, std::vector<char>& decompressed_block);
+
+  void set(const uint64_t segment_id, const size_t block_index, const std::vector<char>& decompressed_block);
+
+  // Sets the maximum number of bytes held by the cache and evicts blocks if needed
+  void resize(const size_t capacity);
+
+  // Removes all blocks and resets the hit and miss counters
+  void clear();
+
+  size_t capacity() const;
+  size_t size_in_bytes() const;
+  size_t block_count() const;
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+  // Returns a process-unique id for a newly created LZ4Segment
+  static uint64_t next_segment_id();
+
+ protected:
+  friend class Hyrise;
+  LZ4BlockCache& operator=(LZ4BlockCache&& lz4_block_cache) noexcept;
+
+ private:
+  using Key = std::pair<uint64_t, size_t>;
+
+  struct Entry {
+    Key key;
+    std::vector<char> decompressed_block;
+  };
+
+  void _evict_until_fits(const size_t capacity);
+
+  size_t _capacity;
+  size_t _size_in_bytes{0};
+  size_t _hit_count{0};
+  size_t _miss_count{0};
+
+  // Most recently used blocks are at the front
+  std::list<Entry> _entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, boost::hash<Key>> _entry_by_key;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,472 @@
+#include "materialized_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+std::shared_ptr<AggregateNode> find_aggregate_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto aggregate_nodes = std::vector<std::shared_ptr<AggregateNode>>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Aggregate) {
+      aggregate_nodes.emplace_back(std::static_pointer_cast<AggregateNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  return aggregate_nodes.size() == 1 ? aggregate_nodes.front() : nullptr;
+}
+
+bool contains_subquery(const std::shared_ptr<AbstractExpression>& expression) {
+  auto found = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::LQPSubquery) found = true;
+    return found ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return found;
+}
+
+std::shared_ptr<AbstractExpression> replaced_copy(const std::shared_ptr<AbstractExpression>& expression,
+                                                  const ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>&
+                                                      mapping) {
+  auto copied_expression = expression->deep_copy();
+  expression_deep_replace(copied_expression, mapping);
+  return copied_expression;
+}
+
+std::shared_ptr<const Table> execute_lqp(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                         const std::shared_ptr<TransactionContext>& transaction_context,
+                                         bool& failed) {
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  pqp->set_transaction_context_recursively(transaction_context);
+  const auto operator_tasks = OperatorTask::make_tasks_from_operator(pqp);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>(operator_tasks.cbegin(), operator_tasks.cend());
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto read_write_operator = std::dynamic_pointer_cast<AbstractReadWriteOperator>(pqp);
+  failed = read_write_operator && read_write_operator->execute_failed();
+  return pqp->get_output();
+}
+
+// The StaticTableNode needs a mutable table, which shares the segments of the given table
+std::shared_ptr<Table> shallow_copy(const Table& table) {
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    auto segments = Segments{};
+    const auto column_count = chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+  }
+  return std::make_shared<Table>(table.column_definitions(), table.type(), std::move(chunks));
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool MaterializedView::is_supported(const LQPView& view) {
+  const auto aggregate_node = find_aggregate_node(view.lqp);
+  if (!aggregate_node) return false;
+
+  // Only PredicateNodes and a ValidateNode between the AggregateNode and a complete StoredTableNode
+  auto node = aggregate_node->left_input();
+  while (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate) {
+    if (node->type == LQPNodeType::Predicate && contains_subquery(node->node_expressions.front())) return false;
+    node = node->left_input();
+  }
+  if (node->type != LQPNodeType::StoredTable) return false;
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+  if (!stored_table_node.pruned_chunk_ids().empty() || !stored_table_node.pruned_column_ids().empty()) return false;
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+
+  // The groups are compared in semi joins, which do not match NULL values
+  const auto& node_expressions = aggregate_node->node_expressions;
+  if (aggregate_node->aggregate_expressions_begin_idx == 0) return false;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_node->aggregate_expressions_begin_idx;
+       ++expression_idx) {
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(node_expressions[expression_idx]);
+    if (!column_expression || column_expression->original_node.lock() != node ||
+        table->column_is_nullable(column_expression->original_column_id)) {
+      return false;
+    }
+  }
+
+  for (auto expression_idx = aggregate_node->aggregate_expressions_begin_idx; expression_idx < node_expressions.size();
+       ++expression_idx) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(*node_expressions[expression_idx]);
+    switch (aggregate_expression.aggregate_function) {
+      case AggregateFunction::Sum:
+      case AggregateFunction::Count:
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        break;
+      default:
+        return false;
+    }
+    if (contains_subquery(aggregate_expression.argument())) return false;
+  }
+
+  return true;
+}
+
+MaterializedView::MaterializedView(const std::string& init_name, const std::shared_ptr<LQPView>& init_view)
+    : name(init_name), _view(init_view->deep_copy()), _partials_table_name(init_name + "__partials") {
+  Assert(is_supported(*_view), "View " + name + " cannot be materialized");
+
+  _aggregate_node = find_aggregate_node(_view->lqp);
+  auto node = _aggregate_node->left_input();
+  while (node->type != LQPNodeType::StoredTable) {
+    if (node->type == LQPNodeType::Predicate) _predicates.emplace_back(node->node_expressions.front());
+    node = node->left_input();
+  }
+  std::reverse(_predicates.begin(), _predicates.end());
+  _stored_table_node = std::static_pointer_cast<StoredTableNode>(node);
+
+  // Collect the partial aggregates without duplicates, e.g., for SUM(x) and COUNT(x)
+  const auto add_partial_aggregate = [&](const std::shared_ptr<AbstractExpression>& expression) {
+    for (auto partial_idx = size_t{0}; partial_idx < _partial_aggregates.size(); ++partial_idx) {
+      if (*_partial_aggregates[partial_idx] == *expression) {
+        return static_cast<ColumnID>(_aggregate_node->aggregate_expressions_begin_idx + partial_idx);
+      }
+    }
+    _partial_aggregates.emplace_back(expression);
+    return static_cast<ColumnID>(_aggregate_node->aggregate_expressions_begin_idx + _partial_aggregates.size() - 1);
+  };
+
+  add_partial_aggregate(count_star_(_stored_table_node));
+
+  const auto& node_expressions = _aggregate_node->node_expressions;
+  for (auto expression_idx = _aggregate_node->aggregate_expressions_begin_idx; expression_idx < node_expressions.size();
+       ++expression_idx) {
+    const auto& aggregate_expression = std::static_pointer_cast<AggregateExpression>(node_expressions[expression_idx]);
+    if (aggregate_expression->aggregate_function == AggregateFunction::Sum) {
+      const auto column_id = add_partial_aggregate(aggregate_expression);
+      const auto count_column_id = add_partial_aggregate(count_(aggregate_expression->argument()));
+      _partial_columns.emplace_back(PartialColumns{column_id, count_column_id});
+    } else {
+      _partial_columns.emplace_back(PartialColumns{add_partial_aggregate(aggregate_expression), std::nullopt});
+      _has_min_or_max |= aggregate_expression->aggregate_function != AggregateFunction::Count;
+    }
+  }
+}
+
+const std::string& MaterializedView::base_table_name() const { return _stored_table_node->table_name; }
+
+const std::string& MaterializedView::partials_table_name() const { return _partials_table_name; }
+
+const std::shared_ptr<AggregateNode>& MaterializedView::aggregate_node() const { return _aggregate_node; }
+
+std::shared_ptr<Table> MaterializedView::create_partials_table() const {
+  const auto base_table = Hyrise::get().storage_manager.get_table(base_table_name());
+  const auto stored_table_node = StoredTableNode::make(base_table_name());
+  const auto partials_lqp = _make_partials_lqp(stored_table_node, stored_table_node, nullptr, false);
+  const auto output_expressions = partials_lqp->output_expressions();
+
+  auto column_definitions = TableColumnDefinitions{};
+  const auto group_count = _aggregate_node->aggregate_expressions_begin_idx;
+  for (auto column_id = ColumnID{0}; column_id < output_expressions.size(); ++column_id) {
+    const auto data_type = output_expressions[column_id]->data_type();
+    if (column_id < group_count) {
+      const auto& column_expression = static_cast<const LQPColumnExpression&>(*output_expressions[column_id]);
+      column_definitions.emplace_back(base_table->column_name(column_expression.original_column_id), data_type, false);
+    } else if (column_id == group_count) {
+      column_definitions.emplace_back("__row_count", data_type, false);
+    } else {
+      column_definitions.emplace_back("__partial_" + std::to_string(column_id - group_count), data_type, true);
+    }
+  }
+
+  return std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+}
+
+void MaterializedView::populate() const {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto stored_table_node = StoredTableNode::make(base_table_name());
+  const auto insert_node = InsertNode::make(_partials_table_name);
+  insert_node->set_left_input(
+      _make_partials_lqp(ValidateNode::make(stored_table_node), stored_table_node, nullptr, false));
+
+  auto failed = false;
+  execute_lqp(insert_node, transaction_context, failed);
+  Assert(!failed, "Inserts do not fail");
+  transaction_context->commit();
+}
+
+std::shared_ptr<LQPView> MaterializedView::make_lqp_view() const {
+  const auto lqp_view = _view->deep_copy();
+  const auto root_node = LogicalPlanRootNode::make(lqp_view->lqp);
+  replace_with_partials(root_node, find_aggregate_node(root_node));
+
+  auto lqp = root_node->left_input();
+  root_node->set_left_input(nullptr);
+  return std::make_shared<LQPView>(lqp, lqp_view->column_names);
+}
+
+void MaterializedView::replace_with_partials(const std::shared_ptr<AbstractLQPNode>& root_node,
+                                             const std::shared_ptr<AbstractLQPNode>& node) const {
+  DebugAssert(*node == *_aggregate_node, "Node should equal the aggregate of the view");
+  const auto read_lqp = _make_read_lqp();
+
+  // The nodes above refer to the output expressions of the aggregate, which now are computed by the read LQP
+  auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  const auto output_expressions = node->output_expressions();
+  const auto read_expressions = read_lqp->output_expressions();
+  DebugAssert(output_expressions.size() == read_expressions.size(), "Read LQP should match the output");
+  for (auto column_id = ColumnID{0}; column_id < output_expressions.size(); ++column_id) {
+    expression_mapping.emplace(output_expressions[column_id], read_expressions[column_id]);
+  }
+
+  lqp_replace_node(node, read_lqp);
+
+  visit_lqp(root_node, [&](const auto& visited_node) {
+    if (visited_node == read_lqp) return LQPVisitation::DoNotVisitInputs;
+
+    for (auto& expression : visited_node->node_expressions) {
+      expression_deep_replace(expression, expression_mapping);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool MaterializedView::maintain_inserted_rows(const std::shared_ptr<const Table>& rows,
+                                              const std::shared_ptr<TransactionContext>& transaction_context) const {
+  if (rows->row_count() == 0) return true;
+  Assert(rows->column_count() == _stored_table_node->output_expressions().size(),
+         "Expected the columns of the base table");
+
+  const auto static_table_node = StaticTableNode::make(shallow_copy(*rows));
+  const auto insert_node = InsertNode::make(_partials_table_name);
+  insert_node->set_left_input(_make_partials_lqp(static_table_node, static_table_node, nullptr, false));
+
+  auto failed = false;
+  execute_lqp(insert_node, transaction_context, failed);
+  return !failed;
+}
+
+bool MaterializedView::maintain_deleted_rows(const std::shared_ptr<const Table>& rows,
+                                             const std::shared_ptr<TransactionContext>& transaction_context) const {
+  if (rows->row_count() == 0) return true;
+  Assert(rows->column_count() == _stored_table_node->output_expressions().size(),
+         "Expected the columns of the base table");
+
+  if (_has_min_or_max) return _recompute_groups(shallow_copy(*rows), transaction_context);
+
+  const auto static_table_node = StaticTableNode::make(shallow_copy(*rows));
+  const auto insert_node = InsertNode::make(_partials_table_name);
+  insert_node->set_left_input(_make_partials_lqp(static_table_node, static_table_node, nullptr, true));
+
+  auto failed = false;
+  execute_lqp(insert_node, transaction_context, failed);
+  return !failed;
+}
+
+bool MaterializedView::compact() const {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // (1) Merge the partials that are visible to the transaction into one row per group
+  auto failed = false;
+  const auto merged_partials = execute_lqp(_make_merged_partials_lqp(), transaction_context, failed);
+
+  // (2) Replace the partials by the merged ones
+  const auto delete_node = DeleteNode::make(ValidateNode::make(StoredTableNode::make(_partials_table_name)));
+  execute_lqp(delete_node, transaction_context, failed);
+  if (failed) {
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  const auto insert_node = InsertNode::make(_partials_table_name);
+  insert_node->set_left_input(StaticTableNode::make(shallow_copy(*merged_partials)));
+  execute_lqp(insert_node, transaction_context, failed);
+  transaction_context->commit();
+  return true;
+}
+
+std::shared_ptr<AbstractLQPNode> MaterializedView::_make_partials_lqp(
+    const std::shared_ptr<AbstractLQPNode>& input_node, const std::shared_ptr<AbstractLQPNode>& columns_node,
+    const std::shared_ptr<AbstractLQPNode>& keys_node, const bool negate) const {
+  // The columns of the view's StoredTableNode become the columns of the given node
+  auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  const auto column_expressions = columns_node->output_expressions();
+  for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+    expression_mapping.emplace(lqp_column_(_stored_table_node, column_id), column_expressions[column_id]);
+  }
+  expression_mapping.emplace(lqp_column_(_stored_table_node, INVALID_COLUMN_ID),
+                             lqp_column_(columns_node, INVALID_COLUMN_ID));
+
+  auto node = input_node;
+  for (const auto& predicate : _predicates) {
+    node = PredicateNode::make(replaced_copy(predicate, expression_mapping), node);
+  }
+
+  const auto group_count = _aggregate_node->aggregate_expressions_begin_idx;
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto expression_idx = size_t{0}; expression_idx < group_count; ++expression_idx) {
+    group_by_expressions.emplace_back(
+        replaced_copy(_aggregate_node->node_expressions[expression_idx], expression_mapping));
+  }
+
+  if (keys_node) {
+    const auto key_expressions = keys_node->output_expressions();
+    auto join_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (auto expression_idx = size_t{0}; expression_idx < group_count; ++expression_idx) {
+      join_predicates.emplace_back(equals_(group_by_expressions[expression_idx], key_expressions[expression_idx]));
+    }
+    node = JoinNode::make(JoinMode::Semi, join_predicates, node, keys_node);
+  }
+
+  auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& partial_aggregate : _partial_aggregates) {
+    aggregate_expressions.emplace_back(replaced_copy(partial_aggregate, expression_mapping));
+  }
+  const auto aggregate_node = AggregateNode::make(group_by_expressions, aggregate_expressions, node);
+  if (!negate) return aggregate_node;
+
+  DebugAssert(!_has_min_or_max, "MIN() and MAX() cannot be negated");
+  auto projection_expressions = aggregate_node->output_expressions();
+  for (auto column_id = group_count; column_id < projection_expressions.size(); ++column_id) {
+    projection_expressions[column_id] = unary_minus_(projection_expressions[column_id]);
+  }
+  return ProjectionNode::make(projection_expressions, aggregate_node);
+}
+
+std::shared_ptr<AbstractLQPNode> MaterializedView::_make_merged_partials_lqp() const {
+  const auto stored_table_node = StoredTableNode::make(_partials_table_name);
+  const auto group_count = _aggregate_node->aggregate_expressions_begin_idx;
+  const auto partial_expressions = stored_table_node->output_expressions();
+
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto merged_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_id = ColumnID{0}; column_id < partial_expressions.size(); ++column_id) {
+    if (column_id < group_count) {
+      group_by_expressions.emplace_back(partial_expressions[column_id]);
+      continue;
+    }
+
+    const auto& partial_aggregate = *_partial_aggregates[column_id - group_count];
+    switch (static_cast<const AggregateExpression&>(partial_aggregate).aggregate_function) {
+      case AggregateFunction::Min:
+        merged_expressions.emplace_back(min_(partial_expressions[column_id]));
+        break;
+      case AggregateFunction::Max:
+        merged_expressions.emplace_back(max_(partial_expressions[column_id]));
+        break;
+      default:
+        merged_expressions.emplace_back(sum_(partial_expressions[column_id]));
+    }
+  }
+
+  // Groups whose rows were all deleted only have partials with a total COUNT(*) of zero
+  return PredicateNode::make(greater_than_(merged_expressions.front(), 0),
+                             AggregateNode::make(group_by_expressions, merged_expressions,
+                                                 ValidateNode::make(stored_table_node)));
+}
+
+std::shared_ptr<AbstractLQPNode> MaterializedView::_make_read_lqp() const {
+  const auto merged_partials_node = _make_merged_partials_lqp();
+  const auto merged_expressions = merged_partials_node->output_expressions();
+  const auto group_count = _aggregate_node->aggregate_expressions_begin_idx;
+
+  auto projection_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      merged_expressions.cbegin(), merged_expressions.cbegin() + static_cast<std::ptrdiff_t>(group_count)};
+  for (const auto& partial_columns : _partial_columns) {
+    if (partial_columns.count_column_id) {
+      // SUM() is NULL if the group has no values
+      projection_expressions.emplace_back(case_(greater_than_(merged_expressions[*partial_columns.count_column_id], 0),
+                                                merged_expressions[partial_columns.column_id], null_()));
+    } else {
+      projection_expressions.emplace_back(merged_expressions[partial_columns.column_id]);
+    }
+  }
+
+  return ProjectionNode::make(projection_expressions, merged_partials_node);
+}
+
+bool MaterializedView::_recompute_groups(const std::shared_ptr<Table>& deleted_rows,
+                                         const std::shared_ptr<TransactionContext>& transaction_context) const {
+  const auto static_table_node = StaticTableNode::make(deleted_rows);
+  const auto make_keys_lqp = [&]() {
+    // The groups of the deleted rows that pass the predicates of the view
+    auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+    const auto column_expressions = static_table_node->output_expressions();
+    for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+      expression_mapping.emplace(lqp_column_(_stored_table_node, column_id), column_expressions[column_id]);
+    }
+
+    auto node = std::shared_ptr<AbstractLQPNode>{static_table_node};
+    for (const auto& predicate : _predicates) {
+      node = PredicateNode::make(replaced_copy(predicate, expression_mapping), node);
+    }
+
+    auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (auto expression_idx = size_t{0}; expression_idx < _aggregate_node->aggregate_expressions_begin_idx;
+         ++expression_idx) {
+      group_by_expressions.emplace_back(
+          replaced_copy(_aggregate_node->node_expressions[expression_idx], expression_mapping));
+    }
+    return AggregateNode::make(group_by_expressions, std::vector<std::shared_ptr<AbstractExpression>>{}, node);
+  };
+
+  // (1) Delete the partials of the groups. This conflicts with concurrent transactions that recompute or compact them.
+  const auto partials_node = StoredTableNode::make(_partials_table_name);
+  const auto keys_node = make_keys_lqp();
+  const auto partial_expressions = partials_node->output_expressions();
+  const auto key_expressions = keys_node->output_expressions();
+  auto join_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_id = ColumnID{0}; column_id < key_expressions.size(); ++column_id) {
+    join_predicates.emplace_back(equals_(partial_expressions[column_id], key_expressions[column_id]));
+  }
+  const auto delete_node = DeleteNode::make(
+      JoinNode::make(JoinMode::Semi, join_predicates, ValidateNode::make(partials_node), keys_node));
+
+  auto failed = false;
+  execute_lqp(delete_node, transaction_context, failed);
+  if (failed) return false;
+
+  // (2) Compute the partials of the groups from the rows that remain visible to the transaction. The rows that it
+  //     deletes are locked by now and thus invisible to it.
+  const auto base_table_node = StoredTableNode::make(base_table_name());
+  const auto insert_node = InsertNode::make(_partials_table_name);
+  insert_node->set_left_input(
+      _make_partials_lqp(ValidateNode::make(base_table_node), base_table_node, make_keys_lqp(), false));
+  execute_lqp(insert_node, transaction_context, failed);
+  return !failed;
+}
+
+}  // namespace opossum
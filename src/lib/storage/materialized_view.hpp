@@ -0,0 +1,131 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "lqp_view.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AbstractLQPNode;
+class AggregateNode;
+class StoredTableNode;
+class Table;
+class TransactionContext;
+
+/**
+ * A view whose aggregate is stored in a table and maintained incrementally, e.g., for dashboards that repeatedly
+ * aggregate the same rows. The AggregateNode of the view's LQP has to group by non-nullable columns of a stored table
+ * and may only compute SUM(), COUNT(), COUNT(*), MIN(), and MAX(). Between the AggregateNode and the StoredTableNode,
+ * there may only be PredicateNodes and a ValidateNode.
+ *
+ * Instead of the aggregates, the view stores partial aggregates in the partials table: one row per group and
+ * modification, with the SUM() and the COUNT() of the argument for each SUM(), the COUNT() for each COUNT(), and the
+ * MIN() or MAX() for each MIN() and MAX(). The COUNT(*) of each partial is stored, too. When rows are inserted into the
+ * base table, the Insert operator adds the partials of these rows within the same transaction (see
+ * maintain_inserted_rows()). The Delete operator adds partials with negated SUM()s and COUNT()s for the deleted rows.
+ * As MIN() and MAX() cannot be maintained that way, the partials of the groups with deleted rows are recomputed from
+ * the base table for views that use them. Updates are deletes followed by inserts. Thus, the partials that are visible
+ * to a transaction always add up to the aggregate of the base table as of the snapshot of the transaction:
+ *
+ *   SELECT k, SUM(sum_x) CASE WHEN SUM(count_x) > 0, ... FROM partials GROUP BY k HAVING SUM(count_star) > 0
+ *
+ * Partials are only appended, so that concurrent transactions do not conflict unless they recompute the same groups.
+ * compact() merges the partials of each group.
+ *
+ * The view is registered as an LQPView that reads the partials (see StorageManager::add_materialized_view()). Also, the
+ * MaterializedViewRewriteRule replaces subplans that are equal to the aggregate of a view. As hsql does not parse
+ * CREATE MATERIALIZED VIEW, materialized views are created from the LQPView of a CREATE VIEW statement. Creating a
+ * materialized view while its base table is modified is not supported.
+ */
+class MaterializedView : private Noncopyable {
+ public:
+  static bool is_supported(const LQPView& view);
+
+  MaterializedView(const std::string& init_name, const std::shared_ptr<LQPView>& init_view);
+
+  const std::string name;
+
+  const std::string& base_table_name() const;
+  const std::string& partials_table_name() const;
+
+  // The aggregate of the view with its inputs, which subplans are compared to
+  const std::shared_ptr<AggregateNode>& aggregate_node() const;
+
+  // Creates the empty partials table to be added to the StorageManager
+  std::shared_ptr<Table> create_partials_table() const;
+
+  // Computes the partials of the rows of the base table in a transaction of its own
+  void populate() const;
+
+  // Returns the registered view, whose aggregate reads the partials
+  std::shared_ptr<LQPView> make_lqp_view() const;
+
+  /**
+   * Replaces @param node, whose subplan equals aggregate_node(), by a subplan that reads the partials and outputs the
+   * same columns. The expressions of the nodes in the plan of @param root_node that refer to the output of the
+   * replaced node are adapted.
+   */
+  void replace_with_partials(const std::shared_ptr<AbstractLQPNode>& root_node,
+                             const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  /**
+   * Add the partials for rows that are inserted into or deleted from the base table by the transaction. The rows
+   * need to have the columns of the base table. Return false if the partials conflict with another transaction.
+   * @{
+   */
+  bool maintain_inserted_rows(const std::shared_ptr<const Table>& rows,
+                              const std::shared_ptr<TransactionContext>& transaction_context) const;
+  bool maintain_deleted_rows(const std::shared_ptr<const Table>& rows,
+                             const std::shared_ptr<TransactionContext>& transaction_context) const;
+  /** @} */
+
+  // Merges the partials of each group in a transaction of its own. Returns false if it conflicted.
+  bool compact() const;
+
+ protected:
+  // Builds the LQP that computes the partials of the rows emitted by @param input_node. The columns of
+  // @param columns_node correspond to the columns of the base table. If @param keys_node is set, only the groups
+  // that it contains are computed. If @param negate is set, SUM()s and COUNT()s are negated.
+  std::shared_ptr<AbstractLQPNode> _make_partials_lqp(const std::shared_ptr<AbstractLQPNode>& input_node,
+                                                      const std::shared_ptr<AbstractLQPNode>& columns_node,
+                                                      const std::shared_ptr<AbstractLQPNode>& keys_node,
+                                                      const bool negate) const;
+
+  // Builds the LQP that merges the visible partials into one row per group, with the columns of the partials table
+  std::shared_ptr<AbstractLQPNode> _make_merged_partials_lqp() const;
+
+  // Builds the LQP that computes the aggregates of the view from the merged partials
+  std::shared_ptr<AbstractLQPNode> _make_read_lqp() const;
+
+  // Recomputes the partials of the groups of the deleted rows
+  bool _recompute_groups(const std::shared_ptr<Table>& deleted_rows,
+                         const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  std::shared_ptr<LQPView> _view;
+  std::shared_ptr<AggregateNode> _aggregate_node;
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::string _partials_table_name;
+
+  // The predicates between the AggregateNode and the StoredTableNode, from the bottom up
+  std::vector<std::shared_ptr<AbstractExpression>> _predicates;
+
+  // The partial aggregates in terms of the columns of _stored_table_node. The first one is COUNT(*).
+  std::vector<std::shared_ptr<AbstractExpression>> _partial_aggregates;
+
+  // For each aggregate of the view, the column of its partial in the partials table and, for SUM(), the column of the
+  // COUNT() of the argument.
+  struct PartialColumns {
+    ColumnID column_id;
+    std::optional<ColumnID> count_column_id;
+  };
+  std::vector<PartialColumns> _partial_columns;
+
+  bool _has_min_or_max{false};
+};
+
+}  // namespace opossum
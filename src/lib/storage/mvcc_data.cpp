@@ -1,5 +1,9 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -13,7 +17,44 @@ MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
   std::atomic_thread_fence(std::memory_order_seq_cst);
 }
 
+std::shared_ptr<MvccData> MvccData::create_compacted(const size_t size, const CommitID max_begin_cid) {
+  DebugAssert(size > 0, "No point in having empty MVCC data, as it cannot grow");
+
+  // The default constructor is private, hence no make_shared
+  auto mvcc_data = std::shared_ptr<MvccData>(new MvccData());
+  mvcc_data->max_begin_cid = max_begin_cid;
+  mvcc_data->_is_compacted = true;
+  mvcc_data->_compacted_size = size;
+  return mvcc_data;
+}
+
+bool MvccData::is_compacted() const { return _is_compacted; }
+
+ChunkOffset MvccData::capacity() const {
+  return static_cast<ChunkOffset>(_is_compacted ? _compacted_size : _begin_cids.size());
+}
+
+std::shared_ptr<MvccData> MvccData::successor() const {
+  if (!_has_successor) return nullptr;
+  return std::atomic_load(&_successor);
+}
+
+std::shared_ptr<MvccData> MvccData::_try_set_successor(const std::shared_ptr<MvccData>& successor) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_write_mutex};
+  if (!_has_successor) {
+    std::atomic_store(&_successor, successor);
+    _has_successor = true;
+  }
+  return std::atomic_load(&_successor);
+}
+
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
+  if (mvcc_data._is_compacted) {
+    stream << "Compacted: " << mvcc_data._compacted_size << " rows, visible since BeginCID "
+           << *mvcc_data.max_begin_cid << std::endl;
+    return stream;
+  }
+
   stream << "TIDs: ";
   for (const auto& tid : mvcc_data._tids) stream << tid.load() << ", ";
   stream << std::endl;
@@ -30,32 +71,38 @@ std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
 }
 
 CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
+  if (_is_compacted) return *max_begin_cid;
   DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   return _begin_cids[offset];
 }
 
 void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID commit_id) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
   DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _begin_cids[offset] = commit_id;
 }
 
 CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
+  if (_is_compacted) return MAX_COMMIT_ID;
   DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   return _end_cids[offset];
 }
 
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
   DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _end_cids[offset] = commit_id;
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
+  if (_is_compacted) return INVALID_TRANSACTION_ID;
   DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   return _tids[offset];
 }
 
 void MvccData::set_tid(const ChunkOffset offset, const TransactionID new_transaction_id,
                        const std::memory_order memory_order) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
   DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
 
   _tids[offset].store(new_transaction_id, memory_order);
@@ -63,11 +110,54 @@ void MvccData::set_tid(const ChunkOffset offset, const TransactionID new_transac
 
 bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                                     TransactionID new_transaction_id) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
   DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
 
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+void MvccData::set_begin_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                              const CommitID commit_id) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
+  DebugAssert(begin_offset <= end_offset && end_offset <= _begin_cids.size(),
+              "offset out of bounds; MvccData insufficently preallocated?");
+  std::fill(_begin_cids.begin() + begin_offset, _begin_cids.begin() + end_offset, commit_id);
+}
+
+void MvccData::set_end_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const CommitID commit_id) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
+  DebugAssert(begin_offset <= end_offset && end_offset <= _end_cids.size(),
+              "offset out of bounds; MvccData insufficently preallocated?");
+  std::fill(_end_cids.begin() + begin_offset, _end_cids.begin() + end_offset, commit_id);
+}
+
+void MvccData::set_tids(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                        const TransactionID transaction_id, const std::memory_order memory_order) {
+  DebugAssert(!_is_compacted, "Compacted MVCC data cannot be modified, use Chunk::writable_mvcc_data");
+  DebugAssert(begin_offset <= end_offset && end_offset <= _tids.size(),
+              "offset out of bounds; MvccData insufficently preallocated?");
+  for (auto offset = begin_offset; offset < end_offset; ++offset) {
+    _tids[offset].store(transaction_id, memory_order);
+  }
+}
+
+const CommitID* MvccData::begin_cids() const {
+  DebugAssert(!_is_compacted, "Compacted MVCC data has no vectors");
+  return _begin_cids.data();
+}
+
+const CommitID* MvccData::end_cids() const {
+  DebugAssert(!_is_compacted, "Compacted MVCC data has no vectors");
+  return _end_cids.data();
+}
+
+const TransactionID* MvccData::tids() const {
+  DebugAssert(!_is_compacted, "Compacted MVCC data has no vectors");
+  // Loads of up to eight bytes are atomic on x64 anyway, so the vectorized code may read the atomics as plain values
+  static_assert(sizeof(decltype(_tids)::value_type) == sizeof(TransactionID), "copyable_atomic must not add padding");
+  return reinterpret_cast<const TransactionID*>(_tids.data());
+}
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
 #include "types.hpp"
@@ -10,6 +11,15 @@ namespace opossum {
 
 /**
  * Stores visibility information for multiversion concurrency control.
+ *
+ * Once all rows of an immutable chunk have been committed before the lowest active snapshot and none of them is
+ * deleted or locked, the per-row vectors hold no information anymore. Chunk::try_compact_mvcc_data then replaces the
+ * MVCC data with compacted MVCC data, which does not store any vectors and reports every row as visible since
+ * max_begin_cid. Writers that want to lock rows of a compacted chunk expand it again (see Chunk::writable_mvcc_data).
+ *
+ * Chunks derived from a stored chunk (e.g., by GetTable with pruned columns) share its MvccData object. Therefore,
+ * compacting and expanding do not modify MVCC data in place. Instead, the newer version is linked as the successor of
+ * the replaced one, and every chunk that still holds the replaced version follows the link.
  */
 struct MvccData {
   friend class Chunk;
@@ -27,6 +37,17 @@ struct MvccData {
   // here are ignored. This is to avoid resizing the vectors, which would cause reallocations and require locking.
   explicit MvccData(const size_t size, CommitID begin_commit_id);
 
+  // Creates compacted MVCC data for `size` rows that are visible to all snapshots from `max_begin_cid` on
+  static std::shared_ptr<MvccData> create_compacted(const size_t size, const CommitID max_begin_cid);
+
+  bool is_compacted() const;
+
+  // Returns the number of rows that the MVCC data was created for, i.e., the maximum size of a mutable chunk
+  ChunkOffset capacity() const;
+
+  // The newer version that replaced this MVCC data when it was compacted or expanded, if any
+  std::shared_ptr<MvccData> successor() const;
+
   /**
    * The thread sanitizer (tsan) complains about concurrent writes and reads to begin/end_cids. That is because it is
    * unaware of their thread-safety being guaranteed by the update of the global last_cid. Furthermore, we exploit that
@@ -45,13 +66,48 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  /**
+   * Range versions of the setters above for batch operations (e.g., Insert and Delete), which apply to the rows in
+   * [begin_offset, end_offset). They do not give any additional guarantees about the order in which the rows are
+   * written.
+   */
+  void set_begin_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const CommitID commit_id);
+  void set_end_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const CommitID commit_id);
+  void set_tids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const TransactionID transaction_id,
+                const std::memory_order memory_order = std::memory_order_seq_cst);
+
+  /**
+   * Raw access to the vectors for vectorized visibility checks (see Validate). The same considerations as for the
+   * helper methods above apply. Not available for compacted MVCC data.
+   */
+  const CommitID* begin_cids() const;
+  const CommitID* end_cids() const;
+  const TransactionID* tids() const;
+
   size_t memory_usage() const;
 
  private:
+  MvccData() = default;
+
+  // Links the successor unless there already is one. Returns the successor.
+  std::shared_ptr<MvccData> _try_set_successor(const std::shared_ptr<MvccData>& successor);
+
   // These vectors are pre-allocated. Do not resize them as someone might be reading them concurrently.
   pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
   pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+
+  // Compacted MVCC data stores the number of rows instead of the vectors
+  bool _is_compacted{false};
+  size_t _compacted_size{0};
+
+  // Checked before loading the successor, which is set at most once
+  std::atomic<bool> _has_successor{false};
+  std::shared_ptr<MvccData> _successor;
+
+  // Writers hold a shared lock while locking rows, the compaction holds an exclusive lock while checking that no row
+  // is locked (see Chunk::writable_mvcc_data and Chunk::try_compact_mvcc_data)
+  mutable std::shared_mutex _write_mutex;
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
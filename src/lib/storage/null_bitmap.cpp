@@ -0,0 +1,104 @@
+#include "null_bitmap.hpp"
+
+#include <algorithm>
+#include <ostream>
+
+namespace opossum {
+
+NullBitmap::NullBitmap(const allocator_type& allocator) : _words(allocator) {}
+
+NullBitmap::NullBitmap(const size_t size, const allocator_type& allocator) : NullBitmap(size, false, allocator) {}
+
+NullBitmap::NullBitmap(const size_t size, const bool value, const allocator_type& allocator)
+    : _words(_word_count(size), value ? ~Word{0} : Word{0}, allocator), _size(size) {
+  _clear_padding();
+}
+
+NullBitmap::NullBitmap(std::initializer_list<bool> values, const allocator_type& allocator)
+    : NullBitmap(values.begin(), values.end(), allocator) {}
+
+NullBitmap::NullBitmap(const NullBitmap& other, const allocator_type& allocator)
+    : _words(other._words, allocator), _size(other._size) {}
+
+void NullBitmap::resize(const size_t size, const bool value) {
+  if (size > _size && value) {
+    // Set the bits in the current last word, the new words are filled below
+    const auto old_size = _size;
+    _words.resize(_word_count(size), ~Word{0});
+    if (old_size % BITS_PER_WORD != 0) _words[old_size / BITS_PER_WORD] |= ~Word{0} << (old_size % BITS_PER_WORD);
+  } else {
+    _words.resize(_word_count(size), Word{0});
+  }
+  _size = size;
+  _clear_padding();
+}
+
+void NullBitmap::reserve(const size_t size) { _words.reserve(_word_count(size)); }
+
+void NullBitmap::clear() {
+  _words.clear();
+  _size = 0;
+}
+
+NullBitmap& NullBitmap::operator|=(const NullBitmap& other) {
+  DebugAssert(_size == other._size, "NullBitmaps must have the same size");
+  const auto word_count = _words.size();
+  auto* const words = _words.data();
+  const auto* const other_words = other._words.data();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    words[word_id] |= other_words[word_id];
+  }
+  return *this;
+}
+
+NullBitmap& NullBitmap::operator&=(const NullBitmap& other) {
+  DebugAssert(_size == other._size, "NullBitmaps must have the same size");
+  const auto word_count = _words.size();
+  auto* const words = _words.data();
+  const auto* const other_words = other._words.data();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    words[word_id] &= other_words[word_id];
+  }
+  return *this;
+}
+
+size_t NullBitmap::count() const {
+  auto count = size_t{0};
+  for (const auto word : _words) {
+    count += static_cast<size_t>(std::popcount(word));
+  }
+  return count;
+}
+
+bool NullBitmap::any() const {
+  return std::any_of(_words.cbegin(), _words.cend(), [](const auto word) { return word != 0; });
+}
+
+void NullBitmap::set_range(const size_t offset, const NullBitmap& source, const size_t source_offset,
+                           const size_t length) {
+  DebugAssert(offset + length <= _size && source_offset + length <= source._size, "NullBitmap range out of bounds");
+
+  // Setting only the NULLs of the source visits each of its words once, while the few NULLs are written bit by bit
+  const auto source_end = source_offset + length;
+  for (auto source_index = source.find_next(source_offset); source_index < source_end;
+       source_index = source.find_next(source_index + 1)) {
+    const auto index = offset + (source_index - source_offset);
+    _words[index / BITS_PER_WORD] |= Word{1} << (index % BITS_PER_WORD);
+  }
+}
+
+void NullBitmap::_clear_padding() {
+  if (_size % BITS_PER_WORD != 0) _words.back() &= ~(~Word{0} << (_size % BITS_PER_WORD));
+}
+
+std::ostream& operator<<(std::ostream& stream, const NullBitmap& null_bitmap) {
+  stream << "[";
+  for (auto index = size_t{0}; index < null_bitmap.size(); ++index) {
+    if (index > 0) stream << ", ";
+    stream << null_bitmap[index];
+  }
+  stream << "]";
+  return stream;
+}
+
+}  // namespace opossum
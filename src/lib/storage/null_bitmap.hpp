@@ -0,0 +1,199 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iosfwd>
+#include <iterator>
+#include <type_traits>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * NullBitmap stores the NULL flags of a ValueSegment or an ExpressionResult, with one bit per value (true means NULL).
+ *
+ * Unlike pmr_vector<bool>, the bits are stored in visible 64-bit words. Bits beyond size() are always zero, so that
+ * combining, counting, and searching NULLs (see operator|=, count(), find_next()) works on whole words, which the
+ * compiler vectorizes. The interface mirrors the parts of pmr_vector<bool> that Hyrise used, so that single bits can
+ * still be read and written through operator[].
+ *
+ * Like vector<bool>, writing a bit is a read-modify-write of its word. Concurrent writers to the same word must be
+ * synchronized (see ValueSegment::set_null_value).
+ */
+class NullBitmap {
+ public:
+  using Word = uint64_t;
+  using allocator_type = PolymorphicAllocator<Word>;
+
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  // Returned by the non-const operator[], writes a single bit
+  class Reference {
+   public:
+    Reference(Word& word, const Word mask) : _word(word), _mask(mask) {}
+
+    operator bool() const { return (_word & _mask) != 0; }  // NOLINT(hicpp-explicit-conversions)
+
+    Reference& operator=(const bool value) {
+      if (value) {
+        _word |= _mask;
+      } else {
+        _word &= ~_mask;
+      }
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other) { return *this = static_cast<bool>(other); }
+
+    Reference(const Reference&) = default;
+    Reference(Reference&&) = default;
+    Reference& operator=(Reference&&) = delete;
+    ~Reference() = default;
+
+   private:
+    Word& _word;
+    const Word _mask;
+  };
+
+  class ConstIterator : public boost::iterator_facade<ConstIterator, bool, std::random_access_iterator_tag, bool> {
+   public:
+    ConstIterator() = default;
+    ConstIterator(const NullBitmap* bitmap, const size_t index) : _bitmap(bitmap), _index(index) {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    bool equal(const ConstIterator& other) const { return _index == other._index; }
+    std::ptrdiff_t distance_to(const ConstIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+    bool dereference() const { return (*_bitmap)[_index]; }
+
+    const NullBitmap* _bitmap{nullptr};
+    size_t _index{0};
+  };
+
+  using const_iterator = ConstIterator;
+  using value_type = bool;
+
+  NullBitmap() = default;
+  explicit NullBitmap(const allocator_type& allocator);
+  NullBitmap(const size_t size, const allocator_type& allocator);
+  explicit NullBitmap(const size_t size, const bool value = false, const allocator_type& allocator = {});
+  NullBitmap(std::initializer_list<bool> values, const allocator_type& allocator = {});
+  NullBitmap(const NullBitmap& other, const allocator_type& allocator);
+
+  // Converts pmr_vector<bool>, std::vector<uint8_t> and the like
+  template <typename Iterator, typename = std::enable_if_t<!std::is_integral_v<Iterator>>>
+  NullBitmap(Iterator begin, const Iterator end, const allocator_type& allocator = {}) : _words(allocator) {
+    reserve(static_cast<size_t>(std::distance(begin, end)));
+    for (; begin != end; ++begin) {
+      push_back(static_cast<bool>(*begin));
+    }
+  }
+
+  NullBitmap(const NullBitmap&) = default;
+  NullBitmap(NullBitmap&&) = default;
+  NullBitmap& operator=(const NullBitmap&) = default;
+  NullBitmap& operator=(NullBitmap&&) = default;
+  ~NullBitmap() = default;
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  // Number of bits that fit into the allocated words
+  size_t capacity() const { return _words.capacity() * BITS_PER_WORD; }
+
+  // Does not reallocate as long as the size stays below the capacity, which concurrent readers rely on (see
+  // ValueSegment::resize)
+  void resize(const size_t size, const bool value = false);
+  void reserve(const size_t size);
+
+  bool operator[](const size_t index) const {
+    DebugAssert(index < _size, "NullBitmap index out of range");
+    return (_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & Word{1};
+  }
+
+  Reference operator[](const size_t index) {
+    DebugAssert(index < _size, "NullBitmap index out of range");
+    return Reference{_words[index / BITS_PER_WORD], Word{1} << (index % BITS_PER_WORD)};
+  }
+
+  bool at(const size_t index) const {
+    Assert(index < _size, "NullBitmap index out of range");
+    return (*this)[index];
+  }
+
+  bool front() const { return (*this)[0]; }
+  bool back() const { return (*this)[_size - 1]; }
+
+  void push_back(const bool value) {
+    if (_size % BITS_PER_WORD == 0) _words.emplace_back(Word{0});
+    if (value) _words.back() |= Word{1} << (_size % BITS_PER_WORD);
+    ++_size;
+  }
+
+  void emplace_back(const bool value) { push_back(value); }
+
+  void clear();
+
+  const_iterator begin() const { return const_iterator{this, 0}; }
+  const_iterator end() const { return const_iterator{this, _size}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // Combine the bitmaps word by word. Both must have the same size.
+  NullBitmap& operator|=(const NullBitmap& other);
+  NullBitmap& operator&=(const NullBitmap& other);
+
+  // Number of NULLs
+  size_t count() const;
+  bool any() const;
+  bool none() const { return !any(); }
+
+  // Returns the index of the first NULL at or after index, or size() if there is none
+  size_t find_next(const size_t index) const {
+    if (index >= _size) return _size;
+
+    auto word_id = index / BITS_PER_WORD;
+    auto word = _words[word_id] & (~Word{0} << (index % BITS_PER_WORD));
+    const auto word_count = _words.size();
+    while (word == 0) {
+      if (++word_id == word_count) return _size;
+      word = _words[word_id];
+    }
+    return word_id * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word));
+  }
+
+  // Copies length bits of source, starting at source_offset, to this bitmap, starting at offset. Bits that are set in
+  // this bitmap stay set.
+  void set_range(const size_t offset, const NullBitmap& source, const size_t source_offset, const size_t length);
+
+  const pmr_vector<Word>& words() const { return _words; }
+
+  allocator_type get_allocator() const { return _words.get_allocator(); }
+
+  bool operator==(const NullBitmap& other) const { return _size == other._size && _words == other._words; }
+  bool operator!=(const NullBitmap& other) const { return !(*this == other); }
+
+ private:
+  static size_t _word_count(const size_t size) { return (size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+  // Clears the bits beyond _size in the last word
+  void _clear_padding();
+
+  pmr_vector<Word> _words;
+  size_t _size{0};
+};
+
+std::ostream& operator<<(std::ostream& stream, const NullBitmap& null_bitmap);
+
+}  // namespace opossum
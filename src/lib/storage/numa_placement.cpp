@@ -0,0 +1,60 @@
+#include "numa_placement.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "memory/huge_page_memory_resource.hpp"
+#include "memory/numa_memory_resource.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table, const NUMAPlacementStrategy strategy) {
+  Assert(table->type() == TableType::Data, "Only data tables can be placed on NUMA nodes");
+  Assert(table->indexes_statistics().empty(), "Chunks with indexes cannot be migrated");
+
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  const auto chunk_count = table->chunk_count();
+  if (node_count < 2) return;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto node_id = NodeID{static_cast<NodeID::base_type>(strategy == NUMAPlacementStrategy::Interleaved
+                                                                   ? chunk_id % node_count
+                                                                   : size_t{chunk_id} * node_count / chunk_count)};
+    if (chunk->numa_node_id() == node_id) continue;
+
+    auto job = std::make_shared<JobTask>([chunk, node_id]() { chunk->migrate(NUMAMemoryResource::get(node_id)); });
+    job->set_node_id(node_id);
+    jobs.emplace_back(job);
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+void place_chunks_on_huge_pages(const std::shared_ptr<Table>& table) {
+  Assert(table->type() == TableType::Data, "Only data tables can be placed on huge pages");
+  Assert(table->indexes_statistics().empty(), "Chunks with indexes cannot be migrated");
+
+  auto* const memory_resource = &HugePageMemoryResource::get(HugePageAllocationClass::Segments);
+  const auto chunk_count = table->chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([chunk, memory_resource]() { chunk->migrate(memory_resource); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+}  // namespace opossum
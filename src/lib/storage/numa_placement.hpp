@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class NUMAPlacementStrategy {
+  // Chunk i is placed on node i % node_count, so that all nodes share the work of scans over a chunk range
+  Interleaved,
+  // Each node holds a contiguous range of chunks, so that tasks processing chunk ranges mostly access a single node
+  Partitioned
+};
+
+/**
+ * Moves the chunks of a data table to the NUMA nodes of the current topology (using NUMAMemoryResources). Each chunk
+ * is migrated by a task that is scheduled on the chunk's target node, so that memory that is placed on first touch
+ * ends up on that node, too. Operators schedule their per-chunk tasks on the chunk's node (see Chunk::numa_node_id()).
+ *
+ * As chunks with indexes cannot be migrated, this has to be called before indexes are created. The table must not be
+ * modified concurrently, which is why this is meant to be called when the table is loaded.
+ */
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table,
+                                const NUMAPlacementStrategy strategy = NUMAPlacementStrategy::Partitioned);
+
+/**
+ * Moves the chunks of a data table to the HugePageMemoryResource of segments, so that large segments are backed by
+ * huge pages (depending on the resource's mode). The same restrictions as for place_chunks_on_numa_nodes() apply. As
+ * the NUMAMemoryResources use normal pages, this is meant for systems with a single NUMA node.
+ */
+void place_chunks_on_huge_pages(const std::shared_ptr<Table>& table);
+
+}  // namespace opossum
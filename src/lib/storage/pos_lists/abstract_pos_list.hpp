@@ -57,6 +57,12 @@ class AbstractPosList : private Noncopyable {
   // For chunks that share a common ChunkID, returns that ID.
   virtual ChunkID common_chunk_id() const = 0;
 
+  // Returns whether it is guaranteed that the PosList contains no NULLs and that its positions are ordered by ChunkID
+  // and ChunkOffset, so that the referenced segments can be accessed chunk by chunk and sequentially within each chunk.
+  // Order-preserving operators (e.g., TableScan and Validate) keep the guarantee of their input.
+  // However, it may be false even if this is the case.
+  virtual bool is_sorted() const = 0;
+
   virtual RowID operator[](size_t n) const = 0;
 
   PosListIterator<> begin() const;
@@ -0,0 +1,57 @@
+#include "cartesian_pos_list.hpp"
+
+namespace opossum {
+
+CartesianPosList::CartesianPosList(const std::shared_ptr<const AbstractPosList>& input_pos_list,
+                                   const ChunkID common_chunk_id, const ChunkOffset input_size,
+                                   const size_t position_repetitions, const size_t sequence_repetitions)
+    : _input_pos_list(input_pos_list),
+      _common_chunk_id(common_chunk_id),
+      _input_size(input_size),
+      _position_repetitions(position_repetitions),
+      _sequence_repetitions(sequence_repetitions) {
+  DebugAssert(_input_pos_list || _common_chunk_id != INVALID_CHUNK_ID,
+              "CartesianPosList requires either an input PosList or a ChunkID");
+  DebugAssert(!_input_pos_list || _input_pos_list->size() == _input_size, "Input size does not match input PosList");
+}
+
+bool CartesianPosList::references_single_chunk() const {
+  return !_input_pos_list || _input_pos_list->references_single_chunk();
+}
+
+ChunkID CartesianPosList::common_chunk_id() const {
+  return _input_pos_list ? _input_pos_list->common_chunk_id() : _common_chunk_id;
+}
+
+bool CartesianPosList::is_sorted() const {
+  // Repeating a position in a row keeps the order, repeating the entire sequence breaks it (unless there is only one
+  // position or a single repetition of the sequence).
+  const auto input_is_sorted = !_input_pos_list || _input_pos_list->is_sorted();
+  return input_is_sorted && (_sequence_repetitions <= 1 || _input_size <= 1);
+}
+
+bool CartesianPosList::empty() const { return size() == 0; }
+
+size_t CartesianPosList::size() const {
+  // size_t is sufficient here, because ChunkOffset::max is 2^32 and (2^32 * 2^32 = 2^64)
+  return static_cast<size_t>(_input_size) * _position_repetitions * _sequence_repetitions;
+}
+
+size_t CartesianPosList::memory_usage(const MemoryUsageCalculationMode) const {
+  // The input PosList is owned by the input segment and therefore not accounted for here.
+  return sizeof *this;
+}
+
+AbstractPosList::PosListIterator<CartesianPosList, RowID> CartesianPosList::begin() const {
+  return PosListIterator<CartesianPosList, RowID>(this, ChunkOffset{0});
+}
+
+AbstractPosList::PosListIterator<CartesianPosList, RowID> CartesianPosList::end() const {
+  return PosListIterator<CartesianPosList, RowID>(this, static_cast<ChunkOffset>(size()));
+}
+
+AbstractPosList::PosListIterator<CartesianPosList, RowID> CartesianPosList::cbegin() const { return begin(); }
+
+AbstractPosList::PosListIterator<CartesianPosList, RowID> CartesianPosList::cend() const { return end(); }
+
+}  // namespace opossum
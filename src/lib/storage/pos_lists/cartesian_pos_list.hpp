@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+// The CartesianPosList describes one side of a cartesian product without materializing it. It virtually repeats the
+// positions of an input - either the positions of an input PosList or, if no PosList is given, the offsets
+// [0, input_size) of the chunk common_chunk_id. Each position is repeated position_repetitions times in a row, and the
+// resulting sequence is repeated sequence_repetitions times. For a product of a chunk with l rows and a chunk with
+// r rows, the left side thus uses (r, 1) and the right side (1, l). Positions are computed by index arithmetic, so a
+// CartesianPosList needs constant memory instead of l * r RowIDs.
+class CartesianPosList final : public AbstractPosList {
+ public:
+  CartesianPosList(const std::shared_ptr<const AbstractPosList>& input_pos_list, const ChunkID common_chunk_id,
+                   const ChunkOffset input_size, const size_t position_repetitions, const size_t sequence_repetitions);
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+  bool is_sorted() const final;
+
+  // Implemented in hpp for performance reasons (to allow inlining)
+  RowID operator[](const size_t index) const final {
+    DebugAssert(index < size(), "CartesianPosList index out of range");
+    const auto input_offset = static_cast<ChunkOffset>((index / _position_repetitions) % _input_size);
+    if (_input_pos_list) return (*_input_pos_list)[input_offset];
+    return RowID{_common_chunk_id, input_offset};
+  }
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  PosListIterator<CartesianPosList, RowID> begin() const;
+  PosListIterator<CartesianPosList, RowID> end() const;
+  PosListIterator<CartesianPosList, RowID> cbegin() const;
+  PosListIterator<CartesianPosList, RowID> cend() const;
+
+ private:
+  const std::shared_ptr<const AbstractPosList> _input_pos_list;
+  const ChunkID _common_chunk_id;
+  const ChunkOffset _input_size;
+  const size_t _position_repetitions;
+  const size_t _sequence_repetitions;
+};
+
+}  // namespace opossum
@@ -6,6 +6,8 @@ bool EntireChunkPosList::references_single_chunk() const { return true; }
 
 ChunkID EntireChunkPosList::common_chunk_id() const { return _common_chunk_id; }
 
+bool EntireChunkPosList::is_sorted() const { return true; }
+
 bool EntireChunkPosList::empty() const { return size() == 0; }
 
 size_t EntireChunkPosList::size() const { return _common_chunk_size; }
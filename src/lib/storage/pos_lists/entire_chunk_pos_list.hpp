@@ -18,6 +18,7 @@ class EntireChunkPosList : public AbstractPosList {
 
   bool references_single_chunk() const final;
   ChunkID common_chunk_id() const final;
+  bool is_sorted() const final;
 
   // Implemented in hpp for performance reasons (to allow inlining)
   RowID operator[](const size_t index) const final { return RowID{_common_chunk_id, static_cast<ChunkOffset>(index)}; }
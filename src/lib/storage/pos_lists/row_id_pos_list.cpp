@@ -1,5 +1,7 @@
 #include "row_id_pos_list.hpp"
 
+#include <algorithm>
+
 namespace opossum {
 
 void RowIDPosList::guarantee_single_chunk() { _references_single_chunk = true; }
@@ -19,6 +21,15 @@ bool RowIDPosList::references_single_chunk() const {
   return _references_single_chunk;
 }
 
+void RowIDPosList::guarantee_sorted() { _sorted = true; }
+
+bool RowIDPosList::is_sorted() const {
+  DebugAssert(!_sorted || (std::none_of(cbegin(), cend(), [](const auto& row_id) { return row_id.is_null(); }) &&
+                           std::is_sorted(cbegin(), cend())),
+              "RowIDPosList was marked as sorted, but is not sorted or contains NULLs");
+  return _sorted;
+}
+
 ChunkID RowIDPosList::common_chunk_id() const {
   DebugAssert(references_single_chunk(),
               "Can only retrieve the common_chunk_id if the RowIDPosList is guaranteed to reference a single chunk.");
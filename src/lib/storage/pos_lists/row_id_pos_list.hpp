@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "abstract_pos_list.hpp"
+#include "memory/pool_memory_resource.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -15,6 +16,9 @@ namespace opossum {
 // Inheriting from std::vector is generally not encouraged, because the STL containers are not prepared for
 // inheritance. By making the inheritance private and this class final, we can assure that the problems that come with
 // a non-virtual destructor do not occur.
+//
+// As most RowIDPosLists are short-lived intermediate results, they are allocated from the PoolMemoryResource unless
+// another allocator is given.
 
 class RowIDPosList final : public AbstractPosList, private pmr_vector<RowID> {
  public:
@@ -33,26 +37,32 @@ class RowIDPosList final : public AbstractPosList, private pmr_vector<RowID> {
   using reverse_iterator = Vector::reverse_iterator;
   using const_reverse_iterator = Vector::const_reverse_iterator;
 
-  /* (1 ) */ RowIDPosList() noexcept(noexcept(allocator_type())) {}
+  /* (1 ) */ RowIDPosList() noexcept : Vector(default_allocator()) {}
   /* (1 ) */ explicit RowIDPosList(const allocator_type& allocator) noexcept : Vector(allocator) {}
-  /* (2 ) */ RowIDPosList(size_type count, const RowID& value, const allocator_type& alloc = allocator_type())
+  /* (2 ) */ RowIDPosList(size_type count, const RowID& value, const allocator_type& alloc = default_allocator())
       : Vector(count, value, alloc) {}
-  /* (3 ) */ explicit RowIDPosList(size_type count, const allocator_type& alloc = allocator_type())
+  /* (3 ) */ explicit RowIDPosList(size_type count, const allocator_type& alloc = default_allocator())
       : Vector(count, alloc) {}
   /* (4 ) */ template <class InputIt>
-  RowIDPosList(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
-      : Vector(std::move(first), std::move(last)) {}
+  RowIDPosList(InputIt first, InputIt last, const allocator_type& alloc = default_allocator())
+      : Vector(std::move(first), std::move(last), alloc) {}
   /* (5 ) */  // RowIDPosList(const Vector& other) : Vector(other); - Oh no, you don't.
   /* (5 ) */  // RowIDPosList(const Vector& other, const allocator_type& alloc) : Vector(other, alloc);
   /* (6 ) */ RowIDPosList(RowIDPosList&& other) noexcept
-      : Vector(std::move(other)), _references_single_chunk{other._references_single_chunk} {}
+      : Vector(std::move(other)),
+        _references_single_chunk{other._references_single_chunk},
+        _sorted{other._sorted} {}
   /* (6+) */ explicit RowIDPosList(Vector&& other) noexcept : Vector(std::move(other)) {}
   /* (7 ) */ RowIDPosList(RowIDPosList&& other, const allocator_type& alloc)
-      : Vector(std::move(other), alloc), _references_single_chunk{other._references_single_chunk} {}
+      : Vector(std::move(other), alloc),
+        _references_single_chunk{other._references_single_chunk},
+        _sorted{other._sorted} {}
   /* (7+) */ RowIDPosList(Vector&& other, const allocator_type& alloc) : Vector(std::move(other), alloc) {}
-  /* (8 ) */ RowIDPosList(std::initializer_list<RowID> init, const allocator_type& alloc = allocator_type())
+  /* (8 ) */ RowIDPosList(std::initializer_list<RowID> init, const allocator_type& alloc = default_allocator())
       : Vector(std::move(init), alloc) {}
 
+  static allocator_type default_allocator() noexcept { return allocator_type{&PoolMemoryResource::get()}; }
+
   RowIDPosList& operator=(RowIDPosList&& other) = default;
 
   // If we know that all entries in the RowIDPosList share a single ChunkID, we can optimize the indirection by
@@ -69,6 +79,12 @@ class RowIDPosList final : public AbstractPosList, private pmr_vector<RowID> {
   // For chunks that share a common ChunkID, returns that ID.
   ChunkID common_chunk_id() const final;
 
+  // Guarantees that the RowIDPosList contains no NULLs and is ordered by ChunkID and ChunkOffset (see
+  // AbstractPosList::is_sorted()). Like the single chunk guarantee, it has to be kept by those who modify the list.
+  void guarantee_sorted();
+
+  bool is_sorted() const final;
+
   using Vector::assign;
   using Vector::get_allocator;
 
@@ -109,6 +125,7 @@ class RowIDPosList final : public AbstractPosList, private pmr_vector<RowID> {
 
  private:
   bool _references_single_chunk = false;
+  bool _sorted = false;
 };
 
 }  // namespace opossum
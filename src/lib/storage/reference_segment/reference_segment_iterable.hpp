@@ -10,11 +10,14 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_accessor.hpp"
+#include "storage/segment_gather.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -32,6 +35,20 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
     const auto& position_filter = _segment.pos_list();
 
+    // Point accesses into LZ4 blocks and SIMD-BP128 compressed vectors decode a whole block, of which the accessors
+    // only cache the last one. Unless a single referenced segment is accessed in order, the values are gathered block
+    // by block first (see segment_gather.hpp) and iterated afterwards.
+    const auto is_sorted_single_chunk = position_filter->references_single_chunk() && position_filter->is_sorted();
+    if (!is_sorted_single_chunk && _references_block_decoding_segments()) {
+      auto values = pmr_vector<T>{};
+      auto null_values = NullBitmap{};
+      segment_gather<T>(_segment, std::make_shared<EntireChunkPosList>(ChunkID{0}, _segment.size()), values,
+                        null_values);
+      const auto gathered_segment = ValueSegment<T>{std::move(values), std::move(null_values)};
+      create_iterable_from_segment<T>(gathered_segment).with_iterators(functor);
+      return;
+    }
+
     // If we are guaranteed that the reference segment refers to a single non-NULL chunk, we can do some
     // optimizations. For example, we can use a filtered iterator instead of having to create segments accessors
     // and using virtual method calls.
@@ -67,7 +84,8 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 #endif
 
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-          if constexpr (std::is_same_v<T, int32_t>) {
+          if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                    hana::type_c<T>)) {
             if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
           }
 #endif
@@ -75,6 +93,9 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
           // Always erase LZ4Segment accessors
           if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) return;
 
+          // Always erase FSSTSegment accessors
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) return;
+
           if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
             const auto segment_iterable = create_iterable_from_segment<T>(typed_segment);
             segment_iterable.with_iterators(position_filter, functor);
@@ -99,6 +120,22 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
       const auto segment_iterable = create_any_segment_iterable<T>(*referenced_segment);
       segment_iterable.with_iterators(position_filter, functor);
+    } else if (position_filter->is_sorted()) {
+      // If the positions are sorted, the referenced chunks are accessed one after another. Thus, a single accessor
+      // suffices and no NULL positions need to be checked.
+      resolve_pos_list_type(position_filter, [&](auto resolved_position_filter) {
+        const auto position_begin_it = resolved_position_filter->begin();
+        const auto position_end_it = resolved_position_filter->end();
+
+        using PosListIteratorType = std::decay_t<decltype(position_begin_it)>;
+
+        auto begin = SortedMultipleChunkIterator<PosListIteratorType>{referenced_table, referenced_column_id,
+                                                                      position_begin_it, position_begin_it};
+        auto end = SortedMultipleChunkIterator<PosListIteratorType>{referenced_table, referenced_column_id,
+                                                                    position_begin_it, position_end_it};
+
+        functor(begin, end);
+      });
     } else {
       using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
 
@@ -125,6 +162,26 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
  private:
   const ReferenceSegment& _segment;
 
+  // Whether point accesses into any of the referenced segments decode blocks (see segment_gather.hpp)
+  bool _references_block_decoding_segments() const {
+    const auto& position_filter = *_segment.pos_list();
+    const auto& referenced_table = *_segment.referenced_table();
+    const auto referenced_column_id = _segment.referenced_column_id();
+
+    if (position_filter.references_single_chunk()) {
+      if (position_filter.empty() || position_filter[0].is_null()) return false;
+      const auto chunk = referenced_table.get_chunk(position_filter.common_chunk_id());
+      return segment_decodes_blocks_on_point_access(*chunk->get_segment(referenced_column_id));
+    }
+
+    const auto chunk_count = referenced_table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = referenced_table.get_chunk(chunk_id);
+      if (chunk && segment_decodes_blocks_on_point_access(*chunk->get_segment(referenced_column_id))) return true;
+    }
+    return false;
+  }
+
  private:
   // The iterator for cases where we potentially iterate over multiple referenced chunks
   template <typename PosListIteratorType>
@@ -197,6 +254,70 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     // PointAccessIterators share vector with one Accessor per Chunk
     std::shared_ptr<std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>> _accessors;
   };
+
+  // The iterator for sorted PosLists (see AbstractPosList::is_sorted) that reference multiple chunks. Each iterator
+  // keeps the accessor of the chunk it last dereferenced and only creates a new one when the chunk changes.
+  template <typename PosListIteratorType>
+  class SortedMultipleChunkIterator
+      : public AbstractSegmentIterator<SortedMultipleChunkIterator<PosListIteratorType>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ReferenceSegmentIterable<T, erase_reference_segment_type>;
+
+   public:
+    explicit SortedMultipleChunkIterator(const std::shared_ptr<const Table>& referenced_table,
+                                         const ColumnID referenced_column_id,
+                                         const PosListIteratorType& begin_pos_list_it,
+                                         const PosListIteratorType& pos_list_it)
+        : _referenced_table{referenced_table},
+          _referenced_column_id{referenced_column_id},
+          _begin_pos_list_it{begin_pos_list_it},
+          _pos_list_it{pos_list_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_pos_list_it; }
+
+    void decrement() { --_pos_list_it; }
+
+    void advance(std::ptrdiff_t n) { _pos_list_it += n; }
+
+    bool equal(const SortedMultipleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
+
+    std::ptrdiff_t distance_to(const SortedMultipleChunkIterator& other) const {
+      return other._pos_list_it - _pos_list_it;
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto pos_list_offset = static_cast<ChunkOffset>(_pos_list_it - _begin_pos_list_it);
+      const auto& row_id = *_pos_list_it;
+
+      if (row_id.chunk_id != _accessor_chunk_id) {
+        _accessor = create_segment_accessor<T>(
+            _referenced_table->get_chunk(row_id.chunk_id)->get_segment(_referenced_column_id));
+        _accessor_chunk_id = row_id.chunk_id;
+      }
+
+      const auto typed_value = _accessor->access(row_id.chunk_offset);
+
+      if (typed_value) {
+        return SegmentPosition<T>{std::move(*typed_value), false, pos_list_offset};
+      } else {
+        return SegmentPosition<T>{T{}, true, pos_list_offset};
+      }
+    }
+
+   private:
+    std::shared_ptr<const Table> _referenced_table;
+    ColumnID _referenced_column_id;
+
+    PosListIteratorType _begin_pos_list_it;
+    PosListIteratorType _pos_list_it;
+
+    mutable ChunkID _accessor_chunk_id{INVALID_CHUNK_ID};
+    mutable std::shared_ptr<AbstractSegmentAccessor<T>> _accessor;
+  };
 };
 
 template <typename T>
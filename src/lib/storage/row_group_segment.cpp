@@ -0,0 +1,228 @@
+#include "row_group_segment.hpp"
+
+#include <climits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+RowGroup::RowGroup(const std::vector<DataType>& data_types, const ChunkOffset capacity)
+    : _data_types(data_types), _capacity(capacity) {
+  Assert(!_data_types.empty(), "A RowGroup needs at least one column");
+
+  // Place the columns in the given order, each aligned to its data type
+  _column_offsets.reserve(_data_types.size());
+  for (const auto data_type : _data_types) {
+    resolve_data_type(data_type, [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _row_width = (_row_width + alignof(ColumnDataType) - 1) / alignof(ColumnDataType) * alignof(ColumnDataType);
+      _column_offsets.emplace_back(_row_width);
+      _row_width += sizeof(ColumnDataType);
+    });
+  }
+  _row_width = (_row_width + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+
+  _data = std::make_unique<uint64_t[]>(_capacity * _row_width / sizeof(uint64_t));
+
+  for (auto group_column_id = ColumnID{0}; group_column_id < _data_types.size(); ++group_column_id) {
+    resolve_data_type(_data_types[group_column_id], [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto* slot = const_cast<std::byte*>(column_begin(group_column_id));
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _capacity; ++chunk_offset, slot += _row_width) {
+        new (slot) ColumnDataType{};
+      }
+    });
+  }
+}
+
+RowGroup::~RowGroup() {
+  for (auto group_column_id = ColumnID{0}; group_column_id < _data_types.size(); ++group_column_id) {
+    if (_data_types[group_column_id] != DataType::String) continue;
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _capacity; ++chunk_offset) {
+      value<pmr_string>(chunk_offset, group_column_id).~pmr_string();
+    }
+  }
+}
+
+const std::vector<DataType>& RowGroup::data_types() const { return _data_types; }
+
+ChunkOffset RowGroup::capacity() const { return _capacity; }
+
+size_t RowGroup::row_width() const { return _row_width; }
+
+size_t RowGroup::memory_usage() const { return sizeof(*this) + _capacity * _row_width; }
+
+template <typename T>
+RowGroupSegment<T>::RowGroupSegment(const std::shared_ptr<RowGroup>& row_group, const ColumnID group_column_id,
+                                    const bool nullable)
+    : BaseValueSegment(data_type_from_type<T>()), _row_group(row_group), _group_column_id(group_column_id) {
+  Assert(_row_group->data_types().at(_group_column_id) == data_type(), "Data type does not match the RowGroup");
+  if (nullable) {
+    _null_values = NullBitmap();
+    _null_values->reserve(_row_group->capacity());
+  }
+}
+
+template <typename T>
+AllTypeVariant RowGroupSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+  PerformanceWarning("operator[] used");
+  access_counter[SegmentAccessCounter::AccessType::Point] += 1;
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) return NULL_VALUE;
+  return *typed_value;
+}
+
+template <typename T>
+bool RowGroupSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  access_counter[SegmentAccessCounter::AccessType::Point] += 1;
+  return is_nullable() && (*_null_values)[chunk_offset];
+}
+
+template <typename T>
+void RowGroupSegment<T>::set_value(const ChunkOffset chunk_offset, const T& value) {
+  DebugAssert(chunk_offset < size(), "RowGroupSegment out-of-bounds");
+  auto& slot = _row_group->value<T>(chunk_offset, _group_column_id);
+  slot = value;
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    _string_heap_size.fetch_add(string_heap_size(slot), std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+void RowGroupSegment<T>::append(const AllTypeVariant& val) {
+  const auto chunk_offset = size();
+  Assert(chunk_offset < _row_group->capacity(), "RowGroupSegment is full");
+
+  const auto is_null = variant_is_null(val);
+  access_counter[SegmentAccessCounter::AccessType::Point] += 1;
+
+  if (is_nullable()) {
+    _null_values->push_back(is_null);
+  } else {
+    Assert(!is_null, "RowGroupSegment is not nullable but value passed is null.");
+  }
+
+  if (!is_null) {
+    auto& slot = _row_group->value<T>(chunk_offset, _group_column_id);
+    slot = boost::get<T>(val);
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _string_heap_size.fetch_add(string_heap_size(slot), std::memory_order_relaxed);
+    }
+  }
+
+  // The size is increased after the value is written, so that readers never see an unwritten value
+  _size.store(chunk_offset + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool RowGroupSegment<T>::is_nullable() const {
+  return static_cast<bool>(_null_values);
+}
+
+template <typename T>
+const NullBitmap& RowGroupSegment<T>::null_values() const {
+  DebugAssert(is_nullable(), "This RowGroupSegment does not support null values.");
+
+  return *_null_values;
+}
+
+template <typename T>
+void RowGroupSegment<T>::set_null_value(const ChunkOffset chunk_offset) {
+  Assert(is_nullable(), "This RowGroupSegment does not support null values.");
+
+  std::lock_guard<std::mutex> lock{_null_value_modification_mutex};
+  (*_null_values)[chunk_offset] = true;
+}
+
+template <typename T>
+void RowGroupSegment<T>::set_null_values(const ChunkOffset chunk_offset, const NullBitmap& null_values,
+                                         const ChunkOffset null_values_offset, const ChunkOffset length) {
+  DebugAssert(null_values.size() >= null_values_offset + length, "Null values out-of-bounds");
+
+  if (!is_nullable()) {
+    Assert(null_values.find_next(null_values_offset) >= null_values_offset + length,
+           "This RowGroupSegment does not support null values.");
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{_null_value_modification_mutex};
+  DebugAssert(_null_values->size() >= chunk_offset + length, "RowGroupSegment out-of-bounds");
+  _null_values->set_range(chunk_offset, null_values, null_values_offset, length);
+}
+
+template <typename T>
+ChunkOffset RowGroupSegment<T>::size() const {
+  return _size.load(std::memory_order_acquire);
+}
+
+template <typename T>
+void RowGroupSegment<T>::resize(const size_t size) {
+  DebugAssert(size > this->size() && size <= _row_group->capacity(),
+              "RowGroupSegments should not be shrunk or resized beyond the capacity of their RowGroup");
+  if (is_nullable()) {
+    std::lock_guard<std::mutex> lock{_null_value_modification_mutex};
+    _null_values->resize(size);
+  }
+  _size.store(static_cast<ChunkOffset>(size), std::memory_order_release);
+}
+
+template <typename T>
+const std::shared_ptr<RowGroup>& RowGroupSegment<T>::row_group() const {
+  return _row_group;
+}
+
+template <typename T>
+ColumnID RowGroupSegment<T>::group_column_id() const {
+  return _group_column_id;
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> RowGroupSegment<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  const auto segment_size = size();
+  auto values = pmr_vector<T>(alloc);
+  values.reserve(segment_size);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    values.emplace_back(value(chunk_offset));
+  }
+
+  std::shared_ptr<AbstractSegment> copy;
+  if (is_nullable()) {
+    auto null_values = NullBitmap(*_null_values, alloc);
+    null_values.resize(segment_size);
+    copy = std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  } else {
+    copy = std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+  copy->access_counter = access_counter;
+  return copy;
+}
+
+template <typename T>
+size_t RowGroupSegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  auto null_value_vector_size = size_t{0};
+  if (_null_values) {
+    null_value_vector_size = _null_values->capacity() / CHAR_BIT;
+  }
+
+  return sizeof(*this) + null_value_vector_size + _row_group->capacity() * sizeof(T) +
+         _string_heap_size.load(std::memory_order_relaxed);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RowGroupSegment);
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_value_segment.hpp"
+#include "chunk.hpp"
+
+namespace opossum {
+
+/**
+ * A RowGroup stores the values of a group of columns of a mutable chunk row by row, i.e., the values of a row are next
+ * to each other (column groups, as in PAX or Data Morphing). Procedures that read or write whole rows, such as those
+ * of TPC-C, touch one or two cache lines per row instead of one per column. The columns of the group are exposed as
+ * RowGroupSegments, so that all operators can read them like ValueSegments. Once the chunk is encoded (see
+ * ChunkEncoder::encode_segment()), each RowGroupSegment is replaced by a columnar segment.
+ *
+ * The slots of all rows up to the capacity are allocated and value-initialized upfront, so that writing a value never
+ * reallocates. The slots of one column are only written by its RowGroupSegment.
+ */
+class RowGroup : private Noncopyable {
+ public:
+  RowGroup(const std::vector<DataType>& data_types, const ChunkOffset capacity);
+  ~RowGroup();
+
+  const std::vector<DataType>& data_types() const;
+  ChunkOffset capacity() const;
+
+  // Number of bytes between the values of two consecutive rows
+  size_t row_width() const;
+
+  // Address of the value of the first row in the given column of the group, the value of row i is i * row_width()
+  // bytes after it
+  const std::byte* column_begin(const ColumnID group_column_id) const {
+    return reinterpret_cast<const std::byte*>(_data.get()) + _column_offsets[group_column_id];
+  }
+
+  template <typename T>
+  const T& value(const ChunkOffset chunk_offset, const ColumnID group_column_id) const {
+    // performance critical - not in cpp to help with inlining
+    return *reinterpret_cast<const T*>(column_begin(group_column_id) + chunk_offset * _row_width);
+  }
+
+  template <typename T>
+  T& value(const ChunkOffset chunk_offset, const ColumnID group_column_id) {
+    return const_cast<T&>(std::as_const(*this).value<T>(chunk_offset, group_column_id));
+  }
+
+  size_t memory_usage() const;
+
+ protected:
+  const std::vector<DataType> _data_types;
+  const ChunkOffset _capacity;
+
+  std::vector<size_t> _column_offsets;
+  size_t _row_width{0};
+
+  // Stored as words so that the rows are aligned for all data types
+  std::unique_ptr<uint64_t[]> _data;
+};
+
+/**
+ * RowGroupSegment is a mutable segment whose values are stored in a RowGroup that it shares with the other columns of
+ * its group. It offers the interface of a ValueSegment apart from values(), as its values are not contiguous. NULL
+ * values are stored in a bitmap per segment.
+ */
+template <typename T>
+class RowGroupSegment : public BaseValueSegment {
+ public:
+  RowGroupSegment(const std::shared_ptr<RowGroup>& row_group, const ColumnID group_column_id, const bool nullable);
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (is_nullable() && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+    return _row_group->value<T>(chunk_offset, _group_column_id);
+  }
+
+  // Returns the value at the position, which is T{} for NULLs
+  const T& value(const ChunkOffset chunk_offset) const { return _row_group->value<T>(chunk_offset, _group_column_id); }
+
+  // Writes a value at a position below size(), used by the Insert operator after resize()
+  void set_value(const ChunkOffset chunk_offset, const T& value);
+
+  // Not thread-safe, see ValueSegment::append()
+  void append(const AllTypeVariant& val) final;
+
+  bool is_nullable() const final;
+
+  const NullBitmap& null_values() const final;
+
+  // See ValueSegment::set_null_value() and ValueSegment::set_null_values()
+  void set_null_value(const ChunkOffset chunk_offset);
+  void set_null_values(const ChunkOffset chunk_offset, const NullBitmap& null_values,
+                       const ChunkOffset null_values_offset, const ChunkOffset length);
+
+  ChunkOffset size() const final;
+
+  // Grows the segment within the capacity of the RowGroup, see ValueSegment::resize()
+  void resize(const size_t size);
+
+  const std::shared_ptr<RowGroup>& row_group() const;
+  ColumnID group_column_id() const;
+
+  // Copies the values into a ValueSegment, as the other columns of the RowGroup are copied by their own segments
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
+
+  // Counts the slots of this column in the RowGroup
+  size_t memory_usage(const MemoryUsageCalculationMode mode) const override;
+
+ protected:
+  const std::shared_ptr<RowGroup> _row_group;
+  const ColumnID _group_column_id;
+
+  std::atomic<ChunkOffset> _size{0};
+  std::optional<NullBitmap> _null_values;
+
+  // Heap memory allocated by the strings of this column, see ValueSegment::_string_heap_size
+  std::atomic<size_t> _string_heap_size{0};
+
+  std::mutex _null_value_modification_mutex;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(RowGroupSegment);
+
+}  // namespace opossum
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <utility>
+
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/row_group_segment.hpp"
+#include "storage/segment_iterables.hpp"
+
+namespace opossum {
+
+// Iterates over the values of a RowGroupSegment by advancing by the row width of its RowGroup
+template <typename T>
+class RowGroupSegmentIterable : public PointAccessibleSegmentIterable<RowGroupSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit RowGroupSegmentIterable(const RowGroupSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto segment_size = _segment.size();
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+
+    const auto& row_group = *_segment.row_group();
+    const auto* values = row_group.column_begin(_segment.group_column_id());
+    const auto* null_values = _null_values();
+
+    auto begin = Iterator{values, row_group.row_width(), null_values, ChunkOffset{0}};
+    auto end = Iterator{values, row_group.row_width(), null_values, segment_size};
+    functor(begin, end);
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+
+    using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+    const auto& row_group = *_segment.row_group();
+    const auto* values = row_group.column_begin(_segment.group_column_id());
+    const auto* null_values = _null_values();
+
+    auto begin = PointAccessIterator<PosListIteratorType>{values, row_group.row_width(), null_values,
+                                                          position_filter->cbegin(), position_filter->cbegin()};
+    auto end = PointAccessIterator<PosListIteratorType>{values, row_group.row_width(), null_values,
+                                                        position_filter->cbegin(), position_filter->cend()};
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  // Segments without NULLs skip the per-value null checks
+  const NullBitmap* _null_values() const {
+    if (!_segment.is_nullable() || !_segment.null_values().any()) return nullptr;
+    return &_segment.null_values();
+  }
+
+  const RowGroupSegment<T>& _segment;
+
+ private:
+  class Iterator : public AbstractSegmentIterator<Iterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = RowGroupSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const std::byte* values, const size_t row_width, const NullBitmap* null_values,
+                      const ChunkOffset chunk_offset)
+        : _values{values}, _row_width{row_width}, _null_values{null_values}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto& value = *reinterpret_cast<const T*>(_values + _chunk_offset * _row_width);
+      return SegmentPosition<T>{value, _null_values && (*_null_values)[_chunk_offset], _chunk_offset};
+    }
+
+   private:
+    const std::byte* _values;
+    size_t _row_width;
+    const NullBitmap* _null_values;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename PosListIteratorType>
+  class PointAccessIterator : public AbstractPointAccessSegmentIterator<PointAccessIterator<PosListIteratorType>,
+                                                                        SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = RowGroupSegmentIterable<T>;
+
+   public:
+    explicit PointAccessIterator(const std::byte* values, const size_t row_width, const NullBitmap* null_values,
+                                 PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>,
+                                             PosListIteratorType>{std::move(position_filter_begin),
+                                                                  std::move(position_filter_it)},
+          _values{values},
+          _row_width{row_width},
+          _null_values{null_values} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+      const auto& value = *reinterpret_cast<const T*>(_values + chunk_offset * _row_width);
+      return SegmentPosition<T>{value, _null_values && (*_null_values)[chunk_offset], chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const std::byte* _values;
+    size_t _row_width;
+    const NullBitmap* _null_values;
+  };
+};
+
+}  // namespace opossum
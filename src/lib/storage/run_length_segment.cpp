@@ -16,7 +16,8 @@ RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<const pmr_vector<T>>
     : AbstractEncodedSegment(data_type_from_type<T>()),
       _values{values},
       _null_values{null_values},
-      _end_positions{end_positions} {}
+      _end_positions{end_positions},
+      _string_heap_size{string_vector_heap_size(*_values)} {}
 
 template <typename T>
 std::shared_ptr<const pmr_vector<T>> RunLengthSegment<T>::values() const {
@@ -64,13 +65,14 @@ std::shared_ptr<AbstractSegment> RunLengthSegment<T>::copy_using_allocator(
 }
 
 template <typename T>
-size_t RunLengthSegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
+size_t RunLengthSegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as the heap size of the strings is computed when the segment is created
   const auto common_elements_size =
       sizeof(*this) + _null_values->capacity() / CHAR_BIT +
       _end_positions->capacity() * sizeof(typename decltype(_end_positions)::element_type::value_type);
 
   if constexpr (std::is_same_v<T, pmr_string>) {
-    return common_elements_size + string_vector_memory_usage(*_values, mode);
+    return common_elements_size + string_vector_memory_usage(*_values, _string_heap_size);
   }
   return common_elements_size + _values->capacity() * sizeof(typename decltype(_values)::element_type::value_type);
 }
@@ -92,6 +92,7 @@ class RunLengthSegment : public AbstractEncodedSegment {
   const std::shared_ptr<const pmr_vector<T>> _values;
   const std::shared_ptr<const pmr_vector<bool>> _null_values;
   const std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
+  const size_t _string_heap_size;
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(RunLengthSegment);
@@ -0,0 +1,143 @@
+#include "segment_encoding_advisor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Unencoded is not a candidate, as the advisor is used to compress segments.
+constexpr auto CANDIDATE_ENCODING_TYPES =
+    std::array{EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FixedStringDictionary,
+               EncodingType::FrameOfReference, EncodingType::LZ4, EncodingType::FSST};
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> sample_segment(const std::shared_ptr<const AbstractSegment>& segment) {
+  constexpr auto block_count = SegmentEncodingAdvisor::SAMPLE_BLOCK_COUNT;
+  constexpr auto block_size = SegmentEncodingAdvisor::SAMPLE_BLOCK_SIZE;
+
+  const auto segment_size = static_cast<size_t>(segment->size());
+  const auto sample_size = std::min(segment_size, block_count * block_size);
+
+  auto values = pmr_vector<T>{};
+  auto null_values = pmr_vector<bool>{};
+  values.reserve(sample_size);
+  null_values.reserve(sample_size);
+
+  const auto accessor = create_segment_accessor<T>(segment);
+  const auto append = [&](const ChunkOffset chunk_offset) {
+    const auto value = accessor->access(chunk_offset);
+    values.emplace_back(value ? *value : T{});
+    null_values.emplace_back(!value);
+  };
+
+  if (sample_size == segment_size) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      append(chunk_offset);
+    }
+  } else {
+    // The first block starts at the beginning of the segment, the last one ends at its end.
+    for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+      const auto block_begin = block_id * (segment_size - block_size) / (block_count - 1);
+      for (auto chunk_offset = block_begin; chunk_offset < block_begin + block_size; ++chunk_offset) {
+        append(static_cast<ChunkOffset>(chunk_offset));
+      }
+    }
+  }
+
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+}  // namespace
+
+namespace opossum {
+
+SegmentEncodingSpec SegmentEncodingAdvisor::advise_segment(const std::shared_ptr<const AbstractSegment>& segment,
+                                                           const DataType data_type, const double memory_weight) {
+  Assert(memory_weight >= 0.0 && memory_weight <= 1.0, "Memory weight has to be in [0, 1]");
+
+  auto best_spec = SegmentEncodingSpec{};
+  if (segment->size() == 0) return best_spec;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto sample = sample_segment<ColumnDataType>(segment);
+    const auto unencoded_size =
+        static_cast<double>(std::max(sample->memory_usage(MemoryUsageCalculationMode::Full), size_t{1}));
+
+    auto best_score = std::numeric_limits<double>::max();
+    for (const auto encoding_type : CANDIDATE_ENCODING_TYPES) {
+      if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+      // The sample might miss the outliers that make the value range of a block too wide for FrameOfReference
+      if (encoding_type == EncodingType::FrameOfReference && !frame_of_reference_is_applicable(*segment, data_type)) {
+        continue;
+      }
+
+      const auto spec = SegmentEncodingSpec{encoding_type};
+      const auto encoded_sample = ChunkEncoder::encode_segment(sample, data_type, spec);
+      const auto relative_size =
+          static_cast<double>(encoded_sample->memory_usage(MemoryUsageCalculationMode::Full)) / unencoded_size;
+
+      const auto score = memory_weight * relative_size + (1.0 - memory_weight) * relative_scan_cost(encoding_type);
+      if (score < best_score) {
+        best_score = score;
+        best_spec = spec;
+      }
+    }
+  });
+
+  return best_spec;
+}
+
+ChunkEncodingSpec SegmentEncodingAdvisor::advise_chunk(const std::shared_ptr<const Chunk>& chunk,
+                                                       const std::vector<DataType>& column_data_types,
+                                                       const double memory_weight) {
+  Assert(column_data_types.size() == chunk->column_count(), "Number of data types must match the chunk's column count");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    chunk_encoding_spec.emplace_back(
+        advise_segment(chunk->get_segment(column_id), column_data_types[column_id], memory_weight));
+  }
+  return chunk_encoding_spec;
+}
+
+double SegmentEncodingAdvisor::relative_scan_cost(const EncodingType encoding_type) {
+  // These estimates reflect the relative sequential scan throughput of the encodings. Dictionary scans can compare
+  // value ids instead of values, while run-length and frame-of-reference segments need to decode run or block
+  // boundaries. FSST decodes every string that it cannot compare in compressed form, and LZ4 has to decompress whole
+  // blocks.
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return 1.0;
+    case EncodingType::Dictionary:
+      return 1.0;
+    case EncodingType::FixedStringDictionary:
+      return 1.3;
+    case EncodingType::RunLength:
+      return 1.5;
+    case EncodingType::FrameOfReference:
+      return 1.5;
+    case EncodingType::LZ4:
+      return 8.0;
+    case EncodingType::FSST:
+      return 2.5;
+  }
+  Fail("Invalid EncodingType");
+}
+
+}  // namespace opossum
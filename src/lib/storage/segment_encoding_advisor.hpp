@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class Chunk;
+
+/**
+ * @brief Picks a SegmentEncodingSpec per segment based on a sample of its data
+ *
+ * A sample of the segment (SAMPLE_BLOCK_COUNT evenly spaced blocks of SAMPLE_BLOCK_SIZE consecutive rows, so that runs
+ * and local value ranges are preserved) is encoded with every encoding that supports the segment's data type. Each
+ * candidate is scored by
+ *
+ *   memory_weight * relative_size + (1 - memory_weight) * relative_scan_cost
+ *
+ * where relative_size is the encoded sample's memory usage relative to the unencoded sample and relative_scan_cost is
+ * a static estimate per encoding type, relative to scanning a ValueSegment. The candidate with the lowest score wins.
+ * A memory_weight of 1 optimizes for memory only, a memory_weight of 0 for scan speed only.
+ */
+class SegmentEncodingAdvisor {
+ public:
+  static SegmentEncodingSpec advise_segment(const std::shared_ptr<const AbstractSegment>& segment,
+                                            const DataType data_type, const double memory_weight);
+
+  static ChunkEncodingSpec advise_chunk(const std::shared_ptr<const Chunk>& chunk,
+                                        const std::vector<DataType>& column_data_types, const double memory_weight);
+
+  // Rough cost of scanning a segment of the given encoding type, relative to scanning a ValueSegment.
+  static double relative_scan_cost(const EncodingType encoding_type);
+
+  constexpr static auto SAMPLE_BLOCK_COUNT = size_t{8};
+  constexpr static auto SAMPLE_BLOCK_SIZE = size_t{512};
+  constexpr static auto DEFAULT_MEMORY_WEIGHT = 0.5;
+};
+
+}  // namespace opossum
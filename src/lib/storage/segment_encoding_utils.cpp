@@ -1,12 +1,17 @@
 #include "segment_encoding_utils.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_encoder.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
 #include "storage/lz4_segment/lz4_encoder.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
+#include "storage/segment_iterate.hpp"
 
 #include "utils/assert.hpp"
 #include "utils/enum_constant.hpp"
@@ -25,7 +30,8 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
     {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
-    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()}};
+    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()},
+    {EncodingType::FSST, std::make_shared<FSSTEncoder>()}};
 
 }  // namespace
 
@@ -66,8 +72,33 @@ VectorCompressionType parent_vector_compression_type(const CompressedVectorType
       break;
     case CompressedVectorType::SimdBp128:
       return VectorCompressionType::SimdBp128;
+    case CompressedVectorType::BitPacking:
+      return VectorCompressionType::BitPacking;
   }
   Fail("Invalid enum value");
 }
 
+bool frame_of_reference_is_applicable(const AbstractSegment& segment, const DataType data_type) {
+  if (!encoding_supports_data_type(EncodingType::FrameOfReference, data_type)) return false;
+  if (data_type != DataType::Long) return true;
+
+  constexpr auto block_size = FrameOfReferenceSegment<int64_t>::block_size;
+
+  auto block_minima = std::vector<int64_t>(segment.size() / block_size + 1, std::numeric_limits<int64_t>::max());
+  auto block_maxima = std::vector<int64_t>(block_minima.size(), std::numeric_limits<int64_t>::lowest());
+  segment_iterate<int64_t>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    const auto block_id = position.chunk_offset() / block_size;
+    block_minima[block_id] = std::min(block_minima[block_id], position.value());
+    block_maxima[block_id] = std::max(block_maxima[block_id], position.value());
+  });
+
+  for (auto block_id = size_t{0}; block_id < block_minima.size(); ++block_id) {
+    if (block_minima[block_id] > block_maxima[block_id]) continue;
+    const auto range = static_cast<uint64_t>(block_maxima[block_id]) - static_cast<uint64_t>(block_minima[block_id]);
+    if (range > std::numeric_limits<uint32_t>::max()) return false;
+  }
+  return true;
+}
+
 }  // namespace opossum
@@ -31,4 +31,12 @@ SegmentEncodingSpec get_segment_encoding_spec(const std::shared_ptr<const Abstra
  */
 VectorCompressionType parent_vector_compression_type(const CompressedVectorType compressed_vector_type);
 
+/**
+ * @brief Returns whether the segment can be encoded as a FrameOfReferenceSegment
+ *
+ * The offsets of a FrameOfReferenceSegment are compressed as uint32_t. For int64_t, the value range of each block
+ * therefore has to fit into 32 bits, which is only known after looking at all values of the segment.
+ */
+bool frame_of_reference_is_applicable(const AbstractSegment& segment, const DataType data_type);
+
 }  // namespace opossum
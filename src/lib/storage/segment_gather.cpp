@@ -0,0 +1,169 @@
+#include "segment_gather.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Writes the values of a non-reference segment at the chunk offsets of `positions` to `values` and `null_values`. The
+// value at positions[i] is written to index output_positions[i] or, if no output positions are given, to index i.
+template <typename T>
+void gather_from_referenced_segment(const AbstractSegment& segment, std::shared_ptr<const AbstractPosList> positions,
+                                    std::vector<ChunkOffset> output_positions, pmr_vector<T>& values,
+                                    NullBitmap& null_values) {
+  // Iterables visit the entire segment for an EntireChunkPosList, which might only cover the first values of a mutable
+  // segment, though
+  if (dynamic_cast<const EntireChunkPosList*>(&*positions) && positions->size() != segment.size()) {
+    auto row_ids = std::make_shared<RowIDPosList>(positions->cbegin(), positions->cend());
+    row_ids->guarantee_single_chunk();
+    row_ids->guarantee_sorted();
+    positions = std::move(row_ids);
+  }
+
+  const auto is_sorted_by_chunk_offset = [&]() {
+    if (positions->is_sorted()) return true;
+    return std::is_sorted(positions->cbegin(), positions->cend(), [](const auto& lhs, const auto& rhs) {
+      return lhs.chunk_offset < rhs.chunk_offset;
+    });
+  };
+
+  if (segment_decodes_blocks_on_point_access(segment) && !is_sorted_by_chunk_offset()) {
+    const auto position_count = positions->size();
+    auto offsets_and_output_positions = std::vector<std::pair<ChunkOffset, ChunkOffset>>{};
+    offsets_and_output_positions.reserve(position_count);
+    for (auto index = ChunkOffset{0}; index < position_count; ++index) {
+      offsets_and_output_positions.emplace_back((*positions)[index].chunk_offset,
+                                                output_positions.empty() ? index : output_positions[index]);
+    }
+    std::sort(offsets_and_output_positions.begin(), offsets_and_output_positions.end());
+
+    const auto chunk_id = positions->common_chunk_id();
+    auto sorted_positions = std::make_shared<RowIDPosList>();
+    sorted_positions->reserve(position_count);
+    output_positions.resize(position_count);
+    for (auto index = size_t{0}; index < position_count; ++index) {
+      sorted_positions->emplace_back(RowID{chunk_id, offsets_and_output_positions[index].first});
+      output_positions[index] = offsets_and_output_positions[index].second;
+    }
+    sorted_positions->guarantee_single_chunk();
+    sorted_positions->guarantee_sorted();
+    positions = std::move(sorted_positions);
+  }
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Found ReferenceSegment pointing to ReferenceSegment");
+    } else {
+      // For point accesses, the chunk offset of a SegmentPosition is its index in the positions
+      create_iterable_from_segment<T>(typed_segment).for_each(positions, [&](const auto& position) {
+        const auto output_position =
+            output_positions.empty() ? position.chunk_offset() : output_positions[position.chunk_offset()];
+        null_values[output_position] = position.is_null();
+        if (!position.is_null()) values[output_position] = position.value();
+      });
+    }
+  });
+}
+
+template <typename T>
+void gather_from_reference_segment(const ReferenceSegment& segment,
+                                   const std::shared_ptr<const AbstractPosList>& positions, pmr_vector<T>& values,
+                                   NullBitmap& null_values) {
+  // The row ids that the positions refer to. Gathering all values of the ReferenceSegment does not need a copy.
+  auto row_ids = segment.pos_list();
+  if (!dynamic_cast<const EntireChunkPosList*>(&*positions)) {
+    const auto& referenced_pos_list = *segment.pos_list();
+    auto referenced_row_ids = std::make_shared<RowIDPosList>();
+    referenced_row_ids->reserve(positions->size());
+    for (const auto& position : *positions) {
+      referenced_row_ids->emplace_back(referenced_pos_list[position.chunk_offset]);
+    }
+    if (referenced_pos_list.references_single_chunk()) referenced_row_ids->guarantee_single_chunk();
+    row_ids = std::move(referenced_row_ids);
+  }
+
+  if (row_ids->empty()) return;
+
+  // Entries that are NULL in the row ids are not visited below and remain NULL
+  const auto position_count = null_values.size();
+  null_values.clear();
+  null_values.resize(position_count, true);
+
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+
+  if (row_ids->references_single_chunk()) {
+    // A PosList that references a single chunk is either free of NULLs or only contains NULLs
+    const auto chunk_id = row_ids->common_chunk_id();
+    if (chunk_id == INVALID_CHUNK_ID) return;
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+    gather_from_referenced_segment(*referenced_segment, row_ids, {}, values, null_values);
+    return;
+  }
+
+  const auto chunk_count = referenced_table.chunk_count();
+  auto sub_pos_lists = split_pos_list_by_chunk_id(row_ids, chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& sub_pos_list = sub_pos_lists[chunk_id];
+    if (sub_pos_list.row_ids->empty()) continue;
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+    gather_from_referenced_segment(*referenced_segment, sub_pos_list.row_ids,
+                                   std::move(sub_pos_list.original_positions), values, null_values);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool segment_decodes_blocks_on_point_access(const AbstractSegment& segment) {
+  const auto* const encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+  if (!encoded_segment) return false;
+
+  return encoded_segment->encoding_type() == EncodingType::LZ4 ||
+         encoded_segment->compressed_vector_type() == CompressedVectorType::SimdBp128;
+}
+
+namespace segment_gather_detail {
+
+template <typename T>
+void SegmentGather<T>::gather(const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& positions,
+                              pmr_vector<T>& values, NullBitmap& null_values) {
+  Assert(positions, "Expected positions to gather");
+  const auto position_count = positions->size();
+  values.clear();
+  values.resize(position_count);
+  null_values.clear();
+  null_values.resize(position_count);
+  if (position_count == 0) return;
+
+  if (const auto* const reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    gather_from_reference_segment(*reference_segment, positions, values, null_values);
+    return;
+  }
+
+  Assert(positions->references_single_chunk(), "Expected positions to reference a single chunk");
+  gather_from_referenced_segment(segment, positions, {}, values, null_values);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentGather);
+
+}  // namespace segment_gather_detail
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "storage/null_bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractPosList;
+class AbstractSegment;
+
+namespace segment_gather_detail {
+
+// We want to instantiate segment_gather() for all data types, but our EXPLICITLY_INSTANTIATE_DATA_TYPES macro only
+// supports classes. So we wrap segment_gather() in this class and instantiate the class in the .cpp
+template <typename T>
+class SegmentGather {
+ public:
+  static void gather(const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& positions,
+                     pmr_vector<T>& values, NullBitmap& null_values);
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(SegmentGather);
+
+}  // namespace segment_gather_detail
+
+/**
+ * Batched random access: Writes the values of @param segment at the chunk offsets of @param positions to
+ * @param values and @param null_values, i.e., values[i] holds the value at positions[i] unless null_values[i] is set.
+ * Both outputs are resized to the size of the positions. For a ReferenceSegment, the positions are offsets into the
+ * ReferenceSegment itself, all other segments expect positions that reference a single chunk.
+ *
+ * Unlike value-by-value accesses through a SegmentAccessor or AbstractSegment::operator[], the positions are grouped
+ * by their referenced chunk and each referenced segment is resolved once. LZ4 blocks and SIMD-BP128 compressed vectors
+ * decode a whole block for each point access and only cache the last one. For those, the positions are sorted by their
+ * chunk offset first, so that each needed block is decoded only once.
+ */
+template <typename T>
+void segment_gather(const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& positions,
+                    pmr_vector<T>& values, NullBitmap& null_values) {
+  segment_gather_detail::SegmentGather<T>::gather(segment, positions, values, null_values);
+}
+
+/**
+ * Returns whether point accesses into the segment decode whole blocks (see above), so that accessing its values in
+ * the order of their chunk offsets is significantly cheaper than accessing them in random order.
+ */
+bool segment_decodes_blocks_on_point_access(const AbstractSegment& segment);
+
+}  // namespace opossum
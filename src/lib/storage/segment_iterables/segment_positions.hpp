@@ -87,29 +87,4 @@ class NonNullSegmentPosition final : public AbstractSegmentPosition<T> {
   alignas(8) const ChunkOffset _chunk_offset;
 };
 
-/**
- * @brief Segment iterator position without value information
- *
- * Used for data structures that only store if the entry is null or not.
- *
- * @see NullValueVectorIterable
- */
-class IsNullSegmentPosition final : public AbstractSegmentPosition<boost::blank> {
- public:
-  static constexpr bool Nullable = true;
-
-  IsNullSegmentPosition(const bool null_value, const ChunkOffset& chunk_offset)
-      : _null_value{null_value}, _chunk_offset{chunk_offset} {}
-
-  const boost::blank& value() const override { return _blank; }
-  bool is_null() const override { return _null_value; }
-  ChunkOffset chunk_offset() const override { return _chunk_offset; }
-
- private:
-  // The alignment improves the suitability of the iterator for (auto-)vectorization
-  static constexpr auto _blank = boost::blank{};
-  alignas(8) const bool _null_value;
-  alignas(8) const ChunkOffset _chunk_offset;
-};
-
 }  // namespace opossum
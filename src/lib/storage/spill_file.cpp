@@ -0,0 +1,51 @@
+#include "spill_file.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile(const std::filesystem::path& directory) {
+  auto path = (directory / "hyrise_spill_XXXXXX").string();
+  _file_descriptor = mkstemp(path.data());
+  Assert(_file_descriptor >= 0, "Could not create spill file in '" + directory.string() + "': " + std::strerror(errno));
+  unlink(path.c_str());
+}
+
+SpillFile::~SpillFile() { close(_file_descriptor); }
+
+SpillFile::Range SpillFile::write(const void* data, const size_t size) {
+  const auto offset = _size.fetch_add(size);
+
+  auto written_byte_count = size_t{0};
+  while (written_byte_count < size) {
+    const auto result = pwrite(_file_descriptor, static_cast<const char*>(data) + written_byte_count,
+                               size - written_byte_count, static_cast<off_t>(offset + written_byte_count));
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, "Could not write to spill file: " + std::string{std::strerror(errno)});
+    written_byte_count += static_cast<size_t>(result);
+  }
+
+  return {offset, size};
+}
+
+void SpillFile::read(const Range& range, void* data) const {
+  auto read_byte_count = size_t{0};
+  while (read_byte_count < range.size) {
+    const auto result = pread(_file_descriptor, static_cast<char*>(data) + read_byte_count,
+                              range.size - read_byte_count, static_cast<off_t>(range.offset + read_byte_count));
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result > 0, "Could not read from spill file: " + std::string{std::strerror(errno)});
+    read_byte_count += static_cast<size_t>(result);
+  }
+}
+
+size_t SpillFile::size() const { return _size.load(); }
+
+}  // namespace opossum
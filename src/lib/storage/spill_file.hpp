@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <type_traits>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file to which operators write intermediate data that does not fit into their memory budget (e.g., the
+ * radix partitions of JoinHash) and from which they read it back later. The file is created in
+ * Hyrise::spill_directory, which should be on a local SSD, and is removed as soon as it is created, so that it
+ * disappears once it is closed, even if the process crashes.
+ *
+ * Ranges can be written and read concurrently by multiple threads. Each write appends to the file.
+ */
+class SpillFile : public Noncopyable {
+ public:
+  // A written range of the file
+  struct Range {
+    size_t offset{0};
+    size_t size{0};
+  };
+
+  explicit SpillFile(const std::filesystem::path& directory);
+  ~SpillFile();
+
+  Range write(const void* data, const size_t size);
+  void read(const Range& range, void* data) const;
+
+  // The number of bytes written in total
+  size_t size() const;
+
+  // Write and read vectors of trivially copyable values, which are stored as they are in memory
+  template <typename Vector>
+  Range write_vector(const Vector& vector) {
+    static_assert(std::is_trivially_copyable_v<typename Vector::value_type>, "Values must be trivially copyable");
+    return write(vector.data(), vector.size() * sizeof(typename Vector::value_type));
+  }
+
+  template <typename Vector>
+  void read_vector(const Range& range, Vector& vector) const {
+    static_assert(std::is_trivially_copyable_v<typename Vector::value_type>, "Values must be trivially copyable");
+    vector.resize(range.size / sizeof(typename Vector::value_type));
+    read(range, vector.data());
+  }
+
+ private:
+  int _file_descriptor{-1};
+  std::atomic<size_t> _size{0};
+};
+
+}  // namespace opossum
@@ -1,5 +1,8 @@
 #include "split_pos_list_by_chunk_id.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace opossum {
 
 PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const AbstractPosList>& input_pos_list,
@@ -18,6 +21,34 @@ PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const Abstrac
     auto& mapping = pos_lists_by_chunk_id[chunk_id];
     mapping.row_ids = std::make_shared<RowIDPosList>();
     mapping.row_ids->guarantee_single_chunk();
+  }
+
+  if (input_pos_list->is_sorted()) {
+    // The entries of each chunk form a contiguous run, which we find using a binary search and copy as a whole. The
+    // sub-lists are sorted, too.
+    const auto end = input_pos_list->cend();
+    auto run_begin = input_pos_list->cbegin();
+    while (run_begin != end) {
+      const auto chunk_id = (*run_begin).chunk_id;
+      DebugAssert(chunk_id < number_of_chunks, "Inconsistent number_of_chunks passed");
+      const auto run_end =
+          std::partition_point(run_begin, end, [&](const auto& row_id) { return row_id.chunk_id == chunk_id; });
+
+      auto& mapping = pos_lists_by_chunk_id[chunk_id];
+      mapping.row_ids->assign(run_begin, run_end);
+      mapping.original_positions.resize(std::distance(run_begin, run_end));
+      std::iota(mapping.original_positions.begin(), mapping.original_positions.end(),
+                static_cast<ChunkOffset>(std::distance(input_pos_list->cbegin(), run_begin)));
+      run_begin = run_end;
+    }
+
+    for (auto& mapping : pos_lists_by_chunk_id) {
+      mapping.row_ids->guarantee_sorted();
+    }
+    return pos_lists_by_chunk_id;
+  }
+
+  for (auto& mapping : pos_lists_by_chunk_id) {
     mapping.row_ids->reserve(input_pos_list->size() / number_of_chunks);
     mapping.original_positions.reserve(input_pos_list->size() / number_of_chunks);
   }
@@ -33,9 +33,14 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  // Create table statistics and chunk pruning statistics for added table.
-
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  // Create table statistics and chunk pruning statistics for added table. Tables parsed from binary files may come
+  // with persisted statistics, which are kept if they represent all rows of the table. Likewise, chunks that already
+  // have pruning statistics are skipped.
+  const auto& table_statistics = table->table_statistics();
+  if (!table_statistics || table_statistics->column_statistics.size() != table->column_count() ||
+      table_statistics->staleness(*table) > 0.0f) {
+    table->set_table_statistics(TableStatistics::from_table(*table));
+  }
   generate_chunk_pruning_statistics(table);
 
   _tables[name] = std::move(table);
@@ -150,6 +155,78 @@ std::unordered_map<std::string, std::shared_ptr<LQPView>> StorageManager::views(
   return result;
 }
 
+void StorageManager::add_materialized_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
+  const auto materialized_view_iter = _materialized_views.find(name);
+  Assert(materialized_view_iter == _materialized_views.end() || !materialized_view_iter->second,
+         "Cannot add materialized view " + name + " - a materialized view with the same name already exists");
+
+  auto materialized_view = std::make_shared<MaterializedView>(name, view);
+  add_table(materialized_view->partials_table_name(), materialized_view->create_partials_table());
+  materialized_view->populate();
+  add_view(name, materialized_view->make_lqp_view());
+  _materialized_views[name] = std::move(materialized_view);
+
+  // Cached plans of queries that the MaterializedViewRewriteRule could rewrite now are outdated
+  if (Hyrise::get().default_pqp_cache) Hyrise::get().default_pqp_cache->clear();
+  if (Hyrise::get().default_lqp_cache) Hyrise::get().default_lqp_cache->clear();
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  const auto materialized_view_iter = _materialized_views.find(name);
+  Assert(materialized_view_iter != _materialized_views.end() && materialized_view_iter->second,
+         "Error deleting materialized view. No such materialized view named '" + name + "'");
+
+  drop_view(name);
+  drop_table(materialized_view_iter->second->partials_table_name());
+  _materialized_views[name] = nullptr;
+
+  if (Hyrise::get().default_pqp_cache) Hyrise::get().default_pqp_cache->clear();
+  if (Hyrise::get().default_lqp_cache) Hyrise::get().default_lqp_cache->clear();
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto materialized_view_iter = _materialized_views.find(name);
+  Assert(materialized_view_iter != _materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  auto materialized_view = materialized_view_iter->second;
+  Assert(materialized_view, "Nullptr found when accessing materialized view named '" + name +
+                                "'. This can happen if a dropped materialized view is accessed.");
+
+  return materialized_view;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const {
+  const auto materialized_view_iter = _materialized_views.find(name);
+  return materialized_view_iter != _materialized_views.end() && materialized_view_iter->second;
+}
+
+std::unordered_map<std::string, std::shared_ptr<MaterializedView>> StorageManager::materialized_views() const {
+  std::unordered_map<std::string, std::shared_ptr<MaterializedView>> result;
+
+  for (const auto& [materialized_view_name, materialized_view] : _materialized_views) {
+    if (!materialized_view) continue;
+
+    result[materialized_view_name] = materialized_view;
+  }
+
+  return result;
+}
+
+std::vector<std::shared_ptr<MaterializedView>> StorageManager::materialized_views_on_table(
+    const std::shared_ptr<const Table>& table) const {
+  auto result = std::vector<std::shared_ptr<MaterializedView>>{};
+  if (_materialized_views.empty()) return result;
+
+  for (const auto& [materialized_view_name, materialized_view] : _materialized_views) {
+    if (!materialized_view) continue;
+
+    const auto table_iter = _tables.find(materialized_view->base_table_name());
+    if (table_iter != _tables.end() && table_iter->second == table) result.emplace_back(materialized_view);
+  }
+
+  return result;
+}
+
 void StorageManager::add_prepared_plan(const std::string& name, const std::shared_ptr<PreparedPlan>& prepared_plan) {
   const auto iter = _prepared_plans.find(name);
   Assert(iter == _prepared_plans.end() || !iter->second,
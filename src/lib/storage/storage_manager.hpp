@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "lqp_view.hpp"
+#include "materialized_view.hpp"
 #include "prepared_plan.hpp"
 #include "types.hpp"
 
@@ -46,6 +47,22 @@ class StorageManager : public Noncopyable {
   std::unordered_map<std::string, std::shared_ptr<LQPView>> views() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views (see MaterializedView), this is only thread-safe for operations on views with
+   * different names. Adding a materialized view adds its partials table and registers it as a view of the same name.
+   * @{
+   */
+  void add_materialized_view(const std::string& name, const std::shared_ptr<LQPView>& view);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  std::unordered_map<std::string, std::shared_ptr<MaterializedView>> materialized_views() const;
+
+  // Returns the materialized views whose base table is @param table, which the Insert and Delete operators maintain
+  std::vector<std::shared_ptr<MaterializedView>> materialized_views_on_table(
+      const std::shared_ptr<const Table>& table) const;
+  /** @} */
+
   /**
    * @defgroup Manage prepared plans - comparable to SQL PREPAREd statements, this is only thread-safe for operations on prepared plans with different names
    * @{
@@ -70,6 +87,8 @@ class StorageManager : public Noncopyable {
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<Table>> _tables{_INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>> _views{_INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans{_INITIAL_MAP_SIZE};
+  tbb::concurrent_unordered_map<std::string, std::shared_ptr<MaterializedView>> _materialized_views{
+      _INITIAL_MAP_SIZE};
 };
 
 std::ostream& operator<<(std::ostream& stream, const StorageManager& storage_manager);
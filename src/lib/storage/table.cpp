@@ -1,18 +1,35 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <boost/hana/for_each.hpp>
+
+#include "concurrency/epoch_manager.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/index/table/table_index.hpp"
+#include "storage/row_group_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table_partitioning.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -29,7 +46,9 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _indexes_mutex(std::make_unique<std::shared_mutex>()),
+      _discovered_key_constraints_mutex(std::make_unique<std::mutex>()) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
   DebugAssert(!target_chunk_size || *target_chunk_size > 0, "Table must have a chunk size greater than 0.");
@@ -39,7 +58,10 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
              std::vector<std::shared_ptr<Chunk>>&& chunks, const UseMvcc use_mvcc)
     : Table(column_definitions, type, type == TableType::Data ? std::optional{Chunk::DEFAULT_SIZE} : std::nullopt,
             use_mvcc) {
-  _chunks = {chunks.begin(), chunks.end()};
+  _chunks.grow_by(chunks.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunks.size(); ++chunk_id) {
+    _chunks[chunk_id] = new std::shared_ptr<Chunk>(std::move(chunks[chunk_id]));
+  }
 
   if constexpr (HYRISE_DEBUG) {
     const auto chunk_count = _chunks.size();
@@ -118,36 +140,71 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  auto last_chunk = !_chunks.empty() ? get_chunk(ChunkID{chunk_count() - 1}) : nullptr;
-  if (!last_chunk || last_chunk->size() >= _target_chunk_size || !last_chunk->is_mutable()) {
+  auto partition_id = std::optional<PartitionID>{};
+  if (_partitioning) {
+    partition_id = _partitioning->partition_for(values.at(_partitioning->column_id()));
+  }
+
+  auto chunk_id = last_chunk_id(partition_id);
+  auto last_chunk = chunk_id ? get_chunk(*chunk_id) : nullptr;
+  if (!last_chunk || !last_chunk->is_mutable() || last_chunk->size() >= mutable_chunk_capacity(*last_chunk)) {
     // One chunk reached its capacity and was not finalized before.
     if (last_chunk && last_chunk->is_mutable()) {
       last_chunk->finalize();
+      create_chunk_indexes(*chunk_id);
     }
 
-    append_mutable_chunk();
-    last_chunk = get_chunk(ChunkID{chunk_count() - 1});
+    append_mutable_chunk(partition_id);
+    chunk_id = last_chunk_id(partition_id);
+    last_chunk = get_chunk(*chunk_id);
   }
 
   last_chunk->append(values);
+
+  const auto chunk_offset = ChunkOffset{last_chunk->size() - 1};
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(*chunk_id, *last_chunk->get_segment(table_index->column_id()), chunk_offset, chunk_offset + 1);
+  }
 }
 
-void Table::append_mutable_chunk() {
-  Segments segments;
-  for (const auto& column_definition : _column_definitions) {
+void Table::append_mutable_chunk(const std::optional<PartitionID> partition_id) {
+  const auto target_chunk_size = this->target_chunk_size();
+  Segments segments(_column_definitions.size());
+  for (const auto& column_group : _column_groups) {
+    auto data_types = std::vector<DataType>{};
+    data_types.reserve(column_group.size());
+    for (const auto column_id : column_group) {
+      data_types.emplace_back(_column_definitions[column_id].data_type);
+    }
+
+    const auto row_group = std::make_shared<RowGroup>(data_types, target_chunk_size);
+    for (auto group_column_id = ColumnID{0}; group_column_id < column_group.size(); ++group_column_id) {
+      const auto& column_definition = _column_definitions[column_group[group_column_id]];
+      resolve_data_type(column_definition.data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segments[column_group[group_column_id]] = std::make_shared<RowGroupSegment<ColumnDataType>>(
+            row_group, group_column_id, column_definition.nullable);
+      });
+    }
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < _column_definitions.size(); ++column_id) {
+    if (segments[column_id]) continue;
+
+    const auto& column_definition = _column_definitions[column_id];
     resolve_data_type(column_definition.data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
-      segments.push_back(
-          std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable, _target_chunk_size));
+      segments[column_id] =
+          std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable, target_chunk_size);
     });
   }
 
   std::shared_ptr<MvccData> mvcc_data;
   if (_use_mvcc == UseMvcc::Yes) {
-    mvcc_data = std::make_shared<MvccData>(_target_chunk_size, MvccData::MAX_COMMIT_ID);
+    mvcc_data = std::make_shared<MvccData>(target_chunk_size, MvccData::MAX_COMMIT_ID);
   }
 
-  append_chunk(segments, mvcc_data);
+  append_chunk(segments, mvcc_data, std::nullopt, partition_id);
 }
 
 uint64_t Table::row_count() const {
@@ -176,6 +233,13 @@ uint64_t Table::row_count() const {
 
 bool Table::empty() const { return row_count() == 0u; }
 
+Table::~Table() {
+  // No other thread can access the table anymore, so the holders are deleted right away
+  for (const auto& chunk_slot : _chunks) {
+    delete chunk_slot.load();
+  }
+}
+
 ChunkID Table::chunk_count() const { return ChunkID{static_cast<ChunkID::base_type>(_chunks.size())}; }
 
 ChunkOffset Table::target_chunk_size() const {
@@ -183,34 +247,63 @@ ChunkOffset Table::target_chunk_size() const {
   return _target_chunk_size;
 }
 
+void Table::set_target_chunk_size(const ChunkOffset target_chunk_size) {
+  Assert(_type == TableType::Data, "target_chunk_size is only valid for data tables");
+  // The mutable chunks of tables without MVCC data do not tell how many rows were pre-allocated for them
+  Assert(_use_mvcc == UseMvcc::Yes, "Only the target chunk size of tables with MVCC data can be changed");
+  Assert(target_chunk_size > 0 && target_chunk_size <= Chunk::MAX_SIZE, "Invalid target chunk size");
+
+  const auto append_lock = acquire_append_mutex();
+  _target_chunk_size = target_chunk_size;
+}
+
+ChunkOffset Table::mutable_chunk_capacity(const Chunk& chunk) const {
+  const auto target_chunk_size = this->target_chunk_size();
+  if (!chunk.has_mvcc_data()) return target_chunk_size;
+
+  // Chunks allocated before the target chunk size was increased cannot hold more rows than they were allocated for
+  return std::min(target_chunk_size, chunk.mvcc_data()->capacity());
+}
+
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  if (_type == TableType::References) {
-    // Not written concurrently, since reference tables are not modified anymore once they are written.
-    return _chunks[chunk_id];
-  } else {
-    return std::atomic_load(&_chunks[chunk_id]);
-  }
+  return _load_chunk(_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  if (_type == TableType::References) {
-    // see comment in non-const function
-    return _chunks[chunk_id];
-  } else {
-    return std::atomic_load(&_chunks[chunk_id]);
-  }
+  return _load_chunk(_chunks[chunk_id]);
 }
 
 std::shared_ptr<Chunk> Table::last_chunk() const {
   DebugAssert(!_chunks.empty(), "last_chunk() called on Table without chunks");
+  return _load_chunk(_chunks.back());
+}
+
+std::optional<ChunkID> Table::last_chunk_id(const std::optional<PartitionID> partition_id) const {
+  if (!_partitioning) {
+    DebugAssert(!partition_id, "Table is not partitioned");
+    if (_chunks.empty()) return std::nullopt;
+    return ChunkID{chunk_count() - 1};
+  }
+
+  DebugAssert(partition_id && *partition_id < _partition_last_chunk_ids.size(), "Invalid partition");
+  const auto chunk_id = _partition_last_chunk_ids[*partition_id];
+  if (chunk_id == INVALID_CHUNK_ID) return std::nullopt;
+  return chunk_id;
+}
+
+std::shared_ptr<Chunk> Table::_load_chunk(const ChunkSlot& chunk_slot) const {
   if (_type == TableType::References) {
     // Not written concurrently, since reference tables are not modified anymore once they are written.
-    return _chunks.back();
-  } else {
-    return std::atomic_load(&_chunks.back());
+    const auto* const chunk_holder = chunk_slot.load(std::memory_order_acquire);
+    return chunk_holder ? *chunk_holder : nullptr;
   }
+
+  // The holder cannot be deleted while the epoch is pinned, even if remove_chunk() unlinks it concurrently
+  const auto epoch_guard = EpochManager::get().pin();
+  const auto* const chunk_holder = chunk_slot.load();
+  return chunk_holder ? *chunk_holder : nullptr;
 }
 
 void Table::remove_chunk(ChunkID chunk_id) {
@@ -221,13 +314,17 @@ void Table::remove_chunk(ChunkID chunk_id) {
               }()),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
-  std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
+  auto* const chunk_holder = _chunks[chunk_id].exchange(nullptr);
+  EpochManager::get().retire(chunk_holder);
 }
 
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
-                         const std::optional<PolymorphicAllocator<Chunk>>& alloc) {
+                         const std::optional<PolymorphicAllocator<Chunk>>& alloc,
+                         const std::optional<PartitionID> partition_id) {
   Assert(_type != TableType::Data || static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes),
          "Supply MvccData to data Tables if MVCC is enabled.");
+  Assert(static_cast<bool>(partition_id) == static_cast<bool>(_partitioning),
+         "Supply a PartitionID iff the Table is partitioned.");
   AssertInput(static_cast<ColumnCount::base_type>(segments.size()) == column_count(),
               "Input does not have the same number of columns.");
 
@@ -250,11 +347,45 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
 
   // tbb::concurrent_vector does not guarantee that elements reported by size() are fully initialized yet:
   // https://software.intel.com/en-us/blogs/2009/04/09/delusion-of-tbbconcurrent_vectors-size-or-3-ways-to-traverse-in-parallel-correctly  // NOLINT
-  // To avoid someone reading an incomplete shared_ptr<Chunk>, we (1) use the zero_allocator for the concurrent_vector,
-  // making sure that an uninitialized entry compares equal to nullptr and (2) insert the desired chunk atomically.
+  // To avoid someone reading an incomplete entry, we (1) use the zero_allocator for the concurrent_vector, making sure
+  // that an uninitialized entry is a nullptr and (2) publish the holder of the desired chunk atomically.
+
+  auto chunk = std::make_shared<Chunk>(segments, mvcc_data, alloc);
+  if (partition_id) {
+    chunk->set_partition(_partitioning, *partition_id);
+  }
 
-  auto new_chunk_iter = _chunks.push_back(nullptr);
-  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  auto new_chunk_iter = _chunks.push_back(ChunkSlot{nullptr});
+  new_chunk_iter->store(new std::shared_ptr<Chunk>(std::move(chunk)));
+  const auto chunk_id = static_cast<ChunkID>(std::distance(_chunks.begin(), new_chunk_iter));
+
+  if (partition_id) {
+    _partition_last_chunk_ids[*partition_id] = chunk_id;
+  }
+
+  if (!_table_indexes.empty()) {
+    for (const auto& table_index : _table_indexes) {
+      const auto& segment = *segments[table_index->column_id()];
+      table_index->insert(chunk_id, segment, ChunkOffset{0}, segment.size());
+    }
+  }
+
+  // The rows of the new chunk were not validated for the discovered key constraints. The version is increased after
+  // the chunk is visible, so that validations that started before either saw the chunk or cannot add their constraint.
+  if (_type == TableType::Data) {
+    auto dropped_constraints = false;
+    {
+      const auto lock = std::lock_guard<std::mutex>{*_discovered_key_constraints_mutex};
+      ++_discovered_key_constraints_version;
+      dropped_constraints = !_discovered_key_constraints.empty();
+      _discovered_key_constraints.clear();
+    }
+
+    if (dropped_constraints) {
+      if (Hyrise::get().default_pqp_cache) Hyrise::get().default_pqp_cache->clear();
+      if (Hyrise::get().default_lqp_cache) Hyrise::get().default_lqp_cache->clear();
+    }
+  }
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -313,13 +444,87 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+std::vector<IndexStatistics> Table::indexes_statistics() const {
+  const auto lock = std::shared_lock{*_indexes_mutex};
+  return _indexes;
+}
+
+void Table::remove_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type) {
+  const auto lock = std::unique_lock{*_indexes_mutex};
+  const auto index_statistics_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& statistics) {
+    return statistics.column_ids == column_ids && statistics.type == index_type;
+  });
+  Assert(index_statistics_it != _indexes.cend(), "Table has no index of that type on the columns.");
+  _indexes.erase(index_statistics_it);
+}
+
+void Table::create_chunk_indexes(const ChunkID chunk_id) {
+  const auto chunk = get_chunk(chunk_id);
+  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  if (chunk->is_mutable()) return;
+
+  for (const auto& index_statistics : indexes_statistics()) {
+    const auto& column_ids = index_statistics.column_ids;
+    if (chunk->get_index(index_statistics.type, column_ids)) continue;
+    if (!_chunk_supports_index(*chunk, index_statistics.type, column_ids)) continue;
+
+    hana::for_each(detail::segment_index_map, [&](const auto index_pair) {
+      if (hana::second(index_pair) != index_statistics.type) return;
+
+      using Index = typename decltype(+hana::first(index_pair))::type;
+      chunk->create_index<Index>(column_ids);
+    });
+  }
 }
 
-std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
+void Table::_create_index_on_chunks(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type,
+                                    const std::function<void(Chunk&)>& create_chunk_index,
+                                    const ChunkProgressCallback& progress_callback) {
+  Hyrise::get().job_partitioner.for_each_chunk(
+      *this,
+      [&](const ChunkID chunk_id) {
+        const auto chunk = get_chunk(chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        if (chunk->is_mutable() || !_chunk_supports_index(*chunk, index_type, column_ids)) return;
+        create_chunk_index(*chunk);
+      },
+      progress_callback);
+}
+
+bool Table::_chunk_supports_index(const Chunk& chunk, const SegmentIndexType index_type,
+                                  const std::vector<ColumnID>& column_ids) {
+  if (index_type == SegmentIndexType::BTree || index_type == SegmentIndexType::Hash) return true;
+
+  return std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk.get_segment(column_id));
+    if (!dictionary_segment) return false;
+    if (index_type != SegmentIndexType::CompositeGroupKey) return true;
+
+    const auto compressed_vector_type = dictionary_segment->compressed_vector_type();
+    return compressed_vector_type && is_fixed_size_byte_aligned(*compressed_vector_type);
+  });
+}
+
+void Table::create_table_index(const ColumnID column_id) {
+  Assert(!get_table_index(column_id), "Column already has a TableIndex.");
+  _table_indexes.emplace_back(std::make_shared<TableIndex>(*this, column_id));
+}
+
+std::shared_ptr<TableIndex> Table::get_table_index(const ColumnID column_id) const {
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_id() == column_id) return table_index;
+  }
+  return nullptr;
+}
+
+const std::vector<std::shared_ptr<TableIndex>>& Table::table_indexes() const { return _table_indexes; }
 
 const TableKeyConstraints& Table::soft_key_constraints() const { return _table_key_constraints; }
 
@@ -354,6 +559,56 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   }
 }
 
+const ForeignKeyConstraints& Table::soft_foreign_key_constraints() const { return _foreign_key_constraints; }
+
+void Table::add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint) {
+  Assert(_type == TableType::Data, "Foreign key constraints are not tracked for reference tables across the PQP.");
+
+  for (const auto& column_id : foreign_key_constraint.foreign_key_columns()) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+  }
+
+  {
+    auto scoped_lock = acquire_append_mutex();
+
+    for (const auto& existing_constraint : _foreign_key_constraints) {
+      Assert(foreign_key_constraint != existing_constraint, "The foreign key constraint has already been defined.");
+    }
+
+    _foreign_key_constraints.push_back(foreign_key_constraint);
+  }
+}
+
+TableKeyConstraints Table::discovered_soft_key_constraints() const {
+  const auto lock = std::lock_guard<std::mutex>{*_discovered_key_constraints_mutex};
+  return _discovered_key_constraints;
+}
+
+uint64_t Table::discovered_soft_key_constraints_version() const {
+  const auto lock = std::lock_guard<std::mutex>{*_discovered_key_constraints_mutex};
+  return _discovered_key_constraints_version;
+}
+
+bool Table::add_discovered_soft_key_constraint(const TableKeyConstraint& table_key_constraint,
+                                               const uint64_t version) {
+  Assert(_type == TableType::Data, "Key constraints are not tracked for reference tables across the PQP.");
+  Assert(table_key_constraint.key_type() == KeyConstraintType::UNIQUE, "Discovered key constraints must be UNIQUE.");
+
+  const auto lock = std::lock_guard<std::mutex>{*_discovered_key_constraints_mutex};
+  if (version != _discovered_key_constraints_version) return false;
+
+  const auto is_known = [&](const auto& existing_constraint) {
+    return existing_constraint.columns() == table_key_constraint.columns();
+  };
+  if (std::any_of(_table_key_constraints.cbegin(), _table_key_constraints.cend(), is_known) ||
+      std::any_of(_discovered_key_constraints.cbegin(), _discovered_key_constraints.cend(), is_known)) {
+    return false;
+  }
+
+  _discovered_key_constraints.push_back(table_key_constraint);
+  return true;
+}
+
 const std::vector<ColumnID>& Table::value_clustered_by() const { return _value_clustered_by; }
 
 void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by) {
@@ -395,6 +650,57 @@ void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_
   _value_clustered_by = value_clustered_by;
 }
 
+const std::vector<std::vector<ColumnID>>& Table::column_groups() const { return _column_groups; }
+
+void Table::set_column_groups(const std::vector<std::vector<ColumnID>>& column_groups) {
+  Assert(_type == TableType::Data, "Only data tables can have column groups");
+
+  auto grouped_column_ids = std::unordered_set<ColumnID>{};
+  for (const auto& column_group : column_groups) {
+    Assert(!column_group.empty(), "Column groups must not be empty");
+    for (const auto column_id : column_group) {
+      Assert(column_id < column_count(), "ColumnID out of range");
+      Assert(grouped_column_ids.emplace(column_id).second, "Column is part of multiple column groups");
+    }
+  }
+
+  _column_groups = column_groups;
+}
+
+const std::shared_ptr<const TablePartitioning>& Table::partitioning() const { return _partitioning; }
+
+void Table::set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning) {
+  Assert(_type == TableType::Data, "Only data tables can be partitioned");
+  Assert(partitioning, "Tables cannot be unpartitioned");
+  Assert(partitioning->column_id() < column_count(), "ColumnID out of range");
+  Assert(!partitioning->data_type() || *partitioning->data_type() == column_data_type(partitioning->column_id()),
+         "Partitioning does not match the data type of the column");
+  Assert(_chunks.empty() || (_partitioning && partitioning->extends(*_partitioning)),
+         "Only tables without chunks can be partitioned, afterwards, the partitioning can only be extended");
+
+  _partitioning = partitioning;
+  _partition_last_chunk_ids.resize(_partitioning->partition_count(), INVALID_CHUNK_ID);
+}
+
+void Table::drop_partition(const PartitionID partition_id) {
+  Assert(_partitioning && partition_id < _partitioning->partition_count(), "Partition does not exist");
+
+  const auto append_lock = acquire_append_mutex();
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk || chunk->partition_id() != partition_id) continue;
+
+    auto* const chunk_holder = _chunks[chunk_id].exchange(nullptr);
+    EpochManager::get().retire(chunk_holder);
+  }
+  _partition_last_chunk_ids[partition_id] = INVALID_CHUNK_ID;
+}
+
+uint64_t Table::version() const { return _version.load(); }
+
+void Table::increase_version() const { ++_version; }
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -410,6 +716,10 @@ size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->memory_consumption();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
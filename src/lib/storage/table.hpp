@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,15 +12,20 @@
 #include "abstract_segment.hpp"
 #include "boost/variant.hpp"
 #include "chunk.hpp"
+#include "foreign_key_constraint.hpp"
+#include "scheduler/job_partitioner.hpp"
 #include "storage/index/index_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "table_key_constraint.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+class TableIndex;
+class TablePartitioning;
 class TableStatistics;
 
 /**
@@ -38,6 +46,8 @@ class Table : private Noncopyable {
   Table(const TableColumnDefinitions& column_definitions, const TableType type,
         std::vector<std::shared_ptr<Chunk>>&& chunks, const UseMvcc use_mvcc = UseMvcc::No);
 
+  ~Table();
+
   /**
    * @defgroup Getter and convenience functions for the column definitions
    * @{
@@ -68,6 +78,17 @@ class Table : private Noncopyable {
   // For data tables, returns the target chunk size (i.e., the number of rows pre-allocated in the ValueSegment).
   ChunkOffset target_chunk_size() const;
 
+  /**
+   * Changes the target chunk size of a data table with MVCC data. Chunks appended afterwards pre-allocate the new
+   * number of rows. Mutable chunks that were allocated before are full once they reach the smaller of both sizes (see
+   * mutable_chunk_capacity()). Existing chunks are not split or merged here. The MvccDeletePlugin merges the chunks
+   * that are small compared to the new size.
+   */
+  void set_target_chunk_size(const ChunkOffset target_chunk_size);
+
+  // Returns the number of rows after which the given mutable chunk of the table is full
+  ChunkOffset mutable_chunk_capacity(const Chunk& chunk) const;
+
   // Returns the number of rows.
   // This number includes invalidated (deleted) rows.
   uint64_t row_count() const;
@@ -94,6 +115,10 @@ class Table : private Noncopyable {
 
   std::shared_ptr<Chunk> last_chunk() const;
 
+  // Returns the ID of the last chunk of the given partition or, for tables that are not partitioned, of the table.
+  // Returns nullopt if there is none. Used to find the chunk that rows are appended to.
+  std::optional<ChunkID> last_chunk_id(const std::optional<PartitionID> partition_id = std::nullopt) const;
+
   /**
    * Removes the chunk with the given id.
    * Makes sure that the the chunk was fully invalidated by the logical delete before deleting it physically.
@@ -107,13 +132,15 @@ class Table : private Noncopyable {
    *
    * Asserts that the @param segments match with the TableType (only ReferenceSegments or only data containing segments)
    *
-   * @param mvcc_data   Has to be passed in iff the Table is a data Table that uses MVCC
+   * @param mvcc_data     Has to be passed in iff the Table is a data Table that uses MVCC
+   * @param partition_id  Has to be passed in iff the Table is partitioned, all rows must belong to the partition
    */
   void append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data = nullptr,
-                    const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt);
+                    const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt,
+                    const std::optional<PartitionID> partition_id = std::nullopt);
 
-  // Create and append a Chunk consisting of ValueSegments.
-  void append_mutable_chunk();
+  // Create and append a Chunk consisting of ValueSegments, or RowGroupSegments for the columns of column_groups().
+  void append_mutable_chunk(const std::optional<PartitionID> partition_id = std::nullopt);
   /** @} */
 
   /**
@@ -137,7 +164,7 @@ class Table : private Noncopyable {
     size_t row_counter = 0u;
     const auto chunk_count = _chunks.size();
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      auto chunk = std::atomic_load(&_chunks[chunk_id]);
+      const auto chunk = get_chunk(chunk_id);
       if (!chunk) continue;
 
       size_t current_size = chunk->size();
@@ -171,7 +198,8 @@ class Table : private Noncopyable {
 
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. They can be replaced (e.g., by the ChunkCompressionTask, see
+   * TableStatistics::with_chunk()) while other threads optimize queries on the table.
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -181,21 +209,51 @@ class Table : private Noncopyable {
 
   std::vector<IndexStatistics> indexes_statistics() const;
 
+  /**
+   * Chunk indexes are only created for immutable chunks, as they would not reflect the rows inserted into a mutable
+   * chunk later on. See create_table_index() for indexing these rows. Chunks that become immutable or whose segments
+   * are replaced by the ChunkEncoder, which drops the indexes of the replaced segments, receive the indexes of
+   * indexes_statistics() via create_chunk_indexes(). Chunks whose segments do not support the index type are skipped
+   * (see create_chunk_indexes()), as chunks can become immutable while the index is created. The chunk indexes are
+   * built in parallel, see JobPartitioner::for_each_chunk(). progress_callback is called after each chunk.
+   */
   template <typename Index>
-  void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
+  void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "",
+                    const ChunkProgressCallback& progress_callback = {}) {
     SegmentIndexType index_type = get_index_type_of<Index>();
 
-    const auto chunk_count = _chunks.size();
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      auto chunk = std::atomic_load(&_chunks[chunk_id]);
-      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-      chunk->create_index<Index>(column_ids);
-    }
+    _create_index_on_chunks(
+        column_ids, index_type, [&](Chunk& chunk) { chunk.create_index<Index>(column_ids); }, progress_callback);
     IndexStatistics index_statistics = {column_ids, name, index_type};
+    const auto lock = std::unique_lock{*_indexes_mutex};
     _indexes.emplace_back(index_statistics);
   }
 
+  /**
+   * Removes the index from indexes_statistics(), so that new plans do not use it and it is not created for further
+   * chunks. The existing chunk indexes are kept, as running queries might still use them. They can be removed from
+   * the chunks (see Chunk::remove_index()) once these queries are finished.
+   */
+  void remove_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type);
+
+  // Creates the indexes of indexes_statistics() that the chunk does not have yet. Mutable chunks are skipped, as are
+  // indexes that cannot be built over the chunk's segments, e.g., GroupKeyIndexes over non-dictionary segments.
+  void create_chunk_indexes(const ChunkID chunk_id);
+
+  /**
+   * In contrast to the chunk indexes above, a TableIndex indexes a column of all chunks, including the mutable ones.
+   * It is maintained by append(), append_chunk(), and the Insert operator (see TableIndex). It must not be created
+   * concurrently with inserts into the table.
+   * @{
+   */
+  void create_table_index(const ColumnID column_id);
+
+  // Returns nullptr if the column has no TableIndex
+  std::shared_ptr<TableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<TableIndex>>& table_indexes() const;
+  /** @} */
+
   /**
    * NOTE: Key constraints are currently NOT ENFORCED and are only used to develop optimization rules.
    * We call them "soft" key constraints to draw attention to that.
@@ -203,6 +261,26 @@ class Table : private Noncopyable {
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
 
+  /**
+   * Like key constraints, foreign key constraints are NOT ENFORCED. The referenced table is identified by its name in
+   * the StorageManager and does not need to exist when the constraint is added.
+   */
+  void add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint);
+  const ForeignKeyConstraints& soft_foreign_key_constraints() const;
+
+  /**
+   * Soft key constraints can also be discovered in the data instead of being declared (see UccDiscoveryPlugin). They
+   * only hold for the validated rows, which must be in immutable chunks. As rows are then only added in new chunks, the
+   * discovered constraints are dropped whenever a chunk is appended, together with the cached plans that might rely on
+   * them. A validation reads the version before it looks at the chunks. add_discovered_soft_key_constraint() only adds
+   * the constraint if no chunk was appended since, i.e., the version is unchanged, and returns whether it did.
+   * @{
+   */
+  TableKeyConstraints discovered_soft_key_constraints() const;
+  uint64_t discovered_soft_key_constraints_version() const;
+  bool add_discovered_soft_key_constraint(const TableKeyConstraint& table_key_constraint, const uint64_t version);
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -221,32 +299,99 @@ class Table : private Noncopyable {
   const std::vector<ColumnID>& value_clustered_by() const;
   void set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by);
 
+  /**
+   * Columns that are mostly read and written together, e.g., by OLTP procedures that access whole rows, can be stored
+   * in column groups. In mutable chunks appended afterwards, the values of a group are stored row by row in a RowGroup
+   * (see row_group_segment.hpp). Encoding a chunk turns the groups into columnar segments. Each column may be part of
+   * at most one group. Not thread-safe, set the groups before the table is modified concurrently.
+   */
+  const std::vector<std::vector<ColumnID>>& column_groups() const;
+  void set_column_groups(const std::vector<std::vector<ColumnID>>& column_groups);
+
+  /**
+   * Data tables can be partitioned horizontally by the values of one column (see TablePartitioning). Each chunk then
+   * holds the rows of a single partition, which append() and the Insert operator route the rows to. The
+   * ChunkPruningRule and the TableScan skip the chunks of partitions that cannot match a predicate, also when the
+   * chunks are still mutable. The partitioning can be set on a table without chunks and later be replaced by one that
+   * extends it, e.g., by the partition of the next month (see TablePartitioning::extends()). Not thread-safe, the
+   * partitioning must not be changed while rows are inserted.
+   * @{
+   */
+  const std::shared_ptr<const TablePartitioning>& partitioning() const;
+  void set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning);
+
+  // Physically removes all chunks of the partition at once, without invalidating their rows first. Like dropping a
+  // table, this is not transactional: Queries that already retrieved the chunks still see their rows. The partition
+  // remains part of the partitioning and can receive new rows. Must not run concurrently with inserts into the
+  // partition.
+  void drop_partition(const PartitionID partition_id);
+  /** @} */
+
+  /**
+   * The version of a data table is increased after each published commit of a transaction that inserted rows into or
+   * deleted rows from the table (see TransactionContext::register_modified_table). As long as the version is the same,
+   * all snapshots taken since see the same rows. Used to invalidate cached results (see sql_result_cache.hpp).
+   */
+  uint64_t version() const;
+  void increase_version() const;
+
  protected:
+  using ChunkSlot = copyable_atomic<std::shared_ptr<Chunk>*>;
+
+  // Copies the shared pointer of the chunk (or nullptr if it was removed), see _chunks
+  std::shared_ptr<Chunk> _load_chunk(const ChunkSlot& chunk_slot) const;
+
+  // The BTreeIndex and the HashIndex work on segments of any encoding, the other indexes use the dictionaries of
+  // DictionarySegments (see their constructors)
+
+  static bool _chunk_supports_index(const Chunk& chunk, const SegmentIndexType index_type,
+                                    const std::vector<ColumnID>& column_ids);
+
+  // Calls create_chunk_index for the immutable chunks that support the index, see create_index(). Not part of the
+  // template so that table.hpp does not need to include hyrise.hpp.
+  void _create_index_on_chunks(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type,
+                               const std::function<void(Chunk&)>& create_chunk_index,
+                               const ChunkProgressCallback& progress_callback);
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
-  const ChunkOffset _target_chunk_size;
+  // Written under the append mutex, so that Insert sees the same value while it allocates rows
+  std::atomic<ChunkOffset> _target_chunk_size;
 
   /**
-   * To prevent data races for TableType::Data tables, we must access _chunks atomically.
-   * This is due to the existence of the MvccDeletePlugin, which might modify shared pointers from a separate thread.
-   *
-   * With C++20 we will get std::atomic<std::shared_ptr<T>>, which allows us to omit the std::atomic_load() and
-   * std::atomic_store() function calls.
+   * The MvccDeletePlugin removes chunks of TableType::Data tables while other threads access them. Instead of
+   * std::atomic_load() on the shared pointers, which locks one of a few global mutexes in libstdc++, each entry points
+   * to a heap-allocated holder of the chunk's shared pointer. Holders are never modified once they are published.
+   * Readers pin an epoch and copy the shared pointer of a holder, while remove_chunk() unlinks the holder and retires
+   * it in the EpochManager, which deletes it once no reader can still be copying it.
    *
    * For the zero_allocator, see the implementation of Table::append_chunk.
    */
-  tbb::concurrent_vector<std::shared_ptr<Chunk>, tbb::zero_allocator<std::shared_ptr<Chunk>>> _chunks;
+  tbb::concurrent_vector<ChunkSlot, tbb::zero_allocator<ChunkSlot>> _chunks;
 
   TableKeyConstraints _table_key_constraints;
+  ForeignKeyConstraints _foreign_key_constraints;
 
   std::vector<ColumnID> _value_clustered_by;
+  std::vector<std::vector<ColumnID>> _column_groups;
+  std::shared_ptr<const TablePartitioning> _partitioning;
+  // For partitioned tables, the last chunk of each partition or INVALID_CHUNK_ID, see last_chunk_id()
+  std::vector<ChunkID> _partition_last_chunk_ids;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::unique_ptr<std::shared_mutex> _indexes_mutex;
+  std::vector<std::shared_ptr<TableIndex>> _table_indexes;
+
+  TableKeyConstraints _discovered_key_constraints;
+  uint64_t _discovered_key_constraints_version{0};
+  std::unique_ptr<std::mutex> _discovered_key_constraints_mutex;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
   mutable std::optional<uint64_t> _cached_row_count;
+
+  mutable std::atomic<uint64_t> _version{0};
 };
 }  // namespace opossum
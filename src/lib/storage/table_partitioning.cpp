@@ -0,0 +1,206 @@
+#include "table_partitioning.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns whether the value of a list partition might match the predicate. Conditions that are not evaluated here
+// never rule out a partition.
+bool value_may_match(const AllTypeVariant& partition_value, const PredicateCondition predicate_condition,
+                     const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return partition_value == value;
+    case PredicateCondition::NotEquals:
+      return !(partition_value == value);
+    case PredicateCondition::LessThan:
+      return partition_value < value;
+    case PredicateCondition::LessThanEquals:
+      return !(value < partition_value);
+    case PredicateCondition::GreaterThan:
+      return value < partition_value;
+    case PredicateCondition::GreaterThanEquals:
+      return !(partition_value < value);
+    case PredicateCondition::BetweenInclusive:
+      return !(partition_value < value) && !(*value2 < partition_value);
+    case PredicateCondition::BetweenLowerExclusive:
+      return value < partition_value && !(*value2 < partition_value);
+    case PredicateCondition::BetweenUpperExclusive:
+      return !(partition_value < value) && partition_value < *value2;
+    case PredicateCondition::BetweenExclusive:
+      return value < partition_value && partition_value < *value2;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+TablePartitioning::TablePartitioning(const PartitioningType type, const ColumnID column_id,
+                                     const PartitionID partition_count)
+    : _type(type), _column_id(column_id), _partition_count(partition_count) {}
+
+std::shared_ptr<const TablePartitioning> TablePartitioning::range(const ColumnID column_id,
+                                                                  const std::vector<AllTypeVariant>& bounds) {
+  Assert(bounds.size() >= 2, "A range partitioning needs at least two bounds");
+  const auto data_type = data_type_from_all_type_variant(bounds.front());
+  for (auto bound_id = size_t{0}; bound_id < bounds.size(); ++bound_id) {
+    Assert(!variant_is_null(bounds[bound_id]) && data_type_from_all_type_variant(bounds[bound_id]) == data_type,
+           "Bounds must be non-NULL values of the same data type");
+    Assert(bound_id == 0 || bounds[bound_id - 1] < bounds[bound_id], "Bounds must be strictly increasing");
+  }
+
+  auto partitioning = std::shared_ptr<TablePartitioning>(
+      new TablePartitioning(PartitioningType::Range, column_id, PartitionID{static_cast<uint32_t>(bounds.size() - 1)}));
+  partitioning->_bounds = bounds;
+  return partitioning;
+}
+
+std::shared_ptr<const TablePartitioning> TablePartitioning::list(
+    const ColumnID column_id, const std::vector<std::vector<AllTypeVariant>>& values) {
+  Assert(!values.empty() && !values.front().empty(), "A list partitioning needs at least one value");
+
+  auto partitioning = std::shared_ptr<TablePartitioning>(
+      new TablePartitioning(PartitioningType::List, column_id, PartitionID{static_cast<uint32_t>(values.size())}));
+  const auto data_type = data_type_from_all_type_variant(values.front().front());
+  for (auto partition_id = PartitionID{0}; partition_id < values.size(); ++partition_id) {
+    Assert(!values[partition_id].empty(), "Each partition needs at least one value");
+    for (const auto& value : values[partition_id]) {
+      Assert(!variant_is_null(value) && data_type_from_all_type_variant(value) == data_type,
+             "Listed values must be non-NULL values of the same data type");
+      const auto inserted = partitioning->_partition_by_value.emplace(value, partition_id).second;
+      Assert(inserted, "Each value may only be listed for one partition");
+    }
+
+    auto sorted_values = values[partition_id];
+    std::sort(sorted_values.begin(), sorted_values.end());
+    partitioning->_values.emplace_back(std::move(sorted_values));
+  }
+  return partitioning;
+}
+
+std::shared_ptr<const TablePartitioning> TablePartitioning::hash(const ColumnID column_id,
+                                                                 const PartitionID partition_count) {
+  Assert(partition_count > 0, "A hash partitioning needs at least one partition");
+  return std::shared_ptr<TablePartitioning>(new TablePartitioning(PartitioningType::Hash, column_id, partition_count));
+}
+
+PartitioningType TablePartitioning::type() const { return _type; }
+
+ColumnID TablePartitioning::column_id() const { return _column_id; }
+
+PartitionID TablePartitioning::partition_count() const { return _partition_count; }
+
+std::optional<DataType> TablePartitioning::data_type() const {
+  switch (_type) {
+    case PartitioningType::Range:
+      return data_type_from_all_type_variant(_bounds.front());
+    case PartitioningType::List:
+      return data_type_from_all_type_variant(_values.front().front());
+    case PartitioningType::Hash:
+      return std::nullopt;
+  }
+  Fail("Invalid enum value");
+}
+
+PartitionID TablePartitioning::partition_for(const AllTypeVariant& value) const {
+  switch (_type) {
+    case PartitioningType::Range: {
+      AssertInput(!variant_is_null(value), "NULL values cannot be inserted into range partitioned tables");
+      const auto bound_id = std::distance(_bounds.begin(), std::upper_bound(_bounds.begin(), _bounds.end(), value));
+      AssertInput(bound_id > 0 && static_cast<size_t>(bound_id) < _bounds.size(),
+                  "Value is outside of the bounds of all partitions");
+      return PartitionID{static_cast<uint32_t>(bound_id - 1)};
+    }
+
+    case PartitioningType::List: {
+      AssertInput(!variant_is_null(value), "NULL values cannot be inserted into list partitioned tables");
+      const auto iter = _partition_by_value.find(value);
+      AssertInput(iter != _partition_by_value.end(), "Value is not listed for any partition");
+      return iter->second;
+    }
+
+    case PartitioningType::Hash:
+      if (variant_is_null(value)) return PartitionID{0};
+      return PartitionID{static_cast<uint32_t>(std::hash<AllTypeVariant>{}(value) % _partition_count)};
+  }
+  Fail("Invalid enum value");
+}
+
+bool TablePartitioning::does_not_contain(const PartitionID partition_id, const ColumnID column_id,
+                                         const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                         const std::optional<AllTypeVariant>& value2) const {
+  DebugAssert(partition_id < _partition_count, "PartitionID out of range");
+  DebugAssert(!is_between_predicate_condition(predicate_condition) || value2, "Between predicates need two values");
+
+  // NULLs never match a predicate, but this is left to the pruning statistics
+  if (column_id != _column_id || variant_is_null(value) || (value2 && variant_is_null(*value2))) return false;
+
+  switch (_type) {
+    case PartitioningType::Range: {
+      // The partition holds values in [lower_bound, upper_bound)
+      const auto& lower_bound = _bounds[partition_id];
+      const auto& upper_bound = _bounds[partition_id + 1];
+
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          return value < lower_bound || !(value < upper_bound);
+        case PredicateCondition::LessThan:
+          return !(lower_bound < value);
+        case PredicateCondition::LessThanEquals:
+          return value < lower_bound;
+        case PredicateCondition::GreaterThan:
+        case PredicateCondition::GreaterThanEquals:
+          return !(value < upper_bound);
+        case PredicateCondition::BetweenInclusive:
+        case PredicateCondition::BetweenLowerExclusive:
+          return !(value < upper_bound) || *value2 < lower_bound;
+        case PredicateCondition::BetweenUpperExclusive:
+        case PredicateCondition::BetweenExclusive:
+          return !(value < upper_bound) || !(lower_bound < *value2);
+        default:
+          return false;
+      }
+    }
+
+    case PartitioningType::List: {
+      const auto& partition_values = _values[partition_id];
+      return std::none_of(partition_values.cbegin(), partition_values.cend(), [&](const auto& partition_value) {
+        return value_may_match(partition_value, predicate_condition, value, value2);
+      });
+    }
+
+    case PartitioningType::Hash:
+      return predicate_condition == PredicateCondition::Equals && partition_for(value) != partition_id;
+  }
+  Fail("Invalid enum value");
+}
+
+bool TablePartitioning::extends(const TablePartitioning& other) const {
+  if (_type != other._type || _column_id != other._column_id || _partition_count < other._partition_count) {
+    return false;
+  }
+
+  switch (_type) {
+    case PartitioningType::Range:
+      return std::equal(other._bounds.cbegin(), other._bounds.cend(), _bounds.cbegin());
+    case PartitioningType::List:
+      return std::equal(other._values.cbegin(), other._values.cend(), _values.cbegin());
+    case PartitioningType::Hash:
+      return _partition_count == other._partition_count;
+  }
+  Fail("Invalid enum value");
+}
+
+}  // namespace opossum
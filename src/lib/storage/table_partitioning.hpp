@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class PartitioningType { Range, List, Hash };
+
+/**
+ * A TablePartitioning assigns each row of a data table to one partition based on its value in a single column (see
+ * Table::set_partitioning()). Each chunk of a partitioned table holds the rows of exactly one partition.
+ *
+ *  - Range: Partition i holds the values in [bounds[i], bounds[i + 1]). Values outside of [bounds.front(),
+ *           bounds.back()) cannot be inserted. E.g., the monthly partitions of an event table are bounded by the first
+ *           days of the months.
+ *  - List:  Partition i holds the values listed for it.
+ *  - Hash:  Partition i holds the values whose hash modulo the number of partitions is i.
+ *
+ * NULL values are placed in the first partition of hash partitionings and cannot be inserted into range or list
+ * partitioned tables. All bounds and listed values must have the data type of the partitioning column, as do the
+ * values passed to partition_for() and does_not_contain().
+ */
+class TablePartitioning {
+ public:
+  // The bounds must be strictly increasing, n + 1 bounds define n partitions
+  static std::shared_ptr<const TablePartitioning> range(const ColumnID column_id,
+                                                        const std::vector<AllTypeVariant>& bounds);
+
+  // Each value may be listed for only one partition
+  static std::shared_ptr<const TablePartitioning> list(const ColumnID column_id,
+                                                       const std::vector<std::vector<AllTypeVariant>>& values);
+
+  static std::shared_ptr<const TablePartitioning> hash(const ColumnID column_id, const PartitionID partition_count);
+
+  PartitioningType type() const;
+  ColumnID column_id() const;
+  PartitionID partition_count() const;
+
+  // The data type of the bounds or listed values, nullopt for hash partitionings
+  std::optional<DataType> data_type() const;
+
+  // Returns the partition of the value. Fails if no partition holds the value.
+  PartitionID partition_for(const AllTypeVariant& value) const;
+
+  // Returns true if no value in the partition can match the predicate on the given column. Only predicates on the
+  // partitioning column can rule out a partition, for hash partitionings only equality predicates.
+  bool does_not_contain(const PartitionID partition_id, const ColumnID column_id,
+                        const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                        const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // Returns true if this partitioning contains the partitions of the other one with the same IDs and values, so that
+  // the chunks of a table partitioned by the other one keep their partition. Range and list partitionings are extended
+  // by adding partitions at the end, hash partitionings cannot be extended.
+  bool extends(const TablePartitioning& other) const;
+
+ protected:
+  TablePartitioning(const PartitioningType type, const ColumnID column_id, const PartitionID partition_count);
+
+  const PartitioningType _type;
+  const ColumnID _column_id;
+  const PartitionID _partition_count;
+
+  // Range partitionings only
+  std::vector<AllTypeVariant> _bounds;
+
+  // List partitionings only, the values of each partition in ascending order and the partition of each value
+  std::vector<std::vector<AllTypeVariant>> _values;
+  std::unordered_map<AllTypeVariant, PartitionID> _partition_by_value;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <limits>
 #include <memory>
@@ -16,28 +17,42 @@
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment(bool nullable, ChunkOffset capacity) : BaseValueSegment(data_type_from_type<T>()) {
+ValueSegment<T>::ValueSegment(bool nullable, ChunkOffset capacity)
+    : BaseValueSegment(data_type_from_type<T>()),
+      _string_heap(std::is_same_v<T, pmr_string> ? std::make_unique<StringHeapMemoryResource>() : nullptr),
+      _values(_string_heap ? PolymorphicAllocator<T>{_string_heap.get()} : PolymorphicAllocator<T>{}) {
+  // The strings copied into _values (e.g., by append() or Insert) are allocated from the _string_heap, as pmr_vector
+  // passes its allocator on to its elements
   _values.reserve(capacity);
   if (nullable) {
-    _null_values = pmr_vector<bool>();
+    _null_values = NullBitmap();
     _null_values->reserve(capacity);
   }
 }
 
 template <typename T>
 ValueSegment<T>::ValueSegment(pmr_vector<T>&& values)
-    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values)) {}
+    : BaseValueSegment(data_type_from_type<T>()),
+      _values(std::move(values)),
+      _string_heap_size(string_vector_heap_size(_values)) {}
 
 template <typename T>
-ValueSegment<T>::ValueSegment(pmr_vector<T>&& values, pmr_vector<bool>&& null_values)
-    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values)), _null_values(std::move(null_values)) {
+ValueSegment<T>::ValueSegment(pmr_vector<T>&& values, NullBitmap&& null_values)
+    : BaseValueSegment(data_type_from_type<T>()),
+      _values(std::move(values)),
+      _null_values(std::move(null_values)),
+      _string_heap_size(string_vector_heap_size(_values)) {
   DebugAssert(_values.size() == _null_values->size(), "The number of values and null_values should be equal");
 
-  // We cannot check for the capacity being equal because of the implementation details of vector<bool>
-  DebugAssert(_values.capacity() <= _null_values->capacity(),
-              "The capacity of values and null_values should be compatible");
+  // Appending values must not reallocate the bitmap, which is read concurrently (see resize())
+  _null_values->reserve(_values.capacity());
 }
 
+template <typename T>
+ValueSegment<T>::ValueSegment(pmr_vector<T>&& values, const pmr_vector<bool>& null_values)
+    : ValueSegment(std::move(values),
+                   NullBitmap(null_values.cbegin(), null_values.cend(), null_values.get_allocator())) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
@@ -77,12 +92,14 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   if (is_nullable()) {
     (*_null_values).push_back(is_null);
     _values.push_back(is_null ? T{} : boost::get<T>(val));
-    return;
+  } else {
+    Assert(!is_null, "ValueSegment is not nullable but value passed is null.");
+    _values.push_back(boost::get<T>(val));
   }
 
-  Assert(!is_null, "ValueSegment is not nullable but value passed is null.");
-
-  _values.push_back(boost::get<T>(val));
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    _string_heap_size.fetch_add(string_heap_size(_values.back()), std::memory_order_relaxed);
+  }
 }
 
 template <typename T>
@@ -95,13 +112,25 @@ pmr_vector<T>& ValueSegment<T>::values() {
   return _values;
 }
 
+template <typename T>
+void ValueSegment<T>::account_for_values(const ChunkOffset chunk_offset, const ChunkOffset length) {
+  DebugAssert(_values.size() >= chunk_offset + length, "ValueSegment out-of-bounds");
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto heap_size = size_t{0};
+    for (auto value_idx = size_t{chunk_offset}; value_idx < chunk_offset + length; ++value_idx) {
+      heap_size += string_heap_size(_values[value_idx]);
+    }
+    _string_heap_size.fetch_add(heap_size, std::memory_order_relaxed);
+  }
+}
+
 template <typename T>
 bool ValueSegment<T>::is_nullable() const {
   return static_cast<bool>(_null_values);
 }
 
 template <typename T>
-const pmr_vector<bool>& ValueSegment<T>::null_values() const {
+const NullBitmap& ValueSegment<T>::null_values() const {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
 
   return *_null_values;
@@ -115,6 +144,22 @@ void ValueSegment<T>::set_null_value(const ChunkOffset chunk_offset) {
   (*_null_values)[chunk_offset] = true;
 }
 
+template <typename T>
+void ValueSegment<T>::set_null_values(const ChunkOffset chunk_offset, const NullBitmap& null_values,
+                                      const ChunkOffset null_values_offset, const ChunkOffset length) {
+  DebugAssert(null_values.size() >= null_values_offset + length, "Null values out-of-bounds");
+
+  if (!is_nullable()) {
+    Assert(null_values.find_next(null_values_offset) >= null_values_offset + length,
+           "This ValueSegment does not support null values.");
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{_null_value_modification_mutex};
+  DebugAssert(_null_values->size() >= chunk_offset + length, "ValueSegment out-of-bounds");
+  _null_values->set_range(chunk_offset, null_values, null_values_offset, length);
+}
+
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
   return static_cast<ChunkOffset>(_values.size());
@@ -137,7 +182,7 @@ std::shared_ptr<AbstractSegment> ValueSegment<T>::copy_using_allocator(
   pmr_vector<T> new_values(_values, alloc);  // NOLINT(cppcoreguidelines-slicing)
   std::shared_ptr<AbstractSegment> copy;
   if (is_nullable()) {
-    pmr_vector<bool> new_null_values(*_null_values, alloc);  // NOLINT(cppcoreguidelines-slicing) (see above)
+    auto new_null_values = NullBitmap(*_null_values, alloc);
     copy = std::make_shared<ValueSegment<T>>(std::move(new_values), std::move(new_null_values));
   } else {
     copy = std::make_shared<ValueSegment<T>>(std::move(new_values));
@@ -147,7 +192,8 @@ std::shared_ptr<AbstractSegment> ValueSegment<T>::copy_using_allocator(
 }
 
 template <typename T>
-size_t ValueSegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
+size_t ValueSegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as the heap size of the strings is tracked (see account_for_values())
   auto null_value_vector_size = size_t{0};
   if (_null_values) {
     null_value_vector_size = _null_values->capacity() / CHAR_BIT;
@@ -156,7 +202,8 @@ size_t ValueSegment<T>::memory_usage(const MemoryUsageCalculationMode mode) cons
   const auto common_elements_size = sizeof(*this) + null_value_vector_size;
 
   if constexpr (std::is_same_v<T, pmr_string>) {
-    return common_elements_size + string_vector_memory_usage(_values, mode);
+    return common_elements_size +
+           string_vector_memory_usage(_values, _string_heap_size.load(std::memory_order_relaxed));
   }
 
   return common_elements_size + _values.capacity() * sizeof(T);
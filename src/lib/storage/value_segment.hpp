@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -8,6 +9,7 @@
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "memory/string_heap_memory_resource.hpp"
 
 namespace opossum {
 
@@ -15,11 +17,13 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseValueSegment {
  public:
+  // For strings, the segment allocates the values that are appended to it from its own StringHeapMemoryResource.
   explicit ValueSegment(bool nullable = false, ChunkOffset capacity = Chunk::DEFAULT_SIZE);
 
   // Create a ValueSegment with the given values.
   explicit ValueSegment(pmr_vector<T>&& values);
-  explicit ValueSegment(pmr_vector<T>&& values, pmr_vector<bool>&& null_values);
+  explicit ValueSegment(pmr_vector<T>&& values, NullBitmap&& null_values);
+  explicit ValueSegment(pmr_vector<T>&& values, const pmr_vector<bool>& null_values);
 
   // Return the value at a certain position. If you want to write efficient operators, back off!
   // Use values() and null_values() to get the vectors and check the content yourself.
@@ -52,21 +56,31 @@ class ValueSegment : public BaseValueSegment {
   const pmr_vector<T>& values() const;
   pmr_vector<T>& values();
 
+  // The heap memory of strings is counted when they are added, so that memory_usage() does not have to visit them.
+  // After writing strings through values() (as Insert does), the written range has to be passed to this method.
+  void account_for_values(const ChunkOffset chunk_offset, const ChunkOffset length);
+
   // Return whether segment supports null values.
   bool is_nullable() const final;
 
-  // Return null value vector that indicates whether a value is null with true at position i.
+  // Return null value bitmap that indicates whether a value is null with true at position i.
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
-  const pmr_vector<bool>& null_values() const final;
+  const NullBitmap& null_values() const final;
 
-  // Writing a vector<bool> is not thread-safe. By only exposing the vector as a const reference, we force people to go
-  // through this thread-safe method. By design, this does not take a bool argument. All entries are false (i.e., not
+  // Writing a bit is not thread-safe. By only exposing the bitmap as a const reference, we force people to go through
+  // this thread-safe method. By design, this does not take a bool argument. All entries are false (i.e., not
   // NULL) by default. Setting them to false again is unnecessarily expensive and changing them from true to false
   // should never be necessary.
   void set_null_value(const ChunkOffset chunk_offset);
 
+  // Copies @param length entries of @param null_values, starting at @param null_values_offset, to the entries starting
+  // at @param chunk_offset, none of which may be NULL yet. Used to copy whole ranges of null values, for which the lock
+  // is only acquired once.
+  void set_null_values(const ChunkOffset chunk_offset, const NullBitmap& null_values,
+                       const ChunkOffset null_values_offset, const ChunkOffset length);
+
   // Return the number of entries in the segment.
   ChunkOffset size() const final;
 
@@ -81,11 +95,17 @@ class ValueSegment : public BaseValueSegment {
   size_t memory_usage(const MemoryUsageCalculationMode mode) const override;
 
  protected:
+  // Only set for strings that are appended to the segment. Declared before _values, as it has to outlive the strings.
+  std::unique_ptr<StringHeapMemoryResource> _string_heap;
+
   pmr_vector<T> _values;
-  std::optional<pmr_vector<bool>> _null_values;
+  std::optional<NullBitmap> _null_values;
+
+  // Heap memory allocated by the strings of _values. Atomic, as Insert writes values while meta tables are generated.
+  std::atomic<size_t> _string_heap_size{0};
 
-  // Protects set_null_value. Does not need to be acquired for reads, as we expect modifications to vector<bool> to be
-  // atomic.
+  // Protects set_null_value. Does not need to be acquired for reads, as we expect modifications of a word of the bitmap
+  // to be atomic.
   std::mutex _null_value_modification_mutex;
 };
 
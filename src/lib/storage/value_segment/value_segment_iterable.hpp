@@ -19,9 +19,10 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
-    if (_segment.is_nullable()) {
-      auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values().cbegin()};
-      auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values().cend()};
+    // Nullable segments without NULLs (found by checking whole words of the bitmap) skip the per-value null checks
+    if (_segment.is_nullable() && _segment.null_values().any()) {
+      auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values()};
+      auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values()};
       functor(begin, end);
     } else {
       auto begin = NonNullIterator{_segment.values().cbegin(), _segment.values().cbegin()};
@@ -36,10 +37,10 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
     using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
 
-    if (_segment.is_nullable()) {
-      auto begin = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values().cbegin(),
+    if (_segment.is_nullable() && _segment.null_values().any()) {
+      auto begin = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values(),
                                                             position_filter->cbegin(), position_filter->cbegin()};
-      auto end = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values().cbegin(),
+      auto end = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values(),
                                                           position_filter->cbegin(), position_filter->cend()};
       functor(begin, end);
     } else {
@@ -102,12 +103,11 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     using ValueType = T;
     using IterableType = ValueSegmentIterable<T>;
     using ValueIterator = typename pmr_vector<T>::const_iterator;
-    using NullValueIterator = pmr_vector<bool>::const_iterator;
 
    public:
-    explicit Iterator(ValueIterator begin_value_it, ValueIterator value_it, NullValueIterator null_value_it)
+    explicit Iterator(ValueIterator begin_value_it, ValueIterator value_it, const NullBitmap& null_values)
         : _value_it(std::move(value_it)),
-          _null_value_it{std::move(null_value_it)},
+          _null_values{&null_values},
           _chunk_offset{static_cast<ChunkOffset>(std::distance(begin_value_it, _value_it))} {}
 
    private:
@@ -115,19 +115,16 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
     void increment() {
       ++_value_it;
-      ++_null_value_it;
       ++_chunk_offset;
     }
 
     void decrement() {
       --_value_it;
-      --_null_value_it;
       --_chunk_offset;
     }
 
     void advance(std::ptrdiff_t n) {
       _value_it += n;
-      _null_value_it += n;
       _chunk_offset += n;
     }
 
@@ -135,11 +132,13 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
     std::ptrdiff_t distance_to(const Iterator& other) const { return other._value_it - _value_it; }
 
-    SegmentPosition<T> dereference() const { return SegmentPosition<T>{*_value_it, *_null_value_it, _chunk_offset}; }
+    SegmentPosition<T> dereference() const {
+      return SegmentPosition<T>{*_value_it, (*_null_values)[_chunk_offset], _chunk_offset};
+    }
 
    private:
     ValueIterator _value_it;
-    NullValueIterator _null_value_it;
+    const NullBitmap* _null_values;
     ChunkOffset _chunk_offset;
   };
 
@@ -180,16 +179,15 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     using ValueType = T;
     using IterableType = ValueSegmentIterable<T>;
     using ValueVectorIterator = typename pmr_vector<T>::const_iterator;
-    using NullValueVectorIterator = typename pmr_vector<bool>::const_iterator;
 
    public:
-    explicit PointAccessIterator(ValueVectorIterator values_begin_it, NullValueVectorIterator null_values_begin_it,
+    explicit PointAccessIterator(ValueVectorIterator values_begin_it, const NullBitmap& null_values,
                                  PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
         : AbstractPointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>,
                                              PosListIteratorType>{std::move(position_filter_begin),
                                                                   std::move(position_filter_it)},
           _values_begin_it{std::move(values_begin_it)},
-          _null_values_begin_it{std::move(null_values_begin_it)} {}
+          _null_values{&null_values} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
@@ -197,13 +195,13 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     SegmentPosition<T> dereference() const {
       const auto& chunk_offsets = this->chunk_offsets();
       return SegmentPosition<T>{*(_values_begin_it + chunk_offsets.offset_in_referenced_chunk),
-                                *(_null_values_begin_it + chunk_offsets.offset_in_referenced_chunk),
+                                (*_null_values)[chunk_offsets.offset_in_referenced_chunk],
                                 chunk_offsets.offset_in_poslist};
     }
 
    private:
     ValueVectorIterator _values_begin_it;
-    NullValueVectorIterator _null_values_begin_it;
+    const NullBitmap* _null_values;
   };
 };
 
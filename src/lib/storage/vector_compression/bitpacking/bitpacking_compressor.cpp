@@ -0,0 +1,58 @@
+#include "bitpacking_compressor.hpp"
+
+#include <algorithm>
+
+#include "bitpacking_vector.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::unique_ptr<const BaseCompressedVector> BitPackingCompressor::compress(const pmr_vector<uint32_t>& vector,
+                                                                           const PolymorphicAllocator<size_t>& alloc,
+                                                                           const UncompressedVectorInfo& meta_info) {
+  auto max_value = uint32_t{0};
+  if (meta_info.max_value) {
+    max_value = *meta_info.max_value;
+  } else if (!vector.empty()) {
+    max_value = *std::max_element(vector.cbegin(), vector.cend());
+  }
+
+  const auto bit_width = bit_width_for_value(max_value);
+
+  // Allocate (at least) one additional word so that the decompressor can always read two consecutive words.
+  const auto word_count = (vector.size() * bit_width) / 64u + 2u;
+  auto data = pmr_vector<uint64_t>(word_count, uint64_t{0}, alloc);
+
+  if (bit_width > 0) {
+    for (auto index = size_t{0}; index < vector.size(); ++index) {
+      const auto value = static_cast<uint64_t>(vector[index]);
+      DebugAssert(value <= max_value, "Value exceeds the given maximum value.");
+
+      const auto bit_offset = index * bit_width;
+      const auto word_index = bit_offset / 64u;
+      const auto shift = bit_offset % 64u;
+
+      data[word_index] |= value << shift;
+      if (shift + bit_width > 64u) {
+        data[word_index + 1] |= value >> (64u - shift);
+      }
+    }
+  }
+
+  return std::make_unique<BitPackingVector>(std::move(data), bit_width, vector.size());
+}
+
+std::unique_ptr<BaseVectorCompressor> BitPackingCompressor::create_new() const {
+  return std::make_unique<BitPackingCompressor>();
+}
+
+uint8_t BitPackingCompressor::bit_width_for_value(const uint32_t max_value) {
+  auto bit_width = uint8_t{0};
+  for (auto remaining = max_value; remaining > 0; remaining >>= 1u) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/vector_compression/base_vector_compressor.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Compresses a vector using fixed-width bit-packing
+ *
+ * The bit width is derived from the maximum value, which is either passed via the UncompressedVectorInfo or
+ * determined by scanning the vector.
+ */
+class BitPackingCompressor : public BaseVectorCompressor {
+ public:
+  std::unique_ptr<const BaseCompressedVector> compress(const pmr_vector<uint32_t>& vector,
+                                                       const PolymorphicAllocator<size_t>& alloc,
+                                                       const UncompressedVectorInfo& meta_info = {}) final;
+
+  std::unique_ptr<BaseVectorCompressor> create_new() const final;
+
+  // Returns the number of bits needed to represent max_value (0 for max_value == 0)
+  static uint8_t bit_width_for_value(const uint32_t max_value);
+};
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Implements point-access into a bit-packed vector
+ *
+ * Since all values share the same bit width, the position of a value can be computed directly from its index. Thus,
+ * random access is O(1) and, in contrast to the SimdBp128Decompressor, does not depend on any block caching.
+ */
+class BitPackingDecompressor : public BaseVectorDecompressor {
+ public:
+  BitPackingDecompressor(const pmr_vector<uint64_t>& data, const uint8_t bit_width, const size_t size)
+      : _data{data}, _bit_width{bit_width}, _size{size} {}
+  BitPackingDecompressor(const BitPackingDecompressor&) = default;
+  BitPackingDecompressor(BitPackingDecompressor&&) = default;
+
+  BitPackingDecompressor& operator=(const BitPackingDecompressor& other) {
+    DebugAssert(&_data == &other._data, "Cannot reassign BitPackingDecompressor");
+    return *this;
+  }
+  BitPackingDecompressor& operator=(BitPackingDecompressor&& other) {
+    DebugAssert(&_data == &other._data, "Cannot reassign BitPackingDecompressor");
+    return *this;
+  }
+
+  uint32_t get(size_t i) final { return unpack(_data.data(), _bit_width, i); }
+
+  size_t size() const final { return _size; }
+
+  /**
+   * Extracts the i-th value. A value spans at most two 64-bit words. The compressor appends a padding word so that the
+   * second word can always be read without branching. Shifting the second word in two steps avoids undefined behavior
+   * for shifts by 64 bits when the value starts at a word boundary.
+   */
+  static uint32_t unpack(const uint64_t* data, const uint8_t bit_width, const size_t i) {
+    const auto bit_offset = i * bit_width;
+    const auto word_index = bit_offset / 64u;
+    const auto shift = bit_offset % 64u;
+    const auto mask = (uint64_t{1} << bit_width) - 1u;
+
+    const auto value = (data[word_index] >> shift) | ((data[word_index + 1] << 1u) << (63u - shift));
+    return static_cast<uint32_t>(value & mask);
+  }
+
+ private:
+  const pmr_vector<uint64_t>& _data;
+  const uint8_t _bit_width;
+  const size_t _size;
+};
+
+}  // namespace opossum
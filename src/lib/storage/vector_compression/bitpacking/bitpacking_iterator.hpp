@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/vector_compression/base_compressed_vector.hpp"
+
+#include "bitpacking_decompressor.hpp"
+
+namespace opossum {
+
+/**
+ * Random-access iterator over a bit-packed vector. Dereferencing computes the value position from the index, so no
+ * decompressor state needs to be copied along with the iterator (cf. SimdBp128Iterator).
+ */
+class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterator> {
+ public:
+  BitPackingIterator(const uint64_t* data, const uint8_t bit_width, const size_t absolute_index = 0u)
+      : _data{data}, _bit_width{bit_width}, _absolute_index{absolute_index} {}
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  // Our code style would want these to be prefixed with an underscore as they are private methods, but we need to
+  // implement boost’s interface.
+  void increment() { ++_absolute_index; }  // NOLINT
+
+  void decrement() { --_absolute_index; }  // NOLINT
+
+  void advance(std::ptrdiff_t n) { _absolute_index += n; }  // NOLINT
+
+  bool equal(const BitPackingIterator& other) const { return _absolute_index == other._absolute_index; }  // NOLINT
+
+  std::ptrdiff_t distance_to(const BitPackingIterator& other) const {  // NOLINT
+    return other._absolute_index - _absolute_index;
+  }
+
+  uint32_t dereference() const {  // NOLINT
+    return BitPackingDecompressor::unpack(_data, _bit_width, _absolute_index);
+  }
+
+ private:
+  const uint64_t* _data;
+  uint8_t _bit_width;
+  size_t _absolute_index;
+};
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#include "bitpacking_vector.hpp"
+
+namespace opossum {
+
+BitPackingVector::BitPackingVector(pmr_vector<uint64_t> data, const uint8_t bit_width, const size_t size)
+    : _data{std::move(data)}, _bit_width{bit_width}, _size{size} {
+  DebugAssert(_bit_width <= 32, "Bit width must not exceed 32 bits.");
+  DebugAssert(_data.size() * 64 >= _size * _bit_width + 64, "Data must be padded by one word.");
+}
+
+const pmr_vector<uint64_t>& BitPackingVector::data() const { return _data; }
+
+uint8_t BitPackingVector::bit_width() const { return _bit_width; }
+
+size_t BitPackingVector::on_size() const { return _size; }
+size_t BitPackingVector::on_data_size() const { return sizeof(uint64_t) * _data.size(); }
+
+std::unique_ptr<BaseVectorDecompressor> BitPackingVector::on_create_base_decompressor() const {
+  return std::make_unique<BitPackingDecompressor>(_data, _bit_width, _size);
+}
+
+BitPackingDecompressor BitPackingVector::on_create_decompressor() const {
+  return BitPackingDecompressor(_data, _bit_width, _size);
+}
+
+BitPackingIterator BitPackingVector::on_begin() const { return BitPackingIterator{_data.data(), _bit_width, 0u}; }
+
+BitPackingIterator BitPackingVector::on_end() const { return BitPackingIterator{_data.data(), _bit_width, _size}; }
+
+std::unique_ptr<const BaseCompressedVector> BitPackingVector::on_copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto data_copy = pmr_vector<uint64_t>{_data, alloc};
+  return std::make_unique<BitPackingVector>(std::move(data_copy), _bit_width, _size);
+}
+
+}  // namespace opossum
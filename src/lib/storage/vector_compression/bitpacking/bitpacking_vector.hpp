@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "storage/vector_compression/base_compressed_vector.hpp"
+
+#include "bitpacking_decompressor.hpp"
+#include "bitpacking_iterator.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Bit-packed vector with a fixed bit width
+ *
+ * All values are stored with the bit width of the largest value, tightly packed into 64-bit words. Values may span
+ * word boundaries. Compared to FixedSizeByteAlignedVector, this saves memory for value ranges that are not close to
+ * 2^8, 2^16, or 2^32 (e.g., 10 bits instead of 16 bits for 1'000 distinct values). Compared to SimdBp128Vector, point
+ * access does not need to decode whole blocks and is O(1), which matters for random-access patterns such as
+ * IndexScan or the JoinIndex.
+ *
+ * The data holds one additional padding word at the end (see BitPackingDecompressor::unpack).
+ */
+class BitPackingVector : public CompressedVector<BitPackingVector> {
+ public:
+  explicit BitPackingVector(pmr_vector<uint64_t> data, const uint8_t bit_width, const size_t size);
+  ~BitPackingVector() override = default;
+
+  const pmr_vector<uint64_t>& data() const;
+  uint8_t bit_width() const;
+
+  size_t on_size() const;
+  size_t on_data_size() const;
+
+  std::unique_ptr<BaseVectorDecompressor> on_create_base_decompressor() const;
+  BitPackingDecompressor on_create_decompressor() const;
+
+  BitPackingIterator on_begin() const;
+  BitPackingIterator on_end() const;
+
+  std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
+
+ private:
+  const pmr_vector<uint64_t> _data;
+  const uint8_t _bit_width;
+  const size_t _size;
+};
+
+}  // namespace opossum
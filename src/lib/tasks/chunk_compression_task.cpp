@@ -1,23 +1,45 @@
 #include "chunk_compression_task.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "hyrise.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_advisor.hpp"
 #include "storage/table.hpp"
 
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Serializes the read-modify-write of the table statistics by concurrent tasks
+std::mutex table_statistics_mutex;
+
+// Background services (e.g., the ChunkCompressionPlugin and the MvccDeletePlugin) might compress the same completed
+// chunk concurrently, which must only be finalized once
+std::mutex finalize_mutex;
+
+}  // namespace
+
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const std::optional<double>& advisor_memory_weight,
+                                           const SchedulePriority priority)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, advisor_memory_weight, priority} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<double>& advisor_memory_weight,
+                                           const SchedulePriority priority)
+    : AbstractTask{priority},
+      _table_name{table_name},
+      _chunk_ids{chunk_ids},
+      _advisor_memory_weight{advisor_memory_weight} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = Hyrise::get().storage_manager.get_table(_table_name);
@@ -29,22 +51,47 @@ void ChunkCompressionTask::_on_execute() {
     const auto chunk = table->get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    // TODO(anyone): It is unclear if this restriction is really necessary. If it becomes a problem and we decide to
-    // get rid of it, we should make sure that a new mutable chunk is created first so that inserts do not end up in
-    // the chunk being compressed.
-    DebugAssert(_chunk_is_completed(chunk, table->target_chunk_size()),
-                "Chunk is not completed and thus can’t be compressed.");
-
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    // Inserts do not end up in finalized chunks, so that these can be compressed even if they are not full
+    DebugAssert(!chunk->is_mutable() || chunk_is_completed(chunk, table->target_chunk_size()),
+                "Chunk is neither completed nor finalized and thus can’t be compressed.");
+
+    // Inserts do not write to full chunks, so that completed chunks can be finalized
+    {
+      const auto lock = std::lock_guard<std::mutex>{finalize_mutex};
+      if (chunk->is_mutable()) chunk->finalize();
+    }
+
+    if (_advisor_memory_weight) {
+      const auto chunk_encoding_spec =
+          SegmentEncodingAdvisor::advise_chunk(chunk, table->column_data_types(), *_advisor_memory_weight);
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
+
+    // The indexes of the table, which the chunk did not have while it was mutable or which were dropped with the
+    // replaced segments, are built over the encoded segments
+    table->create_chunk_indexes(chunk_id);
+
+    // The rows of the completed chunk are added to the statistics, so that they do not become stale with inserts.
+    // Only statistics created from the table (which have ColumnGroupStatistics) can be updated.
+    const auto lock = std::lock_guard<std::mutex>{table_statistics_mutex};
+    const auto table_statistics = table->table_statistics();
+    if (table_statistics && table_statistics->column_group_statistics) {
+      table->set_table_statistics(table_statistics->with_chunk(*table, chunk_id));
+    }
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
-  if (chunk->size() != target_chunk_size) return false;
-
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
   const auto& mvcc_data = chunk->mvcc_data();
 
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < target_chunk_size; ++chunk_offset) {
+  // Chunks allocated before the target chunk size of the table was changed are full before or after reaching it (see
+  // Table::mutable_chunk_capacity())
+  const auto chunk_size = chunk->size();
+  if (chunk_size < std::min(target_chunk_size, mvcc_data->capacity())) return false;
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
     // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
     //               When activating the ChunkCompressionTask, please look for a different means of determining whether
     //               all Inserts to a Chunk finished.
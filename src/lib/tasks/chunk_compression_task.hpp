@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,27 +28,43 @@ class Chunk;
  * full and all of their end-cids must be smaller than infinity. This task calls
  * those chunks “completed”.
  *
+ * If a memory weight is passed, the encoding of each segment is chosen by the SegmentEncodingAdvisor, which trades
+ * off memory usage (weight 1) against scan speed (weight 0).
+ *
+ * Completed chunks that are still mutable are finalized before they are encoded. Chunks that are not completed can be
+ * compressed once the caller has finalized them, as inserts do not end up in finalized chunks (e.g., the chunk that
+ * the MvccDeletePlugin reinserts merged rows into). The encoded chunks get pruning statistics, and rows of the
+ * compressed chunks that the table's statistics do not represent yet are added to them (see
+ * TableStatistics::with_chunk()).
+ *
+ * Background services (e.g., the ChunkCompressionPlugin) pass SchedulePriority::Background, so that the compression
+ * only runs on workers that have no query tasks to process.
+ *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
-  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
-
- protected:
-  void _on_execute() override;
+  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                const std::optional<double>& advisor_memory_weight = std::nullopt,
+                                const SchedulePriority priority = SchedulePriority::Default);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const std::optional<double>& advisor_memory_weight = std::nullopt,
+                                const SchedulePriority priority = SchedulePriority::Default);
 
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  static bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<double> _advisor_memory_weight;
 };
 }  // namespace opossum
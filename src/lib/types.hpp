@@ -48,6 +48,7 @@ STRONG_TYPEDEF(opossum::ColumnID::base_type, ColumnCount);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 STRONG_TYPEDEF(uint32_t, NodeID);
 STRONG_TYPEDEF(uint32_t, CpuID);
+STRONG_TYPEDEF(uint32_t, PartitionID);
 
 // Used to identify a Parameter within a subquery. This can be either a parameter of a Prepared SELECT statement
 // `SELECT * FROM t WHERE a > ?` or a correlated parameter in a subquery.
@@ -126,6 +127,7 @@ struct RowID {
 
 using WorkerID = uint32_t;
 using TaskID = uint32_t;
+using SessionID = uint32_t;
 
 // When changing these to 64-bit types, reading and writing to them might not be atomic anymore.
 // Among others, the validate operator might break when another operator is simultaneously writing begin or end CIDs.
@@ -147,6 +149,8 @@ constexpr ColumnID INVALID_COLUMN_ID{std::numeric_limits<ColumnID::base_type>::m
 // deleted in the same transaction (which has not yet committed)
 constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
 constexpr auto INITIAL_TRANSACTION_ID = TransactionID{1};
+// Read-only transactions do not lock or insert rows. They share this transaction id, which is never handed out.
+constexpr auto READ_ONLY_TRANSACTION_ID = TransactionID{std::numeric_limits<TransactionID>::max()};
 
 constexpr NodeID CURRENT_NODE_ID{std::numeric_limits<NodeID::base_type>::max() - 1};
 
@@ -159,8 +163,9 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 // The Scheduler currently supports just these 3 priorities, subject to change.
 enum class SchedulePriority {
-  Default = 1,  // Schedule task at the end of the queue
-  High = 0      // Schedule task at the beginning of the queue
+  Background = 2,  // Schedule task in a queue that is only processed when no other tasks are waiting
+  Default = 1,     // Schedule task at the end of the queue
+  High = 0         // Schedule task at the beginning of the queue
 };
 
 enum class PredicateCondition {
@@ -238,6 +243,10 @@ enum class MetaTableChangeType { Insert, Delete, Update };
 
 enum class AutoCommit : bool { Yes = true, No = false };
 
+// Read-only transactions (e.g., auto-committed SELECTs) take a cheaper path through the TransactionManager, see
+// TransactionManager::new_transaction_context.
+enum class TransactionAccessMode { ReadWrite, ReadOnly };
+
 enum class LogLevel { Debug, Info, Warning };
 
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
@@ -295,7 +304,7 @@ template <>
 struct hash<std::basic_string<char, std::char_traits<char>, opossum::PolymorphicAllocator<char>>> {
   size_t operator()(
       const std::basic_string<char, std::char_traits<char>, opossum::PolymorphicAllocator<char>>& string) const {
-    return std::hash<std::string_view>{}(string.c_str());
+    return std::hash<std::string_view>{}(std::string_view{string.data(), string.size()});
   }
 };
 }  // namespace std
@@ -0,0 +1,191 @@
+#include "async_file_writer.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AsyncFileWriter::AsyncFileWriter(const std::string& filename) : _filename(filename) {
+  _file_descriptor = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(_file_descriptor >= 0, "Could not open '" + filename + "': " + std::strerror(errno));
+
+  _write_threads.reserve(MAX_WRITES_IN_FLIGHT);
+  for (auto thread_id = size_t{0}; thread_id < MAX_WRITES_IN_FLIGHT; ++thread_id) {
+    _write_threads.emplace_back(&AsyncFileWriter::_write_loop, this);
+  }
+
+  _acquire_buffer();
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  if (_file_descriptor < 0) return;
+
+  // The write threads complete all pending writes before they stop
+  _submit_buffer();
+  _stop_write_threads();
+  ::close(_file_descriptor);
+}
+
+void AsyncFileWriter::close() {
+  if (_file_descriptor < 0) return;
+
+  _submit_buffer();
+  _wait_for_writes();
+  _stop_write_threads();
+
+  const auto result = ::close(_file_descriptor);
+  _file_descriptor = -1;
+  Assert(result == 0, "Could not close '" + _filename + "': " + std::strerror(errno));
+}
+
+AsyncFileWriter::int_type AsyncFileWriter::overflow(int_type character) {
+  _submit_buffer();
+  _acquire_buffer();
+
+  if (!traits_type::eq_int_type(character, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(character);
+    pbump(1);
+  }
+  return traits_type::not_eof(character);
+}
+
+std::streamsize AsyncFileWriter::xsputn(const char* data, std::streamsize size) {
+  auto remaining = size;
+  while (remaining > 0) {
+    if (pptr() == epptr()) {
+      _submit_buffer();
+      _acquire_buffer();
+    }
+
+    const auto copy_size = std::min(remaining, static_cast<std::streamsize>(epptr() - pptr()));
+    std::memcpy(pptr(), data, copy_size);
+    pbump(static_cast<int>(copy_size));
+    data += copy_size;
+    remaining -= copy_size;
+  }
+  return size;
+}
+
+int AsyncFileWriter::sync() {
+  // Flushing only starts the write of the current buffer. It does not wait for the write to complete.
+  _submit_buffer();
+  _acquire_buffer();
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _error.empty() ? 0 : -1;
+}
+
+AsyncFileWriter::pos_type AsyncFileWriter::seekoff(off_type offset, std::ios_base::seekdir direction,
+                                                   std::ios_base::openmode mode) {
+  if (direction == std::ios_base::beg) return seekpos(pos_type{offset}, mode);
+
+  // Only the current position can be queried (i.e., tellp), relative seeks are not needed by the writers
+  if (direction == std::ios_base::cur && offset == 0) return pos_type{_buffer_offset + (pptr() - pbase())};
+  return pos_type{off_type{-1}};
+}
+
+AsyncFileWriter::pos_type AsyncFileWriter::seekpos(pos_type position, std::ios_base::openmode /*mode*/) {
+  _submit_buffer();
+  _wait_for_writes();
+  _acquire_buffer();
+
+  _buffer_offset = static_cast<off_t>(position);
+  return position;
+}
+
+void AsyncFileWriter::_submit_buffer() {
+  const auto size = static_cast<size_t>(pptr() - pbase());
+  setp(nullptr, nullptr);
+  if (size == 0) return;
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _pending_writes.push_back({_current_buffer, size, _buffer_offset});
+    ++_writes_in_flight;
+  }
+  _pending_condition_variable.notify_one();
+
+  _current_buffer = nullptr;
+  _buffer_offset += static_cast<off_t>(size);
+}
+
+void AsyncFileWriter::_acquire_buffer() {
+  if (!_current_buffer) {
+    auto lock = std::unique_lock<std::mutex>{_mutex};
+    _completed_condition_variable.wait(lock, [&]() {
+      return !_free_buffers.empty() || _buffers.size() <= MAX_WRITES_IN_FLIGHT || !_error.empty();
+    });
+    Assert(_error.empty(), _error);
+
+    if (!_free_buffers.empty()) {
+      _current_buffer = _free_buffers.back();
+      _free_buffers.pop_back();
+    } else {
+      // Buffers are allocated on demand so that writing a small file does not allocate all of them
+      auto* const buffer = static_cast<char*>(std::aligned_alloc(BUFFER_ALIGNMENT, BUFFER_SIZE));
+      Assert(buffer, "Could not allocate write buffer");
+      _buffers.emplace_back(buffer);
+      _current_buffer = buffer;
+    }
+  }
+
+  setp(_current_buffer, _current_buffer + BUFFER_SIZE);
+}
+
+void AsyncFileWriter::_wait_for_writes() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _completed_condition_variable.wait(lock, [&]() { return _writes_in_flight == 0; });
+  Assert(_error.empty(), _error);
+}
+
+void AsyncFileWriter::_stop_write_threads() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _shutdown = true;
+  }
+  _pending_condition_variable.notify_all();
+
+  for (auto& thread : _write_threads) {
+    if (thread.joinable()) thread.join();
+  }
+}
+
+void AsyncFileWriter::_write_loop() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  while (true) {
+    _pending_condition_variable.wait(lock, [&]() { return _shutdown || !_pending_writes.empty(); });
+    if (_pending_writes.empty()) return;
+
+    const auto write = _pending_writes.front();
+    _pending_writes.pop_front();
+    lock.unlock();
+
+    // Writes of different buffers never overlap, so they can be issued concurrently and complete in any order
+    auto error = std::string{};
+    auto written_size = size_t{0};
+    while (written_size < write.size) {
+      const auto result = pwrite(_file_descriptor, write.buffer + written_size, write.size - written_size,
+                                 write.offset + static_cast<off_t>(written_size));
+      if (result < 0) {
+        if (errno == EINTR) continue;
+        error = "Could not write '" + _filename + "': " + std::strerror(errno);
+        break;
+      }
+      written_size += static_cast<size_t>(result);
+    }
+
+    lock.lock();
+    if (!error.empty() && _error.empty()) _error = error;
+    _free_buffers.push_back(write.buffer);
+    --_writes_in_flight;
+    _completed_condition_variable.notify_all();
+  }
+}
+
+}  // namespace opossum
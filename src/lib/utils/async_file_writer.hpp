@@ -0,0 +1,100 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+ * Stream buffer that writes a file with several large writes in flight. Written data is collected in aligned buffers
+ * of BUFFER_SIZE bytes. Full buffers are handed to a set of write threads, which write them with pwrite at their file
+ * offset, while the caller continues to fill the next buffer. Thus, the serialization of the data overlaps with its
+ * I/O, and the file is written in a few large requests instead of many small ones. Use it with an std::ostream:
+ *
+ *   auto writer = AsyncFileWriter{filename};
+ *   auto ostream = std::ostream{&writer};
+ *   ostream.exceptions(std::ostream::failbit | std::ostream::badbit);
+ *   ...
+ *   writer.close();
+ *
+ * Seeking (e.g., to fill in an index at the start of the file) waits for all writes in flight, so that writes to the
+ * same bytes are never reordered. Failed writes are reported by the next operation that waits for a buffer or for the
+ * writes in flight, and by close(). The destructor completes all writes, but cannot report failures.
+ */
+class AsyncFileWriter : public std::streambuf, public Noncopyable {
+ public:
+  static constexpr auto BUFFER_SIZE = size_t{4 * 1024 * 1024};
+  static constexpr auto BUFFER_ALIGNMENT = size_t{4096};
+  static constexpr auto MAX_WRITES_IN_FLIGHT = size_t{4};
+
+  explicit AsyncFileWriter(const std::string& filename);
+  ~AsyncFileWriter() override;
+
+  // Writes the remaining data, waits for all writes and closes the file. Fails if any of the writes failed.
+  void close();
+
+ protected:
+  int_type overflow(int_type character) override;
+  std::streamsize xsputn(const char* data, std::streamsize size) override;
+  int sync() override;
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override;
+  pos_type seekpos(pos_type position, std::ios_base::openmode mode) override;
+
+ private:
+  struct Write {
+    char* buffer;
+    size_t size;
+    off_t offset;
+  };
+
+  struct BufferDeleter {
+    void operator()(char* buffer) const { std::free(buffer); }
+  };
+
+  // Hands the filled part of the current buffer to the write threads
+  void _submit_buffer();
+
+  // Makes a free buffer the current buffer, waiting for a write to complete if all buffers are in use
+  void _acquire_buffer();
+
+  void _wait_for_writes();
+  void _stop_write_threads();
+  void _write_loop();
+
+  const std::string _filename;
+  int _file_descriptor{-1};
+
+  // File offset of the first byte of the current buffer
+  off_t _buffer_offset{0};
+  char* _current_buffer{nullptr};
+
+  // Protects all members below
+  std::mutex _mutex;
+  std::condition_variable _pending_condition_variable;
+  std::condition_variable _completed_condition_variable;
+
+  std::vector<std::unique_ptr<char, BufferDeleter>> _buffers;
+  std::vector<char*> _free_buffers;
+  std::deque<Write> _pending_writes;
+
+  // Number of submitted writes that have not completed yet, both pending and running ones
+  size_t _writes_in_flight{0};
+  std::string _error;
+  bool _shutdown{false};
+
+  std::vector<std::thread> _write_threads;
+};
+
+}  // namespace opossum
@@ -58,7 +58,7 @@ class copyable_atomic {
   }
 
   template <typename... Args>
-  bool exchange(Args&&... args) {
+  T exchange(Args&&... args) {
     return _atomic.exchange(std::forward<Args>(args)...);
   }
 
@@ -0,0 +1,70 @@
+#include "date_time_utils.hpp"
+
+#include <cstdio>
+
+namespace {
+
+// Parses the count digits at string[offset], returns nullopt if one of them is not a digit
+std::optional<uint32_t> parse_digits(const std::string_view string, const size_t offset, const size_t count) {
+  auto value = uint32_t{0};
+  for (auto index = offset; index < offset + count; ++index) {
+    const auto character = string[index];
+    if (character < '0' || character > '9') return std::nullopt;
+    value = value * 10 + static_cast<uint32_t>(character - '0');
+  }
+  return value;
+}
+
+constexpr bool is_leap_year(const int32_t year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<int32_t> date_from_string(const std::string_view string) {
+  if (string.size() != 10 || string[4] != '-' || string[7] != '-') return std::nullopt;
+
+  const auto year = parse_digits(string, 0, 4);
+  const auto month = parse_digits(string, 5, 2);
+  const auto day = parse_digits(string, 8, 2);
+  if (!year || !month || !day || *month < 1 || *month > 12 || *day < 1) return std::nullopt;
+
+  constexpr uint32_t DAYS_PER_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const auto signed_year = static_cast<int32_t>(*year);
+  const auto days_in_month = DAYS_PER_MONTH[*month - 1] + (*month == 2 && is_leap_year(signed_year) ? 1 : 0);
+  if (*day > days_in_month) return std::nullopt;
+
+  return days_from_civil({signed_year, *month, *day});
+}
+
+std::optional<int64_t> timestamp_from_string(const std::string_view string) {
+  const auto date = date_from_string(string.substr(0, 10));
+  if (!date) return std::nullopt;
+  if (string.size() == 10) return *date * SECONDS_PER_DAY;
+
+  if (string.size() != 19 || string[10] != ' ' || string[13] != ':' || string[16] != ':') return std::nullopt;
+  const auto hour = parse_digits(string, 11, 2);
+  const auto minute = parse_digits(string, 14, 2);
+  const auto second = parse_digits(string, 17, 2);
+  if (!hour || !minute || !second || *hour > 23 || *minute > 59 || *second > 59) return std::nullopt;
+
+  return *date * SECONDS_PER_DAY + *hour * int64_t{3600} + *minute * int64_t{60} + *second;
+}
+
+std::string date_to_string(const int32_t date) {
+  const auto civil_date = civil_from_days(date);
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", civil_date.year, civil_date.month, civil_date.day);
+  return buffer;
+}
+
+std::string timestamp_to_string(const int64_t timestamp) {
+  const auto date = days_from_timestamp(timestamp);
+  const auto second_of_day = timestamp - date * SECONDS_PER_DAY;
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), " %02d:%02d:%02d", static_cast<int>(second_of_day / 3600),
+                static_cast<int>(second_of_day / 60 % 60), static_cast<int>(second_of_day % 60));
+  return date_to_string(date) + buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace opossum {
+
+/**
+ * Dates and timestamps that are stored as integers: DATE values are the days since 1970-01-01 (int32_t), TIMESTAMP
+ * values are the seconds since 1970-01-01 00:00:00 (int64_t). Unlike dates stored as "YYYY-MM-DD" strings, such
+ * columns are compared as integers, can be FrameOfReference-encoded, and have integer min/max filters for pruning.
+ * EXTRACT on them is computed arithmetically (see ExpressionEvaluator).
+ *
+ * The conversions use the proleptic Gregorian calendar and are constexpr so that they are inlined into the loops of
+ * the ExpressionEvaluator (cf. http://howardhinnant.github.io/date_algorithms.html).
+ */
+
+constexpr auto SECONDS_PER_DAY = int64_t{24 * 60 * 60};
+
+struct CivilDate {
+  int32_t year;
+  uint32_t month;  // 1-12
+  uint32_t day;    // 1-31
+
+  bool operator==(const CivilDate& other) const = default;
+};
+
+constexpr int32_t days_from_civil(const CivilDate& date) {
+  const auto year = date.year - (date.month <= 2 ? 1 : 0);
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+  const auto day_of_year = (153 * (date.month > 2 ? date.month - 3 : date.month + 9) + 2) / 5 + date.day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146'097 + static_cast<int32_t>(day_of_era) - 719'468;
+}
+
+constexpr CivilDate civil_from_days(const int32_t days) {
+  const auto shifted_days = days + 719'468;
+  const auto era = (shifted_days >= 0 ? shifted_days : shifted_days - 146'096) / 146'097;
+  const auto day_of_era = static_cast<uint32_t>(shifted_days - era * 146'097);
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36'524 - day_of_era / 146'096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;  // March is 0
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  return {static_cast<int32_t>(year_of_era) + era * 400 + (month <= 2 ? 1 : 0), month, day};
+}
+
+// Rounds towards negative infinity, so that timestamps before 1970 belong to the preceding day
+constexpr int32_t days_from_timestamp(const int64_t timestamp) {
+  return static_cast<int32_t>(timestamp >= 0 ? timestamp / SECONDS_PER_DAY
+                                             : (timestamp - SECONDS_PER_DAY + 1) / SECONDS_PER_DAY);
+}
+
+// Parses "YYYY-MM-DD". Returns nullopt if the string is malformed or not a valid date.
+std::optional<int32_t> date_from_string(const std::string_view string);
+
+// Parses "YYYY-MM-DD HH:MM:SS" or "YYYY-MM-DD" (i.e., midnight)
+std::optional<int64_t> timestamp_from_string(const std::string_view string);
+
+std::string date_to_string(const int32_t date);
+std::string timestamp_to_string(const int64_t timestamp);
+
+}  // namespace opossum
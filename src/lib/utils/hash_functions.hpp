@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Hash functions for the keys of the hash join and the hash aggregate. libstdc++'s std::hash is the identity for
+ * integers and a (comparatively slow) Murmur2 variant for strings. The identity makes the upper bits of the hash
+ * useless, so that radix partitions, bloom filter slots, and hash table buckets either have to scramble the hash
+ * again or are skewed for keys that are multiples of a power of two.
+ *
+ * KeyHash mixes integers with the finalizer of MurmurHash3 (two multiplications and three shifts) and hashes strings
+ * with a wyhash-style function that consumes eight bytes per step. Both only use 64-bit multiplications, so that they
+ * are fast without ISA-specific flags (e.g., for CRC32 instructions). Every bit of the result depends on every bit of
+ * the key, so that callers can take the partition from the lower bits and, e.g., a second bloom filter slot from the
+ * upper bits of the same hash.
+ *
+ * Types without a specialization fall back to std::hash.
+ */
+
+// MurmurHash3's fmix64
+constexpr uint64_t hash_mix(uint64_t key) {
+  key ^= key >> 33;
+  key *= uint64_t{0xFF51AFD7ED558CCD};
+  key ^= key >> 33;
+  key *= uint64_t{0xC4CEB9FE1A85EC53};
+  key ^= key >> 33;
+  return key;
+}
+
+namespace hash_functions_detail {
+
+constexpr auto SECRET_0 = uint64_t{0xA0761D6478BD642F};
+constexpr auto SECRET_1 = uint64_t{0xE7037ED1A0B428DB};
+constexpr auto SECRET_2 = uint64_t{0x8EBC6AF09C88C6E3};
+constexpr auto SECRET_3 = uint64_t{0x589965CC75374CC3};
+
+// Multiplies to 128 bits and folds the halves
+inline uint64_t multiply_fold(const uint64_t lhs, const uint64_t rhs) {
+  const auto product = static_cast<__uint128_t>(lhs) * rhs;
+  return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+}
+
+inline uint64_t read_64(const unsigned char* data) {
+  auto value = uint64_t{};
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline uint64_t read_32(const unsigned char* data) {
+  auto value = uint32_t{};
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+}  // namespace hash_functions_detail
+
+// wyhash (https://github.com/wangyi-fudan/wyhash). Keys of up to 16 bytes, which are most string keys, are read with
+// at most four overlapping loads and no loop.
+inline uint64_t hash_bytes(const void* bytes, const size_t size, uint64_t seed = 0) {
+  using namespace hash_functions_detail;  // NOLINT
+
+  const auto* data = static_cast<const unsigned char*>(bytes);
+  seed ^= SECRET_0;
+
+  auto first = uint64_t{0};
+  auto second = uint64_t{0};
+  if (size <= 16) {
+    if (size >= 4) {
+      const auto offset = (size >> 3) << 2;
+      first = (read_32(data) << 32) | read_32(data + offset);
+      second = (read_32(data + size - 4) << 32) | read_32(data + size - 4 - offset);
+    } else if (size > 0) {
+      first = (uint64_t{data[0]} << 16) | (uint64_t{data[size >> 1]} << 8) | data[size - 1];
+    }
+  } else {
+    auto remaining = size;
+    if (remaining > 48) {
+      auto seed_1 = seed;
+      auto seed_2 = seed;
+      do {
+        seed = multiply_fold(read_64(data) ^ SECRET_1, read_64(data + 8) ^ seed);
+        seed_1 = multiply_fold(read_64(data + 16) ^ SECRET_2, read_64(data + 24) ^ seed_1);
+        seed_2 = multiply_fold(read_64(data + 32) ^ SECRET_3, read_64(data + 40) ^ seed_2);
+        data += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed_1 ^ seed_2;
+    }
+    while (remaining > 16) {
+      seed = multiply_fold(read_64(data) ^ SECRET_1, read_64(data + 8) ^ seed);
+      data += 16;
+      remaining -= 16;
+    }
+    // The last 16 bytes, which may overlap with the ones that were already consumed
+    first = read_64(data + remaining - 16);
+    second = read_64(data + remaining - 8);
+  }
+
+  return multiply_fold(SECRET_1 ^ size, multiply_fold(first ^ SECRET_1, second ^ seed));
+}
+
+template <typename T, typename Enable = void>
+struct KeyHash : std::hash<T> {};
+
+template <typename T>
+struct KeyHash<T, std::enable_if_t<std::is_integral_v<T>>> {
+  size_t operator()(const T key) const { return hash_mix(static_cast<uint64_t>(key)); }
+};
+
+template <typename T>
+struct KeyHash<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  size_t operator()(const T key) const {
+    // -0.0 and 0.0 are equal and thus must have the same hash
+    if (key == T{0}) return hash_mix(0);
+
+    static_assert(sizeof(T) <= sizeof(uint64_t));
+    auto bits = uint64_t{0};
+    std::memcpy(&bits, &key, sizeof(T));
+    return hash_mix(bits);
+  }
+};
+
+template <>
+struct KeyHash<std::string_view> {
+  size_t operator()(const std::string_view key) const { return hash_bytes(key.data(), key.size()); }
+};
+
+template <>
+struct KeyHash<pmr_string> {
+  size_t operator()(const pmr_string& key) const { return hash_bytes(key.data(), key.size()); }
+};
+
+}  // namespace opossum
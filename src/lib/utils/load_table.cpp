@@ -7,7 +7,9 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -57,30 +59,74 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
 
   auto table = create_table_from_header(infile, chunk_size);
+  const auto column_count = table->column_count();
+
+  // The rows are collected column by column and converted into the ValueSegments of a chunk at once, instead of
+  // appending them one by one as AllTypeVariants
+  auto string_columns = std::vector<std::vector<std::string>>(column_count);
+  auto row_count = size_t{0};
+
+  const auto append_chunk = [&]() {
+    auto segments = Segments{};
+    segments.reserve(column_count);
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        // Reserve the full chunk size, as inserts can append to the last chunk if it is not finalized
+        auto values = pmr_vector<ColumnDataType>{};
+        values.reserve(chunk_size);
+
+        auto& string_column = string_columns[column_id];
+        if (table->column_is_nullable(column_id)) {
+          auto null_values = pmr_vector<bool>{};
+          null_values.reserve(chunk_size);
+
+          for (const auto& string_value : string_column) {
+            const auto is_null = string_value == "null";
+            null_values.emplace_back(is_null);
+            values.emplace_back(is_null ? ColumnDataType{} : boost::lexical_cast<ColumnDataType>(string_value));
+          }
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          for (const auto& string_value : string_column) {
+            values.emplace_back(boost::lexical_cast<ColumnDataType>(string_value));
+          }
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+        string_column.clear();
+      });
+    }
+
+    // All loaded rows are visible, the remaining rows of the chunk are left for inserts
+    const auto mvcc_data = std::make_shared<MvccData>(chunk_size, MvccData::MAX_COMMIT_ID);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+    }
+
+    // Chunks that reached their capacity are finalized, as Table::append() would have done it
+    if (!table->empty()) table->last_chunk()->finalize();
+    table->append_chunk(segments, mvcc_data);
+    row_count = 0;
+  };
 
   std::string line;
   while (std::getline(infile, line)) {
     auto string_values = split_string_by_delimiter(line, '|');
-    auto variant_values = std::vector<AllTypeVariant>(string_values.size());
-
-    for (auto column_id = ColumnID{0}; column_id < string_values.size(); ++column_id) {
-      if (table->column_is_nullable(column_id) && string_values[column_id] == "null") {
-        variant_values[column_id] = NULL_VALUE;
-      } else {
-        resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-          variant_values[column_id] = AllTypeVariant{boost::lexical_cast<ColumnDataType>(string_values[column_id])};
-        });
-      }
-    }
+    Assert(string_values.size() == column_count, "load_table: Invalid number of values in row of " + file_name);
 
-    table->append(variant_values);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      string_columns[column_id].emplace_back(std::move(string_values[column_id]));
+    }
 
-    auto mvcc_data = table->last_chunk()->mvcc_data();
-    mvcc_data->set_begin_cid(table->last_chunk()->size() - 1, 0);
+    ++row_count;
+    if (row_count == chunk_size) append_chunk();
   }
 
-  // All other chunks have been finalized by Table::append() when they reached their capacity.
+  if (row_count > 0) append_chunk();
+
   if (!table->empty() && finalize_last_chunk == FinalizeLastChunk::Yes) {
     table->last_chunk()->finalize();
   }
@@ -0,0 +1,48 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open '" + filename + "': " + std::strerror(errno));
+
+  struct stat file_status {};
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    Fail("Could not stat '" + filename + "': " + std::strerror(errno));
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // mmap rejects zero-length mappings. An empty file is represented by a nullptr with size 0.
+  if (_size > 0) {
+    auto* const mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+      close(file_descriptor);
+      Fail("Could not map '" + filename + "': " + std::strerror(errno));
+    }
+    _data = static_cast<const char*>(mapping);
+  }
+
+  // The mapping stays valid after the file descriptor has been closed.
+  close(file_descriptor);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+}  // namespace opossum
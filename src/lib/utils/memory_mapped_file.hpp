@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+ * Read-only, private memory mapping of an entire file. Pages are faulted in by the kernel on first access, so opening
+ * a file does not read it, and readers can parse the data in place instead of reading it into a buffer first. The
+ * mapping is released when the object is destroyed, i.e., pointers obtained via data() must not outlive it.
+ */
+class MemoryMappedFile : public Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& filename);
+  ~MemoryMappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ private:
+  const char* _data{nullptr};
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -4,7 +4,15 @@
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
+#include "utils/meta_tables/meta_lz4_block_cache_table.hpp"
+#include "utils/meta_tables/meta_memory_usage_table.hpp"
+#include "utils/meta_tables/meta_operator_samples_table.hpp"
+#include "utils/meta_tables/meta_operator_statistics_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_query_statistics_table.hpp"
+#include "utils/meta_tables/meta_running_queries_table.hpp"
+#include "utils/meta_tables/meta_scheduler_table.hpp"
+#include "utils/meta_tables/meta_scheduler_wait_times_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -20,9 +28,17 @@ MetaTableManager::MetaTableManager() {
                                                                        std::make_shared<MetaChunksTable>(),
                                                                        std::make_shared<MetaChunkSortOrdersTable>(),
                                                                        std::make_shared<MetaLogTable>(),
+                                                                       std::make_shared<MetaLZ4BlockCacheTable>(),
+                                                                       std::make_shared<MetaMemoryUsageTable>(),
+                                                                       std::make_shared<MetaOperatorSamplesTable>(),
+                                                                       std::make_shared<MetaOperatorStatisticsTable>(),
+                                                                       std::make_shared<MetaSchedulerTable>(),
+                                                                       std::make_shared<MetaSchedulerWaitTimesTable>(),
                                                                        std::make_shared<MetaSegmentsTable>(),
                                                                        std::make_shared<MetaSegmentsAccurateTable>(),
                                                                        std::make_shared<MetaPluginsTable>(),
+                                                                       std::make_shared<MetaQueryStatisticsTable>(),
+                                                                       std::make_shared<MetaRunningQueriesTable>(),
                                                                        std::make_shared<MetaSettingsTable>(),
                                                                        std::make_shared<MetaSystemInformationTable>(),
                                                                        std::make_shared<MetaSystemUtilizationTable>()};
@@ -34,6 +34,8 @@ class AbstractMetaTable : public Noncopyable {
   friend class MetaTableManagerTest;
   friend class MetaTableTest;
   friend class MetaPluginsTest;
+  friend class MetaQueryStatisticsTest;
+  friend class MetaSchedulerTest;
   friend class MetaSettingsTest;
   friend class MetaSystemUtilizationTest;
   friend class MetaSystemInformationTest;
@@ -0,0 +1,30 @@
+#include "meta_lz4_block_cache_table.hpp"
+
+#include "hyrise.hpp"
+
+namespace opossum {
+
+MetaLZ4BlockCacheTable::MetaLZ4BlockCacheTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"capacity_bytes", DataType::Long, false},
+                                               {"size_bytes", DataType::Long, false},
+                                               {"block_count", DataType::Long, false},
+                                               {"hit_count", DataType::Long, false},
+                                               {"miss_count", DataType::Long, false}}) {}
+
+const std::string& MetaLZ4BlockCacheTable::name() const {
+  static const auto name = std::string{"lz4_block_cache"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaLZ4BlockCacheTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& block_cache = Hyrise::get().lz4_block_cache;
+  output_table->append({static_cast<int64_t>(block_cache.capacity()), static_cast<int64_t>(block_cache.size_in_bytes()),
+                        static_cast<int64_t>(block_cache.block_count()), static_cast<int64_t>(block_cache.hit_count()),
+                        static_cast<int64_t>(block_cache.miss_count())});
+
+  return output_table;
+}
+
+}  // namespace opossum
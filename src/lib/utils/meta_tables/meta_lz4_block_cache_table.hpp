@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the state of the LZ4BlockCache, i.e., its size and how often point accesses to LZ4
+ * segments could be served without decompressing a block.
+ */
+class MetaLZ4BlockCacheTable : public AbstractMetaTable {
+ public:
+  MetaLZ4BlockCacheTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include "meta_memory_usage_table.hpp"
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/index/abstract_index.hpp"
+#include "storage/index/table/table_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Estimates the size of the statistics objects. The bins of histograms are counted with their bounds, height, and
+// distinct count, while the heap memory of string bounds is ignored.
+size_t statistics_memory_usage(const BaseAttributeStatistics& base_statistics) {
+  auto bytes = size_t{0};
+  resolve_data_type(base_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto& statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_statistics);
+
+    bytes += sizeof(statistics);
+    if (statistics.histogram) {
+      bytes += sizeof(AbstractHistogram<ColumnDataType>) +
+               statistics.histogram->bin_count() * (2 * sizeof(ColumnDataType) + 2 * sizeof(HistogramCountType));
+    }
+    if (statistics.min_max_filter) bytes += sizeof(MinMaxFilter<ColumnDataType>);
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (statistics.range_filter) {
+        bytes += sizeof(RangeFilter<ColumnDataType>) +
+                 statistics.range_filter->ranges.size() * sizeof(std::pair<ColumnDataType, ColumnDataType>);
+      }
+    }
+    if (statistics.null_value_ratio) bytes += sizeof(NullValueRatioStatistics);
+    if (statistics.distinct_count_sketch) bytes += sizeof(HyperLogLogSketch) + HyperLogLogSketch::REGISTER_COUNT;
+  });
+  return bytes;
+}
+
+}  // namespace
+
+namespace opossum {
+
+MetaMemoryUsageTable::MetaMemoryUsageTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                               {"column_name", DataType::String, true},
+                                               {"component", DataType::String, false},
+                                               {"encoding_type", DataType::String, true},
+                                               {"size_in_bytes", DataType::Long, false}}) {}
+
+const std::string& MetaMemoryUsageTable::name() const {
+  static const auto name = std::string{"memory_usage"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaMemoryUsageTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto column_count = table->column_count();
+    const auto chunk_count = table->chunk_count();
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto segment_bytes_by_encoding = std::map<EncodingType, size_t>{};
+      auto pruning_statistics_bytes = size_t{0};
+      auto chunk_index_bytes = size_t{0};
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& chunk = table->get_chunk(chunk_id);
+        if (!chunk) continue;  // Skip physically deleted chunks
+
+        const auto& segment = chunk->get_segment(column_id);
+        segment_bytes_by_encoding[get_segment_encoding_spec(segment).encoding_type] +=
+            segment->memory_usage(MemoryUsageCalculationMode::Full);
+
+        const auto& pruning_statistics = chunk->pruning_statistics();
+        if (pruning_statistics && (*pruning_statistics)[column_id]) {
+          pruning_statistics_bytes += statistics_memory_usage(*(*pruning_statistics)[column_id]);
+        }
+
+        // Indexes on multiple columns are accounted for their first column
+        for (const auto& index : chunk->get_indexes(std::vector<ColumnID>{column_id})) {
+          chunk_index_bytes += index->memory_consumption();
+        }
+      }
+
+      auto table_index_bytes = size_t{0};
+      for (const auto& table_index : table->table_indexes()) {
+        if (table_index->column_id() == column_id) table_index_bytes += table_index->memory_consumption();
+      }
+
+      const auto column_name = pmr_string{table->column_name(column_id)};
+      for (const auto& [encoding_type, bytes] : segment_bytes_by_encoding) {
+        output_table->append({pmr_string{table_name}, column_name, pmr_string{"segments"},
+                              pmr_string{encoding_type_to_string.left.at(encoding_type)}, static_cast<int64_t>(bytes)});
+      }
+      if (pruning_statistics_bytes > 0) {
+        output_table->append({pmr_string{table_name}, column_name, pmr_string{"pruning_statistics"}, NULL_VALUE,
+                              static_cast<int64_t>(pruning_statistics_bytes)});
+      }
+      if (chunk_index_bytes > 0) {
+        output_table->append({pmr_string{table_name}, column_name, pmr_string{"chunk_indexes"}, NULL_VALUE,
+                              static_cast<int64_t>(chunk_index_bytes)});
+      }
+      if (table_index_bytes > 0) {
+        output_table->append({pmr_string{table_name}, column_name, pmr_string{"table_indexes"}, NULL_VALUE,
+                              static_cast<int64_t>(table_index_bytes)});
+      }
+    }
+
+    auto mvcc_bytes = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      if (const auto mvcc_data = chunk->mvcc_data()) mvcc_bytes += mvcc_data->memory_usage();
+    }
+    if (mvcc_bytes > 0) {
+      output_table->append({pmr_string{table_name}, NULL_VALUE, pmr_string{"mvcc_data"}, NULL_VALUE,
+                            static_cast<int64_t>(mvcc_bytes)});
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the memory usage of all stored tables via a meta table, broken down by column and
+ * component: the segments of a column (one row per encoding type), its pruning statistics, and its chunk and table
+ * indexes, as well as the MVCC data of the table, which has no column. As segments track the heap memory of their
+ * strings when they are created or appended to, the sizes are exact and cheap to gather (unlike the distinct value
+ * counts of MetaSegmentsAccurateTable). The sizes of pruning statistics are estimated from their bins and ranges.
+ */
+class MetaMemoryUsageTable : public AbstractMetaTable {
+ public:
+  MetaMemoryUsageTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaMemoryUsageTableTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
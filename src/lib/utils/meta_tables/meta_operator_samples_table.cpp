@@ -0,0 +1,40 @@
+#include "meta_operator_samples_table.hpp"
+
+#include "hyrise.hpp"
+#include "utils/sampling_profiler.hpp"
+
+namespace opossum {
+
+MetaOperatorSamplesTable::MetaOperatorSamplesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"operator", DataType::String, false},
+                                               {"worker_id", DataType::Long, true},
+                                               {"walltime_ns", DataType::Long, false},
+                                               {"output_row_count", DataType::Long, false},
+                                               {"cache_misses", DataType::Long, true},
+                                               {"branch_misses", DataType::Long, true}}) {}
+
+const std::string& MetaOperatorSamplesTable::name() const {
+  static const auto name = std::string{"operator_samples"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaOperatorSamplesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& sampling_profiler = Hyrise::get().sampling_profiler;
+  if (!sampling_profiler) return output_table;
+
+  const auto optional_to_variant = [](const auto& value) {
+    return value ? AllTypeVariant{static_cast<int64_t>(*value)} : NULL_VALUE;
+  };
+
+  for (const auto& sample : sampling_profiler->samples()) {
+    output_table->append({pmr_string{sample.operator_name}, optional_to_variant(sample.worker_id),
+                          static_cast<int64_t>(sample.walltime.count()), static_cast<int64_t>(sample.output_row_count),
+                          optional_to_variant(sample.cache_misses), optional_to_variant(sample.branch_misses)});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the operator executions sampled by the SamplingProfiler (see sampling_profiler.hpp).
+ * The table is empty unless Hyrise::get().sampling_profiler is set.
+ */
+class MetaOperatorSamplesTable : public AbstractMetaTable {
+ public:
+  MetaOperatorSamplesTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
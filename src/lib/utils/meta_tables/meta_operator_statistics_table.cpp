@@ -0,0 +1,40 @@
+#include "meta_operator_statistics_table.hpp"
+
+#include "hyrise.hpp"
+
+namespace opossum {
+
+MetaOperatorStatisticsTable::MetaOperatorStatisticsTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"operator", DataType::String, false},
+                                               {"step", DataType::String, true},
+                                               {"execution_count", DataType::Long, false},
+                                               {"walltime_ns", DataType::Long, false},
+                                               {"input_row_count", DataType::Long, true},
+                                               {"output_row_count", DataType::Long, true},
+                                               {"output_memory_usage_bytes", DataType::Long, true}}) {}
+
+const std::string& MetaOperatorStatisticsTable::name() const {
+  static const auto name = std::string{"operator_statistics"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaOperatorStatisticsTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [operator_name, entry] : Hyrise::get().operator_statistics.entries()) {
+    const auto execution_count = static_cast<int64_t>(entry.execution_count);
+    output_table->append({pmr_string{operator_name}, NULL_VALUE, execution_count,
+                          static_cast<int64_t>(entry.walltime.count()), static_cast<int64_t>(entry.input_row_count),
+                          static_cast<int64_t>(entry.output_row_count),
+                          static_cast<int64_t>(entry.output_memory_usage)});
+
+    for (const auto& [step_name, step_runtime] : entry.step_runtimes) {
+      output_table->append({pmr_string{operator_name}, pmr_string{step_name}, execution_count,
+                            static_cast<int64_t>(step_runtime.count()), NULL_VALUE, NULL_VALUE, NULL_VALUE});
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
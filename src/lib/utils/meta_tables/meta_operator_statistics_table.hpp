@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the aggregated performance data of the executed operators (see
+ * operator_statistics.hpp). Each operator has one row with a NULL step and one row for each of its steps. The rows
+ * and memory of an operator are only shown in the former.
+ */
+class MetaOperatorStatisticsTable : public AbstractMetaTable {
+ public:
+  MetaOperatorStatisticsTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include "meta_query_statistics_table.hpp"
+
+#include "hyrise.hpp"
+#include "sql/sql_query_statistics.hpp"
+
+namespace opossum {
+
+namespace {
+
+const auto PHASE_NAMES = std::array<std::string, SQLQueryStatistics::PHASE_COUNT>{"parse", "translate", "optimize",
+                                                                                   "execute", "total"};
+
+TableColumnDefinitions query_statistics_column_definitions() {
+  auto column_definitions = TableColumnDefinitions{{"query", DataType::String, false},
+                                                   {"call_count", DataType::Long, false},
+                                                   {"row_count", DataType::Long, false},
+                                                   {"plan_cache_hit_count", DataType::Long, false},
+                                                   {"result_cache_hit_count", DataType::Long, false}};
+  for (const auto& phase_name : PHASE_NAMES) {
+    column_definitions.emplace_back(phase_name + "_total_ns", DataType::Long, false);
+    column_definitions.emplace_back(phase_name + "_mean_ns", DataType::Long, false);
+    column_definitions.emplace_back(phase_name + "_p99_ns", DataType::Long, false);
+  }
+  return column_definitions;
+}
+
+}  // namespace
+
+MetaQueryStatisticsTable::MetaQueryStatisticsTable() : AbstractMetaTable(query_statistics_column_definitions()) {}
+
+const std::string& MetaQueryStatisticsTable::name() const {
+  static const auto name = std::string{"query_statistics"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaQueryStatisticsTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& query_statistics = Hyrise::get().query_statistics;
+  if (!query_statistics) return output_table;
+
+  for (const auto& [query, entry] : query_statistics->entries()) {
+    auto values = std::vector<AllTypeVariant>{pmr_string{query}, static_cast<int64_t>(entry.call_count),
+                                              static_cast<int64_t>(entry.row_count),
+                                              static_cast<int64_t>(entry.plan_cache_hit_count),
+                                              static_cast<int64_t>(entry.result_cache_hit_count)};
+    for (auto phase_id = size_t{0}; phase_id < SQLQueryStatistics::PHASE_COUNT; ++phase_id) {
+      const auto total_duration = entry.total_durations[phase_id].count();
+      values.emplace_back(static_cast<int64_t>(total_duration));
+      values.emplace_back(static_cast<int64_t>(total_duration / static_cast<int64_t>(entry.call_count)));
+      values.emplace_back(static_cast<int64_t>(entry.p99(static_cast<SQLQueryStatistics::Phase>(phase_id)).count()));
+    }
+    output_table->append(values);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
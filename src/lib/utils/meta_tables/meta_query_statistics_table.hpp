@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the statistics of the executed queries (see sql_query_statistics.hpp), i.e., how often
+ * each normalized query was executed, how many rows it returned, and how much time its phases took. The table is empty
+ * unless Hyrise::get().query_statistics is set.
+ */
+class MetaQueryStatisticsTable : public AbstractMetaTable {
+ public:
+  MetaQueryStatisticsTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "meta_running_queries_table.hpp"
+
+#include "hyrise.hpp"
+#include "operators/pqp_utils.hpp"
+
+namespace opossum {
+
+MetaRunningQueriesTable::MetaRunningQueriesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"query_id", DataType::Long, false},
+                                               {"session_id", DataType::Long, false},
+                                               {"sql", DataType::String, false},
+                                               {"elapsed_time_ns", DataType::Long, false},
+                                               {"cancelled", DataType::Int, false},
+                                               {"operator", DataType::String, true},
+                                               {"processed_chunk_count", DataType::Long, true},
+                                               {"total_chunk_count", DataType::Long, true}}) {}
+
+const std::string& MetaRunningQueriesTable::name() const {
+  static const auto name = std::string{"running_queries"};
+  return name;
+}
+
+bool MetaRunningQueriesTable::can_delete() const { return true; }
+
+std::shared_ptr<Table> MetaRunningQueriesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& query_context : Hyrise::get().running_queries.query_contexts()) {
+    const auto query_id = static_cast<int64_t>(query_context->id());
+    const auto session_id = static_cast<int64_t>(query_context->session_id());
+    const auto sql = pmr_string{query_context->sql()};
+    const auto elapsed_time = static_cast<int64_t>(query_context->elapsed_time().count());
+    const auto cancelled = static_cast<int32_t>(query_context->is_cancelled());
+
+    const auto physical_plan = query_context->physical_plan();
+    if (!physical_plan) {
+      output_table->append({query_id, session_id, sql, elapsed_time, cancelled, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+      continue;
+    }
+
+    visit_pqp(physical_plan, [&](const auto& op) {
+      const auto [processed_chunk_count, total_chunk_count] = op->progress();
+      if (total_chunk_count == 0) {
+        // The operator does not report its progress
+        output_table->append(
+            {query_id, session_id, sql, elapsed_time, cancelled, pmr_string{op->name()}, NULL_VALUE, NULL_VALUE});
+      } else {
+        output_table->append({query_id, session_id, sql, elapsed_time, cancelled, pmr_string{op->name()},
+                              static_cast<int64_t>(processed_chunk_count), static_cast<int64_t>(total_chunk_count)});
+      }
+      return PQPVisitation::VisitInputs;
+    });
+  }
+
+  return output_table;
+}
+
+void MetaRunningQueriesTable::_on_remove(const std::vector<AllTypeVariant>& values) {
+  // A query that has finished in the meantime is not cancelled
+  Hyrise::get().running_queries.cancel(static_cast<uint64_t>(boost::get<int64_t>(values.at(0))));
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the SQL statements that are currently executed (see query_context.hpp) and the progress
+ * of their operators, one row per operator. Deleting the rows of a query cancels it.
+ */
+class MetaRunningQueriesTable : public AbstractMetaTable {
+ public:
+  MetaRunningQueriesTable();
+
+  const std::string& name() const final;
+
+  bool can_delete() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+
+  void _on_remove(const std::vector<AllTypeVariant>& values) final;
+};
+
+}  // namespace opossum
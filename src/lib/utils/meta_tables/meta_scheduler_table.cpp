@@ -0,0 +1,53 @@
+#include "meta_scheduler_table.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+
+namespace opossum {
+
+MetaSchedulerTable::MetaSchedulerTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"node_id", DataType::Int, false},
+                                               {"worker_id", DataType::Int, false},
+                                               {"cpu_id", DataType::Int, false},
+                                               {"finished_tasks", DataType::Long, false},
+                                               {"stolen_tasks", DataType::Long, false},
+                                               {"busy_time_ns", DataType::Long, false},
+                                               {"idle_time_ns", DataType::Long, false},
+                                               {"deque_size", DataType::Long, false},
+                                               {"node_queue_size_high", DataType::Long, false},
+                                               {"node_queue_size_default", DataType::Long, false},
+                                               {"node_queue_size_background", DataType::Long, false}}) {}
+
+const std::string& MetaSchedulerTable::name() const {
+  static const auto name = std::string{"scheduler"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaSchedulerTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler());
+  if (!scheduler) return output_table;
+
+  for (const auto& worker : scheduler->workers()) {
+    const auto statistics = worker->statistics();
+    const auto& queue = *worker->queue();
+    const auto queue_size = [&](const SchedulePriority priority) {
+      return static_cast<int64_t>(queue.estimated_size(static_cast<uint32_t>(priority)));
+    };
+
+    output_table->append({static_cast<int32_t>(queue.node_id()), static_cast<int32_t>(worker->id()),
+                          static_cast<int32_t>(worker->cpu_id()), static_cast<int64_t>(statistics.num_finished_tasks),
+                          static_cast<int64_t>(statistics.num_stolen_tasks),
+                          static_cast<int64_t>(statistics.busy_time.count()),
+                          static_cast<int64_t>(statistics.idle_time.count()),
+                          static_cast<int64_t>(statistics.deque_size), queue_size(SchedulePriority::High),
+                          queue_size(SchedulePriority::Default), queue_size(SchedulePriority::Background)});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
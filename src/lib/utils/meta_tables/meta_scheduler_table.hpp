@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the state of the workers of the NodeQueueScheduler, i.e., how many tasks they executed
+ * or stole from other workers, how long they were busy or idle, and how many tasks wait in their deques and in the
+ * queues of their nodes. Without a NodeQueueScheduler, the table is empty.
+ */
+class MetaSchedulerTable : public AbstractMetaTable {
+ public:
+  MetaSchedulerTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#include "meta_scheduler_wait_times_table.hpp"
+
+#include <magic_enum.hpp>
+
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+
+namespace opossum {
+
+MetaSchedulerWaitTimesTable::MetaSchedulerWaitTimesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"node_id", DataType::Int, false},
+                                               {"worker_id", DataType::Int, false},
+                                               {"priority", DataType::String, false},
+                                               {"max_wait_time_us", DataType::Long, true},
+                                               {"task_count", DataType::Long, false}}) {}
+
+const std::string& MetaSchedulerWaitTimesTable::name() const {
+  static const auto name = std::string{"scheduler_wait_times"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaSchedulerWaitTimesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler());
+  if (!scheduler) return output_table;
+
+  constexpr auto BUCKET_COUNT = WorkerStatistics::TASK_WAIT_TIME_BUCKET_COUNT;
+
+  for (const auto& worker : scheduler->workers()) {
+    const auto statistics = worker->statistics();
+    const auto node_id = static_cast<int32_t>(worker->queue()->node_id());
+
+    for (auto priority = uint32_t{0}; priority < TaskQueue::NUM_PRIORITY_LEVELS; ++priority) {
+      const auto priority_name = pmr_string{magic_enum::enum_name(static_cast<SchedulePriority>(priority))};
+
+      for (auto bucket_id = size_t{0}; bucket_id < BUCKET_COUNT; ++bucket_id) {
+        const auto task_count = statistics.task_wait_times[priority][bucket_id];
+        if (task_count == 0) continue;
+
+        const auto max_wait_time_us = bucket_id + 1 < BUCKET_COUNT
+                                          ? AllTypeVariant{static_cast<int64_t>(uint64_t{1} << bucket_id)}
+                                          : AllTypeVariant{NullValue{}};
+        output_table->append({node_id, static_cast<int32_t>(worker->id()), priority_name, max_wait_time_us,
+                              static_cast<int64_t>(task_count)});
+      }
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
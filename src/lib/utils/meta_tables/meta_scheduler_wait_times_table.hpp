@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing how long tasks waited between being enqueued and being executed, as histograms per
+ * worker of the NodeQueueScheduler and per SchedulePriority. Each row is a non-empty bucket, which counts the tasks
+ * whose wait time was below max_wait_time_us and at least half of it. The last bucket has no upper bound.
+ */
+class MetaSchedulerWaitTimesTable : public AbstractMetaTable {
+ public:
+  MetaSchedulerWaitTimesTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "meta_tables_table.hpp"
 
 #include "hyrise.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -16,6 +17,8 @@ const std::string& MetaTablesTable::name() const {
   return name;
 }
 
+bool MetaTablesTable::can_update() const { return true; }
+
 std::shared_ptr<Table> MetaTablesTable::_on_generate() const {
   auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
 
@@ -28,4 +31,18 @@ std::shared_ptr<Table> MetaTablesTable::_on_generate() const {
   return output_table;
 }
 
+void MetaTablesTable::_on_update(const std::vector<AllTypeVariant>& selected_values,
+                                 const std::vector<AllTypeVariant>& update_values) {
+  // All columns but the target_chunk_size describe the current state of the table
+  for (auto column_id = size_t{0}; column_id < 4; ++column_id) {
+    AssertInput(update_values[column_id] == selected_values[column_id], "Only the target_chunk_size can be updated.");
+  }
+
+  const auto& table_name = std::string{boost::get<pmr_string>(selected_values.at(0))};
+  const auto target_chunk_size = boost::get<int64_t>(update_values.at(4));
+  AssertInput(target_chunk_size > 0 && target_chunk_size <= Chunk::MAX_SIZE, "Invalid target chunk size.");
+  Hyrise::get().storage_manager.get_table(table_name)->set_target_chunk_size(
+      static_cast<ChunkOffset>(target_chunk_size));
+}
+
 }  // namespace opossum
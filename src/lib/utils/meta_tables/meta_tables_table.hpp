@@ -5,17 +5,23 @@
 namespace opossum {
 
 /**
- * This is a class for showing all stored tables via a meta table.
+ * This is a class for showing all stored tables via a meta table. Updating the target_chunk_size of a table changes
+ * the size of the chunks appended to it afterwards (see Table::set_target_chunk_size()).
  */
 class MetaTablesTable : public AbstractMetaTable {
  public:
   MetaTablesTable();
   const std::string& name() const final;
 
+  bool can_update() const final;
+
  protected:
   friend class MetaTableManager;
 
   std::shared_ptr<Table> _on_generate() const final;
+
+  void _on_update(const std::vector<AllTypeVariant>& selected_values,
+                  const std::vector<AllTypeVariant>& update_values) final;
 };
 
 }  // namespace opossum
@@ -0,0 +1,158 @@
+#include "sampling_profiler.hpp"
+
+#include <atomic>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/worker.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Counts the cache misses and branch misses of the calling thread in user space
+class HardwareCounters : public Noncopyable {
+ public:
+  HardwareCounters() {
+#ifdef __linux__
+    auto attributes = perf_event_attr{};
+    attributes.size = sizeof(perf_event_attr);
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_GROUP;
+    _leader_fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    if (_leader_fd < 0) return;
+
+    attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+    _member_fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, _leader_fd, 0));
+    if (_member_fd < 0) {
+      close(_leader_fd);
+      _leader_fd = -1;
+    }
+#endif
+  }
+
+  ~HardwareCounters() {
+#ifdef __linux__
+    if (_member_fd >= 0) close(_member_fd);
+    if (_leader_fd >= 0) close(_leader_fd);
+#endif
+  }
+
+  // Returns the cache misses and the branch misses so far
+  std::optional<std::pair<uint64_t, uint64_t>> read() const {
+#ifdef __linux__
+    if (_leader_fd < 0) return std::nullopt;
+
+    struct {
+      uint64_t counter_count;
+      uint64_t values[2];
+    } group{};
+    if (::read(_leader_fd, &group, sizeof(group)) != static_cast<ssize_t>(sizeof(group))) return std::nullopt;
+    return std::pair{group.values[0], group.values[1]};
+#else
+    return std::nullopt;
+#endif
+  }
+
+ private:
+  int _leader_fd{-1};
+  int _member_fd{-1};
+};
+
+std::atomic<uint64_t> next_profiler_id{1};
+
+}  // namespace
+
+struct SamplingProfiler::RingBuffer {
+  std::mutex mutex;
+  std::vector<Sample> samples;
+  size_t sample_count{0};
+};
+
+struct SamplingProfiler::ThreadState {
+  uint64_t profiler_id{0};
+  size_t execution_count{0};
+  std::shared_ptr<RingBuffer> ring_buffer;
+
+  // Opened with the first sampled operator of the thread
+  std::optional<HardwareCounters> hardware_counters;
+};
+
+SamplingProfiler::Measurement::Measurement(ThreadState& thread_state) : _thread_state(&thread_state) {
+  if (!thread_state.hardware_counters) thread_state.hardware_counters.emplace();
+  _started_counters = thread_state.hardware_counters->read();
+  _started = std::chrono::steady_clock::now();
+}
+
+void SamplingProfiler::Measurement::stop(const AbstractOperator& op) {
+  if (!_thread_state) return;
+
+  const auto done = std::chrono::steady_clock::now();
+  const auto done_counters = _thread_state->hardware_counters->read();
+
+  auto sample = Sample{};
+  sample.operator_name = op.name();
+  if (const auto worker = Worker::get_this_thread_worker()) sample.worker_id = worker->id();
+  sample.walltime = std::chrono::duration_cast<std::chrono::nanoseconds>(done - _started);
+  sample.output_row_count = op.performance_data->output_row_count;
+  if (_started_counters && done_counters) {
+    sample.cache_misses = done_counters->first - _started_counters->first;
+    sample.branch_misses = done_counters->second - _started_counters->second;
+  }
+
+  auto& ring_buffer = *_thread_state->ring_buffer;
+  const auto lock = std::lock_guard<std::mutex>{ring_buffer.mutex};
+  if (ring_buffer.samples.size() < RING_BUFFER_SIZE) {
+    ring_buffer.samples.emplace_back(std::move(sample));
+  } else {
+    ring_buffer.samples[ring_buffer.sample_count % RING_BUFFER_SIZE] = std::move(sample);
+  }
+  ++ring_buffer.sample_count;
+}
+
+SamplingProfiler::SamplingProfiler(const size_t sampling_interval)
+    : _id(next_profiler_id++), _sampling_interval(sampling_interval) {
+  Assert(_sampling_interval > 0, "Sampling interval must be positive");
+}
+
+SamplingProfiler::Measurement SamplingProfiler::start() {
+  auto& thread_state = _this_thread_state();
+  if (thread_state.profiler_id != _id) {
+    thread_state.profiler_id = _id;
+    thread_state.execution_count = 0;
+    thread_state.ring_buffer = std::make_shared<RingBuffer>();
+
+    const auto lock = std::lock_guard<std::mutex>{_ring_buffers_mutex};
+    _ring_buffers.emplace_back(thread_state.ring_buffer);
+  }
+
+  if (thread_state.execution_count++ % _sampling_interval != 0) return Measurement{};
+  return Measurement{thread_state};
+}
+
+std::vector<SamplingProfiler::Sample> SamplingProfiler::samples() const {
+  auto samples = std::vector<Sample>{};
+
+  const auto lock = std::lock_guard<std::mutex>{_ring_buffers_mutex};
+  for (const auto& ring_buffer : _ring_buffers) {
+    const auto ring_buffer_lock = std::lock_guard<std::mutex>{ring_buffer->mutex};
+    samples.insert(samples.end(), ring_buffer->samples.cbegin(), ring_buffer->samples.cend());
+  }
+
+  return samples;
+}
+
+SamplingProfiler::ThreadState& SamplingProfiler::_this_thread_state() {
+  thread_local auto thread_state = ThreadState{};
+  return thread_state;
+}
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Samples the execution of operators with low overhead. Set Hyrise::get().sampling_profiler to enable it. The samples
+ * are exposed by the meta_operator_samples table.
+ *
+ * Each thread measures only every sampling_interval-th operator that it executes. For a sampled operator, the
+ * walltime and, if available, the hardware counters for cache misses and branch misses (via perf_event_open on Linux)
+ * are recorded. The counters are opened once per thread and are only read before and after the sampled operators, so
+ * that the other operators do not pay for them. The counters only cover the thread that executes the operator, not the
+ * jobs that it schedules on other workers.
+ *
+ * The samples are written to a ring buffer of the thread, which keeps the last RING_BUFFER_SIZE samples. The buffers
+ * are only locked when they are written to or read from, so that the threads do not contend.
+ */
+class SamplingProfiler : public Noncopyable {
+  struct RingBuffer;
+  struct ThreadState;
+
+ public:
+  static constexpr auto DEFAULT_SAMPLING_INTERVAL = size_t{64};
+  static constexpr auto RING_BUFFER_SIZE = size_t{4'096};
+
+  struct Sample {
+    std::string operator_name;
+    std::optional<WorkerID> worker_id;
+    std::chrono::nanoseconds walltime{0};
+    uint64_t output_row_count{0};
+
+    // std::nullopt if the hardware counters are not available, e.g., because of the perf_event_paranoid setting
+    std::optional<uint64_t> cache_misses;
+    std::optional<uint64_t> branch_misses;
+  };
+
+  // Started by AbstractOperator::execute() before the operator is executed and stopped afterwards
+  class Measurement {
+   public:
+    // Returns a measurement that does nothing if the operator is not sampled
+    Measurement() = default;
+
+    void stop(const AbstractOperator& op);
+
+   private:
+    friend class SamplingProfiler;
+
+    explicit Measurement(ThreadState& thread_state);
+
+    ThreadState* _thread_state{nullptr};
+    std::optional<std::pair<uint64_t, uint64_t>> _started_counters;
+    std::chrono::steady_clock::time_point _started;
+  };
+
+  explicit SamplingProfiler(const size_t sampling_interval = DEFAULT_SAMPLING_INTERVAL);
+
+  Measurement start();
+
+  // Returns the samples of all threads
+  std::vector<Sample> samples() const;
+
+ private:
+  static ThreadState& _this_thread_state();
+
+  // Identifies the profiler in the thread-local state, so that a replaced profiler is not written to
+  const uint64_t _id;
+  const size_t _sampling_interval;
+
+  mutable std::mutex _ring_buffers_mutex;
+  std::vector<std::shared_ptr<RingBuffer>> _ring_buffers;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <random>
+#include <type_traits>
 
 #include "types.hpp"
 
@@ -30,6 +31,32 @@ string_heap_size(const T& string) {
   return 0;
 }
 
+/**
+ * Returns the number of bytes that the strings of the given vector allocate on the heap, or zero for vectors of other
+ * types. Segments compute this when they are created or appended to, so that their memory usage is known exactly
+ * without visiting all strings (see string_vector_memory_usage() below).
+ */
+template <typename V>
+size_t string_vector_heap_size(const V& vector) {
+  if constexpr (std::is_same_v<typename V::value_type, pmr_string>) {
+    auto heap_size = size_t{0};
+    for (const auto& string : vector) {
+      heap_size += string_heap_size(string);
+    }
+    return heap_size;
+  } else {
+    return 0;
+  }
+}
+
+/**
+ * Returns the memory usage of a string vector whose strings allocate `heap_size` bytes on the heap
+ */
+template <typename V>
+size_t string_vector_memory_usage(const V& string_vector, const size_t heap_size) {
+  return sizeof(V) + string_vector.capacity() * sizeof(typename V::value_type) + heap_size;
+}
+
 /**
   * This function iterates over the given string vector @param string_vector strings and sums up the memory usage. Due
   * to the small string optimization (SSO) in most current C++ libraries, each string has an initially allocated buffer
@@ -6,8 +6,10 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "operators/limit.hpp"
+#include "operators/pipelined_table_scan.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "visualization/abstract_visualizer.hpp"
@@ -107,11 +109,23 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
       _visualize_subqueries(op, table_scan->predicate(), visualized_ops);
     } break;
 
+    case OperatorType::PipelinedTableScan: {
+      const auto pipelined_table_scan = std::dynamic_pointer_cast<const PipelinedTableScan>(op);
+      for (const auto& predicate : pipelined_table_scan->predicates()) {
+        _visualize_subqueries(op, predicate, visualized_ops);
+      }
+    } break;
+
     case OperatorType::Limit: {
       const auto limit = std::dynamic_pointer_cast<const Limit>(op);
       _visualize_subqueries(op, limit->row_count_expression(), visualized_ops);
     } break;
 
+    case OperatorType::TopK: {
+      const auto top_k = std::dynamic_pointer_cast<const TopK>(op);
+      _visualize_subqueries(op, top_k->row_count_expression(), visualized_ops);
+    } break;
+
     default: {
     }  // OperatorType has no expressions
   }
@@ -167,6 +181,9 @@ void PQPVisualizer::_build_dataflow(const std::shared_ptr<const AbstractOperator
 void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>& op) {
   VizVertexInfo info = _default_vertex;
   auto label = op->description(DescriptionMode::MultiLine);
+  if (!op->comment.empty()) {
+    label += "\n(" + op->comment + ")";
+  }
 
   const auto& performance_data = *op->performance_data;
   if (performance_data.executed) {
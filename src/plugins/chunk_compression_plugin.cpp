@@ -0,0 +1,73 @@
+#include "chunk_compression_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+std::string ChunkCompressionPlugin::description() const { return "Chunk compression plugin"; }
+
+void ChunkCompressionPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_COMPRESSION, [&](size_t) { _compression_loop(); });
+}
+
+void ChunkCompressionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+}
+
+void ChunkCompressionPlugin::_compression_loop() {
+  const auto completed_chunks = _find_completed_chunks();
+  const auto compressed_chunk_count = std::min(completed_chunks.size(), MAX_CHUNKS_PER_ITERATION);
+  if (compressed_chunk_count == 0) return;
+
+  // The chunks are compressed one after another, so that the plugin occupies at most one worker
+  for (auto chunk_index = size_t{0}; chunk_index < compressed_chunk_count; ++chunk_index) {
+    const auto& [table_name, chunk_id] = completed_chunks[chunk_index];
+    const auto task = std::make_shared<ChunkCompressionTask>(table_name, chunk_id, std::nullopt,
+                                                             SchedulePriority::Background);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({task});
+  }
+
+  std::ostringstream message;
+  message << "Compressed " << compressed_chunk_count << " of " << completed_chunks.size() << " completed chunk(s)";
+  Hyrise::get().log_manager.add_message("ChunkCompressionPlugin", message.str(), LogLevel::Info);
+}
+
+std::vector<std::pair<std::string, ChunkID>> ChunkCompressionPlugin::_find_completed_chunks() {
+  auto completed_chunks_by_table = std::vector<std::pair<std::string, std::vector<ChunkID>>>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || !chunk->is_mutable()) continue;
+      if (!ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) continue;
+      chunk_ids.emplace_back(chunk_id);
+    }
+
+    if (!chunk_ids.empty()) completed_chunks_by_table.emplace_back(table_name, std::move(chunk_ids));
+  }
+
+  // Interleave the chunks of the tables
+  auto completed_chunks = std::vector<std::pair<std::string, ChunkID>>{};
+  for (auto chunk_index = size_t{0};; ++chunk_index) {
+    auto added_chunk = false;
+    for (const auto& [table_name, chunk_ids] : completed_chunks_by_table) {
+      if (chunk_index >= chunk_ids.size()) continue;
+      completed_chunks.emplace_back(table_name, chunk_ids[chunk_index]);
+      added_chunk = true;
+    }
+    if (!added_chunk) break;
+  }
+
+  return completed_chunks;
+}
+
+EXPORT_PLUGIN(ChunkCompressionPlugin)
+
+}  // namespace opossum
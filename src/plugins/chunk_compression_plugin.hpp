@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/table.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/*
+ * Encodes the chunks of stored tables once they are completed, i.e., once they are full and all inserts into them
+ * have been committed or rolled back (see ChunkCompressionTask). Without this plugin, chunks that are filled by an
+ * insert workload remain mutable and keep their ValueSegments until someone schedules a ChunkCompressionTask, which
+ * costs memory and scan performance and leaves the chunks without pruning statistics.
+ *
+ * In each iteration, the plugin looks for completed mutable chunks in all tables. To limit the resources it takes from
+ * the queries, it compresses at most MAX_CHUNKS_PER_ITERATION chunks per iteration, one after another, in
+ * ChunkCompressionTasks with SchedulePriority::Background. The candidates are taken round-robin from the tables, so
+ * that a table with many inserts does not starve the others, and in the order of their chunk ids within each table.
+ * The ChunkCompressionTask finalizes the chunks, replaces their segments with the encoded ones, and generates their
+ * pruning statistics, while queries continue to read the previous segments.
+ */
+class ChunkCompressionPlugin : public AbstractPlugin {
+  friend class ChunkCompressionPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * MAX_CHUNKS_PER_ITERATION: the number of chunks that are compressed per iteration at most
+   * IDLE_DELAY_COMPRESSION: sleep after each iteration
+   */
+  constexpr static size_t MAX_CHUNKS_PER_ITERATION = 16;
+  constexpr static std::chrono::milliseconds IDLE_DELAY_COMPRESSION = std::chrono::milliseconds(1000);
+
+ private:
+  void _compression_loop();
+
+  // Returns the completed mutable chunks of all tables in the order in which they are compressed
+  static std::vector<std::pair<std::string, ChunkID>> _find_completed_chunks();
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,305 @@
+#include "clustering_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/sort.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Same order as checked by Chunk::set_individually_sorted_by(): NULLs first, then the values in ascending order
+bool is_sorted_ascending(const AbstractSegment& segment) {
+  auto is_sorted = true;
+  segment_with_iterators(segment, [&](auto begin, auto end) {
+    is_sorted = std::is_sorted(begin, end, [](const auto& left, const auto& right) {
+      if (right.is_null()) return false;
+      if (left.is_null()) return true;
+      return left.value() < right.value();
+    });
+  });
+  return is_sorted;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string ClusteringPlugin::description() const { return "Clustering plugin"; }
+
+void ClusteringPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_CLUSTERING, [&](size_t) { _clustering_loop(); });
+}
+
+void ClusteringPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+
+  // Chunks that were deleted logically remain in their tables, but are invisible for new transactions
+  _physical_delete_queue = {};
+  _predicate_executions.clear();
+  _last_lqp_frequencies.clear();
+  _last_parameterized_plan_frequencies.clear();
+}
+
+/**
+ * This function determines the clustering columns from the cached plans and clusters groups of cold chunks that are not
+ * sorted by them yet.
+ */
+void ClusteringPlugin::_clustering_loop() {
+  _delete_chunks_physically();
+  _update_predicate_executions();
+
+  for (const auto& [table_name, column_id] : _clustering_columns()) {
+    const auto table = Hyrise::get().storage_manager.get_table(table_name);
+    if (table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    // Skip the last chunk, which is currently used for insertions
+    auto chunk_ids = std::vector<ChunkID>{};
+    const auto max_chunk_id = static_cast<ChunkID>(std::max(table->chunk_count(), ChunkID{1}) - 1);
+    for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id && chunk_ids.size() < MAX_CHUNKS_PER_CLUSTERING;
+         ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id()) continue;
+
+      const auto& sorted_by = chunk->individually_sorted_by();
+      if (!sorted_by.empty() && sorted_by.front().column == column_id) continue;
+
+      if (!_is_cold(*chunk)) continue;
+
+      chunk_ids.emplace_back(chunk_id);
+    }
+
+    if (chunk_ids.size() < MIN_CHUNKS_PER_CLUSTERING) continue;
+
+    if (_cluster_chunks(table_name, column_id, chunk_ids)) {
+      std::ostringstream message;
+      message << "Clustered " << chunk_ids.size() << " chunk(s) of " << table_name << " by "
+              << table->column_name(column_id);
+      Hyrise::get().log_manager.add_message("ClusteringPlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
+
+void ClusteringPlugin::_update_predicate_executions() {
+  for (auto& [_, execution_count] : _predicate_executions) {
+    execution_count *= EXECUTIONS_DECAY;
+  }
+
+  // Plans that were evicted and cached again start with a new frequency
+  const auto add_plans = [&](const auto& snapshot, auto& last_frequencies, const auto& get_lqp) {
+    auto frequencies = std::map<std::string, size_t>{};
+    for (const auto& [key, entry] : snapshot) {
+      const auto frequency = entry.frequency.value_or(size_t{1});
+      auto execution_count = frequency;
+      const auto last_frequency = last_frequencies.find(key);
+      if (last_frequency != last_frequencies.end() && last_frequency->second <= frequency) {
+        execution_count = frequency - last_frequency->second;
+      }
+      frequencies.emplace(key, frequency);
+
+      if (execution_count > 0) _add_plan(get_lqp(entry.value), execution_count);
+    }
+    last_frequencies = std::move(frequencies);
+  };
+
+  if (const auto& lqp_cache = Hyrise::get().default_lqp_cache) {
+    add_plans(lqp_cache->snapshot(), _last_lqp_frequencies, [](const auto& lqp) { return lqp; });
+  }
+  if (const auto& parameterized_plan_cache = Hyrise::get().parameterized_plan_cache) {
+    add_plans(parameterized_plan_cache->snapshot(), _last_parameterized_plan_frequencies,
+              [](const auto& prepared_plan) { return prepared_plan->lqp; });
+  }
+
+  // Forget about the columns that are no longer filtered on
+  for (auto executions_it = _predicate_executions.begin(); executions_it != _predicate_executions.end();) {
+    if (executions_it->second < 1.0 || !Hyrise::get().storage_manager.has_table(executions_it->first.first)) {
+      executions_it = _predicate_executions.erase(executions_it);
+    } else {
+      ++executions_it;
+    }
+  }
+}
+
+void ClusteringPlugin::_add_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t execution_count) {
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+    // Comparisons and BETWEEN predicates prune chunks if the compared values are known at the latest when the scan is
+    // executed (see AbstractDereferencedColumnTableScanImpl::_can_prune())
+    const auto predicate =
+        std::dynamic_pointer_cast<AbstractPredicateExpression>(static_cast<const PredicateNode&>(*node).predicate());
+    if (!predicate || (!is_binary_numeric_predicate_condition(predicate->predicate_condition) &&
+                       !is_between_predicate_condition(predicate->predicate_condition))) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto column_expression = std::shared_ptr<LQPColumnExpression>{};
+    for (const auto& argument : predicate->arguments) {
+      if (argument->type == ExpressionType::LQPColumn) {
+        // Column-to-column predicates do not profit from clustering
+        if (column_expression) return LQPVisitation::VisitInputs;
+        column_expression = std::static_pointer_cast<LQPColumnExpression>(argument);
+      } else if (argument->type != ExpressionType::Value && argument->type != ExpressionType::Placeholder &&
+                 argument->type != ExpressionType::CorrelatedParameter) {
+        return LQPVisitation::VisitInputs;
+      }
+    }
+    if (!column_expression) return LQPVisitation::VisitInputs;
+
+    const auto original_node = column_expression->original_node.lock();
+    if (!original_node || original_node->type != LQPNodeType::StoredTable) return LQPVisitation::VisitInputs;
+
+    const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+    _predicate_executions[TableAndColumnID{table_name, column_expression->original_column_id}] +=
+        static_cast<double>(execution_count);
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+std::map<std::string, ColumnID> ClusteringPlugin::_clustering_columns() const {
+  auto clustering_columns = std::map<std::string, ColumnID>{};
+  auto clustering_column_executions = std::map<std::string, double>{};
+  for (const auto& [table_and_column_id, execution_count] : _predicate_executions) {
+    const auto& [table_name, column_id] = table_and_column_id;
+    if (execution_count < MIN_PREDICATE_EXECUTIONS) continue;
+
+    auto& max_execution_count = clustering_column_executions[table_name];
+    if (execution_count <= max_execution_count) continue;
+
+    max_execution_count = execution_count;
+    clustering_columns[table_name] = column_id;
+  }
+  return clustering_columns;
+}
+
+bool ClusteringPlugin::_is_cold(const Chunk& chunk) {
+  auto highest_commit_id = CommitID{0};
+  const auto chunk_size = chunk.size();
+  const auto mvcc_data = chunk.mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    for (const auto commit_id : {mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset)}) {
+      if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_commit_id) {
+        highest_commit_id = commit_id;
+      }
+    }
+  }
+
+  return highest_commit_id + CLUSTERING_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
+}
+
+bool ClusteringPlugin::_cluster_chunks(const std::string& table_name, const ColumnID column_id,
+                                       const std::vector<ChunkID>& chunk_ids) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // The reinserted rows are encoded like the first of the clustered chunks
+  const auto& first_chunk = table->get_chunk(chunk_ids.front());
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto chunk_column_id = ColumnID{0}; chunk_column_id < table->column_count(); ++chunk_column_id) {
+    chunk_encoding_spec.emplace_back(get_segment_encoding_spec(first_chunk->get_segment(chunk_column_id)));
+  }
+
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (std::find(chunk_ids.cbegin(), chunk_ids.cend(), chunk_id) == chunk_ids.cend()) {
+      excluded_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>{});
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{column_id}};
+  const auto sort = std::make_shared<Sort>(validate, sort_definitions, table->target_chunk_size());
+  sort->execute();
+
+  // The Insert of the Update continues the last chunk of the table, so that this chunk might hold both other and
+  // reinserted rows
+  const auto first_target_chunk_id = ChunkID{table->chunk_count() - 1};
+
+  const auto update = std::make_shared<Update>(table_name, validate, sort);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+
+  if (update->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed Update directly, that is
+    // our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  transaction_context->commit();
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+    _physical_delete_queue.emplace(table, chunk_id);
+  }
+
+  _finalize_clustered_chunks(table, column_id, first_target_chunk_id, chunk_encoding_spec);
+  return true;
+}
+
+void ClusteringPlugin::_finalize_clustered_chunks(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                                  const ChunkID first_chunk_id,
+                                                  const ChunkEncodingSpec& chunk_encoding_spec) {
+  const auto target_chunk_size = table->target_chunk_size();
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{column_id}};
+
+  // The last chunk remains the target of insertions
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = first_chunk_id; chunk_id + 1 < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    // Other transactions might still be writing their rows, which are committed (or rolled back) later
+    if (!chunk || !chunk->is_mutable() || !ChunkCompressionTask::chunk_is_completed(chunk, target_chunk_size)) {
+      continue;
+    }
+
+    chunk->finalize();
+    ChunkEncoder::encode_chunks(table, {chunk_id}, {{chunk_id, chunk_encoding_spec}});
+    if (is_sorted_ascending(*chunk->get_segment(column_id))) {
+      chunk->set_individually_sorted_by(sort_definitions);
+    }
+  }
+}
+
+void ClusteringPlugin::_delete_chunks_physically() {
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+
+  // The chunks were deleted in the order of their cleanup commit IDs
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table, chunk_id] = _physical_delete_queue.front();
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk) {
+      if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) break;
+      table->remove_chunk(chunk_id);
+    }
+    _physical_delete_queue.pop();
+  }
+}
+
+EXPORT_PLUGIN(ClusteringPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/*
+ * Clusters the immutable chunks of tables by the column that the workload filters on most, so that the
+ * ChunkPruningRule, the scan-time pruning, and the sorted segment search skip more data. In each iteration, the
+ * executions of the cached plans (default LQP cache and parameterized plan cache) since the previous iteration are
+ * attributed to the columns of stored tables that their predicates compare with values or placeholders. These counts
+ * decay with every iteration. The column with the most executions becomes the clustering column of its table once it
+ * reaches MIN_PREDICATE_EXECUTIONS.
+ *
+ * Cold immutable chunks that are not sorted by the clustering column yet are clustered in groups of up to
+ * MAX_CHUNKS_PER_CLUSTERING: Like the MvccDeletePlugin, the plugin deletes their valid rows and reinserts them, sorted
+ * by the clustering column, in a single transaction. Old transactions still see the rows in their original chunks, new
+ * ones see them in the new chunks. Thus, the rows of the group are range-partitioned over the new chunks. Once they
+ * are full and their rows are committed, the new chunks are finalized, encoded like the original chunks, and marked as
+ * sorted if they only contain sorted rows. The original chunks are removed from the table as soon as no active
+ * transaction can see them anymore.
+ */
+class ClusteringPlugin : public AbstractPlugin {
+  friend class ClusteringPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * MIN_PREDICATE_EXECUTIONS: the (decayed) number of predicate executions a column needs to become the clustering
+   * column of its table
+   * EXECUTIONS_DECAY: factor that the predicate executions are multiplied with in every iteration
+   * MIN_CHUNKS_PER_CLUSTERING: the number of chunks that have to be clustered together. Clustering a single chunk
+   * would mostly move its rows to the end of the table.
+   * MAX_CHUNKS_PER_CLUSTERING: the number of chunks that are clustered together at most, which limits the size of the
+   * transaction
+   * CLUSTERING_THRESHOLD_LAST_COMMIT: the number of commits that must have passed since the rows of a chunk were
+   * inserted or invalidated the last time
+   * IDLE_DELAY_CLUSTERING: sleep after each iteration
+   */
+  constexpr static double MIN_PREDICATE_EXECUTIONS = 10.0;
+  constexpr static double EXECUTIONS_DECAY = 0.5;
+  constexpr static size_t MIN_CHUNKS_PER_CLUSTERING = 2;
+  constexpr static size_t MAX_CHUNKS_PER_CLUSTERING = 16;
+  constexpr static CommitID CLUSTERING_THRESHOLD_LAST_COMMIT = CommitID{100};
+  constexpr static std::chrono::milliseconds IDLE_DELAY_CLUSTERING = std::chrono::milliseconds(10'000);
+
+ private:
+  using TableAndColumnID = std::pair<std::string, ColumnID>;
+
+  void _clustering_loop();
+
+  // Adds the executions of the cached plans since the previous iteration to _predicate_executions
+  void _update_predicate_executions();
+
+  void _add_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t execution_count);
+
+  // The column with the most predicate executions per table, if they reach MIN_PREDICATE_EXECUTIONS
+  std::map<std::string, ColumnID> _clustering_columns() const;
+
+  // Returns whether the chunk has not been modified within the last CLUSTERING_THRESHOLD_LAST_COMMIT commits
+  static bool _is_cold(const Chunk& chunk);
+
+  // Reinserts the valid rows of the given chunks sorted by the column and deletes the chunks logically. Returns false
+  // if the transaction conflicted with another one.
+  bool _cluster_chunks(const std::string& table_name, const ColumnID column_id, const std::vector<ChunkID>& chunk_ids);
+
+  // Finalizes and encodes the full chunks starting at first_chunk_id whose rows are all committed. Chunks whose
+  // segment of the column is sorted are marked as such.
+  static void _finalize_clustered_chunks(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                         const ChunkID first_chunk_id, const ChunkEncodingSpec& chunk_encoding_spec);
+
+  // Removes the logically deleted chunks from their tables once no active transaction can see them anymore
+  void _delete_chunks_physically();
+
+  std::map<TableAndColumnID, double> _predicate_executions;
+  std::map<std::string, size_t> _last_lqp_frequencies;
+  std::map<std::string, size_t> _last_parameterized_plan_frequencies;
+
+  // Chunks that were clustered and deleted logically, but are still part of their table
+  std::queue<std::pair<std::shared_ptr<Table>, ChunkID>> _physical_delete_queue;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include "delta_merge_plugin.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+std::string DeltaMergePlugin::description() const { return "Delta merge plugin"; }
+
+void DeltaMergePlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_MERGE, [&](size_t) { _merge_loop(); });
+}
+
+void DeltaMergePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+}
+
+/**
+ * This function merges the delta chunks of all columns of all tables into main partitions.
+ */
+void DeltaMergePlugin::_merge_loop() {
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    auto merged_segment_count = size_t{0};
+    const auto column_count = table->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      merged_segment_count += _merge_column(table, column_id);
+    }
+
+    if (merged_segment_count > 0) {
+      std::ostringstream message;
+      message << "Merged " << merged_segment_count << " segment(s) of table " << table_name << " into main partitions";
+      Hyrise::get().log_manager.add_message("DeltaMergePlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
+
+size_t DeltaMergePlugin::_merge_column(const std::shared_ptr<Table>& table, const ColumnID column_id) {
+  auto merged_segment_count = size_t{0};
+
+  resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // The chunks of the current run of consecutive dictionary-encoded chunks. A run consists of partitions, i.e.,
+    // chunks that share a dictionary, which are stored as their first index within the run and their chunk count.
+    auto chunk_ids = std::vector<ChunkID>{};
+    auto segments = std::vector<std::shared_ptr<const DictionarySegment<ColumnDataType>>>{};
+    auto partitions = std::vector<std::pair<size_t, size_t>>{};
+
+    const auto merge_run = [&]() {
+      auto partition_index = size_t{0};
+      while (partition_index < partitions.size()) {
+        const auto [begin, main_chunk_count] = partitions[partition_index];
+        ++partition_index;
+        if (main_chunk_count >= MAX_CHUNKS_PER_MAIN_PARTITION) continue;
+
+        // Single chunks have their own dictionary and belong to the delta as well
+        auto delta_chunk_count = main_chunk_count == 1 ? size_t{1} : size_t{0};
+        auto end = begin + main_chunk_count;
+        while (partition_index < partitions.size() && partitions[partition_index].second == 1 &&
+               end - begin < MAX_CHUNKS_PER_MAIN_PARTITION) {
+          ++delta_chunk_count;
+          ++end;
+          ++partition_index;
+        }
+        if (delta_chunk_count < MIN_DELTA_CHUNKS_PER_MERGE) continue;
+
+        ChunkEncoder::merge_dictionaries(table, column_id, {chunk_ids.cbegin() + begin, chunk_ids.cbegin() + end});
+        merged_segment_count += end - begin;
+      }
+
+      chunk_ids.clear();
+      segments.clear();
+      partitions.clear();
+    };
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto segment = chunk ? std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(
+                                       chunk->get_segment(column_id))
+                                 : nullptr;
+      // Indexes refer to the segments they were built for and would not find the re-encoded segments
+      if (!segment || chunk->is_mutable() || !chunk->get_indexes({segment}).empty()) {
+        merge_run();
+        continue;
+      }
+
+      if (!segments.empty() && segments.back()->dictionary() == segment->dictionary()) {
+        ++partitions.back().second;
+      } else {
+        partitions.emplace_back(segments.size(), 1);
+      }
+      chunk_ids.emplace_back(chunk_id);
+      segments.emplace_back(segment);
+    }
+    merge_run();
+  });
+
+  return merged_segment_count;
+}
+
+EXPORT_PLUGIN(DeltaMergePlugin)
+
+}  // namespace opossum
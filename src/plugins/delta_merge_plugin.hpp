@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "hyrise.hpp"
+#include "storage/table.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/*
+ * Merges dictionary-encoded chunks into main partitions that share a single sorted dictionary per column, following
+ * the main/delta merge of column stores. New rows are written to the mutable chunk, and the ChunkCompressionTask
+ * encodes each full chunk with its own dictionary. These immutable chunks form the delta of a table: their
+ * dictionaries repeat most of the values of their neighbours, which wastes memory and prevents the dictionaries from
+ * being shared by the operators.
+ *
+ * A main partition is a run of consecutive chunks whose segments of a column point to the same dictionary. In each
+ * iteration, the plugin looks for main partitions (or single chunks) that are followed by at least
+ * MIN_DELTA_CHUNKS_PER_MERGE chunks with their own dictionaries. The dictionaries of these chunks are merged into a
+ * new sorted dictionary, and the attribute vectors are re-encoded with the new value ids (see
+ * ChunkEncoder::merge_dictionaries()). As the values, their order, and the MVCC data remain unchanged, the re-encoded
+ * segments replace the old ones while queries run. Queries that already hold the old segments keep reading them.
+ *
+ * Per column, the main partitions are limited to MAX_CHUNKS_PER_MAIN_PARTITION chunks, which bounds the time needed
+ * for re-encoding them and the width of their value ids. Chunks with other encodings and chunks with indexes on the
+ * column, which refer to the segments they were built on, end a main partition.
+ */
+class DeltaMergePlugin : public AbstractPlugin {
+  friend class DeltaMergePluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * MIN_DELTA_CHUNKS_PER_MERGE: the number of chunks with their own dictionary that are needed to start a merge
+   * MAX_CHUNKS_PER_MAIN_PARTITION: the number of chunks that share a dictionary at most
+   * IDLE_DELAY_MERGE: sleep after each iteration
+   */
+  constexpr static size_t MIN_DELTA_CHUNKS_PER_MERGE = 4;
+  constexpr static size_t MAX_CHUNKS_PER_MAIN_PARTITION = 64;
+  constexpr static std::chrono::milliseconds IDLE_DELAY_MERGE = std::chrono::milliseconds(10'000);
+
+ private:
+  void _merge_loop();
+
+  // Finds the partitions of the column that should be merged and merges them. Returns the number of re-encoded
+  // segments.
+  static size_t _merge_column(const std::shared_ptr<Table>& table, const ColumnID column_id);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,368 @@
+#include "index_selection_plugin.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/abstract_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+class MemoryBudgetSetting : public AbstractSetting {
+ public:
+  explicit MemoryBudgetSetting(std::atomic<size_t>& memory_budget)
+      : AbstractSetting("IndexSelectionPlugin.memory_budget"), _memory_budget(memory_budget) {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Number of bytes that the chunk indexes created by the IndexSelectionPlugin may occupy"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(_memory_budget.load());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty() && std::all_of(value.begin(), value.end(), ::isdigit),
+                "Expected a non-negative number for " + name);
+    _memory_budget = std::stoull(value);
+  }
+
+ private:
+  std::atomic<size_t>& _memory_budget;
+  std::string _value;
+};
+
+bool has_index(const Table& table, const ColumnID column_id, const std::optional<SegmentIndexType> index_type) {
+  const auto indexes_statistics = table.indexes_statistics();
+  return std::any_of(indexes_statistics.cbegin(), indexes_statistics.cend(), [&](const auto& index_statistics) {
+    return index_statistics.column_ids == std::vector<ColumnID>{column_id} &&
+           (!index_type || index_statistics.type == *index_type);
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string IndexSelectionPlugin::description() const { return "Index selection plugin"; }
+
+void IndexSelectionPlugin::start() {
+  _settings.emplace_back(std::make_shared<MemoryBudgetSetting>(_memory_budget));
+  for (const auto& setting : _settings) {
+    setting->register_at_settings_manager();
+  }
+
+  _loop_thread =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_INDEX_SELECTION, [&](size_t) { _selection_loop(); });
+}
+
+void IndexSelectionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+
+  for (const auto& setting : _settings) {
+    setting->unregister_at_settings_manager();
+  }
+  _settings.clear();
+
+  // The chunk indexes of dropped indexes are left to the chunks, as queries might still use them
+  _candidates.clear();
+  _last_plan_frequencies.clear();
+  _last_scanned_value_counts.clear();
+  _created_indexes.clear();
+  _dropped_indexes.clear();
+}
+
+/**
+ * This function updates the benefits of the candidates from the plan cache and the segment access counters, selects
+ * the indexes that fit into the memory budget, and creates and drops indexes accordingly.
+ */
+void IndexSelectionPlugin::_selection_loop() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // The queries that were planned with the indexes dropped in the previous iteration have finished by now
+  for (const auto& [table_name, column_id, index_type] : _dropped_indexes) {
+    if (!storage_manager.has_table(table_name)) continue;
+    const auto table = storage_manager.get_table(table_name);
+    if (has_index(*table, column_id, index_type)) continue;
+
+    const auto column_ids = std::vector<ColumnID>{column_id};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      if (const auto index = chunk->get_index(index_type, column_ids)) chunk->remove_index(index);
+    }
+  }
+  _dropped_indexes.clear();
+
+  // Executions of the cached plans since the previous iteration. Plans that were evicted and cached again start with
+  // a new frequency.
+  auto plan_benefits = std::map<TableAndColumnID, double>{};
+  auto plan_frequencies = std::map<std::string, size_t>{};
+  if (const auto& lqp_cache = Hyrise::get().default_lqp_cache) {
+    for (const auto& [sql_string, entry] : lqp_cache->snapshot()) {
+      const auto frequency = entry.frequency.value_or(size_t{1});
+      auto execution_count = frequency;
+      const auto last_frequency = _last_plan_frequencies.find(sql_string);
+      if (last_frequency != _last_plan_frequencies.end() && last_frequency->second <= frequency) {
+        execution_count = frequency - last_frequency->second;
+      }
+      plan_frequencies.emplace(sql_string, frequency);
+
+      if (execution_count > 0) _add_plan(entry.value, execution_count, plan_benefits);
+    }
+  }
+  _last_plan_frequencies = std::move(plan_frequencies);
+
+  for (const auto& [table_and_column_id, _] : plan_benefits) {
+    _candidates.try_emplace(table_and_column_id);
+  }
+
+  auto scanned_value_counts = std::map<TableAndColumnID, uint64_t>{};
+  for (auto candidate_it = _candidates.begin(); candidate_it != _candidates.end();) {
+    const auto& [table_and_column_id, candidate] = *candidate_it;
+    const auto& [table_name, column_id] = table_and_column_id;
+    if (!storage_manager.has_table(table_name)) {
+      candidate_it = _candidates.erase(candidate_it);
+      continue;
+    }
+    const auto table = storage_manager.get_table(table_name);
+
+    // Replacing a chunk's segments (e.g., when encoding them) resets their counters
+    const auto scanned_value_count = _scanned_value_count(*table, column_id);
+    auto recent_scanned_value_count = scanned_value_count;
+    const auto last_scanned_value_count = _last_scanned_value_counts.find(table_and_column_id);
+    if (last_scanned_value_count != _last_scanned_value_counts.end() &&
+        last_scanned_value_count->second <= scanned_value_count) {
+      recent_scanned_value_count = scanned_value_count - last_scanned_value_count->second;
+    }
+    scanned_value_counts.emplace(table_and_column_id, scanned_value_count);
+
+    const auto plan_benefit = plan_benefits.find(table_and_column_id);
+    const auto benefit = std::max(plan_benefit != plan_benefits.end() ? plan_benefit->second : 0.0,
+                                  static_cast<double>(recent_scanned_value_count));
+    candidate_it->second.benefit = candidate.benefit * BENEFIT_DECAY + benefit;
+    ++candidate_it;
+  }
+  _last_scanned_value_counts = std::move(scanned_value_counts);
+
+  struct IndexSelection {
+    TableAndColumnID table_and_column_id;
+    SegmentIndexType index_type;
+    double benefit;
+    size_t memory_consumption;
+  };
+
+  auto index_selections = std::vector<IndexSelection>{};
+  for (auto candidate_it = _candidates.begin(); candidate_it != _candidates.end();) {
+    const auto& [table_and_column_id, candidate] = *candidate_it;
+    const auto table = storage_manager.get_table(table_and_column_id.first);
+    const auto column_id = table_and_column_id.second;
+
+    // An index pays off if it saves at least one scan of the column per iteration. Forget about the other columns,
+    // so that, e.g., their predicate conditions are collected anew.
+    if (candidate.benefit < std::max(static_cast<double>(table->row_count()), 1.0)) {
+      candidate_it = _candidates.erase(candidate_it);
+      continue;
+    }
+    ++candidate_it;
+
+    // Indexes that were created manually are not touched
+    if (!_created_indexes.contains(table_and_column_id) && has_index(*table, column_id, std::nullopt)) continue;
+
+    // HashIndexes only answer equality predicates
+    const auto index_type =
+        candidate.equality_predicates_only ? SegmentIndexType::Hash : SegmentIndexType::GroupKey;
+    const auto memory_consumption = _estimate_memory_consumption(*table, column_id, index_type);
+    if (!memory_consumption || *memory_consumption == 0) continue;
+
+    index_selections.emplace_back(
+        IndexSelection{table_and_column_id, index_type, candidate.benefit, *memory_consumption});
+  }
+
+  std::sort(index_selections.begin(), index_selections.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.benefit / static_cast<double>(lhs.memory_consumption) >
+           rhs.benefit / static_cast<double>(rhs.memory_consumption);
+  });
+
+  auto selected_indexes = std::map<TableAndColumnID, SegmentIndexType>{};
+  auto selected_memory_consumption = size_t{0};
+  const auto memory_budget = _memory_budget.load();
+  for (const auto& index_selection : index_selections) {
+    if (selected_memory_consumption + index_selection.memory_consumption > memory_budget) continue;
+
+    selected_memory_consumption += index_selection.memory_consumption;
+    selected_indexes.emplace(index_selection.table_and_column_id, index_selection.index_type);
+  }
+
+  auto dropped_index_count = size_t{0};
+  for (auto created_index_it = _created_indexes.begin(); created_index_it != _created_indexes.end();) {
+    const auto& [table_and_column_id, index_type] = *created_index_it;
+    const auto selected_index = selected_indexes.find(table_and_column_id);
+    if (selected_index != selected_indexes.end() && selected_index->second == index_type) {
+      ++created_index_it;
+      continue;
+    }
+
+    _drop_index(table_and_column_id, index_type);
+    created_index_it = _created_indexes.erase(created_index_it);
+    ++dropped_index_count;
+  }
+
+  auto created_index_count = size_t{0};
+  for (const auto& [table_and_column_id, index_type] : selected_indexes) {
+    if (_created_indexes.contains(table_and_column_id)) continue;
+
+    const auto& [table_name, column_id] = table_and_column_id;
+    const auto table = storage_manager.get_table(table_name);
+    const auto column_ids = std::vector<ColumnID>{column_id};
+    const auto index_name = "IndexSelectionPlugin_" + table->column_name(column_id);
+    if (index_type == SegmentIndexType::Hash) {
+      table->create_index<HashIndex>(column_ids, index_name);
+    } else {
+      table->create_index<GroupKeyIndex>(column_ids, index_name);
+    }
+    _created_indexes.emplace(table_and_column_id, index_type);
+    ++created_index_count;
+  }
+
+  if (created_index_count == 0 && dropped_index_count == 0) return;
+
+  // The cached plans were optimized without the created indexes or use the dropped ones. The frequencies of the plans
+  // that are cached again start anew, see above.
+  if (const auto& pqp_cache = Hyrise::get().default_pqp_cache) pqp_cache->clear();
+  if (const auto& lqp_cache = Hyrise::get().default_lqp_cache) lqp_cache->clear();
+  if (const auto& parameterized_plan_cache = Hyrise::get().parameterized_plan_cache) parameterized_plan_cache->clear();
+
+  std::ostringstream message;
+  const auto selected_mb = static_cast<double>(selected_memory_consumption) / (1000.0 * 1000.0);
+  message << "Created " << created_index_count << " and dropped " << dropped_index_count
+          << " index(es), the selected indexes take approx. " << std::setprecision(2) << selected_mb << " MB";
+  Hyrise::get().log_manager.add_message("IndexSelectionPlugin", message.str(), LogLevel::Info);
+}
+
+void IndexSelectionPlugin::_add_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t execution_count,
+                                     std::map<TableAndColumnID, double>& plan_benefits) {
+  visit_lqp(lqp, [&](const auto& node) {
+    // As in the IndexScanRule, only predicates directly on stored tables are answered by chunk indexes
+    if (node->type != LQPNodeType::Predicate || node->left_input()->type != LQPNodeType::StoredTable) {
+      return LQPVisitation::VisitInputs;
+    }
+    const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+    const auto& stored_table_node = static_cast<const StoredTableNode&>(*node->left_input());
+
+    const auto operator_predicates =
+        OperatorScanPredicate::from_expression(*predicate_node.predicate(), predicate_node);
+    if (!operator_predicates || operator_predicates->size() != 1) return LQPVisitation::VisitInputs;
+
+    // The IndexScan handles comparisons with values (see IndexScanRule::_is_index_scan_applicable())
+    const auto& operator_predicate = (*operator_predicates)[0];
+    const auto predicate_condition = operator_predicate.predicate_condition;
+    if (!is_binary_numeric_predicate_condition(predicate_condition) &&
+        !is_between_predicate_condition(predicate_condition)) {
+      return LQPVisitation::VisitInputs;
+    }
+    if (!is_variant(operator_predicate.value) ||
+        (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+        stored_table_node.output_expressions()[operator_predicate.column_id]);
+    const auto& table_name = stored_table_node.table_name;
+    if (!column_expression || !Hyrise::get().storage_manager.has_table(table_name)) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto table = Hyrise::get().storage_manager.get_table(table_name);
+    const auto table_and_column_id = TableAndColumnID{table_name, column_expression->original_column_id};
+    plan_benefits[table_and_column_id] +=
+        static_cast<double>(execution_count) * static_cast<double>(table->row_count());
+    if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals) {
+      _candidates[table_and_column_id].equality_predicates_only = false;
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+uint64_t IndexSelectionPlugin::_scanned_value_count(const Table& table, const ColumnID column_id) {
+  auto scanned_value_count = uint64_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // Scans iterate over the segment, or over the positions of their input in ascending order
+    const auto& access_counter = chunk->get_segment(column_id)->access_counter;
+    scanned_value_count += access_counter[SegmentAccessCounter::AccessType::Sequential] +
+                           access_counter[SegmentAccessCounter::AccessType::Monotonic];
+  }
+  return scanned_value_count;
+}
+
+std::optional<size_t> IndexSelectionPlugin::_estimate_memory_consumption(const Table& table, const ColumnID column_id,
+                                                                         const SegmentIndexType index_type) {
+  auto value_bytes = uint32_t{0};
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    value_bytes = static_cast<uint32_t>(sizeof(ColumnDataType));
+  });
+
+  auto memory_consumption = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) continue;
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id));
+    if (index_type == SegmentIndexType::GroupKey && !dictionary_segment) return std::nullopt;
+
+    // Without a dictionary, all values are assumed to be distinct
+    const auto row_count = chunk->size();
+    const auto distinct_count =
+        dictionary_segment ? static_cast<ChunkOffset>(dictionary_segment->unique_values_count()) : row_count;
+    memory_consumption +=
+        AbstractIndex::estimate_memory_consumption(index_type, row_count, distinct_count, value_bytes);
+  }
+  return memory_consumption;
+}
+
+void IndexSelectionPlugin::_drop_index(const TableAndColumnID& table_and_column_id,
+                                       const SegmentIndexType index_type) {
+  const auto& [table_name, column_id] = table_and_column_id;
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(table_name)) return;
+
+  // The table might have been replaced by another table of the same name
+  const auto table = storage_manager.get_table(table_name);
+  if (!has_index(*table, column_id, index_type)) return;
+
+  table->remove_index({column_id}, index_type);
+  _dropped_indexes.emplace_back(table_name, column_id, index_type);
+}
+
+EXPORT_PLUGIN(IndexSelectionPlugin)
+
+}  // namespace opossum
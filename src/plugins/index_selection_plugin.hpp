@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractSetting;
+class Table;
+
+/*
+ * Creates and drops single-column chunk indexes, so that they do not have to be tuned by hand. In each iteration, the
+ * plugin collects the predicates that the IndexScanRule could answer with a chunk index (i.e., comparisons of a column
+ * of a stored table with values) from the optimized plans in the default LQP cache. The executions of these plans
+ * since the previous iteration (see the frequencies of the cache) multiplied with the row count of the table estimate
+ * the number of values that scans read from the column. As cached plans do not cover all statements, the values that
+ * were read from the column's segments (see SegmentAccessCounter) are used instead if they are larger. These benefits
+ * decay with every iteration, so that the indexes of columns that are no longer queried are eventually dropped.
+ *
+ * The memory that the index of a candidate needs is estimated for its immutable chunks with
+ * AbstractIndex::estimate_memory_consumption(). The candidates are picked by their benefit per byte until the memory
+ * budget (setting "IndexSelectionPlugin.memory_budget") is exhausted. Columns that are only compared for equality get
+ * HashIndexes, the others GroupKeyIndexes, which require all immutable chunks of the column to be dictionary-encoded.
+ *
+ * Only the indexes created by the plugin are dropped. A dropped index is first removed from the table's index
+ * statistics, so that new plans do not use it, and physically removed from the chunks in the next iteration, when the
+ * queries that were planned with it have finished. After indexes were created or dropped, the default plan caches are
+ * cleared, so that the statements are optimized again. Indexes created by the plugin remain when it is unloaded.
+ */
+class IndexSelectionPlugin : public AbstractPlugin {
+  friend class IndexSelectionPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * DEFAULT_MEMORY_BUDGET: the number of bytes that the indexes created by the plugin may occupy
+   * BENEFIT_DECAY: factor that the benefits of the candidates are multiplied with in every iteration
+   * IDLE_DELAY_INDEX_SELECTION: sleep after each iteration
+   */
+  constexpr static size_t DEFAULT_MEMORY_BUDGET = size_t{1} * 1024 * 1024 * 1024;
+  constexpr static double BENEFIT_DECAY = 0.5;
+  constexpr static std::chrono::milliseconds IDLE_DELAY_INDEX_SELECTION = std::chrono::milliseconds(60'000);
+
+ private:
+  using TableAndColumnID = std::pair<std::string, ColumnID>;
+
+  struct IndexCandidate {
+    // Estimated number of values that scans read from the column per iteration, decayed over the iterations
+    double benefit{0.0};
+    bool equality_predicates_only{true};
+  };
+
+  void _selection_loop();
+
+  // Adds the executions of the plan to the candidates of the columns it has indexable predicates on
+  void _add_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t execution_count,
+                 std::map<TableAndColumnID, double>& plan_benefits);
+
+  // Values read from the segments of the column, summed over the chunks
+  static uint64_t _scanned_value_count(const Table& table, const ColumnID column_id);
+
+  // Estimated memory consumption of an index of the given type over the immutable chunks of the column. Returns
+  // std::nullopt if not all of these chunks support the index type.
+  static std::optional<size_t> _estimate_memory_consumption(const Table& table, const ColumnID column_id,
+                                                            const SegmentIndexType index_type);
+
+  void _drop_index(const TableAndColumnID& table_and_column_id, const SegmentIndexType index_type);
+
+  std::atomic<size_t> _memory_budget{DEFAULT_MEMORY_BUDGET};
+
+  std::map<TableAndColumnID, IndexCandidate> _candidates;
+  std::map<std::string, size_t> _last_plan_frequencies;
+  std::map<TableAndColumnID, uint64_t> _last_scanned_value_counts;
+
+  // Indexes created by the plugin and indexes that were removed from their tables, but not from the chunks yet
+  std::map<TableAndColumnID, SegmentIndexType> _created_indexes;
+  std::vector<std::tuple<std::string, ColumnID, SegmentIndexType>> _dropped_indexes;
+
+  std::vector<std::shared_ptr<AbstractSetting>> _settings;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
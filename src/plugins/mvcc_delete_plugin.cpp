@@ -1,12 +1,15 @@
 #include "mvcc_delete_plugin.hpp"
 
+#include "concurrency/epoch_manager.hpp"
 #include "operators/get_table.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
 
 namespace opossum {
 
@@ -25,121 +28,283 @@ void MvccDeletePlugin::stop() {
   _loop_thread_logical_delete.reset();
   _loop_thread_physical_delete.reset();
   _physical_delete_queue = {};
+  _invalid_row_counts.clear();
 }
 
 /**
  * This function analyzes each chunk of every table and triggers a chunk-cleanup-procedure if a certain threshold of
- * invalidated rows is exceeded.
+ * invalidated rows is exceeded. Chunks with only few valid rows are merged with each other.
  */
 void MvccDeletePlugin::_logical_delete_loop() {
   const auto tables = Hyrise::get().storage_manager.tables();
 
+  // Chunks without invalidated rows whose rows were all committed before every active snapshot have their MVCC data
+  // compacted, which frees the per-row vectors and lets Validate skip the chunk's rows
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto compaction_commit_id =
+      transaction_manager.get_lowest_active_snapshot_commit_id().value_or(transaction_manager.last_commit_id());
+
   // Check all tables
   for (auto& [table_name, table] : tables) {
     if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) continue;
-    size_t saved_memory = 0;
-    size_t num_chunks = 0;
 
     // Check all chunks, except for the last one, which is currently used for insertions
     const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
+    auto chunks = std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>{};
+    auto invalid_row_count = uint64_t{0};
     for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
       const auto& chunk = table->get_chunk(chunk_id);
-      if (chunk && !chunk->get_cleanup_commit_id()) {
-        const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+      if (!chunk || chunk->get_cleanup_commit_id()) continue;
 
-        // Calculate metric 1 – Chunk invalidation level
-        const double invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
-        const bool criterion1 = (DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS <= invalidated_rows_ratio);
+      if (chunk->invalid_row_count() == 0) {
+        chunk->try_compact_mvcc_data(compaction_commit_id);
+      }
+      invalid_row_count += chunk->invalid_row_count();
+      chunks.emplace_back(chunk_id, chunk);
+    }
 
-        if (!criterion1) {
-          continue;
-        }
+    const auto delete_threshold = _delete_threshold(table_name, invalid_row_count, table->row_count());
+    const auto merge_threshold_row_count = MERGE_THRESHOLD_PERCENTAGE_VALID_ROWS * table->target_chunk_size();
+    auto candidates = std::vector<DeleteCandidate>{};
+    for (const auto& [chunk_id, chunk] : chunks) {
+      // Calculate metric 1 – Chunk invalidation level
+      const double invalidated_rows_ratio = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
+      const bool criterion1 = (delete_threshold <= invalidated_rows_ratio);
 
-        // Calculate metric 2 – Chunk Hotness
-        auto highest_end_commit_id = CommitID{0};
-        const auto chunk_size = chunk->size();
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          const auto commit_id = chunk->mvcc_data()->get_end_cid(chunk_offset);
-          if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
-            highest_end_commit_id = commit_id;
-          }
-        }
+      // Small chunks are merged with each other instead of being deleted on their own
+      const auto valid_row_count = static_cast<ChunkOffset>(chunk->size() - chunk->invalid_row_count());
+      const bool is_small = valid_row_count < merge_threshold_row_count;
 
-        const bool criterion2 =
-            highest_end_commit_id + DELETE_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
+      if (!criterion1 && !is_small) {
+        continue;
+      }
 
-        if (!criterion2) {
-          continue;
-        }
+      // Calculate metric 2 – Chunk Hotness
+      if (!_is_cold(chunk)) {
+        continue;
+      }
 
-        auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
-        const bool success = _try_logical_delete(table_name, chunk_id, transaction_context);
+      const auto memory_usage = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+      candidates.push_back({chunk_id, valid_row_count, memory_usage,
+                            static_cast<size_t>(static_cast<double>(memory_usage) * invalidated_rows_ratio),
+                            criterion1});
+    }
+
+    const auto memory_usages = [&]() {
+      auto chunk_memory_usages = std::unordered_map<ChunkID, size_t>{};
+      for (const auto& candidate : candidates) {
+        chunk_memory_usages.emplace(candidate.chunk_id, candidate.memory_usage);
+      }
+      return chunk_memory_usages;
+    }();
 
-        if (success) {
-          DebugAssert(table->get_chunk(chunk_id)->get_cleanup_commit_id(),
-                      "Chunk needs to be deleted logically before deleting it physically.");
+    const auto groups = _group_candidates(std::move(candidates), table->target_chunk_size());
+    if (groups.empty()) continue;
 
-          std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
-          _physical_delete_queue.emplace(table, chunk_id);
-          saved_memory += chunk_memory;
-          num_chunks++;
+    // The reinserted rows are appended to the last chunk and the chunks following it
+    const auto first_reinsertion_chunk_id = max_chunk_id;
+
+    // Each group is rewritten in a separate transaction. The transactions do not conflict with each other, as they
+    // invalidate different rows.
+    size_t saved_memory = 0;
+    size_t num_chunks = 0;
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(groups.size());
+    for (const auto& chunk_ids : groups) {
+      jobs.emplace_back(std::make_shared<JobTask>(
+          [&, &table_name = table_name, &table = table]() {
+            auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+            if (!_try_logical_delete(table_name, chunk_ids, transaction_context)) return;
+
+            DebugAssert(table->get_chunk(chunk_ids.front())->get_cleanup_commit_id(),
+                        "Chunk needs to be deleted logically before deleting it physically.");
+
+            std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+            for (const auto chunk_id : chunk_ids) {
+              _physical_delete_queue.emplace(table, chunk_id);
+              saved_memory += memory_usages.at(chunk_id);
+            }
+            num_chunks += chunk_ids.size();
+          },
+          SchedulePriority::Background));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // Encode the chunks that the reinserted rows were written to, so that they do not keep their ValueSegments until
+    // the next compression. The last of them is usually not full, but finalized nonetheless. Meanwhile, inserts are
+    // blocked. They continue in a new chunk afterwards.
+    auto merged_chunk_ids = std::vector<ChunkID>{};
+    if (num_chunks > 0) {
+      const auto append_lock = table->acquire_append_mutex();
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = first_reinsertion_chunk_id; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk || !chunk->is_mutable() || chunk->size() == 0) continue;
+
+        if (ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) {
+          // The ChunkCompressionTask finalizes completed chunks itself, as the ChunkCompressionPlugin might compress
+          // them concurrently
+          merged_chunk_ids.emplace_back(chunk_id);
+        } else if (_is_committed(chunk)) {
+          // Without inserts, no one else can complete (and finalize) the chunk
+          chunk->finalize();
+          merged_chunk_ids.emplace_back(chunk_id);
         }
+        // Otherwise, other transactions are still inserting into the chunk, which is compressed once it is completed
       }
     }
+    if (!merged_chunk_ids.empty()) {
+      const auto task = std::make_shared<ChunkCompressionTask>(table_name, merged_chunk_ids, std::nullopt,
+                                                               SchedulePriority::Background);
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks({task});
+    }
+
     if (saved_memory > 0) {
       std::ostringstream message;
       double saved_mb = static_cast<float>(saved_memory) / (1000.0 * 1000.0);
-      message << "Consolidated " << num_chunks << " chunk(s) of " << table_name << ", saved approx. "
-              << std::setprecision(2) << saved_mb << " MB";
+      message << "Consolidated " << num_chunks << " chunk(s) of " << table_name << " into "
+              << merged_chunk_ids.size() << " encoded chunk(s), saved approx. " << std::setprecision(2)
+              << saved_mb << " MB";
       Hyrise::get().log_manager.add_message("MvccDeletePlugin", message.str(), LogLevel::Info);
     }
   }
 }
 
+double MvccDeletePlugin::_delete_threshold(const std::string& table_name, const uint64_t invalid_row_count,
+                                           const uint64_t row_count) {
+  // Chunks that were deleted since the previous iteration drop out of the count, so that it might decrease
+  const auto [iter, inserted] = _invalid_row_counts.try_emplace(table_name, invalid_row_count);
+  const auto newly_invalidated_row_count =
+      inserted || invalid_row_count < iter->second ? uint64_t{0} : invalid_row_count - iter->second;
+  iter->second = invalid_row_count;
+
+  const auto update_rate = static_cast<double>(newly_invalidated_row_count) / std::max(row_count, uint64_t{1});
+  const auto weight = std::min(update_rate / HIGH_UPDATE_RATE_PERCENTAGE_INVALIDATED_ROWS, 1.0);
+  return DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS -
+         weight * (DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS - MIN_DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS);
+}
+
+std::vector<std::vector<ChunkID>> MvccDeletePlugin::_group_candidates(std::vector<DeleteCandidate> candidates,
+                                                                      const ChunkOffset target_chunk_size) {
+  std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.reclaimable_memory > rhs.reclaimable_memory;
+  });
+
+  auto groups = std::vector<std::vector<ChunkID>>{};
+  auto group_row_counts = std::vector<size_t>{};
+  auto group_exceeds_delete_threshold = std::vector<bool>{};
+  for (const auto& candidate : candidates) {
+    auto group_id = size_t{0};
+    while (group_id < groups.size() && group_row_counts[group_id] + candidate.valid_row_count > target_chunk_size) {
+      ++group_id;
+    }
+
+    if (group_id == groups.size()) {
+      groups.emplace_back();
+      group_row_counts.emplace_back(0);
+      group_exceeds_delete_threshold.emplace_back(false);
+    }
+    groups[group_id].emplace_back(candidate.chunk_id);
+    group_row_counts[group_id] += candidate.valid_row_count;
+    group_exceeds_delete_threshold[group_id] =
+        group_exceeds_delete_threshold[group_id] || candidate.exceeds_delete_threshold;
+  }
+
+  // Deleting a small chunk on its own would only move its rows to the end of the table
+  auto result = std::vector<std::vector<ChunkID>>{};
+  for (auto group_id = size_t{0}; group_id < groups.size(); ++group_id) {
+    if (groups[group_id].size() < 2 && !group_exceeds_delete_threshold[group_id]) continue;
+    std::sort(groups[group_id].begin(), groups[group_id].end());
+    result.emplace_back(std::move(groups[group_id]));
+  }
+  return result;
+}
+
 /**
- * This function processes the physical-delete-queue until its empty.
+ * This function deletes all chunks of the physical-delete-queue that are not visible to any active transaction anymore.
  */
 void MvccDeletePlugin::_physical_delete_loop() {
-  std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
+  {
+    std::unique_lock<std::mutex> lock(_mutex_physical_delete_queue);
 
-  if (!_physical_delete_queue.empty()) {
-    TableAndChunkID table_and_chunk_id = _physical_delete_queue.front();
-    const auto& table = table_and_chunk_id.first;
-    const auto& chunk = table->get_chunk(table_and_chunk_id.second);
+    // Chunks whose cleanup commit id is newer than the lowest active snapshot commit id might still be used by active
+    // transactions. They are kept in the queue, but do not block the removal of the chunks behind them.
+    const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+    auto remaining_queue = std::queue<TableAndChunkID>{};
 
-    DebugAssert(chunk != nullptr, "Chunk does not exist. Physical Delete can not be applied.");
+    while (!_physical_delete_queue.empty()) {
+      TableAndChunkID table_and_chunk_id = _physical_delete_queue.front();
+      _physical_delete_queue.pop();
+      const auto& table = table_and_chunk_id.first;
+      const auto& chunk = table->get_chunk(table_and_chunk_id.second);
 
-    if (chunk->get_cleanup_commit_id().has_value()) {
-      // Check whether there are still active transactions that might use the chunk
-      bool conflicting_transactions = false;
-      auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+      DebugAssert(chunk != nullptr, "Chunk does not exist. Physical Delete can not be applied.");
 
-      if (lowest_snapshot_commit_id.has_value()) {
-        conflicting_transactions = chunk->get_cleanup_commit_id().value() > lowest_snapshot_commit_id.value();
-      }
+      const auto cleanup_commit_id = chunk->get_cleanup_commit_id();
+      const auto conflicting_transactions =
+          !cleanup_commit_id || (lowest_snapshot_commit_id && *cleanup_commit_id > *lowest_snapshot_commit_id);
 
-      if (!conflicting_transactions) {
+      if (conflicting_transactions) {
+        remaining_queue.emplace(std::move(table_and_chunk_id));
+      } else {
         _delete_chunk_physically(table, table_and_chunk_id.second);
-        _physical_delete_queue.pop();
       }
     }
+
+    _physical_delete_queue = std::move(remaining_queue);
+  }
+
+  // Free the chunk holders of earlier physical deletes that were still pinned by concurrent readers of the table
+  EpochManager::get().reclaim();
+}
+
+bool MvccDeletePlugin::_is_cold(const std::shared_ptr<Chunk>& chunk) {
+  auto highest_end_commit_id = CommitID{0};
+  const auto chunk_size = chunk->size();
+  const auto mvcc_data = chunk->mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    const auto commit_id = mvcc_data->get_end_cid(chunk_offset);
+    if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
+      highest_end_commit_id = commit_id;
+    }
+  }
+
+  return highest_end_commit_id + DELETE_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
+}
+
+bool MvccDeletePlugin::_is_committed(const std::shared_ptr<Chunk>& chunk) {
+  const auto chunk_size = chunk->size();
+  const auto mvcc_data = chunk->mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    // Rolled back inserts reset the begin commit id to zero
+    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
   }
+  return true;
 }
 
 bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const ChunkID chunk_id,
                                            const std::shared_ptr<TransactionContext>& transaction_context) {
+  return _try_logical_delete(table_name, std::vector<ChunkID>{chunk_id}, transaction_context);
+}
+
+bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) {
   const auto& table = Hyrise::get().storage_manager.get_table(table_name);
-  const auto& chunk = table->get_chunk(chunk_id);
 
-  Assert(chunk != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
-  Assert(chunk_id < (table->chunk_count() - 1),
-         "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
+  for (const auto chunk_id : chunk_ids) {
+    Assert(table->get_chunk(chunk_id) != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
+    Assert(chunk_id < (table->chunk_count() - 1),
+           "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
+  }
 
-  // Create temporary referencing table that contains the given chunk only
-  //   Include all ChunksIDs of current table except chunk_id for pruning in GetTable
-  std::vector<ChunkID> excluded_chunk_ids(table->chunk_count() - 1);
-  std::iota(excluded_chunk_ids.begin(), excluded_chunk_ids.begin() + chunk_id, 0);
-  std::iota(excluded_chunk_ids.begin() + chunk_id, excluded_chunk_ids.end(), chunk_id + 1);
+  // Create temporary referencing table that contains the given chunks only
+  //   Include all ChunksIDs of current table except chunk_ids for pruning in GetTable
+  std::vector<ChunkID> excluded_chunk_ids;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (std::find(chunk_ids.cbegin(), chunk_ids.cend(), chunk_id) == chunk_ids.cend()) {
+      excluded_chunk_ids.emplace_back(chunk_id);
+    }
+  }
 
   auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
   get_table->set_transaction_context(transaction_context);
@@ -165,8 +330,10 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   }
 
   transaction_context->commit();
-  // Mark chunk as logically deleted
-  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+  // Mark chunks as logically deleted
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
   return true;
 }
 
@@ -5,6 +5,8 @@
 #include <numeric>
 #include <queue>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "gtest/gtest_prod.h"
 #include "hyrise.hpp"
@@ -26,6 +28,17 @@ namespace opossum {
  * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
  * The physical delete checks if chunks are not visible anymore for other transactions and
  * removes the chunk from the table completely.
+ * The same mechanism merges small chunks, e.g., those left behind by many small inserts, partial
+ * invalidation, or an increase of the table's target chunk size (see Table::set_target_chunk_size()):
+ * several of them are deleted logically in a single transaction, so that their valid rows are
+ * reinserted into a single right-sized chunk at the end of the table.
+ * The candidates of a table are ranked by the memory of their invalidated rows and packed into groups
+ * whose valid rows fit into one chunk. The groups are rewritten in parallel. The chunks that the
+ * reinserted rows end up in are finalized and encoded right away, even if they are not full. Tables
+ * with a high update rate are cleaned up at a lower invalidation level, so that they do not grow
+ * faster than the plugin reclaims them.
+ * Chunks without invalidated rows are not deleted. Once all of their rows are visible to every
+ * active transaction, their MVCC data is compacted instead (see Chunk::try_compact_mvcc_data).
  */
 class MvccDeletePlugin : public AbstractPlugin {
   friend class MvccDeletePluginTest;
@@ -40,31 +53,73 @@ class MvccDeletePlugin : public AbstractPlugin {
 
   /**
    * DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS: the percentage of invalidated rows
-   * in chunk to be deleted logically by the plugin.
+   * in chunk to be deleted logically by the plugin, for tables without updates.
+   * MIN_DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS: the lowest such percentage, used for
+   * tables with a high update rate
+   * HIGH_UPDATE_RATE_PERCENTAGE_INVALIDATED_ROWS: the percentage of a table's rows invalidated
+   * since the previous iteration, from which on the lowest threshold is used
    * DELETE_THRESHOLD_LAST_COMMIT: the number of commits that must have passed since
    * the candidate chunk was last modified
+   * MERGE_THRESHOLD_PERCENTAGE_VALID_ROWS: chunks with fewer valid rows than this percentage of
+   * the table's target chunk size are merged
    * IDLE_DELAY_LOGICAL_DELETE: sleep after execution of logical delete
    * IDLE_DELAY_PHYSICAL_DELETE: sleep after execution of physical delete
    */
   constexpr static double DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS = 0.6;
+  constexpr static double MIN_DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS = 0.2;
+  constexpr static double HIGH_UPDATE_RATE_PERCENTAGE_INVALIDATED_ROWS = 0.05;
   constexpr static CommitID DELETE_THRESHOLD_LAST_COMMIT = CommitID{100};
+  constexpr static double MERGE_THRESHOLD_PERCENTAGE_VALID_ROWS = 0.25;
   constexpr static std::chrono::milliseconds IDLE_DELAY_LOGICAL_DELETE = std::chrono::milliseconds(1000);
   constexpr static std::chrono::milliseconds IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds(1000);
 
  private:
   using TableAndChunkID = std::pair<const std::shared_ptr<Table>, ChunkID>;
 
+  struct DeleteCandidate {
+    ChunkID chunk_id;
+    ChunkOffset valid_row_count;
+    size_t memory_usage;
+    // Estimated memory of the invalidated rows
+    size_t reclaimable_memory;
+    bool exceeds_delete_threshold;
+  };
+
   void _logical_delete_loop();
   void _physical_delete_loop();
 
+  // Returns the invalidation level from which on chunks of the table are deleted. It is interpolated between
+  // DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS and MIN_DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS by the number of
+  // rows invalidated since the previous call.
+  double _delete_threshold(const std::string& table_name, uint64_t invalid_row_count, uint64_t row_count);
+
+  // Packs the candidates, ranked by their reclaimable memory, into groups whose valid rows fit into one chunk (first
+  // fit). Candidates that do not exceed the delete threshold are only deleted together with others.
+  static std::vector<std::vector<ChunkID>> _group_candidates(std::vector<DeleteCandidate> candidates,
+                                                             ChunkOffset target_chunk_size);
+
+  // Returns whether the chunk has not been modified within the last DELETE_THRESHOLD_LAST_COMMIT commits
+  static bool _is_cold(const std::shared_ptr<Chunk>& chunk);
+
+  // Returns whether no transaction is still inserting into the chunk
+  static bool _is_committed(const std::shared_ptr<Chunk>& chunk);
+
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Deletes all given chunks logically and reinserts their valid rows together
+  static bool _try_logical_delete(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                  const std::shared_ptr<TransactionContext>& transaction_context);
   static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
 
   std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
 
   std::mutex _mutex_physical_delete_queue;
   std::queue<TableAndChunkID> _physical_delete_queue;
+
+  // Number of invalidated rows of each table in the previous iteration of the logical delete, used to estimate the
+  // update rate. Only accessed by the logical delete thread.
+  std::unordered_map<std::string, uint64_t> _invalid_row_counts;
 };
 
 }  // namespace opossum
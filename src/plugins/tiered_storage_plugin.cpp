@@ -0,0 +1,335 @@
+#include "tiered_storage_plugin.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+class MemoryBudgetSetting : public AbstractSetting {
+ public:
+  explicit MemoryBudgetSetting(std::atomic<size_t>& memory_budget)
+      : AbstractSetting("TieredStoragePlugin.memory_budget"), _memory_budget(memory_budget) {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Number of bytes that the immutable chunks kept in DRAM by the TieredStoragePlugin may occupy"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(_memory_budget.load());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty() && std::all_of(value.begin(), value.end(), ::isdigit),
+                "Expected a non-negative number for " + name);
+    _memory_budget = std::stoull(value);
+  }
+
+ private:
+  std::atomic<size_t>& _memory_budget;
+  std::string _value;
+};
+
+}  // namespace
+
+namespace opossum {
+
+FileBackedMemoryResource::FileBackedMemoryResource(const std::filesystem::path& path)
+    : _path(path), _file_descriptor(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600)) {
+  Assert(_file_descriptor >= 0, "Could not create '" + path.string() + "': " + std::strerror(errno));
+}
+
+FileBackedMemoryResource::~FileBackedMemoryResource() {
+  for (const auto& [begin, extent] : _extents) {
+    munmap(begin, extent.size);
+  }
+  close(_file_descriptor);
+  std::filesystem::remove(_path);
+}
+
+void FileBackedMemoryResource::page_out() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (const auto& [begin, extent] : _extents) {
+    // Once the pages are clean, dropping them from a shared file mapping loses no data.
+    msync(begin, extent.size, MS_SYNC);
+    madvise(begin, extent.size, MADV_DONTNEED);
+  }
+}
+
+const std::filesystem::path& FileBackedMemoryResource::path() const { return _path; }
+
+void* FileBackedMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // Empty allocations still need a unique address
+  bytes = std::max(bytes, size_t{1});
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Extents are page-aligned, so aligning the offset within the extent aligns the address.
+  for (auto& [begin, extent] : _extents) {
+    auto& free_ranges = extent.free_ranges;
+    for (auto free_range = free_ranges.begin(); free_range != free_ranges.end(); ++free_range) {
+      const auto [range_offset, range_size] = *free_range;
+      const auto offset = (range_offset + alignment - 1) / alignment * alignment;
+      if (offset + bytes > range_offset + range_size) continue;
+
+      // Keep the unused parts before and after the allocation
+      free_ranges.erase(free_range);
+      if (offset > range_offset) free_ranges.emplace(range_offset, offset - range_offset);
+      if (offset + bytes < range_offset + range_size) {
+        free_ranges.emplace(offset + bytes, range_offset + range_size - offset - bytes);
+      }
+      return begin + offset;
+    }
+  }
+
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  DebugAssert(alignment <= page_size, "Alignment exceeds page size");
+  const auto extent_size = std::max(EXTENT_SIZE, (bytes + page_size - 1) / page_size * page_size);
+
+  Assert(ftruncate(_file_descriptor, static_cast<off_t>(_file_size + extent_size)) == 0,
+         "Could not grow '" + _path.string() + "': " + std::strerror(errno));
+  auto* const begin = static_cast<char*>(mmap(nullptr, extent_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                              _file_descriptor, static_cast<off_t>(_file_size)));
+  Assert(begin != MAP_FAILED, "Could not map '" + _path.string() + "': " + std::strerror(errno));
+
+  auto& extent = _extents.emplace(begin, Extent{extent_size, static_cast<off_t>(_file_size), {}}).first->second;
+  _file_size += extent_size;
+  if (bytes < extent_size) extent.free_ranges.emplace(bytes, extent_size - bytes);
+  return begin;
+}
+
+void FileBackedMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t /*alignment*/) {
+  bytes = std::max(bytes, size_t{1});
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Find the extent that contains the pointer, i.e., the last one that begins before it
+  auto extent_iter = _extents.upper_bound(static_cast<char*>(pointer));
+  DebugAssert(extent_iter != _extents.begin(), "Memory was not allocated by this resource");
+  --extent_iter;
+  auto& [begin, extent] = *extent_iter;
+
+  auto offset = static_cast<size_t>(static_cast<char*>(pointer) - begin);
+  auto size = bytes;
+  DebugAssert(offset + size <= extent.size, "Memory was not allocated by this resource");
+
+  // Merge the range with the free ranges directly after and before it
+  auto& free_ranges = extent.free_ranges;
+  auto next_range = free_ranges.lower_bound(offset);
+  DebugAssert(next_range == free_ranges.end() || next_range->first >= offset + size, "Memory is already free");
+  if (next_range != free_ranges.end() && next_range->first == offset + size) {
+    size += next_range->second;
+    next_range = free_ranges.erase(next_range);
+  }
+  if (next_range != free_ranges.begin()) {
+    const auto previous_range = std::prev(next_range);
+    if (previous_range->first + previous_range->second == offset) {
+      offset = previous_range->first;
+      size += previous_range->second;
+      free_ranges.erase(previous_range);
+    }
+  }
+  free_ranges.emplace(offset, size);
+
+  _punch_hole(extent, offset, size);
+}
+
+void FileBackedMemoryResource::_punch_hole(const Extent& extent, const size_t offset, const size_t size) const {
+#ifdef __linux__
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto hole_begin = (offset + page_size - 1) / page_size * page_size;
+  const auto hole_end = (offset + size) / page_size * page_size;
+  if (hole_begin >= hole_end) return;
+
+  // This also drops the pages from the mapping, later accesses read zeros. If the file system does not support holes,
+  // the blocks are only reused by later allocations.
+  fallocate(_file_descriptor, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+            extent.file_offset + static_cast<off_t>(hole_begin), static_cast<off_t>(hole_end - hole_begin));
+#endif
+}
+
+std::string TieredStoragePlugin::description() const { return "Tiered storage plugin"; }
+
+void TieredStoragePlugin::start() {
+  const auto path = std::filesystem::temp_directory_path() /
+                    ("hyrise_tiered_storage_" + std::to_string(getpid()) + ".bin");
+  _memory_resource = std::make_unique<FileBackedMemoryResource>(path);
+
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>(_memory_budget);
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_TIERING, [&](size_t) { _tiering_loop(); });
+}
+
+void TieredStoragePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+
+  if (_memory_budget_setting) {
+    _memory_budget_setting->unregister_at_settings_manager();
+    _memory_budget_setting = nullptr;
+  }
+
+  // The segments of evicted chunks point to the memory resource, so they have to be moved back before it is released.
+  for (const auto& [table_name, chunk_id] : _evicted_chunks) {
+    if (!Hyrise::get().storage_manager.has_table(table_name)) continue;
+    const auto chunk = Hyrise::get().storage_manager.get_table(table_name)->get_chunk(chunk_id);
+    if (chunk) _move_chunk(*chunk, PolymorphicAllocator<size_t>{});
+  }
+
+  _evicted_chunks.clear();
+  _last_access_counts.clear();
+  _memory_resource.reset();
+}
+
+/**
+ * This function ranks the immutable chunks of all tables by their recent accesses, evicts cold chunks while the
+ * resident ones exceed the memory budget, and moves evicted chunks that became hot back to DRAM.
+ */
+void TieredStoragePlugin::_tiering_loop() {
+  struct ChunkCandidate {
+    TableAndChunkID table_and_chunk_id;
+    std::shared_ptr<Chunk> chunk;
+    uint64_t recent_access_count;
+    size_t memory_usage;
+  };
+
+  auto resident_chunks = std::vector<ChunkCandidate>{};
+  auto evicted_chunks = std::vector<ChunkCandidate>{};
+  auto resident_memory = size_t{0};
+  auto access_counts = std::map<TableAndChunkID, uint64_t>{};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || _has_indexes(*chunk)) continue;
+
+      auto table_and_chunk_id = TableAndChunkID{table_name, chunk_id};
+      const auto access_count = _access_count(*chunk);
+
+      // Replacing a chunk's segments (e.g., when moving or encoding them) resets their counters.
+      auto recent_access_count = access_count;
+      const auto last_access_count = _last_access_counts.find(table_and_chunk_id);
+      if (last_access_count != _last_access_counts.end() && last_access_count->second <= access_count) {
+        recent_access_count = access_count - last_access_count->second;
+      }
+      access_counts.emplace(table_and_chunk_id, access_count);
+
+      auto candidate = ChunkCandidate{table_and_chunk_id, chunk, recent_access_count,
+                                      chunk->memory_usage(MemoryUsageCalculationMode::Sampled)};
+      if (_evicted_chunks.contains(table_and_chunk_id)) {
+        evicted_chunks.emplace_back(std::move(candidate));
+      } else {
+        resident_memory += candidate.memory_usage;
+        resident_chunks.emplace_back(std::move(candidate));
+      }
+    }
+  }
+
+  // Forget about chunks that have been removed in the meantime
+  _last_access_counts = std::move(access_counts);
+  _evicted_chunks.clear();
+  for (const auto& candidate : evicted_chunks) {
+    _evicted_chunks.emplace(candidate.table_and_chunk_id);
+  }
+
+  // The budget may be changed concurrently, so each iteration uses one consistent value
+  const auto memory_budget = _memory_budget.load();
+
+  // Promote the hottest evicted chunks first
+  std::sort(evicted_chunks.begin(), evicted_chunks.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.recent_access_count > rhs.recent_access_count;
+  });
+  for (const auto& candidate : evicted_chunks) {
+    if (candidate.recent_access_count < HOT_CHUNK_ACCESS_THRESHOLD) break;
+    if (resident_memory + candidate.memory_usage > memory_budget) continue;
+
+    _move_chunk(*candidate.chunk, PolymorphicAllocator<size_t>{});
+    _last_access_counts[candidate.table_and_chunk_id] = 0;
+    _evicted_chunks.erase(candidate.table_and_chunk_id);
+    resident_memory += candidate.memory_usage;
+  }
+
+  // Evict the coldest resident chunks until the budget is met
+  std::sort(resident_chunks.begin(), resident_chunks.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.recent_access_count < rhs.recent_access_count;
+  });
+  auto evicted_memory = size_t{0};
+  auto evicted_chunk_count = size_t{0};
+  const auto allocator = PolymorphicAllocator<size_t>{_memory_resource.get()};
+  for (const auto& candidate : resident_chunks) {
+    if (resident_memory <= memory_budget || candidate.recent_access_count >= HOT_CHUNK_ACCESS_THRESHOLD) break;
+
+    _move_chunk(*candidate.chunk, allocator);
+    _last_access_counts[candidate.table_and_chunk_id] = 0;
+    _evicted_chunks.emplace(candidate.table_and_chunk_id);
+    resident_memory -= candidate.memory_usage;
+    evicted_memory += candidate.memory_usage;
+    ++evicted_chunk_count;
+  }
+
+  if (evicted_chunk_count > 0) {
+    _memory_resource->page_out();
+
+    std::ostringstream message;
+    const auto evicted_mb = static_cast<double>(evicted_memory) / (1000.0 * 1000.0);
+    message << "Evicted " << evicted_chunk_count << " chunk(s) with approx. " << std::setprecision(2) << evicted_mb
+            << " MB to " << _memory_resource->path();
+    Hyrise::get().log_manager.add_message("TieredStoragePlugin", message.str(), LogLevel::Info);
+  }
+}
+
+uint64_t TieredStoragePlugin::_access_count(const Chunk& chunk) {
+  auto access_count = uint64_t{0};
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& access_counter = chunk.get_segment(column_id)->access_counter;
+    for (const auto& [access_type, _] : SegmentAccessCounter::access_type_string_mapping) {
+      access_count += access_counter[access_type];
+    }
+  }
+  return access_count;
+}
+
+bool TieredStoragePlugin::_has_indexes(const Chunk& chunk) {
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (!chunk.get_indexes(std::vector<ColumnID>{column_id}).empty()) return true;
+  }
+  return false;
+}
+
+void TieredStoragePlugin::_move_chunk(Chunk& chunk, const PolymorphicAllocator<size_t>& allocator) {
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    chunk.replace_segment(column_id, chunk.get_segment(column_id)->copy_using_allocator(allocator));
+  }
+}
+
+size_t TieredStoragePlugin::_default_memory_budget() {
+  const auto page_count = static_cast<size_t>(sysconf(_SC_PHYS_PAGES));
+  const auto physical_memory = page_count * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return static_cast<size_t>(static_cast<double>(physical_memory) * DEFAULT_MEMORY_BUDGET_RATIO);
+}
+
+EXPORT_PLUGIN(TieredStoragePlugin)
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class AbstractSetting;
+
+/*
+ * Memory resource that hands out memory from a file that is mapped (MAP_SHARED) in extents of at least EXTENT_SIZE
+ * bytes. Data written to this memory ends up in the file, so the kernel can drop its pages without needing swap space
+ * and reads them back from the file on the next access. Each extent keeps its free ranges, from which allocations are
+ * served first-fit. Deallocated ranges are merged with adjacent free ranges and the file blocks of their whole pages
+ * are released (punched out), so the file only grows when the evicted chunks need more memory than ever before and
+ * does not occupy disk space for chunks that were promoted or removed. Destroying the resource deletes the file.
+ */
+class FileBackedMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  explicit FileBackedMemoryResource(const std::filesystem::path& path);
+  ~FileBackedMemoryResource() override;
+
+  // Writes all dirty pages back to the file and releases them. Later accesses fault them in again.
+  void page_out();
+
+  const std::filesystem::path& path() const;
+
+  constexpr static size_t EXTENT_SIZE = size_t{64} * 1024 * 1024;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override { return &other == this; }
+
+ private:
+  struct Extent {
+    size_t size;
+    off_t file_offset;
+
+    // Unused ranges of the extent as offset -> size. Adjacent ranges are always merged.
+    std::map<size_t, size_t> free_ranges;
+  };
+
+  // Releases the file blocks of the whole pages within the given range of the extent
+  void _punch_hole(const Extent& extent, const size_t offset, const size_t size) const;
+
+  const std::filesystem::path _path;
+  int _file_descriptor;
+  size_t _file_size{0};
+
+  // Mapped extents by their first byte
+  std::map<char*, Extent> _extents;
+
+  std::mutex _mutex;
+};
+
+/*
+ * Tiered storage for data sets that are larger than DRAM. In each iteration, the immutable chunks of all tables are
+ * ranked by the number of segment accesses since the previous iteration (see SegmentAccessCounter). While the resident
+ * chunks exceed the memory budget (setting "TieredStoragePlugin.memory_budget", by default a fraction of the physical
+ * memory), the coldest ones are copied into a FileBackedMemoryResource and their pages are
+ * written to disk and released. The copies are regular segments, so operators read them transparently and the kernel
+ * faults the data back in on access. Evicted chunks that turn hot again are copied back to DRAM if the budget allows.
+ *
+ * Chunks with indexes are never evicted, as the indexes reference the segments they were built on. Before the plugin's
+ * memory resource is released, stop() moves all evicted chunks back to DRAM. Queries may not run while the plugin is
+ * stopped (i.e., unloaded), because they could still hold segments that live in the file.
+ */
+class TieredStoragePlugin : public AbstractPlugin {
+  friend class TieredStoragePluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * DEFAULT_MEMORY_BUDGET_RATIO: share of the physical memory that the resident immutable chunks may occupy unless the
+   * memory budget is set
+   * HOT_CHUNK_ACCESS_THRESHOLD: chunks with at least this many accesses per iteration are never evicted, and evicted
+   * chunks that reach it are moved back to DRAM
+   * IDLE_DELAY_TIERING: sleep after each iteration
+   */
+  constexpr static double DEFAULT_MEMORY_BUDGET_RATIO = 0.5;
+  constexpr static uint64_t HOT_CHUNK_ACCESS_THRESHOLD = 1'000;
+  constexpr static std::chrono::milliseconds IDLE_DELAY_TIERING = std::chrono::milliseconds(10'000);
+
+ private:
+  using TableAndChunkID = std::pair<std::string, ChunkID>;
+
+  void _tiering_loop();
+
+  // Sum of all access counters of the chunk's segments.
+  static uint64_t _access_count(const Chunk& chunk);
+
+  static bool _has_indexes(const Chunk& chunk);
+
+  // Replaces every segment of the chunk by a copy whose memory is allocated by the given allocator.
+  static void _move_chunk(Chunk& chunk, const PolymorphicAllocator<size_t>& allocator);
+
+  static size_t _default_memory_budget();
+
+  std::atomic<size_t> _memory_budget{_default_memory_budget()};
+
+  std::unique_ptr<FileBackedMemoryResource> _memory_resource;
+  std::map<TableAndChunkID, uint64_t> _last_access_counts;
+  std::set<TableAndChunkID> _evicted_chunks;
+
+  std::shared_ptr<AbstractSetting> _memory_budget_setting;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
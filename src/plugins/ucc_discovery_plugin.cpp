@@ -0,0 +1,119 @@
+#include "ucc_discovery_plugin.hpp"
+
+#include <sstream>
+#include <unordered_set>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table_key_constraint.hpp"
+
+namespace opossum {
+
+std::string UccDiscoveryPlugin::description() const { return "Unique column combination discovery plugin"; }
+
+void UccDiscoveryPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_DISCOVERY, [&](size_t) { _discovery_loop(); });
+}
+
+void UccDiscoveryPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+}
+
+void UccDiscoveryPlugin::_discovery_loop() {
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    // The version has to be read before the chunks are looked at (see Table::add_discovered_soft_key_constraint())
+    const auto version = table->discovered_soft_key_constraints_version();
+    const auto validated_version_iter = _validated_versions.find(table_name);
+    if (validated_version_iter != _validated_versions.end() &&
+        validated_version_iter->second.first.lock() == table && validated_version_iter->second.second == version) {
+      continue;
+    }
+
+    // Tables with mutable chunks are validated once these are finalized
+    auto all_chunks_immutable = true;
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk && chunk->is_mutable()) {
+        all_chunks_immutable = false;
+        break;
+      }
+    }
+    if (!all_chunks_immutable || table->empty()) continue;
+
+    const auto discovered_count = _discover_uccs(table, version);
+    _validated_versions[table_name] = {table, version};
+
+    if (discovered_count > 0) {
+      std::ostringstream message;
+      message << "Discovered " << discovered_count << " unique column(s) of table " << table_name;
+      Hyrise::get().log_manager.add_message("UccDiscoveryPlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
+
+size_t UccDiscoveryPlugin::_discover_uccs(const std::shared_ptr<Table>& table, const uint64_t version) {
+  // Columns with a single-column key constraint are unique already
+  auto unique_columns = std::unordered_set<ColumnID>{};
+  for (const auto& key_constraints : {table->soft_key_constraints(), table->discovered_soft_key_constraints()}) {
+    for (const auto& key_constraint : key_constraints) {
+      if (key_constraint.columns().size() == 1) unique_columns.emplace(*key_constraint.columns().cbegin());
+    }
+  }
+
+  auto discovered_count = size_t{0};
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (unique_columns.contains(column_id) || !_is_unique(*table, column_id)) continue;
+
+    if (table->add_discovered_soft_key_constraint(TableKeyConstraint{{column_id}, KeyConstraintType::UNIQUE},
+                                                  version)) {
+      ++discovered_count;
+    } else if (table->discovered_soft_key_constraints_version() != version) {
+      // A chunk was appended, the table is validated again once all of its chunks are immutable
+      break;
+    }
+  }
+
+  return discovered_count;
+}
+
+bool UccDiscoveryPlugin::_is_unique(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+
+  // A chunk whose dictionary has fewer values than the chunk has rows contains a duplicate or a NULL. This also holds
+  // for dictionaries that are shared by several chunks.
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto segment = chunk->get_segment(column_id);
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    if (dictionary_segment && dictionary_segment->unique_values_count() < segment->size()) return false;
+  }
+
+  auto is_unique = true;
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto values = std::unordered_set<ColumnDataType>{};
+    values.reserve(table.row_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && is_unique; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!is_unique) return;
+        is_unique = !position.is_null() && values.emplace(position.value()).second;
+      });
+    }
+  });
+
+  return is_unique;
+}
+
+EXPORT_PLUGIN(UccDiscoveryPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "hyrise.hpp"
+#include "storage/table.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/*
+ * Discovers unique column combinations (UCCs) in the data and registers them as soft key constraints, so that the
+ * optimizer can use them, e.g., in the DependentGroupByReductionRule or to rewrite joins into semi joins. Imported
+ * data rarely declares its keys.
+ *
+ * The candidates are the single columns of a table that are not covered by a key constraint yet. A candidate is
+ * valid if the column has no NULL values and no duplicates. Most candidates are rejected per chunk without looking at
+ * the values: if a dictionary has fewer values than the chunk has rows, the chunk contains a duplicate or a NULL. The
+ * remaining candidates are validated by inserting all values into a hash set, which stops at the first duplicate.
+ *
+ * Only tables whose chunks are all immutable are validated. As new rows are then added in new chunks, the discovered
+ * constraints are dropped when a chunk is appended (see Table::add_discovered_soft_key_constraint()). The table is
+ * validated again once all of its chunks are immutable.
+ */
+class UccDiscoveryPlugin : public AbstractPlugin {
+  friend class UccDiscoveryPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // Sleep after each iteration
+  constexpr static std::chrono::milliseconds IDLE_DELAY_DISCOVERY = std::chrono::milliseconds(10'000);
+
+ private:
+  void _discovery_loop();
+
+  // Validates the candidates of the table and registers the valid ones. Returns the number of registered constraints.
+  static size_t _discover_uccs(const std::shared_ptr<Table>& table, const uint64_t version);
+
+  static bool _is_unique(const Table& table, const ColumnID column_id);
+
+  // The table and the version of its discovered key constraints (see Table) when it was last validated
+  std::unordered_map<std::string, std::pair<std::weak_ptr<const Table>, uint64_t>> _validated_versions;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
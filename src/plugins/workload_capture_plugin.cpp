@@ -0,0 +1,69 @@
+#include "workload_capture_plugin.hpp"
+
+#include "sql/sql_workload_recorder.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+class LogPathSetting : public AbstractSetting {
+ public:
+  explicit LogPathSetting(const std::shared_ptr<SQLWorkloadRecorder>& recorder)
+      : AbstractSetting("WorkloadCapturePlugin.log_path"), _recorder(recorder) {}
+
+  const std::string& description() const final {
+    static const auto description = std::string{"File that the WorkloadCapturePlugin logs the SQL statements to"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = _recorder->path().string();
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty(), "Expected a file path for " + name);
+    _recorder->open(value);
+  }
+
+ private:
+  const std::shared_ptr<SQLWorkloadRecorder> _recorder;
+  std::string _value;
+};
+
+}  // namespace
+
+namespace opossum {
+
+std::string WorkloadCapturePlugin::description() const { return "Workload capture plugin"; }
+
+void WorkloadCapturePlugin::start() {
+  _recorder = std::make_shared<SQLWorkloadRecorder>(DEFAULT_LOG_PATH);
+  _log_path_setting = std::make_shared<LogPathSetting>(_recorder);
+  _log_path_setting->register_at_settings_manager();
+
+  Hyrise::get().workload_recorder = _recorder;
+}
+
+void WorkloadCapturePlugin::stop() {
+  // Statements that are still running hold their own reference to the recorder
+  if (Hyrise::get().workload_recorder == _recorder) {
+    Hyrise::get().workload_recorder = nullptr;
+  }
+
+  if (_log_path_setting) {
+    _log_path_setting->unregister_at_settings_manager();
+    _log_path_setting = nullptr;
+  }
+
+  if (_recorder) {
+    _recorder->flush();
+    _recorder = nullptr;
+  }
+}
+
+EXPORT_PLUGIN(WorkloadCapturePlugin)
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "hyrise.hpp"
+#include "utils/abstract_plugin.hpp"
+
+namespace opossum {
+
+class AbstractSetting;
+class SQLWorkloadRecorder;
+
+/*
+ * Captures the workload of this instance: While the plugin is loaded, all SQL statements executed by SQLPipelines
+ * (e.g., those of the server's simple query protocol) are logged with their timing, session, and transaction by an
+ * SQLWorkloadRecorder. The log can be replayed against a snapshot of the data with hyriseWorkloadReplay.
+ *
+ * The log is written to DEFAULT_LOG_PATH in the working directory. The setting "WorkloadCapturePlugin.log_path"
+ * switches to another file, e.g., to capture a specific time frame. Unloading the plugin stops the capture and flushes
+ * the log.
+ */
+class WorkloadCapturePlugin : public AbstractPlugin {
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  constexpr static auto DEFAULT_LOG_PATH = "hyrise_workload.log";
+
+ private:
+  std::shared_ptr<SQLWorkloadRecorder> _recorder;
+  std::shared_ptr<AbstractSetting> _log_path_setting;
+};
+
+}  // namespace opossum
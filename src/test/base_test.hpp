@@ -97,9 +97,11 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::Unencoded},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
+    SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::FixedSizeByteAligned},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
     SegmentEncodingSpec{EncodingType::LZ4},
-    SegmentEncodingSpec{EncodingType::RunLength}};
+    SegmentEncodingSpec{EncodingType::RunLength},
+    SegmentEncodingSpec{EncodingType::FSST}};
 }  // namespace opossum
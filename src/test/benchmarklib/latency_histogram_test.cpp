@@ -0,0 +1,80 @@
+#include "../base_test.hpp"
+
+#include "latency_histogram.hpp"
+
+namespace opossum {
+
+class LatencyHistogramTest : public BaseTest {};
+
+TEST_F(LatencyHistogramTest, EmptyHistogram) {
+  const auto histogram = LatencyHistogram{};
+  EXPECT_EQ(histogram.count(), 0);
+  EXPECT_EQ(histogram.max(), 0);
+  EXPECT_EQ(histogram.percentile(99.0), 0);
+  EXPECT_TRUE(histogram.to_json()["buckets"].empty());
+}
+
+TEST_F(LatencyHistogramTest, BucketBounds) {
+  // Small values are counted exactly
+  EXPECT_EQ(LatencyHistogram::bucket_index(0), 0);
+  EXPECT_EQ(LatencyHistogram::bucket_index(255), 255);
+  EXPECT_EQ(LatencyHistogram::bucket_upper_bound(255), 255);
+
+  // Above, buckets are contiguous and their relative width is below 1%
+  for (const auto value : {uint64_t{256}, uint64_t{1'000}, uint64_t{123'456'789}, uint64_t{1} << 62}) {
+    const auto index = LatencyHistogram::bucket_index(value);
+    const auto upper_bound = LatencyHistogram::bucket_upper_bound(index);
+    const auto lower_bound = LatencyHistogram::bucket_upper_bound(index - 1) + 1;
+    EXPECT_LE(lower_bound, value);
+    EXPECT_GE(upper_bound, value);
+    EXPECT_EQ(LatencyHistogram::bucket_index(upper_bound + 1), index + 1);
+    EXPECT_LT(static_cast<double>(upper_bound - lower_bound) / static_cast<double>(lower_bound), 0.01);
+  }
+
+  EXPECT_EQ(LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(UINT64_MAX)), UINT64_MAX);
+}
+
+TEST_F(LatencyHistogramTest, Percentiles) {
+  auto histogram = LatencyHistogram{};
+  for (auto value = 1; value <= 1'000; ++value) {
+    histogram.record(std::chrono::microseconds{value});
+  }
+
+  EXPECT_EQ(histogram.count(), 1'000);
+  EXPECT_EQ(histogram.min(), 1'000);
+  EXPECT_EQ(histogram.max(), 1'000'000);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 500'500.0);
+
+  EXPECT_NEAR(static_cast<double>(histogram.percentile(50.0)), 500'000.0, 5'000.0);
+  EXPECT_NEAR(static_cast<double>(histogram.percentile(90.0)), 900'000.0, 9'000.0);
+  EXPECT_NEAR(static_cast<double>(histogram.percentile(99.0)), 990'000.0, 9'900.0);
+  EXPECT_EQ(histogram.percentile(100.0), 1'000'000);
+
+  const auto json = histogram.to_json();
+  EXPECT_EQ(json["p99.9"], histogram.percentile(99.9));
+
+  auto bucket_count_sum = uint64_t{0};
+  for (const auto& bucket : json["buckets"]) {
+    bucket_count_sum += bucket["count"].get<uint64_t>();
+  }
+  EXPECT_EQ(bucket_count_sum, 1'000);
+  EXPECT_FALSE(histogram.to_json(false).contains("buckets"));
+}
+
+TEST_F(LatencyHistogramTest, Merge) {
+  auto histogram_a = LatencyHistogram{};
+  histogram_a.record(std::chrono::milliseconds{2});
+
+  auto histogram_b = LatencyHistogram{};
+  histogram_b.record(std::chrono::nanoseconds{10});
+  histogram_b.record(std::chrono::seconds{1});
+
+  histogram_a.merge(histogram_b);
+  EXPECT_EQ(histogram_a.count(), 3);
+  EXPECT_EQ(histogram_a.min(), 10);
+  EXPECT_EQ(histogram_a.max(), 1'000'000'000);
+  EXPECT_EQ(histogram_a.percentile(50.0),
+            LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(2'000'000)));
+}
+
+}  // namespace opossum
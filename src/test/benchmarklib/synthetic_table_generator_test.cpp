@@ -41,6 +41,35 @@ TEST_F(SyntheticTableGeneratorTest, TestGeneratedValueRange) {
   EXPECT_EQ(table->chunk_count(), row_count / chunk_size);
 }
 
+TEST_F(SyntheticTableGeneratorTest, SkewedDistributions) {
+  constexpr auto row_count = size_t{10'000};
+  constexpr auto chunk_size = size_t{1'000};
+
+  const auto value_counts = [&](const ColumnDataDistribution& distribution) {
+    const auto table = SyntheticTableGenerator::generate_table({{distribution, DataType::Int}}, row_count, chunk_size);
+    auto counts = std::vector<size_t>(1'001);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      const auto value = table->get_value<int32_t>(ColumnID{0}, row_id);
+      EXPECT_TRUE(value && *value >= 0 && *value <= 1'000);
+      ++counts[*value];
+    }
+    return counts;
+  };
+
+  // With an exponent of 1, the most frequent value occurs in about 1 / H(1'001) ≈ 13% of the rows, the second one in
+  // half as many
+  const auto zipf_counts = value_counts(ColumnDataDistribution::make_zipf_config(0.0, 1'000.0));
+  EXPECT_GT(zipf_counts[0], row_count / 10);
+  EXPECT_GT(zipf_counts[0], zipf_counts[1]);
+  EXPECT_GT(zipf_counts[1], zipf_counts[100]);
+
+  const auto hot_key_counts = value_counts(ColumnDataDistribution::make_hot_key_config(0.0, 1'000.0, 0.5, 2));
+  EXPECT_GT(hot_key_counts[0] + hot_key_counts[1], row_count * 4 / 10);
+  EXPECT_GT(hot_key_counts[0], row_count / 5);
+  EXPECT_GT(hot_key_counts[1], row_count / 5);
+  EXPECT_LT(hot_key_counts[2], row_count / 100);
+}
+
 using Params = std::tuple<DataType, ColumnDataDistribution>;
 
 class SyntheticTableGeneratorDataTypeTests : public testing::TestWithParam<Params> {};
@@ -100,6 +129,12 @@ auto formatter = [](const testing::TestParamInfo<Params> info) {
       break;
     case DataDistributionType::NormalSkewed:
       stream << "Skewed";
+      break;
+    case DataDistributionType::Zipf:
+      stream << "Zipf";
+      break;
+    case DataDistributionType::HotKey:
+      stream << "HotKey";
   }
 
   stream << "_" << data_type_to_string.left.at(std::get<0>(info.param));
@@ -113,6 +148,8 @@ INSTANTIATE_TEST_SUITE_P(SyntheticTableGeneratorDataType, SyntheticTableGenerato
                                                           DataType::Double, DataType::String),
                                           testing::Values(ColumnDataDistribution::make_uniform_config(0.0, 10'000),
                                                           ColumnDataDistribution::make_pareto_config(),
-                                                          ColumnDataDistribution::make_skewed_normal_config(1'000.0))),
+                                                          ColumnDataDistribution::make_skewed_normal_config(1'000.0),
+                                                          ColumnDataDistribution::make_zipf_config(0.0, 10'000),
+                                                          ColumnDataDistribution::make_hot_key_config(0.0, 10'000))),
                          formatter);
 }  // namespace opossum
@@ -465,4 +465,23 @@ TEST_F(TPCCTest, OrderStatusCustomerById) {
 
 // The dynamic nature of Stock-Level together with the random table generation makes this transaction hard to test.
 
+TEST_F(TPCCTest, PreparedStatements) {
+  // The statements are prepared once, the later executions bind their parameters to the generic plan
+  const auto sql = std::string{"SELECT W_TAX FROM WAREHOUSE WHERE W_ID = ?"};
+  BenchmarkSQLExecutor sql_executor{nullptr, std::nullopt};
+  for (auto execution_idx = int32_t{0}; execution_idx < 8; ++execution_idx) {
+    const auto w_id = 1 + execution_idx % NUM_WAREHOUSES;
+    const auto [prepared_status, prepared_table] = sql_executor.execute_prepared(sql, {w_id});
+    EXPECT_EQ(prepared_status, SQLPipelineStatus::Success);
+
+    const auto table = sql_executor.execute("SELECT W_TAX FROM WAREHOUSE WHERE W_ID = " + std::to_string(w_id)).second;
+    EXPECT_TABLE_EQ_ORDERED(prepared_table, table);
+  }
+
+  EXPECT_TRUE(Hyrise::get().storage_manager.has_prepared_plan(sql));
+
+  // Only the unprepared executions record metrics
+  EXPECT_EQ(sql_executor.metrics.size(), 8);
+}
+
 }  // namespace opossum
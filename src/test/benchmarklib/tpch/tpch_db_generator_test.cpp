@@ -1,6 +1,11 @@
+#include <filesystem>
+
 #include "base_test.hpp"
 
+#include "benchmark_config.hpp"
 #include "hyrise.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_value_segment.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/load_table.hpp"
 
@@ -59,6 +64,52 @@ TEST_F(TPCHTableGeneratorTest, SmallScaleFactor) {
   }
 }
 
+TEST_F(TPCHTableGeneratorTest, EncodeChunksDuringGeneration) {
+  const auto table_info_by_name = TPCHTableGenerator(0.01f, 1000).generate();
+
+  // Tables that are not sorted later are encoded with the default encoding as soon as their chunks are complete
+  const auto& customer_table = table_info_by_name.at("customer").table;
+  for (auto chunk_id = ChunkID{0}; chunk_id < customer_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = customer_table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id)));
+    }
+  }
+
+  // The lineitem table is sorted by generate_and_store(), which encodes it afterwards
+  const auto& lineitem_chunk = table_info_by_name.at("lineitem").table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseValueSegment>(lineitem_chunk->get_segment(ColumnID{0})));
+}
+
+TEST_F(TPCHTableGeneratorTest, BinaryTableCache) {
+  // An unusual scale factor so that we do not interfere with caches of actual benchmark runs
+  const auto scale_factor = 0.005f;
+  const auto cache_directory = std::string{"tpch_cached_tables/sf-"} + std::to_string(scale_factor);
+  std::filesystem::remove_all(cache_directory);
+
+  auto config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  config->chunk_size = 1000;
+  config->cache_binary_tables = true;
+  TPCHTableGenerator(scale_factor, config).generate_and_store();
+  EXPECT_TRUE(std::filesystem::exists(cache_directory + "/customer.bin"));
+
+  const auto cached_table_info_by_name = TPCHTableGenerator(scale_factor, config).generate();
+  EXPECT_EQ(cached_table_info_by_name.size(), 8);
+  for (const auto& [table_name, table_info] : cached_table_info_by_name) {
+    EXPECT_TRUE(table_info.loaded_from_binary);
+    EXPECT_TABLE_EQ_ORDERED(table_info.table, Hyrise::get().storage_manager.get_table(table_name));
+  }
+
+  // Cached tables with a different chunk size are discarded and re-generated
+  config->chunk_size = 500;
+  const auto generated_table_info_by_name = TPCHTableGenerator(scale_factor, config).generate();
+  EXPECT_FALSE(generated_table_info_by_name.at("customer").loaded_from_binary);
+  EXPECT_EQ(generated_table_info_by_name.at("customer").table->get_chunk(ChunkID{0})->size(), 500);
+
+  std::filesystem::remove_all(cache_directory);
+}
+
 TEST_F(TPCHTableGeneratorTest, RowCountsMediumScaleFactor) {
   /**
    * Mostly intended to generate coverage and trigger potential leaks in third_party/tpch_dbgen
@@ -1,5 +1,10 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
+#include "cache/sharded_gdfs_cache.hpp"
+
 namespace opossum {
 
 // Test for the cache implementation in lib/cache.
@@ -191,4 +196,80 @@ TEST_F(CacheTest, Snapshot) {
   }
 }
 
+TEST_F(CacheTest, ShardedGDFSSingleShard) {
+  // Small caches have a single shard and evict like the GDFSCache, even though the hits are applied lazily
+  ShardedGDFSCache<int, int> cache(2);
+  ASSERT_EQ(cache.shard_count(), 1u);
+
+  cache.set(1, 2);                 // Miss, insert, L=0, Fr=1
+  ASSERT_EQ(cache.try_get(1), 2);  // Hit, L=0, Fr=2
+  ASSERT_EQ(cache.try_get(1), 2);  // Hit, L=0, Fr=3
+  cache.set(2, 4);                 // Miss, insert, L=0, Fr=1
+  cache.set(3, 6);                 // Miss, evict 2, L=1, Fr=1
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit, L=1, Fr=2
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit, L=1, Fr=3
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit, L=1, Fr=4
+  cache.set(2, 4);                 // Miss, evict 1 (priority 3 vs. 5), L=3, Fr=1
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  const auto snapshot = cache.snapshot();
+  EXPECT_EQ(snapshot.at(2).frequency, 1);
+  EXPECT_EQ(snapshot.at(3).frequency, 4);
+}
+
+TEST_F(CacheTest, ShardedGDFSCapacity) {
+  ShardedGDFSCache<int, int> cache(256);
+  ASSERT_EQ(cache.shard_count(), 4u);
+
+  for (auto key = 0; key < 1'000; ++key) {
+    cache.set(key, key);
+  }
+  ASSERT_EQ(cache.size(), 256u);
+
+  cache.resize(128);
+  ASSERT_EQ(cache.capacity(), 128u);
+  ASSERT_EQ(cache.size(), 128u);
+
+  cache.clear();
+  ASSERT_EQ(cache.size(), 0u);
+}
+
+TEST_F(CacheTest, ShardedGDFSConcurrentHits) {
+  ShardedGDFSCache<int, int> cache(1'024);
+  for (auto key = 0; key < 100; ++key) {
+    cache.set(key, key * 10);
+  }
+
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto HITS_PER_THREAD = 1'000;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto hit_id = 0; hit_id < HITS_PER_THREAD; ++hit_id) {
+        const auto key = hit_id % 100;
+        EXPECT_EQ(cache.try_get(key), key * 10);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // No hit is lost
+  const auto snapshot = cache.snapshot();
+  for (auto key = 0; key < 100; ++key) {
+    EXPECT_EQ(snapshot.at(key).frequency, 1 + THREAD_COUNT * HITS_PER_THREAD / 100);
+  }
+}
+
 }  // namespace opossum
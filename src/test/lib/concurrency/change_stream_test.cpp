@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/change_stream.hpp"
+#include "concurrency/replica.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class ChangeStreamTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    add_table_a();
+
+    Hyrise::get().change_stream = std::make_shared<ChangeStream>();
+    Hyrise::get().change_stream->subscribe([&](const CommitID commit_id, const auto& records) {
+      changes.emplace_back(commit_id, std::string{records->begin(), records->end()});
+    });
+  }
+
+  // The state of the primary when the replica took its snapshot
+  static void add_table_a() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, pmr_string{"one"}});
+    table->append({2, pmr_string{"two"}});
+    table->append({3, NULL_VALUE});
+    Hyrise::get().storage_manager.add_table("table_a", table);
+  }
+
+  static void execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [status, _] = pipeline.get_result_table();
+    ASSERT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> table_a() {
+    auto pipeline = SQLPipelineBuilder{std::string{"SELECT * FROM table_a"}}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  std::vector<std::pair<CommitID, std::string>> changes;
+};
+
+TEST_F(ChangeStreamTest, PublishInCommitOrder) {
+  execute("INSERT INTO table_a VALUES (4, 'four')");
+  execute("SELECT * FROM table_a");
+  execute("DELETE FROM table_a WHERE a = 5");
+  execute("DELETE FROM table_a WHERE a = 1");
+
+  // Commits without changes are not published
+  ASSERT_EQ(changes.size(), 2);
+  EXPECT_LT(changes[0].first, changes[1].first);
+
+  Hyrise::get().change_stream = nullptr;
+  execute("INSERT INTO table_a VALUES (5, 'five')");
+  EXPECT_EQ(changes.size(), 2);
+}
+
+TEST_F(ChangeStreamTest, ApplyOnReplica) {
+  execute("INSERT INTO table_a VALUES (4, 'four'), (5, NULL), (1, 'one')");
+  execute("DELETE FROM table_a WHERE a = 2");
+  const auto intermediate_table = table_a();
+  execute("UPDATE table_a SET b = 'three' WHERE a = 3");
+  execute("DELETE FROM table_a WHERE a = 1 AND b = 'one'");
+  const auto expected_table = table_a();
+  ASSERT_EQ(changes.size(), 4);
+
+  // Replay the changes on a replica that starts from the same state
+  Hyrise::reset();
+  add_table_a();
+  const auto replica = std::make_shared<Replica>();
+  Hyrise::get().replica = replica;
+
+  replica->apply(changes[0].first, changes[0].second);
+  replica->apply(changes[1].first, changes[1].second);
+  EXPECT_EQ(replica->applied_commit_id(), changes[1].first);
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), intermediate_table);
+  EXPECT_THROW(replica->apply(changes[0].first, changes[0].second), std::exception);
+
+  replica->apply(changes[2].first, changes[2].second);
+  replica->apply(changes[3].first, changes[3].second);
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), expected_table);
+
+  // Replicas are read-only
+  auto pipeline = SQLPipelineBuilder{std::string{"INSERT INTO table_a VALUES (6, 'six')"}}.create_pipeline();
+  EXPECT_THROW(pipeline.get_result_table(), InvalidInputException);
+}
+
+}  // namespace opossum
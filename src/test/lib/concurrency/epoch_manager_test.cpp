@@ -0,0 +1,114 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/epoch_manager.hpp"
+
+namespace opossum {
+
+class EpochManagerTest : public BaseTest {
+ protected:
+  void SetUp() override { ASSERT_EQ(EpochManager::get().reclaim(), 0); }
+
+  // Sets the flag once it is deleted
+  struct Retirable {
+    explicit Retirable(std::atomic_bool& init_deleted) : deleted(init_deleted) {}
+    ~Retirable() { deleted = true; }
+
+    std::atomic_bool& deleted;
+  };
+};
+
+TEST_F(EpochManagerTest, RetireWithoutReaders) {
+  auto deleted = std::atomic_bool{false};
+  EpochManager::get().retire(new Retirable{deleted});
+  EXPECT_TRUE(deleted);
+  EXPECT_EQ(EpochManager::get().retired_count(), 0);
+}
+
+TEST_F(EpochManagerTest, PinnedReadersDelayReclamation) {
+  auto& epoch_manager = EpochManager::get();
+  auto deleted = std::atomic_bool{false};
+
+  {
+    const auto outer_guard = epoch_manager.pin();
+    {
+      const auto inner_guard = epoch_manager.pin();
+      epoch_manager.retire(new Retirable{deleted});
+    }
+    EXPECT_FALSE(deleted);
+    EXPECT_EQ(epoch_manager.reclaim(), 1);
+  }
+
+  EXPECT_EQ(epoch_manager.reclaim(), 0);
+  EXPECT_TRUE(deleted);
+}
+
+TEST_F(EpochManagerTest, ReadersPinnedAfterRetirementDoNotDelayReclamation) {
+  auto& epoch_manager = EpochManager::get();
+  auto deleted = std::atomic_bool{false};
+
+  auto reader_pinned = std::atomic_bool{false};
+  auto retired = std::atomic_bool{false};
+  auto reader = std::thread{[&]() {
+    const auto epoch_guard = epoch_manager.pin();
+    reader_pinned = true;
+    while (!retired) std::this_thread::yield();
+  }};
+
+  while (!reader_pinned) std::this_thread::yield();
+  epoch_manager.retire(new Retirable{deleted});
+  EXPECT_FALSE(deleted);
+
+  // Pinning a new epoch, potentially in the same slot as the reader, must not free objects the reader might access
+  {
+    const auto epoch_guard = epoch_manager.pin();
+    EXPECT_EQ(epoch_manager.reclaim(), 1);
+  }
+
+  retired = true;
+  reader.join();
+  EXPECT_EQ(epoch_manager.reclaim(), 0);
+  EXPECT_TRUE(deleted);
+}
+
+TEST_F(EpochManagerTest, ConcurrentReaders) {
+  auto& epoch_manager = EpochManager::get();
+
+  constexpr auto THREAD_COUNT = uint32_t{8};
+  constexpr auto ITERATION_COUNT = uint32_t{10'000};
+
+  // Readers copy the shared pointer of the current holder, while a writer replaces and retires it
+  auto current_holder = std::atomic<std::shared_ptr<uint32_t>*>{new std::shared_ptr<uint32_t>(new uint32_t{0})};
+
+  auto stop = std::atomic_bool{false};
+  auto readers = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    readers.emplace_back([&]() {
+      while (!stop) {
+        const auto epoch_guard = epoch_manager.pin();
+        const auto value = *current_holder.load();
+        EXPECT_LE(*value, ITERATION_COUNT);
+      }
+    });
+  }
+
+  for (auto iteration = uint32_t{1}; iteration <= ITERATION_COUNT; ++iteration) {
+    auto* const previous_holder =
+        current_holder.exchange(new std::shared_ptr<uint32_t>(std::make_shared<uint32_t>(iteration)));
+    epoch_manager.retire(previous_holder);
+  }
+
+  stop = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(epoch_manager.reclaim(), 0);
+  delete current_holder.load();
+}
+
+}  // namespace opossum
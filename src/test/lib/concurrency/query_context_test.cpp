@@ -0,0 +1,103 @@
+#include "base_test.hpp"
+
+#include "concurrency/query_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class QueryContextTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int.tbl", 1));
+    _table_wrapper->execute();
+    _query_context = std::make_shared<QueryContext>("SELECT * FROM int_int", 0);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<QueryContext> _query_context;
+};
+
+TEST_F(QueryContextTest, OperatorsReportProgress) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+  const auto aggregate = std::make_shared<AggregateHash>(
+      table_scan, std::vector<std::shared_ptr<AggregateExpression>>{min_(pqp_column_(ColumnID{0}, DataType::Int,
+                                                                                      false, "a"))},
+      std::initializer_list<ColumnID>{ColumnID{1}});
+  aggregate->set_query_context_recursively(_query_context);
+  EXPECT_EQ(table_scan->query_context(), _query_context);
+
+  table_scan->execute();
+  aggregate->execute();
+
+  EXPECT_EQ(table_scan->progress(), std::make_pair(size_t{3}, size_t{3}));
+  EXPECT_EQ(aggregate->progress(), std::make_pair(size_t{2}, size_t{2}));
+  EXPECT_EQ(aggregate->get_output()->row_count(), 2u);
+
+  // Operators without per-chunk loops do not report their progress
+  EXPECT_EQ(_table_wrapper->progress(), std::make_pair(size_t{0}, size_t{0}));
+}
+
+TEST_F(QueryContextTest, CancelledOperatorsStopProcessing) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+  table_scan->set_query_context_recursively(_query_context);
+  _query_context->cancel();
+  EXPECT_TRUE(table_scan->is_cancelled());
+
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(table_scan->progress(), std::make_pair(size_t{0}, size_t{3}));
+}
+
+TEST_F(QueryContextTest, MemoryAccounting) {
+  const auto aggregate = std::make_shared<AggregateHash>(
+      _table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{min_(pqp_column_(ColumnID{0}, DataType::Int,
+                                                                                           false, "a"))},
+      std::initializer_list<ColumnID>{ColumnID{1}});
+  aggregate->set_query_context_recursively(_query_context);
+  aggregate->execute();
+
+  // The intermediate data structures are released, but the output is accounted until it is cleared
+  EXPECT_GT(aggregate->performance_data->peak_memory_usage, 0u);
+  EXPECT_GT(_query_context->memory_resource()->allocated_bytes(), 0u);
+  EXPECT_GE(_query_context->memory_resource()->peak_allocated_bytes(),
+            aggregate->performance_data->peak_memory_usage);
+  aggregate->clear_output();
+  EXPECT_EQ(_query_context->memory_resource()->allocated_bytes(), 0u);
+}
+
+TEST_F(QueryContextTest, MemoryLimitCancelsQuery) {
+  const auto query_context = std::make_shared<QueryContext>("SELECT * FROM int_int", 0, 1);
+  const auto aggregate = std::make_shared<AggregateHash>(
+      _table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{min_(pqp_column_(ColumnID{0}, DataType::Int,
+                                                                                           false, "a"))},
+      std::initializer_list<ColumnID>{ColumnID{1}});
+  aggregate->set_query_context_recursively(query_context);
+  EXPECT_FALSE(aggregate->is_cancelled());
+
+  aggregate->execute();
+  EXPECT_TRUE(query_context->memory_limit_exceeded());
+  EXPECT_TRUE(aggregate->is_cancelled());
+}
+
+TEST_F(QueryContextTest, RunningQueries) {
+  auto& running_queries = Hyrise::get().running_queries;
+  running_queries.add(_query_context);
+  ASSERT_EQ(running_queries.query_contexts().size(), 1u);
+  EXPECT_EQ(running_queries.query_contexts().front()->sql(), "SELECT * FROM int_int");
+
+  EXPECT_FALSE(running_queries.cancel(_query_context->id() + 1));
+  EXPECT_FALSE(_query_context->is_cancelled());
+  EXPECT_TRUE(running_queries.cancel(_query_context->id()));
+  EXPECT_TRUE(_query_context->is_cancelled());
+
+  running_queries.remove(*_query_context);
+  EXPECT_TRUE(running_queries.query_contexts().empty());
+}
+
+}  // namespace opossum
@@ -1,8 +1,12 @@
 #include <algorithm>
+#include <atomic>
+#include <set>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
 
+#include "concurrency/commit_context.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 
@@ -12,16 +16,33 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::multiset<CommitID> get_active_snapshot_commit_ids() {
+    const auto& manager = Hyrise::get().transaction_manager;
+    auto active_snapshot_commit_ids = std::multiset<CommitID>{};
+    for (auto slot_id = uint32_t{0}; slot_id < TransactionManager::ACTIVE_SNAPSHOT_SLOT_COUNT; ++slot_id) {
+      const auto slot_state = manager._active_snapshot_slots[slot_id].load();
+      for (auto count = slot_state & 0xFFFFFFFF; count > 0; --count) {
+        active_snapshot_commit_ids.emplace(static_cast<CommitID>(slot_state >> 32u));
+      }
+    }
+    return active_snapshot_commit_ids;
   }
 
+  static uint32_t active_snapshot_slot_count() { return TransactionManager::ACTIVE_SNAPSHOT_SLOT_COUNT; }
+
+  static TransactionID next_transaction_id() { return Hyrise::get().transaction_manager._next_transaction_id; }
+
   static void register_transaction(CommitID snapshot_commit_id) {
     Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
   }
   static void deregister_transaction(CommitID snapshot_commit_id) {
     Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id);
   }
+
+  static std::shared_ptr<CommitContext> new_commit_context() {
+    return Hyrise::get().transaction_manager._new_commit_context();
+  }
+  static void publish_pending_commits() { Hyrise::get().transaction_manager._publish_pending_commits(); }
 };
 
 /** Check if all active snapshot commit ids of uncommitted
@@ -46,30 +67,24 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t1_snapshot_commit_id));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_snapshot_commit_id));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t3_snapshot_commit_id));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
   t1_context->commit();
   deregister_transaction(t1_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t1_context->snapshot_commit_id()));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t3_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t3_context->commit();
   deregister_transaction(t3_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t2_context->commit();
@@ -84,4 +99,148 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   register_transaction(t3_snapshot_commit_id);
 }
 
+TEST_F(TransactionManagerTest, TrackCollidingSnapshotCommitIDs) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  // All of these snapshot commit ids map to the same slot
+  const auto slot_count = active_snapshot_slot_count();
+  register_transaction(CommitID{5 + 2 * slot_count});
+  register_transaction(CommitID{5 + slot_count});
+  register_transaction(CommitID{5 + slot_count});
+  register_transaction(CommitID{5});
+  EXPECT_EQ(get_active_snapshot_commit_ids(), std::multiset<CommitID>({5, 5 + slot_count, 5 + slot_count,
+                                                                       5 + 2 * slot_count}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+
+  deregister_transaction(CommitID{5});
+  deregister_transaction(CommitID{5 + 2 * slot_count});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5 + slot_count});
+
+  deregister_transaction(CommitID{5 + slot_count});
+  deregister_transaction(CommitID{5 + slot_count});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+  EXPECT_THROW(deregister_transaction(CommitID{5}), std::logic_error);
+}
+
+TEST_F(TransactionManagerTest, ReadOnlyTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto initial_next_transaction_id = next_transaction_id();
+  const auto last_commit_id = manager.last_commit_id();
+
+  auto t1_context = manager.new_transaction_context(AutoCommit::Yes, TransactionAccessMode::ReadOnly);
+  auto t2_context = manager.new_transaction_context(AutoCommit::Yes, TransactionAccessMode::ReadOnly);
+  EXPECT_TRUE(t1_context->is_read_only());
+  EXPECT_EQ(t1_context->transaction_id(), READ_ONLY_TRANSACTION_ID);
+  EXPECT_EQ(next_transaction_id(), initial_next_transaction_id);
+
+  // Readers are counted in the reader slots, not in the hash table of active snapshot commit ids
+  EXPECT_TRUE(get_active_snapshot_commit_ids().empty());
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), last_commit_id);
+
+  EXPECT_THROW(t1_context->register_read_write_operator(nullptr), std::logic_error);
+
+  t1_context->commit();
+  EXPECT_EQ(t1_context->phase(), TransactionPhase::Committed);
+  auto callback_called = false;
+  t2_context->commit_async([&](const TransactionID /*transaction_id*/) { callback_called = true; });
+  EXPECT_TRUE(callback_called);
+  EXPECT_EQ(manager.last_commit_id(), last_commit_id);
+
+  // Readers can be released by other threads
+  std::thread{[&]() { t1_context = nullptr; }}.join();
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), last_commit_id);
+  t2_context = nullptr;
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentReadOnlyTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  constexpr auto THREAD_COUNT = uint32_t{8};
+  constexpr auto TRANSACTIONS_PER_THREAD = uint32_t{1'000};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto transaction_id = uint32_t{0}; transaction_id < TRANSACTIONS_PER_THREAD; ++transaction_id) {
+        const auto reader_context = manager.new_transaction_context(AutoCommit::Yes, TransactionAccessMode::ReadOnly);
+        reader_context->commit();
+
+        // Mix in some writers that publish new snapshots
+        if (transaction_id % 10 == 0) {
+          const auto commit_context = new_commit_context();
+          commit_context->make_pending(TransactionID{1}, [](const TransactionID /*transaction_id*/) {});
+          publish_pending_commits();
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, GroupCommit) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto initial_commit_id = manager.last_commit_id();
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto callback = [&](const TransactionID transaction_id) {
+    committed_transaction_ids.emplace_back(transaction_id);
+  };
+
+  const auto context_1 = new_commit_context();
+  const auto context_2 = new_commit_context();
+  const auto context_3 = new_commit_context();
+  EXPECT_EQ(context_1->commit_id(), initial_commit_id + 1);
+  EXPECT_EQ(context_3->commit_id(), initial_commit_id + 3);
+
+  // Later commits are not visible before the earlier ones are
+  context_3->make_pending(TransactionID{3}, callback);
+  publish_pending_commits();
+  context_2->make_pending(TransactionID{2}, callback);
+  publish_pending_commits();
+  EXPECT_EQ(manager.last_commit_id(), initial_commit_id);
+  EXPECT_TRUE(committed_transaction_ids.empty());
+
+  // All three are published together and in order
+  context_1->make_pending(TransactionID{1}, callback);
+  publish_pending_commits();
+  EXPECT_EQ(manager.last_commit_id(), initial_commit_id + 3);
+  EXPECT_EQ(committed_transaction_ids, std::vector<TransactionID>({1, 2, 3}));
+}
+
+TEST_F(TransactionManagerTest, ConcurrentCommits) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto initial_commit_id = manager.last_commit_id();
+
+  constexpr auto THREAD_COUNT = uint32_t{8};
+  constexpr auto COMMITS_PER_THREAD = uint32_t{1'000};
+
+  auto callback_count = std::atomic_uint{0};
+  const auto callback = [&](const TransactionID /*transaction_id*/) { ++callback_count; };
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto commit_id = uint32_t{0}; commit_id < COMMITS_PER_THREAD; ++commit_id) {
+        const auto commit_context = new_commit_context();
+        commit_context->make_pending(TransactionID{1}, callback);
+        publish_pending_commits();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Every commit was published, even if its thread could not publish it itself
+  EXPECT_EQ(manager.last_commit_id(), initial_commit_id + THREAD_COUNT * COMMITS_PER_THREAD);
+  EXPECT_EQ(callback_count, THREAD_COUNT * COMMITS_PER_THREAD);
+}
+
 }  // namespace opossum
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(directory);
+
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, pmr_string{"one"}});
+    table->append({2, pmr_string{"two"}});
+    table->append({3, NULL_VALUE});
+    Hyrise::get().storage_manager.add_table("table_a", table);
+
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(directory);
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::filesystem::remove_all(directory);
+  }
+
+  static void execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [status, _] = pipeline.get_result_table();
+    ASSERT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> table_a() {
+    auto pipeline = SQLPipelineBuilder{std::string{"SELECT * FROM table_a"}}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  // Drops all in-memory state as a crash would (but lets the log finish its writes) and recovers from the directory
+  void restart() {
+    Hyrise::reset();
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(directory);
+  }
+
+  std::vector<std::string> directory_contents() const {
+    auto filenames = std::vector<std::string>{};
+    for (const auto& directory_entry : std::filesystem::directory_iterator(directory)) {
+      filenames.emplace_back(directory_entry.path().filename().string());
+    }
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+  }
+
+  const std::filesystem::path directory = test_data_path + "write_ahead_log_test";
+};
+
+TEST_F(WriteAheadLogTest, RecoverFromLog) {
+  execute("INSERT INTO table_a VALUES (4, 'four'), (5, NULL), (1, 'one')");
+  execute("DELETE FROM table_a WHERE a = 2");
+  execute("UPDATE table_a SET b = 'three' WHERE a = 3");
+  execute("DELETE FROM table_a WHERE a = 1 AND b = 'one'");
+  const auto expected_table = table_a();
+  EXPECT_EQ(expected_table->row_count(), 3);
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), expected_table);
+
+  // The recovered commits are part of the new checkpoint
+  EXPECT_EQ(directory_contents(), std::vector<std::string>({"checkpoint_2", "log_2.wal"}));
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), expected_table);
+
+  // Tables can be modified after the recovery
+  execute("INSERT INTO table_a VALUES (6, 'six')");
+  const auto modified_table = table_a();
+  EXPECT_EQ(modified_table->row_count(), 4);
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), modified_table);
+}
+
+TEST_F(WriteAheadLogTest, RecoverFromCheckpointAndLog) {
+  execute("INSERT INTO table_a VALUES (4, 'four')");
+  Hyrise::get().write_ahead_log->checkpoint();
+  EXPECT_EQ(directory_contents(), std::vector<std::string>({"checkpoint_2", "log_2.wal"}));
+
+  execute("DELETE FROM table_a WHERE a < 3");
+  const auto expected_table = table_a();
+  EXPECT_EQ(expected_table->row_count(), 2);
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, TornEntryIsIgnored) {
+  execute("INSERT INTO table_a VALUES (4, 'four')");
+  const auto expected_table = table_a();
+  Hyrise::get().write_ahead_log->flush();
+
+  // Simulate an entry whose write was interrupted by the crash
+  {
+    auto log_file = std::ofstream{directory / "log_1.wal", std::ios::binary | std::ios::app};
+    const auto torn_entry = std::string{"\x40\x00\x00\x00\x05\x00\x00\x00garbage", 15};
+    log_file << torn_entry;
+  }
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(table_a(), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, TransactionsWithoutChangesAreNotLogged) {
+  execute("DELETE FROM table_a WHERE a > 100");
+  Hyrise::get().write_ahead_log->flush();
+  EXPECT_EQ(std::filesystem::file_size(directory / "log_1.wal"), 0);
+}
+
+}  // namespace opossum
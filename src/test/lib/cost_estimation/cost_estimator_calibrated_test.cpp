@@ -0,0 +1,129 @@
+#include <memory>
+#include <random>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "cost_estimation/cost_model_calibration.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostEstimatorCalibratedTest : public BaseTest {
+ public:
+  void SetUp() override {
+    node_a = create_mock_node_with_statistics({{DataType::Int, "a"}}, 100,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 100, 10)});
+    node_b = create_mock_node_with_statistics({{DataType::Int, "b"}}, 1000,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 1000, 100)});
+    a = node_a->get_column("a");
+    b = node_b->get_column("b");
+  }
+
+  CostEstimatorCalibrated cost_estimator(const CostModelCoefficients& coefficients) const {
+    return CostEstimatorCalibrated{std::make_shared<CardinalityEstimator>(),
+                                   std::make_shared<const CostModelCoefficients>(coefficients)};
+  }
+
+  static CostModelCoefficients::Coefficients constant(const double runtime_ns) {
+    return {runtime_ns, 0.0, 0.0, 0.0, 0.0, 0.0};
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(CostEstimatorCalibratedTest, TrainRecoversLinearRuntimes) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), node_a, node_b);
+
+  auto calibration = CostModelCalibration{};
+  auto random_engine = std::mt19937{42};
+  auto row_count_distribution = std::uniform_real_distribution<double>{1.0, 10'000.0};
+  for (auto sample_id = 0; sample_id < 50; ++sample_id) {
+    const auto features = cost_model_features(row_count_distribution(random_engine),
+                                              row_count_distribution(random_engine),
+                                              row_count_distribution(random_engine));
+    const auto runtime = 1000.0 + 2.0 * features[1] + 5.0 * features[2] + 3.0 * features[3];
+    calibration.add_sample(*join_node, OperatorType::JoinHash, features,
+                           std::chrono::nanoseconds{static_cast<int64_t>(runtime)});
+  }
+  EXPECT_EQ(calibration.sample_count(), 50);
+
+  const auto coefficients = calibration.train();
+  const auto join_hash_coefficients = coefficients.get(CostModelKey{OperatorType::JoinHash});
+  ASSERT_TRUE(join_hash_coefficients);
+  EXPECT_NEAR((*join_hash_coefficients)[0], 1000.0, 5.0);
+  EXPECT_NEAR((*join_hash_coefficients)[1], 2.0, 0.01);
+  EXPECT_NEAR((*join_hash_coefficients)[2], 5.0, 0.01);
+  EXPECT_NEAR((*join_hash_coefficients)[3], 3.0, 0.01);
+  EXPECT_NEAR((*join_hash_coefficients)[4], 0.0, 0.01);
+  EXPECT_NEAR((*join_hash_coefficients)[5], 0.0, 0.01);
+
+  // Too few samples to calibrate the other join implementations
+  EXPECT_FALSE(coefficients.get(CostModelKey{OperatorType::JoinSortMerge}));
+}
+
+TEST_F(CostEstimatorCalibratedTest, JsonRoundTrip) {
+  auto coefficients = CostModelCoefficients{};
+  coefficients.fallback_nanoseconds_per_row = 3.5;
+  coefficients.set(CostModelKey{OperatorType::JoinHash}, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+  coefficients.set(CostModelKey{OperatorType::TableScan, EncodingType::Dictionary,
+                                SegmentAccessCounter::AccessType::Sequential},
+                   constant(7.0));
+
+  const auto loaded_coefficients = CostModelCoefficients::from_json(coefficients.to_json());
+  EXPECT_EQ(loaded_coefficients.fallback_nanoseconds_per_row, 3.5);
+  EXPECT_EQ(loaded_coefficients.get(CostModelKey{OperatorType::JoinHash}),
+            CostModelCoefficients::Coefficients({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(loaded_coefficients.get(CostModelKey{OperatorType::TableScan, EncodingType::Dictionary,
+                                                 SegmentAccessCounter::AccessType::Sequential}),
+            constant(7.0));
+
+  // Neither the operator type alone nor other encodings are calibrated
+  EXPECT_FALSE(loaded_coefficients.get(CostModelKey{OperatorType::TableScan}));
+  EXPECT_FALSE(loaded_coefficients.get(CostModelKey{OperatorType::TableScan, EncodingType::LZ4,
+                                                    SegmentAccessCounter::AccessType::Sequential}));
+}
+
+TEST_F(CostEstimatorCalibratedTest, CheapestJoinOperator) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), node_a, node_b);
+
+  auto coefficients = CostModelCoefficients{};
+  coefficients.set(CostModelKey{OperatorType::JoinHash}, constant(1000.0));
+  coefficients.set(CostModelKey{OperatorType::JoinSortMerge}, constant(10.0));
+  EXPECT_EQ(cost_estimator(coefficients).cheapest_join_operator(join_node), OperatorType::JoinSortMerge);
+  EXPECT_EQ(cost_estimator(coefficients).estimate_node_cost(join_node), 10.0f);
+
+  // Only calibrated join implementations that support the join are candidates
+  coefficients.set(CostModelKey{OperatorType::JoinNestedLoop}, constant(1.0));
+  const auto theta_join_node = JoinNode::make(JoinMode::Inner, less_than_(a, b), node_a, node_b);
+  EXPECT_EQ(cost_estimator(coefficients).cheapest_join_operator(join_node), OperatorType::JoinNestedLoop);
+  EXPECT_EQ(cost_estimator(coefficients).cheapest_join_operator(theta_join_node), OperatorType::JoinNestedLoop);
+
+  EXPECT_FALSE(cost_estimator(CostModelCoefficients{}).cheapest_join_operator(join_node));
+}
+
+TEST_F(CostEstimatorCalibratedTest, FallbackToLogicalCost) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 50), node_a);
+
+  auto coefficients = CostModelCoefficients{};
+  coefficients.fallback_nanoseconds_per_row = 2.0;
+
+  const auto logical_cost = CostEstimatorLogical{std::make_shared<CardinalityEstimator>()}.estimate_node_cost(
+      predicate_node);
+  EXPECT_FLOAT_EQ(cost_estimator(coefficients).estimate_node_cost(predicate_node), logical_cost * 2.0f);
+
+  // The coefficients of the operator type alone are used for the unknown encoding of the mock node
+  coefficients.set(CostModelKey{OperatorType::TableScan}, {0.0, 1.0, 0.0, 0.0, 0.0, 0.0});
+  EXPECT_FLOAT_EQ(cost_estimator(coefficients).estimate_node_cost(predicate_node), 100.0f);
+}
+
+}  // namespace opossum
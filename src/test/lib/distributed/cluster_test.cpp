@@ -0,0 +1,112 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "distributed/cluster.hpp"
+#include "distributed/shard_fragment.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class ClusterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, true);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, 10});
+    table->append({2, 20});
+    table->append({3, 10});
+    table->append({4, NULL_VALUE});
+    Hyrise::get().storage_manager.add_table("sharded", table);
+
+    // Both nodes run in this process and share the StorageManager, so that the shard of each node is the entire table
+    const auto nodes = std::vector<ClusterNode>{{"127.0.0.1", 24190}, {"127.0.0.1", 24191}};
+    Hyrise::get().cluster = std::make_shared<Cluster>(nodes, NodeID{0});
+    Hyrise::get().cluster->add_sharded_table("sharded", ColumnID{0});
+    remote_node = std::make_shared<Cluster>(nodes, NodeID{1});
+    remote_node->add_sharded_table("sharded", ColumnID{0});
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  std::shared_ptr<Cluster> remote_node;
+};
+
+TEST_F(ClusterTest, SerializeFragment) {
+  auto fragment = ShardFragment{};
+  fragment.table_name = "sharded";
+  fragment.pruned_column_ids = {ColumnID{2}};
+  fragment.predicates.push_back({ColumnID{0}, PredicateCondition::GreaterThan, int32_t{2}, std::nullopt});
+  fragment.predicates.push_back(
+      {ColumnID{1}, PredicateCondition::BetweenInclusive, pmr_string{"a"}, AllTypeVariant{NULL_VALUE}});
+  fragment.group_by_column_ids = {ColumnID{1}};
+  fragment.aggregates.push_back({AggregateFunction::Count, std::nullopt});
+  fragment.aggregates.push_back({AggregateFunction::Max, ColumnID{0}});
+
+  const auto data = fragment.serialize();
+  const auto deserialized_fragment = ShardFragment::deserialize({data.data(), data.size()});
+  EXPECT_EQ(deserialized_fragment.table_name, "sharded");
+  EXPECT_EQ(deserialized_fragment.pruned_column_ids, fragment.pruned_column_ids);
+  ASSERT_EQ(deserialized_fragment.predicates.size(), 2);
+  EXPECT_EQ(deserialized_fragment.predicates[0].predicate_condition, PredicateCondition::GreaterThan);
+  EXPECT_EQ(deserialized_fragment.predicates[0].value, AllTypeVariant{int32_t{2}});
+  EXPECT_FALSE(deserialized_fragment.predicates[0].value2);
+  EXPECT_EQ(deserialized_fragment.predicates[1].column_id, ColumnID{1});
+  EXPECT_EQ(deserialized_fragment.predicates[1].value, AllTypeVariant{pmr_string{"a"}});
+  ASSERT_TRUE(deserialized_fragment.predicates[1].value2);
+  EXPECT_TRUE(variant_is_null(*deserialized_fragment.predicates[1].value2));
+  EXPECT_EQ(deserialized_fragment.group_by_column_ids, fragment.group_by_column_ids);
+  ASSERT_EQ(deserialized_fragment.aggregates.size(), 2);
+  EXPECT_FALSE(deserialized_fragment.aggregates[0].column_id);
+  EXPECT_EQ(deserialized_fragment.aggregates[1].aggregate_function, AggregateFunction::Max);
+  EXPECT_EQ(deserialized_fragment.aggregates[1].column_id, ColumnID{0});
+}
+
+TEST_F(ClusterTest, GatherShards) {
+  // Each row is returned by both nodes
+  const auto table = execute("SELECT a FROM sharded WHERE a > 2 AND b IS NULL");
+  ASSERT_EQ(table->row_count(), 2);
+  EXPECT_EQ(table->get_rows()[0][0], AllTypeVariant{int32_t{4}});
+  EXPECT_EQ(table->get_rows()[1][0], AllTypeVariant{int32_t{4}});
+
+  const auto joined_table = execute("SELECT * FROM sharded s1, sharded s2 WHERE s1.a = s2.a AND s1.a = 1");
+  EXPECT_EQ(joined_table->row_count(), 4);
+}
+
+TEST_F(ClusterTest, AggregateShards) {
+  const auto count_table = execute("SELECT COUNT(*) FROM sharded");
+  EXPECT_EQ(count_table->column_name(ColumnID{0}), "COUNT(*)");
+  EXPECT_EQ(count_table->get_rows(), (std::vector<std::vector<AllTypeVariant>>{{int64_t{8}}}));
+
+  const auto grouped_table =
+      execute("SELECT b, SUM(a), MIN(a), COUNT(b) FROM sharded WHERE a < 4 GROUP BY b ORDER BY b");
+  const auto expected_rows = std::vector<std::vector<AllTypeVariant>>{
+      {int32_t{10}, int64_t{8}, int32_t{1}, int64_t{4}}, {int32_t{20}, int64_t{4}, int32_t{2}, int64_t{2}}};
+  EXPECT_EQ(grouped_table->get_rows(), expected_rows);
+}
+
+TEST_F(ClusterTest, ShuffleInsertedRows) {
+  execute("INSERT INTO sharded VALUES (5, 50), (6, 60), (7, 70), (8, 80)");
+
+  // Each row is inserted once, either by this node or by the remote node
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("sharded")->row_count(), 8);
+  const auto table = execute("SELECT COUNT(*) FROM sharded WHERE a > 4");
+  EXPECT_EQ(table->get_rows(), (std::vector<std::vector<AllTypeVariant>>{{int64_t{8}}}));
+}
+
+TEST_F(ClusterTest, RejectDelete) {
+  auto pipeline = SQLPipelineBuilder{std::string{"DELETE FROM sharded WHERE a = 1"}}.create_pipeline();
+  EXPECT_THROW(pipeline.get_result_table(), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,184 @@
+#include <optional>
+
+#include "base_test.hpp"
+
+#include "expression/evaluation/compiled_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "memory/tracking_memory_resource.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CompiledExpressionTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table_a = load_table("resources/test_data/tbl/expression_evaluator/input_a.tbl");
+    a = PQPColumnExpression::from_table(*table_a, "a");
+    b = PQPColumnExpression::from_table(*table_a, "b");
+    c = PQPColumnExpression::from_table(*table_a, "c");
+    e = PQPColumnExpression::from_table(*table_a, "e");
+    f = PQPColumnExpression::from_table(*table_a, "f");
+    s1 = PQPColumnExpression::from_table(*table_a, "s1");
+    s2 = PQPColumnExpression::from_table(*table_a, "s2");
+  }
+
+  template <typename R>
+  std::vector<std::optional<R>> evaluate(const std::shared_ptr<Table>& table,
+                                         const std::shared_ptr<AbstractExpression>& expression) {
+    EXPECT_TRUE(CompiledExpression::compile(*expression));
+
+    const auto result = ExpressionEvaluator{table, ChunkID{0}}.evaluate_expression_to_result<R>(*expression);
+    auto normalized = std::vector<std::optional<R>>(result->size());
+    result->as_view([&](const auto& view) {
+      for (auto row_id = size_t{0}; row_id < result->size(); ++row_id) {
+        if (!view.is_null(row_id)) normalized[row_id] = view.value(row_id);
+      }
+    });
+    return normalized;
+  }
+
+  std::shared_ptr<Table> table_a;
+  std::shared_ptr<PQPColumnExpression> a, b, c, e, f, s1, s2;
+};
+
+TEST_F(CompiledExpressionTest, Arithmetic) {
+  const auto expected = std::vector<std::optional<int32_t>>{99, std::nullopt, 238, std::nullopt};
+  EXPECT_EQ(evaluate<int32_t>(table_a, mul_(add_(a, b), c)), expected);
+}
+
+TEST_F(CompiledExpressionTest, ArithmeticWithMixedTypes) {
+  // As in the ExpressionEvaluator, each node is computed in the common type of its operands
+  const auto expected = std::vector<std::optional<double>>{
+      static_cast<double>(1 + 20.5f) * 99.5, static_cast<double>(2 + 100.0f) * 2.2,
+      static_cast<double>(3 + 42.8f) * 13.8, static_cast<double>(4 + -14.0f) * 15.9};
+  EXPECT_EQ(evaluate<double>(table_a, mul_(add_(a, e), f)), expected);
+}
+
+TEST_F(CompiledExpressionTest, DivisionByZero) {
+  const auto expected = std::vector<std::optional<int32_t>>{std::nullopt, 1, 1, 1};
+  EXPECT_EQ(evaluate<int32_t>(table_a, div_(sub_(a, 1), sub_(b, 2))), expected);
+
+  const auto expected_modulo = std::vector<std::optional<int32_t>>{std::nullopt, 0, 1, 1};
+  EXPECT_EQ(evaluate<int32_t>(table_a, mod_(sub_(b, 1), sub_(a, 1))), expected_modulo);
+}
+
+TEST_F(CompiledExpressionTest, ComparisonsAndTernaryLogic) {
+  const auto expression = and_(greater_than_(c, 33), less_than_(add_(a, b), 9));
+
+  const auto expected = std::vector<std::optional<int32_t>>{0, std::nullopt, 1, 0};
+  EXPECT_EQ(evaluate<int32_t>(table_a, expression), expected);
+
+  const auto pos_list = ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_pos_list(*expression);
+  const auto expected_pos_list = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{2}}};
+  EXPECT_EQ(pos_list, expected_pos_list);
+}
+
+TEST_F(CompiledExpressionTest, NonFusableInputs) {
+  // String comparisons are evaluated by the ExpressionEvaluator and become inputs of the compiled expression
+  const auto expression = or_(equals_(s1, s2), greater_than_(add_(a, b), 6));
+  const auto compiled_expression = CompiledExpression::compile(*expression);
+  ASSERT_TRUE(compiled_expression);
+  EXPECT_EQ(compiled_expression->inputs().size(), 4u);
+
+  const auto expected = std::vector<std::optional<int32_t>>{0, 0, 1, 1};
+  EXPECT_EQ(evaluate<int32_t>(table_a, expression), expected);
+}
+
+TEST_F(CompiledExpressionTest, SharedSubexpressions) {
+  const auto expression = mul_(add_(a, 3), add_(a, 3));
+  const auto compiled_expression = CompiledExpression::compile(*expression);
+  ASSERT_TRUE(compiled_expression);
+  EXPECT_EQ(compiled_expression->inputs().size(), 2u);
+
+  const auto expected = std::vector<std::optional<int32_t>>{16, 25, 36, 49};
+  EXPECT_EQ(evaluate<int32_t>(table_a, expression), expected);
+}
+
+TEST_F(CompiledExpressionTest, PrecomputedSubexpressions) {
+  // `a + b` is shared with another expression and becomes an input, `(a + b) * c` is the root and is still compiled
+  const auto expression = sub_(mul_(add_(a, b), c), add_(a, b));
+  const auto precomputed_subexpressions = ExpressionUnorderedSet{add_(a, b), expression};
+  const auto compiled_expression = CompiledExpression::compile(*expression, precomputed_subexpressions);
+  ASSERT_TRUE(compiled_expression);
+  EXPECT_EQ(compiled_expression->inputs().size(), 2u);
+  EXPECT_NE(CompiledExpression::compile(*expression), compiled_expression);
+
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}};
+  evaluator.set_common_subexpressions(std::make_shared<ExpressionUnorderedSet>(precomputed_subexpressions));
+  const auto result = evaluator.evaluate_expression_to_result<int32_t>(*expression);
+  EXPECT_EQ(result->value(0), 3 * 33 - 3);
+  EXPECT_TRUE(result->is_null(1));
+}
+
+TEST_F(CompiledExpressionTest, FindCommonSubexpressions) {
+  const auto discounted = mul_(e, sub_(1, f));
+  const auto common_subexpressions = ExpressionEvaluator::find_common_subexpressions(
+      expression_vector(discounted, mul_(discounted, add_(1, c)), add_(sub_(1, f), a), a, add_(a, b)));
+
+  // `1 - f` also occurs outside of `e * (1 - f)`, `a` is a column
+  EXPECT_EQ(common_subexpressions->size(), 2u);
+  EXPECT_TRUE(common_subexpressions->contains(discounted));
+  EXPECT_TRUE(common_subexpressions->contains(sub_(1, f)));
+}
+
+TEST_F(CompiledExpressionTest, MultipleBlocks) {
+  const auto row_count = 2 * CompiledExpression::BLOCK_SIZE + 17;
+  auto values = pmr_vector<int32_t>(row_count);
+  auto nulls = pmr_vector<bool>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    values[row_id] = static_cast<int32_t>(row_id);
+    nulls[row_id] = row_id % 7 == 0;
+  }
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(nulls))});
+  const auto x = PQPColumnExpression::from_table(*table, "x");
+
+  auto expected = std::vector<std::optional<int32_t>>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    const auto value = static_cast<int32_t>(row_id);
+    if (row_id % 7 != 0 && value % 3 != 0) expected[row_id] = (value * 2 + 1) / (value % 3);
+  }
+  EXPECT_EQ(evaluate<int32_t>(table, div_(add_(mul_(x, 2), 1), mod_(x, 3))), expected);
+}
+
+TEST_F(CompiledExpressionTest, AllocatesResultWithGivenAllocator) {
+  const auto compiled_expression = CompiledExpression::compile(*mul_(add_(a, b), c));
+  ASSERT_TRUE(compiled_expression);
+
+  auto input_results = std::vector<std::shared_ptr<BaseExpressionResult>>{};
+  for (const auto& input : compiled_expression->inputs()) {
+    ASSERT_EQ(input->data_type(), DataType::Int);
+    input_results.emplace_back(ExpressionEvaluator{table_a, ChunkID{0}}.evaluate_expression_to_result<int32_t>(*input));
+  }
+
+  auto memory_resource = TrackingMemoryResource{};
+  const auto result = std::static_pointer_cast<ExpressionResult<int32_t>>(
+      compiled_expression->evaluate(input_results, PolymorphicAllocator<size_t>{&memory_resource}));
+  EXPECT_GT(memory_resource.allocated_bytes(), 0u);
+  EXPECT_EQ(result->value(0), 99);
+  EXPECT_TRUE(result->is_null(1));
+  EXPECT_EQ(result->value(2), 238);
+}
+
+TEST_F(CompiledExpressionTest, OnlyTreesAreCompiled) {
+  EXPECT_FALSE(CompiledExpression::compile(*add_(a, b)));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(add_(a, b), NullValue{})));
+  EXPECT_FALSE(CompiledExpression::compile(*and_(equals_(s1, s2), equals_(s1, "a"))));
+  EXPECT_FALSE(CompiledExpression::compile(*a));
+}
+
+TEST_F(CompiledExpressionTest, CachesPrograms) {
+  const auto compiled_expression = CompiledExpression::compile(*mul_(add_(a, b), c));
+  ASSERT_TRUE(compiled_expression);
+  EXPECT_EQ(CompiledExpression::compile(*mul_(add_(a, b), c)), compiled_expression);
+  EXPECT_NE(CompiledExpression::compile(*mul_(add_(a, b), 2)), compiled_expression);
+}
+
+}  // namespace opossum
@@ -55,6 +55,22 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPattern) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GeneralPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("H_llo%W%ld")));
+
+  EXPECT_TRUE(match("Hello World", "H_llo%W%ld"));
+  EXPECT_TRUE(match("Hello Wld", "H_llo%W%ld"));
+  EXPECT_TRUE(match("abcbcd", "a%bc_%d"));
+  EXPECT_TRUE(match("aXbXcXb", "%b_c%b"));
+  EXPECT_TRUE(match("Line\nbreak", "Line_break"));
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_FALSE(match("Hello World", "H_llo%X%ld"));
+  EXPECT_FALSE(match("Hello Wd", "H_llo%W%ld"));
+  EXPECT_FALSE(match("abc", "a%bc_"));
+  EXPECT_FALSE(match("ab", "a_b"));
+}
+
 TEST_F(LikeMatcherTest, LowerUpperBound) {
   const auto pattern = pmr_string("Japan%");
   const auto bounds = LikeMatcher::bounds(pattern);
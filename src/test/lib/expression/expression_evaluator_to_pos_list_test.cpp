@@ -161,6 +161,14 @@ TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithNulls) {
   EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), equals_(c, 33)), {0, 1, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithExpensiveOperand) {
+  // LIKEs are only evaluated for the rows that the other operand leaves undecided
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(like_(s1, "%a%"), is_not_null_(c)), {0, 2}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(s3), like_(s1, "%H%")), {0, 1, 3}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), and_(is_not_null_(s3), like_(s3, "%z%"))),
+                              {1, 2, 3}));
+}
+
 TEST_F(ExpressionEvaluatorToPosListTest, ExistsCorrelated) {
   const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
   const auto table_scan =
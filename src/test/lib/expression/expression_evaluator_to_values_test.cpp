@@ -17,10 +17,13 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "operators/get_table.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
@@ -241,6 +244,32 @@ TEST_F(ExpressionEvaluatorToValuesTest, ExpressionReuse) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ResultsAllocatedFromEvaluatorMemoryResource) {
+  // The results and the intermediate results they are computed from are allocated from the evaluator's memory
+  // resource, which is backed by the given upstream resource. The returned results keep it alive.
+  const auto memory_resource = std::make_shared<TrackingMemoryResource>();
+  auto sum = std::shared_ptr<ExpressionResult<int32_t>>{};
+  auto substrings = std::shared_ptr<ExpressionResult<pmr_string>>{};
+  {
+    auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}, nullptr, nullptr, memory_resource};
+    sum = evaluator.evaluate_expression_to_result<int32_t>(*add_(a, add_(b, c)));
+    substrings = evaluator.evaluate_expression_to_result<pmr_string>(*concat_(substr_(s1, 2, 3), s2));
+    EXPECT_GT(memory_resource->allocated_bytes(), 0u);
+  }
+
+  EXPECT_GT(memory_resource->allocated_bytes(), 0u);
+  EXPECT_EQ(normalize_expression_result(*sum),
+            (std::vector<std::optional<int32_t>>{36, std::nullopt, 41, std::nullopt}));
+  EXPECT_EQ(normalize_expression_result(*substrings),
+            (std::vector<std::optional<pmr_string>>{"b", "ellWorld", "hatup", "ameSame"}));
+
+  // The memory is returned once the last result is released
+  sum.reset();
+  EXPECT_GT(memory_resource->allocated_bytes(), 0u);
+  substrings.reset();
+  EXPECT_EQ(memory_resource->allocated_bytes(), 0u);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, PredicatesLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*greater_than_(5, 3.3), {1}));
   EXPECT_TRUE(test_expression<int32_t>(*greater_than_(5, 5.0), {0}));
@@ -372,6 +401,25 @@ TEST_F(ExpressionEvaluatorToValuesTest, CaseSeries) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, LazyLogicalAndCase) {
+  // Expensive operands and branches are only evaluated for the rows that need them. Their columns are gathered for
+  // these rows, so encoded tables are covered as well.
+  const auto encoded_table_a = load_table("resources/test_data/tbl/expression_evaluator/input_a.tbl");
+  ChunkEncoder::encode_all_chunks(encoded_table_a, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  for (const auto& table : {table_a, encoded_table_a}) {
+    // clang-format off
+    EXPECT_TRUE(test_expression<int32_t>(table, *and_(greater_than_(a, 2), like_(s1, "%a%")), {0, 0, 1, 1}));
+    EXPECT_TRUE(test_expression<int32_t>(table, *and_(like_(s3, "%a%"), less_than_(a, 3)), {std::nullopt, 1, 0, 0}));
+    EXPECT_TRUE(test_expression<int32_t>(table, *or_(greater_than_(c, 33), like_(s3, "%a%")), {std::nullopt, 1, 1, std::nullopt}));  // NOLINT
+    EXPECT_TRUE(test_expression<int32_t>(table, *or_(less_than_(a, 5), like_(s3, "%a%")), {1, 1, 1, 1}));
+    EXPECT_TRUE(test_expression<int32_t>(table, *case_(greater_than_(a, 2), like_(s1, "%a%"), like_(s3, "%a%")), {std::nullopt, 1, 1, 1}));  // NOLINT
+    EXPECT_TRUE(test_expression<pmr_string>(table, *case_(equals_(a, 1), "one", case_(is_null_(s3), substr_(s1, 1, 2), s3)), {"one", "abcd", "xyzlol", "Sa"}));  // NOLINT
+    EXPECT_TRUE(test_expression<int32_t>(table, *and_(greater_than_(a, 1), or_(less_than_(a, 4), like_(s1, "%x%"))), {0, 1, 1, 0}));  // NOLINT
+    // clang-format on
+  }
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, IsNullLiteral) {
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(0), {0}));
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(1), {0}));
@@ -693,6 +741,31 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelated) {
                                        {std::nullopt, std::nullopt, std::nullopt, std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CorrelatedSubqueryMemoization) {
+  // PQP that returns the column "a" added to the current value in "c" (33, NULL, 34, NULL)
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
+  const auto add_c = add_(correlated_parameter_(ParameterID{0}, c), PQPColumnExpression::from_table(*table_a, "a"));
+  const auto pqp = std::make_shared<Projection>(table_wrapper, expression_vector(add_c));
+  const auto subquery = pqp_subquery_(pqp, DataType::Int, true, std::make_pair(ParameterID{0}, ColumnID{2}));
+
+  const auto correlated_subquery_results = std::make_shared<ExpressionEvaluator::CorrelatedSubqueryResults>();
+  const auto result = ExpressionEvaluator{table_a, ChunkID{0}, nullptr, correlated_subquery_results}
+                          .evaluate_expression_to_result<int32_t>(*in_(35, subquery));
+  const auto expected = std::vector<std::optional<int32_t>>{1, std::nullopt, 1, std::nullopt};
+  EXPECT_EQ(normalize_expression_result(*result), expected);
+
+  // The subquery was executed once per distinct parameter value, including NULL
+  const auto null_parameter = std::vector<AllTypeVariant>{NullValue{}};
+  const auto null_result = correlated_subquery_results->get(pqp, null_parameter);
+  ASSERT_TRUE(null_result);
+  EXPECT_EQ(null_result->row_count(), 4u);
+
+  const auto parameter_33 = std::vector<AllTypeVariant>{int32_t{33}};
+  const auto parameter_35 = std::vector<AllTypeVariant>{int32_t{35}};
+  EXPECT_TRUE(correlated_subquery_results->get(pqp, parameter_33));
+  EXPECT_FALSE(correlated_subquery_results->get(pqp, parameter_35));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, NotInListLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_())), {std::nullopt}));
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_(), 3)), {std::nullopt}));
@@ -772,6 +845,27 @@ TEST_F(ExpressionEvaluatorToValuesTest, ExtractLiterals) {
   EXPECT_EQ(extract_(DatetimeComponent::Year, "1993-08-01")->data_type(), DataType::String);
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ExtractIntegerDatetimes) {
+  // 1992-09-30 as a DATE (days since 1970-01-01) and 1992-09-30 13:14:15 as a TIMESTAMP (seconds since 1970-01-01)
+  const auto date = value_(int32_t{8308});
+  const auto timestamp = value_(int64_t{8308} * 86'400 + 13 * 3600 + 14 * 60 + 15);
+
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Year, date), {1992}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Month, date), {9}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, date), {30}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, date), {0}));
+
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, timestamp), {30}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, timestamp), {13}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Minute, timestamp), {14}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Second, timestamp), {15}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *extract_(DatetimeComponent::Year, a), {1970, 1970, 1970, 1970}));
+
+  EXPECT_EQ(extract_(DatetimeComponent::Year, date)->data_type(), DataType::Int);
+  EXPECT_EQ(extract_(DatetimeComponent::Year, timestamp)->data_type(), DataType::Int);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, ExtractSeries) {
   EXPECT_TRUE(test_expression<pmr_string>(table_a, *extract_(DatetimeComponent::Year, dates),
                                           {"2017", "2014", "2011", "2010"}));
@@ -808,4 +902,37 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastSeries) {
       test_expression<pmr_string>(table_a, *cast_(c, DataType::String), {"33", std::nullopt, "34", std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, FunctionsOnDictionarySegment) {
+  // Functions of a dictionary-encoded column are evaluated once per dictionary entry
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String, true}}, TableType::Data, ChunkOffset{6});
+  for (const auto& value : std::vector<AllTypeVariant>{"apple", "pear", NullValue{}, "apple", "pear", "7"}) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto s = PQPColumnExpression::from_table(*table, "s");
+
+  EXPECT_TRUE(test_expression<pmr_string>(table, *substr_(s, 1, 2), {"ap", "pe", std::nullopt, "ap", "pe", "7"}));
+  EXPECT_TRUE(test_expression<pmr_string>(table, *concat_(substr_(s, 2, 1), "!"),
+                                          {"p!", "e!", std::nullopt, "p!", "e!", "!"}));
+  EXPECT_TRUE(test_expression<int32_t>(table, *cast_(s, DataType::Int), {0, 0, std::nullopt, 0, 0, 7}));
+  EXPECT_TRUE(test_expression<pmr_string>(table, *concat_(s, null_()),
+                                          {std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt,
+                                           std::nullopt}));
+
+  // ReferenceSegments that reference a single DictionarySegment are supported as well
+  auto pos_list = std::make_shared<RowIDPosList>();
+  for (const auto chunk_offset : {4, 2, 0, 1, 3, 0}) {
+    pos_list->emplace_back(RowID{ChunkID{0}, static_cast<ChunkOffset>(chunk_offset)});
+  }
+  pos_list->guarantee_single_chunk();
+  const auto reference_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String, true}}, TableType::References);
+  reference_table->append_chunk({std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+
+  EXPECT_TRUE(test_expression<pmr_string>(reference_table, *substr_(s, 1, 3),
+                                          {"pea", std::nullopt, "app", "pea", "app", "app"}));
+}
+
 }  // namespace opossum
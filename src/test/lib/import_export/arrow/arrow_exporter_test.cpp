@@ -0,0 +1,106 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "import_export/arrow/arrow_exporter.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class ArrowExporterTest : public BaseTest {
+ protected:
+  static bool is_valid(const ArrowArray& array, const size_t index) {
+    if (!array.buffers[0]) return true;
+    const auto* const validity = static_cast<const uint8_t*>(array.buffers[0]);
+    return (validity[index / 8] >> (index % 8)) & 1;
+  }
+};
+
+TEST_F(ArrowExporterTest, Schema) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+
+  auto schema = ArrowSchema{};
+  ArrowExporter::export_schema(*table, &schema);
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  ASSERT_EQ(schema.n_children, 2);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema.children[0]->name}, "a");
+  EXPECT_EQ(schema.children[0]->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_EQ(std::string{schema.children[1]->format}, "f");
+
+  schema.release(&schema);
+  EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST_F(ArrowExporterTest, ZeroCopyValueSegments) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+  const auto chunk = table->get_chunk(ChunkID{0});
+  ASSERT_FALSE(chunk->is_mutable());
+
+  auto array = ArrowArray{};
+  ArrowExporter::export_chunk(table, ChunkID{0}, &array);
+  EXPECT_EQ(array.length, 2);
+  ASSERT_EQ(array.n_children, 2);
+
+  // The values are not copied
+  const auto& ints = *array.children[0];
+  const auto& value_segment = static_cast<const ValueSegment<int32_t>&>(*chunk->get_segment(ColumnID{0}));
+  EXPECT_EQ(ints.buffers[1], value_segment.values().data());
+  EXPECT_EQ(ints.null_count, 0);
+
+  const auto& floats = *array.children[1];
+  EXPECT_EQ(floats.null_count, 1);
+  EXPECT_TRUE(is_valid(floats, 0));
+  EXPECT_FALSE(is_valid(floats, 1));
+  EXPECT_FLOAT_EQ(static_cast<const float*>(floats.buffers[1])[0], 458.7f);
+
+  array.release(&array);
+  EXPECT_EQ(array.release, nullptr);
+}
+
+TEST_F(ArrowExporterTest, MaterializeEncodedSegmentsAndStrings) {
+  const auto table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 4, FinalizeLastChunk::No);
+  ChunkEncoder::encode_chunk(table->get_chunk(ChunkID{0}), table->column_data_types(),
+                             SegmentEncodingSpec{EncodingType::Dictionary});
+
+  auto stream = ArrowArrayStream{};
+  ArrowExporter::export_table(table, &stream);
+
+  auto schema = ArrowSchema{};
+  ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+  EXPECT_EQ(schema.n_children, 4);
+  schema.release(&schema);
+
+  auto array = ArrowArray{};
+  ASSERT_EQ(stream.get_next(&stream, &array), 0);
+  ASSERT_NE(array.release, nullptr);
+  EXPECT_EQ(array.length, 4);
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[3], 4);
+
+  const auto& strings = *array.children[3];
+  ASSERT_EQ(strings.n_buffers, 3);
+  const auto* const offsets = static_cast<const int32_t*>(strings.buffers[1]);
+  const auto* const characters = static_cast<const char*>(strings.buffers[2]);
+  EXPECT_EQ(std::string(characters + offsets[1], offsets[2] - offsets[1]), "c");
+  array.release(&array);
+
+  // The second chunk is still mutable and is materialized as well
+  ASSERT_EQ(stream.get_next(&stream, &array), 0);
+  EXPECT_EQ(array.length, 2);
+  EXPECT_EQ(static_cast<const double*>(array.children[2]->buffers[1])[1], 6.0);
+  array.release(&array);
+
+  // A released array marks the end of the stream
+  ASSERT_EQ(stream.get_next(&stream, &array), 0);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(stream.get_last_error(&stream), nullptr);
+
+  stream.release(&stream);
+  EXPECT_EQ(stream.release, nullptr);
+}
+
+}  // namespace opossum
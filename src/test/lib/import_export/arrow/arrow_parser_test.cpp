@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "import_export/arrow/arrow_parser.hpp"
+#include "import_export/arrow/arrow_writer.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class ArrowParserTest : public BaseTest, public ::testing::WithParamInterface<FileType> {
+ protected:
+  void SetUp() override {
+    filename = test_data_path + "arrow_parser_test" + (GetParam() == FileType::Parquet ? ".parquet" : ".arrow");
+    std::remove(filename.c_str());
+  }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  std::string filename;
+};
+
+INSTANTIATE_TEST_SUITE_P(FileTypes, ArrowParserTest, ::testing::Values(FileType::Parquet, FileType::Arrow));
+
+#if HYRISE_ARROW_SUPPORT
+
+TEST_P(ArrowParserTest, WriteAndRead) {
+  const auto expected_table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 2);
+  ArrowWriter::write(*expected_table, filename, GetParam());
+
+  const auto table = ArrowParser::parse(filename, GetParam());
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Each chunk is written as a row group and read back as a chunk
+  EXPECT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+}
+
+TEST_P(ArrowParserTest, NullValues) {
+  const auto expected_table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+  ArrowWriter::write(*expected_table, filename, GetParam());
+
+  EXPECT_TABLE_EQ_ORDERED(ArrowParser::parse(filename, GetParam()), expected_table);
+}
+
+TEST_P(ArrowParserTest, ColumnsAndRowGroups) {
+  ArrowWriter::write(*load_table("resources/test_data/tbl/int_float_double_string.tbl", 2), filename, GetParam());
+
+  const auto table = ArrowParser::parse(filename, GetParam(), Chunk::DEFAULT_SIZE, {"s", "i"}, {2});
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"s", DataType::String, false}, {"i", DataType::Int, false}}, TableType::Data);
+  expected_table->append({pmr_string{"f"}, 5});
+  expected_table->append({pmr_string{"g"}, 6});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Parquet's dictionary pages become DictionarySegments
+  if (GetParam() == FileType::Parquet) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+        table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  }
+
+  EXPECT_THROW(ArrowParser::parse(filename, GetParam(), Chunk::DEFAULT_SIZE, {"x"}), std::exception);
+  EXPECT_THROW(ArrowParser::parse(filename, GetParam(), Chunk::DEFAULT_SIZE, {}, {3}), std::exception);
+}
+
+#else
+
+TEST_P(ArrowParserTest, NotSupported) {
+  const auto table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 2);
+  EXPECT_THROW(ArrowWriter::write(*table, filename, GetParam()), std::exception);
+  EXPECT_THROW(ArrowParser::parse(filename, GetParam()), std::exception);
+}
+
+#endif
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <memory>
 #include <string>
 #include <vector>
@@ -6,6 +7,13 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -422,4 +430,89 @@ TEST_F(BinaryParserTest, SortColumnDefinitions) {
   EXPECT_TRUE(table->get_chunk(ChunkID{2})->individually_sorted_by().empty());
 }
 
+TEST_F(BinaryParserTest, ParallelImport) {
+  // The writer and the parser process the chunks in parallel tasks, which must keep the order of the chunks
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data, 3);
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    expected_table->append({value, value % 7 == 0 ? NULL_VALUE : AllTypeVariant{pmr_string(value, 'x')}});
+  }
+  expected_table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(expected_table, {ChunkID{1}, ChunkID{5}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto filename = test_data_path + "parallel_import.bin";
+  BinaryWriter::write(*expected_table, filename);
+  const auto table = BinaryParser::parse(filename);
+  std::remove(filename.c_str());
+
+  EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(BinaryParserTest, PersistedStatistics) {
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data, 10);
+  for (auto value = int32_t{0}; value < 35; ++value) {
+    expected_table->append({value, value % 5 == 0 ? NULL_VALUE : AllTypeVariant{pmr_string(1 + value % 3, 'x')}});
+  }
+  expected_table->last_chunk()->finalize();
+  generate_chunk_pruning_statistics(expected_table);
+  expected_table->set_table_statistics(TableStatistics::from_table(*expected_table));
+
+  const auto filename = test_data_path + "persisted_statistics.bin";
+  BinaryWriter::write(*expected_table, filename);
+  const auto table = BinaryParser::parse(filename);
+  std::remove(filename.c_str());
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // The pruning statistics of the chunks are restored
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& expected_pruning_statistics = *expected_table->get_chunk(chunk_id)->pruning_statistics();
+    const auto& pruning_statistics = table->get_chunk(chunk_id)->pruning_statistics();
+    ASSERT_TRUE(pruning_statistics);
+
+    const auto& expected_int_statistics =
+        static_cast<const AttributeStatistics<int32_t>&>(*expected_pruning_statistics[ColumnID{0}]);
+    const auto& int_statistics = static_cast<const AttributeStatistics<int32_t>&>(*(*pruning_statistics)[ColumnID{0}]);
+    ASSERT_TRUE(int_statistics.range_filter);
+    EXPECT_EQ(int_statistics.range_filter->ranges, expected_int_statistics.range_filter->ranges);
+    ASSERT_TRUE(int_statistics.distinct_count_sketch);
+    EXPECT_EQ(int_statistics.distinct_count_sketch->registers(),
+              expected_int_statistics.distinct_count_sketch->registers());
+
+    const auto& expected_string_statistics =
+        static_cast<const AttributeStatistics<pmr_string>&>(*expected_pruning_statistics[ColumnID{1}]);
+    const auto& string_statistics =
+        static_cast<const AttributeStatistics<pmr_string>&>(*(*pruning_statistics)[ColumnID{1}]);
+    ASSERT_TRUE(string_statistics.min_max_filter);
+    EXPECT_EQ(string_statistics.min_max_filter->min, expected_string_statistics.min_max_filter->min);
+    EXPECT_EQ(string_statistics.min_max_filter->max, expected_string_statistics.min_max_filter->max);
+  }
+
+  // The table statistics are restored and are not recreated when the table is added to the StorageManager
+  const auto& expected_table_statistics = *expected_table->table_statistics();
+  const auto table_statistics = table->table_statistics();
+  ASSERT_TRUE(table_statistics);
+  EXPECT_EQ(table_statistics->row_count, expected_table_statistics.row_count);
+  EXPECT_EQ(table_statistics->represented_chunk_sizes, expected_table_statistics.represented_chunk_sizes);
+
+  const auto& expected_column_statistics =
+      static_cast<const AttributeStatistics<pmr_string>&>(*expected_table_statistics.column_statistics[ColumnID{1}]);
+  const auto& column_statistics =
+      static_cast<const AttributeStatistics<pmr_string>&>(*table_statistics->column_statistics[ColumnID{1}]);
+  ASSERT_TRUE(column_statistics.histogram);
+  EXPECT_EQ(column_statistics.histogram->bin_count(), expected_column_statistics.histogram->bin_count());
+  EXPECT_EQ(column_statistics.histogram->total_count(), expected_column_statistics.histogram->total_count());
+  EXPECT_EQ(column_statistics.histogram->bin_maximum(BinID{0}),
+            expected_column_statistics.histogram->bin_maximum(BinID{0}));
+  ASSERT_TRUE(column_statistics.null_value_ratio);
+  EXPECT_FLOAT_EQ(column_statistics.null_value_ratio->ratio, expected_column_statistics.null_value_ratio->ratio);
+
+  Hyrise::get().storage_manager.add_table("persisted_statistics", table);
+  EXPECT_EQ(table->table_statistics(), table_statistics);
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -7,6 +8,7 @@
 
 #include "base_test.hpp"
 
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -299,6 +301,39 @@ TEST_F(BinaryWriterTest, SortColumnDefinitions) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(BinaryWriterTest, BitPackedDictionaryRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::String, false);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = 0; value < 250; ++value) {
+    table->append({value % 37, pmr_string{std::to_string(value % 5)}});
+  }
+  table->last_chunk()->finalize();
+
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+  BinaryWriter::write(*table, filename);
+
+  const auto imported_table = BinaryParser::parse(filename);
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  const auto segment = imported_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(dictionary_segment->compressed_vector_type(), CompressedVectorType::BitPacking);
+}
+
+TEST_F(BinaryWriterTest, TruncatedFileIsRejected) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data, 10);
+  for (auto value = 0; value < 25; ++value) {
+    table->append({pmr_string{"value" + std::to_string(value)}});
+  }
+  BinaryWriter::write(*table, filename);
+
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 3);
+  EXPECT_THROW(BinaryParser::parse(filename), std::logic_error);
+}
+
 // TEST_P for all supported encoding types
 
 TEST_P(BinaryWriterMultiEncodingTest, RepeatedInt) {
@@ -9,7 +9,12 @@
 
 namespace opossum {
 
-class CsvParserTest : public BaseTest {};
+class CsvParserTest : public BaseTest {
+ protected:
+  struct ExposedCsvParser : public CsvParser {
+    using CsvParser::_find_chunk_ends;
+  };
+};
 
 TEST_F(CsvParserTest, SingleFloatColumn) {
   auto table = CsvParser::parse("resources/test_data/csv/float.csv");
@@ -300,4 +305,17 @@ TEST_F(CsvParserTest, FinalizedChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, FindChunkEndsInSmallRanges) {
+  // Ranges of four bytes split quoted fields and escaped quotes. The last row has no delimiter.
+  const auto csv_content = std::string_view{"1,\"x\ny\"\n2,z\n3,\"w\"\"\"\n4,v"};
+  const auto meta = CsvMeta{};
+
+  for (const auto range_size : {size_t{1}, size_t{4}, size_t{1'000}}) {
+    EXPECT_EQ(ExposedCsvParser::_find_chunk_ends(csv_content, ChunkOffset{2}, meta, range_size),
+              (std::vector<size_t>{11, 22}));
+    EXPECT_EQ(ExposedCsvParser::_find_chunk_ends(csv_content, ChunkOffset{1}, meta, range_size),
+              (std::vector<size_t>{7, 11, 19, 22}));
+  }
+}
+
 }  // namespace opossum
@@ -96,6 +96,20 @@ TEST_F(CsvWriterTest, MultipleChunks) {
                            "6,\"Tag\",3.5\n"));
 }
 
+TEST_F(CsvWriterTest, ManyChunksInOrder) {
+  // More chunks than are formatted in parallel in one batch
+  auto expected_content = std::string{};
+  for (auto row = int32_t{0}; row < 500; ++row) {
+    table->append({row, pmr_string{"row " + std::to_string(row)}, static_cast<float>(row) + 0.5f});
+    expected_content += std::to_string(row) + ",\"row " + std::to_string(row) + "\"," + std::to_string(row) + ".5\n";
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  CsvWriter::write(*table, test_filename);
+
+  EXPECT_TRUE(compare_file(test_filename, expected_content));
+}
+
 TEST_F(CsvWriterTest, DictionarySegmentFixedSizeByteAligned) {
   table->append({1, "Hallo", 3.5f});
   table->append({1, "Hallo", 3.5f});
@@ -227,4 +241,20 @@ TEST_F(CsvWriterTest, ExportNullValuesMeta) {
   EXPECT_TRUE(meta_information.columns.at(1).nullable);
 }
 
+TEST_F(CsvWriterTest, ExportTbl) {
+  const auto expected_table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 1);
+  CsvWriter::write_tbl(*expected_table, test_filename);
+
+  EXPECT_TRUE(file_exists(test_filename));
+  EXPECT_FALSE(file_exists(test_meta_filename));
+  EXPECT_TRUE(compare_file(test_filename,
+                           "a|b\n"
+                           "int_null|float_null\n"
+                           "12345|458.7\n"
+                           "123|null\n"
+                           "null|456.7\n"
+                           "1234|457.7\n"));
+  EXPECT_TABLE_EQ_ORDERED(load_table(test_filename), expected_table);
+}
+
 }  // namespace opossum
@@ -105,6 +105,23 @@ TEST_F(JoinNodeTest, Copy) {
   EXPECT_EQ(*_anti_join_node, *_anti_join_node->deep_copy());
 }
 
+TEST_F(JoinNodeTest, RuntimeFilter) {
+  const auto runtime_filter_node = std::static_pointer_cast<JoinNode>(_semi_join_node->deep_copy());
+  runtime_filter_node->is_semi_reduction = true;
+  runtime_filter_node->is_runtime_filter = true;
+
+  EXPECT_EQ(runtime_filter_node->description(), "[Join] Mode: Semi (Runtime Filter) [a = y]");
+
+  // Runtime filters are not exact and must not be confused with semi joins
+  EXPECT_NE(*runtime_filter_node, *_semi_join_node);
+  EXPECT_NE(runtime_filter_node->hash(), _semi_join_node->hash());
+
+  const auto copy = std::static_pointer_cast<JoinNode>(runtime_filter_node->deep_copy());
+  EXPECT_EQ(*copy, *runtime_filter_node);
+  EXPECT_TRUE(copy->is_semi_reduction);
+  EXPECT_TRUE(copy->is_runtime_filter);
+}
+
 TEST_F(JoinNodeTest, OutputColumnExpressionsSemiJoin) {
   ASSERT_EQ(_semi_join_node->output_expressions().size(), 3u);
   EXPECT_EQ(*_semi_join_node->output_expressions().at(0), *_t_a_a);
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "expression/expression_functional.hpp"
@@ -442,4 +445,41 @@ TEST_F(LogicalQueryPlanTest, OutputResetOnNodeDelete) {
   EXPECT_EQ(mock_node_b->output_count(), 0u);
 }
 
+TEST_F(LogicalQueryPlanTest, ClearOutputsOfSelfJoin) {
+  _join_node->set_left_input(_mock_node_a);
+  _join_node->set_right_input(_mock_node_a);
+  ASSERT_EQ(_mock_node_a->output_count(), 2u);
+
+  _mock_node_a->clear_outputs();
+
+  EXPECT_EQ(_mock_node_a->output_count(), 0u);
+  EXPECT_EQ(_join_node->left_input(), nullptr);
+  EXPECT_EQ(_join_node->right_input(), nullptr);
+}
+
+TEST_F(LogicalQueryPlanTest, ConcurrentOutputs) {
+  // Like join ordering algorithms that build candidate plans concurrently, several threads add and remove outputs of
+  // the same node while reading them
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto ITERATION_COUNT = 1'000;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto iteration = 0; iteration < ITERATION_COUNT; ++iteration) {
+        auto predicate_node = PredicateNode::make(equals_(_t_a_a, iteration), _mock_node_a);
+        EXPECT_GE(_mock_node_a->output_count(), 1u);
+        for (const auto& output_relation : _mock_node_a->output_relations()) {
+          EXPECT_EQ(output_relation.input_side, LQPInputSide::Left);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(_mock_node_a->output_count(), 0u);
+}
+
 }  // namespace opossum
@@ -33,25 +33,32 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
+#include "operators/group_join.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_inequality.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/drop_table.hpp"
+#include "operators/pipelined_table_scan.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -364,6 +371,68 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitOverSortToTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 3
+   */
+  const auto sort_modes = std::vector<SortMode>{SortMode::Descending, SortMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(3)),
+    SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(static_cast<int64_t>(3)));
+  EXPECT_EQ(top_k->sort_definitions(),
+            std::vector<SortColumnDefinition>({SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                                               SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->left_input());
+  ASSERT_TRUE(get_table);
+}
+
+TEST_F(LQPTranslatorTest, LimitOverSharedSort) {
+  /**
+   * If the sorted result is also used elsewhere, Sort and Limit are kept apart
+   */
+  const auto sort_node = SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+                                        int_float_node);
+  const auto lqp = UnionNode::make(SetOperationMode::All, LimitNode::make(value_(static_cast<int64_t>(3)), sort_node),
+                                   sort_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<const Limit>(pqp->left_input());
+  ASSERT_TRUE(limit);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, LimitSetsRowBudget) {
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+  const auto pqp = LQPTranslator{}.translate_node(LimitNode::make(value_(static_cast<int64_t>(10)), predicate_node));
+  EXPECT_EQ(pqp->left_input()->row_budget, 10);
+
+  // The scan that is also used elsewhere and the input of a prepared Limit get no row budget
+  const auto shared_pqp = LQPTranslator{}.translate_node(UnionNode::make(
+      SetOperationMode::All, LimitNode::make(value_(static_cast<int64_t>(10)), predicate_node), predicate_node));
+  EXPECT_EQ(shared_pqp->right_input()->type(), OperatorType::TableScan);
+  EXPECT_FALSE(shared_pqp->right_input()->row_budget);
+
+  const auto prepared_pqp =
+      LQPTranslator{}.translate_node(LimitNode::make(placeholder_(ParameterID{0}), predicate_node));
+  EXPECT_FALSE(prepared_pqp->left_input()->row_budget);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -380,6 +449,52 @@ TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *equals_(b, 42));
 }
 
+TEST_F(LQPTranslatorTest, StackedPredicateNodesToPipelinedTableScan) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_(int_float_b, 500),
+    PredicateNode::make(greater_than_(int_float_a, 100),
+      PredicateNode::make(equals_(int_float_b, 42),
+        int_float_node)));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto pipelined_table_scan = std::dynamic_pointer_cast<const PipelinedTableScan>(pqp);
+  ASSERT_TRUE(pipelined_table_scan);
+  const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
+  const auto b = PQPColumnExpression::from_table(*table_int_float, "b");
+  const auto& predicates = pipelined_table_scan->predicates();
+  ASSERT_EQ(predicates.size(), 3u);
+  EXPECT_EQ(*predicates[0], *equals_(b, 42));
+  EXPECT_EQ(*predicates[1], *greater_than_(a, 100));
+  EXPECT_EQ(*predicates[2], *less_than_(b, 500));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(pipelined_table_scan->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, StackedPredicateNodesNotPipelined) {
+  // A scan that is used elsewhere, too, is not pipelined
+  const auto shared_predicate_node = PredicateNode::make(equals_(int_float_b, 42), int_float_node);
+  const auto shared_lqp = UnionNode::make(SetOperationMode::All,
+                                          PredicateNode::make(greater_than_(int_float_a, 100), shared_predicate_node),
+                                          shared_predicate_node);
+  const auto shared_pqp = LQPTranslator{}.translate_node(shared_lqp);
+  ASSERT_EQ(shared_pqp->left_input()->type(), OperatorType::TableScan);
+  EXPECT_EQ(shared_pqp->left_input()->left_input(), shared_pqp->right_input());
+
+  // Neither are scans with subqueries
+  const auto subquery = lqp_subquery_(AggregateNode::make(expression_vector(), expression_vector(max_(int_float5_a)),
+                                                          int_float5_node));
+  // clang-format off
+  const auto subquery_lqp =
+  PredicateNode::make(greater_than_(int_float_a, subquery),
+    PredicateNode::make(equals_(int_float_b, 42),
+      int_float_node));
+  // clang-format on
+  const auto subquery_pqp = LQPTranslator{}.translate_node(subquery_lqp);
+  ASSERT_EQ(subquery_pqp->type(), OperatorType::TableScan);
+  EXPECT_EQ(subquery_pqp->left_input()->type(), OperatorType::TableScan);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeBetweenScan) {
   /**
    * Build LQP and translate to PQP
@@ -569,6 +684,21 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_inclusive_(b, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanWithoutIndexedChunks) {
+  // E.g., the only chunk of the table is still mutable and thus not indexed yet
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op);
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_TRUE(table_scan_op->excluded_chunk_ids.empty());
+  EXPECT_EQ(table_scan_op->lqp_node, predicate_node);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -644,6 +774,36 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeWithSortedInputsToJoinSortMerge) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b),
+    SortNode::make(expression_vector(int_float_b), std::vector<SortMode>{SortMode::Ascending}, int_float_node),
+    SortNode::make(expression_vector(int_float2_b), std::vector<SortMode>{SortMode::Descending}, int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - both inputs are sorted by their join columns, so JoinSortMerge is preferred over JoinHash
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinSortMerge>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::Equals);
+
+  // If only one input is sorted by its join column, JoinHash is still used
+  // clang-format off
+  join_node =
+  JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b),
+    SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending}, int_float_node),
+    SortNode::make(expression_vector(int_float2_b), std::vector<SortMode>{SortMode::Ascending}, int_float2_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   /**
    * Build LQP and translate to PQP
@@ -663,6 +823,71 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinInequality) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data,
+      ChunkOffset{100}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 1000; ++value) {
+    table->append({value, value + 10});
+  }
+  Hyrise::get().storage_manager.add_table("intervals", table);
+
+  const auto left_node = StoredTableNode::make("intervals");
+  const auto right_node = StoredTableNode::make("intervals");
+  const auto left_a = left_node->get_column("a");
+  const auto left_b = left_node->get_column("b");
+  const auto right_a = right_node->get_column("a");
+
+  // Band join: right.a BETWEEN left.a AND left.b
+  auto join_node = JoinNode::make(
+      JoinMode::Inner, expression_vector(less_than_equals_(left_a, right_a), greater_than_equals_(left_b, right_a)),
+      left_node, right_node);
+  const auto join_op = std::dynamic_pointer_cast<JoinInequality>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::LessThanEquals);
+  EXPECT_EQ(join_op->secondary_predicates().size(), 1);
+
+  // With a single inequality predicate, JoinSortMerge is used
+  join_node = JoinNode::make(JoinMode::Inner, less_than_equals_(left_a, right_a), left_node, right_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(join_node)));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeCostBasedOperatorChoice) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{100}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 1000; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table);
+  Hyrise::get().storage_manager.add_table("int_large", table);
+
+  const auto int_large_node = StoredTableNode::make("int_large");
+  const auto int_large_a = int_large_node->get_column("a");
+  const auto predicate_node = PredicateNode::make(equals_(int_float_a, 123), int_float_node);
+
+  // With a tiny input, JoinNestedLoop is much cheaper than sorting the other input for JoinSortMerge
+  auto join_node =
+      JoinNode::make(JoinMode::Inner, less_than_(int_float_a, int_large_a), predicate_node, int_large_node);
+  auto op = LQPTranslator{}.translate_node(join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinNestedLoop>(op));
+  EXPECT_NE(op->comment.find("JoinSortMerge"), std::string::npos);
+
+  // Without an index, JoinHash is used for the equi join
+  join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_large_a), predicate_node, int_large_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  // With an index on every chunk, the few rows of the left input are looked up in the index of the right input
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  op = LQPTranslator{}.translate_node(join_node);
+  const auto join_index = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_index);
+  EXPECT_NE(join_index->description(DescriptionMode::SingleLine).find("Index side: Right"), std::string::npos);
+  EXPECT_NE(op->comment.find("JoinIndex (index on Right)"), std::string::npos);
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
@@ -691,6 +916,117 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(*count, *count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeOverJoinNodeToGroupJoin) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_b),
+                      expression_vector(count_star_(int_float_node), sum_(int_float2_a), any_(int_float_a)),
+    JoinNode::make(JoinMode::Left, equals_(int_float2_b, int_float_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP - the aggregate groups by the join key, so the join and the aggregate are fused
+   */
+  const auto group_join = std::dynamic_pointer_cast<GroupJoin>(op);
+  ASSERT_TRUE(group_join);
+  EXPECT_EQ(group_join->mode(), JoinMode::Left);
+  EXPECT_EQ(group_join->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(group_join->groupby_column_id(), ColumnID{1});
+  ASSERT_EQ(group_join->aggregates().size(), 3u);
+  EXPECT_EQ(*group_join->aggregates()[1], *sum_(pqp_column_(ColumnID{2}, DataType::Int, true, "a")));
+  EXPECT_EQ(*group_join->aggregates()[2], *any_(pqp_column_(ColumnID{0}, DataType::Int, false, "a")));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(group_join->left_input()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(group_join->right_input()));
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeOverJoinNodeWithoutGroupJoin) {
+  // Grouping by a column that is not the join key
+  // clang-format off
+  auto lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(count_star_(int_float_node)),
+    JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+
+  // Grouping by the right join column of a left outer join, which is NULL for left rows without a match
+  // clang-format off
+  lqp =
+  AggregateNode::make(expression_vector(int_float2_b), expression_vector(count_star_(int_float_node)),
+    JoinNode::make(JoinMode::Left, equals_(int_float2_b, int_float_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+
+  // Aggregating a column of the left input
+  // clang-format off
+  lqp =
+  AggregateNode::make(expression_vector(int_float_b), expression_vector(sum_(int_float_a)),
+    JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeOverLargeJoinWithGroupJoin) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_b), expression_vector(count_star_(int_float_node)),
+    JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  table_int_float->table_statistics()->row_count = 10'000'000;
+
+  // The GroupJoin is parallelized, so that it is used for large inputs with a multi-threaded scheduler, too
+  EXPECT_TRUE(std::dynamic_pointer_cast<GroupJoin>(LQPTranslator{}.translate_node(lqp)));
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  EXPECT_TRUE(std::dynamic_pointer_cast<GroupJoin>(LQPTranslator{}.translate_node(lqp)));
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeOverOrderedInput) {
+  // The input is ordered by the only GROUP BY column, so that AggregateSort does not have to sort it
+  // clang-format off
+  auto lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float_b)),
+    ValidateNode::make(
+      SortNode::make(expression_vector(int_float_a, int_float_b), std::vector<SortMode>{SortMode::Descending, SortMode::Ascending},  // NOLINT
+        int_float_node)));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateSort>(LQPTranslator{}.translate_node(lqp)));
+
+  // Ordered by another column
+  // clang-format off
+  lqp =
+  AggregateNode::make(expression_vector(int_float_b), expression_vector(sum_(int_float_a)),
+    SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+      int_float_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+
+  // Multiple GROUP BY columns
+  // clang-format off
+  lqp =
+  AggregateNode::make(expression_vector(int_float_a, int_float_b), expression_vector(count_star_(int_float_node)),
+    SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+      int_float_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+
+  // The chunks of the stored table are not sorted
+  lqp = AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float_b)), int_float_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{}.translate_node(lqp)));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
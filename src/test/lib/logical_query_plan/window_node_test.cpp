@@ -0,0 +1,78 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/window_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WindowNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Float, "c"}});
+
+    _a = _mock_node->get_column("a");
+    _b = _mock_node->get_column("b");
+    _c = _mock_node->get_column("c");
+
+    _rank = std::make_shared<WindowFunctionExpression>(WindowFunction::Rank, nullptr, expression_vector(_a),
+                                                       expression_vector(_b),
+                                                       std::vector<SortMode>{SortMode::Descending});
+    _sum = std::make_shared<WindowFunctionExpression>(WindowFunction::Sum, _c, expression_vector(),
+                                                      expression_vector(_b), std::vector<SortMode>{SortMode::Ascending},
+                                                      WindowFrame{FrameType::Rows, 2, 0});
+
+    _window_node = WindowNode::make(_rank, _mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<LQPColumnExpression> _a, _b, _c;
+  std::shared_ptr<WindowFunctionExpression> _rank, _sum;
+  std::shared_ptr<WindowNode> _window_node;
+};
+
+TEST_F(WindowNodeTest, Description) {
+  EXPECT_EQ(_window_node->description(), "[Window] RANK() OVER (PARTITION BY a ORDER BY b (Descending))");
+  EXPECT_EQ(WindowNode::make(_sum, _mock_node)->description(),
+            "[Window] SUM(c) OVER (ORDER BY b (Ascending) ROWS BETWEEN 2 PRECEDING AND CURRENT ROW)");
+}
+
+TEST_F(WindowNodeTest, OutputExpressions) {
+  const auto output_expressions = _window_node->output_expressions();
+  ASSERT_EQ(output_expressions.size(), 4u);
+  EXPECT_EQ(*output_expressions.at(0), *_a);
+  EXPECT_EQ(*output_expressions.at(1), *_b);
+  EXPECT_EQ(*output_expressions.at(2), *_c);
+  EXPECT_EQ(*output_expressions.at(3), *_rank);
+  EXPECT_EQ(output_expressions.at(3)->data_type(), DataType::Long);
+}
+
+TEST_F(WindowNodeTest, IsColumnNullable) {
+  EXPECT_FALSE(_window_node->is_column_nullable(ColumnID{0}));
+  EXPECT_FALSE(_window_node->is_column_nullable(ColumnID{3}));
+  EXPECT_THROW(_window_node->is_column_nullable(ColumnID{4}), std::logic_error);
+}
+
+TEST_F(WindowNodeTest, HashingAndEqualityCheck) {
+  const auto same_window_node = WindowNode::make(_rank->deep_copy(), _mock_node);
+  const auto other_window_node = WindowNode::make(_sum, _mock_node);
+
+  EXPECT_EQ(*_window_node, *same_window_node);
+  EXPECT_EQ(_window_node->hash(), same_window_node->hash());
+  EXPECT_NE(*_window_node, *other_window_node);
+}
+
+TEST_F(WindowNodeTest, Copy) { EXPECT_EQ(*_window_node->deep_copy(), *_window_node); }
+
+TEST_F(WindowNodeTest, NodeExpressions) {
+  ASSERT_EQ(_window_node->node_expressions.size(), 1u);
+  EXPECT_EQ(*_window_node->node_expressions.at(0), *_rank);
+}
+
+}  // namespace opossum
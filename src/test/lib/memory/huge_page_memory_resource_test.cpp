@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <cstring>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/huge_page_memory_resource.hpp"
+#include "memory/pool_memory_resource.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+class HugePageMemoryResourceTest : public BaseTest {
+ protected:
+  void TearDown() override { _memory_resource.set_mode(HugePageMode::Transparent); }
+
+  HugePageMemoryResource& _memory_resource = HugePageMemoryResource::get(HugePageAllocationClass::Intermediates);
+};
+
+TEST_F(HugePageMemoryResourceTest, MappedSize) {
+  constexpr auto HUGE_PAGE_SIZE = HugePageMemoryResource::HUGE_PAGE_SIZE;
+  constexpr auto GIGANTIC_PAGE_SIZE = HugePageMemoryResource::GIGANTIC_PAGE_SIZE;
+  EXPECT_EQ(HugePageMemoryResource::mapped_size(1), HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapped_size(HUGE_PAGE_SIZE), HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapped_size(HUGE_PAGE_SIZE + 1), 2 * HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapped_size(GIGANTIC_PAGE_SIZE), GIGANTIC_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapped_size(GIGANTIC_PAGE_SIZE + 1), 2 * GIGANTIC_PAGE_SIZE);
+}
+
+TEST_F(HugePageMemoryResourceTest, SmallAllocationsAreForwarded) {
+  EXPECT_EQ(_memory_resource.min_bytes(), PoolMemoryResource::MAX_POOLED_BYTES + 1);
+  EXPECT_EQ(HugePageMemoryResource::get(HugePageAllocationClass::Segments).min_bytes(),
+            HugePageMemoryResource::HUGE_PAGE_SIZE);
+
+  const auto mapped_bytes = _memory_resource.mapped_bytes();
+  auto* const pointer = _memory_resource.allocate(PoolMemoryResource::MAX_POOLED_BYTES);
+  EXPECT_EQ(_memory_resource.mapped_bytes(), mapped_bytes);
+  _memory_resource.deallocate(pointer, PoolMemoryResource::MAX_POOLED_BYTES);
+}
+
+TEST_F(HugePageMemoryResourceTest, LargeAllocations) {
+  const auto bytes = size_t{5} * 1024 * 1024;
+  for (const auto mode : {HugePageMode::Disabled, HugePageMode::Transparent, HugePageMode::Explicit}) {
+    _memory_resource.set_mode(mode);
+
+    const auto mapped_bytes = _memory_resource.mapped_bytes();
+    auto* const pointer = _memory_resource.allocate(bytes);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % HugePageMemoryResource::HUGE_PAGE_SIZE, 0);
+    EXPECT_EQ(_memory_resource.mapped_bytes(), mapped_bytes + HugePageMemoryResource::mapped_size(bytes));
+
+    std::memset(pointer, 1, bytes);
+    EXPECT_EQ(static_cast<char*>(pointer)[bytes - 1], 1);
+
+    // Memory that was allocated before the mode was changed can still be deallocated
+    _memory_resource.set_mode(HugePageMode::Disabled);
+    _memory_resource.deallocate(pointer, bytes);
+    EXPECT_EQ(_memory_resource.mapped_bytes(), mapped_bytes);
+  }
+}
+
+TEST_F(HugePageMemoryResourceTest, Setting) {
+  _memory_resource.register_settings();
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("Memory.huge_pages.intermediates");
+  EXPECT_EQ(setting->get(), "transparent");
+
+  setting->set("explicit");
+  EXPECT_EQ(_memory_resource.mode(), HugePageMode::Explicit);
+  setting->set("disabled");
+  EXPECT_EQ(_memory_resource.mode(), HugePageMode::Disabled);
+  EXPECT_THROW(setting->set("always"), InvalidInputException);
+  EXPECT_EQ(setting->get(), "disabled");
+
+  _memory_resource.unregister_settings();
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("Memory.huge_pages.intermediates"));
+}
+
+}  // namespace opossum
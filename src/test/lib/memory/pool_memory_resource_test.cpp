@@ -0,0 +1,74 @@
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "memory/pool_memory_resource.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace opossum {
+
+class PoolMemoryResourceTest : public BaseTest {};
+
+TEST_F(PoolMemoryResourceTest, BlockSize) {
+  EXPECT_EQ(PoolMemoryResource::block_size(1), PoolMemoryResource::MIN_BLOCK_SIZE);
+  EXPECT_EQ(PoolMemoryResource::block_size(64), 64u);
+  EXPECT_EQ(PoolMemoryResource::block_size(65), 80u);
+  EXPECT_EQ(PoolMemoryResource::block_size(81), 96u);
+  EXPECT_EQ(PoolMemoryResource::block_size(128), 128u);
+  EXPECT_EQ(PoolMemoryResource::block_size(129), 160u);
+  EXPECT_EQ(PoolMemoryResource::block_size(65'535 * sizeof(RowID)), 524'288u);
+  EXPECT_EQ(PoolMemoryResource::block_size(PoolMemoryResource::MAX_POOLED_BYTES),
+            PoolMemoryResource::MAX_POOLED_BYTES);
+  EXPECT_EQ(PoolMemoryResource::block_size(PoolMemoryResource::MAX_POOLED_BYTES + 1),
+            PoolMemoryResource::MAX_POOLED_BYTES + 1);
+
+  // Requests are rounded up by less than 25%
+  for (auto bytes = size_t{65}; bytes < 100'000; bytes += 97) {
+    const auto block_size = PoolMemoryResource::block_size(bytes);
+    EXPECT_GE(block_size, bytes);
+    EXPECT_LT(block_size, bytes + bytes / 4);
+  }
+}
+
+TEST_F(PoolMemoryResourceTest, ReusesFreedBlocks) {
+  auto& memory_resource = PoolMemoryResource::get();
+
+  // The thread's cache is empty, while the cache of the main thread might be full from previous tests
+  auto thread = std::thread{[&]() {
+    auto* const block = memory_resource.allocate(100'000);
+    memory_resource.deallocate(block, 100'000);
+
+    // A request of the same size class gets the cached block
+    auto* const reused_block = memory_resource.allocate(99'000);
+    EXPECT_EQ(reused_block, block);
+    memory_resource.deallocate(reused_block, 99'000);
+
+    auto* const large_block = memory_resource.allocate(PoolMemoryResource::MAX_POOLED_BYTES + 1);
+    memory_resource.deallocate(large_block, PoolMemoryResource::MAX_POOLED_BYTES + 1);
+  }};
+  thread.join();
+}
+
+TEST_F(PoolMemoryResourceTest, BlocksCanBeFreedByOtherThreads) {
+  auto& memory_resource = PoolMemoryResource::get();
+
+  auto* block = static_cast<void*>(nullptr);
+  auto allocating_thread = std::thread{[&]() { block = memory_resource.allocate(1'000); }};
+  allocating_thread.join();
+
+  auto freeing_thread = std::thread{[&]() {
+    // The block is now cached by this thread
+    memory_resource.deallocate(block, 1'000);
+    auto* const reused_block = memory_resource.allocate(1'000);
+    EXPECT_EQ(reused_block, block);
+    memory_resource.deallocate(reused_block, 1'000);
+  }};
+  freeing_thread.join();
+}
+
+TEST_F(PoolMemoryResourceTest, DefaultResourceOfRowIDPosLists) {
+  auto pos_list = RowIDPosList(10);
+  EXPECT_EQ(pos_list.get_allocator().resource(), &PoolMemoryResource::get());
+}
+
+}  // namespace opossum
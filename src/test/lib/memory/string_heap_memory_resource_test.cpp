@@ -0,0 +1,89 @@
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "memory/string_heap_memory_resource.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StringHeapMemoryResourceTest : public BaseTest {};
+
+TEST_F(StringHeapMemoryResourceTest, AllocatesContiguously) {
+  auto memory_resource = StringHeapMemoryResource{};
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+
+  auto* const first = static_cast<std::byte*>(memory_resource.allocate(30, 1));
+  auto* const second = static_cast<std::byte*>(memory_resource.allocate(17, 1));
+  auto* const third = static_cast<std::byte*>(memory_resource.allocate(8, 8));
+  EXPECT_EQ(second, first + 32);
+  EXPECT_EQ(third, second + 24);
+  EXPECT_EQ(memory_resource.allocated_bytes(), StringHeapMemoryResource::MIN_BLOCK_SIZE);
+
+  // Freeing small allocations does not release their bytes
+  memory_resource.deallocate(second, 17, 1);
+  EXPECT_EQ(memory_resource.allocated_bytes(), StringHeapMemoryResource::MIN_BLOCK_SIZE);
+
+  // Once the block is full, a block of twice its size is added
+  memory_resource.allocate(StringHeapMemoryResource::MIN_BLOCK_SIZE, 1);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 3 * StringHeapMemoryResource::MIN_BLOCK_SIZE);
+}
+
+TEST_F(StringHeapMemoryResourceTest, ForwardsLargeAllocations) {
+  auto memory_resource = StringHeapMemoryResource{};
+  const auto bytes = StringHeapMemoryResource::LARGE_ALLOCATION_BYTES + 1;
+
+  auto* const large_allocation = memory_resource.allocate(bytes, 1);
+  EXPECT_EQ(memory_resource.allocated_bytes(), bytes);
+  memory_resource.deallocate(large_allocation, bytes, 1);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+}
+
+TEST_F(StringHeapMemoryResourceTest, ConcurrentAllocations) {
+  auto memory_resource = StringHeapMemoryResource{};
+
+  constexpr auto THREAD_COUNT = size_t{8};
+  constexpr auto ALLOCATION_COUNT = size_t{10'000};
+
+  auto allocations = std::vector<std::vector<std::byte*>>(THREAD_COUNT);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto allocation_id = size_t{0}; allocation_id < ALLOCATION_COUNT; ++allocation_id) {
+        auto* const allocation = static_cast<std::byte*>(memory_resource.allocate(40, 1));
+        std::fill_n(allocation, 40, static_cast<std::byte>(thread_id));
+        allocations[thread_id].emplace_back(allocation);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // No two threads got overlapping memory
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    for (auto* const allocation : allocations[thread_id]) {
+      EXPECT_EQ(allocation[0], static_cast<std::byte>(thread_id));
+      EXPECT_EQ(allocation[39], static_cast<std::byte>(thread_id));
+    }
+  }
+}
+
+TEST_F(StringHeapMemoryResourceTest, ValueSegmentStrings) {
+  auto segment = ValueSegment<pmr_string>{false, 10};
+  const auto long_string = pmr_string{"ThisStringIsTooLongForTheSmallStringBuffer"};
+  segment.append(long_string);
+  segment.append(long_string);
+
+  // Both strings are in the same block, one after another
+  const auto& values = segment.values();
+  EXPECT_EQ(values[0], long_string);
+  EXPECT_EQ(values[1].data(), values[0].data() + (values[0].capacity() + 1 + 7) / 8 * 8);
+
+  // Copies do not reference the heap of the segment
+  const auto copy = pmr_string{values[0]};
+  EXPECT_EQ(copy.get_allocator().resource(), boost::container::pmr::get_default_resource());
+}
+
+}  // namespace opossum
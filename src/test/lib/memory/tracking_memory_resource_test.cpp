@@ -0,0 +1,63 @@
+#include "base_test.hpp"
+
+#include "memory/tracking_memory_resource.hpp"
+
+namespace opossum {
+
+class TrackingMemoryResourceTest : public BaseTest {};
+
+TEST_F(TrackingMemoryResourceTest, CountsAllocatedBytes) {
+  auto memory_resource = TrackingMemoryResource{};
+
+  {
+    auto values = pmr_vector<int64_t>(100, PolymorphicAllocator<int64_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.allocated_bytes(), 100 * sizeof(int64_t));
+  }
+
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 100 * sizeof(int64_t));
+
+  memory_resource.add_bytes(1'000);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 1'000u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 1'000u);
+  memory_resource.remove_bytes(1'000);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+}
+
+TEST_F(TrackingMemoryResourceTest, ParentCountsBytesOfChildren) {
+  const auto parent = std::make_shared<TrackingMemoryResource>();
+  auto first_child = TrackingMemoryResource{parent};
+  auto second_child = TrackingMemoryResource{parent};
+
+  auto first_values = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{&first_child});
+  second_child.add_bytes(100);
+
+  EXPECT_EQ(first_child.allocated_bytes(), 10 * sizeof(int32_t));
+  EXPECT_EQ(second_child.allocated_bytes(), 100u);
+  EXPECT_EQ(parent->allocated_bytes(), 10 * sizeof(int32_t) + 100);
+
+  second_child.remove_bytes(100);
+  EXPECT_EQ(parent->allocated_bytes(), 10 * sizeof(int32_t));
+  EXPECT_EQ(parent->peak_allocated_bytes(), 10 * sizeof(int32_t) + 100);
+}
+
+TEST_F(TrackingMemoryResourceTest, Limit) {
+  const auto parent = std::make_shared<TrackingMemoryResource>(nullptr, 100);
+  auto child = TrackingMemoryResource{parent};
+  EXPECT_EQ(parent->limit(), 100u);
+  EXPECT_FALSE(child.limit());
+
+  child.add_bytes(100);
+  EXPECT_FALSE(parent->limit_exceeded());
+
+  // The allocation succeeds, but the limit stays exceeded even after the memory was released
+  {
+    auto values = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{&child});
+    EXPECT_TRUE(parent->limit_exceeded());
+  }
+  child.remove_bytes(100);
+  EXPECT_TRUE(parent->limit_exceeded());
+  EXPECT_FALSE(child.limit_exceeded());
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include <cmath>
+
+#include "base_test.hpp"
+#include "operators/aggregate/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {};
+
+TEST_F(HyperLogLogTest, Empty) {
+  const auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0u);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinalitiesAreAlmostExact) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    sketch.add(value);
+    sketch.add(value);
+  }
+  EXPECT_NEAR(static_cast<double>(sketch.estimate()), 100.0, 2.0);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinalities) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 100'000; ++value) {
+    sketch.add(value);
+  }
+  EXPECT_NEAR(static_cast<double>(sketch.estimate()), 100'000.0, 5'000.0);
+}
+
+TEST_F(HyperLogLogTest, Strings) {
+  auto sketch = HyperLogLog{};
+  for (auto value = 0; value < 1'000; ++value) {
+    sketch.add(pmr_string{"value" + std::to_string(value % 500)});
+  }
+  EXPECT_NEAR(static_cast<double>(sketch.estimate()), 500.0, 25.0);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch_a = HyperLogLog{};
+  auto sketch_b = HyperLogLog{};
+  auto sketch_union = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    sketch_a.add(value);
+    sketch_union.add(value);
+  }
+  for (auto value = int32_t{10'000}; value < 30'000; ++value) {
+    sketch_b.add(value);
+    sketch_union.add(value);
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_EQ(sketch_a.estimate(), sketch_union.estimate());
+  EXPECT_NEAR(static_cast<double>(sketch_a.estimate()), 30'000.0, 1'500.0);
+
+  auto empty_sketch = HyperLogLog{};
+  empty_sketch.merge(sketch_union);
+  EXPECT_EQ(empty_sketch.estimate(), sketch_union.estimate());
+}
+
+}  // namespace opossum
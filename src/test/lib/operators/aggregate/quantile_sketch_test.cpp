@@ -0,0 +1,55 @@
+#include "base_test.hpp"
+#include "operators/aggregate/quantile_sketch.hpp"
+
+namespace opossum {
+
+class QuantileSketchTest : public BaseTest {};
+
+TEST_F(QuantileSketchTest, Empty) {
+  const auto sketch = QuantileSketch{};
+  EXPECT_EQ(sketch.count(), 0u);
+  EXPECT_THROW(sketch.quantile(0.5), std::logic_error);
+}
+
+TEST_F(QuantileSketchTest, SmallInputsAreExact) {
+  auto sketch = QuantileSketch{};
+  for (const auto value : {5.0, 1.0, 4.0, 2.0, 3.0}) {
+    sketch.add(value);
+  }
+
+  EXPECT_EQ(sketch.count(), 5u);
+  EXPECT_DOUBLE_EQ(sketch.quantile(0.0), 1.0);
+  EXPECT_DOUBLE_EQ(sketch.quantile(0.5), 3.0);
+  EXPECT_DOUBLE_EQ(sketch.quantile(0.8), 4.0);
+  EXPECT_DOUBLE_EQ(sketch.quantile(1.0), 5.0);
+  EXPECT_THROW(sketch.quantile(1.5), std::logic_error);
+}
+
+TEST_F(QuantileSketchTest, LargeInputs) {
+  auto sketch = QuantileSketch{};
+  for (auto value = 1; value <= 100'000; ++value) {
+    // Add the values out of order
+    sketch.add(static_cast<double>((value * 7'919) % 100'000 + 1));
+  }
+
+  EXPECT_EQ(sketch.count(), 100'000u);
+  EXPECT_NEAR(sketch.quantile(0.5), 50'000.0, 2'000.0);
+  EXPECT_NEAR(sketch.quantile(0.9), 90'000.0, 2'000.0);
+  EXPECT_NEAR(sketch.quantile(0.1), 10'000.0, 2'000.0);
+}
+
+TEST_F(QuantileSketchTest, Merge) {
+  auto sketch_a = QuantileSketch{};
+  auto sketch_b = QuantileSketch{};
+  for (auto value = 1; value <= 50'000; ++value) {
+    sketch_a.add(static_cast<double>(value));
+    sketch_b.add(static_cast<double>(value + 50'000));
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_EQ(sketch_a.count(), 100'000u);
+  EXPECT_NEAR(sketch_a.quantile(0.25), 25'000.0, 2'000.0);
+  EXPECT_NEAR(sketch_a.quantile(0.75), 75'000.0, 2'000.0);
+}
+
+}  // namespace opossum
@@ -200,4 +200,77 @@ TEST_F(AggregateSortTest, AggregateOnPresortedValueClustered) {
   test_clustered_table_input(to_simple_reference_table(table_sorted_value_clustered));
 }
 
+TEST_F(AggregateSortTest, StreamingChunkOrder) {
+  const auto make_table = [](const std::vector<std::vector<AllTypeVariant>>& chunk_values, const SortMode sort_mode) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                               ChunkOffset{3});
+    for (const auto& values : chunk_values) {
+      for (const auto& value : values) {
+        table->append({value});
+      }
+      table->last_chunk()->finalize();
+      table->last_chunk()->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, sort_mode));
+    }
+    return table;
+  };
+
+  // Value ranges that only share their borders, NULL-only chunks come first
+  const auto table = make_table({{4, 5, 5}, {1, 2, 4}, {NULL_VALUE, NULL_VALUE, NULL_VALUE}, {5, 7, 8}, {5, 5, 5}},
+                                SortMode::Ascending);
+  const auto chunk_order = AggregateSort::streaming_chunk_order(*table, ColumnID{0});
+  ASSERT_TRUE(chunk_order);
+  EXPECT_EQ(*chunk_order, (std::vector<ChunkID>{ChunkID{2}, ChunkID{1}, ChunkID{0}, ChunkID{4}, ChunkID{3}}));
+
+  const auto descending_table = make_table({{3, 2, 1}, {9, 8, 3}}, SortMode::Descending);
+  const auto descending_chunk_order = AggregateSort::streaming_chunk_order(*descending_table, ColumnID{0});
+  ASSERT_TRUE(descending_chunk_order);
+  EXPECT_EQ(*descending_chunk_order, (std::vector<ChunkID>{ChunkID{1}, ChunkID{0}}));
+
+  // Overlapping value ranges
+  EXPECT_FALSE(AggregateSort::streaming_chunk_order(*make_table({{1, 3, 5}, {2, 4, 6}}, SortMode::Ascending),
+                                                    ColumnID{0}));
+
+  // Chunks that contain both NULLs and values
+  EXPECT_FALSE(AggregateSort::streaming_chunk_order(*make_table({{NULL_VALUE, 1, 2}, {3, 4, 5}}, SortMode::Ascending),
+                                                    ColumnID{0}));
+
+  // Different sort modes (as in _table_wrapper_1) and chunks without sort order
+  EXPECT_FALSE(AggregateSort::streaming_chunk_order(*this->_table_wrapper_1->get_output(), ColumnID{0}));
+  EXPECT_FALSE(AggregateSort::streaming_chunk_order(*this->_table_wrapper_1->get_output(), ColumnID{1}));
+}
+
+TEST_F(AggregateSortTest, StreamingAggregateOnReorderedChunks) {
+  // Groups of a continue across the borders of the (shuffled) chunks, which are sorted by a
+  const auto table_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{4});
+  for (const auto chunk_index : {3, 0, 2, 1}) {
+    for (auto row_index = int32_t{0}; row_index < 4; ++row_index) {
+      const auto row_id = chunk_index * 4 + row_index;
+      table->append({row_id / 3, row_id});
+    }
+    table->last_chunk()->finalize();
+    table->last_chunk()->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+  }
+  ASSERT_TRUE(AggregateSort::streaming_chunk_order(*table, ColumnID{0}));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto reference_table_wrapper = std::make_shared<TableWrapper>(to_simple_reference_table(table));
+  reference_table_wrapper->execute();
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      sum_(pqp_column_(ColumnID{1}, DataType::Int, false, "b")),
+      count_(pqp_column_(ColumnID{1}, DataType::Int, false, "b"))};
+  for (const auto& input : {table_wrapper, reference_table_wrapper}) {
+    const auto aggregate = std::make_shared<AggregateSort>(input, aggregates, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+
+    const auto reference = std::make_shared<AggregateHash>(input, aggregates, std::vector<ColumnID>{ColumnID{0}});
+    reference->execute();
+
+    EXPECT_EQ(aggregate->get_output()->row_count(), 6u);
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+  }
+}
+
 }  // namespace opossum
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -19,6 +20,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -872,4 +875,293 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+TYPED_TEST(OperatorsAggregateTest, ManyGroupsInManyChunks) {
+  // Large enough for AggregateHash to pre-aggregate the chunks in parallel and to merge the partitioned groups. The
+  // values of a are too sparse for the immediate key shortcut. The result is compared with that of AggregateSort.
+  const auto table_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::String, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row_id = int32_t{0}; row_id < 8 * AggregateHash::JOB_SPAWN_THRESHOLD; ++row_id) {
+    const auto b = row_id % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id % 101};
+    table->append({row_id % 7'000 * 100, b, pmr_string{"s" + std::to_string(row_id % 3)}});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::String, false, "c");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::Avg, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::Min, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::Max, c),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")),
+      std::make_shared<AggregateExpression>(AggregateFunction::CountDistinct, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::StandardDeviationSample, b)};
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{ColumnID{0}}, std::vector{ColumnID{0}, ColumnID{2}}}) {
+    for (const auto& aggregate_expressions : {aggregates, std::vector<std::shared_ptr<AggregateExpression>>{}}) {
+      const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregate_expressions, groupby_column_ids);
+      aggregate->execute();
+
+      const auto reference = std::make_shared<AggregateSort>(table_wrapper, aggregate_expressions, groupby_column_ids);
+      reference->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+    }
+  }
+}
+
+TYPED_TEST(OperatorsAggregateTest, LongStringGroupByColumns) {
+  // Strings with five or more characters are mapped to ids through the id_map, whose keys point into an arena. The
+  // strings repeat across chunks and are combined with an int and a float column of mixed nullability.
+  const auto table_definitions = TableColumnDefinitions{
+      {"a", DataType::String, true}, {"b", DataType::Int, false}, {"c", DataType::Float, true}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_id = int32_t{0}; row_id < 2'000; ++row_id) {
+    const auto a = row_id % 13 == 0 ? AllTypeVariant{NullValue{}}
+                                    : AllTypeVariant{pmr_string{"customer#" + std::to_string(row_id % 37)}};
+    const auto c = row_id % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<float>(row_id % 3)};
+    table->append({a, row_id % 5, c});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  for (const auto& groupby_column_ids :
+       {std::vector<ColumnID>{ColumnID{0}}, std::vector{ColumnID{0}, ColumnID{1}},
+        std::vector{ColumnID{2}, ColumnID{0}, ColumnID{1}}}) {
+    const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto reference = std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    reference->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+  }
+}
+
+TYPED_TEST(OperatorsAggregateTest, DictionaryEncodedGroupByColumns) {
+  // The dictionaries of the chunks differ, so the value ids have to be translated into ids that are valid for all
+  // chunks. For AggregateHash, the few combinations of status and country are aggregated using immediate indexes.
+  const auto table_definitions = TableColumnDefinitions{
+      {"status", DataType::String, true}, {"country", DataType::Int, false}, {"v", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{7});
+  const auto encoded_table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{7});
+  const auto statuses = std::vector<AllTypeVariant>{pmr_string{"ok"}, NullValue{}, pmr_string{"failed"},
+                                                    pmr_string{"pending"}};
+  for (auto row_id = int32_t{0}; row_id < 100; ++row_id) {
+    const auto row = std::vector<AllTypeVariant>{statuses[(row_id + row_id / 3) % 4], row_id % 5 * 1'000, row_id};
+    table->append(row);
+    encoded_table->append(row);
+  }
+  ChunkEncoder::encode_all_chunks(encoded_table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  const auto v = pqp_column_(ColumnID{2}, DataType::Int, false, "v");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum, v),
+      std::make_shared<AggregateExpression>(AggregateFunction::Max, v),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{ColumnID{0}}, std::vector{ColumnID{1}, ColumnID{0}}}) {
+    for (const auto& aggregate_expressions : {aggregates, std::vector<std::shared_ptr<AggregateExpression>>{}}) {
+      const auto aggregate =
+          std::make_shared<TypeParam>(encoded_table_wrapper, aggregate_expressions, groupby_column_ids);
+      aggregate->execute();
+
+      const auto reference = std::make_shared<AggregateSort>(table_wrapper, aggregate_expressions, groupby_column_ids);
+      reference->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+    }
+  }
+}
+
+TYPED_TEST(OperatorsAggregateTest, RunLengthEncodedAggregateColumns) {
+  // Without GROUP BY, AggregateHash aggregates RunLengthSegments per run. The runs have different lengths and some of
+  // them are NULL.
+  const auto table_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Double, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{50});
+  const auto encoded_table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{50});
+  for (auto row_id = int32_t{0}; row_id < 200; ++row_id) {
+    const auto run_id = static_cast<int32_t>(std::sqrt(row_id));
+    const auto a = run_id % 3 == 2 ? AllTypeVariant{NullValue{}} : AllTypeVariant{run_id - 5};
+    const auto row = std::vector<AllTypeVariant>{a, pmr_string{"status" + std::to_string(run_id % 4)}, run_id * 0.5};
+    table->append(row);
+    encoded_table->append(row);
+  }
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::RunLength});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto aggregate_function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum,
+                                        AggregateFunction::Avg, AggregateFunction::Count}) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(aggregate_function,
+                                                                  pqp_column_(ColumnID{0}, DataType::Int, true, "a")));
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        aggregate_function, pqp_column_(ColumnID{2}, DataType::Double, false, "c")));
+  }
+  for (const auto aggregate_function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Count}) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        aggregate_function, pqp_column_(ColumnID{1}, DataType::String, false, "b")));
+  }
+
+  const auto aggregate = std::make_shared<TypeParam>(encoded_table_wrapper, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto reference = std::make_shared<AggregateSort>(table_wrapper, aggregates, std::vector<ColumnID>{});
+  reference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+}
+
+TYPED_TEST(OperatorsAggregateTest, MinMaxFromMetadata) {
+  // Without GROUP BY, AggregateHash takes MIN and MAX of entire segments from their dictionaries or pruning statistics.
+  // Chunk 0 is dictionary-encoded, chunk 1 is LZ4-encoded and holds the maximum of a, chunk 2 only has NULLs in a,
+  // chunk 3 is immutable but unencoded and holds the minimum of a, and chunk 4 is mutable.
+  const auto table_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{10});
+  for (auto row_id = int32_t{0}; row_id < 50; ++row_id) {
+    const auto offsets = std::vector<int32_t>{100, 900, 0, -100, 0};
+    const auto a = row_id / 10 == 2 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id + offsets[row_id / 10]};
+    table->append({a, pmr_string{"value" + std::to_string((row_id * 7) % 50)}});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{2}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::LZ4});
+
+  // Same as the Validate's output: entirely visible chunks are referenced with an EntireChunkPosList. In chunk 3, the
+  // row with the minimum of a is not visible.
+  const auto reference_table = std::make_shared<Table>(table_definitions, TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto pos_list = std::shared_ptr<AbstractPosList>{};
+    if (chunk_id == ChunkID{3}) {
+      auto row_ids = RowIDPosList{};
+      for (auto chunk_offset = ChunkOffset{1}; chunk_offset < 10; ++chunk_offset) {
+        row_ids.emplace_back(chunk_id, chunk_offset);
+      }
+      row_ids.guarantee_single_chunk();
+      pos_list = std::make_shared<RowIDPosList>(std::move(row_ids));
+    } else {
+      pos_list = std::make_shared<EntireChunkPosList>(chunk_id, table->get_chunk(chunk_id)->size());
+    }
+    reference_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list),
+                                           std::make_shared<ReferenceSegment>(table, ColumnID{1}, pos_list)});
+  }
+
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto aggregate_function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Count}) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(aggregate_function,
+                                                                  pqp_column_(ColumnID{0}, DataType::Int, true, "a")));
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        aggregate_function, pqp_column_(ColumnID{1}, DataType::String, false, "b")));
+  }
+
+  for (const auto& input_table : {table, reference_table}) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+
+    const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, std::vector<ColumnID>{});
+    aggregate->execute();
+
+    const auto reference = std::make_shared<AggregateSort>(table_wrapper, aggregates, std::vector<ColumnID>{});
+    reference->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), reference->get_output());
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+  const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+  EXPECT_EQ(aggregate->get_output()->template get_value<int32_t>(ColumnID{0}, 0), -69);
+  EXPECT_EQ(aggregate->get_output()->template get_value<int32_t>(ColumnID{2}, 0), 919);
+}
+
+TYPED_TEST(OperatorsAggregateTest, ApproximateAggregates) {
+  // Large enough for AggregateHash to merge the sketches of the pre-aggregated chunks. Every group has 500 distinct
+  // values of b, which are uniformly distributed between 0 and 2'000.
+  const auto table_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row_id = int32_t{0}; row_id < 4 * AggregateHash::JOB_SPAWN_THRESHOLD; ++row_id) {
+    const auto b = row_id % 13 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id % 2'000};
+    table->append({row_id % 4 * 1'000'000, b});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxCountDistinct, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxPercentile, b, 0.5),
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxPercentile, b, 0.9)};
+
+  const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  EXPECT_EQ(output->column_data_type(ColumnID{1}), DataType::Long);
+  EXPECT_FALSE(output->column_is_nullable(ColumnID{1}));
+  EXPECT_EQ(output->column_data_type(ColumnID{2}), DataType::Double);
+
+  const auto rows = output->get_rows();
+  ASSERT_EQ(rows.size(), 4u);
+  for (const auto& row : rows) {
+    EXPECT_NEAR(static_cast<double>(boost::get<int64_t>(row[1])), 500.0, 25.0);
+    EXPECT_NEAR(boost::get<double>(row[2]), 1'000.0, 60.0);
+    EXPECT_NEAR(boost::get<double>(row[3]), 1'800.0, 60.0);
+  }
+}
+
+TYPED_TEST(OperatorsAggregateTest, ApproximateAggregatesSmallGroupsAreExact) {
+  const auto b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxCountDistinct, b),
+      std::make_shared<AggregateExpression>(AggregateFunction::ApproxPercentile, b, 0.0)};
+
+  const auto aggregate =
+      std::make_shared<TypeParam>(this->_table_wrapper_1_1, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  auto results = std::map<int32_t, std::pair<int64_t, double>>{};
+  for (const auto& row : aggregate->get_output()->get_rows()) {
+    results[boost::get<int32_t>(row[0])] = {boost::get<int64_t>(row[1]), boost::get<double>(row[2])};
+  }
+
+  const auto expected_results = std::map<int32_t, std::pair<int64_t, double>>{
+      {12, {1, 350.7f}}, {123, {1, 458.7f}}, {12345, {2, 456.7f}}};
+  EXPECT_EQ(results, expected_results);
+}
+
+TYPED_TEST(OperatorsAggregateTest, CannotApproxPercentileStringColumns) {
+  const auto table = this->_table_wrapper_1_1_string->get_output();
+  const auto aggregate_expressions = std::vector<std::shared_ptr<AggregateExpression>>{approx_percentile_(
+      pqp_column_(ColumnID{0}, table->column_data_type(ColumnID{0}), table->column_is_nullable(ColumnID{0}),
+                  table->column_name(ColumnID{0})),
+      0.5)};
+  auto aggregate = std::make_shared<TypeParam>(this->_table_wrapper_1_1_string, aggregate_expressions,
+                                               std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
 }  // namespace opossum
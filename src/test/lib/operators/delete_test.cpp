@@ -17,6 +17,8 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -356,4 +358,37 @@ TEST_F(OperatorsDeleteTest, PrunedInputTable) {
   EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_end_cid(1u), expected_end_cid);
 }
 
+TEST_F(OperatorsDeleteTest, DeleteRunsOfChunksAndOffsets) {
+  // The positions are processed in runs of the same chunk, whose consecutive offsets are updated as ranges
+  const auto pos_list = std::make_shared<RowIDPosList>(RowIDPosList{
+      RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{2}, ChunkOffset{0}},
+      RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{2}}, RowID{ChunkID{2}, ChunkOffset{1}}});
+  const auto referencing_table = std::make_shared<Table>(_table2->column_definitions(), TableType::References);
+  referencing_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(_table2, ColumnID{0}, pos_list),
+                                           std::make_shared<ReferenceSegment>(_table2, ColumnID{1}, pos_list)});
+  const auto table_wrapper = std::make_shared<TableWrapper>(referencing_table);
+  table_wrapper->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto delete_op = std::make_shared<Delete>(table_wrapper);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+  transaction_context->commit();
+
+  const auto deleted = transaction_context->commit_id();
+  const auto kept = MvccData::MAX_COMMIT_ID;
+  const auto expected_end_cids = std::vector<std::vector<CommitID>>{{kept, deleted, deleted},
+                                                                    {deleted, kept, deleted},
+                                                                    {deleted, deleted}};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table2->chunk_count(); ++chunk_id) {
+    const auto chunk = _table2->get_chunk(chunk_id);
+    ASSERT_EQ(chunk->size(), expected_end_cids[chunk_id].size());
+    EXPECT_EQ(chunk->invalid_row_count(), 2);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(chunk->mvcc_data()->get_end_cid(chunk_offset), expected_end_cids[chunk_id][chunk_offset]);
+    }
+  }
+}
+
 }  // namespace opossum
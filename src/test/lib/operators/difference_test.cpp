@@ -28,6 +28,23 @@ class OperatorsDifferenceTest : public BaseTest {
     _table_wrapper_b->execute();
   }
 
+  // Creates a table with an int and a string column and two rows per chunk
+  static std::shared_ptr<Table> create_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> create_table_wrapper(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(create_table(rows));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
   std::shared_ptr<TableWrapper> _table_wrapper_a;
   std::shared_ptr<TableWrapper> _table_wrapper_b;
 };
@@ -59,6 +76,44 @@ TEST_F(OperatorsDifferenceTest, DifferneceOnReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
 }
 
+TEST_F(OperatorsDifferenceTest, SetOperationModes) {
+  const auto left = create_table_wrapper({{1, "x"},
+                                          {1, "x"},
+                                          {NULL_VALUE, "y"},
+                                          {1, "x"},
+                                          {2, "x"},
+                                          {NULL_VALUE, "y"},
+                                          {1, "y"},
+                                          {3, "z"}});
+  const auto right = create_table_wrapper({{NULL_VALUE, "y"}, {1, "x"}, {4, "x"}, {1, "z"}});
+
+  auto difference = std::make_shared<Difference>(left, right, SetOperationMode::Unique);
+  difference->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), create_table({{2, "x"}, {1, "y"}, {3, "z"}}));
+
+  difference = std::make_shared<Difference>(left, right, SetOperationMode::All);
+  difference->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(),
+                            create_table({{1, "x"}, {1, "x"}, {NULL_VALUE, "y"}, {2, "x"}, {1, "y"}, {3, "z"}}));
+
+  difference = std::make_shared<Difference>(left, right, SetOperationMode::Positions);
+  difference->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), create_table({{2, "x"}, {1, "y"}, {3, "z"}}));
+}
+
+TEST_F(OperatorsDifferenceTest, EmptyRightInput) {
+  const auto left = create_table_wrapper({{1, "x"}, {1, "x"}, {2, "y"}});
+  const auto right = create_table_wrapper({});
+
+  auto difference = std::make_shared<Difference>(left, right, SetOperationMode::Unique);
+  difference->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), create_table({{1, "x"}, {2, "y"}}));
+
+  difference = std::make_shared<Difference>(left, right, SetOperationMode::All);
+  difference->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), left->get_output());
+}
+
 TEST_F(OperatorsDifferenceTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
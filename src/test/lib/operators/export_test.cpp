@@ -97,6 +97,19 @@ TEST_P(OperatorsExportMultiFileTypeTest, ExportWithoutFileType) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(OperatorsExportTest, ExportTbl) {
+  const auto expected_table = load_table("resources/test_data/tbl/string_with_null.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(expected_table);
+  table_wrapper->execute();
+
+  const auto filename = test_filename + ".tbl";
+  auto exporter = std::make_shared<Export>(table_wrapper, filename);
+  exporter->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(load_table(filename), expected_table);
+  std::remove(filename.c_str());
+}
+
 TEST_F(OperatorsExportTest, NonsensePath) {
   table->append({1, "hello", 3.5f});
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
@@ -0,0 +1,196 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/group_join.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsGroupJoinTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto left_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"k", DataType::Int, true}, {"x", DataType::Int, false}}, TableType::Data, 2);
+    left_table->append({1, 10});
+    left_table->append({2, 20});
+    left_table->append({1, 10});
+    left_table->append({3, 30});
+    left_table->append({NullValue{}, 40});
+
+    const auto right_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"k", DataType::Int, true}, {"v", DataType::Int, true}, {"s", DataType::String, false}},
+        TableType::Data, 2);
+    right_table->append({1, 5, "b"});
+    right_table->append({4, 9, "d"});
+    right_table->append({1, NullValue{}, "a"});
+    right_table->append({2, 7, "c"});
+    right_table->append({NullValue{}, 1, "e"});
+    right_table->append({2, 3, "f"});
+
+    _left_input = std::make_shared<TableWrapper>(left_table);
+    _right_input = std::make_shared<TableWrapper>(right_table);
+    _left_input->execute();
+    _right_input->execute();
+  }
+
+  // Returns the aggregate on a column of the join result, which has the columns k, x, k, v, s
+  static std::shared_ptr<AggregateExpression> _aggregate(const AggregateFunction aggregate_function,
+                                                         const ColumnID column_id) {
+    if (column_id == INVALID_COLUMN_ID) {
+      return std::make_shared<AggregateExpression>(aggregate_function,
+                                                   pqp_column_(column_id, DataType::Long, false, "*"));
+    }
+
+    const auto data_types = std::vector<DataType>{DataType::Int, DataType::Int, DataType::Int, DataType::Int,
+                                                  DataType::String};
+    const auto names = std::vector<std::string>{"k", "x", "k", "v", "s"};
+    return std::make_shared<AggregateExpression>(
+        aggregate_function, pqp_column_(column_id, data_types[column_id], column_id != ColumnID{1}, names[column_id]));
+  }
+
+  // Compares the GroupJoin with a JoinHash followed by an AggregateHash
+  void _test_group_join(const JoinMode mode, const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                        const ColumnID groupby_column_id) {
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+    const auto group_join =
+        std::make_shared<GroupJoin>(_left_input, _right_input, mode, primary_predicate, aggregates, groupby_column_id);
+    group_join->execute();
+
+    const auto join = std::make_shared<JoinHash>(_left_input, _right_input, mode, primary_predicate);
+    const auto aggregate = std::make_shared<AggregateHash>(join, aggregates, std::vector<ColumnID>{groupby_column_id});
+    join->execute();
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(group_join->get_output(), aggregate->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _left_input, _right_input;
+};
+
+TEST_F(OperatorsGroupJoinTest, Supports) {
+  EXPECT_TRUE(GroupJoin::supports({JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Int, false}));
+  EXPECT_TRUE(GroupJoin::supports({JoinMode::Left, PredicateCondition::Equals, DataType::String, DataType::String,
+                                   false}));
+  EXPECT_FALSE(GroupJoin::supports({JoinMode::Right, PredicateCondition::Equals, DataType::Int, DataType::Int, false}));
+  EXPECT_FALSE(GroupJoin::supports({JoinMode::Semi, PredicateCondition::Equals, DataType::Int, DataType::Int, false}));
+  EXPECT_FALSE(
+      GroupJoin::supports({JoinMode::Inner, PredicateCondition::LessThan, DataType::Int, DataType::Int, false}));
+  EXPECT_FALSE(GroupJoin::supports({JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Long, false}));
+  EXPECT_FALSE(GroupJoin::supports({JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Int, true}));
+
+  const auto left_column_count = ColumnCount{2};
+  EXPECT_TRUE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Count, INVALID_COLUMN_ID), left_column_count));
+  EXPECT_TRUE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Sum, ColumnID{3}), left_column_count));
+  EXPECT_TRUE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Any, ColumnID{1}), left_column_count));
+  EXPECT_TRUE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Max, ColumnID{4}), left_column_count));
+  EXPECT_FALSE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Sum, ColumnID{1}), left_column_count));
+  EXPECT_FALSE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Any, ColumnID{3}), left_column_count));
+  EXPECT_FALSE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::Sum, ColumnID{4}), left_column_count));
+  EXPECT_FALSE(
+      GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::CountDistinct, ColumnID{3}), left_column_count));
+  EXPECT_FALSE(GroupJoin::supports_aggregate(*_aggregate(AggregateFunction::StandardDeviationSample, ColumnID{3}),
+                                             left_column_count));
+}
+
+TEST_F(OperatorsGroupJoinTest, DescriptionAndName) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto group_join =
+      std::make_shared<GroupJoin>(_left_input, _right_input, JoinMode::Left, primary_predicate,
+                                  std::vector{_aggregate(AggregateFunction::Count, ColumnID{3})}, ColumnID{0});
+
+  EXPECT_EQ(group_join->name(), "GroupJoin");
+  EXPECT_EQ(group_join->description(DescriptionMode::SingleLine),
+            "GroupJoin (Left Join where k = k) GroupBy ColumnID: 0 Aggregates: COUNT(v)");
+}
+
+TEST_F(OperatorsGroupJoinTest, DeepCopy) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto group_join =
+      std::make_shared<GroupJoin>(_left_input, _right_input, JoinMode::Inner, primary_predicate,
+                                  std::vector{_aggregate(AggregateFunction::Sum, ColumnID{3})}, ColumnID{2});
+  const auto copy = std::dynamic_pointer_cast<GroupJoin>(group_join->deep_copy());
+  ASSERT_TRUE(copy);
+
+  EXPECT_EQ(copy->mode(), JoinMode::Inner);
+  EXPECT_EQ(copy->primary_predicate(), primary_predicate);
+  EXPECT_EQ(copy->groupby_column_id(), ColumnID{2});
+  ASSERT_EQ(copy->aggregates().size(), 1);
+  EXPECT_EQ(*copy->aggregates().front(), *group_join->aggregates().front());
+}
+
+TEST_F(OperatorsGroupJoinTest, MatchesJoinAndAggregate) {
+  const auto aggregates = std::vector{_aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+                                      _aggregate(AggregateFunction::Count, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Sum, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Avg, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Min, ColumnID{4}),
+                                      _aggregate(AggregateFunction::Max, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Any, ColumnID{1})};
+
+  _test_group_join(JoinMode::Inner, aggregates, ColumnID{0});
+  _test_group_join(JoinMode::Left, aggregates, ColumnID{0});
+
+  // For inner joins, grouping by the right join column is the same as grouping by the left one
+  _test_group_join(JoinMode::Inner, aggregates, ColumnID{2});
+}
+
+TEST_F(OperatorsGroupJoinTest, NoMatches) {
+  const auto empty_table = Table::create_dummy_table(_right_input->get_output()->column_definitions());
+  _right_input = std::make_shared<TableWrapper>(empty_table);
+  _right_input->execute();
+
+  const auto aggregates = std::vector{_aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+                                      _aggregate(AggregateFunction::Sum, ColumnID{3})};
+  _test_group_join(JoinMode::Inner, aggregates, ColumnID{0});
+  _test_group_join(JoinMode::Left, aggregates, ColumnID{0});
+}
+
+TEST_F(OperatorsGroupJoinTest, MatchesJoinAndAggregateMultiThreaded) {
+  // The inputs are large enough to be built and probed in multiple tasks (see GroupJoin::JOB_SPAWN_THRESHOLD)
+  const auto left_table = std::make_shared<Table>(_left_input->get_output()->column_definitions(), TableType::Data,
+                                                  ChunkOffset{1'000});
+  for (auto row_idx = int32_t{0}; row_idx < 30'000; ++row_idx) {
+    // As ANY(x) may return any row of a group, x is the same for all rows of a group
+    if (row_idx % 97 == 0) {
+      left_table->append({NullValue{}, -1});
+    } else {
+      left_table->append({row_idx % 3'000, row_idx % 3'000 * 10});
+    }
+  }
+
+  const auto right_table = std::make_shared<Table>(_right_input->get_output()->column_definitions(), TableType::Data,
+                                                   ChunkOffset{1'000});
+  for (auto row_idx = int32_t{0}; row_idx < 50'000; ++row_idx) {
+    const auto key = row_idx % 89 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_idx % 4'000};
+    const auto value = row_idx % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_idx % 100};
+    right_table->append({key, value, pmr_string{std::to_string(row_idx % 500)}});
+  }
+
+  _left_input = std::make_shared<TableWrapper>(left_table);
+  _right_input = std::make_shared<TableWrapper>(right_table);
+  _left_input->execute();
+  _right_input->execute();
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto aggregates = std::vector{_aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+                                      _aggregate(AggregateFunction::Count, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Sum, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Avg, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Min, ColumnID{4}),
+                                      _aggregate(AggregateFunction::Max, ColumnID{3}),
+                                      _aggregate(AggregateFunction::Any, ColumnID{1})};
+
+  _test_group_join(JoinMode::Inner, aggregates, ColumnID{0});
+  _test_group_join(JoinMode::Left, aggregates, ColumnID{0});
+  _test_group_join(JoinMode::Inner, aggregates, ColumnID{2});
+}
+
+}  // namespace opossum
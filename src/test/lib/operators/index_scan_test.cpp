@@ -21,6 +21,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -308,4 +309,145 @@ TYPED_TEST(OperatorsIndexScanTest, AddedChunk) {
                             load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
 }
 
+// HashIndexes only support equality lookups and are therefore tested separately
+class OperatorsIndexScanHashIndexTest : public OperatorsIndexScanTest<HashIndex> {};
+
+TEST_F(OperatorsIndexScanHashIndexTest, SingleColumnScanOnDataTable) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, test.first, right_values);
+    scan->execute();
+
+    auto scan_small_chunk =
+        std::make_shared<IndexScan>(_int_int_small_chunk, _index_type, _column_ids, test.first, right_values);
+    scan_small_chunk->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+    ASSERT_COLUMN_EQ(scan_small_chunk->get_output(), ColumnID{1u}, test.second);
+  }
+
+  // Values that the column cannot hold have no matches
+  auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, PredicateCondition::Equals,
+                                          std::vector<AllTypeVariant>{AllTypeVariant{4.5}});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIndexScanHashIndexTest, RangeScanThrows) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+  auto scan =
+      std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, PredicateCondition::LessThan, right_values);
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
+class OperatorsIndexScanTableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+    table->create_table_index(ColumnID{0});
+    Hyrise::get().storage_manager.add_table("table_index_test_table", table);
+  }
+
+  static std::shared_ptr<IndexScan> index_scan(const std::shared_ptr<GetTable>& get_table,
+                                               const PredicateCondition predicate_condition,
+                                               const std::vector<AllTypeVariant>& right_values,
+                                               const std::vector<AllTypeVariant>& right_values2 = {}) {
+    if (!get_table->get_output()) get_table->execute();
+    auto scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::Invalid, std::vector<ColumnID>{ColumnID{0}},
+                                            predicate_condition, right_values, right_values2);
+    scan->use_table_index = true;
+    scan->execute();
+    return scan;
+  }
+
+  static std::vector<AllTypeVariant> sorted_values(const Table& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.emplace_back(segment[chunk_offset]);
+      }
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsIndexScanTableIndexTest, ScanAllChunks) {
+  const auto get_table = std::make_shared<GetTable>("table_index_test_table");
+
+  const auto equals_scan = index_scan(get_table, PredicateCondition::Equals, {4});
+  EXPECT_EQ(sorted_values(*equals_scan->get_output(), ColumnID{1}), std::vector<AllTypeVariant>({104, 104}));
+
+  // The output has one chunk per input chunk with matches, so that each pos list references a single chunk
+  const auto& output = *equals_scan->get_output();
+  ASSERT_EQ(output.chunk_count(), 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::static_pointer_cast<const ReferenceSegment>(output.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    EXPECT_TRUE(segment->pos_list()->references_single_chunk());
+    EXPECT_EQ(segment->referenced_table(), get_table->get_output());
+  }
+
+  const auto less_than_scan = index_scan(get_table, PredicateCondition::LessThan, {4});
+  EXPECT_EQ(sorted_values(*less_than_scan->get_output(), ColumnID{1}),
+            std::vector<AllTypeVariant>({100, 100, 102, 102}));
+
+  const auto between_scan = index_scan(get_table, PredicateCondition::BetweenExclusive, {8}, {12});
+  EXPECT_EQ(sorted_values(*between_scan->get_output(), ColumnID{1}), std::vector<AllTypeVariant>({110, 110}));
+
+  const auto no_matches_scan = index_scan(get_table, PredicateCondition::Equals, {5});
+  EXPECT_EQ(no_matches_scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIndexScanTableIndexTest, PrunedChunksAndColumns) {
+  // Matches in the first chunk are dropped, the column IDs of the index scan refer to the input of the scan
+  const auto column_definitions = TableColumnDefinitions{{"z", DataType::Int, false}, {"a", DataType::Int, false}};
+  const auto pruned_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  pruned_table->append({1, 4});
+  pruned_table->append({2, 6});
+  pruned_table->append({3, 4});
+  pruned_table->create_table_index(ColumnID{1});
+  Hyrise::get().storage_manager.add_table("pruned_table", pruned_table);
+
+  const auto get_table = std::make_shared<GetTable>("pruned_table", std::vector<ChunkID>{ChunkID{0}},
+                                                    std::vector<ColumnID>{ColumnID{0}});
+  const auto scan = index_scan(get_table, PredicateCondition::Equals, {4});
+
+  const auto& output = *scan->get_output();
+  ASSERT_EQ(output.row_count(), 1u);
+  const auto segment =
+      std::static_pointer_cast<const ReferenceSegment>(output.get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ((*segment->pos_list())[0], (RowID{ChunkID{0}, ChunkOffset{0}}));
+  EXPECT_EQ((*segment)[0], AllTypeVariant{4});
+}
+
+TEST_F(OperatorsIndexScanTableIndexTest, LQPTranslation) {
+  // A TableIndex covers all chunks, so that no TableScan is needed
+  const auto stored_table_node = StoredTableNode::make("table_index_test_table");
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("a"), 4), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  const auto index_scan = std::dynamic_pointer_cast<IndexScan>(pqp);
+  ASSERT_TRUE(index_scan);
+  EXPECT_TRUE(index_scan->use_table_index);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(index_scan->left_input()));
+
+  // Rows of chunks that are added later are found as well
+  table->append({4, 5});
+  const auto copied_pqp = pqp->deep_copy();
+  copied_pqp->mutable_left_input()->execute();
+  copied_pqp->execute();
+  EXPECT_EQ(sorted_values(*copied_pqp->get_output(), ColumnID{1}), std::vector<AllTypeVariant>({5, 104, 104}));
+}
+
 }  // namespace opossum
@@ -83,6 +83,44 @@ TEST_F(OperatorsInsertTest, InsertRespectChunkSize) {
   EXPECT_EQ(table->row_count(), 13u);
 }
 
+TEST_F(OperatorsInsertTest, InsertRespectChangedChunkSize) {
+  // 3 Rows in a mutable chunk of 4 rows
+  auto table = load_table("resources/test_data/tbl/int.tbl", 4u, FinalizeLastChunk::No);
+  Hyrise::get().storage_manager.add_table("test1", table);
+
+  // 10 Rows
+  auto table2 = load_table("resources/test_data/tbl/10_ints.tbl");
+  Hyrise::get().storage_manager.add_table("test2", table2);
+
+  const auto insert_rows = [&]() {
+    auto get_table2 = std::make_shared<GetTable>("test2");
+    get_table2->execute();
+
+    auto insert = std::make_shared<Insert>("test1", get_table2);
+    auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  };
+
+  // The mutable chunk is filled up to the size it was allocated with, the following chunks have the new size
+  table->set_target_chunk_size(8);
+  insert_rows();
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 8u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1u);
+
+  // The mutable chunk, which was allocated with 8 rows, is full once it reaches the new size
+  table->set_target_chunk_size(3);
+  insert_rows();
+  EXPECT_EQ(table->chunk_count(), 6u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{5})->size(), 2u);
+  EXPECT_EQ(table->row_count(), 23u);
+}
+
 TEST_F(OperatorsInsertTest, MultipleChunks) {
   auto table_name = "test1";
   auto table_name2 = "test2";
@@ -0,0 +1,103 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/intersect.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIntersectTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left = create_table_wrapper({{1, "x"},
+                                  {1, "x"},
+                                  {NULL_VALUE, "y"},
+                                  {1, "x"},
+                                  {2, "x"},
+                                  {NULL_VALUE, "y"},
+                                  {1, "y"},
+                                  {3, "z"}});
+    _right = create_table_wrapper({{NULL_VALUE, "y"}, {1, "x"}, {4, "x"}, {1, "x"}, {3, "z"}, {1, "z"}});
+  }
+
+  // Creates a table with an int and a string column and two rows per chunk
+  static std::shared_ptr<Table> create_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> create_table_wrapper(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(create_table(rows));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsIntersectTest, Unique) {
+  const auto intersect = std::make_shared<Intersect>(_left, _right, SetOperationMode::Unique);
+  intersect->execute();
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), create_table({{1, "x"}, {NULL_VALUE, "y"}, {3, "z"}}));
+}
+
+TEST_F(OperatorsIntersectTest, All) {
+  const auto intersect = std::make_shared<Intersect>(_left, _right, SetOperationMode::All);
+  intersect->execute();
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(),
+                            create_table({{1, "x"}, {1, "x"}, {NULL_VALUE, "y"}, {3, "z"}}));
+}
+
+TEST_F(OperatorsIntersectTest, Positions) {
+  const auto intersect = std::make_shared<Intersect>(_left, _right, SetOperationMode::Positions);
+  intersect->execute();
+  EXPECT_TABLE_EQ_UNORDERED(
+      intersect->get_output(),
+      create_table({{1, "x"}, {1, "x"}, {NULL_VALUE, "y"}, {1, "x"}, {NULL_VALUE, "y"}, {3, "z"}}));
+}
+
+TEST_F(OperatorsIntersectTest, ReferenceInput) {
+  const auto table_scan = create_table_scan(_left, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  table_scan->execute();
+
+  const auto intersect = std::make_shared<Intersect>(table_scan, _right, SetOperationMode::Unique);
+  intersect->execute();
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), create_table({{3, "z"}}));
+
+  // The output references the original table, not the output of the scan
+  const auto& output_table = intersect->get_output();
+  ASSERT_EQ(output_table->chunk_count(), 1);
+  const auto& reference_segment =
+      static_cast<const ReferenceSegment&>(*output_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ(reference_segment.referenced_table(), _left->get_output());
+}
+
+TEST_F(OperatorsIntersectTest, PositionsForwardSortedByFlag) {
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition(ColumnID{0})};
+  const auto sort = std::make_shared<Sort>(_left, sort_definitions, ChunkOffset{2});
+  sort->execute();
+
+  const auto intersect = std::make_shared<Intersect>(sort, _right, SetOperationMode::Positions);
+  intersect->execute();
+
+  const auto& output_table = intersect->get_output();
+  EXPECT_EQ(output_table->row_count(), 6);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output_table->get_chunk(chunk_id)->individually_sorted_by(), sort_definitions);
+  }
+}
+
+}  // namespace opossum
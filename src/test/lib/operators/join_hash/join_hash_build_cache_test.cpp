@@ -0,0 +1,121 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_build_cache.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinHashBuildCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("build", load_table("resources/test_data/tbl/int_int3.tbl", 3));
+    Hyrise::get().storage_manager.add_table("probe", load_table("resources/test_data/tbl/int_int4.tbl", 3));
+    Hyrise::get().join_hash_build_cache = std::make_shared<JoinHashBuildCache>();
+  }
+
+  // Returns a GetTable followed by a Validate, which has its LQP set like the LQPTranslator does
+  std::shared_ptr<AbstractOperator> _validated_table(const std::string& table_name) {
+    auto validate = std::make_shared<Validate>(std::make_shared<GetTable>(table_name));
+    validate->lqp_node = ValidateNode::make(StoredTableNode::make(table_name));
+    return validate;
+  }
+
+  // Joins the build with the probe table in a new transaction. Build is smaller and becomes the build side.
+  std::shared_ptr<JoinHash> _execute_join() {
+    const auto join = std::make_shared<JoinHash>(
+        _validated_table("build"), _validated_table("probe"), JoinMode::Inner,
+        OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+    join->set_transaction_context_recursively(transaction_context);
+    execute_all({join->mutable_left_input()->mutable_left_input(), join->mutable_left_input(),
+                 join->mutable_right_input()->mutable_left_input(), join->mutable_right_input(), join});
+    transaction_context->commit();
+
+    return join;
+  }
+
+  static bool _build_side_is_cached(const JoinHash& join) {
+    return static_cast<const JoinHash::PerformanceData&>(*join.performance_data).build_side_is_cached;
+  }
+};
+
+TEST_F(JoinHashBuildCacheTest, ReuseBuildSide) {
+  const auto first_join = _execute_join();
+  EXPECT_FALSE(_build_side_is_cached(*first_join));
+  EXPECT_EQ(Hyrise::get().join_hash_build_cache->size(), 1);
+
+  const auto second_join = _execute_join();
+  EXPECT_TRUE(_build_side_is_cached(*second_join));
+  EXPECT_EQ(Hyrise::get().join_hash_build_cache->size(), 1);
+
+  EXPECT_TABLE_EQ_UNORDERED(second_join->get_output(), first_join->get_output());
+}
+
+TEST_F(JoinHashBuildCacheTest, NoReuseAfterCommit) {
+  const auto first_join = _execute_join();
+  EXPECT_EQ(first_join->get_output()->row_count(), 8);
+
+  // Insert a row with a join partner into the build table. This changes the snapshot of later transactions.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto new_row = std::make_shared<Table>(column_definitions, TableType::Data);
+  new_row->append({0, 100});
+  const auto table_wrapper = std::make_shared<TableWrapper>(new_row);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("build", table_wrapper);
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  const auto second_join = _execute_join();
+  EXPECT_FALSE(_build_side_is_cached(*second_join));
+  EXPECT_EQ(second_join->get_output()->row_count(), 10);
+  EXPECT_EQ(Hyrise::get().join_hash_build_cache->size(), 2);
+}
+
+TEST_F(JoinHashBuildCacheTest, NoCacheWithoutTransactionContext) {
+  const auto join = std::make_shared<JoinHash>(
+      _validated_table("build"), _validated_table("probe"), JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  join->mutable_left_input()->set_transaction_context_recursively(transaction_context);
+  join->mutable_right_input()->set_transaction_context_recursively(transaction_context);
+  execute_all({join->mutable_left_input()->mutable_left_input(), join->mutable_left_input(),
+               join->mutable_right_input()->mutable_left_input(), join->mutable_right_input(), join});
+
+  EXPECT_EQ(Hyrise::get().join_hash_build_cache->size(), 0);
+}
+
+TEST_F(JoinHashBuildCacheTest, CacheableBuildInputs) {
+  const auto stored_table_node = StoredTableNode::make("build");
+  const auto a = stored_table_node->get_column("a");
+
+  EXPECT_TRUE(join_hash_build_input_is_cacheable(ValidateNode::make(stored_table_node)));
+  EXPECT_TRUE(join_hash_build_input_is_cacheable(
+      PredicateNode::make(greater_than_(a, 5), ValidateNode::make(stored_table_node))));
+
+  // Not validated
+  EXPECT_FALSE(join_hash_build_input_is_cacheable(stored_table_node));
+  EXPECT_FALSE(join_hash_build_input_is_cacheable(MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}})));
+  EXPECT_FALSE(join_hash_build_input_is_cacheable(nullptr));
+
+  // The value of the placeholder is not part of the LQP
+  EXPECT_FALSE(join_hash_build_input_is_cacheable(
+      PredicateNode::make(greater_than_(a, placeholder_(ParameterID{0})), ValidateNode::make(stored_table_node))));
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <numeric>
 
 #include "base_test.hpp"
 
@@ -75,6 +76,24 @@ TEST_F(JoinHashStepsTest, SmallHashTableAllPositions) {
   }
 }
 
+TEST_F(JoinHashStepsTest, HashTableGrowsBeyondEstimatedDistinctCount) {
+  // The estimate is too small, so that the hash table has to grow
+  auto table = PosHashTable<int>{JoinHashBuildMode::AllPositions, 100, 2};
+  for (auto i = 0; i < 50; ++i) {
+    table.emplace(i, RowID{ChunkID{0}, ChunkOffset{2} * i});
+    table.emplace(i, RowID{ChunkID{0}, ChunkOffset{2} * i + 1});
+  }
+  table.finalize();
+
+  for (auto i = 0; i < 50; ++i) {
+    auto [iter, end] = table.find(i);
+    const auto materialized_result = RowIDPosList{iter, end};
+    EXPECT_EQ(materialized_result, RowIDPosList({RowID{ChunkID{0}, ChunkOffset{2} * i},
+                                                 RowID{ChunkID{0}, ChunkOffset{2} * i + 1}}));
+  }
+  EXPECT_FALSE(table.contains(50));
+}
+
 TEST_F(JoinHashStepsTest, LargeHashTableExistenceOnly) {
   auto table = PosHashTable<int>{JoinHashBuildMode::ExistenceOnly, 100};
   for (auto i = 0; i < 100; ++i) {
@@ -93,6 +112,47 @@ TEST_F(JoinHashStepsTest, LargeHashTableExistenceOnly) {
   }
 }
 
+TEST_F(JoinHashStepsTest, HashTableExistenceBitmap) {
+  auto table = PosHashTable<int>{JoinHashBuildMode::ExistenceOnly, 4};
+  table.use_existence_bitmap(-5, 100);
+  for (const auto value : {-5, 0, 42, 100}) {
+    table.emplace(value, RowID{ChunkID{0}, ChunkOffset{0}});
+  }
+  table.finalize();
+
+  EXPECT_TRUE(table.uses_existence_bitmap());
+  for (const auto value : {-5, 0, 42, 100}) {
+    EXPECT_TRUE(table.contains(value));
+  }
+  for (const auto value : {std::numeric_limits<int>::lowest(), -6, 41, 101, std::numeric_limits<int>::max()}) {
+    EXPECT_FALSE(table.contains(value));
+  }
+}
+
+TEST_F(JoinHashStepsTest, BuildExistenceBitmapForDenseValues) {
+  std::vector<std::vector<size_t>> histograms;  // Ignored in this test
+  BloomFilter output_bloom_filter;              // Ignored in this test
+
+  // The table holds the values 0 and 1
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table_zero_one);
+  table_wrapper->execute();
+  auto container =
+      materialize_input<int, int, false>(table_wrapper->get_output(), ColumnID{0}, histograms, 0, output_bloom_filter);
+
+  const auto hash_tables = build<int, int>(container, JoinHashBuildMode::ExistenceOnly, 0, ALL_TRUE_BLOOM_FILTER);
+  ASSERT_EQ(hash_tables.size(), 1);
+  EXPECT_TRUE(hash_tables[0]->uses_existence_bitmap());
+  EXPECT_TRUE(hash_tables[0]->contains(0));
+  EXPECT_TRUE(hash_tables[0]->contains(1));
+  EXPECT_FALSE(hash_tables[0]->contains(-1));
+  EXPECT_FALSE(hash_tables[0]->contains(2));
+
+  // Positions cannot be stored in the bitmap
+  const auto all_positions_hash_tables =
+      build<int, int>(container, JoinHashBuildMode::AllPositions, 0, ALL_TRUE_BLOOM_FILTER);
+  EXPECT_FALSE(all_positions_hash_tables[0]->uses_existence_bitmap());
+}
+
 TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   const size_t radix_bit_count = 0;
   std::vector<std::vector<size_t>> histograms;
@@ -162,16 +222,15 @@ TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
+    // All input values should be contained in the bloom filter
+    auto expected_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE);
     for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
-
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+      EXPECT_TRUE(bloom_filter_contains(bloom_filter, JoinHashFunction<int>{}(value), BLOOM_FILTER_MASK));
+      bloom_filter_insert(expected_bloom_filter, JoinHashFunction<int>{}(value), BLOOM_FILTER_MASK);
     }
 
     // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    EXPECT_EQ(bloom_filter, expected_bloom_filter);
   }
 }
 
@@ -183,7 +242,7 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
     // Fill input_bloom_filter
     BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      bloom_filter_insert(input_bloom_filter, JoinHashFunction<int>{}(value), BLOOM_FILTER_MASK);
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -208,44 +267,28 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
 }
 
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
-  {
+  // The radix clusters are determined by the least significant bits of the hashed value. For the 0/1 table, each
+  // chunk holds _chunk_size_zero_one / 2 zeros and ones, which go to the clusters of their hashes.
+  const auto hash_function = JoinHashFunction<int>{};
+  for (const auto radix_bit_count : {size_t{1}, size_t{2}}) {
     std::vector<std::vector<size_t>> histograms;
     BloomFilter bloom_filter;  // Ignored in this test
 
-    // When using 1 bit for radix partitioning, we have two radix clusters determined on the least
-    // significant bit. For the 0/1 table, we should thus cluster the ones and the zeros.
-    materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 1, bloom_filter);
+    materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, radix_bit_count, bloom_filter);
+
+    const auto radix_mask = (size_t{1} << radix_bit_count) - 1;
+    auto expected_histogram = std::vector<size_t>(size_t{1} << radix_bit_count);
+    expected_histogram[hash_function(0) & radix_mask] += this->_chunk_size_zero_one / 2;
+    expected_histogram[hash_function(1) & radix_mask] += this->_chunk_size_zero_one / 2;
+
     size_t histogram_offset_sum = 0;
     EXPECT_EQ(histograms.size(), this->_table_size_zero_one / this->_chunk_size_zero_one);
     for (const auto& radix_count_per_chunk : histograms) {
-      for (auto count : radix_count_per_chunk) {
-        EXPECT_EQ(count, this->_chunk_size_zero_one / 2);
-        histogram_offset_sum += count;
-      }
+      EXPECT_EQ(radix_count_per_chunk, expected_histogram);
+      histogram_offset_sum += std::accumulate(radix_count_per_chunk.begin(), radix_count_per_chunk.end(), size_t{0});
     }
     EXPECT_EQ(histogram_offset_sum, _table_zero_one->row_count());
   }
-
-  {
-    std::vector<std::vector<size_t>> histograms;
-    BloomFilter bloom_filter;  // Ignored in this test
-
-    // When using 2 bits for radix partitioning, we have four radix clusters determined on the two least
-    // significant bits. For the 0/1 table, we expect two non-empty clusters (00/01) and two empty ones (10/11).
-    // Since the radix clusters are determine by hashing the value, we do not know in which cluster
-    // the values are going to be stored.
-    size_t empty_cluster_count = 0;
-    materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 2, bloom_filter);
-    for (const auto& radix_count_per_chunk : histograms) {
-      for (auto count : radix_count_per_chunk) {
-        // Again, due to the hashing, we do not know which cluster holds the value
-        // But we know that two buckets have _table_size_zero_one/2 items and two have none items.
-        EXPECT_TRUE(count == this->_chunk_size_zero_one / 2 || count == 0);
-        if (count == 0) ++empty_cluster_count;
-      }
-    }
-    EXPECT_EQ(empty_cluster_count, 2 * this->_table_size_zero_one / this->_chunk_size_zero_one);
-  }
 }
 
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
@@ -283,7 +326,7 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   // Fill input_bloom_filter
   BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    bloom_filter_insert(input_bloom_filter, JoinHashFunction<int>{}(value), BLOOM_FILTER_MASK);
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -302,6 +345,52 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   EXPECT_FALSE(hash_table->contains(18));
 }
 
+TEST_F(JoinHashStepsTest, PartitionRespectsBloomFilter) {
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter output_bloom_filter;  // Ignored in this test
+
+  auto input_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE);
+  for (auto value : std::vector<int>{6, 7, 9}) {
+    bloom_filter_insert(input_bloom_filter, JoinHashFunction<int>{}(value), BLOOM_FILTER_MASK);
+  }
+
+  const auto radix_bit_count = size_t{1};
+  const auto materialized = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
+                                                               histograms, radix_bit_count, output_bloom_filter);
+  auto filtered_histograms = histograms;
+  const auto unfiltered = partition_by_radix<int, int, false>(materialized, histograms, radix_bit_count);
+  const auto filtered =
+      partition_by_radix<int, int, false>(materialized, filtered_histograms, radix_bit_count, input_bloom_filter);
+
+  ASSERT_EQ(filtered.size(), unfiltered.size());
+  for (auto partition_idx = size_t{0}; partition_idx < filtered.size(); ++partition_idx) {
+    // Filtering removes the values that are not in the bloom filter but keeps the order of the remaining values
+    auto expected_elements = std::vector<PartitionedElement<int>>{};
+    for (const auto& element : unfiltered[partition_idx].elements) {
+      if (element.value == 6 || element.value == 7 || element.value == 9) expected_elements.emplace_back(element);
+    }
+
+    const auto& elements = filtered[partition_idx].elements;
+    ASSERT_EQ(elements.size(), expected_elements.size());
+    for (auto element_idx = size_t{0}; element_idx < elements.size(); ++element_idx) {
+      EXPECT_EQ(elements[element_idx].value, expected_elements[element_idx].value);
+      EXPECT_EQ(elements[element_idx].row_id, expected_elements[element_idx].row_id);
+    }
+  }
+}
+
+TEST_F(JoinHashStepsTest, BloomFilterSelectivity) {
+  auto bloom_filter = BloomFilter(BLOOM_FILTER_SIZE);
+  EXPECT_TRUE(bloom_filter_is_selective(bloom_filter));
+
+  for (auto value = 0; value < BLOOM_FILTER_SIZE / 2; ++value) {
+    bloom_filter[value] = true;
+  }
+  EXPECT_TRUE(bloom_filter_is_selective(bloom_filter));
+
+  EXPECT_FALSE(bloom_filter_is_selective(ALL_TRUE_BLOOM_FILTER));
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
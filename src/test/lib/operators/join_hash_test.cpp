@@ -1,7 +1,15 @@
+#include <functional>
+#include <optional>
+
 #include "base_test.hpp"
 
+#include "concurrency/query_context.hpp"
+#include "hyrise.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -108,6 +116,216 @@ TEST_F(OperatorsJoinHashTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillPartitionsUnderMemoryPressure) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto reference_join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner,
+                                                         primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+  reference_join->execute();
+
+  // The partitions and hash tables of the join are larger than the memory limit, but each partition fits into it
+  const auto query_context = std::make_shared<QueryContext>("SELECT ...", 0, 40'000);
+  const auto join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner,
+                                               primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+  join->set_query_context_recursively(query_context);
+  join->execute();
+  _table_tpch_orders->set_query_context_recursively(nullptr);
+  _table_tpch_lineitems->set_query_context_recursively(nullptr);
+
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*join->performance_data);
+  EXPECT_GT(performance_data.spilled_bytes, 0u);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), reference_join->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, JoinOnDictionaryValueIDs) {
+  // Creates a string table with chunks of four rows. If `dictionary_encoded` is set, the chunks are encoded with a
+  // dictionary each, and the dictionaries of `shared_dictionary_chunk_count` chunks are merged.
+  const auto create_table = [](const std::vector<std::optional<std::string>>& values, const bool dictionary_encoded,
+                               const size_t shared_dictionary_chunk_count = 0) {
+    auto table =
+        std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String, true}}, TableType::Data, ChunkOffset{4});
+    for (const auto& value : values) {
+      table->append({value ? AllTypeVariant{pmr_string{*value}} : NULL_VALUE});
+    }
+    table->last_chunk()->finalize();
+
+    if (dictionary_encoded) {
+      ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+      auto chunk_ids = std::vector<ChunkID>{};
+      for (auto chunk_id = ChunkID{0}; chunk_id < shared_dictionary_chunk_count; ++chunk_id) {
+        chunk_ids.emplace_back(chunk_id);
+      }
+      if (!chunk_ids.empty()) ChunkEncoder::merge_dictionaries(table, ColumnID{0}, chunk_ids);
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto build_values = std::vector<std::optional<std::string>>{"b", "d", "f", "h", "d", "b", std::nullopt, "f",
+                                                                    "j", "h", "d", "b", "f", "f", "b", "b"};
+  const auto probe_values = std::vector<std::optional<std::string>>{
+      "a", "b", "c", "a", "d", std::nullopt, "b", "d", "x", "x", "x", "j", "h", "h", "h", "h", "b", "c", "c", "b"};
+  const auto build_table = create_table(build_values, true, 4);
+  const auto expected_build_table = create_table(build_values, false);
+  const auto probe_table = create_table(probe_values, true);
+  const auto expected_probe_table = create_table(probe_values, false);
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  using Input = std::shared_ptr<AbstractOperator>;
+  const auto test_join = [&](const Input& left, const Input& right, const Input& expected_left,
+                             const Input& expected_right, const JoinMode mode, const bool joins_on_value_ids) {
+    const auto join = std::make_shared<JoinHash>(left, right, mode, primary_predicate);
+    join->execute();
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*join->performance_data);
+    EXPECT_EQ(performance_data.joins_on_value_ids, joins_on_value_ids);
+
+    const auto expected_join = std::make_shared<JoinHash>(expected_left, expected_right, mode, primary_predicate);
+    expected_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  };
+
+  // Self-join on the shared dictionary
+  test_join(build_table, build_table, expected_build_table, expected_build_table, JoinMode::Inner, true);
+
+  // The dictionaries of the probe side are translated to the build side's dictionary, including values that do not
+  // occur on the build side (JoinHash builds the hash tables for the right input of Left and Anti joins)
+  test_join(probe_table, build_table, expected_probe_table, expected_build_table, JoinMode::Left, true);
+  test_join(probe_table, build_table, expected_probe_table, expected_build_table, JoinMode::AntiNullAsTrue, true);
+  test_join(probe_table, build_table, expected_probe_table, expected_build_table, JoinMode::Semi, true);
+
+  // Reference inputs are translated via the segments they reference
+  const auto scanned_table =
+      create_table_scan(build_table, ColumnID{0}, PredicateCondition::NotEquals, pmr_string{"h"});
+  scanned_table->execute();
+  const auto expected_scanned_table =
+      create_table_scan(expected_build_table, ColumnID{0}, PredicateCondition::NotEquals, pmr_string{"h"});
+  expected_scanned_table->execute();
+  test_join(probe_table, scanned_table, expected_probe_table, expected_scanned_table, JoinMode::Inner, true);
+
+  // Without a shared dictionary on the build side, the strings are joined
+  test_join(build_table, probe_table, expected_build_table, expected_probe_table, JoinMode::Left, false);
+  const auto partially_merged_table = create_table(build_values, true, 2);
+  test_join(probe_table, partially_merged_table, expected_probe_table, expected_build_table, JoinMode::Inner, false);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinOnPackedKeys) {
+  // Tables with a composite key (w, d, o) of integral columns and a float column, which cannot be packed
+  const auto create_table = [](const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"w", DataType::Int, true},
+                                                                {"d", DataType::Long, true},
+                                                                {"o", DataType::Int, true},
+                                                                {"f", DataType::Float, true}},
+                                         TableType::Data, ChunkOffset{3});
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto left = create_table({{1, int64_t{1}, 10, 1.0f},
+                                  {1, int64_t{1}, 11, 1.0f},
+                                  {1, int64_t{2}, 10, 2.0f},
+                                  {2, int64_t{1}, 10, 1.0f},
+                                  {-3, int64_t{-5}, 12, 3.0f},
+                                  {1, NULL_VALUE, 10, 1.0f},
+                                  {NULL_VALUE, int64_t{1}, 10, 1.0f},
+                                  {1, int64_t{1}, 10, 4.0f}});
+  const auto right = create_table({{1, int64_t{1}, 10, 1.0f},
+                                   {1, int64_t{1}, 10, 1.0f},
+                                   {1, int64_t{2}, 11, 2.0f},
+                                   {2, int64_t{1}, 10, 5.0f},
+                                   {-3, int64_t{-5}, 12, 3.0f},
+                                   {1, int64_t{1}, NULL_VALUE, 1.0f},
+                                   {7, int64_t{1'000'000}, 10, 1.0f}});
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto test_join = [&](const JoinMode mode, const std::vector<OperatorJoinPredicate>& secondary_predicates,
+                             const size_t packed_predicate_count) {
+    const auto join = std::make_shared<JoinHash>(left, right, mode, primary_predicate, secondary_predicates);
+    join->execute();
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*join->performance_data);
+    EXPECT_EQ(performance_data.packed_predicate_count, packed_predicate_count);
+
+    const auto expected_join =
+        std::make_shared<JoinNestedLoop>(left, right, mode, primary_predicate, secondary_predicates);
+    expected_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  };
+
+  const auto d_equals = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto o_equals = OperatorJoinPredicate{{ColumnID{2}, ColumnID{2}}, PredicateCondition::Equals};
+  const auto f_equals = OperatorJoinPredicate{{ColumnID{3}, ColumnID{3}}, PredicateCondition::Equals};
+  const auto o_less_than = OperatorJoinPredicate{{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    test_join(mode, {d_equals, o_equals}, 3);
+
+    // Predicates that cannot be packed are still evaluated for each candidate pair
+    test_join(mode, {d_equals, f_equals}, 2);
+    test_join(mode, {o_less_than, d_equals}, 2);
+    test_join(mode, {f_equals}, 0);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, ProbeInBatches) {
+  // The partitions are probed in batches of PROBE_BATCH_SIZE elements. The probe side has more rows than a batch and
+  // its row count is not a multiple of the batch size. Some batches contain only misses, some only matches (including
+  // values that match several rows), and NULL values are spread over them.
+  const auto create_table = [](const size_t row_count, const std::function<std::optional<int32_t>(int32_t)>& value) {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10});
+    for (auto row_idx = int32_t{0}; row_idx < static_cast<int32_t>(row_count); ++row_idx) {
+      const auto row_value = value(row_idx);
+      table->append({row_value ? AllTypeVariant{*row_value} : NULL_VALUE, row_idx % 3});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto probe_row_count = PROBE_BATCH_SIZE * 5 + 3;
+  const auto left = create_table(probe_row_count, [](const int32_t row_idx) -> std::optional<int32_t> {
+    if (row_idx % 7 == 0) return std::nullopt;
+    if (row_idx >= static_cast<int32_t>(PROBE_BATCH_SIZE) && row_idx < static_cast<int32_t>(2 * PROBE_BATCH_SIZE)) {
+      return 1'000 + row_idx;
+    }
+    return row_idx % 11;
+  });
+  const auto right = create_table(PROBE_BATCH_SIZE + 5, [](const int32_t row_idx) -> std::optional<int32_t> {
+    if (row_idx == 3) return std::nullopt;
+    return row_idx % 8;
+  });
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::AntiNullAsFalse,
+                          JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+      for (const auto& secondary_predicates : {std::vector<OperatorJoinPredicate>{},
+                                               std::vector<OperatorJoinPredicate>{secondary_predicate}}) {
+        // Secondary predicates are not supported for AntiNullAsTrue
+        if (mode == JoinMode::AntiNullAsTrue && !secondary_predicates.empty()) continue;
+
+        const auto join =
+            std::make_shared<JoinHash>(left, right, mode, primary_predicate, secondary_predicates, radix_bits);
+        join->execute();
+
+        const auto expected_join =
+            std::make_shared<JoinNestedLoop>(left, right, mode, primary_predicate, secondary_predicates);
+        expected_join->execute();
+        EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+      }
+    }
+  }
+}
+
 TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   // Simple tests to check that side switching and zero-sizes work.
   EXPECT_EQ(JoinHash::calculate_radix_bits<int32_t>(1, 0, JoinMode::Inner), 0ul);
@@ -116,6 +334,25 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   EXPECT_EQ(JoinHash::calculate_radix_bits<int32_t>(1, 1, JoinMode::Inner), 0ul);
   EXPECT_TRUE(JoinHash::calculate_radix_bits<int32_t>(std::numeric_limits<size_t>::max(),
                                                       std::numeric_limits<size_t>::max(), JoinMode::Inner) > 0ul);
+
+  // Smaller caches lead to more partitions
+  Hyrise::get().topology.set_l2_cache_size(size_t{1'024'000});
+  const auto radix_bits_large_cache = JoinHash::calculate_radix_bits<int32_t>(10'000'000, 10'000'000, JoinMode::Inner);
+  Hyrise::get().topology.set_l2_cache_size(size_t{128'000});
+  const auto radix_bits_small_cache = JoinHash::calculate_radix_bits<int32_t>(10'000'000, 10'000'000, JoinMode::Inner);
+  EXPECT_GT(radix_bits_small_cache, radix_bits_large_cache);
+}
+
+TEST_F(OperatorsJoinHashTest, BloomFilterSizeCalculation) {
+  Hyrise::get().topology.set_l2_cache_size(size_t{1'024'000});
+  EXPECT_EQ(JoinHash::calculate_bloom_filter_size(0), MIN_BLOOM_FILTER_SIZE);
+  EXPECT_EQ(JoinHash::calculate_bloom_filter_size(100), MIN_BLOOM_FILTER_SIZE);
+  EXPECT_EQ(JoinHash::calculate_bloom_filter_size(100'000), size_t{1} << 20);
+
+  // The filter does not exceed half of the L2 cache (here: 4'096'000 bits, rounded down to a power of two)
+  EXPECT_EQ(JoinHash::calculate_bloom_filter_size(std::numeric_limits<size_t>::max()), size_t{1} << 21);
+  Hyrise::get().topology.set_l2_cache_size(size_t{128'000});
+  EXPECT_EQ(JoinHash::calculate_bloom_filter_size(std::numeric_limits<size_t>::max()), size_t{1} << 18);
 }
 
 }  // namespace opossum
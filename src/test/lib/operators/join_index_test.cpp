@@ -7,12 +7,15 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table/table_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -259,4 +262,33 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, JoinWithTableIndex) {
+  // The index side is read by a GetTable whose stored table has a TableIndex (and no chunk indexes). Pruning the first
+  // chunk checks that the RowIDs of the stored table are mapped to the chunks of the GetTable output.
+  const auto table = load_table("resources/test_data/tbl/int_float_null_2.tbl", 3);
+  table->create_table_index(ColumnID{0});
+  Hyrise::get().storage_manager.add_table("table_with_table_index", table);
+
+  for (const auto& pruned_chunk_ids : {std::vector<ChunkID>{}, std::vector<ChunkID>{ChunkID{0}}}) {
+    const auto get_table =
+        std::make_shared<GetTable>("table_with_table_index", pruned_chunk_ids, std::vector<ColumnID>{});
+    get_table->execute();
+
+    for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+      for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+        EXPECT_TRUE(JoinIndex::uses_table_index(mode, IndexSide::Right));
+        test_join_output(_table_wrapper_h_no_index, get_table, {{ColumnID{0}, ColumnID{0}}, predicate_condition}, mode,
+                         1);
+      }
+      test_join_output(get_table, _table_wrapper_h_no_index, {{ColumnID{0}, ColumnID{0}}, predicate_condition},
+                       JoinMode::Inner, 1, true, IndexSide::Left);
+    }
+  }
+
+  // Unmatched rows of the index side cannot be tracked with a TableIndex
+  EXPECT_FALSE(JoinIndex::uses_table_index(JoinMode::FullOuter, IndexSide::Right));
+  EXPECT_FALSE(JoinIndex::uses_table_index(JoinMode::Semi, IndexSide::Left));
+  EXPECT_FALSE(JoinIndex::uses_table_index(JoinMode::AntiNullAsTrue, IndexSide::Right));
+}
+
 }  // namespace opossum
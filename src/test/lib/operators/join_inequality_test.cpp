@@ -0,0 +1,119 @@
+#include "base_test.hpp"
+
+#include "operators/join_inequality.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsJoinInequalityTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto dummy_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+    dummy_input = std::make_shared<TableWrapper>(dummy_table);
+
+    // Intervals [start, end] on the left and points on the right, with NULLs in both inputs
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}};
+    const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{7});
+    const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5});
+    for (auto value = int32_t{0}; value < 40; ++value) {
+      const auto start = (value * 17) % 31;
+      left_table->append({value % 9 == 0 ? NULL_VALUE : AllTypeVariant{start}, start + value % 6});
+      right_table->append({(value * 13) % 37, value % 11 == 0 ? NULL_VALUE : AllTypeVariant{value}});
+    }
+    left_input = std::make_shared<TableWrapper>(left_table);
+    right_input = std::make_shared<TableWrapper>(right_table);
+    left_input->execute();
+    right_input->execute();
+  }
+
+  std::shared_ptr<AbstractOperator> dummy_input, left_input, right_input;
+};
+
+TEST_F(OperatorsJoinInequalityTest, DescriptionAndName) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto secondary_predicate =
+      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThanEquals};
+
+  const auto join_operator =
+      std::make_shared<JoinInequality>(dummy_input, dummy_input, JoinMode::Inner, primary_predicate,
+                                       std::vector<OperatorJoinPredicate>{secondary_predicate});
+
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine),
+            "JoinInequality (Inner Join where Column #0 < Column #0 AND Column #0 >= Column #0)");
+
+  dummy_input->execute();
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine),
+            "JoinInequality (Inner Join where a < a AND a >= a)");
+
+  EXPECT_EQ(join_operator->name(), "JoinInequality");
+}
+
+TEST_F(OperatorsJoinInequalityTest, DeepCopy) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::NotEquals}};
+  const auto join_operator = std::make_shared<JoinInequality>(dummy_input, dummy_input, JoinMode::Left,
+                                                              primary_predicate, secondary_predicates);
+  const auto abstract_join_operator_copy = join_operator->deep_copy();
+  const auto join_operator_copy = std::dynamic_pointer_cast<JoinInequality>(abstract_join_operator_copy);
+
+  ASSERT_TRUE(join_operator_copy);
+
+  EXPECT_EQ(join_operator_copy->mode(), JoinMode::Left);
+  EXPECT_EQ(join_operator_copy->primary_predicate(), primary_predicate);
+  EXPECT_EQ(join_operator_copy->secondary_predicates(), secondary_predicates);
+  EXPECT_NE(join_operator_copy->left_input(), nullptr);
+  EXPECT_NE(join_operator_copy->right_input(), nullptr);
+}
+
+TEST_F(OperatorsJoinInequalityTest, Supports) {
+  auto configuration =
+      JoinConfiguration{JoinMode::Inner, PredicateCondition::LessThan, DataType::Int, DataType::Int, false};
+  EXPECT_TRUE(JoinInequality::supports(configuration));
+
+  configuration.predicate_condition = PredicateCondition::Equals;
+  EXPECT_FALSE(JoinInequality::supports(configuration));
+
+  configuration.predicate_condition = PredicateCondition::GreaterThanEquals;
+  configuration.right_data_type = DataType::Float;
+  EXPECT_FALSE(JoinInequality::supports(configuration));
+
+  configuration.right_data_type = DataType::Int;
+  configuration.join_mode = JoinMode::AntiNullAsTrue;
+  EXPECT_FALSE(JoinInequality::supports(configuration));
+}
+
+TEST_F(OperatorsJoinInequalityTest, BandJoin) {
+  // left.a <= right.a AND right.a <= left.b, i.e., right.a BETWEEN left.a AND left.b, plus a predicate that is
+  // neither indexed nor evaluated using the bit array
+  const auto primary_predicate =
+      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThanEquals};
+  const auto secondary_predicates = std::vector<OperatorJoinPredicate>{
+      {{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThanEquals},
+      {{ColumnID{1}, ColumnID{1}}, PredicateCondition::NotEquals}};
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                               JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+
+    for (const auto secondary_predicate_count : {size_t{0}, size_t{1}, size_t{2}}) {
+      const auto predicates = std::vector<OperatorJoinPredicate>{
+          secondary_predicates.cbegin(), secondary_predicates.cbegin() + secondary_predicate_count};
+
+      const auto join =
+          std::make_shared<JoinInequality>(left_input, right_input, join_mode, primary_predicate, predicates);
+      join->execute();
+      const auto reference_join =
+          std::make_shared<JoinNestedLoop>(left_input, right_input, join_mode, primary_predicate, predicates);
+      reference_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), reference_join->get_output());
+      const auto& performance_data = static_cast<const JoinInequality::PerformanceData&>(*join->performance_data);
+      EXPECT_EQ(performance_data.uses_bit_array, secondary_predicate_count > 0);
+    }
+  }
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "base_test.hpp"
 
+#include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
@@ -57,4 +58,42 @@ TEST_F(OperatorsJoinNestedLoopTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinNestedLoopTest, JoinsBlocksOfChunkPairs) {
+  // The right input is split into several blocks of chunks, which are joined by separate jobs. Chunk sizes that are no
+  // multiples of 64 test the last blocks of the vectorized comparison.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{70});
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'001});
+  for (auto value = int32_t{0}; value < 150; ++value) {
+    left_table->append({value % 13 == 0 ? NULL_VALUE : AllTypeVariant{value * 7 % 400}, value % 3});
+  }
+  for (auto value = int32_t{0}; value < 30'000; ++value) {
+    right_table->append({value % 101 == 0 ? NULL_VALUE : AllTypeVariant{value % 500}, value % 4});
+  }
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  left_input->execute();
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThanEquals}};
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+    const auto predicates =
+        join_mode == JoinMode::AntiNullAsTrue ? std::vector<OperatorJoinPredicate>{} : secondary_predicates;
+
+    const auto join =
+        std::make_shared<JoinNestedLoop>(left_input, right_input, join_mode, primary_predicate, predicates);
+    join->execute();
+    const auto reference_join =
+        std::make_shared<JoinHash>(left_input, right_input, join_mode, primary_predicate, predicates);
+    reference_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), reference_join->get_output());
+  }
+}
+
 }  // namespace opossum
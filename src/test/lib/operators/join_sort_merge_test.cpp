@@ -1,7 +1,10 @@
 #include "base_test.hpp"
 
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/join_sort_merge/column_materializer.hpp"
 #include "operators/projection.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
 
 namespace opossum {
@@ -117,4 +120,115 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, PresortedInputs) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5});
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5});
+  for (auto value = int32_t{0}; value < 40; ++value) {
+    left_table->append({(value * 7) % 13});
+    right_table->append({(value * 5) % 11});
+  }
+  left_table->append({NullValue{}});
+  right_table->append({NullValue{}});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+
+  // Small output chunks, so that the merge phase has to merge multiple sorted runs
+  const auto left_sort = std::make_shared<Sort>(
+      left_input, std::vector<SortColumnDefinition>{SortColumnDefinition(ColumnID{0}, SortMode::Ascending)},
+      ChunkOffset{7});
+  const auto right_sort = std::make_shared<Sort>(
+      right_input, std::vector<SortColumnDefinition>{SortColumnDefinition(ColumnID{0}, SortMode::Descending)},
+      ChunkOffset{6});
+  execute_all({left_input, right_input, left_sort, right_sort});
+
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::FullOuter}) {
+      const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+      const auto sorted_join = std::make_shared<JoinSortMerge>(left_sort, right_sort, mode, primary_predicate);
+      const auto unsorted_join = std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate);
+      sorted_join->execute();
+      unsorted_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(sorted_join->get_output(), unsorted_join->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SkewedInputs) {
+  // Half of the left rows hold the heavy hitter 7, so that its rows are spread over all clusters on the left input and
+  // copied to all clusters on the right input (or the other way around for the swapped inputs).
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto skewed_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{64});
+  const auto uniform_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{64});
+  for (auto row_id = int32_t{0}; row_id < 1'024; ++row_id) {
+    skewed_table->append({row_id % 2 == 0 ? 7 : row_id % 100, row_id});
+  }
+  for (auto row_id = int32_t{0}; row_id < 512; ++row_id) {
+    uniform_table->append({row_id % 50 == 49 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id % 150}, row_id});
+  }
+
+  const auto skewed_input = std::make_shared<TableWrapper>(skewed_table);
+  const auto uniform_input = std::make_shared<TableWrapper>(uniform_table);
+  execute_all({skewed_input, uniform_input});
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicates = std::vector<std::vector<OperatorJoinPredicate>>{
+      {}, {OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan}}};
+  const auto inputs = std::vector<std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>>{
+      {skewed_input, uniform_input}, {uniform_input, skewed_input}};
+
+  for (const auto& [left_input, right_input] : inputs) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter}) {
+      for (const auto& secondary_predicate : secondary_predicates) {
+        const auto sort_merge_join =
+            std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate, secondary_predicate);
+        const auto nested_loop_join =
+            std::make_shared<JoinNestedLoop>(left_input, right_input, mode, primary_predicate, secondary_predicate);
+        sort_merge_join->execute();
+        nested_loop_join->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(sort_merge_join->get_output(), nested_loop_join->get_output());
+      }
+    }
+  }
+
+  // The rows of the heavy hitter are spread over multiple output chunks, so that the output is not value-clustered
+  const auto join_operator =
+      std::make_shared<JoinSortMerge>(skewed_input, uniform_input, JoinMode::Inner, primary_predicate);
+  join_operator->execute();
+  EXPECT_TRUE(join_operator->get_output()->value_clustered_by().empty());
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SortMaterializedStrings) {
+  EXPECT_LT(order_preserving_string_prefix("a"), order_preserving_string_prefix("b"));
+  EXPECT_LT(order_preserving_string_prefix("ab"), order_preserving_string_prefix("b"));
+  EXPECT_LT(order_preserving_string_prefix(""), order_preserving_string_prefix("a"));
+  EXPECT_LT(order_preserving_string_prefix("z"), order_preserving_string_prefix("\xE4"));
+  // Strings that only differ after the eighth byte or in trailing null bytes have the same prefix
+  EXPECT_EQ(order_preserving_string_prefix("abcdefghX"), order_preserving_string_prefix("abcdefghY"));
+  EXPECT_EQ(order_preserving_string_prefix(pmr_string{"a"}), order_preserving_string_prefix(pmr_string{"a\0", 2}));
+
+  const auto values = std::vector<pmr_string>{"abcdefghY", "b", "abcdefghX", "", "abcdefgh", "a", pmr_string{"a\0", 2},
+                                              "abcdefghX"};
+  auto segment = MaterializedSegment<pmr_string>{};
+  for (auto index = ChunkOffset{0}; index < values.size(); ++index) {
+    segment.emplace_back(RowID{ChunkID{0}, index}, values[index]);
+  }
+
+  sort_materialized_segment(segment);
+
+  auto sorted_values = std::vector<pmr_string>{};
+  for (const auto& materialized_value : segment) {
+    sorted_values.emplace_back(materialized_value.value);
+    // The row ids are moved together with their values
+    EXPECT_EQ(values[materialized_value.row_id.chunk_offset], materialized_value.value);
+  }
+
+  auto expected_values = values;
+  std::sort(expected_values.begin(), expected_values.end());
+  EXPECT_EQ(sorted_values, expected_values);
+}
+
 }  // namespace opossum
@@ -5,6 +5,7 @@
 #include "nlohmann/json.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
+#include "operators/join_inequality.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/join_verification.hpp"
@@ -12,6 +13,7 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "utils/load_table.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -589,14 +591,17 @@ class JoinTestRunner : public BaseTestWithParam<JoinTestConfiguration> {
 
       /**
        * To sufficiently test IndexJoins, indexes have to be created. Therefore, if index_side is set in the configuration,
-       * indexes for the data table are created. The index type is either GroupKeyIndex for dictionary segments or BTreeIndex
-       * for non-dictionary segments.
+       * indexes for the data table are created. The index type is GroupKeyIndex for dictionary segments,
+       * HashIndex for run-length segments (joins with predicates other than (Not)Equals fall back to the nested loop
+       * join), and BTreeIndex for the other segments.
        */
 
       for (auto chunk_id = indexed_chunk_range.first; chunk_id < indexed_chunk_range.second; ++chunk_id) {
         for (ColumnID column_id{0}; column_id < data_table->column_count(); ++column_id) {
           if (encoding_type == EncodingType::Dictionary) {
             data_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{column_id});
+          } else if (encoding_type == EncodingType::RunLength) {
+            data_table->get_chunk(chunk_id)->create_index<HashIndex>(std::vector<ColumnID>{column_id});
           } else {
             data_table->get_chunk(chunk_id)->create_index<BTreeIndex>(std::vector<ColumnID>{column_id});
           }
@@ -771,5 +776,7 @@ INSTANTIATE_TEST_SUITE_P(JoinSortMerge, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinSortMerge>()));
 INSTANTIATE_TEST_SUITE_P(JoinIndex, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinIndex>()));
+INSTANTIATE_TEST_SUITE_P(JoinInequality, JoinTestRunner,
+                         testing::ValuesIn(JoinTestRunner::create_configurations<JoinInequality>()));
 
 }  // namespace opossum
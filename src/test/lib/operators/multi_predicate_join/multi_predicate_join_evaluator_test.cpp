@@ -0,0 +1,70 @@
+#include "base_test.hpp"
+
+#include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
+
+namespace opossum {
+
+class MultiPredicateJoinEvaluatorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Float, false}};
+    _left = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    _right = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+
+    _left->append({1, 1.0f});
+    _left->append({2, 2.0f});
+    _left->append({NULL_VALUE, 3.0f});
+    _left->append({4, 4.0f});
+    _right->append({2, 3.0f});
+    _right->append({NULL_VALUE, 1.0f});
+  }
+
+ protected:
+  std::shared_ptr<Table> _left, _right;
+  const std::vector<RowID> _left_row_ids{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                         RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{1}}};
+};
+
+TEST_F(MultiPredicateJoinEvaluatorTest, FilterLeftRows) {
+  // left.a != right.a AND left.b < right.b
+  const auto predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{0}, ColumnID{0}}, PredicateCondition::NotEquals},
+                                         {{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan}};
+  auto evaluator = MultiPredicateJoinEvaluator{*_left, *_right, JoinMode::Inner, predicates};
+  const auto right_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+
+  auto left_row_ids = _left_row_ids;
+  evaluator.filter_left_rows(left_row_ids, right_row_id);
+  EXPECT_EQ(left_row_ids, std::vector<RowID>{_left_row_ids[0]});
+
+  // The batch evaluation matches the evaluation of single pairs
+  for (const auto& left_row_id : _left_row_ids) {
+    EXPECT_EQ(evaluator.satisfies_all_predicates(left_row_id, right_row_id), left_row_id == _left_row_ids[0]);
+  }
+}
+
+TEST_F(MultiPredicateJoinEvaluatorTest, FilterLeftRowsWithNulls) {
+  const auto predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThanEquals}};
+
+  // NULLs never satisfy the predicate, except for AntiNullAsTrue
+  auto evaluator = MultiPredicateJoinEvaluator{*_left, *_right, JoinMode::Semi, predicates};
+  auto left_row_ids = _left_row_ids;
+  evaluator.filter_left_rows(left_row_ids, RowID{ChunkID{0}, ChunkOffset{0}});
+  EXPECT_EQ(left_row_ids, std::vector<RowID>({_left_row_ids[1], _left_row_ids[3]}));
+
+  left_row_ids = _left_row_ids;
+  evaluator.filter_left_rows(left_row_ids, RowID{ChunkID{0}, ChunkOffset{1}});
+  EXPECT_TRUE(left_row_ids.empty());
+
+  auto null_as_true_evaluator = MultiPredicateJoinEvaluator{*_left, *_right, JoinMode::AntiNullAsTrue, predicates};
+  left_row_ids = _left_row_ids;
+  null_as_true_evaluator.filter_left_rows(left_row_ids, RowID{ChunkID{0}, ChunkOffset{0}});
+  EXPECT_EQ(left_row_ids, std::vector<RowID>({_left_row_ids[1], _left_row_ids[2], _left_row_ids[3]}));
+
+  left_row_ids = _left_row_ids;
+  null_as_true_evaluator.filter_left_rows(left_row_ids, RowID{ChunkID{0}, ChunkOffset{1}});
+  EXPECT_EQ(left_row_ids, _left_row_ids);
+}
+
+}  // namespace opossum
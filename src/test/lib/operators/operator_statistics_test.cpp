@@ -0,0 +1,68 @@
+#include <magic_enum.hpp>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/operator_statistics.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int.tbl", 2);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorStatisticsTest, AggregatesExecutedOperators) {
+  for (auto execution_id = 0; execution_id < 2; ++execution_id) {
+    const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+    table_scan->execute();
+  }
+
+  const auto entries = Hyrise::get().operator_statistics.entries();
+  ASSERT_EQ(entries.size(), 2u);
+
+  const auto& table_scan_entry = entries.at("TableScan");
+  EXPECT_EQ(table_scan_entry.execution_count, 2u);
+  EXPECT_EQ(table_scan_entry.input_row_count, 6u);
+  EXPECT_EQ(table_scan_entry.output_row_count, 4u);
+  EXPECT_GT(table_scan_entry.output_memory_usage, 0u);
+  EXPECT_GT(table_scan_entry.walltime.count(), 0);
+  EXPECT_TRUE(table_scan_entry.step_runtimes.empty());
+
+  const auto& table_wrapper_entry = entries.at("TableWrapper");
+  EXPECT_EQ(table_wrapper_entry.execution_count, 1u);
+  EXPECT_EQ(table_wrapper_entry.input_row_count, 0u);
+  EXPECT_EQ(table_wrapper_entry.output_row_count, 3u);
+}
+
+TEST_F(OperatorStatisticsTest, StepRuntimes) {
+  const auto aggregate = std::make_shared<AggregateHash>(
+      _table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{min_(pqp_column_(ColumnID{0}, DataType::Int,
+                                                                                          false, "a"))},
+      std::initializer_list<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  const auto entries = Hyrise::get().operator_statistics.entries();
+  const auto& step_runtimes = entries.at("AggregateHash").step_runtimes;
+  ASSERT_EQ(step_runtimes.size(), magic_enum::enum_count<AggregateHash::OperatorSteps>());
+  EXPECT_EQ(step_runtimes.front().first, "GroupByKeyPartitioning");
+  EXPECT_EQ(step_runtimes.back().first, "OutputWriting");
+
+  Hyrise::get().operator_statistics.clear();
+  EXPECT_TRUE(Hyrise::get().operator_statistics.entries().empty());
+}
+
+}  // namespace opossum
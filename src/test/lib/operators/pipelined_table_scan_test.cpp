@@ -0,0 +1,105 @@
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/pipelined_table_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/adaptive_predicate_order.hpp"
+#include "operators/table_wrapper.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsPipelinedTableScanTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int_int.tbl", 2));
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+    _c = pqp_column_(ColumnID{2}, DataType::Int, false, "c");
+  }
+
+  // Compares the PipelinedTableScan with one TableScan per predicate
+  static void _test_pipelined_table_scan(const std::shared_ptr<AbstractOperator>& input,
+                                         const std::vector<std::shared_ptr<AbstractExpression>>& predicates) {
+    const auto pipelined_table_scan = std::make_shared<PipelinedTableScan>(input, predicates);
+    pipelined_table_scan->execute();
+
+    auto table_scan = input;
+    for (const auto& predicate : predicates) {
+      table_scan = std::make_shared<TableScan>(table_scan, predicate);
+      table_scan->execute();
+    }
+
+    EXPECT_EQ(pipelined_table_scan->get_output()->type(), TableType::References);
+    EXPECT_TABLE_EQ_UNORDERED(pipelined_table_scan->get_output(), table_scan->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<AbstractExpression> _a, _b, _c;
+};
+
+TEST_F(OperatorsPipelinedTableScanTest, NameAndDeepCopy) {
+  const auto predicates = expression_vector(greater_than_(_a, 5), equals_(_b, _c));
+  const auto pipelined_table_scan = std::make_shared<PipelinedTableScan>(_table_wrapper, predicates);
+  EXPECT_EQ(pipelined_table_scan->name(), "PipelinedTableScan");
+
+  const auto copy = std::dynamic_pointer_cast<PipelinedTableScan>(pipelined_table_scan->deep_copy());
+  ASSERT_TRUE(copy);
+  ASSERT_EQ(copy->predicates().size(), 2u);
+  EXPECT_EQ(*copy->predicates()[0], *predicates[0]);
+  EXPECT_EQ(*copy->predicates()[1], *predicates[1]);
+  EXPECT_NE(copy->predicates()[0], predicates[0]);
+}
+
+TEST_F(OperatorsPipelinedTableScanTest, DataTableInput) {
+  _test_pipelined_table_scan(_table_wrapper, expression_vector(greater_than_equals_(_a, 10)));
+  _test_pipelined_table_scan(_table_wrapper, expression_vector(greater_than_equals_(_a, 10), equals_(_b, 10)));
+  _test_pipelined_table_scan(_table_wrapper,
+                             expression_vector(less_than_(_a, 12), equals_(_b, 10), not_equals_(_a, _c)));
+}
+
+TEST_F(OperatorsPipelinedTableScanTest, ReferenceTableInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_c, 0));
+  table_scan->execute();
+
+  _test_pipelined_table_scan(table_scan, expression_vector(greater_than_equals_(_a, 10), equals_(_b, 10)));
+  _test_pipelined_table_scan(table_scan, expression_vector(or_(equals_(_a, 9), equals_(_a, 11)), less_than_(_c, 11)));
+}
+
+TEST_F(OperatorsPipelinedTableScanTest, NoMatches) {
+  // The first or an intermediate predicate do not leave any rows
+  _test_pipelined_table_scan(_table_wrapper, expression_vector(greater_than_(_a, 1000), equals_(_b, 10)));
+  _test_pipelined_table_scan(_table_wrapper,
+                             expression_vector(equals_(_b, 10), greater_than_(_a, 1000), equals_(_c, 1)));
+
+  const auto pipelined_table_scan =
+      std::make_shared<PipelinedTableScan>(_table_wrapper, expression_vector(equals_(_b, 10), less_than_(_a, 0)));
+  pipelined_table_scan->execute();
+  EXPECT_EQ(pipelined_table_scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsPipelinedTableScanTest, AdaptivePredicateOrder) {
+  auto predicate_order = AdaptivePredicateOrder{3};
+  const auto initial_order = std::vector<size_t>{0, 1, 2};
+  EXPECT_EQ(predicate_order.order(), initial_order);
+
+  // The second predicate is more selective, but expensive. The third one has not been measured yet.
+  predicate_order.record(0, 100, 90, std::chrono::nanoseconds{100});
+  predicate_order.record(1, 90, 9, std::chrono::nanoseconds{900});
+  const auto measured_order = std::vector<size_t>{2, 0, 1};
+  EXPECT_EQ(predicate_order.order(), measured_order);
+
+  predicate_order.record(2, 100, 95, std::chrono::nanoseconds{100});
+  predicate_order.record(1, 1'000, 10, std::chrono::nanoseconds{100});
+  const auto refined_order = std::vector<size_t>{1, 0, 2};
+  EXPECT_EQ(predicate_order.order(), refined_order);
+}
+
+}  // namespace opossum
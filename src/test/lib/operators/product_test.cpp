@@ -9,6 +9,8 @@
 #include "operators/product.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/pos_lists/cartesian_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -47,6 +49,20 @@ TEST_F(OperatorsProductTest, ReferenceAndValueSegments) {
   EXPECT_TABLE_EQ_UNORDERED(product->get_output(), expected_result);
 }
 
+TEST_F(OperatorsProductTest, DoesNotMaterializePositions) {
+  auto product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_b);
+  product->execute();
+
+  const auto& output_table = product->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    const auto chunk = output_table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < output_table->column_count(); ++column_id) {
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+      EXPECT_TRUE(std::dynamic_pointer_cast<const CartesianPosList>(reference_segment.pos_list()));
+    }
+  }
+}
+
 TEST_F(OperatorsProductTest, SelfProduct) {
   auto product = std::make_shared<Product>(_table_wrapper_c, _table_wrapper_c);
   product->execute();
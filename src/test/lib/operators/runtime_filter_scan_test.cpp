@@ -0,0 +1,127 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/runtime_filter_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsRuntimeFilterScanTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Chunks: [1, 2, 3], [4, 5, 6], [7, NULL, 9]
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+    _probe_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+    for (auto value = int32_t{1}; value <= 9; ++value) {
+      _probe_table->append({value == 8 ? AllTypeVariant{NullValue{}} : AllTypeVariant{value}, value * 10});
+    }
+    _probe_table->last_chunk()->finalize();
+    generate_chunk_pruning_statistics(_probe_table);
+
+    _probe_wrapper = std::make_shared<TableWrapper>(_probe_table);
+    _probe_wrapper->execute();
+
+    _build_wrapper = _make_build_wrapper({5, 6, NullValue{}, 8, 6});
+  }
+
+  static std::shared_ptr<TableWrapper> _make_build_wrapper(const std::vector<AllTypeVariant>& values) {
+    const auto build_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, true}}, TableType::Data, ChunkOffset{2});
+    for (const auto& value : values) {
+      build_table->append({value});
+    }
+
+    const auto build_wrapper = std::make_shared<TableWrapper>(build_table);
+    build_wrapper->execute();
+    return build_wrapper;
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<int32_t>& values) const {
+    const auto expected_table = std::make_shared<Table>(_probe_table->column_definitions(), TableType::Data);
+    for (const auto value : values) {
+      expected_table->append({value, value * 10});
+    }
+    return expected_table;
+  }
+
+  std::shared_ptr<Table> _probe_table;
+  std::shared_ptr<TableWrapper> _probe_wrapper, _build_wrapper;
+};
+
+TEST_F(OperatorsRuntimeFilterScanTest, NameAndDeepCopy) {
+  const auto runtime_filter_scan =
+      std::make_shared<RuntimeFilterScan>(_probe_wrapper, _build_wrapper, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(runtime_filter_scan->name(), "RuntimeFilterScan");
+  EXPECT_EQ(runtime_filter_scan->description(DescriptionMode::SingleLine), "RuntimeFilterScan (a in filter of x)");
+
+  const auto copy = std::dynamic_pointer_cast<RuntimeFilterScan>(runtime_filter_scan->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->column_ids(), runtime_filter_scan->column_ids());
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, DataTableInput) {
+  // The value range of the build side is [5, 8], so that the first chunk is pruned. The bloom filter removes 7 and the
+  // NULLs are never forwarded.
+  const auto runtime_filter_scan =
+      std::make_shared<RuntimeFilterScan>(_probe_wrapper, _build_wrapper, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  runtime_filter_scan->execute();
+
+  EXPECT_EQ(runtime_filter_scan->get_output()->type(), TableType::References);
+  EXPECT_TABLE_EQ_UNORDERED(runtime_filter_scan->get_output(), _expected_table({5, 6}));
+
+  const auto& performance_data =
+      static_cast<const RuntimeFilterScan::PerformanceData&>(*runtime_filter_scan->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_pruned.load(), 1u);
+  EXPECT_TRUE(performance_data.bloom_filter_used);
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, ReferenceTableInput) {
+  // The chunks of the TableScan's output reference a single stored chunk each, whose statistics are used for pruning
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto table_scan = std::make_shared<TableScan>(_probe_wrapper, not_equals_(a, 6));
+  table_scan->execute();
+
+  const auto runtime_filter_scan =
+      std::make_shared<RuntimeFilterScan>(table_scan, _build_wrapper, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  runtime_filter_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(runtime_filter_scan->get_output(), _expected_table({5}));
+
+  const auto& performance_data =
+      static_cast<const RuntimeFilterScan::PerformanceData&>(*runtime_filter_scan->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_pruned.load(), 1u);
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, NoBuildValues) {
+  // Without non-NULL values on the build side, no row can find a join partner
+  for (const auto& build_values : {std::vector<AllTypeVariant>{}, std::vector<AllTypeVariant>{NullValue{}}}) {
+    const auto runtime_filter_scan = std::make_shared<RuntimeFilterScan>(
+        _probe_wrapper, _make_build_wrapper(build_values), ColumnIDPair{ColumnID{0}, ColumnID{0}});
+    runtime_filter_scan->execute();
+
+    EXPECT_EQ(runtime_filter_scan->get_output()->row_count(), 0u);
+    EXPECT_EQ(runtime_filter_scan->get_output()->column_count(), 2u);
+  }
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, DifferentDataTypes) {
+  const auto long_build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Long, false}}, TableType::Data);
+  long_build_table->append({int64_t{5}});
+  const auto long_build_wrapper = std::make_shared<TableWrapper>(long_build_table);
+  long_build_wrapper->execute();
+
+  const auto runtime_filter_scan =
+      std::make_shared<RuntimeFilterScan>(_probe_wrapper, long_build_wrapper, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  EXPECT_THROW(runtime_filter_scan->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,5 +1,8 @@
+#include <random>
+
 #include "base_test.hpp"
 
+#include "concurrency/query_context.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
@@ -227,4 +230,86 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, ManyRowsInManyChunks) {
+  // Enough rows for the keys to be sorted by multiple tasks and the sorted runs to be merged. Values are drawn from
+  // small domains so that there are many ties that have to keep their input order.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true},
+                                                         {"b", DataType::Double, true},
+                                                         {"c", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+
+  auto random_engine = std::mt19937{42};
+  auto value_distribution = std::uniform_int_distribution<int32_t>{-20, 20};
+  for (auto row_id = int64_t{0}; row_id < 4 * Sort::JOB_SPAWN_THRESHOLD; ++row_id) {
+    const auto a = value_distribution(random_engine);
+    const auto b = value_distribution(random_engine);
+    auto row = std::vector<AllTypeVariant>{a % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{a},
+                                           b % 5 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{b / 4.0}, row_id};
+    table->append(row);
+    rows.emplace_back(std::move(row));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}, SortMode::Ascending}};
+  const auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions);
+  sort->execute();
+
+  // NULLs come first in both sort modes
+  std::stable_sort(rows.begin(), rows.end(), [&](const auto& lhs, const auto& rhs) {
+    for (const auto& sort_definition : sort_definitions) {
+      const auto& lhs_value = lhs[sort_definition.column];
+      const auto& rhs_value = rhs[sort_definition.column];
+      if (variant_is_null(lhs_value) || variant_is_null(rhs_value)) {
+        if (variant_is_null(lhs_value) == variant_is_null(rhs_value)) continue;
+        return variant_is_null(lhs_value);
+      }
+      if (lhs_value == rhs_value) continue;
+      return (lhs_value < rhs_value) == (sort_definition.sort_mode == SortMode::Ascending);
+    }
+    return false;
+  });
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto& row : rows) {
+    expected_table->append(row);
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_table);
+}
+
+TEST_F(SortTest, ExternalSortUnderMemoryPressure) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+
+  auto random_engine = std::mt19937{42};
+  auto value_distribution = std::uniform_int_distribution<int32_t>{-50, 50};
+  for (auto row_id = int64_t{0}; row_id < 2 * Sort::JOB_SPAWN_THRESHOLD; ++row_id) {
+    const auto a = value_distribution(random_engine);
+    table->append({a % 9 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{a}, row_id});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, SortMode::Descending}};
+  const auto reference_sort = std::make_shared<Sort>(table_wrapper, sort_definitions);
+  reference_sort->execute();
+
+  // The keys of all rows are larger than the memory limit, so that the sorted runs are spilled and merged
+  const auto query_context = std::make_shared<QueryContext>("SELECT ...", 0, 100'000);
+  const auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions);
+  sort->set_query_context_recursively(query_context);
+  sort->execute();
+  table_wrapper->set_query_context_recursively(nullptr);
+
+  const auto& performance_data = static_cast<const Sort::PerformanceData&>(*sort->performance_data);
+  EXPECT_GT(performance_data.spilled_bytes, 0u);
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), reference_sort->get_output());
+}
+
 }  // namespace opossum
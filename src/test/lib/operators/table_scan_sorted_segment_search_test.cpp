@@ -1,6 +1,8 @@
 #include "base_test.hpp"
 
 #include "operators/table_scan/sorted_segment_search.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 
 namespace {
@@ -63,6 +65,117 @@ class OperatorsTableScanSortedSegmentSearchTest : public BaseTest, public ::test
   SortMode _sorted_by;
 };
 
+/**
+ * Compares the search on a FrameOfReferenceSegment with and without its block minima (and with the expected result).
+ * The segment has three full blocks and a partial one. Its values grow by two every three rows, so that the values in
+ * between do not occur. The search values are taken from around the offsets of the block minima and the block ends,
+ * and lie below the first and above the last value. The searched ranges do not necessarily start at offset 0.
+ */
+using BlockMinimaParams = std::tuple<DataType, SortMode>;
+
+class OperatorsTableScanSortedBlockMinimaSearchTest : public BaseTest,
+                                                      public ::testing::WithParamInterface<BlockMinimaParams> {
+ protected:
+  template <typename T>
+  void test_block_minima_search() {
+    const auto sort_mode = std::get<1>(GetParam());
+    constexpr auto block_size = size_t{FrameOfReferenceSegment<T>::block_size};
+    constexpr auto row_count = 3 * block_size + 100;
+    const auto base = std::is_same_v<T, int64_t> ? static_cast<T>(int64_t{1} << 40) : T{-1'000};
+
+    auto values = std::vector<T>(row_count);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      const auto rank = sort_mode == SortMode::Ascending ? row : row_count - 1 - row;
+      values[row] = base + static_cast<T>(rank / 3 * 2);
+    }
+    const auto value_segment = std::make_shared<ValueSegment<T>>(pmr_vector<T>(values.begin(), values.end()));
+    const auto segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<T>>(ChunkEncoder::encode_segment(
+        value_segment, data_type_from_type<T>(), SegmentEncodingSpec{EncodingType::FrameOfReference}));
+    ASSERT_TRUE(segment);
+
+    auto search_values = std::vector<T>{values.front() - 5, values.back() - 5, values.front() + 5, values.back() + 5};
+    for (const auto offset : {size_t{0}, size_t{1}, block_size - 1, block_size, block_size + 1, 2 * block_size - 1,
+                              2 * block_size, 3 * block_size - 1, 3 * block_size, row_count - 1}) {
+      search_values.insert(search_values.end(), {values[offset] - 1, values[offset], values[offset] + 1});
+    }
+
+    const auto ranges = std::vector<std::pair<size_t, size_t>>{{0, row_count},
+                                                               {1, row_count},
+                                                               {block_size - 1, 2 * block_size + 1},
+                                                               {3'000, 3'001},
+                                                               {3 * block_size + 1, row_count},
+                                                               {0, block_size},
+                                                               {100, 100}};
+
+    const auto predicate_conditions = {PredicateCondition::Equals,
+                                       PredicateCondition::NotEquals,
+                                       PredicateCondition::LessThan,
+                                       PredicateCondition::LessThanEquals,
+                                       PredicateCondition::GreaterThan,
+                                       PredicateCondition::GreaterThanEquals,
+                                       PredicateCondition::BetweenInclusive,
+                                       PredicateCondition::BetweenLowerExclusive,
+                                       PredicateCondition::BetweenUpperExclusive,
+                                       PredicateCondition::BetweenExclusive};
+
+    for (const auto& [begin_offset, end_offset] : ranges) {
+      for (const auto predicate_condition : predicate_conditions) {
+        for (const auto search_value : search_values) {
+          // Between predicates cover the values in [search_value, search_value + 7]
+          const auto is_between = is_between_predicate_condition(predicate_condition);
+          const auto upper_value = static_cast<T>(search_value + 7);
+
+          auto expected_offsets = std::vector<ChunkOffset>{};
+          for (auto offset = begin_offset; offset < end_offset; ++offset) {
+            const auto value = values[offset];
+            auto matches = false;
+            switch (predicate_condition) {
+              case PredicateCondition::Equals: matches = value == search_value; break;
+              case PredicateCondition::NotEquals: matches = value != search_value; break;
+              case PredicateCondition::LessThan: matches = value < search_value; break;
+              case PredicateCondition::LessThanEquals: matches = value <= search_value; break;
+              case PredicateCondition::GreaterThan: matches = value > search_value; break;
+              case PredicateCondition::GreaterThanEquals: matches = value >= search_value; break;
+              default:
+                matches = (is_lower_inclusive_between(predicate_condition) ? value >= search_value
+                                                                           : value > search_value) &&
+                          (is_upper_inclusive_between(predicate_condition) ? value <= upper_value
+                                                                           : value < upper_value);
+            }
+            if (matches) expected_offsets.emplace_back(static_cast<ChunkOffset>(offset));
+          }
+
+          const auto search = [&](const bool use_block_minima) {
+            auto offsets = std::vector<ChunkOffset>{};
+            create_iterable_from_segment(*segment).with_iterators([&](auto begin, auto /* end */) {
+              using SearchType = SortedSegmentSearch<decltype(begin), T>;
+              auto sorted_segment_search =
+                  is_between ? SearchType{begin + begin_offset, begin + end_offset, sort_mode, false,
+                                          predicate_condition, search_value, upper_value}
+                             : SearchType{begin + begin_offset, begin + end_offset, sort_mode, false,
+                                          predicate_condition, search_value};
+              if (use_block_minima) sorted_segment_search.use_block_minima(*segment, false);
+
+              sorted_segment_search.scan_sorted_segment([&](auto output_begin, const auto output_end) {
+                for (; output_begin != output_end; ++output_begin) {
+                  offsets.emplace_back(output_begin->chunk_offset());
+                }
+              });
+            });
+            return offsets;
+          };
+
+          const auto trace = std::string{"["} + std::to_string(begin_offset) + ", " + std::to_string(end_offset) +
+                             ") " + predicate_condition_to_string.left.at(predicate_condition) + " " +
+                             std::to_string(search_value);
+          EXPECT_EQ(search(true), expected_offsets) << trace;
+          EXPECT_EQ(search(false), expected_offsets) << trace;
+        }
+      }
+    }
+  }
+};
+
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(
     Predicates, OperatorsTableScanSortedSegmentSearchTest,
@@ -132,4 +245,21 @@ TEST_P(OperatorsTableScanSortedSegmentSearchTest, ScanSortedSegment) {
   });
 }
 
+INSTANTIATE_TEST_SUITE_P(DataTypesAndSortModes, OperatorsTableScanSortedBlockMinimaSearchTest,
+                         ::testing::Combine(::testing::Values(DataType::Int, DataType::Long),
+                                            ::testing::Values(SortMode::Ascending, SortMode::Descending)),
+                         [](const ::testing::TestParamInfo<BlockMinimaParams>& info) {
+                           return data_type_to_string.left.at(std::get<0>(info.param)) +
+                                  sort_mode_to_string.left.at(std::get<1>(info.param));
+                         });
+
+TEST_P(OperatorsTableScanSortedBlockMinimaSearchTest, SearchWithAndWithoutBlockMinima) {
+  resolve_data_type(std::get<0>(GetParam()), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+      test_block_minima_search<ColumnDataType>();
+    }
+  });
+}
+
 }  // namespace opossum
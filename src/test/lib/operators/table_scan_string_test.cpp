@@ -63,7 +63,8 @@ auto table_scan_scring_test_formatter = [](const ::testing::TestParamInfo<Encodi
 
 INSTANTIATE_TEST_SUITE_P(EncodingTypes, OperatorsTableScanStringTest,
                          ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                           EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                           EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                           EncodingType::FSST),
                          table_scan_scring_test_formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
@@ -82,6 +83,17 @@ TEST_P(OperatorsTableScanStringTest, ScanNotEquals) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanLikeWithoutWildcard) {
+  auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::Like, "Reeperbahn");
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+
+  auto scan_not_like =
+      create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Reeperbahn");
+  scan_not_like->execute();
+  EXPECT_EQ(scan_not_like->get_output()->row_count(), 5u);
+}
+
 TEST_P(OperatorsTableScanStringTest, ScanLessThan) {
   auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::LessThan, "Schiff");
   scan->execute();
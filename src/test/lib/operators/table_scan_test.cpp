@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -15,11 +16,14 @@
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_scan/abstract_table_scan_impl.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
+#include "operators/table_scan/disjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -890,6 +894,35 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PrunesChunksWithParameters) {
+  // The ChunkPruningRule cannot prune chunks for placeholders, but the scan can once the parameters are set
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  for (auto value = int32_t{1}; value <= 6; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_a = std::make_shared<TableScan>(
+      table_wrapper, greater_than_(get_column_expression(table_wrapper, ColumnID{0}), placeholder_(ParameterID{0})));
+  scan_a->set_parameters({{ParameterID{0}, AllTypeVariant{2}}});
+  scan_a->execute();
+  ASSERT_COLUMN_EQ(scan_a->get_output(), ColumnID{0}, std::vector<AllTypeVariant>{3, 4, 5, 6});
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan_a->performance_data).num_chunks_with_early_out, 1u);
+
+  // Chunks of ReferenceSegments are pruned based on the statistics of the chunks they reference
+  const auto scan_b = std::make_shared<TableScan>(
+      scan_a, between_inclusive_(get_column_expression(scan_a, ColumnID{0}), placeholder_(ParameterID{0}),
+                                 placeholder_(ParameterID{1})));
+  scan_b->set_parameters({{ParameterID{0}, AllTypeVariant{5}}, {ParameterID{1}, AllTypeVariant{7}}});
+  scan_b->execute();
+  ASSERT_COLUMN_EQ(scan_b->get_output(), ColumnID{0}, std::vector<AllTypeVariant>{5, 6});
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan_b->performance_data).num_chunks_with_early_out, 1u);
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -915,7 +948,9 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), in_(column_a, list_(1, 2)))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), equals_(column_a, column_b))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, 5.5f)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_b, 1e40)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, int64_t{3'000'000'000})}.create_impl().get()));  // NOLINT
@@ -924,6 +959,9 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), between_inclusive_(column_a, 0, null_())}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(TableScan{get_int_float_with_null_op(), is_not_null_(column_an)}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<DisjunctionTableScanImpl*>(TableScan{get_int_float_op(), or_(equals_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<DisjunctionTableScanImpl*>(TableScan{get_int_float_op(), or_(equals_(column_a, 5), in_(column_a, list_(1, 2)))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), or_(in_(column_a, list_(1, 2)), like_("hello", "%s%"))}.create_impl().get()));  // NOLINT
 
   // Cases where the lossless_predicate_cast is used and the predicate condition gets adjusted:
   {
@@ -1033,6 +1071,60 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   // clang-format on
 }
 
+TEST_P(OperatorsTableScanTest, DisjunctionScan) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, true, "b");
+
+  // Each row but the first one matches a different number of predicates. The IN predicate is evaluated by the
+  // ExpressionEvaluator.
+  const auto predicate = or_(equals_(column_a, 123),
+                             or_(less_than_(column_b, 457.0f), or_(is_null_(column_a), in_(column_a, list_(1234)))));
+  auto scan = std::make_shared<TableScan>(get_int_float_with_null_op(), predicate);
+  scan->execute();
+
+  const auto& impl = static_cast<const DisjunctionTableScanImpl&>(*scan->create_impl());
+  EXPECT_EQ(impl.predicate_impls().size(), 4u);
+  EXPECT_EQ(impl.description(), "Disjunction(ColumnVsValue, ColumnVsValue, IsNullScan, ExpressionEvaluator)");
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Float, true}}, TableType::Data);
+  expected_result->append({123, NullValue{}});
+  expected_result->append({NullValue{}, 456.7f});
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScan) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, true, "b");
+
+  const auto predicate = and_(greater_than_(column_a, 100),
+                              and_(less_than_(column_b, 458.0f), between_inclusive_(column_a, 0, 2000)));
+  const auto table = get_int_float_with_null_op()->get_output();
+  const auto abstract_impl = TableScan::create_impl(table, predicate);
+  auto& impl = dynamic_cast<ConjunctionTableScanImpl&>(*abstract_impl);
+  EXPECT_EQ(impl.description(), "Conjunction(ColumnVsValue, ColumnVsValue, ColumnBetween)");
+
+  // The first chunk is scanned in the original order of the predicates. The predicate on b does not leave any rows,
+  // so the BETWEEN predicate has not been measured yet and comes first for the next chunk. The predicate on a has not
+  // filtered out any rows and comes last.
+  EXPECT_TRUE(impl.scan_chunk(ChunkID{0})->empty());
+  const auto expected_order = std::vector<size_t>{2, 1, 0};
+  EXPECT_EQ(impl.predicate_order(), expected_order);
+
+  const auto matches = impl.scan_chunk(ChunkID{1});
+  const auto expected_matches = RowIDPosList{RowID{ChunkID{1}, ChunkOffset{1}}};
+  EXPECT_EQ(*matches, expected_matches);
+
+  auto scan = std::make_shared<TableScan>(get_int_float_with_null_op(), predicate);
+  scan->execute();
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Float, true}}, TableType::Data);
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
 TEST_P(OperatorsTableScanTest, TwoBigScans) {
   // To stress-test the SIMD scan, which only operates on bigger tables, the generated table holds 1'000 rows.
   // For each fifth row, column a is NULL. Otherwise, a is 100'000 + i, b is the index in the list of non-NULL values.
@@ -1082,6 +1174,151 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, BigScansOnSingleChunk) {
+  // Dictionary segments with more than BLOCK_SIZE rows are scanned directly on the compressed attribute vector. Use
+  // 40 and 300 distinct values so that both the one-byte and the two-byte attribute vectors are covered.
+  for (const auto distinct_count : {40, 300}) {
+    auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+    const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 2'000);
+
+    for (auto i = 0; i < 1'999; ++i) {
+      if (i % 7 == 6) {
+        data_table->append({NullValue{}});
+      } else {
+        data_table->append({(i * 13) % distinct_count});
+      }
+    }
+    data_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+
+    auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+    data_table_wrapper->execute();
+
+    const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+    const auto search_value = distinct_count / 3;
+
+    const auto expected_count = [&](const auto& predicate) {
+      auto count = size_t{0};
+      for (auto i = 0; i < 1'999; ++i) {
+        if (i % 7 != 6 && predicate((i * 13) % distinct_count)) ++count;
+      }
+      return count;
+    };
+
+    const auto predicates = std::vector<std::pair<std::shared_ptr<AbstractExpression>, size_t>>{
+        {equals_(column_a, search_value), expected_count([&](auto v) { return v == search_value; })},
+        {not_equals_(column_a, search_value), expected_count([&](auto v) { return v != search_value; })},
+        {less_than_(column_a, search_value), expected_count([&](auto v) { return v < search_value; })},
+        {less_than_equals_(column_a, search_value), expected_count([&](auto v) { return v <= search_value; })},
+        {greater_than_(column_a, search_value), expected_count([&](auto v) { return v > search_value; })},
+        {greater_than_equals_(column_a, search_value), expected_count([&](auto v) { return v >= search_value; })},
+        {between_inclusive_(column_a, 3, search_value),
+         expected_count([&](auto v) { return v >= 3 && v <= search_value; })},
+        {between_exclusive_(column_a, 3, search_value),
+         expected_count([&](auto v) { return v > 3 && v < search_value; })}};
+
+    for (const auto& [predicate, expected_row_count] : predicates) {
+      const auto scan = std::make_shared<TableScan>(data_table_wrapper, predicate);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << predicate->as_column_name();
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanMatchesOfAllBlockMasks) {
+  // The SIMD scan compresses the matches of blocks of eight rows. Block i matches the rows whose bit is set in i, so
+  // that every one of the 256 masks occurs. The rows after the last full block are scanned without SIMD. In column b,
+  // every thirteenth row is NULL. Column c holds the row number.
+  const auto row_count = int32_t{256 * 8 + 5};
+  auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::Int, false}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{row_count});
+
+  const auto matches = [](const int32_t row) { return (row / 8 >> row % 8 & 1) == 1; };
+  const auto is_null = [](const int32_t row) { return row % 13 == 12; };
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    const auto value = matches(row) ? 1 : 0;
+    data_table->append({value, is_null(row) ? AllTypeVariant{NullValue{}} : AllTypeVariant{value}, row});
+  }
+  data_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+  for (const auto& column : {column_a, column_b}) {
+    const auto scan = std::make_shared<TableScan>(data_table_wrapper, equals_(column, 1));
+    scan->execute();
+
+    auto expected_rows = std::vector<int32_t>{};
+    for (auto row = int32_t{0}; row < row_count; ++row) {
+      if (matches(row) && (column == column_a || !is_null(row))) expected_rows.emplace_back(row);
+    }
+
+    const auto& output_table = scan->get_output();
+    auto rows = std::vector<int32_t>{};
+    for (auto row_number = size_t{0}; row_number < output_table->row_count(); ++row_number) {
+      rows.emplace_back(*output_table->get_value<int32_t>(ColumnID{2}, row_number));
+    }
+    EXPECT_EQ(rows, expected_rows) << column->as_column_name();
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanOnFrameOfReferenceOffsets) {
+  // FrameOfReferenceSegments with byte-aligned offsets are scanned on their offsets, block by block. The values grow
+  // by 100 with each block of 2'048 values, so that blocks are skipped, fully matched, or scanned.
+  if (_encoding_type != EncodingType::FrameOfReference) GTEST_SKIP();
+
+  constexpr auto ROW_COUNT = 10'000;
+  const auto value_at = [](const auto index) { return (index / 2'048) * 100 + (index * 7) % 150; };
+
+  const auto data_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, ROW_COUNT);
+  for (auto index = 0; index < ROW_COUNT; ++index) {
+    if (index % 11 == 10) {
+      data_table->append({NullValue{}});
+    } else {
+      data_table->append({value_at(index)});
+    }
+  }
+  data_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(
+      data_table, SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned});
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  const auto expected_count = [&](const auto& predicate) {
+    auto count = size_t{0};
+    for (auto index = 0; index < ROW_COUNT; ++index) {
+      if (index % 11 != 10 && predicate(value_at(index))) ++count;
+    }
+    return count;
+  };
+
+  const auto predicates = std::vector<std::pair<std::shared_ptr<AbstractExpression>, size_t>>{
+      {equals_(column_a, 120), expected_count([](auto v) { return v == 120; })},
+      {less_than_(column_a, 120), expected_count([](auto v) { return v < 120; })},
+      {less_than_equals_(column_a, 250), expected_count([](auto v) { return v <= 250; })},
+      {greater_than_(column_a, 320), expected_count([](auto v) { return v > 320; })},
+      {greater_than_equals_(column_a, -5), expected_count([](auto v) { return v >= -5; })},
+      {less_than_(column_a, std::numeric_limits<int32_t>::min()), size_t{0}},
+      {greater_than_(column_a, std::numeric_limits<int32_t>::max()), size_t{0}},
+      {between_inclusive_(column_a, 90, 260), expected_count([](auto v) { return v >= 90 && v <= 260; })},
+      {between_exclusive_(column_a, 90, 260), expected_count([](auto v) { return v > 90 && v < 260; })},
+      {between_upper_exclusive_(column_a, 160, 1'000), expected_count([](auto v) { return v >= 160 && v < 1'000; })}};
+
+  for (const auto& [predicate, expected_row_count] : predicates) {
+    const auto scan = std::make_shared<TableScan>(data_table_wrapper, predicate);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << predicate->as_column_name();
+  }
+}
+
 /**
  * Tests for sorted_by flag forwarding.
  */
@@ -1243,4 +1480,139 @@ TEST_P(OperatorsTableScanTest, SortedFlagMultipleChunksReferenced) {
   ASSERT_TRUE(chunk_sorted_by.empty());
 }
 
+TEST_P(OperatorsTableScanTest, SortedPosListsAreForwarded) {
+  const auto table = get_int_sorted_op()->table;
+
+  // The matches of a scan on data segments are sorted
+  const auto data_scan = create_table_scan(get_int_sorted_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 2);
+  data_scan->execute();
+  const auto data_scan_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(data_scan->get_output()->get_chunk(ChunkID{0})->get_segment(
+          ColumnID{0}));
+  EXPECT_TRUE(data_scan_segment->pos_list()->is_sorted());
+
+  // Sorted positions that reference multiple chunks stay sorted, unsorted positions are not guaranteed to be sorted
+  for (const auto sorted : {true, false}) {
+    auto pos_list = std::make_shared<RowIDPosList>();
+    pos_list->emplace_back(RowID{ChunkID{0}, 1});
+    pos_list->emplace_back(RowID{ChunkID{0}, 3});
+    pos_list->emplace_back(RowID{ChunkID{1}, 0});
+    if (sorted) pos_list->guarantee_sorted();
+
+    const auto ref_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+    ref_table->append_chunk({std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+    const auto table_wrapper = std::make_shared<TableWrapper>(ref_table);
+    table_wrapper->execute();
+
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 2);
+    scan->execute();
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    ASSERT_LT(segment->size(), pos_list->size());
+    EXPECT_EQ(segment->pos_list()->is_sorted(), sorted);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, CoalescesSmallOutputChunks) {
+  // 100 input chunks with one match each. Their output chunks are merged into one chunk, whose segments still share
+  // their position list.
+  const auto data_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data, 10);
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    data_table->append({value, value % 10});
+  }
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto scan = create_table_scan(data_table_wrapper, ColumnID{1}, PredicateCondition::Equals, 0);
+  scan->execute();
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->row_count(), 100);
+
+  const auto chunk = output->get_chunk(ChunkID{0});
+  const auto segment_a = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+  EXPECT_EQ(segment_a->pos_list(), segment_b->pos_list());
+  EXPECT_FALSE(segment_a->pos_list()->references_single_chunk());
+
+  auto expected_values = std::vector<AllTypeVariant>{};
+  for (auto value = int32_t{0}; value < 1'000; value += 10) {
+    expected_values.emplace_back(value);
+  }
+  ASSERT_COLUMN_EQ(output, ColumnID{0}, expected_values);
+
+  // Scanning the merged chunk dereferences positions from all input chunks
+  const auto second_scan = create_table_scan(scan, ColumnID{0}, PredicateCondition::LessThan, 500);
+  second_scan->execute();
+  expected_values.resize(50);
+  ASSERT_COLUMN_EQ(second_scan->get_output(), ColumnID{0}, expected_values);
+}
+
+TEST_P(OperatorsTableScanTest, KeepsFewSmallOutputChunks) {
+  // Below MIN_CHUNK_COUNT_TO_COALESCE output chunks, the chunks are emitted as they are
+  const auto chunk_count = AbstractReadOnlyOperator::MIN_CHUNK_COUNT_TO_COALESCE - 1;
+  const auto data_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 10);
+  for (auto value = int32_t{0}; value < static_cast<int32_t>(chunk_count * 10); ++value) {
+    data_table->append({value % 10});
+  }
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto scan = create_table_scan(data_table_wrapper, ColumnID{0}, PredicateCondition::Equals, 0);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->chunk_count(), chunk_count);
+}
+
+class TableScanCompressPermutationsTest : public BaseTest {
+ protected:
+  // Exposes the permutations of the AVX2 compression, which are only used on machines without AVX-512 VL
+  class TableScanImpl : public AbstractTableScanImpl {
+   public:
+    using AbstractTableScanImpl::_compress_permutations;
+  };
+};
+
+TEST_F(TableScanCompressPermutationsTest, PermutationsMoveMatchesToTheFront) {
+  constexpr auto permutations = TableScanImpl::_compress_permutations();
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    auto expected_rows = std::vector<uint32_t>{};
+    for (auto row = uint32_t{0}; row < 8; ++row) {
+      if (mask >> row & 1) expected_rows.emplace_back(row);
+    }
+
+    const auto& permutation = permutations[mask];
+    const auto rows = std::vector<uint32_t>(permutation.begin(), permutation.begin() + expected_rows.size());
+    EXPECT_EQ(rows, expected_rows) << "mask " << mask;
+
+    // The remaining lanes are not written to the matches, but must be valid indexes for the permutation instruction
+    for (const auto row : permutation) {
+      EXPECT_LT(row, 8u);
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, RowBudget) {
+  const auto data_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                  TableType::Data, 10);
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    data_table->append({value});
+  }
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  // The scan stops once it found 15 rows. It only emits entire chunks.
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto scan = std::make_shared<TableScan>(data_table_wrapper, greater_than_(column_a, 4));
+  scan->row_budget = 15;
+  scan->execute();
+  EXPECT_GE(scan->get_output()->row_count(), 15);
+  EXPECT_LT(scan->get_output()->row_count(), 95);
+
+  const auto copied_scan = scan->deep_copy();
+  EXPECT_EQ(copied_scan->row_budget, 15);
+}
+
 }  // namespace opossum
@@ -0,0 +1,139 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data, 4);
+    table->append({5, "e"});
+    table->append({3, "c"});
+    table->append({NullValue{}, "x"});
+    table->append({3, "a"});
+    table->append({8, "h"});
+    table->append({1, "a"});
+    table->append({5, "b"});
+    table->append({NullValue{}, "y"});
+    table->append({2, "b"});
+    table->append({3, "c"});
+    table->append({7, "g"});
+    _finalize(table);
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static void _finalize(const std::shared_ptr<Table>& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable()) chunk->finalize();
+    }
+  }
+
+  // Compares the TopK with a Sort followed by a Limit
+  static void _test_top_k(const std::shared_ptr<AbstractOperator>& input,
+                          const std::vector<SortColumnDefinition>& sort_definitions, const int64_t row_count) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(row_count));
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    const auto limit = std::make_shared<Limit>(sort, value_(row_count));
+    sort->execute();
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  const SortColumnDefinition _a_ascending{ColumnID{0}, SortMode::Ascending};
+  const SortColumnDefinition _a_descending{ColumnID{0}, SortMode::Descending};
+  const SortColumnDefinition _b_ascending{ColumnID{1}, SortMode::Ascending};
+  const SortColumnDefinition _b_descending{ColumnID{1}, SortMode::Descending};
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, NameAndDeepCopy) {
+  const auto sort_definitions = std::vector<SortColumnDefinition>{_a_descending};
+  const auto top_k = std::make_shared<TopK>(_table_wrapper, sort_definitions, value_(int64_t{3}));
+  EXPECT_EQ(top_k->name(), "TopK");
+
+  const auto copy = std::dynamic_pointer_cast<TopK>(top_k->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->sort_definitions(), sort_definitions);
+  EXPECT_EQ(*copy->row_count_expression(), *value_(int64_t{3}));
+}
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  for (const auto sort_mode : {SortMode::Ascending, SortMode::Descending}) {
+    for (const auto row_count : {int64_t{1}, int64_t{3}, int64_t{6}}) {
+      _test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{0}, sort_mode}}, row_count);
+      _test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, sort_mode}}, row_count);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  for (const auto row_count : {int64_t{2}, int64_t{4}, int64_t{7}}) {
+    _test_top_k(_table_wrapper, {_a_ascending, _b_descending}, row_count);
+    _test_top_k(_table_wrapper, {_a_descending, _b_ascending}, row_count);
+    _test_top_k(_table_wrapper, {_b_ascending, _a_ascending}, row_count);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ZeroOrAllRows) {
+  _test_top_k(_table_wrapper, {_a_ascending}, 0);
+  _test_top_k(_table_wrapper, {_a_ascending}, 11);
+  _test_top_k(_table_wrapper, {_a_descending}, 20);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 2);
+  table_scan->execute();
+
+  _test_top_k(table_scan, {_a_ascending}, 3);
+  _test_top_k(table_scan, {_b_descending, _a_ascending}, 2);
+}
+
+TEST_F(OperatorsTopKTest, SortedChunks) {
+  // Each chunk is sorted by a with NULLs first, so that the scan of a chunk can stop early
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data, 4);
+  table->append({NullValue{}, "x"});
+  table->append({2, "b"});
+  table->append({4, "d"});
+  table->append({9, "i"});
+  table->append({1, "a"});
+  table->append({2, "c"});
+  table->append({3, "c"});
+  table->append({5, "e"});
+  table->append({0, "z"});
+  table->append({6, "f"});
+  _finalize(table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->set_individually_sorted_by(_a_ascending);
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto row_count : {int64_t{1}, int64_t{3}, int64_t{5}}) {
+    _test_top_k(table_wrapper, {_a_ascending}, row_count);
+    _test_top_k(table_wrapper, {_a_ascending, _b_descending}, row_count);
+    _test_top_k(table_wrapper, {_a_descending}, row_count);
+  }
+}
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "expression/pqp_column_expression.hpp"
 #include "operators/projection.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "storage/table.hpp"
@@ -53,6 +54,29 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, ForwardsSegmentsAndSortOrder) {
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+  const auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions, ChunkOffset{2});
+  sort->execute();
+
+  auto union_all = std::make_shared<UnionAll>(sort, _table_wrapper_b);
+  union_all->execute();
+
+  const auto& sorted_table = sort->get_output();
+  const auto& output_table = union_all->get_output();
+  ASSERT_EQ(output_table->chunk_count(), sorted_table->chunk_count() + _table_wrapper_b->get_output()->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < sorted_table->chunk_count(); ++chunk_id) {
+    const auto input_chunk = sorted_table->get_chunk(chunk_id);
+    const auto output_chunk = output_table->get_chunk(chunk_id);
+    EXPECT_FALSE(output_chunk->is_mutable());
+    EXPECT_EQ(output_chunk->individually_sorted_by(), sort_definitions);
+    for (auto column_id = ColumnID{0}; column_id < sorted_table->column_count(); ++column_id) {
+      EXPECT_EQ(output_chunk->get_segment(column_id), input_chunk->get_segment(column_id));
+    }
+  }
+}
+
 TEST_F(OperatorsUnionAllTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   std::shared_ptr<Table> test_table_c = load_table("resources/test_data/tbl/int.tbl", 2);
@@ -91,6 +91,52 @@ TEST_F(UnionPositionsTest, SelfUnionOverlappingRanges) {
   EXPECT_TABLE_EQ_UNORDERED(union_unique_op->get_output(), _table_10_ints);
 }
 
+TEST_F(UnionPositionsTest, SelfUnionOverlappingRangesWithBitmaps) {
+  auto get_table_op = std::make_shared<GetTable>("10_ints");
+  auto table_scan_a_op = std::make_shared<TableScan>(get_table_op, greater_than_(_int_column_0_non_nullable, 20));
+  auto table_scan_b_op = std::make_shared<TableScan>(get_table_op, less_than_(_int_column_0_non_nullable, 100));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  execute_all({get_table_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  // The output has one chunk with a sorted pos list for each referenced chunk
+  const auto& output = union_unique_op->get_output();
+  EXPECT_TABLE_EQ_ORDERED(output, _table_10_ints);
+  ASSERT_EQ(output->chunk_count(), _table_10_ints->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    EXPECT_TRUE(pos_list.references_single_chunk());
+    EXPECT_EQ(pos_list.common_chunk_id(), chunk_id);
+  }
+}
+
+TEST_F(UnionPositionsTest, DuplicatesWithinInput) {
+  // Rows that occur multiple times in an input cannot be represented by the bitmaps and are kept, like std::set_union
+  // does
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+
+  const auto pos_list_left = std::make_shared<RowIDPosList>();
+  pos_list_left->emplace_back(RowID{ChunkID{0}, 1});
+  pos_list_left->emplace_back(RowID{ChunkID{0}, 1});
+  pos_list_left->emplace_back(RowID{ChunkID{1}, 0});
+  const auto table_left = std::make_shared<Table>(column_definitions, TableType::References);
+  table_left->append_chunk({std::make_shared<ReferenceSegment>(_table_10_ints, ColumnID{0}, pos_list_left)});
+
+  const auto pos_list_right = std::make_shared<RowIDPosList>();
+  pos_list_right->emplace_back(RowID{ChunkID{0}, 1});
+  const auto table_right = std::make_shared<Table>(column_definitions, TableType::References);
+  table_right->append_chunk({std::make_shared<ReferenceSegment>(_table_10_ints, ColumnID{0}, pos_list_right)});
+
+  auto table_wrapper_left_op = std::make_shared<TableWrapper>(table_left);
+  auto table_wrapper_right_op = std::make_shared<TableWrapper>(table_right);
+  auto union_unique_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+
+  execute_all({table_wrapper_left_op, table_wrapper_right_op, union_unique_op});
+
+  EXPECT_EQ(union_unique_op->get_output()->row_count(), 3u);
+}
+
 TEST_F(UnionPositionsTest, EarlyResultLeft) {
   /**
    * If one of the input tables is empty, an early result should be produced
@@ -8,8 +8,10 @@
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -83,4 +85,61 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateOwnInsertInPlace) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto values_to_insert = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values_to_insert->append({1, 1.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  const auto insert = std::make_shared<Insert>(table_to_update_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  table_wrapper->execute();
+  insert->execute();
+  const auto row_count = table->row_count();
+
+  // Update the inserted row twice. As no other transaction can see it, its values are overwritten.
+  for (const auto new_value : {2.5f, 3.5f}) {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, 1));
+    const auto updated_values_projection =
+        std::make_shared<Projection>(where_scan, expression_vector(column_a, new_value));
+    const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+    update->set_transaction_context(transaction_context);
+    execute_all({get_table, validate, where_scan, updated_values_projection, update});
+    EXPECT_FALSE(update->execute_failed());
+  }
+  EXPECT_EQ(table->row_count(), row_count);
+
+  // Updated committed rows are still deleted and inserted again
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, 12));
+  const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, 1.5f));
+  const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  execute_all({get_table, validate, where_scan, updated_values_projection, update});
+  EXPECT_EQ(table->row_count(), row_count + 1);
+
+  transaction_context->commit();
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({12345, 456.7f});
+  expected_table->append({12345, 457.7f});
+  expected_table->append({123, 458.7f});
+  expected_table->append({12, 1.5f});
+  expected_table->append({1, 3.5f});
+
+  const auto post_update_transaction_context =
+      Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto post_update_get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto post_update_validate = std::make_shared<Validate>(post_update_get_table);
+  post_update_validate->set_transaction_context(post_update_transaction_context);
+  execute_all({post_update_get_table, post_update_validate});
+  EXPECT_TABLE_EQ_UNORDERED(post_update_validate->get_output(), expected_table);
+}
+
 }  // namespace opossum
@@ -56,6 +56,10 @@ class OperatorsValidateTest : public BaseTest {
                                               const CommitID snapshot_commit_id) {
     return validate->_is_entire_chunk_visible(chunk, snapshot_commit_id);
   }
+
+  static void forward_disable_chunk_shortcut(std::shared_ptr<Validate> validate) {
+    validate->_can_use_chunk_shortcut = false;
+  }
 };
 
 void OperatorsValidateTest::set_all_records_visible(Table& table) {
@@ -136,6 +140,62 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   t2_context->commit();
 }
 
+TEST_F(OperatorsValidateTest, ValidateRowsInBlocks) {
+  // Enough rows for multiple SIMD blocks and a remainder, with different visibilities
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{100},
+                              UseMvcc::Yes);
+  const auto row_count = int32_t{37};
+  for (auto value = int32_t{0}; value < row_count; ++value) {
+    table->append({value});
+  }
+
+  const auto our_tid = TransactionID{1};
+  const auto snapshot_cid = CommitID{2};
+  const auto mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  auto expected_values = std::vector<int32_t>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(row_count); ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, chunk_offset % 4);
+    if (chunk_offset % 5 == 0) mvcc_data->set_end_cid(chunk_offset, CommitID{2});
+    if (chunk_offset % 7 == 0) {
+      // Uncommitted rows inserted by us or by someone else
+      mvcc_data->set_begin_cid(chunk_offset, MvccData::MAX_COMMIT_ID);
+      mvcc_data->set_end_cid(chunk_offset, MvccData::MAX_COMMIT_ID);
+      mvcc_data->set_tid(chunk_offset, chunk_offset % 2 == 0 ? our_tid : TransactionID{5});
+    }
+
+    if (Validate::is_row_visible(our_tid, snapshot_cid, mvcc_data->get_tid(chunk_offset),
+                                 mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset))) {
+      expected_values.emplace_back(static_cast<int32_t>(chunk_offset));
+    }
+  }
+
+  const auto context = std::make_shared<TransactionContext>(our_tid, snapshot_cid, AutoCommit::No);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Data table
+  const auto validate_data = std::make_shared<Validate>(table_wrapper);
+  validate_data->set_transaction_context(context);
+  validate_data->execute();
+
+  // Reference table
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  table_scan->execute();
+  const auto validate_references = std::make_shared<Validate>(table_scan);
+  validate_references->set_transaction_context(context);
+  validate_references->execute();
+
+  for (const auto& validate : {validate_data, validate_references}) {
+    auto values = std::vector<int32_t>{};
+    const auto output = validate->get_output();
+    for (auto row_id = size_t{0}; row_id < output->row_count(); ++row_id) {
+      values.emplace_back(output->get_value<int32_t>(ColumnID{0}, row_id).value());
+    }
+    EXPECT_EQ(values, expected_values);
+  }
+}
+
 TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleThrowsOnRefChunk) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -203,6 +263,26 @@ TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ChunkWithCompactedMvccDataEntirelyVisible) {
+  auto snapshot_cid = CommitID{1};
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, CommitID{1}));
+  chunk->finalize();
+  auto uncompacted_chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, CommitID{1}));
+  uncompacted_chunk->finalize();
+  ASSERT_TRUE(chunk->try_compact_mvcc_data(snapshot_cid));
+
+  auto validate = std::make_shared<Validate>(nullptr);
+  EXPECT_TRUE(forward_is_entire_chunk_visible(validate, uncompacted_chunk, snapshot_cid));
+
+  // Compacted chunks are entirely visible even if the transaction contains a Delete, uncompacted ones are not
+  forward_disable_chunk_shortcut(validate);
+  EXPECT_FALSE(forward_is_entire_chunk_visible(validate, uncompacted_chunk, snapshot_cid));
+  EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
+  EXPECT_FALSE(forward_is_entire_chunk_visible(validate, chunk, CommitID{0}));
+}
+
 TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   // If Validate has a reference table as input, it can usually optimize the evaluation of the MVCC data.
   // This optimization is possible if a PosList of a reference segment references only one chunk.
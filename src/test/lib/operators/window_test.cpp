@@ -0,0 +1,144 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsWindowTest : public BaseTest {
+ public:
+  // NULLs are std::nullopt, as NullValues never compare equal
+  using WindowColumn = std::vector<std::optional<AllTypeVariant>>;
+
+  void SetUp() override {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"p", DataType::Int, false}, {"o", DataType::Int, false}, {"v", DataType::Int, true}},
+        TableType::Data, 3);
+    table->append({1, 3, 10});
+    table->append({2, 1, NullValue{}});
+    table->append({1, 1, 20});
+    table->append({1, 1, 30});
+    table->append({2, 2, 40});
+    table->append({1, 2, 50});
+    table->last_chunk()->finalize();
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // The rows are ordered by p and o: (1, 1, 20), (1, 1, 30), (1, 2, 50), (1, 3, 10), (2, 1, NULL), (2, 2, 40)
+  std::shared_ptr<WindowFunctionExpression> _window_function(const WindowFunction window_function,
+                                                             const std::shared_ptr<AbstractExpression>& argument,
+                                                             const WindowFrame& frame = {}) const {
+    return std::make_shared<WindowFunctionExpression>(
+        window_function, argument, std::vector<std::shared_ptr<AbstractExpression>>{_p},
+        std::vector<std::shared_ptr<AbstractExpression>>{_o}, std::vector<SortMode>{SortMode::Ascending}, frame);
+  }
+
+  static WindowColumn _window_column(const std::shared_ptr<AbstractOperator>& input,
+                                     const std::shared_ptr<WindowFunctionExpression>& expression) {
+    const auto window = std::make_shared<Window>(input, expression);
+    window->execute();
+
+    const auto& output = window->get_output();
+    auto values = WindowColumn{};
+    for (auto row = size_t{0}; row < output->row_count(); ++row) {
+      const auto value = output->get_row(row).back();
+      values.emplace_back(variant_is_null(value) ? std::nullopt : std::optional<AllTypeVariant>{value});
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  const std::shared_ptr<AbstractExpression> _p = pqp_column_(ColumnID{0}, DataType::Int, false, "p");
+  const std::shared_ptr<AbstractExpression> _o = pqp_column_(ColumnID{1}, DataType::Int, false, "o");
+  const std::shared_ptr<AbstractExpression> _v = pqp_column_(ColumnID{2}, DataType::Int, true, "v");
+};
+
+TEST_F(OperatorsWindowTest, RankingFunctions) {
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::RowNumber, nullptr)),
+            (WindowColumn{int64_t{1}, int64_t{2}, int64_t{3}, int64_t{4}, int64_t{1}, int64_t{2}}));
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Rank, nullptr)),
+            (WindowColumn{int64_t{1}, int64_t{1}, int64_t{3}, int64_t{4}, int64_t{1}, int64_t{2}}));
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::DenseRank, nullptr)),
+            (WindowColumn{int64_t{1}, int64_t{1}, int64_t{2}, int64_t{3}, int64_t{1}, int64_t{2}}));
+}
+
+TEST_F(OperatorsWindowTest, OutputColumns) {
+  const auto window = std::make_shared<Window>(_table_wrapper, _window_function(WindowFunction::Sum, _v));
+  window->execute();
+
+  const auto& output = window->get_output();
+  ASSERT_EQ(output->column_count(), 4u);
+  EXPECT_EQ(output->column_data_type(ColumnID{3}), DataType::Long);
+  EXPECT_TRUE(output->column_is_nullable(ColumnID{3}));
+  EXPECT_EQ(output->get_row(3), (std::vector<AllTypeVariant>{1, 3, 10, int64_t{110}}));
+  EXPECT_TRUE(variant_is_null(output->get_row(4).back()));
+}
+
+TEST_F(OperatorsWindowTest, RangeFrameIncludesPeers) {
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Sum, _v)),
+            (WindowColumn{int64_t{50}, int64_t{50}, int64_t{100}, int64_t{110}, std::nullopt, int64_t{40}}));
+
+  const auto entire_partition = WindowFrame{FrameType::Range, std::nullopt, std::nullopt};
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Count, nullptr, entire_partition)),
+            (WindowColumn{int64_t{4}, int64_t{4}, int64_t{4}, int64_t{4}, int64_t{2}, int64_t{2}}));
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Count, _v, entire_partition)),
+            (WindowColumn{int64_t{4}, int64_t{4}, int64_t{4}, int64_t{4}, int64_t{1}, int64_t{1}}));
+}
+
+TEST_F(OperatorsWindowTest, RowsFrame) {
+  const auto sliding = WindowFrame{FrameType::Rows, 1, 1};
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Sum, _v, sliding)),
+            (WindowColumn{int64_t{50}, int64_t{100}, int64_t{90}, int64_t{60}, int64_t{40}, int64_t{40}}));
+
+  const auto preceding = WindowFrame{FrameType::Rows, 1, 0};
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Min, _v, preceding)),
+            (WindowColumn{20, 20, 30, 10, std::nullopt, 40}));
+  EXPECT_EQ(_window_column(_table_wrapper, _window_function(WindowFunction::Max, _v, preceding)),
+            (WindowColumn{20, 30, 50, 50, std::nullopt, 40}));
+}
+
+TEST_F(OperatorsWindowTest, WithoutPartitionsAndOrder) {
+  const auto expression = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Avg, _v, std::vector<std::shared_ptr<AbstractExpression>>{},
+      std::vector<std::shared_ptr<AbstractExpression>>{}, std::vector<SortMode>{});
+  EXPECT_EQ(_window_column(_table_wrapper, expression), WindowColumn(6, 30.0));
+}
+
+TEST_F(OperatorsWindowTest, ReferenceInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_o, 1));
+  table_scan->execute();
+
+  const auto window = std::make_shared<Window>(table_scan, _window_function(WindowFunction::RowNumber, nullptr));
+  window->execute();
+
+  const auto& output = window->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  ASSERT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_row(0), (std::vector<AllTypeVariant>{1, 2, 50, int64_t{1}}));
+  EXPECT_EQ(output->get_row(1), (std::vector<AllTypeVariant>{1, 3, 10, int64_t{2}}));
+  EXPECT_EQ(output->get_row(2), (std::vector<AllTypeVariant>{2, 2, 40, int64_t{1}}));
+}
+
+TEST_F(OperatorsWindowTest, EmptyInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_o, 5));
+  table_scan->execute();
+
+  const auto window = std::make_shared<Window>(table_scan, _window_function(WindowFunction::Rank, nullptr));
+  window->execute();
+
+  EXPECT_EQ(window->get_output()->row_count(), 0u);
+  EXPECT_EQ(window->get_output()->column_count(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "optimizer/adaptive_reoptimizer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class AdaptiveReoptimizerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // t3 holds the values of t1 and t2 three times, so that the join of t1 and t2 is estimated to be the cheapest
+    for (const auto& [table_name, repetitions] : {std::pair{"t1", 1}, std::pair{"t2", 1}, std::pair{"t3", 3}}) {
+      auto column_definitions = TableColumnDefinitions{};
+      column_definitions.emplace_back("a", DataType::Int, false);
+      column_definitions.emplace_back("b", DataType::Int, false);
+      const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100}, UseMvcc::Yes);
+      for (auto repetition = 0; repetition < repetitions; ++repetition) {
+        for (auto value = int32_t{0}; value < 1'000; ++value) {
+          table->append({value, value});
+        }
+      }
+      Hyrise::get().storage_manager.add_table(table_name, table);
+    }
+  }
+
+  void TearDown() override {
+    Hyrise::get().adaptive_reoptimizer = nullptr;
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  static std::shared_ptr<AbstractLQPNode> optimized_lqp(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    return pipeline.get_optimized_logical_plans().at(0);
+  }
+
+  // The CardinalityEstimator cannot estimate the predicate on an arithmetic expression and assumes that it selects all
+  // rows of t1, so the result of the first join is overestimated by two orders of magnitude
+  const std::string misestimated_join_query =
+      "SELECT t1.a, t3.b FROM t1, t2, t3 WHERE t1.a = t2.a AND t2.a = t3.a AND t1.b + 1 <= 10";
+};
+
+TEST_F(AdaptiveReoptimizerTest, IsApplicable) {
+  EXPECT_TRUE(AdaptiveReoptimizer::is_applicable(optimized_lqp(misestimated_join_query)));
+  EXPECT_FALSE(AdaptiveReoptimizer::is_applicable(optimized_lqp("SELECT * FROM t1, t2 WHERE t1.a = t2.a")));
+  EXPECT_FALSE(AdaptiveReoptimizer::is_applicable(optimized_lqp("INSERT INTO t1 SELECT t2.a, t3.b FROM t2, t3")));
+}
+
+TEST_F(AdaptiveReoptimizerTest, ReoptimizeMisestimatedJoins) {
+  const auto expected_table = execute(misestimated_join_query);
+  EXPECT_EQ(expected_table->row_count(), 30);
+
+  const auto adaptive_reoptimizer = std::make_shared<AdaptiveReoptimizer>();
+  Hyrise::get().adaptive_reoptimizer = adaptive_reoptimizer;
+  EXPECT_TABLE_EQ_UNORDERED(execute(misestimated_join_query), expected_table);
+  EXPECT_GE(adaptive_reoptimizer->reoptimization_count, 1);
+}
+
+TEST_F(AdaptiveReoptimizerTest, KeepPlanBelowThreshold) {
+  const auto expected_table = execute(misestimated_join_query);
+
+  const auto adaptive_reoptimizer = std::make_shared<AdaptiveReoptimizer>(1'000'000.0);
+  Hyrise::get().adaptive_reoptimizer = adaptive_reoptimizer;
+  EXPECT_TABLE_EQ_UNORDERED(execute(misestimated_join_query), expected_table);
+  EXPECT_EQ(adaptive_reoptimizer->reoptimization_count, 0);
+}
+
+}  // namespace opossum
@@ -2,12 +2,14 @@
 
 #include "cost_estimation/cost_estimator_logical.hpp"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimator.hpp"
 #include "statistics/table_statistics.hpp"
@@ -240,4 +242,56 @@ TEST_F(DpCcpTest, UncorrelatedPredicates) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(DpCcpTest, CsgCmpPairLimit) {
+  // A star with four vertices has twelve CsgCmpPairs
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{4, 0b0101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_a_d = JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(a_a, d_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c, node_d}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_a_d}));
+
+  EXPECT_TRUE(DpCcp{12}(join_graph, cost_estimator));
+  EXPECT_FALSE(DpCcp{11}(join_graph, cost_estimator));
+}
+
+TEST_F(DpCcpTest, ConcurrentPlanning) {
+  // A clique of seven vertices has 966 CsgCmpPairs, so that the larger vertex sets are planned by multiple tasks. The
+  // plan has to be the same as when planning serially.
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto columns = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto vertex_idx = size_t{0}; vertex_idx < 7; ++vertex_idx) {
+    const auto row_count = 10 * (vertex_idx + 1);
+    const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100, static_cast<float>(row_count), 10);
+    const auto node =
+        create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count, {histogram});
+    vertices.emplace_back(node);
+    columns.emplace_back(node->get_column("a"));
+  }
+
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (auto first_vertex_idx = size_t{0}; first_vertex_idx < vertices.size(); ++first_vertex_idx) {
+    for (auto second_vertex_idx = first_vertex_idx + 1; second_vertex_idx < vertices.size(); ++second_vertex_idx) {
+      auto vertex_set = JoinGraphVertexSet{vertices.size()};
+      vertex_set.set(first_vertex_idx);
+      vertex_set.set(second_vertex_idx);
+      edges.emplace_back(vertex_set, expression_vector(equals_(columns[first_vertex_idx], columns[second_vertex_idx])));
+    }
+  }
+  const auto join_graph = JoinGraph{vertices, edges};
+
+  const auto serial_lqp = DpCcp{}(join_graph, cost_estimator->new_instance());  // NOLINT
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto caching_cost_estimator = cost_estimator->new_instance();
+  caching_cost_estimator->guarantee_bottom_up_construction();
+  caching_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+  const auto concurrent_lqp = DpCcp{}(join_graph, caching_cost_estimator);  // NOLINT
+
+  EXPECT_LQP_EQ(concurrent_lqp, serial_lqp);
+}
+
 }  // namespace opossum
+
@@ -164,4 +164,17 @@ TEST_F(EnumerateCcpTest, ArbitraryVertexNumbering) {
   EXPECT_TRUE(equals(pairs[3], std::make_pair(0b101ul, 0b010ul)));
 }
 
+TEST_F(EnumerateCcpTest, PairCountLimit) {
+  // The star with four vertices has twelve CCPs (see above)
+  std::vector<std::pair<size_t, size_t>> edges{{0, 1}, {0, 2}, {0, 3}};
+
+  auto enumerate_ccp_within_limit = EnumerateCcp{4, edges, 12};
+  EXPECT_EQ(enumerate_ccp_within_limit().size(), 12u);
+  EXPECT_FALSE(enumerate_ccp_within_limit.limit_exceeded());
+
+  auto enumerate_ccp_above_limit = EnumerateCcp{4, edges, 11};
+  EXPECT_LE(enumerate_ccp_above_limit().size(), 11u);
+  EXPECT_TRUE(enumerate_ccp_above_limit.limit_exceeded());
+}
+
 }  // namespace opossum
@@ -0,0 +1,134 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    // All columns have the same statistics, only Table row counts differ
+    const auto single_bin_histogram_a = GenericHistogram<int32_t>::with_single_bin(0, 100, 5'000, 100);
+    const auto single_bin_histogram_b = GenericHistogram<int32_t>::with_single_bin(0, 100, 1'000, 100);
+    const auto single_bin_histogram_c = GenericHistogram<int32_t>::with_single_bin(0, 100, 200, 100);
+    const auto single_bin_histogram_d = GenericHistogram<int32_t>::with_single_bin(0, 100, 500, 100);
+
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a_a"}}, 5'000,
+                                              {single_bin_histogram_a});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "b_a"}}, 1'000,
+                                              {single_bin_histogram_b});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "c_a"}}, 200,
+                                              {single_bin_histogram_c});
+    node_d = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "d_a"}}, 500,
+                                              {single_bin_histogram_d});
+
+    a_a = node_a->get_column("a_a");
+    b_a = node_b->get_column("b_a");
+    c_a = node_c->get_column("c_a");
+    d_a = node_d->get_column("d_a");
+  }
+
+  // Returns the number of inner JoinNodes and expects that the plan contains no cross joins
+  static size_t inner_join_count(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    auto join_count = size_t{0};
+    visit_lqp(lqp, [&](const auto& node) {
+      if (node->type == LQPNodeType::Join) {
+        EXPECT_EQ(static_cast<const JoinNode&>(*node).join_mode, JoinMode::Inner);
+        ++join_count;
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    return join_count;
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a, d_a;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+};
+
+TEST_F(LinearizedDpTest, Linearize) {
+  // Star with the center 0. Joining 2 first reduces the cardinality, joining 3 increases it, so that 3 is joined last.
+  const auto cardinalities = std::vector<double>{1'000, 10, 100, 50};
+  const auto tree_edges = std::vector<std::tuple<size_t, size_t, double>>{{0, 1, 0.1}, {0, 2, 0.001}, {0, 3, 0.1}};
+
+  EXPECT_EQ(LinearizedDp::linearize(cardinalities, tree_edges), (std::vector<size_t>{0, 2, 1, 3}));
+}
+
+TEST_F(LinearizedDpTest, SingleVertex) {
+  const auto edge_a = JoinGraphEdge{JoinGraphVertexSet{1, 0b1}, expression_vector(greater_than_(a_a, 0))};
+  const auto join_graph =
+      JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a}, std::vector<JoinGraphEdge>{edge_a}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  const auto expected_lqp = PredicateNode::make(greater_than_(a_a, 0), node_a);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LinearizedDpTest, CyclicQuery) {
+  // Cycle a - b - c - d - a with a local predicate on a. The cycle is broken up for the linearization, but all join
+  // predicates are placed.
+  const auto edge_a = JoinGraphEdge{JoinGraphVertexSet{4, 0b0001}, expression_vector(greater_than_(a_a, 0))};
+  const auto edge_ab = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto edge_bc = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(b_a, c_a))};
+  const auto edge_cd = JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a))};
+  const auto edge_ad = JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(a_a, d_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b, node_c, node_d},
+                                    std::vector<JoinGraphEdge>{edge_a, edge_ab, edge_bc, edge_cd, edge_ad}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  EXPECT_EQ(inner_join_count(actual_lqp), 3);
+
+  auto predicate_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      predicate_count += static_cast<const JoinNode&>(*node).join_predicates().size();
+    } else if (node->type == LQPNodeType::Predicate) {
+      ++predicate_count;
+      // The local predicate is pushed down to its vertex
+      if (*static_cast<const PredicateNode&>(*node).predicate() == *greater_than_(a_a, 0)) {
+        EXPECT_EQ(node->left_input(), node_a);
+      }
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(predicate_count, 5);
+}
+
+TEST_F(LinearizedDpTest, UncorrelatedPredicate) {
+  const auto edge_uncorrelated = JoinGraphEdge{JoinGraphVertexSet{2, 0b0000}, expression_vector(equals_(6, 6))};
+  const auto edge_ab = JoinGraphEdge{JoinGraphVertexSet{2, 0b0011}, expression_vector(equals_(a_a, b_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b},
+                                    std::vector<JoinGraphEdge>{edge_uncorrelated, edge_ab}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(6, 6),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
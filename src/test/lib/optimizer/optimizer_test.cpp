@@ -9,6 +9,8 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
 
@@ -264,4 +266,48 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   }
 }
 
+TEST_F(OptimizerTest, IsSimpleStatement) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+  const auto stored_table_a = StoredTableNode::make("table_a");
+  const auto stored_table_b = StoredTableNode::make("table_b");
+  const auto a_a = stored_table_a->get_column("a");
+  const auto b_a = stored_table_b->get_column("a");
+
+  // clang-format off
+  const auto point_lookup =
+  ProjectionNode::make(expression_vector(a_a),
+    PredicateNode::make(equals_(a_a, 123),
+      ValidateNode::make(
+        stored_table_a)));
+
+  const auto join =
+  JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+    stored_table_a,
+    stored_table_b);
+  // clang-format on
+
+  EXPECT_TRUE(Optimizer::is_simple_statement(point_lookup));
+  EXPECT_FALSE(Optimizer::is_simple_statement(join));
+  EXPECT_FALSE(Optimizer::is_simple_statement(PredicateNode::make(greater_than_(a, subquery_b), node_a)));
+}
+
+TEST_F(OptimizerTest, OptimizesSimpleStatementsWithFewerRules) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  auto lqp = std::static_pointer_cast<AbstractLQPNode>(
+      PredicateNode::make(equals_(stored_table_node->get_column("a"), 123), stored_table_node));
+
+  const auto rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+  const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(std::move(lqp), rule_durations);
+
+  const auto simple_statement_rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+  Optimizer::create_simple_statement_optimizer()->optimize(optimized_lqp->deep_copy(),
+                                                           simple_statement_rule_durations);
+
+  EXPECT_EQ(rule_durations->size(), simple_statement_rule_durations->size());
+}
+
 }  // namespace opossum
@@ -24,6 +24,7 @@
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -396,6 +397,88 @@ TEST_F(ChunkPruningRuleTest, PrunePastNonFilteringNodes) {
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, BloomFilterPruningTest) {
+  // The ids are scattered over the chunks, so that the range of every chunk contains the searched ids
+  Hyrise::get().build_pruning_bloom_filters = true;
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"id", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{100});
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    table->append({row_id * 7'919 % 1'000});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  Hyrise::get().storage_manager.add_table("ids", table);
+
+  // 123 is only stored in chunk 5, 456 only in chunk 6. The min/max values of every chunk are about 0 and 999.
+  {
+    const auto stored_table_node = StoredTableNode::make("ids");
+    const auto input_lqp = PredicateNode::make(equals_(lqp_column_(stored_table_node, ColumnID{0}), 123),
+                                               stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+    const auto expected_chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}, ChunkID{4},
+                                                         ChunkID{6}, ChunkID{7}, ChunkID{8}, ChunkID{9}};
+    EXPECT_EQ(stored_table_node->pruned_chunk_ids(), expected_chunk_ids);
+  }
+
+  {
+    const auto stored_table_node = StoredTableNode::make("ids");
+    const auto input_lqp = PredicateNode::make(
+        in_(lqp_column_(stored_table_node, ColumnID{0}), list_(123, 456, NullValue{})), stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+    const auto expected_chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3},
+                                                         ChunkID{4}, ChunkID{7}, ChunkID{8}, ChunkID{9}};
+    EXPECT_EQ(stored_table_node->pruned_chunk_ids(), expected_chunk_ids);
+  }
+
+  {
+    // NOT IN cannot be pruned
+    const auto stored_table_node = StoredTableNode::make("ids");
+    const auto input_lqp =
+        PredicateNode::make(not_in_(lqp_column_(stored_table_node, ColumnID{0}), list_(123)), stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+    EXPECT_TRUE(stored_table_node->pruned_chunk_ids().empty());
+  }
+}
+
+TEST_F(ChunkPruningRuleTest, PartitionPruningTest) {
+  // Each day is stored in the partition of its month. The chunks are mutable and have no pruning statistics.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"day", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{10});
+  table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0, 31, 59, 90}));
+  table->append({5});
+  table->append({40});
+  table->append({70});
+  table->append({6});
+  Hyrise::get().storage_manager.add_table("days", table);
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  {
+    const auto stored_table_node = StoredTableNode::make("days");
+    const auto input_lqp = PredicateNode::make(
+        greater_than_equals_(lqp_column_(stored_table_node, ColumnID{0}), 59), stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+    EXPECT_EQ(stored_table_node->pruned_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  }
+
+  {
+    const auto stored_table_node = StoredTableNode::make("days");
+    const auto input_lqp = PredicateNode::make(
+        between_inclusive_(lqp_column_(stored_table_node, ColumnID{0}), 31, 58), stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+    EXPECT_EQ(stored_table_node->pruned_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{2}}));
+  }
+
+  {
+    const auto stored_table_node = StoredTableNode::make("days");
+    const auto input_lqp =
+        PredicateNode::make(in_(lqp_column_(stored_table_node, ColumnID{0}), list_(5, 75)), stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, input_lqp);
+    EXPECT_EQ(stored_table_node->pruned_chunk_ids(), (std::vector<ChunkID>{ChunkID{1}}));
+  }
+}
+
 TEST_F(ChunkPruningRuleTest, ValueOutOfRange) {
   // Filters are not required to handle values out of their data type's range and the ColumnPruningRule currently
   // doesn't convert out-of-range values into the type's range
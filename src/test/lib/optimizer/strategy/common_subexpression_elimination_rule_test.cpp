@@ -0,0 +1,105 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/common_subexpression_elimination_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CommonSubexpressionEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+    c = node_a->get_column("c");
+
+    rule = std::make_shared<CommonSubexpressionEliminationRule>();
+  }
+
+  std::shared_ptr<CommonSubexpressionEliminationRule> rule;
+  std::shared_ptr<MockNode> node_a;
+  std::shared_ptr<LQPColumnExpression> a, b, c;
+};
+
+TEST_F(CommonSubexpressionEliminationRuleTest, ComputeSharedExpressionBelowPredicates) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(mul_(a, b), add_(mul_(a, b), c)),
+    PredicateNode::make(less_than_(c, 7),
+      PredicateNode::make(greater_than_(mul_(a, b), 5),
+        PredicateNode::make(greater_than_(a, 1),
+          node_a))));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(mul_(a, b), add_(mul_(a, b), c)),
+    PredicateNode::make(less_than_(c, 7),
+      PredicateNode::make(greater_than_(mul_(a, b), 5),
+        ProjectionNode::make(expression_vector(a, b, c, mul_(a, b)),
+          PredicateNode::make(greater_than_(a, 1),
+            node_a)))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  // Applying the rule again does not add another projection
+  EXPECT_LQP_EQ(apply_rule(rule, actual_lqp), expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, ShareOutermostExpressions) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(mul_(add_(a, 1), b)),
+    PredicateNode::make(greater_than_(mul_(add_(a, 1), b), 5),
+      PredicateNode::make(greater_than_(add_(a, 1), c),
+        node_a)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(mul_(add_(a, 1), b)),
+    PredicateNode::make(greater_than_(mul_(add_(a, 1), b), 5),
+      PredicateNode::make(greater_than_(add_(a, 1), c),
+        ProjectionNode::make(expression_vector(a, b, c, mul_(add_(a, 1), b), add_(a, 1)),
+          node_a))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, KeepPlansWithoutSharedExpressions) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(add_(a, b), mul_(a, c)),
+    PredicateNode::make(greater_than_(mul_(a, b), 5),
+      node_a));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  EXPECT_LQP_EQ(apply_rule(rule, input_lqp), expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, KeepPredicatesWithMultipleOutputs) {
+  // The new column would be computed for the other output as well
+  const auto predicate_node = PredicateNode::make(greater_than_(mul_(a, b), 5), node_a);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(SetOperationMode::All,
+    ProjectionNode::make(expression_vector(mul_(a, b)),
+      predicate_node),
+    ProjectionNode::make(expression_vector(add_(mul_(a, b), 1)),
+      predicate_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  EXPECT_LQP_EQ(apply_rule(rule, input_lqp), expected_lqp);
+}
+
+}  // namespace opossum
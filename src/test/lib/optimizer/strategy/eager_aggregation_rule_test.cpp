@@ -0,0 +1,167 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/eager_aggregation_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class EagerAggregationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+
+    // The statistics of the tables are created when they are added, so the rows have to be appended before
+    const auto customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_custkey", DataType::Int, false},
+                               {"c_nationkey", DataType::Int, false},
+                               {"c_acctbal", DataType::Int, true}},
+        TableType::Data, 50, UseMvcc::Yes);
+    for (auto custkey = int32_t{0}; custkey < 100; ++custkey) {
+      customer_table->append({custkey, custkey % 5, custkey * 10});
+    }
+    customer_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    storage_manager.add_table("customer", customer_table);
+
+    const auto nation_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"n_nationkey", DataType::Int, false},
+                               {"n_regionkey", DataType::Int, false},
+                               {"n_name", DataType::String, false}},
+        TableType::Data, 50, UseMvcc::Yes);
+    for (auto nationkey = int32_t{0}; nationkey < 5; ++nationkey) {
+      nation_table->append({nationkey, nationkey % 2, pmr_string{"nation" + std::to_string(nationkey)}});
+    }
+    nation_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    storage_manager.add_table("nation", nation_table);
+
+    customer = StoredTableNode::make("customer");
+    c_custkey = customer->get_column("c_custkey");
+    c_nationkey = customer->get_column("c_nationkey");
+    c_acctbal = customer->get_column("c_acctbal");
+
+    nation = StoredTableNode::make("nation");
+    n_nationkey = nation->get_column("n_nationkey");
+    n_regionkey = nation->get_column("n_regionkey");
+    n_name = nation->get_column("n_name");
+
+    rule = std::make_shared<EagerAggregationRule>();
+  }
+
+  std::shared_ptr<EagerAggregationRule> rule;
+  std::shared_ptr<StoredTableNode> customer, nation;
+  std::shared_ptr<LQPColumnExpression> c_custkey, c_nationkey, c_acctbal, n_nationkey, n_regionkey, n_name;
+};
+
+TEST_F(EagerAggregationRuleTest, PushSumCountAndAverage) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(n_name), expression_vector(sum_(c_acctbal), count_star_(customer), avg_(c_acctbal)),  // NOLINT
+    JoinNode::make(JoinMode::Inner, equals_(c_nationkey, n_nationkey),
+      customer,
+      nation));
+  // clang-format on
+
+  const auto partial_sum = sum_(c_acctbal);
+  const auto partial_count_star = count_star_(customer);
+  const auto partial_count = count_(c_acctbal);
+  const auto average = div_(cast_(sum_(partial_sum), DataType::Double), sum_(partial_count));
+  const auto final_expressions = expression_vector(n_name, sum_(partial_sum), sum_(partial_count_star), average);
+
+  // clang-format off
+  const auto expected_lqp =
+  AliasNode::make(final_expressions, std::vector<std::string>{"n_name", "SUM(c_acctbal)", "COUNT(*)", "AVG(c_acctbal)"},  // NOLINT
+    ProjectionNode::make(final_expressions,
+      AggregateNode::make(expression_vector(n_name), expression_vector(sum_(partial_sum), sum_(partial_count_star), sum_(partial_count)),  // NOLINT
+        JoinNode::make(JoinMode::Inner, equals_(c_nationkey, n_nationkey),
+          AggregateNode::make(expression_vector(c_nationkey), expression_vector(partial_sum, partial_count_star, partial_count),  // NOLINT
+            customer),
+          nation))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(EagerAggregationRuleTest, PushIntoRightInputWithComputedArgument) {
+  // The ProjectionNode of the arguments is moved below the partial aggregate, the aliases are kept
+  const auto argument = add_(c_acctbal, 1);
+
+  // clang-format off
+  const auto input_lqp =
+  AliasNode::make(expression_vector(n_name, max_(argument)), std::vector<std::string>{"name", "maximum"},
+    AggregateNode::make(expression_vector(n_name), expression_vector(max_(argument)),
+      ProjectionNode::make(expression_vector(n_name, argument),
+        JoinNode::make(JoinMode::Inner, equals_(n_nationkey, c_nationkey),
+          nation,
+          customer))));
+
+  const auto expected_lqp =
+  AliasNode::make(expression_vector(n_name, max_(max_(argument))), std::vector<std::string>{"name", "maximum"},
+    AggregateNode::make(expression_vector(n_name), expression_vector(max_(max_(argument))),
+      JoinNode::make(JoinMode::Inner, equals_(n_nationkey, c_nationkey),
+        nation,
+        AggregateNode::make(expression_vector(c_nationkey), expression_vector(max_(argument)),
+          ProjectionNode::make(expression_vector(c_nationkey, argument),
+            customer)))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(EagerAggregationRuleTest, KeepAggregates) {
+  const auto make_input_lqp = [&](const size_t variant) -> std::shared_ptr<AbstractLQPNode> {
+    const auto customer_node = StoredTableNode::make("customer");
+    const auto custkey = customer_node->get_column("c_custkey");
+    const auto nationkey = customer_node->get_column("c_nationkey");
+    const auto acctbal = customer_node->get_column("c_acctbal");
+    const auto nation_node = StoredTableNode::make("nation");
+    const auto join_predicate = equals_(nationkey, nation_node->get_column("n_nationkey"));
+    const auto name = nation_node->get_column("n_name");
+
+    switch (variant) {
+      case 0:
+        // Outer join
+        return AggregateNode::make(expression_vector(name), expression_vector(sum_(acctbal)),
+                                   JoinNode::make(JoinMode::Left, join_predicate, customer_node, nation_node));
+      case 1:
+        // Neither input is unique on the join columns
+        return AggregateNode::make(
+            expression_vector(name), expression_vector(sum_(acctbal)),
+            JoinNode::make(JoinMode::Inner, equals_(nationkey, nation_node->get_column("n_regionkey")), customer_node,
+                           nation_node));
+      case 2:
+        // COUNT(DISTINCT) cannot be merged
+        return AggregateNode::make(expression_vector(name), expression_vector(count_distinct_(acctbal)),
+                                   JoinNode::make(JoinMode::Inner, join_predicate, customer_node, nation_node));
+      case 3:
+        // The argument is a column of the other input
+        return AggregateNode::make(expression_vector(nationkey),
+                                   expression_vector(sum_(nation_node->get_column("n_regionkey"))),
+                                   JoinNode::make(JoinMode::Inner, join_predicate, customer_node, nation_node));
+      case 4:
+        // Grouping by the unique c_custkey does not reduce the rows
+        return AggregateNode::make(expression_vector(custkey, name), expression_vector(sum_(acctbal)),
+                                   JoinNode::make(JoinMode::Inner, join_predicate, customer_node, nation_node));
+      default:
+        // Without a GROUP BY, the merged COUNT(*) of an empty join would be NULL
+        return AggregateNode::make(expression_vector(), expression_vector(count_star_(customer_node)),
+                                   JoinNode::make(JoinMode::Inner, join_predicate, customer_node, nation_node));
+    }
+  };
+
+  for (auto variant = size_t{0}; variant < 6; ++variant) {
+    const auto input_lqp = make_input_lqp(variant);
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
@@ -22,6 +22,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -147,6 +148,48 @@ TEST_F(IndexScanRuleTest, IndexScanWithIndex) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithHashIndexForEqualsOnly) {
+  table->create_index<HashIndex>({ColumnID{2}});
+
+  generate_mock_statistics(1'000'000);
+  table->table_statistics()->column_statistics.at(2)->set_statistics_object(
+      GenericHistogram<int32_t>::with_single_bin(0, 20'000, 1'000'000, 20'000));
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, 19'900));
+  predicate_node_0->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'990));
+  predicate_node_1->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanWithTableIndex) {
+  table->create_table_index(ColumnID{2});
+  stored_table_node->set_pruned_column_ids({ColumnID{0}});
+
+  generate_mock_statistics(1'000'000);
+
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'990));
+  predicate_node_0->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  // Not selective enough
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 10));
+  predicate_node_1->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+
+  // Range lookups require values of the column's data type
+  auto predicate_node_2 = PredicateNode::make(greater_than_(c, 19'990.5));
+  predicate_node_2->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::TableScan);
+}
+
 TEST_F(IndexScanRuleTest, IndexScanWithIndexPrunedColumn) {
   table->create_index<GroupKeyIndex>({ColumnID{2}});
   stored_table_node->set_pruned_column_ids({ColumnID{0}});
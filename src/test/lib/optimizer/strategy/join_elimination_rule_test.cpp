@@ -0,0 +1,203 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/join_elimination_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+
+    const auto customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_custkey", DataType::Int, false}, {"c_name", DataType::String, false}},
+        TableType::Data, 2, UseMvcc::Yes);
+    customer_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    storage_manager.add_table("customer", customer_table);
+
+    const auto orders_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"o_orderkey", DataType::Int, false}, {"o_custkey", DataType::Int, true}},
+        TableType::Data, 2, UseMvcc::Yes);
+    orders_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    orders_table->add_soft_foreign_key_constraint({{ColumnID{1}}, "customer", {ColumnID{0}}});
+    storage_manager.add_table("orders", orders_table);
+
+    customer = StoredTableNode::make("customer");
+    c_custkey = customer->get_column("c_custkey");
+    c_name = customer->get_column("c_name");
+
+    orders = StoredTableNode::make("orders");
+    o_orderkey = orders->get_column("o_orderkey");
+    o_custkey = orders->get_column("o_custkey");
+
+    rule = std::make_shared<JoinEliminationRule>();
+  }
+
+  std::shared_ptr<JoinEliminationRule> rule;
+  std::shared_ptr<StoredTableNode> customer, orders;
+  std::shared_ptr<LQPColumnExpression> c_custkey, c_name, o_orderkey, o_custkey;
+};
+
+TEST_F(JoinEliminationRuleTest, LeftJoinWithUniqueRightInput) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    JoinNode::make(JoinMode::Left, equals_(o_custkey, c_custkey),
+      orders,
+      PredicateNode::make(equals_(c_name, "Alice"),
+        customer)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    orders);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, RightJoinWithUniqueLeftInput) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    JoinNode::make(JoinMode::Right, expression_vector(equals_(c_custkey, o_custkey), not_equals_(c_name, "Alice")),
+      customer,
+      orders));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    orders);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepLeftJoinWithUsedRightInput) {
+  // The columns of the discarded input are used by a projection or by the root node
+  // clang-format off
+  const auto projection_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey, c_name),
+    JoinNode::make(JoinMode::Left, equals_(o_custkey, c_custkey),
+      orders,
+      customer));
+
+  const auto root_lqp =
+  PredicateNode::make(greater_than_(o_orderkey, 5),
+    JoinNode::make(JoinMode::Left, equals_(o_custkey, c_custkey),
+      orders,
+      customer));
+  // clang-format on
+
+  for (const auto& input_lqp : std::vector<std::shared_ptr<AbstractLQPNode>>{projection_lqp, root_lqp}) {
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(JoinEliminationRuleTest, KeepLeftJoinWithoutUniqueRightInput) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    JoinNode::make(JoinMode::Left, equals_(o_orderkey, c_name),
+      orders,
+      customer));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, SemiJoinFollowingForeignKey) {
+  // o_custkey is nullable, so rows without a customer are removed
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    JoinNode::make(JoinMode::Semi, equals_(o_custkey, c_custkey),
+      ValidateNode::make(
+        orders),
+      ValidateNode::make(
+        customer)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(o_orderkey),
+    PredicateNode::make(is_not_null_(o_custkey),
+      ValidateNode::make(
+        orders)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepSemiJoinNotFollowingForeignKey) {
+  // The right input is filtered, the predicate does not follow the foreign key, or there is another predicate
+  // clang-format off
+  const auto filtered_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(o_custkey, c_custkey),
+    orders,
+    PredicateNode::make(equals_(c_name, "Alice"),
+      customer));
+
+  const auto other_column_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(o_orderkey, c_custkey),
+    orders,
+    customer);
+
+  const auto other_predicate_lqp =
+  JoinNode::make(JoinMode::Semi, expression_vector(equals_(o_custkey, c_custkey), not_equals_(o_orderkey, c_custkey)),
+    orders,
+    customer);
+  // clang-format on
+
+  for (const auto& input_lqp : {filtered_lqp, other_column_lqp, other_predicate_lqp}) {
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(JoinEliminationRuleTest, InnerJoinFollowingForeignKey) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(o_orderkey), expression_vector(count_star_(orders)),
+    JoinNode::make(JoinMode::Inner, equals_(c_custkey, o_custkey),
+      customer,
+      orders));
+
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(o_orderkey), expression_vector(count_star_(orders)),
+    PredicateNode::make(is_not_null_(o_custkey),
+      orders));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepInnerJoinWithCountStarOnDiscardedInput) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_star_(customer)),
+    JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey),
+      orders,
+      customer));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
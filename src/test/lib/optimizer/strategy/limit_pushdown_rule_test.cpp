@@ -0,0 +1,109 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/limit_pushdown_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LimitPushdownRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}});
+    x = node_b->get_column("x");
+
+    rule = std::make_shared<LimitPushdownRule>();
+  }
+
+  std::shared_ptr<LimitPushdownRule> rule;
+  std::shared_ptr<MockNode> node_a, node_b;
+  std::shared_ptr<LQPColumnExpression> a, b, x;
+};
+
+TEST_F(LimitPushdownRuleTest, MoveBelowProjectionAndAlias) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    AliasNode::make(expression_vector(add_(a, 1)), std::vector<std::string>{"c"},
+      ProjectionNode::make(expression_vector(add_(a, 1)),
+        SortNode::make(expression_vector(b), std::vector<SortMode>{SortMode::Ascending},
+          node_a))));
+
+  const auto expected_lqp =
+  AliasNode::make(expression_vector(add_(a, 1)), std::vector<std::string>{"c"},
+    ProjectionNode::make(expression_vector(add_(a, 1)),
+      LimitNode::make(value_(10),
+        SortNode::make(expression_vector(b), std::vector<SortMode>{SortMode::Ascending},
+          node_a))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, LimitRowPreservingInputs) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    JoinNode::make(JoinMode::Left, equals_(a, x),
+      UnionNode::make(SetOperationMode::All,
+        PredicateNode::make(greater_than_(a, 5),
+          node_a),
+        node_a),
+      node_b));
+
+  const auto expected_lqp =
+  LimitNode::make(value_(10),
+    JoinNode::make(JoinMode::Left, equals_(a, x),
+      LimitNode::make(value_(10),
+        UnionNode::make(SetOperationMode::All,
+          LimitNode::make(value_(10),
+            PredicateNode::make(greater_than_(a, 5),
+              node_a)),
+          LimitNode::make(value_(10),
+            node_a))),
+      node_b));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  // Applying the rule again does not add more limits
+  EXPECT_LQP_EQ(apply_rule(rule, actual_lqp), expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, KeepLimits) {
+  // Inner joins and filters can drop rows, the projection has another output
+  const auto projection_node = ProjectionNode::make(expression_vector(a), node_a);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(10),
+      projection_node),
+    LimitNode::make(value_(10),
+      JoinNode::make(JoinMode::Inner, equals_(a, x),
+        PredicateNode::make(greater_than_(a, 5),
+          projection_node),
+        node_b)));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/materialized_view_rewrite_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewRewriteRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table("t", std::make_shared<Table>(
+                                       TableColumnDefinitions{{"k", DataType::Int, false}, {"x", DataType::Int, true}},
+                                       TableType::Data, 2, UseMvcc::Yes));
+
+    const auto stored_table_node = StoredTableNode::make("t");
+    const auto view_lqp =
+        AggregateNode::make(expression_vector(stored_table_node->get_column("k")),
+                            expression_vector(sum_(stored_table_node->get_column("x"))),
+                            ValidateNode::make(stored_table_node));
+    const auto view = std::make_shared<LQPView>(view_lqp, std::unordered_map<ColumnID, std::string>{});
+    storage_manager.add_materialized_view("mv", view);
+
+    t = StoredTableNode::make("t");
+    k = t->get_column("k");
+    x = t->get_column("x");
+
+    rule = std::make_shared<MaterializedViewRewriteRule>();
+  }
+
+  std::shared_ptr<MaterializedViewRewriteRule> rule;
+  std::shared_ptr<StoredTableNode> t;
+  std::shared_ptr<LQPColumnExpression> k, x;
+};
+
+TEST_F(MaterializedViewRewriteRuleTest, ReplaceMatchingAggregate) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(sum_(x), k),
+    AggregateNode::make(expression_vector(k), expression_vector(sum_(x)),
+      ValidateNode::make(
+        t)));
+  // clang-format on
+
+  const auto partials = StoredTableNode::make("mv__partials");
+  const auto partials_k = partials->get_column("k");
+  const auto row_count = partials->get_column("__row_count");
+  const auto partial_sum = partials->get_column("__partial_1");
+  const auto partial_count = partials->get_column("__partial_2");
+  const auto merged_sum = case_(greater_than_(sum_(partial_count), 0), sum_(partial_sum), null_());
+  const auto merged_expressions = expression_vector(sum_(row_count), sum_(partial_sum), sum_(partial_count));
+
+  // clang-format off
+  const auto expected_lqp =
+  AliasNode::make(expression_vector(merged_sum, partials_k), std::vector<std::string>{"SUM(x)", "k"},
+    ProjectionNode::make(expression_vector(merged_sum, partials_k),
+      ProjectionNode::make(expression_vector(partials_k, merged_sum),
+        PredicateNode::make(greater_than_(sum_(row_count), 0),
+          AggregateNode::make(expression_vector(partials_k), merged_expressions,
+            ValidateNode::make(
+              partials))))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRewriteRuleTest, KeepAliases) {
+  // clang-format off
+  const auto input_lqp =
+  AliasNode::make(expression_vector(k, sum_(x)), std::vector<std::string>{"key", "total"},
+    AggregateNode::make(expression_vector(k), expression_vector(sum_(x)),
+      ValidateNode::make(
+        t)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  ASSERT_EQ(actual_lqp->type, LQPNodeType::Alias);
+  EXPECT_EQ(static_cast<const AliasNode&>(*actual_lqp).aliases, (std::vector<std::string>{"key", "total"}));
+  EXPECT_EQ(actual_lqp->left_input()->type, LQPNodeType::Projection);
+}
+
+TEST_F(MaterializedViewRewriteRuleTest, KeepDifferentAggregates) {
+  // Different aggregates, an additional predicate, and a missing ValidateNode
+  const auto make_input_lqp = [&](const size_t variant) -> std::shared_ptr<AbstractLQPNode> {
+    const auto stored_table_node = StoredTableNode::make("t");
+    const auto stored_k = stored_table_node->get_column("k");
+    const auto stored_x = stored_table_node->get_column("x");
+    switch (variant) {
+      case 0:
+        return AggregateNode::make(expression_vector(stored_k), expression_vector(max_(stored_x)),
+                                   ValidateNode::make(stored_table_node));
+      case 1:
+        return AggregateNode::make(expression_vector(stored_k), expression_vector(sum_(stored_x)),
+                                   PredicateNode::make(greater_than_(stored_x, 1),
+                                                       ValidateNode::make(stored_table_node)));
+      default:
+        return AggregateNode::make(expression_vector(stored_k), expression_vector(sum_(stored_x)), stored_table_node);
+    }
+  };
+
+  for (auto variant = size_t{0}; variant < 3; ++variant) {
+    const auto input_lqp = make_input_lqp(variant);
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
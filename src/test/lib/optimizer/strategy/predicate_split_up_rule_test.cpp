@@ -325,6 +325,32 @@ TEST_F(PredicateSplitUpRuleTest, SplitUpComplexNestedConjunctionsAndDisjunctions
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(PredicateSplitUpRuleTest, KeepColumnDisjunctions) {
+  // SELECT * FROM a WHERE (a < 3 OR b BETWEEN 5 AND 7 OR c IS NULL) AND (a > b OR a + 1 > 5)
+  rule = std::make_shared<PredicateSplitUpRule>(true, false);
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(and_(or_(less_than_(a_a, value_(3)), or_(between_inclusive_(a_b, 5, 7), is_null_(a_c))), or_(greater_than_(a_a, a_b), greater_than_(add_(a_a, 1), 5))),  // NOLINT
+    node_a);
+
+  const auto column_disjunction_node =
+  PredicateNode::make(or_(less_than_(a_a, value_(3)), or_(between_inclusive_(a_b, 5, 7), is_null_(a_c))),
+    node_a);
+
+  const auto expected_lqp =
+  UnionNode::make(SetOperationMode::Positions,
+    PredicateNode::make(greater_than_(a_a, a_b),
+      column_disjunction_node),
+    PredicateNode::make(greater_than_(add_(a_a, 1), 5),
+      column_disjunction_node));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(PredicateSplitUpRuleTest, NoRewriteSimplePredicate) {
   // SELECT * FROM a WHERE a < 10
 
@@ -0,0 +1,104 @@
+#include "lib/optimizer/strategy/strategy_base_test.hpp"
+
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/runtime_filter_scan.hpp"
+#include "optimizer/strategy/runtime_join_filter_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class RuntimeJoinFilterRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("fact", load_table("resources/test_data/tbl/int_int_int.tbl", 2));
+    Hyrise::get().storage_manager.add_table("dimension", load_table("resources/test_data/tbl/int_int_float.tbl", 2));
+
+    _fact = StoredTableNode::make("fact");
+    _fact_a = _fact->get_column("a");
+    _fact_b = _fact->get_column("b");
+
+    _dimension = StoredTableNode::make("dimension");
+    _dimension_a = _dimension->get_column("a");
+    _dimension_c = _dimension->get_column("c");
+  }
+
+  // Creates the semi join reduction of the fact side of `fact JOIN dimension ON predicate`, as the
+  // SemiJoinReductionRule would
+  static std::shared_ptr<JoinNode> _make_semi_reduction(const std::shared_ptr<AbstractExpression>& predicate,
+                                                        const std::shared_ptr<AbstractLQPNode>& reduced_node,
+                                                        const std::shared_ptr<AbstractLQPNode>& reducer_node) {
+    const auto semi_join_reduction = JoinNode::make(JoinMode::Semi, predicate, reduced_node, reducer_node);
+    semi_join_reduction->is_semi_reduction = true;
+    return semi_join_reduction;
+  }
+
+  std::shared_ptr<StoredTableNode> _fact, _dimension;
+  std::shared_ptr<LQPColumnExpression> _fact_a, _fact_b, _dimension_a, _dimension_c;
+  std::shared_ptr<RuntimeJoinFilterRule> _rule{std::make_shared<RuntimeJoinFilterRule>()};
+};
+
+TEST_F(RuntimeJoinFilterRuleTest, ReductionOfStoredTableScan) {
+  const auto reducer = PredicateNode::make(greater_than_(_dimension_c, 11.0f), _dimension);
+
+  // clang-format off
+  const auto semi_join_reduction =
+  _make_semi_reduction(equals_(_fact_a, _dimension_a),
+    PredicateNode::make(greater_than_(_fact_b, 0),
+      ValidateNode::make(
+        _fact)),
+    reducer);
+
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(_fact_a, _dimension_a),
+    semi_join_reduction,
+    reducer);
+  // clang-format on
+
+  apply_rule(_rule, input_lqp);
+  EXPECT_TRUE(semi_join_reduction->is_runtime_filter);
+
+  // The RuntimeFilterScan and the join share the operator of the reducer side
+  const auto pqp = LQPTranslator{}.translate_node(input_lqp);
+  const auto runtime_filter_scan = std::dynamic_pointer_cast<const RuntimeFilterScan>(pqp->left_input());
+  ASSERT_TRUE(runtime_filter_scan);
+  EXPECT_EQ(runtime_filter_scan->column_ids(), (ColumnIDPair{ColumnID{0}, ColumnID{0}}));
+  EXPECT_EQ(runtime_filter_scan->right_input(), pqp->right_input());
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, NoSemiReduction) {
+  // Semi joins that are part of the query have to be exact
+  const auto semi_join = JoinNode::make(JoinMode::Semi, equals_(_fact_a, _dimension_a), _fact, _dimension);
+
+  apply_rule(_rule, semi_join);
+  EXPECT_FALSE(semi_join->is_runtime_filter);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, NoStoredTableScan) {
+  // The rows let through by a runtime filter above an aggregate would be aggregated
+  // clang-format off
+  const auto semi_join_reduction =
+  _make_semi_reduction(equals_(_fact_a, _dimension_a),
+    AggregateNode::make(expression_vector(_fact_a), expression_vector(),
+      _fact),
+    _dimension);
+  // clang-format on
+
+  apply_rule(_rule, semi_join_reduction);
+  EXPECT_FALSE(semi_join_reduction->is_runtime_filter);
+}
+
+TEST_F(RuntimeJoinFilterRuleTest, DifferentDataTypes) {
+  // The values of the columns are hashed, which requires them to have the same data type
+  const auto semi_join_reduction = _make_semi_reduction(equals_(_fact_a, _dimension_c), _fact, _dimension);
+
+  apply_rule(_rule, semi_join_reduction);
+  EXPECT_FALSE(semi_join_reduction->is_runtime_filter);
+}
+
+}  // namespace opossum
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/admission_control.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class AdmissionControlTest : public BaseTest {
+ protected:
+  // Busy-waits until the given number of queries waits for admission
+  static void _wait_for_waiting_queries(const AdmissionControl& admission_control, const size_t query_count) {
+    while (admission_control.waiting_query_count() != query_count) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+};
+
+TEST_F(AdmissionControlTest, UnlimitedAdmission) {
+  const auto admission_control = std::make_shared<AdmissionControl>();
+
+  auto tickets = std::vector<std::unique_ptr<AdmissionControl::Ticket>>{};
+  for (auto query_id = 0; query_id < 10; ++query_id) {
+    tickets.emplace_back(admission_control->admit(SessionID{1}));
+  }
+  EXPECT_EQ(admission_control->running_query_count(), 10);
+  EXPECT_EQ(admission_control->waiting_query_count(), 0);
+
+  tickets.clear();
+  EXPECT_EQ(admission_control->running_query_count(), 0);
+}
+
+TEST_F(AdmissionControlTest, ConcurrencyLimit) {
+  const auto admission_control = std::make_shared<AdmissionControl>(1);
+
+  auto ticket = admission_control->admit(SessionID{1});
+
+  auto admitted = std::atomic_bool{false};
+  auto thread = std::thread([&]() {
+    const auto second_ticket = admission_control->admit(SessionID{2});
+    admitted = true;
+  });
+
+  _wait_for_waiting_queries(*admission_control, 1);
+  EXPECT_FALSE(admitted);
+  EXPECT_EQ(admission_control->running_query_count(), 1);
+
+  ticket.reset();
+  thread.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(admission_control->running_query_count(), 0);
+  EXPECT_EQ(admission_control->waiting_query_count(), 0);
+}
+
+TEST_F(AdmissionControlTest, SessionQuota) {
+  const auto admission_control = std::make_shared<AdmissionControl>(0, 1);
+
+  auto ticket = admission_control->admit(SessionID{1});
+
+  // Other sessions are not affected by the quota of session 1
+  const auto other_ticket = admission_control->admit(SessionID{2});
+
+  auto admitted = std::atomic_bool{false};
+  auto thread = std::thread([&]() {
+    const auto second_ticket = admission_control->admit(SessionID{1});
+    admitted = true;
+  });
+
+  _wait_for_waiting_queries(*admission_control, 1);
+  EXPECT_FALSE(admitted);
+
+  // Raising the quota admits the waiting query
+  admission_control->set_max_queries_per_session(2);
+  thread.join();
+  EXPECT_TRUE(admitted);
+}
+
+TEST_F(AdmissionControlTest, WeightedFairOrder) {
+  const auto admission_control = std::make_shared<AdmissionControl>(1);
+  admission_control->set_session_weight(SessionID{1}, 2.0);
+
+  auto blocking_ticket = admission_control->admit(SessionID{0});
+
+  auto admission_order = std::vector<SessionID>{};
+  auto admission_order_mutex = std::mutex{};
+  auto threads = std::vector<std::thread>{};
+  const auto sessions = std::vector<SessionID>{1, 1, 1, 1, 2, 2};
+  for (auto query_id = size_t{0}; query_id < sessions.size(); ++query_id) {
+    threads.emplace_back([&, session_id = sessions[query_id]]() {
+      const auto ticket = admission_control->admit(session_id);
+      const auto lock = std::lock_guard<std::mutex>{admission_order_mutex};
+      admission_order.emplace_back(session_id);
+    });
+    _wait_for_waiting_queries(*admission_control, query_id + 1);
+  }
+
+  blocking_ticket.reset();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Session 1 gets twice as many admissions as session 2 while both wait
+  EXPECT_EQ(admission_order, std::vector<SessionID>({1, 2, 1, 1, 2, 1}));
+}
+
+TEST_F(AdmissionControlTest, Settings) {
+  const auto admission_control = std::make_shared<AdmissionControl>(4, 2);
+  admission_control->register_settings();
+
+  auto& settings_manager = Hyrise::get().settings_manager;
+  const auto max_concurrent_queries = settings_manager.get_setting("AdmissionControl.max_concurrent_queries");
+  const auto max_queries_per_session = settings_manager.get_setting("AdmissionControl.max_queries_per_session");
+  EXPECT_EQ(max_concurrent_queries->get(), "4");
+  EXPECT_EQ(max_queries_per_session->get(), "2");
+
+  max_concurrent_queries->set("8");
+  EXPECT_EQ(admission_control->max_concurrent_queries(), 8);
+  EXPECT_THROW(max_queries_per_session->set("-1"), InvalidInputException);
+  EXPECT_EQ(admission_control->max_queries_per_session(), 2);
+
+  admission_control->unregister_settings();
+  EXPECT_FALSE(settings_manager.has_setting("AdmissionControl.max_concurrent_queries"));
+}
+
+TEST_F(AdmissionControlTest, SQLPipeline) {
+  Hyrise::get().admission_control = std::make_shared<AdmissionControl>(1);
+
+  const auto [status, table] =
+      SQLPipelineBuilder{"SELECT 1"}.with_session_id(SessionID{3}).create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_EQ(Hyrise::get().admission_control->running_query_count(), 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/job_partitioner.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class JobPartitionerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 10 chunks of 10 rows each
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                     ChunkOffset{10}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      _table->append({value});
+    }
+    _table->last_chunk()->finalize();
+  }
+
+  using Groups = std::vector<std::vector<ChunkID>>;
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(JobPartitionerTest, MergeSmallChunks) {
+  const auto partitioner = JobPartitioner{25};
+  EXPECT_EQ(partitioner.partition(*_table), Groups({{ChunkID{0}, ChunkID{1}, ChunkID{2}},
+                                                    {ChunkID{3}, ChunkID{4}, ChunkID{5}},
+                                                    {ChunkID{6}, ChunkID{7}, ChunkID{8}},
+                                                    {ChunkID{9}}}));
+
+  // Only the given chunks are grouped
+  EXPECT_EQ(partitioner.partition(*_table, {ChunkID{1}, ChunkID{4}, ChunkID{5}, ChunkID{9}}),
+            Groups({{ChunkID{1}, ChunkID{4}, ChunkID{5}}, {ChunkID{9}}}));
+  EXPECT_TRUE(partitioner.partition(*_table, {}).empty());
+}
+
+TEST_F(JobPartitionerTest, LargeChunksGetJobOfTheirOwn) {
+  const auto groups = JobPartitioner{10}.partition(*_table);
+  ASSERT_EQ(groups.size(), 10u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) {
+    EXPECT_EQ(groups[chunk_id], std::vector<ChunkID>{chunk_id});
+  }
+}
+
+TEST_F(JobPartitionerTest, SmallInputIsSingleGroup) {
+  const auto groups = JobPartitioner{}.partition(*_table);
+  ASSERT_EQ(groups.size(), 1u);
+  EXPECT_EQ(groups[0].size(), 10u);
+}
+
+TEST_F(JobPartitionerTest, ChunkCost) {
+  EXPECT_DOUBLE_EQ(JobPartitioner::chunk_cost(*_table->get_chunk(ChunkID{0})), 10.0);
+
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_chunks(_table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::LZ4});
+  EXPECT_DOUBLE_EQ(JobPartitioner::chunk_cost(*_table->get_chunk(ChunkID{0})), 10.0);
+  EXPECT_DOUBLE_EQ(JobPartitioner::chunk_cost(*_table->get_chunk(ChunkID{1})), 40.0);
+
+  const auto pos_list = std::make_shared<EntireChunkPosList>(ChunkID{2}, ChunkOffset{10});
+  const auto reference_chunk =
+      std::make_shared<Chunk>(Segments{std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list)});
+  EXPECT_DOUBLE_EQ(JobPartitioner::chunk_cost(*reference_chunk), 20.0);
+
+  // The LZ4-encoded chunk is expensive enough for a job of its own
+  EXPECT_EQ(JobPartitioner{25}.partition(*_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}}),
+            Groups({{ChunkID{0}}, {ChunkID{1}}, {ChunkID{2}, ChunkID{3}}}));
+}
+
+TEST_F(JobPartitionerTest, ForEachChunk) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto mutex = std::mutex{};
+  auto processed_chunk_ids = std::vector<ChunkID>{};
+  using Progress = std::vector<std::pair<size_t, size_t>>;
+  auto progress = Progress{};
+  const auto functor = [&](const ChunkID chunk_id) {
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    processed_chunk_ids.emplace_back(chunk_id);
+  };
+  const auto progress_callback = [&](const size_t processed_chunk_count, const size_t chunk_count) {
+    progress.emplace_back(processed_chunk_count, chunk_count);
+  };
+
+  // Every chunk is processed by a job of its own
+  JobPartitioner{10}.for_each_chunk(*_table, {ChunkID{2}, ChunkID{3}, ChunkID{7}}, functor, progress_callback);
+  std::sort(processed_chunk_ids.begin(), processed_chunk_ids.end());
+  EXPECT_EQ(processed_chunk_ids, std::vector<ChunkID>({ChunkID{2}, ChunkID{3}, ChunkID{7}}));
+  EXPECT_EQ(progress, Progress({{1, 3}, {2, 3}, {3, 3}}));
+
+  processed_chunk_ids.clear();
+  JobPartitioner{25}.for_each_chunk(*_table, functor);
+  EXPECT_EQ(processed_chunk_ids.size(), 10u);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(JobPartitionerTest, Settings) {
+  auto& job_partitioner = Hyrise::get().job_partitioner;
+  job_partitioner.register_settings();
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("Scheduler.min_job_cost");
+  EXPECT_EQ(setting->get(), std::to_string(JobPartitioner::DEFAULT_MIN_JOB_COST));
+
+  setting->set("25");
+  EXPECT_EQ(job_partitioner.min_job_cost(), 25);
+  EXPECT_THROW(setting->set("many"), InvalidInputException);
+
+  job_partitioner.unregister_settings();
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("Scheduler.min_job_cost"));
+}
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -203,6 +205,43 @@ TEST_F(SchedulerTest, DiamondDependenciesWithScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, TaskGraphScheduledAtOnce) {
+  // A root task fans out to many tasks that are joined by a sink task. The graph is scheduled in reverse order, both
+  // from outside the scheduler and from within a worker, so that tasks become ready while their batch is enqueued.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto FAN_OUT = uint32_t{100};
+
+  const auto schedule_task_graph = [&]() {
+    auto counter = std::atomic_uint{0};
+    auto sink_counter_value = std::atomic_uint{0};
+
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    const auto root = std::make_shared<JobTask>([&]() { EXPECT_EQ(counter++, 0u); });
+    const auto sink = std::make_shared<JobTask>([&]() { sink_counter_value = counter++; });
+    tasks.emplace_back(sink);
+    for (auto task_index = uint32_t{0}; task_index < FAN_OUT; ++task_index) {
+      const auto task = std::make_shared<JobTask>([&]() { counter++; });
+      root->set_as_predecessor_of(task);
+      task->set_as_predecessor_of(sink);
+      tasks.emplace_back(task);
+    }
+    tasks.emplace_back(root);
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    EXPECT_EQ(counter, FAN_OUT + 2);
+    EXPECT_EQ(sink_counter_value, FAN_OUT + 1);
+  };
+
+  schedule_task_graph();
+
+  const auto outer_task = std::make_shared<JobTask>(schedule_task_graph);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({outer_task});
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(SchedulerTest, LinearDependenciesWithoutScheduler) {
   std::atomic_uint counter{0u};
   stress_linear_dependencies(counter);
@@ -290,4 +329,18 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, WaitForTaskChecksStealableTasks) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  // A task in the deque of another worker (reported by the callback) prevents the worker from going to sleep
+  const auto wait_begin = std::chrono::steady_clock::now();
+  auto checked_deques = false;
+  queue.wait_for_task(std::chrono::seconds{10}, [&]() {
+    checked_deques = true;
+    return true;
+  });
+  EXPECT_TRUE(checked_deques);
+  EXPECT_LT(std::chrono::steady_clock::now() - wait_begin, std::chrono::seconds{5});
+}
+
 }  // namespace opossum
@@ -0,0 +1,65 @@
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class TopologyTest : public BaseTest {
+ protected:
+  static std::optional<uint32_t> parse_cgroup_v2_cpu_limit(const std::string& cpu_max) {
+    return Topology::_parse_cgroup_v2_cpu_limit(cpu_max);
+  }
+
+  static std::optional<uint32_t> parse_cgroup_v1_cpu_limit(const std::string& cfs_quota_us,
+                                                           const std::string& cfs_period_us) {
+    return Topology::_parse_cgroup_v1_cpu_limit(cfs_quota_us, cfs_period_us);
+  }
+
+  static std::vector<CpuID> parse_cpu_list(const std::string& cpu_list) { return Topology::_parse_cpu_list(cpu_list); }
+};
+
+TEST_F(TopologyTest, ParseCgroupV2CpuLimit) {
+  EXPECT_EQ(parse_cgroup_v2_cpu_limit("max 100000"), std::nullopt);
+  EXPECT_EQ(parse_cgroup_v2_cpu_limit("200000 100000"), 2u);
+  EXPECT_EQ(parse_cgroup_v2_cpu_limit("150000 100000\n"), 2u);
+  EXPECT_EQ(parse_cgroup_v2_cpu_limit("50000 100000"), 1u);
+  EXPECT_EQ(parse_cgroup_v2_cpu_limit(""), std::nullopt);
+}
+
+TEST_F(TopologyTest, ParseCgroupV1CpuLimit) {
+  EXPECT_EQ(parse_cgroup_v1_cpu_limit("-1", "100000"), std::nullopt);
+  EXPECT_EQ(parse_cgroup_v1_cpu_limit("400000", "100000"), 4u);
+  EXPECT_EQ(parse_cgroup_v1_cpu_limit("250000", "100000"), 3u);
+  EXPECT_EQ(parse_cgroup_v1_cpu_limit("100000", "0"), std::nullopt);
+}
+
+TEST_F(TopologyTest, ParseCpuList) {
+  EXPECT_EQ(parse_cpu_list("0"), std::vector<CpuID>{CpuID{0}});
+  EXPECT_EQ(parse_cpu_list("0,4"), (std::vector<CpuID>{CpuID{0}, CpuID{4}}));
+  EXPECT_EQ(parse_cpu_list("0-2,8\n"), (std::vector<CpuID>{CpuID{0}, CpuID{1}, CpuID{2}, CpuID{8}}));
+  EXPECT_TRUE(parse_cpu_list("").empty());
+}
+
+TEST_F(TopologyTest, RespectsAvailableCpus) {
+  auto& topology = Hyrise::get().topology;
+
+  topology.use_non_numa_topology();
+  const auto num_cpus = topology.num_cpus();
+  EXPECT_GT(num_cpus, 0u);
+  EXPECT_LE(num_cpus, std::thread::hardware_concurrency());
+
+  topology.use_non_numa_topology(0, HyperthreadMode::OnePerCore);
+  EXPECT_GT(topology.num_cpus(), 0u);
+  EXPECT_LE(topology.num_cpus(), num_cpus);
+
+  topology.use_default_topology(1);
+  EXPECT_EQ(topology.num_cpus(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> _create_tasks(const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopLastAndStealFirst) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  const auto tasks = _create_tasks(4);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{2};
+
+  const auto tasks = _create_tasks(100);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+
+  for (const auto& task : tasks) {
+    EXPECT_EQ(deque.steal(), task);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, HoldsReferencesUntilDestruction) {
+  auto task = _create_tasks(1).front();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentPopAndSteal) {
+  // Each task is taken exactly once, either by the owner or by one of the thieves
+  constexpr auto TASK_COUNT = size_t{100'000};
+  constexpr auto THIEF_COUNT = 4;
+
+  auto deque = WorkStealingDeque{16};
+  const auto tasks = _create_tasks(TASK_COUNT);
+  auto taken_count = std::vector<std::atomic<uint32_t>>(TASK_COUNT);
+  auto task_ids = std::unordered_map<const AbstractTask*, size_t>{};
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    task_ids[tasks[task_id].get()] = task_id;
+  }
+
+  auto total_taken_count = std::atomic<size_t>{0};
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) {
+    if (!task) return;
+    ++taken_count[task_ids.at(task.get())];
+    ++total_taken_count;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (total_taken_count < TASK_COUNT) {
+        take(deque.steal());
+      }
+    });
+  }
+
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) take(deque.pop());
+  }
+  while (total_taken_count < TASK_COUNT) {
+    take(deque.pop());
+  }
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  for (const auto& count : taken_count) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+}  // namespace opossum
@@ -225,7 +225,7 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   const std::string portal = "test_portal";
   const std::string statement_name = "test_statement";
 
-  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x31'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x33'});
   _mocked_socket->write(portal);
   _mocked_socket->write(std::string{"\0", 1});
   _mocked_socket->write(statement_name);
@@ -240,15 +240,18 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04'});
   // Set parameter to value "test"
   _mocked_socket->write("test");
-  // Assuming one result column
-  _mocked_socket->write(std::string{'\0', '\x01'});
-  // Also format code 0: text format
+  // Assuming two result columns
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  // Format code 0: text format, and format code 1: binary format
   _mocked_socket->write(std::string{"\0", 2});
+  _mocked_socket->write(std::string{'\0', '\x01'});
 
   const auto& statement_information = _protocol_handler->read_bind_packet();
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_formats,
+            (std::vector<ResultFormat>{ResultFormat::Text, ResultFormat::Binary}));
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
@@ -61,6 +61,80 @@ TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   EXPECT_EQ(result_table->column_count(), 2u);
 }
 
+TEST_F(QueryHandlerTest, BindCachedGenericPlan) {
+  QueryHandler::setup_prepared_plan("test_statement", "SELECT a + ? FROM table_a");
+  auto prepared_plan_cache = PreparedPlanCache{};
+
+  // The parameter does not change the plan, so the generic plan is used once enough custom plans have been compared
+  for (auto execution_idx = size_t{0}; execution_idx < QueryHandler::CUSTOM_PLAN_COUNT; ++execution_idx) {
+    QueryHandler::bind_prepared_plan(PreparedStatementDetails{"test_statement", "", {1}}, prepared_plan_cache);
+  }
+  const auto& entry = prepared_plan_cache.at("test_statement");
+  ASSERT_TRUE(entry.generic_pqp);
+  EXPECT_FALSE(entry.generic_lqp);
+
+  for (const auto parameter : {1, 2}) {
+    const auto pqp = QueryHandler::bind_prepared_plan(PreparedStatementDetails{"test_statement", "", {parameter}},
+                                                      prepared_plan_cache);
+    EXPECT_NE(pqp, entry.generic_pqp);
+
+    pqp->set_transaction_context_recursively(
+        Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes));
+    const auto result_table = QueryHandler::execute_prepared_plan(pqp);
+    ASSERT_EQ(result_table->row_count(), 3u);
+    EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{0}, 0), 12345 + parameter);
+  }
+
+  // Redefining the statement invalidates the generic plan
+  Hyrise::get().storage_manager.drop_prepared_plan("test_statement");
+  QueryHandler::setup_prepared_plan("test_statement", "SELECT a + ? FROM table_a");
+  QueryHandler::bind_prepared_plan(PreparedStatementDetails{"test_statement", "", {1}}, prepared_plan_cache);
+  EXPECT_FALSE(prepared_plan_cache.at("test_statement").generic_pqp);
+  EXPECT_EQ(prepared_plan_cache.at("test_statement").custom_plan_count, 1u);
+}
+
+TEST_F(QueryHandlerTest, BindCachedPlanWithoutParameters) {
+  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a");
+  auto prepared_plan_cache = PreparedPlanCache{};
+
+  QueryHandler::bind_prepared_plan(PreparedStatementDetails{"test_statement", "", {}}, prepared_plan_cache);
+  EXPECT_TRUE(prepared_plan_cache.at("test_statement").generic_pqp);
+}
+
+TEST_F(QueryHandlerTest, BindCustomPlanForSubqueries) {
+  QueryHandler::setup_prepared_plan("test_statement",
+                                    "SELECT * FROM table_a WHERE a IN (SELECT a FROM table_a WHERE b > ?)");
+  auto prepared_plan_cache = PreparedPlanCache{};
+
+  for (auto execution_idx = size_t{0}; execution_idx <= QueryHandler::CUSTOM_PLAN_COUNT; ++execution_idx) {
+    QueryHandler::bind_prepared_plan(PreparedStatementDetails{"test_statement", "", {457.0f}}, prepared_plan_cache);
+  }
+  EXPECT_FALSE(prepared_plan_cache.at("test_statement").generic_pqp);
+}
+
+TEST_F(QueryHandlerTest, ExecutePreparedInsertBatch) {
+  QueryHandler::setup_prepared_plan("insert_statement", "INSERT INTO table_a VALUES (?, ?)");
+  QueryHandler::setup_prepared_plan("select_statement", "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_TRUE(QueryHandler::is_batchable_insert("insert_statement"));
+  EXPECT_FALSE(QueryHandler::is_batchable_insert("select_statement"));
+  EXPECT_FALSE(QueryHandler::is_batchable_insert("unknown_statement"));
+
+  // Parameters from the client are strings, which are cast to the column types
+  const auto parameter_rows = std::vector<std::vector<AllTypeVariant>>{
+      {pmr_string{"1"}, pmr_string{"1.5"}}, {pmr_string{"2"}, pmr_string{"2.5"}}, {pmr_string{"3"}, pmr_string{"3.5"}}};
+  const auto pqp = QueryHandler::bind_prepared_insert_batch("insert_statement", parameter_rows);
+  EXPECT_EQ(pqp->type(), OperatorType::Insert);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  pqp->set_transaction_context_recursively(transaction_context);
+  QueryHandler::execute_prepared_plan(pqp);
+
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table->row_count(), 6u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 5), 3);
+  EXPECT_FLOAT_EQ(*table->get_value<float>(ColumnID{1}, 5), 3.5f);
+}
+
 TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   QueryHandler::setup_prepared_plan("", "SELECT * FROM table_a WHERE a > ?");
   const auto old_plan = Hyrise::get().storage_manager.get_prepared_plan("");
@@ -78,4 +152,26 @@ TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan(""));
 }
 
+TEST_F(QueryHandlerTest, ParseCopyStatement) {
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("SELECT * FROM table_a;"));
+
+  const auto copy_from = QueryHandler::parse_copy_statement("COPY table_a FROM STDIN WITH (FORMAT csv, HEADER true);");
+  ASSERT_TRUE(copy_from);
+  EXPECT_TRUE(copy_from->is_copy_from_stdin);
+  EXPECT_EQ(copy_from->table_name, "table_a");
+  EXPECT_TRUE(copy_from->has_header);
+
+  const auto copy_to = QueryHandler::parse_copy_statement("copy (SELECT a FROM table_a\nWHERE a > 1) to stdout csv");
+  ASSERT_TRUE(copy_to);
+  EXPECT_FALSE(copy_to->is_copy_from_stdin);
+  EXPECT_EQ(copy_to->query, "SELECT a FROM table_a WHERE a > 1");
+  EXPECT_FALSE(copy_to->has_header);
+
+  EXPECT_EQ(QueryHandler::parse_copy_statement("COPY table_a TO STDOUT CSV")->query, "SELECT * FROM table_a");
+
+  // Only the CSV format is supported
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN;"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN (FORMAT binary);"), InvalidInputException);
+}
+
 }  // namespace opossum
@@ -44,6 +44,27 @@ TEST_F(ReadBufferTest, ReadValues) {
   EXPECT_EQ(_read_buffer->get_value<char>(), 'A');
 }
 
+TEST_F(ReadBufferTest, PeekValues) {
+  const auto converted = htonl(32);
+  _mocked_socket->write("AB");
+  _mocked_socket->write(std::string(reinterpret_cast<const char*>(&converted), sizeof(uint32_t)));
+  EXPECT_EQ(_read_buffer->get_value<char>(), 'A');
+
+  // The remaining data has been buffered by the previous read, so that the handler is called immediately
+  auto received = false;
+  _read_buffer->async_receive(sizeof(char) + sizeof(uint32_t), [&](const auto& error_code) {
+    EXPECT_FALSE(error_code);
+    received = true;
+  });
+  EXPECT_TRUE(received);
+
+  // Peeking does not consume the buffered data
+  EXPECT_EQ(_read_buffer->peek_value<uint32_t>(sizeof(char)), 32);
+  EXPECT_EQ(_read_buffer->peek_value<char>(), 'B');
+  EXPECT_EQ(_read_buffer->get_value<char>(), 'B');
+  EXPECT_EQ(_read_buffer->get_value<uint32_t>(), 32);
+}
+
 TEST_F(ReadBufferTest, ReadString) {
   const std::string original_content = {"somerandom\0string\0", 19};
   _mocked_socket->write(original_content);
@@ -52,6 +73,18 @@ TEST_F(ReadBufferTest, ReadString) {
   EXPECT_EQ(_read_buffer->get_string(7), "string");
 }
 
+TEST_F(ReadBufferTest, ReadStringView) {
+  // Strings that wrap around the end of the ring buffer are copied, all others are returned as views into the buffer
+  const auto padding = std::string(SERVER_BUFFER_SIZE - 3u, 'a');
+  _mocked_socket->write(padding);
+  _mocked_socket->write("somerandomstring");
+  _read_buffer->skip(padding.size() - 4u);
+  EXPECT_EQ(_read_buffer->get_string_view(4), "aaaa");
+  EXPECT_EQ(_read_buffer->get_string_view(4), "some");
+  EXPECT_EQ(_read_buffer->get_string_view(6), "random");
+  EXPECT_EQ(_read_buffer->get_string_view(6), "string");
+}
+
 TEST_F(ReadBufferTest, ReadLargeString) {
   const std::string original_content = std::string(SERVER_BUFFER_SIZE + 2u, 'a');
   _mocked_socket->write(original_content);
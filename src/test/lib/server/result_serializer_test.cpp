@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
@@ -43,6 +45,40 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, BinaryQueryResponse) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  ResultSerializer::send_table_description(table, _protocol_handler, {ResultFormat::Binary});
+  ResultSerializer::send_query_response(table, _protocol_handler, {ResultFormat::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Both columns are announced in binary format (the format code is the last field of each column description)
+  const auto first_data_row =
+      sizeof(PostgresMessageType) + NetworkConversionHelper::get_message_length(file_content.cbegin() + 1);
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content[first_data_row]), PostgresMessageType::DataRow);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + first_data_row - 2), 1);
+
+  // The first row (12345, 458.7) is sent as big-endian int4 and float4
+  auto start = file_content.cbegin() + first_data_row + sizeof(PostgresMessageType) + sizeof(uint32_t);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(start), 2);
+  start += sizeof(uint16_t);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(start), sizeof(int32_t));
+  start += sizeof(uint32_t);
+  EXPECT_EQ(static_cast<int32_t>(NetworkConversionHelper::get_message_length(start)), 12345);
+  start += sizeof(int32_t);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(start), sizeof(float));
+  start += sizeof(uint32_t);
+  const auto float_bits = NetworkConversionHelper::get_message_length(start);
+  auto float_value = float{};
+  std::memcpy(&float_value, &float_bits, sizeof(float));
+  EXPECT_FLOAT_EQ(float_value, 458.7f);
+
+  // The number of result formats has to match the number of columns
+  EXPECT_THROW(ResultSerializer::send_query_response(table, _protocol_handler,
+                                                     {ResultFormat::Text, ResultFormat::Binary, ResultFormat::Text}),
+               std::logic_error);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -287,6 +287,23 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Sessions do not occupy a thread while they wait for the client. Hence, many open connections can be served by few
+  // threads, and a query on one of them is not delayed by the others. The number of connections is limited by the
+  // file descriptors of this process, which holds both ends of each connection.
+  const auto num_connections = 200u;
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_id = 0u; connection_id < num_connections; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  for (auto connection_id = 0u; connection_id < num_connections; connection_id += 50) {
+    pqxx::nontransaction transaction{*connections[connection_id]};
+    const auto result = transaction.exec("SELECT * FROM table_a;");
+    EXPECT_EQ(result.size(), _table_a->row_count());
+  }
+}
+
 TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
@@ -346,6 +363,22 @@ TEST_F(ServerTestRunner, TestPreparedStatement) {
   EXPECT_EQ(result3.size(), 2u);
 }
 
+TEST_F(ServerTestRunner, TestPreparedInsert) {
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+
+  // Executions of single-row inserts are deferred until Sync, after which their responses are sent
+  const std::string prepared_name = "insert_statement";
+  connection.prepare(prepared_name, "INSERT INTO table_a VALUES (?, ?)");
+  for (auto value = 0; value < 3; ++value) {
+    const auto result = transaction.exec_prepared(prepared_name, value, 1.5);
+    EXPECT_EQ(result.affected_rows(), 1u);
+  }
+
+  const auto result = transaction.exec("SELECT * FROM table_a WHERE b = 1.5");
+  EXPECT_EQ(result.size(), 3u);
+}
+
 TEST_F(ServerTestRunner, TestUnnamedPreparedStatement) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
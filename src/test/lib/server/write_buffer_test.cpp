@@ -74,4 +74,18 @@ TEST_F(WriteBufferTest, WriteLargeString) {
   EXPECT_EQ(_mocked_socket->read(), original_content);
 }
 
+TEST_F(WriteBufferTest, WriteBytes) {
+  // Small data is only buffered
+  _write_buffer->put_string("some", HasNullTerminator::No);
+  _write_buffer->put_bytes("random");
+  EXPECT_TRUE(_mocked_socket->empty());
+  EXPECT_EQ(_write_buffer->size(), 10u);
+
+  // Large data is sent along with the buffered data
+  const auto large_content = std::string(SERVER_BUFFER_SIZE + 2u, 'a');
+  _write_buffer->put_bytes(large_content);
+  EXPECT_EQ(_write_buffer->size(), 0u);
+  EXPECT_EQ(_mocked_socket->read(), "somerandom" + large_content);
+}
+
 }  // namespace opossum
@@ -0,0 +1,75 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "SQLParser.h"
+
+#include "sql/sql_literal_normalizer.hpp"
+
+namespace opossum {
+
+class SQLLiteralNormalizerTest : public BaseTest {
+ protected:
+  static bool parameterizable(const std::string& sql) {
+    const auto normalized_sql = normalize_sql_literals(sql);
+    EXPECT_TRUE(normalized_sql);
+
+    auto parsed_normalized_sql = hsql::SQLParserResult{};
+    hsql::SQLParser::parse(normalized_sql->sql, &parsed_normalized_sql);
+    return is_parameterizable(parsed_normalized_sql, normalized_sql->literals.size());
+  }
+};
+
+TEST_F(SQLLiteralNormalizerTest, Literals) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT * FROM t WHERE a = 17 AND b > 3000000000 AND c < 1.5 AND d <> 'it''s'");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a = ? AND b > ? AND c < ? AND d <> ?");
+  EXPECT_EQ(normalized_sql->literals, (std::vector<AllTypeVariant>{int32_t{17}, int64_t{3'000'000'000}, double{1.5},
+                                                                   pmr_string{"it's"}}));
+}
+
+TEST_F(SQLLiteralNormalizerTest, MinusSigns) {
+  const auto normalized_sql = normalize_sql_literals("SELECT a - 1, -2, (- 3), 4-5 FROM t WHERE a = -6");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT a - ?, ?, (?), ?-? FROM t WHERE a = ?");
+  EXPECT_EQ(normalized_sql->literals, (std::vector<AllTypeVariant>{int32_t{1}, int32_t{-2}, int32_t{-3}, int32_t{4},
+                                                                   int32_t{5}, int32_t{-6}}));
+}
+
+TEST_F(SQLLiteralNormalizerTest, VerbatimTokens) {
+  // Identifiers, quoted identifiers, comments, and the literals of dates, intervals, and limits are kept
+  const auto sql = std::string{
+      "SELECT t1.a2, \"b 3\" FROM t1 -- 4\n"
+      "WHERE d < DATE '1995-01-01' + INTERVAL '3' MONTH /* 5 */ LIMIT 10"};
+  const auto normalized_sql = normalize_sql_literals(sql);
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, sql);
+  EXPECT_TRUE(normalized_sql->literals.empty());
+}
+
+TEST_F(SQLLiteralNormalizerTest, ExistingPlaceholders) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ? AND b = 5"));
+  EXPECT_TRUE(normalize_sql_literals("SELECT * FROM t WHERE a = '?'"));
+}
+
+TEST_F(SQLLiteralNormalizerTest, IsParameterizable) {
+  EXPECT_TRUE(parameterizable("SELECT * FROM t WHERE a = 17"));
+  EXPECT_TRUE(parameterizable("SELECT a FROM t WHERE (5 < a OR b <> 'x') AND c BETWEEN 1 AND 2.5 LIMIT 10"));
+
+  // Placeholders are only allowed where they are compared to columns of the WHERE clause
+  EXPECT_FALSE(parameterizable("SELECT a + 1 FROM t WHERE a = 17"));
+  EXPECT_FALSE(parameterizable("SELECT * FROM t WHERE a + 1 = 17"));
+  EXPECT_FALSE(parameterizable("SELECT * FROM t WHERE a IN (1, 2)"));
+  EXPECT_FALSE(parameterizable("SELECT * FROM t WHERE NOT a = 17"));
+  EXPECT_FALSE(parameterizable("SELECT * FROM t WHERE a = (SELECT MAX(b) FROM u WHERE b < 17)"));
+
+  // Only SELECT statements are parameterized
+  EXPECT_FALSE(parameterizable("DELETE FROM t WHERE a = 17"));
+}
+
+}  // namespace opossum
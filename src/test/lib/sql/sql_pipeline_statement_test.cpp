@@ -340,6 +340,119 @@ TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPNotValidated) {
   EXPECT_TRUE(lqp_is_validated(*validated_cached_lqp));
 }
 
+TEST_F(SQLPipelineStatementTest, GetParameterizedOptimizedLQP) {
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+  Hyrise::get().parameterized_plan_cache = parameterized_plan_cache;
+
+  const auto execute = [&](const std::string& sql) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    auto& statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto [pipeline_status, table] = statement->get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return std::make_pair(table, statement->metrics()->parameterized_plan_cache_hit);
+  };
+
+  const auto [first_table, first_cache_hit] = execute("SELECT * FROM table_int WHERE a = 9");
+  EXPECT_FALSE(first_cache_hit);
+  EXPECT_TRUE(parameterized_plan_cache->has("SELECT * FROM table_int WHERE a = ?"));
+
+  auto expected_first_table = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_first_table->append({9, 10, 11});
+  expected_first_table->append({9, 10, 9});
+  EXPECT_TABLE_EQ_UNORDERED(first_table, expected_first_table);
+
+  // The second statement only differs in its literal and reuses the optimized LQP with its own value
+  const auto [second_table, second_cache_hit] = execute("SELECT * FROM table_int WHERE a = 10");
+  EXPECT_TRUE(second_cache_hit);
+
+  auto expected_second_table = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_second_table->append({10, 10, 10});
+  EXPECT_TABLE_EQ_UNORDERED(second_table, expected_second_table);
+
+  // Statements with literals outside of the WHERE clause's comparisons are not parameterized
+  const auto [projection_table, projection_cache_hit] = execute("SELECT a + 1 FROM table_int WHERE a = 9");
+  EXPECT_FALSE(projection_cache_hit);
+  EXPECT_EQ(projection_table->row_count(), 2u);
+  const auto not_parameterizable_plan = parameterized_plan_cache->try_get("SELECT a + ? FROM table_int WHERE a = ?");
+  ASSERT_TRUE(not_parameterizable_plan);
+  EXPECT_FALSE(*not_parameterizable_plan);
+}
+
+TEST_F(SQLPipelineStatementTest, GetCachedResultTable) {
+  Hyrise::get().result_cache = std::make_shared<SQLResultCache>();
+
+  const auto execute = [&](const std::string& sql) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    auto& statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto [pipeline_status, table] = statement->get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return std::make_pair(table, statement->metrics()->result_cache_hit);
+  };
+
+  const auto sql = std::string{"SELECT * FROM table_int WHERE a = 9"};
+  const auto [first_table, first_cache_hit] = execute(sql);
+  EXPECT_FALSE(first_cache_hit);
+  EXPECT_EQ(first_table->row_count(), 2u);
+
+  const auto [second_table, second_cache_hit] = execute(sql);
+  EXPECT_TRUE(second_cache_hit);
+  EXPECT_EQ(second_table, first_table);
+
+  // Once the table has been modified, the result is computed again
+  execute("INSERT INTO table_int VALUES (9, 1, 2)");
+  const auto [third_table, third_cache_hit] = execute(sql);
+  EXPECT_FALSE(third_cache_hit);
+  EXPECT_EQ(third_table->row_count(), 3u);
+
+  // Results of statements within a user-defined transaction are not cached
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_transaction_context(transaction_context).create_pipeline();
+  auto& statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  EXPECT_EQ(statement->get_result_table().second->row_count(), 3u);
+  EXPECT_FALSE(statement->metrics()->result_cache_hit);
+  transaction_context->commit();
+}
+
+TEST_F(SQLPipelineStatementTest, GetCachedSubqueryResult) {
+  const auto subquery_result_cache = std::make_shared<SQLResultCache>();
+  Hyrise::get().subquery_result_cache = subquery_result_cache;
+
+  const auto execute = [&](const std::string& sql) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return table;
+  };
+
+  const auto sql = std::string{"SELECT a, (SELECT MAX(a) FROM table_int) FROM table_int"};
+  const auto first_table = execute(sql);
+  EXPECT_EQ(first_table->get_value<int32_t>(ColumnID{1}, 0), 11);
+  ASSERT_EQ(subquery_result_cache->size(), 1u);
+
+  // The second execution reuses the result of the subquery
+  const auto second_table = execute(sql);
+  EXPECT_EQ(second_table->get_value<int32_t>(ColumnID{1}, 0), 11);
+  ASSERT_EQ(subquery_result_cache->size(), 1u);
+  EXPECT_EQ(subquery_result_cache->snapshot().begin()->second.frequency, 2u);
+
+  // Once the table has been modified, the subquery is executed again
+  execute("INSERT INTO table_int VALUES (12, 1, 2)");
+  const auto third_table = execute(sql);
+  EXPECT_EQ(third_table->get_value<int32_t>(ColumnID{1}, 0), 12);
+  EXPECT_EQ(subquery_result_cache->size(), 2u);
+
+  // Subqueries of transactions that modified rows are not cached, as they see their own modifications
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"INSERT INTO table_int VALUES (13, 1, 2)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_transaction_context(transaction_context).create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_table().second->get_value<int32_t>(ColumnID{1}, 0), 13);
+  EXPECT_EQ(subquery_result_cache->size(), 2u);
+  transaction_context->commit();
+}
+
 TEST_F(SQLPipelineStatementTest, GetOptimizedLQPDoesNotInfluenceUnoptimizedLQP) {
   auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
   auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
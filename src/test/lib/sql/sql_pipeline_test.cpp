@@ -17,6 +17,7 @@
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_workload_recorder.hpp"
 
 namespace opossum {
 
@@ -613,6 +614,40 @@ TEST_F(SQLPipelineTest, CacheQueryPlanTwice) {
   EXPECT_TRUE(_pqp_cache->has("INSERT INTO table_a VALUES (11, 11.11);"));
 }
 
+TEST_F(SQLPipelineTest, ShareSubplanResults) {
+  auto sql_pipeline = SQLPipelineBuilder{
+      "SELECT a, b FROM table_a WHERE a > 1000; SELECT b, a FROM table_a WHERE a > 1000; "
+      "INSERT INTO table_a VALUES (12346, 1.5); SELECT a, b FROM table_a WHERE a > 1000;"}
+                          .create_pipeline();
+  const auto [pipeline_status, tables] = sql_pipeline.get_result_tables();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+  const auto& statement_metrics = sql_pipeline.metrics().statement_metrics;
+  EXPECT_EQ(statement_metrics.at(0)->shared_subplan_count, 0u);
+  EXPECT_EQ(tables.at(0)->row_count(), 2u);
+
+  // The second statement uses the result of the first statement's predicate
+  EXPECT_EQ(statement_metrics.at(1)->shared_subplan_count, 1u);
+  EXPECT_EQ(tables.at(1)->row_count(), 2u);
+
+  // After the INSERT, the results are computed again
+  EXPECT_EQ(statement_metrics.at(3)->shared_subplan_count, 0u);
+  EXPECT_EQ(tables.at(3)->row_count(), 3u);
+}
+
+TEST_F(SQLPipelineTest, DoNotShareSubplanResultsTruncatedByLimit) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 0 LIMIT 1; SELECT COUNT(*) FROM table_a WHERE a > 0;"}
+          .create_pipeline();
+  const auto [pipeline_status, tables] = sql_pipeline.get_result_tables();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(tables.at(0)->row_count(), 1u);
+
+  // The scan of the first statement stops after the first match, so the second statement has to scan again
+  EXPECT_EQ(sql_pipeline.metrics().statement_metrics.at(1)->shared_subplan_count, 0u);
+  EXPECT_EQ(tables.at(1)->get_value<int64_t>(ColumnID{0}, 0u), 3);
+}
+
 TEST_F(SQLPipelineTest, DefaultPlanCaches) {
   const auto default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   const auto local_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
@@ -708,4 +743,36 @@ TEST_F(SQLPipelineTest, GetResultTableNoReexecuteOnConflict) {
   EXPECT_EQ(_table_a->row_count(), 5);
 }
 
+TEST_F(SQLPipelineTest, RecordWorkload) {
+  const auto log_path = test_data_path + "sql_pipeline_workload.log";
+  Hyrise::get().workload_recorder = std::make_shared<SQLWorkloadRecorder>(log_path);
+
+  auto sql_pipeline = SQLPipelineBuilder{"BEGIN; INSERT INTO table_a VALUES (11, 11.11); COMMIT;"}
+                          .with_session_id(SessionID{7})
+                          .create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_tables().first, SQLPipelineStatus::Success);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto transaction_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_transaction_context(transaction_context).create_pipeline();
+  EXPECT_EQ(transaction_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+  Hyrise::get().workload_recorder->flush();
+
+  const auto records = SQLWorkloadRecorder::read(log_path);
+  ASSERT_EQ(records.size(), 4);
+  EXPECT_EQ(records[0].sql, sql_pipeline.get_sql_per_statement()[0]);
+  EXPECT_EQ(records[0].session_id, SessionID{7});
+  EXPECT_EQ(records[0].transaction_id, INVALID_TRANSACTION_ID);
+  EXPECT_TRUE(records[0].succeeded);
+
+  // INSERT and COMMIT ran in the transaction that BEGIN started
+  EXPECT_NE(records[1].transaction_id, INVALID_TRANSACTION_ID);
+  EXPECT_EQ(records[2].transaction_id, records[1].transaction_id);
+  EXPECT_LE(records[1].start + records[1].duration, records[2].start);
+
+  EXPECT_EQ(records[3].sql, _select_query_a);
+  EXPECT_EQ(records[3].session_id, SessionID{0});
+  EXPECT_EQ(records[3].transaction_id, transaction_context->transaction_id());
+}
+
 }  // namespace opossum
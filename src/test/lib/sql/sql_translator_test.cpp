@@ -1066,6 +1066,21 @@ TEST_F(SQLTranslatorTest, AggregateCount) {
   EXPECT_LQP_EQ(actual_lqp_count_1, expected_lqp_count_1);
 }
 
+TEST_F(SQLTranslatorTest, ApproximateAggregates) {
+  const auto [actual_lqp, translation_info] =
+      sql_to_lqp_helper("SELECT a, APPROX_COUNT_DISTINCT(b), APPROX_PERCENTILE(b, 0.9) FROM int_float GROUP BY a");
+  // clang-format off
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(approx_count_distinct_(int_float_b), approx_percentile_(int_float_b, 0.9)),  // NOLINT
+    stored_table_node_int_float);
+  // clang-format on
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b, 1.5) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b, a) FROM int_float"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, GroupByOnly) {
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT * FROM int_float GROUP BY b + 3, a / b, a, b");
 
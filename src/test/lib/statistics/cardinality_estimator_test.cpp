@@ -30,6 +30,7 @@
 #include "statistics/cardinality_estimator.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "utils/load_table.hpp"
@@ -142,6 +143,16 @@ class CardinalityEstimatorTest : public BaseTest {
     g_a = node_g->get_column("a");
   }
 
+  // A sketch of value_count values, which are the first distinct_count integers repeatedly
+  static std::shared_ptr<HyperLogLogSketch> sketch_with_distinct_count(const size_t distinct_count,
+                                                                       const size_t value_count) {
+    const auto sketch = std::make_shared<HyperLogLogSketch>();
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      sketch->add(static_cast<int32_t>(value_idx % distinct_count));
+    }
+    return sketch;
+  }
+
   CardinalityEstimator estimator;
   std::shared_ptr<LQPColumnExpression> a_a, a_b, b_a, b_b, c_x, d_a, d_b, d_c, e_a, e_b, f_a, f_b, g_a;
   std::shared_ptr<MockNode> node_a, node_b, node_c, node_d, node_e, node_f, node_g;
@@ -164,6 +175,24 @@ TEST_F(CardinalityEstimatorTest, Aggregate) {
   EXPECT_TRUE(result_table_statistics->column_statistics.at(2));
 }
 
+TEST_F(CardinalityEstimatorTest, AggregateWithDistinctCountSketches) {
+  const auto node = create_mock_node_with_statistics({{DataType::Int, "a"}, {DataType::Int, "b"}}, 1'000,
+                                                     {sketch_with_distinct_count(10, 1'000),
+                                                      sketch_with_distinct_count(200, 1'000)});
+  const auto a = node->get_column("a");
+  const auto b = node->get_column("b");
+
+  const auto aggregate_a = AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), node);
+  EXPECT_NEAR(estimator.estimate_cardinality(aggregate_a), 10.0f, 1.0f);
+
+  // The number of groups is capped at the input row count
+  const auto aggregate_a_b = AggregateNode::make(expression_vector(a, b), expression_vector(sum_(b)), node);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(aggregate_a_b), 1'000.0f);
+
+  const auto aggregate_without_group_by = AggregateNode::make(expression_vector(), expression_vector(sum_(b)), node);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(aggregate_without_group_by), 1.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, Alias) {
   // clang-format off
   const auto input_lqp =
@@ -269,6 +298,25 @@ TEST_F(CardinalityEstimatorTest, JoinEquiInnerDifferentDataTypes) {
   ASSERT_EQ(result_statistics->column_statistics.size(), 4u);
 }
 
+TEST_F(CardinalityEstimatorTest, JoinEquiInnerWithDistinctCountSketches) {
+  // Without histograms, the join is estimated as |L| * |R| / max(d(L), d(R))
+  const auto left_node =
+      create_mock_node_with_statistics({{DataType::String, "a"}}, 100, {sketch_with_distinct_count(10, 100)});
+  const auto right_node =
+      create_mock_node_with_statistics({{DataType::String, "a"}}, 200, {sketch_with_distinct_count(50, 200)});
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(left_node->get_column("a"), right_node->get_column("a")),
+    left_node,
+    right_node);
+  // clang-format on
+
+  const auto result_statistics = estimator.estimate_statistics(input_lqp);
+  EXPECT_NEAR(result_statistics->row_count, 400.0f, 40.0f);
+  ASSERT_EQ(result_statistics->column_statistics.size(), 2u);
+}
+
 TEST_F(CardinalityEstimatorTest, JoinCross) {
   // clang-format off
   const auto input_lqp =
@@ -846,6 +894,70 @@ TEST_F(CardinalityEstimatorTest, StoredTable) {
   EXPECT_EQ(estimator.estimate_cardinality(StoredTableNode::make("t")), 3);
 }
 
+TEST_F(CardinalityEstimatorTest, CorrelatedPredicates) {
+  // Every zip code belongs to a single city
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("city", DataType::Int, false);
+  column_definitions.emplace_back("zip", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    table->append({row_id / 10, row_id / 5});
+  }
+  Hyrise::get().storage_manager.add_table("addresses", table);
+
+  const auto stored_table_node = StoredTableNode::make("addresses");
+  const auto city = stored_table_node->get_column("city");
+  const auto zip = stored_table_node->get_column("zip");
+
+  const auto city_predicate_node = PredicateNode::make(equals_(city, 7), stored_table_node);
+  EXPECT_NEAR(estimator.estimate_cardinality(city_predicate_node), 10.0f, 0.01f);
+
+  // Assuming independence, the zip code predicate would select 1 / 200 of the remaining rows. With the distinct
+  // counts of 100 cities and 200 (city, zip) combinations, half of the rows remain.
+  const auto zip_predicate_node = PredicateNode::make(equals_(zip, 14), city_predicate_node);
+  EXPECT_NEAR(estimator.estimate_cardinality(zip_predicate_node), 5.0f, 0.01f);
+
+  const auto conjunction_node = PredicateNode::make(and_(equals_(city, 7), equals_(zip, 14)), stored_table_node);
+  EXPECT_NEAR(estimator.estimate_cardinality(conjunction_node), 5.0f, 0.01f);
+
+  // Predicates on values outside of the histograms still select nothing
+  const auto non_matching_predicate_node = PredicateNode::make(equals_(zip, 1'000), city_predicate_node);
+  EXPECT_EQ(estimator.estimate_cardinality(non_matching_predicate_node), 0.0f);
+}
+
+TEST_F(CardinalityEstimatorTest, MultiColumnJoin) {
+  for (const auto& table_name : {"l", "r"}) {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+    for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+      table->append({row_id / 10, row_id / 5});
+    }
+    Hyrise::get().storage_manager.add_table(table_name, table);
+  }
+
+  const auto l = StoredTableNode::make("l");
+  const auto r = StoredTableNode::make("r");
+  const auto l_a = l->get_column("a");
+  const auto l_b = l->get_column("b");
+  const auto r_a = r->get_column("a");
+  const auto r_b = r->get_column("b");
+
+  // Each of the 100 values of a matches 10 * 10 rows
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(l_a, r_a), l, r);
+  EXPECT_NEAR(estimator.estimate_cardinality(join_node), 10'000.0f, 1.0f);
+
+  // Each of the 200 combinations of a and b matches 5 * 5 rows. The secondary predicate is either part of the
+  // JoinNode or (as placed by the JoinOrderingRule) a PredicateNode on top of it.
+  const auto predicate_node = PredicateNode::make(equals_(l_b, r_b), join_node);
+  EXPECT_NEAR(estimator.estimate_cardinality(predicate_node), 5'000.0f, 1.0f);
+
+  const auto multi_predicate_join_node =
+      JoinNode::make(JoinMode::Inner, expression_vector(equals_(l_a, r_a), equals_(l_b, r_b)), l, r);
+  EXPECT_NEAR(estimator.estimate_cardinality(multi_predicate_join_node), 5'000.0f, 1.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, Validate) {
   // Test Validate doesn't break the TableStatistics. The CardinalityEstimator is not estimating anything for Validate
   // as there are no statistics available atm to base such an estimation on.
@@ -0,0 +1,98 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CardinalityFeedbackTest : public BaseTest {
+ public:
+  void SetUp() override {
+    node_a = create_mock_node_with_statistics({{DataType::Int, "a"}, {DataType::Int, "b"}}, 100,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 100, 10),
+                                               GenericHistogram<int32_t>::with_single_bin(10, 129, 70, 55)});
+    a_a = node_a->get_column("a");
+
+    predicate_node = PredicateNode::make(greater_than_(a_a, 50), node_a);
+
+    cardinality_feedback = std::make_shared<CardinalityFeedback>();
+    Hyrise::get().cardinality_feedback = cardinality_feedback;
+  }
+
+  Cardinality estimate(const std::shared_ptr<AbstractLQPNode>& lqp) const {
+    return CardinalityEstimator{}.estimate_cardinality(lqp);
+  }
+
+  std::shared_ptr<MockNode> node_a;
+  std::shared_ptr<LQPColumnExpression> a_a;
+  std::shared_ptr<PredicateNode> predicate_node;
+  std::shared_ptr<CardinalityFeedback> cardinality_feedback;
+};
+
+TEST_F(CardinalityFeedbackTest, AdjustsRecordedSubplan) {
+  const auto unadjusted_row_count = estimate(predicate_node);
+  EXPECT_GT(unadjusted_row_count, 10.0f);
+
+  cardinality_feedback->add_observation(predicate_node, unadjusted_row_count, 10.0f);
+  EXPECT_FLOAT_EQ(estimate(predicate_node), 10.0f);
+
+  // A structurally equal subplan is adjusted as well
+  const auto equal_predicate_node = PredicateNode::make(greater_than_(a_a, 50), node_a);
+  EXPECT_FLOAT_EQ(estimate(equal_predicate_node), 10.0f);
+
+  // The adjustment of the parent follows from that of its input
+  const auto projection_node = ProjectionNode::make(expression_vector(a_a), predicate_node);
+  EXPECT_FLOAT_EQ(estimate(projection_node), 10.0f);
+
+  // Other subplans are not adjusted
+  const auto other_predicate_node = PredicateNode::make(greater_than_(a_a, 40), node_a);
+  EXPECT_GT(estimate(other_predicate_node), unadjusted_row_count);
+}
+
+TEST_F(CardinalityFeedbackTest, RepeatedObservationsReplaceAdjustment) {
+  const auto unadjusted_row_count = estimate(predicate_node);
+
+  cardinality_feedback->add_observation(predicate_node, unadjusted_row_count, 10.0f);
+  cardinality_feedback->add_observation(predicate_node, estimate(predicate_node), 20.0f);
+  EXPECT_FLOAT_EQ(estimate(predicate_node), 20.0f);
+
+  const auto observation = cardinality_feedback->observation(predicate_node);
+  ASSERT_TRUE(observation);
+  EXPECT_EQ(observation->execution_count, 2);
+  EXPECT_FLOAT_EQ(observation->estimated_row_count, 10.0f);
+  EXPECT_FLOAT_EQ(observation->actual_row_count, 20.0f);
+  EXPECT_FLOAT_EQ(observation->adjustment, 20.0f / unadjusted_row_count);
+}
+
+TEST_F(CardinalityFeedbackTest, EmptyResultKeepsAdjustmentPositive) {
+  cardinality_feedback->add_observation(predicate_node, estimate(predicate_node), 0.0f);
+  EXPECT_FLOAT_EQ(estimate(predicate_node), 1.0f);
+
+  cardinality_feedback->add_observation(predicate_node, estimate(predicate_node), 30.0f);
+  EXPECT_FLOAT_EQ(estimate(predicate_node), 30.0f);
+}
+
+TEST_F(CardinalityFeedbackTest, KeyIsIndependentOfRecordedPlan) {
+  cardinality_feedback->add_observation(predicate_node, estimate(predicate_node), 10.0f);
+
+  // Modifying the recorded plan afterwards does not modify the recorded subplan
+  predicate_node->set_left_input(PredicateNode::make(less_than_(a_a, 90), node_a));
+  EXPECT_FALSE(cardinality_feedback->observation(predicate_node));
+  EXPECT_TRUE(cardinality_feedback->observation(PredicateNode::make(greater_than_(a_a, 50), node_a)));
+
+  EXPECT_EQ(cardinality_feedback->subplan_count(), 1);
+  cardinality_feedback->clear();
+  EXPECT_EQ(cardinality_feedback->subplan_count(), 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/blocked_bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BlockedBloomFilterTest : public BaseTest {};
+
+TEST_F(BlockedBloomFilterTest, NoFalseNegatives) {
+  auto values = pmr_vector<int32_t>{};
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    values.emplace_back(value * 7'919);
+  }
+
+  const auto filter = BlockedBloomFilter<int32_t>::build_filter(values);
+  ASSERT_TRUE(filter);
+  EXPECT_EQ(filter->words.size(), (values.size() * BlockedBloomFilter<int32_t>::BITS_PER_VALUE + 63) / 64);
+
+  for (const auto value : values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, value));
+  }
+}
+
+TEST_F(BlockedBloomFilterTest, FewFalsePositives) {
+  auto values = pmr_vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    values.emplace_back(value * 2);
+  }
+  const auto filter = BlockedBloomFilter<int64_t>::build_filter(values);
+
+  // The odd values are not in the filter. With ten bits per value, clearly less than 5% of them are false positives.
+  auto false_positive_count = size_t{0};
+  for (auto value = int64_t{1}; value < 20'000; value += 2) {
+    false_positive_count += filter->may_contain(value);
+  }
+  EXPECT_LT(false_positive_count, 500);
+  EXPECT_GT(false_positive_count, 0);
+}
+
+TEST_F(BlockedBloomFilterTest, Strings) {
+  auto values = pmr_vector<pmr_string>{};
+  for (auto value = 0; value < 1'000; ++value) {
+    values.emplace_back("customer#" + std::to_string(value));
+  }
+  const auto filter = BlockedBloomFilter<pmr_string>::build_filter(values);
+
+  for (const auto& value : values) {
+    EXPECT_TRUE(filter->may_contain(value));
+  }
+
+  auto false_positive_count = size_t{0};
+  for (auto value = 1'000; value < 2'000; ++value) {
+    false_positive_count += filter->may_contain(pmr_string{"customer#" + std::to_string(value)});
+  }
+  EXPECT_LT(false_positive_count, 50);
+}
+
+TEST_F(BlockedBloomFilterTest, OnlyPrunesEquality) {
+  const auto filter = BlockedBloomFilter<int32_t>::build_filter(pmr_vector<int32_t>{1, 5, 9});
+  ASSERT_TRUE(filter);
+
+  auto missing_value = int32_t{10};
+  while (filter->may_contain(missing_value)) {
+    ++missing_value;
+  }
+
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, missing_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::NotEquals, missing_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::LessThan, missing_value));
+  EXPECT_FALSE(
+      filter->does_not_contain(PredicateCondition::BetweenInclusive, missing_value, AllTypeVariant{missing_value}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, NullValue{}));
+
+  EXPECT_FALSE(filter->sliced(PredicateCondition::Equals, missing_value));
+  const auto sliced_filter =
+      std::dynamic_pointer_cast<BlockedBloomFilter<int32_t>>(filter->sliced(PredicateCondition::GreaterThan, 3));
+  ASSERT_TRUE(sliced_filter);
+  EXPECT_EQ(sliced_filter->words, filter->words);
+
+  const auto scaled_filter = std::dynamic_pointer_cast<BlockedBloomFilter<int32_t>>(filter->scaled(0.5f));
+  ASSERT_TRUE(scaled_filter);
+  EXPECT_EQ(scaled_filter->words, filter->words);
+}
+
+TEST_F(BlockedBloomFilterTest, EmptyDictionary) {
+  EXPECT_FALSE(BlockedBloomFilter<int32_t>::build_filter(pmr_vector<int32_t>{}));
+}
+
+}  // namespace opossum
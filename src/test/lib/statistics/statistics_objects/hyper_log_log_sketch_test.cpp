@@ -0,0 +1,90 @@
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class HyperLogLogSketchTest : public BaseTest {};
+
+TEST_F(HyperLogLogSketchTest, DistinctCount) {
+  auto sketch = HyperLogLogSketch{};
+  EXPECT_FLOAT_EQ(sketch.distinct_count(), 0.0f);
+
+  // Small counts are estimated by linear counting, which is almost exact
+  for (auto value = int32_t{0}; value < 5; ++value) {
+    sketch.add(value);
+    sketch.add(value);
+  }
+  EXPECT_NEAR(sketch.distinct_count(), 5.0f, 0.1f);
+  EXPECT_FLOAT_EQ(sketch.value_count, 10.0f);
+
+  for (auto value = int32_t{0}; value < 100'000; ++value) {
+    sketch.add(value);
+  }
+  EXPECT_NEAR(sketch.distinct_count(), 100'000.0f, 10'000.0f);
+
+  auto string_sketch = HyperLogLogSketch{};
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    string_sketch.add(pmr_string{"value" + std::to_string(value % 100)});
+  }
+  EXPECT_NEAR(string_sketch.distinct_count(), 100.0f, 10.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, Merge) {
+  auto sketch = HyperLogLogSketch{};
+  auto other_sketch = HyperLogLogSketch{};
+  for (auto value = int32_t{0}; value < 6'000; ++value) {
+    sketch.add(value);
+    other_sketch.add(value + 4'000);
+  }
+
+  sketch.merge(other_sketch);
+  EXPECT_NEAR(sketch.distinct_count(), 10'000.0f, 1'000.0f);
+  EXPECT_FLOAT_EQ(sketch.value_count, 12'000.0f);
+
+  // Merging is idempotent for the registers
+  sketch.merge(other_sketch);
+  EXPECT_NEAR(sketch.distinct_count(), 10'000.0f, 1'000.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, FromSegment) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    segment->append(value % 20);
+  }
+  segment->append(NULL_VALUE);
+
+  const auto sketch = HyperLogLogSketch::from_segment(*segment);
+  EXPECT_NEAR(sketch->distinct_count(), 20.0f, 1.0f);
+  EXPECT_FLOAT_EQ(sketch->value_count, 100.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, Scaled) {
+  auto sketch = HyperLogLogSketch{};
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    sketch.add(value % 1'000);
+  }
+  const auto distinct_count = sketch.distinct_count();
+
+  // Each value has ten rows. With a selectivity of 1%, 1 - 0.99^10 of the values remain.
+  const auto scaled_sketch = std::dynamic_pointer_cast<HyperLogLogSketch>(sketch.scaled(0.01f));
+  ASSERT_TRUE(scaled_sketch);
+  EXPECT_NEAR(scaled_sketch->distinct_count(), distinct_count * (1.0f - std::pow(0.99f, 10.0f)), 5.0f);
+
+  // Scaling up does not add distinct values
+  const auto scaled_up_sketch = std::dynamic_pointer_cast<HyperLogLogSketch>(sketch.scaled(2.0f));
+  EXPECT_FLOAT_EQ(scaled_up_sketch->distinct_count(), distinct_count);
+
+  const auto pruned_sketch =
+      std::dynamic_pointer_cast<HyperLogLogSketch>(sketch.pruned(9'900, PredicateCondition::GreaterThan, 5));
+  EXPECT_NEAR(pruned_sketch->distinct_count(), scaled_sketch->distinct_count(), 1.0f);
+
+  EXPECT_FALSE(sketch.sliced(PredicateCondition::Equals, 5));
+}
+
+}  // namespace opossum
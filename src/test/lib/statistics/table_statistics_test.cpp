@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "statistics/table_statistics.hpp"
@@ -41,4 +42,103 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithSampling) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    table->append({row_id % 50, row_id});
+  }
+
+  // Only the first of the ten chunks is scanned
+  const auto table_statistics = TableStatistics::from_table(*table, 100);
+  ASSERT_EQ(table_statistics->row_count, 1'000);
+
+  const auto histogram_a = std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(
+                               table_statistics->column_statistics.at(0))->histogram;
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 1'000);
+  EXPECT_FLOAT_EQ(histogram_a->total_distinct_count(), 50);
+
+  // All values of b are unique within the sample, their distinct count is extrapolated as sqrt(10) * 100
+  const auto histogram_b = std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(
+                               table_statistics->column_statistics.at(1))->histogram;
+  ASSERT_TRUE(histogram_b);
+  EXPECT_FLOAT_EQ(histogram_b->total_count(), 1'000);
+  EXPECT_NEAR(histogram_b->total_distinct_count(), 316.2f, 1.0f);
+  EXPECT_EQ(histogram_b->bin_maximum(histogram_b->bin_count() - 1), 99);
+}
+
+TEST_F(TableStatisticsTest, WithChunk) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4});
+  for (auto row_id = int32_t{0}; row_id < 6; ++row_id) {
+    table->append({row_id, pmr_string{"value"}});
+  }
+
+  const auto table_statistics = TableStatistics::from_table(*table);
+  EXPECT_EQ(table_statistics->represented_chunk_sizes, std::vector<ChunkOffset>({4, 2}));
+  EXPECT_FLOAT_EQ(table_statistics->staleness(*table), 0.0f);
+
+  // Two more rows in the second chunk and a third chunk with four rows, one of them NULL
+  for (auto row_id = int32_t{6}; row_id < 11; ++row_id) {
+    table->append({row_id + 100, pmr_string{"value"}});
+  }
+  table->append({NULL_VALUE, pmr_string{"value"}});
+  EXPECT_FLOAT_EQ(table_statistics->staleness(*table), 0.5f);
+
+  const auto updated_table_statistics =
+      table_statistics->with_chunk(*table, ChunkID{1})->with_chunk(*table, ChunkID{2});
+  EXPECT_EQ(updated_table_statistics->row_count, 12);
+  EXPECT_EQ(updated_table_statistics->represented_chunk_sizes, std::vector<ChunkOffset>({4, 4, 4}));
+  EXPECT_FLOAT_EQ(updated_table_statistics->staleness(*table), 0.0f);
+  EXPECT_TRUE(updated_table_statistics->column_group_statistics);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(updated_table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a->histogram);
+  EXPECT_FLOAT_EQ(column_statistics_a->histogram->total_count(), 11);
+  EXPECT_EQ(column_statistics_a->histogram->bin_minimum(BinID{0}), 0);
+  EXPECT_EQ(column_statistics_a->histogram->bin_maximum(column_statistics_a->histogram->bin_count() - 1), 110);
+  EXPECT_NEAR(column_statistics_a->null_value_ratio->ratio, 1.0f / 12.0f, 0.001f);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<pmr_string>>(updated_table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics_b->histogram);
+  EXPECT_FLOAT_EQ(column_statistics_b->histogram->total_count(), 12);
+
+  // Chunks that are already represented do not change the statistics
+  EXPECT_EQ(updated_table_statistics->with_chunk(*table, ChunkID{0})->row_count, 12);
+}
+
+TEST_F(TableStatisticsTest, ColumnGroupDistinctCount) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("city", DataType::Int, false);
+  column_definitions.emplace_back("zip", DataType::String, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  table->append({1, pmr_string{"10"}});
+  table->append({1, pmr_string{"11"}});
+  table->append({2, pmr_string{"20"}});
+  table->append({2, pmr_string{"20"}});
+  table->append({3, NULL_VALUE});
+
+  const auto table_statistics = TableStatistics::from_table(*table);
+  const auto& column_group_statistics = table_statistics->column_group_statistics;
+  ASSERT_TRUE(column_group_statistics);
+
+  EXPECT_EQ(column_group_statistics->distinct_count(*table, {ColumnID{0}}), 3);
+  EXPECT_EQ(column_group_statistics->distinct_count(*table, {ColumnID{1}}), 3);
+
+  // Rows with NULLs are not counted, the order of the columns does not matter
+  EXPECT_EQ(column_group_statistics->distinct_count(*table, {ColumnID{0}, ColumnID{1}}), 3);
+  EXPECT_EQ(column_group_statistics->distinct_count(*table, {ColumnID{1}, ColumnID{0}}), 3);
+
+  // Statistics derived during cardinality estimation have no multi-column statistics
+  const auto derived_statistics = TableStatistics{std::vector{table_statistics->column_statistics}, 2};
+  EXPECT_FALSE(derived_statistics.column_group_statistics);
+}
+
 }  // namespace opossum
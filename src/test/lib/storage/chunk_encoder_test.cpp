@@ -6,12 +6,16 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
@@ -210,6 +214,30 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   assert_chunk_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, EncodeInParallel) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  Hyrise::get().job_partitioner.set_min_job_cost(5);
+  _table->last_chunk()->finalize();
+
+  auto progress = std::vector<size_t>{};
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary},
+                                  [&](const size_t processed_chunk_count, const size_t chunk_count) {
+                                    EXPECT_EQ(chunk_count, 3u);
+                                    progress.emplace_back(processed_chunk_count);
+                                  });
+  EXPECT_EQ(progress, std::vector<size_t>({1, 2, 3}));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(column_id)));
+    }
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(ChunkEncoderTest, ReencodingTable) {
   // Encoding specifications which will be applied one after another to the chunk.
   const auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{
@@ -235,4 +263,69 @@ TEST_F(ChunkEncoderTest, ReencodingTable) {
   }
 }
 
+TEST_F(ChunkEncoderTest, EncodingRecreatesIndexesOfTable) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  _table->create_index<HashIndex>(column_ids);
+
+  // The last chunk is still mutable, an index would miss the rows appended later on
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::Hash, column_ids));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::Hash, column_ids));
+
+  // Encoding a single chunk drops the index of the replaced segment
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  const auto value_segment = chunk->get_segment(ColumnID{0});
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_TRUE(chunk->get_indexes(std::vector<std::shared_ptr<const AbstractSegment>>{value_segment}).empty());
+  EXPECT_FALSE(chunk->get_index(SegmentIndexType::Hash, column_ids));
+
+  // Encoding the chunks of the table recreates the indexes of the table, also for chunks that became immutable
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::LZ4});
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->get_indexes(column_ids).size(), 1u);
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->get_index(SegmentIndexType::Hash, column_ids));
+  }
+}
+
+TEST_F(ChunkEncoderTest, MergeDictionaries) {
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  _table->create_index<HashIndex>(column_ids);
+
+  const auto chunk_count = _table->chunk_count();
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_ids.emplace_back(chunk_id);
+  }
+  ChunkEncoder::merge_dictionaries(_table, ColumnID{0}, chunk_ids);
+
+  const auto dictionary_of_chunk = [&](const ChunkID chunk_id, const ColumnID column_id) {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(column_id);
+    return std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(segment)->dictionary();
+  };
+
+  const auto dictionary = dictionary_of_chunk(ChunkID{0}, ColumnID{0});
+  EXPECT_EQ(dictionary->size(), _table->row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(dictionary_of_chunk(chunk_id, ColumnID{0}), dictionary);
+    // Other columns keep their own dictionaries, and the indexes are recreated for the merged segments
+    EXPECT_EQ(dictionary_of_chunk(chunk_id, ColumnID{1})->size(), chunk->size());
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::Hash, column_ids));
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], (*chunk->get_segment(ColumnID{1}))[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(ChunkEncoderTest, ThrowOnMergingDictionariesOfOtherEncodings) {
+  _table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::RunLength});
+
+  EXPECT_THROW(ChunkEncoder::merge_dictionaries(_table, ColumnID{0}, {ChunkID{0}, ChunkID{1}}), std::logic_error);
+}
+
 }  // namespace opossum
@@ -90,6 +90,61 @@ TEST_F(StorageChunkTest, FinalizeSetsMaxBeginCid) {
   EXPECT_EQ(mvcc_data_chunk->max_begin_cid, 3);
 }
 
+TEST_F(StorageChunkTest, CompactMvccData) {
+  auto mvcc_data = std::make_shared<MvccData>(3, 0);
+  mvcc_data->set_begin_cid(0, 1);
+  mvcc_data->set_begin_cid(1, 3);
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}), mvcc_data);
+
+  // Mutable chunks and chunks with rows committed after the given snapshot are not compacted
+  EXPECT_FALSE(chunk->try_compact_mvcc_data(CommitID{5}));
+  chunk->finalize();
+  EXPECT_FALSE(chunk->try_compact_mvcc_data(CommitID{2}));
+
+  // Neither are chunks with locked rows
+  mvcc_data->set_tid(2, TransactionID{7});
+  EXPECT_FALSE(chunk->try_compact_mvcc_data(CommitID{5}));
+  mvcc_data->set_tid(2, INVALID_TRANSACTION_ID);
+
+  EXPECT_TRUE(chunk->try_compact_mvcc_data(CommitID{3}));
+  const auto compacted_mvcc_data = chunk->mvcc_data();
+  EXPECT_TRUE(compacted_mvcc_data->is_compacted());
+  EXPECT_EQ(mvcc_data->successor(), compacted_mvcc_data);
+  EXPECT_LT(compacted_mvcc_data->memory_usage(), mvcc_data->memory_usage());
+  EXPECT_EQ(compacted_mvcc_data->max_begin_cid, CommitID{3});
+  EXPECT_EQ(compacted_mvcc_data->get_begin_cid(2), CommitID{3});
+  EXPECT_EQ(compacted_mvcc_data->get_end_cid(2), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(compacted_mvcc_data->get_tid(2), INVALID_TRANSACTION_ID);
+  EXPECT_FALSE(chunk->try_compact_mvcc_data(CommitID{3}));
+}
+
+TEST_F(StorageChunkTest, ExpandCompactedMvccData) {
+  auto mvcc_data = std::make_shared<MvccData>(3, 0);
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}), mvcc_data);
+  chunk->finalize();
+
+  // Chunks derived from the chunk (e.g., by GetTable) share its MVCC data
+  const auto derived_chunk = std::make_shared<Chunk>(Segments({vs_int}), mvcc_data);
+  ASSERT_TRUE(chunk->try_compact_mvcc_data(CommitID{0}));
+
+  // Writing through the derived chunk expands the compacted MVCC data for both chunks
+  {
+    const auto [writable_mvcc_data, lock] = derived_chunk->writable_mvcc_data();
+    EXPECT_FALSE(writable_mvcc_data->is_compacted());
+    EXPECT_TRUE(writable_mvcc_data->compare_exchange_tid(1, INVALID_TRANSACTION_ID, TransactionID{7}));
+  }
+
+  EXPECT_EQ(chunk->mvcc_data(), derived_chunk->mvcc_data());
+  EXPECT_EQ(chunk->mvcc_data()->get_tid(1), TransactionID{7});
+  EXPECT_EQ(chunk->mvcc_data()->get_begin_cid(0), CommitID{0});
+
+  // The locked row prevents the expanded MVCC data from being compacted again
+  EXPECT_FALSE(chunk->try_compact_mvcc_data(CommitID{0}));
+  chunk->mvcc_data()->set_tid(1, INVALID_TRANSACTION_ID);
+  EXPECT_TRUE(chunk->try_compact_mvcc_data(CommitID{0}));
+  EXPECT_TRUE(derived_chunk->mvcc_data()->is_compacted());
+}
+
 TEST_F(StorageChunkTest, AddIndexByColumnID) {
   chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
   auto index_int = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
@@ -92,7 +92,8 @@ auto compressed_vector_test_formatter = [](const ::testing::TestParamInfo<Vector
 
 INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, CompressedVectorTest,
                          ::testing::Values(VectorCompressionType::SimdBp128,
-                                           VectorCompressionType::FixedSizeByteAligned),
+                                           VectorCompressionType::FixedSizeByteAligned,
+                                           VectorCompressionType::BitPacking),
                          compressed_vector_test_formatter);
 
 TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIterators) {
@@ -33,7 +33,8 @@ auto dictionary_segment_test_formatter = [](const ::testing::TestParamInfo<Vecto
 
 INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, StorageDictionarySegmentTest,
                          ::testing::Values(VectorCompressionType::SimdBp128,
-                                           VectorCompressionType::FixedSizeByteAligned),
+                                           VectorCompressionType::FixedSizeByteAligned,
+                                           VectorCompressionType::BitPacking),
                          dictionary_segment_test_formatter);
 
 TEST_P(StorageDictionarySegmentTest, LowerUpperBound) {
@@ -15,6 +15,7 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_access_counter.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 
 #include "types.hpp"
@@ -705,6 +706,8 @@ TEST_F(EncodedSegmentTest, FrameOfReference) {
 
   // Block minium should be the smallest value: 0
   EXPECT_EQ(for_segment->block_minima().front(), minimum);
+  ASSERT_EQ(for_segment->block_maxima().size(), 1);
+  EXPECT_EQ(for_segment->block_maxima().front(), minimum + row_count - 1);
   resolve_compressed_vector_type(for_segment->offset_values(), [&](const auto& offset_values) {
     auto offset_iter = offset_values.cbegin();
     auto values_iter = values_copy.cbegin();
@@ -727,4 +730,61 @@ TEST_F(EncodedSegmentTest, FrameOfReference) {
   EXPECT_FALSE(for_segment_no_nulls->null_values());
 }
 
+// 64-bit integers are supported as long as the values of each block fit into the 32-bit offsets.
+TEST_F(EncodedSegmentTest, FrameOfReferenceInt64) {
+  constexpr auto row_count = int64_t{17};
+  constexpr auto minimum = int64_t{1} << 40;
+  auto values = pmr_vector<int64_t>(row_count);
+  for (auto row_id = int64_t{0}; row_id < row_count; ++row_id) {
+    values[row_id] = minimum + row_id * 1'000;
+  }
+
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values});
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+  EXPECT_EQ(for_segment->block_minima().front(), minimum);
+
+  auto row_id = size_t{0};
+  segment_iterate<int64_t>(*for_segment, [&](const auto& position) {
+    ASSERT_FALSE(position.is_null());
+    EXPECT_EQ(position.value(), values[row_id]);
+    ++row_id;
+  });
+  EXPECT_EQ(row_id, row_count);
+}
+
+// Blocks whose values do not fit into 32-bit offsets cannot be FrameOfReference-encoded. They are encoded with a
+// dictionary instead of failing.
+TEST_F(EncodedSegmentTest, FrameOfReferenceInt64WideValueRange) {
+  constexpr auto row_count = int64_t{2'500};
+  auto values = pmr_vector<int64_t>(row_count);
+  for (auto row_id = int64_t{0}; row_id < row_count; ++row_id) {
+    values[row_id] = row_id;
+  }
+  values[2'100] = int64_t{1} << 40;
+
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values});
+  EXPECT_FALSE(frame_of_reference_is_applicable(*value_segment, DataType::Long));
+
+  // The other blocks alone still fit
+  const auto narrow_value_segment =
+      std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values.begin(), values.begin() + 2'048});
+  EXPECT_TRUE(frame_of_reference_is_applicable(*narrow_value_segment, DataType::Long));
+
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  ASSERT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int64_t>>(encoded_segment));
+
+  auto row_id = size_t{0};
+  segment_iterate<int64_t>(*encoded_segment, [&](const auto& position) {
+    ASSERT_FALSE(position.is_null());
+    EXPECT_EQ(position.value(), values[row_id]);
+    ++row_id;
+  });
+  EXPECT_EQ(row_id, row_count);
+}
+
 }  // namespace opossum
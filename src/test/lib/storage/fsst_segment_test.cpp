@@ -0,0 +1,144 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<FSSTSegment<pmr_string>> compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment) {
+    auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  auto fsst_segment = compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_EQ(fsst_segment->size(), 0u);
+  EXPECT_TRUE(fsst_segment->compressed_values().empty());
+  EXPECT_FALSE(fsst_segment->null_values());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append("");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Anna");
+  auto fsst_segment = compress(vs_str);
+
+  EXPECT_EQ(fsst_segment->size(), 5u);
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), (pmr_vector<bool>{false, false, false, true, false}));
+
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{0}], AllTypeVariant{"Alex"});
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{1}], AllTypeVariant{"Peter"});
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{2}], AllTypeVariant{""});
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[ChunkOffset{3}]));
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{4}], AllTypeVariant{"Anna"});
+
+  EXPECT_TRUE(fsst_segment->compressed_value(ChunkOffset{2}).empty());
+  EXPECT_TRUE(fsst_segment->compressed_value(ChunkOffset{3}).empty());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressedValuesAreComparable) {
+  const auto values = std::vector<std::string>{"Dampfschifffahrtsgesellschaft", "Schifffahrtsgesellschaft",
+                                               "Dampfschifffahrtsgesellschaftskapitän", "Reeperbahn"};
+  for (auto repetition = 0; repetition < 100; ++repetition) {
+    for (const auto& value : values) {
+      vs_str->append(pmr_string{value});
+    }
+  }
+  auto fsst_segment = compress(vs_str);
+  const auto& symbol_table = fsst_segment->symbol_table();
+
+  // Equal strings are compressed to equal byte sequences, different strings to different ones
+  EXPECT_EQ(fsst_segment->compressed_value(ChunkOffset{0}), fsst_segment->compressed_value(ChunkOffset{4}));
+  EXPECT_NE(fsst_segment->compressed_value(ChunkOffset{0}), fsst_segment->compressed_value(ChunkOffset{1}));
+
+  auto compressed_search_value = pmr_vector<char>{};
+  symbol_table.compress("Reeperbahn", compressed_search_value);
+  EXPECT_EQ(fsst_segment->compressed_value(ChunkOffset{3}),
+            std::string_view(compressed_search_value.data(), compressed_search_value.size()));
+
+  const auto compressed_value = fsst_segment->compressed_value(ChunkOffset{2});
+  EXPECT_TRUE(symbol_table.decompressed_starts_with(compressed_value, ""));
+  EXPECT_TRUE(symbol_table.decompressed_starts_with(compressed_value, "Dampf"));
+  EXPECT_TRUE(symbol_table.decompressed_starts_with(compressed_value, "Dampfschifffahrtsgesellschaftskapitän"));
+  EXPECT_FALSE(symbol_table.decompressed_starts_with(compressed_value, "Dampfer"));
+  EXPECT_FALSE(symbol_table.decompressed_starts_with(compressed_value, "Dampfschifffahrtsgesellschaftskapitäne"));
+
+  // The repetitive strings should compress well
+  EXPECT_LT(fsst_segment->memory_usage(MemoryUsageCalculationMode::Full),
+            vs_str->memory_usage(MemoryUsageCalculationMode::Full));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressUnseenBytes) {
+  vs_str->append("aaaaaaaaaaaaaaaa");
+  auto fsst_segment = compress(vs_str);
+
+  // Bytes that are not covered by the symbol table are escaped
+  auto compressed_value = pmr_vector<char>{};
+  fsst_segment->symbol_table().compress("a\xff\x01zaa", compressed_value);
+  auto decompressed_value = pmr_string{};
+  fsst_segment->symbol_table().decompress(std::string_view(compressed_value.data(), compressed_value.size()),
+                                          decompressed_value);
+  EXPECT_EQ(decompressed_value, "a\xff\x01zaa");
+}
+
+TEST_F(StorageFSSTSegmentTest, PointAccess) {
+  vs_str->append("Hamburg");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Hannover");
+  vs_str->append("Berlin");
+  auto fsst_segment = compress(vs_str);
+
+  auto position_filter = std::make_shared<RowIDPosList>();
+  position_filter->emplace_back(ChunkID{0}, ChunkOffset{3});
+  position_filter->emplace_back(ChunkID{0}, ChunkOffset{1});
+  position_filter->emplace_back(ChunkID{0}, ChunkOffset{0});
+  position_filter->guarantee_single_chunk();
+
+  auto values = std::vector<std::optional<pmr_string>>{};
+  const auto iterable = FSSTSegmentIterable<pmr_string>{*fsst_segment};
+  iterable.with_iterators(position_filter, [&](auto it, const auto end) {
+    for (; it != end; ++it) {
+      values.emplace_back(it->is_null() ? std::nullopt : std::optional<pmr_string>{it->value()});
+    }
+  });
+
+  EXPECT_EQ(values, (std::vector<std::optional<pmr_string>>{"Berlin", std::nullopt, "Hamburg"}));
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  vs_str->append("Hamburg");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Hannover");
+  auto fsst_segment = compress(vs_str);
+
+  const auto copied_segment =
+      std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(fsst_segment->copy_using_allocator({}));
+  ASSERT_TRUE(copied_segment);
+  EXPECT_EQ(copied_segment->size(), 3u);
+  EXPECT_EQ(copied_segment->compressed_values(), fsst_segment->compressed_values());
+  EXPECT_EQ(copied_segment->offsets(), fsst_segment->offsets());
+  EXPECT_EQ((*copied_segment)[ChunkOffset{2}], AllTypeVariant{"Hannover"});
+  EXPECT_TRUE(variant_is_null((*copied_segment)[ChunkOffset{1}]));
+}
+
+}  // namespace opossum
@@ -283,4 +283,33 @@ TEST_F(AdaptiveRadixTreeIndexTest, DenseVectorOfInts) {
   _search_elements(values);
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, RangesAcrossCompressedPaths) {
+  // 300 distinct values, whose value IDs share their first two bytes, which are stored as prefixes of the nodes. Every
+  // value occurs twice, the NULLs are not part of the ranges.
+  auto values = std::vector<std::optional<int32_t>>{};
+  for (auto value = int32_t{299}; value >= 0; --value) {
+    values.emplace_back(value);
+    values.emplace_back(std::nullopt);
+    values.emplace_back(value);
+  }
+  const auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  const auto index = AdaptiveRadixTreeIndex{std::vector<std::shared_ptr<const AbstractSegment>>({segment})};
+
+  EXPECT_EQ(std::distance(index.cbegin(), index.cend()), 600);
+  EXPECT_EQ(index.null_cend() - index.null_cbegin(), 300);
+
+  for (const auto value : {0, 1, 255, 256, 299}) {
+    const auto lower_bound = index.lower_bound({value});
+    const auto upper_bound = index.upper_bound({value});
+    ASSERT_EQ(std::distance(lower_bound, upper_bound), 2);
+    // The positions of a value are stored in ascending order
+    EXPECT_EQ(*lower_bound, static_cast<ChunkOffset>((299 - value) * 3));
+    EXPECT_EQ(*std::next(lower_bound), static_cast<ChunkOffset>((299 - value) * 3 + 2));
+    EXPECT_EQ(std::distance(index.cbegin(), lower_bound), 2 * value);
+  }
+
+  EXPECT_EQ(index.lower_bound({-1}), index.cbegin());
+  EXPECT_EQ(index.lower_bound({300}), index.cend());
+}
+
 }  // namespace opossum
@@ -26,6 +26,15 @@ std::vector<opossum::VariableLengthKey> to_vector(const opossum::VariableLengthK
   return result;
 }
 
+std::vector<opossum::ChunkOffset> to_vector(const opossum::BaseCompressedVector& offsets) {
+  auto decompressor = offsets.create_base_decompressor();
+  auto result = std::vector<opossum::ChunkOffset>(offsets.size());
+  for (auto index = size_t{0}; index < result.size(); ++index) {
+    result[index] = opossum::ChunkOffset{decompressor->get(index)};
+  }
+  return result;
+}
+
 testing::AssertionResult is_contained_in(opossum::ChunkOffset value, const std::set<opossum::ChunkOffset>& set) {
   if (set.find(value) == set.end()) {
     return testing::AssertionFailure() << testing::PrintToString(set) << " does not contain " << value;
@@ -67,8 +76,8 @@ class CompositeGroupKeyIndexTest : public BaseTest {
     _keys_int_str = &(_index_int_str->_keys);
     _keys_str_int = &(_index_str_int->_keys);
 
-    _offsets_int_str = &(_index_int_str->_key_offsets);
-    _offsets_str_int = &(_index_str_int->_key_offsets);
+    _offsets_int_str = _index_int_str->_key_offsets.get();
+    _offsets_str_int = _index_str_int->_key_offsets.get();
 
     _position_list_int_str = &(_index_int_str->_position_list);
     _position_list_str_int = &(_index_str_int->_position_list);
@@ -88,8 +97,8 @@ class CompositeGroupKeyIndexTest : public BaseTest {
   VariableLengthKeyStore* _keys_int_str;
   VariableLengthKeyStore* _keys_str_int;
 
-  std::vector<ChunkOffset>* _offsets_int_str;
-  std::vector<ChunkOffset>* _offsets_str_int;
+  const BaseCompressedVector* _offsets_int_str;
+  const BaseCompressedVector* _offsets_str_int;
 
   std::vector<ChunkOffset>* _position_list_int_str;
   std::vector<ChunkOffset>* _position_list_str_int;
@@ -111,8 +120,11 @@ TEST_F(CompositeGroupKeyIndexTest, Offsets) {
   auto expected_int_str = std::vector<ChunkOffset>{0, 1, 2, 4, 5, 6, 7};
   auto expected_str_int = std::vector<ChunkOffset>{0, 1, 2, 3, 5, 6, 7};
 
-  EXPECT_EQ(expected_int_str, *_offsets_int_str);
-  EXPECT_EQ(expected_str_int, *_offsets_str_int);
+  EXPECT_EQ(expected_int_str, to_vector(*_offsets_int_str));
+  EXPECT_EQ(expected_str_int, to_vector(*_offsets_str_int));
+
+  // Eight positions fit into a single byte per offset
+  EXPECT_EQ(_offsets_int_str->type(), CompressedVectorType::FixedSize1ByteAligned);
 }
 
 TEST_F(CompositeGroupKeyIndexTest, PositionList) {
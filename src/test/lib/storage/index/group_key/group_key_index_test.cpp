@@ -41,7 +41,7 @@ class GroupKeyIndexTest : public BaseTest {
 
     index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>({dict_segment}));
 
-    value_start_offsets = &(index->_value_start_offsets);
+    value_start_offsets = index->_value_start_offsets.get();
     positions = &(index->_positions);
     null_positions = &(index->_null_positions);
   }
@@ -54,14 +54,22 @@ class GroupKeyIndexTest : public BaseTest {
    * private scope. In order to minimize the friend classes of CompositeGroupKeyIndex the fixture
    * is used as proxy. Since the variables are set in setup() references are not possible.
    */
-  std::vector<ChunkOffset>* value_start_offsets;
+  const BaseCompressedVector* value_start_offsets;
   std::vector<ChunkOffset>* positions;
   std::vector<ChunkOffset>* null_positions;
 };
 
 TEST_F(GroupKeyIndexTest, IndexOffsets) {
   auto expected_offsets = std::vector<ChunkOffset>{0, 1, 3, 5, 6, 7, 8};
-  EXPECT_EQ(expected_offsets, *value_start_offsets);
+  auto decompressor = value_start_offsets->create_base_decompressor();
+  auto offsets = std::vector<ChunkOffset>(value_start_offsets->size());
+  for (auto index = size_t{0}; index < offsets.size(); ++index) {
+    offsets[index] = ChunkOffset{decompressor->get(index)};
+  }
+  EXPECT_EQ(expected_offsets, offsets);
+
+  // Eight positions fit into a single byte per offset
+  EXPECT_EQ(value_start_offsets->type(), CompressedVectorType::FixedSize1ByteAligned);
 }
 
 /*
@@ -99,54 +107,58 @@ TEST_F(GroupKeyIndexTest, IndexMemoryConsumption) {
   // A2, B1, C1
   // expected memory consumption:
   //  - `_indexed_segments`, shared pointer               ->  16 bytes
-  //  - `_value_start_offsets`                                  ->  24 bytes
-  //  - `_value_start_offsets`, 7 elements, each 4 bytes        ->  28 bytes
+  //  - `_value_start_offsets`, unique pointer                ->   8 bytes
+  //  - `_value_start_offsets`, 7 elements, each 1 byte         ->   7 bytes
+  //  - `_value_start_offsets_decompressor`, unique pointer   ->   8 bytes
   //  - `_positions`                                 ->  24 bytes
   //  - `_positions`, 8 elements, each 4 bytes       ->  32 bytes
   //  - `_null_positions`                            ->  24 bytes
   //  - `_null_positions`, 4 elements, each 4 bytes  ->  16 bytes
   //  - `_type`                                           ->   1 byte
-  //  - sum                                               >> 165 bytes
-  EXPECT_EQ(index->memory_consumption(), 165u);
+  //  - sum                                               >> 136 bytes
+  EXPECT_EQ(index->memory_consumption(), 136u);
 
   // A2, B1, C2
   // expected memory consumption:
   //  - `_indexed_segments`, shared pointer               ->  16 bytes
-  //  - `_value_start_offsets`                                  ->  24 bytes
-  //  - `_value_start_offsets`, 1 elements, each 4 bytes        ->   4 bytes
+  //  - `_value_start_offsets`, unique pointer                ->   8 bytes
+  //  - `_value_start_offsets`, 1 elements, each 1 byte         ->   1 byte
+  //  - `_value_start_offsets_decompressor`, unique pointer   ->   8 bytes
   //  - `_positions`                                 ->  24 bytes
   //  - `_positions`, 0 elements, each 4 bytes       ->   0 bytes
   //  - `_null_positions`                            ->  24 bytes
   //  - `_null_positions`, 2 elements, each 4 bytes  ->   8 bytes
   //  - `_type`                                           ->   1 byte
-  //  - sum                                               >> 101 bytes
-  EXPECT_EQ(index_int_nulls->memory_consumption(), 101u);
+  //  - sum                                               >>  90 bytes
+  EXPECT_EQ(index_int_nulls->memory_consumption(), 90u);
 
   // A2, B2, C1
   // expected memory consumption:
   //  - `_indexed_segments`, shared pointer               ->  16 bytes
-  //  - `_value_start_offsets`                                  ->  24 bytes
-  //  - `_value_start_offsets`, 3 elements, each 4 bytes        ->  12 bytes
+  //  - `_value_start_offsets`, unique pointer                ->   8 bytes
+  //  - `_value_start_offsets`, 3 elements, each 1 byte         ->   3 bytes
+  //  - `_value_start_offsets_decompressor`, unique pointer   ->   8 bytes
   //  - `_positions`                                 ->  24 bytes
   //  - `_positions`, 2 elements, each 4 bytes       ->   8 bytes
   //  - `_null_positions`                            ->  24 bytes
   //  - `_null_positions`, 0 elements, each 4 bytes  ->   0 bytes
   //  - `_type`                                           ->   1 byte
-  //  - sum                                               >> 109 bytes
-  EXPECT_EQ(index_int_no_nulls->memory_consumption(), 109u);
+  //  - sum                                               >>  92 bytes
+  EXPECT_EQ(index_int_no_nulls->memory_consumption(), 92u);
 
   // A1, B2, C2
   // expected memory consumption:
   //  - `_indexed_segments`, shared pointer               ->  16 bytes
-  //  - `_value_start_offsets`                                  ->  24 bytes
-  //  - `_value_start_offsets`, 1 elements, each 4 bytes        ->   4 bytes
+  //  - `_value_start_offsets`, unique pointer                ->   8 bytes
+  //  - `_value_start_offsets`, 1 elements, each 1 byte         ->   1 byte
+  //  - `_value_start_offsets_decompressor`, unique pointer   ->   8 bytes
   //  - `_positions`                                 ->  24 bytes
   //  - `_positions`, 0 elements, each 4 bytes       ->   0 bytes
   //  - `_null_positions`                            ->  24 bytes
   //  - `_null_positions`, 0 elements, each 4 bytes  ->   0 bytes
   //  - `_type`                                           ->   1 byte
-  //  - sum                                               >>  93 bytes
-  EXPECT_EQ(index_int_empty->memory_consumption(), 93u);
+  //  - sum                                               >>  82 bytes
+  EXPECT_EQ(index_int_empty->memory_consumption(), 82u);
 }
 
 TEST_F(GroupKeyIndexTest, IndexPostings) {
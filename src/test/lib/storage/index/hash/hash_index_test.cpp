@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/abstract_segment.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    values = {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"};
+    segment = std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{values});
+    index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const AbstractSegment>>({segment}));
+  }
+
+  static std::vector<ChunkOffset> equal_positions(const HashIndex& hash_index, const AllTypeVariant& value) {
+    const auto [begin, end] = hash_index.equal_range({value});
+    auto positions = std::vector<ChunkOffset>(begin, end);
+    std::sort(positions.begin(), positions.end());
+    return positions;
+  }
+
+  static size_t slot_count(const HashIndex& hash_index) {
+    return static_cast<const HashIndexImpl<int32_t>&>(*hash_index._impl)._slots.size();
+  }
+
+  pmr_vector<pmr_string> values;
+  std::shared_ptr<HashIndex> index = nullptr;
+  std::shared_ptr<ValueSegment<pmr_string>> segment = nullptr;
+};
+
+TEST_F(HashIndexTest, IndexProbes) {
+  EXPECT_EQ(equal_positions(*index, "apple"), std::vector<ChunkOffset>({4}));
+  EXPECT_EQ(equal_positions(*index, "charlie"), std::vector<ChunkOffset>({5, 6}));
+  EXPECT_EQ(equal_positions(*index, "delta"), std::vector<ChunkOffset>({1, 3}));
+  EXPECT_EQ(equal_positions(*index, "hotel"), std::vector<ChunkOffset>({0}));
+  EXPECT_TRUE(equal_positions(*index, "golf").empty());
+
+  // The positions of each value are stored contiguously
+  EXPECT_EQ(index->cend() - index->cbegin(), 8);
+  EXPECT_EQ(index->null_cbegin(), index->null_cend());
+}
+
+TEST_F(HashIndexTest, NullsAndCasts) {
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{3, 0, 3, 7},
+                                                                   pmr_vector<bool>{false, true, false, false});
+  const auto int_index = HashIndex{std::vector<std::shared_ptr<const AbstractSegment>>({int_segment})};
+
+  EXPECT_EQ(equal_positions(int_index, 3), std::vector<ChunkOffset>({0, 2}));
+  EXPECT_EQ(equal_positions(int_index, int64_t{7}), std::vector<ChunkOffset>({3}));
+  EXPECT_TRUE(equal_positions(int_index, 0).empty());
+  EXPECT_TRUE(equal_positions(int_index, 3.5).empty());
+  EXPECT_EQ(std::vector<ChunkOffset>(int_index.null_cbegin(), int_index.null_cend()), std::vector<ChunkOffset>({1}));
+}
+
+TEST_F(HashIndexTest, ManyDistinctValues) {
+  auto int_values = pmr_vector<int32_t>(10'000);
+  for (auto value_idx = size_t{0}; value_idx < int_values.size(); ++value_idx) {
+    // Multiples of a power of two would collide if the hash were not mixed
+    int_values[value_idx] = static_cast<int32_t>((value_idx % 5'000) * 1024);
+  }
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values));
+  const auto int_index = HashIndex{std::vector<std::shared_ptr<const AbstractSegment>>({int_segment})};
+
+  // The table grows so that at most half of the slots are used
+  EXPECT_GE(slot_count(int_index), 10'000u);
+
+  for (auto value_idx = ChunkOffset{0}; value_idx < 5'000; value_idx += 499) {
+    EXPECT_EQ(equal_positions(int_index, static_cast<int32_t>(value_idx * 1024)),
+              std::vector<ChunkOffset>({value_idx, value_idx + 5'000}));
+  }
+  EXPECT_TRUE(equal_positions(int_index, 1).empty());
+}
+
+TEST_F(HashIndexTest, RangeQueriesThrow) {
+  EXPECT_FALSE(index->supports_range_queries());
+  EXPECT_THROW(index->lower_bound({"apple"}), std::logic_error);
+  EXPECT_THROW(index->upper_bound({"apple"}), std::logic_error);
+}
+
+TEST_F(HashIndexTest, MemoryConsumption) {
+  EXPECT_GT(index->memory_consumption(), 8 * sizeof(ChunkOffset) + 6 * sizeof(pmr_string));
+}
+
+}  // namespace opossum
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table/table_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    table->append({4, "delta"});
+    table->append({2, "bravo"});
+    table->append({NullValue{}, "null"});
+    table->append({4, "delta"});
+    table->append({1, "alpha"});
+    table->append({3, "charlie"});
+    table->append({5, "echo"});
+  }
+
+  static std::vector<RowID> lookup(const TableIndex& table_index, const PredicateCondition predicate_condition,
+                                   const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2 = {}) {
+    auto matches = RowIDPosList{};
+    table_index.lookup(predicate_condition, value, value2, matches);
+    auto sorted_matches = std::vector<RowID>(matches.begin(), matches.end());
+    std::sort(sorted_matches.begin(), sorted_matches.end());
+    return sorted_matches;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(TableIndexTest, Lookups) {
+  table->create_table_index(ColumnID{0});
+  const auto& table_index = *table->get_table_index(ColumnID{0});
+  EXPECT_FALSE(table->get_table_index(ColumnID{1}));
+
+  // NULL values are not indexed
+  EXPECT_EQ(table_index.entry_count(), 6u);
+
+  const auto row = [](const uint32_t chunk_id, const uint32_t chunk_offset) {
+    return RowID{ChunkID{chunk_id}, ChunkOffset{chunk_offset}};
+  };
+
+  EXPECT_EQ(lookup(table_index, PredicateCondition::Equals, 4), std::vector<RowID>({row(0, 0), row(1, 0)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::Equals, int64_t{5}), std::vector<RowID>({row(2, 0)}));
+  EXPECT_TRUE(lookup(table_index, PredicateCondition::Equals, 6).empty());
+  EXPECT_TRUE(lookup(table_index, PredicateCondition::Equals, 2.5).empty());
+  EXPECT_TRUE(lookup(table_index, PredicateCondition::Equals, NullValue{}).empty());
+
+  EXPECT_EQ(lookup(table_index, PredicateCondition::NotEquals, 4),
+            std::vector<RowID>({row(0, 1), row(1, 1), row(1, 2), row(2, 0)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::NotEquals, 2.5).size(), 6u);
+  EXPECT_EQ(lookup(table_index, PredicateCondition::LessThan, 3), std::vector<RowID>({row(0, 1), row(1, 1)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::LessThanEquals, 3),
+            std::vector<RowID>({row(0, 1), row(1, 1), row(1, 2)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::GreaterThan, 4), std::vector<RowID>({row(2, 0)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::GreaterThanEquals, 4),
+            std::vector<RowID>({row(0, 0), row(1, 0), row(2, 0)}));
+
+  EXPECT_EQ(lookup(table_index, PredicateCondition::BetweenInclusive, 2, 4),
+            std::vector<RowID>({row(0, 0), row(0, 1), row(1, 0), row(1, 2)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::BetweenLowerExclusive, 2, 4),
+            std::vector<RowID>({row(0, 0), row(1, 0), row(1, 2)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::BetweenUpperExclusive, 2, 4),
+            std::vector<RowID>({row(0, 1), row(1, 2)}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::BetweenExclusive, 2, 4), std::vector<RowID>({row(1, 2)}));
+  EXPECT_TRUE(lookup(table_index, PredicateCondition::BetweenExclusive, 3, 3).empty());
+  EXPECT_TRUE(lookup(table_index, PredicateCondition::BetweenInclusive, 4, 2).empty());
+}
+
+TEST_F(TableIndexTest, LookupEquals) {
+  table->create_table_index(ColumnID{1});
+  const auto& table_index = *table->get_table_index(ColumnID{1});
+
+  auto matches = std::vector<std::pair<ChunkOffset, RowID>>{};
+  table_index.lookup_equals<pmr_string>({{"echo", ChunkOffset{0}},
+                                         {"delta", ChunkOffset{1}},
+                                         {"foxtrot", ChunkOffset{2}},
+                                         {"delta", ChunkOffset{3}},
+                                         {"alpha", ChunkOffset{4}}},
+                                        matches);
+  std::sort(matches.begin(), matches.end());
+
+  const auto match = [](const uint32_t probe_chunk_offset, const uint32_t chunk_id, const uint32_t chunk_offset) {
+    return std::pair{ChunkOffset{probe_chunk_offset}, RowID{ChunkID{chunk_id}, ChunkOffset{chunk_offset}}};
+  };
+  const auto expected_matches = std::vector<std::pair<ChunkOffset, RowID>>{
+      match(0, 2, 0), match(1, 0, 0), match(1, 1, 0), match(3, 0, 0), match(3, 1, 0), match(4, 1, 1)};
+  EXPECT_EQ(matches, expected_matches);
+
+  // The values have to have the data type of the column
+  EXPECT_THROW(table_index.lookup_equals<int32_t>({{4, ChunkOffset{0}}}, matches), std::logic_error);
+}
+
+TEST_F(TableIndexTest, Supports) {
+  table->create_table_index(ColumnID{0});
+  const auto& table_index = *table->get_table_index(ColumnID{0});
+
+  EXPECT_TRUE(TableIndex::supports(PredicateCondition::BetweenExclusive));
+  EXPECT_FALSE(TableIndex::supports(PredicateCondition::Like));
+  EXPECT_FALSE(TableIndex::supports(PredicateCondition::IsNull));
+
+  EXPECT_TRUE(table_index.supports(PredicateCondition::Equals, 2.5, std::nullopt));
+  EXPECT_TRUE(table_index.supports(PredicateCondition::LessThan, 3, std::nullopt));
+  EXPECT_FALSE(table_index.supports(PredicateCondition::LessThan, 2.5, std::nullopt));
+  EXPECT_FALSE(table_index.supports(PredicateCondition::BetweenInclusive, 1, int64_t{3}));
+
+  EXPECT_THROW(lookup(table_index, PredicateCondition::LessThan, 2.5), std::logic_error);
+  EXPECT_THROW(table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, EncodedChunks) {
+  table->get_chunk(ChunkID{2})->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  table->create_table_index(ColumnID{1});
+  const auto& table_index = *table->get_table_index(ColumnID{1});
+
+  EXPECT_EQ(table_index.entry_count(), 7u);
+  EXPECT_EQ(lookup(table_index, PredicateCondition::Equals, "delta"),
+            std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_EQ(lookup(table_index, PredicateCondition::GreaterThan, "delta"),
+            std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{2}, ChunkOffset{0}}}));
+  EXPECT_GT(table_index.memory_consumption(), 0u);
+}
+
+TEST_F(TableIndexTest, MaintainedByInsert) {
+  Hyrise::get().storage_manager.add_table("table_a", table);
+  table->create_table_index(ColumnID{0});
+  const auto& table_index = *table->get_table_index(ColumnID{0});
+
+  const auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values->append({4, "delta"});
+  values->append({NullValue{}, "null"});
+  values->append({6, "foxtrot"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  // The entries are added before the commit. Rolled back rows remain in the index, their MVCC data makes them
+  // invisible.
+  const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(table_index.entry_count(), 8u);
+  EXPECT_EQ(lookup(table_index, PredicateCondition::Equals, 6),
+            std::vector<RowID>({RowID{ChunkID{3}, ChunkOffset{0}}}));
+  context->rollback(RollbackReason::User);
+
+  const auto insert2 = std::make_shared<Insert>("table_a", table_wrapper);
+  const auto context2 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert2->set_transaction_context(context2);
+  insert2->execute();
+  context2->commit();
+
+  EXPECT_EQ(table_index.entry_count(), 10u);
+  EXPECT_EQ(lookup(table_index, PredicateCondition::Equals, 4),
+            std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{0}},
+                                RowID{ChunkID{2}, ChunkOffset{1}}, RowID{ChunkID{3}, ChunkOffset{1}}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
+#include "storage/lz4_segment/lz4_encoder.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class LZ4BlockCacheTest : public BaseTest {};
+
+TEST_F(LZ4BlockCacheTest, SetAndGet) {
+  auto cache = LZ4BlockCache{1'000};
+  auto block = std::vector<char>{};
+
+  EXPECT_FALSE(cache.try_get(0, 0, block));
+  cache.set(0, 0, std::vector<char>(100, 'a'));
+  cache.set(0, 1, std::vector<char>(100, 'b'));
+  cache.set(1, 0, std::vector<char>(100, 'c'));
+
+  EXPECT_TRUE(cache.try_get(0, 1, block));
+  EXPECT_EQ(block, std::vector<char>(100, 'b'));
+  EXPECT_TRUE(cache.try_get(1, 0, block));
+  EXPECT_EQ(block, std::vector<char>(100, 'c'));
+  EXPECT_FALSE(cache.try_get(1, 1, block));
+
+  EXPECT_EQ(cache.block_count(), 3);
+  EXPECT_EQ(cache.size_in_bytes(), 300);
+  EXPECT_EQ(cache.hit_count(), 2);
+  EXPECT_EQ(cache.miss_count(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.block_count(), 0);
+  EXPECT_EQ(cache.size_in_bytes(), 0);
+  EXPECT_EQ(cache.hit_count(), 0);
+  EXPECT_EQ(cache.miss_count(), 0);
+}
+
+TEST_F(LZ4BlockCacheTest, EvictLeastRecentlyUsed) {
+  auto cache = LZ4BlockCache{300};
+  auto block = std::vector<char>{};
+
+  cache.set(0, 0, std::vector<char>(100, 'a'));
+  cache.set(0, 1, std::vector<char>(100, 'b'));
+  cache.set(0, 2, std::vector<char>(100, 'c'));
+
+  // Block 0 was used most recently, so block 1 is evicted
+  EXPECT_TRUE(cache.try_get(0, 0, block));
+  cache.set(0, 3, std::vector<char>(100, 'd'));
+  EXPECT_EQ(cache.size_in_bytes(), 300);
+  EXPECT_TRUE(cache.try_get(0, 0, block));
+  EXPECT_FALSE(cache.try_get(0, 1, block));
+  EXPECT_TRUE(cache.try_get(0, 2, block));
+  EXPECT_TRUE(cache.try_get(0, 3, block));
+
+  // Blocks larger than the cache are not cached
+  cache.set(0, 4, std::vector<char>(301, 'e'));
+  EXPECT_FALSE(cache.try_get(0, 4, block));
+  EXPECT_EQ(cache.block_count(), 3);
+
+  cache.resize(150);
+  EXPECT_EQ(cache.capacity(), 150);
+  EXPECT_EQ(cache.block_count(), 1);
+  EXPECT_TRUE(cache.try_get(0, 3, block));
+
+  // A capacity of zero disables the cache
+  cache.resize(0);
+  cache.set(0, 5, std::vector<char>(1, 'f'));
+  EXPECT_EQ(cache.block_count(), 0);
+}
+
+TEST_F(LZ4BlockCacheTest, CachePointAccessesToLZ4Segments) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto row_count = LZ4Encoder::_block_size / sizeof(int32_t) * 3;
+  for (auto value = int32_t{0}; value < static_cast<int32_t>(row_count); ++value) {
+    value_segment->append(value);
+  }
+  const auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<int32_t>>(
+      ChunkEncoder::encode_segment(value_segment, DataType::Int, SegmentEncodingSpec{EncodingType::LZ4}));
+  ASSERT_TRUE(lz4_segment);
+
+  auto& cache = Hyrise::get().lz4_block_cache;
+  cache.clear();
+
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{5}), 5);
+  EXPECT_EQ(cache.miss_count(), 1);
+  EXPECT_EQ(cache.block_count(), 1);
+
+  // The second access to the same block does not decompress it again
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{10}), 10);
+  EXPECT_EQ(cache.hit_count(), 1);
+
+  const auto last_offset = static_cast<ChunkOffset>(row_count - 1);
+  EXPECT_EQ(lz4_segment->get_typed_value(last_offset), static_cast<int32_t>(last_offset));
+  EXPECT_EQ(lz4_segment->get_typed_value(last_offset), static_cast<int32_t>(last_offset));
+  EXPECT_EQ(cache.miss_count(), 2);
+  EXPECT_EQ(cache.hit_count(), 2);
+  EXPECT_EQ(cache.block_count(), 2);
+
+  // Copies do not share the cached blocks as their ids differ
+  const auto copied_segment =
+      std::dynamic_pointer_cast<LZ4Segment<int32_t>>(lz4_segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  EXPECT_EQ(copied_segment->get_typed_value(ChunkOffset{5}), 5);
+  EXPECT_EQ(cache.miss_count(), 3);
+}
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logical_query_plan/create_view_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The view is defined on sales. The same statements are executed on reference, which has no view.
+    for (const auto& table_name : {"sales", "reference"}) {
+      const auto table = std::make_shared<Table>(
+          TableColumnDefinitions{{"region", DataType::Int, false}, {"amount", DataType::Int, true}}, TableType::Data,
+          ChunkOffset{4}, UseMvcc::Yes);
+      for (auto value = int32_t{0}; value < 10; ++value) {
+        table->append({value % 3, value % 4 == 0 ? NULL_VALUE : AllTypeVariant{value}});
+      }
+      Hyrise::get().storage_manager.add_table(table_name, table);
+    }
+  }
+
+  static std::shared_ptr<const Table> execute(
+      const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    auto pipeline = builder.create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  // Executes the statement on both tables
+  static void modify(const std::string& sql_template) {
+    for (const auto& table_name : {"sales", "reference"}) {
+      auto sql = sql_template;
+      sql.replace(sql.find("%"), 1, table_name);
+      execute(sql);
+    }
+  }
+
+  static std::shared_ptr<LQPView> lqp_view(const std::string& select_sql) {
+    auto pipeline = SQLPipelineBuilder{"CREATE VIEW unused AS " + select_sql}.create_pipeline();
+    return std::static_pointer_cast<CreateViewNode>(pipeline.get_unoptimized_logical_plans().at(0))->view;
+  }
+
+  static void expect_view_matches_reference(const std::string& select_template) {
+    auto reference_sql = select_template;
+    reference_sql.replace(reference_sql.find("%"), 1, "reference");
+
+    // The aggregates of the view are computed from the partials and differ in their nullability
+    if (const auto table_difference_message =
+            check_table_equal(execute("SELECT * FROM mv"), execute(reference_sql), OrderSensitivity::No,
+                              TypeCmpMode::Strict, FloatComparisonMode::AbsoluteDifference, IgnoreNullable::Yes)) {
+      FAIL() << *table_difference_message;
+    }
+  }
+
+  const std::string sum_template =
+      "SELECT region, SUM(amount) AS total, COUNT(amount) AS amounts, COUNT(*) AS row_count FROM % "
+      "WHERE region < 2 GROUP BY region";
+  const std::string min_max_template =
+      "SELECT region, MIN(amount) AS minimum, MAX(amount) AS maximum FROM % GROUP BY region";
+};
+
+TEST_F(MaterializedViewTest, IsSupported) {
+  EXPECT_TRUE(MaterializedView::is_supported(*lqp_view("SELECT region, SUM(amount) FROM sales GROUP BY region")));
+  EXPECT_TRUE(MaterializedView::is_supported(
+      *lqp_view("SELECT region, MAX(amount) FROM sales WHERE amount > 2 GROUP BY region HAVING MAX(amount) > 5")));
+
+  // AVG() is not supported
+  EXPECT_FALSE(MaterializedView::is_supported(*lqp_view("SELECT region, AVG(amount) FROM sales GROUP BY region")));
+  // The groups must be non-nullable columns
+  EXPECT_FALSE(MaterializedView::is_supported(*lqp_view("SELECT amount, COUNT(*) FROM sales GROUP BY amount")));
+  EXPECT_FALSE(MaterializedView::is_supported(*lqp_view("SELECT SUM(amount) FROM sales")));
+  // The argument is computed by a ProjectionNode below the AggregateNode
+  EXPECT_FALSE(
+      MaterializedView::is_supported(*lqp_view("SELECT region, SUM(amount + 1) FROM sales GROUP BY region")));
+  EXPECT_FALSE(MaterializedView::is_supported(*lqp_view(
+      "SELECT s.region, SUM(s.amount) FROM sales s, reference r WHERE s.region = r.region GROUP BY s.region")));
+}
+
+TEST_F(MaterializedViewTest, AddAndDrop) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto sql = sum_template;
+  storage_manager.add_materialized_view("mv", lqp_view(sql.replace(sql.find("%"), 1, "sales")));
+
+  EXPECT_TRUE(storage_manager.has_materialized_view("mv"));
+  EXPECT_TRUE(storage_manager.has_view("mv"));
+  EXPECT_TRUE(storage_manager.has_table("mv__partials"));
+  EXPECT_EQ(storage_manager.materialized_views_on_table(storage_manager.get_table("sales")).size(), 1);
+  EXPECT_TRUE(storage_manager.materialized_views_on_table(storage_manager.get_table("reference")).empty());
+  expect_view_matches_reference(sum_template);
+
+  storage_manager.drop_materialized_view("mv");
+  EXPECT_FALSE(storage_manager.has_materialized_view("mv"));
+  EXPECT_FALSE(storage_manager.has_view("mv"));
+  EXPECT_FALSE(storage_manager.has_table("mv__partials"));
+  EXPECT_TRUE(storage_manager.materialized_views_on_table(storage_manager.get_table("sales")).empty());
+}
+
+TEST_F(MaterializedViewTest, MaintainSumAndCount) {
+  auto sql = sum_template;
+  Hyrise::get().storage_manager.add_materialized_view("mv", lqp_view(sql.replace(sql.find("%"), 1, "sales")));
+
+  modify("INSERT INTO % VALUES (0, 100), (1, NULL), (2, 7), (3, 3)");
+  expect_view_matches_reference(sum_template);
+
+  // Delete all rows of region 1, so that the group vanishes
+  modify("DELETE FROM % WHERE region = 1");
+  expect_view_matches_reference(sum_template);
+
+  modify("UPDATE % SET amount = amount + 1 WHERE region = 0");
+  expect_view_matches_reference(sum_template);
+
+  modify("INSERT INTO % VALUES (1, NULL)");
+  expect_view_matches_reference(sum_template);
+}
+
+TEST_F(MaterializedViewTest, MaintainMinAndMax) {
+  auto sql = min_max_template;
+  Hyrise::get().storage_manager.add_materialized_view("mv", lqp_view(sql.replace(sql.find("%"), 1, "sales")));
+
+  // Increase and decrease the extrema of the groups
+  modify("INSERT INTO % VALUES (0, -1), (1, 100)");
+  expect_view_matches_reference(min_max_template);
+
+  modify("DELETE FROM % WHERE amount = -1 OR amount = 100 OR amount = 2");
+  expect_view_matches_reference(min_max_template);
+
+  modify("UPDATE % SET amount = 0 WHERE region = 1");
+  expect_view_matches_reference(min_max_template);
+}
+
+TEST_F(MaterializedViewTest, ModificationsWithinTransaction) {
+  auto sql = min_max_template;
+  Hyrise::get().storage_manager.add_materialized_view("mv", lqp_view(sql.replace(sql.find("%"), 1, "sales")));
+  const auto expected_table = execute("SELECT * FROM mv");
+
+  // The transaction sees its own modifications, other transactions do not
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO sales VALUES (3, 5)", transaction_context);
+  execute("DELETE FROM sales WHERE region = 0", transaction_context);
+  EXPECT_EQ(execute("SELECT * FROM mv", transaction_context)->row_count(), 3);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM mv"), expected_table);
+
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM mv"), expected_table);
+}
+
+TEST_F(MaterializedViewTest, Compact) {
+  auto sql = sum_template;
+  Hyrise::get().storage_manager.add_materialized_view("mv", lqp_view(sql.replace(sql.find("%"), 1, "sales")));
+
+  modify("INSERT INTO % VALUES (0, 100), (1, 5)");
+  modify("DELETE FROM % WHERE amount = 5");
+  EXPECT_GT(execute("SELECT * FROM mv__partials")->row_count(), 2);
+
+  EXPECT_TRUE(Hyrise::get().storage_manager.get_materialized_view("mv")->compact());
+  EXPECT_EQ(execute("SELECT * FROM mv__partials")->row_count(), 2);
+  expect_view_matches_reference(sum_template);
+}
+
+}  // namespace opossum
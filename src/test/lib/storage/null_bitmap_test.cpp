@@ -0,0 +1,119 @@
+#include <sstream>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/null_bitmap.hpp"
+
+namespace opossum {
+
+class NullBitmapTest : public BaseTest {};
+
+TEST_F(NullBitmapTest, Construction) {
+  EXPECT_TRUE(NullBitmap{}.empty());
+  EXPECT_EQ(NullBitmap(70).size(), 70);
+  EXPECT_EQ(NullBitmap(70).count(), 0);
+  EXPECT_EQ(NullBitmap(70, true).count(), 70);
+  EXPECT_EQ(NullBitmap(70, true).words().size(), 2);
+
+  const auto bools = pmr_vector<bool>{true, false, true};
+  const auto converted = NullBitmap(bools.begin(), bools.end());
+  EXPECT_EQ(converted, (NullBitmap{true, false, true}));
+  EXPECT_NE(converted, (NullBitmap{true, false, false}));
+  EXPECT_EQ(std::vector<bool>(converted.begin(), converted.end()), std::vector<bool>(bools.begin(), bools.end()));
+}
+
+TEST_F(NullBitmapTest, ReadAndWriteBits) {
+  auto bitmap = NullBitmap(130);
+  bitmap[0] = true;
+  bitmap[64] = true;
+  bitmap[129] = true;
+  EXPECT_TRUE(bitmap[0]);
+  EXPECT_FALSE(bitmap[1]);
+  EXPECT_TRUE(bitmap[64]);
+  EXPECT_TRUE(bitmap.back());
+  EXPECT_EQ(bitmap.count(), 3);
+
+  bitmap[64] = false;
+  EXPECT_FALSE(bitmap[64]);
+  EXPECT_EQ(bitmap.count(), 2);
+  EXPECT_THROW(bitmap.at(130), std::logic_error);
+}
+
+TEST_F(NullBitmapTest, ResizeKeepsPaddingCleared) {
+  auto bitmap = NullBitmap(60, true);
+  bitmap.resize(10);
+  EXPECT_EQ(bitmap.count(), 10);
+
+  // Growing must not resurrect the bits that were cut off
+  bitmap.resize(100);
+  EXPECT_EQ(bitmap.count(), 10);
+
+  bitmap.resize(140, true);
+  EXPECT_EQ(bitmap.count(), 50);
+  EXPECT_FALSE(bitmap[99]);
+  EXPECT_TRUE(bitmap[100]);
+
+  for (auto index = size_t{0}; index < 70; ++index) {
+    bitmap.push_back(index % 2 == 0);
+  }
+  EXPECT_EQ(bitmap.size(), 210);
+  EXPECT_EQ(bitmap.count(), 85);
+}
+
+TEST_F(NullBitmapTest, CombineWords) {
+  auto left = NullBitmap(100);
+  auto right = NullBitmap(100);
+  left[3] = true;
+  left[70] = true;
+  right[70] = true;
+  right[99] = true;
+
+  auto disjunction = left;
+  disjunction |= right;
+  EXPECT_EQ(disjunction.count(), 3);
+  EXPECT_TRUE(disjunction[3] && disjunction[70] && disjunction[99]);
+
+  auto conjunction = left;
+  conjunction &= right;
+  EXPECT_EQ(conjunction.count(), 1);
+  EXPECT_TRUE(conjunction[70]);
+}
+
+TEST_F(NullBitmapTest, FindNext) {
+  auto bitmap = NullBitmap(200);
+  EXPECT_TRUE(bitmap.none());
+  EXPECT_EQ(bitmap.find_next(0), 200);
+
+  bitmap[5] = true;
+  bitmap[150] = true;
+  EXPECT_TRUE(bitmap.any());
+  EXPECT_EQ(bitmap.find_next(0), 5);
+  EXPECT_EQ(bitmap.find_next(5), 5);
+  EXPECT_EQ(bitmap.find_next(6), 150);
+  EXPECT_EQ(bitmap.find_next(151), 200);
+  EXPECT_EQ(bitmap.find_next(300), 200);
+}
+
+TEST_F(NullBitmapTest, SetRange) {
+  auto source = NullBitmap(100);
+  source[10] = true;
+  source[70] = true;
+  source[90] = true;
+
+  auto target = NullBitmap(80);
+  target[0] = true;
+  target.set_range(5, source, 10, 70);
+  EXPECT_EQ(target.count(), 3);
+  EXPECT_TRUE(target[0]);
+  EXPECT_TRUE(target[5]);
+  EXPECT_TRUE(target[65]);
+}
+
+TEST_F(NullBitmapTest, Print) {
+  auto stream = std::stringstream{};
+  stream << NullBitmap{false, true};
+  EXPECT_EQ(stream.str(), "[0, 1]");
+}
+
+}  // namespace opossum
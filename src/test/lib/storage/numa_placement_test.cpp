@@ -0,0 +1,72 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/huge_page_memory_resource.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class NUMAPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().topology.use_fake_numa_topology(2, 1);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+    _table = load_table("resources/test_data/tbl/int_float6.tbl", ChunkOffset{1});
+  }
+
+  void TearDown() override { Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>()); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(NUMAPlacementTest, Partitioned) {
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->numa_node_id(), INVALID_NODE_ID);
+
+  place_chunks_on_numa_nodes(_table, NUMAPlacementStrategy::Partitioned);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->numa_node_id(), NodeID{1});
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->numa_node_id(), NodeID{1});
+
+  EXPECT_TABLE_EQ_ORDERED(_table, load_table("resources/test_data/tbl/int_float6.tbl"));
+}
+
+TEST_F(NUMAPlacementTest, Interleaved) {
+  place_chunks_on_numa_nodes(_table, NUMAPlacementStrategy::Interleaved);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->numa_node_id(), NodeID{1});
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->numa_node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->numa_node_id(), NodeID{1});
+
+  EXPECT_TABLE_EQ_ORDERED(_table, load_table("resources/test_data/tbl/int_float6.tbl"));
+}
+
+TEST_F(NUMAPlacementTest, ReferencedChunk) {
+  place_chunks_on_numa_nodes(_table, NUMAPlacementStrategy::Interleaved);
+
+  // A chunk that references a single chunk is located on that chunk's node
+  const auto pos_list = std::make_shared<EntireChunkPosList>(ChunkID{3}, ChunkOffset{1});
+  const auto segments = Segments{std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list),
+                                 std::make_shared<ReferenceSegment>(_table, ColumnID{1}, pos_list)};
+  EXPECT_EQ(std::make_shared<Chunk>(segments)->numa_node_id(), NodeID{1});
+}
+
+TEST_F(NUMAPlacementTest, HugePages) {
+  place_chunks_on_huge_pages(_table);
+
+  const auto* const memory_resource = &HugePageMemoryResource::get(HugePageAllocationClass::Segments);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->get_allocator().resource(), memory_resource);
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(_table, load_table("resources/test_data/tbl/int_float6.tbl"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include "base_test.hpp"
+#include "storage/pos_lists/cartesian_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace opossum {
+
+class CartesianPosListTest : public BaseTest {};
+
+TEST_F(CartesianPosListTest, RepeatPositionsOfChunk) {
+  const auto pos_list = CartesianPosList{nullptr, ChunkID{3}, ChunkOffset{2}, 3, 1};
+
+  EXPECT_EQ(pos_list.size(), 6);
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_TRUE(pos_list.is_sorted());
+
+  const auto expected_positions = std::vector<RowID>{{ChunkID{3}, ChunkOffset{0}}, {ChunkID{3}, ChunkOffset{0}},
+                                                     {ChunkID{3}, ChunkOffset{0}}, {ChunkID{3}, ChunkOffset{1}},
+                                                     {ChunkID{3}, ChunkOffset{1}}, {ChunkID{3}, ChunkOffset{1}}};
+  EXPECT_EQ(std::vector<RowID>(pos_list.begin(), pos_list.end()), expected_positions);
+}
+
+TEST_F(CartesianPosListTest, RepeatSequenceOfInputPosList) {
+  const auto input_pos_list = std::make_shared<RowIDPosList>();
+  input_pos_list->emplace_back(RowID{ChunkID{1}, ChunkOffset{4}});
+  input_pos_list->emplace_back(NULL_ROW_ID);
+  input_pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{2}});
+
+  const auto pos_list = CartesianPosList{input_pos_list, INVALID_CHUNK_ID, ChunkOffset{3}, 1, 2};
+
+  EXPECT_EQ(pos_list.size(), 6);
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.is_sorted());
+
+  const auto expected_positions =
+      std::vector<RowID>{{ChunkID{1}, ChunkOffset{4}}, NULL_ROW_ID, {ChunkID{0}, ChunkOffset{2}},
+                         {ChunkID{1}, ChunkOffset{4}}, NULL_ROW_ID, {ChunkID{0}, ChunkOffset{2}}};
+  EXPECT_EQ(std::vector<RowID>(pos_list.begin(), pos_list.end()), expected_positions);
+}
+
+TEST_F(CartesianPosListTest, Sortedness) {
+  const auto input_pos_list = std::make_shared<RowIDPosList>();
+  input_pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{1}});
+  input_pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{2}});
+  input_pos_list->guarantee_single_chunk();
+  input_pos_list->guarantee_sorted();
+
+  EXPECT_TRUE((CartesianPosList{input_pos_list, INVALID_CHUNK_ID, ChunkOffset{2}, 5, 1}.is_sorted()));
+  EXPECT_FALSE((CartesianPosList{input_pos_list, INVALID_CHUNK_ID, ChunkOffset{2}, 1, 5}.is_sorted()));
+  EXPECT_TRUE((CartesianPosList{nullptr, ChunkID{0}, ChunkOffset{1}, 1, 5}.is_sorted()));
+  EXPECT_TRUE((CartesianPosList{input_pos_list, INVALID_CHUNK_ID, ChunkOffset{2}, 1, 5}.references_single_chunk()));
+  EXPECT_EQ((CartesianPosList{input_pos_list, INVALID_CHUNK_ID, ChunkOffset{2}, 1, 5}.common_chunk_id()), ChunkID{0});
+}
+
+TEST_F(CartesianPosListTest, Empty) {
+  EXPECT_TRUE((CartesianPosList{nullptr, ChunkID{0}, ChunkOffset{0}, 4, 1}.empty()));
+  EXPECT_TRUE((CartesianPosList{nullptr, ChunkID{0}, ChunkOffset{4}, 1, 0}.empty()));
+}
+
+}  // namespace opossum
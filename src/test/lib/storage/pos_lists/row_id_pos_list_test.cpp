@@ -0,0 +1,48 @@
+#include "base_test.hpp"
+
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
+
+namespace opossum {
+
+class RowIDPosListTest : public BaseTest {};
+
+TEST_F(RowIDPosListTest, SortedGuarantee) {
+  auto pos_list = RowIDPosList{RowID{ChunkID{0}, 3}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}};
+  EXPECT_FALSE(pos_list.is_sorted());
+
+  pos_list.guarantee_sorted();
+  EXPECT_TRUE(pos_list.is_sorted());
+  EXPECT_FALSE(pos_list.references_single_chunk());
+
+  // The guarantee is kept when the list is moved
+  const auto moved_pos_list = RowIDPosList{std::move(pos_list)};
+  EXPECT_TRUE(moved_pos_list.is_sorted());
+
+  EXPECT_TRUE(EntireChunkPosList(ChunkID{0}, 3).is_sorted());
+}
+
+TEST_F(RowIDPosListTest, SplitSortedPosList) {
+  auto pos_list = std::make_shared<RowIDPosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 4}, RowID{ChunkID{2}, 0}, RowID{ChunkID{2}, 1}, RowID{ChunkID{2}, 5}});
+  pos_list->guarantee_sorted();
+
+  const auto pos_lists_by_chunk_id = split_pos_list_by_chunk_id(pos_list, 3);
+  ASSERT_EQ(pos_lists_by_chunk_id.size(), 3);
+
+  EXPECT_EQ(*pos_lists_by_chunk_id[0].row_ids, RowIDPosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 4}}));
+  EXPECT_EQ(pos_lists_by_chunk_id[0].original_positions, std::vector<ChunkOffset>({0, 1}));
+  EXPECT_TRUE(pos_lists_by_chunk_id[1].row_ids->empty());
+  EXPECT_TRUE(pos_lists_by_chunk_id[1].original_positions.empty());
+  EXPECT_EQ(*pos_lists_by_chunk_id[2].row_ids,
+            RowIDPosList({RowID{ChunkID{2}, 0}, RowID{ChunkID{2}, 1}, RowID{ChunkID{2}, 5}}));
+  EXPECT_EQ(pos_lists_by_chunk_id[2].original_positions, std::vector<ChunkOffset>({2, 3, 4}));
+
+  for (const auto& sub_pos_list : pos_lists_by_chunk_id) {
+    EXPECT_TRUE(sub_pos_list.row_ids->references_single_chunk());
+    EXPECT_TRUE(sub_pos_list.row_ids->is_sorted());
+  }
+}
+
+}  // namespace opossum
@@ -15,6 +15,7 @@
 #include "operators/table_scan.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_iterable.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -104,6 +105,27 @@ TEST_F(ReferenceSegmentTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_segment[3], segment[2]);
 }
 
+TEST_F(ReferenceSegmentTest, IteratesSortedPositionsFromChunks) {
+  // RowIDPosList with (0, 1), (0, 2), (1, 0), (1, 1), which is iterated sequentially chunk by chunk
+  auto pos_list = std::make_shared<RowIDPosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 1}}));
+  pos_list->guarantee_sorted();
+  const auto ref_segment = ReferenceSegment(_test_table, ColumnID{0}, pos_list);
+
+  auto values = std::vector<int32_t>{};
+  auto nulls = std::vector<bool>{};
+  auto offsets = std::vector<ChunkOffset>{};
+  ReferenceSegmentIterable<int32_t, EraseReferencedSegmentType::No>{ref_segment}.for_each([&](const auto& position) {
+    values.emplace_back(position.is_null() ? 0 : position.value());
+    nulls.emplace_back(position.is_null());
+    offsets.emplace_back(position.chunk_offset());
+  });
+
+  EXPECT_EQ(values, std::vector<int32_t>({1234, 12345, 0, 12345}));
+  EXPECT_EQ(nulls, std::vector<bool>({false, false, true, false}));
+  EXPECT_EQ(offsets, std::vector<ChunkOffset>({0, 1, 2, 3}));
+}
+
 TEST_F(ReferenceSegmentTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
@@ -0,0 +1,174 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/row_group_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRowGroupSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    row_group = std::make_shared<RowGroup>(std::vector<DataType>{DataType::Int, DataType::String, DataType::Double},
+                                           ChunkOffset{10});
+    int_segment = std::make_shared<RowGroupSegment<int32_t>>(row_group, ColumnID{0}, false);
+    string_segment = std::make_shared<RowGroupSegment<pmr_string>>(row_group, ColumnID{1}, true);
+    double_segment = std::make_shared<RowGroupSegment<double>>(row_group, ColumnID{2}, true);
+
+    table_column_definitions.emplace_back("a", DataType::Int, false);
+    table_column_definitions.emplace_back("b", DataType::String, true);
+    table_column_definitions.emplace_back("c", DataType::Float, false);
+  }
+
+  std::shared_ptr<RowGroup> row_group;
+  std::shared_ptr<RowGroupSegment<int32_t>> int_segment;
+  std::shared_ptr<RowGroupSegment<pmr_string>> string_segment;
+  std::shared_ptr<RowGroupSegment<double>> double_segment;
+
+  TableColumnDefinitions table_column_definitions;
+};
+
+TEST_F(StorageRowGroupSegmentTest, Layout) {
+  // The int is followed by padding so that the string is aligned, the double follows the string
+  EXPECT_EQ(row_group->row_width(), 8 + sizeof(pmr_string) + 8);
+  EXPECT_EQ(row_group->column_begin(ColumnID{1}) - row_group->column_begin(ColumnID{0}), 8);
+  EXPECT_EQ(row_group->capacity(), 10);
+}
+
+TEST_F(StorageRowGroupSegmentTest, AppendAndRetrieve) {
+  int_segment->append(3);
+  string_segment->append("Hello");
+  double_segment->append(NULL_VALUE);
+
+  int_segment->append(4);
+  string_segment->append(NULL_VALUE);
+  double_segment->append(2.5);
+
+  EXPECT_EQ(int_segment->size(), 2);
+  EXPECT_EQ(string_segment->size(), 2);
+
+  EXPECT_EQ(int_segment->get_typed_value(0), 3);
+  EXPECT_EQ(int_segment->value(1), 4);
+  EXPECT_EQ(string_segment->get_typed_value(0), "Hello");
+  EXPECT_EQ(string_segment->get_typed_value(1), std::nullopt);
+  EXPECT_TRUE(string_segment->is_null(1));
+  EXPECT_EQ((*double_segment)[0], NULL_VALUE);
+  EXPECT_EQ((*double_segment)[1], AllTypeVariant{2.5});
+
+  EXPECT_THROW(int_segment->append(NULL_VALUE), std::exception);
+}
+
+TEST_F(StorageRowGroupSegmentTest, AppendBeyondCapacity) {
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    int_segment->append(value);
+  }
+  EXPECT_THROW(int_segment->append(10), std::exception);
+}
+
+TEST_F(StorageRowGroupSegmentTest, IterableAndAccessor) {
+  string_segment->append("a");
+  string_segment->append(NULL_VALUE);
+  string_segment->append("c");
+
+  auto values = std::vector<std::optional<pmr_string>>{};
+  segment_iterate<pmr_string>(*string_segment, [&](const auto& position) {
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<pmr_string>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<pmr_string>>{"a", std::nullopt, "c"}));
+
+  const auto position_filter = std::make_shared<RowIDPosList>(RowIDPosList{{ChunkID{0}, 2}, {ChunkID{0}, 0}});
+  position_filter->guarantee_single_chunk();
+  values.clear();
+  segment_iterate_filtered<pmr_string>(*string_segment, position_filter, [&](const auto& position) {
+    values.emplace_back(position.value());
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<pmr_string>>{"c", "a"}));
+
+  const auto accessor = create_segment_accessor<pmr_string>(string_segment);
+  EXPECT_EQ(accessor->access(0), "a");
+  EXPECT_EQ(accessor->access(1), std::nullopt);
+}
+
+TEST_F(StorageRowGroupSegmentTest, CopyUsingAllocator) {
+  double_segment->append(1.5);
+  double_segment->append(NULL_VALUE);
+
+  const auto copy = std::dynamic_pointer_cast<ValueSegment<double>>(double_segment->copy_using_allocator({}));
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->values()[0], 1.5);
+  EXPECT_TRUE(copy->is_null(1));
+}
+
+TEST_F(StorageRowGroupSegmentTest, TableColumnGroups) {
+  const auto table = std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  EXPECT_THROW(table->set_column_groups({{ColumnID{0}, ColumnID{2}}, {ColumnID{2}}}), std::exception);
+  table->set_column_groups({{ColumnID{0}, ColumnID{2}}});
+
+  table->append({1, "one", 1.0f});
+  table->append({2, NULL_VALUE, 2.0f});
+  table->append({3, "three", 3.0f});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto a_segment = std::dynamic_pointer_cast<RowGroupSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  const auto c_segment = std::dynamic_pointer_cast<RowGroupSegment<float>>(chunk->get_segment(ColumnID{2}));
+  ASSERT_TRUE(a_segment);
+  ASSERT_TRUE(c_segment);
+  EXPECT_EQ(a_segment->row_group(), c_segment->row_group());
+  EXPECT_EQ(c_segment->group_column_id(), ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<pmr_string>>(chunk->get_segment(ColumnID{1})));
+
+  EXPECT_EQ(table->get_value<float>(ColumnID{2}, 2), 3.0f);
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 1), std::nullopt);
+
+  // Encoding the chunk replaces the row groups with columnar segments, also if no encoding is requested. The first
+  // chunk was finalized by the append of the third row.
+  ChunkEncoder::encode_chunk(chunk, table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 1), 2);
+
+  const auto second_chunk = table->get_chunk(ChunkID{1});
+  second_chunk->finalize();
+  ChunkEncoder::encode_chunk(second_chunk, table->column_data_types(), SegmentEncodingSpec{EncodingType::Unencoded});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<float>>(second_chunk->get_segment(ColumnID{2})));
+  EXPECT_EQ(table->get_value<float>(ColumnID{2}, 2), 3.0f);
+}
+
+TEST_F(StorageRowGroupSegmentTest, Insert) {
+  const auto table = std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->set_column_groups({{ColumnID{0}, ColumnID{1}, ColumnID{2}}});
+  Hyrise::get().storage_manager.add_table("row_group_table", table);
+
+  const auto values_table = std::make_shared<Table>(table_column_definitions, TableType::Data);
+  values_table->append({1, "one", 1.0f});
+  values_table->append({2, NULL_VALUE, 2.0f});
+  values_table->append({3, "three", 3.0f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("row_group_table", table_wrapper);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(table->chunk_count(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RowGroupSegment<pmr_string>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{1})));
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 0), "one");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 1), std::nullopt);
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 2), "three");
+  EXPECT_EQ(table->get_value<float>(ColumnID{2}, 2), 3.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_encoding_advisor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentEncodingAdvisorTest : public BaseTest {
+ protected:
+  // Sorted values with long runs, i.e., [0, 0, ..., 1, 1, ..., 9]
+  static std::shared_ptr<ValueSegment<int32_t>> _create_sorted_segment() {
+    auto values = pmr_vector<int32_t>(10'000);
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      values[index] = static_cast<int32_t>(index / 1'000);
+    }
+    return std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  }
+};
+
+TEST_F(SegmentEncodingAdvisorTest, PrefersRunLengthForLongRunsWhenOptimizingForMemory) {
+  const auto spec = SegmentEncodingAdvisor::advise_segment(_create_sorted_segment(), DataType::Int, 0.9);
+  EXPECT_EQ(spec.encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, PrefersDictionaryWhenOptimizingForScanSpeed) {
+  EXPECT_EQ(SegmentEncodingAdvisor::advise_segment(_create_sorted_segment(), DataType::Int, 0.0).encoding_type,
+            EncodingType::Dictionary);
+
+  auto strings = pmr_vector<pmr_string>{};
+  for (auto index = 0; index < 100; ++index) {
+    strings.emplace_back("value_" + std::to_string(index % 7));
+  }
+  const auto string_segment = std::make_shared<ValueSegment<pmr_string>>(std::move(strings));
+  EXPECT_EQ(SegmentEncodingAdvisor::advise_segment(string_segment, DataType::String, 0.0).encoding_type,
+            EncodingType::Dictionary);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, AdvisesEveryColumnOfAChunk) {
+  auto strings = pmr_vector<pmr_string>(10'000, pmr_string{"hyrise"});
+  const auto chunk = std::make_shared<Chunk>(
+      Segments{_create_sorted_segment(), std::make_shared<ValueSegment<pmr_string>>(std::move(strings))});
+
+  const auto chunk_encoding_spec =
+      SegmentEncodingAdvisor::advise_chunk(chunk, std::vector<DataType>{DataType::Int, DataType::String}, 0.9);
+  ASSERT_EQ(chunk_encoding_spec.size(), 2);
+  EXPECT_EQ(chunk_encoding_spec[0].encoding_type, EncodingType::RunLength);
+  EXPECT_NE(chunk_encoding_spec[1].encoding_type, EncodingType::Unencoded);
+}
+
+TEST_F(SegmentEncodingAdvisorTest, RejectsInvalidMemoryWeight) {
+  EXPECT_THROW(SegmentEncodingAdvisor::advise_segment(_create_sorted_segment(), DataType::Int, 1.5), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_gather.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SegmentGatherTest : public BaseTestWithParam<SegmentEncodingSpec> {
+ protected:
+  void SetUp() override {
+    // Large enough for the segments to span several LZ4 blocks and SIMD-BP128 meta blocks
+    auto values = pmr_vector<int32_t>(VALUE_COUNT);
+    auto null_values = pmr_vector<bool>(VALUE_COUNT);
+    for (auto index = uint32_t{0}; index < VALUE_COUNT; ++index) {
+      values[index] = static_cast<int32_t>(index % 1'000);
+      null_values[index] = index % 7 == 0;
+    }
+    const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), null_values);
+    segment = ChunkEncoder::encode_segment(value_segment, DataType::Int, GetParam());
+
+    table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    table->append_chunk({segment});
+    table->append_chunk({ChunkEncoder::encode_segment(value_segment, DataType::Int, GetParam())});
+
+    // Random offsets, i.e., unsorted ones that access the blocks of the segment in random order
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<uint32_t>{0, VALUE_COUNT - 1};
+    chunk_offsets.resize(5'000);
+    for (auto& chunk_offset : chunk_offsets) {
+      chunk_offset = ChunkOffset{distribution(generator)};
+    }
+  }
+
+  static constexpr auto VALUE_COUNT = uint32_t{20'000};
+
+  std::shared_ptr<AbstractSegment> segment;
+  std::shared_ptr<Table> table;
+  std::vector<ChunkOffset> chunk_offsets;
+};
+
+TEST_P(SegmentGatherTest, UnsortedPositions) {
+  const auto positions = std::make_shared<RowIDPosList>();
+  for (const auto chunk_offset : chunk_offsets) {
+    positions->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  positions->guarantee_single_chunk();
+
+  auto values = pmr_vector<int32_t>{};
+  auto null_values = NullBitmap{};
+  segment_gather<int32_t>(*segment, positions, values, null_values);
+  ASSERT_EQ(values.size(), chunk_offsets.size());
+  ASSERT_EQ(null_values.size(), chunk_offsets.size());
+
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    const auto expected_value = (*segment)[chunk_offsets[index]];
+    EXPECT_EQ(null_values[index], variant_is_null(expected_value));
+    if (!null_values[index]) EXPECT_EQ(values[index], boost::get<int32_t>(expected_value));
+  }
+}
+
+TEST_P(SegmentGatherTest, EntireSegment) {
+  auto values = pmr_vector<int32_t>{};
+  auto null_values = NullBitmap{};
+  segment_gather<int32_t>(*segment, std::make_shared<EntireChunkPosList>(ChunkID{0}, VALUE_COUNT), values,
+                          null_values);
+  ASSERT_EQ(values.size(), VALUE_COUNT);
+
+  EXPECT_TRUE(null_values[0]);
+  EXPECT_EQ(values[1], 1);
+  EXPECT_TRUE(null_values[VALUE_COUNT - 1]);
+  EXPECT_EQ(values[VALUE_COUNT - 2], 998);
+}
+
+TEST_P(SegmentGatherTest, ReferenceSegmentAcrossChunks) {
+  // Positions alternate between both chunks and contain NULL references
+  const auto pos_list = std::make_shared<RowIDPosList>();
+  for (const auto chunk_offset : chunk_offsets) {
+    const auto offset = static_cast<uint32_t>(chunk_offset);
+    pos_list->emplace_back(RowID{ChunkID{offset % 2}, chunk_offset});
+    if (offset % 5 == 0) pos_list->emplace_back(NULL_ROW_ID);
+  }
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  // Gather every other position of the ReferenceSegment
+  const auto positions = std::make_shared<RowIDPosList>();
+  for (auto offset = uint32_t{0}; offset < pos_list->size(); offset += 2) {
+    positions->emplace_back(RowID{ChunkID{0}, ChunkOffset{offset}});
+  }
+
+  auto values = pmr_vector<int32_t>{};
+  auto null_values = NullBitmap{};
+  segment_gather<int32_t>(reference_segment, positions, values, null_values);
+  ASSERT_EQ(values.size(), positions->size());
+
+  for (auto index = size_t{0}; index < positions->size(); ++index) {
+    const auto expected_value = reference_segment[(*positions)[index].chunk_offset];
+    EXPECT_EQ(null_values[index], variant_is_null(expected_value));
+    if (!null_values[index]) EXPECT_EQ(values[index], boost::get<int32_t>(expected_value));
+  }
+
+  // Iterating the ReferenceSegment gathers its values if it references LZ4 or SIMD-BP128 segments
+  auto row_count = ChunkOffset{0};
+  segment_iterate<int32_t>(reference_segment, [&](const auto& position) {
+    ASSERT_EQ(position.chunk_offset(), row_count);
+    const auto expected_value = reference_segment[row_count];
+    EXPECT_EQ(position.is_null(), variant_is_null(expected_value));
+    if (!position.is_null()) EXPECT_EQ(position.value(), boost::get<int32_t>(expected_value));
+    ++row_count;
+  });
+  EXPECT_EQ(row_count, pos_list->size());
+}
+
+auto segment_gather_test_formatter = [](const ::testing::TestParamInfo<SegmentEncodingSpec> info) {
+  const auto spec = info.param;
+
+  auto stream = std::stringstream{};
+  stream << spec.encoding_type;
+  if (spec.vector_compression_type) {
+    stream << "-" << *spec.vector_compression_type;
+  }
+
+  auto string = stream.str();
+  string.erase(std::remove_if(string.begin(), string.end(), [](char c) { return !std::isalnum(c); }), string.end());
+
+  return string;
+};
+
+INSTANTIATE_TEST_SUITE_P(SegmentGatherTestInstances, SegmentGatherTest,
+                         ::testing::Values(SegmentEncodingSpec{EncodingType::Unencoded},
+                                           SegmentEncodingSpec{EncodingType::LZ4},
+                                           SegmentEncodingSpec{EncodingType::Dictionary,
+                                                               VectorCompressionType::SimdBp128},
+                                           SegmentEncodingSpec{EncodingType::Dictionary,
+                                                               VectorCompressionType::FixedSizeByteAligned},
+                                           SegmentEncodingSpec{EncodingType::FrameOfReference,
+                                                               VectorCompressionType::SimdBp128}),
+                         segment_gather_test_formatter);
+
+}  // namespace opossum
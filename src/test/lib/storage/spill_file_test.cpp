@@ -0,0 +1,40 @@
+#include "base_test.hpp"
+
+#include "storage/spill_file.hpp"
+
+namespace opossum {
+
+class SpillFileTest : public BaseTest {};
+
+TEST_F(SpillFileTest, WriteAndRead) {
+  auto spill_file = SpillFile{std::filesystem::temp_directory_path()};
+
+  const auto first_values = std::vector<int32_t>{1, 2, 3};
+  const auto second_values = std::vector<double>{4.5, 6.5};
+  const auto first_range = spill_file.write_vector(first_values);
+  const auto second_range = spill_file.write_vector(second_values);
+  const auto empty_range = spill_file.write_vector(std::vector<int64_t>{});
+
+  EXPECT_EQ(first_range.offset, 0u);
+  EXPECT_EQ(first_range.size, 3 * sizeof(int32_t));
+  EXPECT_EQ(second_range.offset, 3 * sizeof(int32_t));
+  EXPECT_EQ(spill_file.size(), 3 * sizeof(int32_t) + 2 * sizeof(double));
+
+  auto read_second_values = std::vector<double>{};
+  spill_file.read_vector(second_range, read_second_values);
+  EXPECT_EQ(read_second_values, second_values);
+
+  auto read_first_values = std::vector<int32_t>{};
+  spill_file.read_vector(first_range, read_first_values);
+  EXPECT_EQ(read_first_values, first_values);
+
+  auto read_empty_values = std::vector<int64_t>{1};
+  spill_file.read_vector(empty_range, read_empty_values);
+  EXPECT_TRUE(read_empty_values.empty());
+}
+
+TEST_F(SpillFileTest, InvalidDirectory) {
+  EXPECT_THROW(SpillFile{"/this/directory/does/not/exist"}, std::logic_error);
+}
+
+}  // namespace opossum
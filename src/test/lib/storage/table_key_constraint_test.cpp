@@ -112,4 +112,53 @@ TEST_F(TableKeyConstraintTest, Equals) {
   EXPECT_FALSE(key_constraint_a == key_constraint_c);
 }
 
+TEST_F(TableKeyConstraintTest, AddForeignKeyConstraints) {
+  EXPECT_TRUE(_table->soft_foreign_key_constraints().empty());
+  _table->add_soft_foreign_key_constraint({{ColumnID{1}, ColumnID{0}}, "table_nullable", {ColumnID{0}, ColumnID{1}}});
+  ASSERT_EQ(_table->soft_foreign_key_constraints().size(), 1);
+
+  const auto& foreign_key_constraint = _table->soft_foreign_key_constraints().front();
+  EXPECT_EQ(foreign_key_constraint.foreign_key_columns(), std::vector<ColumnID>({ColumnID{1}, ColumnID{0}}));
+  EXPECT_EQ(foreign_key_constraint.referenced_table_name(), "table_nullable");
+  EXPECT_EQ(foreign_key_constraint.referenced_columns(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+
+  // Foreign key constraints with the same columns but a different mapping are different
+  _table->add_soft_foreign_key_constraint({{ColumnID{0}, ColumnID{1}}, "table_nullable", {ColumnID{0}, ColumnID{1}}});
+  EXPECT_EQ(_table->soft_foreign_key_constraints().size(), 2);
+
+  // Invalid, because the column id is out of range, the column counts differ, or the constraint already exists
+  EXPECT_THROW(_table->add_soft_foreign_key_constraint({{ColumnID{5}}, "table_nullable", {ColumnID{0}}}),
+               std::logic_error);
+  EXPECT_THROW(ForeignKeyConstraint({ColumnID{0}}, "table_nullable", {ColumnID{0}, ColumnID{1}}), std::logic_error);
+  EXPECT_THROW(_table->add_soft_foreign_key_constraint({{ColumnID{1}, ColumnID{0}}, "table_nullable",
+                                                         {ColumnID{0}, ColumnID{1}}}),
+               std::logic_error);
+}
+
+TEST_F(TableKeyConstraintTest, AddDiscoveredKeyConstraints) {
+  _table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE});
+  _table->append({1, 2, 3, 4});
+  _table->last_chunk()->finalize();
+
+  const auto version = _table->discovered_soft_key_constraints_version();
+  EXPECT_TRUE(_table->add_discovered_soft_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE}, version));
+  EXPECT_EQ(_table->discovered_soft_key_constraints().size(), 1);
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+
+  // Key constraints for the given column sets already exist
+  EXPECT_FALSE(_table->add_discovered_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE}, version));
+  EXPECT_FALSE(_table->add_discovered_soft_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE}, version));
+
+  // Only unique constraints are discovered
+  EXPECT_THROW(_table->add_discovered_soft_key_constraint({{ColumnID{2}}, KeyConstraintType::PRIMARY_KEY}, version),
+               std::logic_error);
+
+  // Appending a chunk drops the discovered constraints, and constraints validated before are rejected
+  _table->append({1, 2, 3, 4});
+  EXPECT_GT(_table->discovered_soft_key_constraints_version(), version);
+  EXPECT_TRUE(_table->discovered_soft_key_constraints().empty());
+  EXPECT_FALSE(_table->add_discovered_soft_key_constraint({{ColumnID{2}}, KeyConstraintType::UNIQUE}, version));
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+}
+
 }  // namespace opossum
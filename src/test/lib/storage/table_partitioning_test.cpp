@@ -0,0 +1,184 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TablePartitioningTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    column_definitions.emplace_back("day", DataType::Int, false);
+    column_definitions.emplace_back("event", DataType::String, true);
+  }
+
+  TableColumnDefinitions column_definitions;
+};
+
+TEST_F(TablePartitioningTest, RangePartitioning) {
+  const auto partitioning = TablePartitioning::range(ColumnID{0}, {0, 31, 59});
+  EXPECT_EQ(partitioning->type(), PartitioningType::Range);
+  EXPECT_EQ(partitioning->partition_count(), 2);
+  EXPECT_EQ(partitioning->data_type(), DataType::Int);
+
+  EXPECT_EQ(partitioning->partition_for(0), PartitionID{0});
+  EXPECT_EQ(partitioning->partition_for(30), PartitionID{0});
+  EXPECT_EQ(partitioning->partition_for(31), PartitionID{1});
+  EXPECT_THROW(partitioning->partition_for(59), std::exception);
+  EXPECT_THROW(partitioning->partition_for(-1), std::exception);
+  EXPECT_THROW(partitioning->partition_for(NULL_VALUE), std::exception);
+
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{0}, ColumnID{0}, PredicateCondition::Equals, 31));
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::Equals, 31));
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::LessThan, 31));
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::LessThanEquals, 31));
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{0}, ColumnID{0}, PredicateCondition::GreaterThan, 31));
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{0}, ColumnID{0}, PredicateCondition::GreaterThan, 29));
+  EXPECT_TRUE(
+      partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::BetweenInclusive, 0, 30));
+  EXPECT_TRUE(
+      partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::BetweenUpperExclusive, 0, 31));
+  EXPECT_FALSE(
+      partitioning->does_not_contain(PartitionID{1}, ColumnID{0}, PredicateCondition::BetweenInclusive, 0, 31));
+
+  // Predicates on other columns never rule out a partition
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{0}, ColumnID{1}, PredicateCondition::Equals, 31));
+
+  EXPECT_THROW(TablePartitioning::range(ColumnID{0}, {0, 0}), std::exception);
+  EXPECT_THROW(TablePartitioning::range(ColumnID{0}, {0, 1.5f}), std::exception);
+}
+
+TEST_F(TablePartitioningTest, ListPartitioning) {
+  const auto partitioning = TablePartitioning::list(ColumnID{1}, {{"click", "view"}, {"purchase"}});
+  EXPECT_EQ(partitioning->partition_count(), 2);
+
+  EXPECT_EQ(partitioning->partition_for("view"), PartitionID{0});
+  EXPECT_EQ(partitioning->partition_for("purchase"), PartitionID{1});
+  EXPECT_THROW(partitioning->partition_for("refund"), std::exception);
+
+  const auto purchase = AllTypeVariant{pmr_string{"purchase"}};
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{0}, ColumnID{1}, PredicateCondition::Equals, purchase));
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{1}, ColumnID{1}, PredicateCondition::NotEquals, purchase));
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{0}, ColumnID{1}, PredicateCondition::NotEquals, purchase));
+  EXPECT_TRUE(partitioning->does_not_contain(PartitionID{0}, ColumnID{1}, PredicateCondition::GreaterThan,
+                                             AllTypeVariant{pmr_string{"w"}}));
+  EXPECT_FALSE(partitioning->does_not_contain(PartitionID{0}, ColumnID{1}, PredicateCondition::Like,
+                                              AllTypeVariant{pmr_string{"%"}}));
+
+  EXPECT_THROW(TablePartitioning::list(ColumnID{1}, {{"click"}, {"click"}}), std::exception);
+}
+
+TEST_F(TablePartitioningTest, HashPartitioning) {
+  const auto partitioning = TablePartitioning::hash(ColumnID{0}, PartitionID{4});
+  EXPECT_EQ(partitioning->data_type(), std::nullopt);
+  EXPECT_EQ(partitioning->partition_for(NULL_VALUE), PartitionID{0});
+
+  const auto partition_id = partitioning->partition_for(17);
+  EXPECT_LT(partition_id, PartitionID{4});
+  for (auto other_partition_id = PartitionID{0}; other_partition_id < PartitionID{4}; ++other_partition_id) {
+    EXPECT_EQ(partitioning->does_not_contain(other_partition_id, ColumnID{0}, PredicateCondition::Equals, 17),
+              other_partition_id != partition_id);
+    EXPECT_FALSE(partitioning->does_not_contain(other_partition_id, ColumnID{0}, PredicateCondition::LessThan, 17));
+  }
+}
+
+TEST_F(TablePartitioningTest, Extends) {
+  const auto january = TablePartitioning::range(ColumnID{0}, {0, 31});
+  const auto february = TablePartitioning::range(ColumnID{0}, {0, 31, 59});
+  EXPECT_TRUE(february->extends(*january));
+  EXPECT_FALSE(january->extends(*february));
+  EXPECT_FALSE(TablePartitioning::range(ColumnID{0}, {1, 31, 59})->extends(*january));
+
+  const auto hash = TablePartitioning::hash(ColumnID{0}, PartitionID{2});
+  EXPECT_TRUE(hash->extends(*TablePartitioning::hash(ColumnID{0}, PartitionID{2})));
+  EXPECT_FALSE(hash->extends(*TablePartitioning::hash(ColumnID{0}, PartitionID{1})));
+}
+
+TEST_F(TablePartitioningTest, TableAppendAndDropPartition) {
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  EXPECT_THROW(table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0.0f, 31.0f})), std::exception);
+  table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0, 31}));
+
+  table->append({1, "view"});
+  EXPECT_THROW(table->append({40, "view"}), std::exception);
+
+  // The partitioning can only be extended once the table has chunks
+  EXPECT_THROW(table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0, 40})), std::exception);
+  table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0, 31, 59}));
+
+  table->append({40, "click"});
+  table->append({2, "click"});
+  table->append({3, NULL_VALUE});
+
+  // Day 40 is in the chunk of February, the chunk of January was full after day 2
+  ASSERT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->partition_id(), PartitionID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->partition_id(), PartitionID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->partition_id(), PartitionID{0});
+  EXPECT_EQ(table->last_chunk_id(PartitionID{0}), ChunkID{2});
+  EXPECT_EQ(table->last_chunk_id(PartitionID{1}), ChunkID{1});
+
+  table->drop_partition(PartitionID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{0}), nullptr);
+  EXPECT_EQ(table->get_chunk(ChunkID{2}), nullptr);
+  EXPECT_EQ(table->row_count(), 1);
+  EXPECT_EQ(table->last_chunk_id(PartitionID{0}), std::nullopt);
+
+  table->append({4, "view"});
+  EXPECT_EQ(table->last_chunk_id(PartitionID{0}), ChunkID{3});
+}
+
+TEST_F(TablePartitioningTest, InsertAndScan) {
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->set_partitioning(TablePartitioning::range(ColumnID{0}, {0, 31, 59}));
+  Hyrise::get().storage_manager.add_table("events", table);
+
+  const auto values_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_table->append({40, "click"});
+  values_table->append({1, "view"});
+  values_table->append({41, NULL_VALUE});
+  values_table->append({42, "purchase"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("events", table_wrapper);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // January gets one chunk, February two
+  ASSERT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->partition_id(), PartitionID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 1);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->partition_id(), PartitionID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->partition_id(), PartitionID{1});
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 0), "view");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 2), std::nullopt);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 3), 42);
+
+  // The scan skips the mutable chunks of February
+  const auto stored_table_wrapper = std::make_shared<TableWrapper>(table);
+  stored_table_wrapper->execute();
+  const auto day_column = pqp_column_(ColumnID{0}, DataType::Int, false, "day");
+  const auto scan =
+      std::make_shared<TableScan>(stored_table_wrapper, less_than_(day_column, placeholder_(ParameterID{0})));
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{10}}});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1);
+  EXPECT_EQ(dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data).num_chunks_with_early_out, 2u);
+}
+
+}  // namespace opossum
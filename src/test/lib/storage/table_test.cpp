@@ -6,6 +6,7 @@
 
 #include "base_test.hpp"
 
+#include "concurrency/epoch_manager.hpp"
 #include "resolve_type.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -20,7 +21,7 @@ class StorageTableTest : public BaseTest {
     t = std::make_shared<Table>(column_definitions, TableType::Data, 2);
   }
 
-  static tbb::concurrent_vector<std::shared_ptr<Chunk>, tbb::zero_allocator<std::shared_ptr<Chunk>>>& get_chunks(
+  static tbb::concurrent_vector<Table::ChunkSlot, tbb::zero_allocator<Table::ChunkSlot>>& get_chunks(
       std::shared_ptr<Table>& table) {
     return table->_chunks;
   }
@@ -46,6 +47,30 @@ TEST_F(StorageTableTest, GetChunk) {
   EXPECT_NE(t->get_chunk(ChunkID{1}), nullptr);
 }
 
+TEST_F(StorageTableTest, RemoveChunk) {
+  t->append({4, "Hello,"});
+  t->append({6, "world"});
+  t->append({3, "!"});
+  const auto chunk = t->get_chunk(ChunkID{0});
+  chunk->increase_invalid_row_count(chunk->size());
+
+  auto& epoch_manager = EpochManager::get();
+  {
+    // A reader that pinned its epoch before the removal might still copy the chunk, so it is not freed yet
+    const auto epoch_guard = epoch_manager.pin();
+    t->remove_chunk(ChunkID{0});
+    EXPECT_EQ(t->get_chunk(ChunkID{0}), nullptr);
+    EXPECT_EQ(epoch_manager.retired_count(), 1);
+  }
+
+  EXPECT_EQ(epoch_manager.reclaim(), 0);
+  EXPECT_EQ(t->chunk_count(), 2u);
+  EXPECT_NE(t->get_chunk(ChunkID{1}), nullptr);
+
+  // Readers that copied the chunk before keep it alive
+  EXPECT_EQ(chunk->size(), 2u);
+}
+
 TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t->column_count(), 2u); }
 
 TEST_F(StorageTableTest, RowCount) {
@@ -260,9 +285,9 @@ TEST_F(StorageTableTest, StableChunks) {
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1);
   table->append({100, "Hello"});
 
-  // The address of the first shared_ptr control object
+  // The address of the holder of the first chunk
   const auto& chunks_vector = get_chunks(table);
-  const auto first_chunk = &chunks_vector[0];
+  const auto first_chunk = chunks_vector[0].load();
 
   for (auto i = 1; i < 10; ++i) {
     table->append({i, "Hello"});
@@ -270,7 +295,7 @@ TEST_F(StorageTableTest, StableChunks) {
 
   // The vector should have been resized / expanded by now
 
-  EXPECT_EQ(first_chunk, &chunks_vector[0]);
+  EXPECT_EQ(first_chunk, chunks_vector[0].load());
   EXPECT_EQ((*(*first_chunk)->get_segment(ColumnID{0}))[0], AllTypeVariant{100});
 }
 
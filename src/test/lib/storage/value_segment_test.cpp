@@ -81,6 +81,20 @@ TEST_F(StorageValueSegmentTest, ArraySubscriptOperatorReturnsNullValue) {
   EXPECT_TRUE(variant_is_null(vs_double[0]));
 }
 
+TEST_F(StorageValueSegmentTest, SetNullValues) {
+  auto vs_nullable_int = ValueSegment<int>{true};
+  vs_nullable_int.resize(4);
+
+  const auto null_values = NullBitmap{true, false, true, true};
+  vs_nullable_int.set_null_values(ChunkOffset{1}, null_values, ChunkOffset{1}, ChunkOffset{3});
+  EXPECT_EQ(vs_nullable_int.null_values(), (NullBitmap{false, false, true, true}));
+
+  // Non-nullable segments only accept ranges without null values
+  vs_int.resize(4);
+  EXPECT_NO_THROW(vs_int.set_null_values(ChunkOffset{0}, null_values, ChunkOffset{1}, ChunkOffset{1}));
+  EXPECT_THROW(vs_int.set_null_values(ChunkOffset{0}, null_values, ChunkOffset{0}, ChunkOffset{2}), std::logic_error);
+}
+
 TEST_F(StorageValueSegmentTest, MemoryUsageEstimation) {
   /**
    * As ValueSegments are pre-allocated, their size should not change when inserting data, except for strings placed
@@ -110,4 +124,21 @@ TEST_F(StorageValueSegmentTest, MemoryUsageEstimation) {
   EXPECT_EQ(vs_str.memory_usage(MemoryUsageCalculationMode::Full), empty_usage_str + longer_str.capacity() + 1);
 }
 
+TEST_F(StorageValueSegmentTest, MemoryUsageOfStringsWrittenThroughValues) {
+  const auto longer_str = pmr_string{"HelloWorldHaveANiceDayWithSunshineAndGoodCofefe"};
+  auto values = pmr_vector<pmr_string>{pmr_string{"Hello"}, longer_str};
+  auto segment = ValueSegment<pmr_string>{std::move(values)};
+  const auto memory_usage = segment.memory_usage(MemoryUsageCalculationMode::Full);
+  EXPECT_EQ(memory_usage, ValueSegment<pmr_string>{pmr_vector<pmr_string>(2)}.memory_usage(
+                              MemoryUsageCalculationMode::Full) + longer_str.capacity() + 1);
+
+  // Strings that are written through values() are only counted once their range is passed to account_for_values()
+  segment.values()[0] = longer_str;
+  EXPECT_EQ(segment.memory_usage(MemoryUsageCalculationMode::Full), memory_usage);
+  segment.account_for_values(ChunkOffset{0}, ChunkOffset{1});
+  EXPECT_EQ(segment.memory_usage(MemoryUsageCalculationMode::Full), memory_usage + longer_str.capacity() + 1);
+  EXPECT_EQ(segment.memory_usage(MemoryUsageCalculationMode::Sampled),
+            segment.memory_usage(MemoryUsageCalculationMode::Full));
+}
+
 }  // namespace opossum
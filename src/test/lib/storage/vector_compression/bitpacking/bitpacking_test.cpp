@@ -0,0 +1,153 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "storage/vector_compression/bitpacking/bitpacking_compressor.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BitPackingTest : public BaseTest, public ::testing::WithParamInterface<uint8_t> {
+ protected:
+  void SetUp() override {
+    _bit_size = GetParam();
+    _min = static_cast<uint32_t>(1ul << (_bit_size - 1u));
+    _max = static_cast<uint32_t>((1ul << _bit_size) - 1u);
+  }
+
+  pmr_vector<uint32_t> generate_sequence(const size_t count) {
+    auto sequence = pmr_vector<uint32_t>(count);
+    auto value = _min;
+    for (auto& elem : sequence) {
+      elem = value;
+
+      value += 1u;
+      if (value > _max) value = _min;
+    }
+
+    return sequence;
+  }
+
+  std::unique_ptr<const BaseCompressedVector> compress(const pmr_vector<uint32_t>& vector) {
+    auto compressor = BitPackingCompressor{};
+    auto compressed_vector = compressor.compress(vector, vector.get_allocator());
+    EXPECT_EQ(compressed_vector->size(), vector.size());
+
+    return compressed_vector;
+  }
+
+  uint8_t _bit_size;
+  uint32_t _min;
+  uint32_t _max;
+};
+
+class BitPackingEdgeCaseTest : public BaseTest {};
+
+auto bitpacking_test_formatter = [](const ::testing::TestParamInfo<uint8_t> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_SUITE_P(BitSizes, BitPackingTest, ::testing::Range(uint8_t{1}, uint8_t{33}), bitpacking_test_formatter);
+
+TEST_P(BitPackingTest, UsesMinimalBitWidth) {
+  const auto sequence = generate_sequence(420);
+  const auto compressed_sequence_base = compress(sequence);
+  auto compressed_sequence = dynamic_cast<const BitPackingVector*>(compressed_sequence_base.get());
+  ASSERT_NE(compressed_sequence, nullptr);
+
+  EXPECT_EQ(compressed_sequence->bit_width(), _bit_size);
+  // Payload plus at most one partially filled word and the padding word
+  EXPECT_LE(compressed_sequence->data_size(), (420 * _bit_size) / 8 + 2 * sizeof(uint64_t));
+}
+
+TEST_P(BitPackingTest, DecompressSequenceUsingIterators) {
+  const auto sequence = generate_sequence(420);
+  const auto compressed_sequence_base = compress(sequence);
+  auto compressed_sequence = dynamic_cast<const BitPackingVector*>(compressed_sequence_base.get());
+  ASSERT_NE(compressed_sequence, nullptr);
+
+  auto seq_it = sequence.cbegin();
+  auto compressed_seq_it = compressed_sequence->cbegin();
+  const auto compressed_seq_end = compressed_sequence->cend();
+  for (; compressed_seq_it != compressed_seq_end; seq_it++, compressed_seq_it++) {
+    EXPECT_EQ(*seq_it, *compressed_seq_it);
+  }
+}
+
+TEST_P(BitPackingTest, DecompressSequenceUsingAdvance) {
+  const auto sequence = generate_sequence(1'000);
+  const auto compressed_sequence_base = compress(sequence);
+  auto compressed_sequence = dynamic_cast<const BitPackingVector*>(compressed_sequence_base.get());
+  ASSERT_NE(compressed_sequence, nullptr);
+
+  auto seq_it = sequence.cbegin();
+  auto compressed_seq_it = compressed_sequence->cbegin();
+  EXPECT_EQ(*seq_it, *compressed_seq_it);
+
+  seq_it += 63;
+  compressed_seq_it += 63;
+  EXPECT_EQ(*seq_it, *compressed_seq_it);
+
+  seq_it += 500;
+  compressed_seq_it += 500;
+  EXPECT_EQ(*seq_it, *compressed_seq_it);
+
+  seq_it -= 17;
+  compressed_seq_it -= 17;
+  EXPECT_EQ(*seq_it, *compressed_seq_it);
+
+  EXPECT_EQ(*(sequence.cend() - 1), *(compressed_sequence->cend() - 1));
+  EXPECT_EQ(compressed_sequence->cend() - compressed_sequence->cbegin(), 1'000);
+}
+
+TEST_P(BitPackingTest, DecompressSequenceUsingDecompressor) {
+  const auto sequence = generate_sequence(420);
+  const auto compressed_sequence = compress(sequence);
+
+  auto decompressor = compressed_sequence->create_base_decompressor();
+
+  // Access the values in reverse order, as the decompressor does not rely on sequential access
+  for (auto index = sequence.size(); index > 0; --index) {
+    EXPECT_EQ(sequence[index - 1], decompressor->get(index - 1));
+  }
+}
+
+TEST_P(BitPackingTest, CopyUsingAllocator) {
+  const auto sequence = generate_sequence(100);
+  const auto compressed_sequence = compress(sequence);
+  const auto copy = compressed_sequence->copy_using_allocator({});
+
+  EXPECT_EQ(copy->type(), CompressedVectorType::BitPacking);
+  EXPECT_EQ(copy->data_size(), compressed_sequence->data_size());
+
+  auto decompressor = copy->create_base_decompressor();
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    EXPECT_EQ(sequence[index], decompressor->get(index));
+  }
+}
+
+TEST_F(BitPackingEdgeCaseTest, CompressSequenceOfZeros) {
+  const auto sequence = pmr_vector<uint32_t>(200, 0u);
+  auto compressed_sequence_base = BitPackingCompressor{}.compress(sequence, sequence.get_allocator());
+  auto compressed_sequence = dynamic_cast<const BitPackingVector*>(compressed_sequence_base.get());
+  ASSERT_NE(compressed_sequence, nullptr);
+
+  EXPECT_EQ(compressed_sequence->bit_width(), 0u);
+  auto decompressor = compressed_sequence->create_base_decompressor();
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    EXPECT_EQ(decompressor->get(index), 0u);
+  }
+}
+
+TEST_F(BitPackingEdgeCaseTest, CompressEmptySequence) {
+  const auto sequence = pmr_vector<uint32_t>{};
+  auto compressed_sequence = BitPackingCompressor{}.compress(sequence, sequence.get_allocator());
+
+  EXPECT_EQ(compressed_sequence->size(), 0u);
+  auto decompressor = compressed_sequence->create_base_decompressor();
+  EXPECT_EQ(decompressor->size(), 0u);
+}
+
+}  // namespace opossum
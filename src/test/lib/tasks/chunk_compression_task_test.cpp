@@ -9,7 +9,10 @@
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/run_length_segment.hpp"
 #include "tasks/chunk_compression_task.hpp"
 
 namespace opossum {
@@ -111,4 +114,73 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, CompressionCreatesIndexes) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u, FinalizeLastChunk::No);
+  Hyrise::get().storage_manager.add_table("table_indexed", table);
+
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  table->create_index<GroupKeyIndex>(column_ids);
+
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, column_ids));
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_index(SegmentIndexType::GroupKey, column_ids));
+
+  table->get_chunk(ChunkID{1})->finalize();
+  auto compression =
+      std::make_shared<ChunkCompressionTask>("table_indexed", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}});
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression});
+
+  // The index of the re-encoded chunk is rebuilt, the previously mutable chunk receives its index
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto index = chunk->get_index(SegmentIndexType::GroupKey, column_ids);
+    ASSERT_TRUE(index);
+    const auto indexed_row_count =
+        std::distance(index->cbegin(), index->cend()) + std::distance(index->null_cbegin(), index->null_cend());
+    EXPECT_EQ(static_cast<ChunkOffset>(indexed_row_count), chunk->size());
+  }
+}
+
+TEST_F(ChunkCompressionTaskTest, CompressionWithEncodingAdvisor) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 10'000,
+                                       UseMvcc::Yes);
+  for (auto value = 0; value < 10'000; ++value) {
+    table->append({value / 1'000});
+  }
+  Hyrise::get().storage_manager.add_table("table_advised", table);
+
+  auto compression_task = std::make_shared<ChunkCompressionTask>("table_advised", ChunkID{0}, 0.9);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression_task});
+
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(segment));
+}
+
+TEST_F(ChunkCompressionTaskTest, CompressionUpdatesStatistics) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  Hyrise::get().storage_manager.add_table("table_insert", table);
+
+  auto get_table = std::make_shared<GetTable>("table_insert");
+  get_table->execute();
+  auto insert = std::make_shared<Insert>("table_insert", get_table);
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 4u);
+  EXPECT_EQ(table->table_statistics()->row_count, 12);
+  EXPECT_FLOAT_EQ(table->table_statistics()->staleness(*table), 0.5f);
+
+  table->get_chunk(ChunkID{2})->finalize();
+  table->get_chunk(ChunkID{3})->finalize();
+
+  auto compression = std::make_shared<ChunkCompressionTask>(
+      "table_insert", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}});
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression});
+
+  EXPECT_EQ(table->table_statistics()->row_count, 24);
+  EXPECT_FLOAT_EQ(table->table_statistics()->staleness(*table), 0.0f);
+}
+
 }  // namespace opossum
@@ -0,0 +1,89 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "utils/async_file_writer.hpp"
+
+namespace opossum {
+
+class AsyncFileWriterTest : public BaseTest {
+ protected:
+  void SetUp() override { std::remove(filename.c_str()); }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  std::string read_file() const {
+    auto file = std::ifstream{filename, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  const std::string filename = test_data_path + "async_file_writer_test.bin";
+};
+
+TEST_F(AsyncFileWriterTest, WritesFileContent) {
+  // Larger than all buffers together, so that writes are in flight while further buffers are filled
+  auto expected_content = std::string{};
+  while (expected_content.size() < (AsyncFileWriter::MAX_WRITES_IN_FLIGHT + 2) * AsyncFileWriter::BUFFER_SIZE) {
+    expected_content += "row " + std::to_string(expected_content.size()) + '\n';
+  }
+
+  {
+    auto writer = AsyncFileWriter{filename};
+    auto ostream = std::ostream{&writer};
+    ostream.exceptions(std::ostream::failbit | std::ostream::badbit);
+
+    ostream << 'h';
+    ostream.write(expected_content.data() + 1, 1'000);
+    EXPECT_EQ(ostream.tellp(), 1'001);
+    ostream.flush();
+    ostream.write(expected_content.data() + 1'001, static_cast<std::streamsize>(expected_content.size() - 1'001));
+    EXPECT_EQ(ostream.tellp(), expected_content.size());
+    writer.close();
+  }
+
+  expected_content[0] = 'h';
+  EXPECT_EQ(read_file(), expected_content);
+}
+
+TEST_F(AsyncFileWriterTest, SeekOverwritesWrittenBytes) {
+  {
+    auto writer = AsyncFileWriter{filename};
+    auto ostream = std::ostream{&writer};
+    ostream.exceptions(std::ostream::failbit | std::ostream::badbit);
+
+    ostream << "0000 index";
+    const auto body_position = ostream.tellp();
+    ostream << std::string(AsyncFileWriter::BUFFER_SIZE, 'x');
+    ostream.seekp(0);
+    ostream << "1234";
+    EXPECT_EQ(ostream.tellp(), 4);
+    ostream.seekp(body_position);
+    ostream << " body";
+    writer.close();
+  }
+
+  const auto content = read_file();
+  ASSERT_EQ(content.size(), 10 + AsyncFileWriter::BUFFER_SIZE);
+  EXPECT_EQ(content.substr(0, 15), "1234 index body");
+  EXPECT_EQ(content.back(), 'x');
+}
+
+TEST_F(AsyncFileWriterTest, DestructorCompletesWrites) {
+  {
+    auto writer = AsyncFileWriter{filename};
+    auto ostream = std::ostream{&writer};
+    ostream << "hyrise";
+  }
+
+  EXPECT_EQ(read_file(), "hyrise");
+}
+
+TEST_F(AsyncFileWriterTest, DirectoryDoesNotExist) {
+  EXPECT_THROW(AsyncFileWriter{"not_existing_directory/file"}, std::logic_error);
+}
+
+}  // namespace opossum
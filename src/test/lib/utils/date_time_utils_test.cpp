@@ -0,0 +1,63 @@
+#include "base_test.hpp"
+
+#include "utils/date_time_utils.hpp"
+
+namespace opossum {
+
+class DateTimeUtilsTest : public BaseTest {};
+
+TEST_F(DateTimeUtilsTest, CivilDateConversion) {
+  EXPECT_EQ(days_from_civil({1970, 1, 1}), 0);
+  EXPECT_EQ(days_from_civil({1969, 12, 31}), -1);
+  EXPECT_EQ(days_from_civil({1992, 1, 1}), 8035);
+  EXPECT_EQ(days_from_civil({2000, 3, 1}), 11'017);
+
+  EXPECT_EQ(civil_from_days(0), (CivilDate{1970, 1, 1}));
+  EXPECT_EQ(civil_from_days(-1), (CivilDate{1969, 12, 31}));
+  EXPECT_EQ(civil_from_days(11'016), (CivilDate{2000, 2, 29}));
+
+  // The conversions are inverse to each other
+  for (auto days = int32_t{-800'000}; days < 800'000; days += 97) {
+    EXPECT_EQ(days_from_civil(civil_from_days(days)), days);
+  }
+}
+
+TEST_F(DateTimeUtilsTest, DaysFromTimestamp) {
+  EXPECT_EQ(days_from_timestamp(0), 0);
+  EXPECT_EQ(days_from_timestamp(SECONDS_PER_DAY - 1), 0);
+  EXPECT_EQ(days_from_timestamp(SECONDS_PER_DAY), 1);
+  EXPECT_EQ(days_from_timestamp(-1), -1);
+  EXPECT_EQ(days_from_timestamp(-SECONDS_PER_DAY), -1);
+}
+
+TEST_F(DateTimeUtilsTest, ParseDate) {
+  EXPECT_EQ(date_from_string("1970-01-01"), 0);
+  EXPECT_EQ(date_from_string("1998-12-01"), 10'561);
+  EXPECT_EQ(date_from_string("2000-02-29"), 11'016);
+
+  EXPECT_EQ(date_from_string("1999-02-29"), std::nullopt);
+  EXPECT_EQ(date_from_string("1999-13-01"), std::nullopt);
+  EXPECT_EQ(date_from_string("1999-04-31"), std::nullopt);
+  EXPECT_EQ(date_from_string("1999-4-30"), std::nullopt);
+  EXPECT_EQ(date_from_string("1999/04/30"), std::nullopt);
+  EXPECT_EQ(date_from_string(""), std::nullopt);
+}
+
+TEST_F(DateTimeUtilsTest, ParseTimestamp) {
+  EXPECT_EQ(timestamp_from_string("1970-01-01"), 0);
+  EXPECT_EQ(timestamp_from_string("1970-01-02 01:02:03"), SECONDS_PER_DAY + 3723);
+  EXPECT_EQ(timestamp_from_string("1969-12-31 23:59:59"), -1);
+
+  EXPECT_EQ(timestamp_from_string("1970-01-01 24:00:00"), std::nullopt);
+  EXPECT_EQ(timestamp_from_string("1970-01-01T00:00:00"), std::nullopt);
+  EXPECT_EQ(timestamp_from_string("1970-01-01 00:00"), std::nullopt);
+}
+
+TEST_F(DateTimeUtilsTest, Print) {
+  EXPECT_EQ(date_to_string(10'561), "1998-12-01");
+  EXPECT_EQ(date_to_string(-1), "1969-12-31");
+  EXPECT_EQ(timestamp_to_string(SECONDS_PER_DAY + 3723), "1970-01-02 01:02:03");
+  EXPECT_EQ(timestamp_to_string(-1), "1969-12-31 23:59:59");
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <bitset>
+#include <unordered_set>
+
+#include "base_test.hpp"
+
+#include "utils/hash_functions.hpp"
+
+namespace opossum {
+
+class HashFunctionsTest : public BaseTest {};
+
+TEST_F(HashFunctionsTest, IntegersAreMixed) {
+  const auto hash_function = KeyHash<int32_t>{};
+
+  // Consecutive keys differ in about half of the bits of their hashes, in the lower as well as in the upper half
+  for (auto key = int32_t{1}; key < 1'000; ++key) {
+    const auto difference = hash_function(key) ^ hash_function(key - 1);
+    EXPECT_GT(std::bitset<32>(difference).count(), 4);
+    EXPECT_GT(std::bitset<32>(difference >> 32).count(), 4);
+  }
+
+  // Multiples of a power of two are spread over the lower bits
+  auto partitions = std::unordered_set<size_t>{};
+  for (auto key = int32_t{0}; key < 1'024 * 64; key += 1'024) {
+    partitions.emplace(hash_function(key) & 15);
+  }
+  EXPECT_EQ(partitions.size(), 16);
+}
+
+TEST_F(HashFunctionsTest, IntegerTypesAgree) {
+  // Joining int32_t with int64_t hashes both as int64_t, where equal values must have equal hashes
+  EXPECT_EQ(KeyHash<int32_t>{}(-17), KeyHash<int64_t>{}(int64_t{-17}));
+  EXPECT_EQ(KeyHash<int32_t>{}(42), KeyHash<int64_t>{}(int64_t{42}));
+}
+
+TEST_F(HashFunctionsTest, FloatingPointZeros) {
+  EXPECT_EQ(KeyHash<float>{}(0.0f), KeyHash<float>{}(-0.0f));
+  EXPECT_EQ(KeyHash<double>{}(0.0), KeyHash<double>{}(-0.0));
+  EXPECT_NE(KeyHash<double>{}(1.0), KeyHash<double>{}(-1.0));
+}
+
+TEST_F(HashFunctionsTest, Strings) {
+  const auto hash_function = KeyHash<pmr_string>{};
+
+  // Covers every code path of hash_bytes (empty, 1-3, 4-16, 17-48, and more than 48 bytes)
+  auto hashes = std::unordered_set<size_t>{};
+  auto string = pmr_string{};
+  for (auto length = size_t{0}; length < 200; ++length) {
+    EXPECT_EQ(hash_function(string), hash_function(pmr_string{string}));
+    EXPECT_EQ(hash_function(string), hash_bytes(string.data(), string.size()));
+    hashes.emplace(hash_function(string));
+    string += static_cast<char>('a' + length % 26);
+  }
+  EXPECT_EQ(hashes.size(), 200);
+
+  // Strings that differ in a single character or an embedded NULL
+  EXPECT_NE(hash_function("customer#000000001"), hash_function("customer#000000002"));
+  EXPECT_NE(hash_function(pmr_string{"a\0b", 3}), hash_function(pmr_string{"a\0c", 3}));
+  EXPECT_NE(hash_function(pmr_string{"a"}), hash_function(pmr_string{"a\0", 2}));
+}
+
+TEST_F(HashFunctionsTest, Seed) {
+  const auto string = pmr_string{"hash join"};
+  EXPECT_EQ(hash_bytes(string.data(), string.size(), 1), hash_bytes(string.data(), string.size(), 1));
+  EXPECT_NE(hash_bytes(string.data(), string.size(), 1), hash_bytes(string.data(), string.size(), 2));
+}
+
+}  // namespace opossum
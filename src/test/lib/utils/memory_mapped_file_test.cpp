@@ -0,0 +1,44 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+class MemoryMappedFileTest : public BaseTest {
+ protected:
+  void SetUp() override { std::remove(filename.c_str()); }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  const std::string filename = test_data_path + "memory_mapped_file_test.bin";
+};
+
+TEST_F(MemoryMappedFileTest, MapsFileContent) {
+  const auto content = std::string{"hyrise\0binary", 13};
+  {
+    auto file = std::ofstream{filename, std::ios::binary};
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+
+  const auto mapped_file = MemoryMappedFile{filename};
+  ASSERT_EQ(mapped_file.size(), content.size());
+  EXPECT_EQ(std::string(mapped_file.data(), mapped_file.size()), content);
+}
+
+TEST_F(MemoryMappedFileTest, EmptyFile) {
+  { auto file = std::ofstream{filename, std::ios::binary}; }
+
+  const auto mapped_file = MemoryMappedFile{filename};
+  EXPECT_EQ(mapped_file.size(), 0);
+  EXPECT_EQ(mapped_file.data(), nullptr);
+}
+
+TEST_F(MemoryMappedFileTest, FileDoesNotExist) {
+  EXPECT_THROW(MemoryMappedFile{"not_existing_file"}, std::logic_error);
+}
+
+}  // namespace opossum
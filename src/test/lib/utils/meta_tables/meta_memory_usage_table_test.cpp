@@ -0,0 +1,83 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table/table_index.hpp"
+#include "utils/meta_tables/meta_memory_usage_table.hpp"
+
+namespace opossum {
+
+class MetaMemoryUsageTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    _table->append({1, pmr_string{"a string that is too long for the small string optimization"}});
+    _table->append({2, pmr_string{"short"}});
+    _table->append({3, pmr_string{"another string that is too long for the small string optimization"}});
+    _table->last_chunk()->finalize();
+
+    ChunkEncoder::encode_chunk(_table->get_chunk(ChunkID{0}), _table->column_data_types(),
+                               SegmentEncodingSpec{EncodingType::Dictionary});
+    generate_chunk_pruning_statistics(_table->get_chunk(ChunkID{0}));
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+    _table->create_table_index(ColumnID{1});
+
+    Hyrise::get().storage_manager.add_table("t", _table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+  // Returns the size of the given row, or zero if there is no such row
+  static size_t size_of(const std::shared_ptr<Table>& meta_table, const AllTypeVariant& column_name,
+                        const std::string& component, const AllTypeVariant& encoding_type) {
+    // NULL does not equal NULL
+    const auto matches = [](const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+      return variant_is_null(lhs) ? variant_is_null(rhs) : lhs == rhs;
+    };
+
+    for (const auto& row : meta_table->get_rows()) {
+      if (matches(row[1], column_name) && matches(row[2], pmr_string{component}) && matches(row[3], encoding_type)) {
+        return static_cast<size_t>(boost::get<int64_t>(row[4]));
+      }
+    }
+    return 0;
+  }
+
+  std::shared_ptr<Table> generate_meta_table() const { return MetaMemoryUsageTable{}._on_generate(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MetaMemoryUsageTableTest, Breakdown) {
+  const auto meta_table = generate_meta_table();
+  const auto a = AllTypeVariant{pmr_string{"a"}};
+  const auto b = AllTypeVariant{pmr_string{"b"}};
+  const auto dictionary = AllTypeVariant{pmr_string{"Dictionary"}};
+  const auto unencoded = AllTypeVariant{pmr_string{"Unencoded"}};
+
+  const auto& chunk_0 = *_table->get_chunk(ChunkID{0});
+  const auto& chunk_1 = *_table->get_chunk(ChunkID{1});
+  const auto full = MemoryUsageCalculationMode::Full;
+  EXPECT_EQ(size_of(meta_table, a, "segments", dictionary), chunk_0.get_segment(ColumnID{0})->memory_usage(full));
+  EXPECT_EQ(size_of(meta_table, b, "segments", dictionary), chunk_0.get_segment(ColumnID{1})->memory_usage(full));
+  EXPECT_EQ(size_of(meta_table, a, "segments", unencoded), chunk_1.get_segment(ColumnID{0})->memory_usage(full));
+  EXPECT_EQ(size_of(meta_table, b, "segments", unencoded), chunk_1.get_segment(ColumnID{1})->memory_usage(full));
+
+  EXPECT_GT(size_of(meta_table, a, "pruning_statistics", NULL_VALUE), 0);
+  EXPECT_GT(size_of(meta_table, b, "pruning_statistics", NULL_VALUE), 0);
+
+  EXPECT_EQ(size_of(meta_table, a, "chunk_indexes", NULL_VALUE),
+            chunk_0.get_indexes(std::vector<ColumnID>{ColumnID{0}}).front()->memory_consumption());
+  EXPECT_EQ(size_of(meta_table, b, "chunk_indexes", NULL_VALUE), 0);
+  EXPECT_EQ(size_of(meta_table, b, "table_indexes", NULL_VALUE),
+            _table->get_table_index(ColumnID{1})->memory_consumption());
+
+  EXPECT_EQ(size_of(meta_table, NULL_VALUE, "mvcc_data", NULL_VALUE),
+            chunk_0.mvcc_data()->memory_usage() + chunk_1.mvcc_data()->memory_usage());
+}
+
+}  // namespace opossum
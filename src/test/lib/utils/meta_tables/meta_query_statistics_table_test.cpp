@@ -0,0 +1,66 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_query_statistics.hpp"
+#include "utils/load_table.hpp"
+#include "utils/meta_tables/meta_query_statistics_table.hpp"
+
+namespace opossum {
+
+class MetaQueryStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("int_int", load_table("resources/test_data/tbl/int_int.tbl", 2));
+    meta_query_statistics_table = std::make_shared<MetaQueryStatisticsTable>();
+  }
+
+  void execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  const std::shared_ptr<Table> generate_meta_table(const std::shared_ptr<AbstractMetaTable>& table) const {
+    return table->_generate();
+  }
+
+  std::shared_ptr<AbstractMetaTable> meta_query_statistics_table;
+};
+
+TEST_F(MetaQueryStatisticsTest, EmptyWithoutQueryStatistics) {
+  execute("SELECT * FROM int_int");
+  EXPECT_EQ(generate_meta_table(meta_query_statistics_table)->row_count(), 0);
+}
+
+TEST_F(MetaQueryStatisticsTest, AggregatesNormalizedQueries) {
+  Hyrise::get().query_statistics = std::make_shared<SQLQueryStatistics>();
+
+  // Both statements only differ in their literals and are aggregated
+  execute("SELECT * FROM int_int WHERE a > 200; SELECT * FROM int_int WHERE a > 12000");
+  execute("SELECT b FROM int_int");
+
+  const auto table = generate_meta_table(meta_query_statistics_table);
+  ASSERT_EQ(table->row_count(), 2);
+
+  const auto call_count_column_id = table->column_id_by_name("call_count");
+  const auto row_count_column_id = table->column_id_by_name("row_count");
+  const auto total_column_id = table->column_id_by_name("total_total_ns");
+  const auto execute_column_id = table->column_id_by_name("execute_total_ns");
+  auto call_counts = std::vector<int64_t>{};
+  auto row_counts = std::vector<int64_t>{};
+  for (const auto& row : table->get_rows()) {
+    call_counts.emplace_back(boost::get<int64_t>(row[call_count_column_id]));
+    row_counts.emplace_back(boost::get<int64_t>(row[row_count_column_id]));
+    EXPECT_GE(boost::get<int64_t>(row[total_column_id]), boost::get<int64_t>(row[execute_column_id]));
+  }
+  std::sort(call_counts.begin(), call_counts.end());
+  std::sort(row_counts.begin(), row_counts.end());
+
+  const auto expected_call_counts = std::vector<int64_t>{1, 2};
+  const auto expected_row_counts = std::vector<int64_t>{3, 3};
+  EXPECT_EQ(call_counts, expected_call_counts);
+  EXPECT_EQ(row_counts, expected_row_counts);
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "utils/meta_tables/meta_scheduler_table.hpp"
+#include "utils/meta_tables/meta_scheduler_wait_times_table.hpp"
+
+namespace opossum {
+
+class MetaSchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override { Hyrise::reset(); }
+
+  static std::shared_ptr<Table> generate_meta_table(const std::shared_ptr<AbstractMetaTable>& meta_table) {
+    return meta_table->_on_generate();
+  }
+
+  // Sums up a column of the meta table
+  static int64_t sum(const std::shared_ptr<const Table>& table, const std::string& column_name) {
+    const auto column_id = table->column_id_by_name(column_name);
+    auto sum = int64_t{0};
+    for (auto row_id = uint64_t{0}; row_id < table->row_count(); ++row_id) {
+      sum += boost::get<int64_t>(table->get_row(row_id)[column_id]);
+    }
+    return sum;
+  }
+};
+
+TEST_F(MetaSchedulerTest, EmptyWithoutNodeQueueScheduler) {
+  EXPECT_EQ(generate_meta_table(std::make_shared<MetaSchedulerTable>())->row_count(), 0);
+  EXPECT_EQ(generate_meta_table(std::make_shared<MetaSchedulerWaitTimesTable>())->row_count(), 0);
+}
+
+TEST_F(MetaSchedulerTest, WorkerStatistics) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto TASK_COUNT = int64_t{100};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = int64_t{0}; task_id < TASK_COUNT; ++task_id) {
+    const auto priority = task_id % 2 == 0 ? SchedulePriority::Default : SchedulePriority::Background;
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}, priority));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto scheduler_table = generate_meta_table(std::make_shared<MetaSchedulerTable>());
+  EXPECT_EQ(scheduler_table->row_count(), 4);
+  EXPECT_EQ(sum(scheduler_table, "finished_tasks"), TASK_COUNT);
+  EXPECT_GT(sum(scheduler_table, "busy_time_ns"), 0);
+  EXPECT_EQ(sum(scheduler_table, "deque_size"), 0);
+  EXPECT_EQ(sum(scheduler_table, "node_queue_size_default"), 0);
+
+  // Every executed task is counted in exactly one bucket of its priority
+  const auto wait_times_table = generate_meta_table(std::make_shared<MetaSchedulerWaitTimesTable>());
+  EXPECT_EQ(sum(wait_times_table, "task_count"), TASK_COUNT);
+
+  const auto priority_column_id = wait_times_table->column_id_by_name("priority");
+  for (auto row_id = uint64_t{0}; row_id < wait_times_table->row_count(); ++row_id) {
+    const auto priority = boost::get<pmr_string>(wait_times_table->get_row(row_id)[priority_column_id]);
+    EXPECT_TRUE(priority == "Default" || priority == "Background");
+  }
+}
+
+}  // namespace opossum
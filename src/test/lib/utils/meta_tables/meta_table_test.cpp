@@ -103,7 +103,8 @@ INSTANTIATE_TEST_SUITE_P(MetaTable, MultiMetaTablesTest, ::testing::ValuesIn(Met
 
 TEST_P(MultiMetaTablesTest, IsImmutable) {
   EXPECT_FALSE(GetParam()->can_insert());
-  EXPECT_FALSE(GetParam()->can_update());
+  // The target chunk size of stored tables can be changed via meta_tables
+  EXPECT_EQ(GetParam()->can_update(), GetParam()->name() == "tables");
   EXPECT_FALSE(GetParam()->can_delete());
 }
 
@@ -159,6 +160,18 @@ TEST_P(MultiMetaTablesTest, SQLFeatures) {
   EXPECT_EQ(result.second->row_count(), 1);
 }
 
+TEST_F(MetaTableTest, UpdateTargetChunkSize) {
+  const auto sql = "UPDATE meta_tables SET target_chunk_size = 5 WHERE table_name = 'int_int'";
+  EXPECT_EQ(SQLPipelineBuilder{sql}.create_pipeline().get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_EQ(int_int->target_chunk_size(), 5);
+  EXPECT_EQ(int_int_int_null->target_chunk_size(), 100);
+
+  // The other columns describe the tables and cannot be changed
+  auto sql_pipeline = SQLPipelineBuilder{"UPDATE meta_tables SET row_count = 0 WHERE table_name = 'int_int'"}
+                          .create_pipeline();
+  EXPECT_THROW(sql_pipeline.get_result_table(), InvalidInputException);
+}
+
 TEST_F(MetaTableTest, SingleGenerationInPipeline) {
   auto mock_table = std::make_shared<MetaMockTable>();
   _add_meta_table(mock_table);
@@ -0,0 +1,50 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "utils/sampling_profiler.hpp"
+
+namespace opossum {
+
+class SamplingProfilerTest : public BaseTest {
+ protected:
+  void execute_table_wrappers(const size_t count) {
+    const auto table = load_table("resources/test_data/tbl/int_int.tbl", 2);
+    for (auto execution_id = size_t{0}; execution_id < count; ++execution_id) {
+      std::make_shared<TableWrapper>(table)->execute();
+    }
+  }
+};
+
+TEST_F(SamplingProfilerTest, SamplesEveryNthOperator) {
+  const auto sampling_profiler = std::make_shared<SamplingProfiler>(3);
+  Hyrise::get().sampling_profiler = sampling_profiler;
+
+  execute_table_wrappers(7);
+
+  const auto samples = sampling_profiler->samples();
+  ASSERT_EQ(samples.size(), 3u);
+  for (const auto& sample : samples) {
+    EXPECT_EQ(sample.operator_name, "TableWrapper");
+    EXPECT_EQ(sample.output_row_count, 3u);
+    EXPECT_FALSE(sample.worker_id);
+    // Depending on the system, the hardware counters may not be available
+    EXPECT_EQ(sample.cache_misses.has_value(), sample.branch_misses.has_value());
+  }
+}
+
+TEST_F(SamplingProfilerTest, RingBufferKeepsLastSamples) {
+  const auto sampling_profiler = std::make_shared<SamplingProfiler>(1);
+  Hyrise::get().sampling_profiler = sampling_profiler;
+
+  execute_table_wrappers(SamplingProfiler::RING_BUFFER_SIZE + 10);
+  EXPECT_EQ(sampling_profiler->samples().size(), SamplingProfiler::RING_BUFFER_SIZE);
+
+  // A new profiler does not see the samples of the previous one
+  const auto new_sampling_profiler = std::make_shared<SamplingProfiler>(1);
+  Hyrise::get().sampling_profiler = new_sampling_profiler;
+  execute_table_wrappers(1);
+  EXPECT_EQ(new_sampling_profiler->samples().size(), 1u);
+}
+
+}  // namespace opossum
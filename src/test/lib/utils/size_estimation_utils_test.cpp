@@ -64,4 +64,14 @@ TEST_F(SizeEstimationUtilsTest, StringVectorExceedingSSOLengths) {
   EXPECT_EQ(string_vector_memory_usage(string_vector, MemoryUsageCalculationMode::Full), expected_size_full);
 }
 
+TEST_F(SizeEstimationUtilsTest, KnownHeapSize) {
+  const auto large_string = pmr_string(500, '#');
+  const auto string_vector = pmr_vector<pmr_string>{"a", large_string, "b", large_string};
+
+  EXPECT_EQ(string_vector_heap_size(string_vector), 2 * string_heap_size(large_string));
+  EXPECT_EQ(string_vector_heap_size(pmr_vector<int32_t>{1, 2, 3}), 0);
+  EXPECT_EQ(string_vector_memory_usage(string_vector, string_vector_heap_size(string_vector)),
+            string_vector_memory_usage(string_vector, MemoryUsageCalculationMode::Full));
+}
+
 }  // namespace opossum
@@ -0,0 +1,140 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/chunk_compression_plugin.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ChunkCompressionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  void _run_compression_loop() { _plugin._compression_loop(); }
+
+  std::vector<std::pair<std::string, ChunkID>> _find_completed_chunks() {
+    return ChunkCompressionPlugin::_find_completed_chunks();
+  }
+
+  // Inserts row_count rows into the table. Returns the transaction context, which is committed if requested.
+  std::shared_ptr<TransactionContext> _insert_rows(const size_t row_count, const bool commit = true) {
+    return _insert_rows(_table_name, row_count, commit);
+  }
+
+  std::shared_ptr<TransactionContext> _insert_rows(const std::string& table_name, const size_t row_count,
+                                                   const bool commit) {
+    const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      values->append({static_cast<int32_t>(row_index), row_index % 3 == 0 ? NULL_VALUE : AllTypeVariant{"x"}});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    if (commit) transaction_context->commit();
+    return transaction_context;
+  }
+
+  bool _is_dictionary_encoded(const ChunkID chunk_id) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      if (!std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id))) return false;
+    }
+    return true;
+  }
+
+  const std::string _table_name{"chunkCompressionTestTable"};
+  static constexpr auto _chunk_size = ChunkOffset{10};
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+  ChunkCompressionPlugin _plugin;
+};
+
+TEST_F(ChunkCompressionPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseChunkCompressionPlugin"));
+  pm.unload_plugin("hyriseChunkCompressionPlugin");
+}
+
+TEST_F(ChunkCompressionPluginTest, CompressesCompletedChunks) {
+  _insert_rows(25);
+  ASSERT_EQ(_table->chunk_count(), 3);
+
+  _run_compression_loop();
+
+  // The two full chunks are finalized, encoded, and have pruning statistics
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{1}}) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(_is_dictionary_encoded(chunk_id));
+    EXPECT_TRUE(chunk->pruning_statistics());
+  }
+
+  // The last chunk still receives inserts
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  const auto segment = _table->get_chunk(ChunkID{2})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseValueSegment>(segment));
+
+  // Further inserts go to the mutable chunk
+  _insert_rows(5);
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_EQ(_table->row_count(), 30);
+
+  _run_compression_loop();
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{2}));
+}
+
+TEST_F(ChunkCompressionPluginTest, SkipsChunksWithPendingInserts) {
+  const auto transaction_context = _insert_rows(10, false);
+  ASSERT_EQ(_table->chunk_count(), 1);
+  EXPECT_TRUE(_find_completed_chunks().empty());
+
+  _run_compression_loop();
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+
+  transaction_context->commit();
+  EXPECT_EQ(_find_completed_chunks().size(), 1);
+
+  _run_compression_loop();
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{0}));
+}
+
+TEST_F(ChunkCompressionPluginTest, InterleavesTables) {
+  const auto other_table = std::make_shared<Table>(_column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("otherTable", other_table);
+  _insert_rows("otherTable", 20, true);
+  _insert_rows(30);
+
+  const auto completed_chunks = _find_completed_chunks();
+  ASSERT_EQ(completed_chunks.size(), 5);
+  EXPECT_NE(completed_chunks[0].first, completed_chunks[1].first);
+  EXPECT_EQ(completed_chunks[0].second, ChunkID{0});
+  EXPECT_EQ(completed_chunks[1].second, ChunkID{0});
+  EXPECT_EQ(completed_chunks[2].second, ChunkID{1});
+  EXPECT_EQ(completed_chunks[3].second, ChunkID{1});
+  EXPECT_EQ(completed_chunks[4], std::make_pair(_table_name, ChunkID{2}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,171 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/clustering_plugin.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plugin_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ClusteringPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", _chunk_size);
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+    _expected_table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", _chunk_size);
+
+    Hyrise::get().storage_manager.add_table(_dummy_table_name, load_table("resources/test_data/tbl/int.tbl"));
+    Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+
+    _stored_table_node = StoredTableNode::make(_table_name);
+    _a = _stored_table_node->get_column("a");
+    _b = _stored_table_node->get_column("b");
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  // Adds the plan to the cache as if it had been executed execution_count times
+  void _cache_plan(const std::string& sql_string, const std::shared_ptr<AbstractExpression>& predicate,
+                   const size_t execution_count) {
+    const auto& lqp_cache = Hyrise::get().default_lqp_cache;
+    lqp_cache->set(sql_string, PredicateNode::make(predicate, _stored_table_node));
+    for (auto execution_id = size_t{1}; execution_id < execution_count; ++execution_id) {
+      lqp_cache->try_get(sql_string);
+    }
+  }
+
+  // Commits transactions on another table, so that the chunks of the clustered table become cold
+  void _advance_commit_ids() {
+    const auto values = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl"));
+    values->execute();
+    for (auto commit_id = CommitID{0}; commit_id < ClusteringPlugin::CLUSTERING_THRESHOLD_LAST_COMMIT; ++commit_id) {
+      const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      const auto insert = std::make_shared<Insert>(_dummy_table_name, values);
+      insert->set_transaction_context(transaction_context);
+      insert->execute();
+      transaction_context->commit();
+    }
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    transaction_context->commit();
+    return validate->get_output();
+  }
+
+  void _run_clustering_loop() { _plugin._clustering_loop(); }
+
+  std::map<std::string, ColumnID> _clustering_columns() {
+    _plugin._update_predicate_executions();
+    return _plugin._clustering_columns();
+  }
+
+  void _delete_chunks_physically() { _plugin._delete_chunks_physically(); }
+
+  const std::string _table_name{"clusteringTestTable"};
+  const std::string _dummy_table_name{"clusteringDummyTable"};
+  static constexpr auto _chunk_size = ChunkOffset{4};
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<LQPColumnExpression> _a;
+  std::shared_ptr<LQPColumnExpression> _b;
+  ClusteringPlugin _plugin;
+};
+
+TEST_F(ClusteringPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseClusteringPlugin"));
+  pm.unload_plugin("hyriseClusteringPlugin");
+}
+
+TEST_F(ClusteringPluginTest, SelectsMostFilteredColumn) {
+  _cache_plan("SELECT * FROM t WHERE a > 5", greater_than_(_a, 5), 10);
+  _cache_plan("SELECT * FROM t WHERE b = ?", equals_(_b, placeholder_(ParameterID{0})), 20);
+  _cache_plan("SELECT * FROM t WHERE a = b", equals_(_a, _b), 100);
+
+  const auto clustering_columns = _clustering_columns();
+  ASSERT_EQ(clustering_columns.size(), 1u);
+  EXPECT_EQ(clustering_columns.at(_table_name), ColumnID{1});
+
+  // Without further executions, the decayed executions of b fall behind those of a
+  _cache_plan("SELECT * FROM t WHERE a > 5", greater_than_(_a, 5), 30);
+  EXPECT_EQ(_clustering_columns().at(_table_name), ColumnID{0});
+}
+
+TEST_F(ClusteringPluginTest, IgnoresRarelyFilteredColumns) {
+  _cache_plan("SELECT * FROM t WHERE a > 5", greater_than_(_a, 5), 5);
+
+  EXPECT_TRUE(_clustering_columns().empty());
+}
+
+TEST_F(ClusteringPluginTest, ClustersColdChunks) {
+  _cache_plan("SELECT * FROM t WHERE a > 5", greater_than_(_a, 5), 10);
+
+  // Chunks that were modified recently are not clustered
+  _run_clustering_loop();
+  EXPECT_EQ(_table->chunk_count(), 4);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  _advance_commit_ids();
+  _cache_plan("SELECT * FROM t WHERE a > 5", greater_than_(_a, 5), 20);
+  _run_clustering_loop();
+
+  // The rows of the chunks 0 to 2 (the last chunk is skipped) are reinserted in chunks 4 to 6. The full chunks are
+  // finalized, encoded like the original chunks, and sorted.
+  ASSERT_EQ(_table->chunk_count(), 7);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+  EXPECT_FALSE(_table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  for (auto chunk_id = ChunkID{4}; chunk_id < 6; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(std::dynamic_pointer_cast<BaseDictionarySegment>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_EQ(chunk->individually_sorted_by(), std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  }
+  EXPECT_TRUE(_table->get_chunk(ChunkID{6})->is_mutable());
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), _expected_table);
+
+  // Without active transactions, the clustered chunks are removed from the table
+  _delete_chunks_physically();
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id));
+  }
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), _expected_table);
+
+  // Sorted chunks are not clustered again
+  _advance_commit_ids();
+  _run_clustering_loop();
+  EXPECT_EQ(_table->chunk_count(), 7);
+}
+
+}  // namespace opossum
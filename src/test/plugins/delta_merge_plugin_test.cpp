@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/delta_merge_plugin.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class DeltaMergePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size);
+    _expected_table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    _append_chunks(DeltaMergePlugin::MIN_DELTA_CHUNKS_PER_MERGE);
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  void _run_merge_loop() { _plugin._merge_loop(); }
+
+  // Appends full chunks whose values repeat across chunks and encodes them with their own dictionaries
+  void _append_chunks(const size_t chunk_count) {
+    const auto first_chunk_id = _table->chunk_count();
+    for (auto row_index = size_t{0}; row_index < chunk_count * _chunk_size; ++row_index) {
+      const auto value = static_cast<int32_t>(_expected_table->row_count() % 3);
+      const auto row = std::vector<AllTypeVariant>{value == 2 ? NULL_VALUE : AllTypeVariant{value},
+                                                   pmr_string{"value_" + std::to_string(row_index % 5)}};
+      _table->append(row);
+      _expected_table->append(row);
+    }
+    _table->last_chunk()->finalize();
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = first_chunk_id; chunk_id < _table->chunk_count(); ++chunk_id) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+    ChunkEncoder::encode_chunks(_table, chunk_ids, SegmentEncodingSpec{EncodingType::Dictionary});
+  }
+
+  template <typename T>
+  std::shared_ptr<const pmr_vector<T>> _dictionary(const ChunkID chunk_id, const ColumnID column_id) const {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(column_id);
+    return std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)->dictionary();
+  }
+
+  const std::string _table_name{"deltaMergeTestTable"};
+  static constexpr auto _chunk_size = ChunkOffset{4};
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+  DeltaMergePlugin _plugin;
+};
+
+TEST_F(DeltaMergePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseDeltaMergePlugin"));
+  pm.unload_plugin("hyriseDeltaMergePlugin");
+}
+
+TEST_F(DeltaMergePluginTest, MergesDeltaChunks) {
+  _run_merge_loop();
+
+  const auto int_dictionary = _dictionary<int32_t>(ChunkID{0}, ColumnID{0});
+  const auto string_dictionary = _dictionary<pmr_string>(ChunkID{0}, ColumnID{1});
+  EXPECT_EQ(*int_dictionary, pmr_vector<int32_t>({0, 1}));
+  EXPECT_EQ(string_dictionary->size(), 5);
+  EXPECT_TRUE(std::is_sorted(string_dictionary->cbegin(), string_dictionary->cend()));
+
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_dictionary<int32_t>(chunk_id, ColumnID{0}), int_dictionary);
+    EXPECT_EQ(_dictionary<pmr_string>(chunk_id, ColumnID{1}), string_dictionary);
+  }
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(DeltaMergePluginTest, ExtendsMainPartition) {
+  _run_merge_loop();
+  const auto main_dictionary = _dictionary<pmr_string>(ChunkID{0}, ColumnID{1});
+
+  // Too few new chunks are not merged into the main partition
+  _append_chunks(DeltaMergePlugin::MIN_DELTA_CHUNKS_PER_MERGE - 1);
+  _run_merge_loop();
+  EXPECT_EQ(_dictionary<pmr_string>(ChunkID{0}, ColumnID{1}), main_dictionary);
+  EXPECT_NE(_dictionary<pmr_string>(ChunkID{_table->chunk_count() - 1}, ColumnID{1}), main_dictionary);
+
+  _append_chunks(1);
+  _run_merge_loop();
+  const auto merged_dictionary = _dictionary<pmr_string>(ChunkID{0}, ColumnID{1});
+  EXPECT_NE(merged_dictionary, main_dictionary);
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_dictionary<pmr_string>(chunk_id, ColumnID{1}), merged_dictionary);
+  }
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(DeltaMergePluginTest, SkipsIndexedAndMutableChunks) {
+  // The index splits the run of delta chunks, so that neither part reaches MIN_DELTA_CHUNKS_PER_MERGE
+  _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  _table->append({1, pmr_string{"mutable"}});
+  _expected_table->append({1, pmr_string{"mutable"}});
+
+  _run_merge_loop();
+
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count() - 1; ++chunk_id) {
+    EXPECT_NE(_dictionary<int32_t>(chunk_id, ColumnID{0}), _dictionary<int32_t>(ChunkID{chunk_id - 1}, ColumnID{0}));
+  }
+  // The string column is not indexed, but the mutable chunk is not encoded yet
+  EXPECT_EQ(_dictionary<pmr_string>(ChunkID{1}, ColumnID{1}), _dictionary<pmr_string>(ChunkID{0}, ColumnID{1}));
+  EXPECT_TRUE(_table->last_chunk()->is_mutable());
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+}  // namespace opossum
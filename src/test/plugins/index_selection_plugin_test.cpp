@@ -0,0 +1,137 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/index_selection_plugin.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plugin_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IndexSelectionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_float.tbl", _chunk_size);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+    Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+
+    _stored_table_node = StoredTableNode::make(_table_name);
+    _a = _stored_table_node->get_column("a");
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  // Run the loop manually instead of on the plugin's thread
+  void _run_selection_loop(const size_t memory_budget = IndexSelectionPlugin::DEFAULT_MEMORY_BUDGET) {
+    _plugin._memory_budget = memory_budget;
+    _plugin._selection_loop();
+  }
+
+  void _cache_plan(const std::string& sql_string, const std::shared_ptr<AbstractExpression>& predicate) {
+    Hyrise::get().default_lqp_cache->set(sql_string, PredicateNode::make(predicate, _stored_table_node));
+  }
+
+  bool _has_chunk_index(const SegmentIndexType index_type) const {
+    return _table->get_chunk(ChunkID{0})->get_index(index_type, std::vector<ColumnID>{ColumnID{0}}) != nullptr;
+  }
+
+  const std::string _table_name{"indexSelectionTestTable"};
+  static constexpr auto _chunk_size = ChunkOffset{2};
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<LQPColumnExpression> _a;
+  IndexSelectionPlugin _plugin;
+};
+
+TEST_F(IndexSelectionPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseIndexSelectionPlugin"));
+  pm.unload_plugin("hyriseIndexSelectionPlugin");
+}
+
+TEST_F(IndexSelectionPluginTest, CreatesHashIndexForEqualityPredicates) {
+  _cache_plan("SELECT * FROM t WHERE a = 123", equals_(_a, 123));
+
+  _run_selection_loop();
+
+  const auto indexes_statistics = _table->indexes_statistics();
+  ASSERT_EQ(indexes_statistics.size(), 1u);
+  EXPECT_EQ(indexes_statistics[0].type, SegmentIndexType::Hash);
+  EXPECT_EQ(indexes_statistics[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TRUE(_has_chunk_index(SegmentIndexType::Hash));
+
+  // The cached plans are optimized again to use the index
+  EXPECT_EQ(Hyrise::get().default_lqp_cache->size(), 0u);
+}
+
+TEST_F(IndexSelectionPluginTest, CreatesGroupKeyIndexForRangePredicates) {
+  _cache_plan("SELECT * FROM t WHERE a > 123", greater_than_(_a, 123));
+
+  // GroupKeyIndexes require dictionary-encoded segments
+  _run_selection_loop();
+  EXPECT_TRUE(_table->indexes_statistics().empty());
+
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  _cache_plan("SELECT * FROM t WHERE a > 123", greater_than_(_a, 123));
+  _run_selection_loop();
+
+  const auto indexes_statistics = _table->indexes_statistics();
+  ASSERT_EQ(indexes_statistics.size(), 1u);
+  EXPECT_EQ(indexes_statistics[0].type, SegmentIndexType::GroupKey);
+  EXPECT_TRUE(_has_chunk_index(SegmentIndexType::GroupKey));
+}
+
+TEST_F(IndexSelectionPluginTest, KeepsIndexesWithinBudget) {
+  _cache_plan("SELECT * FROM t WHERE a = 123", equals_(_a, 123));
+
+  _run_selection_loop(0);
+
+  EXPECT_TRUE(_table->indexes_statistics().empty());
+  EXPECT_FALSE(_has_chunk_index(SegmentIndexType::Hash));
+}
+
+TEST_F(IndexSelectionPluginTest, DropsColdIndexesInTwoPhases) {
+  _cache_plan("SELECT * FROM t WHERE a = 123", equals_(_a, 123));
+  _run_selection_loop();
+  ASSERT_EQ(_table->indexes_statistics().size(), 1u);
+
+  // Without further executions, the benefit decays below the threshold. The index is no longer used for new plans, but
+  // remains in the chunks for running queries.
+  _run_selection_loop();
+  EXPECT_TRUE(_table->indexes_statistics().empty());
+  EXPECT_TRUE(_has_chunk_index(SegmentIndexType::Hash));
+
+  _run_selection_loop();
+  EXPECT_FALSE(_has_chunk_index(SegmentIndexType::Hash));
+}
+
+TEST_F(IndexSelectionPluginTest, KeepsManuallyCreatedIndexes) {
+  _table->create_index<HashIndex>({ColumnID{0}}, "manual");
+  _cache_plan("SELECT * FROM t WHERE a = 123", equals_(_a, 123));
+
+  _run_selection_loop();
+  _run_selection_loop();
+  _run_selection_loop();
+
+  const auto indexes_statistics = _table->indexes_statistics();
+  ASSERT_EQ(indexes_statistics.size(), 1u);
+  EXPECT_EQ(indexes_statistics[0].name, "manual");
+  EXPECT_TRUE(_has_chunk_index(SegmentIndexType::Hash));
+}
+
+}  // namespace opossum
@@ -15,6 +15,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -60,10 +61,38 @@ class MvccDeletePluginTest : public BaseTest {
     auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
     return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
   }
+  static bool _try_logical_delete(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
+    auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    return MvccDeletePlugin::_try_logical_delete(table_name, chunk_ids, transaction_context);
+  }
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   std::shared_ptr<TransactionContext> transaction_context) {
     return MvccDeletePlugin::_try_logical_delete(table_name, chunk_id, transaction_context);
   }
+  // Candidates are given as (chunk id, valid row count, reclaimable memory, exceeds delete threshold)
+  static std::vector<std::vector<ChunkID>> _group_candidates(
+      const std::vector<std::tuple<ChunkID, ChunkOffset, size_t, bool>>& candidates, const ChunkOffset chunk_size) {
+    auto delete_candidates = std::vector<MvccDeletePlugin::DeleteCandidate>{};
+    for (const auto& [chunk_id, valid_row_count, reclaimable_memory, exceeds_delete_threshold] : candidates) {
+      delete_candidates.push_back({chunk_id, valid_row_count, reclaimable_memory, reclaimable_memory,
+                                   exceeds_delete_threshold});
+    }
+    return MvccDeletePlugin::_group_candidates(std::move(delete_candidates), chunk_size);
+  }
+  static double _delete_threshold(MvccDeletePlugin& plugin, const uint64_t invalid_row_count,
+                                  const uint64_t row_count) {
+    return plugin._delete_threshold("table", invalid_row_count, row_count);
+  }
+  static void _logical_delete_loop(MvccDeletePlugin& plugin) { plugin._logical_delete_loop(); }
+  // Appends an immutable chunk with a single row for each of the values, followed by a mutable chunk with last_value
+  static void _append_small_chunks(Table& table, const std::vector<int32_t>& values, const int32_t last_value) {
+    for (const auto value : values) {
+      const auto segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{value});
+      table.append_chunk(Segments{segment}, std::make_shared<MvccData>(1, CommitID{0}));
+      table.last_chunk()->finalize();
+    }
+    table.append({last_value});
+  }
   static void _delete_chunk_physically(const std::string& table_name, ChunkID chunk_id) {
     MvccDeletePlugin::_delete_chunk_physically(Hyrise::get().storage_manager.get_table(table_name), chunk_id);
   }
@@ -179,6 +208,64 @@ TEST_F(MvccDeletePluginTest, LogicalDeleteConflicts) {
   EXPECT_EQ(transaction_context->phase(), TransactionPhase::RolledBackAfterConflict);
 }
 
+/**
+ * This test checks that several small chunks are merged by deleting them logically in a single transaction. Their
+ * valid rows are reinserted together.
+ */
+TEST_F(MvccDeletePluginTest, LogicalDeleteMergesChunks) {
+  const auto table_name = std::string{"mvccMergeTestTable"};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             _chunk_size, UseMvcc::Yes);
+  _append_small_chunks(*table, {10, 20}, 30);
+  Hyrise::get().storage_manager.add_table(table_name, table);
+
+  EXPECT_TRUE(_try_logical_delete(table_name, std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+
+  // --- Expected: _ | _ | 30, 10, 20
+  EXPECT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 3);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{1}), 10);
+  EXPECT_EQ(_get_int_value_from_table(table, ChunkID{2}, ColumnID{0}, ChunkOffset{2}), 20);
+}
+
+/**
+ * This test checks that the chunk that merged rows are reinserted into is finalized and encoded, even though it is not
+ * full. Further inserts continue in a new chunk.
+ */
+TEST_F(MvccDeletePluginTest, MergedChunkIsEncoded) {
+  const auto table_name = std::string{"mvccMergeTestTable"};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{8}, UseMvcc::Yes);
+  _append_small_chunks(*table, {10, 20}, 30);
+  Hyrise::get().storage_manager.add_table(table_name, table);
+
+  // Only chunks that were not modified recently are merged
+  for (auto commit_id = CommitID{0}; commit_id < MvccDeletePlugin::DELETE_THRESHOLD_LAST_COMMIT; ++commit_id) {
+    Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No)->commit();
+  }
+
+  auto plugin = MvccDeletePlugin{};
+  _logical_delete_loop(plugin);
+
+  // --- Expected: _ | _ | 30, 10, 20
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  ASSERT_EQ(table->chunk_count(), 3);
+  const auto merged_chunk = table->get_chunk(ChunkID{2});
+  EXPECT_EQ(merged_chunk->size(), 3);
+  EXPECT_FALSE(merged_chunk->is_mutable());
+  EXPECT_NE(get_segment_encoding_spec(merged_chunk->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::Unencoded);
+
+  // --- Expected: _ | _ | 30, 10, 20 | 40
+  auto sql_pipeline = SQLPipelineBuilder{"INSERT INTO " + table_name + " VALUES (40)"}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_EQ(table->chunk_count(), 4);
+  EXPECT_EQ(merged_chunk->size(), 3);
+}
+
 /**
  * This test checks the physical delete of the MvccDeletePlugin. At first,
  * the logical delete is performed as described in the former test. Afterwards,
@@ -208,4 +295,50 @@ TEST_F(MvccDeletePluginTest, PhysicalDelete) {
   EXPECT_TRUE(table->get_chunk(chunk_to_delete_id) == nullptr);
 }
 
+/**
+ * This test checks that candidates are ranked by their reclaimable memory and packed into groups whose valid rows fit
+ * into one chunk. Small chunks that are not merged with others are not deleted.
+ */
+TEST_F(MvccDeletePluginTest, GroupCandidates) {
+  const auto groups = _group_candidates({{ChunkID{0}, ChunkOffset{1}, 100, false},
+                                         {ChunkID{1}, ChunkOffset{3}, 300, true},
+                                         {ChunkID{2}, ChunkOffset{2}, 200, true},
+                                         {ChunkID{3}, ChunkOffset{1}, 400, false},
+                                         {ChunkID{4}, ChunkOffset{3}, 50, false}},
+                                        ChunkOffset{4});
+
+  // Chunk 3 and chunk 1 fill the first group, chunk 2 and chunk 0 the second one. Chunk 4 remains on its own.
+  const auto expected_groups =
+      std::vector<std::vector<ChunkID>>{{ChunkID{1}, ChunkID{3}}, {ChunkID{0}, ChunkID{2}}};
+  EXPECT_EQ(groups, expected_groups);
+
+  EXPECT_TRUE(_group_candidates({}, ChunkOffset{4}).empty());
+  EXPECT_EQ(_group_candidates({{ChunkID{5}, ChunkOffset{0}, 10, true}}, ChunkOffset{4}).size(), 1);
+}
+
+/**
+ * This test checks that the delete threshold decreases with the number of rows invalidated since the previous
+ * iteration.
+ */
+TEST_F(MvccDeletePluginTest, AdaptiveDeleteThreshold) {
+  auto plugin = MvccDeletePlugin{};
+  constexpr auto MAX_THRESHOLD = MvccDeletePlugin::DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS;
+  constexpr auto MIN_THRESHOLD = MvccDeletePlugin::MIN_DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS;
+
+  EXPECT_DOUBLE_EQ(_delete_threshold(plugin, 100, 10'000), MAX_THRESHOLD);
+
+  // No further invalidations
+  EXPECT_DOUBLE_EQ(_delete_threshold(plugin, 100, 10'000), MAX_THRESHOLD);
+
+  // Half the rate from which on the lowest threshold is used
+  const auto half_rate_row_count =
+      static_cast<uint64_t>(10'000 * MvccDeletePlugin::HIGH_UPDATE_RATE_PERCENTAGE_INVALIDATED_ROWS / 2);
+  EXPECT_DOUBLE_EQ(_delete_threshold(plugin, 100 + half_rate_row_count, 10'000), (MAX_THRESHOLD + MIN_THRESHOLD) / 2);
+
+  EXPECT_DOUBLE_EQ(_delete_threshold(plugin, 5'000, 10'000), MIN_THRESHOLD);
+
+  // Deleted chunks reduce the number of invalidated rows
+  EXPECT_DOUBLE_EQ(_delete_threshold(plugin, 1'000, 10'000), MAX_THRESHOLD);
+}
+
 }  // namespace opossum
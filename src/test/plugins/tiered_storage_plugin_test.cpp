@@ -0,0 +1,176 @@
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/tiered_storage_plugin.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class TieredStoragePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_string.tbl", _chunk_size);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+    _expected_table = load_table("resources/test_data/tbl/int_string.tbl", _chunk_size);
+
+    // Run the loop manually instead of on the plugin's thread
+    _plugin._memory_resource = std::make_unique<FileBackedMemoryResource>(test_data_path + "tiered_storage_test.bin");
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  void _run_tiering_loop(const size_t memory_budget) {
+    _plugin._memory_budget = memory_budget;
+    _plugin._tiering_loop();
+  }
+
+  bool _is_evicted(const ChunkID chunk_id) const {
+    return _plugin._evicted_chunks.contains(TieredStoragePlugin::TableAndChunkID{_table_name, chunk_id});
+  }
+
+  size_t _evicted_chunk_count() const { return _plugin._evicted_chunks.size(); }
+
+  size_t _file_size() const { return std::filesystem::file_size(_plugin._memory_resource->path()); }
+
+  const std::string _table_name{"tieredStorageTestTable"};
+  static constexpr auto _chunk_size = ChunkOffset{2};
+  static constexpr auto _unlimited_budget = std::numeric_limits<size_t>::max();
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+  TieredStoragePlugin _plugin;
+};
+
+TEST_F(TieredStoragePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseTieredStoragePlugin"));
+  pm.unload_plugin("hyriseTieredStoragePlugin");
+}
+
+TEST_F(TieredStoragePluginTest, MemoryBudgetSetting) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseTieredStoragePlugin"));
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("TieredStoragePlugin.memory_budget");
+  EXPECT_GT(std::stoull(setting->get()), 0);
+  setting->set("1024");
+  EXPECT_EQ(setting->get(), "1024");
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+
+  pm.unload_plugin("hyriseTieredStoragePlugin");
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("TieredStoragePlugin.memory_budget"));
+}
+
+TEST_F(TieredStoragePluginTest, MemoryResourceReusesDeallocatedMemory) {
+  auto& memory_resource = *_plugin._memory_resource;
+
+  auto* const first = memory_resource.allocate(1'000, 8);
+  auto* const second = memory_resource.allocate(2'000, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % 64, 0);
+
+  // Freeing both neighboring ranges merges them, so a larger allocation fits into their space
+  memory_resource.deallocate(first, 1'000, 8);
+  memory_resource.deallocate(second, 2'000, 64);
+  auto* const third = memory_resource.allocate(3'000, 8);
+  EXPECT_EQ(third, first);
+
+  // Allocations larger than an extent get their own extent
+  auto* const large = memory_resource.allocate(FileBackedMemoryResource::EXTENT_SIZE + 1, 8);
+  const auto file_size = _file_size();
+  EXPECT_GT(file_size, FileBackedMemoryResource::EXTENT_SIZE);
+  memory_resource.deallocate(large, FileBackedMemoryResource::EXTENT_SIZE + 1, 8);
+  EXPECT_EQ(memory_resource.allocate(FileBackedMemoryResource::EXTENT_SIZE, 8), large);
+  EXPECT_EQ(_file_size(), file_size);
+}
+
+TEST_F(TieredStoragePluginTest, RepeatedEvictionsDoNotGrowFile) {
+  _run_tiering_loop(0);
+  const auto file_size = _file_size();
+
+  for (auto iteration = 0; iteration < 3; ++iteration) {
+    // Promote all chunks and evict them again
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      _table->get_chunk(chunk_id)->get_segment(ColumnID{0})->access_counter[SegmentAccessCounter::AccessType::Point] +=
+          TieredStoragePlugin::HOT_CHUNK_ACCESS_THRESHOLD;
+    }
+    _run_tiering_loop(_unlimited_budget);
+    EXPECT_EQ(_evicted_chunk_count(), 0);
+    _run_tiering_loop(0);
+  }
+
+  EXPECT_EQ(_file_size(), file_size);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(TieredStoragePluginTest, KeepsChunksWithinBudget) {
+  _run_tiering_loop(_unlimited_budget);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(_is_evicted(chunk_id));
+  }
+}
+
+TEST_F(TieredStoragePluginTest, EvictsColdChunksTransparently) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  _run_tiering_loop(0);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(_is_evicted(chunk_id));
+  }
+  EXPECT_NE(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segment);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // Unloading moves the chunks back to DRAM
+  _plugin.stop();
+  EXPECT_EQ(_evicted_chunk_count(), 0);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(TieredStoragePluginTest, EvictsColdestChunkFirst) {
+  const auto chunk_memory = _table->get_chunk(ChunkID{0})->memory_usage(MemoryUsageCalculationMode::Sampled);
+  auto total_size = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    total_size += _table->get_chunk(chunk_id)->memory_usage(MemoryUsageCalculationMode::Sampled);
+  }
+
+  // All chunks except for chunk 0 are accessed
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    _table->get_chunk(chunk_id)->get_segment(ColumnID{0})->access_counter[SegmentAccessCounter::AccessType::Point] += 1;
+  }
+
+  // The budget only requires a single chunk to be evicted
+  _run_tiering_loop(total_size - chunk_memory);
+
+  EXPECT_TRUE(_is_evicted(ChunkID{0}));
+  for (auto chunk_id = ChunkID{1}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(_is_evicted(chunk_id));
+  }
+}
+
+TEST_F(TieredStoragePluginTest, PromotesHotChunks) {
+  _run_tiering_loop(0);
+  ASSERT_TRUE(_is_evicted(ChunkID{0}));
+
+  _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->access_counter[SegmentAccessCounter::AccessType::Random] +=
+      TieredStoragePlugin::HOT_CHUNK_ACCESS_THRESHOLD;
+  _run_tiering_loop(_unlimited_budget);
+
+  EXPECT_FALSE(_is_evicted(ChunkID{0}));
+  EXPECT_TRUE(_is_evicted(ChunkID{1}));
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/ucc_discovery_plugin.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/table_key_constraint.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class UccDiscoveryPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"unique", DataType::Int, false},
+                                                           {"duplicates", DataType::String, false},
+                                                           {"nullable", DataType::Int, true},
+                                                           {"encoded_unique", DataType::Long, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    _append_rows(3 * _chunk_size);
+  }
+
+  void TearDown() override {
+    _plugin.stop();
+    Hyrise::reset();
+  }
+
+ protected:
+  void _run_discovery_loop() { _plugin._discovery_loop(); }
+
+  void _append_rows(const size_t row_count) {
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      const auto value = static_cast<int32_t>(_table->row_count());
+      _table->append({value, pmr_string{"value_" + std::to_string(value % 3)},
+                      value == 5 ? NULL_VALUE : AllTypeVariant{value}, int64_t{1'000 * value}});
+    }
+  }
+
+  // Finalizes the last chunk and encodes all chunks
+  void _finalize_and_encode() {
+    _table->last_chunk()->finalize();
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+    ChunkEncoder::encode_chunks(_table, chunk_ids, SegmentEncodingSpec{EncodingType::Dictionary});
+  }
+
+  bool _is_discovered(const ColumnID column_id) const {
+    const auto key_constraints = _table->discovered_soft_key_constraints();
+    return std::find(key_constraints.cbegin(), key_constraints.cend(),
+                     TableKeyConstraint{{column_id}, KeyConstraintType::UNIQUE}) != key_constraints.cend();
+  }
+
+  const std::string _table_name{"uccDiscoveryTestTable"};
+  static constexpr auto _chunk_size = ChunkOffset{4};
+  std::shared_ptr<Table> _table;
+  UccDiscoveryPlugin _plugin;
+};
+
+TEST_F(UccDiscoveryPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseUccDiscoveryPlugin"));
+  pm.unload_plugin("hyriseUccDiscoveryPlugin");
+}
+
+TEST_F(UccDiscoveryPluginTest, DiscoversUniqueColumns) {
+  // The last chunk is still mutable
+  _run_discovery_loop();
+  EXPECT_TRUE(_table->discovered_soft_key_constraints().empty());
+
+  _finalize_and_encode();
+  _run_discovery_loop();
+
+  EXPECT_EQ(_table->discovered_soft_key_constraints().size(), 2);
+  EXPECT_TRUE(_is_discovered(ColumnID{0}));
+  EXPECT_FALSE(_is_discovered(ColumnID{1}));
+  EXPECT_FALSE(_is_discovered(ColumnID{2}));
+  EXPECT_TRUE(_is_discovered(ColumnID{3}));
+
+  // The discovered constraints are visible to the optimizer
+  const auto stored_table_node = StoredTableNode::make(_table_name);
+  EXPECT_EQ(stored_table_node->unique_constraints()->size(), 2);
+}
+
+TEST_F(UccDiscoveryPluginTest, DropsConstraintsOnAppend) {
+  _finalize_and_encode();
+  _run_discovery_loop();
+  EXPECT_EQ(_table->discovered_soft_key_constraints().size(), 2);
+
+  // The new value in the "unique" column is a duplicate, the table is not validated while the new chunk is mutable
+  _table->append({int32_t{0}, pmr_string{"value_new"}, int32_t{100}, int64_t{-1}});
+  EXPECT_TRUE(_table->discovered_soft_key_constraints().empty());
+  _run_discovery_loop();
+  EXPECT_TRUE(_table->discovered_soft_key_constraints().empty());
+
+  _table->last_chunk()->finalize();
+  _run_discovery_loop();
+  EXPECT_EQ(_table->discovered_soft_key_constraints().size(), 1);
+  EXPECT_TRUE(_is_discovered(ColumnID{3}));
+}
+
+TEST_F(UccDiscoveryPluginTest, SkipsDeclaredConstraints) {
+  _table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  _finalize_and_encode();
+  _run_discovery_loop();
+
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+  EXPECT_EQ(_table->discovered_soft_key_constraints().size(), 1);
+  EXPECT_TRUE(_is_discovered(ColumnID{3}));
+}
+
+}  // namespace opossum
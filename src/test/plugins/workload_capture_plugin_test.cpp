@@ -0,0 +1,60 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/workload_capture_plugin.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_workload_recorder.hpp"
+#include "utils/plugin_manager.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+class WorkloadCapturePluginTest : public BaseTest {
+ public:
+  void TearDown() override {
+    _plugin.stop();
+    std::filesystem::remove(WorkloadCapturePlugin::DEFAULT_LOG_PATH);
+  }
+
+ protected:
+  WorkloadCapturePlugin _plugin;
+};
+
+TEST_F(WorkloadCapturePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseWorkloadCapturePlugin"));
+  EXPECT_TRUE(Hyrise::get().workload_recorder);
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("WorkloadCapturePlugin.log_path"));
+
+  pm.unload_plugin("hyriseWorkloadCapturePlugin");
+  EXPECT_FALSE(Hyrise::get().workload_recorder);
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("WorkloadCapturePlugin.log_path"));
+}
+
+TEST_F(WorkloadCapturePluginTest, SwitchLogPath) {
+  _plugin.start();
+
+  const auto log_path = test_data_path + "workload_capture.log";
+  const auto setting = Hyrise::get().settings_manager.get_setting("WorkloadCapturePlugin.log_path");
+  EXPECT_EQ(setting->get(), WorkloadCapturePlugin::DEFAULT_LOG_PATH);
+  setting->set(log_path);
+  EXPECT_EQ(setting->get(), log_path);
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT 1"}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  // Unloading flushes the log
+  _plugin.stop();
+  EXPECT_FALSE(Hyrise::get().workload_recorder);
+
+  const auto records = SQLWorkloadRecorder::read(log_path);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].sql, "SELECT 1");
+  EXPECT_TRUE(SQLWorkloadRecorder::read(WorkloadCapturePlugin::DEFAULT_LOG_PATH).empty());
+}
+
+}  // namespace opossum